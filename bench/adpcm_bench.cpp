@@ -0,0 +1,246 @@
+// ============================================================================
+// ADPCM kernel bench (host)
+// ----------------------------------------------------------------------------
+// Kiểm tra AdpcmCodec (kernel bảng + block) bit-exact với IMA ADPCM cổ điển
+// (bản cũ, copy nguyên bên dưới) và đo thời gian / cycles mỗi sample.
+//
+//   g++ -O2 -std=c++17 -Ilib/audio bench/adpcm_bench.cpp lib/audio/AdpcmCodec.cpp -o adpcm_bench
+//   ./adpcm_bench
+//
+// Hoặc build cùng bench host (bench/CMakeLists.txt, ctest "adpcm_bitexact").
+//
+// Exit code != 0 nếu có sai khác.
+// ============================================================================
+#include "AdpcmCodec.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64_t cycles() { return __rdtsc(); }
+#define HAVE_CYCLES 1
+#else
+static inline uint64_t cycles() { return 0; }
+#define HAVE_CYCLES 0
+#endif
+
+// ----------------------------------------------------------------------------
+// Reference: the original per-sample IMA loop
+// ----------------------------------------------------------------------------
+namespace ref
+{
+static const int8_t indexTable[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8};
+
+static const int16_t stepTable[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+struct State
+{
+    int predictor = 0;
+    int index = 0;
+};
+
+size_t encode(State &st, const int16_t *pcm, size_t n, uint8_t *out, size_t cap)
+{
+    int predictor = st.predictor, index = st.index, step = stepTable[index];
+    size_t o = 0;
+    uint8_t byte = 0;
+    bool high = false;
+    for (size_t i = 0; i < n && o < cap; ++i)
+    {
+        int diff = pcm[i] - predictor;
+        int sign = (diff < 0) ? 8 : 0;
+        if (sign)
+            diff = -diff;
+        int delta = 0, t = step;
+        if (diff >= t) { delta |= 4; diff -= t; }
+        t >>= 1;
+        if (diff >= t) { delta |= 2; diff -= t; }
+        t >>= 1;
+        if (diff >= t) delta |= 1;
+        int nibble = delta | sign;
+        int dq = step >> 3;
+        if (delta & 1) dq += step >> 2;
+        if (delta & 2) dq += step >> 1;
+        if (delta & 4) dq += step;
+        predictor = std::clamp(predictor + (sign ? -dq : dq), -32768, 32767);
+        index = std::clamp(index + indexTable[nibble], 0, 88);
+        step = stepTable[index];
+        if (!high) { byte = (nibble & 0x0F) << 4; high = true; }
+        else { out[o++] = byte | (nibble & 0x0F); high = false; }
+    }
+    if (high && o < cap)
+        out[o++] = byte;
+    st.predictor = predictor;
+    st.index = index;
+    return o;
+}
+
+size_t decode(State &st, const uint8_t *in, size_t len, int16_t *pcm, size_t cap)
+{
+    int predictor = st.predictor, index = st.index, step = stepTable[index];
+    size_t o = 0;
+    for (size_t i = 0; i < len && o < cap; ++i)
+    {
+        for (int shift = 4; shift >= 0; shift -= 4)
+        {
+            int nibble = (in[i] >> shift) & 0x0F;
+            int delta = nibble & 7;
+            int dq = step >> 3;
+            if (delta & 4) dq += step;
+            if (delta & 2) dq += step >> 1;
+            if (delta & 1) dq += step >> 2;
+            predictor = std::clamp(predictor + ((nibble & 8) ? -dq : dq), -32768, 32767);
+            index = std::clamp(index + indexTable[nibble], 0, 88);
+            step = stepTable[index];
+            pcm[o++] = predictor;
+            if (o >= cap)
+                break;
+        }
+    }
+    st.predictor = predictor;
+    st.index = index;
+    return o;
+}
+} // namespace ref
+
+// ----------------------------------------------------------------------------
+// Test signals
+// ----------------------------------------------------------------------------
+static std::vector<int16_t> makeSignal(size_t n)
+{
+    std::vector<int16_t> s(n);
+    std::mt19937 rng(1234);
+    std::uniform_int_distribution<int> noise(-32768, 32767);
+    for (size_t i = 0; i < n; i++)
+    {
+        size_t seg = (i / 16000) % 5;
+        double t = i / 16000.0;
+        double v = 0;
+        switch (seg)
+        {
+        case 0: v = 12000 * sin(2 * M_PI * (200 + 1800 * t) * t); break;  // sweep
+        case 1: v = noise(rng); break;                                     // full-scale noise
+        case 2: v = ((i / 20) & 1) ? 32767 : -32768; break;                // rail-to-rail square
+        case 3: v = 0; break;                                              // silence
+        default: v = 3000 * sin(2 * M_PI * 440 * t) + noise(rng) / 16; break;
+        }
+        s[i] = static_cast<int16_t>(std::clamp(v, -32768.0, 32767.0));
+    }
+    return s;
+}
+
+// ----------------------------------------------------------------------------
+// Bit-exactness
+// ----------------------------------------------------------------------------
+static bool checkExact(const std::vector<int16_t> &pcm)
+{
+    AdpcmCodec codec;
+    ref::State re, rd;
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<size_t> frame(1, 600);
+
+    std::vector<uint8_t> a(400), b(400);
+    std::vector<int16_t> pa(800), pb(800);
+    size_t pos = 0, frames = 0;
+
+    while (pos < pcm.size())
+    {
+        // Mix of the real frame size, odd sizes and short output buffers
+        size_t n = (frames % 3 == 0) ? 256 : std::min(frame(rng), pcm.size() - pos);
+        n = std::min(n, pcm.size() - pos);
+        size_t cap = (frames % 7 == 0) ? n / 3 : (n + 1) / 2;
+
+        size_t la = codec.encode(&pcm[pos], n, a.data(), cap);
+        size_t lb = ref::encode(re, &pcm[pos], n, b.data(), cap);
+        if (la != lb || memcmp(a.data(), b.data(), la) != 0)
+        {
+            printf("encode mismatch at sample %zu (frame %zu, n=%zu)\n", pos, frames, n);
+            return false;
+        }
+
+        size_t pcap = (frames % 5 == 0) ? la * 2 - 1 : la * 2;
+        size_t da = codec.decode(a.data(), la, pa.data(), pcap);
+        size_t db = ref::decode(rd, b.data(), lb, pb.data(), pcap);
+        if (da != db || memcmp(pa.data(), pb.data(), da * sizeof(int16_t)) != 0)
+        {
+            printf("decode mismatch at sample %zu (frame %zu)\n", pos, frames);
+            return false;
+        }
+
+        pos += n;
+        frames++;
+    }
+    printf("bit-exact: %zu frames, %zu samples OK\n", frames, pcm.size());
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Timing
+// ----------------------------------------------------------------------------
+template <typename F>
+static void bench(const char *label, size_t samples, F &&fn)
+{
+    const int reps = 20;
+    auto t0 = std::chrono::steady_clock::now();
+    uint64_t c0 = cycles();
+    for (int r = 0; r < reps; r++)
+        fn();
+    uint64_t c1 = cycles();
+    auto t1 = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / (double(samples) * reps);
+    if (HAVE_CYCLES)
+        printf("  %-22s %6.2f ns/sample  %6.2f cycles/sample\n", label, ns, double(c1 - c0) / (double(samples) * reps));
+    else
+        printf("  %-22s %6.2f ns/sample\n", label, ns);
+}
+
+int main()
+{
+    const size_t N = 16000 * 10; // 10 s @16 kHz
+    std::vector<int16_t> pcm = makeSignal(N);
+
+    if (!checkExact(pcm))
+        return 1;
+
+    const size_t FRAME = 256;
+    std::vector<uint8_t> enc(N / 2);
+    std::vector<int16_t> dec(N);
+
+    printf("timing (%zu-sample frames):\n", FRAME);
+    bench("ref encode", N, [&] {
+        ref::State st;
+        for (size_t i = 0; i < N; i += FRAME)
+            ref::encode(st, &pcm[i], FRAME, &enc[i / 2], FRAME / 2);
+    });
+    bench("block encode", N, [&] {
+        AdpcmCodec::AdpcmState st;
+        for (size_t i = 0; i < N; i += FRAME)
+            AdpcmCodec::encodeBlock(st, &pcm[i], FRAME / 2, &enc[i / 2]);
+    });
+    bench("ref decode", N, [&] {
+        ref::State st;
+        for (size_t i = 0; i < N; i += FRAME)
+            ref::decode(st, &enc[i / 2], FRAME / 2, &dec[i], FRAME);
+    });
+    bench("block decode", N, [&] {
+        AdpcmCodec::AdpcmState st;
+        for (size_t i = 0; i < N; i += FRAME)
+            AdpcmCodec::decodeBlock(st, &enc[i / 2], FRAME / 2, &dec[i]);
+    });
+    return 0;
+}
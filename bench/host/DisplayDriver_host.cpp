@@ -0,0 +1,110 @@
+// ============================================================================
+// DisplayDriver (host)
+// ----------------------------------------------------------------------------
+// Thay cho lib/display/DisplayDriver.cpp khi build trên Linux: không có SPI,
+// pixel đi vào một sink (đếm + checksum) thay vì panel. Chỉ có các hàm
+// AnimationPlayer cần (setWindow / writePixels / đường queued DMA).
+// ============================================================================
+#include "DisplayDriver.hpp"
+#include "HostDisplay.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+    uint64_t s_pixels = 0;
+    uint32_t s_windows = 0;
+    uint32_t s_hash = 2166136261u;
+
+    void sink(const uint16_t *px, size_t len_bytes)
+    {
+        const auto *p = reinterpret_cast<const uint8_t *>(px);
+        uint32_t h = s_hash;
+        for (size_t i = 0; i < len_bytes; i++)
+            h = (h ^ p[i]) * 16777619u;
+        s_hash = h;
+        s_pixels += len_bytes / sizeof(uint16_t);
+    }
+} // namespace
+
+namespace host_display
+{
+    uint64_t pixelsWritten() { return s_pixels; }
+    uint32_t windows() { return s_windows; }
+    uint32_t checksum() { return s_hash; }
+    void reset()
+    {
+        s_pixels = 0;
+        s_windows = 0;
+        s_hash = 2166136261u;
+    }
+} // namespace host_display
+
+DisplayDriver::DisplayDriver() = default;
+
+DisplayDriver::~DisplayDriver()
+{
+    for (int i = 0; i < MAX_DMA_BUFFERS; i++)
+        free(dma_bufs_[i]);
+    free(line_buf_);
+}
+
+size_t DisplayDriver::bufferPoolBytes(const Config &cfg)
+{
+    const size_t line = (size_t)std::max(cfg.width, cfg.height) * sizeof(uint16_t);
+    return line * ((size_t)cfg.dma_buffer_count * cfg.dma_lines + 1);
+}
+
+bool DisplayDriver::init(const Config &cfg)
+{
+    cfg_ = cfg;
+    width_ = cfg.width;
+    height_ = cfg.height;
+    initDmaBuffers();
+    initialized = true;
+    return true;
+}
+
+void DisplayDriver::initDmaBuffers()
+{
+    const size_t line_bytes = (size_t)std::max(width_, height_) * sizeof(uint16_t);
+    line_buf_ = (uint16_t *)malloc(line_bytes);
+
+    const int count = std::min<int>(cfg_.dma_buffer_count, MAX_DMA_BUFFERS);
+    for (int i = 0; i < count && cfg_.dma_lines; i++)
+    {
+        dma_bufs_[i] = (uint16_t *)malloc(line_bytes * cfg_.dma_lines);
+        dma_buf_count_ = i + 1;
+    }
+    dma_buf_bytes_ = dma_buf_count_ ? line_bytes * cfg_.dma_lines : 0;
+}
+
+void DisplayDriver::setWindow(uint16_t, uint16_t, uint16_t, uint16_t)
+{
+    s_windows++;
+}
+
+void DisplayDriver::writePixels(const uint16_t *buffer, size_t len_bytes)
+{
+    sink(buffer, len_bytes);
+}
+
+uint16_t *DisplayDriver::acquirePixelBuffer()
+{
+    if (!initialized || dma_buf_count_ == 0)
+        return nullptr;
+    uint16_t *buf = dma_bufs_[dma_next_];
+    dma_next_ = (dma_next_ + 1) % dma_buf_count_;
+    return buf;
+}
+
+void DisplayDriver::queuePixels(const uint16_t *buffer, size_t len_bytes)
+{
+    // "Transmitted" at once: the buffer is free again on return
+    sink(buffer, len_bytes);
+}
+
+void DisplayDriver::flushPixels()
+{
+}
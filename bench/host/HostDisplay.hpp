@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Pixel sink of the host DisplayDriver (DisplayDriver_host.cpp): what a
+// render pushed "over SPI", for checks in the benches.
+namespace host_display
+{
+    uint64_t pixelsWritten();
+    uint32_t windows();
+    // FNV-1a over every pixel byte since the last reset()
+    uint32_t checksum();
+    void reset();
+} // namespace host_display
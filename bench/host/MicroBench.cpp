@@ -0,0 +1,258 @@
+#include "MicroBench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
+namespace microbench
+{
+    namespace
+    {
+        struct Entry
+        {
+            std::string name;
+            Fn fn;
+            int64_t arg;
+        };
+
+        std::vector<Entry> &registry()
+        {
+            static std::vector<Entry> r;
+            return r;
+        }
+
+        int64_t nowNs()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        struct Options
+        {
+            std::string filter;
+            std::string save;
+            std::string baseline;
+            double min_time = 0.2;   // seconds per repetition
+            double threshold = 1.15; // allowed slowdown vs baseline
+            int repeat = 3;
+            bool list = false;
+        };
+
+        bool flag(const char *arg, const char *name, std::string &out)
+        {
+            const size_t n = strlen(name);
+            if (strncmp(arg, name, n) != 0 || arg[n] != '=')
+                return false;
+            out = arg + n + 1;
+            return true;
+        }
+
+        bool parse(int argc, char **argv, Options &o)
+        {
+            for (int i = 1; i < argc; i++)
+            {
+                std::string v;
+                if (flag(argv[i], "--filter", v))
+                    o.filter = v;
+                else if (flag(argv[i], "--save", v))
+                    o.save = v;
+                else if (flag(argv[i], "--baseline", v))
+                    o.baseline = v;
+                else if (flag(argv[i], "--min-time", v))
+                    o.min_time = atof(v.c_str());
+                else if (flag(argv[i], "--threshold", v))
+                    o.threshold = atof(v.c_str());
+                else if (flag(argv[i], "--repeat", v))
+                    o.repeat = std::max(1, atoi(v.c_str()));
+                else if (strcmp(argv[i], "--list") == 0)
+                    o.list = true;
+                else
+                {
+                    fprintf(stderr,
+                            "usage: %s [--filter=S] [--min-time=SEC] [--repeat=N] [--save=FILE]\n"
+                            "          [--baseline=FILE] [--threshold=X] [--list]\n",
+                            argv[0]);
+                    return false;
+                }
+            }
+            return o.min_time > 0 && o.threshold >= 1.0;
+        }
+
+        std::map<std::string, double> loadBaseline(const std::string &path)
+        {
+            std::map<std::string, double> m;
+            std::ifstream in(path);
+            std::string name;
+            double ns;
+            while (in >> name >> ns)
+                m[name] = ns;
+            return m;
+        }
+
+        void printRate(const char *unit, double per_sec)
+        {
+            if (per_sec >= 1e9)
+                printf("  %8.2f G%s/s", per_sec / 1e9, unit);
+            else if (per_sec >= 1e6)
+                printf("  %8.2f M%s/s", per_sec / 1e6, unit);
+            else
+                printf("  %8.2f k%s/s", per_sec / 1e3, unit);
+        }
+    } // namespace
+
+    struct Runner
+    {
+        struct Result
+        {
+            double ns_per_iter = 0;
+            uint64_t iters = 0;
+            uint64_t bytes = 0;
+            uint64_t items = 0;
+            std::string label;
+            std::string error;
+        };
+
+        static Result once(const Entry &e, uint64_t iters)
+        {
+            State st(iters, e.arg);
+            e.fn(st);
+            Result r;
+            r.iters = iters;
+            r.bytes = st.bytes_;
+            r.items = st.items_;
+            r.label = st.label_;
+            r.error = st.error_;
+            const int64_t ns = st.t_end_ns_ - st.t_start_ns_;
+            r.ns_per_iter = iters ? double(std::max<int64_t>(ns, 1)) / double(iters) : 0;
+            return r;
+        }
+
+        // Grow the iteration count until one run takes min_time, then keep
+        // the fastest of `repeat` runs at that count.
+        static Result measure(const Entry &e, const Options &o)
+        {
+            const double target_ns = o.min_time * 1e9;
+            uint64_t iters = 1;
+            Result r = once(e, iters);
+            while (r.error.empty() && r.ns_per_iter * iters < target_ns && iters < (1ull << 40))
+            {
+                const double want = target_ns / std::max(r.ns_per_iter, 0.1);
+                iters = std::min<uint64_t>(std::max<uint64_t>(iters * 2, uint64_t(want * 1.2)), iters * 100);
+                r = once(e, iters);
+            }
+
+            Result best = r;
+            for (int i = 1; i < o.repeat && best.error.empty(); i++)
+            {
+                Result x = once(e, iters);
+                if (!x.error.empty() || x.ns_per_iter < best.ns_per_iter)
+                    best = x;
+            }
+            return best;
+        }
+    };
+
+    State::Iterator State::begin()
+    {
+        t_start_ns_ = nowNs();
+        return Iterator{this, max_iters_};
+    }
+
+    void State::stopTimer()
+    {
+        t_end_ns_ = nowNs();
+    }
+
+    Registrar::Registrar(const char *name, Fn fn, int64_t arg)
+    {
+        registry().push_back(Entry{name, fn, arg});
+    }
+
+    int runAll(int argc, char **argv)
+    {
+        Options o;
+        if (!parse(argc, argv, o))
+            return 2;
+
+        std::vector<Entry> entries = registry();
+        std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) { return a.name < b.name; });
+
+        if (o.list)
+        {
+            for (const Entry &e : entries)
+                printf("%s\n", e.name.c_str());
+            return 0;
+        }
+
+        const auto base = o.baseline.empty() ? std::map<std::string, double>{} : loadBaseline(o.baseline);
+        if (!o.baseline.empty() && base.empty())
+        {
+            fprintf(stderr, "baseline %s: missing or empty\n", o.baseline.c_str());
+            return 2;
+        }
+
+        std::FILE *save = nullptr;
+        if (!o.save.empty() && !(save = fopen(o.save.c_str(), "w")))
+        {
+            fprintf(stderr, "cannot write %s\n", o.save.c_str());
+            return 2;
+        }
+
+        printf("%-36s %12s %12s %16s\n", "benchmark", "ns/iter", "iterations", "throughput");
+        int failed = 0, regressed = 0;
+        for (const Entry &e : entries)
+        {
+            if (!o.filter.empty() && e.name.find(o.filter) == std::string::npos)
+                continue;
+
+            Runner::Result r = Runner::measure(e, o);
+            if (!r.error.empty())
+            {
+                printf("%-36s FAILED: %s\n", e.name.c_str(), r.error.c_str());
+                failed++;
+                continue;
+            }
+
+            printf("%-36s %12.1f %12llu", e.name.c_str(), r.ns_per_iter, (unsigned long long)r.iters);
+            const double sec = r.ns_per_iter * double(r.iters) / 1e9;
+            if (r.bytes)
+                printRate("B", double(r.bytes) / sec);
+            else if (r.items)
+                printRate("item", double(r.items) / sec);
+            if (!r.label.empty())
+                printf("  %s", r.label.c_str());
+
+            auto it = base.find(e.name);
+            if (it != base.end())
+            {
+                const double ratio = r.ns_per_iter / it->second;
+                printf("  x%.2f", ratio);
+                if (ratio > o.threshold)
+                {
+                    printf(" REGRESSION (> x%.2f)", o.threshold);
+                    regressed++;
+                }
+            }
+            else if (!base.empty())
+            {
+                printf("  (not in baseline)");
+            }
+            printf("\n");
+
+            if (save)
+                fprintf(save, "%s %.3f\n", e.name.c_str(), r.ns_per_iter);
+        }
+
+        if (save)
+            fclose(save);
+        if (failed || regressed)
+            printf("%d failed, %d regressed\n", failed, regressed);
+        return (failed || regressed) ? 1 : 0;
+    }
+} // namespace microbench
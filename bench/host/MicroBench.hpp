@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * MicroBench
+ * ============================================================================
+ * Micro-benchmark harness kiểu Google Benchmark, không phụ thuộc ngoài:
+ *
+ *   static void BM_Encode(microbench::State &state)
+ *   {
+ *       ... setup ...
+ *       for (auto _ : state)
+ *           microbench::doNotOptimize(codec.encode(...));
+ *       state.setBytesProcessed(state.iterations() * bytes_per_iter);
+ *   }
+ *   BENCHMARK(BM_Encode);
+ *
+ * - Số vòng tự hiệu chỉnh tới --min-time (giây), lặp --repeat lần, lấy min
+ *   ns/iter (ít nhiễu nhất trên máy host).
+ * - --save=FILE ghi "name ns_per_iter" mỗi dòng; --baseline=FILE so với file
+ *   đó, chậm hơn baseline x --threshold (mặc định 1.15) → REGRESSION, exit 1.
+ * - state.error(msg): benchmark kiểm tra kết quả sai → FAILED, exit 1.
+ * - --filter=SUBSTR chỉ chạy benchmark có tên chứa SUBSTR; --list in tên.
+ */
+namespace microbench
+{
+    class State
+    {
+    public:
+        State(uint64_t iterations, int64_t arg) : max_iters_(iterations), arg_(arg) {}
+
+        // What `for (auto _ : state)` binds: a user-provided destructor keeps
+        // -Wunused-variable quiet about `_` (as in Google Benchmark)
+        struct Value
+        {
+            ~Value() {}
+        };
+
+        // Only the loop is timed: the clock starts in begin() and stops when
+        // the last iteration is done (setup / teardown around it are free).
+        struct Iterator
+        {
+            State *st;
+            uint64_t left;
+            bool operator!=(const Iterator &)
+            {
+                if (left != 0)
+                    return true;
+                st->stopTimer();
+                return false;
+            }
+            void operator++() { --left; }
+            Value operator*() const { return Value{}; }
+        };
+        Iterator begin();
+        Iterator end() { return Iterator{this, 0}; }
+
+        uint64_t iterations() const { return max_iters_; }
+        // BENCHMARK_ARG value (-1 when registered without one)
+        int64_t arg() const { return arg_; }
+
+        void setBytesProcessed(uint64_t bytes) { bytes_ = bytes; }
+        void setItemsProcessed(uint64_t items) { items_ = items; }
+        void setLabel(const std::string &label) { label_ = label; }
+        void error(const std::string &msg) { error_ = msg; }
+
+    private:
+        friend struct Runner;
+        void stopTimer();
+
+        uint64_t max_iters_;
+        int64_t arg_;
+        uint64_t bytes_ = 0;
+        uint64_t items_ = 0;
+        std::string label_;
+        std::string error_;
+        int64_t t_start_ns_ = 0;
+        int64_t t_end_ns_ = 0;
+    };
+
+    using Fn = void (*)(State &);
+
+    struct Registrar
+    {
+        Registrar(const char *name, Fn fn, int64_t arg = -1);
+    };
+
+    // Keep `v` (and what it points to) alive without an observable side effect
+    template <typename T>
+    inline void doNotOptimize(T const &v)
+    {
+        asm volatile("" : : "r,m"(v) : "memory");
+    }
+    inline void clobberMemory() { asm volatile("" : : : "memory"); }
+
+    // Parse flags, run, compare; returns the process exit code.
+    int runAll(int argc, char **argv);
+} // namespace microbench
+
+#define MICROBENCH_CAT2(a, b) a##b
+#define MICROBENCH_CAT(a, b) MICROBENCH_CAT2(a, b)
+#define BENCHMARK(fn) \
+    static ::microbench::Registrar MICROBENCH_CAT(microbench_reg_, __LINE__)(#fn, fn)
+#define BENCHMARK_ARG(fn, a) \
+    static ::microbench::Registrar MICROBENCH_CAT(microbench_reg_, __LINE__)(#fn "/" #a, fn, a)
@@ -0,0 +1,185 @@
+// ============================================================================
+// FreeRTOS host shim (tasks, task notifications, queues)
+// ----------------------------------------------------------------------------
+// Đủ cho code trong lib/ và StateManager chạy trên Linux: mỗi std::thread có
+// một HostTask (notification counter index 0), queue là deque byte có khóa.
+// Không có priority / core: chỉ để bench và kiểm tra chức năng.
+// ============================================================================
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct HostTask
+{
+    std::mutex m;
+    std::condition_variable cv;
+    uint32_t notify = 0;
+};
+
+struct HostQueue
+{
+    std::mutex m;
+    std::condition_variable cv;
+    std::deque<std::vector<uint8_t>> items;
+    size_t depth = 0;
+    size_t item_size = 0;
+};
+
+namespace
+{
+    // Never freed: a waker may still hold the handle of a finished thread
+    HostTask *currentTask()
+    {
+        thread_local HostTask *t = new HostTask;
+        return t;
+    }
+
+    struct TaskExit
+    {
+    };
+
+    template <typename Pred>
+    bool waitFor(std::condition_variable &cv, std::unique_lock<std::mutex> &lk, TickType_t wait, Pred pred)
+    {
+        if (wait == 0)
+            return pred();
+        if (wait == portMAX_DELAY)
+        {
+            cv.wait(lk, pred);
+            return true;
+        }
+        return cv.wait_for(lk, std::chrono::milliseconds(wait), pred);
+    }
+} // namespace
+
+// ============================================================================
+// Tasks
+// ============================================================================
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return currentTask();
+}
+
+TickType_t xTaskGetTickCount()
+{
+    static const auto t0 = std::chrono::steady_clock::now();
+    return static_cast<TickType_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - t0).count());
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *, uint32_t, void *arg, UBaseType_t,
+                                   TaskHandle_t *out, BaseType_t)
+{
+    std::mutex m;
+    std::condition_variable cv;
+    TaskHandle_t handle = nullptr;
+
+    std::thread([&, fn, arg] {
+        {
+            std::lock_guard<std::mutex> lk(m);
+            handle = xTaskGetCurrentTaskHandle();
+        }
+        cv.notify_one();
+        try
+        {
+            fn(arg);
+        }
+        catch (const TaskExit &)
+        {
+        }
+    }).detach();
+
+    std::unique_lock<std::mutex> lk(m);
+    cv.wait(lk, [&] { return handle != nullptr; });
+    if (out)
+        *out = handle;
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == nullptr || task == xTaskGetCurrentTaskHandle())
+        throw TaskExit{};
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    {
+        std::lock_guard<std::mutex> lk(task->m);
+        task->notify++;
+    }
+    task->cv.notify_all();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait)
+{
+    HostTask *t = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lk(t->m);
+    waitFor(t->cv, lk, wait, [t] { return t->notify != 0; });
+    const uint32_t v = t->notify;
+    if (v)
+        t->notify = clear_on_exit ? 0 : v - 1;
+    return v;
+}
+
+// ============================================================================
+// Queues
+// ============================================================================
+QueueHandle_t xQueueCreate(UBaseType_t depth, UBaseType_t item_size)
+{
+    if (depth == 0 || item_size == 0)
+        return nullptr;
+    auto *q = new HostQueue;
+    q->depth = depth;
+    q->item_size = item_size;
+    return q;
+}
+
+void vQueueDelete(QueueHandle_t q)
+{
+    delete q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait)
+{
+    std::unique_lock<std::mutex> lk(q->m);
+    if (!waitFor(q->cv, lk, wait, [q] { return q->items.size() < q->depth; }))
+        return pdFALSE;
+    const auto *p = static_cast<const uint8_t *>(item);
+    q->items.emplace_back(p, p + q->item_size);
+    lk.unlock();
+    q->cv.notify_all();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait)
+{
+    std::unique_lock<std::mutex> lk(q->m);
+    if (!waitFor(q->cv, lk, wait, [q] { return !q->items.empty(); }))
+        return pdFALSE;
+    memcpy(item, q->items.front().data(), q->item_size);
+    q->items.pop_front();
+    lk.unlock();
+    q->cv.notify_all();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q)
+{
+    std::lock_guard<std::mutex> lk(q->m);
+    return static_cast<UBaseType_t>(q->items.size());
+}
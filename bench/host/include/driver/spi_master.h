@@ -0,0 +1,21 @@
+#pragma once
+// Host shim: only the types DisplayDriver.hpp names.
+#include <cstddef>
+#include <cstdint>
+
+typedef enum
+{
+    SPI1_HOST = 0,
+    SPI2_HOST = 1,
+    SPI3_HOST = 2,
+} spi_host_device_t;
+
+typedef struct spi_device_t *spi_device_handle_t;
+
+typedef struct
+{
+    uint32_t flags;
+    size_t length;
+    const void *tx_buffer;
+    void *user;
+} spi_transaction_t;
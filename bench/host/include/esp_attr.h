@@ -0,0 +1,7 @@
+#pragma once
+// Host shim: placement attributes are no-ops.
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define EXT_RAM_BSS_ATTR
@@ -0,0 +1,11 @@
+#pragma once
+// Host shim of the IDF 4.4 esp_cpu.h counter: ticks in nanoseconds (steady
+// clock), so cycles/pixel on the host read as ns/pixel.
+#include <chrono>
+#include <cstdint>
+
+inline uint32_t esp_cpu_get_ccount()
+{
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
@@ -0,0 +1,32 @@
+#pragma once
+// Host shim: CRC-32 (IEEE 802.3, reflected, same as the ROM crc32_le behind
+// esp_crc32_le), byte-wise table like the ROM.
+#include <cstddef>
+#include <cstdint>
+
+namespace ptalk_host
+{
+    struct Crc32Table
+    {
+        uint32_t t[256];
+        Crc32Table()
+        {
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++)
+                    c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+                t[i] = c;
+            }
+        }
+    };
+} // namespace ptalk_host
+
+inline uint32_t esp_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+    static const ptalk_host::Crc32Table table;
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++)
+        crc = table.t[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
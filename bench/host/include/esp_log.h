@@ -0,0 +1,25 @@
+#pragma once
+// Host shim: ESP_LOGE / ESP_LOGW go to stderr; I / D / V print nothing
+// unless PTALK_HOST_LOG_VERBOSE is defined (benchmarks must not time printf).
+#include <cstdio>
+
+#define PTALK_HOST_LOG(letter, tag, fmt, ...) fprintf(stderr, letter " (%s) " fmt "\n", tag, ##__VA_ARGS__)
+
+#define ESP_LOGE(tag, fmt, ...) PTALK_HOST_LOG("E", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGW(tag, fmt, ...) PTALK_HOST_LOG("W", tag, fmt, ##__VA_ARGS__)
+#if defined(PTALK_HOST_LOG_VERBOSE)
+#define ESP_LOGI(tag, fmt, ...) PTALK_HOST_LOG("I", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) PTALK_HOST_LOG("D", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGV(tag, fmt, ...) PTALK_HOST_LOG("V", tag, fmt, ##__VA_ARGS__)
+#else
+// Never printed, but the arguments stay referenced (and format-checked)
+#define PTALK_HOST_LOG_OFF(letter, tag, fmt, ...)             \
+    do                                                       \
+    {                                                        \
+        if (0)                                               \
+            PTALK_HOST_LOG(letter, tag, fmt, ##__VA_ARGS__); \
+    } while (0)
+#define ESP_LOGI(tag, fmt, ...) PTALK_HOST_LOG_OFF("I", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGD(tag, fmt, ...) PTALK_HOST_LOG_OFF("D", tag, fmt, ##__VA_ARGS__)
+#define ESP_LOGV(tag, fmt, ...) PTALK_HOST_LOG_OFF("V", tag, fmt, ##__VA_ARGS__)
+#endif
@@ -0,0 +1,42 @@
+#pragma once
+// Host shim: no partitions on the host, lookups find nothing.
+#include <cstddef>
+#include <cstdint>
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#define ESP_FAIL -1
+#endif
+
+typedef enum
+{
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+typedef int esp_partition_subtype_t;
+// IDF 4.4 esp_spi_flash.h (esp_partition_mmap_memory_t only from 5.1)
+typedef enum
+{
+    SPI_FLASH_MMAP_DATA,
+    SPI_FLASH_MMAP_INST,
+} spi_flash_mmap_memory_t;
+typedef uint32_t spi_flash_mmap_handle_t;
+
+typedef struct
+{
+    uint32_t address;
+    uint32_t size;
+} esp_partition_t;
+
+inline const esp_partition_t *esp_partition_find_first(esp_partition_type_t, esp_partition_subtype_t, const char *)
+{
+    return nullptr;
+}
+inline esp_err_t esp_partition_read(const esp_partition_t *, size_t, void *, size_t) { return ESP_FAIL; }
+inline esp_err_t esp_partition_mmap(const esp_partition_t *, size_t, size_t, spi_flash_mmap_memory_t,
+                                    const void **, spi_flash_mmap_handle_t *)
+{
+    return ESP_FAIL;
+}
+inline void spi_flash_munmap(spi_flash_mmap_handle_t) {}
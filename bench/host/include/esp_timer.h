@@ -0,0 +1,10 @@
+#pragma once
+// Host shim: microseconds since the first call (steady clock).
+#include <chrono>
+#include <cstdint>
+
+inline int64_t esp_timer_get_time()
+{
+    static const auto t0 = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count();
+}
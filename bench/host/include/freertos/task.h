@@ -0,0 +1,24 @@
+#pragma once
+// Host shim: tasks are std::threads; each thread gets a handle with a
+// notification counter (index 0) on first use. See bench/host/freertos_shim.cpp.
+#include "freertos/FreeRTOS.h"
+
+typedef struct HostTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+TaskHandle_t xTaskGetCurrentTaskHandle();
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_bytes, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *out, BaseType_t core);
+inline BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_bytes, void *arg,
+                              UBaseType_t priority, TaskHandle_t *out)
+{
+    return xTaskCreatePinnedToCore(fn, name, stack_bytes, arg, priority, out, tskNO_AFFINITY);
+}
+// Only vTaskDelete(nullptr) (self) is supported; it does not return.
+void vTaskDelete(TaskHandle_t task);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait);
@@ -0,0 +1,590 @@
+// ============================================================================
+// Audio micro-benchmarks (host): ADPCM, Opus, resampler, PLC, earcons, NS / AGC,
+// MFCC + command recognizer, SpscRing, media prebuffer
+// ============================================================================
+#include "AdpcmCodec.hpp"
+#include "CommandRecognizer.hpp"
+#include "EarconPlayer.hpp"
+#include "KeywordSpotter.hpp"
+#include "MediaBuffer.hpp"
+#include "OpusCodec.hpp"
+#include "PacketLossConcealer.hpp"
+#include "PolyphaseResampler.hpp"
+#include "SpscRing.hpp"
+#include "VoiceFrontEnd.hpp"
+
+#include "MicroBench.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Speech-like test signal: two tones + noise, int16
+    std::vector<int16_t> testPcm(size_t n, uint32_t rate = 16000)
+    {
+        std::vector<int16_t> pcm(n);
+        std::mt19937 rng(1234);
+        std::normal_distribution<float> noise(0.f, 600.f);
+        for (size_t i = 0; i < n; i++)
+        {
+            const float t = float(i) / float(rate);
+            float v = 9000.f * std::sin(2.f * float(M_PI) * 220.f * t) +
+                      4000.f * std::sin(2.f * float(M_PI) * 1750.f * t) + noise(rng);
+            pcm[i] = int16_t(std::max(-32768.f, std::min(32767.f, v)));
+        }
+        return pcm;
+    }
+
+    // ------------------------------------------------------------------------
+    // ADPCM: one 256-sample frame per iteration (16 ms at 16 kHz)
+    // ------------------------------------------------------------------------
+    void BM_AdpcmEncode(microbench::State &state)
+    {
+        AdpcmCodec codec(16000);
+        const size_t n = codec.pcmFrameSamples();
+        const auto pcm = testPcm(n * 64);
+        std::vector<uint8_t> out(codec.encodedFrameBytes());
+
+        size_t frame = 0;
+        for (auto _ : state)
+        {
+            microbench::doNotOptimize(codec.encode(pcm.data() + frame * n, n, out.data(), out.size()));
+            frame = (frame + 1) & 63;
+        }
+        state.setBytesProcessed(state.iterations() * n * sizeof(int16_t));
+    }
+    BENCHMARK(BM_AdpcmEncode);
+
+    void BM_AdpcmDecode(microbench::State &state)
+    {
+        AdpcmCodec codec(16000);
+        const size_t n = codec.pcmFrameSamples();
+        const size_t fb = codec.encodedFrameBytes();
+        const auto pcm = testPcm(n * 64);
+        std::vector<uint8_t> enc(fb * 64);
+        for (size_t f = 0; f < 64; f++)
+            codec.encode(pcm.data() + f * n, n, enc.data() + f * fb, fb);
+        std::vector<int16_t> out(n);
+
+        size_t frame = 0;
+        for (auto _ : state)
+        {
+            microbench::doNotOptimize(codec.decode(enc.data() + frame * fb, fb, out.data(), out.size()));
+            frame = (frame + 1) & 63;
+        }
+        state.setBytesProcessed(state.iterations() * n * sizeof(int16_t));
+    }
+    BENCHMARK(BM_AdpcmDecode);
+
+#if PTALK_HAS_OPUS
+    // ------------------------------------------------------------------------
+    // Opus (system libopus): encode + decode of one 20 ms frame per
+    // iteration, firmware settings (16 kbps VBR, complexity 3, in-band FEC)
+    // ------------------------------------------------------------------------
+    void BM_OpusRoundTrip(microbench::State &state)
+    {
+        OpusCodec codec(16000, 16000);
+        if (!codec.valid())
+        {
+            state.error("encoder / decoder create failed");
+            return;
+        }
+        const size_t n = codec.pcmFrameSamples();
+        const auto pcm = testPcm(n * 64);
+        std::vector<uint8_t> pkt(codec.maxEncodedFrameBytes());
+        std::vector<int16_t> out(n);
+
+        size_t frame = 0;
+        uint64_t bytes = 0;
+        bool ok = true;
+        for (auto _ : state)
+        {
+            const size_t len = codec.encode(pcm.data() + frame * n, n, pkt.data(), pkt.size());
+            ok &= len > 0 && codec.decode(pkt.data(), len, out.data(), out.size()) == n;
+            bytes += len;
+            frame = (frame + 1) & 63;
+        }
+        if (!ok)
+            state.error("a frame did not round-trip");
+        // VBR around the nominal 40 B per packet
+        const uint64_t avg = bytes / state.iterations();
+        if (avg < 20 || avg > 80)
+            state.error("average packet " + std::to_string(avg) + " B, expected ~40");
+        state.setBytesProcessed(state.iterations() * n * sizeof(int16_t));
+    }
+    BENCHMARK(BM_OpusRoundTrip);
+#endif
+
+    // ------------------------------------------------------------------------
+    // Resampler: 20 ms of input per iteration; arg = input rate (→ 16 kHz
+    // uplink, or 16 kHz → arg for playback at the I2S rate)
+    // ------------------------------------------------------------------------
+    void resample(microbench::State &state, uint32_t in_rate, uint32_t out_rate)
+    {
+        const size_t in_n = in_rate / 50;
+        PolyphaseResampler rs;
+        if (!rs.init(in_rate, out_rate, in_n))
+        {
+            state.error("init failed");
+            return;
+        }
+        const auto pcm = testPcm(in_n, in_rate);
+        std::vector<int16_t> out(rs.maxOutput(in_n));
+
+        size_t produced = 0;
+        for (auto _ : state)
+            produced += rs.process(pcm.data(), in_n, out.data());
+        microbench::doNotOptimize(produced);
+
+        // Steady state must give the exact rate ratio (± filter delay)
+        const double expect = double(state.iterations()) * in_n * out_rate / in_rate;
+        if (std::fabs(double(produced) - expect) > 64)
+            state.error("output count " + std::to_string(produced) + " != " + std::to_string(uint64_t(expect)));
+        state.setItemsProcessed(state.iterations() * in_n);
+    }
+
+    void BM_ResampleTo16k(microbench::State &state)
+    {
+        resample(state, uint32_t(state.arg()), 16000);
+    }
+    BENCHMARK_ARG(BM_ResampleTo16k, 24000);
+    BENCHMARK_ARG(BM_ResampleTo16k, 48000);
+
+    void BM_ResampleFrom16k(microbench::State &state)
+    {
+        resample(state, 16000, uint32_t(state.arg()));
+    }
+    BENCHMARK_ARG(BM_ResampleFrom16k, 22050);
+    BENCHMARK_ARG(BM_ResampleFrom16k, 48000);
+
+    // ------------------------------------------------------------------------
+    // PLC: one received frame then one concealed frame per iteration (pitch
+    // search on every loss, the worst case). Checked first on a 200 Hz tone:
+    // the concealed frame continues it, and a long gap fades to silence.
+    // ------------------------------------------------------------------------
+    void BM_PlcConceal(microbench::State &state)
+    {
+        constexpr uint32_t rate = 16000;
+        constexpr size_t n = 256;
+        PacketLossConcealer plc;
+        if (!plc.init(rate))
+        {
+            state.error("init failed");
+            return;
+        }
+
+        std::vector<int16_t> tone(n * 16);
+        for (size_t i = 0; i < tone.size(); i++)
+            tone[i] = int16_t(8000.f * std::sin(2.f * float(M_PI) * 200.f * float(i) / float(rate)));
+        std::vector<int16_t> frame(n);
+        for (size_t f = 0; f < 10; f++)
+        {
+            memcpy(frame.data(), tone.data() + f * n, n * sizeof(int16_t));
+            plc.onDecoded(frame.data(), n);
+        }
+
+        // First 10 ms of the gap play at full gain
+        plc.conceal(frame.data(), n);
+        double err = 0;
+        for (size_t i = 0; i < rate / 100; i++)
+        {
+            const double d = double(frame[i]) - tone[10 * n + i];
+            err += d * d;
+        }
+        if (std::sqrt(err / (rate / 100)) > 400.0)
+            state.error("concealed frame does not continue the tone");
+        for (int f = 0; f < 4; f++)
+            plc.conceal(frame.data(), n);
+        for (int16_t v : frame)
+            if (v != 0)
+            {
+                state.error("80 ms gap not faded to silence");
+                break;
+            }
+
+        const auto pcm = testPcm(n * 64);
+        size_t f = 0;
+        for (auto _ : state)
+        {
+            memcpy(frame.data(), pcm.data() + f * n, n * sizeof(int16_t));
+            plc.onDecoded(frame.data(), n);
+            microbench::doNotOptimize(plc.conceal(frame.data(), n));
+            f = (f + 1) & 63;
+        }
+        state.setItemsProcessed(state.iterations() * n);
+    }
+    BENCHMARK(BM_PlcConceal);
+
+    // ------------------------------------------------------------------------
+    // Earcon mixer: one 256-sample speaker frame per iteration with a cue
+    // always playing. Checked first: the cue is audible, ends on time, and
+    // mix() leaves the frame untouched once it is over.
+    // ------------------------------------------------------------------------
+    void BM_EarconMix(microbench::State &state)
+    {
+        constexpr size_t n = 256;
+        EarconPlayer player;
+        player.init(16000);
+
+        std::vector<int16_t> frame(n, 0);
+        player.play(Earcon::LISTEN_START); // 140 ms = 2240 samples
+        size_t mixed = 0;
+        int32_t peak = 0;
+        for (int f = 0; f < 12; f++)
+        {
+            std::fill(frame.begin(), frame.end(), int16_t(0));
+            mixed += player.mix(frame.data(), n);
+            for (int16_t v : frame)
+                peak = std::max<int32_t>(peak, std::abs(int32_t(v)));
+        }
+        if (mixed != 2240 || peak < 4000 || player.busy())
+            state.error("cue length " + std::to_string(mixed) + " peak " + std::to_string(peak));
+
+        const auto pcm = testPcm(n * 64);
+        size_t f = 0;
+        for (auto _ : state)
+        {
+            if (!player.busy())
+                player.play(Earcon::ERROR);
+            memcpy(frame.data(), pcm.data() + f * n, n * sizeof(int16_t));
+            microbench::doNotOptimize(player.mix(frame.data(), n));
+            f = (f + 1) & 63;
+        }
+        state.setItemsProcessed(state.iterations() * n);
+    }
+    BENCHMARK(BM_EarconMix);
+
+    // ------------------------------------------------------------------------
+    // Uplink NS + AGC: one 256-sample mic frame per iteration (the per-frame
+    // CPU budget, two STFT hops). Checked first: stationary noise alone is
+    // cut by ≥ 10 dB once learned (AGC holds its gain on it), and a quiet
+    // tone that follows is lifted toward the AGC target.
+    // ------------------------------------------------------------------------
+    void BM_VoiceFrontEnd(microbench::State &state)
+    {
+        constexpr uint32_t rate = 16000;
+        constexpr size_t n = 256;
+        VoiceFrontEnd fe;
+        if (!fe.init(VoiceFrontEnd::Config{}))
+        {
+            state.error("init failed");
+            return;
+        }
+
+        std::mt19937 rng(7);
+        std::normal_distribution<float> noise(0.f, 200.f); // -44 dBFS fan / AC hiss
+        std::vector<int16_t> frame(n);
+        double in_e = 0, out_e = 0;
+        for (int f = 0; f < 250; f++) // 4 s of noise
+        {
+            for (auto &v : frame)
+                v = int16_t(noise(rng));
+            const int16_t *out = fe.process(frame.data(), n);
+            for (size_t i = 0; f >= 125 && i < n; i++)
+            {
+                in_e += double(frame[i]) * frame[i];
+                out_e += double(out[i]) * out[i];
+            }
+        }
+        if (out_e * 10.0 > in_e)
+            state.error("noise not suppressed");
+
+        double tone_e = 0;
+        for (int f = 0; f < 125; f++) // 2 s of a far-field -36 dBFS tone over the noise
+        {
+            for (size_t i = 0; i < n; i++)
+                frame[i] = int16_t(700.f * std::sin(2.f * float(M_PI) * 500.f * float(f * n + i) / float(rate)) +
+                                   noise(rng));
+            const int16_t *out = fe.process(frame.data(), n);
+            for (size_t i = 0; f >= 100 && i < n; i++)
+                tone_e += double(out[i]) * out[i];
+        }
+        if (fe.gainDb() < 10.f || std::sqrt(tone_e / (25 * n)) < 2000.0)
+            state.error("AGC gain " + std::to_string(fe.gainDb()) + " dB");
+
+        const auto pcm = testPcm(n * 64);
+        size_t f = 0;
+        for (auto _ : state)
+        {
+            microbench::doNotOptimize(fe.process(pcm.data() + f * n, n));
+            f = (f + 1) & 63;
+        }
+        state.setItemsProcessed(state.iterations() * n);
+    }
+    BENCHMARK(BM_VoiceFrontEnd);
+
+    // ------------------------------------------------------------------------
+    // Voice commands: one 20 ms hop at 8 kHz per iteration through the shared
+    // MFCC front-end (wake-word detection off) and CommandRecognizer::poll().
+    // The model is a stand-in (loud recent rows = "volume_up"), so this times
+    // the front-end and the smoothing / window logic, not a trained net.
+    // Checked first: background noise gives no command, a tone gives exactly
+    // one, and the window is closed after it.
+    // ------------------------------------------------------------------------
+    class LoudnessCommandModel : public CommandModel
+    {
+    public:
+        size_t inputFrames() const override { return 25; }
+        size_t inputCoeffs() const override { return 10; }
+        float inputScale() const override { return 0.25f; }
+        const char *name() const override { return "loudness"; }
+        size_t numClasses() const override { return 3; }
+        const char *label(size_t cls) const override
+        {
+            static const char *const LABELS[] = {"_silence_", "_unknown_", "volume_up"};
+            return LABELS[cls];
+        }
+        uint8_t infer(const int8_t *features) override
+        {
+            uint8_t p[3];
+            inferClasses(features, p);
+            return p[2];
+        }
+        void inferClasses(const int8_t *features, uint8_t *probs) override
+        {
+            int sum = 0;
+            for (size_t f = 15; f < 25; f++)
+                sum += features[f * 10];
+            const bool loud = sum / 10 > baseline + 8;
+            probs[0] = loud ? 10 : 235;
+            probs[1] = 10;
+            probs[2] = loud ? 235 : 10;
+        }
+
+        int baseline = 0; // c0 of the background noise
+    };
+
+    void BM_CommandRecognizer(microbench::State &state)
+    {
+        constexpr size_t hop = 160; // 20 ms at 8 kHz
+        LoudnessCommandModel model;
+        KeywordSpotter kws;
+        CommandRecognizer cmd;
+        if (!kws.init(KeywordSpotter::Config{}, &model) || !cmd.init(CommandRecognizer::Config{}, &model, kws))
+        {
+            state.error("init failed");
+            return;
+        }
+        kws.setDetect(false);
+
+        std::mt19937 rng(11);
+        std::normal_distribution<float> noise(0.f, 100.f);
+        std::vector<int16_t> pcm(hop);
+        auto feedNoise = [&](float tone)
+        {
+            static size_t t = 0;
+            for (auto &v : pcm)
+                v = int16_t(tone * std::sin(2.f * float(M_PI) * 600.f * float(t++) / 8000.f) + noise(rng));
+            kws.feed(pcm.data(), hop);
+        };
+
+        for (int i = 0; i < 25; i++)
+            feedNoise(0.f);
+        model.baseline = kws.features()[24 * 10];
+
+        // 0.5 s of noise, 1 s of tone, then noise past the 2 s window
+        cmd.reset();
+        int commands = 0, in_window = 0;
+        for (int i = 0; i < 150; i++)
+        {
+            feedNoise(i >= 25 && i < 75 ? 8000.f : 0.f);
+            const VoiceCommand c = cmd.poll(kws);
+            if (c == VoiceCommand::VOLUME_UP)
+            {
+                commands++;
+                in_window += i >= 25 && i < 100;
+            }
+            else if (c != VoiceCommand::NONE)
+            {
+                state.error("wrong command");
+            }
+        }
+        if (commands != 1 || in_window != 1)
+            state.error("commands " + std::to_string(commands) + ", in window " + std::to_string(in_window));
+        if (!cmd.expired())
+            state.error("window did not expire");
+
+        const auto tone = testPcm(hop * 64, 8000);
+        size_t f = 0;
+        cmd.reset();
+        for (auto _ : state)
+        {
+            kws.feed(tone.data() + f * hop, hop);
+            microbench::doNotOptimize(cmd.poll(kws));
+            if (cmd.expired())
+                cmd.reset();
+            f = (f + 1) & 63;
+        }
+        state.setItemsProcessed(state.iterations() * hop);
+    }
+    BENCHMARK(BM_CommandRecognizer);
+
+    // ------------------------------------------------------------------------
+    // SpscRing: 512-byte chunks (one 16 ms PCM frame), single thread, then a
+    // producer / consumer pair (includes the notify wake-ups)
+    // ------------------------------------------------------------------------
+    constexpr size_t RING_CHUNK = 512;
+
+    void BM_SpscRingWriteRead(microbench::State &state)
+    {
+        SpscRing ring;
+        if (!ring.allocate(8 * 1024, RING_CHUNK))
+        {
+            state.error("allocate failed");
+            return;
+        }
+        uint8_t src[RING_CHUNK];
+        memset(src, 0x5A, sizeof(src));
+
+        for (auto _ : state)
+        {
+            uint8_t *w = ring.acquireWrite(RING_CHUNK, 0);
+            memcpy(w, src, RING_CHUNK);
+            ring.commitWrite(RING_CHUNK);
+            const uint8_t *r = ring.acquireRead(RING_CHUNK, 0);
+            microbench::doNotOptimize(r[RING_CHUNK - 1]);
+            ring.release(RING_CHUNK);
+        }
+        state.setBytesProcessed(state.iterations() * RING_CHUNK);
+    }
+    BENCHMARK(BM_SpscRingWriteRead);
+
+    void BM_SpscRingThreads(microbench::State &state)
+    {
+        SpscRing ring;
+        if (!ring.allocate(8 * 1024, RING_CHUNK))
+        {
+            state.error("allocate failed");
+            return;
+        }
+        const uint64_t n = state.iterations();
+        uint64_t received = 0;
+        std::thread consumer([&] {
+            for (uint64_t i = 0; i < n; i++)
+            {
+                const uint8_t *r = ring.acquireRead(RING_CHUNK, portMAX_DELAY);
+                microbench::doNotOptimize(r[0]);
+                ring.release(RING_CHUNK);
+                received++;
+            }
+        });
+
+        uint8_t seq = 0;
+        for (auto _ : state)
+        {
+            uint8_t *w = ring.acquireWrite(RING_CHUNK, portMAX_DELAY);
+            w[0] = seq++;
+            ring.commitWrite(RING_CHUNK);
+        }
+        consumer.join();
+
+        if (received != n)
+            state.error("lost chunks");
+        state.setBytesProcessed(n * RING_CHUNK);
+    }
+    BENCHMARK(BM_SpscRingThreads);
+    // ------------------------------------------------------------------------
+    // MediaBuffer: 64 KiB stream through 4 KiB of RAM spilling to a 16 KiB
+    // file. Fill to capacity, then the decoder side reads 300 B units while
+    // the fetch side tops up in 700 B socket reads; one in-buffer skip and
+    // one reset (seek outside the buffer) on the way. Content vs stream
+    // offset across RAM and file, offsets, and the file removed on deinit.
+    // ------------------------------------------------------------------------
+    void BM_MediaBuffer(microbench::State &state)
+    {
+        static constexpr uint32_t STREAM = 64 * 1024;
+        static constexpr size_t IN = 700, OUT = 300;
+        static constexpr uint32_t SKIP_AT = 20000, SKIP = 1500, SEEK_AT = 40000, SEEK_TO = 50000;
+        const char *path = "ptalk_bench_media.bin"; // working directory
+        auto byteAt = [](uint32_t off) { return static_cast<uint8_t>(off * 7 + (off >> 8)); };
+
+        MediaBuffer buf;
+        MediaBuffer::Config cfg;
+        cfg.ram_bytes = 4 * 1024;
+        cfg.spill_path = path;
+        cfg.spill_max_bytes = 16 * 1024;
+        if (!buf.init(cfg))
+        {
+            state.error("buffer init failed");
+            return;
+        }
+
+        uint8_t in[IN], out[OUT];
+        bool content_ok = true, offsets_ok = true, filled = true, spilled = false;
+        uint32_t read_total = 0, seek_from = 0;
+        for (auto _ : state)
+        {
+            buf.reset(0);
+            uint32_t fetch = 0; // next stream byte to fetch
+            bool skipped = false, seeked = false;
+            read_total = 0;
+            auto topUp = [&]
+            {
+                while (fetch < STREAM && buf.space() >= IN)
+                {
+                    const size_t n = std::min<size_t>(IN, STREAM - fetch);
+                    for (size_t i = 0; i < n; i++)
+                        in[i] = byteAt(fetch + static_cast<uint32_t>(i));
+                    fetch += static_cast<uint32_t>(buf.write(in, n));
+                }
+                spilled |= buf.spilledBytes() > 0;
+            };
+            topUp();
+            filled &= buf.bytes() + IN > buf.capacity();
+
+            for (;;)
+            {
+                const uint32_t at = buf.readOffset();
+                if (!skipped && at >= SKIP_AT)
+                {
+                    skipped = true;
+                    offsets_ok &= buf.skip(SKIP) == SKIP && buf.readOffset() == at + SKIP;
+                }
+                if (!seeked && buf.readOffset() >= SEEK_AT)
+                {
+                    seeked = true;
+                    seek_from = buf.readOffset();
+                    buf.reset(SEEK_TO);
+                    offsets_ok &= buf.bytes() == 0 && buf.writeOffset() == SEEK_TO;
+                    fetch = buf.writeOffset(); // refetch from the seek target
+                    topUp();
+                }
+                offsets_ok &= buf.writeOffset() == fetch;
+                const uint32_t from = buf.readOffset();
+                const size_t n = buf.read(out, OUT);
+                if (n == 0)
+                    break;
+                for (size_t i = 0; i < n; i++)
+                    content_ok &= out[i] == byteAt(from + static_cast<uint32_t>(i));
+                read_total += static_cast<uint32_t>(n);
+                topUp();
+            }
+            offsets_ok &= buf.readOffset() == STREAM && buf.errors() == 0;
+            microbench::doNotOptimize(read_total);
+        }
+        auto exists = [path]
+        {
+            FILE *f = std::fopen(path, "rb");
+            if (f)
+                std::fclose(f);
+            return f != nullptr;
+        };
+        const bool spilled_file = exists();
+        buf.deinit();
+        const bool removed = !exists();
+
+        if (!content_ok)
+            state.error("media buffer returned bytes out of order or corrupted");
+        else if (!offsets_ok || read_total != STREAM - SKIP - (SEEK_TO - seek_from))
+            state.error("media buffer offsets wrong after skip / reset");
+        else if (!filled || !spilled || !spilled_file || !removed)
+            state.error("spill file not filled, not used or not deleted");
+        state.setBytesProcessed(state.iterations() * read_total);
+    }
+    BENCHMARK(BM_MediaBuffer);
+} // namespace
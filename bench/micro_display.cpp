@@ -0,0 +1,274 @@
+// ============================================================================
+// Display micro-benchmarks (host): RLE scanline decode via AnimationPlayer,
+// icon blit via RleBlitter, status overlay composited into the batches
+// ----------------------------------------------------------------------------
+// Dữ liệu thật: animation "happy" (320x218, 33 frame). DisplayDriver host
+// (host/DisplayDriver_host.cpp) nhận pixel vào sink, nên thời gian đo là
+// decode RLE + đổ vào buffer scanline, không có SPI.
+// ============================================================================
+#include "AnimationPlayer.hpp"
+#include "DisplayDriver.hpp"
+#include "OverlayCompositor.hpp"
+#include "RleBlitter.hpp"
+#include "assets/emotions/happy.hpp"
+#include "assets/icons/battery_charge.hpp"
+#include "assets/icons/critical_power.hpp"
+
+#include "HostDisplay.hpp"
+#include "MicroBench.hpp"
+
+#include <vector>
+
+namespace
+{
+    Animation1Bit happy()
+    {
+        const auto &a = asset::emotion::HAPPY;
+        Animation1Bit anim;
+        anim.width = a.width;
+        anim.height = a.height;
+        anim.frame_count = a.frame_count;
+        anim.fps = a.fps;
+        anim.loop = a.loop;
+        anim.max_packed_size = a.max_packed_size;
+        anim.frames = a.frames();
+        return anim;
+    }
+
+    DisplayDriver::Config panel()
+    {
+        DisplayDriver::Config cfg;
+        cfg.width = 320;
+        cfg.height = 240;
+        return cfg;
+    }
+
+    // Pixels and checksum of `loops` full animation loops
+    uint32_t playLoops(AnimationPlayer &player, const Animation1Bit &anim, int loops)
+    {
+        host_display::reset();
+        player.setAnimation(anim, 0, 11);
+        player.render();
+        const uint32_t step = 1000 / anim.fps;
+        for (int i = 1; i < anim.frame_count * loops; i++)
+        {
+            player.update(step);
+            player.render();
+        }
+        return host_display::checksum();
+    }
+
+    // ------------------------------------------------------------------------
+    // Frame 0 (full 320x218 RLE frame) per iteration
+    // ------------------------------------------------------------------------
+    void BM_RleFullFrame(microbench::State &state)
+    {
+        DisplayDriver drv;
+        drv.init(panel());
+        AnimationPlayer player(&drv);
+        const Animation1Bit anim = happy();
+        player.setAnimation(anim, 0, 11);
+
+        for (auto _ : state)
+        {
+            player.invalidate();
+            player.render();
+        }
+        state.setItemsProcessed(state.iterations() * anim.width * anim.height);
+        state.setLabel("px");
+    }
+    BENCHMARK(BM_RleFullFrame);
+
+    // ------------------------------------------------------------------------
+    // One animation step (dirty rect) per iteration; arg = frame cache bytes
+    // ------------------------------------------------------------------------
+    void BM_RleAnimationStep(microbench::State &state)
+    {
+        DisplayDriver drv;
+        drv.init(panel());
+        AnimationPlayer player(&drv);
+        const Animation1Bit anim = happy();
+
+        // The cached path must put the same pixels on screen
+        const uint32_t ref = playLoops(player, anim, 2);
+        player.setFrameCacheBudget(size_t(state.arg()));
+        if (playLoops(player, anim, 2) != ref)
+        {
+            state.error("frame cache output differs from plain RLE decode");
+            return;
+        }
+
+        host_display::reset();
+        const uint32_t step = 1000 / anim.fps;
+        for (auto _ : state)
+        {
+            player.update(step);
+            player.render();
+        }
+        state.setItemsProcessed(host_display::pixelsWritten());
+        state.setLabel("px");
+    }
+    BENCHMARK_ARG(BM_RleAnimationStep, 0);
+    BENCHMARK_ARG(BM_RleAnimationStep, 32768);
+
+    // ------------------------------------------------------------------------
+    // Icon (critical_power, 218x218) in 16-row batches per iteration; arg =
+    // columns clipped off each side (0 = whole icon). Checked first against
+    // a plain per-pixel decode of the same stream.
+    // ------------------------------------------------------------------------
+    std::vector<uint16_t> referenceIcon(const asset::icon::Icon &icon)
+    {
+        std::vector<uint16_t> px;
+        px.reserve(size_t(icon.w) * icon.h);
+        for (const uint8_t *src = icon.rle_data; px.size() < px.capacity(); src += 2)
+            for (int i = 0; i < src[0] && px.size() < px.capacity(); i++)
+                px.push_back(RleBlitter::GRAY_PALETTE[src[1] & 3]);
+        return px;
+    }
+
+    void BM_RleIcon(microbench::State &state)
+    {
+        const auto &icon = asset::icon::CRITICAL_POWER;
+        const int clip = int(state.arg());
+        const int cw = icon.w - 2 * clip;
+        constexpr int ROWS = 16;
+        RleBlitter blit;
+        std::vector<uint16_t> out(size_t(ROWS) * cw + 1);
+
+        auto blitIcon = [&](std::vector<uint16_t> *all)
+        {
+            RleBlitter::Cursor cur;
+            cur.src = icon.rle_data;
+            int pixels = 0;
+            for (int row = 0; row < icon.h; row += ROWS)
+            {
+                const int rows = std::min(ROWS, icon.h - row);
+                // Odd start address: the paired stores must realign
+                uint16_t *dst = out.data() + (row / ROWS & 1);
+                pixels += blit.decodeRows(cur, icon.w, clip, cw, rows, dst);
+                if (all)
+                    all->insert(all->end(), dst, dst + rows * cw);
+            }
+            return pixels;
+        };
+
+        const auto ref = referenceIcon(icon);
+        std::vector<uint16_t> got;
+        blitIcon(&got);
+        for (int y = 0; y < icon.h && got.size() == size_t(icon.h) * cw; y++)
+            for (int x = 0; x < cw; x++)
+                if (got[size_t(y) * cw + x] != ref[size_t(y) * icon.w + clip + x])
+                {
+                    state.error("blit differs from reference at " + std::to_string(x) + "," + std::to_string(y));
+                    return;
+                }
+        if (got.size() != size_t(icon.h) * cw)
+        {
+            state.error("short blit");
+            return;
+        }
+
+        int64_t pixels = 0;
+        for (auto _ : state)
+            pixels += blitIcon(nullptr);
+        state.setItemsProcessed(pixels);
+        state.setLabel("px");
+    }
+    BENCHMARK_ARG(BM_RleIcon, 0);
+    BENCHMARK_ARG(BM_RleIcon, 40);
+
+    // ------------------------------------------------------------------------
+    // Full frame with status layers over the face (battery %, 22x22 icon);
+    // arg 0 = no overlay. The layers must leave with the frame's own
+    // batches: no standalone push, same pixel count as without overlay.
+    // ------------------------------------------------------------------------
+    void BM_OverlayCompose(microbench::State &state)
+    {
+        DisplayDriver drv;
+        drv.init(panel());
+        AnimationPlayer player(&drv);
+        OverlayCompositor overlay;
+        const Animation1Bit anim = happy();
+        player.setAnimation(anim, 0, 11);
+
+        host_display::reset();
+        player.render();
+        const uint64_t plain_px = host_display::pixelsWritten();
+        const uint32_t plain_sum = host_display::checksum();
+
+        if (state.arg())
+        {
+            const auto &icon = asset::icon::BATTERY_CHARGE;
+            overlay.setText(0, 160, 40, " 87%", 0xFFFF, 0x0000);
+            overlay.setIcon(1, 135, 33, icon.w, icon.h, icon.rle_data, RleBlitter::GRAY_PALETTE);
+            player.setOverlay(&overlay);
+            host_display::reset();
+            player.invalidate();
+            player.render();
+            if (overlay.hasPending() || overlay.standalonePushes() != 0)
+            {
+                state.error("overlay not delivered with the animation batches");
+                return;
+            }
+            if (host_display::pixelsWritten() != plain_px || host_display::checksum() == plain_sum)
+            {
+                state.error("overlay changed the pixel count or was not blended");
+                return;
+            }
+        }
+
+        host_display::reset();
+        for (auto _ : state)
+        {
+            player.invalidate();
+            player.render();
+        }
+        state.setItemsProcessed(host_display::pixelsWritten());
+        state.setLabel("px");
+    }
+    BENCHMARK_ARG(BM_OverlayCompose, 0);
+    BENCHMARK_ARG(BM_OverlayCompose, 1);
+
+    // ------------------------------------------------------------------------
+    // Catch-up after a stall (4 frames due at once) with a per-pass budget;
+    // arg = budget in us (0 = unlimited). A cut pass must leave the player
+    // dirty and the following passes finish the same frame.
+    // ------------------------------------------------------------------------
+    void BM_RenderBudget(microbench::State &state)
+    {
+        DisplayDriver drv;
+        drv.init(panel());
+        AnimationPlayer player(&drv);
+        const Animation1Bit anim = happy();
+        const uint32_t step = 1000 / anim.fps;
+        const uint32_t budget = uint32_t(state.arg());
+
+        int64_t passes = 0;
+        host_display::reset();
+        for (auto _ : state)
+        {
+            player.setAnimation(anim, 0, 11);
+            player.render();
+            player.update(step * 4);
+            do
+            {
+                player.render(budget);
+                passes++;
+            } while (player.isDirty() && passes < 1000000);
+        }
+        if (player.isDirty())
+        {
+            state.error("budgeted render never caught up");
+            return;
+        }
+        if (budget && player.budgetCuts() == 0)
+        {
+            state.error("budget never cut a pass");
+            return;
+        }
+        state.setItemsProcessed(host_display::pixelsWritten());
+        state.setLabel("px (" + std::to_string(passes / std::max<int64_t>(state.iterations(), 1)) + " passes)");
+    }
+    BENCHMARK_ARG(BM_RenderBudget, 0);
+    BENCHMARK_ARG(BM_RenderBudget, 1);
+} // namespace
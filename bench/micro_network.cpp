@@ -0,0 +1,364 @@
+// ============================================================================
+// Network micro-benchmarks (host): JsonLite, OTA chunk parse + CRC,
+// uplink rate control on a simulated link, uplink store-and-forward,
+// Wi-Fi link quality / roam trigger
+// ============================================================================
+#include "JsonLite.hpp"
+#include "LinkQualityMonitor.hpp"
+#include "OtaChunk.hpp"
+#include "UplinkRateController.hpp"
+#include "UtteranceStore.hpp"
+
+#include "MicroBench.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // JsonLite: handshake-sized message; arg 0 = JSON, 1 = MessagePack
+    // ------------------------------------------------------------------------
+    jsonlite::Format fmt(const microbench::State &state)
+    {
+        return state.arg() ? jsonlite::Format::MSGPACK : jsonlite::Format::JSON;
+    }
+
+    size_t writeHandshake(char *buf, size_t cap, jsonlite::Format f, uint32_t battery)
+    {
+        jsonlite::Writer w(buf, cap, f);
+        w.beginObject()
+            .field("cmd", "device_handshake")
+            .field("device_id", "ptalk-a1b2c3d4e5f6")
+            .field("firmware_version", "1.4.2")
+            .field("ota_encodings", "raw,heatshrink")
+            .field("device_name", "Ptalk \"kitchen\"")
+            .field("battery_percent", battery)
+            .field("connectivity_state", "ONLINE")
+            .fieldFixed("rtt_ms", 23.4)
+            .field("charging", false)
+            .endObject();
+        return w.ok() ? w.size() : 0;
+    }
+
+    void BM_JsonWrite(microbench::State &state)
+    {
+        char buf[384];
+        uint32_t battery = 0;
+        size_t bytes = 0;
+        for (auto _ : state)
+        {
+            bytes += writeHandshake(buf, sizeof(buf), fmt(state), battery++ % 100);
+            microbench::clobberMemory();
+        }
+        if (bytes == 0)
+            state.error("writer overflow");
+        state.setBytesProcessed(bytes);
+    }
+    BENCHMARK_ARG(BM_JsonWrite, 0);
+    BENCHMARK_ARG(BM_JsonWrite, 1);
+
+    void BM_JsonRead(microbench::State &state)
+    {
+        char buf[384];
+        const size_t len = writeHandshake(buf, sizeof(buf), fmt(state), 87);
+        const std::string_view msg(buf, len);
+
+        uint32_t fields = 0, battery = 0;
+        for (auto _ : state)
+        {
+            jsonlite::ObjectReader rd(msg, fmt(state));
+            std::string_view key;
+            jsonlite::Value v;
+            while (rd.next(key, v))
+            {
+                fields++;
+                if (key == "battery_percent")
+                    v.asU32(battery);
+            }
+        }
+        microbench::doNotOptimize(fields);
+        if (battery != 87 || fields != state.iterations() * 9)
+            state.error("reader returned wrong fields");
+        state.setBytesProcessed(state.iterations() * len);
+    }
+    BENCHMARK_ARG(BM_JsonRead, 0);
+    BENCHMARK_ARG(BM_JsonRead, 1);
+
+    // ------------------------------------------------------------------------
+    // OTA chunk (handleOtaBinaryChunk framing + CRC32); arg = data bytes
+    // ------------------------------------------------------------------------
+    void BM_OtaChunkParse(microbench::State &state)
+    {
+        const size_t n = size_t(state.arg());
+        std::vector<uint8_t> msg(ota_chunk::HEADER_BYTES + n);
+        std::mt19937 rng(7);
+        for (size_t i = 0; i < n; i++)
+            msg[ota_chunk::HEADER_BYTES + i] = uint8_t(rng());
+        ota_chunk::writeHeader(msg.data(), 42, msg.data() + ota_chunk::HEADER_BYTES, uint32_t(n));
+
+        uint64_t ok = 0;
+        for (auto _ : state)
+        {
+            ota_chunk::Chunk c;
+            ok += ota_chunk::parse(msg.data(), msg.size(), c) == ota_chunk::Status::OK;
+        }
+        if (ok != state.iterations())
+            state.error("CRC check failed on a valid chunk");
+
+        // A flipped bit must be caught
+        msg.back() ^= 0x01;
+        ota_chunk::Chunk c;
+        if (ota_chunk::parse(msg.data(), msg.size(), c) != ota_chunk::Status::CRC_MISMATCH)
+            state.error("corrupted chunk accepted");
+        state.setBytesProcessed(state.iterations() * n);
+    }
+    BENCHMARK_ARG(BM_OtaChunkParse, 1024);
+    BENCHMARK_ARG(BM_OtaChunkParse, 4096);
+
+    // ------------------------------------------------------------------------
+    // Uplink rate control: Opus levels 16/12/8/6 kbps, 40 ms packets over a
+    // link of 40 kbps (10 s) → 9 kbps (20 s) → 40 kbps (60 s). The level
+    // must drop under the bottleneck before the queue runs away and come
+    // back to nominal once the link recovers.
+    // ------------------------------------------------------------------------
+    struct LinkRun
+    {
+        uint8_t level_bad = 0;      // level at the end of the bad phase
+        uint8_t level_end = 0;
+        uint32_t max_backlog_ms = 0; // worst queued audio in the bad phase
+        uint32_t downs = 0, ups = 0;
+    };
+
+    LinkRun simulateLink()
+    {
+        static constexpr uint32_t KBPS[] = {16, 12, 8, 6};
+        static constexpr uint32_t PACKET_MS = 40;
+        UplinkRateController ctl;
+        ctl.reset(4, 0, 0);
+
+        LinkRun r;
+        uint32_t queue_bytes = 0; // encoded audio not yet on the wire
+        for (uint32_t now = 0; now < 90000; now += PACKET_MS)
+        {
+            const uint32_t link_kbps = (now >= 10000 && now < 30000) ? 9 : 40;
+            const uint32_t kbps = KBPS[ctl.level()];
+            queue_bytes += kbps * PACKET_MS / 8;
+
+            // One packet per tick; the link moves link_kbps worth of bytes
+            const uint32_t pkt = std::min(queue_bytes, kbps * PACKET_MS / 8);
+            const uint32_t send_ms = pkt * 8 / link_kbps + 2;
+            const uint32_t can = link_kbps * PACKET_MS / 8;
+            queue_bytes -= std::min(queue_bytes, can);
+            ctl.onRtt(20 + queue_bytes * 8 / link_kbps);
+            ctl.onPacket(now, send_ms < 1000, send_ms, queue_bytes * 8 / kbps);
+
+            if (now >= 10000 && now < 30000)
+            {
+                r.max_backlog_ms = std::max(r.max_backlog_ms, queue_bytes * 8 / kbps);
+                r.level_bad = ctl.level();
+            }
+        }
+        r.level_end = ctl.level();
+        r.downs = ctl.stepsDown();
+        r.ups = ctl.stepsUp();
+        return r;
+    }
+
+    void BM_UplinkRateControl(microbench::State &state)
+    {
+        LinkRun r;
+        for (auto _ : state)
+        {
+            r = simulateLink();
+            microbench::doNotOptimize(r);
+        }
+        // 9 kbps only carries the 8 / 6 kbps levels
+        if (r.level_bad < 2)
+            state.error("rate control stayed above the bottleneck");
+        else if (r.max_backlog_ms > 1000)
+            state.error("uplink queue ran away before stepping down");
+        else if (r.level_end != 0)
+            state.error("rate control did not recover to nominal");
+        else if (r.downs > 6)
+            state.error("rate control oscillates");
+    }
+    BENCHMARK(BM_UplinkRateControl);
+
+    // ------------------------------------------------------------------------
+    // Link quality: 10 s samples walking away from the AP (-50 → -80 dBm
+    // over 5 min) with +-3 dB noise, then a congested minute (RTT 2 s, every
+    // other ping lost) at a strong signal. GOOD → FAIR → POOR without
+    // flapping, a roam search after roam_after weak samples and then only
+    // once per cooldown, congestion alone enough for POOR.
+    // ------------------------------------------------------------------------
+    struct QualityRun
+    {
+        uint32_t changes = 0;
+        uint32_t searches = 0;
+        LinkQualityMonitor::Quality far = LinkQualityMonitor::Quality::UNKNOWN;
+        LinkQualityMonitor::Quality congested = LinkQualityMonitor::Quality::UNKNOWN;
+        LinkQualityMonitor::Sleep near_sleep = LinkQualityMonitor::Sleep::NONE;
+    };
+
+    QualityRun simulateWalk()
+    {
+        static constexpr uint32_t SAMPLE_MS = 10000;
+        static constexpr int8_t NOISE[] = {0, 3, -2, 1, -3, 2, -1, 3, -3, 0};
+        LinkQualityMonitor mon;
+        mon.onAssociated();
+
+        QualityRun r;
+        LinkQualityMonitor::Quality prev = mon.quality();
+        uint32_t n = 0;
+        for (uint32_t now = 0; now < 600000; now += SAMPLE_MS, n++)
+        {
+            const bool congested = now >= 480000;
+            LinkQualityMonitor::Sample s;
+            const int32_t base = now < 300000 ? -50 - static_cast<int32_t>(now / 10000) : (congested ? -50 : -80);
+            s.rssi = static_cast<int8_t>(base + NOISE[n % 10]);
+            s.rtt_ms = congested ? 2000 : 40;
+            s.probed = true;
+            s.answered = !congested || (n & 1);
+            if (now == 420000)
+                mon.onAssociated(); // moved to a strong AP
+
+            const LinkQualityMonitor::Quality q = mon.onSample(s);
+            if (q != prev && prev != LinkQualityMonitor::Quality::UNKNOWN)
+                r.changes++;
+            prev = q;
+            if (now == 50000)
+                r.near_sleep = mon.sleep();
+            if (now < 420000 && mon.wantRoam(now))
+            {
+                mon.onRoamAttempt(now);
+                r.searches++;
+            }
+            if (now == 410000)
+                r.far = q;
+        }
+        r.congested = prev;
+        return r;
+    }
+
+    void BM_LinkQuality(microbench::State &state)
+    {
+        QualityRun r;
+        for (auto _ : state)
+        {
+            r = simulateWalk();
+            microbench::doNotOptimize(r);
+        }
+        // Weak from ~-70 dBm (t ~ 200 s) to 420 s: first search after three
+        // weak samples, one more per 120 s cooldown
+        if (r.near_sleep != LinkQualityMonitor::Sleep::MAX_MODEM)
+            state.error("strong link did not get the deepest modem sleep");
+        else if (r.far != LinkQualityMonitor::Quality::POOR)
+            state.error("-80 dBm not classified POOR");
+        else if (r.congested != LinkQualityMonitor::Quality::POOR)
+            state.error("RTT / ping loss did not override a strong RSSI");
+        else if (r.changes > 5)
+            state.error("link quality flaps around a threshold");
+        else if (r.searches < 1 || r.searches > 2)
+            state.error("roam searches ignore roam_after / the cooldown");
+    }
+    BENCHMARK(BM_LinkQuality);
+
+    // ------------------------------------------------------------------------
+    // UtteranceStore: 40 ms ADPCM packets (320 B) into 4 KiB of RAM spilling
+    // to a 32 KiB file. 6 s offline overflows it, the link comes back and
+    // the backlog is replayed, then 4 s more go through the store. FIFO
+    // order and content across RAM and file, the bound, and a GAP on the
+    // first packet after the dropped ones.
+    // ------------------------------------------------------------------------
+    void BM_UtteranceStore(microbench::State &state)
+    {
+        static constexpr size_t PKT = 320;
+        static constexpr uint32_t PACKETS = 250;
+        static constexpr uint32_t RESUME_AT = 150;
+        static constexpr uint8_t GAP = 0x02;
+        const char *path = "ptalk_bench_utt.bin"; // working directory
+
+        UtteranceStore store;
+        UtteranceStore::Config cfg;
+        cfg.ram_bytes = 4 * 1024;
+        cfg.spill_path = path;
+        cfg.spill_max_bytes = 32 * 1024;
+        if (!store.init(cfg))
+        {
+            state.error("store init failed");
+            return;
+        }
+
+        std::vector<uint8_t> pkt(PKT), out(PKT);
+        uint32_t stored = 0, stored_full = 0, replayed = 0, gaps = 0;
+        bool order_ok = true;
+        auto drain = [&](uint32_t &expect)
+        {
+            UtteranceStore::Record r;
+            while (store.peek(r, out.data(), out.size()))
+            {
+                // Dropped packets leave a hole: the next one carries GAP
+                const uint32_t i = r.timestamp_ms / 40;
+                if (i != expect)
+                    order_ok &= (r.flags & GAP) != 0 && i > expect;
+                order_ok &= out[0] == static_cast<uint8_t>(i) && out[PKT - 1] == static_cast<uint8_t>(i) &&
+                            r.len == PKT;
+                gaps += (r.flags & GAP) ? 1 : 0;
+                expect = i + 1;
+                replayed++;
+                store.pop();
+            }
+        };
+
+        for (auto _ : state)
+        {
+            store.clear();
+            stored = replayed = gaps = 0;
+            uint32_t expect = 0;
+            for (uint32_t i = 0; i < PACKETS; i++)
+            {
+                if (i == RESUME_AT)
+                {
+                    stored_full = stored;
+                    drain(expect);
+                }
+                std::fill(pkt.begin(), pkt.end(), static_cast<uint8_t>(i));
+                UtteranceStore::Record r;
+                r.len = PKT;
+                r.flags = store.gapPending() ? GAP : 0;
+                r.timestamp_ms = i * 40;
+                if (store.push(r, pkt.data()))
+                    stored++;
+            }
+            drain(expect);
+            microbench::doNotOptimize(replayed);
+        }
+        auto exists = [path]
+        {
+            FILE *f = std::fopen(path, "rb");
+            if (f)
+                std::fclose(f);
+            return f != nullptr;
+        };
+        const bool spilled_file = exists();
+        store.deinit();
+        const bool removed = !exists();
+
+        // Whole records only: up to one record of slack in RAM and in the file
+        const uint32_t bound = (cfg.ram_bytes + cfg.spill_max_bytes) / (PKT + UtteranceStore::RECORD_HDR);
+        if (!order_ok)
+            state.error("store replay out of order or corrupted");
+        else if (replayed != stored || !store.empty())
+            state.error("store lost packets it accepted");
+        else if (stored_full > bound || stored_full + 2 < bound)
+            state.error("store ignored its RAM / flash bound");
+        else if (gaps != 1 || stored != stored_full + (PACKETS - RESUME_AT))
+            state.error("dropped packets not marked by exactly one GAP");
+        else if (!spilled_file || !removed)
+            state.error("spill file not used or not deleted");
+    }
+    BENCHMARK(BM_UtteranceStore);
+} // namespace
@@ -0,0 +1,54 @@
+// ============================================================================
+// StateManager micro-benchmarks (host): publish fan-out, direct and mailbox
+// ============================================================================
+#include "system/StateManager.hpp"
+
+#include "MicroBench.hpp"
+
+namespace
+{
+    // Three direct subscribers, like the display / audio / controller set
+    void BM_StatePublishDirect(microbench::State &state)
+    {
+        auto &sm = StateManager::instance();
+        uint32_t calls = 0;
+        int ids[3];
+        for (int &id : ids)
+            id = sm.subscribeEmotion([&calls](state::EmotionState) { calls++; });
+
+        uint8_t e = 0;
+        for (auto _ : state)
+            sm.setEmotionState(static_cast<state::EmotionState>(e++ & 3));
+
+        for (int id : ids)
+            sm.unsubscribeEmotion(id);
+        if (calls != state.iterations() * 3)
+            state.error("missed callbacks");
+        state.setItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_StatePublishDirect);
+
+    // Enqueue to a mailbox + pump() on the same thread (deferred path)
+    void BM_StatePublishMailbox(microbench::State &state)
+    {
+        auto &sm = StateManager::instance();
+        StateManager::Mailbox mb = StateManager::createMailbox(8);
+        uint32_t calls = 0;
+        const int id = sm.subscribePower([&calls](state::PowerState) { calls++; }, mb);
+
+        // Unchanged power states are not published: always flip
+        uint8_t p = static_cast<uint8_t>(sm.getPowerState()) + 1;
+        for (auto _ : state)
+        {
+            sm.setPowerState(static_cast<state::PowerState>(p++ & 1));
+            sm.pump(mb, 0);
+        }
+
+        sm.unsubscribePower(id);
+        StateManager::deleteMailbox(mb);
+        if (calls != state.iterations())
+            state.error("missed callbacks");
+        state.setItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_StatePublishMailbox);
+} // namespace
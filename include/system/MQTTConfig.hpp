@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 /**
  * WSConfig.hpp
@@ -34,6 +35,12 @@ namespace mqtt_config
         REQUEST_STATUS = 8,        // Server → Device: Request device status
         REQUEST_OTA = 9,           // Server → Device: Trigger OTA update (optional version)
         REQUEST_BLE_CONFIG = 10,   // Server → Device: Open BLE config mode with WiFi scan
+        SET_ENCODING = 11,         // Server → Device: Switch device → server MQTT encoding (json / msgpack)
+        REQUEST_MEM = 12,          // Server → Device: Full heap / stack / ring telemetry
+        REQUEST_CPU = 13,          // Server → Device: Per-task / per-core CPU load + probes
+        SET_AUDIO_FRONTEND = 14,   // Server → Device: Uplink noise suppression / AGC on-off
+        ANIM_PACK = 15,            // Server → Device: Animation pack to cache (HTTP(S) URL + sha256)
+        MEDIA = 16,                // Server → Device: Long-form playback (play / pause / resume / seek / stop)
         
         // Add more as needed
     };
@@ -175,6 +182,107 @@ namespace mqtt_config
      * }
      */
 
+    /**
+     * Set Encoding (Server → Device)
+     * Chọn encoding cho các message device → server trên MQTT (status,
+     * reply, OTA ACK). Command từ server luôn được nhận ở cả hai dạng (phát
+     * hiện theo byte đầu). Reset về "json" mỗi lần MQTT kết nối lại.
+     * Request:
+     * {
+     *   "cmd": "set_encoding",
+     *   "encoding": "msgpack"   // "json" | "msgpack"
+     * }
+     * Response (sent in the NEW encoding):
+     * {
+     *   "status": "ok" | "invalid_param",
+     *   "encoding": "msgpack"
+     * }
+     */
+
+    /**
+     * Request Memory Report (Server → Device)
+     * Request:
+     * {
+     *   "cmd": "request_mem"
+     * }
+     * Response (sizes in bytes; "free" of a task = lowest stack headroom seen):
+     * {
+     *   "status": "ok",
+     *   "device_id": "A1B2C3D4E5F6",
+     *   "mem": {
+     *     "samples": 120,
+     *     "heap": {"free": 81234, "min_free": 40122, "largest": 53248, "frag": 34},
+     *     "dma": {"free": 80112, "min_free": 39000, "largest": 53248},
+     *     "tasks": {"AudioMicTask": {"size": 3072, "free": 1180, "live": true}, ...},
+     *     "rings": {"mic_pcm": {"cap": 4096, "fill": 512, "peak": 2048}, ...}
+     *   }
+     * }
+     */
+
+    /**
+     * Set Audio Front-end (Server → Device)
+     * Noise suppression / AGC của uplink mic; persists to NVS, applies from
+     * the next mic frame. Omitted fields keep their value.
+     * Request:
+     * {
+     *   "cmd": "set_audio_frontend",
+     *   "ns": true,     // spectral noise suppression
+     *   "agc": false    // automatic gain control
+     * }
+     * Response:
+     * {
+     *   "status": "ok" | "not_supported",
+     *   "ns": true,
+     *   "agc": false,
+     *   "gain_db": 0.0  // current AGC gain
+     * }
+     */
+
+    /**
+     * Animation Pack (Server → Device)
+     * Pack = PTAB bundle (scripts/convert_assets.py bundle); animation names
+     * are registry slots ("angry", "calm"...). Fetched over HTTP(S) when the
+     * device is idle, skipped when a pack with that sha256 is cached.
+     * Request:
+     * {
+     *   "cmd": "anim_pack",
+     *   "pack": "angry",                 // ≤ 16 chars, same name = newer version
+     *   "url": "http://server/packs/angry.bin",
+     *   "sha256": "<64 hex>",
+     *   "size": 48213                     // bytes, ≤ 128 KB - 64
+     * }
+     * Response:
+     * {
+     *   "status": "ok" | "invalid_param",
+     *   "message": "queued" | "cached" | ...
+     * }
+     */
+
+    /**
+     * Media (Server → Device)
+     * Music / podcast stream fetched by the device over HTTP(S) (Range
+     * requests, independent of the WS turn channel), in the device codec:
+     * ADPCM byte stream, or Opus as [u16 LE len][packet] records (CBR for
+     * seek). A voice turn ducks the media instead of stopping it.
+     * Request:
+     * {
+     *   "cmd": "media",
+     *   "action": "play" | "pause" | "resume" | "seek" | "stop",
+     *   "url": "https://server/media/42.adpcm",  // play
+     *   "offset": 0,        // play: first stream byte (resume an earlier stream)
+     *   "ms": 0,            // play: start position / seek: target position
+     *   "rate": 16000,      // play, ADPCM: decoded sample rate (default codec rate)
+     *   "bps": 8000,        // play: stream bytes per second (default from the codec / first record)
+     *   "spill": false      // play: prebuffer past RAM into flash
+     * }
+     * Response:
+     * {
+     *   "status": "ok" | "invalid_param" | "not_supported",
+     *   "message": "buffering" | "paused" | ...
+     * }
+     * Stream end → "<base>/media" {"event": "finished" | "stopped" | "error", "pos_ms": 61230}
+     */
+
     // =========================================================================
     // Helper Functions
     // =========================================================================
@@ -182,7 +290,7 @@ namespace mqtt_config
     /**
      * Parse command string to ConfigCommand enum
      */
-    inline ConfigCommand parseCommandString(const std::string &cmd_str)
+    inline ConfigCommand parseCommandString(std::string_view cmd_str)
     {
         if (cmd_str == "device_handshake")
             return ConfigCommand::DEVICE_HANDSHAKE;
@@ -204,7 +312,19 @@ namespace mqtt_config
             return ConfigCommand::REQUEST_OTA;
         if (cmd_str == "request_ble_config")
             return ConfigCommand::REQUEST_BLE_CONFIG;
-        
+        if (cmd_str == "set_encoding")
+            return ConfigCommand::SET_ENCODING;
+        if (cmd_str == "request_mem")
+            return ConfigCommand::REQUEST_MEM;
+        if (cmd_str == "request_cpu")
+            return ConfigCommand::REQUEST_CPU;
+        if (cmd_str == "set_audio_frontend")
+            return ConfigCommand::SET_AUDIO_FRONTEND;
+        if (cmd_str == "anim_pack")
+            return ConfigCommand::ANIM_PACK;
+        if (cmd_str == "media")
+            return ConfigCommand::MEDIA;
+
         return ConfigCommand::INVALID;
     }
 
@@ -235,6 +355,18 @@ namespace mqtt_config
             return "request_ota";
         case ConfigCommand::REQUEST_BLE_CONFIG:
             return "request_ble_config";
+        case ConfigCommand::SET_ENCODING:
+            return "set_encoding";
+        case ConfigCommand::REQUEST_MEM:
+            return "request_mem";
+        case ConfigCommand::REQUEST_CPU:
+            return "request_cpu";
+        case ConfigCommand::SET_AUDIO_FRONTEND:
+            return "set_audio_frontend";
+        case ConfigCommand::ANIM_PACK:
+            return "anim_pack";
+        case ConfigCommand::MEDIA:
+            return "media";
         default:
             return "invalid";
         }
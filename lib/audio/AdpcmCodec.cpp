@@ -1,13 +1,18 @@
 #include "AdpcmCodec.hpp"
 #include <algorithm>
 
+#if defined(ESP_PLATFORM)
+#include "esp_attr.h"
+#else
+#define IRAM_ATTR
+#define DRAM_ATTR
+#endif
+
 // ================= IMA ADPCM tables =================
 
-static const int8_t indexTable[16] = {
-    -1, -1, -1, -1, 2, 4, 6, 8,
-    -1, -1, -1, -1, 2, 4, 6, 8};
+static constexpr int8_t indexTable[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
 
-static const int16_t stepTable[89] = {
+static constexpr int16_t stepTable[89] = {
     7, 8, 9, 10, 11, 12, 13, 14,
     16, 17, 19, 21, 23, 25, 28, 31,
     34, 37, 41, 45, 50, 55, 60, 66,
@@ -21,17 +26,123 @@ static const int16_t stepTable[89] = {
     15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
     32767};
 
+// Per (index, 3-bit magnitude): dequantized difference and clamped next index.
+// Built at compile time; kept in DRAM so the IRAM kernels never touch flash.
+struct AdpcmTables {
+    int16_t step[89];
+    uint16_t diff[89 * 8]; // up to 15/8 * 32767, needs the full 16 bits
+    uint8_t next[89 * 8];
+};
+
+static constexpr AdpcmTables makeTables()
+{
+    AdpcmTables t{};
+    for (int i = 0; i < 89; i++) {
+        int step = stepTable[i];
+        t.step[i] = static_cast<int16_t>(step);
+        for (int d = 0; d < 8; d++) {
+            int dq = step >> 3;
+            if (d & 4) dq += step;
+            if (d & 2) dq += step >> 1;
+            if (d & 1) dq += step >> 2;
+            int n = i + indexTable[d];
+            t.diff[i * 8 + d] = static_cast<uint16_t>(dq);
+            t.next[i * 8 + d] = static_cast<uint8_t>(n < 0 ? 0 : (n > 88 ? 88 : n));
+        }
+    }
+    return t;
+}
+
+static const DRAM_ATTR AdpcmTables kTables = makeTables();
+
+// ===================================================
+// One sample (inlined into the block loops)
+// ===================================================
+
+static inline int encodeNibble(int& predictor, int& index, int sample)
+{
+    const int step = kTables.step[index];
+    int diff = sample - predictor;
+    const int s = diff >> 31;      // 0 or -1
+    diff = (diff ^ s) - s;         // |diff|
+
+    // Successive approximation without branches
+    const int b2 = diff >= step;
+    diff -= step & -b2;
+    const int b1 = diff >= (step >> 1);
+    diff -= (step >> 1) & -b1;
+    const int b0 = diff >= (step >> 2);
+    const int delta = (b2 << 2) | (b1 << 1) | b0;
+
+    const int k = index * 8 + delta;
+    const int dq = kTables.diff[k];
+    predictor = std::min(std::max(predictor + ((dq ^ s) - s), -32768), 32767);
+    index = kTables.next[k];
+    return delta | (s & 8);
+}
+
+static inline int decodeNibble(int& predictor, int& index, int nibble)
+{
+    const int k = index * 8 + (nibble & 7);
+    const int s = -(nibble >> 3);  // 0 or -1
+    const int dq = kTables.diff[k];
+    predictor = std::min(std::max(predictor + ((dq ^ s) - s), -32768), 32767);
+    index = kTables.next[k];
+    return predictor;
+}
+
+// ===================================================
+// Block kernels (IRAM)
+// ===================================================
+
+void IRAM_ATTR AdpcmCodec::encodeBlock(AdpcmState& st, const int16_t* pcm, size_t pairs, uint8_t* out)
+{
+    int predictor = st.predictor;
+    int index = st.index;
+    for (size_t i = 0; i < pairs; i++) {
+        int hi = encodeNibble(predictor, index, pcm[2 * i]);
+        int lo = encodeNibble(predictor, index, pcm[2 * i + 1]);
+        out[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    st.predictor = static_cast<int16_t>(predictor);
+    st.index = static_cast<int8_t>(index);
+}
+
+void IRAM_ATTR AdpcmCodec::decodeBlock(AdpcmState& st, const uint8_t* in, size_t pairs, int16_t* pcm)
+{
+    int predictor = st.predictor;
+    int index = st.index;
+    for (size_t i = 0; i < pairs; i++) {
+        const int byte = in[i];
+        pcm[2 * i] = static_cast<int16_t>(decodeNibble(predictor, index, byte >> 4));
+        pcm[2 * i + 1] = static_cast<int16_t>(decodeNibble(predictor, index, byte & 0x0F));
+    }
+    st.predictor = static_cast<int16_t>(predictor);
+    st.index = static_cast<int8_t>(index);
+}
+
 // ===================================================
 
 AdpcmCodec::AdpcmCodec(uint32_t sample_rate)
     : sample_rate_(sample_rate) {}
 
-void AdpcmCodec::reset()
+void AdpcmCodec::resetEncoder()
 {
     enc_ = {};
+}
+
+void AdpcmCodec::resetDecoder()
+{
     dec_ = {};
 }
 
+bool AdpcmCodec::resyncDecoder(int16_t predictor, uint8_t index)
+{
+    dec_.predictor = predictor;
+    dec_.index = static_cast<int8_t>(std::min<uint8_t>(index, 88));
+    return true;
+}
+
 // ===================================================
 // Encode PCM -> ADPCM (4:1)
 // ===================================================
@@ -41,74 +152,23 @@ size_t AdpcmCodec::encode(const int16_t *pcm,
                           uint8_t *out,
                           size_t out_capacity)
 {
-    int predictor = enc_.predictor;
-    int index = enc_.index;
-    int step = stepTable[index];
-
-    size_t out_index = 0;
-    uint8_t out_byte = 0;
-    bool high_nibble = false;
-
-    for (size_t i = 0; i < pcm_samples && out_index < out_capacity; ++i)
-    {
-        int diff = pcm[i] - predictor;
-        int sign = (diff < 0) ? 8 : 0;
-        if (sign)
-            diff = -diff;
-
-        int delta = 0;
-        int tempStep = step;
-
-        if (diff >= tempStep)
-        {
-            delta |= 4;
-            diff -= tempStep;
-        }
-        tempStep >>= 1;
-        if (diff >= tempStep)
-        {
-            delta |= 2;
-            diff -= tempStep;
-        }
-        tempStep >>= 1;
-        if (diff >= tempStep)
-            delta |= 1;
-
-        int nibble = delta | sign;
-
-        int diffq = step >> 3;
-        if (delta & 1)
-            diffq += step >> 2;
-        if (delta & 2)
-            diffq += step >> 1;
-        if (delta & 4)
-            diffq += step;
-
-        predictor += sign ? -diffq : diffq;
-        predictor = std::clamp(predictor, -32768, 32767);
-
-        index += indexTable[nibble];
-        index = std::clamp(index, 0, 88);
-        step = stepTable[index];
-
-        if (!high_nibble)
-        {
-            out_byte = (nibble & 0x0F) << 4; // HIGH nibble
-            high_nibble = true;
-        }
-        else
-        {
-            out[out_index++] = out_byte | (nibble & 0x0F); // LOW nibble
-            high_nibble = false;
-        }
+    if (!pcm || !out)
+        return 0;
+
+    size_t pairs = std::min(pcm_samples / 2, out_capacity);
+    encodeBlock(enc_, pcm, pairs, out);
+    size_t out_index = pairs;
+
+    // Odd tail: last byte carries only the HIGH nibble
+    if (pcm_samples & 1 && out_index < out_capacity && pairs == pcm_samples / 2) {
+        int predictor = enc_.predictor;
+        int index = enc_.index;
+        int nibble = encodeNibble(predictor, index, pcm[pcm_samples - 1]);
+        enc_.predictor = static_cast<int16_t>(predictor);
+        enc_.index = static_cast<int8_t>(index);
+        out[out_index++] = static_cast<uint8_t>(nibble << 4);
     }
 
-    if (high_nibble && out_index < out_capacity)
-        out[out_index++] = out_byte;
-
-    enc_.predictor = predictor;
-    enc_.index = index;
-
     return out_index;
 }
 
@@ -121,46 +181,22 @@ size_t AdpcmCodec::decode(const uint8_t *data,
                           int16_t *pcm_out,
                           size_t pcm_capacity)
 {
-    int predictor = dec_.predictor;
-    int index = dec_.index;
-    int step = stepTable[index];
-
-    size_t out_samples = 0;
-
-    for (size_t i = 0; i < data_len && out_samples < pcm_capacity; ++i)
-    {
-        uint8_t byte = data[i];
-
-        for (int shift = 4; shift >= 0; shift -= 4)
-        {
-            int nibble = (byte >> shift) & 0x0F;
-            int sign = nibble & 8;
-            int delta = nibble & 7;
-
-            int diffq = step >> 3;
-            if (delta & 4)
-                diffq += step;
-            if (delta & 2)
-                diffq += step >> 1;
-            if (delta & 1)
-                diffq += step >> 2;
-
-            predictor += sign ? -diffq : diffq;
-            predictor = std::clamp(predictor, -32768, 32767);
-
-            index += indexTable[nibble];
-            index = std::clamp(index, 0, 88);
-            step = stepTable[index];
-
-            pcm_out[out_samples++] = predictor;
-            if (out_samples >= pcm_capacity)
-                break;
-        }
+    if (!data || !pcm_out)
+        return 0;
+
+    size_t pairs = std::min(data_len, pcm_capacity / 2);
+    decodeBlock(dec_, data, pairs, pcm_out);
+    size_t out_samples = pairs * 2;
+
+    // Odd capacity: one more HIGH nibble fits
+    if (pairs < data_len && out_samples < pcm_capacity) {
+        int predictor = dec_.predictor;
+        int index = dec_.index;
+        pcm_out[out_samples++] = static_cast<int16_t>(decodeNibble(predictor, index, data[pairs] >> 4));
+        dec_.predictor = static_cast<int16_t>(predictor);
+        dec_.index = static_cast<int8_t>(index);
     }
 
-    dec_.predictor = predictor;
-    dec_.index = index;
-
     return out_samples;
 }
 
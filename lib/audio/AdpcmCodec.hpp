@@ -1,8 +1,27 @@
 #pragma once
 #include "AudioCodec.hpp"
 
+/**
+ * AdpcmCodec
+ * ============================================================================
+ * IMA ADPCM 4:1, mono, 256 samples ↔ 128 bytes per frame.
+ * Byte layout: sample chẵn ở HIGH nibble, sample lẻ ở LOW nibble.
+ *
+ * Kernel: bảng diff/next-index (index x delta) tính lúc compile, lượng tử
+ * hóa không rẽ nhánh, 2 nibble mỗi byte, đặt trong IRAM. Bit-exact với IMA
+ * cổ điển (bench/adpcm_bench.cpp kiểm tra và đo cycles/sample trên host).
+ *
+ * Mất gói: decoder lệch predictor / index so với encoder của server cho tới
+ * khi resyncDecoder() nhận state mà server gửi kèm gói (FLAG_SYNC); không
+ * có PLC riêng (conceal() = 0).
+ */
 class AdpcmCodec : public AudioCodec {
 public:
+    struct AdpcmState {
+        int16_t predictor = 0;
+        int8_t  index = 0;
+    };
+
     explicit AdpcmCodec(uint32_t sample_rate = 16000);
 
     size_t encode(const int16_t* pcm,
@@ -15,20 +34,27 @@ public:
                   int16_t* pcm_out,
                   size_t pcm_capacity) override;
 
-    void reset() override;
+    void resetEncoder() override;
+    void resetDecoder() override;
+    bool resyncDecoder(int16_t predictor, uint8_t index) override;
 
     size_t pcmFrameSamples() const override;
     size_t encodedFrameBytes() const override;
 
+    // 4 bits per sample
+    uint32_t bitrate() const override { return sample_rate_ * 4; }
+
     uint32_t sampleRate() const override;
     uint8_t channels() const override;
+    const char* name() const override { return "adpcm"; }
 
-private:
-    struct AdpcmState {
-        int16_t predictor = 0;
-        int8_t  index = 0;
-    };
+    // ------------------------------------------------------------------------
+    // Block kernels: `pairs` sample pairs ↔ `pairs` bytes, state in/out
+    // ------------------------------------------------------------------------
+    static void encodeBlock(AdpcmState& st, const int16_t* pcm, size_t pairs, uint8_t* out);
+    static void decodeBlock(AdpcmState& st, const uint8_t* in, size_t pairs, int16_t* pcm);
 
+private:
     AdpcmState enc_;
     AdpcmState dec_;
     uint32_t sample_rate_;
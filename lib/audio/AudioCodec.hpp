@@ -26,18 +26,57 @@ public:
     // Reset internal state
     //  - ADPCM: predictor + index
     //  - Opus : decoder / encoder state
+    // Encoder and decoder state are independent: AudioManager encodes and
+    // decodes from two tasks at once, each resetting only its own side.
+    // Implementations must not share scratch memory between the two.
     // =========================================================
-    virtual void reset() = 0;
+    virtual void resetEncoder() = 0;
+    virtual void resetDecoder() = 0;
+    void reset() { resetEncoder(); resetDecoder(); }
+
+    // =========================================================
+    // Downlink loss handling (packet lost / truncated)
+    // =========================================================
+    // One frame for a lost packet from the decoder's own PLC; 0 = none,
+    // AudioManager then repeats the waveform (PacketLossConcealer).
+    virtual size_t conceal(int16_t* /*pcm_out*/, size_t /*pcm_capacity*/) { return 0; }
+
+    // The frame lost right before `data`, from the in-band FEC that packet
+    // carries (Opus LBRR); 0 = none. `data` is decoded normally afterwards.
+    virtual size_t decodeFec(const uint8_t* /*data*/, size_t /*data_len*/,
+                             int16_t* /*pcm_out*/, size_t /*pcm_capacity*/) { return 0; }
+
+    // Decoder state the server sent with a packet (stateful sample codecs:
+    // ADPCM predictor + step index). false = codec has no such state.
+    virtual bool resyncDecoder(int16_t /*predictor*/, uint8_t /*index*/) { return false; }
 
     // =========================================================
     // Frame hints (task loop KHÔNG hardcode)
     // =========================================================
     virtual size_t pcmFrameSamples() const = 0;      // e.g. 256
-    virtual size_t encodedFrameBytes() const = 0;    // e.g. 512
+    virtual size_t encodedFrameBytes() const = 0;    // e.g. 128 (nominal size of one frame)
+
+    // Largest packet encode() may produce for one PCM frame.
+    virtual size_t maxEncodedFrameBytes() const { return encodedFrameBytes(); }
+
+    // true  → packets vary in size (Opus); on the wire / in the rings each
+    //         packet is prefixed with its length: [u16 LE len][packet]
+    // false → plain byte stream, decode() accepts any split (ADPCM)
+    virtual bool variableFrameSize() const { return false; }
+
+    // Nominal encoder bitrate (bps) and a live change of it, applied from
+    // the next encode() (uplink rate control). false = fixed-rate codec.
+    virtual uint32_t bitrate() const = 0;
+    virtual bool setBitrate(uint32_t /*bps*/) { return false; }
+
+    // Stack the encoder / decoder task needs for encode() / decode() calls.
+    virtual uint32_t encoderStackBytes() const { return 8192; }
+    virtual uint32_t decoderStackBytes() const { return 8192; }
 
     // =========================================================
     // Info
     // =========================================================
     virtual uint32_t sampleRate() const = 0;         // 16000
     virtual uint8_t channels() const = 0;            // 1
+    virtual const char* name() const = 0;            // "adpcm", "opus" (handshake)
 };
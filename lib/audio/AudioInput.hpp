@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <cstddef>
 
+#include "DmaPreset.hpp"
+
 /**
  * AudioInput
  * ============================================================================
@@ -55,6 +57,11 @@ public:
     // Power saving mode
     virtual void setLowPower(bool enable) = 0;
 
+    // Re-shape the DMA queue (DmaPreset.hpp). Call from the task that
+    // calls readPcm(); capture keeps running (a few ms of audio are lost).
+    // false = unsupported or failed.
+    virtual bool setDmaPreset(DmaPreset preset) { (void)preset; return false; }
+
     // ========================================================================
     // Info
     // ========================================================================
@@ -62,4 +69,8 @@ public:
     virtual uint32_t sampleRate() const = 0;
     virtual uint8_t  channels() const   = 0;
     virtual uint8_t  bitsPerSample() const = 0;
+
+    // DMA overruns seen so far (captured audio dropped because readPcm()
+    // was late). Monotonic; 0 when the source cannot tell.
+    virtual uint32_t overruns() const { return 0; }
 };
@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <cstddef>
 
+#include "DmaPreset.hpp"
+
 /**
  * AudioOutput
  * ============================================================================
@@ -50,6 +52,10 @@ public:
     // Power saving mode
     virtual void setLowPower(bool enable) = 0;
 
+    // Re-shape the DMA queue (DmaPreset.hpp); only while playback is
+    // stopped. false = unsupported, running or failed.
+    virtual bool setDmaPreset(DmaPreset preset) { (void)preset; return false; }
+
     // ========================================================================
     // Info
     // ========================================================================
@@ -57,4 +63,12 @@ public:
     virtual uint32_t sampleRate() const = 0;
     virtual uint8_t  channels() const   = 0;
     virtual uint8_t  bitsPerSample() const = 0;
+
+    // Delay from writePcm() to the speaker (DMA queue), 0 = unknown
+    virtual uint32_t queueDelayMs() const { return 0; }
+
+    // DMA underruns seen so far (the hardware replayed silence because no
+    // data was queued in time). Monotonic; 0 when the sink cannot tell.
+    // Idle gaps count too: callers look at deltas while data is flowing.
+    virtual uint32_t underruns() const { return 0; }
 };
@@ -0,0 +1,164 @@
+#include "CommandRecognizer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "CommandRecognizer";
+
+namespace
+{
+    struct CommandName
+    {
+        VoiceCommand cmd;
+        const char *name;
+    };
+
+    constexpr CommandName NAMES[] = {
+        {VoiceCommand::VOLUME_UP, "volume_up"},
+        {VoiceCommand::VOLUME_DOWN, "volume_down"},
+        {VoiceCommand::CANCEL, "cancel"},
+        {VoiceCommand::SLEEP, "sleep"},
+    };
+} // namespace
+
+const char *voiceCommandName(VoiceCommand c)
+{
+    for (const auto &n : NAMES)
+        if (n.cmd == c)
+            return n.name;
+    return "none";
+}
+
+VoiceCommand voiceCommandFromLabel(const char *label)
+{
+    if (!label)
+        return VoiceCommand::NONE;
+    for (const auto &n : NAMES)
+        if (strcmp(n.name, label) == 0)
+            return n.cmd;
+    return VoiceCommand::NONE;
+}
+
+// ============================================================================
+// Init
+// ============================================================================
+bool CommandRecognizer::init(const Config &cfg, CommandModel *model, const KeywordSpotter &front_end)
+{
+    deinit();
+    if (!model || !front_end.ready())
+        return false;
+    if (model->inputFrames() != front_end.frames() || model->inputCoeffs() != front_end.coeffs() ||
+        model->inputScale() != front_end.inputScale())
+    {
+        ESP_LOGE(TAG, "Model %s does not match the KWS front-end (%u x %u)", model->name(),
+                 (unsigned)front_end.frames(), (unsigned)front_end.coeffs());
+        return false;
+    }
+    classes_ = model->numClasses();
+    if (classes_ < 2 || classes_ > CommandModel::MAX_CLASSES)
+    {
+        ESP_LOGE(TAG, "Unsupported class count %u", (unsigned)classes_);
+        return false;
+    }
+
+    size_t commands = 0;
+    for (size_t k = 0; k < classes_; k++)
+    {
+        map_[k] = voiceCommandFromLabel(model->label(k));
+        commands += map_[k] != VoiceCommand::NONE;
+    }
+    if (commands == 0)
+    {
+        ESP_LOGE(TAG, "Model %s has no known command label", model->name());
+        return false;
+    }
+
+    cfg_ = cfg;
+    cfg_.smooth_frames = std::clamp<uint8_t>(cfg_.smooth_frames, 1, MAX_SMOOTH);
+    cfg_.infer_every_hops = std::max<uint8_t>(cfg_.infer_every_hops, 1);
+    window_hops_ = cfg_.window_ms / std::max<uint16_t>(front_end.hopMs(), 1);
+    model_ = model;
+    reset();
+
+    ESP_LOGI(TAG, "Commands ready: model %s, %u classes (%u commands), window %u ms",
+             model->name(), (unsigned)classes_, (unsigned)commands, (unsigned)cfg_.window_ms);
+    return true;
+}
+
+void CommandRecognizer::reset()
+{
+    synced_ = false;
+    fired_ = false;
+    hops_ = 0;
+    since_infer_ = 0;
+    prob_idx_ = 0;
+    prob_count_ = 0;
+    last_score_ = 0;
+}
+
+// ============================================================================
+// Poll: infer on the shared window, smooth, decide
+// ============================================================================
+VoiceCommand CommandRecognizer::poll(const KeywordSpotter &front_end)
+{
+    if (!model_ || expired())
+        return VoiceCommand::NONE;
+
+    const uint32_t now_hops = front_end.hops();
+    if (!synced_)
+    {
+        synced_ = true;
+        seen_hops_ = now_hops;
+        return VoiceCommand::NONE;
+    }
+    const uint32_t fresh = now_hops - seen_hops_;
+    seen_hops_ = now_hops;
+    hops_ += fresh;
+    since_infer_ = static_cast<uint8_t>(std::min<uint32_t>(since_infer_ + fresh, 0xFF));
+    if (since_infer_ < cfg_.infer_every_hops || !front_end.windowFull())
+        return VoiceCommand::NONE;
+    since_infer_ = 0;
+
+    const int64_t t0 = esp_timer_get_time();
+    model_->inferClasses(front_end.features(), probs_[prob_idx_]);
+    last_infer_us_ = static_cast<uint32_t>(esp_timer_get_time() - t0);
+    prob_idx_ = (prob_idx_ + 1) % cfg_.smooth_frames;
+    if (prob_count_ < cfg_.smooth_frames)
+        prob_count_++;
+    if (prob_count_ < cfg_.smooth_frames)
+        return VoiceCommand::NONE;
+
+    // Smoothed posterior: best and runner-up class
+    uint32_t best = 0, second = 0;
+    size_t best_k = 0;
+    for (size_t k = 0; k < classes_; k++)
+    {
+        uint32_t sum = 0;
+        for (uint8_t i = 0; i < prob_count_; i++)
+            sum += probs_[i][k];
+        const uint32_t p = sum / prob_count_;
+        if (p > best)
+        {
+            second = best;
+            best = p;
+            best_k = k;
+        }
+        else if (p > second)
+        {
+            second = p;
+        }
+    }
+    last_score_ = static_cast<uint8_t>(best);
+
+    const VoiceCommand cmd = map_[best_k];
+    if (cmd == VoiceCommand::NONE || best < cfg_.threshold || best - second < cfg_.margin)
+        return VoiceCommand::NONE;
+
+    ESP_LOGI(TAG, "Command %s (score=%u, runner-up=%u, infer=%u us)", voiceCommandName(cmd),
+             (unsigned)best, (unsigned)second, (unsigned)last_infer_us_);
+    fired_ = true; // one window, one command
+    return cmd;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "KeywordSpotter.hpp"
+
+// Device-local intents: handled without the server in the loop.
+enum class VoiceCommand : uint8_t
+{
+    NONE,
+    VOLUME_UP,   // "to lên" / "louder"
+    VOLUME_DOWN, // "nhỏ lại" / "quieter"
+    CANCEL,      // "dừng" / "stop"
+    SLEEP,       // "đi ngủ" / "go to sleep"
+    COUNT
+};
+
+const char *voiceCommandName(VoiceCommand c);
+// Model label → command ("volume_up", "volume_down", "cancel", "sleep");
+// anything else (filler, silence) is NONE.
+VoiceCommand voiceCommandFromLabel(const char *label);
+
+/**
+ * CommandModel
+ * ============================================================================
+ * Bộ phân loại lệnh nhiều lớp trên cùng cửa sổ MFCC int8 với wake-word
+ * (KeywordModel: inputFrames() x inputCoeffs(), inputScale()). Mỗi lớp có
+ * một nhãn; lớp không map sang VoiceCommand nào (filler "_unknown_",
+ * "_silence_") là "không phải lệnh".
+ *
+ * infer() (KeywordModel) = xác suất lớn nhất trong các lớp lệnh, để model
+ * này cũng dựng được front-end của KeywordSpotter khi không có wake-word.
+ */
+class CommandModel : public KeywordModel
+{
+public:
+    static constexpr size_t MAX_CLASSES = 12;
+
+    virtual size_t numClasses() const = 0;
+    virtual const char *label(size_t cls) const = 0;
+    // Probabilities 0..255 of every class into probs[numClasses()].
+    virtual void inferClasses(const int8_t *features, uint8_t *probs) = 0;
+};
+
+/**
+ * CommandRecognizer
+ * ============================================================================
+ * Nhận lệnh ngắn ngay trên thiết bị ("to lên", "dừng", "đi ngủ"...) để khỏi
+ * đi một vòng ASR/NLU trên server chỉ để nhận về SET_AUDIO_VOLUME / cancel.
+ *
+ * - Không có front-end riêng: đọc cửa sổ MFCC của KeywordSpotter (wake-word
+ *   và lệnh dùng chung FFT / mel / DCT, MFCC tính một lần mỗi hop).
+ * - Infer mỗi infer_every_hops hop mới; posterior từng lớp trung bình trên
+ *   smooth_frames lần. Lệnh được nhận khi lớp đó ≥ threshold và hơn lớp kế
+ *   tiếp ít nhất margin (filler thắng sát nút → không làm gì).
+ * - Chỉ nghe trong window_ms đầu (lệnh là cả câu nói ngắn; câu dài hơn là
+ *   yêu cầu cho server). Hết cửa sổ, hoặc đã nhận một lệnh → expired().
+ *
+ * Không thread-safe: chỉ KWS task gọi, sau KeywordSpotter::feed().
+ */
+class CommandRecognizer
+{
+public:
+    struct Config
+    {
+        uint8_t infer_every_hops = 2; // 40 ms at 20 ms hops
+        uint8_t smooth_frames = 3;    // posterior averaging (inferences)
+        uint8_t threshold = 190;      // 0..255 on the smoothed posterior
+        uint8_t margin = 96;          // over the runner-up class
+        uint16_t window_ms = 2000;    // listen this long after reset()
+    };
+
+    CommandRecognizer() = default;
+
+    CommandRecognizer(const CommandRecognizer &) = delete;
+    CommandRecognizer &operator=(const CommandRecognizer &) = delete;
+
+    // `model` (not owned) must read the window `front_end` builds.
+    bool init(const Config &cfg, CommandModel *model, const KeywordSpotter &front_end);
+    void deinit() { model_ = nullptr; }
+    bool ready() const { return model_ != nullptr; }
+
+    // New listening window (history and smoothing dropped).
+    void reset();
+
+    // New MFCC rows since the last call → maybe a command. NONE otherwise.
+    VoiceCommand poll(const KeywordSpotter &front_end);
+    bool expired() const { return fired_ || hops_ >= window_hops_; }
+
+    uint8_t lastScore() const { return last_score_; }
+    uint32_t lastInferUs() const { return last_infer_us_; }
+
+private:
+    static constexpr size_t MAX_SMOOTH = 8;
+
+    Config cfg_{};
+    CommandModel *model_ = nullptr;
+    size_t classes_ = 0;
+    VoiceCommand map_[CommandModel::MAX_CLASSES] = {};
+
+    bool synced_ = false;     // seen_hops_ valid (first poll after reset())
+    bool fired_ = false;      // a command was returned since reset()
+    uint32_t seen_hops_ = 0;  // KeywordSpotter::hops() at the last poll
+    uint32_t hops_ = 0;       // since reset()
+    uint32_t window_hops_ = 0;
+    uint8_t since_infer_ = 0;
+
+    uint8_t probs_[MAX_SMOOTH][CommandModel::MAX_CLASSES] = {};
+    uint8_t prob_idx_ = 0;
+    uint8_t prob_count_ = 0;
+    uint8_t last_score_ = 0;
+    uint32_t last_infer_us_ = 0;
+};
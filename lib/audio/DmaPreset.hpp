@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * DmaPreset
+ * ============================================================================
+ * Hình dạng hàng đợi DMA của I2S (số descriptor x sample mỗi descriptor):
+ * đổi độ trễ lấy khả năng chịu task bị trễ.
+ *
+ *   LOW_LATENCY  4 x  64 = 256 sample  (16 ms @16 kHz)  ISR mỗi 4 ms
+ *   BALANCED     6 x 128 = 768 sample  (48 ms)          ISR mỗi 8 ms
+ *   ROBUST       8 x 192 = 1536 sample (96 ms)          ISR mỗi 12 ms
+ *
+ * - TX: tổng hàng đợi là độ trễ writePcm() → loa, cũng là thời gian speaker
+ *   task được phép trễ trước khi DMA phát im lặng (underrun).
+ * - RX: buf_len là độ hạt dữ liệu tới readPcm(); tổng hàng đợi là thời gian
+ *   mic task được phép trễ trước khi DMA ghi đè (overrun).
+ */
+enum class DmaPreset : uint8_t
+{
+    LOW_LATENCY,
+    BALANCED,
+    ROBUST
+};
+
+struct DmaGeometry
+{
+    int buf_count = 6; // descriptors (legacy driver: 2..128)
+    int buf_len = 128; // samples per descriptor (legacy driver: 8..1024)
+
+    constexpr uint32_t samples() const { return static_cast<uint32_t>(buf_count * buf_len); }
+    constexpr uint32_t delayMs(uint32_t sample_rate) const
+    {
+        return sample_rate ? samples() * 1000 / sample_rate : 0;
+    }
+    constexpr bool operator==(const DmaGeometry &o) const { return buf_count == o.buf_count && buf_len == o.buf_len; }
+    constexpr bool operator!=(const DmaGeometry &o) const { return !(*this == o); }
+};
+
+constexpr DmaGeometry dmaGeometry(DmaPreset p)
+{
+    switch (p)
+    {
+    case DmaPreset::LOW_LATENCY:
+        return {4, 64};
+    case DmaPreset::ROBUST:
+        return {8, 192};
+    case DmaPreset::BALANCED:
+    default:
+        return {6, 128};
+    }
+}
+
+constexpr const char *dmaPresetName(DmaPreset p)
+{
+    switch (p)
+    {
+    case DmaPreset::LOW_LATENCY:
+        return "low_latency";
+    case DmaPreset::ROBUST:
+        return "robust";
+    case DmaPreset::BALANCED:
+    default:
+        return "balanced";
+    }
+}
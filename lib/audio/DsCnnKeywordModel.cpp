@@ -0,0 +1,236 @@
+#include "DsCnnKeywordModel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+
+#include "esp_log.h"
+
+#if PTALK_HAS_KWS_MODEL
+#include "kws_model_data.h"
+#endif
+#if PTALK_HAS_CMD_MODEL
+#include "cmd_model_data.h"
+#endif
+
+static const char *TAG = "DsCnn";
+
+DsCnnRunner::DsCnnRunner(const DsCnnTable &table) : t_(table)
+{
+    if (t_.num_layers == 0 || !t_.layers || t_.layers[t_.num_layers - 1].type != KwsLayer::DENSE ||
+        t_.layers[t_.num_layers - 1].out_ch != t_.num_classes || t_.num_classes < 2 ||
+        t_.num_classes > MAX_CLASSES)
+    {
+        ESP_LOGE(TAG, "Model %s: table inconsistent", t_.name);
+        return;
+    }
+
+    act_bytes_ = std::max<size_t>(t_.max_act_bytes, static_cast<size_t>(t_.input_frames) * t_.input_coeffs);
+    arena_.reset(new (std::nothrow) int8_t[2 * act_bytes_]);
+    if (!arena_)
+    {
+        ESP_LOGE(TAG, "Model %s: no RAM for %u B activation arena", t_.name, (unsigned)(2 * act_bytes_));
+        return;
+    }
+    valid_ = true;
+}
+
+int8_t DsCnnRunner::requant(int32_t acc, const KwsLayer &l)
+{
+    int64_t v = static_cast<int64_t>(acc) * l.mult;
+    if (l.shift > 0)
+        v = (v + (int64_t(1) << (l.shift - 1))) >> l.shift;
+    int32_t lo = l.relu ? 0 : -128;
+    return static_cast<int8_t>(std::clamp<int64_t>(v, lo, 127));
+}
+
+// ----------------------------------------------------------------------------
+// One layer, "same" padding, HWC int8 → HWC int8
+// ----------------------------------------------------------------------------
+DsCnnRunner::Shape DsCnnRunner::runLayer(const KwsLayer &l, Shape in,
+                                                     const int8_t *src, int8_t *dst) const
+{
+    if (l.type == KwsLayer::POINTWISE)
+    {
+        const size_t pixels = static_cast<size_t>(in.h) * in.w;
+        for (size_t p = 0; p < pixels; p++)
+        {
+            const int8_t *x = &src[p * in.c];
+            for (uint16_t oc = 0; oc < l.out_ch; oc++)
+            {
+                const int8_t *w = &l.weights[static_cast<size_t>(oc) * in.c];
+                int32_t acc = l.bias ? l.bias[oc] : 0;
+                for (uint16_t ic = 0; ic < in.c; ic++)
+                    acc += x[ic] * w[ic];
+                dst[p * l.out_ch + oc] = requant(acc, l);
+            }
+        }
+        return {in.h, in.w, l.out_ch};
+    }
+
+    const uint16_t oh = (in.h + l.sh - 1) / l.sh;
+    const uint16_t ow = (in.w + l.sw - 1) / l.sw;
+    const int pad_t = std::max(0, ((oh - 1) * l.sh + l.kh - in.h) / 2);
+    const int pad_l = std::max(0, ((ow - 1) * l.sw + l.kw - in.w) / 2);
+    const bool dw = l.type == KwsLayer::DEPTHWISE;
+    const uint16_t out_c = dw ? in.c : l.out_ch;
+
+    for (int oy = 0; oy < oh; oy++)
+    {
+        for (int ox = 0; ox < ow; ox++)
+        {
+            int8_t *y = &dst[(static_cast<size_t>(oy) * ow + ox) * out_c];
+            for (uint16_t oc = 0; oc < out_c; oc++)
+            {
+                int32_t acc = l.bias ? l.bias[oc] : 0;
+                for (int ky = 0; ky < l.kh; ky++)
+                {
+                    int iy = oy * l.sh + ky - pad_t;
+                    if (iy < 0 || iy >= in.h)
+                        continue;
+                    for (int kx = 0; kx < l.kw; kx++)
+                    {
+                        int ix = ox * l.sw + kx - pad_l;
+                        if (ix < 0 || ix >= in.w)
+                            continue;
+                        const int8_t *x = &src[(static_cast<size_t>(iy) * in.w + ix) * in.c];
+                        if (dw)
+                        {
+                            acc += x[oc] * l.weights[(ky * l.kw + kx) * in.c + oc];
+                        }
+                        else
+                        {
+                            const int8_t *w = &l.weights[((static_cast<size_t>(oc) * l.kh + ky) * l.kw + kx) * in.c];
+                            for (uint16_t ic = 0; ic < in.c; ic++)
+                                acc += x[ic] * w[ic];
+                        }
+                    }
+                }
+                y[oc] = requant(acc, l);
+            }
+        }
+    }
+    return {oh, ow, out_c};
+}
+
+// ----------------------------------------------------------------------------
+// Full forward pass → softmax of every class in 0..255
+// ----------------------------------------------------------------------------
+bool DsCnnRunner::run(const int8_t *features, uint8_t *probs)
+{
+    if (!valid_ || !features || !probs)
+        return false;
+
+    int8_t *bufs[2] = {&arena_[0], &arena_[act_bytes_]};
+    const int8_t *src = features;
+    Shape s{t_.input_frames, t_.input_coeffs, 1};
+    int cur = 0;
+
+    for (size_t i = 0; i + 1 < t_.num_layers; i++)
+    {
+        s = runLayer(t_.layers[i], s, src, bufs[cur]);
+        src = bufs[cur];
+        cur ^= 1;
+    }
+
+    // Global average pool → dense logits
+    const KwsLayer &fc = t_.layers[t_.num_layers - 1];
+    const size_t pixels = static_cast<size_t>(s.h) * s.w;
+    float logits[MAX_CLASSES];
+    for (uint8_t k = 0; k < t_.num_classes; k++)
+    {
+        int64_t acc = 0;
+        for (uint16_t c = 0; c < s.c; c++)
+        {
+            int32_t sum = 0;
+            for (size_t p = 0; p < pixels; p++)
+                sum += src[p * s.c + c];
+            acc += static_cast<int64_t>(sum) * fc.weights[static_cast<size_t>(k) * s.c + c];
+        }
+        acc /= static_cast<int64_t>(pixels);
+        if (fc.bias)
+            acc += fc.bias[k];
+        logits[k] = static_cast<float>(acc) * t_.logit_scale;
+    }
+
+    float max_l = logits[0];
+    for (uint8_t k = 1; k < t_.num_classes; k++)
+        max_l = std::max(max_l, logits[k]);
+    float denom = 0.0f;
+    for (uint8_t k = 0; k < t_.num_classes; k++)
+    {
+        logits[k] = expf(logits[k] - max_l);
+        denom += logits[k];
+    }
+    for (uint8_t k = 0; k < t_.num_classes; k++)
+        probs[k] = static_cast<uint8_t>(std::clamp(logits[k] / denom * 255.0f + 0.5f, 0.0f, 255.0f));
+    return true;
+}
+
+// ============================================================================
+// Wake-word model (kws_model_data.h)
+// ============================================================================
+#if PTALK_HAS_KWS_MODEL
+
+static constexpr DsCnnTable KWS_TABLE = {
+    kws_model::INPUT_FRAMES, kws_model::INPUT_COEFFS, kws_model::INPUT_SCALE,
+    kws_model::MAX_ACT_BYTES, kws_model::NUM_CLASSES, kws_model::LOGIT_SCALE,
+    kws_model::LAYERS, kws_model::NUM_LAYERS, kws_model::NAME};
+static_assert(kws_model::KEYWORD_CLASS < kws_model::NUM_CLASSES, "keyword class out of range");
+
+DsCnnKeywordModel::DsCnnKeywordModel() : runner_(KWS_TABLE) {}
+
+size_t DsCnnKeywordModel::inputFrames() const { return kws_model::INPUT_FRAMES; }
+size_t DsCnnKeywordModel::inputCoeffs() const { return kws_model::INPUT_COEFFS; }
+float DsCnnKeywordModel::inputScale() const { return kws_model::INPUT_SCALE; }
+const char *DsCnnKeywordModel::name() const { return kws_model::NAME; }
+
+uint8_t DsCnnKeywordModel::infer(const int8_t *features)
+{
+    uint8_t probs[DsCnnRunner::MAX_CLASSES];
+    return runner_.run(features, probs) ? probs[kws_model::KEYWORD_CLASS] : 0;
+}
+
+#endif // PTALK_HAS_KWS_MODEL
+
+// ============================================================================
+// Command model (cmd_model_data.h)
+// ============================================================================
+#if PTALK_HAS_CMD_MODEL
+
+static constexpr DsCnnTable CMD_TABLE = {
+    cmd_model::INPUT_FRAMES, cmd_model::INPUT_COEFFS, cmd_model::INPUT_SCALE,
+    cmd_model::MAX_ACT_BYTES, cmd_model::NUM_CLASSES, cmd_model::LOGIT_SCALE,
+    cmd_model::LAYERS, cmd_model::NUM_LAYERS, cmd_model::NAME};
+
+DsCnnCommandModel::DsCnnCommandModel() : runner_(CMD_TABLE) {}
+
+size_t DsCnnCommandModel::inputFrames() const { return cmd_model::INPUT_FRAMES; }
+size_t DsCnnCommandModel::inputCoeffs() const { return cmd_model::INPUT_COEFFS; }
+float DsCnnCommandModel::inputScale() const { return cmd_model::INPUT_SCALE; }
+const char *DsCnnCommandModel::name() const { return cmd_model::NAME; }
+size_t DsCnnCommandModel::numClasses() const { return cmd_model::NUM_CLASSES; }
+
+const char *DsCnnCommandModel::label(size_t cls) const
+{
+    return cls < cmd_model::NUM_CLASSES ? cmd_model::LABELS[cls] : "";
+}
+
+void DsCnnCommandModel::inferClasses(const int8_t *features, uint8_t *probs)
+{
+    if (!runner_.run(features, probs))
+        std::fill(probs, probs + cmd_model::NUM_CLASSES, 0);
+}
+
+uint8_t DsCnnCommandModel::infer(const int8_t *features)
+{
+    uint8_t probs[DsCnnRunner::MAX_CLASSES];
+    inferClasses(features, probs);
+    uint8_t best = 0;
+    for (size_t k = 0; k < cmd_model::NUM_CLASSES; k++)
+        if (voiceCommandFromLabel(cmd_model::LABELS[k]) != VoiceCommand::NONE)
+            best = std::max(best, probs[k]);
+    return best;
+}
+
+#endif // PTALK_HAS_CMD_MODEL
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "KeywordSpotter.hpp"
+#include "CommandRecognizer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * DS-CNN keyword / command models (int8)
+ * ============================================================================
+ * Runner nhỏ cho DS-CNN đã lượng tử hóa: conv → N x (depthwise + pointwise)
+ * → global average pool → fully connected → softmax các lớp.
+ *
+ * Trọng số do tool training xuất ra (một bảng KwsLayer, xem cuối file):
+ *  - "kws_model_data.h" → DsCnnKeywordModel (wake-word). Không có file đó →
+ *    PTALK_HAS_KWS_MODEL = 0, wake-word tắt và thiết bị chỉ dùng nút bấm.
+ *  - "cmd_model_data.h" → DsCnnCommandModel (lệnh cục bộ, cùng front-end
+ *    MFCC). Không có → PTALK_HAS_CMD_MODEL = 0, mọi lệnh đi qua server.
+ *
+ * Quantization: activation int8 symmetric (zero point 0), bias int32,
+ * requant out = clamp((acc * mult) >> shift), tensor HWC.
+ */
+struct KwsLayer
+{
+    enum Type : uint8_t
+    {
+        CONV,      // full kh x kw conv, w[oc][ky][kx][ic]
+        DEPTHWISE, // kh x kw per channel, w[ky][kx][c]
+        POINTWISE, // 1x1, w[oc][ic]
+        DENSE      // after global average pool, w[oc][ic] → logits
+    };
+
+    Type type;
+    uint8_t kh, kw; // kernel
+    uint8_t sh, sw; // stride
+    bool relu;
+    uint16_t out_ch;
+    const int8_t *weights;
+    const int32_t *bias;
+    int32_t mult; // requant multiplier
+    uint8_t shift;
+};
+
+// One exported model (the constants of the kws_model / cmd_model namespace)
+struct DsCnnTable
+{
+    uint16_t input_frames;
+    uint16_t input_coeffs;
+    float input_scale;
+    size_t max_act_bytes;
+    uint8_t num_classes;
+    float logit_scale;
+    const KwsLayer *layers;
+    size_t num_layers;
+    const char *name;
+};
+
+// Forward pass shared by both models; owns the activation arena.
+class DsCnnRunner
+{
+public:
+    static constexpr size_t MAX_CLASSES = 16;
+
+    explicit DsCnnRunner(const DsCnnTable &table);
+
+    // true if the activation arena was allocated and the table is consistent
+    bool valid() const { return valid_; }
+    const DsCnnTable &table() const { return t_; }
+
+    // Softmax of every class, 0..255, into probs[num_classes].
+    bool run(const int8_t *features, uint8_t *probs);
+
+private:
+    struct Shape
+    {
+        uint16_t h, w, c;
+    };
+
+    Shape runLayer(const KwsLayer &l, Shape in, const int8_t *src, int8_t *dst) const;
+    static int8_t requant(int32_t acc, const KwsLayer &l);
+
+private:
+    DsCnnTable t_;
+    std::unique_ptr<int8_t[]> arena_; // two ping-pong activation buffers
+    size_t act_bytes_ = 0;
+    bool valid_ = false;
+};
+
+#if defined(__has_include)
+#if __has_include("kws_model_data.h")
+#define PTALK_HAS_KWS_MODEL 1
+#endif
+#if __has_include("cmd_model_data.h")
+#define PTALK_HAS_CMD_MODEL 1
+#endif
+#endif
+#ifndef PTALK_HAS_KWS_MODEL
+#define PTALK_HAS_KWS_MODEL 0
+#endif
+#ifndef PTALK_HAS_CMD_MODEL
+#define PTALK_HAS_CMD_MODEL 0
+#endif
+
+#if PTALK_HAS_KWS_MODEL
+
+class DsCnnKeywordModel : public KeywordModel
+{
+public:
+    DsCnnKeywordModel();
+
+    bool valid() const { return runner_.valid(); }
+
+    size_t inputFrames() const override;
+    size_t inputCoeffs() const override;
+    float inputScale() const override;
+    uint8_t infer(const int8_t *features) override;
+    const char *name() const override;
+
+private:
+    DsCnnRunner runner_;
+};
+
+#endif // PTALK_HAS_KWS_MODEL
+
+#if PTALK_HAS_CMD_MODEL
+
+class DsCnnCommandModel : public CommandModel
+{
+public:
+    DsCnnCommandModel();
+
+    bool valid() const { return runner_.valid(); }
+
+    size_t inputFrames() const override;
+    size_t inputCoeffs() const override;
+    float inputScale() const override;
+    uint8_t infer(const int8_t *features) override;
+    const char *name() const override;
+
+    size_t numClasses() const override;
+    const char *label(size_t cls) const override;
+    void inferClasses(const int8_t *features, uint8_t *probs) override;
+
+private:
+    DsCnnRunner runner_;
+};
+
+#endif // PTALK_HAS_CMD_MODEL
+
+/*
+ * kws_model_data.h contract (namespace kws_model):
+ *   constexpr uint16_t INPUT_FRAMES, INPUT_COEFFS;
+ *   constexpr float    INPUT_SCALE;      // MFCC per int8 step
+ *   constexpr size_t   MAX_ACT_BYTES;    // largest activation tensor
+ *   constexpr uint8_t  NUM_CLASSES, KEYWORD_CLASS;
+ *   constexpr float    LOGIT_SCALE;      // dequant of the DENSE output
+ *   constexpr size_t   NUM_LAYERS;
+ *   extern const KwsLayer LAYERS[NUM_LAYERS]; // last one is DENSE
+ *   constexpr const char *NAME;
+ *
+ * cmd_model_data.h (namespace cmd_model): the same constants except
+ * KEYWORD_CLASS, plus
+ *   extern const char *const LABELS[NUM_CLASSES]; // "volume_up", "cancel",
+ *                                                 // "_unknown_", ...
+ * The front-end layout (INPUT_FRAMES / INPUT_COEFFS / INPUT_SCALE) must match
+ * the wake-word model when both are built in.
+ */
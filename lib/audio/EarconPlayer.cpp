@@ -0,0 +1,318 @@
+#include "EarconPlayer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_partition.h"
+
+static const char *TAG = "Earcon";
+
+namespace
+{
+    // Built-in cues: short two / three note figures, rising = "go", falling = "done"
+    constexpr uint16_t TONE_RAMP_MS = 3;
+
+    constexpr uint8_t SEG_MAX = 4;
+    struct ToneCue
+    {
+        uint16_t hz[SEG_MAX];
+        uint16_t ms[SEG_MAX];
+        uint8_t count;
+    };
+    constexpr ToneCue BUILTIN[] = {
+        {{880, 1320}, {60, 80}, 2},          // LISTEN_START
+        {{1320, 880}, {60, 80}, 2},          // LISTEN_END
+        {{330, 0, 330}, {120, 60, 120}, 3},  // ERROR
+        {{880, 660, 440}, {100, 100, 160}, 3}, // LOW_BATTERY
+    };
+    static_assert(sizeof(BUILTIN) / sizeof(BUILTIN[0]) == static_cast<size_t>(Earcon::COUNT), "one tone per cue");
+
+    constexpr const char *NAMES[] = {"listen_start", "listen_end", "error", "low_battery"};
+
+    // One sine cycle, shared by all players (built on first init)
+    int16_t s_sine[256];
+    bool s_sine_ready = false;
+
+    // Bundle sound table (see AssetBundle.hpp)
+    constexpr size_t BUNDLE_HEADER_BYTES = 16;
+    constexpr size_t SOUND_TABLE_HEAD = 4;
+    constexpr size_t SOUND_ENTRY_BYTES = 32;
+    constexpr uint8_t FORMAT_PCM16 = 0;
+    constexpr uint8_t FORMAT_ADPCM = 1;
+
+    inline uint16_t rd16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+    inline uint32_t rd32(const uint8_t *p)
+    {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+} // namespace
+
+EarconPlayer::~EarconPlayer()
+{
+    if (map_)
+        spi_flash_munmap(static_cast<spi_flash_mmap_handle_t>(map_handle_));
+}
+
+const char *EarconPlayer::name(Earcon cue)
+{
+    const size_t i = static_cast<size_t>(cue);
+    return i < static_cast<size_t>(Earcon::COUNT) ? NAMES[i] : "?";
+}
+
+Earcon EarconPlayer::fromName(const char *name)
+{
+    for (size_t i = 0; i < static_cast<size_t>(Earcon::COUNT); i++)
+        if (name && strcmp(name, NAMES[i]) == 0)
+            return static_cast<Earcon>(i);
+    return Earcon::COUNT;
+}
+
+// ============================================================================
+// Cue table
+// ============================================================================
+void EarconPlayer::init(uint32_t sample_rate)
+{
+    rate_ = sample_rate ? sample_rate : 16000;
+    if (!s_sine_ready)
+    {
+        for (size_t i = 0; i < 256; i++)
+            s_sine[i] = static_cast<int16_t>(32767.f * std::sin(2.f * static_cast<float>(M_PI) * i / 256.f));
+        s_sine_ready = true;
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(Earcon::COUNT); i++)
+    {
+        uint32_t total = 0;
+        for (uint8_t s = 0; s < BUILTIN[i].count; s++)
+            total += static_cast<uint32_t>(BUILTIN[i].ms[s]) * rate_ / 1000;
+        cues_[i] = Cue{Source::TONE, static_cast<uint8_t>(i), nullptr, total};
+    }
+}
+
+size_t EarconPlayer::loadBundle(const char *label)
+{
+    const esp_partition_t *part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(0x40), label);
+    if (!part)
+        return 0;
+
+    uint8_t hdr[BUNDLE_HEADER_BYTES];
+    if (esp_partition_read(part, 0, hdr, sizeof(hdr)) != ESP_OK || rd32(hdr) != 0x42415450 /* "PTAB" */)
+        return 0;
+    const uint32_t total = rd32(hdr + 8);
+    const uint32_t table = rd32(hdr + 12);
+    if (table == 0)
+        return 0; // bundle without sounds
+    if (total > part->size || table < BUNDLE_HEADER_BYTES || table + SOUND_TABLE_HEAD > total)
+    {
+        ESP_LOGE(TAG, "Bad sound table offset %u (bundle %u B)", (unsigned)table, (unsigned)total);
+        return 0;
+    }
+
+    // Map the sound section only (table + samples sit at the end of the bundle)
+    const void *ptr = nullptr;
+    spi_flash_mmap_handle_t handle = 0;
+    if (esp_partition_mmap(part, table, total - table, SPI_FLASH_MMAP_DATA, &ptr, &handle) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "mmap of %u B sound section failed", (unsigned)(total - table));
+        return 0;
+    }
+    const uint8_t *base = static_cast<const uint8_t *>(ptr);
+    const size_t size = total - table;
+
+    const size_t n = rd16(base);
+    if (SOUND_TABLE_HEAD + n * SOUND_ENTRY_BYTES > size)
+    {
+        ESP_LOGE(TAG, "Bad sound table (%u entries)", (unsigned)n);
+        spi_flash_munmap(handle);
+        return 0;
+    }
+
+    size_t taken = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const uint8_t *e = base + SOUND_TABLE_HEAD + i * SOUND_ENTRY_BYTES;
+        char nm[17] = {};
+        memcpy(nm, e, 16);
+        const Earcon cue = fromName(nm);
+        const uint32_t rate = rd32(e + 16);
+        const uint8_t format = e[20];
+        const uint32_t d_off = rd32(e + 24);
+        const uint32_t samples = rd32(e + 28);
+        const uint64_t bytes = format == FORMAT_ADPCM ? (samples + 1) / 2 : uint64_t(samples) * 2;
+
+        if (cue == Earcon::COUNT)
+        {
+            ESP_LOGW(TAG, "Unknown sound '%s' ignored", nm);
+            continue;
+        }
+        if (rate != rate_ || (format != FORMAT_PCM16 && format != FORMAT_ADPCM) || samples == 0 ||
+            d_off < table || d_off - table + bytes > size)
+        {
+            // Samples play as-is at the speaker rate: no resampling here
+            ESP_LOGW(TAG, "Sound '%s' unusable (%u Hz, format %u), keeping the tone", nm, (unsigned)rate, (unsigned)format);
+            continue;
+        }
+        cues_[static_cast<size_t>(cue)] = Cue{format == FORMAT_ADPCM ? Source::ADPCM : Source::PCM16, 0,
+                                              base + (d_off - table), samples};
+        taken++;
+    }
+
+    if (taken == 0)
+    {
+        spi_flash_munmap(handle);
+        return 0;
+    }
+    // Cues point into the mapping for the rest of the runtime
+    if (map_)
+        spi_flash_munmap(static_cast<spi_flash_mmap_handle_t>(map_handle_));
+    map_ = ptr;
+    map_handle_ = handle;
+    ESP_LOGI(TAG, "%u cue(s) from '%s' (%u B mapped)", (unsigned)taken, label, (unsigned)size);
+    return taken;
+}
+
+// ============================================================================
+// Trigger (any task)
+// ============================================================================
+void EarconPlayer::play(Earcon cue)
+{
+    if (!enabled_ || cue >= Earcon::COUNT)
+        return;
+    pending_.store(static_cast<uint8_t>(cue), std::memory_order_release);
+}
+
+// ============================================================================
+// Mixer (speaker task)
+// ============================================================================
+void EarconPlayer::stop()
+{
+    pending_.store(NONE, std::memory_order_release);
+    active_ = NONE;
+    chunk_len_ = chunk_pos_ = 0;
+}
+
+void EarconPlayer::start(uint8_t id)
+{
+    active_ = id;
+    pos_ = 0;
+    segment_ = 0;
+    seg_pos_ = 0;
+    seg_len_ = 0;
+    phase_ = 0;
+    adpcm_ = AdpcmCodec::AdpcmState{};
+    chunk_len_ = chunk_pos_ = 0;
+    if (cues_[id].source == Source::TONE)
+        beginSegment();
+}
+
+void EarconPlayer::beginSegment()
+{
+    const ToneCue &t = BUILTIN[cues_[active_].tone];
+    seg_pos_ = 0;
+    seg_len_ = static_cast<uint32_t>(t.ms[segment_]) * rate_ / 1000;
+    phase_inc_ = static_cast<uint32_t>((static_cast<uint64_t>(t.hz[segment_]) << 32) / rate_);
+}
+
+void EarconPlayer::renderTone(size_t n)
+{
+    const ToneCue &t = BUILTIN[cues_[active_].tone];
+    const uint32_t ramp = std::max<uint32_t>(1, rate_ * TONE_RAMP_MS / 1000);
+    size_t k = 0;
+    while (k < n && segment_ < t.count)
+    {
+        if (seg_pos_ == seg_len_)
+        {
+            if (++segment_ == t.count)
+                break;
+            beginSegment();
+            continue;
+        }
+
+        const size_t m = std::min<size_t>(n - k, seg_len_ - seg_pos_);
+        if (t.hz[segment_] == 0)
+        {
+            memset(chunk_ + k, 0, m * sizeof(int16_t));
+        }
+        else
+        {
+            for (size_t i = 0; i < m; i++)
+            {
+                // Linear attack / release at the segment edges: no clicks
+                const uint32_t p = seg_pos_ + static_cast<uint32_t>(i);
+                const uint32_t env = std::min(std::min(p, seg_len_ - 1 - p), ramp);
+                chunk_[k + i] = static_cast<int16_t>(s_sine[phase_ >> 24] * static_cast<int32_t>(env) / static_cast<int32_t>(ramp));
+                phase_ += phase_inc_;
+            }
+        }
+        k += m;
+        seg_pos_ += static_cast<uint32_t>(m);
+    }
+    chunk_len_ = k;
+}
+
+bool EarconPlayer::refill()
+{
+    const Cue &c = cues_[active_];
+    chunk_pos_ = 0;
+    chunk_len_ = 0;
+    if (pos_ >= c.samples)
+        return false;
+
+    const size_t k = std::min<size_t>(CHUNK, c.samples - pos_);
+    switch (c.source)
+    {
+    case Source::TONE:
+        renderTone(k);
+        break;
+    case Source::PCM16:
+        memcpy(chunk_, c.data + static_cast<size_t>(pos_) * 2, k * sizeof(int16_t));
+        chunk_len_ = k;
+        break;
+    case Source::ADPCM:
+        // pos_ stays even (CHUNK is), so each refill starts on a byte
+        AdpcmCodec::decodeBlock(adpcm_, c.data + pos_ / 2, (k + 1) / 2, chunk_);
+        chunk_len_ = k;
+        break;
+    }
+    pos_ += static_cast<uint32_t>(k);
+    return chunk_len_ > 0;
+}
+
+size_t EarconPlayer::mix(int16_t *pcm, size_t n)
+{
+    if (active_ == NONE)
+    {
+        const uint8_t id = pending_.exchange(NONE, std::memory_order_acq_rel);
+        if (id == NONE)
+            return 0;
+        start(id);
+    }
+
+    size_t done = 0;
+    while (done < n)
+    {
+        if (chunk_pos_ == chunk_len_ && !refill())
+        {
+            // Cue over: chain one queued meanwhile
+            active_ = NONE;
+            const uint8_t id = pending_.exchange(NONE, std::memory_order_acq_rel);
+            if (id == NONE)
+                break;
+            start(id);
+            continue;
+        }
+        const size_t k = std::min(n - done, chunk_len_ - chunk_pos_);
+        for (size_t i = 0; i < k; i++)
+        {
+            const int32_t v = pcm[done + i] + ((chunk_[chunk_pos_ + i] * level_q15_) >> 15);
+            pcm[done + i] = static_cast<int16_t>(std::clamp<int32_t>(v, -32768, 32767));
+        }
+        done += k;
+        chunk_pos_ += k;
+    }
+    return done;
+}
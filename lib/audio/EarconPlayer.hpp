@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "AdpcmCodec.hpp"
+
+// Local confirmation sounds, played without the server in the loop.
+enum class Earcon : uint8_t
+{
+    LISTEN_START, // mic opened
+    LISTEN_END,   // turn sent, waiting for the answer
+    ERROR,        // system / connection error
+    LOW_BATTERY,  // battery critical
+    COUNT
+};
+
+/**
+ * EarconPlayer
+ * ============================================================================
+ * Bộ cue âm thanh ngắn + mixer nhẹ cho speaker task: phản hồi ngay khi
+ * state đổi, không chờ downlink.
+ *
+ *  - Mặc định mỗi cue là chuỗi tone tổng hợp tại chỗ (vài đoạn Hz x ms, bao
+ *    đường 3 ms chống click): không tốn flash / RAM cho mẫu âm.
+ *  - loadBundle(): cue cùng tên trong partition "assets" (sound table của
+ *    bundle, xem AssetBundle.hpp) thay thế tone; mẫu PCM16 hoặc IMA ADPCM
+ *    được đọc thẳng từ flash đã mmap (zero-copy), đúng sample rate của loa.
+ *  - mix(): cộng cue vào PCM sắp ghi ra I2S (bão hòa int16); gọi với buffer
+ *    0 khi không có luồng TTS.
+ *
+ * play() an toàn từ mọi task (cue mới nhất thay cue đang chờ); mix() / stop()
+ * chỉ từ speaker task.
+ */
+class EarconPlayer
+{
+public:
+    EarconPlayer() = default;
+    ~EarconPlayer();
+
+    EarconPlayer(const EarconPlayer &) = delete;
+    EarconPlayer &operator=(const EarconPlayer &) = delete;
+
+    // Built-in tones at the speaker rate.
+    void init(uint32_t sample_rate);
+    // Replace cues by name from the bundle's sound table ("listen_start",
+    // "listen_end", "error", "low_battery"); returns how many were taken.
+    size_t loadBundle(const char *label = "assets");
+
+    void setEnabled(bool enable) { enabled_ = enable; }
+    bool enabled() const { return enabled_; }
+    // Cue level relative to full scale (default 25%, -12 dBFS).
+    void setLevel(uint8_t percent) { level_q15_ = static_cast<int32_t>(percent > 100 ? 100 : percent) * 32768 / 100; }
+
+    // Queue a cue; replaces a queued one, starts after the playing one.
+    void play(Earcon cue);
+    // A cue is queued or playing (speaker task).
+    bool busy() const { return pending_.load(std::memory_order_acquire) != NONE || active_ != NONE; }
+
+    // Add the current cue to `pcm`; returns samples of cue mixed (0 = idle).
+    size_t mix(int16_t *pcm, size_t n);
+    // Drop the queued and the playing cue.
+    void stop();
+
+    static const char *name(Earcon cue);
+    // Earcon::COUNT if unknown.
+    static Earcon fromName(const char *name);
+
+private:
+    static constexpr uint8_t NONE = 0xFF;
+    static constexpr size_t CHUNK = 64; // samples rendered per refill
+
+    enum class Source : uint8_t
+    {
+        TONE,
+        PCM16,
+        ADPCM
+    };
+
+    struct Cue
+    {
+        Source source = Source::TONE;
+        uint8_t tone = 0;              // TONE: built-in figure
+        const uint8_t *data = nullptr; // PCM16 / ADPCM, in the mapped partition
+        uint32_t samples = 0;
+    };
+
+    void start(uint8_t id);
+    void beginSegment();
+    // Next ≤ CHUNK samples of the active cue into chunk_; false when done.
+    bool refill();
+    void renderTone(size_t n);
+
+    uint32_t rate_ = 16000;
+    Cue cues_[static_cast<size_t>(Earcon::COUNT)];
+    bool enabled_ = true;
+    int32_t level_q15_ = 8192;
+
+    std::atomic<uint8_t> pending_{NONE};
+
+    // Speaker task
+    uint8_t active_ = NONE;
+    uint32_t pos_ = 0;       // samples of the cue rendered
+    uint8_t segment_ = 0;    // TONE: current segment
+    uint32_t seg_pos_ = 0;   // TONE: samples into it
+    uint32_t seg_len_ = 0;
+    uint32_t phase_ = 0;     // TONE: oscillator phase (2^32 = one cycle)
+    uint32_t phase_inc_ = 0;
+    AdpcmCodec::AdpcmState adpcm_;
+    int16_t chunk_[CHUNK];
+    size_t chunk_len_ = 0;
+    size_t chunk_pos_ = 0;
+
+    const void *map_ = nullptr; // partition mapping (loadBundle)
+    uint32_t map_handle_ = 0;   // spi_flash_mmap_handle_t
+};
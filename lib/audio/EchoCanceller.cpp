@@ -0,0 +1,164 @@
+#include "EchoCanceller.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#include "esp_log.h"
+
+static const char *TAG = "EchoCanceller";
+
+// Far-end below this peak counts as silence (int16 units)
+static constexpr int FAR_SILENCE_PEAK = 16;
+
+bool EchoCanceller::init(const Config &cfg)
+{
+    deinit();
+    if (cfg.taps == 0 || cfg.max_block == 0 || cfg.sample_rate == 0)
+        return false;
+
+    cfg_ = cfg;
+    bulk_ = static_cast<size_t>(cfg_.sample_rate) * cfg_.bulk_delay_ms / 1000;
+
+    const uint16_t max_bulk_ms = std::max(cfg_.bulk_delay_ms, cfg_.max_bulk_delay_ms);
+    size_t need = static_cast<size_t>(cfg_.sample_rate) * max_bulk_ms / 1000 + cfg_.taps + cfg_.max_block;
+    size_t len = 1;
+    while (len < need)
+        len <<= 1;
+    line_mask_ = len - 1;
+
+    line_.reset(new (std::nothrow) int16_t[len]);
+    weights_.reset(new (std::nothrow) float[cfg_.taps]);
+    window_.reset(new (std::nothrow) float[cfg_.taps + cfg_.max_block - 1]);
+    out_.reset(new (std::nothrow) int16_t[cfg_.max_block]);
+    if (!line_ || !weights_ || !window_ || !out_)
+    {
+        ESP_LOGE(TAG, "Out of memory");
+        deinit();
+        return false;
+    }
+
+    std::fill_n(weights_.get(), cfg_.taps, 0.0f);
+    reset();
+    ESP_LOGI(TAG, "AEC ready: %u taps, bulk delay %u ms, line %u samples",
+             (unsigned)cfg_.taps, (unsigned)cfg_.bulk_delay_ms, (unsigned)len);
+    return true;
+}
+
+void EchoCanceller::deinit()
+{
+    line_.reset();
+    weights_.reset();
+    window_.reset();
+    out_.reset();
+}
+
+void EchoCanceller::reset()
+{
+    if (line_)
+        memset(line_.get(), 0, (line_mask_ + 1) * sizeof(int16_t));
+    head_ = 0;
+    dt_hold_ = 0;
+    silent_ = UINT32_MAX / 2;
+    far_active_ = false;
+}
+
+bool EchoCanceller::setBulkDelayMs(uint16_t ms)
+{
+    if (!ready())
+        return false;
+    // Line must hold bulk + taps + one block
+    const size_t max_bulk = line_mask_ + 1 - cfg_.taps - cfg_.max_block;
+    size_t bulk = static_cast<size_t>(cfg_.sample_rate) * ms / 1000;
+    const bool fits = bulk <= max_bulk;
+    if (!fits)
+    {
+        ESP_LOGW(TAG, "Bulk delay %u ms exceeds the line, clamped", (unsigned)ms);
+        bulk = max_bulk;
+    }
+    bulk_ = bulk;
+    cfg_.bulk_delay_ms = static_cast<uint16_t>(bulk * 1000 / cfg_.sample_rate);
+    reset();
+    return fits;
+}
+
+const int16_t *EchoCanceller::process(const int16_t *mic, const int16_t *far, size_t n)
+{
+    if (!ready() || !mic)
+        return mic;
+    n = std::min<size_t>(n, cfg_.max_block);
+
+    // Append the far-end block to the delay line
+    int far_peak = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        int16_t v = far ? far[i] : 0;
+        line_[(head_ + i) & line_mask_] = v;
+        far_peak = std::max(far_peak, std::abs(static_cast<int>(v)));
+    }
+    head_ = (head_ + n) & line_mask_;
+
+    silent_ = far_peak < FAR_SILENCE_PEAK ? silent_ + n : 0;
+    // Echo of the last loud sample is gone once it left the filter window
+    far_active_ = silent_ < bulk_ + cfg_.taps + n;
+    if (!far_active_)
+        return mic;
+
+    // Window of far samples aligned to this block:
+    // window_[m] = far(t0 - bulk - (taps - 1) + m), m = 0 .. taps + n - 2
+    const size_t taps = cfg_.taps;
+    const size_t wlen = taps + n - 1;
+    const size_t start = (head_ - n - bulk_ - (taps - 1)) & line_mask_;
+    float wmax = 0.0f;
+    for (size_t m = 0; m < wlen; m++)
+    {
+        float v = line_[(start + m) & line_mask_] * (1.0f / 32768.0f);
+        window_[m] = v;
+        wmax = std::max(wmax, std::fabs(v));
+    }
+
+    float *h = weights_.get();
+    const float eps = 1e-4f * taps;
+    const uint32_t hold = cfg_.sample_rate * cfg_.dt_hold_ms / 1000;
+
+    // Energy of the first regressor, then updated incrementally
+    float power = 0.0f;
+    for (size_t k = 0; k < taps; k++)
+        power += window_[k] * window_[k];
+
+    for (size_t i = 0; i < n; i++)
+    {
+        // Regressor x_k = window_[i + taps - 1 - k]; iterate newest → oldest
+        const float *x = &window_[i];
+        if (i > 0)
+        {
+            float in = x[taps - 1], outv = x[-1];
+            power = std::max(0.0f, power + in * in - outv * outv);
+        }
+
+        float y = 0.0f;
+        for (size_t k = 0; k < taps; k++)
+            y += h[k] * x[taps - 1 - k];
+
+        const float d = mic[i] * (1.0f / 32768.0f);
+        const float e = d - y;
+
+        if (std::fabs(d) > cfg_.dt_ratio * wmax)
+            dt_hold_ = hold; // near-end talking over the far end
+        if (dt_hold_ > 0)
+        {
+            dt_hold_--;
+        }
+        else
+        {
+            const float g = cfg_.mu * e / (power + eps);
+            for (size_t k = 0; k < taps; k++)
+                h[k] += g * x[taps - 1 - k];
+        }
+
+        int v = static_cast<int>(lrintf(e * 32768.0f));
+        out_[i] = static_cast<int16_t>(std::clamp(v, -32768, 32767));
+    }
+    return out_.get();
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * EchoCanceller
+ * ============================================================================
+ * NLMS acoustic echo canceller (time domain) cho full-duplex barge-in.
+ *
+ * - Far-end: PCM loa, lấy ngay trước writePcm() (speaker task → ring riêng)
+ * - Delay line: bulk_delay_ms bù độ trễ DMA loa + DMA mic, sau đó `taps`
+ *   hệ số NLMS phủ phần đuôi phản xạ còn lại
+ * - Double-talk (Geigel): |mic| > dt_ratio * max|far| → ngừng adapt một lúc,
+ *   giọng người dùng không làm filter phân kỳ
+ * - Far-end im lặng → bypass (không tốn CPU khi không phát)
+ *
+ * Chỉ encoder task gọi process(); không thread-safe.
+ */
+class EchoCanceller
+{
+public:
+    struct Config
+    {
+        uint32_t sample_rate = 16000;
+        uint16_t taps = 256;          // 16 ms echo tail @16 kHz
+        uint16_t bulk_delay_ms = 104; // speaker DMA queue (6 x 256) + one mic DMA block
+        uint16_t max_bulk_delay_ms = 0; // delay line sized for setBulkDelayMs() up to this
+        uint16_t max_block = 480;     // largest process() block
+        float mu = 0.25f;             // NLMS step
+        float dt_ratio = 0.6f;        // Geigel double-talk threshold
+        uint16_t dt_hold_ms = 40;     // freeze adaptation this long after double talk
+    };
+
+    EchoCanceller() = default;
+    EchoCanceller(const EchoCanceller &) = delete;
+    EchoCanceller &operator=(const EchoCanceller &) = delete;
+
+    bool init(const Config &cfg);
+    void deinit();
+    bool ready() const { return weights_ != nullptr; }
+
+    // Clear the far-end history (keeps the learned echo path).
+    void reset();
+
+    // New speaker queue depth (DMA preset change): moves the bulk delay and
+    // clears the far-end history. Clamped to the line sized at init();
+    // false when clamped.
+    bool setBulkDelayMs(uint16_t ms);
+    uint16_t bulkDelayMs() const { return cfg_.bulk_delay_ms; }
+
+    // Cancel echo from one near-end block. `far` is the speaker reference for
+    // the same period (nullptr = speaker silent). Returns an internal buffer
+    // of n samples, valid until the next call.
+    const int16_t *process(const int16_t *mic, const int16_t *far, size_t n);
+
+    // Far-end energy in the filter window (for callers gating on playback).
+    bool farEndActive() const { return far_active_; }
+
+private:
+    Config cfg_{};
+    size_t bulk_ = 0;       // samples
+    size_t line_mask_ = 0;  // delay line length - 1 (power of two)
+    size_t head_ = 0;       // next write position in the delay line
+
+    std::unique_ptr<int16_t[]> line_;   // far-end delay line
+    std::unique_ptr<float[]> weights_;  // taps
+    std::unique_ptr<float[]> window_;   // taps + max_block - 1 far samples, oldest first
+    std::unique_ptr<int16_t[]> out_;    // max_block
+
+    uint32_t dt_hold_ = 0;  // samples left with adaptation frozen
+    uint32_t silent_ = 0;   // far-end silent samples in a row
+    bool far_active_ = false;
+};
@@ -1,16 +1,23 @@
 #include "I2SAudioInput_INMP441.hpp"
 #include "esp_log.h"
 #include <cstring>
+#include <algorithm>
 
 static const char *TAG = "INMP441";
 
 I2SAudioInput_INMP441::I2SAudioInput_INMP441(const Config &cfg)
-    : cfg_(cfg) {}
+    : cfg_(cfg)
+{
+    setGainQ8(cfg_.gain_q8);
+    lifecycle_ = xSemaphoreCreateMutex();
+}
 
 I2SAudioInput_INMP441::~I2SAudioInput_INMP441()
 {
     stopCapture();
-    i2s_driver_uninstall(cfg_.i2s_port);
+    uninstall();
+    if (lifecycle_)
+        vSemaphoreDelete(lifecycle_);
 }
 
 // ============================================================================
@@ -19,57 +26,39 @@ I2SAudioInput_INMP441::~I2SAudioInput_INMP441()
 // Thêm hàm Init riêng
 bool I2SAudioInput_INMP441::init() {
     ESP_LOGI(TAG, "Initializing I2S Driver once...");
-    
-    i2s_config_t i2s_cfg = {};
-    i2s_cfg.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX);
-    i2s_cfg.sample_rate = cfg_.sample_rate;
-    i2s_cfg.bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT;
-    i2s_cfg.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
-    i2s_cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
-    i2s_cfg.dma_buf_count = 6; 
-    i2s_cfg.dma_buf_len = 256;
-    i2s_cfg.use_apll = false;
-    i2s_cfg.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
-
-    // Cài đặt driver
-    esp_err_t err = i2s_driver_install(cfg_.i2s_port, &i2s_cfg, 0, nullptr);
-    if (err != ESP_OK) return false;
-
-    // Cấu hình Pin
-    i2s_pin_config_t pin_cfg = {
-        .mck_io_num = I2S_PIN_NO_CHANGE,
-        .bck_io_num = cfg_.pin_bck,
-        .ws_io_num = cfg_.pin_ws,
-        .data_out_num = I2S_PIN_NO_CHANGE,
-        .data_in_num = cfg_.pin_din
-    };
-    i2s_set_pin(cfg_.i2s_port, &pin_cfg);
-
-    // Dừng ngay sau khi init để tiết kiệm điện, khi nào cần thu mới start
-    i2s_stop(cfg_.i2s_port); 
-    return true;
+    if (!lifecycle_)
+        return false;
+    return install();
 }
 
 bool I2SAudioInput_INMP441::startCapture() {
     if (running) return true;
+    if (!lifecycle_) return false;
     ESP_LOGI(TAG, "I2S Start");
-    esp_err_t err = i2s_start(cfg_.i2s_port); // Không install lại, chỉ start
-    if (err == ESP_OK) running = true;
+    xSemaphoreTake(lifecycle_, portMAX_DELAY);
+    if (hwStart()) { // Không install lại, chỉ start
+        running = true;
+        hpf_x1_ = 0;
+        hpf_y_ = 0;
+    }
+    xSemaphoreGive(lifecycle_);
     return running;
 }
 
 void I2SAudioInput_INMP441::stopCapture() {
-    if (!running) return;
+    if (!running || !lifecycle_) return;
     ESP_LOGI(TAG, "I2S Stop");
-    i2s_stop(cfg_.i2s_port); // Không uninstall, chỉ stop
+    xSemaphoreTake(lifecycle_, portMAX_DELAY);
+    hwStop(); // Không uninstall, chỉ stop
     running = false;
+    xSemaphoreGive(lifecycle_);
 }
 
 void I2SAudioInput_INMP441::pauseCapture()
 {
     if (!running)
         return;
-    i2s_stop(cfg_.i2s_port);
+    hwStop();
     ESP_LOGI(TAG, "INMP441 capture paused");
 }
 
@@ -77,35 +66,63 @@ void I2SAudioInput_INMP441::pauseCapture()
 // Data
 // ============================================================================
 
+void I2SAudioInput_INMP441::convertBlock(const int32_t* in, int16_t* out, size_t n)
+{
+    const int32_t g = cfg_.gain_q8;
+    const uint8_t k = cfg_.hpf_shift;
+    int32_t x1 = hpf_x1_;
+    int32_t y = hpf_y_;
+
+    for (size_t i = 0; i < n; i++) {
+        int32_t x = in[i] >> 8; // 24-bit sample, left-aligned in the slot
+        if (k) {
+            // y[n] = x[n] - x[n-1] + (1 - 2^-k) * y[n-1]
+            y += (x - x1) - (y >> k);
+            x1 = x;
+            x = y;
+        }
+        // 24 → 16 bit (>> 8) and Q8 gain (>> 8), pre-shifted to stay in 32 bits
+        int32_t v = ((x >> 5) * g) >> 11;
+        out[i] = static_cast<int16_t>(std::clamp<int32_t>(v, -32768, 32767));
+    }
+
+    hpf_x1_ = x1;
+    hpf_y_ = y;
+}
+
 size_t I2SAudioInput_INMP441::readPcm(int16_t* pcm, size_t max_samples)
 {
     if (!pcm || max_samples == 0 || !running) return 0;
 
-    // Khai báo buffer tạm trên Stack (256 samples * 2 kênh * 4 bytes = 2KB)
-    // ESP32 Task stack 4KB hoặc 8KB dư sức chứa 2KB này.
-    int32_t raw_buf[max_samples * 2]; 
-    size_t bytes_read = 0;
-
-    esp_err_t res = i2s_read(cfg_.i2s_port, raw_buf, sizeof(raw_buf), &bytes_read, pdMS_TO_TICKS(100));
-    if (res != ESP_OK || bytes_read == 0) return 0;
+    // Overruns since the previous read
+    drainEvents();
 
-    size_t actual_samples = bytes_read / sizeof(int32_t);
     size_t pcm_idx = 0;
+    while (pcm_idx < max_samples) {
+        size_t n = std::min(max_samples - pcm_idx, RAW_BLOCK);
+        size_t got = hwRead(raw_, n);
+        if (got == 0) break;
 
-    // Lọc lấy kênh Trái (Index 0, 2, 4...) và dịch bit 14
-    for (size_t i = 0; i < actual_samples; i += 2) {
-        if (pcm_idx < max_samples) {
-            pcm[pcm_idx++] = (int16_t)(raw_buf[i] >> 16);
-        }
+        convertBlock(raw_, pcm + pcm_idx, got);
+        pcm_idx += got;
+        if (got < n) break; // timeout mid-frame
     }
 
-    return pcm_idx; 
+    if (muted && pcm_idx > 0)
+        memset(pcm, 0, pcm_idx * sizeof(int16_t));
+
+    return pcm_idx;
 }
 
 // ============================================================================
 // Control
 // ============================================================================
 
+void I2SAudioInput_INMP441::setGainQ8(uint16_t gain_q8)
+{
+    cfg_.gain_q8 = std::min<uint16_t>(gain_q8, 4095);
+}
+
 void I2SAudioInput_INMP441::setMuted(bool mute)
 {
     muted = mute;
@@ -115,10 +132,191 @@ void I2SAudioInput_INMP441::setLowPower(bool enable)
 {
     if (enable && running)
     {
-        i2s_stop(cfg_.i2s_port);
+        hwStop();
     }
     else if (!enable && running)
     {
-        i2s_start(cfg_.i2s_port);
+        hwStart();
+    }
+}
+
+#if !PTALK_I2S_STD
+// ============================================================================
+// Backend: legacy driver on its own port
+// ============================================================================
+
+bool I2SAudioInput_INMP441::install()
+{
+    i2s_config_t i2s_cfg = {};
+    i2s_cfg.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX);
+    i2s_cfg.sample_rate = cfg_.sample_rate;
+    i2s_cfg.bits_per_sample = I2S_BITS_PER_SAMPLE_32BIT;
+    // Mono slot: half the DMA traffic of RIGHT_LEFT.
+    // Legacy ESP32 driver may swap slots in mono mode; flip use_left_channel if silent.
+    i2s_cfg.channel_format = cfg_.use_left_channel ? I2S_CHANNEL_FMT_ONLY_LEFT
+                                                   : I2S_CHANNEL_FMT_ONLY_RIGHT;
+    i2s_cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+    i2s_cfg.dma_buf_count = cfg_.dma.buf_count;
+    i2s_cfg.dma_buf_len = cfg_.dma.buf_len;
+    i2s_cfg.use_apll = false;
+    i2s_cfg.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
+
+    // Cài đặt driver
+    // Event queue only for the overrun counter; one slot per DMA buffer
+    esp_err_t err = i2s_driver_install(cfg_.i2s_port, &i2s_cfg, i2s_cfg.dma_buf_count, &events_);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "I2S driver install failed: %s", esp_err_to_name(err));
+        events_ = nullptr;
+        return false;
+    }
+    installed_ = true;
+
+    // Cấu hình Pin
+    i2s_pin_config_t pin_cfg = {
+        .mck_io_num = I2S_PIN_NO_CHANGE,
+        .bck_io_num = cfg_.pin_bck,
+        .ws_io_num = cfg_.pin_ws,
+        .data_out_num = I2S_PIN_NO_CHANGE,
+        .data_in_num = cfg_.pin_din
+    };
+    i2s_set_pin(cfg_.i2s_port, &pin_cfg);
+
+    // Dừng ngay sau khi init để tiết kiệm điện, khi nào cần thu mới start
+    i2s_stop(cfg_.i2s_port); 
+    ESP_LOGI(TAG, "RX DMA %dx%d (%u ms)", cfg_.dma.buf_count, cfg_.dma.buf_len,
+             (unsigned)cfg_.dma.delayMs(cfg_.sample_rate));
+    return true;
+}
+
+bool I2SAudioInput_INMP441::setDmaPreset(DmaPreset preset)
+{
+    const DmaGeometry g = dmaGeometry(preset);
+    if (!lifecycle_ || !installed_)
+        return false;
+    if (g == cfg_.dma)
+        return true;
+
+    xSemaphoreTake(lifecycle_, portMAX_DELAY);
+    const DmaGeometry prev = cfg_.dma;
+    uninstall();
+    cfg_.dma = g;
+    bool ok = install();
+    if (!ok)
+    {
+        cfg_.dma = prev;
+        install();
+    }
+    if (running && installed_)
+        hwStart();
+    xSemaphoreGive(lifecycle_);
+    return ok;
+}
+
+void I2SAudioInput_INMP441::uninstall()
+{
+    if (!installed_)
+        return;
+    i2s_driver_uninstall(cfg_.i2s_port);
+    installed_ = false;
+    events_ = nullptr;
+}
+
+bool I2SAudioInput_INMP441::hwStart()
+{
+    if (events_)
+        xQueueReset(events_); // stopped clock: nothing left to count
+    return i2s_start(cfg_.i2s_port) == ESP_OK;
+}
+
+void I2SAudioInput_INMP441::hwStop()
+{
+    i2s_stop(cfg_.i2s_port);
+}
+
+size_t I2SAudioInput_INMP441::hwRead(int32_t* raw, size_t n)
+{
+    size_t bytes_read = 0;
+    esp_err_t res = i2s_read(cfg_.i2s_port, raw, n * sizeof(int32_t), &bytes_read, pdMS_TO_TICKS(100));
+    return res == ESP_OK ? bytes_read / sizeof(int32_t) : 0;
+}
+
+void I2SAudioInput_INMP441::drainEvents()
+{
+    if (!events_)
+        return;
+    i2s_event_t ev;
+    uint32_t n = 0;
+    while (xQueueReceive(events_, &ev, 0) == pdTRUE)
+    {
+        if (ev.type == I2S_EVENT_RX_Q_OVF)
+            n++;
+    }
+    if (n)
+        overruns_.fetch_add(n, std::memory_order_relaxed);
+}
+
+uint32_t I2SAudioInput_INMP441::overruns() const
+{
+    return overruns_.load(std::memory_order_relaxed);
+}
+
+#else
+// ============================================================================
+// Backend: RX channel of the duplex bus (i2s_std)
+// ============================================================================
+
+bool I2SAudioInput_INMP441::install()
+{
+    if (!cfg_.bus || !cfg_.bus->ready())
+    {
+        ESP_LOGE(TAG, "Duplex bus not ready");
+        return false;
     }
+    // The bus owns the clock, the slot and the DMA shape; RX stays disabled
+    // until startCapture()
+    cfg_.dma = cfg_.bus->config().dma;
+    installed_ = true;
+    ESP_LOGI(TAG, "On duplex bus RX: DMA %dx%d (%u ms)", cfg_.dma.buf_count, cfg_.dma.buf_len,
+             (unsigned)cfg_.dma.delayMs(cfg_.sample_rate));
+    return true;
+}
+
+void I2SAudioInput_INMP441::uninstall()
+{
+    installed_ = false;
+}
+
+bool I2SAudioInput_INMP441::setDmaPreset(DmaPreset preset)
+{
+    // Shared with the speaker and fixed at bus init
+    return installed_ && dmaGeometry(preset) == cfg_.dma;
 }
+
+bool I2SAudioInput_INMP441::hwStart()
+{
+    return cfg_.bus->acquire(I2SDuplexBus::MIC);
+}
+
+void I2SAudioInput_INMP441::hwStop()
+{
+    cfg_.bus->release(I2SDuplexBus::MIC);
+}
+
+size_t I2SAudioInput_INMP441::hwRead(int32_t* raw, size_t n)
+{
+    size_t bytes_read = 0;
+    esp_err_t res = i2s_channel_read(cfg_.bus->rx(), raw, n * sizeof(int32_t), &bytes_read, pdMS_TO_TICKS(100));
+    return res == ESP_OK ? bytes_read / sizeof(int32_t) : 0;
+}
+
+void I2SAudioInput_INMP441::drainEvents()
+{
+}
+
+uint32_t I2SAudioInput_INMP441::overruns() const
+{
+    return cfg_.bus ? cfg_.bus->rxOverflows() : 0;
+}
+
+#endif // PTALK_I2S_STD
@@ -1,7 +1,13 @@
 #pragma once
 
 #include "AudioInput.hpp"
+#include "I2SDuplexBus.hpp"
+#if !PTALK_I2S_STD
 #include "driver/i2s.h"
+#endif
+#include "freertos/semphr.h"
+
+#include <atomic>
 
 /**
  * I2SAudioInput_INMP441
@@ -14,6 +20,16 @@
  *   - I2S RX only
  *   - 24-bit data (usually trimmed to 16-bit)
  *   - Mono (L or R selectable)
+ *
+ * Capture path:
+ *   - I2S chỉ lấy một slot (ONLY_LEFT / ONLY_RIGHT) → DMA không chở kênh rỗng
+ *   - readPcm() đọc theo block vào raw_ của object (không VLA trên stack)
+ *   - convertBlock(): 24-bit → DC-blocking high-pass → gain Q8 → int16 bão hòa
+ *   - I2S_EVENT_RX_Q_OVF (DMA ghi đè buffer chưa đọc) → overruns()
+ *
+ * Backend (PTALK_I2S_STD): legacy driver trên port riêng (mặc định), hoặc
+ * kênh RX của I2SDuplexBus (cfg.bus) — clock chung với loa, slot L/R và
+ * hình dạng DMA do bus quyết định, overrun đếm bằng callback của bus.
  */
 class I2SAudioInput_INMP441 : public AudioInput {
 public:
@@ -26,6 +42,17 @@ public:
 
         uint32_t sample_rate = 16000;
         bool use_left_channel = true; // INMP441 L/R select
+
+        uint16_t gain_q8 = 256; // digital gain, 256 = 0 dB (max 4095 ≈ +24 dB)
+        uint8_t hpf_shift = 6;  // DC blocker pole 1 - 2^-shift (6 ≈ 40 Hz @16 kHz), 0 = off
+
+        // RX DMA queue: how late readPcm() may be before audio is overwritten
+        DmaGeometry dma = dmaGeometry(DmaPreset::ROBUST);
+
+#if PTALK_I2S_STD
+        // RX channel owner; port / pins / channel / dma above are unused
+        I2SDuplexBus* bus = nullptr;
+#endif
     };
 
 public:
@@ -45,14 +72,49 @@ public:
 
     void setMuted(bool mute) override;
     void setLowPower(bool enable) override;
+    // Reinstalls the RX driver; capture resumes if it was running.
+    // Duplex bus: true only for the bus's own geometry.
+    bool setDmaPreset(DmaPreset preset) override;
 
     uint32_t sampleRate() const override { return cfg_.sample_rate; }
     uint8_t  channels() const override   { return 1; }
     uint8_t  bitsPerSample() const override { return 16; }
+    uint32_t overruns() const override;
+
+    void setGainQ8(uint16_t gain_q8);
+
+private:
+    // Backend: driver + pins for cfg_, left stopped (init(), setDmaPreset()),
+    // clock start / stop, and one block from the DMA (samples read).
+    bool install();
+    void uninstall();
+    bool hwStart();
+    void hwStop();
+    size_t hwRead(int32_t* raw, size_t n);
+
+    // Raw 32-bit slots → int16 with HPF + gain (state carried across blocks).
+    void convertBlock(const int32_t* in, int16_t* out, size_t n);
+    // Count RX_Q_OVF events from the driver's event queue (mic task).
+    // No-op on the duplex bus (its ISR callback counts).
+    void drainEvents();
 
 private:
     Config cfg_;
 
+    static constexpr size_t RAW_BLOCK = 256; // samples per i2s_read
+    int32_t raw_[RAW_BLOCK];
+    int32_t hpf_x1_ = 0;
+    int32_t hpf_y_ = 0;
+
     bool running = false;
     bool muted   = false;
+
+#if !PTALK_I2S_STD
+    QueueHandle_t events_ = nullptr; // legacy driver event queue
+    std::atomic<uint32_t> overruns_{0};
+#endif
+
+    // Start / stop (state task) vs. reinstall (mic task)
+    SemaphoreHandle_t lifecycle_ = nullptr;
+    bool installed_ = false;
 };
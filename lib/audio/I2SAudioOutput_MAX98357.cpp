@@ -1,22 +1,188 @@
 #include "I2SAudioOutput_MAX98357.hpp"
 #include "esp_log.h"
 #include <cstring>
+#include <algorithm>
+
+#if PTALK_HAS_ESP_DSP
+#include "dsps_mulc.h"
+#endif
 
 static const char* TAG = "MAX98357";
 
 I2SAudioOutput_MAX98357::I2SAudioOutput_MAX98357(const Config& cfg)
     : cfg_(cfg)
 {
-    // Install I2S driver ONCE during construction - never reinstall
+    uint32_t ramp_samples = std::max<uint32_t>(1, cfg_.sample_rate * cfg_.volume_ramp_ms / 1000);
+    ramp_step_ = std::max<int32_t>(1, 32767 / static_cast<int32_t>(ramp_samples));
+
+    // Install I2S driver once; only setDmaPreset() reinstalls (stopped)
+    install();
+}
+
+I2SAudioOutput_MAX98357::~I2SAudioOutput_MAX98357()
+{
+    stopPlayback();
+    uninstall();
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+bool I2SAudioOutput_MAX98357::startPlayback()
+{
+    if (running) return true;
+    if (!i2s_installed) {
+        ESP_LOGE(TAG, "I2S not installed, cannot start playback");
+        return false;
+    }
+
+    if (!hwStart())
+        return false;
+
+    // New stream: no DC history, start at the current volume
+    dc_x1_ = 0;
+    dc_y_q8_ = 0;
+    gain_q15_ = target_gain_q15_.load(std::memory_order_relaxed);
+
+    running = true;
+    ESP_LOGI(TAG, "MAX98357 playback started");
+    return true;
+}
+
+void I2SAudioOutput_MAX98357::stopPlayback()
+{
+    if (!running) return;
+
+    hwStop();
+    running = false;
+    ESP_LOGI(TAG, "MAX98357 playback stopped");
+}
+
+// ============================================================================
+// Data
+// ============================================================================
+
+void I2SAudioOutput_MAX98357::processBlock(const int16_t* in, int16_t* out, size_t n, int32_t target)
+{
+#if PTALK_HAS_ESP_DSP
+    if (!cfg_.dc_block && gain_q15_ == target) {
+        // Steady gain ≤ 1.0 cannot clip: plain vector multiply
+        dsps_mulc_s16(in, out, (int)n, (int16_t)target, 1, 1);
+        return;
+    }
+#endif
+
+    int32_t g = gain_q15_;
+    int32_t x1 = dc_x1_;
+    int32_t y = dc_y_q8_;
+    const int32_t KNEE = 28000;
+
+    for (size_t i = 0; i < n; i++) {
+        int32_t x = in[i];
+        if (cfg_.dc_block) {
+            // y[n] = x[n] - x[n-1] + (1 - 2^-7) * y[n-1]  (~20 Hz @16 kHz)
+            y += ((x - x1) << 8) - (y >> 7);
+            x1 = x;
+            x = y >> 8;
+        }
+
+        if (g != target)
+            g += std::clamp(target - g, -ramp_step_, ramp_step_);
+
+        int32_t v = (x * g) >> 15;
+
+        // Soft knee above KNEE, hard limit at full scale
+        if (v > KNEE)
+            v = KNEE + ((v - KNEE) >> 2);
+        else if (v < -KNEE)
+            v = -KNEE + ((v + KNEE) >> 2);
+        out[i] = static_cast<int16_t>(std::clamp<int32_t>(v, -32768, 32767));
+    }
+
+    gain_q15_ = g;
+    dc_x1_ = x1;
+    dc_y_q8_ = y;
+}
+
+size_t I2SAudioOutput_MAX98357::writePcm(const int16_t* pcm, size_t pcm_samples)
+{
+    if (!running || !pcm || pcm_samples == 0)
+        return 0;
+
+    // Underruns since the previous write (queue holds at most one per buffer)
+    drainEvents();
+
+    // Fully faded out at volume 0: leave the DMA to auto-clear (silence)
+    if (gain_q15_ == 0 && target_gain_q15_.load(std::memory_order_relaxed) == 0)
+        return 0;
+
+    // Caller's memory is const (ring view / concealment copy): process in
+    // blocks through the object's scratch, any frame length
+    size_t written_samples = 0;
+    while (written_samples < pcm_samples) {
+        size_t n = std::min(pcm_samples - written_samples, BLOCK_SAMPLES);
+        const int32_t target = target_gain_q15_.load(std::memory_order_relaxed);
+        const int32_t g0 = gain_q15_, x0 = dc_x1_, y0 = dc_y_q8_;
+        processBlock(pcm + written_samples, scratch_, n, target);
+
+        const size_t accepted = hwWrite(scratch_, n);
+        if (accepted < n) {
+            // DMA full until timeout. The caller resubmits the tail, so the
+            // ramp / DC filter must stand after the accepted samples only:
+            // rewind and run just those again (same input, same result).
+            gain_q15_ = g0;
+            dc_x1_ = x0;
+            dc_y_q8_ = y0;
+            if (accepted > 0)
+                processBlock(pcm + written_samples, scratch_, accepted, target);
+            written_samples += accepted;
+            break;
+        }
+        written_samples += accepted;
+    }
+
+    return written_samples; // trả về số sample
+}
+
+
+// ============================================================================
+// Control
+// ============================================================================
+
+void I2SAudioOutput_MAX98357::setVolume(uint8_t percent)
+{
+    if (percent > 100) percent = 100;
+    volume = percent;
+    // Q15 gain, ramped per sample in writePcm()
+    target_gain_q15_.store(percent * 32767 / 100, std::memory_order_relaxed);
+}
+
+void I2SAudioOutput_MAX98357::setLowPower(bool enable)
+{
+    if (enable && running) {
+        hwStop();
+    } else if (!enable && running) {
+        hwStart();
+    }
+}
+
+#if !PTALK_I2S_STD
+// ============================================================================
+// Backend: legacy driver on its own port
+// ============================================================================
+
+bool I2SAudioOutput_MAX98357::install()
+{
     i2s_config_t i2s_cfg = {};
     i2s_cfg.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX);
     i2s_cfg.sample_rate = cfg_.sample_rate;
     i2s_cfg.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
     i2s_cfg.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
     i2s_cfg.communication_format = I2S_COMM_FORMAT_STAND_I2S;
-    i2s_cfg.dma_buf_count = 6;
-    i2s_cfg.dma_buf_len = 256;
-    i2s_cfg.use_apll = false;
+    i2s_cfg.dma_buf_count = cfg_.dma.buf_count;
+    i2s_cfg.dma_buf_len = cfg_.dma.buf_len;
+    i2s_cfg.use_apll = cfg_.use_apll;
     i2s_cfg.tx_desc_auto_clear = true;
     i2s_cfg.intr_alloc_flags = ESP_INTR_FLAG_LEVEL1;
 
@@ -26,20 +192,23 @@ I2SAudioOutput_MAX98357::I2SAudioOutput_MAX98357(const Config& cfg)
     pin_cfg.data_out_num = cfg_.pin_dout;
     pin_cfg.data_in_num  = I2S_PIN_NO_CHANGE;
 
-    esp_err_t err = i2s_driver_install(cfg_.i2s_port, &i2s_cfg, 0, nullptr);
+    // Event queue only for the underrun counter; one slot per DMA buffer
+    esp_err_t err = i2s_driver_install(cfg_.i2s_port, &i2s_cfg, cfg_.dma.buf_count, &events_);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "I2S driver install failed: %s", esp_err_to_name(err));
-        return;
+        events_ = nullptr;
+        return false;
     }
 
     err = i2s_set_pin(cfg_.i2s_port, &pin_cfg);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "I2S set pin failed: %s", esp_err_to_name(err));
         i2s_driver_uninstall(cfg_.i2s_port);
-        return;
+        events_ = nullptr;
+        return false;
     }
 
-    // Explicit clock config for precise 16kHz timing
+    // Explicit clock config for precise sample-rate timing
     err = i2s_set_clk(
         cfg_.i2s_port,
         cfg_.sample_rate,
@@ -49,33 +218,57 @@ I2SAudioOutput_MAX98357::I2SAudioOutput_MAX98357(const Config& cfg)
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "I2S set clock failed: %s", esp_err_to_name(err));
         i2s_driver_uninstall(cfg_.i2s_port);
-        return;
+        events_ = nullptr;
+        return false;
     }
 
+    const uint32_t delay_ms = cfg_.dma.delayMs(cfg_.sample_rate);
+    queue_delay_ms_.store(delay_ms, std::memory_order_relaxed);
+    // A full queue frees one buffer per buf_len; wait for the whole queue
+    // plus a margin before calling the write short
+    write_timeout_ = pdMS_TO_TICKS(delay_ms + 10);
+
     i2s_installed = true;
-    ESP_LOGI(TAG, "I2S driver installed: %dHz, 16bit, mono, APLL=off", cfg_.sample_rate);
+    ESP_LOGI(TAG, "I2S driver installed: %dHz, 16bit, mono, APLL=%s, DMA %dx%d (%u ms)",
+             (int)cfg_.sample_rate, cfg_.use_apll ? "on" : "off",
+             cfg_.dma.buf_count, cfg_.dma.buf_len, (unsigned)delay_ms);
+    return true;
 }
 
-I2SAudioOutput_MAX98357::~I2SAudioOutput_MAX98357()
+void I2SAudioOutput_MAX98357::uninstall()
 {
-    stopPlayback();
-    if (i2s_installed) {
-        i2s_driver_uninstall(cfg_.i2s_port);
-        i2s_installed = false;
-    }
+    if (!i2s_installed)
+        return;
+    i2s_driver_uninstall(cfg_.i2s_port);
+    i2s_installed = false;
+    events_ = nullptr;
 }
 
-// ============================================================================
-// Lifecycle
-// ============================================================================
-
-bool I2SAudioOutput_MAX98357::startPlayback()
+bool I2SAudioOutput_MAX98357::setDmaPreset(DmaPreset preset)
 {
-    if (running) return true;
-    if (!i2s_installed) {
-        ESP_LOGE(TAG, "I2S not installed, cannot start playback");
+    const DmaGeometry g = dmaGeometry(preset);
+    if (running)
         return false;
-    }
+    if (i2s_installed && g == cfg_.dma)
+        return true;
+
+    const DmaGeometry prev = cfg_.dma;
+    uninstall();
+    cfg_.dma = g;
+    if (install())
+        return true;
+
+    // Keep the speaker usable with the previous shape
+    cfg_.dma = prev;
+    install();
+    return false;
+}
+
+bool I2SAudioOutput_MAX98357::hwStart()
+{
+    // Stopped clock: events left from the previous run are not underruns
+    if (events_)
+        xQueueReset(events_);
 
     // Clear DMA buffer and start clock
     esp_err_t err = i2s_zero_dma_buffer(cfg_.i2s_port);
@@ -88,66 +281,110 @@ bool I2SAudioOutput_MAX98357::startPlayback()
         ESP_LOGE(TAG, "Failed to start I2S: %s", esp_err_to_name(err));
         return false;
     }
-
-    running = true;
-    ESP_LOGI(TAG, "MAX98357 playback started");
     return true;
 }
 
-void I2SAudioOutput_MAX98357::stopPlayback()
+void I2SAudioOutput_MAX98357::hwStop()
 {
-    if (!running) return;
-
     i2s_stop(cfg_.i2s_port);
-    running = false;
-    ESP_LOGI(TAG, "MAX98357 playback stopped");
 }
 
-// ============================================================================
-// Data
-// ============================================================================
-
-size_t I2SAudioOutput_MAX98357::writePcm(const int16_t* pcm, size_t pcm_samples)
+size_t I2SAudioOutput_MAX98357::hwWrite(const int16_t* samples, size_t n)
 {
-    if (!running || volume == 0 || !pcm || pcm_samples == 0)
-        return 0;
-
-    // CRITICAL: Buffer MUST handle full frame size from codec decode
-    static int16_t scaled[1024];
-    if (pcm_samples > 1024) pcm_samples = 1024;
-
-    for (size_t i = 0; i < pcm_samples; i++) {
-        scaled[i] = (pcm[i] * volume) / 100;
-    }
-
     size_t bytes_written = 0;
     i2s_write(
         cfg_.i2s_port,
-        scaled,
-        pcm_samples * sizeof(int16_t),
+        samples,
+        n * sizeof(int16_t),
         &bytes_written,
-        pdMS_TO_TICKS(50)  // 50ms timeout to allow task responsiveness instead of blocking indefinitely
+        write_timeout_  // bounded: the task stays responsive if the clock stops
     );
+    return bytes_written / sizeof(int16_t);
+}
 
-    return bytes_written / sizeof(int16_t); // trả về số sample
+void I2SAudioOutput_MAX98357::drainEvents()
+{
+    if (!events_)
+        return;
+    i2s_event_t ev;
+    uint32_t n = 0;
+    while (xQueueReceive(events_, &ev, 0) == pdTRUE)
+    {
+        if (ev.type == I2S_EVENT_TX_Q_OVF)
+            n++;
+    }
+    if (n)
+        underruns_.fetch_add(n, std::memory_order_relaxed);
 }
 
+uint32_t I2SAudioOutput_MAX98357::underruns() const
+{
+    return underruns_.load(std::memory_order_relaxed);
+}
 
+#else
 // ============================================================================
-// Control
+// Backend: TX channel of the duplex bus (i2s_std)
 // ============================================================================
 
-void I2SAudioOutput_MAX98357::setVolume(uint8_t percent)
+bool I2SAudioOutput_MAX98357::install()
 {
-    if (percent > 100) percent = 100;
-    volume = percent;
+    if (!cfg_.bus || !cfg_.bus->ready()) {
+        ESP_LOGE(TAG, "Duplex bus not ready");
+        return false;
+    }
+
+    // The bus owns the clock and the DMA shape
+    cfg_.dma = cfg_.bus->config().dma;
+    const uint32_t delay_ms = cfg_.dma.delayMs(cfg_.sample_rate);
+    queue_delay_ms_.store(delay_ms, std::memory_order_relaxed);
+    write_timeout_ = pdMS_TO_TICKS(delay_ms + 10);
+
+    i2s_installed = true;
+    ESP_LOGI(TAG, "On duplex bus TX: %dHz, 32bit slots, DMA %dx%d (%u ms)",
+             (int)cfg_.sample_rate, cfg_.dma.buf_count, cfg_.dma.buf_len, (unsigned)delay_ms);
+    return true;
 }
 
-void I2SAudioOutput_MAX98357::setLowPower(bool enable)
+void I2SAudioOutput_MAX98357::uninstall()
 {
-    if (enable && running) {
-        i2s_stop(cfg_.i2s_port);
-    } else if (!enable && running) {
-        i2s_start(cfg_.i2s_port);
-    }
+    i2s_installed = false;
 }
+
+bool I2SAudioOutput_MAX98357::setDmaPreset(DmaPreset preset)
+{
+    // Shared with the mic and fixed at bus init
+    return i2s_installed && dmaGeometry(preset) == cfg_.dma;
+}
+
+bool I2SAudioOutput_MAX98357::hwStart()
+{
+    return cfg_.bus->acquire(I2SDuplexBus::SPEAKER);
+}
+
+void I2SAudioOutput_MAX98357::hwStop()
+{
+    cfg_.bus->release(I2SDuplexBus::SPEAKER);
+}
+
+size_t I2SAudioOutput_MAX98357::hwWrite(const int16_t* samples, size_t n)
+{
+    // 16-bit sample in the top half of the 32-bit slot
+    for (size_t i = 0; i < n; i++)
+        wide_[i] = static_cast<int32_t>(samples[i]) * 65536;
+
+    size_t bytes_written = 0;
+    i2s_channel_write(cfg_.bus->tx(), wide_, n * sizeof(int32_t), &bytes_written, write_timeout_);
+    return bytes_written / sizeof(int32_t);
+}
+
+void I2SAudioOutput_MAX98357::drainEvents()
+{
+}
+
+uint32_t I2SAudioOutput_MAX98357::underruns() const
+{
+    return cfg_.bus ? cfg_.bus->txUnderflows() : 0;
+}
+
+#endif // PTALK_I2S_STD
@@ -1,7 +1,22 @@
 #pragma once
 
 #include "AudioOutput.hpp"
+#include "I2SDuplexBus.hpp"
+#if !PTALK_I2S_STD
 #include "driver/i2s.h"
+#endif
+
+#include <atomic>
+
+// ESP-DSP (component esp-dsp) cho đường nhân gain cố định; không có thì dùng vòng C
+#if defined(__has_include)
+#if __has_include("dsps_mulc.h")
+#define PTALK_HAS_ESP_DSP 1
+#endif
+#endif
+#ifndef PTALK_HAS_ESP_DSP
+#define PTALK_HAS_ESP_DSP 0
+#endif
 
 /**
  * I2SAudioOutput_MAX98357
@@ -14,6 +29,21 @@
  *   - I2S TX
  *   - 16-bit / 32-bit supported
  *   - Handles amplification internally
+ *
+ * Gain stage (writePcm):
+ *   - Q15 gain tính sẵn trong setVolume(), không chia per-sample
+ *   - Ramp gain ~volume_ramp_ms khi đổi volume (không click)
+ *   - DC blocker 1-pole (~20 Hz), soft clip gần full scale
+ *   - Xử lý theo block qua scratch của object → frame dài bao nhiêu cũng được
+ *   - Gain ổn định + không DC blocker → dsps_mulc_s16 (ESP-DSP) nếu có
+ *
+ * Underrun: driver báo I2S_EVENT_TX_Q_OVF khi DMA phát hết một buffer mà
+ * chưa có dữ liệu mới (tx_desc_auto_clear → phát im lặng); writePcm() đếm
+ * các event đó vào underruns().
+ *
+ * Backend (PTALK_I2S_STD): legacy driver trên port riêng (mặc định), hoặc
+ * kênh TX của I2SDuplexBus (cfg.bus) — slot 32-bit, clock chung với mic,
+ * hình dạng DMA do bus quyết định, underrun đếm bằng callback của bus.
  */
 class I2SAudioOutput_MAX98357 : public AudioOutput {
 public:
@@ -26,6 +56,21 @@ public:
 
         uint32_t sample_rate = 16000;
         uint8_t channels     = 1;   // mono default
+        // APLL clock: accurate 22.05k/44.1k (the PLL_D2 divider drifts off
+        // those). Only one APLL on the chip — leave it to a single port.
+        bool use_apll = false;
+
+        bool dc_block = true;           // remove decoder DC offset before the amp
+        uint16_t volume_ramp_ms = 10;   // gain slew time on volume changes
+
+        // DMA queue depth = count * len samples; it is also the delay from
+        // writePcm() to the amp once the clock runs. setDmaPreset() swaps it.
+        DmaGeometry dma = dmaGeometry(DmaPreset::ROBUST);
+
+#if PTALK_I2S_STD
+        // TX channel owner; port / pins / dma above are unused
+        I2SDuplexBus* bus = nullptr;
+#endif
     };
 
 public:
@@ -42,15 +87,55 @@ public:
 
     void setVolume(uint8_t percent) override;
     void setLowPower(bool enable) override;
+    // Reinstalls the driver with the preset's geometry (stopped only).
+    // Duplex bus: true only for the bus's own geometry.
+    bool setDmaPreset(DmaPreset preset) override;
 
     uint32_t sampleRate() const override { return cfg_.sample_rate; }
+    uint32_t queueDelayMs() const override { return queue_delay_ms_.load(std::memory_order_relaxed); }
     uint8_t  channels() const override   { return cfg_.channels; }
     uint8_t  bitsPerSample() const override { return 16; }
+    uint32_t underruns() const override;
+
+private:
+    // Backend: driver + pins + clock for cfg_ (constructor, setDmaPreset()),
+    // clock start / stop, and one block to the DMA (samples accepted).
+    bool install();
+    void uninstall();
+    bool hwStart();
+    void hwStop();
+    size_t hwWrite(const int16_t* samples, size_t n);
+
+    // Gain/DC/clip one block towards `target`, advancing the ramp and DC
+    // filter state by n samples.
+    void processBlock(const int16_t* in, int16_t* out, size_t n, int32_t target);
+    // Count TX_Q_OVF events (DMA sent a buffer nobody refilled) from the
+    // driver's event queue; called from writePcm() (speaker task). No-op on
+    // the duplex bus (its ISR callback counts).
+    void drainEvents();
 
 private:
     Config cfg_;
 
     bool running = false;
     bool i2s_installed = false;
+#if !PTALK_I2S_STD
+    QueueHandle_t events_ = nullptr;       // legacy driver event queue
+    std::atomic<uint32_t> underruns_{0};
+#endif
+    std::atomic<uint32_t> queue_delay_ms_{0}; // of the installed geometry
+    TickType_t write_timeout_ = 0;           // DMA queue + margin
     uint8_t volume = 60;  // 60% volume
+
+    // Gain stage state (speaker task only, except target_gain_q15_)
+    static constexpr size_t BLOCK_SAMPLES = 256;
+    int16_t scratch_[BLOCK_SAMPLES];
+#if PTALK_I2S_STD
+    int32_t wide_[BLOCK_SAMPLES];  // scratch_ in 32-bit slots
+#endif
+    std::atomic<int32_t> target_gain_q15_{60 * 32767 / 100};
+    int32_t gain_q15_ = 60 * 32767 / 100;
+    int32_t ramp_step_ = 205;   // Q15 per sample
+    int32_t dc_x1_ = 0;         // previous input
+    int32_t dc_y_q8_ = 0;       // previous output, Q8
 };
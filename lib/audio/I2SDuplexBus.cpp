@@ -0,0 +1,190 @@
+#include "I2SDuplexBus.hpp"
+
+#if PTALK_I2S_STD
+
+#include "esp_attr.h"
+#include "esp_log.h"
+
+static const char *TAG = "I2SDuplex";
+
+I2SDuplexBus::~I2SDuplexBus()
+{
+    if (tx_on_ || rx_on_)
+        apply(0);
+    if (tx_)
+        i2s_del_channel(tx_);
+    if (rx_)
+        i2s_del_channel(rx_);
+    if (lock_)
+        vSemaphoreDelete(lock_);
+}
+
+bool I2SDuplexBus::init(const Config &cfg)
+{
+    if (ready())
+        return true;
+    cfg_ = cfg;
+
+    if (!lock_)
+        lock_ = xSemaphoreCreateMutex();
+    if (!lock_)
+        return false;
+
+    i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(cfg_.port, I2S_ROLE_MASTER);
+    chan_cfg.dma_desc_num = cfg_.dma.buf_count;
+    chan_cfg.dma_frame_num = cfg_.dma.buf_len;
+    chan_cfg.auto_clear = true; // TX: sent descriptors zeroed → silence on underrun
+
+    esp_err_t err = i2s_new_channel(&chan_cfg, &tx_, &rx_);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "i2s_new_channel failed: %s", esp_err_to_name(err));
+        tx_ = rx_ = nullptr;
+        return false;
+    }
+
+    // One clock and one slot layout for both directions
+    i2s_std_config_t std_cfg = {
+        .clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(cfg_.sample_rate),
+        .slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_32BIT, I2S_SLOT_MODE_MONO),
+        .gpio_cfg = {
+            .mclk = I2S_GPIO_UNUSED,
+            .bclk = static_cast<gpio_num_t>(cfg_.pin_bck),
+            .ws = static_cast<gpio_num_t>(cfg_.pin_ws),
+            .dout = static_cast<gpio_num_t>(cfg_.pin_dout),
+            .din = static_cast<gpio_num_t>(cfg_.pin_din),
+            .invert_flags = {
+                .mclk_inv = false,
+                .bclk_inv = false,
+                .ws_inv = false,
+            },
+        },
+    };
+    if (cfg_.use_apll)
+        std_cfg.clk_cfg.clk_src = I2S_CLK_SRC_APLL;
+
+    std_cfg.slot_cfg.slot_mask = I2S_STD_SLOT_LEFT;
+    err = i2s_channel_init_std_mode(tx_, &std_cfg);
+    if (err == ESP_OK)
+    {
+        std_cfg.slot_cfg.slot_mask = cfg_.mic_left ? I2S_STD_SLOT_LEFT : I2S_STD_SLOT_RIGHT;
+        err = i2s_channel_init_std_mode(rx_, &std_cfg);
+    }
+
+    // Callbacks can only be registered while the channels are disabled
+    if (err == ESP_OK)
+    {
+        i2s_event_callbacks_t tx_cbs = {};
+        tx_cbs.on_send_q_ovf = onSendQOvf;
+        err = i2s_channel_register_event_callback(tx_, &tx_cbs, this);
+    }
+    if (err == ESP_OK)
+    {
+        i2s_event_callbacks_t rx_cbs = {};
+        rx_cbs.on_recv_q_ovf = onRecvQOvf;
+        err = i2s_channel_register_event_callback(rx_, &rx_cbs, this);
+    }
+
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Channel setup failed: %s", esp_err_to_name(err));
+        i2s_del_channel(tx_);
+        i2s_del_channel(rx_);
+        tx_ = rx_ = nullptr;
+        return false;
+    }
+
+    ESP_LOGI(TAG, "I2S%d full duplex: %uHz, 32bit slots, APLL=%s, DMA %dx%d (%u ms)", (int)cfg_.port,
+             (unsigned)cfg_.sample_rate, cfg_.use_apll ? "on" : "off", cfg_.dma.buf_count, cfg_.dma.buf_len,
+             (unsigned)cfg_.dma.delayMs(cfg_.sample_rate));
+    return true;
+}
+
+// ============================================================================
+// Users
+// ============================================================================
+bool I2SDuplexBus::acquire(User user)
+{
+    if (!ready())
+        return false;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    const uint8_t users = users_.load(std::memory_order_relaxed) | user;
+    const bool ok = apply(users);
+    if (ok)
+        users_.store(users, std::memory_order_relaxed);
+    else
+        apply(users_.load(std::memory_order_relaxed));
+    xSemaphoreGive(lock_);
+    return ok;
+}
+
+void I2SDuplexBus::release(User user)
+{
+    if (!ready())
+        return;
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    const uint8_t users = users_.load(std::memory_order_relaxed) & ~user;
+    users_.store(users, std::memory_order_relaxed);
+    apply(users);
+    xSemaphoreGive(lock_);
+}
+
+bool I2SDuplexBus::apply(uint8_t users)
+{
+    const bool want_tx = users != 0;
+    const bool want_rx = (users & MIC) != 0;
+    esp_err_t err = ESP_OK;
+
+    // RX runs off the TX clock: TX comes up first and goes down last
+    if (want_tx && !tx_on_)
+    {
+        err = i2s_channel_enable(tx_);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(TAG, "TX enable failed: %s", esp_err_to_name(err));
+            return false;
+        }
+        tx_on_ = true;
+    }
+
+    if (want_rx != rx_on_)
+    {
+        err = want_rx ? i2s_channel_enable(rx_) : i2s_channel_disable(rx_);
+        if (err != ESP_OK)
+        {
+            ESP_LOGE(TAG, "RX %s failed: %s", want_rx ? "enable" : "disable", esp_err_to_name(err));
+            return false;
+        }
+        rx_on_ = want_rx;
+    }
+
+    if (!want_tx && tx_on_)
+    {
+        i2s_channel_disable(tx_);
+        tx_on_ = false;
+    }
+    return true;
+}
+
+// ============================================================================
+// ISR callbacks (DMA interrupt)
+// ============================================================================
+// A finished descriptor nobody refilled: the queue overflows and the DMA
+// sends an auto-cleared (silent) buffer
+bool IRAM_ATTR I2SDuplexBus::onSendQOvf(i2s_chan_handle_t, i2s_event_data_t *, void *ctx)
+{
+    auto *bus = static_cast<I2SDuplexBus *>(ctx);
+    if (bus->users_.load(std::memory_order_relaxed) & SPEAKER)
+        bus->tx_underflows_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+// A received descriptor nobody read: the oldest buffer is overwritten
+bool IRAM_ATTR I2SDuplexBus::onRecvQOvf(i2s_chan_handle_t, i2s_event_data_t *, void *ctx)
+{
+    auto *bus = static_cast<I2SDuplexBus *>(ctx);
+    bus->rx_overflows_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+#endif // PTALK_I2S_STD
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "DmaPreset.hpp"
+
+// I2S backend of the audio drivers, chosen at build time: the legacy driver
+// (driver/i2s.h, one port per device) by default; -DPTALK_I2S_STD=1 moves mic
+// and speaker onto one controller through the i2s_std channel API (IDF 5
+// only). IDF aborts at boot when both drivers are linked, so it is never both.
+#ifndef PTALK_I2S_STD
+#define PTALK_I2S_STD 0
+#endif
+
+#if PTALK_I2S_STD
+
+// i2s_std exists from IDF 5.0; espressif32@5.4 (env esp32dev) is IDF 4.4
+#include "esp_idf_version.h"
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 0, 0)
+#error "PTALK_I2S_STD=1 needs ESP-IDF >= 5.0 (driver/i2s_std.h); build without it on IDF 4.4"
+#endif
+
+#include "driver/i2s_std.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include <atomic>
+
+/**
+ * I2SDuplexBus
+ * ============================================================================
+ * Một controller I2S, hai kênh std (Philips) full-duplex: TX → MAX98357,
+ * RX ← INMP441, chung BCLK / WS (đấu chung dây SCK / WS của mic và loa).
+ *
+ * - Một clock cho cả hai chiều: mẫu loa và mẫu mic không trôi nhau, nên bulk
+ *   delay của AEC cố định theo hàng đợi DMA (không cần bám drift).
+ * - Một ngắt DMA thay cho hai; controller còn lại để trống.
+ * - Slot 32-bit mono hai chiều (BCLK = rate x 64): mic 24-bit căn trái,
+ *   loa ghi int16 << 16 (MAX98357 nhận 32-bit).
+ * - Underrun / overrun: callback on_send_q_ovf / on_recv_q_ovf trong ISR,
+ *   chỉ đếm khi phía đó đang được dùng (không có event queue để drain).
+ *
+ * RX nhận clock từ TX: TX chạy khi còn ít nhất một phía acquire() (khi chỉ
+ * mic dùng, TX phát im lặng nhờ auto_clear); RX chạy khi mic acquire().
+ * Hình dạng DMA cố định lúc init() (i2s_new_channel), chung cho hai kênh.
+ */
+class I2SDuplexBus
+{
+public:
+    struct Config
+    {
+        i2s_port_t port = I2S_NUM_0;
+
+        int pin_bck = -1;  // shared SCK / BCLK
+        int pin_ws = -1;   // shared WS / LRCLK
+        int pin_dout = -1; // → MAX98357 DIN
+        int pin_din = -1;  // ← INMP441 SD
+
+        uint32_t sample_rate = 16000;
+        bool use_apll = false;   // APLL clock source (exact 22.05k/44.1k)
+        bool mic_left = true;    // INMP441 L/R select
+
+        DmaGeometry dma = dmaGeometry(DmaPreset::BALANCED);
+    };
+
+    enum User : uint8_t
+    {
+        SPEAKER = 1 << 0,
+        MIC = 1 << 1
+    };
+
+    I2SDuplexBus() = default;
+    ~I2SDuplexBus();
+
+    I2SDuplexBus(const I2SDuplexBus &) = delete;
+    I2SDuplexBus &operator=(const I2SDuplexBus &) = delete;
+
+    // Both channels created and configured, left disabled.
+    bool init(const Config &cfg);
+    bool ready() const { return tx_ && rx_; }
+    const Config &config() const { return cfg_; }
+
+    // Enable the channels `user` needs (ref-counted per side); false if the
+    // bus is not ready or a channel fails to enable.
+    bool acquire(User user);
+    void release(User user);
+
+    i2s_chan_handle_t tx() const { return tx_; }
+    i2s_chan_handle_t rx() const { return rx_; }
+
+    uint32_t txUnderflows() const { return tx_underflows_.load(std::memory_order_relaxed); }
+    uint32_t rxOverflows() const { return rx_overflows_.load(std::memory_order_relaxed); }
+
+private:
+    static bool onSendQOvf(i2s_chan_handle_t chan, i2s_event_data_t *event, void *ctx);
+    static bool onRecvQOvf(i2s_chan_handle_t chan, i2s_event_data_t *event, void *ctx);
+
+    // Enable / disable the channels for the current users_ (lock held).
+    bool apply(uint8_t users);
+
+    Config cfg_;
+    i2s_chan_handle_t tx_ = nullptr;
+    i2s_chan_handle_t rx_ = nullptr;
+    bool tx_on_ = false;
+    bool rx_on_ = false;
+
+    SemaphoreHandle_t lock_ = nullptr;
+    std::atomic<uint8_t> users_{0};
+    std::atomic<uint32_t> tx_underflows_{0};
+    std::atomic<uint32_t> rx_overflows_{0};
+};
+
+#endif // PTALK_I2S_STD
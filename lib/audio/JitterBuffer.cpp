@@ -0,0 +1,79 @@
+#include "JitterBuffer.hpp"
+
+#include <algorithm>
+
+#include "esp_timer.h"
+
+void JitterBuffer::configure(const Config &cfg)
+{
+    cfg_ = cfg;
+    if (cfg_.bytes_per_ms == 0)
+        cfg_.bytes_per_ms = 1;
+    if (cfg_.max_delay_ms < cfg_.min_delay_ms)
+        cfg_.max_delay_ms = cfg_.min_delay_ms;
+    reset();
+}
+
+void JitterBuffer::reset()
+{
+    // Estimator state belongs to the producer: just ask it to restart its
+    // time base on the next packet.
+    restart_pending_.store(true, std::memory_order_release);
+    last_arrival_ms_.store(0, std::memory_order_relaxed);
+    boost_ms_.store(boost_ms_.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    underrun_pending_.store(false, std::memory_order_relaxed);
+}
+
+void JitterBuffer::onArrival(size_t bytes)
+{
+    int64_t now_us = esp_timer_get_time();
+    last_arrival_ms_.store(static_cast<uint32_t>(now_us / 1000) | 1, std::memory_order_relaxed);
+
+    if (restart_pending_.exchange(false, std::memory_order_acq_rel) || first_arrival_us_ < 0)
+    {
+        first_arrival_us_ = now_us;
+        media_bytes_ = bytes;
+        prev_transit_ms_ = 0;
+        return;
+    }
+
+    // transit = arrival time - media time of the packet start
+    int64_t arrival_ms = (now_us - first_arrival_us_) / 1000;
+    int64_t transit = arrival_ms - static_cast<int64_t>(media_bytes_ / cfg_.bytes_per_ms);
+    int64_t d = transit - prev_transit_ms_;
+    prev_transit_ms_ = transit;
+    media_bytes_ += bytes;
+
+    if (d < 0)
+        d = -d;
+    if (d > 1000)
+        d = 1000; // a stall is handled by the underrun path, don't let it blow up J
+
+    // J += (|D| - J) / 16, J kept in Q4
+    int32_t j = static_cast<int32_t>(jitter_q4_.load(std::memory_order_relaxed));
+    j += (static_cast<int32_t>(d << 4) - j) >> 4;
+    jitter_q4_.store(static_cast<uint32_t>(std::max<int32_t>(j, 0)), std::memory_order_relaxed);
+}
+
+uint32_t JitterBuffer::targetMs() const
+{
+    uint32_t t = cfg_.start_delay_ms + 2 * jitterMs() + boost_ms_.load(std::memory_order_relaxed);
+    return std::clamp(t, cfg_.min_delay_ms, cfg_.max_delay_ms);
+}
+
+uint32_t JitterBuffer::msSinceArrival() const
+{
+    uint32_t last = last_arrival_ms_.load(std::memory_order_relaxed);
+    if (last == 0)
+        return UINT32_MAX;
+    int32_t d = static_cast<int32_t>(static_cast<uint32_t>(esp_timer_get_time() / 1000) - last);
+    return d > 0 ? static_cast<uint32_t>(d) : 0;
+}
+
+void JitterBuffer::noteUnderrun()
+{
+    uint32_t boost = boost_ms_.load(std::memory_order_relaxed) + cfg_.underrun_step_ms;
+    boost_ms_.store(std::min(boost, cfg_.max_delay_ms), std::memory_order_relaxed);
+    underruns_.fetch_add(1, std::memory_order_relaxed);
+    underrun_pending_.store(true, std::memory_order_release);
+}
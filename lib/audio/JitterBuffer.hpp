@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+
+/**
+ * JitterBuffer
+ * ============================================================================
+ * Playout-delay controller cho downlink audio (server → speaker).
+ *
+ * Không tự giữ dữ liệu: encoded bytes vẫn nằm trong SpscRing của
+ * AudioManager. Lớp này chỉ quyết định KHI NÀO bắt đầu decode:
+ *
+ *  - onArrival(): gọi từ WS callback cho mỗi gói, ước lượng inter-arrival
+ *    jitter kiểu RFC 3550 (J += (|D| - J) / 16) theo thời lượng audio
+ *    mà gói đó mang.
+ *  - targetBytes(): độ sâu cần có trước khi phát =
+ *      start_delay + 2 * jitter + underrun boost, kẹp trong [min, max].
+ *    Bắt đầu thấp (fast start), chỉ tăng khi mạng thật sự giật.
+ *  - noteUnderrun(): speaker task báo hết dữ liệu → tăng boost và
+ *    decoder task buffer lại (takeUnderrun()).
+ *
+ * Producer (WS task) và consumer (codec/speaker task) khác nhau nên mọi
+ * trạng thái chia sẻ là atomic; chỉ onArrival() ghi ước lượng jitter.
+ */
+class JitterBuffer
+{
+public:
+    struct Config
+    {
+        uint32_t bytes_per_ms = 8;     // encoded rate (ADPCM 16kHz 4-bit = 8 B/ms)
+        uint32_t start_delay_ms = 48;  // initial playout delay (fast start)
+        uint32_t min_delay_ms = 32;
+        uint32_t max_delay_ms = 400;
+        uint32_t underrun_step_ms = 24; // boost added per underrun
+    };
+
+    JitterBuffer() = default;
+
+    void configure(const Config &cfg);
+
+    // New talk spurt / session: keep learned jitter, halve the underrun boost.
+    void reset();
+
+    // Producer: a downlink packet of `bytes` encoded bytes arrived now.
+    void onArrival(size_t bytes);
+
+    // Consumer: playout depth to reach before (re)starting decode.
+    uint32_t targetMs() const;
+    size_t targetBytes() const { return static_cast<size_t>(targetMs()) * cfg_.bytes_per_ms; }
+
+    // Smoothed inter-arrival jitter in ms.
+    uint32_t jitterMs() const { return jitter_q4_.load(std::memory_order_relaxed) >> 4; }
+
+    // Milliseconds since the last packet (UINT32_MAX if none this session).
+    uint32_t msSinceArrival() const;
+
+    // Speaker ran dry: raise the target and ask the codec to rebuffer.
+    void noteUnderrun();
+    // Codec: consume a pending underrun notice.
+    bool takeUnderrun() { return underrun_pending_.exchange(false, std::memory_order_acq_rel); }
+
+    uint32_t underrunCount() const { return underruns_.load(std::memory_order_relaxed); }
+
+private:
+    Config cfg_{};
+
+    // Producer-owned estimator state
+    int64_t first_arrival_us_ = -1; // session time base
+    uint64_t media_bytes_ = 0;      // encoded audio received so far
+    int64_t prev_transit_ms_ = 0;
+
+    std::atomic<bool> restart_pending_{true};
+    std::atomic<uint32_t> last_arrival_ms_{0}; // 0 = none (low bit forced to 1)
+    std::atomic<uint32_t> jitter_q4_{0};  // ms, 4 fractional bits
+    std::atomic<uint32_t> boost_ms_{0};
+    std::atomic<bool> underrun_pending_{false};
+    std::atomic<uint32_t> underruns_{0};
+};
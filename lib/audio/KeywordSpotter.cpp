@@ -0,0 +1,252 @@
+#include "KeywordSpotter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "KeywordSpotter";
+
+static float hzToMel(float hz) { return 2595.0f * log10f(1.0f + hz / 700.0f); }
+static float melToHz(float mel) { return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f); }
+
+// ============================================================================
+// Init / Deinit
+// ============================================================================
+bool KeywordSpotter::init(const Config &cfg, KeywordModel *model)
+{
+    deinit();
+    if (!model || cfg.sample_rate == 0 || cfg.mel_bands < 2)
+        return false;
+
+    cfg_ = cfg;
+    cfg_.smooth_frames = std::clamp<uint8_t>(cfg_.smooth_frames, 1, MAX_SMOOTH);
+    cfg_.infer_every_hops = std::max<uint8_t>(cfg_.infer_every_hops, 1);
+    cfg_.max_every_hops = std::max(cfg_.max_every_hops, cfg_.infer_every_hops);
+
+    frames_ = model->inputFrames();
+    coeffs_ = model->inputCoeffs();
+    hop_samples_ = cfg_.sample_rate * cfg_.hop_ms / 1000;
+    win_samples_ = std::min<size_t>(FFT_SIZE, cfg_.sample_rate * 32 / 1000);
+    if (frames_ == 0 || coeffs_ == 0 || coeffs_ > cfg_.mel_bands ||
+        hop_samples_ == 0 || hop_samples_ > win_samples_)
+    {
+        ESP_LOGE(TAG, "Unsupported layout: %u frames x %u coeffs, hop %u / win %u",
+                 (unsigned)frames_, (unsigned)coeffs_, (unsigned)hop_samples_, (unsigned)win_samples_);
+        return false;
+    }
+
+    const size_t bands = cfg_.mel_bands;
+    hann_.reset(new (std::nothrow) float[win_samples_]);
+    mel_edges_.reset(new (std::nothrow) uint16_t[bands + 2]);
+    dct_.reset(new (std::nothrow) float[coeffs_ * bands]);
+    pcm_.reset(new (std::nothrow) int16_t[win_samples_]);
+    work_.reset(new (std::nothrow) float[2 * FFT_SIZE + bands]);
+    features_.reset(new (std::nothrow) int8_t[frames_ * coeffs_]);
+    if (!fft_.init() || !hann_ || !mel_edges_ || !dct_ || !pcm_ || !work_ || !features_)
+    {
+        ESP_LOGE(TAG, "Out of memory");
+        deinit();
+        return false;
+    }
+
+    const float pi = 3.14159265f;
+    for (size_t i = 0; i < win_samples_; i++)
+        hann_[i] = 0.5f - 0.5f * cosf(2.0f * pi * i / (win_samples_ - 1));
+
+    // Mel triangle edges as FFT bins (bands + 2 points, 20 Hz .. Nyquist)
+    const float mel_lo = hzToMel(20.0f);
+    const float mel_hi = hzToMel(cfg_.sample_rate / 2.0f);
+    for (size_t i = 0; i < bands + 2; i++)
+    {
+        float hz = melToHz(mel_lo + (mel_hi - mel_lo) * i / (bands + 1));
+        size_t bin = static_cast<size_t>(hz * FFT_SIZE / cfg_.sample_rate + 0.5f);
+        mel_edges_[i] = static_cast<uint16_t>(std::min(bin, FFT_SIZE / 2));
+    }
+
+    // Orthonormal DCT-II
+    for (size_t k = 0; k < coeffs_; k++)
+        for (size_t m = 0; m < bands; m++)
+            dct_[k * bands + m] = sqrtf(2.0f / bands) * cosf(pi * k * (m + 0.5f) / bands);
+
+    model_ = model;
+    reset();
+
+    ESP_LOGI(TAG, "KWS ready: model %s, %u x %u MFCC, hop %u ms, stride %u hops",
+             model_->name(), (unsigned)frames_, (unsigned)coeffs_,
+             (unsigned)cfg_.hop_ms, (unsigned)stride_hops_);
+    return true;
+}
+
+void KeywordSpotter::deinit()
+{
+    model_ = nullptr;
+    hann_.reset();
+    fft_.release();
+    mel_edges_.reset();
+    dct_.reset();
+    pcm_.reset();
+    work_.reset();
+    features_.reset();
+}
+
+void KeywordSpotter::reset()
+{
+    if (pcm_)
+        memset(pcm_.get(), 0, win_samples_ * sizeof(int16_t));
+    pcm_fill_ = 0;
+    feature_count_ = 0;
+    stride_hops_ = cfg_.infer_every_hops;
+    hops_since_infer_ = 0;
+    refractory_hops_ = 0;
+    score_idx_ = 0;
+    score_count_ = 0;
+    last_score_ = 0;
+}
+
+// ============================================================================
+// Feed
+// ============================================================================
+bool KeywordSpotter::feed(const int16_t *pcm, size_t samples)
+{
+    if (!model_ || !pcm)
+        return false;
+
+    bool detected = false;
+    const size_t tail = win_samples_ - hop_samples_;
+
+    while (samples > 0)
+    {
+        size_t take = std::min(samples, hop_samples_ - pcm_fill_);
+        memcpy(&pcm_[tail + pcm_fill_], pcm, take * sizeof(int16_t));
+        pcm += take;
+        samples -= take;
+        pcm_fill_ += take;
+        if (pcm_fill_ < hop_samples_)
+            break;
+        pcm_fill_ = 0;
+
+        // New feature row (slide the window once it is full)
+        int8_t *row;
+        if (feature_count_ < frames_)
+        {
+            row = &features_[feature_count_++ * coeffs_];
+        }
+        else
+        {
+            memmove(&features_[0], &features_[coeffs_], (frames_ - 1) * coeffs_);
+            row = &features_[(frames_ - 1) * coeffs_];
+        }
+        computeMfcc(row);
+        hops_++;
+        memmove(&pcm_[0], &pcm_[hop_samples_], tail * sizeof(int16_t));
+
+        if (refractory_hops_ > 0)
+        {
+            refractory_hops_--;
+            continue;
+        }
+        if (!detect_)
+            continue;
+        if (++hops_since_infer_ < stride_hops_ || feature_count_ < frames_)
+            continue;
+        hops_since_infer_ = 0;
+
+        if (runInference())
+            detected = true;
+    }
+    return detected;
+}
+
+// ============================================================================
+// Front-end: one hop → MFCC row (int8)
+// ============================================================================
+void KeywordSpotter::computeMfcc(int8_t *out)
+{
+    const size_t bands = cfg_.mel_bands;
+    float *re = &work_[0];
+    float *im = &work_[FFT_SIZE];
+    float *mel = &work_[2 * FFT_SIZE];
+
+    for (size_t i = 0; i < FFT_SIZE; i++)
+    {
+        re[i] = i < win_samples_ ? pcm_[i] * hann_[i] * (1.0f / 32768.0f) : 0.0f;
+        im[i] = 0.0f;
+    }
+    fft_.transform(re, im);
+
+    // Power spectrum in place (bins 0..N/2)
+    for (size_t i = 0; i <= FFT_SIZE / 2; i++)
+        re[i] = re[i] * re[i] + im[i] * im[i];
+
+    for (size_t b = 0; b < bands; b++)
+    {
+        size_t lo = mel_edges_[b], mid = mel_edges_[b + 1], hi = mel_edges_[b + 2];
+        float e = 0.0f;
+        for (size_t i = lo; i < mid; i++)
+            e += re[i] * (i - lo) / static_cast<float>(mid - lo);
+        for (size_t i = mid; i < hi; i++)
+            e += re[i] * (hi - i) / static_cast<float>(hi - mid);
+        if (mid == lo && mid == hi)
+            e = re[mid]; // narrow low bands collapse onto one bin
+        mel[b] = logf(e + 1e-6f);
+    }
+
+    const float inv_scale = 1.0f / model_->inputScale();
+    for (size_t k = 0; k < coeffs_; k++)
+    {
+        float c = 0.0f;
+        const float *d = &dct_[k * bands];
+        for (size_t m = 0; m < bands; m++)
+            c += d[m] * mel[m];
+        int q = static_cast<int>(lrintf(c * inv_scale));
+        out[k] = static_cast<int8_t>(std::clamp(q, -128, 127));
+    }
+}
+
+// ============================================================================
+// Inference + decision
+// ============================================================================
+bool KeywordSpotter::runInference()
+{
+    int64_t t0 = esp_timer_get_time();
+    uint8_t p = model_->infer(features_.get());
+    last_infer_us_ = static_cast<uint32_t>(esp_timer_get_time() - t0);
+
+    // Bounded CPU: stretch the stride while inference exceeds its share
+    uint32_t budget_us = stride_hops_ * cfg_.hop_ms * 10u * cfg_.cpu_budget_pct;
+    if (last_infer_us_ > budget_us && stride_hops_ < cfg_.max_every_hops)
+    {
+        stride_hops_++;
+        ESP_LOGW(TAG, "Inference %u us over budget, stride -> %u hops",
+                 (unsigned)last_infer_us_, (unsigned)stride_hops_);
+    }
+    else if (stride_hops_ > cfg_.infer_every_hops &&
+             2 * last_infer_us_ < (stride_hops_ - 1u) * cfg_.hop_ms * 10u * cfg_.cpu_budget_pct)
+    {
+        stride_hops_--;
+    }
+
+    scores_[score_idx_] = p;
+    score_idx_ = (score_idx_ + 1) % cfg_.smooth_frames;
+    if (score_count_ < cfg_.smooth_frames)
+        score_count_++;
+
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < score_count_; i++)
+        sum += scores_[i];
+    last_score_ = static_cast<uint8_t>(sum / score_count_);
+
+    if (score_count_ < cfg_.smooth_frames || last_score_ < cfg_.threshold)
+        return false;
+
+    ESP_LOGI(TAG, "Keyword detected (score=%u, infer=%u us)",
+             (unsigned)last_score_, (unsigned)last_infer_us_);
+    refractory_hops_ = static_cast<uint16_t>(cfg_.refractory_ms / std::max<uint16_t>(cfg_.hop_ms, 1));
+    score_idx_ = 0;
+    score_count_ = 0;
+    return true;
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Radix2Fft.hpp"
+
+/**
+ * KeywordModel
+ * ============================================================================
+ * Bộ phân loại wake-word chạy trên cửa sổ MFCC đã lượng tử hóa int8.
+ *
+ * Input:  inputFrames() x inputCoeffs() int8, frame-major, frame cũ nhất trước.
+ * Output: xác suất keyword 0..255.
+ *
+ * KeywordSpotter lo front-end (MFCC), smoothing và ngưỡng; model chỉ infer.
+ */
+class KeywordModel
+{
+public:
+    virtual ~KeywordModel() = default;
+
+    virtual size_t inputFrames() const = 0;
+    virtual size_t inputCoeffs() const = 0;
+
+    // Quantization step of the int8 features (mfcc = q * scale)
+    virtual float inputScale() const = 0;
+
+    virtual uint8_t infer(const int8_t *features) = 0;
+
+    virtual const char *name() const = 0;
+};
+
+/**
+ * KeywordSpotter
+ * ============================================================================
+ * Always-on keyword spotting front-end trên PCM đã decimate (mặc định 8 kHz).
+ *
+ * - Hop 20 ms, cửa sổ 32 ms (Hann) → FFT 256 → log-mel → DCT (MFCC)
+ * - Cửa sổ feature trượt (inputFrames() hop), infer mỗi stride hop
+ * - Posterior trung bình trên smooth_frames lần infer ≥ threshold → detect,
+ *   sau đó refractory để một câu nói không bắn nhiều event
+ * - CPU budget: nếu infer tốn quá cpu_budget_pct thời gian thực, stride tự
+ *   tăng (chậm phát hiện hơn chứ không chiếm CPU của audio/WiFi)
+ * - Cửa sổ feature dùng chung: CommandRecognizer đọc features() sau mỗi
+ *   feed(); setDetect(false) chỉ chạy front-end (không infer wake-word)
+ *
+ * Không thread-safe: chỉ KWS task gọi feed().
+ */
+class KeywordSpotter
+{
+public:
+    struct Config
+    {
+        uint32_t sample_rate = 8000;   // decimated input rate
+        uint16_t hop_ms = 20;
+        uint8_t mel_bands = 20;
+        uint8_t infer_every_hops = 2;  // nominal stride (40 ms)
+        uint8_t max_every_hops = 16;   // budget never stretches the stride past this
+        uint8_t smooth_frames = 3;     // posterior averaging (inferences)
+        uint8_t threshold = 200;       // 0..255 on the smoothed posterior
+        uint16_t refractory_ms = 1500; // ignore repeats after a detection
+        uint8_t cpu_budget_pct = 25;   // of real time per stride
+    };
+
+    KeywordSpotter() = default;
+    ~KeywordSpotter() = default;
+
+    KeywordSpotter(const KeywordSpotter &) = delete;
+    KeywordSpotter &operator=(const KeywordSpotter &) = delete;
+
+    // Build tables and buffers for `model` (not owned). False on OOM / bad config.
+    bool init(const Config &cfg, KeywordModel *model);
+    void deinit();
+    bool ready() const { return model_ != nullptr; }
+
+    // Drop history (after re-arming, so stale audio can't trigger).
+    void reset();
+
+    // Push decimated PCM; true when the keyword was detected in this chunk.
+    bool feed(const int16_t *pcm, size_t samples);
+    // Off: MFCC rows keep sliding, the keyword model is not run.
+    void setDetect(bool on) { detect_ = on; }
+
+    // Shared MFCC window: frames() x coeffs() int8, oldest row first.
+    const int8_t *features() const { return features_.get(); }
+    bool windowFull() const { return feature_count_ >= frames_; }
+    uint32_t hops() const { return hops_; } // rows computed, wraps
+    size_t frames() const { return frames_; }
+    size_t coeffs() const { return coeffs_; }
+    uint16_t hopMs() const { return cfg_.hop_ms; }
+    float inputScale() const { return model_ ? model_->inputScale() : 0.f; }
+
+    uint8_t lastScore() const { return last_score_; }
+    uint32_t lastInferUs() const { return last_infer_us_; }
+    uint8_t strideHops() const { return stride_hops_; }
+
+private:
+    static constexpr size_t FFT_SIZE = Radix2Fft::SIZE;
+    static constexpr size_t MAX_SMOOTH = 8;
+
+    void computeMfcc(int8_t *out);
+    bool runInference();
+
+private:
+    Config cfg_{};
+    KeywordModel *model_ = nullptr;
+
+    size_t hop_samples_ = 160;
+    size_t win_samples_ = 256;
+    size_t frames_ = 0; // model window (hops)
+    size_t coeffs_ = 0; // MFCC per hop
+
+    // Tables
+    std::unique_ptr<float[]> hann_;   // win_samples_
+    Radix2Fft fft_;                   // shared twiddle table
+    std::unique_ptr<uint16_t[]> mel_edges_; // mel_bands + 2 FFT bins
+    std::unique_ptr<float[]> dct_;    // coeffs_ x mel_bands
+
+    // Working state
+    std::unique_ptr<int16_t[]> pcm_;     // last win_samples_ input samples
+    size_t pcm_fill_ = 0;                // new samples since last hop
+    std::unique_ptr<float[]> work_;      // 2 * FFT_SIZE (re | im) + mel_bands
+    std::unique_ptr<int8_t[]> features_; // frames_ x coeffs_, oldest first
+    size_t feature_count_ = 0;
+
+    uint32_t hops_ = 0;
+    bool detect_ = true;
+    uint8_t stride_hops_ = 2;
+    uint8_t hops_since_infer_ = 0;
+    uint16_t refractory_hops_ = 0;
+
+    uint8_t scores_[MAX_SMOOTH] = {0};
+    uint8_t score_idx_ = 0;
+    uint8_t score_count_ = 0;
+    uint8_t last_score_ = 0;
+    uint32_t last_infer_us_ = 0;
+};
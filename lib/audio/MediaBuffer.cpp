@@ -0,0 +1,213 @@
+#include "MediaBuffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+bool MediaBuffer::init(const Config &cfg)
+{
+    deinit();
+    cfg_ = cfg;
+    ram_.reset(new (std::nothrow) uint8_t[cfg.ram_bytes]);
+    if (!ram_)
+        return false;
+    ram_cap_ = cfg.ram_bytes;
+    reset(0);
+    return true;
+}
+
+void MediaBuffer::deinit()
+{
+    closeFile();
+    ram_.reset();
+    ram_cap_ = 0;
+    reset(0);
+}
+
+void MediaBuffer::closeFile()
+{
+    if (file_)
+    {
+        fclose(file_);
+        file_ = nullptr;
+        if (cfg_.spill_path)
+            remove(cfg_.spill_path);
+    }
+    file_head_ = file_tail_ = 0;
+}
+
+void MediaBuffer::reset(uint32_t offset)
+{
+    ram_head_ = ram_tail_ = 0;
+    // The file stays open for the next spill; positions restart at 0
+    file_head_ = file_tail_ = 0;
+    read_off_ = offset;
+}
+
+// ============================================================================
+// RAM ring
+// ============================================================================
+size_t MediaBuffer::ramIn(const uint8_t *src, size_t n)
+{
+    n = std::min(n, ram_cap_ - ramBytes());
+    const size_t at = ram_head_ % ram_cap_;
+    const size_t first = std::min(n, ram_cap_ - at);
+    memcpy(&ram_[at], src, first);
+    memcpy(&ram_[0], src + first, n - first);
+    ram_head_ += n;
+    return n;
+}
+
+void MediaBuffer::ramCopyOut(size_t pos, uint8_t *dst, size_t n) const
+{
+    const size_t at = pos % ram_cap_;
+    const size_t first = std::min(n, ram_cap_ - at);
+    memcpy(dst, &ram_[at], first);
+    memcpy(dst + first, &ram_[0], n - first);
+}
+
+// ============================================================================
+// Spill file: a ring of spill_max_bytes, overwritten in place
+// ============================================================================
+bool MediaBuffer::fileWrite(size_t pos, const uint8_t *src, size_t n)
+{
+    const size_t cap = cfg_.spill_max_bytes;
+    while (n > 0)
+    {
+        const size_t at = pos % cap;
+        const size_t part = std::min(n, cap - at);
+        if (fseek(file_, static_cast<long>(at), SEEK_SET) != 0 || fwrite(src, 1, part, file_) != part)
+            return false;
+        pos += part;
+        src += part;
+        n -= part;
+    }
+    return true;
+}
+
+bool MediaBuffer::fileRead(size_t pos, uint8_t *dst, size_t n)
+{
+    const size_t at = pos % cfg_.spill_max_bytes;
+    return n <= cfg_.spill_max_bytes - at && fseek(file_, static_cast<long>(at), SEEK_SET) == 0 &&
+           fread(dst, 1, n, file_) == n;
+}
+
+size_t MediaBuffer::fileIn(const uint8_t *src, size_t n)
+{
+    if (!cfg_.spill_path || cfg_.spill_max_bytes == 0)
+        return 0;
+    n = std::min(n, cfg_.spill_max_bytes - spilledBytes());
+    if (n == 0)
+        return 0;
+    if (!file_)
+    {
+        file_ = fopen(cfg_.spill_path, "w+b");
+        if (!file_)
+        {
+            errors_++;
+            return 0;
+        }
+    }
+    // Flash full: nothing taken, the caller retries later
+    if (!fileWrite(file_head_, src, n))
+    {
+        errors_++;
+        return 0;
+    }
+    file_head_ += n;
+    return n;
+}
+
+void MediaBuffer::promote()
+{
+    const size_t n = std::min(spilledBytes(), ram_cap_ - ramBytes());
+    if (n == 0)
+        return;
+    // Straight into the ring, split where either ring wraps
+    size_t done = 0;
+    while (done < n)
+    {
+        const size_t at = (ram_head_ + done) % ram_cap_;
+        const size_t in_file = cfg_.spill_max_bytes - (file_tail_ + done) % cfg_.spill_max_bytes;
+        const size_t part = std::min({n - done, ram_cap_ - at, in_file});
+        if (!fileRead(file_tail_ + done, &ram_[at], part))
+        {
+            // Unreadable: the file part is lost, the writer refetches it
+            errors_++;
+            file_head_ = file_tail_ = 0;
+            return;
+        }
+        done += part;
+    }
+    ram_head_ += n;
+    file_tail_ += n;
+    if (file_tail_ == file_head_)
+        file_head_ = file_tail_ = 0;
+}
+
+// ============================================================================
+// Stream side
+// ============================================================================
+size_t MediaBuffer::write(const uint8_t *data, size_t n)
+{
+    if (!ram_ || !data)
+        return 0;
+    // Keep the order: once bytes wait in the file, new ones follow them
+    size_t done = spilledBytes() == 0 ? ramIn(data, n) : 0;
+    if (done < n)
+        done += fileIn(data + done, n - done);
+    return done;
+}
+
+size_t MediaBuffer::space() const
+{
+    const size_t file_cap = cfg_.spill_path ? cfg_.spill_max_bytes : 0;
+    if (spilledBytes() > 0)
+        return file_cap - spilledBytes();
+    return ram_cap_ - ramBytes() + file_cap;
+}
+
+size_t MediaBuffer::read(uint8_t *out, size_t n)
+{
+    if (!ram_)
+        return 0;
+    size_t done = 0;
+    while (done < n)
+    {
+        // Refill in large blocks: at most one flash read per half ring
+        if (spilledBytes() > 0 && ramBytes() < ram_cap_ / 2)
+            promote();
+        const size_t part = std::min(n - done, ramBytes());
+        if (part == 0)
+            break;
+        ramCopyOut(ram_tail_, out + done, part);
+        ram_tail_ += part;
+        done += part;
+    }
+    read_off_ += static_cast<uint32_t>(done);
+    return done;
+}
+
+bool MediaBuffer::peek(uint8_t *out, size_t n)
+{
+    if (!ram_ || n > bytes() || n > ram_cap_)
+        return false;
+    if (ramBytes() < n)
+        promote();
+    if (ramBytes() < n)
+        return false;
+    ramCopyOut(ram_tail_, out, n);
+    return true;
+}
+
+size_t MediaBuffer::skip(size_t n)
+{
+    const size_t from_ram = std::min(n, ramBytes());
+    ram_tail_ += from_ram;
+    const size_t from_file = std::min(n - from_ram, spilledBytes());
+    file_tail_ += from_file;
+    if (file_tail_ == file_head_)
+        file_head_ = file_tail_ = 0;
+    read_off_ += static_cast<uint32_t>(from_ram + from_file);
+    return from_ram + from_file;
+}
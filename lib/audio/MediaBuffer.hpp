@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+/**
+ * MediaBuffer
+ * ============================================================================
+ * Prebuffer byte-stream cho media dài (nhạc / podcast, MediaPlayer): luồng
+ * nén tải trước nhiều giây để mạng chập chờn không làm đứt tiếng.
+ *
+ *  - RAM trước (ram_bytes), tràn sang một vòng file trên flash (spill_path,
+ *    vd "/spiffs/media.bin", tối đa spill_max_bytes, ghi đè tại chỗ).
+ *  - Thứ tự giữ nguyên: mọi byte trong RAM luôn cũ hơn mọi byte trong file;
+ *    khi file còn dữ liệu, byte mới cũng vào file. read() kéo dần phần đầu
+ *    file về RAM (từng khối ≥ nửa RAM) khi RAM vơi, nên đọc flash theo khối
+ *    lớn, còn decoder luôn đọc từ RAM.
+ *  - Biết vị trí trong stream: readOffset() là byte stream kế tiếp sẽ đọc,
+ *    writeOffset() là byte kế tiếp cần tải. reset(offset) bỏ hết và bắt đầu
+ *    lại ở offset (seek ra ngoài phần đã đệm); skip() nhảy tới trong phần đã
+ *    đệm không cần tải lại.
+ *  - Lỗi đọc file → phần trong file bị bỏ (errors() tăng): writeOffset()
+ *    lùi về đó, bên tải lấy lại từ offset ấy.
+ *
+ * Không thread-safe: MediaPlayer giữ mutex quanh mọi lời gọi.
+ */
+class MediaBuffer
+{
+public:
+    struct Config
+    {
+        size_t ram_bytes = 40 * 1024;
+        const char *spill_path = nullptr; // nullptr = RAM only
+        size_t spill_max_bytes = 256 * 1024;
+    };
+
+    MediaBuffer() = default;
+    ~MediaBuffer() { deinit(); }
+
+    MediaBuffer(const MediaBuffer &) = delete;
+    MediaBuffer &operator=(const MediaBuffer &) = delete;
+
+    // Allocate the RAM part; false on OOM.
+    bool init(const Config &cfg);
+    // Drop everything, free RAM, delete the spill file.
+    void deinit();
+    bool ready() const { return ram_ != nullptr; }
+
+    // Forget the buffered bytes; the next byte written is stream byte `offset`.
+    void reset(uint32_t offset = 0);
+
+    // Append up to n bytes (RAM, then file); returns bytes taken.
+    size_t write(const uint8_t *data, size_t n);
+    // Up to n bytes from the front; returns bytes copied.
+    size_t read(uint8_t *out, size_t n);
+    // First n bytes without consuming them; false when fewer are buffered.
+    bool peek(uint8_t *out, size_t n);
+    // Drop up to n bytes from the front; returns bytes dropped.
+    size_t skip(size_t n);
+
+    size_t bytes() const { return ramBytes() + spilledBytes(); }
+    size_t ramBytes() const { return ram_head_ - ram_tail_; }
+    size_t spilledBytes() const { return file_head_ - file_tail_; }
+    size_t capacity() const { return ram_cap_ + (cfg_.spill_path ? cfg_.spill_max_bytes : 0); }
+    // Bytes write() takes now: while the file holds data, only its free part
+    size_t space() const;
+
+    uint32_t readOffset() const { return read_off_; }
+    uint32_t writeOffset() const { return read_off_ + static_cast<uint32_t>(bytes()); }
+    uint32_t errors() const { return errors_; }
+
+private:
+    size_t ramIn(const uint8_t *src, size_t n);
+    size_t fileIn(const uint8_t *src, size_t n);
+    // Move the oldest file bytes into free RAM
+    void promote();
+    void ramCopyOut(size_t pos, uint8_t *dst, size_t n) const;
+    bool fileWrite(size_t pos, const uint8_t *src, size_t n);
+    // One run that does not cross the end of the file ring
+    bool fileRead(size_t pos, uint8_t *dst, size_t n);
+    void closeFile();
+
+    Config cfg_{};
+    std::unique_ptr<uint8_t[]> ram_;
+    size_t ram_cap_ = 0;
+    size_t ram_head_ = 0; // bytes ever written / read (positions mod ram_cap_)
+    size_t ram_tail_ = 0;
+
+    FILE *file_ = nullptr;
+    size_t file_head_ = 0; // positions mod spill_max_bytes
+    size_t file_tail_ = 0;
+
+    uint32_t read_off_ = 0;
+    uint32_t errors_ = 0;
+};
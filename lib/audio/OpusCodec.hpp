@@ -1,98 +1,114 @@
-// #pragma once
-
-// #include "AudioCodec.hpp"
-// #include <cstdint>
-// #include <memory>
-
-// struct OpusEncoder;
-// struct OpusDecoder;
-
-// /**
-//  * OpusCodec
-//  * ============================================================================
-//  * Opus compression codec for real-time audio streaming.
-//  * 
-//  * - Input: 16-bit PCM mono audio
-//  * - Output: Opus-encoded frames (variable-length)
-//  * - Sample rate: 16 kHz (standard for voice)
-//  * - Frame duration: 20 ms (320 samples per frame)
-//  * - Bitrate: ~10-16 kbps (ultra-low for IoT)
-//  * - Quality: Good voice clarity for speech
-//  *
-//  * State:
-//  * - OpusEncoder & OpusDecoder maintain internal state
-//  * - reset() clears state for packet loss recovery
-//  * - NOT real-time safe if memory allocation fails mid-stream
-//  */
-// class OpusCodec : public AudioCodec {
-// public:
-//     // ========================================================================
-//     // Constructor / Destructor
-//     // ========================================================================
-//     explicit OpusCodec(uint32_t sample_rate = 16000,
-//                        int bitrate_bps = 12000);
-//     ~OpusCodec() override;
-
-//     // Disable copy/move (contains opaque pointers to opus state)
-//     OpusCodec(const OpusCodec&) = delete;
-//     OpusCodec& operator=(const OpusCodec&) = delete;
-
-//     // ========================================================================
-//     // AudioCodec Interface
-//     // ========================================================================
-
-//     /**
-//      * Encode PCM samples to Opus frames
-//      * 
-//      * @param pcm             Pointer to int16_t PCM samples (mono)
-//      * @param pcm_samples     Number of samples to encode
-//      * @param out             Output buffer for encoded frames
-//      * @param out_capacity    Max bytes to write
-//      * @return                Bytes written to output buffer
-//      * 
-//      * Note: Opus works on frames (320 samples @ 16kHz = 20ms)
-//      *       Partial frames are buffered internally and encoded when complete
-//      */
-//     size_t encode(const int16_t* pcm,
-//                   size_t pcm_samples,
-//                   uint8_t* out,
-//                   size_t out_capacity) override;
-
-//     /**
-//      * Decode Opus frames to PCM samples
-//      * 
-//      * @param data            Pointer to encoded Opus data
-//      * @param data_len        Length of encoded data
-//      * @param pcm_out         Output buffer for PCM samples
-//      * @param pcm_capacity    Max samples to write
-//      * @return                Number of PCM samples decoded
-//      */
-//     size_t decode(const uint8_t* data,
-//                   size_t data_len,
-//                   int16_t* pcm_out,
-//                   size_t pcm_capacity) override;
-
-//     /**
-//      * Reset encoder/decoder state
-//      * Important for handling packet loss or stream restarts
-//      */
-//     void reset() override;
-
-//     uint32_t sampleRate() const override;
-//     uint8_t  channels() const override;
-
-// private:
-//     // ========================================================================
-//     // State
-//     // ========================================================================
-//     OpusEncoder* encoder_;
-//     OpusDecoder* decoder_;
-
-//     uint32_t sample_rate_;
-//     int bitrate_bps_;
-
-//     // Frame buffering for encode
-//     static constexpr int FRAME_SIZE = 320;  // 20ms @ 16kHz
-//     int16_t frame_buffer_[FRAME_SIZE];
-//     size_t frame_buffer_pos_;
-// };
+#pragma once
+
+#include "AudioCodec.hpp"
+#include <cstdint>
+
+// Opus chỉ được build khi có thư viện (component cung cấp "opus.h").
+// Không có → PTALK_HAS_OPUS = 0 và DeviceProfile dùng ADPCM.
+#if defined(__has_include)
+#if __has_include("opus.h")
+#define PTALK_HAS_OPUS 1
+#endif
+#endif
+#ifndef PTALK_HAS_OPUS
+#define PTALK_HAS_OPUS 0
+#endif
+
+#if PTALK_HAS_OPUS
+
+struct OpusEncoder;
+struct OpusDecoder;
+
+/**
+ * OpusCodec
+ * ============================================================================
+ * Opus compression codec for real-time audio streaming.
+ *
+ * - Input: 16-bit PCM mono audio
+ * - Output: Opus-encoded packets (variable-length)
+ * - Sample rate: 16 kHz (standard for voice)
+ * - Frame duration: 20 ms (320 samples per frame)
+ * - Bitrate: ~12-16 kbps (vs 64 kbps ADPCM)
+ *
+ * Pipeline contract (frame-aligned):
+ * - encode() takes exactly one frame (pcmFrameSamples()) → one packet
+ * - decode() takes exactly one packet → one frame
+ * - variableFrameSize() = true: AudioManager/NetworkManager prefix every
+ *   packet with [u16 LE len] in the rings and on the wire
+ *
+ * State:
+ * - OpusEncoder & OpusDecoder maintain internal state
+ * - resetEncoder() / resetDecoder() clear one side for a new session;
+ *   encoder and decoder may run on different tasks at the same time
+ *
+ * Loss:
+ * - conceal(): decoder PLC (opus_decode with no packet)
+ * - decodeFec(): frame before a packet rebuilt from its LBRR (in-band FEC)
+ * - Encoder emits in-band FEC too, for the server's decoder
+ */
+class OpusCodec : public AudioCodec {
+public:
+    // ========================================================================
+    // Constructor / Destructor
+    // ========================================================================
+    explicit OpusCodec(uint32_t sample_rate = 16000,
+                       int bitrate_bps = 16000,
+                       int complexity = 3);
+    ~OpusCodec() override;
+
+    // Disable copy/move (contains opaque pointers to opus state)
+    OpusCodec(const OpusCodec&) = delete;
+    OpusCodec& operator=(const OpusCodec&) = delete;
+
+    // true if encoder and decoder were created
+    bool valid() const { return encoder_ && decoder_; }
+
+    // ========================================================================
+    // AudioCodec Interface
+    // ========================================================================
+    size_t encode(const int16_t* pcm,
+                  size_t pcm_samples,
+                  uint8_t* out,
+                  size_t out_capacity) override;
+
+    size_t decode(const uint8_t* data,
+                  size_t data_len,
+                  int16_t* pcm_out,
+                  size_t pcm_capacity) override;
+
+    void resetEncoder() override;
+    void resetDecoder() override;
+
+    size_t conceal(int16_t* pcm_out, size_t pcm_capacity) override;
+    size_t decodeFec(const uint8_t* data, size_t data_len,
+                     int16_t* pcm_out, size_t pcm_capacity) override;
+
+    size_t pcmFrameSamples() const override { return frame_samples_; }
+    size_t encodedFrameBytes() const override;
+    size_t maxEncodedFrameBytes() const override { return MAX_PACKET_BYTES; }
+    bool variableFrameSize() const override { return true; }
+    // SILK/CELT analysis is stack hungry; synthesis (+ PLC / FEC) much less
+    uint32_t encoderStackBytes() const override { return 24 * 1024; }
+
+    // Nominal rate from the constructor; setBitrate() retunes the encoder only
+    uint32_t bitrate() const override { return static_cast<uint32_t>(bitrate_bps_); }
+    bool setBitrate(uint32_t bps) override;
+    uint32_t decoderStackBytes() const override { return 12 * 1024; }
+
+    uint32_t sampleRate() const override { return sample_rate_; }
+    uint8_t  channels() const override { return 1; }
+    const char* name() const override { return "opus"; }
+
+private:
+    // Cap per-packet size; at 16 kbps a 20 ms packet is ~40 bytes
+    static constexpr size_t MAX_PACKET_BYTES = 256;
+
+    OpusEncoder* encoder_ = nullptr;
+    OpusDecoder* decoder_ = nullptr;
+
+    uint32_t sample_rate_;
+    int bitrate_bps_;
+    size_t frame_samples_;
+};
+
+#endif // PTALK_HAS_OPUS
@@ -0,0 +1,181 @@
+#include "PacketLossConcealer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+bool PacketLossConcealer::init(uint32_t sample_rate)
+{
+    if (sample_rate == 0)
+        return false;
+    rate_ = sample_rate;
+    pitch_min_ = sample_rate / 400;       // 2.5 ms (400 Hz)
+    pitch_max_ = sample_rate * 15 / 1000; // 15 ms (~66 Hz)
+    corr_len_ = sample_rate / 100;        // 10 ms
+    merge_len_ = sample_rate / 250;       // 4 ms
+    hold_len_ = sample_rate / 100;        // 10 ms at full gain
+    fade_len_ = sample_rate / 20;         // silent 60 ms into the gap
+    // Window + longest lag; also covers the period before the last one
+    hist_len_ = pitch_max_ + corr_len_;
+
+    history_.reset(new (std::nothrow) int16_t[hist_len_]);
+    period_.reset(new (std::nothrow) int16_t[pitch_max_]);
+    merge_.reset(new (std::nothrow) int16_t[merge_len_]);
+    if (!history_ || !period_ || !merge_)
+    {
+        history_.reset();
+        period_.reset();
+        merge_.reset();
+        return false;
+    }
+    reset();
+    return true;
+}
+
+void PacketLossConcealer::reset()
+{
+    hist_fill_ = 0;
+    concealing_ = false;
+    pitch_ = 0;
+    pos_ = 0;
+    erased_ = 0;
+    offset_ = 0;
+}
+
+// ============================================================================
+// History
+// ============================================================================
+void PacketLossConcealer::appendHistory(const int16_t *pcm, size_t n)
+{
+    // Right-aligned: newest sample at history_[hist_len_ - 1]
+    if (n >= hist_len_)
+    {
+        memcpy(history_.get(), pcm + n - hist_len_, hist_len_ * sizeof(int16_t));
+        hist_fill_ = hist_len_;
+        return;
+    }
+    memmove(history_.get(), history_.get() + n, (hist_len_ - n) * sizeof(int16_t));
+    memcpy(history_.get() + hist_len_ - n, pcm, n * sizeof(int16_t));
+    hist_fill_ = std::min(hist_len_, hist_fill_ + n);
+}
+
+void PacketLossConcealer::onDecoded(int16_t *pcm, size_t n)
+{
+    if (!ready() || !pcm)
+        return;
+
+    if (concealing_)
+    {
+        // Fade from the continued repetition into the real signal
+        const size_t m = std::min(n, merge_len_);
+        synthesize(merge_.get(), m);
+        for (size_t i = 0; i < m; i++)
+        {
+            const int32_t w = static_cast<int32_t>((i + 1) * 32768 / (m + 1));
+            pcm[i] = static_cast<int16_t>((merge_[i] * (32768 - w) + pcm[i] * w) >> 15);
+        }
+        concealing_ = false;
+    }
+    appendHistory(pcm, n);
+}
+
+// ============================================================================
+// Concealment
+// ============================================================================
+void PacketLossConcealer::findPitch()
+{
+    pitch_ = 0;
+    if (hist_fill_ < hist_len_)
+        return; // stream just started: conceal with silence
+
+    const int16_t *x = history_.get();
+    const size_t N = hist_len_;
+    const int16_t *win = x + N - corr_len_;
+
+    // Lag with the best normalized correlation c·|c| / e against the last 10 ms
+    size_t best = pitch_max_;
+    float best_score = 0.f;
+    for (size_t lag = pitch_min_; lag <= pitch_max_; lag++)
+    {
+        const int16_t *ref = win - lag;
+        int64_t c = 0, e = 0;
+        for (size_t i = 0; i < corr_len_; i++)
+        {
+            c += static_cast<int32_t>(win[i]) * ref[i];
+            e += static_cast<int32_t>(ref[i]) * ref[i];
+        }
+        if (c <= 0 || e == 0)
+            continue;
+        const float cf = static_cast<float>(c);
+        const float score = cf * cf / static_cast<float>(e);
+        if (score > best_score)
+        {
+            best_score = score;
+            best = lag;
+        }
+    }
+    pitch_ = best;
+
+    // Last period; its tail overlap-added with the period before so the
+    // wrap period_[L-1] → period_[0] continues like the signal did
+    const size_t L = pitch_;
+    const size_t ola = L / 4;
+    for (size_t i = 0; i < L; i++)
+        period_[i] = x[N - L + i];
+    for (size_t k = 0; k < ola; k++)
+    {
+        const size_t i = L - ola + k;
+        const int32_t w = static_cast<int32_t>((k + 1) * 32768 / (ola + 1));
+        period_[i] = static_cast<int16_t>((x[N - L + i] * (32768 - w) + x[N - 2 * L + i] * w) >> 15);
+    }
+
+    // Seam with the last played sample: keep its level, decay over a period
+    offset_ = static_cast<int32_t>(x[N - 1]) - x[N - L - 1];
+}
+
+void PacketLossConcealer::synthesize(int16_t *out, size_t n)
+{
+    if (pitch_ == 0)
+    {
+        memset(out, 0, n * sizeof(int16_t));
+        erased_ += n;
+        return;
+    }
+
+    const size_t L = pitch_;
+    for (size_t j = 0; j < n; j++, erased_++)
+    {
+        int32_t gain = 32768;
+        if (erased_ >= hold_len_ + fade_len_)
+            gain = 0;
+        else if (erased_ > hold_len_)
+            gain = static_cast<int32_t>((hold_len_ + fade_len_ - erased_) * 32768 / fade_len_);
+
+        int32_t v = period_[pos_];
+        if (erased_ < L)
+            v += offset_ * static_cast<int32_t>(L - erased_) / static_cast<int32_t>(L);
+        v = (v * gain) >> 15;
+        out[j] = static_cast<int16_t>(std::clamp<int32_t>(v, -32768, 32767));
+
+        if (++pos_ == L)
+            pos_ = 0;
+    }
+}
+
+size_t PacketLossConcealer::conceal(int16_t *out, size_t n)
+{
+    if (!ready() || !out)
+        return 0;
+    if (!concealing_)
+    {
+        findPitch();
+        pos_ = 0;
+        erased_ = 0;
+        concealing_ = true;
+    }
+    synthesize(out, n);
+    // Concealed audio is what was played: a second loss right after repeats it
+    appendHistory(out, n);
+    concealed_total_ += static_cast<uint32_t>(n);
+    return n;
+}
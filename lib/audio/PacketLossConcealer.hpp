@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * PacketLossConcealer
+ * ============================================================================
+ * Che frame downlink bị mất bằng lặp dạng sóng theo chu kỳ pitch (kiểu
+ * G.711 Appendix I), cho codec không có PLC riêng (ADPCM).
+ *
+ *  - onDecoded(): mỗi frame giải mã được ghi vào history (~25 ms). Frame
+ *    đầu sau một đoạn che được cross-fade (~4 ms) từ tín hiệu che sang tín
+ *    hiệu thật → không click khi gói về lại.
+ *  - conceal(): frame che đầu tiên tìm pitch (2.5–15 ms) bằng tương quan
+ *    chuẩn hóa trên 10 ms cuối, rồi lặp chu kỳ cuối của history. Đuôi chu
+ *    kỳ được overlap-add với chu kỳ trước đó nên chỗ nối lặp liền mạch; chỗ
+ *    nối với mẫu thật cuối cùng được bù offset giảm dần.
+ *  - Giữ nguyên biên độ 10 ms đầu, rồi giảm tuyến tính về 0 ở 60 ms: mất
+ *    ngắn nghe liền, mất dài thành im lặng thay vì tiếng "buzz".
+ *
+ * Chỉ dùng trong một task (decoder task); không cấp phát sau init().
+ */
+class PacketLossConcealer
+{
+public:
+    PacketLossConcealer() = default;
+
+    // Buffers for `sample_rate`; false on allocation failure.
+    bool init(uint32_t sample_rate);
+    bool ready() const { return history_ != nullptr; }
+
+    // New stream: forget history (next loss conceals with silence).
+    void reset();
+
+    // A decoded frame about to be played; cross-faded in place after a loss.
+    void onDecoded(int16_t *pcm, size_t n);
+
+    // Fill `n` samples for missing audio; returns n (0 if not ready).
+    size_t conceal(int16_t *out, size_t n);
+
+    bool concealing() const { return concealing_; }
+    uint32_t concealedSamples() const { return concealed_total_; }
+
+private:
+    void findPitch();
+    // Next n repeated samples (gain applied), advancing the repetition.
+    void synthesize(int16_t *out, size_t n);
+    void appendHistory(const int16_t *pcm, size_t n);
+
+    uint32_t rate_ = 0;
+    size_t hist_len_ = 0;  // samples kept
+    size_t pitch_min_ = 0; // lags searched
+    size_t pitch_max_ = 0;
+    size_t corr_len_ = 0;  // correlation window
+    size_t merge_len_ = 0; // cross-fade on recovery
+    size_t hold_len_ = 0;  // full gain before the fade
+    size_t fade_len_ = 0;  // fade to silence
+
+    std::unique_ptr<int16_t[]> history_; // newest sample last
+    size_t hist_fill_ = 0;
+    std::unique_ptr<int16_t[]> period_;  // one pitch period, seam-smoothed
+    std::unique_ptr<int16_t[]> merge_;   // concealment tail for the cross-fade
+
+    bool concealing_ = false;
+    size_t pitch_ = 0;     // current period (samples)
+    size_t pos_ = 0;       // read position in period_
+    size_t erased_ = 0;    // samples concealed in this gap
+    int32_t offset_ = 0;   // seam correction, decays over the first period
+    uint32_t concealed_total_ = 0;
+};
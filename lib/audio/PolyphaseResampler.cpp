@@ -0,0 +1,150 @@
+#include "PolyphaseResampler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+
+#include "esp_log.h"
+
+static const char *TAG = "Resampler";
+
+// ============================================================================
+// Init / Deinit
+// ============================================================================
+bool PolyphaseResampler::init(uint32_t in_rate, uint32_t out_rate, size_t max_in)
+{
+    deinit();
+    if (in_rate == 0 || out_rate == 0 || max_in == 0)
+        return false;
+
+    coef_.reset(new (std::nothrow) int16_t[(PHASES + 1) * TAPS]);
+    buf_cap_ = max_in + TAPS;
+    buf_.reset(new (std::nothrow) int16_t[buf_cap_]);
+    if (!coef_ || !buf_)
+    {
+        ESP_LOGE(TAG, "Out of memory");
+        deinit();
+        return false;
+    }
+
+    in_rate_ = in_rate;
+    out_rate_ = out_rate;
+
+    // Input samples advanced per output sample, integer + Q32 fraction
+    uint64_t step = (static_cast<uint64_t>(in_rate) << 32) / out_rate;
+    step_int_ = static_cast<uint32_t>(step >> 32);
+    step_frac_ = static_cast<uint32_t>(step);
+
+    // Blackman-windowed sinc, cutoff in cycles per input sample
+    const float pi = 3.14159265f;
+    const float fc = 0.45f * std::min(in_rate, out_rate) / in_rate;
+    float row[TAPS];
+    for (size_t p = 0; p <= PHASES; p++)
+    {
+        float sum = 0.0f;
+        for (size_t j = 0; j < TAPS; j++)
+        {
+            // Distance from the output instant to tap j's sample
+            float d = static_cast<float>(HALF - 1) - j + static_cast<float>(p) / PHASES;
+            float x = 2.0f * fc * d;
+            float sinc = fabsf(x) < 1e-6f ? 1.0f : sinf(pi * x) / (pi * x);
+            float w = 0.42f + 0.5f * cosf(pi * d / HALF) + 0.08f * cosf(2.0f * pi * d / HALF);
+            row[j] = 2.0f * fc * sinc * w;
+            sum += row[j];
+        }
+        for (size_t j = 0; j < TAPS; j++)
+        {
+            long q = lrintf(row[j] / sum * 16384.0f);
+            coef_[p * TAPS + j] = static_cast<int16_t>(std::clamp<long>(q, -32768, 32767));
+        }
+    }
+
+    reset();
+    ESP_LOGI(TAG, "%u Hz -> %u Hz, %u phases x %u taps",
+             (unsigned)in_rate_, (unsigned)out_rate_, (unsigned)PHASES, (unsigned)TAPS);
+    return true;
+}
+
+void PolyphaseResampler::deinit()
+{
+    coef_.reset();
+    buf_.reset();
+    buf_cap_ = 0;
+    buf_len_ = 0;
+    in_rate_ = 0;
+    out_rate_ = 0;
+}
+
+void PolyphaseResampler::reset()
+{
+    if (!buf_)
+        return;
+    // HALF - 1 zeros ahead of the first sample so its window is complete
+    memset(buf_.get(), 0, (HALF - 1) * sizeof(int16_t));
+    buf_len_ = HALF - 1;
+    pos_ = HALF - 1;
+    frac_ = 0;
+}
+
+size_t PolyphaseResampler::maxOutput(size_t in) const
+{
+    if (in_rate_ == 0)
+        return 0;
+    // Up to HALF samples of look-ahead from the previous call become usable
+    return static_cast<size_t>(((static_cast<uint64_t>(in) + HALF) * out_rate_ + in_rate_ - 1) / in_rate_) + 1;
+}
+
+// ============================================================================
+// Process
+// ============================================================================
+int32_t PolyphaseResampler::dot(const int16_t *x, const int16_t *c) const
+{
+    // Q14 taps, per-phase sum 1.0 → |acc| stays well inside int32
+    int32_t acc = 0;
+    for (size_t j = 0; j < TAPS; j++)
+        acc += static_cast<int32_t>(x[j]) * c[j];
+    return acc;
+}
+
+size_t PolyphaseResampler::process(const int16_t *in, size_t in_samples, int16_t *out)
+{
+    if (!coef_ || !in)
+        return 0;
+
+    size_t produced = 0;
+    while (in_samples > 0)
+    {
+        size_t take = std::min(in_samples, buf_cap_ - buf_len_);
+        memcpy(&buf_[buf_len_], in, take * sizeof(int16_t));
+        buf_len_ += take;
+        in += take;
+        in_samples -= take;
+
+        // Every output whose window [pos - HALF + 1, pos + HALF] is buffered
+        while (pos_ + HALF < buf_len_)
+        {
+            const int16_t *x = &buf_[pos_ - (HALF - 1)];
+            const size_t p = frac_ >> 26;           // 6-bit phase
+            const int32_t sub = (frac_ >> 12) & 0x3FFF; // Q14 between phases
+            int32_t s0 = (dot(x, &coef_[p * TAPS]) + (1 << 13)) >> 14;
+            int32_t s1 = (dot(x, &coef_[(p + 1) * TAPS]) + (1 << 13)) >> 14;
+            int32_t s = s0 + (((s1 - s0) * sub) >> 14);
+            out[produced++] = static_cast<int16_t>(std::clamp<int32_t>(s, -32768, 32767));
+
+            uint64_t f = static_cast<uint64_t>(frac_) + step_frac_;
+            pos_ += step_int_ + static_cast<size_t>(f >> 32);
+            frac_ = static_cast<uint32_t>(f);
+        }
+
+        // Keep only the history the next window needs
+        size_t drop = std::min(pos_ - (HALF - 1), buf_len_);
+        if (drop > 0)
+        {
+            memmove(&buf_[0], &buf_[drop], (buf_len_ - drop) * sizeof(int16_t));
+            buf_len_ -= drop;
+            pos_ -= drop;
+        }
+    }
+    return produced;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * PolyphaseResampler
+ * ============================================================================
+ * Đổi sample rate PCM int16 mono theo tỉ lệ bất kỳ (vd 24k → 16k, 16k → 22.05k)
+ * cho downlink: decoder ra rate của server, I2S chạy rate của loa.
+ *
+ * - Windowed-sinc (Blackman) chia PHASES pha, TAPS tap mỗi pha, hệ số Q14
+ * - Vị trí đầu ra là số fixed-point (phần nguyên + phân số 32 bit); hai pha
+ *   kề nhau được nội suy tuyến tính nên tỉ lệ không cần chia hết PHASES
+ * - Cutoff = 0.45 * min(in, out) → khi downsample, filter cũng là anti-alias
+ * - Mỗi pha chuẩn hóa tổng = 1.0 (không gợn DC giữa các pha)
+ *
+ * Streaming: process() giữ lại đủ lịch sử giữa các lần gọi, trễ TAPS/2 mẫu vào.
+ * Không thread-safe: chỉ decoder task gọi.
+ */
+class PolyphaseResampler
+{
+public:
+    static constexpr size_t PHASES = 64;
+    static constexpr size_t TAPS = 16;
+
+    PolyphaseResampler() = default;
+    ~PolyphaseResampler() = default;
+
+    PolyphaseResampler(const PolyphaseResampler &) = delete;
+    PolyphaseResampler &operator=(const PolyphaseResampler &) = delete;
+
+    // Build the filter for in_rate → out_rate. max_in bounds one process()
+    // call. False on OOM / zero rate.
+    bool init(uint32_t in_rate, uint32_t out_rate, size_t max_in);
+    void deinit();
+    bool ready() const { return coef_ != nullptr; }
+
+    // Drop history (new stream).
+    void reset();
+
+    // Upper bound of samples produced by one process() of `in` samples.
+    size_t maxOutput(size_t in) const;
+
+    // Resample `in` samples into `out`; returns samples written. `out` must
+    // hold maxOutput(in) samples.
+    size_t process(const int16_t *in, size_t in_samples, int16_t *out);
+
+    uint32_t inRate() const { return in_rate_; }
+    uint32_t outRate() const { return out_rate_; }
+
+private:
+    static constexpr size_t HALF = TAPS / 2;
+
+    int32_t dot(const int16_t *x, const int16_t *c) const;
+
+private:
+    uint32_t in_rate_ = 0;
+    uint32_t out_rate_ = 0;
+
+    // (PHASES + 1) x TAPS, row p = kernel offset p / PHASES
+    std::unique_ptr<int16_t[]> coef_;
+
+    // History (TAPS - 1) + one call of input
+    std::unique_ptr<int16_t[]> buf_;
+    size_t buf_cap_ = 0;
+    size_t buf_len_ = 0;
+
+    // Next output position in buf_ (integer sample + Q32 fraction)
+    size_t pos_ = 0;
+    uint32_t frac_ = 0;
+    uint32_t step_int_ = 1;
+    uint32_t step_frac_ = 0;
+};
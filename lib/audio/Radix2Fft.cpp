@@ -0,0 +1,79 @@
+#include "Radix2Fft.hpp"
+
+#include <cmath>
+#include <memory>
+#include <new>
+#include <utility>
+
+// cos[SIZE / 2] then -sin[SIZE / 2]
+static std::unique_ptr<float[]> s_twiddle;
+static uint32_t s_users = 0;
+
+bool Radix2Fft::init()
+{
+    if (held_)
+        return true;
+    if (!s_twiddle)
+    {
+        s_twiddle.reset(new (std::nothrow) float[SIZE]);
+        if (!s_twiddle)
+            return false;
+        const float pi = 3.14159265f;
+        for (size_t i = 0; i < SIZE / 2; i++)
+        {
+            s_twiddle[i] = cosf(2.0f * pi * i / SIZE);
+            s_twiddle[SIZE / 2 + i] = -sinf(2.0f * pi * i / SIZE);
+        }
+    }
+    s_users++;
+    held_ = true;
+    return true;
+}
+
+void Radix2Fft::release()
+{
+    if (!held_)
+        return;
+    held_ = false;
+    if (--s_users == 0)
+        s_twiddle.reset();
+}
+
+void Radix2Fft::transform(float *re, float *im) const
+{
+    const float *cos_t = s_twiddle.get();
+    const float *sin_t = cos_t + SIZE / 2;
+
+    for (size_t i = 1, j = 0; i < SIZE; i++)
+    {
+        size_t bit = SIZE >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+        {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+
+    for (size_t len = 2; len <= SIZE; len <<= 1)
+    {
+        size_t step = SIZE / len;
+        size_t half = len >> 1;
+        for (size_t i = 0; i < SIZE; i += len)
+        {
+            for (size_t j = 0; j < half; j++)
+            {
+                float wr = cos_t[j * step], wi = sin_t[j * step];
+                size_t a = i + j, b = a + half;
+                float tr = re[b] * wr - im[b] * wi;
+                float ti = re[b] * wi + im[b] * wr;
+                re[b] = re[a] - tr;
+                im[b] = im[a] - ti;
+                re[a] += tr;
+                im[a] += ti;
+            }
+        }
+    }
+}
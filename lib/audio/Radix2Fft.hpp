@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Radix2Fft
+ * ============================================================================
+ * FFT radix-2 tại chỗ (iterative, 256 điểm) dùng chung cho KeywordSpotter
+ * (MFCC) và VoiceFrontEnd (noise suppression).
+ *
+ * Bảng twiddle (cos / -sin, SIZE / 2 cặp, 1 KB) là một bản cho mọi
+ * instance: instance đầu tiên init() cấp phát, instance cuối release() trả
+ * lại. Sau khi dựng bảng chỉ đọc, nên transform() từ nhiều task song song
+ * không cần khoá; init() / release() gọi từ một task (audio init).
+ */
+class Radix2Fft
+{
+public:
+    static constexpr size_t SIZE = 256;
+
+    Radix2Fft() = default;
+    ~Radix2Fft() { release(); }
+    Radix2Fft(const Radix2Fft &) = delete;
+    Radix2Fft &operator=(const Radix2Fft &) = delete;
+
+    // Takes a reference on the shared table (built by the first user);
+    // false = out of memory
+    bool init();
+    void release();
+    bool ready() const { return held_; }
+
+    // In place on re[SIZE] / im[SIZE]
+    void transform(float *re, float *im) const;
+
+private:
+    bool held_ = false;
+};
@@ -0,0 +1,276 @@
+#include "SpscRing.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+#include "esp_log.h"
+
+static const char *TAG = "SpscRing";
+
+// ============================================================================
+// Wait helpers
+// ============================================================================
+namespace
+{
+    // Wake the task parked in `slot` (if any).
+    inline void wakeSlot(std::atomic<TaskHandle_t> &slot)
+    {
+        TaskHandle_t t = slot.exchange(nullptr, std::memory_order_acq_rel);
+        if (t)
+            xTaskNotifyGive(t);
+    }
+
+    // Park the calling task in `slot` until ready(), the deadline or an
+    // interrupt. The condition is re-checked after publishing the handle so
+    // a notify sent between the first check and the park is never lost.
+    template <typename Ready>
+    bool waitUntil(std::atomic<TaskHandle_t> &slot, Ready ready, TickType_t wait,
+                   std::atomic<bool> *interrupt = nullptr)
+    {
+        if (ready())
+            return true;
+        if (wait == 0)
+            return false;
+
+        const TickType_t start = xTaskGetTickCount();
+        while (true)
+        {
+            slot.store(xTaskGetCurrentTaskHandle(), std::memory_order_release);
+            if (ready())
+            {
+                slot.store(nullptr, std::memory_order_release);
+                return true;
+            }
+            if (interrupt && interrupt->exchange(false, std::memory_order_acq_rel))
+            {
+                slot.store(nullptr, std::memory_order_release);
+                return false;
+            }
+
+            TickType_t remaining = portMAX_DELAY;
+            if (wait != portMAX_DELAY)
+            {
+                TickType_t elapsed = xTaskGetTickCount() - start;
+                if (elapsed >= wait)
+                {
+                    slot.store(nullptr, std::memory_order_release);
+                    return ready();
+                }
+                remaining = wait - elapsed;
+            }
+            ulTaskNotifyTake(pdTRUE, remaining);
+        }
+    }
+}
+
+// ============================================================================
+// Storage
+// ============================================================================
+SpscRing::~SpscRing()
+{
+    deallocate();
+}
+
+static size_t roundPow2(size_t n)
+{
+    size_t cap = 1;
+    while (cap < n)
+        cap <<= 1;
+    return cap;
+}
+
+size_t SpscRing::storageBytes(size_t capacity, size_t max_chunk)
+{
+    return roundPow2(capacity) + max_chunk;
+}
+
+bool SpscRing::allocate(size_t capacity, size_t max_chunk)
+{
+    return allocate(capacity, max_chunk, nullptr);
+}
+
+bool SpscRing::allocate(size_t capacity, size_t max_chunk, uint8_t *storage)
+{
+    if (buf_)
+        return true;
+    if (capacity == 0 || max_chunk == 0 || max_chunk > capacity)
+    {
+        ESP_LOGE(TAG, "Invalid ring size %zu / chunk %zu", capacity, max_chunk);
+        return false;
+    }
+
+    const size_t cap = roundPow2(capacity);
+
+    buf_ = storage ? storage : static_cast<uint8_t *>(malloc(cap + max_chunk));
+    if (!buf_)
+    {
+        ESP_LOGE(TAG, "OOM allocating %zu bytes", cap + max_chunk);
+        return false;
+    }
+    owns_buf_ = (storage == nullptr);
+
+    cap_ = cap;
+    mask_ = cap - 1;
+    slack_ = max_chunk;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    peak_.store(0, std::memory_order_relaxed);
+    discard_pending_.store(false, std::memory_order_relaxed);
+    write_len_ = 0;
+    return true;
+}
+
+void SpscRing::deallocate()
+{
+    if (!buf_)
+        return;
+    if (owns_buf_)
+        ::free(buf_);
+    buf_ = nullptr;
+    owns_buf_ = false;
+    cap_ = mask_ = slack_ = 0;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    discard_pending_.store(false, std::memory_order_relaxed);
+    reader_waiting_.store(nullptr, std::memory_order_relaxed);
+    writer_waiting_.store(nullptr, std::memory_order_relaxed);
+    reader_interrupt_.store(false, std::memory_order_relaxed);
+}
+
+size_t SpscRing::available() const
+{
+    return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+}
+
+size_t SpscRing::freeSpace() const
+{
+    return cap_ - available();
+}
+
+// ============================================================================
+// Producer
+// ============================================================================
+bool SpscRing::waitWritable(size_t n, TickType_t wait)
+{
+    return waitUntil(writer_waiting_, [this, n]()
+                     { return freeSpace() >= n; }, wait);
+}
+
+uint8_t *SpscRing::acquireWrite(size_t n, TickType_t wait)
+{
+    if (!buf_ || n == 0 || n > slack_)
+        return nullptr;
+    if (!waitWritable(n, wait))
+        return nullptr;
+
+    write_pos_ = head_.load(std::memory_order_relaxed);
+    write_len_ = n;
+    // May run into the slack area; commitWrite() folds that part back.
+    return buf_ + (write_pos_ & mask_);
+}
+
+void SpscRing::commitWrite(size_t n)
+{
+    if (!buf_ || n == 0)
+    {
+        write_len_ = 0;
+        return;
+    }
+    if (n > write_len_)
+        n = write_len_;
+
+    size_t pos = write_pos_ & mask_;
+    if (pos + n > cap_)
+        memcpy(buf_, buf_ + cap_, pos + n - cap_);
+
+    head_.store(write_pos_ + n, std::memory_order_release);
+    write_len_ = 0;
+    notePeak(write_pos_ + n);
+    wakeSlot(reader_waiting_);
+}
+
+size_t SpscRing::write(const void *src, size_t n, TickType_t wait)
+{
+    if (!buf_ || !src || n == 0 || n > cap_)
+        return 0;
+    if (!waitWritable(n, wait))
+        return 0;
+
+    uint32_t h = head_.load(std::memory_order_relaxed);
+    size_t pos = h & mask_;
+    size_t first = (pos + n > cap_) ? cap_ - pos : n;
+    memcpy(buf_ + pos, src, first);
+    if (first < n)
+        memcpy(buf_, static_cast<const uint8_t *>(src) + first, n - first);
+
+    head_.store(h + n, std::memory_order_release);
+    notePeak(h + n);
+    wakeSlot(reader_waiting_);
+    return n;
+}
+
+// ============================================================================
+// Consumer
+// ============================================================================
+void SpscRing::applyDiscard()
+{
+    if (!discard_pending_.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    uint32_t target = discard_to_.load(std::memory_order_acquire);
+    uint32_t t = tail_.load(std::memory_order_relaxed);
+    if (static_cast<int32_t>(target - t) > 0)
+    {
+        tail_.store(target, std::memory_order_release);
+        wakeSlot(writer_waiting_);
+    }
+}
+
+bool SpscRing::waitReadable(size_t n, TickType_t wait)
+{
+    return waitUntil(reader_waiting_, [this, n]()
+                     {
+                         applyDiscard();
+                         return available() >= n; }, wait, &reader_interrupt_);
+}
+
+void SpscRing::interruptReader()
+{
+    reader_interrupt_.store(true, std::memory_order_release);
+    wakeSlot(reader_waiting_);
+}
+
+const uint8_t *SpscRing::acquireRead(size_t n, TickType_t wait)
+{
+    if (!buf_ || n == 0 || n > slack_)
+        return nullptr;
+    if (!waitReadable(n, wait))
+        return nullptr;
+
+    size_t pos = tail_.load(std::memory_order_relaxed) & mask_;
+    // Mirror the wrapped head of the data into the slack so the view is contiguous.
+    if (pos + n > cap_)
+        memcpy(buf_ + cap_, buf_, pos + n - cap_);
+    return buf_ + pos;
+}
+
+void SpscRing::release(size_t n)
+{
+    if (!buf_ || n == 0)
+        return;
+    size_t avail = available();
+    if (n > avail)
+        n = avail;
+    tail_.store(tail_.load(std::memory_order_relaxed) + n, std::memory_order_release);
+    wakeSlot(writer_waiting_);
+}
+
+void SpscRing::reset()
+{
+    if (!buf_)
+        return;
+    discard_to_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+    discard_pending_.store(true, std::memory_order_release);
+    // Let a parked consumer service the request now (frees space for the producer).
+    wakeSlot(reader_waiting_);
+}
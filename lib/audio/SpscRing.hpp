@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/**
+ * SpscRing
+ * ============================================================================
+ * Ring buffer lock-free cho đúng 1 producer task + 1 consumer task.
+ *
+ * Khác với StreamBuffer (copy vào, copy ra), producer/consumer làm việc
+ * trực tiếp trên vùng nhớ của ring:
+ *
+ *   uint8_t* w = ring.acquireWrite(n, wait);   // n byte liên tục
+ *   ... ghi tối đa n byte vào w ...
+ *   ring.commitWrite(used);
+ *
+ *   const uint8_t* r = ring.acquireRead(n, wait);  // n byte liên tục
+ *   ... đọc r ...
+ *   ring.release(n);
+ *
+ * - Capacity làm tròn lên lũy thừa 2; index là counter 32-bit tăng dần.
+ * - Phía sau buffer có thêm vùng "slack" = max_chunk byte, nên một lần
+ *   acquire luôn trả về vùng liên tục kể cả khi vắt qua cuối ring
+ *   (chỉ tốn memcpy phần vắt qua, không phải cả frame).
+ * - Block bằng task notification: bên còn lại notify khi commit/release,
+ *   không cần trigger level 1 byte.
+ * - reset() an toàn gọi từ task thứ ba: chỉ ghi nhận yêu cầu, consumer
+ *   bỏ đúng phần dữ liệu có tại thời điểm reset ở lần acquire kế tiếp.
+ *
+ * Lưu ý: task notification (index 0) được dùng chung, task chờ có thể bị
+ * đánh thức sớm bởi notify khác — vòng chờ luôn kiểm tra lại điều kiện.
+ */
+class SpscRing
+{
+public:
+    SpscRing() = default;
+    ~SpscRing();
+
+    SpscRing(const SpscRing &) = delete;
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    // Allocate storage; max_chunk = largest single acquireWrite/acquireRead.
+    // Returns false on OOM or invalid sizes. No-op if already allocated.
+    bool allocate(size_t capacity, size_t max_chunk);
+    // Same on caller-owned memory of storageBytes(capacity, max_chunk)
+    // bytes (e.g. a boot arena block); deallocate() then does not free it.
+    bool allocate(size_t capacity, size_t max_chunk, uint8_t *storage);
+    // Storage needed for a ring: capacity rounded up to a power of 2 + slack
+    static size_t storageBytes(size_t capacity, size_t max_chunk);
+
+    // Free storage (both sides must be idle).
+    void deallocate();
+
+    bool valid() const { return buf_ != nullptr; }
+    size_t capacity() const { return cap_; }
+    // Largest single acquire (max_chunk given to allocate()).
+    size_t maxChunk() const { return slack_; }
+
+    // ------------------------------------------------------------------------
+    // Producer side
+    // ------------------------------------------------------------------------
+    // Contiguous space for n bytes, waiting up to `wait` ticks; nullptr on timeout.
+    uint8_t *acquireWrite(size_t n, TickType_t wait);
+    // Publish `n` bytes (<= last acquired size) to the consumer.
+    void commitWrite(size_t n);
+    // Copy helper for producers that do not own the source memory
+    // (e.g. network callbacks). Returns bytes written (all or nothing).
+    size_t write(const void *src, size_t n, TickType_t wait);
+
+    // ------------------------------------------------------------------------
+    // Consumer side
+    // ------------------------------------------------------------------------
+    // Contiguous view of n bytes, waiting up to `wait` ticks; nullptr on timeout.
+    const uint8_t *acquireRead(size_t n, TickType_t wait);
+    // Drop `n` bytes (<= last acquired size) and wake a blocked producer.
+    void release(size_t n);
+    // Make a blocked acquireRead() return now (nullptr unless ready), e.g.
+    // on a state change the consumer must see; if nobody is waiting, the
+    // next blocking acquireRead() that would park returns early once.
+    void interruptReader();
+
+    // Bytes readable / writable right now (approximate from the other side).
+    size_t available() const;
+    size_t freeSpace() const;
+    bool empty() const { return available() == 0; }
+    // Highest fill level seen at a commit since allocate() / resetPeak()
+    // (sizing telemetry; exact, not sampled)
+    size_t peakFill() const { return peak_.load(std::memory_order_relaxed); }
+    void resetPeak() { peak_.store(0, std::memory_order_relaxed); }
+
+    // Stream positions: bytes ever committed / released (32-bit, wrapping).
+    // Exact on the owning side; a pending reset() moves the read position
+    // at the consumer's next acquireRead().
+    uint32_t writePosition() const { return head_.load(std::memory_order_acquire); }
+    uint32_t readPosition() const { return tail_.load(std::memory_order_acquire); }
+
+    // Discard everything committed so far (serviced by the consumer).
+    void reset();
+
+private:
+    // Block until `n` bytes are writable / readable; false on timeout.
+    bool waitWritable(size_t n, TickType_t wait);
+    bool waitReadable(size_t n, TickType_t wait);
+    // Consumer: apply a pending reset() request.
+    void applyDiscard();
+    // Producer: record the fill level after publishing up to `head`.
+    void notePeak(uint32_t head)
+    {
+        const uint32_t fill = head - tail_.load(std::memory_order_relaxed);
+        if (fill > peak_.load(std::memory_order_relaxed))
+            peak_.store(fill, std::memory_order_relaxed);
+    }
+
+private:
+    uint8_t *buf_ = nullptr;
+    size_t cap_ = 0;   // power of 2
+    size_t mask_ = 0;
+    size_t slack_ = 0; // bytes past the end for wrap-around views
+    bool owns_buf_ = false;
+
+    std::atomic<uint32_t> head_{0}; // written by producer
+    std::atomic<uint32_t> tail_{0}; // written by consumer
+
+    uint32_t write_pos_ = 0;     // producer: head at acquireWrite()
+    size_t write_len_ = 0;       // producer: size granted by acquireWrite()
+
+    std::atomic<uint32_t> peak_{0}; // producer: max fill at commit
+
+    std::atomic<uint32_t> discard_to_{0};
+    std::atomic<bool> discard_pending_{false};
+
+    std::atomic<TaskHandle_t> reader_waiting_{nullptr};
+    std::atomic<TaskHandle_t> writer_waiting_{nullptr};
+    std::atomic<bool> reader_interrupt_{false};
+};
@@ -0,0 +1,112 @@
+#include "VoiceActivityDetector.hpp"
+
+#include <algorithm>
+
+static uint16_t msToFrames(uint32_t ms, uint32_t frame_ms)
+{
+    if (frame_ms == 0)
+        frame_ms = 1;
+    uint32_t f = (ms + frame_ms - 1) / frame_ms;
+    return static_cast<uint16_t>(std::clamp<uint32_t>(f, 1, UINT16_MAX));
+}
+
+void VoiceActivityDetector::configure(const Config &cfg)
+{
+    cfg_ = cfg;
+    onset_frames_ = msToFrames(cfg_.onset_ms, cfg_.frame_ms);
+    hangover_frames_ = msToFrames(cfg_.hangover_ms, cfg_.frame_ms);
+    min_speech_frames_ = msToFrames(cfg_.min_speech_ms, cfg_.frame_ms);
+    floor_ = 0;
+    reset();
+}
+
+void VoiceActivityDetector::reset()
+{
+    in_speech_ = false;
+    speech_run_ = 0;
+    silence_run_ = 0;
+    speech_total_ = 0;
+}
+
+bool VoiceActivityDetector::isSpeechFrame(uint32_t amp, uint32_t zcr_permille) const
+{
+    uint32_t threshold = std::max<uint32_t>((floor_ * cfg_.ratio_q4) >> 4, cfg_.min_amplitude);
+    if (amp <= threshold)
+        return false;
+    // Broadband hiss crosses zero on almost every sample; only accept it when clearly loud
+    if (zcr_permille > cfg_.noisy_zcr_permille && amp < 2 * threshold)
+        return false;
+    return true;
+}
+
+void VoiceActivityDetector::updateFloor(uint32_t amp, bool speech_frame)
+{
+    if (floor_ == 0)
+    {
+        floor_ = std::max<uint32_t>(amp, cfg_.min_noise_floor);
+        return;
+    }
+
+    if (amp < floor_)
+        floor_ -= (floor_ - amp) >> 2; // fast down
+    else if (!speech_frame)
+        floor_ += (amp - floor_) >> 5; // follow background
+    else
+        floor_ += (amp - floor_) >> 10; // creep up under long speech / steady noise
+
+    floor_ = std::max<uint32_t>(floor_, cfg_.min_noise_floor);
+}
+
+VoiceActivityDetector::Result VoiceActivityDetector::process(const int16_t *pcm, size_t samples)
+{
+    if (!pcm || samples == 0)
+        return in_speech_ ? Result::SPEECH : Result::SILENCE;
+
+    // Mean |x| and zero crossings in one pass
+    uint32_t sum_abs = 0;
+    uint32_t crossings = 0;
+    int16_t prev = pcm[0];
+    for (size_t i = 0; i < samples; i++)
+    {
+        int32_t x = pcm[i];
+        sum_abs += static_cast<uint32_t>(x < 0 ? -x : x);
+        crossings += static_cast<uint32_t>((x ^ prev) < 0);
+        prev = static_cast<int16_t>(x);
+    }
+    uint32_t amp = sum_abs / samples;
+    uint32_t zcr_permille = crossings * 1000 / samples;
+    last_amp_ = amp;
+
+    if (floor_ == 0)
+        updateFloor(amp, false); // first frame seeds the floor
+
+    bool speech = isSpeechFrame(amp, zcr_permille);
+    updateFloor(amp, speech);
+
+    if (!in_speech_)
+    {
+        speech_run_ = speech ? speech_run_ + 1 : 0;
+        if (speech_run_ >= onset_frames_)
+        {
+            in_speech_ = true;
+            silence_run_ = 0;
+            speech_total_ = speech_run_;
+            return Result::SPEECH;
+        }
+        return Result::SILENCE;
+    }
+
+    if (speech)
+    {
+        silence_run_ = 0;
+        speech_total_++;
+        return Result::SPEECH;
+    }
+
+    if (++silence_run_ < hangover_frames_)
+        return Result::SPEECH; // hangover keeps word endings
+
+    bool long_enough = speech_total_ >= min_speech_frames_;
+    reset();
+    return long_enough ? Result::END_OF_SPEECH : Result::SILENCE;
+}
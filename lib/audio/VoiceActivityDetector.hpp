@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * VoiceActivityDetector
+ * ============================================================================
+ * VAD + endpointing cho mic path, chạy trên từng PCM frame (16/20 ms).
+ *
+ * - Đặc trưng: biên độ trung bình |x| (int32, không cần float) và
+ *   zero-crossing rate.
+ * - Noise floor tự thích nghi: giảm nhanh khi yên lặng, tăng rất chậm
+ *   khi đang nói (chịu được quạt/điều hòa chạy đều).
+ * - Frame là speech khi biên độ > floor * ratio và > min_amplitude;
+ *   frame có ZCR rất cao mà năng lượng chỉ vừa qua ngưỡng bị coi là nhiễu.
+ * - Máy trạng thái: onset_ms speech liên tục → SPEECH; sau đó
+ *   hangover_ms im lặng → END_OF_SPEECH (chỉ khi đã nói đủ min_speech_ms,
+ *   tiếng click ngắn không kết thúc lượt nói).
+ *
+ * Không giữ dữ liệu, không thread-safe: chỉ encoder task gọi process().
+ */
+class VoiceActivityDetector
+{
+public:
+    struct Config
+    {
+        uint32_t frame_ms = 16;
+        uint16_t onset_ms = 48;           // speech needed to enter SPEECH
+        uint16_t hangover_ms = 800;       // trailing silence that ends the utterance
+        uint16_t min_speech_ms = 240;     // shorter bursts never trigger END_OF_SPEECH
+        uint16_t ratio_q4 = 40;           // speech threshold = floor * 2.5 (Q4)
+        uint16_t min_amplitude = 120;     // absolute mean |x| threshold
+        uint16_t min_noise_floor = 20;
+        uint16_t noisy_zcr_permille = 450; // crossings/sample above this look like hiss
+    };
+
+    enum class Result : uint8_t
+    {
+        SILENCE,      // not part of an utterance (suppress on uplink)
+        SPEECH,       // inside an utterance, including hangover frames
+        END_OF_SPEECH // first frame after the hangover expired
+    };
+
+    VoiceActivityDetector() { configure(Config{}); }
+
+    void configure(const Config &cfg);
+
+    // Start a new turn (keeps the learned noise floor).
+    void reset();
+
+    // Classify one frame.
+    Result process(const int16_t *pcm, size_t samples);
+
+    bool inSpeech() const { return in_speech_; }
+    uint32_t lastAmplitude() const { return last_amp_; }
+    uint32_t noiseFloor() const { return floor_; }
+
+private:
+    bool isSpeechFrame(uint32_t amp, uint32_t zcr_permille) const;
+    void updateFloor(uint32_t amp, bool speech_frame);
+
+private:
+    Config cfg_{};
+
+    uint16_t onset_frames_ = 3;
+    uint16_t hangover_frames_ = 50;
+    uint16_t min_speech_frames_ = 15;
+
+    uint32_t floor_ = 0; // 0 = not initialised yet
+    uint32_t last_amp_ = 0;
+
+    bool in_speech_ = false;
+    uint16_t speech_run_ = 0;   // consecutive speech frames (onset)
+    uint16_t silence_run_ = 0;  // consecutive non-speech frames (hangover)
+    uint32_t speech_total_ = 0; // speech frames in the current utterance
+};
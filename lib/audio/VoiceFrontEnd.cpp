@@ -0,0 +1,306 @@
+#include "VoiceFrontEnd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "esp_log.h"
+
+static const char *TAG = "VoiceFrontEnd";
+
+namespace
+{
+    constexpr float NOISE_RISE_DB_PER_S = 5.0f; // noise floor can grow this fast
+    constexpr uint32_t WARMUP_MS = 200;          // noise PSD = plain average first
+    constexpr float NOISE_BIAS = 2.0f;           // minimum of a smoothed periodogram sits ~3 dB low
+    constexpr float PSD_SMOOTH = 0.3f;           // weight of the new hop in smooth_
+    constexpr float DD_ALPHA = 0.98f;            // decision-directed a priori SNR
+
+    constexpr int32_t Q12 = 4096;
+    constexpr uint64_t SPEECH_MIN_MS = 1000;     // mean square ~ -60 dBFS: below is never speech
+    constexpr uint64_t SPEECH_OVER_FLOOR = 8;    // 9 dB above the tracked floor
+
+    int32_t dbToQ12(float db) { return static_cast<int32_t>(Q12 * powf(10.0f, db / 20.0f) + 0.5f); }
+} // namespace
+
+// ============================================================================
+// Init / Deinit
+// ============================================================================
+bool VoiceFrontEnd::init(const Config &cfg)
+{
+    deinit();
+    if (cfg.sample_rate == 0 || cfg.max_block == 0)
+        return false;
+    cfg_ = cfg;
+
+    win_.reset(new (std::nothrow) float[FFT_SIZE]);
+    work_.reset(new (std::nothrow) float[2 * FFT_SIZE]);
+    ana_.reset(new (std::nothrow) float[FFT_SIZE]);
+    ola_.reset(new (std::nothrow) float[FFT_SIZE]);
+    smooth_.reset(new (std::nothrow) float[BINS]);
+    noise_.reset(new (std::nothrow) float[BINS]);
+    clean_.reset(new (std::nothrow) float[BINS]);
+    fifo_.reset(new (std::nothrow) int16_t[cfg_.max_block + 2 * HOP]);
+    out_.reset(new (std::nothrow) int16_t[cfg_.max_block]);
+    if (!fft_.init() || !win_ || !work_ || !ana_ || !ola_ || !smooth_ || !noise_ || !clean_ || !fifo_ || !out_)
+    {
+        ESP_LOGE(TAG, "Out of memory");
+        deinit();
+        return false;
+    }
+
+    // sqrt-Hann (periodic) on analysis and synthesis: squares sum to 1 at 50% overlap
+    const float pi = 3.14159265f;
+    for (size_t i = 0; i < FFT_SIZE; i++)
+        win_[i] = sqrtf(0.5f - 0.5f * cosf(2.0f * pi * i / FFT_SIZE));
+
+    const float hops_per_s = static_cast<float>(cfg_.sample_rate) / HOP;
+    rise_ = powf(10.0f, NOISE_RISE_DB_PER_S / 10.0f / hops_per_s);
+    warmup_hops_ = static_cast<uint32_t>(hops_per_s * WARMUP_MS / 1000.0f);
+    gain_floor_ = powf(10.0f, -static_cast<float>(cfg_.ns_max_atten_db) / 20.0f);
+
+    gain_min_q12_ = dbToQ12(-static_cast<float>(cfg_.agc_max_cut_db));
+    gain_max_q12_ = dbToQ12(cfg_.agc_max_gain_db);
+    target_rms_ = static_cast<int32_t>(32768.0f * powf(10.0f, cfg_.agc_target_dbfs / 20.0f));
+
+    reset();
+    ESP_LOGI(TAG, "NS %u-pt STFT hop %u (-%u dB floor), AGC %d dBFS [-%u, +%u dB]",
+             (unsigned)FFT_SIZE, (unsigned)HOP, (unsigned)cfg_.ns_max_atten_db,
+             (int)cfg_.agc_target_dbfs, (unsigned)cfg_.agc_max_cut_db, (unsigned)cfg_.agc_max_gain_db);
+    return true;
+}
+
+void VoiceFrontEnd::deinit()
+{
+    win_.reset();
+    fft_.release();
+    work_.reset();
+    ana_.reset();
+    ola_.reset();
+    smooth_.reset();
+    noise_.reset();
+    clean_.reset();
+    fifo_.reset();
+    out_.reset();
+}
+
+void VoiceFrontEnd::reset()
+{
+    if (!ready())
+        return;
+    resetStft();
+    memset(smooth_.get(), 0, BINS * sizeof(float));
+    memset(noise_.get(), 0, BINS * sizeof(float));
+    memset(clean_.get(), 0, BINS * sizeof(float));
+    hops_ = 0;
+    gain_q12_ = Q12;
+    level_ = 0;
+    floor_energy_ = 0;
+    speech_ = false;
+}
+
+void VoiceFrontEnd::resetStft()
+{
+    memset(ana_.get(), 0, FFT_SIZE * sizeof(float));
+    memset(ola_.get(), 0, FFT_SIZE * sizeof(float));
+    fill_ = 0;
+    fifo_len_ = 0;
+}
+
+float VoiceFrontEnd::gainDb() const
+{
+    return 20.0f * log10f(static_cast<float>(gain_q12_) / Q12);
+}
+
+// ============================================================================
+// Process
+// ============================================================================
+const int16_t *VoiceFrontEnd::process(const int16_t *in, size_t n)
+{
+    if (!ready() || !in || n == 0 || n > cfg_.max_block)
+        return in;
+
+    const bool ns = nsEnabled();
+    const bool agc = agcEnabled();
+    if (ns != ns_active_)
+    {
+        resetStft();
+        ns_active_ = ns;
+    }
+    if (!ns && !agc)
+        return in;
+
+    if (ns)
+        suppress(in, n);
+    else
+        memcpy(out_.get(), in, n * sizeof(int16_t));
+    if (agc)
+        autoGain(n);
+    return out_.get();
+}
+
+// ----------------------------------------------------------------------------
+// Noise suppression
+// ----------------------------------------------------------------------------
+void VoiceFrontEnd::suppress(const int16_t *in, size_t n)
+{
+    for (size_t k = 0; k < n;)
+    {
+        const size_t take = std::min(n - k, HOP - fill_);
+        float *dst = &ana_[FFT_SIZE - HOP + fill_];
+        for (size_t i = 0; i < take; i++)
+            dst[i] = in[k + i] * (1.0f / 32768.0f);
+        fill_ += take;
+        k += take;
+        if (fill_ == HOP)
+        {
+            fill_ = 0;
+            suppressHop();
+        }
+    }
+
+    // Blocks that are not a multiple of the hop: pad once at the start, the
+    // FIFO then keeps that lead
+    if (fifo_len_ < n)
+    {
+        const size_t pad = n - fifo_len_;
+        memmove(&fifo_[pad], fifo_.get(), fifo_len_ * sizeof(int16_t));
+        memset(fifo_.get(), 0, pad * sizeof(int16_t));
+        fifo_len_ = n;
+    }
+    memcpy(out_.get(), fifo_.get(), n * sizeof(int16_t));
+    fifo_len_ -= n;
+    memmove(fifo_.get(), &fifo_[n], fifo_len_ * sizeof(int16_t));
+}
+
+void VoiceFrontEnd::suppressHop()
+{
+    float *re = &work_[0];
+    float *im = &work_[FFT_SIZE];
+    for (size_t i = 0; i < FFT_SIZE; i++)
+    {
+        re[i] = ana_[i] * win_[i];
+        im[i] = 0.0f;
+    }
+    memmove(ana_.get(), &ana_[HOP], (FFT_SIZE - HOP) * sizeof(float));
+    fft_.transform(re, im);
+
+    const bool warming = hops_ < warmup_hops_;
+    for (size_t k = 0; k < BINS; k++)
+    {
+        const float p = re[k] * re[k] + im[k] * im[k];
+        float &s = smooth_[k];
+        float &nz = noise_[k];
+        s = hops_ == 0 ? p : s + PSD_SMOOTH * (p - s);
+        if (warming)
+            nz += (s - nz) / static_cast<float>(hops_ + 1); // plain average
+        else
+            nz = std::min(nz * rise_, s); // minimum tracking, slow rise
+
+        // Wiener gain from the decision-directed a priori SNR
+        const float noise = nz * NOISE_BIAS + 1e-12f;
+        const float post = p / noise;
+        const float prio = DD_ALPHA * clean_[k] / noise + (1.0f - DD_ALPHA) * std::max(post - 1.0f, 0.0f);
+        const float g = std::max(prio / (1.0f + prio), gain_floor_);
+        clean_[k] = g * g * p;
+
+        re[k] *= g;
+        im[k] *= g;
+        if (k > 0 && k < FFT_SIZE / 2)
+        {
+            re[FFT_SIZE - k] *= g;
+            im[FFT_SIZE - k] *= g;
+        }
+    }
+    hops_++;
+
+    // Inverse FFT (conjugate trick), synthesis window, overlap-add
+    for (size_t i = 0; i < FFT_SIZE; i++)
+        im[i] = -im[i];
+    fft_.transform(re, im);
+    const float scale = 1.0f / FFT_SIZE;
+    for (size_t i = 0; i < FFT_SIZE; i++)
+        ola_[i] += re[i] * scale * win_[i];
+
+    int16_t *dst = &fifo_[fifo_len_];
+    for (size_t i = 0; i < HOP; i++)
+    {
+        const long v = lrintf(ola_[i] * 32768.0f);
+        dst[i] = static_cast<int16_t>(std::clamp<long>(v, -32768, 32767));
+    }
+    fifo_len_ += HOP;
+    memmove(ola_.get(), &ola_[HOP], (FFT_SIZE - HOP) * sizeof(float));
+    memset(&ola_[FFT_SIZE - HOP], 0, HOP * sizeof(float));
+}
+
+// ----------------------------------------------------------------------------
+// Automatic gain control (Q12 fixed point)
+// ----------------------------------------------------------------------------
+void VoiceFrontEnd::autoGain(size_t n)
+{
+    int16_t *x = out_.get();
+    uint64_t energy = 0;
+    int32_t peak = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const int32_t v = x[i];
+        energy += static_cast<uint64_t>(v * v);
+        peak = std::max(peak, std::abs(v));
+    }
+    const uint64_t ms = energy / n;
+
+    // Speech = well above the floor of recent quiet blocks; the floor falls
+    // at once and rises ~4 dB/s, so it settles on the background level
+    speech_ = floor_energy_ > 0 && ms > SPEECH_MIN_MS && ms > floor_energy_ * SPEECH_OVER_FLOOR;
+    if (floor_energy_ == 0 || ms < floor_energy_)
+        floor_energy_ = std::max<uint64_t>(ms, 1);
+    else
+        floor_energy_ += floor_energy_ / 64 + 1;
+
+    const int32_t g0 = gain_q12_;
+    int32_t g1 = g0;
+    if (speech_)
+    {
+        // Speech level: fast attack, slow release
+        const uint32_t rms = static_cast<uint32_t>(sqrtf(static_cast<float>(ms)));
+        if (level_ == 0)
+            level_ = rms;
+        else if (rms > level_)
+            level_ += (rms - level_) / 2;
+        else
+            level_ -= (level_ - rms) / 16;
+
+        const int32_t want = std::clamp<int32_t>(
+            static_cast<int32_t>(static_cast<int64_t>(target_rms_) * Q12 / std::max<uint32_t>(level_, 1)),
+            gain_min_q12_, gain_max_q12_);
+        // Cut within ~4 blocks, boost over ~32: loud onsets settle fast,
+        // a pause never pumps the gain up quickly
+        if (want < g1)
+            g1 -= (g1 - want + 3) / 4;
+        else
+            g1 += (want - g1) / 32;
+    }
+
+    // Peak limiter: this block's peak lands at full scale at most
+    bool limited = false;
+    if (peak > 0 && static_cast<int64_t>(peak) * g1 > (static_cast<int64_t>(32767) << 12))
+    {
+        g1 = static_cast<int32_t>((static_cast<int64_t>(32767) << 12) / peak);
+        limited = true;
+    }
+    gain_q12_ = g1;
+
+    // Ramp across the block (no zipper noise); a limited block starts at the limit
+    const int32_t start = limited ? g1 : g0;
+    const int32_t span = g1 - start;
+    if (span == 0 && g1 == Q12)
+        return;
+    for (size_t i = 0; i < n; i++)
+    {
+        const int32_t g = start + static_cast<int32_t>(static_cast<int64_t>(span) * static_cast<int64_t>(i) / static_cast<int64_t>(n));
+        const int32_t v = (x[i] * g) >> 12;
+        x[i] = static_cast<int16_t>(std::clamp<int32_t>(v, -32768, 32767));
+    }
+}
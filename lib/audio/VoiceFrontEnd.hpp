@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "Radix2Fft.hpp"
+
+/**
+ * VoiceFrontEnd
+ * ============================================================================
+ * Noise suppression + automatic gain control cho uplink, giữa AEC và
+ * VAD / encoder: server ASR nhận giọng ở mức ổn định, ít tiếng quạt / điều hòa.
+ *
+ * NS (spectral, kiểu WebRTC-lite):
+ *  - STFT 256 điểm, hop 128 (8 ms @16 kHz), cửa sổ sqrt-Hann phân tích +
+ *    tổng hợp (overlap-add tái tạo hoàn hảo khi gain = 1). Trễ thêm 8 ms.
+ *  - Noise PSD mỗi bin: theo dõi cực tiểu của phổ đã làm mượt, tăng chậm
+ *    (~5 dB/s) → bám tạp âm dừng, không ăn giọng nói.
+ *  - Gain Wiener với SNR a priori "decision-directed" (0.98): ít musical
+ *    noise; sàn gain ns_max_atten_db giữ lại chút nền cho tự nhiên.
+ *
+ * AGC (fixed-point, gain Q12):
+ *  - Đo RMS của frame có tiếng nói (năng lượng vượt sàn tự theo dõi 9 dB);
+ *    frame im lặng giữ nguyên gain → không khuếch đại tạp âm.
+ *  - Gain về mức đích agc_target_dbfs: giảm nhanh (~60 ms), tăng chậm
+ *    (~0.5 s); trong khoảng [-agc_max_cut_db, +agc_max_gain_db].
+ *  - Limiter đỉnh: frame sẽ clip thì gain hạ ngay cho đỉnh vừa full scale;
+ *    gain nội suy tuyến tính trong frame (không "zipper").
+ *
+ * process() chỉ từ một task (encoder task). setNs/setAgc an toàn từ mọi
+ * task; bật / tắt NS xóa lịch sử STFT (giữ noise PSD đã học).
+ */
+class VoiceFrontEnd
+{
+public:
+    struct Config
+    {
+        uint32_t sample_rate = 16000;
+        uint16_t max_block = 480;      // largest process() block
+        uint8_t ns_max_atten_db = 15;  // per-bin gain floor
+        int8_t agc_target_dbfs = -20;  // speech RMS target
+        uint8_t agc_max_gain_db = 24;  // far-field boost
+        uint8_t agc_max_cut_db = 12;   // near-field cut
+    };
+
+    VoiceFrontEnd() = default;
+    VoiceFrontEnd(const VoiceFrontEnd &) = delete;
+    VoiceFrontEnd &operator=(const VoiceFrontEnd &) = delete;
+
+    bool init(const Config &cfg);
+    void deinit();
+    bool ready() const { return out_ != nullptr; }
+
+    // Forget signal history, noise estimate and gain (new capture device / rate).
+    void reset();
+
+    void setNsEnabled(bool enable) { ns_on_.store(enable, std::memory_order_relaxed); }
+    bool nsEnabled() const { return ns_on_.load(std::memory_order_relaxed); }
+    void setAgcEnabled(bool enable) { agc_on_.store(enable, std::memory_order_relaxed); }
+    bool agcEnabled() const { return agc_on_.load(std::memory_order_relaxed); }
+    bool active() const { return nsEnabled() || agcEnabled(); }
+
+    // Process one block. Returns an internal buffer of n samples, valid
+    // until the next call (`in` itself when both stages are off / n too big).
+    const int16_t *process(const int16_t *in, size_t n);
+
+    // Current AGC gain (dB) and whether the last block held speech.
+    float gainDb() const;
+    bool speech() const { return speech_; }
+    // Added delay with NS on (samples).
+    size_t latencySamples() const { return ns_active_ ? HOP : 0; }
+
+private:
+    static constexpr size_t FFT_SIZE = Radix2Fft::SIZE;
+    static constexpr size_t HOP = FFT_SIZE / 2;
+    static constexpr size_t BINS = FFT_SIZE / 2 + 1;
+
+    void resetStft();
+    // n samples through the STFT into out_ (delayed by HOP).
+    void suppress(const int16_t *in, size_t n);
+    void suppressHop();
+    // In place on out_[0..n).
+    void autoGain(size_t n);
+
+    Config cfg_{};
+    std::atomic<bool> ns_on_{true};
+    std::atomic<bool> agc_on_{true};
+    bool ns_active_ = false; // STFT state matches ns_on_ (process() side)
+
+    // NS
+    std::unique_ptr<float[]> win_;    // sqrt-Hann, FFT_SIZE
+    Radix2Fft fft_;                   // shared twiddle table
+    std::unique_ptr<float[]> work_;   // re | im, 2 * FFT_SIZE
+    std::unique_ptr<float[]> ana_;    // last FFT_SIZE input samples
+    std::unique_ptr<float[]> ola_;    // overlap-add accumulator, FFT_SIZE
+    std::unique_ptr<float[]> smooth_; // smoothed power, BINS
+    std::unique_ptr<float[]> noise_;  // noise PSD, BINS
+    std::unique_ptr<float[]> clean_;  // previous clean power estimate, BINS
+    std::unique_ptr<int16_t[]> fifo_; // suppressed samples not yet returned
+    size_t fill_ = 0;        // new samples in the current hop
+    size_t fifo_len_ = 0;
+    uint32_t hops_ = 0;      // since reset (noise estimate warm-up)
+    uint32_t warmup_hops_ = 0;
+    float gain_floor_ = 0.f;
+    float rise_ = 1.f;       // noise floor growth per hop
+
+    // AGC (Q12 gain, 4096 = 0 dB)
+    int32_t gain_q12_ = 4096;
+    int32_t gain_min_q12_ = 0;
+    int32_t gain_max_q12_ = 0;
+    int32_t target_rms_ = 0;
+    uint32_t level_ = 0;       // speech RMS envelope (input scale)
+    uint64_t floor_energy_ = 0; // tracked mean-square of non-speech blocks
+    bool speech_ = false;
+
+    std::unique_ptr<int16_t[]> out_; // max_block
+};
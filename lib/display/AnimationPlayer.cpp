@@ -1,7 +1,11 @@
 #include "AnimationPlayer.hpp"
 #include "DisplayDriver.hpp"
+#include "OverlayCompositor.hpp"
 #include "esp_log.h"
+#include "esp_timer.h"
+#include <algorithm>
 #include <cstring>
+#include <new>
 #include "assets/emotions/emotion_types.hpp"
 
 static const char* TAG = "AnimationPlayer";
@@ -34,12 +38,19 @@ void AnimationPlayer::setAnimation(const Animation1Bit& anim, int x, int y)
         return;
     }
 
+    if (anim.frames != cache_owner_) {
+        resetFrameCache();
+        cache_owner_ = anim.frames;
+    }
+
     current_anim_ = anim;
     pos_x_ = x;
     pos_y_ = y;
 
     frame_index_ = 0;
     frame_timer_ = 0;
+    rendered_index_ = -1;
+    frame_dirty_ = true;
     paused_ = false;
     playing_ = true;
 
@@ -49,9 +60,16 @@ void AnimationPlayer::setAnimation(const Animation1Bit& anim, int x, int y)
         frame_interval_ = 1000 / anim.fps;
     }
 
-    // Allocate scanline buffer for streaming (8 rows max)
+    // Allocate scanline buffer for streaming, unless the driver's async
+    // DMA buffers are large enough to hold a whole batch
     size_t scanline_size = SCANLINE_ROWS * anim.width * sizeof(uint16_t);
-    if (scanline_size > scanline_buf_size_) {
+    if (drv_ && drv_->pixelBufferBytes() >= scanline_size) {
+        if (scanline_buffer_) {
+            free(scanline_buffer_);
+            scanline_buffer_ = nullptr;
+            scanline_buf_size_ = 0;
+        }
+    } else if (scanline_size > scanline_buf_size_) {
         if (scanline_buffer_) free(scanline_buffer_);
         scanline_buffer_ = (uint16_t*)malloc(scanline_size);
         scanline_buf_size_ = scanline_size;
@@ -73,6 +91,8 @@ void AnimationPlayer::stop()
     paused_  = false;
     frame_index_ = 0;
     frame_timer_ = 0;
+    rendered_index_ = -1;
+    frame_dirty_ = false;
 }
 
 void AnimationPlayer::pause()
@@ -92,6 +112,8 @@ void AnimationPlayer::update(uint32_t dt_ms)
 
     frame_timer_ += dt_ms;
 
+    size_t prev_index = frame_index_;
+
     // Update frame index
     while (frame_timer_ >= frame_interval_) {
         frame_timer_ -= frame_interval_;
@@ -107,6 +129,17 @@ void AnimationPlayer::update(uint32_t dt_ms)
             }
         }
     }
+
+    if (frame_index_ != prev_index) {
+        frame_dirty_ = true;
+    }
+}
+
+uint32_t AnimationPlayer::msUntilNextFrame() const
+{
+    if (!playing_ || paused_ || !current_anim_.valid() || current_anim_.frame_count <= 1)
+        return UINT32_MAX;
+    return frame_timer_ >= frame_interval_ ? 0 : frame_interval_ - frame_timer_;
 }
 
 void AnimationPlayer::decode1BitToRGB565(const uint8_t* packed_data, int width, int height)
@@ -118,72 +151,284 @@ void AnimationPlayer::decode1BitToRGB565(const uint8_t* packed_data, int width,
     (void)height;
 }
 
-void AnimationPlayer::decodeRLEScanline(const uint8_t* rle_data, int start_y, int num_rows, uint16_t* out_buffer)
+// ----------------------------------------------------------------------------
+// Frame cache + palette
+// ----------------------------------------------------------------------------
+void AnimationPlayer::setPalette(const uint16_t colors[4])
+{
+    memcpy(palette_, colors, sizeof(palette_));
+    blit_.setPalette(palette_);
+    if (quad_lut_) rebuildQuadLut();
+    invalidate();
+}
+
+void AnimationPlayer::rebuildQuadLut()
+{
+    for (int b = 0; b < 256; b++) {
+        for (int k = 0; k < 4; k++) {
+            quad_lut_[b * 4 + k] = palette_[(b >> (k * 2)) & 0x03];
+        }
+    }
+}
+
+void AnimationPlayer::setFrameCacheBudget(size_t bytes)
 {
-    if (!rle_data || !out_buffer) return;
+    cache_arena_.reset();
+    quad_lut_.reset();
+    cache_cap_ = 0;
+    resetFrameCache();
+    if (bytes == 0) return;
+
+    cache_arena_.reset(new (std::nothrow) uint8_t[bytes]);
+    quad_lut_.reset(new (std::nothrow) uint16_t[256 * 4]);
+    if (!cache_arena_ || !quad_lut_) {
+        ESP_LOGW(TAG, "Frame cache: no RAM for %zu bytes, disabled", bytes);
+        cache_arena_.reset();
+        quad_lut_.reset();
+        return;
+    }
+    cache_cap_ = bytes;
+    rebuildQuadLut();
+    ESP_LOGI(TAG, "Frame cache: %zu bytes (2 bpp)", bytes);
+}
 
-    int w = current_anim_.width;
-    int h = current_anim_.height;
-    int start_pixel = start_y * w;
-    int end_pixel = (start_y + num_rows) * w;
-    if (end_pixel > w * h) end_pixel = w * h;
+void AnimationPlayer::resetFrameCache()
+{
+    cache_used_ = 0;
+    cache_count_ = 0;
+    cache_hits_ = 0;
+    cache_misses_ = 0;
+}
 
-    const uint8_t* src = rle_data;
-    int px = 0;  // Current pixel index in frame
-    int out_idx = 0;  // Output buffer index
+const uint8_t* AnimationPlayer::cachedBlock(const asset::emotion::DiffBlock* block)
+{
+    if (!cache_arena_) return nullptr;
+
+    for (int i = 0; i < cache_count_; i++) {
+        if (cache_entries_[i].key == block) {
+            cache_hits_++;
+            return &cache_arena_[cache_entries_[i].offset];
+        }
+    }
 
-    // RLE decode: [count, value] (2-bit grayscale, 4 levels)
-    while (px < w * h) {
+    cache_misses_++;
+    const int pixels = block->width * block->height;
+    const size_t bytes = (pixels + 3) / 4;
+    if (cache_count_ == CACHE_MAX_ENTRIES || cache_used_ + bytes > cache_cap_)
+        return nullptr; // full: stream this block from RLE
+
+    // Pack the whole RLE stream once; value-0 runs are covered by the memset
+    uint8_t* dst = &cache_arena_[cache_used_];
+    memset(dst, 0, bytes);
+    const uint8_t* src = block->data;
+    int pos = 0;
+    while (pos < pixels) {
         uint8_t count = *src++;
-        uint8_t value = *src++;
+        uint8_t value = *src++ & 0x03;
         if (count == 0) break;
-
-        uint8_t gray2 = value & 0x03; // 2-bit value (0-3)
-        uint8_t gray = gray2 * 85; // 0, 85, 170, 255
-        uint16_t color = ((gray >> 3) << 11) | ((gray >> 2) << 5) | (gray >> 3); // RGB565
-
-        for (uint8_t i = 0; i < count && px < end_pixel; i++, px++) {
-            if (px >= start_pixel) {
-                out_buffer[out_idx++] = color;
+        int end = pos + count;
+        if (end > pixels) end = pixels;
+        if (value) {
+            for (; pos < end; pos++) {
+                dst[pos >> 2] |= value << ((pos & 3) * 2);
             }
         }
-        if (px >= end_pixel) break;
+        pos = end;
+    }
+
+    cache_entries_[cache_count_++] = CacheEntry{block, static_cast<uint32_t>(cache_used_)};
+    cache_used_ += bytes;
+    return dst;
+}
+
+void AnimationPlayer::expandPacked(const uint8_t* packed, int first, int n, uint16_t* out) const
+{
+    const uint8_t* src = packed + (first >> 2);
+    int i = 0;
+
+    // Leading pixels up to a byte boundary
+    for (int k = first & 3; k != 0 && k < 4 && i < n; k++, i++) {
+        out[i] = palette_[(*src >> (k * 2)) & 0x03];
+        if (k == 3) src++;
+    }
+
+    // 4 pixels per packed byte through the LUT
+    for (; i + 4 <= n; i += 4) {
+        memcpy(&out[i], &quad_lut_[*src++ * 4], 4 * sizeof(uint16_t));
+    }
+
+    for (int k = 0; i < n; k++, i++) {
+        out[i] = palette_[(*src >> (k * 2)) & 0x03];
     }
 }
 
-void AnimationPlayer::decodeFullRLEFrame(const asset::emotion::DiffBlock* block)
+void AnimationPlayer::decodeFullRLEFrame(const asset::emotion::DiffBlock* /*block*/)
 {
     // Deprecated - no longer used
 }
 
-void AnimationPlayer::applyDiffBlock(const asset::emotion::DiffBlock* diff)
+void AnimationPlayer::applyDiffBlock(const asset::emotion::DiffBlock* /*diff*/)
 {
     // Deprecated - no longer used
 }
 
-void AnimationPlayer::render()
+bool AnimationPlayer::isFullBlock(const asset::emotion::DiffBlock* block) const
+{
+    return block && block->x == 0 && block->y == 0 &&
+           block->width == current_anim_.width && block->height == current_anim_.height;
+}
+
+void AnimationPlayer::renderBlock(const asset::emotion::DiffBlock* block)
+{
+    if (!block || !block->data) return;
+
+    int bw = block->width;
+    int bh = block->height;
+    if (bw <= 0 || bh <= 0 ||
+        block->x + bw > current_anim_.width || block->y + bh > current_anim_.height) {
+        ESP_LOGW(TAG, "renderBlock: block out of bounds (%u,%u %ux%u)",
+                 block->x, block->y, block->width, block->height);
+        return;
+    }
+
+    // Clip to the panel: an animation placed partly off screen only sends
+    // the visible columns / rows (the panel would wrap the window otherwise)
+    const int bx = pos_x_ + block->x;
+    const int by = pos_y_ + block->y;
+    const int x0 = std::max(bx, 0);
+    const int y0 = std::max(by, 0);
+    const int x1 = std::min(bx + bw, (int)drv_->width());
+    const int y1 = std::min(by + bh, (int)drv_->height());
+    if (x0 >= x1 || y0 >= y1) return;
+    const int cw = x1 - x0;
+    const int clip_x = x0 - bx;
+    const int first_row = y0 - by;
+    const int rows_total = y1 - y0;
+
+    // Async path: decode batch N+1 while the driver DMAs batch N
+    const size_t row_bytes = cw * sizeof(uint16_t);
+    bool use_async = drv_->pixelBufferBytes() >= SCANLINE_ROWS * row_bytes;
+    if (!use_async && !scanline_buffer_)
+        return;
+    // As many rows per transaction as the buffer holds (narrow dirty rects
+    // go out in fewer, larger SPI transactions)
+    const size_t buf_bytes = use_async ? drv_->pixelBufferBytes() : scanline_buf_size_;
+    const int batch_rows = (int)(buf_bytes / row_bytes);
+
+    // Set window once for the whole block
+    drv_->setWindow(x0, y0, x1 - 1, y1 - 1);
+
+    // Cached blocks expand from 2 bpp; otherwise the cursor carries the RLE
+    // position across batches -> single linear pass per block
+    const uint8_t* packed = cachedBlock(block);
+    RleBlitter::Cursor cursor;
+    cursor.src = block->data;
+    if (!packed) RleBlitter::skip(cursor, first_row * bw);
+
+    for (int row = 0; row < rows_total; row += batch_rows) {
+        const int rows = std::min(batch_rows, rows_total - row);
+        const int batch_pixels = rows * cw;
+
+        uint16_t* out = use_async ? drv_->acquirePixelBuffer() : scanline_buffer_;
+        if (!out) break;
+
+        if (packed) {
+            const int first = (first_row + row) * bw + clip_x;
+            if (cw == bw) {
+                expandPacked(packed, first, batch_pixels, out);
+            } else {
+                for (int r = 0; r < rows; r++)
+                    expandPacked(packed, first + r * bw, cw, out + r * cw);
+            }
+        } else {
+            // Decode this scanline batch from RLE directly to RGB565
+            int decoded = blit_.decodeRows(cursor, bw, clip_x, cw, rows, out);
+            if (decoded < batch_pixels) {
+                // Truncated stream: pad with black so the window stays in sync
+                memset(out + decoded, 0, (batch_pixels - decoded) * sizeof(uint16_t));
+            }
+        }
+
+        // Status overlay goes out with the batch (no second pass, no flicker)
+        if (overlay_) overlay_->compose(x0, y0 + row, cw, rows, out);
+
+        // Write scanline batch directly to display (no framebuffer!)
+        if (use_async) {
+            drv_->queuePixels(out, batch_pixels * sizeof(uint16_t));
+        } else {
+            drv_->writePixels(out, batch_pixels * sizeof(uint16_t));
+        }
+    }
+
+    if (use_async) {
+        drv_->flushPixels();
+    }
+}
+
+void AnimationPlayer::render(uint32_t budget_us)
 {
-    if (!playing_ || !drv_ || !current_anim_.valid() || !scanline_buffer_) 
+    // Nothing changed since last render -> no SPI traffic at all. A finished
+    // non-looping animation still gets its final frame drawn once.
+    if (!frame_dirty_ || !drv_ || !current_anim_.valid())
         return;
 
-    // Get current frame's RLE data
-    const asset::emotion::FrameInfo& frame_info = current_anim_.frames[frame_index_];
-    if (!frame_info.diff || !frame_info.diff->data) return;
+    int target = (int)frame_index_;
+    const asset::emotion::FrameInfo* frames = current_anim_.frames;
 
-    int w = current_anim_.width;
-    int h = current_anim_.height;
+    // Pick the first frame to draw: continue after the frame on screen, or
+    // rebuild from frame 0 after a wrap/reset. Same frame -> redraw its block.
+    int first;
+    if (rendered_index_ < 0 || rendered_index_ > target) {
+        first = 0;
+    } else if (rendered_index_ == target) {
+        first = target;
+    } else {
+        first = rendered_index_ + 1;
+    }
+
+    // Skip ahead to the latest full frame in range; earlier diffs are overdrawn anyway
+    for (int i = target; i > first; i--) {
+        if (isFullBlock(frames[i].diff)) {
+            first = i;
+            break;
+        }
+    }
 
-    // Set window once for entire animation frame
-    drv_->setWindow(pos_x_, pos_y_, pos_x_ + w - 1, pos_y_ + h - 1);
+    int64_t t_start = esp_timer_get_time();
+
+    // Apply dirty rects in order (skipped frames still contribute their boxes).
+    // Out of budget: stop between rects, the screen then shows frame `done`
+    // and the next call continues from there.
+    const int prev = rendered_index_;
+    int done = target;
+    for (int i = first; i <= target; i++) {
+        renderBlock(frames[i].diff);
+        if (budget_us && i < target && (uint32_t)(esp_timer_get_time() - t_start) >= budget_us) {
+            done = i;
+            budget_cuts_++;
+            break;
+        }
+    }
+    rendered_index_ = done;
+    frame_dirty_ = done != target;
 
-    // Stream scanline-by-scanline: decode RLE directly to RGB565 and write
-    for (int y = 0; y < h; y += SCANLINE_ROWS) {
-        int rows_in_batch = (y + SCANLINE_ROWS > h) ? (h - y) : SCANLINE_ROWS;
-        
-        // Decode this scanline batch from RLE directly to RGB565
-        decodeRLEScanline(frame_info.diff->data, y, rows_in_batch, scanline_buffer_);
+    // Frames passed over since the previous render (loop wrap included)
+    if (prev >= 0 && done != prev) {
+        const int passed = done > prev ? done - prev : done + current_anim_.frame_count - prev;
+        dropped_frames_ += (uint32_t)(passed - 1);
+    }
 
-        // Write scanline batch directly to display (no framebuffer!)
-        drv_->writePixels(scanline_buffer_, w * rows_in_batch * sizeof(uint16_t));
+    last_render_us_ = (uint32_t)(esp_timer_get_time() - t_start);
+    render_us_accum_ += last_render_us_;
+    if (++render_count_ >= RENDER_STATS_FRAMES) {
+        const uint32_t cpp = blit_.stats().cyclesPerPixelX100();
+        ESP_LOGD(TAG, "Render avg: %u us/frame over %u frames (%dx%d), cache %u/%u hit, %zu/%zu B, "
+                      "RLE %u.%02u cycles/px",
+                 (unsigned)(render_us_accum_ / render_count_), (unsigned)render_count_,
+                 current_anim_.width, current_anim_.height,
+                 (unsigned)cache_hits_, (unsigned)(cache_hits_ + cache_misses_), cache_used_, cache_cap_,
+                 (unsigned)(cpp / 100), (unsigned)(cpp % 100));
+        render_us_accum_ = 0;
+        render_count_ = 0;
     }
 }
@@ -5,6 +5,10 @@
 #include <string>
 #include <memory>
 
+#include "RleBlitter.hpp"
+
+class OverlayCompositor;
+
 // Forward declare emotion types
 namespace asset { namespace emotion {
     struct DiffBlock;
@@ -39,9 +43,10 @@ struct Animation1Bit {
 /*
  * AnimationPlayer
  * ---------------------------------------------------------
- * Plays 1-bit black/white animations with diff encoding:
- *  - Decodes base frame (1-bit) to RGB565 working buffer
- *  - Applies diff blocks for subsequent frames
+ * Plays 2-bit grayscale RLE animations with diff encoding:
+ *  - Frame 0 is a full frame
+ *  - Later frames carry only the changed bounding box (dirty rect),
+ *    so render() pushes just that box over SPI
  *  - Renders frames directly to display (no framebuffer required)  // direct scanline rendering
  *
  * Note: Không dùng timer riêng — DisplayManager sẽ gọi update().
@@ -66,12 +71,70 @@ public:
     // Update theo thời gian (ms)
     void update(uint32_t dt_ms);
 
-    // Render frame directly to display (no framebuffer needed)
-    void render();
+    // Render frame directly to display (no framebuffer needed).
+    // Only the dirty rects of frames since the last render are pushed.
+    // budget_us > 0: no new dirty rect is started once that much time went
+    // by; the rest stays dirty for the next call (a cut never splits a rect).
+    void render(uint32_t budget_us = 0);
+
+    // Force the next render() to rebuild the whole frame (e.g. after the
+    // animation area was overdrawn by something else)
+    void invalidate() { rendered_index_ = -1; frame_dirty_ = true; }
+
+    // True if the frame on screen is out of date (render() would draw)
+    bool isDirty() const { return frame_dirty_; }
+
+    // ms còn lại tới frame kế tiếp (UINT32_MAX nếu không có frame nào nữa:
+    // stopped, paused, hết animation không loop, hoặc chỉ có 1 frame) —
+    // display task ngủ đúng tới deadline này thay vì poll.
+    uint32_t msUntilNextFrame() const;
+    bool isPlaying() const { return playing_ && current_anim_.valid(); }
+
+    // Thời gian render frame gần nhất (us), dùng để đo hiệu năng
+    uint32_t lastRenderUs() const { return last_render_us_; }
+    // Frames never shown on their own (overtaken before a render finished
+    // on them) and renders cut short by budget_us, since start
+    uint32_t droppedFrames() const { return dropped_frames_; }
+    uint32_t budgetCuts() const { return budget_cuts_; }
+    // RLE decode cost (cycles / pixels) since start, without SPI
+    const RleBlitter::Stats& blitStats() const { return blit_.stats(); }
+
+    // Optional frame cache: decoded blocks của animation hiện tại giữ dạng
+    // 2 bpp packed (index palette, 4 pixel/byte → 320x218 ≈ 17 KB). Loop lần
+    // 2 trở đi bỏ qua RLE decode, chỉ expand qua LUT vào DMA buffer. Block
+    // được nhận vào cache theo thứ tự gặp cho tới khi đầy rồi giữ nguyên (với
+    // animation loop, LRU/FIFO sẽ luôn miss khi cache nhỏ hơn 1 vòng).
+    // 0 = tắt (giải phóng RAM). Đổi animation → cache xoá.
+    void setFrameCacheBudget(size_t bytes);
+    uint32_t cacheHits() const { return cache_hits_; }
+    uint32_t cacheMisses() const { return cache_misses_; }
+    // Storage behind an animation may be reused (unmapped pack): the next
+    // setAnimation() must not trust a frames pointer seen before.
+    void forgetFrameCache() { resetFrameCache(); cache_owner_ = nullptr; }
+
+    // 4-entry RGB565 palette for the 2-bit pixel values (theme). Default:
+    // black → white gray ramp. Takes effect on the next (full) redraw.
+    void setPalette(const uint16_t colors[4]);
+
+    // Status layers blended into every scanline batch before it is sent
+    // (not owned; nullptr = none).
+    void setOverlay(OverlayCompositor* overlay) { overlay_ = overlay; }
 
 private:
-    // Decode RLE directly to RGB565 scanline buffer (no intermediate packed buffer)
-    void decodeRLEScanline(const uint8_t* rle_data, int start_y, int num_rows, uint16_t* out_buffer);
+    // Cached block (packed 2 bpp at cache_arena_ + offset) or nullptr; on a
+    // miss the block is packed into the arena if it still fits.
+    const uint8_t* cachedBlock(const asset::emotion::DiffBlock* block);
+    void resetFrameCache();
+    // Expand n pixels starting at pixel `first` of a packed block
+    void expandPacked(const uint8_t* packed, int first, int n, uint16_t* out) const;
+    void rebuildQuadLut();
+
+    // Stream one DiffBlock (full frame or dirty rect) to the display,
+    // clipped to the panel.
+    void renderBlock(const asset::emotion::DiffBlock* block);
+
+    // True if block covers the whole animation area
+    bool isFullBlock(const asset::emotion::DiffBlock* block) const;
     
     // Deprecated functions (kept for compatibility)
     void decode1BitToRGB565(const uint8_t* packed_data, int width, int height);
@@ -79,13 +142,15 @@ private:
     void applyDiffBlock(const asset::emotion::DiffBlock* diff);
 
     DisplayDriver* drv_ = nullptr;
+    OverlayCompositor* overlay_ = nullptr;
 
     Animation1Bit current_anim_;
     int pos_x_ = 0;
     int pos_y_ = 0;
 
     // Streaming scanline buffer: decode RLE directly to RGB565 scanline
-    // (8 rows × width pixels × 2 bytes/pixel = 8 × 320 × 2 = 5120 bytes max)
+    // (16 rows × width pixels × 2 bytes/pixel = 16 × 320 × 2 = 10240 bytes max)
+    // Only allocated when the driver's async DMA buffers can't hold a batch.
     static constexpr int SCANLINE_ROWS = 16;
     uint16_t* scanline_buffer_ = nullptr;
     size_t scanline_buf_size_ = 0;
@@ -96,7 +161,40 @@ private:
     uint32_t frame_interval_ = 50; // ms/frame (20 fps)
 
     size_t frame_index_ = 0;
+    int rendered_index_ = -1;      // frame currently on screen (-1 = none)
+    bool frame_dirty_ = false;     // frame advanced/reset since last render()
+
+    // Render timing (esp_timer, microseconds)
+    uint32_t last_render_us_ = 0;
+    uint64_t render_us_accum_ = 0;
+    uint32_t render_count_ = 0;
+    static constexpr uint32_t RENDER_STATS_FRAMES = 100;
+    uint32_t dropped_frames_ = 0;
+    uint32_t budget_cuts_ = 0;
 
     bool paused_ = false;
     bool playing_ = false;
+
+    // 2-bit value → RGB565
+    uint16_t palette_[4] = {0x0000, 0x52AA, 0xAD55, 0xFFFF};
+    // RLE → RGB565 kernel (LUT of palette_); the cursor carries the stream
+    // position across scanline batches → one linear pass per block
+    RleBlitter blit_;
+
+    // Frame cache (bump allocator, reset per animation)
+    struct CacheEntry {
+        const asset::emotion::DiffBlock* key;
+        uint32_t offset;
+    };
+    static constexpr int CACHE_MAX_ENTRIES = 64;
+    std::unique_ptr<uint8_t[]> cache_arena_;
+    size_t cache_cap_ = 0;
+    size_t cache_used_ = 0;
+    CacheEntry cache_entries_[CACHE_MAX_ENTRIES];
+    int cache_count_ = 0;
+    const asset::emotion::FrameInfo* cache_owner_ = nullptr; // animation cached
+    uint32_t cache_hits_ = 0;
+    uint32_t cache_misses_ = 0;
+    // Packed byte → its 4 RGB565 pixels (2 KB, only with the cache enabled)
+    std::unique_ptr<uint16_t[]> quad_lut_;
 };
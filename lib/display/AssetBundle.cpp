@@ -0,0 +1,193 @@
+#include "AssetBundle.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "esp_log.h"
+
+static const char *TAG = "AssetBundle";
+
+namespace
+{
+    constexpr size_t HEADER_BYTES = 16;
+    constexpr size_t ANIM_BYTES = 32;
+    constexpr size_t FRAME_BYTES = 16;
+
+    inline uint16_t rd16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+    inline uint32_t rd32(const uint8_t *p)
+    {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+} // namespace
+
+AssetBundle::~AssetBundle()
+{
+    close();
+}
+
+// ============================================================================
+// Open / Close
+// ============================================================================
+bool AssetBundle::openAt(const char *label, size_t offset, size_t max_bytes)
+{
+    close();
+
+    const esp_partition_t *part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, static_cast<esp_partition_subtype_t>(PARTITION_SUBTYPE), label);
+    if (!part)
+    {
+        ESP_LOGI(TAG, "No '%s' partition", label);
+        return false;
+    }
+    if (offset + HEADER_BYTES > part->size)
+        return false;
+    const size_t room = max_bytes ? std::min<size_t>(max_bytes, part->size - offset) : part->size - offset;
+
+    uint8_t hdr[HEADER_BYTES];
+    if (esp_partition_read(part, offset, hdr, sizeof(hdr)) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Header read failed");
+        return false;
+    }
+    if (rd32(hdr) != MAGIC || rd16(hdr + 4) != VERSION)
+    {
+        // Erased (0xFF) partition: nothing flashed yet
+        ESP_LOGI(TAG, "'%s'+0x%x holds no bundle (magic 0x%08x)", label, (unsigned)offset, (unsigned)rd32(hdr));
+        return false;
+    }
+
+    const uint32_t total = rd32(hdr + 8);
+    if (total < HEADER_BYTES || total > room)
+    {
+        ESP_LOGE(TAG, "Bad bundle size %u (room %u)", (unsigned)total, (unsigned)room);
+        return false;
+    }
+
+    // Map only what the bundle uses; the data MMU window is shared with the app's rodata
+    const void *ptr = nullptr;
+    esp_err_t err = esp_partition_mmap(part, offset, total, SPI_FLASH_MMAP_DATA, &ptr, &mmap_handle);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "mmap %u B failed: %s", (unsigned)total, esp_err_to_name(err));
+        return false;
+    }
+    base = static_cast<const uint8_t *>(ptr);
+    size = total;
+
+    if (!parse())
+    {
+        close();
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Mapped '%s'+0x%x: %u animations, %u B", label, (unsigned)offset, (unsigned)anim_count,
+             (unsigned)size);
+    return true;
+}
+
+void AssetBundle::close()
+{
+    if (base)
+    {
+        spi_flash_munmap(mmap_handle);
+        base = nullptr;
+    }
+    size = 0;
+    mmap_handle = 0;
+    anim_count = 0;
+    names.reset();
+    anims.reset();
+    frames.reset();
+    blocks.reset();
+}
+
+const char *AssetBundle::name(size_t i) const
+{
+    return i < anim_count ? names[i].c_str() : "";
+}
+
+// ============================================================================
+// Parse: validate every offset, then point the tables into the mapping
+// ============================================================================
+bool AssetBundle::parse()
+{
+    const size_t n = rd16(base + 6);
+    if (n == 0 || HEADER_BYTES + n * ANIM_BYTES > size)
+    {
+        ESP_LOGE(TAG, "Bad animation table (%u entries)", (unsigned)n);
+        return false;
+    }
+
+    // Pass 1: bounds + total frame count
+    size_t total_frames = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const uint8_t *e = base + HEADER_BYTES + i * ANIM_BYTES;
+        const uint32_t fc = rd16(e + 20);
+        const uint32_t off = rd32(e + 28);
+        if (fc == 0 || off < HEADER_BYTES || static_cast<uint64_t>(off) + fc * FRAME_BYTES > size)
+        {
+            ESP_LOGE(TAG, "Animation %u: bad frame table", (unsigned)i);
+            return false;
+        }
+        for (uint32_t f = 0; f < fc; f++)
+        {
+            const uint8_t *fr = base + off + f * FRAME_BYTES;
+            const uint32_t d_off = rd32(fr + 8);
+            const uint32_t d_len = rd32(fr + 12);
+            if (d_off != 0 && (d_len == 0 || static_cast<uint64_t>(d_off) + d_len > size))
+            {
+                ESP_LOGE(TAG, "Animation %u frame %u: data out of range", (unsigned)i, (unsigned)f);
+                return false;
+            }
+        }
+        total_frames += fc;
+    }
+
+    names.reset(new (std::nothrow) std::string[n]);
+    anims.reset(new (std::nothrow) Animation1Bit[n]);
+    frames.reset(new (std::nothrow) asset::emotion::FrameInfo[total_frames]);
+    blocks.reset(new (std::nothrow) asset::emotion::DiffBlock[total_frames]);
+    if (!names || !anims || !frames || !blocks)
+    {
+        ESP_LOGE(TAG, "Out of memory for %u frames", (unsigned)total_frames);
+        return false;
+    }
+
+    // Pass 2: fill tables (pixel data stays in flash)
+    size_t next = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        const uint8_t *e = base + HEADER_BYTES + i * ANIM_BYTES;
+        names[i].assign(reinterpret_cast<const char *>(e), strnlen(reinterpret_cast<const char *>(e), 16));
+
+        Animation1Bit &a = anims[i];
+        a.width = rd16(e + 16);
+        a.height = rd16(e + 18);
+        a.frame_count = rd16(e + 20);
+        a.fps = rd16(e + 22);
+        a.loop = e[24] != 0;
+        a.max_packed_size = (a.width * a.height + 7) / 8;
+        a.base_frame = nullptr;
+        a.frames = &frames[next];
+
+        const uint32_t off = rd32(e + 28);
+        for (int f = 0; f < a.frame_count; f++, next++)
+        {
+            const uint8_t *fr = base + off + f * FRAME_BYTES;
+            const uint32_t d_off = rd32(fr + 8);
+            if (d_off == 0)
+            {
+                frames[next].diff = nullptr;
+                continue;
+            }
+            blocks[next] = asset::emotion::DiffBlock{rd16(fr), rd16(fr + 2), rd16(fr + 4), rd16(fr + 6), base + d_off};
+            frames[next].diff = &blocks[next];
+        }
+    }
+
+    anim_count = n;
+    return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "AnimationPlayer.hpp"
+#include "assets/emotions/emotion_types.hpp"
+#include "esp_partition.h"
+
+/**
+ * AssetBundle
+ * ============================================================================
+ * Emotion animations đóng gói trong một data partition riêng (label "assets",
+ * subtype 0x40), tạo bởi `scripts/convert_assets.py bundle`. Partition được
+ * esp_partition_mmap(): dữ liệu RLE của từng frame được player đọc thẳng từ
+ * flash cache (zero-copy); RAM chỉ giữ bảng FrameInfo/DiffBlock (~16 B/frame).
+ *
+ * Cập nhật animation = flash lại partition (esptool write_flash), không cần
+ * build/OTA firmware. Phần trống phía sau bundle chứa các animation pack tải
+ * từ server (AnimPackCache): cùng layout, mở bằng openAt().
+ *
+ * Layout (little-endian, offset tính từ đầu bundle):
+ *   Header 16 B   magic "PTAB", u16 version, u16 anim_count, u32 total_size,
+ *                 u32 sound_offset (0: không có âm thanh)
+ *   Anim   32 B × anim_count
+ *                 char name[16], u16 width, u16 height, u16 frame_count,
+ *                 u16 fps, u8 loop, u8 pad[3], u32 frames_offset
+ *   Frame  16 B × frame_count (tại frames_offset)
+ *                 u16 x, u16 y, u16 w, u16 h, u32 data_offset, u32 data_len
+ *                 (data_offset = 0: frame không đổi)
+ *   Blob           RLE 2-bit [count, value] như src/assets/emotions
+ *   Sounds         (tại sound_offset, cuối bundle; đọc bởi EarconPlayer)
+ *                 u16 count, u16 0, rồi 32 B × count:
+ *                 char name[16], u32 sample_rate, u8 format (0 PCM16, 1 IMA
+ *                 ADPCM), u8 pad[3], u32 data_offset, u32 samples
+ */
+class AssetBundle
+{
+public:
+    static constexpr uint32_t MAGIC = 0x42415450; // "PTAB"
+    static constexpr uint16_t VERSION = 1;
+    static constexpr uint8_t PARTITION_SUBTYPE = 0x40;
+
+    AssetBundle() = default;
+    ~AssetBundle();
+
+    AssetBundle(const AssetBundle &) = delete;
+    AssetBundle &operator=(const AssetBundle &) = delete;
+
+    // Map the partition and build the frame tables; false if missing/invalid.
+    bool open(const char *label = "assets") { return openAt(label, 0, 0); }
+    // Bundle stored `offset` bytes into the partition, at most `max_bytes`
+    // long (0: up to the partition end).
+    bool openAt(const char *label, size_t offset, size_t max_bytes);
+    void close();
+
+    bool isOpen() const { return base != nullptr; }
+    size_t count() const { return anim_count; }
+    // Mapped bytes (header total_size)
+    size_t bytes() const { return size; }
+
+    // Animation `i`; pointers stay valid until close().
+    const char *name(size_t i) const;
+    const Animation1Bit &animation(size_t i) const { return anims[i]; }
+
+private:
+    bool parse();
+
+    const uint8_t *base = nullptr;
+    size_t size = 0;
+    spi_flash_mmap_handle_t mmap_handle = 0;
+
+    size_t anim_count = 0;
+    std::unique_ptr<std::string[]> names;
+    std::unique_ptr<Animation1Bit[]> anims;
+    std::unique_ptr<asset::emotion::FrameInfo[]> frames; // all animations back to back
+    std::unique_ptr<asset::emotion::DiffBlock[]> blocks;
+};
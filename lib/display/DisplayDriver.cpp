@@ -6,6 +6,7 @@
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "driver/ledc.h"
+#include "esp_heap_caps.h"
 #include <cstring>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -21,6 +22,13 @@ static const char *TAG = "DisplayDriver";
 #define ST7789_CMD_RASET 0x2B
 #define ST7789_CMD_RAMWR 0x2C
 #define ST7789_CMD_DISPON 0x29
+#define ST7789_CMD_PTLON 0x12
+#define ST7789_CMD_NORON 0x13
+#define ST7789_CMD_PTLAR 0x30
+#define ST7789_CMD_VSCRDEF 0x33
+#define ST7789_CMD_VSCSAD 0x37
+#define ST7789_CMD_IDMOFF 0x38
+#define ST7789_CMD_IDMON 0x39
 
 // MADCTL bits
 #define ST7789_MADCTL_MY 0x80
@@ -40,6 +48,7 @@ DisplayDriver::~DisplayDriver()
 {
     if (spi_dev)
     {
+        flushPixels();
         spi_bus_remove_device(spi_dev);
         spi_dev = nullptr;
     }
@@ -49,6 +58,46 @@ DisplayDriver::~DisplayDriver()
         spi_bus_free(cfg_.spi_host);
         ESP_LOGD(TAG, "SPI bus freed");
     }
+    for (int i = 0; i < MAX_DMA_BUFFERS; i++)
+    {
+        freeDma(dma_bufs_[i]);
+        dma_bufs_[i] = nullptr;
+    }
+    freeDma(line_buf_);
+    line_buf_ = nullptr;
+}
+
+size_t DisplayDriver::bufferPoolBytes(const Config &cfg)
+{
+    // Rotation swaps width/height: size for the longer side
+    size_t line = (size_t)std::max(cfg.width, cfg.height) * sizeof(uint16_t);
+    int count = std::min<int>(cfg.dma_buffer_count, MAX_DMA_BUFFERS);
+    size_t total = (line + 3) & ~(size_t)3;
+    if (count > 0)
+        total += count * (((line * cfg.dma_lines) + 3) & ~(size_t)3);
+    return total;
+}
+
+void *DisplayDriver::allocDma(size_t bytes)
+{
+    size_t aligned = (bytes + 3) & ~(size_t)3;
+    if (cfg_.buffer_pool && pool_used_ + aligned <= cfg_.buffer_pool_bytes)
+    {
+        void *p = cfg_.buffer_pool + pool_used_;
+        pool_used_ += aligned;
+        return p;
+    }
+    return heap_caps_malloc(bytes, MALLOC_CAP_DMA);
+}
+
+void DisplayDriver::freeDma(void *p)
+{
+    if (!p)
+        return;
+    const uint8_t *b = static_cast<const uint8_t *>(p);
+    if (cfg_.buffer_pool && b >= cfg_.buffer_pool && b < cfg_.buffer_pool + cfg_.buffer_pool_bytes)
+        return; // pool memory is owned by the caller
+    heap_caps_free(p);
 }
 
 // ----------------------------------------------------------------------------
@@ -57,6 +106,8 @@ DisplayDriver::~DisplayDriver()
 
 void DisplayDriver::sendCommand(uint8_t cmd)
 {
+    // Blocking transfers must not interleave with queued pixel data
+    flushPixels();
     gpio_set_level((gpio_num_t)cfg_.pin_dc, 0); // DC = 0 (command)
 
     spi_transaction_t t = {};
@@ -70,6 +121,7 @@ void DisplayDriver::sendData(const uint8_t *data, size_t len)
     if (!len)
         return;
 
+    flushPixels();
     gpio_set_level((gpio_num_t)cfg_.pin_dc, 1); // DC = 1 (data)
 
     spi_transaction_t t = {};
@@ -102,6 +154,19 @@ void DisplayDriver::setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint
     sendCommand(ST7789_CMD_RAMWR);
 }
 
+void DisplayDriver::sendCommandU16(uint8_t cmd, const uint16_t *vals, size_t count)
+{
+    uint8_t buf[8];
+    count = std::min(count, sizeof(buf) / 2);
+    for (size_t i = 0; i < count; i++)
+    {
+        buf[2 * i] = (uint8_t)(vals[i] >> 8);
+        buf[2 * i + 1] = (uint8_t)(vals[i] & 0xFF);
+    }
+    sendCommand(cmd);
+    sendData(buf, count * 2);
+}
+
 // ----------------------------------------------------------------------------
 // Backlight control
 // ----------------------------------------------------------------------------
@@ -225,6 +290,7 @@ bool DisplayDriver::init(const Config &cfg)
 
     sendCommand(ST7789_CMD_MADCTL);
     sendData(&madctl, 1);
+    madctl_ = madctl;
 
     // Optional: invert colors for bring-up diagnostics
     // 0x21 = INVON (invert), 0x20 = INVOFF (normal)
@@ -237,6 +303,8 @@ bool DisplayDriver::init(const Config &cfg)
 
     ESP_LOGI(TAG, "ST7789 init OK");
 
+    initDmaBuffers();
+
     // Clear screen to black to avoid pixel noise
     fillScreen(0x0000);
     vTaskDelay(pdMS_TO_TICKS(100));
@@ -264,12 +332,137 @@ void DisplayDriver::writePixels(const uint16_t *buffer, size_t len_bytes)
 {
     if (!initialized || !buffer || len_bytes == 0)
         return;
+    flushPixels();
     spi_transaction_t t = {};
     t.length = len_bytes * 8; // bits
     t.tx_buffer = buffer;
     ESP_ERROR_CHECK(spi_device_transmit(spi_dev, &t));
 }
 
+// ----------------------------------------------------------------------------
+// Async (queued DMA) pixel streaming
+// ----------------------------------------------------------------------------
+
+void DisplayDriver::initDmaBuffers()
+{
+    // Line buffer for fills / RLE icons, allocated once (longer side)
+    size_t line_bytes = (size_t)std::max(width_, height_) * sizeof(uint16_t);
+    line_buf_ = (uint16_t *)allocDma(line_bytes);
+    if (!line_buf_)
+    {
+        ESP_LOGE(TAG, "Line buffer alloc failed (%zu bytes)", line_bytes);
+    }
+
+    int count = std::min<int>(cfg_.dma_buffer_count, MAX_DMA_BUFFERS);
+    if (count <= 0 || cfg_.dma_lines == 0)
+        return;
+
+    // Queue depth must cover every buffer in flight (devcfg.queue_size = 7)
+    size_t bytes = line_bytes * cfg_.dma_lines;
+    for (int i = 0; i < count; i++)
+    {
+        dma_bufs_[i] = (uint16_t *)allocDma(bytes);
+        if (!dma_bufs_[i])
+        {
+            ESP_LOGW(TAG, "Async pixel buffer %d alloc failed (%zu bytes)", i, bytes);
+            break;
+        }
+        dma_buf_count_ = i + 1;
+    }
+
+    // Double buffering needs at least two buffers to overlap anything
+    if (dma_buf_count_ < 2)
+    {
+        for (int i = 0; i < dma_buf_count_; i++)
+        {
+            freeDma(dma_bufs_[i]);
+            dma_bufs_[i] = nullptr;
+        }
+        dma_buf_count_ = 0;
+        ESP_LOGW(TAG, "Async pixel pipeline disabled");
+        return;
+    }
+
+    dma_buf_bytes_ = bytes;
+    ESP_LOGI(TAG, "Async pixel pipeline: %d x %zu bytes", dma_buf_count_, dma_buf_bytes_);
+}
+
+void DisplayDriver::waitOneQueued()
+{
+    spi_transaction_t *done = nullptr;
+    esp_err_t err = spi_device_get_trans_result(spi_dev, &done, portMAX_DELAY);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "get_trans_result failed: %d", err);
+    }
+    dma_in_flight_--;
+}
+
+uint16_t *DisplayDriver::acquirePixelBuffer()
+{
+    if (!initialized || dma_buf_count_ == 0)
+        return nullptr;
+
+    // Buffers are handed out round-robin and complete in order, so when all
+    // of them are in flight the oldest one (dma_next_) is the first to finish.
+    if (dma_in_flight_ >= dma_buf_count_)
+    {
+        waitOneQueued();
+    }
+
+    uint16_t *buf = dma_bufs_[dma_next_];
+    dma_next_ = (dma_next_ + 1) % dma_buf_count_;
+    return buf;
+}
+
+void DisplayDriver::queuePixels(const uint16_t *buffer, size_t len_bytes)
+{
+    if (!initialized || !buffer || len_bytes == 0)
+        return;
+    if (len_bytes > dma_buf_bytes_)
+    {
+        ESP_LOGE(TAG, "queuePixels: %zu bytes exceeds buffer (%zu)", len_bytes, dma_buf_bytes_);
+        return;
+    }
+
+    // Find the transaction slot owned by this buffer
+    int slot = -1;
+    for (int i = 0; i < dma_buf_count_; i++)
+    {
+        if (dma_bufs_[i] == buffer)
+        {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0)
+    {
+        ESP_LOGE(TAG, "queuePixels: buffer not from acquirePixelBuffer()");
+        return;
+    }
+
+    spi_transaction_t &t = dma_trans_[slot];
+    t = {};
+    t.length = len_bytes * 8; // bits
+    t.tx_buffer = buffer;
+
+    esp_err_t err = spi_device_queue_trans(spi_dev, &t, portMAX_DELAY);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "queue_trans failed: %d", err);
+        return;
+    }
+    dma_in_flight_++;
+}
+
+void DisplayDriver::flushPixels()
+{
+    while (dma_in_flight_ > 0)
+    {
+        waitOneQueued();
+    }
+}
+
 // ----------------------------------------------------------------------------
 // Backlight deep-sleep hold control
 // ----------------------------------------------------------------------------
@@ -325,11 +518,11 @@ void DisplayDriver::fillScreen(uint16_t color, int x, int y, int w, int h)
     setAddressWindow(x, y, x + w - 1, y + h - 1);
     gpio_set_level((gpio_num_t)cfg_.pin_dc, 1); // data
 
-    // Allocate line buffer (much smaller than full screen)
-    uint16_t *line_buf = (uint16_t *)malloc(width_ * sizeof(uint16_t));
+    // Line buffer (much smaller than full screen), allocated at init
+    uint16_t *line_buf = line_buf_;
     if (!line_buf)
     {
-        ESP_LOGE(TAG, "fillScreen: malloc failed for line buffer (%d bytes)", width_ * 2);
+        ESP_LOGE(TAG, "fillScreen: no line buffer");
         return;
     }
 
@@ -353,8 +546,6 @@ void DisplayDriver::fillScreen(uint16_t color, int x, int y, int w, int h)
             break;
         }
     }
-
-    free(line_buf);
 }
 
 void DisplayDriver::fillRect(int x, int y, int w, int h, uint16_t color)
@@ -387,11 +578,11 @@ void DisplayDriver::fillRect(int x, int y, int w, int h, uint16_t color)
     setAddressWindow(x, y, x + w - 1, y + h - 1);
     gpio_set_level((gpio_num_t)cfg_.pin_dc, 1);
 
-    // Allocate line buffer
-    uint16_t *line_buf = (uint16_t *)malloc(w * sizeof(uint16_t));
+    // Line buffer (w <= width_ after clipping)
+    uint16_t *line_buf = line_buf_;
     if (!line_buf)
     {
-        ESP_LOGE(TAG, "fillRect: malloc failed");
+        ESP_LOGE(TAG, "fillRect: no line buffer");
         return;
     }
 
@@ -410,8 +601,6 @@ void DisplayDriver::fillRect(int x, int y, int w, int h, uint16_t color)
     {
         spi_device_transmit(spi_dev, &t);
     }
-
-    free(line_buf);
 }
 
 void DisplayDriver::drawPixel(int x, int y, uint16_t color)
@@ -440,45 +629,152 @@ void DisplayDriver::drawBitmap(int x, int y, int w, int h, const uint16_t *pixel
 // Text rendering (direct to display)
 // ----------------------------------------------------------------------------
 
-void DisplayDriver::drawText(const char *text, uint16_t color, int x, int y, int scale)
+static inline const uint8_t *glyphFor(char c)
+{
+    if (c < 32 || c > 126)
+        c = '?';
+    return FONT8x8[c - 32];
+}
+
+void DisplayDriver::drawText(const char *text, uint16_t color, int x, int y, int scale, int32_t bg_color)
+{
+    if (!initialized || !text)
+        return;
+    if (scale < 1)
+        scale = 1;
+
+    size_t len = strlen(text);
+    if (len == 0)
+        return;
+
+    if (bg_color >= 0)
+    {
+        drawTextOpaque(text, len, color, (uint16_t)bg_color, x, y, scale);
+    }
+    else
+    {
+        drawTextRuns(text, len, color, x, y, scale);
+    }
+}
+
+void DisplayDriver::drawTextClipped(const char *text, uint16_t color, uint16_t bg, int x, int y, int scale,
+                                    int clip_x0, int clip_x1)
 {
     if (!initialized || !text)
         return;
+    if (scale < 1)
+        scale = 1;
+    size_t len = strlen(text);
+    if (len == 0)
+        return;
+    drawTextOpaque(text, len, color, bg, x, y, scale, clip_x0, clip_x1);
+}
+
+// Rasterize the string box (len*8*scale x 8*scale) strip by strip into a line
+// buffer and stream it with a single address window.
+void DisplayDriver::drawTextOpaque(const char *text, size_t len, uint16_t color, uint16_t bg, int x, int y, int scale,
+                                   int clip_x0, int clip_x1)
+{
+    int text_w = (int)len * 8 * scale;
+    int text_h = 8 * scale;
+
+    // Clip to screen bounds (and the caller's column range)
+    int x0 = std::max({x, 0, clip_x0});
+    int y0 = std::max(y, 0);
+    int x1 = std::min({x + text_w, (int)width_, clip_x1}); // exclusive
+    int y1 = std::min(y + text_h, (int)height_); // exclusive
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    int vis_w = x1 - x0;
+    int vis_h = y1 - y0;
+
+    // Prefer the async DMA buffers; fall back to the line buffer, one row
+    // per transfer
+    bool use_async = dma_buf_bytes_ >= (size_t)vis_w * sizeof(uint16_t);
+    int strip_rows = use_async ? (int)(dma_buf_bytes_ / (vis_w * sizeof(uint16_t))) : 1;
+    strip_rows = std::min(strip_rows, vis_h);
+
+    uint16_t *tmp_buf = line_buf_;
+    if (!use_async && !tmp_buf)
+    {
+        ESP_LOGE(TAG, "drawText: no line buffer");
+        return;
+    }
+
+    setWindow(x0, y0, x1 - 1, y1 - 1);
+
+    for (int row = y0; row < y1; row += strip_rows)
+    {
+        int rows = std::min(strip_rows, y1 - row);
+        uint16_t *buf = use_async ? acquirePixelBuffer() : tmp_buf;
+        if (!buf)
+            break;
+
+        uint16_t *dst = buf;
+        for (int r = 0; r < rows; r++)
+        {
+            int glyph_row = (row + r - y) / scale;
+            for (int px = x0; px < x1; px++)
+            {
+                int tx = px - x;
+                int glyph_col = (tx / scale) & 7;
+                uint8_t bits = glyphFor(text[tx / (8 * scale)])[glyph_row];
+                *dst++ = (bits & (0x80 >> glyph_col)) ? color : bg;
+            }
+        }
+
+        size_t bytes = (size_t)rows * vis_w * sizeof(uint16_t);
+        if (use_async)
+        {
+            queuePixels(buf, bytes);
+        }
+        else
+        {
+            writePixels(buf, bytes);
+        }
+    }
+
+    if (use_async)
+    {
+        flushPixels();
+    }
+}
 
+// Transparent text: each horizontal run of lit glyph pixels becomes one
+// scale-high rectangle instead of scale*scale single-pixel windows.
+void DisplayDriver::drawTextRuns(const char *text, size_t len, uint16_t color, int x, int y, int scale)
+{
     int cx = x;
-    while (*text)
+    for (size_t i = 0; i < len; i++, cx += 8 * scale)
     {
-        char c = *text++;
-        if (c < 32 || c > 126)
+        if (cx >= width_)
+            break;
+        if (cx + 8 * scale <= 0 || text[i] == ' ')
             continue;
 
-        const uint8_t *glyph = FONT8x8[c - 32];
-
-        // Draw character pixel by pixel
+        const uint8_t *glyph = glyphFor(text[i]);
         for (int row = 0; row < 8; row++)
         {
             uint8_t line = glyph[row];
-            for (int col = 0; col < 8; col++)
+            int col = 0;
+            while (col < 8)
             {
-                if (line & (0x80 >> col))
+                if (!(line & (0x80 >> col)))
                 {
-                    // Draw scaled pixel
-                    for (int sy = 0; sy < scale; sy++)
-                    {
-                        for (int sx = 0; sx < scale; sx++)
-                        {
-                            drawPixel(cx + col * scale + sx, y + row * scale + sy, color);
-                        }
-                    }
+                    col++;
+                    continue;
                 }
+                int start = col;
+                while (col < 8 && (line & (0x80 >> col)))
+                    col++;
+                fillRect(cx + start * scale, y + row * scale, (col - start) * scale, scale, color);
             }
         }
-
-        cx += 8 * scale;
     }
 }
 
-void DisplayDriver::drawTextCenter(const char *text, uint16_t color, int cx, int cy, int scale)
+void DisplayDriver::drawTextCenter(const char *text, uint16_t color, int cx, int cy, int scale, int32_t bg_color)
 {
     if (!text)
         return;
@@ -490,7 +786,7 @@ void DisplayDriver::drawTextCenter(const char *text, uint16_t color, int cx, int
     int x = cx - text_w / 2;
     int y = cy - 4 * scale;
 
-    drawText(text, color, x, y, scale);
+    drawText(text, color, x, y, scale, bg_color);
 }
 
 // Decode và vẽ icon RLE 2-bit (4 mức xám) trực tiếp lên màn hình
@@ -505,59 +801,67 @@ void DisplayDriver::drawRLE2bitIcon(int x,
         return;
     }
 
-    // Set drawing window
-    setAddressWindow(x, y, x + w - 1, y + h - 1);
-    gpio_set_level((gpio_num_t)cfg_.pin_dc, 1);
-
-    // Allocate line buffer (1 line RGB565)
-    uint16_t *line_buf = (uint16_t *)malloc(w * sizeof(uint16_t));
-    if (!line_buf)
+    // Clip to the panel: rows above are skipped in the stream, columns
+    // outside are decoded past without being written
+    const int x0 = std::max(x, 0);
+    const int y0 = std::max(y, 0);
+    const int x1 = std::min(x + w, (int)width_);
+    const int y1 = std::min(y + h, (int)height_);
+    if (x0 >= x1 || y0 >= y1)
     {
         return;
     }
+    const int cw = x1 - x0;
+    const size_t row_bytes = cw * sizeof(uint16_t);
 
-    const uint8_t *src = rle_data;
+    // Whole icon in as few transactions as the async buffers allow; the line
+    // buffer (one row per transaction) only without them
+    const bool use_async = dma_buf_bytes_ >= row_bytes;
+    if (!use_async && !line_buf_)
+    {
+        return;
+    }
+    const int batch_rows = use_async ? (int)(dma_buf_bytes_ / row_bytes) : 1;
 
-    uint8_t run_count = 0;
-    uint8_t run_value = 0;
+    RleBlitter::Cursor cur;
+    cur.src = rle_data;
+    RleBlitter::skip(cur, (y0 - y) * w);
 
-    for (int row = 0; row < h; row++)
+    setWindow(x0, y0, x1 - 1, y1 - 1);
+    for (int row = y0; row < y1; row += batch_rows)
     {
-        int col = 0;
-
-        while (col < w)
+        const int rows = std::min(batch_rows, y1 - row);
+        uint16_t *out = use_async ? acquirePixelBuffer() : line_buf_;
+        if (!out)
         {
-
-            // Load next RLE token if needed
-            if (run_count == 0)
-            {
-                run_count = *src++;
-                run_value = *src++;
-            }
-
-            uint8_t gray2 = run_value & 0x03; // 2-bit grayscale
-            uint8_t gray = gray2 * 85;        // 0,85,170,255
-
-            uint16_t color =
-                ((gray >> 3) << 11) | // R
-                ((gray >> 2) << 5) |  // G
-                (gray >> 3);          // B
-
-            int run = std::min<int>(run_count, w - col);
-
-            for (int i = 0; i < run; i++)
-            {
-                line_buf[col++] = color;
-            }
-
-            run_count -= run;
+            break;
         }
-
-        // Send one full line
-        sendData((uint8_t *)line_buf, w * sizeof(uint16_t));
+        const int pixels = rows * cw;
+        const int got = icon_blit_.decodeRows(cur, w, x0 - x, cw, rows, out);
+        if (got < pixels)
+        {
+            memset(out + got, 0, (pixels - got) * sizeof(uint16_t)); // truncated icon
+        }
+        if (use_async)
+        {
+            queuePixels(out, pixels * sizeof(uint16_t));
+        }
+        else
+        {
+            writePixels(out, pixels * sizeof(uint16_t));
+        }
+    }
+    if (use_async)
+    {
+        flushPixels();
     }
 
-    free(line_buf);
+    if ((++icons_drawn_ & 63) == 0)
+    {
+        const uint32_t cpp = icon_blit_.stats().cyclesPerPixelX100();
+        ESP_LOGD(TAG, "Icon RLE: %u.%02u cycles/px over %u icons", (unsigned)(cpp / 100),
+                 (unsigned)(cpp % 100), (unsigned)icons_drawn_);
+    }
 }
 
 // Display rotation (0, 1, 2, 3 = 0°, 90°, 180°, 270°)
@@ -592,6 +896,7 @@ void DisplayDriver::setRotation(uint8_t rotation)
 
     sendCommand(ST7789_CMD_MADCTL);
     sendData(&madctl, 1);
+    madctl_ = madctl;
 
     // ✅ swap DIMENSION TRƯỚC khi update rotation_
     if (was_landscape != is_landscape)
@@ -604,6 +909,10 @@ void DisplayDriver::setRotation(uint8_t rotation)
 
     rotation_ = rotation;
 
+    // A scroll band defined for the old orientation no longer makes sense
+    if (scroll_len_)
+        resetScroll();
+
     cfg_.x_offset = new_x_offset;
     cfg_.y_offset = new_y_offset;
 
@@ -612,6 +921,103 @@ void DisplayDriver::setRotation(uint8_t rotation)
              rotation_, madctl, width_, height_);
 }
 
+// ----------------------------------------------------------------------------
+// Hardware scroll / partial / idle
+// ----------------------------------------------------------------------------
+// VSCRDEF/VSCSAD/PTLAR count panel gate lines (0..cfg_.height-1). MADCTL MY
+// reverses the gate order relative to the screen axis, so screen bands are
+// mirrored before they reach the panel.
+
+bool DisplayDriver::gateMirrored() const
+{
+    return (madctl_ & ST7789_MADCTL_MY) != 0;
+}
+
+uint16_t DisplayDriver::panelLine(uint16_t start, uint16_t len) const
+{
+    const uint16_t lines = cfg_.height;
+    return gateMirrored() ? (uint16_t)(lines - (start + len)) : start;
+}
+
+void DisplayDriver::setScrollRegion(uint16_t start, uint16_t len)
+{
+    if (!initialized)
+        return;
+    const uint16_t lines = cfg_.height;
+    if (start >= lines)
+        return;
+    len = std::min<uint16_t>(len, lines - start);
+    if (len == 0)
+        return;
+
+    uint16_t tfa = panelLine(start, len);
+    uint16_t params[3] = {tfa, len, (uint16_t)(lines - tfa - len)};
+    sendCommandU16(ST7789_CMD_VSCRDEF, params, 3);
+
+    scroll_start_ = start;
+    scroll_len_ = len;
+    setScrollOffset(0);
+}
+
+void DisplayDriver::setScrollOffset(uint16_t offset)
+{
+    if (!initialized || scroll_len_ == 0)
+        return;
+    offset %= scroll_len_;
+
+    // Mirrored gates scroll the other way on screen: invert the offset so the
+    // content still moves toward lower screen coordinates.
+    uint16_t tfa = panelLine(scroll_start_, scroll_len_);
+    uint16_t rel = gateMirrored() ? (uint16_t)((scroll_len_ - offset) % scroll_len_) : offset;
+    uint16_t vsp = tfa + rel;
+    sendCommandU16(ST7789_CMD_VSCSAD, &vsp, 1);
+}
+
+void DisplayDriver::resetScroll()
+{
+    if (!initialized)
+        return;
+    const uint16_t lines = cfg_.height;
+    uint16_t params[3] = {0, lines, 0};
+    sendCommandU16(ST7789_CMD_VSCRDEF, params, 3);
+    uint16_t vsp = 0;
+    sendCommandU16(ST7789_CMD_VSCSAD, &vsp, 1);
+    scroll_start_ = 0;
+    scroll_len_ = 0;
+}
+
+void DisplayDriver::setPartialArea(uint16_t start, uint16_t len)
+{
+    if (!initialized)
+        return;
+    const uint16_t lines = cfg_.height;
+    if (start >= lines || len == 0)
+        return;
+    len = std::min<uint16_t>(len, lines - start);
+
+    uint16_t first = panelLine(start, len);
+    uint16_t params[2] = {first, (uint16_t)(first + len - 1)};
+    sendCommandU16(ST7789_CMD_PTLAR, params, 2);
+}
+
+void DisplayDriver::setPartialMode(bool enable)
+{
+    if (!initialized || partial_on_ == enable)
+        return;
+    sendCommand(enable ? ST7789_CMD_PTLON : ST7789_CMD_NORON);
+    partial_on_ = enable;
+    ESP_LOGI(TAG, "Partial mode %s", enable ? "ON" : "OFF");
+}
+
+void DisplayDriver::setIdleMode(bool enable)
+{
+    if (!initialized || idle_on_ == enable)
+        return;
+    sendCommand(enable ? ST7789_CMD_IDMON : ST7789_CMD_IDMOFF);
+    idle_on_ = enable;
+    ESP_LOGI(TAG, "Idle mode %s", enable ? "ON" : "OFF");
+}
+
 void DisplayDriver::initBacklightPwm()
 {
     if (cfg_.pin_bl < 0)
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <string>
 #include "driver/spi_master.h"
+#include "RleBlitter.hpp"
 
 /*
  * DisplayDriver = Raw ST7789 Driver
@@ -37,8 +38,23 @@ public:
         uint16_t y_offset = 0;
 
         uint32_t spi_speed_hz = 40 * 1000 * 1000; // 40 MHz
+
+        // Async pixel streaming: N DMA-capable buffers of dma_lines rows each
+        // (sized for the longer panel side so rotation doesn't matter).
+        // dma_buffer_count = 0 disables the queued path.
+        uint8_t dma_buffer_count = 2;
+        uint16_t dma_lines = 16;
+
+        // Optional DMA-capable memory of bufferPoolBytes() bytes (e.g. a boot
+        // arena block) for the async buffers and the line buffer; nullptr =
+        // heap_caps_malloc(MALLOC_CAP_DMA) once at init
+        uint8_t *buffer_pool = nullptr;
+        size_t buffer_pool_bytes = 0;
     };
 
+    // Pool needed by cfg: dma_buffer_count x dma_lines rows + one line
+    static size_t bufferPoolBytes(const Config &cfg);
+
 public:
     DisplayDriver();
     ~DisplayDriver();
@@ -59,10 +75,25 @@ public:
     void drawBitmap(int x, int y, int w, int h, const uint16_t *pixels);
 
     // Text rendering (direct to display, no framebuffer needed)
-    void drawText(const char *text, uint16_t color, int x, int y, int scale = 1);
-    void drawTextCenter(const char *text, uint16_t color, int cx, int cy, int scale = 1);
-
+    // bg_color >= 0: the whole string box is rasterized into a line buffer and
+    // sent with one window (no clear needed beforehand).
+    // bg_color < 0 (TEXT_TRANSPARENT): only lit pixels are drawn, one window per
+    // horizontal glyph run.
+    static constexpr int32_t TEXT_TRANSPARENT = -1;
+    void drawText(const char *text, uint16_t color, int x, int y, int scale = 1,
+                  int32_t bg_color = TEXT_TRANSPARENT);
+    void drawTextCenter(const char *text, uint16_t color, int cx, int cy, int scale = 1,
+                        int32_t bg_color = TEXT_TRANSPARENT);
+    // Opaque text limited to screen columns [clip_x0, clip_x1): only that slice
+    // of the string box is sent (marquee redraws just the newly exposed columns).
+    void drawTextClipped(const char *text, uint16_t color, uint16_t bg, int x, int y, int scale,
+                         int clip_x0, int clip_x1);
+
+    // 2-bit RLE icon (gray ramp), clipped to the panel; rows are batched
+    // into the async DMA buffers (one SPI transaction per batch).
     void drawRLE2bitIcon(int x, int y, int w, int h, const uint8_t *rle_data);
+    // Icon RLE decode cost since init (cycles / pixels)
+    const RleBlitter::Stats &iconBlitStats() const { return icon_blit_.stats(); }
     // Set address window for streaming/scanline rendering
     // x0, y0: top-left; x1, y1: bottom-right (inclusive)
     void setWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
@@ -71,6 +102,19 @@ public:
     // buffer: RGB565 pixels, len_bytes: size in bytes (width * height * 2)
     void writePixels(const uint16_t *buffer, size_t len_bytes);
 
+    // Async (queued DMA) pixel streaming, used after setWindow:
+    //  buf = acquirePixelBuffer(); fill buf; queuePixels(buf, len); ... flushPixels();
+    // acquirePixelBuffer() blocks only if that buffer is still in flight, so the
+    // caller can fill buffer N+1 while buffer N is being transmitted.
+    // Returns nullptr if the queued path is unavailable.
+    uint16_t *acquirePixelBuffer();
+    // Queue a buffer obtained from acquirePixelBuffer() for transmission.
+    void queuePixels(const uint16_t *buffer, size_t len_bytes);
+    // Wait until all queued pixel transfers are done.
+    void flushPixels();
+    // Capacity of each async pixel buffer in bytes (0 if unavailable).
+    size_t pixelBufferBytes() const { return dma_buf_bytes_; }
+
     // Display rotation (0, 1, 2, 3 = 0°, 90°, 180°, 270°)
     // With automatic offset adjustment for ST7789 panels with physical offset
     // For 0°/180°: y_offset applies; For 90°/270°: x_offset applies (80px shifts to X axis)
@@ -79,15 +123,56 @@ public:
     uint16_t width() const { return width_; }
     uint16_t height() const { return height_; }
 
+    // ------------------------------------------------------------------------
+    // Hardware scroll / partial / idle (ST7789 VSCRDEF, VSCSAD, PTLAR, IDMON)
+    // ------------------------------------------------------------------------
+    // The panel scrolls along its gate axis (the native 320 lines): screen Y in
+    // portrait, screen X in landscape. All start/len/offset arguments below are
+    // screen coordinates along that axis; MY mirroring is handled here.
+    bool scrollAxisIsX() const { return (rotation_ & 1) != 0; }
+    uint16_t scrollAxisLength() const { return scrollAxisIsX() ? width_ : height_; }
+
+    // Scroll band [start, start+len); lines outside it stay fixed.
+    void setScrollRegion(uint16_t start, uint16_t len);
+    // Shift the band content by `offset` lines toward lower coordinates
+    // (GRAM line start+offset is shown at screen line start).
+    void setScrollOffset(uint16_t offset);
+    // Full-screen band, offset 0 (GRAM and screen coordinates agree again).
+    void resetScroll();
+    bool scrollActive() const { return scroll_len_ != 0; }
+
+    // Partial mode: only lines [start, start+len) are driven, the rest is
+    // blanked by the panel. GRAM outside the area is kept.
+    void setPartialArea(uint16_t start, uint16_t len);
+    void setPartialMode(bool enable);
+    // Idle mode: 8-colour (MSB of each channel), lower panel power.
+    void setIdleMode(bool enable);
+    bool partialMode() const { return partial_on_; }
+    bool idleMode() const { return idle_on_; }
+
 private:
     // Low-level ST7789 commands
     void sendCommand(uint8_t cmd);
     void sendData(const uint8_t *data, size_t len);
+    void sendCommandU16(uint8_t cmd, const uint16_t *vals, size_t count); // big-endian params
+    // Screen band along the scroll axis -> panel gate lines (MY mirror)
+    uint16_t panelLine(uint16_t start, uint16_t len) const;
+    bool gateMirrored() const;
     void setAddressWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
 
     // Backlight PWM init helper
     void initBacklightPwm();
 
+    // Allocate async pixel buffers (DMA-capable)
+    void initDmaBuffers();
+    // Collect one finished queued transaction (oldest first)
+    void waitOneQueued();
+
+    // Text helpers
+    void drawTextOpaque(const char *text, size_t len, uint16_t color, uint16_t bg, int x, int y, int scale,
+                        int clip_x0 = 0, int clip_x1 = INT16_MAX);
+    void drawTextRuns(const char *text, size_t len, uint16_t color, int x, int y, int scale);
+
 private:
     Config cfg_;
     spi_device_handle_t spi_dev = nullptr;
@@ -96,10 +181,37 @@ private:
     uint16_t height_ = 320;
 
     uint8_t rotation_ = 0;
+    uint8_t madctl_ = 0;
+
+    // Scroll / partial state (screen coordinates along the scroll axis)
+    uint16_t scroll_start_ = 0;
+    uint16_t scroll_len_ = 0; // 0 = no scroll band defined
+    bool partial_on_ = false;
+    bool idle_on_ = false;
 
     // Backlight PWM state
     bool bl_pwm_ready_ = false;
     uint8_t bl_level_percent_ = 100;
 
+    // Async pixel pipeline state
+    static constexpr int MAX_DMA_BUFFERS = 4;
+    uint16_t *dma_bufs_[MAX_DMA_BUFFERS] = {nullptr};
+    spi_transaction_t dma_trans_[MAX_DMA_BUFFERS] = {};
+    int dma_buf_count_ = 0;
+    size_t dma_buf_bytes_ = 0;
+    int dma_next_ = 0;      // next buffer handed out by acquirePixelBuffer()
+    int dma_in_flight_ = 0; // queued but not yet collected
+
+    // One panel line (longer side) for fills, and RLE icons without the
+    // async buffers; no per-draw malloc
+    uint16_t *line_buf_ = nullptr;
+    RleBlitter icon_blit_;
+    uint32_t icons_drawn_ = 0;
+    size_t pool_used_ = 0; // bytes handed out of cfg_.buffer_pool
+
+    // From cfg_.buffer_pool while it lasts, else the DMA heap
+    void *allocDma(size_t bytes);
+    void freeDma(void *p);
+
     bool initialized = false;
 };
@@ -0,0 +1,296 @@
+#include "OverlayCompositor.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "DisplayDriver.hpp"
+#include "Font8x8.hpp"
+
+namespace
+{
+    inline uint32_t rowMask(int h)
+    {
+        return h >= 32 ? 0xFFFFFFFFu : (1u << h) - 1;
+    }
+
+    inline const uint8_t *glyph(char c)
+    {
+        if (c < 32 || c > 126)
+            c = '?';
+        return FONT8x8[c - 32];
+    }
+} // namespace
+
+// ============================================================================
+// Layers
+// ============================================================================
+void OverlayCompositor::place(Layer &l, Kind kind, int x, int y, int w, int h)
+{
+    Rect r;
+    r.x = (int16_t)x;
+    r.y = (int16_t)y;
+    r.w = (int16_t)w;
+    r.h = (int16_t)h;
+    if (l.kind != Kind::NONE && !(l.r == r))
+        markPending(l.erase, l.r);
+    l.kind = kind;
+    l.r = r;
+    markPending(l.draw, r);
+}
+
+bool OverlayCompositor::setText(int slot, int x, int y, const char *text, uint16_t fg, uint16_t bg, int scale)
+{
+    if (slot < 0 || slot >= MAX_LAYERS || !text)
+        return false;
+    const size_t len = strlen(text);
+    scale = std::max(scale, 1);
+    if (len == 0 || len > MAX_TEXT || !validRect((int)len * 8 * scale, 8 * scale))
+        return false;
+
+    Layer &l = layers_[slot];
+    if (l.kind == Kind::TEXT && l.r.x == x && l.r.y == y && l.scale == scale && l.fg == fg && l.bg == bg &&
+        strcmp(l.text, text) == 0)
+        return true; // already shown
+
+    place(l, Kind::TEXT, x, y, (int)len * 8 * scale, 8 * scale);
+    memcpy(l.text, text, len + 1);
+    l.fg = fg;
+    l.bg = bg;
+    l.scale = (uint8_t)scale;
+    return true;
+}
+
+bool OverlayCompositor::setIcon(int slot, int x, int y, int w, int h, const uint8_t *rle, const uint16_t palette[4])
+{
+    if (slot < 0 || slot >= MAX_LAYERS || !rle || !palette || !validRect(w, h) || w * h > MAX_ICON_PX)
+        return false;
+
+    Layer &l = layers_[slot];
+    if (l.kind == Kind::ICON && l.rle == rle && l.r.x == x && l.r.y == y && l.r.w == w && l.r.h == h &&
+        memcmp(l.palette, palette, sizeof(l.palette)) == 0)
+        return true;
+
+    place(l, Kind::ICON, x, y, w, h);
+    memcpy(l.palette, palette, sizeof(l.palette));
+    l.rle = rle;
+
+    // Unpack once to 2 bpp indices: compose() then indexes pixels directly
+    memset(l.px, 0, sizeof(l.px));
+    const int total = w * h;
+    int n = 0;
+    for (const uint8_t *src = rle; n < total && src[0] != 0; src += 2)
+    {
+        const uint8_t v = src[1] & 0x03;
+        for (int i = 0; i < src[0] && n < total; i++, n++)
+            l.px[n >> 2] |= (uint8_t)(v << ((n & 3) * 2));
+    }
+    return true;
+}
+
+bool OverlayCompositor::setBar(int slot, int x, int y, int w, int h, uint8_t percent, uint16_t fg, uint16_t bg)
+{
+    if (slot < 0 || slot >= MAX_LAYERS || !validRect(w, h))
+        return false;
+    percent = std::min<uint8_t>(percent, 100);
+
+    Layer &l = layers_[slot];
+    if (l.kind == Kind::BAR && l.r.x == x && l.r.y == y && l.r.w == w && l.r.h == h && l.fg == fg &&
+        l.bg == bg && l.percent == percent)
+        return true;
+
+    place(l, Kind::BAR, x, y, w, h);
+    l.percent = percent;
+    l.fg = fg;
+    l.bg = bg;
+    return true;
+}
+
+void OverlayCompositor::hide(int slot)
+{
+    if (slot < 0 || slot >= MAX_LAYERS)
+        return;
+    Layer &l = layers_[slot];
+    if (l.kind == Kind::NONE)
+        return;
+    markPending(l.erase, l.r);
+    l.draw.on = false;
+    l.kind = Kind::NONE;
+    l.rle = nullptr;
+}
+
+void OverlayCompositor::hideAll()
+{
+    for (int i = 0; i < MAX_LAYERS; i++)
+        hide(i);
+}
+
+bool OverlayCompositor::visible(int slot) const
+{
+    return slot >= 0 && slot < MAX_LAYERS && layers_[slot].kind != Kind::NONE;
+}
+
+void OverlayCompositor::invalidate()
+{
+    for (auto &l : layers_)
+    {
+        if (l.kind != Kind::NONE)
+            markPending(l.draw, l.r);
+    }
+}
+
+// ============================================================================
+// Pending bookkeeping
+// ============================================================================
+void OverlayCompositor::markPending(Pending &p, const Rect &r)
+{
+    p.r = r;
+    p.on = !r.empty();
+    p.rows_sent = 0;
+}
+
+// Rows of p inside the batch count as sent when the batch spans all of its
+// columns (a narrower dirty rect leaves the rest of the row stale)
+void OverlayCompositor::markSent(Pending &p, int x0, int y0, int w, int rows)
+{
+    if (!p.on || p.r.x < x0 || p.r.x + p.r.w > x0 + w)
+        return;
+    const int ry0 = std::max<int>(y0, p.r.y);
+    const int ry1 = std::min<int>(y0 + rows, p.r.y + p.r.h);
+    if (ry0 >= ry1)
+        return;
+    p.rows_sent |= rowMask(ry1 - ry0) << (ry0 - p.r.y);
+    if (p.rows_sent == rowMask(p.r.h))
+        p.on = false;
+}
+
+bool OverlayCompositor::hasPending() const
+{
+    for (const auto &l : layers_)
+    {
+        if (l.draw.on || l.erase.on)
+            return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// Compose (scanline batch)
+// ============================================================================
+void OverlayCompositor::blend(const Layer &l, int x0, int y0, int w, int rows, uint16_t *buf)
+{
+    const Rect &r = l.r;
+    const int cx0 = std::max<int>(x0, r.x);
+    const int cx1 = std::min<int>(x0 + w, r.x + r.w);
+    const int cy0 = std::max<int>(y0, r.y);
+    const int cy1 = std::min<int>(y0 + rows, r.y + r.h);
+    if (cx0 >= cx1 || cy0 >= cy1)
+        return;
+
+    for (int y = cy0; y < cy1; y++)
+    {
+        const int ly = y - r.y;
+        uint16_t *dst = buf + (size_t)(y - y0) * w + (cx0 - x0);
+        switch (l.kind)
+        {
+        case Kind::TEXT:
+        {
+            const int glyph_row = ly / l.scale;
+            for (int x = cx0; x < cx1; x++)
+            {
+                const int tx = x - r.x;
+                const uint8_t bits = glyph(l.text[tx / (8 * l.scale)])[glyph_row];
+                *dst++ = (bits & (0x80 >> ((tx / l.scale) & 7))) ? l.fg : l.bg;
+            }
+            break;
+        }
+        case Kind::ICON:
+        {
+            int idx = ly * r.w + (cx0 - r.x);
+            for (int x = cx0; x < cx1; x++, idx++, dst++)
+            {
+                const uint8_t v = (l.px[idx >> 2] >> ((idx & 3) * 2)) & 0x03;
+                if (v)
+                    *dst = l.palette[v];
+            }
+            break;
+        }
+        case Kind::BAR:
+        {
+            const int fill_x = r.x + r.w * l.percent / 100;
+            for (int x = cx0; x < cx1; x++)
+                *dst++ = x < fill_x ? l.fg : l.bg;
+            break;
+        }
+        case Kind::NONE:
+            return;
+        }
+    }
+}
+
+void OverlayCompositor::compose(int x0, int y0, int w, int rows, uint16_t *buf)
+{
+    if (!buf || w <= 0 || rows <= 0)
+        return;
+    for (auto &l : layers_)
+    {
+        if (l.kind != Kind::NONE)
+            blend(l, x0, y0, w, rows, buf);
+        markSent(l.draw, x0, y0, w, rows);
+        markSent(l.erase, x0, y0, w, rows);
+    }
+}
+
+// ============================================================================
+// Standalone push (layer not covered by an animation batch)
+// ============================================================================
+void OverlayCompositor::pushRect(DisplayDriver &drv, Rect r)
+{
+    // Clip to the panel
+    const int x0 = std::max<int>(r.x, 0);
+    const int y0 = std::max<int>(r.y, 0);
+    const int x1 = std::min<int>(r.x + r.w, drv.width());
+    const int y1 = std::min<int>(r.y + r.h, drv.height());
+    if (x0 >= x1 || y0 >= y1)
+        return;
+    const int w = x1 - x0;
+    const size_t row_bytes = (size_t)w * sizeof(uint16_t);
+
+    // Async DMA buffers when a row fits, else one row at a time
+    const bool use_async = drv.pixelBufferBytes() >= row_bytes;
+    const int strip_rows = use_async ? (int)(drv.pixelBufferBytes() / row_bytes) : 1;
+
+    drv.setWindow(x0, y0, x1 - 1, y1 - 1);
+    for (int y = y0; y < y1; y += strip_rows)
+    {
+        const int rows = std::min(strip_rows, y1 - y);
+        uint16_t *buf = use_async ? drv.acquirePixelBuffer() : row_buf_;
+        if (!buf)
+            break;
+        std::fill(buf, buf + (size_t)rows * w, background_);
+        compose(x0, y, w, rows, buf);
+        if (use_async)
+            drv.queuePixels(buf, rows * row_bytes);
+        else
+            drv.writePixels(buf, rows * row_bytes);
+    }
+    if (use_async)
+        drv.flushPixels();
+    standalone_pushes_++;
+}
+
+void OverlayCompositor::flushPending(DisplayDriver &drv)
+{
+    // Erases first: a layer moved onto its old area is drawn last
+    for (auto &l : layers_)
+    {
+        if (l.erase.on)
+            pushRect(drv, l.erase.r);
+        l.erase.on = false;
+    }
+    for (auto &l : layers_)
+    {
+        if (l.draw.on)
+            pushRect(drv, l.draw.r);
+        l.draw.on = false;
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class DisplayDriver;
+
+/**
+ * OverlayCompositor
+ * ============================================================================
+ * Lớp phủ nhỏ (battery %, icon trạng thái, thanh tiến độ) trộn thẳng vào
+ * scanline batch của AnimationPlayer trước khi batch đi SPI, thay vì vẽ đè
+ * sau render():
+ *  - frame animation kế tiếp không xoá overlay (không nháy),
+ *  - vùng overlay nằm trong frame chỉ đi SPI một lần mỗi frame.
+ *
+ * Layer có chỗ cố định (slot 0..MAX_LAYERS-1), cao tối đa MAX_LAYER_H hàng
+ * (mỗi hàng một bit "đã đi SPI"). Đổi nội dung / vị trí / ẩn → layer
+ * "pending": nếu một batch animation phủ hết layer, nó lên màn hình cùng
+ * batch đó; phần còn lại flushPending() tự đẩy riêng (vd. overlay ở thanh
+ * trên, ngoài vùng animation, hoặc animation đang đứng yên).
+ *
+ * Chỉ display task gọi (không thread-safe).
+ */
+class OverlayCompositor
+{
+public:
+    static constexpr int MAX_LAYERS = 4;
+    static constexpr int MAX_LAYER_W = 256;
+    static constexpr int MAX_LAYER_H = 32;
+    static constexpr int MAX_TEXT = 8;
+    static constexpr int MAX_ICON_PX = 32 * 32;
+
+    // Text box (len*8*scale x 8*scale), fg glyphs on an opaque bg.
+    bool setText(int slot, int x, int y, const char *text, uint16_t fg, uint16_t bg, int scale = 1);
+    // 2-bit RLE icon ([count, value] pairs); value 0 is transparent, 1..3
+    // map to palette[1..3]. At most MAX_ICON_PX pixels.
+    bool setIcon(int slot, int x, int y, int w, int h, const uint8_t *rle, const uint16_t palette[4]);
+    // Horizontal bar filled to percent: fg on the left, bg on the right.
+    bool setBar(int slot, int x, int y, int w, int h, uint8_t percent, uint16_t fg, uint16_t bg);
+    void hide(int slot);
+    void hideAll();
+    bool visible(int slot) const;
+
+    // Blend every visible layer into one batch of screen pixels: columns
+    // [x0, x0 + w) of rows [y0, y0 + rows), row stride w. Pending rows that
+    // this batch fully covers count as on screen.
+    void compose(int x0, int y0, int w, int rows, uint16_t *buf);
+
+    bool hasPending() const;
+    // Push what compose() has not delivered yet: changed layers drawn over
+    // background(), hidden / moved ones filled with it.
+    void flushPending(DisplayDriver &drv);
+    // Panel content was replaced (clear, text screen...): redraw every layer.
+    void invalidate();
+
+    // Color under transparent icon pixels and erased layers (screen clear)
+    void setBackground(uint16_t color) { background_ = color; }
+    uint16_t background() const { return background_; }
+
+    // Layers (or erased areas) pushed on their own, outside an animation batch
+    uint32_t standalonePushes() const { return standalone_pushes_; }
+
+private:
+    enum class Kind : uint8_t { NONE, TEXT, ICON, BAR };
+
+    struct Rect
+    {
+        int16_t x = 0, y = 0, w = 0, h = 0;
+        bool empty() const { return w <= 0 || h <= 0; }
+        bool operator==(const Rect &o) const { return x == o.x && y == o.y && w == o.w && h == o.h; }
+    };
+
+    // Rect waiting for its pixels: one bit per row already sent
+    struct Pending
+    {
+        Rect r;
+        bool on = false;
+        uint32_t rows_sent = 0;
+    };
+
+    struct Layer
+    {
+        Kind kind = Kind::NONE;
+        Rect r;
+        uint16_t fg = 0xFFFF;
+        uint16_t bg = 0x0000;
+        uint8_t scale = 1;
+        uint8_t percent = 0;
+        char text[MAX_TEXT + 1] = {};
+        uint16_t palette[4] = {};
+        const uint8_t *rle = nullptr;     // icon source (change detection)
+        uint8_t px[MAX_ICON_PX / 4] = {}; // icon, 2 bpp packed
+        Pending draw;                     // new content
+        Pending erase;                    // area left by hide / move
+    };
+
+    static bool validRect(int w, int h) { return w > 0 && h > 0 && w <= MAX_LAYER_W && h <= MAX_LAYER_H; }
+    // Replace slot's geometry; the old area (if any) becomes an erase
+    void place(Layer &l, Kind kind, int x, int y, int w, int h);
+    static void markPending(Pending &p, const Rect &r);
+    static void markSent(Pending &p, int x0, int y0, int w, int rows);
+    // Layer pixels in [x0, x0 + w) x [y0, y0 + rows) over buf (stride w)
+    static void blend(const Layer &l, int x0, int y0, int w, int rows, uint16_t *buf);
+    // Send r on its own: background + every layer over it
+    void pushRect(DisplayDriver &drv, Rect r);
+
+    Layer layers_[MAX_LAYERS];
+    uint16_t background_ = 0x0000;
+    uint16_t row_buf_[MAX_LAYER_W] = {}; // push fallback without DMA buffers
+    uint32_t standalone_pushes_ = 0;
+};
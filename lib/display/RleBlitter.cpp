@@ -0,0 +1,116 @@
+#include "RleBlitter.hpp"
+
+#include "esp_attr.h"
+#include "esp_cpu.h"
+
+const uint16_t RleBlitter::GRAY_PALETTE[4] = {0x0000, 0x52AA, 0xAD55, 0xFFFF};
+
+namespace
+{
+    // Run of one color: align to 4 bytes, then paired 32-bit stores
+    inline void IRAM_ATTR fillRun(uint16_t *dst, int n, uint16_t color, uint32_t pair)
+    {
+        if ((reinterpret_cast<uintptr_t>(dst) & 2) && n > 0)
+        {
+            *dst++ = color;
+            n--;
+        }
+        uint32_t *d32 = reinterpret_cast<uint32_t *>(dst);
+        for (int i = n >> 1; i > 0; i--)
+            *d32++ = pair;
+        if (n & 1)
+            *reinterpret_cast<uint16_t *>(d32) = color;
+    }
+} // namespace
+
+void RleBlitter::setPalette(const uint16_t colors[4])
+{
+    for (int i = 0; i < 4; i++)
+    {
+        color_[i] = colors[i];
+        pair_[i] = static_cast<uint32_t>(colors[i]) | (static_cast<uint32_t>(colors[i]) << 16);
+    }
+}
+
+int IRAM_ATTR RleBlitter::decodeSpan(Cursor &cur, int n, uint16_t *out) const
+{
+    int written = 0;
+    while (written < n)
+    {
+        if (cur.run_left == 0)
+        {
+            if (!cur.src)
+                break;
+            const uint8_t count = cur.src[0];
+            if (count == 0)
+            {
+                cur.src = nullptr; // end of stream
+                break;
+            }
+            cur.value = cur.src[1] & 0x03;
+            cur.run_left = count;
+            cur.src += 2;
+        }
+        int take = n - written;
+        if (take > cur.run_left)
+            take = cur.run_left;
+        fillRun(out + written, take, color_[cur.value], pair_[cur.value]);
+        written += take;
+        cur.run_left -= take;
+    }
+    return written;
+}
+
+void IRAM_ATTR RleBlitter::skip(Cursor &cur, int n)
+{
+    while (n > 0)
+    {
+        if (cur.run_left == 0)
+        {
+            if (!cur.src || cur.src[0] == 0)
+            {
+                cur.src = nullptr;
+                return;
+            }
+            cur.value = cur.src[1] & 0x03;
+            cur.run_left = cur.src[0];
+            cur.src += 2;
+        }
+        const int take = n < cur.run_left ? n : cur.run_left;
+        cur.run_left -= take;
+        n -= take;
+    }
+}
+
+int RleBlitter::decode(Cursor &cur, int n, uint16_t *out)
+{
+    if (!out || n <= 0)
+        return 0;
+    const uint32_t t0 = esp_cpu_get_ccount();
+    const int written = decodeSpan(cur, n, out);
+    stats_.cycles += esp_cpu_get_ccount() - t0;
+    stats_.pixels += written;
+    return written;
+}
+
+int RleBlitter::decodeRows(Cursor &cur, int src_w, int clip_x, int clip_w, int rows, uint16_t *out)
+{
+    if (!out || rows <= 0 || clip_w <= 0 || clip_x < 0 || clip_x + clip_w > src_w)
+        return 0;
+    // Unclipped: rows are contiguous in the stream and in out
+    if (clip_x == 0 && clip_w == src_w)
+        return decode(cur, rows * src_w, out);
+
+    const uint32_t t0 = esp_cpu_get_ccount();
+    const int right = src_w - clip_x - clip_w;
+    int written = 0;
+    for (int r = 0; r < rows && cur.src; r++)
+    {
+        skip(cur, clip_x);
+        written += decodeSpan(cur, clip_w, out + written);
+        skip(cur, right);
+    }
+    stats_.cycles += esp_cpu_get_ccount() - t0;
+    stats_.pixels += written;
+    return written;
+}
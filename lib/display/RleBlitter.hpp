@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * RleBlitter
+ * ============================================================================
+ * Decoder RLE 2-bit dùng chung cho animation (AnimationPlayer) và icon
+ * (DisplayDriver::drawRLE2bitIcon: pin, sạc, logo...).
+ *
+ * Stream: cặp [count, value] (count 1..255 pixel, value & 3 = mức xám),
+ * row-major, run được phép vắt qua hàng; count = 0 → hết stream.
+ *
+ * - LUT 4 màu RGB565 + 4 cặp pixel 32 bit dựng một lần ở setPalette(), không
+ *   tính màu mỗi run.
+ * - Run ghi bằng store 32 bit (2 pixel / lần) sau khi căn địa chỉ; kernel
+ *   nằm trong IRAM (không miss flash cache khi SPI DMA đang chạy).
+ * - Clip theo cột: decodeRows() giữ cột [clip_x, clip_x + clip_w) của mỗi
+ *   hàng, phần ngoài chỉ trượt cursor; skip() bỏ hàng phía trên vùng clip.
+ *
+ * Caller lo batch nhiều hàng vào buffer DMA cố định (acquirePixelBuffer) và
+ * window SPI. stats(): cycles và pixel đã decode (cycles/pixel).
+ */
+class RleBlitter
+{
+public:
+    // Resumable position in the [count, value] stream (across batches)
+    struct Cursor
+    {
+        const uint8_t *src = nullptr; // next pair; nullptr = stream ended
+        uint16_t run_left = 0;        // pixels left in the current run
+        uint8_t value = 0;            // 2-bit value of the current run
+    };
+
+    struct Stats
+    {
+        uint64_t cycles = 0;
+        uint64_t pixels = 0;
+        // x100 to keep two decimals without float
+        uint32_t cyclesPerPixelX100() const { return pixels ? static_cast<uint32_t>(cycles * 100 / pixels) : 0; }
+    };
+
+    // Default gray ramp (0, 85, 170, 255)
+    static const uint16_t GRAY_PALETTE[4];
+
+    RleBlitter() { setPalette(GRAY_PALETTE); }
+
+    void setPalette(const uint16_t colors[4]);
+
+    // n pixels (row-major, unclipped) into out; returns pixels written
+    // (< n when the stream ends).
+    int decode(Cursor &cur, int n, uint16_t *out);
+
+    // `rows` rows of a src_w wide image, keeping columns
+    // [clip_x, clip_x + clip_w) packed in out (rows x clip_w). Returns
+    // pixels written.
+    int decodeRows(Cursor &cur, int src_w, int clip_x, int clip_w, int rows, uint16_t *out);
+
+    // Advance the cursor by n pixels without writing.
+    static void skip(Cursor &cur, int n);
+
+    const Stats &stats() const { return stats_; }
+    void clearStats() { stats_ = Stats{}; }
+
+private:
+    int decodeSpan(Cursor &cur, int n, uint16_t *out) const;
+
+    uint16_t color_[4];
+    uint32_t pair_[4]; // color | color << 16
+    Stats stats_{};
+};
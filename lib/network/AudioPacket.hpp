@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Audio packet header (uplink + downlink)
+ * ============================================================================
+ * Mỗi WS binary message mang audio = 1 header 12 byte (little-endian) +
+ * payload là N frame codec liền nhau (ADPCM: byte stream; codec framed: các
+ * record [u16 LE len][packet]).
+ *
+ *   off  size  field
+ *   0    1     version (VERSION)
+ *   1    1     codec   (CodecId)
+ *   2    1     flags   (FLAG_*)
+ *   3    1     kbps    (bitrate của payload, 0 = mặc định của codec)
+ *   4    2     session (1 utterance uplink / 1 câu TTS downlink)
+ *   6    2     seq     (tăng 1 mỗi packet trong session, wraps)
+ *   8    4     timestamp ms của mẫu đầu payload (clock của bên gửi)
+ *
+ * kbps (uplink, bitrate thích nghi theo link): Opus tự mô tả trong TOC nên
+ * chỉ để thông tin; ADPCM 4 bit/mẫu → sample rate = kbps * 250 Hz (64 =
+ * 16 kHz, 32 = 8 kHz). Thiết bị chỉ hạ ADPCM xuống 8 kHz khi server đã trả
+ * "AUDIO_UL_ADAPT:1". Sender cũ ghi 0 ở byte này.
+ *
+ * Bên nhận dùng seq để phát hiện mất/đảo packet, session để biết luồng mới,
+ * codec để từ chối payload không giải được, FLAG_EOU để xả jitter buffer
+ * ngay thay vì chờ timeout.
+ *
+ * FLAG_SYNC (downlink ADPCM, khi thiết bị báo "audio_dl_sync"): ngay sau
+ * header là 4 byte state của encoder tại mẫu đầu payload
+ *   12   2     predictor (int16)
+ *   14   1     step index (0..88)
+ *   15   1     reserved (0)
+ * → decoder khớp lại sau gói mất / cụt thay vì lệch tới hết câu.
+ *
+ * FLAG_CANCEL (uplink, khi thiết bị báo "audio_ul_cancel"): packet chỉ có
+ * header, kèm FLAG_EOU, cùng session → người dùng đã hủy lượt nói ngay trên
+ * thiết bị (lệnh giọng nói cục bộ); server bỏ utterance, kể cả khi EOU của
+ * nó đã tới trước đó, và không trả lời.
+ *
+ * Uplink luôn có header. Downlink có header khi server báo "AUDIO_PROTO:2"
+ * sau handshake (server cũ gửi ADPCM trần vẫn chạy).
+ */
+namespace audio_packet
+{
+    constexpr uint8_t VERSION = 2;
+    constexpr size_t HEADER_BYTES = 12;
+
+    enum CodecId : uint8_t
+    {
+        CODEC_UNKNOWN = 0,
+        CODEC_ADPCM = 1, // IMA ADPCM 4-bit, byte stream
+        CODEC_OPUS = 2,  // [u16 LE len][packet] records
+    };
+
+    constexpr uint8_t FLAG_EOU = 0x01; // end of utterance / end of TTS stream
+    constexpr uint8_t FLAG_GAP = 0x02; // sender dropped frames before this packet
+    constexpr uint8_t FLAG_SYNC = 0x04; // ADPCM decoder state follows the header
+    constexpr uint8_t FLAG_CANCEL = 0x08; // uplink: device cancelled the turn, drop the utterance
+
+    constexpr size_t SYNC_BYTES = 4;
+
+    // Header + optional sync state: where the payload starts
+    constexpr size_t headerBytes(uint8_t flags)
+    {
+        return HEADER_BYTES + ((flags & FLAG_SYNC) ? SYNC_BYTES : 0);
+    }
+
+    struct Header
+    {
+        uint8_t codec = CODEC_UNKNOWN;
+        uint8_t flags = 0;
+        uint8_t kbps = 0;
+        uint16_t session = 0;
+        uint16_t seq = 0;
+        uint32_t timestamp_ms = 0;
+        // FLAG_SYNC only
+        int16_t sync_predictor = 0;
+        uint8_t sync_index = 0;
+    };
+
+    inline void write(uint8_t *dst, const Header &h)
+    {
+        dst[0] = VERSION;
+        dst[1] = h.codec;
+        dst[2] = h.flags;
+        dst[3] = h.kbps;
+        dst[4] = static_cast<uint8_t>(h.session & 0xFF);
+        dst[5] = static_cast<uint8_t>(h.session >> 8);
+        dst[6] = static_cast<uint8_t>(h.seq & 0xFF);
+        dst[7] = static_cast<uint8_t>(h.seq >> 8);
+        dst[8] = static_cast<uint8_t>(h.timestamp_ms & 0xFF);
+        dst[9] = static_cast<uint8_t>((h.timestamp_ms >> 8) & 0xFF);
+        dst[10] = static_cast<uint8_t>((h.timestamp_ms >> 16) & 0xFF);
+        dst[11] = static_cast<uint8_t>(h.timestamp_ms >> 24);
+    }
+
+    // False if too short (sync state included) or another protocol version.
+    inline bool parse(const uint8_t *src, size_t len, Header &h)
+    {
+        if (!src || len < HEADER_BYTES || src[0] != VERSION)
+            return false;
+        h.codec = src[1];
+        h.flags = src[2];
+        h.kbps = src[3];
+        h.session = static_cast<uint16_t>(src[4] | (src[5] << 8));
+        h.seq = static_cast<uint16_t>(src[6] | (src[7] << 8));
+        h.timestamp_ms = static_cast<uint32_t>(src[8]) | (static_cast<uint32_t>(src[9]) << 8) |
+                         (static_cast<uint32_t>(src[10]) << 16) | (static_cast<uint32_t>(src[11]) << 24);
+        if (h.flags & FLAG_SYNC)
+        {
+            if (len < HEADER_BYTES + SYNC_BYTES)
+                return false;
+            h.sync_predictor = static_cast<int16_t>(src[12] | (src[13] << 8));
+            h.sync_index = src[14];
+        }
+        return true;
+    }
+
+    // Codec name (AudioCodec::name()) → wire id.
+    inline CodecId codecId(const char *name)
+    {
+        if (!name)
+            return CODEC_UNKNOWN;
+        if (strcmp(name, "adpcm") == 0)
+            return CODEC_ADPCM;
+        if (strcmp(name, "opus") == 0)
+            return CODEC_OPUS;
+        return CODEC_UNKNOWN;
+    }
+} // namespace audio_packet
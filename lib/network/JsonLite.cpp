@@ -0,0 +1,864 @@
+#include "JsonLite.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace jsonlite
+{
+    Format detectFormat(std::string_view data)
+    {
+        for (char ch : data)
+        {
+            const unsigned char c = static_cast<unsigned char>(ch);
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r')
+                continue;
+            // fixmap 0x80-0x8f, map16 0xde, map32 0xdf
+            if ((c >= 0x80 && c <= 0x8f) || c == 0xde || c == 0xdf)
+                return Format::MSGPACK;
+            break;
+        }
+        return Format::JSON;
+    }
+
+    const char *formatName(Format f)
+    {
+        return f == Format::MSGPACK ? "msgpack" : "json";
+    }
+
+    // ======================================================================
+    // Writer
+    // ======================================================================
+    Writer::Writer(char *buf, size_t cap, Format fmt) : buf_(buf), cap_(cap), fmt_(fmt)
+    {
+        if (cap_ > 0)
+            buf_[0] = '\0';
+        else
+            overflow_ = true;
+    }
+
+    void Writer::put(char c)
+    {
+        if (len_ + 1 >= cap_)
+        {
+            overflow_ = true;
+            return;
+        }
+        buf_[len_++] = c;
+        buf_[len_] = '\0';
+    }
+
+    void Writer::put(std::string_view s)
+    {
+        if (len_ + s.size() >= cap_)
+        {
+            overflow_ = true;
+            return;
+        }
+        memcpy(buf_ + len_, s.data(), s.size());
+        len_ += s.size();
+        buf_[len_] = '\0';
+    }
+
+    void Writer::putEscaped(std::string_view s)
+    {
+        static const char HEX[] = "0123456789abcdef";
+        put('"');
+        for (char ch : s)
+        {
+            const unsigned char c = static_cast<unsigned char>(ch);
+            switch (c)
+            {
+            case '"':
+                put("\\\"");
+                break;
+            case '\\':
+                put("\\\\");
+                break;
+            case '\n':
+                put("\\n");
+                break;
+            case '\r':
+                put("\\r");
+                break;
+            case '\t':
+                put("\\t");
+                break;
+            default:
+                if (c < 0x20)
+                {
+                    const char esc[6] = {'\\', 'u', '0', '0', HEX[c >> 4], HEX[c & 0xF]};
+                    put(std::string_view(esc, sizeof(esc)));
+                }
+                else
+                {
+                    put(ch);
+                }
+                break;
+            }
+        }
+        put('"');
+    }
+
+    void Writer::mpBE(uint64_t v, int bytes)
+    {
+        for (int i = bytes - 1; i >= 0; i--)
+            put(static_cast<char>((v >> (8 * i)) & 0xFF));
+    }
+
+    void Writer::mpString(std::string_view s)
+    {
+        const size_t n = s.size();
+        if (n < 32)
+        {
+            put(static_cast<char>(0xa0 | n));
+        }
+        else if (n < 256)
+        {
+            put(static_cast<char>(0xd9));
+            mpBE(n, 1);
+        }
+        else if (n < 65536)
+        {
+            put(static_cast<char>(0xda));
+            mpBE(n, 2);
+        }
+        else
+        {
+            put(static_cast<char>(0xdb));
+            mpBE(n, 4);
+        }
+        put(s);
+    }
+
+    void Writer::mpInt(int64_t v)
+    {
+        if (v >= 0)
+        {
+            if (v < 128)
+                put(static_cast<char>(v));
+            else if (v < 256)
+            {
+                put(static_cast<char>(0xcc));
+                mpBE(v, 1);
+            }
+            else if (v < 65536)
+            {
+                put(static_cast<char>(0xcd));
+                mpBE(v, 2);
+            }
+            else if (v <= UINT32_MAX)
+            {
+                put(static_cast<char>(0xce));
+                mpBE(v, 4);
+            }
+            else
+            {
+                put(static_cast<char>(0xcf));
+                mpBE(v, 8);
+            }
+            return;
+        }
+        if (v >= -32)
+            put(static_cast<char>(v)); // negative fixint
+        else if (v >= INT8_MIN)
+        {
+            put(static_cast<char>(0xd0));
+            mpBE(static_cast<uint64_t>(v), 1);
+        }
+        else if (v >= INT16_MIN)
+        {
+            put(static_cast<char>(0xd1));
+            mpBE(static_cast<uint64_t>(v), 2);
+        }
+        else if (v >= INT32_MIN)
+        {
+            put(static_cast<char>(0xd2));
+            mpBE(static_cast<uint64_t>(v), 4);
+        }
+        else
+        {
+            put(static_cast<char>(0xd3));
+            mpBE(static_cast<uint64_t>(v), 8);
+        }
+    }
+
+    void Writer::prefix(const char *key)
+    {
+        if (fmt_ == Format::MSGPACK)
+        {
+            if (depth_ > 0)
+                map_count_[depth_ - 1]++;
+            if (key && depth_ > 0)
+                mpString(key);
+            return;
+        }
+
+        if (depth_ > 0)
+        {
+            const uint32_t bit = 1u << (depth_ - 1);
+            if (has_member_ & bit)
+                put(',');
+            has_member_ |= bit;
+        }
+        if (key)
+        {
+            putEscaped(key);
+            put(':');
+        }
+    }
+
+    Writer &Writer::beginObject()
+    {
+        return beginObject(nullptr);
+    }
+
+    Writer &Writer::beginObject(const char *key)
+    {
+        if (depth_ >= MAX_DEPTH)
+        {
+            overflow_ = true;
+            return *this;
+        }
+        prefix(key);
+        if (fmt_ == Format::MSGPACK)
+        {
+            // map16 placeholder, count patched in endObject()
+            map_pos_[depth_] = len_;
+            map_count_[depth_] = 0;
+            put(static_cast<char>(0xde));
+            put('\0');
+            put('\0');
+            depth_++;
+            return *this;
+        }
+        put('{');
+        depth_++;
+        has_member_ &= ~(1u << (depth_ - 1));
+        return *this;
+    }
+
+    Writer &Writer::endObject()
+    {
+        if (depth_ == 0)
+        {
+            overflow_ = true;
+            return *this;
+        }
+        depth_--;
+        if (fmt_ == Format::MSGPACK)
+        {
+            if (overflow_)
+                return *this;
+            const size_t pos = map_pos_[depth_];
+            const uint16_t count = map_count_[depth_];
+            if (count < 16)
+            {
+                // Compact to a fixmap: everything after the header is this
+                // map's (already final) content, so a plain shift is enough
+                memmove(buf_ + pos + 1, buf_ + pos + 3, len_ - pos - 3);
+                len_ -= 2;
+                buf_[pos] = static_cast<char>(0x80 | count);
+                buf_[len_] = '\0';
+            }
+            else
+            {
+                buf_[pos + 1] = static_cast<char>(count >> 8);
+                buf_[pos + 2] = static_cast<char>(count & 0xFF);
+            }
+            return *this;
+        }
+        put('}');
+        return *this;
+    }
+
+    Writer &Writer::field(const char *key, std::string_view value)
+    {
+        prefix(key);
+        if (fmt_ == Format::MSGPACK)
+            mpString(value);
+        else
+            putEscaped(value);
+        return *this;
+    }
+
+    Writer &Writer::field(const char *key, int64_t value)
+    {
+        prefix(key);
+        if (fmt_ == Format::MSGPACK)
+        {
+            mpInt(value);
+            return *this;
+        }
+        char num[24];
+        auto res = std::to_chars(num, num + sizeof(num), value);
+        put(std::string_view(num, res.ptr - num));
+        return *this;
+    }
+
+    Writer &Writer::field(const char *key, bool value)
+    {
+        prefix(key);
+        if (fmt_ == Format::MSGPACK)
+            put(static_cast<char>(value ? 0xc3 : 0xc2));
+        else
+            put(value ? "true" : "false");
+        return *this;
+    }
+
+    Writer &Writer::fieldFixed(const char *key, double value, int decimals)
+    {
+        prefix(key);
+        if (fmt_ == Format::MSGPACK)
+        {
+            // float32: 5 bytes, plenty for telemetry values
+            const float f = static_cast<float>(value);
+            uint32_t bits;
+            memcpy(&bits, &f, sizeof(bits));
+            put(static_cast<char>(0xca));
+            mpBE(bits, 4);
+            return *this;
+        }
+        if (!std::isfinite(value))
+        {
+            put("null");
+            return *this;
+        }
+        char num[32];
+        int n = snprintf(num, sizeof(num), "%.*f", decimals, value);
+        if (n > 0)
+            put(std::string_view(num, static_cast<size_t>(n) < sizeof(num) ? n : sizeof(num) - 1));
+        return *this;
+    }
+
+    // ======================================================================
+    // Value
+    // ======================================================================
+    // JSON number token → integer part; "2048.0" / "1e3" keep the part
+    // before '.' / 'e'
+    static bool parseInt(std::string_view raw, int64_t &out, bool &integral)
+    {
+        const char *b = raw.data();
+        const char *e = raw.data() + raw.size();
+        auto res = std::from_chars(b, e, out);
+        integral = res.ptr == e;
+        return res.ec == std::errc() && res.ptr != b;
+    }
+
+    bool Value::asU32(uint32_t &out) const
+    {
+        if (type != Type::NUMBER || num < 0 || num > UINT32_MAX)
+            return false;
+        out = static_cast<uint32_t>(num);
+        return true;
+    }
+
+    bool Value::asI32(int32_t &out) const
+    {
+        if (type != Type::NUMBER || num < INT32_MIN || num > INT32_MAX)
+            return false;
+        out = static_cast<int32_t>(num);
+        return true;
+    }
+
+    bool Value::asBool(bool &out) const
+    {
+        if (type != Type::BOOL)
+            return false;
+        out = num != 0;
+        return true;
+    }
+
+    // Resolve one escape at raw[i] ('\\'); appends up to 3 UTF-8 bytes
+    static size_t unescapeAt(std::string_view raw, size_t i, char *out, size_t &consumed)
+    {
+        consumed = 2;
+        if (i + 1 >= raw.size())
+        {
+            consumed = 1;
+            return 0;
+        }
+        switch (raw[i + 1])
+        {
+        case 'n':
+            out[0] = '\n';
+            return 1;
+        case 'r':
+            out[0] = '\r';
+            return 1;
+        case 't':
+            out[0] = '\t';
+            return 1;
+        case 'b':
+            out[0] = '\b';
+            return 1;
+        case 'f':
+            out[0] = '\f';
+            return 1;
+        case 'u':
+        {
+            if (i + 6 > raw.size())
+                return 0;
+            unsigned cp = 0;
+            auto res = std::from_chars(raw.data() + i + 2, raw.data() + i + 6, cp, 16);
+            if (res.ptr != raw.data() + i + 6)
+                return 0;
+            consumed = 6;
+            // BMP only; surrogate halves come out as-is (3 bytes each)
+            if (cp < 0x80)
+            {
+                out[0] = static_cast<char>(cp);
+                return 1;
+            }
+            if (cp < 0x800)
+            {
+                out[0] = static_cast<char>(0xC0 | (cp >> 6));
+                out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+                return 2;
+            }
+            out[0] = static_cast<char>(0xE0 | (cp >> 12));
+            out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 3;
+        }
+        default: // \" \\ \/
+            out[0] = raw[i + 1];
+            return 1;
+        }
+    }
+
+    bool Value::equals(std::string_view s) const
+    {
+        if (type != Type::STRING)
+            return false;
+        if (!escaped)
+            return raw == s;
+
+        size_t j = 0;
+        for (size_t i = 0; i < raw.size();)
+        {
+            char tmp[3];
+            size_t n, used;
+            if (raw[i] == '\\')
+            {
+                n = unescapeAt(raw, i, tmp, used);
+            }
+            else
+            {
+                tmp[0] = raw[i];
+                n = used = 1;
+            }
+            if (j + n > s.size() || memcmp(s.data() + j, tmp, n) != 0)
+                return false;
+            j += n;
+            i += used;
+        }
+        return j == s.size();
+    }
+
+    size_t Value::copyString(char *dst, size_t cap) const
+    {
+        if (cap == 0)
+            return 0;
+        size_t j = 0;
+        if (type == Type::STRING)
+        {
+            for (size_t i = 0; i < raw.size();)
+            {
+                char tmp[3];
+                size_t n, used;
+                if (raw[i] == '\\')
+                {
+                    n = unescapeAt(raw, i, tmp, used);
+                }
+                else
+                {
+                    tmp[0] = raw[i];
+                    n = used = 1;
+                }
+                if (j + n >= cap)
+                    break; // never split a UTF-8 sequence
+                memcpy(dst + j, tmp, n);
+                j += n;
+                i += used;
+            }
+        }
+        dst[j] = '\0';
+        return j;
+    }
+
+    // ======================================================================
+    // ObjectReader
+    // ======================================================================
+    ObjectReader::ObjectReader(std::string_view data, Format fmt) : in_(data), fmt_(fmt)
+    {
+        if (fmt_ == Format::MSGPACK)
+        {
+            uint64_t n = 0;
+            const unsigned char c = in_.empty() ? 0 : static_cast<unsigned char>(in_[0]);
+            pos_ = 1;
+            if (c >= 0x80 && c <= 0x8f)
+                n = c & 0x0f;
+            else if (!((c == 0xde && mpBE(2, n)) || (c == 0xdf && mpBE(4, n))))
+            {
+                error_ = true;
+                done_ = true;
+                return;
+            }
+            mp_left_ = static_cast<uint32_t>(n);
+            return;
+        }
+
+        skipWs();
+        if (pos_ >= in_.size() || in_[pos_] != '{')
+        {
+            error_ = true;
+            done_ = true;
+            return;
+        }
+        pos_++;
+    }
+
+    void ObjectReader::skipWs()
+    {
+        while (pos_ < in_.size() &&
+               (in_[pos_] == ' ' || in_[pos_] == '\t' || in_[pos_] == '\n' || in_[pos_] == '\r'))
+            pos_++;
+    }
+
+    bool ObjectReader::readString(std::string_view &out, bool &escaped)
+    {
+        // at the opening quote
+        escaped = false;
+        const size_t start = ++pos_;
+        while (pos_ < in_.size())
+        {
+            const char c = in_[pos_];
+            if (c == '\\')
+            {
+                escaped = true;
+                pos_ += 2;
+                continue;
+            }
+            if (c == '"')
+            {
+                out = in_.substr(start, pos_ - start);
+                pos_++;
+                return true;
+            }
+            pos_++;
+        }
+        return false;
+    }
+
+    bool ObjectReader::skipNested()
+    {
+        int depth = 0;
+        while (pos_ < in_.size())
+        {
+            const char c = in_[pos_];
+            if (c == '"')
+            {
+                std::string_view s;
+                bool esc;
+                if (!readString(s, esc))
+                    return false;
+                continue;
+            }
+            if (c == '{' || c == '[')
+                depth++;
+            else if (c == '}' || c == ']')
+            {
+                if (--depth == 0)
+                {
+                    pos_++;
+                    return true;
+                }
+            }
+            pos_++;
+        }
+        return false;
+    }
+
+    bool ObjectReader::readValue(Value &v)
+    {
+        skipWs();
+        if (pos_ >= in_.size())
+            return false;
+
+        const char c = in_[pos_];
+        const size_t start = pos_;
+        v.escaped = false;
+        if (c == '"')
+        {
+            v.type = Type::STRING;
+            return readString(v.raw, v.escaped);
+        }
+        if (c == '{' || c == '[')
+        {
+            v.type = (c == '{') ? Type::OBJECT : Type::ARRAY;
+            if (!skipNested())
+                return false;
+            v.raw = in_.substr(start, pos_ - start);
+            return true;
+        }
+
+        // Bare token: number / true / false / null
+        while (pos_ < in_.size() && in_[pos_] != ',' && in_[pos_] != '}' && in_[pos_] != ']' &&
+               in_[pos_] != ' ' && in_[pos_] != '\t' && in_[pos_] != '\n' && in_[pos_] != '\r')
+            pos_++;
+        v.raw = in_.substr(start, pos_ - start);
+        if (v.raw == "true" || v.raw == "false")
+        {
+            v.type = Type::BOOL;
+            v.num = (v.raw == "true");
+        }
+        else if (v.raw == "null")
+            v.type = Type::NUL;
+        else if (!v.raw.empty() && (v.raw[0] == '-' || (v.raw[0] >= '0' && v.raw[0] <= '9')))
+        {
+            v.type = Type::NUMBER;
+            if (!parseInt(v.raw, v.num, v.integral))
+                return false;
+        }
+        else
+            return false;
+        return true;
+    }
+
+    bool ObjectReader::next(std::string_view &key, Value &value)
+    {
+        if (done_)
+            return false;
+        if (fmt_ == Format::MSGPACK)
+            return mpNext(key, value);
+
+        skipWs();
+        if (pos_ < in_.size() && in_[pos_] == '}')
+        {
+            pos_++;
+            done_ = true;
+            return false;
+        }
+        if (!first_)
+        {
+            if (pos_ >= in_.size() || in_[pos_] != ',')
+            {
+                error_ = done_ = true;
+                return false;
+            }
+            pos_++;
+            skipWs();
+        }
+        first_ = false;
+
+        bool esc;
+        if (pos_ >= in_.size() || in_[pos_] != '"' || !readString(key, esc))
+        {
+            error_ = done_ = true;
+            return false;
+        }
+        skipWs();
+        if (pos_ >= in_.size() || in_[pos_] != ':')
+        {
+            error_ = done_ = true;
+            return false;
+        }
+        pos_++;
+        value = Value{};
+        if (!readValue(value))
+        {
+            error_ = done_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    // ======================================================================
+    // ObjectReader: MessagePack
+    // ======================================================================
+    bool ObjectReader::mpTake(size_t n, std::string_view &out)
+    {
+        if (n > in_.size() - pos_)
+            return false;
+        out = in_.substr(pos_, n);
+        pos_ += n;
+        return true;
+    }
+
+    bool ObjectReader::mpBE(int bytes, uint64_t &out)
+    {
+        std::string_view b;
+        if (!mpTake(bytes, b))
+            return false;
+        out = 0;
+        for (char c : b)
+            out = (out << 8) | static_cast<unsigned char>(c);
+        return true;
+    }
+
+    // One element at pos_; maps / arrays (depth > 0 or as values) are
+    // skipped whole and returned as raw
+    bool ObjectReader::mpRead(Value &v, int depth)
+    {
+        if (depth > 8 || pos_ >= in_.size())
+            return false;
+
+        const size_t start = pos_;
+        const unsigned char c = static_cast<unsigned char>(in_[pos_++]);
+        uint64_t u = 0;
+        uint64_t len = 0;
+        uint64_t items = 0;
+        bool is_map = false;
+        v.escaped = false;
+        v.integral = true;
+
+        if (c <= 0x7f || c >= 0xe0)
+        {
+            // positive / negative fixint
+            v.type = Type::NUMBER;
+            v.num = static_cast<int8_t>(c);
+            if (c <= 0x7f)
+                v.num = c;
+            v.raw = in_.substr(start, 1);
+            return true;
+        }
+        else if ((c & 0xe0) == 0xa0 || c == 0xd9 || c == 0xda || c == 0xdb)
+        {
+            if ((c & 0xe0) == 0xa0)
+                len = c & 0x1f;
+            else if (!mpBE(c == 0xd9 ? 1 : c == 0xda ? 2 : 4, len))
+                return false;
+            v.type = Type::STRING;
+            return mpTake(len, v.raw);
+        }
+        else if ((c & 0xf0) == 0x80 || c == 0xde || c == 0xdf)
+        {
+            is_map = true;
+            if ((c & 0xf0) == 0x80)
+                items = c & 0x0f;
+            else if (!mpBE(c == 0xde ? 2 : 4, items))
+                return false;
+        }
+        else if ((c & 0xf0) == 0x90 || c == 0xdc || c == 0xdd)
+        {
+            if ((c & 0xf0) == 0x90)
+                items = c & 0x0f;
+            else if (!mpBE(c == 0xdc ? 2 : 4, items))
+                return false;
+        }
+        else
+        {
+            switch (c)
+            {
+            case 0xc0:
+                v.type = Type::NUL;
+                break;
+            case 0xc2:
+            case 0xc3:
+                v.type = Type::BOOL;
+                v.num = (c == 0xc3);
+                break;
+            case 0xcc:
+            case 0xcd:
+            case 0xce:
+            case 0xcf:
+                if (!mpBE(1 << (c - 0xcc), u))
+                    return false;
+                v.type = Type::NUMBER;
+                v.num = static_cast<int64_t>(u);
+                v.integral = (c != 0xcf || u <= INT64_MAX);
+                break;
+            case 0xd0:
+            case 0xd1:
+            case 0xd2:
+            case 0xd3:
+            {
+                const int bytes = 1 << (c - 0xd0);
+                if (!mpBE(bytes, u))
+                    return false;
+                // sign-extend
+                const int shift = 64 - 8 * bytes;
+                v.type = Type::NUMBER;
+                v.num = static_cast<int64_t>(u << shift) >> shift;
+                break;
+            }
+            case 0xca:
+            case 0xcb:
+            {
+                double d;
+                if (c == 0xca)
+                {
+                    if (!mpBE(4, u))
+                        return false;
+                    const uint32_t bits = static_cast<uint32_t>(u);
+                    float f;
+                    memcpy(&f, &bits, sizeof(f));
+                    d = f;
+                }
+                else
+                {
+                    if (!mpBE(8, u))
+                        return false;
+                    memcpy(&d, &u, sizeof(d));
+                }
+                if (!std::isfinite(d) || d > 9.2e18 || d < -9.2e18)
+                    return false;
+                v.type = Type::NUMBER;
+                v.num = static_cast<int64_t>(d);
+                v.integral = (static_cast<double>(v.num) == d);
+                break;
+            }
+            case 0xc4: // bin8/16/32: carried as a string of bytes
+            case 0xc5:
+            case 0xc6:
+                if (!mpBE(1 << (c - 0xc4), len))
+                    return false;
+                v.type = Type::STRING;
+                return mpTake(len, v.raw);
+            default: // ext types: not used by the control schema
+                return false;
+            }
+            v.raw = in_.substr(start, pos_ - start);
+            return true;
+        }
+
+        // Nested container: skip its elements
+        v.type = is_map ? Type::OBJECT : Type::ARRAY;
+        const uint64_t n = is_map ? items * 2 : items;
+        for (uint64_t i = 0; i < n; i++)
+        {
+            Value inner;
+            if (!mpRead(inner, depth + 1))
+                return false;
+        }
+        v.raw = in_.substr(start, pos_ - start);
+        return true;
+    }
+
+    bool ObjectReader::mpNext(std::string_view &key, Value &value)
+    {
+        if (mp_left_ == 0)
+        {
+            done_ = true;
+            return false;
+        }
+        mp_left_--;
+
+        Value k;
+        if (!mpRead(k, 1) || k.type != Type::STRING)
+        {
+            error_ = done_ = true;
+            return false;
+        }
+        key = k.raw;
+        value = Value{};
+        if (!mpRead(value, 0))
+        {
+            error_ = done_ = true;
+            return false;
+        }
+        return true;
+    }
+} // namespace jsonlite
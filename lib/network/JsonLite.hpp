@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * JsonLite
+ * ---------------------------------------------------------
+ * JSON không cấp phát cho các message điều khiển của thiết bị (config
+ * command, status, handshake, OTA ACK).
+ *
+ * - Writer: ghi thẳng vào buffer cố định do caller cấp (thường trên stack),
+ *   tự thêm dấu phẩy / escape chuỗi. Hết chỗ → ok() = false, nội dung bị
+ *   cắt nhưng vẫn NUL-terminated.
+ * - ObjectReader: duyệt lần lượt các member cấp 1 của một object (kiểu
+ *   SAX/pull). Value là view trên input: object/array lồng nhau được bỏ qua
+ *   nguyên khối (raw), chuỗi chỉ được unescape khi copyString().
+ *
+ * Cùng API cho MessagePack (Format::MSGPACK): map được ghi với header
+ * map16 rồi vá số phần tử (và thu gọn về fixmap) ở endObject(); số thực ghi
+ * dạng float32. Server chọn encoding (set_encoding), nên call site chỉ đổi
+ * tham số format.
+ *
+ * Chỉ đủ cho schema phẳng của thiết bị, không phải parser JSON tổng quát
+ * (không kiểm tra UTF-8, số dạng mũ chỉ đọc phần nguyên).
+ */
+namespace jsonlite
+{
+    enum class Format : uint8_t
+    {
+        JSON,
+        MSGPACK
+    };
+
+    // By the first byte: '{' → JSON, a msgpack map header → MSGPACK
+    Format detectFormat(std::string_view data);
+    const char *formatName(Format f);
+
+    // ======================================================================
+    // Writer
+    // ======================================================================
+    class Writer
+    {
+    public:
+        Writer(char *buf, size_t cap, Format fmt = Format::JSON);
+
+        Writer &beginObject();
+        Writer &beginObject(const char *key);
+        Writer &endObject();
+
+        Writer &field(const char *key, std::string_view value);
+        Writer &field(const char *key, const char *value) { return field(key, std::string_view(value ? value : "")); }
+        Writer &field(const char *key, int32_t value) { return field(key, static_cast<int64_t>(value)); }
+        Writer &field(const char *key, uint32_t value) { return field(key, static_cast<int64_t>(value)); }
+        Writer &field(const char *key, int64_t value);
+        Writer &field(const char *key, bool value);
+        // Fixed-point number (e.g. latency in ms with one decimal)
+        Writer &fieldFixed(const char *key, double value, int decimals = 1);
+
+        bool ok() const { return !overflow_ && depth_ == 0; }
+        size_t size() const { return len_; }
+        Format format() const { return fmt_; }
+        // JSON only (MessagePack output is binary, use view())
+        const char *c_str() const { return buf_; }
+        std::string_view view() const { return std::string_view(buf_, len_); }
+
+    private:
+        void put(char c);
+        void put(std::string_view s);
+        void putEscaped(std::string_view s);
+        void prefix(const char *key); // comma + "key": / msgpack key
+
+        // MessagePack primitives
+        void mpString(std::string_view s);
+        void mpInt(int64_t v);
+        void mpBE(uint64_t v, int bytes);
+
+        static constexpr int MAX_DEPTH = 8;
+
+        char *buf_;
+        size_t cap_;
+        size_t len_ = 0;
+        Format fmt_;
+        bool overflow_ = false;
+        int depth_ = 0;
+        uint32_t has_member_ = 0; // bit d: object at depth d already has a member
+        // MessagePack: map header offset and member count per open map
+        size_t map_pos_[MAX_DEPTH] = {};
+        uint16_t map_count_[MAX_DEPTH] = {};
+    };
+
+    // ======================================================================
+    // Reader
+    // ======================================================================
+    enum class Type : uint8_t
+    {
+        NONE,
+        STRING,
+        NUMBER,
+        BOOL,
+        NUL,
+        OBJECT,
+        ARRAY
+    };
+
+    struct Value
+    {
+        Type type = Type::NONE;
+        // STRING: between the quotes, still escaped (msgpack: the bytes);
+        // others: the token / encoded element
+        std::string_view raw;
+        bool escaped = false; // STRING contains backslash escapes
+        bool integral = false; // NUMBER fits num exactly (not a fraction / overflow)
+        int64_t num = 0;       // NUMBER integer part, BOOL 0/1
+
+        bool present() const { return type != Type::NONE; }
+        bool isString() const { return type == Type::STRING; }
+        bool isNumber() const { return type == Type::NUMBER; }
+
+        // Integer part of a NUMBER; false for other types / out of range
+        bool asU32(uint32_t &out) const;
+        bool asI32(int32_t &out) const;
+        bool asBool(bool &out) const;
+        // Compare a STRING with a literal (escapes resolved)
+        bool equals(std::string_view s) const;
+        // Unescaped STRING into dst (always NUL-terminated when cap > 0);
+        // returns the length written, truncating at cap - 1
+        size_t copyString(char *dst, size_t cap) const;
+    };
+
+    class ObjectReader
+    {
+    public:
+        explicit ObjectReader(std::string_view data, Format fmt = Format::JSON);
+
+        // Next top-level member (key is raw, escapes not resolved). False at
+        // the end of the object or on malformed input (see error()).
+        bool next(std::string_view &key, Value &value);
+
+        bool error() const { return error_; }
+
+    private:
+        void skipWs();
+        bool readString(std::string_view &out, bool &escaped);
+        bool readValue(Value &v);
+        bool skipNested(); // past a balanced {...} / [...]
+
+        // MessagePack
+        bool mpNext(std::string_view &key, Value &value);
+        bool mpRead(Value &v, int depth);
+        bool mpTake(size_t n, std::string_view &out);
+        bool mpBE(int bytes, uint64_t &out);
+
+        std::string_view in_;
+        size_t pos_ = 0;
+        Format fmt_;
+        bool error_ = false;
+        bool done_ = false;
+        bool first_ = true;
+        uint32_t mp_left_ = 0; // msgpack members still to read
+    };
+} // namespace jsonlite
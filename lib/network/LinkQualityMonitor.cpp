@@ -0,0 +1,90 @@
+#include "LinkQualityMonitor.hpp"
+
+void LinkQualityMonitor::onAssociated()
+{
+    q_ = Quality::UNKNOWN;
+    srssi_x4_ = 0;
+    srtt_ms_ = 0;
+    loss_x4_ = 0;
+    weak_run_ = 0;
+}
+
+LinkQualityMonitor::Quality LinkQualityMonitor::onSample(const Sample &s)
+{
+    if (s.rssi == 0)
+        return q_; // not associated: nothing to judge
+
+    const int32_t rssi_x4 = s.rssi * 4;
+    srssi_x4_ = srssi_x4_ ? (srssi_x4_ * 3 + rssi_x4) / 4 : rssi_x4;
+    if (s.rtt_ms)
+        srtt_ms_ = srtt_ms_ ? (srtt_ms_ * 3 + s.rtt_ms) / 4 : s.rtt_ms;
+    if (s.probed)
+        loss_x4_ = (loss_x4_ * 3 + (s.answered ? 0 : 400)) / 4;
+
+    weak_run_ = rssi() < cfg_.roam_rssi ? static_cast<uint8_t>(weak_run_ < UINT8_MAX ? weak_run_ + 1 : weak_run_) : 0;
+    q_ = classify();
+    return q_;
+}
+
+LinkQualityMonitor::Quality LinkQualityMonitor::classify() const
+{
+    // RSSI class, sticky within hyst_db of the boundary it would cross
+    const int r = rssi();
+    Quality q;
+    if (r >= cfg_.good_rssi || (q_ == Quality::GOOD && r >= cfg_.good_rssi - cfg_.hyst_db))
+        q = Quality::GOOD;
+    else if (r < cfg_.poor_rssi && !(q_ >= Quality::FAIR && r >= cfg_.poor_rssi - cfg_.hyst_db))
+        q = Quality::POOR;
+    else if (q_ == Quality::POOR && r < cfg_.poor_rssi + cfg_.hyst_db)
+        q = Quality::POOR;
+    else
+        q = Quality::FAIR;
+
+    // A strong signal does not help a congested or lossy link
+    const uint32_t loss = lossPct();
+    if (srtt_ms_ > cfg_.rtt_poor_ms || loss > cfg_.loss_poor_pct)
+        return Quality::POOR;
+    if ((srtt_ms_ > cfg_.rtt_fair_ms || loss > cfg_.loss_fair_pct) && q > Quality::FAIR)
+        return Quality::FAIR;
+    return q;
+}
+
+LinkQualityMonitor::Sleep LinkQualityMonitor::sleep() const
+{
+    switch (q_)
+    {
+    case Quality::GOOD:
+        return Sleep::MAX_MODEM;
+    case Quality::POOR:
+        return Sleep::NONE;
+    default:
+        return Sleep::MIN_MODEM; // FAIR, and until the first sample
+    }
+}
+
+bool LinkQualityMonitor::wantRoam(uint32_t now_ms) const
+{
+    if (weak_run_ < cfg_.roam_after)
+        return false;
+    return !roam_tried_ || now_ms - last_roam_ms_ >= cfg_.roam_cooldown_ms;
+}
+
+void LinkQualityMonitor::onRoamAttempt(uint32_t now_ms)
+{
+    roam_tried_ = true;
+    last_roam_ms_ = now_ms;
+    weak_run_ = 0;
+    attempts_++;
+}
+
+const char *LinkQualityMonitor::qualityName(Quality q)
+{
+    static constexpr const char *NAMES[] = {"unknown", "poor", "fair", "good"};
+    return static_cast<uint8_t>(q) < 4 ? NAMES[static_cast<uint8_t>(q)] : "?";
+}
+
+const char *LinkQualityMonitor::sleepName(Sleep s)
+{
+    static constexpr const char *NAMES[] = {"none", "min_modem", "max_modem"};
+    return static_cast<uint8_t>(s) < 3 ? NAMES[static_cast<uint8_t>(s)] : "?";
+}
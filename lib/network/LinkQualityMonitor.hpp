@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * LinkQualityMonitor
+ * ============================================================================
+ * Đánh giá chất lượng link Wi-Fi từ các mẫu định kỳ (NetworkManager, mỗi
+ * link_sample_ms) thay vì chỉ biết "đã nối / đã rớt":
+ *  - RSSI của AP đang nối (esp_wifi_sta_get_ap_info)
+ *  - RTT ping/pong WebSocket
+ *  - tỉ lệ ping không được trả lời trước mẫu kế tiếp (thay cho số lần retry
+ *    802.11, driver không công bố)
+ *
+ * RSSI / RTT / mất ping được làm mượt (EWMA 1/4). Lớp chất lượng:
+ *  - theo RSSI: GOOD >= good_rssi, POOR < poor_rssi, còn lại FAIR; có
+ *    hysteresis hyst_db để không nhảy qua lại quanh ngưỡng;
+ *  - RTT / mất ping cao kéo xuống FAIR hoặc POOR dù RSSI tốt (AP quá tải,
+ *    nhiễu). Ngưỡng RTT rộng: modem sleep tự nó cộng thêm tới một listen
+ *    interval vào RTT lúc rảnh.
+ *
+ * sleep(): độ sâu modem sleep khi rảnh — GOOD → MAX_MODEM (thức theo listen
+ * interval), FAIR → MIN_MODEM (mỗi DTIM), POOR → NONE (không bỏ lỡ beacon /
+ * retry khi link sắp rớt).
+ *
+ * wantRoam(): RSSI mượt < roam_rssi roam_after mẫu liên tiếp và ngoài
+ * cooldown → NetworkManager tìm BSSID cùng SSID mạnh hơn ít nhất
+ * roam_delta_db (roamTargetRssi()) và chuyển sang khi IDLE.
+ *
+ * Không thread-safe: chỉ network task gọi.
+ */
+class LinkQualityMonitor
+{
+public:
+    enum class Quality : uint8_t
+    {
+        UNKNOWN, // no sample since the last association
+        POOR,
+        FAIR,
+        GOOD,
+    };
+
+    enum class Sleep : uint8_t
+    {
+        NONE,      // radio always awake
+        MIN_MODEM, // wake every DTIM
+        MAX_MODEM, // wake every listen interval
+    };
+
+    struct Config
+    {
+        int8_t good_rssi = -60;        // dBm
+        int8_t poor_rssi = -75;
+        uint8_t hyst_db = 3;
+        uint16_t rtt_fair_ms = 600;    // smoothed RTT above → at most FAIR
+        uint16_t rtt_poor_ms = 1500;   // → POOR
+        uint8_t loss_fair_pct = 20;    // smoothed ping loss above → at most FAIR
+        uint8_t loss_poor_pct = 50;    // → POOR
+        int8_t roam_rssi = -70;        // look for a better AP below this
+        uint8_t roam_after = 3;        // consecutive weak samples first
+        uint8_t roam_delta_db = 8;     // candidate must beat us by this much
+        uint32_t roam_cooldown_ms = 120000;
+    };
+
+    struct Sample
+    {
+        int8_t rssi = 0;      // 0 = not associated
+        uint32_t rtt_ms = 0;  // 0 = no new round trip since the last sample
+        bool probed = false;  // a ping went out after the previous sample...
+        bool answered = false; // ...and its pong came back
+    };
+
+    LinkQualityMonitor() = default;
+    explicit LinkQualityMonitor(const Config &cfg) : cfg_(cfg) {}
+
+    const Config &config() const { return cfg_; }
+
+    // New association (other AP, or the same one again): start over; the
+    // roam cooldown and the counters are kept
+    void onAssociated();
+    // One sample; returns the quality from now on
+    Quality onSample(const Sample &s);
+
+    Quality quality() const { return q_; }
+    // Modem sleep depth for the idle profile
+    Sleep sleep() const;
+    int8_t rssi() const { return static_cast<int8_t>(srssi_x4_ / 4); }
+    uint32_t rttMs() const { return srtt_ms_; }
+    uint8_t lossPct() const { return static_cast<uint8_t>(loss_x4_ / 4); }
+
+    // Weak long enough and out of the cooldown
+    bool wantRoam(uint32_t now_ms) const;
+    // A same-SSID AP is worth the reconnect from this RSSI up
+    int8_t roamTargetRssi() const { return static_cast<int8_t>(rssi() + cfg_.roam_delta_db); }
+    // A search started (found something or not): restarts the cooldown
+    void onRoamAttempt(uint32_t now_ms);
+    // The search moved us (directed reconnect) or asked the AP to (802.11v)
+    void onRoamed() { roams_++; }
+    uint32_t roamAttempts() const { return attempts_; }
+    uint32_t roams() const { return roams_; }
+
+    static const char *qualityName(Quality q);
+    static const char *sleepName(Sleep s);
+
+private:
+    Quality classify() const;
+
+    Config cfg_{};
+    Quality q_ = Quality::UNKNOWN;
+    int32_t srssi_x4_ = 0;  // smoothed RSSI * 4 (0 = none yet)
+    uint32_t srtt_ms_ = 0;  // 0 = none yet
+    uint32_t loss_x4_ = 0;  // smoothed ping loss % * 4
+    uint8_t weak_run_ = 0;
+    bool roam_tried_ = false;
+    uint32_t last_roam_ms_ = 0;
+    uint32_t attempts_ = 0;
+    uint32_t roams_ = 0;
+};
@@ -55,7 +55,8 @@ void MqttClient::start()
     // -------------------------------
     cfg.buffer_size = 4096;      // Reduced from 8KB
     cfg.out_buffer_size = 512;
-    cfg.keepalive = 60;
+    cfg.keepalive = keepalive_s_;
+    cfg.disable_clean_session = persistent_;
     cfg.disable_auto_reconnect = false;
     cfg.reconnect_timeout_ms = 2000;
 
@@ -114,21 +115,35 @@ void MqttClient::stop()
 }
 
 bool MqttClient::publish(const std::string& topic,
-                         const std::string& json,
+                         std::string_view json,
                          int qos,
                          bool retain)
 {
     if (!client_ || !connected_)
+    {
+        dropped_++;
+        return false;
+    }
+
+    // QoS 1 stays in the outbox until PUBACK: bound it
+    if (qos > 0 && outbox_limit_ &&
+        (size_t)esp_mqtt_client_get_outbox_size(client_) + json.size() > outbox_limit_)
+    {
+        dropped_++;
+        ESP_LOGW(TAG, "Outbox full, dropped %u B on %s", (unsigned)json.size(), topic.c_str());
         return false;
+    }
 
     int msg_id = esp_mqtt_client_publish(
         client_,
         topic.c_str(),
-        json.c_str(),
+        json.data(),
         json.size(),
         qos,
         retain);
 
+    if (msg_id < 0)
+        dropped_++;
     return msg_id >= 0;
 }
 
@@ -156,7 +171,7 @@ void MqttClient::onDisconnected(std::function<void()> cb)
 }
 
 void MqttClient::onMessage(
-    std::function<void(const std::string&, const std::string&)> cb)
+    std::function<void(std::string_view, std::string_view)> cb)
 {
     message_cb_ = cb;
 }
@@ -185,8 +200,9 @@ void MqttClient::eventHandler(esp_mqtt_event_handle_t event)
     switch (event->event_id)
     {
     case MQTT_EVENT_CONNECTED:
-        ESP_LOGI(TAG, "MQTT connected");
         connected_ = true;
+        session_present_ = event->session_present;
+        ESP_LOGI(TAG, "MQTT connected%s", session_present_ ? " (session resumed)" : "");
         if (connected_cb_)
             connected_cb_();
         break;
@@ -201,14 +217,15 @@ void MqttClient::eventHandler(esp_mqtt_event_handle_t event)
     case MQTT_EVENT_DATA:
         if (message_cb_)
         {
-            std::string topic;
-            std::string payload;
+            // No copy: handlers parse in place
+            std::string_view topic;
+            std::string_view payload;
 
             if (event->topic && event->topic_len > 0)
-                topic.assign(event->topic, event->topic_len);
+                topic = std::string_view(event->topic, event->topic_len);
 
             if (event->data && event->data_len > 0)
-                payload.assign(event->data, event->data_len);
+                payload = std::string_view(event->data, event->data_len);
 
             message_cb_(topic, payload);
         }
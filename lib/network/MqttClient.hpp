@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <cstdint>
 
@@ -11,8 +13,12 @@
  * @brief Lightweight MQTT client for JSON control only
  *
  * - One TCP connection
- * - QoS 0
- * - Small buffers
+ * - QoS 0 / 1
+ * - Small buffers, bounded outbox: a QoS 1 publish that would push the
+ *   unacked bytes past the limit is dropped (and counted) instead of
+ *   growing the heap while the link is down
+ * - Persistent session (clean-session = false): the broker keeps the
+ *   subscriptions and queues QoS 1 commands across reconnects
  * - Auto reconnect
  */
 class MqttClient
@@ -27,6 +33,12 @@ public:
     void init();
     void setUri(const std::string& uri);      // mqtt://host:port
     void setClientId(const std::string& id);  // unique device id
+    // Before start(). Longer keepalive = fewer PINGREQ wakeups while idle.
+    void setKeepalive(uint16_t seconds) { keepalive_s_ = seconds; }
+    // Needs a stable client id; sessionPresent() tells if the broker kept it
+    void setPersistentSession(bool persistent) { persistent_ = persistent; }
+    // Unacked QoS 1 bytes kept for retransmission; 0 = unbounded
+    void setOutboxLimit(size_t bytes) { outbox_limit_ = bytes; }
     void start();
     void stop();
 
@@ -34,7 +46,7 @@ public:
     // Pub / Sub
     // ------------------------------------------------------------------
     bool publish(const std::string& topic,
-                 const std::string& json,
+                 std::string_view json,
                  int qos = 0,
                  bool retain = false);
 
@@ -45,10 +57,15 @@ public:
     // ------------------------------------------------------------------
     void onConnected(std::function<void()> cb);
     void onDisconnected(std::function<void()> cb);
-    void onMessage(std::function<void(const std::string& topic,
-                                       const std::string& payload)> cb);
+    // Views point into the client's receive buffer (valid during the call)
+    void onMessage(std::function<void(std::string_view topic,
+                                       std::string_view payload)> cb);
 
     bool isConnected() const;
+    // Last CONNACK: broker resumed the session (subscriptions still active)
+    bool sessionPresent() const { return session_present_; }
+    // Publishes refused: not connected or outbox over its limit
+    uint32_t droppedCount() const { return dropped_.load(); }
 
 private:
     // ------------------------------------------------------------------
@@ -68,9 +85,14 @@ private:
     std::string client_id_;
 
     bool connected_ = false;
+    bool session_present_ = false;
+    uint16_t keepalive_s_ = 60;
+    bool persistent_ = false;
+    size_t outbox_limit_ = 0;
+    std::atomic<uint32_t> dropped_{0};
 
     std::function<void()> connected_cb_;
     std::function<void()> disconnected_cb_;
-    std::function<void(const std::string&,
-                       const std::string&)> message_cb_;
+    std::function<void(std::string_view,
+                       std::string_view)> message_cb_;
 };
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esp_crc.h"
+
+/**
+ * OTA binary chunk (server → device, WS binary khi đang tải firmware)
+ * ============================================================================
+ * Header 12 byte little-endian + data:
+ *
+ *   off  size  field
+ *   0    4     seq    (chỉ số chunk, bắt đầu từ 0)
+ *   4    4     size   (số byte data, phải bằng len - 12)
+ *   8    4     crc32  (esp_crc32_le(0, data, size), CRC-32 IEEE)
+ *
+ * parse() chỉ kiểm tra khung + CRC; cửa sổ trượt / ACK nằm ở NetworkManager.
+ * Tách riêng để bench host đo được throughput CRC (bench/host).
+ */
+namespace ota_chunk
+{
+    constexpr size_t HEADER_BYTES = 12;
+
+    enum class Status : uint8_t
+    {
+        OK,
+        TOO_SMALL,     // shorter than the header
+        SIZE_MISMATCH, // header size != payload length
+        CRC_MISMATCH
+    };
+
+    struct Chunk
+    {
+        uint32_t seq = 0;
+        uint32_t size = 0;
+        uint32_t crc = 0;      // from the header
+        uint32_t calc_crc = 0; // over data (valid once the size matched)
+        const uint8_t *data = nullptr;
+    };
+
+    inline uint32_t readU32(const uint8_t *p)
+    {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    inline void writeU32(uint8_t *p, uint32_t v)
+    {
+        p[0] = static_cast<uint8_t>(v & 0xFF);
+        p[1] = static_cast<uint8_t>((v >> 8) & 0xFF);
+        p[2] = static_cast<uint8_t>((v >> 16) & 0xFF);
+        p[3] = static_cast<uint8_t>(v >> 24);
+    }
+
+    // Header for `size` bytes of data (sender side; bench and tools).
+    inline void writeHeader(uint8_t *dst, uint32_t seq, const uint8_t *data, uint32_t size)
+    {
+        writeU32(dst, seq);
+        writeU32(dst + 4, size);
+        writeU32(dst + 8, esp_crc32_le(0, data, size));
+    }
+
+    // Fields are filled as far as parsing got (seq is set for every status
+    // but TOO_SMALL, so the caller can NACK it).
+    inline Status parse(const uint8_t *src, size_t len, Chunk &c)
+    {
+        if (!src || len < HEADER_BYTES)
+            return Status::TOO_SMALL;
+
+        c.seq = readU32(src);
+        c.size = readU32(src + 4);
+        c.crc = readU32(src + 8);
+        c.data = src + HEADER_BYTES;
+
+        if (len - HEADER_BYTES != c.size)
+            return Status::SIZE_MISMATCH;
+
+        c.calc_crc = esp_crc32_le(0, c.data, c.size);
+        return c.calc_crc == c.crc ? Status::OK : Status::CRC_MISMATCH;
+    }
+} // namespace ota_chunk
@@ -0,0 +1,91 @@
+#include "UplinkRateController.hpp"
+
+#include <algorithm>
+
+void UplinkRateController::reset(uint8_t levels, uint8_t start, uint32_t now_ms)
+{
+    levels_ = std::max<uint8_t>(levels, 1);
+    level_ = std::min<uint8_t>(start, levels_ - 1);
+    last_change_ms_ = now_ms;
+    clean_ = false;
+    probing_ = false;
+    congested_run_ = 0;
+    // A backoff earned on this link outlives the stream
+    if (up_hold_ms_ == 0)
+        up_hold_ms_ = cfg_.up_hold_ms;
+}
+
+void UplinkRateController::setLevels(uint8_t levels)
+{
+    levels_ = std::max<uint8_t>(levels, 1);
+    level_ = std::min<uint8_t>(level_, levels_ - 1);
+}
+
+void UplinkRateController::onRtt(uint32_t rtt_ms)
+{
+    srtt_ms_ = srtt_ms_ ? (srtt_ms_ * 7 + rtt_ms) / 8 : rtt_ms;
+    // Base RTT: the minimum, creeping up slowly so a route change is learned
+    if (min_rtt_ms_ == 0 || rtt_ms < min_rtt_ms_)
+        min_rtt_ms_ = rtt_ms;
+    else
+        min_rtt_ms_ += (rtt_ms - min_rtt_ms_) / 64;
+}
+
+bool UplinkRateController::rttCongested() const
+{
+    return min_rtt_ms_ != 0 && srtt_ms_ > min_rtt_ms_ + cfg_.rtt_rise_ms;
+}
+
+uint8_t UplinkRateController::onPacket(uint32_t now_ms, bool sent, uint32_t send_ms, uint32_t backlog_ms)
+{
+    const bool congested = !sent || send_ms >= cfg_.send_slow_ms ||
+                           backlog_ms >= cfg_.backlog_high_ms || rttCongested();
+    if (congested)
+    {
+        clean_ = false;
+        if (congested_run_ < 0xFF)
+            congested_run_++;
+        // A failed send is certain; one slow packet may be a hiccup
+        if ((!sent || congested_run_ >= 2) && level_ + 1 < levels_ &&
+            now_ms - last_change_ms_ >= cfg_.down_hold_ms)
+        {
+            if (probing_)
+                up_hold_ms_ = std::min<uint32_t>(up_hold_ms_ * 2, cfg_.max_up_hold_ms);
+            probing_ = false;
+            level_++;
+            downs_++;
+            last_change_ms_ = now_ms;
+            congested_run_ = 0;
+        }
+        return level_;
+    }
+    congested_run_ = 0;
+
+    if (backlog_ms > cfg_.backlog_low_ms || send_ms >= cfg_.send_slow_ms / 2)
+    {
+        clean_ = false;
+        return level_;
+    }
+    if (!clean_)
+    {
+        clean_ = true;
+        clean_since_ms_ = now_ms;
+    }
+
+    const uint32_t clean_for = now_ms - clean_since_ms_;
+    if (probing_ && clean_for >= up_hold_ms_)
+    {
+        // The last step up held: the link is good again
+        probing_ = false;
+        up_hold_ms_ = cfg_.up_hold_ms;
+    }
+    if (level_ > 0 && clean_for >= up_hold_ms_ && now_ms - last_change_ms_ >= up_hold_ms_)
+    {
+        level_--;
+        ups_++;
+        last_change_ms_ = now_ms;
+        clean_since_ms_ = now_ms;
+        probing_ = true;
+    }
+    return level_;
+}
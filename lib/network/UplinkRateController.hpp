@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * UplinkRateController
+ * ============================================================================
+ * Chọn mức bitrate uplink theo tình trạng link, trước khi Wi-Fi yếu làm
+ * sendBinary timeout và socket bị đóng (mất cả lượt nói).
+ *
+ * Mức 0 = chất lượng cao nhất, mức lớn hơn = ít byte hơn (Opus bitrate thấp
+ * hơn, ADPCM 8 kHz...). Bảng mức do AudioManager định nghĩa; ở đây chỉ là
+ * chỉ số.
+ *
+ * Tín hiệu nghẽn (mỗi packet uplink gửi / gửi hỏng):
+ *  - backlog: audio đã encode còn nằm trong ring chờ gửi (ms)
+ *  - thời gian một lần sendBinary (ms)
+ *  - RTT ping/pong (làm mượt 1/8) so với RTT nhỏ nhất đã thấy
+ *
+ * Hạ mức: gửi hỏng, hoặc 2 packet liên tiếp nghẽn; sau mỗi lần đổi chờ
+ * down_hold_ms cho backlog kịp phản ánh mức mới.
+ * Tăng mức: link sạch liên tục up_hold_ms. Nếu vừa tăng mà lại nghẽn ngay
+ * (probe thất bại) thì thời gian chờ nhân đôi, tới max_up_hold_ms; một chặng
+ * sạch đủ dài đưa nó về lại up_hold_ms.
+ *
+ * Không thread-safe: chỉ uplink task gọi (RTT do nó tự đọc rồi đưa vào).
+ */
+class UplinkRateController
+{
+public:
+    struct Config
+    {
+        uint16_t backlog_high_ms = 240; // queued audio that means "falling behind"
+        uint16_t backlog_low_ms = 80;   // "clean" only below this
+        uint16_t send_slow_ms = 50;     // one sendBinary slower than this is congested
+        uint16_t rtt_rise_ms = 250;     // smoothed RTT above min RTT + this is congested
+        uint16_t down_hold_ms = 500;    // min time between two steps down
+        uint16_t up_hold_ms = 3000;     // clean time before a step up
+        uint16_t max_up_hold_ms = 24000;
+    };
+
+    UplinkRateController() = default;
+    explicit UplinkRateController(const Config &cfg) : cfg_(cfg) {}
+
+    // New stream with `levels` levels (>= 1), starting at `start`. RTT
+    // history is kept (same link).
+    void reset(uint8_t levels, uint8_t start, uint32_t now_ms);
+    // Cap the usable levels (e.g. a level the server cannot decode).
+    void setLevels(uint8_t levels);
+
+    // One packet: sent (or not), how long the send took and the backlog
+    // left after it. Returns the level to use from now on.
+    uint8_t onPacket(uint32_t now_ms, bool sent, uint32_t send_ms, uint32_t backlog_ms);
+    // One ping/pong round trip.
+    void onRtt(uint32_t rtt_ms);
+
+    uint8_t level() const { return level_; }
+    uint32_t srttMs() const { return srtt_ms_; }
+    uint32_t stepsDown() const { return downs_; }
+    uint32_t stepsUp() const { return ups_; }
+
+private:
+    bool rttCongested() const;
+
+    Config cfg_{};
+    uint8_t levels_ = 1;
+    uint8_t level_ = 0;
+
+    uint32_t last_change_ms_ = 0;
+    uint32_t clean_since_ms_ = 0;
+    bool clean_ = false;
+    bool probing_ = false; // stepped up, not yet confirmed by a clean hold
+    uint8_t congested_run_ = 0;
+    uint32_t up_hold_ms_ = 0;
+
+    uint32_t srtt_ms_ = 0;
+    uint32_t min_rtt_ms_ = 0;
+
+    uint32_t downs_ = 0;
+    uint32_t ups_ = 0;
+};
@@ -0,0 +1,188 @@
+#include "UtteranceStore.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace
+{
+    void packHeader(uint8_t *h, const UtteranceStore::Record &r)
+    {
+        h[0] = static_cast<uint8_t>(r.len & 0xFF);
+        h[1] = static_cast<uint8_t>(r.len >> 8);
+        h[2] = r.flags;
+        h[3] = r.kbps;
+        h[4] = static_cast<uint8_t>(r.timestamp_ms & 0xFF);
+        h[5] = static_cast<uint8_t>((r.timestamp_ms >> 8) & 0xFF);
+        h[6] = static_cast<uint8_t>((r.timestamp_ms >> 16) & 0xFF);
+        h[7] = static_cast<uint8_t>(r.timestamp_ms >> 24);
+    }
+
+    void unpackHeader(const uint8_t *h, UtteranceStore::Record &r)
+    {
+        r.len = static_cast<uint16_t>(h[0] | (h[1] << 8));
+        r.flags = h[2];
+        r.kbps = h[3];
+        r.timestamp_ms = static_cast<uint32_t>(h[4]) | (static_cast<uint32_t>(h[5]) << 8) |
+                         (static_cast<uint32_t>(h[6]) << 16) | (static_cast<uint32_t>(h[7]) << 24);
+    }
+} // namespace
+
+bool UtteranceStore::init(const Config &cfg)
+{
+    deinit();
+    cfg_ = cfg;
+    ram_.reset(new (std::nothrow) uint8_t[cfg.ram_bytes]);
+    if (!ram_)
+        return false;
+    ram_cap_ = cfg.ram_bytes;
+    clear();
+    return true;
+}
+
+void UtteranceStore::deinit()
+{
+    clear();
+    closeFile();
+    ram_.reset();
+    ram_cap_ = 0;
+}
+
+void UtteranceStore::closeFile()
+{
+    if (file_)
+    {
+        fclose(file_);
+        file_ = nullptr;
+        if (cfg_.spill_path)
+            remove(cfg_.spill_path);
+    }
+    file_write_ = file_read_ = 0;
+}
+
+void UtteranceStore::clear()
+{
+    ram_head_ = ram_tail_ = 0;
+    count_ = 0;
+    gap_ = false;
+    peek_bytes_ = 0;
+    // The file stays open for the next outage; offsets restart at 0
+    file_write_ = file_read_ = 0;
+}
+
+// ============================================================================
+// RAM ring (records may wrap around the end)
+// ============================================================================
+void UtteranceStore::ramCopyIn(size_t pos, const uint8_t *src, size_t n)
+{
+    const size_t at = pos % ram_cap_;
+    const size_t first = std::min(n, ram_cap_ - at);
+    memcpy(&ram_[at], src, first);
+    memcpy(&ram_[0], src + first, n - first);
+}
+
+void UtteranceStore::ramCopyOut(size_t pos, uint8_t *dst, size_t n) const
+{
+    const size_t at = pos % ram_cap_;
+    const size_t first = std::min(n, ram_cap_ - at);
+    memcpy(dst, &ram_[at], first);
+    memcpy(dst + first, &ram_[0], n - first);
+}
+
+bool UtteranceStore::pushRam(const uint8_t *hdr, const uint8_t *payload, size_t len)
+{
+    if (ram_cap_ - (ram_head_ - ram_tail_) < RECORD_HDR + len)
+        return false;
+    ramCopyIn(ram_head_, hdr, RECORD_HDR);
+    ramCopyIn(ram_head_ + RECORD_HDR, payload, len);
+    ram_head_ += RECORD_HDR + len;
+    return true;
+}
+
+// ============================================================================
+// Spill file (append at file_write_, read at file_read_)
+// ============================================================================
+bool UtteranceStore::pushFile(const uint8_t *hdr, const uint8_t *payload, size_t len)
+{
+    if (!cfg_.spill_path || file_write_ + RECORD_HDR + len > cfg_.spill_max_bytes)
+        return false;
+    if (!file_)
+    {
+        file_ = fopen(cfg_.spill_path, "w+b");
+        if (!file_)
+            return false;
+    }
+    if (fseek(file_, static_cast<long>(file_write_), SEEK_SET) != 0 ||
+        fwrite(hdr, 1, RECORD_HDR, file_) != RECORD_HDR ||
+        fwrite(payload, 1, len, file_) != len)
+        return false; // flash full: the partial record past file_write_ is ignored
+    file_write_ += RECORD_HDR + len;
+    return true;
+}
+
+bool UtteranceStore::push(const Record &r, const uint8_t *payload)
+{
+    if (!ram_ || (r.len && !payload))
+        return false;
+
+    uint8_t hdr[RECORD_HDR];
+    packHeader(hdr, r);
+
+    // Keep FIFO order: once records wait in the file, new ones follow them
+    const bool ok = file_write_ > file_read_ ? pushFile(hdr, payload, r.len)
+                                              : (pushRam(hdr, payload, r.len) || pushFile(hdr, payload, r.len));
+    if (!ok)
+    {
+        dropped_++;
+        gap_ = true;
+        return false;
+    }
+    gap_ = false;
+    count_++;
+    return true;
+}
+
+bool UtteranceStore::peek(Record &r, uint8_t *out, size_t cap)
+{
+    if (count_ == 0)
+        return false;
+
+    uint8_t hdr[RECORD_HDR];
+    if (ram_head_ != ram_tail_)
+    {
+        ramCopyOut(ram_tail_, hdr, RECORD_HDR);
+        unpackHeader(hdr, r);
+        if (r.len > cap)
+            return false;
+        ramCopyOut(ram_tail_ + RECORD_HDR, out, r.len);
+        peek_ram_ = true;
+    }
+    else
+    {
+        if (!file_ || fseek(file_, static_cast<long>(file_read_), SEEK_SET) != 0 ||
+            fread(hdr, 1, RECORD_HDR, file_) != RECORD_HDR)
+            return false;
+        unpackHeader(hdr, r);
+        if (r.len > cap || fread(out, 1, r.len, file_) != r.len)
+            return false;
+        peek_ram_ = false;
+    }
+    peek_bytes_ = RECORD_HDR + r.len;
+    return true;
+}
+
+void UtteranceStore::pop()
+{
+    if (count_ == 0 || peek_bytes_ == 0)
+        return;
+    if (peek_ram_)
+        ram_tail_ += peek_bytes_;
+    else
+        file_read_ += peek_bytes_;
+    peek_bytes_ = 0;
+    count_--;
+
+    // File drained: reuse it from the start
+    if (file_read_ == file_write_)
+        file_read_ = file_write_ = 0;
+}
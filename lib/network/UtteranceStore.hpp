@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+/**
+ * UtteranceStore
+ * ============================================================================
+ * Hàng đợi FIFO có giới hạn các packet uplink đã đóng gói, giữ lượt nói khi
+ * WS rớt giữa chừng: uplink task ghi vào khi offline, phát lại ở tốc độ link
+ * khi session được nối lại (cùng uplink session, seq nối tiếp) → server nhận
+ * một utterance liền mạch, người dùng không phải nói lại.
+ *
+ *  - RAM trước (ram_bytes, cấp phát ở init()), tràn sang file trên flash
+ *    (spill_path, vd "/spiffs/utt.bin") tới spill_max_bytes.
+ *  - Thứ tự giữ nguyên: khi file còn record chưa đọc, record mới cũng vào
+ *    file (mọi record trong RAM luôn cũ hơn mọi record trong file).
+ *  - Đầy → record bị bỏ, dropped() tăng; gapPending() báo cho record kế
+ *    tiếp (caller đặt FLAG_GAP vào header của nó).
+ *
+ * Mỗi record: header 8 byte [u16 len][u8 flags][u8 kbps][u32 timestamp_ms]
+ * + payload. Không thread-safe: chỉ uplink task dùng.
+ */
+class UtteranceStore
+{
+public:
+    struct Config
+    {
+        size_t ram_bytes = 16 * 1024;
+        const char *spill_path = nullptr; // nullptr = RAM only
+        size_t spill_max_bytes = 256 * 1024;
+    };
+
+    // Packet header fields kept with the payload
+    struct Record
+    {
+        uint16_t len = 0;
+        uint8_t flags = 0;
+        uint8_t kbps = 0;
+        uint32_t timestamp_ms = 0;
+    };
+
+    static constexpr size_t RECORD_HDR = 8;
+
+    UtteranceStore() = default;
+    ~UtteranceStore() { deinit(); }
+
+    UtteranceStore(const UtteranceStore &) = delete;
+    UtteranceStore &operator=(const UtteranceStore &) = delete;
+
+    // Allocate the RAM part; false on OOM.
+    bool init(const Config &cfg);
+    // Drop everything, free RAM, delete the spill file.
+    void deinit();
+    bool ready() const { return ram_ != nullptr; }
+
+    // Append one packet; false = store full, packet dropped.
+    bool push(const Record &r, const uint8_t *payload);
+    // Oldest packet: header into `r`, payload into `out` (cap bytes); false
+    // when empty, or when the payload does not fit / the file read fails.
+    bool peek(Record &r, uint8_t *out, size_t cap);
+    // Remove the packet peek() returned.
+    void pop();
+    // Forget all packets (RAM and file), keep the allocation.
+    void clear();
+
+    bool empty() const { return count_ == 0; }
+    uint32_t packets() const { return count_; }
+    size_t bytes() const { return (ram_head_ - ram_tail_) + (file_write_ - file_read_); }
+    size_t spilledBytes() const { return file_write_ - file_read_; }
+    uint32_t dropped() const { return dropped_; }
+    // A packet was dropped since the last push() that went in.
+    bool gapPending() const { return gap_; }
+
+private:
+    bool pushRam(const uint8_t *hdr, const uint8_t *payload, size_t len);
+    bool pushFile(const uint8_t *hdr, const uint8_t *payload, size_t len);
+    void ramCopyIn(size_t pos, const uint8_t *src, size_t n);
+    void ramCopyOut(size_t pos, uint8_t *dst, size_t n) const;
+    void closeFile();
+
+    Config cfg_{};
+    std::unique_ptr<uint8_t[]> ram_;
+    size_t ram_cap_ = 0;
+    size_t ram_head_ = 0; // bytes ever written / read (positions mod ram_cap_)
+    size_t ram_tail_ = 0;
+
+    FILE *file_ = nullptr;
+    size_t file_write_ = 0; // append offset
+    size_t file_read_ = 0;
+
+    uint32_t count_ = 0;
+    uint32_t dropped_ = 0;
+    bool gap_ = false;
+    size_t peek_bytes_ = 0; // record size returned by the last peek()
+    bool peek_ram_ = false;
+};
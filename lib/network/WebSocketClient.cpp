@@ -1,7 +1,20 @@
 #include "WebSocketClient.hpp"
+
+#include <cstdio>
+
 #include "esp_log.h"
 #include "esp_event.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_idf_version.h"
+
+// Certificate bundle on the WS client config: esp_websocket_client from IDF 5
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0) && CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+#define PTALK_WS_CRT_BUNDLE 1
+#include "esp_crt_bundle.h"
+#else
+#define PTALK_WS_CRT_BUNDLE 0
+#endif
 
 static const char *TAG = "WebSocketClient";
 
@@ -22,6 +35,17 @@ void WebSocketClient::setUrl(const std::string &url)
     ws_url = url;
 }
 
+void WebSocketClient::setCaCert(const char *pem, bool skip_cn_check)
+{
+    ca_pem = pem;
+    skip_cn = skip_cn_check;
+}
+
+static bool isTlsUrl(const std::string &url)
+{
+    return url.rfind("wss://", 0) == 0;
+}
+
 void WebSocketClient::connect()
 {
     if (ws_url.empty())
@@ -30,12 +54,43 @@ void WebSocketClient::connect()
         return;
     }
 
-    if (client != nullptr)
+    if (client != nullptr && client_url != ws_url)
     {
-        ESP_LOGW(TAG, "WS already created, closing old instance");
+        ESP_LOGW(TAG, "WS URL changed, recreating client");
         close();
     }
 
+    if (client == nullptr)
+    {
+        if (!createClient())
+            return;
+    }
+    else
+    {
+        if (esp_websocket_client_is_connected(client))
+            return;
+        // Previous attempt still running (or its task ended on error): restart
+        // on the same handle, the receive buffer and transport are kept
+        stopClient();
+    }
+
+    ESP_LOGI(TAG, "Connecting to WS: %s", ws_url.c_str());
+    heap_at_start = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    heap_min_at_start = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    connect_start_us = esp_timer_get_time();
+    if (esp_websocket_client_start(client) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "esp_websocket_client_start failed");
+        return;
+    }
+    client_started = true;
+
+    if (status_cb)
+        status_cb(1); // CONNECTING
+}
+
+bool WebSocketClient::createClient()
+{
     esp_websocket_client_config_t cfg = {};
     cfg.uri = ws_url.c_str();
     cfg.buffer_size = 4096; // Reduced from 8KB - we now have freed 115KB from Framebuffer removal
@@ -49,11 +104,34 @@ void WebSocketClient::connect()
     cfg.keep_alive_idle = 5;     // Thời gian chờ rảnh rỗi (giây)
     cfg.keep_alive_interval = 5; // Khoảng cách giữa các gói probe (giây)
     cfg.keep_alive_count = 3;    // Số lần thử lại trước khi báo lỗi
+
+    if (isTlsUrl(ws_url))
+    {
+        // Handshake runs on the WS task: ECDHE + certificate verify need
+        // more stack than the plaintext default
+        cfg.task_stack = 6 * 1024;
+        if (ca_pem)
+        {
+            cfg.cert_pem = ca_pem;
+            cfg.skip_cert_common_name_check = skip_cn;
+        }
+        else
+        {
+#if PTALK_WS_CRT_BUNDLE
+            cfg.crt_bundle_attach = esp_crt_bundle_attach;
+#else
+            // The IDF 4.4 client takes no certificate bundle and nothing fills
+            // the esp-tls global CA store: the handshake could never verify
+            ESP_LOGE(TAG, "wss:// needs a CA cert (Config::ws_ca_pem or NVS \"ws_ca\")");
+            return false;
+#endif
+        }
+    }
     client = esp_websocket_client_init(&cfg);
     if (!client)
     {
         ESP_LOGE(TAG, "Failed to init websocket");
-        return;
+        return false;
     }
 
     ESP_ERROR_CHECK(esp_websocket_register_events(
@@ -62,26 +140,51 @@ void WebSocketClient::connect()
         &WebSocketClient::eventHandlerStatic,
         this));
 
-    ESP_LOGI(TAG, "Free heap before ws_start: %d bytes", esp_get_free_heap_size());
-    ESP_LOGI(TAG, "Connecting to WS: %s", ws_url.c_str());
-    esp_websocket_client_start(client);
-    ESP_LOGI(TAG, "Free heap after ws_start: %d bytes", esp_get_free_heap_size());
+    client_url = ws_url;
+    client_started = false;
+    ESP_LOGI(TAG, "WS client created, free heap: %d bytes", esp_get_free_heap_size());
+    return true;
+}
 
-    if (status_cb)
-        status_cb(1); // CONNECTING
+// Stop the client task (waits for it to exit); the handle stays valid
+void WebSocketClient::stopClient()
+{
+    if (client && client_started)
+    {
+        // Returns at once if the task already ended on its own (no auto reconnect)
+        esp_websocket_client_stop(client);
+        client_started = false;
+    }
+}
+
+void WebSocketClient::disconnect()
+{
+    const bool was_connected = connected;
+    if (client && was_connected)
+    {
+        // Polite close frame; the task is stopped by it (or by stopClient)
+        esp_websocket_client_close(client, 100);
+    }
+    stopClient();
+    connected = false;
+    msg_opcode = 0;
+
+    // DISCONNECTED event already reported a drop that happened on its own
+    if (was_connected && status_cb)
+        status_cb(0); // CLOSED
 }
 
 void WebSocketClient::close()
 {
     if (client)
     {
-        ESP_LOGI(TAG, "Free heap before close: %d bytes", esp_get_free_heap_size());
         ESP_LOGI(TAG, "Closing WebSocket...");
-        esp_websocket_client_close(client, 100);
-        // Give internal task time to cleanup
-        vTaskDelay(pdMS_TO_TICKS(200));
+        if (connected)
+            esp_websocket_client_close(client, 100);
+        // destroy() stops the client task and waits for it, no fixed delay needed
         esp_websocket_client_destroy(client);
         client = nullptr;
+        client_started = false;
         connected = false;
         ESP_LOGI(TAG, "Free heap after close: %d bytes", esp_get_free_heap_size());
     }
@@ -90,28 +193,61 @@ void WebSocketClient::close()
         status_cb(0); // CLOSED
 }
 
-bool WebSocketClient::sendText(const std::string &msg)
+bool WebSocketClient::sendText(std::string_view msg)
 {
     if (!client || !connected)
         return false;
 
-    int sent = esp_websocket_client_send_text(client, msg.c_str(), msg.size(), 100);
-    return sent == msg.size();
+    int sent = esp_websocket_client_send_text(client, msg.data(), msg.size(), 100);
+    return sent == (int)msg.size();
 }
 
-bool WebSocketClient::sendBinary(const uint8_t *data, size_t len)
+bool WebSocketClient::sendBinary(const uint8_t *data, size_t len, int timeout_ms)
 {
     if (!client || !connected)
         return false;
 
-    int sent = esp_websocket_client_send_bin(client, (const char *)data, len, 100);
-    if (sent != (int)len)
+    int sent = esp_websocket_client_send_bin(client, (const char *)data, len, timeout_ms);
+    if (sent == (int)len)
+        return true;
+
+    if (esp_websocket_client_is_connected(client))
     {
-        ESP_LOGE(TAG, "WS send failed -> force close");
-        connected = false;
-        esp_websocket_client_close(client, 0);
+        // Lock held by the WS task (ping / rx) or send buffer full: caller retries
+        ESP_LOGD(TAG, "WS send busy (%d/%u)", sent, (unsigned)len);
         return false;
     }
+
+    ESP_LOGE(TAG, "WS send failed, connection aborted");
+    connected = false;
+    return false;
+}
+
+bool WebSocketClient::sendPing(int timeout_ms)
+{
+    if (!client || !connected)
+        return false;
+
+    // Send time (ms) as the stamp, checked again in takePong()
+    char msg[16];
+    const int n = snprintf(msg, sizeof(msg), "PING:%u", (unsigned)(esp_timer_get_time() / 1000));
+    return esp_websocket_client_send_text(client, msg, n, pdMS_TO_TICKS(timeout_ms)) == n;
+}
+
+bool WebSocketClient::takePong(std::string_view msg)
+{
+    if (msg.size() <= 5 || msg.size() > 15 || msg.compare(0, 5, "PONG:") != 0)
+        return false;
+    uint32_t sent = 0;
+    for (size_t i = 5; i < msg.size(); i++)
+    {
+        if (msg[i] < '0' || msg[i] > '9')
+            return false;
+        sent = sent * 10 + static_cast<uint32_t>(msg[i] - '0');
+    }
+    rtt_ms.store(static_cast<uint32_t>(esp_timer_get_time() / 1000) - sent, std::memory_order_relaxed);
+    rtt_samples.fetch_add(1, std::memory_order_release);
+    pong_seen.store(true, std::memory_order_relaxed);
     return true;
 }
 
@@ -120,12 +256,12 @@ void WebSocketClient::onStatus(std::function<void(int)> cb)
     status_cb = cb;
 }
 
-void WebSocketClient::onText(std::function<void(const std::string &)> cb)
+void WebSocketClient::onText(std::function<void(std::string_view)> cb)
 {
     text_cb = cb;
 }
 
-void WebSocketClient::onBinary(std::function<void(const uint8_t *, size_t)> cb)
+void WebSocketClient::onBinary(std::function<void(const WsBinaryView &)> cb)
 {
     binary_cb = cb;
 }
@@ -146,35 +282,36 @@ void WebSocketClient::eventHandler(esp_event_base_t base, int32_t event_id,
     switch (event_id)
     {
     case WEBSOCKET_EVENT_CONNECTED:
-        ESP_LOGI(TAG, "WS connected!");
+    {
+        // Peak heap of the handshake: a new low-water mark set during it,
+        // else what is still held now (lower bound)
+        const size_t heap_now = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+        const size_t heap_min = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+        const size_t low = heap_min < heap_min_at_start ? heap_min : heap_now;
+        stats.heap_peak = heap_at_start > low ? static_cast<uint32_t>(heap_at_start - low) : 0;
+        stats.last_ms = static_cast<uint32_t>((esp_timer_get_time() - connect_start_us) / 1000);
+        stats.avg_ms = stats.connects ? (stats.avg_ms * 7 + stats.last_ms) / 8 : stats.last_ms;
+        stats.tls = isTlsUrl(client_url);
+        stats.connects++;
+        ESP_LOGI(TAG, "WS connected in %u ms (%s, heap peak %u B)", (unsigned)stats.last_ms,
+                 stats.tls ? "TLS" : "plain", (unsigned)stats.heap_peak);
         connected = true;
+        pong_seen.store(false, std::memory_order_relaxed);
         if (status_cb)
             status_cb(2);
         break;
+    }
 
     case WEBSOCKET_EVENT_DATA:
         if (!data)
             break;
-
-        if (data->op_code == 0x1)
-        { // WS_OP_TEXT
-            if (text_cb)
-            {
-                text_cb(std::string((const char *)data->data_ptr, data->data_len));
-            }
-        }
-        else if (data->op_code == 0x2)
-        { // WS_OP_BINARY
-            if (binary_cb)
-            {
-                binary_cb((const uint8_t *)data->data_ptr, data->data_len);
-            }
-        }
+        handleData(data);
         break;
 
     case WEBSOCKET_EVENT_DISCONNECTED:
         ESP_LOGW(TAG, "WS disconnected");
         connected = false;
+        msg_opcode = 0;
         if (status_cb)
             status_cb(0);
         break;
@@ -190,3 +327,57 @@ void WebSocketClient::eventHandler(esp_event_base_t base, int32_t event_id,
         break;
     }
 }
+
+// ======================================================================================
+// DATA: one receive buffer of a frame
+// ======================================================================================
+// esp_websocket_client hands over at most buffer_size bytes per event;
+// payload_offset / payload_len locate them in the frame. IDF 4.4 does not
+// report FIN, so a frame is a message; continuation frames (op_code 0)
+// keep the type of the message they continue.
+void WebSocketClient::handleData(esp_websocket_event_data_t *data)
+{
+    uint8_t op = data->op_code;
+    if (op == 0x0)
+        op = msg_opcode; // continuation
+    if (op != 0x1 && op != 0x2)
+        return; // ping / pong / close, or a continuation we never saw start
+
+    const size_t len = data->data_len > 0 ? static_cast<size_t>(data->data_len) : 0;
+    const size_t off = data->payload_offset > 0 ? static_cast<size_t>(data->payload_offset) : 0;
+    const size_t total = data->payload_len > 0 ? static_cast<size_t>(data->payload_len) : len;
+    const bool last = off + len >= total;
+    msg_opcode = op;
+
+    if (op == 0x2)
+    {
+        if (binary_cb)
+        {
+            WsBinaryView v{reinterpret_cast<const uint8_t *>(data->data_ptr), len, off, total, last};
+            binary_cb(v);
+        }
+        return;
+    }
+
+    if (off == 0 && last)
+    {
+        // Pong to sendPing() never reaches the callback
+        std::string_view msg(data->data_ptr, len);
+        if (takePong(msg) || !text_cb)
+            return;
+        // Common case: the whole message is in this buffer, parse in place
+        text_cb(msg);
+        return;
+    }
+
+    if (!text_cb)
+        return;
+    if (off == 0)
+        text_frag.clear();
+    if (text_frag.size() + len <= MAX_TEXT_BYTES)
+        text_frag.append(data->data_ptr, len);
+    else
+        ESP_LOGW(TAG, "Text message over %u B truncated", (unsigned)MAX_TEXT_BYTES);
+    if (last)
+        text_cb(std::string_view(text_frag));
+}
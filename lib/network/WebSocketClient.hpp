@@ -1,16 +1,54 @@
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <vector>
 #include "esp_websocket_client.h"
 
+/**
+ * WsBinaryView
+ * ---------------------------------------------------------
+ * Một mảnh của binary message, trỏ thẳng vào buffer nhận của
+ * esp_websocket_client (chỉ hợp lệ trong callback).
+ *
+ * Message lớn hơn buffer_size tới thành nhiều mảnh liên tiếp: offset tăng
+ * dần, total = độ dài cả message, last ở mảnh cuối.
+ */
+struct WsBinaryView
+{
+    const uint8_t *data;
+    size_t len;
+    size_t offset; // position of data within the message
+    size_t total;  // whole message length
+    bool last;     // final fragment of the message
+
+    bool first() const { return offset == 0; }
+};
+
+// Cost of the last connects (TCP + TLS + HTTP upgrade), for telemetry
+struct WsConnectStats
+{
+    uint32_t connects = 0;  // successful opens since boot
+    uint32_t last_ms = 0;   // start() -> CONNECTED of the last open
+    uint32_t avg_ms = 0;    // running average (1/8 weight)
+    uint32_t heap_peak = 0; // heap taken at the worst point of the last open
+    bool tls = false;       // last open was wss://
+};
+
 /**
  * WebSocketClient
  * ---------------------------------------------------------
  * - Đóng gói esp_websocket_client
  * - Tự động callback status / text / binary
  * - Không xử lý logic ứng dụng (NetworkManager làm việc đó)
+ * - Không copy khi nhận: text một mảnh được đưa ra dạng string_view ngay
+ *   trên buffer nhận; binary đi theo từng mảnh (WsBinaryView) để consumer
+ *   ghi thẳng vào ring của nó
+ * - Giữ lại instance esp_websocket_client qua các lần rớt kết nối:
+ *   disconnect() chỉ dừng task, connect() lần sau start lại cùng handle
+ *   (không init/destroy, không cấp phát lại buffer). close() mới giải phóng.
  */
 class WebSocketClient {
 public:
@@ -20,8 +58,13 @@ public:
     // Init sơ bộ, chưa connect
     void init();
 
-    // Kết nối tới ws_url (thiết lập trong setUrl)
+    // Kết nối tới ws_url (thiết lập trong setUrl). Reuses the existing client
+    // when the URL is unchanged; no-op while already connected.
     void connect();
+    // Drop the connection but keep the client for a fast reconnect.
+    // Not callable from the status/text/binary callbacks (WS task).
+    void disconnect();
+    // Drop the connection and free the client.
     void close();
 
     // Get connection status
@@ -29,14 +72,37 @@ public:
 
     void setUrl(const std::string& url);
 
+    // Trust anchor for wss:// (PEM, must outlive the client). nullptr: the
+    // certificate bundle on IDF 5; on IDF 4.4 a wss:// URL is then refused
+    // (connect() logs it). Takes effect on the next client creation.
+    void setCaCert(const char* pem, bool skip_cn_check = false);
+
+    const WsConnectStats& connectStats() const { return stats; }
+
     // Send
-    bool sendText(const std::string& msg);
-    bool sendBinary(const uint8_t* data, size_t len);
+    bool sendText(std::string_view msg);
+    // timeout_ms bounds both waiting for the client lock and the socket write.
+    // False without closing if the client is merely busy; a transport error
+    // is aborted by esp_websocket_client itself (DISCONNECTED event follows).
+    bool sendBinary(const uint8_t* data, size_t len, int timeout_ms = 100);
+
+    // RTT probe: text "PING:<ms>" with the send time, the server answers
+    // "PONG:<ms>" with the same stamp (IDF 4.4 cannot put a payload in a
+    // ping frame: its opcode send is internal). The pong is consumed here,
+    // not passed to onText(). rttMs() = last round trip, rttSamples() counts
+    // them; pongSeen(): the server answered one on this connection (one that
+    // never echoes is not a lossy link).
+    bool sendPing(int timeout_ms = 20);
+    uint32_t rttMs() const { return rtt_ms.load(std::memory_order_relaxed); }
+    uint32_t rttSamples() const { return rtt_samples.load(std::memory_order_acquire); }
+    bool pongSeen() const { return pong_seen.load(std::memory_order_relaxed); }
 
     // Callbacks
     void onStatus(std::function<void(int)> cb);   // 0=closed,1=connecting,2=open
-    void onText(std::function<void(const std::string&)> cb);
-    void onBinary(std::function<void(const uint8_t*, size_t)> cb);
+    // Whole text message; the view is only valid during the call
+    void onText(std::function<void(std::string_view)> cb);
+    // Binary fragments in order (see WsBinaryView)
+    void onBinary(std::function<void(const WsBinaryView&)> cb);
 
 private:
     static void eventHandlerStatic(void* handler_args, esp_event_base_t base,
@@ -44,16 +110,47 @@ private:
 
     void eventHandler(esp_event_base_t base, int32_t event_id,
                       esp_websocket_event_data_t* data);
+    void handleData(esp_websocket_event_data_t* data);
+    // "PONG:<ms>" → RTT sample; false for any other message
+    bool takePong(std::string_view msg);
 
 private:
+    bool createClient();
+    void stopClient();
+
     esp_websocket_client_handle_t client = nullptr;
 
     std::string ws_url;
+    std::string client_url; // URL the current client was created with
 
     bool connected = false;
+    bool client_started = false; // esp_websocket_client_start() without stop
+
+    // TLS
+    const char* ca_pem = nullptr;
+    bool skip_cn = false;
+
+    // Connect cost measurement (start() -> CONNECTED)
+    WsConnectStats stats;
+    int64_t connect_start_us = 0;
+    size_t heap_at_start = 0;
+    size_t heap_min_at_start = 0;
+
+    // Reassembly of text split across receive buffers (rare: control
+    // messages are short). Capacity is kept, so no allocation per message.
+    static constexpr size_t MAX_TEXT_BYTES = 4096;
+    std::string text_frag;
+
+    // Type of the current message, for continuation frames
+    uint8_t msg_opcode = 0;
+
+    // PING / PONG round trip (written by the WS task)
+    std::atomic<uint32_t> rtt_ms{0};
+    std::atomic<uint32_t> rtt_samples{0};
+    std::atomic<bool> pong_seen{false};
 
     // callbacks
-    std::function<void(int)> status_cb;               // status
-    std::function<void(const std::string&)> text_cb;  // text message
-    std::function<void(const uint8_t*, size_t)> binary_cb; // binary message
+    std::function<void(int)> status_cb;                 // status
+    std::function<void(std::string_view)> text_cb;      // text message
+    std::function<void(const WsBinaryView&)> binary_cb; // binary fragments
 };
@@ -1,5 +1,6 @@
 #include "WifiService.hpp"
-#include "web_page.hpp"
+#include "portal_assets.hpp"
+#include "JsonLite.hpp"
 #include "esp_log.h"
 #include "nvs_flash.h"
 #include "nvs.h"
@@ -8,7 +9,14 @@
 #include "esp_event.h"
 #include "esp_http_server.h"
 #include "sdkconfig.h"
-
+#include "esp_attr.h"
+#include "esp_timer.h"
+#if CONFIG_WPA_11KV_SUPPORT
+#include "esp_wnm.h"
+#endif
+
+#include <algorithm>
+#include <cctype>
 #include <string>
 #include <vector>
 #include <cstring>
@@ -16,150 +24,122 @@
 // Logos (data URLs)
 #include "../../src/assets/logos/logo1.hpp"
 #include "../../src/assets/logos/logo2.hpp"
+#include "../../src/system/ConfigStore.hpp"
 
 static const char *TAG = "WifiService";
 
-// Small helpers
-static int rssiToPercent(int rssi)
-{
-    if (rssi <= -100)
-        return 0;
-    if (rssi >= -50)
-        return 100;
-    return 2 * (rssi + 100);
-}
 // --------------------------------------------------------------------------------
 // Struct to hold WiFi connection parameters for async connect
 struct WifiConnParams
 {
     WifiService *svc;
-    std::string ssid;
-    std::string pass;
+    char ssid[33];
+    char pass[65];
 };
-// --------------------------------------------------------------------------------
-// HTTP helpers & templates
-// We'll use PAGE_HTML from web_page.hpp and replace placeholders
-// --------------------------------------------------------------------------------
 
-static std::string makeWifiListHtml(const std::vector<WifiInfo> &list)
-{
-    std::string out;
-    for (const auto &w : list)
-    {
-        int pct = rssiToPercent(w.rssi);
-        const char *color = (pct > 66) ? "#48bb78" : (pct > 33) ? "#ed8936"
-                                                                : "#e53e3e";
-        char buf[512];
-        // escape single quotes in SSID for onclick handler
-        std::string esc = w.ssid;
-        for (auto &c : esc)
-            if (c == '\'')
-                c = ' ';
-        snprintf(buf, sizeof(buf),
-                 "<div class='wifi-item' onclick=\"sel('%s')\">"
-                 "<div class='ssid-text'>%s</div>"
-                 "<div class='rssi-box'><div class='bar-bg'><div class='bar-fg' style='width:%d%%;background:%s'></div></div><div>%ddBm</div></div>"
-                 "</div>",
-                 esc.c_str(), w.ssid.c_str(), pct, color, w.rssi);
-        out += buf;
-    }
-    if (out.empty())
-        out = "<div style='padding:12px;color:#718096'>Không tìm thấy mạng WiFi</div>";
-    return out;
-}
+// Portal POST body: "ssid=..&pass=.." url-encoded; 3 bytes per escaped char
+static constexpr size_t PORTAL_FORM_MAX = 3 * (32 + 64) + 16;
 
 // --------------------------------------------------------------------------------
-// NVS helpers (store SSID/PASS in namespace "storage")
+// HTTP server handlers
 // --------------------------------------------------------------------------------
-static bool nvs_set_string(const char *ns, const char *key, const std::string &v)
-{
-    nvs_handle_t h;
-    esp_err_t e = nvs_open(ns, NVS_READWRITE, &h);
-    if (e != ESP_OK)
-        return false;
-    e = nvs_set_str(h, key, v.c_str());
-    if (e == ESP_OK)
-        nvs_commit(h);
-    nvs_close(h);
-    return e == ESP_OK;
-}
 
-static bool nvs_get_string(const char *ns, const char *key, std::string &out)
+// Client already has this version (If-None-Match) → 304, no body
+static bool send_not_modified(httpd_req_t *req, const char *etag)
 {
-    nvs_handle_t h;
-    esp_err_t e = nvs_open(ns, NVS_READONLY, &h);
-    if (e != ESP_OK)
-        return false;
-    size_t required = 0;
-    e = nvs_get_str(h, key, nullptr, &required);
-    if (e != ESP_OK)
-    {
-        nvs_close(h);
-        return false;
-    }
-    out.resize(required);
-    e = nvs_get_str(h, key, out.data(), &required);
-    nvs_close(h);
-    if (e != ESP_OK)
+    char inm[40];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", inm, sizeof(inm)) != ESP_OK || strcmp(inm, etag) != 0)
         return false;
-    // remove trailing null if present
-    if (!out.empty() && out.back() == '\0')
-        out.resize(out.size() - 1);
+    httpd_resp_set_status(req, "304 Not Modified");
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_send(req, nullptr, 0);
     return true;
 }
 
-// --------------------------------------------------------------------------------
-// HTTP server handlers
-// --------------------------------------------------------------------------------
-
-static esp_err_t root_get_handler(httpd_req_t *req)
+// Pre-gzipped page from flash (portal_assets.hpp): one send, no allocation
+static esp_err_t static_get_handler(httpd_req_t *req)
 {
+    const PortalAsset *a = static_cast<const PortalAsset *>(req->user_ctx);
     ESP_LOGI(TAG, "HTTP GET %s", req->uri);
+    if (send_not_modified(req, a->etag))
+        return ESP_OK;
+
+    httpd_resp_set_type(req, a->type);
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    // Revalidate each visit (ETag → 304): a firmware update changes the page
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    httpd_resp_set_hdr(req, "ETag", a->etag);
+    return httpd_resp_send(req, reinterpret_cast<const char *>(a->gz), a->gz_len);
+}
 
+// GET /networks.json: {"networks":{"<ssid>":<rssi>,...}} from the scan cache
+static esp_err_t networks_get_handler(httpd_req_t *req)
+{
     HandlerContext *ctx = (HandlerContext *)req->user_ctx;
     if (!ctx)
-    {
-        ESP_LOGE(TAG, "No handler context");
         return ESP_FAIL;
-    }
-    if (httpd_resp_set_type(req, "text/html; charset=utf-8") != ESP_OK)
-    {
-        ESP_LOGE(TAG, "Failed to set response type");
-        return ESP_FAIL;
-    }
 
-    // HEAD + LOGO (logo load bằng URL nội bộ)
-    if (httpd_resp_send_chunk(req, PAGE_HTML_HEAD, strlen(PAGE_HTML_HEAD)) != ESP_OK)
-    {
-        ESP_LOGE(TAG, "Failed to send HTML head");
-        return ESP_FAIL;
-    }
+    WifiService::ScanEntry nets[WifiService::SCAN_CACHE_MAX];
+    const size_t n = ctx->svc->snapshotNetworks(nets);
 
-    // Trước danh sách WiFi
-    if (httpd_resp_send_chunk(req, PAGE_HTML_BEFORE_LIST, strlen(PAGE_HTML_BEFORE_LIST)) != ESP_OK)
+    static char json[2048]; // httpd runs one handler at a time
+    jsonlite::Writer w(json, sizeof(json));
+    w.beginObject().beginObject("networks");
+    for (size_t i = 0; i < n; i++)
     {
-        ESP_LOGE(TAG, "Failed to send HTML before list");
-        return ESP_FAIL;
+        // Worst case: every SSID byte escaped (\u00XX), ",\"..\":-100", "}}".
+        // Weakest entries come last, so a full buffer drops those first.
+        const size_t need = 6 * strlen(nets[i].ssid) + 12;
+        if (w.size() + need >= sizeof(json))
+            break;
+        w.field(nets[i].ssid, (int32_t)nets[i].rssi);
     }
-
-    // WiFi list (dynamic)
-    std::string list = makeWifiListHtml(ctx->svc->getCachedNetworks());
-    if (httpd_resp_send_chunk(req, list.c_str(), list.size()) != ESP_OK)
+    w.endObject().endObject();
+    if (!w.ok())
     {
-        ESP_LOGE(TAG, "Failed to send WiFi list");
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "List too long");
         return ESP_FAIL;
     }
 
-    // Footer
-    if (httpd_resp_send_chunk(req, PAGE_HTML_FOOTER, strlen(PAGE_HTML_FOOTER)) != ESP_OK)
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+    return httpd_resp_send(req, w.c_str(), w.size());
+}
+
+// Value of `key` in a url-encoded form, decoded into out (NUL-terminated).
+// False if missing or longer than cap - 1.
+static bool form_field(const char *body, size_t len, const char *key, char *out, size_t cap)
+{
+    const size_t klen = strlen(key);
+    const char *end = body + len;
+    for (const char *p = body; p < end;)
     {
-        ESP_LOGE(TAG, "Failed to send HTML footer");
-        return ESP_FAIL;
+        const char *amp = static_cast<const char *>(memchr(p, '&', end - p));
+        const char *stop = amp ? amp : end;
+        if ((size_t)(stop - p) > klen && memcmp(p, key, klen) == 0 && p[klen] == '=')
+        {
+            size_t o = 0;
+            for (const char *v = p + klen + 1; v < stop; v++)
+            {
+                char c = *v;
+                if (c == '+')
+                    c = ' ';
+                else if (c == '%' && stop - v > 2 && isxdigit((unsigned char)v[1]) && isxdigit((unsigned char)v[2]))
+                {
+                    const char hex[3] = {v[1], v[2], 0};
+                    c = (char)strtol(hex, nullptr, 16);
+                    v += 2;
+                }
+                if (o + 1 >= cap)
+                    return false;
+                out[o++] = c;
+            }
+            out[o] = '\0';
+            return true;
+        }
+        p = stop + 1;
     }
-
-    // End response
-    httpd_resp_send_chunk(req, nullptr, 0);
-    return ESP_OK;
+    return false;
 }
 
 static esp_err_t connect_post_handler(httpd_req_t *req)
@@ -169,52 +149,37 @@ static esp_err_t connect_post_handler(httpd_req_t *req)
     if (!ctx)
         return ESP_FAIL;
 
-    // 1. Read POST data
-    int len = req->content_len;
-    std::string body;
-    body.resize(len);
-    int ret = httpd_req_recv(req, reinterpret_cast<char *>(body.data()), len);
-    if (ret <= 0)
+    // 1. Read POST data (fixed buffer; a longer body cannot be a valid form)
+    char body[PORTAL_FORM_MAX];
+    const size_t len = req->content_len;
+    if (len == 0 || len > sizeof(body))
     {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No body");
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, len ? "Body too long" : "No body");
         return ESP_FAIL;
     }
-
-    // 2. Parse field helper (giữ nguyên logic của bạn)
-    auto get_field = [&](const std::string &key) -> std::string
+    size_t got = 0;
+    while (got < len)
     {
-        std::string needle = key + "=";
-        size_t i = body.find(needle);
-        if (i == std::string::npos)
-            return "";
-        i += needle.size();
-        size_t j = body.find('&', i);
-        std::string val = body.substr(i, (j == std::string::npos) ? std::string::npos : (j - i));
-        std::string dec;
-        for (size_t k = 0; k < val.size(); ++k)
+        int ret = httpd_req_recv(req, body + got, len - got);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT)
+            continue;
+        if (ret <= 0)
         {
-            if (val[k] == '+')
-                dec.push_back(' ');
-            else if (val[k] == '%' && k + 2 < val.size())
-            {
-                char hex[3] = {val[k + 1], val[k + 2], 0};
-                dec.push_back((char)strtol(hex, nullptr, 16));
-                k += 2;
-            }
-            else
-                dec.push_back(val[k]);
+            httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "No body");
+            return ESP_FAIL;
         }
-        return dec;
-    };
-
-    std::string ssid = get_field("ssid");
-    std::string pass = get_field("pass");
+        got += ret;
+    }
 
-    if (ssid.empty())
+    // 2. Parse fields in place
+    WifiConnParams conn{ctx->svc, {}, {}};
+    if (!form_field(body, len, "ssid", conn.ssid, sizeof(conn.ssid)) || conn.ssid[0] == '\0')
     {
         httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Empty SSID");
         return ESP_FAIL;
     }
+    if (!form_field(body, len, "pass", conn.pass, sizeof(conn.pass)))
+        conn.pass[0] = '\0';
 
     // 3. GỬI PHẢN HỒI TRƯỚC (Quan trọng nhất để tránh Deadlock)
     httpd_resp_set_status(req, "303 See Other");
@@ -222,20 +187,21 @@ static esp_err_t connect_post_handler(httpd_req_t *req)
     httpd_resp_send(req, nullptr, 0);
 
     // 4. Tạo một Task riêng để xử lý kết nối (Deferred Execution)
-    WifiConnParams *params = new WifiConnParams{ctx->svc, ssid, pass};
+    WifiConnParams *params = new WifiConnParams(conn);
 
-    xTaskCreate([](void *arg)
+    // Short-lived, beside the Wi-Fi stack on core 0 (core 1 belongs to audio)
+    xTaskCreatePinnedToCore([](void *arg)
                 {
                     WifiConnParams *p = (WifiConnParams *)arg;
                     vTaskDelay(pdMS_TO_TICKS(500)); // Đợi 0.5s để server gửi xong gói tin HTTP cuối cùng
 
                     ESP_LOGI("WifiTask", "Executing connection switch...");
-                    p->svc->connectWithCredentials(p->ssid.c_str(), p->pass.c_str());
+                    p->svc->connectWithCredentials(p->ssid, p->pass);
 
                     delete p;          // Giải phóng bộ nhớ struct
                     vTaskDelete(NULL); // Tự xóa task
                 },
-                "wifi_conn_task", 4096, params, 5, NULL);
+                "wifi_conn_task", 4096, params, 5, NULL, 0);
 
     return ESP_OK;
 }
@@ -272,6 +238,61 @@ static esp_err_t logo2_get_handler(httpd_req_t *req)
         LOGO2_PNG_LEN);
 }
 // --------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------
+// Fast reconnect cache
+// RTC copy survives deep sleep (and carries the DHCP lease); the NVS copy
+// (BSSID + channel only) covers cold boots and is rewritten only on change.
+// --------------------------------------------------------------------------------
+struct WifiFastCache
+{
+    uint32_t magic;
+    uint32_t ssid_hash;
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t has_lease;
+    uint32_t ip;
+    uint32_t gw;
+    uint32_t netmask;
+    uint32_t dns;
+};
+
+static constexpr uint32_t FAST_CACHE_MAGIC = 0x57464331; // "WFC1"
+static constexpr const char *FAST_CACHE_KEY = "wifi_fast";
+
+RTC_DATA_ATTR static WifiFastCache s_rtc_fast;
+
+static uint32_t ssidHash(const std::string &ssid)
+{
+    // FNV-1a: cache only applies to the network it was learned on
+    uint32_t h = 2166136261u;
+    for (unsigned char c : ssid)
+        h = (h ^ c) * 16777619u;
+    return h;
+}
+
+static bool loadFastCache(const std::string &ssid, WifiFastCache &out)
+{
+    const uint32_t want = ssidHash(ssid);
+    if (s_rtc_fast.magic == FAST_CACHE_MAGIC && s_rtc_fast.ssid_hash == want)
+    {
+        out = s_rtc_fast;
+        return true;
+    }
+
+    nvs_handle_t h;
+    if (nvs_open("storage", NVS_READONLY, &h) != ESP_OK)
+        return false;
+    WifiFastCache c{};
+    size_t len = sizeof(c);
+    esp_err_t e = nvs_get_blob(h, FAST_CACHE_KEY, &c, &len);
+    nvs_close(h);
+    if (e != ESP_OK || len != sizeof(c) || c.magic != FAST_CACHE_MAGIC || c.ssid_hash != want)
+        return false;
+    c.has_lease = 0; // leases are only trusted across deep sleep
+    out = c;
+    return true;
+}
+
 // WifiService implementation
 // --------------------------------------------------------------------------------
 
@@ -295,7 +316,8 @@ void WifiService::init()
     wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
     ESP_ERROR_CHECK(esp_wifi_init(&cfg));
 
-    ESP_ERROR_CHECK(esp_wifi_set_ps(WIFI_PS_NONE)); 
+    ESP_ERROR_CHECK(esp_wifi_set_ps(ps_type));
+    scan_done_sem = xSemaphoreCreateBinary();
     registerEvents();
     ESP_LOGI(TAG, "WifiService initialized");
 }
@@ -349,13 +371,24 @@ void WifiService::startCaptivePortal(const std::string &ap_ssid, const uint8_t a
     if (httpd_start(&http_server, &http_cfg) == ESP_OK)
     {
 
-        // GET /
-        httpd_uri_t root_get = {};
-        root_get.uri = "/";
-        root_get.method = HTTP_GET;
-        root_get.handler = root_get_handler;
-        root_get.user_ctx = &http_ctx;
-        httpd_register_uri_handler(http_server, &root_get);
+        // GET / (+ other pre-gzipped pages)
+        for (size_t i = 0; i < PORTAL_ASSET_COUNT; i++)
+        {
+            httpd_uri_t page_get = {};
+            page_get.uri = PORTAL_ASSETS[i].uri;
+            page_get.method = HTTP_GET;
+            page_get.handler = static_get_handler;
+            page_get.user_ctx = const_cast<PortalAsset *>(&PORTAL_ASSETS[i]);
+            httpd_register_uri_handler(http_server, &page_get);
+        }
+
+        // GET /networks.json
+        httpd_uri_t networks_get = {};
+        networks_get.uri = "/networks.json";
+        networks_get.method = HTTP_GET;
+        networks_get.handler = networks_get_handler;
+        networks_get.user_ctx = &http_ctx;
+        httpd_register_uri_handler(http_server, &networks_get);
 
         // POST /connect
         httpd_uri_t connect_post = {};
@@ -405,7 +438,6 @@ void WifiService::stopCaptivePortal()
 
     portal_running = false;
     ap_only_mode = false;
-    cached_networks.clear();
 
     // Thử kết nối lại STA nếu có credentials cũ
     loadCredentials();
@@ -434,6 +466,90 @@ void WifiService::disableAutoConnect()
     auto_connect_enabled = false;
 }
 
+void WifiService::setFastReconnect(bool enable, bool reuse_lease)
+{
+    fast_enabled = enable;
+    fast_reuse_lease = reuse_lease;
+}
+
+void WifiService::setPowerSave(wifi_ps_type_t ps)
+{
+    if (ps == ps_type)
+        return;
+    ps_type = ps;
+    esp_err_t err = esp_wifi_set_ps(ps);
+    if (err != ESP_OK && err != ESP_ERR_WIFI_NOT_INIT)
+        ESP_LOGW(TAG, "esp_wifi_set_ps(%d) failed: %s", (int)ps, esp_err_to_name(err));
+    ESP_LOGI(TAG, "Modem sleep %s", ps == WIFI_PS_MAX_MODEM ? "max" : ps == WIFI_PS_MIN_MODEM ? "min" : "off");
+}
+
+bool WifiService::findRoamCandidate(int8_t min_rssi, uint32_t max_age_ms, ScanEntry &out) const
+{
+    wifi_ap_record_t ap = {};
+    if (!connected || scanAgeMs() > max_age_ms || esp_wifi_sta_get_ap_info(&ap) != ESP_OK)
+        return false;
+
+    bool found = false;
+    portENTER_CRITICAL(&scan_lock);
+    for (size_t k = 0; k < scan_count; k++)
+    {
+        const ScanEntry &e = scan_cache[k];
+        if (e.seen_gen == scan_gen && e.rssi >= min_rssi && memcmp(e.bssid, ap.bssid, sizeof(e.bssid)) != 0 &&
+            strncmp(e.ssid, sta_ssid.c_str(), sizeof(e.ssid)) == 0)
+        {
+            out = e;
+            found = true;
+            break; // one entry per SSID
+        }
+    }
+    portEXIT_CRITICAL(&scan_lock);
+    return found;
+}
+
+bool WifiService::roamTo(const ScanEntry &ap)
+{
+    if (!connected || ap_only_mode || portal_running || ap.channel < 1 || ap.channel > 14)
+        return false;
+    memcpy(roam_bssid, ap.bssid, sizeof(roam_bssid));
+    roam_channel = ap.channel;
+    roam_pending = true;
+    ESP_LOGI(TAG, "Roaming to " MACSTR " ch %u (%d dBm)", MAC2STR(ap.bssid), ap.channel, ap.rssi);
+    if (esp_wifi_disconnect() != ESP_OK)
+    {
+        roam_pending = false;
+        return false;
+    }
+    return true;
+}
+
+bool WifiService::requestBssTransition()
+{
+#if CONFIG_WPA_11KV_SUPPORT
+    if (!connected || !esp_wnm_is_btm_supported_connection())
+        return false;
+    // The AP answers with a BTM request; the supplicant reassociates itself
+    // (WIFI_REASON_ROAMING disconnect, then GOT_IP as usual)
+    if (esp_wnm_send_bss_transition_mgmt_query(REASON_RSSI, nullptr, 0) != 0)
+        return false;
+    ESP_LOGI(TAG, "BSS transition query sent");
+    return true;
+#else
+    return false;
+#endif
+}
+
+void WifiService::forgetFastReconnect()
+{
+    s_rtc_fast.magic = 0;
+    nvs_handle_t h;
+    if (nvs_open("storage", NVS_READWRITE, &h) == ESP_OK)
+    {
+        nvs_erase_key(h, FAST_CACHE_KEY);
+        nvs_commit(h);
+        nvs_close(h);
+    }
+}
+
 std::string WifiService::getIp() const
 {
     if (!sta_netif)
@@ -448,6 +564,14 @@ std::string WifiService::getIp() const
     return std::string();
 }
 
+int8_t WifiService::getRssi() const
+{
+    wifi_ap_record_t ap = {};
+    if (!connected || esp_wifi_sta_get_ap_info(&ap) != ESP_OK)
+        return 0;
+    return ap.rssi;
+}
+
 void WifiService::connectWithCredentials(const char *ssid, const char *pass)
 {
     if (!ssid)
@@ -456,6 +580,8 @@ void WifiService::connectWithCredentials(const char *ssid, const char *pass)
     ESP_LOGI(TAG, "connectWithCredentials: %s", ssid);
 
     // Lưu credentials trước
+    if (sta_ssid != ssid)
+        forgetFastReconnect(); // new network: the cached AP is meaningless
     sta_ssid = ssid;
     sta_pass = pass ? pass : "";
     saveCredentials(sta_ssid.c_str(), sta_pass.c_str());
@@ -482,59 +608,245 @@ void WifiService::connectWithCredentials(const char *ssid, const char *pass)
     startSTA();
 }
 
-std::vector<WifiInfo> WifiService::scanNetworks()
+bool WifiService::startScan(const WifiScanOptions &opt)
 {
-    std::vector<WifiInfo> out;
-
     // Block scanning if portal or AP-only mode is active
     if (ap_only_mode || portal_running)
     {
         ESP_LOGW(TAG, "Scan blocked: portal/AP active");
-        return {};
+        return false;
     }
 
     if (!wifi_started)
     {
         ESP_LOGW(TAG, "Scan blocked: wifi not started");
-        return {};
+        return false;
     }
 
+    // One already running: its results land in the same cache. A scan the
+    // driver dropped without SCAN_DONE (esp_wifi_stop) expires after 10 s.
+    const int64_t now = esp_timer_get_time();
+    bool idle = false;
+    if (!scanning.compare_exchange_strong(idle, true))
+    {
+        if (now - scan_start_us < 10 * 1000 * 1000)
+            return true;
+        ESP_LOGW(TAG, "Previous scan never completed; restarting");
+    }
+    scan_start_us = now;
+
     wifi_scan_config_t cfg = {};
     cfg.ssid = nullptr;
     cfg.bssid = nullptr;
-    cfg.channel = 0;
-    cfg.show_hidden = true;
+    cfg.channel = opt.channel;
+    cfg.show_hidden = opt.show_hidden;
+    if (opt.passive)
+    {
+        cfg.scan_type = WIFI_SCAN_TYPE_PASSIVE;
+        cfg.scan_time.passive = opt.passive_ms;
+    }
+    else
+    {
+        cfg.scan_type = WIFI_SCAN_TYPE_ACTIVE;
+        cfg.scan_time.active.min = opt.active_min_ms;
+        cfg.scan_time.active.max = opt.active_max_ms;
+    }
 
-    esp_err_t e = esp_wifi_scan_start(&cfg, true); // blocking
+    scan_channel = opt.channel;
+    xSemaphoreTake(scan_done_sem, 0); // drop a stale completion
+    esp_err_t e = esp_wifi_scan_start(&cfg, false);
     if (e != ESP_OK)
     {
-        ESP_LOGW(TAG, "scan start failed: %d", e);
-        return out;
+        // ESP_ERR_WIFI_STATE: STA is connecting; the caller retries later
+        ESP_LOGW(TAG, "scan start failed: %s", esp_err_to_name(e));
+        scanning = false;
+        return false;
     }
+    return true;
+}
 
-    uint16_t ap_num = 0;
-    esp_wifi_scan_get_ap_num(&ap_num);
-    if (ap_num == 0)
-        return out;
+bool WifiService::waitScan(uint32_t timeout_ms)
+{
+    if (!scanning.load())
+        return true;
+    if (xSemaphoreTake(scan_done_sem, pdMS_TO_TICKS(timeout_ms)) != pdTRUE)
+        return false;
+    return true;
+}
 
-    std::vector<wifi_ap_record_t> records(ap_num);
-    esp_wifi_scan_get_ap_records(&ap_num, records.data());
+uint32_t WifiService::scanAgeMs() const
+{
+    portENTER_CRITICAL(&scan_lock);
+    const int64_t done = scan_done_us;
+    portEXIT_CRITICAL(&scan_lock);
+    if (done == 0)
+        return UINT32_MAX;
+    const int64_t age = (esp_timer_get_time() - done) / 1000;
+    return age > (int64_t)UINT32_MAX ? UINT32_MAX : (uint32_t)age;
+}
 
-    for (uint16_t i = 0; i < ap_num; i++)
+bool WifiService::refreshScan(uint32_t max_age_ms, uint32_t timeout_ms, const WifiScanOptions &opt)
+{
+    if (max_age_ms && scanAgeMs() <= max_age_ms)
+        return true;
+    if (!startScan(opt))
+        return false;
+    return waitScan(timeout_ms);
+}
+
+void WifiService::setScanRefresh(uint32_t interval_ms, const WifiScanOptions &opt)
+{
+    scan_refresh_opt = opt;
+    if (scan_timer)
     {
-        WifiInfo wi;
-        wi.ssid = reinterpret_cast<const char *>(records[i].ssid);
-        wi.rssi = records[i].rssi;
-        out.push_back(wi);
+        esp_timer_stop(scan_timer);
+    }
+    else if (interval_ms)
+    {
+        esp_timer_create_args_t args = {};
+        args.callback = &WifiService::scanRefreshTimer;
+        args.arg = this;
+        args.name = "wifi_scan";
+        if (esp_timer_create(&args, &scan_timer) != ESP_OK)
+        {
+            ESP_LOGW(TAG, "scan refresh timer create failed");
+            return;
+        }
     }
+    if (interval_ms)
+        esp_timer_start_periodic(scan_timer, (uint64_t)interval_ms * 1000);
+}
+
+void WifiService::scanRefreshTimer(void *arg)
+{
+    auto *self = static_cast<WifiService *>(arg);
+    // Connected only: a scan while the STA is connecting fails, and one
+    // during a voice turn would take the radio off-channel mid-stream
+    if (self->connected && !self->scan_paused && !self->scanning.load())
+        self->startScan(self->scan_refresh_opt);
+}
+
+// WIFI_EVENT_SCAN_DONE (event task): merge the records into the cache
+void WifiService::onScanDone()
+{
+    uint16_t n = SCAN_RECORDS_MAX;
+    if (esp_wifi_scan_get_ap_records(&n, scan_records) != ESP_OK)
+        n = 0;
+    esp_wifi_clear_ap_list(); // records beyond SCAN_RECORDS_MAX
+
+    // Merge on a copy: only this task writes, readers never wait on a merge
+    ScanEntry cache[SCAN_CACHE_MAX];
+    portENTER_CRITICAL(&scan_lock);
+    memcpy(cache, scan_cache, sizeof(cache));
+    size_t count = scan_count;
+    portEXIT_CRITICAL(&scan_lock);
+
+    const bool full = scan_channel == 0;
+    const uint8_t gen = full ? (uint8_t)(scan_gen + 1) : scan_gen;
+    for (uint16_t i = 0; i < n; i++)
+    {
+        const wifi_ap_record_t &r = scan_records[i];
+        const char *ssid = reinterpret_cast<const char *>(r.ssid);
+        if (ssid[0] == '\0')
+            continue;
 
+        ScanEntry *e = nullptr;
+        for (size_t k = 0; k < count && !e; k++)
+        {
+            if (strncmp(cache[k].ssid, ssid, sizeof(cache[k].ssid)) == 0)
+                e = &cache[k];
+        }
+        if (e)
+        {
+            // Several BSSIDs of one SSID: keep the strongest of this scan
+            if (e->seen_gen == gen && e->rssi >= r.rssi)
+                continue;
+        }
+        else if (count < SCAN_CACHE_MAX)
+        {
+            e = &cache[count++];
+        }
+        else
+        {
+            ScanEntry *weakest = &cache[0];
+            for (size_t k = 1; k < count; k++)
+            {
+                if (cache[k].rssi < weakest->rssi)
+                    weakest = &cache[k];
+            }
+            if (weakest->rssi >= r.rssi)
+                continue;
+            e = weakest;
+        }
+        strncpy(e->ssid, ssid, sizeof(e->ssid) - 1);
+        e->ssid[sizeof(e->ssid) - 1] = '\0';
+        e->rssi = r.rssi;
+        e->channel = r.primary;
+        e->seen_gen = gen;
+        memcpy(e->bssid, r.bssid, sizeof(e->bssid));
+    }
+
+    // Age out after SCAN_MISS_MAX full scans (single-channel scans only add)
+    if (full)
+    {
+        size_t kept = 0;
+        for (size_t k = 0; k < count; k++)
+        {
+            if ((uint8_t)(gen - cache[k].seen_gen) < SCAN_MISS_MAX)
+                cache[kept++] = cache[k];
+        }
+        count = kept;
+    }
+
+    portENTER_CRITICAL(&scan_lock);
+    memcpy(scan_cache, cache, sizeof(cache));
+    scan_count = count;
+    scan_gen = gen;
+    scan_done_us = esp_timer_get_time();
+    portEXIT_CRITICAL(&scan_lock);
+
+    scanning = false;
+    xSemaphoreGive(scan_done_sem);
+    ESP_LOGI(TAG, "Scan done: %u APs, %u cached", (unsigned)n, (unsigned)count);
+}
+
+size_t WifiService::snapshotNetworks(ScanEntry out[SCAN_CACHE_MAX]) const
+{
+    portENTER_CRITICAL(&scan_lock);
+    memcpy(out, scan_cache, sizeof(scan_cache));
+    const size_t count = scan_count;
+    portEXIT_CRITICAL(&scan_lock);
+    std::sort(out, out + count, [](const ScanEntry &a, const ScanEntry &b) { return a.rssi > b.rssi; });
+    return count;
+}
+
+std::vector<WifiInfo> WifiService::getCachedNetworks() const
+{
+    ScanEntry cache[SCAN_CACHE_MAX];
+    const size_t count = snapshotNetworks(cache);
+
+    std::vector<WifiInfo> out;
+    out.reserve(count);
+    for (size_t k = 0; k < count; k++)
+    {
+        WifiInfo wi;
+        wi.ssid = cache[k].ssid;
+        wi.rssi = cache[k].rssi;
+        out.push_back(std::move(wi));
+    }
     return out;
 }
 
+std::vector<WifiInfo> WifiService::scanNetworks()
+{
+    refreshScan(0, 5000);
+    return getCachedNetworks();
+}
+
 void WifiService::scanAndCache()
 {
-    cached_networks = scanNetworks();
-    ESP_LOGI(TAG, "Scanned and cached %d networks", cached_networks.size());
+    refreshScan(0, 5000);
+    ESP_LOGI(TAG, "Scanned and cached %u networks", (unsigned)scan_count);
 }
 
 void WifiService::ensureStaStarted()
@@ -561,14 +873,13 @@ void WifiService::ensureStaStarted()
 // --------------------------------------------------------------------------------
 void WifiService::loadCredentials()
 {
-    std::string s, p;
-    if (nvs_get_string("storage", "ssid", s))
+    // SSID / PASS live in NVS "storage", cached in RAM by ConfigStore
+    const ConfigStore &store = ConfigStore::instance();
+    std::string s = store.getString(ConfigStore::Key::SSID);
+    if (!s.empty())
     {
         sta_ssid = s;
-    }
-    if (nvs_get_string("storage", "pass", p))
-    {
-        sta_pass = p;
+        sta_pass = store.getString(ConfigStore::Key::PASS);
     }
     ESP_LOGI(TAG, "loadCredentials: Loaded SSID: %s, Pass: %s",
              sta_ssid.c_str(), sta_pass.empty() ? "<empty>" : "<set>");
@@ -576,8 +887,10 @@ void WifiService::loadCredentials()
 
 void WifiService::saveCredentials(const char *ssid, const char *pass)
 {
-    nvs_set_string("storage", "ssid", ssid ? ssid : "");
-    nvs_set_string("storage", "pass", pass ? pass : "");
+    ConfigStore &store = ConfigStore::instance();
+    store.setStr(ConfigStore::Key::SSID, ssid);
+    store.setStr(ConfigStore::Key::PASS, pass);
+    store.flush(); // new network: durable before any restart
 }
 
 void WifiService::startSTA()
@@ -592,24 +905,157 @@ void WifiService::startSTA()
              sta_ssid.c_str(), sta_pass.empty() ? "<empty>" : "<set>");
 
     wifi_config_t cfg = {};
-    strncpy(reinterpret_cast<char *>(cfg.sta.ssid), sta_ssid.c_str(), sizeof(cfg.sta.ssid) - 1);
-    strncpy(reinterpret_cast<char *>(cfg.sta.password), sta_pass.c_str(), sizeof(cfg.sta.password) - 1);
+    buildStaConfig(cfg, fast_enabled);
 
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
     ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &cfg));
     ESP_ERROR_CHECK(esp_wifi_start());
 
-    esp_wifi_set_ps(WIFI_PS_NONE); 
+    esp_wifi_set_ps(ps_type);
 
     wifi_started = true;
     ESP_LOGI(TAG, "WiFi STA started. Connecting to SSID: %s (password: %s)",
              sta_ssid.c_str(), sta_pass.empty() ? "<empty>" : "<set>");
+    connect_start_us = esp_timer_get_time();
     esp_wifi_connect();
 
     if (status_cb)
         status_cb(1); // CONNECTING
 }
 
+// directed: lock onto the cached BSSID/channel with a fast (first match)
+// scan; otherwise scan all channels and pick the strongest AP.
+void WifiService::buildStaConfig(wifi_config_t &cfg, bool directed)
+{
+    cfg = {};
+    strncpy(reinterpret_cast<char *>(cfg.sta.ssid), sta_ssid.c_str(), sizeof(cfg.sta.ssid) - 1);
+    strncpy(reinterpret_cast<char *>(cfg.sta.password), sta_pass.c_str(), sizeof(cfg.sta.password) - 1);
+
+    WifiFastCache cache{};
+    fast_attempt = directed && loadFastCache(sta_ssid, cache) && cache.channel >= 1 && cache.channel <= 14;
+    if (fast_attempt)
+    {
+        memcpy(cfg.sta.bssid, cache.bssid, sizeof(cfg.sta.bssid));
+        cfg.sta.bssid_set = true;
+        cfg.sta.channel = cache.channel;
+        cfg.sta.scan_method = WIFI_FAST_SCAN;
+        ESP_LOGI(TAG, "Fast reconnect: BSSID " MACSTR " ch %u%s", MAC2STR(cache.bssid), cache.channel,
+                 cache.has_lease && fast_reuse_lease ? " + cached lease" : "");
+    }
+    else
+    {
+        cfg.sta.scan_method = WIFI_ALL_CHANNEL_SCAN;
+        cfg.sta.sort_method = WIFI_CONNECT_AP_BY_SIGNAL;
+    }
+#if CONFIG_WPA_11KV_SUPPORT
+    // Advertise 802.11k / v so the AP can steer us (requestBssTransition())
+    cfg.sta.rm_enabled = 1;
+    cfg.sta.btm_enabled = 1;
+#endif
+
+    // Reapply the lease as static IP, or make sure DHCP runs
+    bool use_lease = fast_attempt && fast_reuse_lease && cache.has_lease;
+    if (use_lease)
+    {
+        esp_netif_ip_info_t ip{};
+        ip.ip.addr = cache.ip;
+        ip.gw.addr = cache.gw;
+        ip.netmask.addr = cache.netmask;
+        esp_netif_dhcpc_stop(sta_netif);
+        lease_applied = true;
+        if (esp_netif_set_ip_info(sta_netif, &ip) == ESP_OK)
+        {
+            esp_netif_dns_info_t dns{};
+            dns.ip.u_addr.ip4.addr = cache.dns;
+            dns.ip.type = ESP_IPADDR_TYPE_V4;
+            esp_netif_set_dns_info(sta_netif, ESP_NETIF_DNS_MAIN, &dns);
+        }
+        else
+        {
+            setStaticLease(false);
+        }
+    }
+    else
+    {
+        setStaticLease(false);
+    }
+}
+
+// false: back to DHCP (no-op if it is already running)
+void WifiService::setStaticLease(bool enable)
+{
+    if (!enable && lease_applied && sta_netif)
+    {
+        esp_netif_dhcpc_start(sta_netif);
+    }
+    lease_applied = enable;
+}
+
+// Directed connect failed (AP moved channel, replaced, out of range): forget
+// it and associate the slow way
+void WifiService::fallbackToFullScan()
+{
+    ESP_LOGW(TAG, "Fast reconnect failed - falling back to full scan");
+    s_rtc_fast.magic = 0;
+
+    wifi_config_t cfg = {};
+    buildStaConfig(cfg, false);
+    esp_wifi_set_config(WIFI_IF_STA, &cfg);
+    esp_wifi_connect();
+}
+
+// Called on GOT_IP: remember the AP and (RTC only) the lease
+void WifiService::saveFastCache()
+{
+    wifi_ap_record_t ap{};
+    if (esp_wifi_sta_get_ap_info(&ap) != ESP_OK)
+        return;
+
+    WifiFastCache c{};
+    c.magic = FAST_CACHE_MAGIC;
+    c.ssid_hash = ssidHash(sta_ssid);
+    memcpy(c.bssid, ap.bssid, sizeof(c.bssid));
+    c.channel = ap.primary;
+
+    esp_netif_ip_info_t ip{};
+    esp_netif_dns_info_t dns{};
+    if (sta_netif && esp_netif_get_ip_info(sta_netif, &ip) == ESP_OK &&
+        esp_netif_get_dns_info(sta_netif, ESP_NETIF_DNS_MAIN, &dns) == ESP_OK)
+    {
+        c.ip = ip.ip.addr;
+        c.gw = ip.gw.addr;
+        c.netmask = ip.netmask.addr;
+        c.dns = dns.ip.u_addr.ip4.addr;
+        c.has_lease = c.ip != 0;
+    }
+
+    // NVS only when the AP changed (flash wear: every wake reconnects)
+    bool ap_changed = s_rtc_fast.magic != FAST_CACHE_MAGIC || s_rtc_fast.ssid_hash != c.ssid_hash ||
+                      s_rtc_fast.channel != c.channel || memcmp(s_rtc_fast.bssid, c.bssid, sizeof(c.bssid)) != 0;
+    s_rtc_fast = c;
+
+    if (ap_changed)
+    {
+        WifiFastCache stored{};
+        WifiFastCache nv = c;
+        nv.has_lease = 0;
+        nv.ip = nv.gw = nv.netmask = nv.dns = 0;
+
+        nvs_handle_t h;
+        if (nvs_open("storage", NVS_READWRITE, &h) == ESP_OK)
+        {
+            size_t len = sizeof(stored);
+            if (nvs_get_blob(h, FAST_CACHE_KEY, &stored, &len) != ESP_OK || len != sizeof(stored) ||
+                memcmp(&stored, &nv, sizeof(nv)) != 0)
+            {
+                nvs_set_blob(h, FAST_CACHE_KEY, &nv, sizeof(nv));
+                nvs_commit(h);
+            }
+            nvs_close(h);
+        }
+    }
+}
+
 void WifiService::registerEvents()
 {
     esp_event_handler_instance_t instance_any_id;
@@ -647,6 +1093,12 @@ void WifiService::ipEventHandlerStatic(void *arg, esp_event_base_t base,
 
 void WifiService::wifiEventHandler(esp_event_base_t base, int32_t id, void *data)
 {
+    // Scan records are owned by the driver until read, whatever the mode
+    if (id == WIFI_EVENT_SCAN_DONE)
+    {
+        onScanDone();
+        return;
+    }
     if (ap_only_mode)
         return;
 
@@ -656,15 +1108,44 @@ void WifiService::wifiEventHandler(esp_event_base_t base, int32_t id, void *data
         ESP_LOGI(TAG, "WIFI_EVENT_STA_START");
         break;
     case WIFI_EVENT_STA_DISCONNECTED:
-        ESP_LOGW(TAG, "WIFI_EVENT_STA_DISCONNECTED");
+    {
+        const auto *ev = static_cast<const wifi_event_sta_disconnected_t *>(data);
+        ESP_LOGW(TAG, "WIFI_EVENT_STA_DISCONNECTED (reason %d)", ev ? (int)ev->reason : -1);
         connected = false;
         if (status_cb)
             status_cb(0);
-        if (auto_connect_enabled && !sta_ssid.empty())
+#if CONFIG_WPA_11KV_SUPPORT
+        // BSS transition in progress: the supplicant connects on its own
+        if (ev && ev->reason == WIFI_REASON_ROAMING)
+            break;
+#endif
+        if (roam_pending.exchange(false))
         {
+            // Our roamTo(): directed connect; a failure falls back to a full scan
+            wifi_config_t cfg = {};
+            buildStaConfig(cfg, false);
+            memcpy(cfg.sta.bssid, roam_bssid, sizeof(cfg.sta.bssid));
+            cfg.sta.bssid_set = true;
+            cfg.sta.channel = roam_channel;
+            cfg.sta.scan_method = WIFI_FAST_SCAN;
+            fast_attempt = true;
+            connect_start_us = esp_timer_get_time();
+            esp_wifi_set_config(WIFI_IF_STA, &cfg);
             esp_wifi_connect();
         }
+        else if (auto_connect_enabled && !sta_ssid.empty())
+        {
+            if (fast_attempt)
+            {
+                fallbackToFullScan();
+            }
+            else
+            {
+                esp_wifi_connect();
+            }
+        }
         break;
+    }
     default:
         break;
     }
@@ -679,6 +1160,15 @@ void WifiService::ipEventHandler(esp_event_base_t base, int32_t id, void *event)
     {
         connected = true;
         has_connected_once = true;
+        if (connect_start_us)
+        {
+            ESP_LOGI(TAG, "Time to IP: %lld ms (%s)", (esp_timer_get_time() - connect_start_us) / 1000,
+                     fast_attempt ? (lease_applied ? "fast + lease" : "fast") : "full scan");
+            connect_start_us = 0;
+        }
+        // Later drops reconnect to whatever is best, not necessarily this AP
+        fast_attempt = false;
+        saveFastCache();
         if (status_cb)
             status_cb(2);
         if (portal_running)
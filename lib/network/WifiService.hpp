@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <functional>
@@ -8,6 +9,9 @@
 #include "esp_event.h"
 #include "esp_http_server.h"
 #include "esp_err.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 
 /**
  * WifiInfo
@@ -19,6 +23,22 @@ struct WifiInfo {
     int rssi = -99;
 };
 
+/**
+ * WifiScanOptions
+ * ---------------------------------------------------------
+ * - Kiểu scan + thời gian dừng mỗi kênh (dwell)
+ * - Active: gửi probe request, dwell ngắn; passive: chỉ nghe beacon
+ *   (không phát gì, nhưng mỗi kênh phải chờ lâu hơn một chu kỳ beacon)
+ */
+struct WifiScanOptions {
+    bool passive = false;
+    uint8_t channel = 0;          // 0 = mọi kênh
+    uint16_t active_min_ms = 0;   // dwell / kênh, active
+    uint16_t active_max_ms = 60;
+    uint16_t passive_ms = 150;    // dwell / kênh, passive (> 1 beacon interval)
+    bool show_hidden = false;
+};
+
 /**
  * HandlerContext for HTTP server
  * ---------------------------------------------------------
@@ -38,7 +58,9 @@ struct HandlerContext
  * - Init WiFi stack (NVS, netif, wifi driver)
  * - Auto-connect STA nếu có credentials
  * - Nếu không → mở Captive Portal
- * - Cung cấp scan WiFi
+ * - Cung cấp scan WiFi (không chặn): kết quả vào cache nhỏ cố định,
+ *   gộp theo SSID, cập nhật dần mỗi WIFI_EVENT_SCAN_DONE; portal và BLE
+ *   provisioning chỉ đọc cache
  * - Callback khi WiFi CONNECTING / CONNECTED / DISCONNECTED
  */
 class WifiService {
@@ -65,15 +87,44 @@ public:
     // Trạng thái
     bool isConnected() const { return connected; }
     std::string getIp() const;
+    // RSSI of the associated AP (dBm), 0 when not connected
+    int8_t getRssi() const;
     std::string getSsid() const { return sta_ssid; }
 
     // Credential
     void connectWithCredentials(const char* ssid, const char* pass);
 
     // Scan WiFi
-    std::vector<WifiInfo> scanNetworks();
+    // Start a scan and return at once (STA up, no portal, no scan running);
+    // results are merged into the cache on WIFI_EVENT_SCAN_DONE.
+    bool startScan(const WifiScanOptions& opt = {});
+    bool isScanning() const { return scanning.load(); }
+    // Wait up to timeout_ms for the running scan; true if none is running.
+    bool waitScan(uint32_t timeout_ms);
+    // ms since the last completed scan (UINT32_MAX: never)
+    uint32_t scanAgeMs() const;
+    // Cache younger than max_age_ms → nothing to do; else scan and wait up
+    // to timeout_ms. True if the cache is fresh afterwards.
+    bool refreshScan(uint32_t max_age_ms, uint32_t timeout_ms, const WifiScanOptions& opt = {});
+    // Background refresh every interval_ms while connected and not paused
+    // (voice turn / download pause it); 0 = off.
+    void setScanRefresh(uint32_t interval_ms, const WifiScanOptions& opt = {});
+    void pauseScanRefresh(bool paused) { scan_paused = paused; }
+
+    std::vector<WifiInfo> scanNetworks();  // blocking: fresh scan, then the cache
     void scanAndCache();  // Scan and cache networks (to be called before portal)
-    std::vector<WifiInfo> getCachedNetworks() const { return cached_networks; }
+    // Cache snapshot, strongest first
+    std::vector<WifiInfo> getCachedNetworks() const;
+    // Same without allocating (portal JSON); returns the entry count
+    static constexpr size_t SCAN_CACHE_MAX = 20;
+    struct ScanEntry {
+        char ssid[33];
+        int8_t rssi;
+        uint8_t channel;
+        uint8_t seen_gen;  // scan_gen of the last full scan that saw it
+        uint8_t bssid[6];  // the strongest AP of that SSID
+    };
+    size_t snapshotNetworks(ScanEntry out[SCAN_CACHE_MAX]) const;
     void ensureStaStarted(); // Ensure STA mode is started
 
     // Callback status: 0=DISCONNECTED, 1=CONNECTING, 2=GOT_IP
@@ -82,12 +133,51 @@ public:
     // Control AP-only mode from external (e.g., HTTP handlers)
     void setApOnlyMode(bool enabled) { ap_only_mode = enabled; }
 
+    // Fast reconnect: BSSID + channel của lần kết nối tốt gần nhất được giữ
+    // trong RTC memory (qua deep sleep) và NVS (cold boot). startSTA() thử
+    // connect thẳng tới AP đó trên đúng 1 kênh trước, lỗi mới quét toàn bộ.
+    // reuse_lease: sau deep sleep áp lại IP/GW/DNS cũ làm static IP (bỏ qua
+    // DHCP hoàn toàn) — chỉ bật khi router giữ lease đủ lâu.
+    void setFastReconnect(bool enable, bool reuse_lease = false);
+    // Drop the cached AP (e.g. after the user changes networks)
+    void forgetFastReconnect();
+
+    // Modem sleep: WIFI_PS_MIN_MODEM wakes per DTIM, WIFI_PS_MAX_MODEM per
+    // listen interval (deeper, more latency) so the idle profile can
+    // light-sleep; off (WIFI_PS_NONE) for lowest latency during a voice turn
+    // or on a failing link. Applied immediately if the driver is up.
+    void setPowerSave(wifi_ps_type_t ps);
+    wifi_ps_type_t powerSave() const { return ps_type; }
+    bool isPowerSave() const { return ps_type != WIFI_PS_NONE; }
+
+    // Roaming within the configured SSID (LinkQualityMonitor decides when).
+    // Strongest cached BSSID of our SSID other than the current AP, heard
+    // at min_rssi or better by a scan younger than max_age_ms.
+    bool findRoamCandidate(int8_t min_rssi, uint32_t max_age_ms, ScanEntry &out) const;
+    // Disconnect and associate directly with that AP; if it fails the usual
+    // full-scan fallback picks whatever is best. False: not connected.
+    bool roamTo(const ScanEntry &ap);
+    // 802.11v: ask the AP for a BSS transition (it answers with a candidate
+    // list and the supplicant moves). False: not built with
+    // CONFIG_WPA_11KV_SUPPORT, or the AP does not support BTM.
+    bool requestBssTransition();
+
 private:
     void loadCredentials();
     void saveCredentials(const char* ssid, const char* pass);
     void startSTA();
     void registerEvents();
 
+    // Fast reconnect helpers
+    void buildStaConfig(wifi_config_t& cfg, bool directed);
+    void saveFastCache();
+    void fallbackToFullScan();
+    void setStaticLease(bool enable);
+
+    // Scan cache (event task writes, readers copy under scan_lock)
+    void onScanDone();
+    static void scanRefreshTimer(void* arg);
+
     // Event handlers
     static void wifiEventHandlerStatic(void* arg, esp_event_base_t base,
                                       int32_t id, void* data);
@@ -109,13 +199,44 @@ private:
     bool ap_only_mode = false;
     bool has_connected_once = false;  // Track if WiFi ever connected successfully
     bool wifi_started = false;  // Track if WiFi has been started
+    wifi_ps_type_t ps_type = WIFI_PS_NONE;
+
+    // Fast reconnect state
+    bool fast_enabled = true;
+    bool fast_reuse_lease = false;
+    bool fast_attempt = false;     // current connect is the directed one
+    bool lease_applied = false;    // static IP from the cached lease is set
+    // Roam: target set by roamTo(), applied by the DISCONNECTED it causes
+    std::atomic<bool> roam_pending{false};
+    uint8_t roam_bssid[6] = {};
+    uint8_t roam_channel = 0;
+    int64_t connect_start_us = 0;  // startSTA() → GOT_IP timing
 
     esp_netif_t* sta_netif = nullptr;
     esp_netif_t* ap_netif = nullptr;
 
     httpd_handle_t http_server = nullptr;
     HandlerContext http_ctx{ this };
-    std::vector<WifiInfo> cached_networks;  // Cache WiFi scan results
+
+    // Scan cache: one entry per SSID (strongest BSSID), fixed capacity so a
+    // scan never allocates. An entry missed by SCAN_MISS_MAX full scans in a
+    // row is dropped; when full, a stronger AP replaces the weakest entry.
+    static constexpr size_t SCAN_RECORDS_MAX = 24; // records read per scan
+    static constexpr uint8_t SCAN_MISS_MAX = 3;
+    ScanEntry scan_cache[SCAN_CACHE_MAX] = {};
+    size_t scan_count = 0;
+    uint8_t scan_gen = 0;
+    int64_t scan_done_us = 0;  // 0 = never
+    mutable portMUX_TYPE scan_lock = portMUX_INITIALIZER_UNLOCKED;
+    wifi_ap_record_t scan_records[SCAN_RECORDS_MAX] = {};
+    std::atomic<bool> scanning{false};
+    uint8_t scan_channel = 0;  // channel of the running scan (0 = all)
+    int64_t scan_start_us = 0;
+    SemaphoreHandle_t scan_done_sem = nullptr;
+
+    esp_timer_handle_t scan_timer = nullptr;
+    WifiScanOptions scan_refresh_opt;
+    volatile bool scan_paused = false;
 
     std::function<void(int)> status_cb = nullptr;
 };
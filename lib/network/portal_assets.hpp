@@ -0,0 +1,199 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// Auto-generated from lib/network/web/ by scripts/convert_portal.py
+// Do not edit: change the web files and re-run the script.
+
+struct PortalAsset
+{
+    const char *uri;
+    const char *type;
+    const uint8_t *gz; // gzip body (Content-Encoding: gzip)
+    size_t gz_len;
+    const char *etag; // quoted, for If-None-Match
+};
+
+// index.html: 4806 bytes -> 2078 gzip
+static const uint8_t PORTAL_INDEX_HTML_GZ[] = {
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xA5, 0x58, 
+    0x5B, 0x6F, 0xE3, 0xC6, 0x15, 0x7E, 0xD7, 0xAF, 0x38, 0x4B, 0x63, 0x4B, 
+    0xA9, 0x35, 0xA9, 0x9B, 0xA5, 0x55, 0x74, 0x2B, 0x10, 0x67, 0x8B, 0x2C, 
+    0x92, 0xEC, 0x2E, 0x6A, 0xB7, 0x41, 0xB1, 0xF0, 0xC3, 0x90, 0x1C, 0x92, 
+    0x63, 0x51, 0x1C, 0x76, 0x38, 0xB4, 0xAC, 0x38, 0x7E, 0xCA, 0x63, 0x50, 
+    0x60, 0xF3, 0x54, 0xF4, 0xA9, 0x28, 0x16, 0x45, 0xD1, 0x20, 0x79, 0x29, 
+    0x0A, 0x14, 0xB0, 0x81, 0xF6, 0xC1, 0xFB, 0x47, 0xF4, 0x4F, 0x7A, 0x66, 
+    0x48, 0x4A, 0xD4, 0xC5, 0x9B, 0x02, 0x85, 0x00, 0x53, 0x9C, 0x39, 0x73, 
+    0xCE, 0x77, 0xBE, 0x73, 0x1B, 0x79, 0xFC, 0xE4, 0x93, 0x57, 0xA7, 0xE7, 
+    0xBF, 0x7B, 0xFD, 0x1C, 0x42, 0x39, 0x8F, 0xA6, 0xB5, 0x71, 0xF9, 0xA0, 
+    0xC4, 0xC3, 0xC7, 0x9C, 0x4A, 0x02, 0x6E, 0x48, 0x44, 0x4A, 0xE5, 0xC4, 
+    0xCC, 0xA4, 0x6F, 0x0D, 0xCC, 0x72, 0x39, 0x26, 0x73, 0x3A, 0x31, 0xAF, 
+    0x18, 0x5D, 0x24, 0x5C, 0x48, 0x13, 0x5C, 0x1E, 0x4B, 0x1A, 0xA3, 0xD8, 
+    0x82, 0x79, 0x32, 0x9C, 0x78, 0xF4, 0x8A, 0xB9, 0xD4, 0xD2, 0x2F, 0xC7, 
+    0xC0, 0x62, 0x26, 0x19, 0x89, 0xAC, 0xD4, 0x25, 0x11, 0x9D, 0xB4, 0x95, 
+    0x12, 0xC9, 0x64, 0x44, 0xA7, 0xCF, 0xCF, 0x5E, 0x77, 0x3B, 0x70, 0xCA, 
+    0x63, 0x9F, 0x05, 0xE3, 0x66, 0xBE, 0x56, 0x1B, 0xA7, 0x72, 0xA9, 0x9E, 
+    0x0E, 0xF7, 0x96, 0x70, 0x03, 0x3E, 0x6A, 0xB6, 0x7C, 0x32, 0x67, 0xD1, 
+    0x72, 0x08, 0x29, 0x89, 0x53, 0x2B, 0xA5, 0x82, 0xF9, 0x23, 0x70, 0x88, 
+    0x3B, 0x0B, 0x04, 0xCF, 0x62, 0x6F, 0x08, 0x47, 0x7E, 0xC7, 0x3F, 0xF1, 
+    0x07, 0x23, 0xF0, 0x58, 0x9A, 0x44, 0x04, 0x25, 0xFD, 0x88, 0x5E, 0x8F, 
+    0xE0, 0x32, 0x4B, 0x25, 0xF3, 0x97, 0x56, 0x01, 0x6F, 0x08, 0x2E, 0xFE, 
+    0xA5, 0x62, 0x04, 0x24, 0x62, 0x41, 0x6C, 0x31, 0x49, 0xE7, 0xE9, 0x66, 
+    0x71, 0xCE, 0x62, 0x2B, 0xA4, 0x2C, 0x08, 0x51, 0xB0, 0xDD, 0x6A, 0x5D, 
+    0x85, 0xB8, 0x44, 0x44, 0xC0, 0xE2, 0x21, 0xB4, 0x46, 0x70, 0x5B, 0xB3, 
+    0x5D, 0x22, 0x3C, 0x84, 0xB4, 0x6D, 0xD9, 0x47, 0x2C, 0x09, 0xF1, 0x3C, 
+    0x16, 0x07, 0x43, 0xE8, 0xF4, 0x12, 0x34, 0xEB, 0x70, 0xE1, 0x51, 0x61, 
+    0x09, 0xE2, 0xB1, 0x0C, 0xF5, 0xB7, 0x3B, 0xF9, 0xE2, 0xB5, 0x95, 0x86, 
+    0xC4, 0xE3, 0x0B, 0x54, 0x07, 0x83, 0xE4, 0x1A, 0x3A, 0x2D, 0xFC, 0x23, 
+    0x02, 0x87, 0xD4, 0x5B, 0xC7, 0xFA, 0x63, 0xB7, 0x1B, 0x23, 0xD0, 0xA4, 
+    0x69, 0x00, 0x4F, 0x95, 0xFD, 0x6B, 0xAB, 0x58, 0xE8, 0xB5, 0x5A, 0x4A, 
+    0x0D, 0xC2, 0x88, 0x78, 0xC0, 0xB5, 0x4B, 0x84, 0xC5, 0x54, 0x20, 0xA0, 
+    0xFF, 0xCB, 0xEB, 0x80, 0x24, 0x43, 0x0D, 0xA5, 0xF4, 0xD6, 0x72, 0xB8, 
+    0x94, 0x7C, 0x5E, 0x3A, 0x53, 0x1A, 0x64, 0xF3, 0x00, 0x4D, 0x95, 0xE8, 
+    0xF2, 0x03, 0x25, 0x5B, 0x24, 0x93, 0x7C, 0x04, 0xDC, 0xB9, 0xA4, 0x2E, 
+    0x06, 0x8B, 0x29, 0x93, 0x39, 0xBC, 0x2D, 0x0F, 0x4E, 0x7A, 0x4F, 0x4B, 
+    0x6E, 0x50, 0x03, 0xFA, 0x9E, 0xF2, 0x88, 0x79, 0x70, 0x44, 0x29, 0x55, 
+    0x66, 0xC2, 0x0E, 0xEA, 0x97, 0xF4, 0x5A, 0x5A, 0x1A, 0xE7, 0x06, 0xA1, 
+    0xCB, 0x23, 0x8E, 0x27, 0x8E, 0xBA, 0xDD, 0x6E, 0x25, 0x22, 0xF8, 0xD1, 
+    0x04, 0xB6, 0x46, 0x0A, 0x21, 0x4B, 0xE5, 0x16, 0x25, 0xCA, 0x6C, 0x89, 
+    0xAE, 0xD3, 0xD7, 0x60, 0xF9, 0x15, 0x15, 0x7E, 0xC4, 0x17, 0xD6, 0xB2, 
+    0x04, 0x7C, 0x08, 0x4B, 0x9B, 0x9E, 0xD0, 0xC1, 0x5E, 0x08, 0x07, 0x87, 
+    0xE8, 0x29, 0xE3, 0xB1, 0x60, 0x3E, 0xD3, 0xAC, 0xA2, 0xDD, 0x75, 0x26, 
+    0xA8, 0xA0, 0x43, 0xBB, 0x9A, 0x0E, 0xE5, 0xB9, 0x8A, 0x35, 0xBF, 0xA5, 
+    0x3E, 0xE8, 0x61, 0x26, 0x52, 0xE5, 0x62, 0xC2, 0x59, 0xEE, 0xF2, 0x4F, 
+    0x45, 0x34, 0x4D, 0x08, 0xD6, 0x97, 0x43, 0xE5, 0x82, 0xD2, 0xF8, 0x91, 
+    0xC0, 0x56, 0x91, 0x0D, 0x43, 0xE5, 0xFD, 0x6E, 0xEE, 0x52, 0x8A, 0x75, 
+    0xD3, 0xD3, 0x92, 0x69, 0xCA, 0x3C, 0x4B, 0x91, 0x5F, 0x96, 0xDC, 0xA2, 
+    0x20, 0xAF, 0xDF, 0x6A, 0x6D, 0x22, 0xD0, 0xF1, 0xBA, 0xCF, 0x4E, 0x90, 
+    0x1D, 0x2D, 0x91, 0xB2, 0xAF, 0x28, 0x7A, 0x73, 0x82, 0x2E, 0xA2, 0x02, 
+    0x81, 0x1A, 0xD0, 0xC5, 0xEB, 0x9D, 0x18, 0x0A, 0xA5, 0x65, 0xFB, 0x40, 
+    0x5B, 0x71, 0x52, 0x6A, 0x7C, 0xD6, 0x1E, 0xB4, 0x3E, 0xEA, 0x6B, 0x08, 
+    0x0E, 0x41, 0x8E, 0x2A, 0x39, 0xD6, 0xED, 0x55, 0x53, 0x2C, 0x67, 0x72, 
+    0x0B, 0xBD, 0x87, 0xE8, 0x9F, 0xED, 0x85, 0xAA, 0x5B, 0x09, 0x95, 0xE4, 
+    0x49, 0xB1, 0x50, 0x06, 0x7F, 0x08, 0x21, 0xF3, 0x3C, 0xC5, 0x59, 0x61, 
+    0xD1, 0x57, 0x16, 0x2B, 0x55, 0xFF, 0xF4, 0xB0, 0x42, 0x94, 0xA6, 0xF3, 
+    0x44, 0x2E, 0x77, 0x43, 0x7C, 0xC8, 0x93, 0x88, 0x38, 0x34, 0xB2, 0x7D, 
+    0x46, 0x23, 0xAF, 0x64, 0xB3, 0x70, 0x5D, 0xAB, 0xDA, 0xA2, 0xD7, 0xE1, 
+    0x91, 0xB7, 0xD1, 0x71, 0x42, 0x7A, 0xBD, 0x7E, 0xB5, 0x8D, 0x39, 0x11, 
+    0x77, 0x67, 0x7B, 0x99, 0x57, 0xD4, 0x25, 0x8B, 0x93, 0x4C, 0xBE, 0x91, 
+    0xCB, 0x04, 0x5B, 0xB1, 0xE2, 0xDC, 0xBC, 0x50, 0xBD, 0x76, 0xB3, 0x96, 
+    0x90, 0x34, 0x5D, 0xA0, 0x2F, 0xE6, 0x45, 0xA5, 0x70, 0xB5, 0x87, 0x1B, 
+    0x17, 0x0E, 0xD5, 0x7D, 0x35, 0x6B, 0xB7, 0xD2, 0xD5, 0x75, 0xBC, 0x1E, 
+    0x6D, 0xED, 0x11, 0xD4, 0x5F, 0xB7, 0x37, 0xF6, 0x95, 0xD6, 0xBA, 0x4E, 
+    0xF8, 0xDD, 0x90, 0xF9, 0x03, 0x9F, 0xF8, 0xEE, 0x1A, 0xFB, 0xD0, 0xE7, 
+    0x6E, 0x96, 0xAA, 0xAC, 0xCC, 0x0F, 0xAC, 0x0B, 0xBD, 0x3D, 0xE8, 0xB8, 
+    0xD8, 0x13, 0x78, 0x26, 0x23, 0xAC, 0xE7, 0x21, 0xC4, 0x3C, 0xA6, 0xA3, 
+    0x03, 0x7D, 0x57, 0x25, 0x6E, 0x88, 0x15, 0xAD, 0x3C, 0xDD, 0xEF, 0x83, 
+    0x8F, 0xB7, 0xBB, 0xC7, 0xCB, 0x79, 0xAF, 0x12, 0x77, 0x53, 0x7D, 0x2F, 
+    0x56, 0x19, 0xCE, 0x23, 0x9C, 0x49, 0x11, 0xB6, 0xBE, 0x12, 0xE8, 0x16, 
+    0x2C, 0xED, 0x69, 0x25, 0x00, 0xFD, 0x6A, 0x56, 0xE7, 0x6F, 0x7B, 0x46, 
+    0xB7, 0xC6, 0x8E, 0x93, 0x21, 0xC0, 0xF8, 0xF1, 0x10, 0x76, 0xF6, 0x2A, 
+    0xA3, 0xE4, 0xAF, 0x80, 0xBA, 0x08, 0x91, 0x83, 0x4D, 0x40, 0x0B, 0x32, 
+    0x0F, 0xC4, 0xF0, 0x50, 0x66, 0xEE, 0x42, 0x93, 0x02, 0x67, 0x30, 0xCE, 
+    0x73, 0xAE, 0xE0, 0xD9, 0x9D, 0x74, 0x94, 0x97, 0xBB, 0x5E, 0xF6, 0xB9, 
+    0x40, 0x22, 0xB3, 0x24, 0xA1, 0xC2, 0x25, 0x29, 0xDD, 0x80, 0x3F, 0xDC, 
+    0x7E, 0x3A, 0x4E, 0xDF, 0x75, 0xB4, 0x8B, 0xE3, 0x66, 0x31, 0xF4, 0xC7, 
+    0xCD, 0xE2, 0xF2, 0xA1, 0xA6, 0x3F, 0x3E, 0x3C, 0x76, 0x05, 0x6E, 0x84, 
+    0x34, 0x4E, 0x4C, 0x35, 0x7C, 0xCD, 0xAD, 0x25, 0x63, 0x7B, 0x10, 0x1A, 
+    0xB8, 0xA9, 0x86, 0x54, 0x75, 0x13, 0xDF, 0x0D, 0x48, 0x85, 0x3B, 0x31, 
+    0x9A, 0xEA, 0xBD, 0x6D, 0x5F, 0x26, 0xC1, 0xFF, 0x20, 0xD7, 0x29, 0xE5, 
+    0x9A, 0x68, 0x4D, 0xDD, 0x88, 0x3A, 0xD3, 0xD3, 0xD5, 0xDD, 0x5F, 0x33, 
+    0x08, 0x1F, 0x7E, 0x88, 0x43, 0xF8, 0x92, 0xFD, 0x8A, 0x21, 0xD2, 0xCE, 
+    0x36, 0xC0, 0xED, 0x19, 0x64, 0x02, 0xF3, 0xF2, 0x35, 0x73, 0x5A, 0x95, 
+    0xD2, 0x5D, 0xC4, 0x9C, 0xBE, 0x7F, 0x4B, 0xE2, 0x00, 0xE4, 0xEA, 0xEE, 
+    0x1D, 0xB3, 0x6D, 0x3B, 0xB7, 0x53, 0x5A, 0xD3, 0xFD, 0xA3, 0x84, 0xA7, 
+    0xDB, 0x88, 0x31, 0x3D, 0x3B, 0x7B, 0xF1, 0xC9, 0xB8, 0xA9, 0x77, 0x14, 
+    0x7C, 0x9D, 0x53, 0x68, 0xC0, 0x48, 0x0D, 0xD0, 0xC5, 0x6E, 0xA8, 0x28, 
+    0x18, 0x80, 0xE9, 0xEF, 0xD2, 0x10, 0x23, 0x47, 0xC5, 0xC4, 0x38, 0x0D, 
+    0x57, 0xF7, 0x7F, 0x88, 0x21, 0xE4, 0xAB, 0xBB, 0x7F, 0xB9, 0x10, 0x87, 
+    0xAB, 0xBB, 0x1F, 0x13, 0x90, 0x0F, 0xDF, 0xC7, 0xDA, 0x01, 0xE3, 0x11, 
+    0x4B, 0x5F, 0xA0, 0x98, 0x84, 0x19, 0x4A, 0xFF, 0x3D, 0x3B, 0x64, 0x31, 
+    0x29, 0x2D, 0x96, 0xED, 0x65, 0xC7, 0xEA, 0xCB, 0xDC, 0xCE, 0xBC, 0xA2, 
+    0x66, 0xCF, 0xD4, 0xBA, 0x3A, 0x8C, 0xB5, 0xEA, 0x5C, 0xA7, 0x1B, 0x52, 
+    0x77, 0x86, 0x7D, 0xC3, 0xC8, 0x9D, 0x0B, 0x0D, 0xE0, 0xB1, 0x1B, 0x31, 
+    0x77, 0x86, 0x0E, 0xF2, 0x20, 0x88, 0xE8, 0xEB, 0xC2, 0x68, 0xBD, 0x61, 
+    0x4C, 0xE1, 0x53, 0xB6, 0xBA, 0xFF, 0x26, 0x06, 0x89, 0x7E, 0x7E, 0xBB, 
+    0x65, 0xB0, 0xB6, 0x01, 0x5E, 0x54, 0xCF, 0x5A, 0x4D, 0x9A, 0x39, 0x73, 
+    0x26, 0xBF, 0xC4, 0xC1, 0xA8, 0x54, 0x7C, 0xB6, 0xBA, 0xFB, 0xF7, 0x39, 
+    0xBC, 0x5C, 0xDD, 0xBF, 0x7D, 0x31, 0x6E, 0xE6, 0xA2, 0x9B, 0xA8, 0xA7, 
+    0xAE, 0x60, 0x89, 0x9C, 0xD6, 0xFC, 0x2C, 0x76, 0x55, 0xC2, 0x03, 0x56, 
+    0x79, 0x3D, 0x6D, 0xDC, 0x78, 0xD8, 0xB5, 0xE6, 0xD8, 0x4E, 0xEC, 0x80, 
+    0xCA, 0xE7, 0x11, 0x55, 0x5F, 0x3F, 0x5E, 0xBE, 0xF0, 0xEA, 0x66, 0x6A, 
+    0x36, 0xEC, 0x2B, 0x12, 0x65, 0x74, 0x92, 0x8E, 0x1E, 0x15, 0x4A, 0x50, 
+    0x48, 0xF7, 0xBD, 0x7A, 0x03, 0xE7, 0xE6, 0x5A, 0xF7, 0xAE, 0x7B, 0x37, 
+    0xB5, 0x2B, 0x22, 0x20, 0x81, 0x09, 0x7C, 0x48, 0xD3, 0xA8, 0x96, 0xD8, 
+    0x8A, 0xB9, 0x0F, 0x89, 0xA5, 0x21, 0x5A, 0xD4, 0xC4, 0x52, 0x0F, 0x7E, 
+    0x09, 0xF9, 0xA8, 0x80, 0x21, 0x6C, 0xE6, 0xC3, 0xA8, 0x56, 0x01, 0x92, 
+    0xB8, 0xB2, 0x2E, 0x1A, 0x37, 0x20, 0xA8, 0xCC, 0x44, 0x0C, 0x02, 0xC6, 
+    0x13, 0xB0, 0xB0, 0xE7, 0xE0, 0xD1, 0x16, 0x9E, 0x12, 0x30, 0xC5, 0xF7, 
+    0x9E, 0x7A, 0x55, 0x8B, 0xD8, 0x37, 0xE1, 0xE7, 0x50, 0x17, 0xF0, 0x0B, 
+    0xF5, 0xDA, 0x50, 0xC5, 0xDC, 0x6C, 0xC2, 0x8D, 0x11, 0xE3, 0xD5, 0x84, 
+    0x8B, 0x59, 0x6A, 0x0C, 0x6F, 0x8C, 0xB1, 0xBA, 0x5C, 0x4C, 0x8D, 0xE1, 
+    0x58, 0xDD, 0x11, 0xA6, 0xC7, 0x98, 0xEF, 0xB7, 0xB7, 0xE0, 0x0B, 0x3E, 
+    0xC7, 0xC8, 0x51, 0xC8, 0x7F, 0x2B, 0x00, 0xFE, 0x38, 0x88, 0xC1, 0x25, 
+    0x88, 0xB3, 0xC2, 0x37, 0xA6, 0xC9, 0xCB, 0x42, 0x51, 0x1D, 0x35, 0xA6, 
+    0x05, 0x2B, 0xAA, 0xAA, 0x3E, 0xE4, 0xB1, 0xAE, 0x3A, 0xE4, 0x46, 0xC9, 
+    0xEA, 0xF6, 0x8F, 0xC2, 0xAF, 0xF4, 0xE5, 0xD4, 0x9E, 0xD1, 0x65, 0xA1, 
+    0xCA, 0x9E, 0x93, 0xA4, 0x5E, 0x9A, 0xAA, 0xCF, 0x36, 0x1E, 0xBF, 0x99, 
+    0x1D, 0x83, 0x92, 0x78, 0x33, 0xBB, 0xB8, 0x40, 0x7F, 0x50, 0x8F, 0xD6, 
+    0x61, 0x63, 0x1F, 0x94, 0x9B, 0x03, 0xE4, 0x18, 0x9C, 0xCD, 0x19, 0xE7, 
+    0x4D, 0xFB, 0x02, 0x2C, 0x20, 0xF8, 0xC8, 0x8F, 0x28, 0x08, 0xB6, 0x62, 
+    0xFA, 0x34, 0xBF, 0xB2, 0x21, 0x02, 0x13, 0x79, 0x66, 0x3E, 0xD4, 0x9F, 
+    0xE4, 0xEA, 0x22, 0x1A, 0x07, 0x32, 0x6C, 0xC0, 0x4D, 0x2E, 0xCB, 0x62, 
+    0x6C, 0x1A, 0x9F, 0x9E, 0x7F, 0xF1, 0x39, 0x4A, 0x1A, 0x07, 0x1A, 0xC6, 
+    0x67, 0xE1, 0xC3, 0x3F, 0x55, 0xC7, 0x78, 0xF8, 0x41, 0xD1, 0x86, 0xCD, 
+    0x68, 0xA9, 0x32, 0xFE, 0x2F, 0xB8, 0x94, 0x77, 0x23, 0x95, 0xB2, 0xC6, 
+    0xA8, 0x96, 0xE3, 0x51, 0x01, 0xCD, 0xAD, 0x60, 0x4B, 0x7E, 0x8E, 0xA4, 
+    0x6E, 0x70, 0x33, 0x59, 0x49, 0x2D, 0x15, 0x6B, 0x26, 0x11, 0x74, 0x41, 
+    0x96, 0xE0, 0x8B, 0x2A, 0xAF, 0xAE, 0xA0, 0x44, 0xD2, 0x82, 0xDA, 0xBA, 
+    0x89, 0x26, 0x14, 0xAB, 0x28, 0x64, 0x6B, 0x6C, 0x2F, 0xF1, 0x47, 0xA0, 
+    0xF2, 0x6B, 0x7D, 0xCB, 0x34, 0xF3, 0xCD, 0xA2, 0xD6, 0x70, 0x6B, 0x6D, 
+    0x15, 0x99, 0x52, 0xC5, 0x83, 0xB6, 0x5A, 0x17, 0x2A, 0x49, 0x72, 0xC1, 
+    0x47, 0x7D, 0x5E, 0xDF, 0x46, 0xCD, 0xA2, 0x29, 0x56, 0x37, 0xCB, 0x9B, 
+    0xE6, 0x76, 0x5F, 0xCD, 0x6F, 0x8F, 0xFB, 0x6B, 0x7E, 0xB0, 0xD6, 0xB1, 
+    0xD6, 0xB4, 0xB5, 0x60, 0x14, 0x1E, 0x85, 0x2C, 0xF2, 0x04, 0x8D, 0x11, 
+    0xE0, 0x4E, 0xDC, 0x34, 0xE8, 0x9C, 0x1F, 0x54, 0x88, 0x0B, 0x4A, 0xFC, 
+    0xF7, 0x19, 0x15, 0xCB, 0x33, 0x3D, 0xF5, 0xB9, 0xA8, 0x9B, 0xC5, 0x55, 
+    0x52, 0xD1, 0x83, 0xDF, 0x6C, 0x3D, 0xCD, 0x6C, 0x3D, 0xAF, 0x15, 0xCB, 
+    0x58, 0x1C, 0xE6, 0x53, 0xB3, 0xBA, 0xB5, 0x99, 0x83, 0x7A, 0x7F, 0x0A, 
+    0xFD, 0xBE, 0x2A, 0xCD, 0xA3, 0x93, 0x81, 0xE3, 0x3C, 0x1B, 0xA8, 0xEA, 
+    0x54, 0x8B, 0xDD, 0xAE, 0x5E, 0xA4, 0xDE, 0xE0, 0xA3, 0x6E, 0x5F, 0x97, 
+    0xEC, 0x11, 0xED, 0x75, 0x69, 0x97, 0x9A, 0x3B, 0x98, 0xDB, 0x17, 0x36, 
+    0x7A, 0x2C, 0x4F, 0xD5, 0xFB, 0x3E, 0x7A, 0x4C, 0x4D, 0x04, 0xE0, 0x7D, 
+    0xAC, 0xE2, 0xA3, 0x73, 0x8D, 0xE0, 0x84, 0x8E, 0x3D, 0x2D, 0x5D, 0x47, 
+    0x3D, 0x08, 0x5A, 0xA5, 0x2C, 0xF6, 0x00, 0x2A, 0x31, 0x55, 0xCC, 0x66, 
+    0x59, 0xBC, 0xF6, 0x65, 0xCA, 0x63, 0x6C, 0x1E, 0x58, 0xA6, 0xF1, 0x26, 
+    0x83, 0xAA, 0xCD, 0x41, 0x4B, 0xD4, 0x55, 0x44, 0x1B, 0xB5, 0x1D, 0xB1, 
+    0x4B, 0x15, 0xF3, 0x6A, 0x01, 0x5F, 0xDA, 0xA5, 0x5E, 0xF8, 0xFA, 0x6B, 
+    0xB8, 0xB9, 0x2D, 0x4E, 0xB9, 0x44, 0x56, 0xF3, 0x73, 0xF7, 0x54, 0x21, 
+    0x37, 0xAA, 0x74, 0x85, 0x4A, 0x07, 0xC7, 0xEA, 0xC1, 0x89, 0x8B, 0xDD, 
+    0x20, 0xFD, 0x60, 0x07, 0x2C, 0xFB, 0xF2, 0xA8, 0x90, 0xFE, 0xA9, 0xB6, 
+    0x5A, 0x4A, 0x33, 0xBF, 0xFE, 0x24, 0x45, 0x23, 0x78, 0x95, 0xA4, 0x58, 
+    0xFC, 0xE6, 0x6F, 0x33, 0x06, 0xD1, 0xC3, 0x3F, 0xB0, 0xE8, 0xDC, 0x7C, 
+    0xB6, 0xAA, 0xDA, 0xC3, 0xA0, 0x17, 0x7C, 0xA8, 0xEE, 0x57, 0x72, 0x88, 
+    0x86, 0x62, 0x4C, 0x0E, 0xF3, 0x18, 0x21, 0xCE, 0xA9, 0x0C, 0x39, 0xDE, 
+    0x78, 0xCC, 0xD7, 0xAF, 0xCE, 0xCE, 0xCD, 0xE3, 0x9A, 0xBA, 0xE3, 0x50, 
+    0x81, 0xB7, 0xAE, 0x1B, 0x30, 0x8B, 0x48, 0x59, 0xE7, 0xD8, 0xC5, 0x4D, 
+    0x14, 0xC1, 0xD8, 0x60, 0xF1, 0x10, 0xE5, 0x69, 0x13, 0x7F, 0x39, 0x2F, 
+    0x16, 0x96, 0xBA, 0x55, 0x59, 0x99, 0xC0, 0x7E, 0xE1, 0x72, 0x8F, 0x7A, 
+    0x26, 0xDC, 0x1E, 0xEB, 0x7F, 0x8E, 0xA0, 0xB0, 0xAA, 0x93, 0x89, 0x89, 
+    0xD1, 0xCD, 0xF7, 0x7E, 0xF3, 0xEB, 0x17, 0xA7, 0x7C, 0x9E, 0xE0, 0xFD, 
+    0x0E, 0xCB, 0x15, 0x71, 0x63, 0xD4, 0x7F, 0x96, 0xE8, 0x4A, 0x38, 0x2C, 
+    0x92, 0x34, 0x30, 0xF0, 0x79, 0xD8, 0x90, 0xCA, 0xC9, 0x14, 0xA1, 0x16, 
+    0x8E, 0xBE, 0x7F, 0xFB, 0xF0, 0x0E, 0x82, 0xD5, 0xFD, 0x8F, 0x0C, 0x96, 
+    0x0F, 0xDF, 0x67, 0xE0, 0xAE, 0xEE, 0xFE, 0x96, 0xC1, 0x6C, 0x75, 0xF7, 
+    0x1F, 0x09, 0xF1, 0xEA, 0xFE, 0x3B, 0x66, 0xC3, 0x86, 0x8B, 0xF7, 0xDF, 
+    0xAD, 0xEE, 0xDF, 0x31, 0xEC, 0x4A, 0x4C, 0xEF, 0x3B, 0x6A, 0x1A, 0xE3, 
+    0x1C, 0xBE, 0xFF, 0x33, 0xD3, 0x5B, 0x7F, 0x42, 0x91, 0x08, 0x5B, 0x15, 
+    0xB3, 0x4D, 0x9D, 0x69, 0x45, 0xC4, 0xA9, 0x10, 0xCA, 0x64, 0x61, 0xF0, 
+    0xF3, 0xD5, 0xFD, 0x1F, 0x59, 0xD5, 0x00, 0x7A, 0xA7, 0x40, 0x0B, 0xD1, 
+    0xD0, 0xA9, 0x89, 0x37, 0xC4, 0x62, 0x1A, 0xE3, 0x9C, 0xCE, 0xEF, 0x86, 
+    0xCD, 0xFC, 0xDF, 0x55, 0xFF, 0x05, 0x7D, 0x65, 0x9E, 0xAF, 0xC6, 0x12, 
+    0x00, 0x00, 
+};
+
+static const PortalAsset PORTAL_ASSETS[] = {
+    {"/", "text/html; charset=utf-8", PORTAL_INDEX_HTML_GZ, sizeof(PORTAL_INDEX_HTML_GZ), "\"2cc2c9e6a8229719\""},
+};
+
+static const size_t PORTAL_ASSET_COUNT = sizeof(PORTAL_ASSETS) / sizeof(PORTAL_ASSETS[0]);
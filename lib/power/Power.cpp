@@ -36,7 +36,22 @@ Power::Power(adc1_channel_t adc_channel, gpio_num_t pin_chg, gpio_num_t pin_full
 
 // Read VBAT real voltage, return -1 if disconnected/floating
 float Power::readVoltage() {
-    uint32_t raw = adc1_get_raw(channel_);
+    // Oversample: averaging N conversions buys ~log4(N) bits and beats the
+    // ESP32 ADC noise; min/max are dropped to reject single spikes
+    uint32_t sum = 0, lo = UINT32_MAX, hi = 0;
+    for (uint8_t i = 0; i < oversample_; i++) {
+        int r = adc1_get_raw(channel_);
+        uint32_t v = r < 0 ? 0 : static_cast<uint32_t>(r);
+        sum += v;
+        if (v < lo) lo = v;
+        if (v > hi) hi = v;
+    }
+    uint32_t n = oversample_;
+    if (n >= 4) {
+        sum -= lo + hi;
+        n -= 2;
+    }
+    uint32_t raw = (sum + n / 2) / n;
     uint32_t mv = esp_adc_cal_raw_to_voltage(raw, &adc_chars_);
 
     // If mv < 40mV -> impossible for real battery => floating/disconnected
@@ -49,25 +64,26 @@ float Power::readVoltage() {
     return vbat;
 }
 
-uint8_t Power::voltageToPercent(float v) {
-    struct { float v; uint8_t p; } tbl[] = {
-        {3.00, 0}, {3.30, 10}, {3.50, 25}, {3.70, 50},
-        {3.90, 75}, {4.10, 90}, {4.20, 100}
+float Power::ocvToPercent(float v) {
+    static constexpr struct { float v; float p; } tbl[] = {
+        {3.00f, 0}, {3.30f, 10}, {3.50f, 25}, {3.70f, 50},
+        {3.90f, 75}, {4.10f, 90}, {4.20f, 100}
     };
-
-    uint8_t raw_percent = 0;
-
-    if (v <= tbl[0].v) raw_percent = 0;
-    else if (v >= tbl[6].v) raw_percent = 100;
-    else {
-        for (int i = 0; i < 6; i++) {
-            if (v >= tbl[i].v && v < tbl[i + 1].v) {
-                float r = (v - tbl[i].v) / (tbl[i + 1].v - tbl[i].v);
-                raw_percent = tbl[i].p + r * (tbl[i + 1].p - tbl[i].p);
-                break;
-            }
+    constexpr int N = sizeof(tbl) / sizeof(tbl[0]);
+
+    if (v <= tbl[0].v) return 0.0f;
+    if (v >= tbl[N - 1].v) return 100.0f;
+    for (int i = 0; i < N - 1; i++) {
+        if (v < tbl[i + 1].v) {
+            float r = (v - tbl[i].v) / (tbl[i + 1].v - tbl[i].v);
+            return tbl[i].p + r * (tbl[i + 1].p - tbl[i].p);
         }
     }
+    return 100.0f;
+}
+
+uint8_t Power::voltageToPercent(float v) {
+    uint8_t raw_percent = static_cast<uint8_t>(ocvToPercent(v));
 
     // Hysteresis: only update when difference >= 5%
     static int last_percent = -1;
@@ -18,6 +18,9 @@ private:
 
     float R1_, R2_;
 
+    // Conversions averaged per reading (trimmed mean, min/max dropped)
+    uint8_t oversample_ = 64;
+
     // internal raw read
     float readVoltage();
     uint8_t voltageToPercent(float v);
@@ -37,6 +40,12 @@ public:
     // Public: expose voltage to PowerManager/UI
     float getVoltage() { return readVoltage(); }
 
+    // Burst size per getVoltage() (1 = single conversion, ~40 us each)
+    void setOversampling(uint8_t n) { oversample_ = n ? n : 1; }
+
+    // Resting (open-circuit) voltage → 0..100 %, continuous (no steps)
+    static float ocvToPercent(float v);
+
     // Return 0–100% valid OR BATTERY_INVALID (255)
     uint8_t getBatteryPercent();
 
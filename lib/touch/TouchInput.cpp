@@ -1,5 +1,7 @@
 #include "TouchInput.hpp"
 #include "esp_log.h"
+#include "esp_sleep.h"
+#include "driver/rtc_io.h"
 
 static const char *TAG = "TouchInput";
 
@@ -17,9 +19,42 @@ bool TouchInput::init(const Config &cfg)
     io.mode = GPIO_MODE_INPUT;
     io.pull_up_en = cfg_.active_low ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE;
     io.pull_down_en = cfg_.active_low ? GPIO_PULLDOWN_DISABLE : GPIO_PULLDOWN_ENABLE;
-    io.intr_type = GPIO_INTR_DISABLE;
+    io.intr_type = GPIO_INTR_ANYEDGE;
 
     ESP_ERROR_CHECK(gpio_config(&io));
+    gpio_intr_disable(cfg_.pin); // until start()
+
+    esp_timer_create_args_t args = {};
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.callback = &TouchInput::debounceTimerCb;
+    args.name = "touch_debounce";
+    if (esp_timer_create(&args, &debounce_timer_) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "esp_timer_create (debounce) failed");
+        return false;
+    }
+    args.callback = &TouchInput::longPressTimerCb;
+    args.name = "touch_long";
+    if (esp_timer_create(&args, &long_timer_) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "esp_timer_create (long press) failed");
+        return false;
+    }
+
+    // Shared per-pin dispatcher; another module may have installed it already
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE)
+    {
+        ESP_LOGE(TAG, "gpio_install_isr_service failed: %s", esp_err_to_name(err));
+        return false;
+    }
+    if (gpio_isr_handler_add(cfg_.pin, &TouchInput::isrHandler, this) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "gpio_isr_handler_add failed");
+        return false;
+    }
+    isr_added_ = true;
 
     last_state = readRaw();
     return true;
@@ -28,29 +63,37 @@ bool TouchInput::init(const Config &cfg)
 TouchInput::~TouchInput()
 {
     stop();
+    if (isr_added_)
+        gpio_isr_handler_remove(cfg_.pin);
+    if (debounce_timer_)
+        esp_timer_delete(debounce_timer_);
+    if (long_timer_)
+        esp_timer_delete(long_timer_);
 }
 
 void TouchInput::start()
 {
-    if (running)
+    if (running || !isr_added_)
         return;
     running = true;
 
-    xTaskCreatePinnedToCore(
-        taskEntry,
-        "TouchInput",
-        2048,
-        this,
-        3,
-        &task_,
-        0);
+    // Resync silently: a press held across stop/start is not reported
+    last_state = readRaw();
+    armed_ = true;
+    gpio_intr_enable(cfg_.pin);
 
-    ESP_LOGI(TAG, "TouchInput started");
+    ESP_LOGI(TAG, "TouchInput started (GPIO %d, interrupt)", (int)cfg_.pin);
 }
 
 void TouchInput::stop()
 {
-    running = false;
+    if (!running.exchange(false))
+        return;
+    armed_ = false;
+    gpio_intr_disable(cfg_.pin);
+    esp_timer_stop(debounce_timer_); // ESP_ERR_INVALID_STATE if idle: fine
+    esp_timer_stop(long_timer_);
+    ESP_LOGI(TAG, "TouchInput stopped");
 }
 
 void TouchInput::onEvent(std::function<void(Event)> cb)
@@ -69,50 +112,103 @@ bool TouchInput::readRaw() const
     return cfg_.active_low ? !level : level;
 }
 
-void TouchInput::taskEntry(void *arg)
+// ============================================================================
+// Interrupt + timers
+// ============================================================================
+void IRAM_ATTR TouchInput::isrHandler(void *arg)
 {
-    static_cast<TouchInput *>(arg)->loop();
+    auto *self = static_cast<TouchInput *>(arg);
+    // Bounces after the first edge only find armed_ cleared
+    if (self->armed_.exchange(false))
+        esp_timer_start_once(self->debounce_timer_, 0);
+}
+
+void TouchInput::debounceTimerCb(void *arg)
+{
+    static_cast<TouchInput *>(arg)->settle();
+}
+
+void TouchInput::longPressTimerCb(void *arg)
+{
+    auto *self = static_cast<TouchInput *>(arg);
+    if (self->running && self->last_state && self->cb_)
+        self->cb_(Event::LONG_PRESS);
+}
+
+void TouchInput::settle()
+{
+    if (!running)
+        return;
+
+    const bool state = readRaw();
+    if (state != last_state)
+    {
+        last_state = state;
+        if (state && cfg_.long_press_event && cfg_.long_press_ms)
+            esp_timer_start_once(long_timer_, static_cast<uint64_t>(cfg_.long_press_ms) * 1000);
+        else if (!state)
+            esp_timer_stop(long_timer_);
+
+        if (cb_)
+            cb_(state ? Event::PRESS : Event::RELEASE);
+
+        // Lock out the bounce, then sample again
+        esp_timer_start_once(debounce_timer_, static_cast<uint64_t>(cfg_.debounce_ms) * 1000);
+        return;
+    }
+
+    // Stable: re-arm. An edge during the lockout left no interrupt behind,
+    // so compare once more (the ISR may also win the race and re-trigger)
+    armed_ = true;
+    if (readRaw() != last_state && armed_.exchange(false))
+        esp_timer_start_once(debounce_timer_, 0);
 }
 
-void TouchInput::loop()
+// ============================================================================
+// Deep sleep wake
+// ============================================================================
+bool TouchInput::enableDeepSleepWake()
 {
-    while (running)
+    if (cfg_.pin == GPIO_NUM_NC || cfg_.wake == Wake::NONE)
+        return false;
+    if (!rtc_gpio_is_valid_gpio(cfg_.pin))
     {
-        bool state = readRaw();
-
-        if (state != last_state)
-        {
-            vTaskDelay(pdMS_TO_TICKS(cfg_.debounce_ms));
-            state = readRaw();
-
-            if (state != last_state)
-            {
-                last_state = state;
-
-                // if (state) {
-                //     press_tick = xTaskGetTickCount();
-                //     if (cb_) cb_(Event::PRESS);
-                // } else {
-                //     TickType_t held =
-                //         xTaskGetTickCount() - press_tick;
-
-                //     if (held * portTICK_PERIOD_MS >= cfg_.long_press_ms) {
-                //         if (cb_) cb_(Event::LONG_PRESS);
-                //     } else {
-                //         if (cb_) cb_(Event::RELEASE);
-                //     }
-                // }
-                if (cb_)
-                {
-                    cb_(state ? Event::PRESS : Event::RELEASE);
-                }
-            }
-
-           
-        }
-
-         vTaskDelay(pdMS_TO_TICKS(10));
+        ESP_LOGW(TAG, "GPIO %d is not an RTC GPIO, no deep-sleep wake on touch", (int)cfg_.pin);
+        return false;
     }
-    ESP_LOGI(TAG, "TouchInput stopped");
-    vTaskDelete(nullptr);
+
+    stop();
+
+    // Digital pulls are off in deep sleep: hold the idle level with the RTC ones
+    if (cfg_.active_low)
+    {
+        rtc_gpio_pullup_en(cfg_.pin);
+        rtc_gpio_pulldown_dis(cfg_.pin);
+    }
+    else
+    {
+        rtc_gpio_pulldown_en(cfg_.pin);
+        rtc_gpio_pullup_dis(cfg_.pin);
+    }
+
+    esp_err_t err;
+    if (cfg_.wake == Wake::EXT0)
+    {
+        err = esp_sleep_enable_ext0_wakeup(cfg_.pin, cfg_.active_low ? 0 : 1);
+    }
+    else
+    {
+        // ext1 does not power RTC peripherals on its own (pulls above)
+        esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_ON);
+        err = esp_sleep_enable_ext1_wakeup(1ULL << cfg_.pin,
+                                           cfg_.active_low ? ESP_EXT1_WAKEUP_ALL_LOW : ESP_EXT1_WAKEUP_ANY_HIGH);
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Deep-sleep wake on GPIO %d failed: %s", (int)cfg_.pin, esp_err_to_name(err));
+        return false;
+    }
+    ESP_LOGI(TAG, "Deep-sleep wake armed on GPIO %d (%s)", (int)cfg_.pin,
+             cfg_.wake == Wake::EXT0 ? "ext0" : "ext1");
+    return true;
 }
@@ -4,8 +4,8 @@
 #include <atomic>
 
 #include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "driver/gpio.h"
+#include "esp_timer.h"
 
 /**
  * Class:   TouchInput
@@ -17,8 +17,13 @@
  *  - Đọc trạng thái cảm ứng / nút bấm từ một chân GPIO
  *  - Hỗ trợ debounce, phát hiện nhấn dài
  *  - Gọi callback khi có sự kiện
- *  - Chạy trong task riêng để không block main thread
+ *  - Không có task riêng: ngắt GPIO (any edge) + esp_timer
  *  - Cấu hình đơn giản qua struct Config
+ *
+ * Debounce (leading edge): cạnh đầu tiên lấy mẫu chân ngay trong esp_timer
+ * task rồi báo sự kiện, sau đó khoá ngắt `debounce_ms`; hết khoá chân được
+ * lấy mẫu lại, nên nhấn ngắn hơn debounce vẫn có PRESS + RELEASE. Callback
+ * chạy trong esp_timer task: phải ngắn, không block (AppController::postEvent).
  */
 class TouchInput
 {
@@ -30,12 +35,24 @@ public:
         LONG_PRESS
     };
 
+    // Deep-sleep wake source on the same pin (needs an RTC-capable GPIO)
+    enum class Wake : uint8_t
+    {
+        NONE,
+        EXT0, // single pin, level from active_low
+        EXT1  // when ext0 is taken by another source
+    };
+
     struct Config
     {
         gpio_num_t pin;
         bool active_low = true;
         uint32_t long_press_ms = 1500;
         uint32_t debounce_ms = 30;
+        // Emit LONG_PRESS while still held (off: PRESS / RELEASE only,
+        // holding is press-to-talk)
+        bool long_press_event = false;
+        Wake wake = Wake::EXT0;
     };
 
 public:
@@ -49,14 +66,26 @@ public:
 
     //======= Event callback =======
     /**
-     * Register event callback
+     * Register event callback (called from the esp_timer task)
      * @param cb Callback function receiving Event
      */
     void onEvent(std::function<void(Event)> cb);
 
+    //======= Deep sleep =======
+    /**
+     * Arm the pin as deep-sleep wake source (Config::wake); call right
+     * before esp_deep_sleep_start().
+     * @return false if disabled or the pin is not an RTC GPIO
+     */
+    bool enableDeepSleepWake();
+
 private:
-    static void taskEntry(void *arg);
-    void loop();
+    static void isrHandler(void *arg);
+    static void debounceTimerCb(void *arg);
+    static void longPressTimerCb(void *arg);
+
+    // Sample, report a change, lock out / re-arm the interrupt
+    void settle();
 
     //======= Read raw input =======
     /**
@@ -69,10 +98,14 @@ private:
     Config cfg_{};
     std::function<void(Event)> cb_;
 
-    TaskHandle_t task_ = nullptr;
+    esp_timer_handle_t debounce_timer_ = nullptr;
+    esp_timer_handle_t long_timer_ = nullptr;
+    bool isr_added_ = false;
+
     std::atomic<bool> running{false};
+    // ISR may start the debounce timer (cleared by the first edge)
+    std::atomic<bool> armed_{false};
 
-    // debounce & timing
+    // Debounced state; only touched from the esp_timer task (and start())
     bool last_state = false;
-    TickType_t press_tick = 0;
 };
@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 import os
+import struct
 import argparse
 from typing import List, Optional, Tuple
 from PIL import Image, ImageSequence
@@ -80,8 +81,8 @@ def convert_icon(png_path, out_root, w=None, h=None):
         f.write("#pragma once\n")
         f.write("#include <cstdint>\n\n")
         f.write("namespace asset::icon {\n\n")
-        f.write("#ifndef ICON\n")
-        f.write("#define ICON\n\n")
+        f.write("#ifndef PTALK_ASSET_ICON_TYPE\n")
+        f.write("#define PTALK_ASSET_ICON_TYPE\n\n")
         f.write("struct Icon {\n")
         f.write("    int w;\n")
         f.write("    int h;\n")
@@ -177,6 +178,288 @@ def convert_emotion(gif_path, out_root, w=None, h=None, fps=10, loop=True):
     print(f"[EMOTION] {name_l} → {fw}x{fh}, {len(frames)} frames")
 
 
+# ============================================================
+# BUNDLE (GIFs → "assets" partition image, see lib/display/AssetBundle.hpp)
+# ============================================================
+
+BUNDLE_MAGIC = b"PTAB"
+BUNDLE_VERSION = 1
+
+def _align4(n):
+    return (n + 3) & ~3
+
+SOUND_PCM16 = 0
+SOUND_ADPCM = 1
+
+IMA_STEP = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+IMA_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+def ima_encode(samples):
+    """IMA ADPCM from state (0, 0), even sample in the HIGH nibble (AdpcmCodec)."""
+    pred, index, out = 0, 0, bytearray()
+    for i, s in enumerate(samples):
+        step = IMA_STEP[index]
+        diff = s - pred
+        code = 8 if diff < 0 else 0
+        diff = abs(diff)
+        if diff >= step:
+            code |= 4
+            diff -= step
+        if diff >= step >> 1:
+            code |= 2
+            diff -= step >> 1
+        if diff >= step >> 2:
+            code |= 1
+        dq = step >> 3
+        if code & 4:
+            dq += step
+        if code & 2:
+            dq += step >> 1
+        if code & 1:
+            dq += step >> 2
+        pred = max(-32768, min(32767, pred - dq if code & 8 else pred + dq))
+        index = max(0, min(88, index + IMA_INDEX[code]))
+        if i % 2 == 0:
+            out.append(code << 4)
+        else:
+            out[-1] |= code
+    return bytes(out)
+
+def load_sound(spec):
+    """"name=file.wav[:adpcm]" → (name, rate, format, data, samples); mono 16-bit WAV."""
+    import wave
+    name, _, rest = spec.partition("=")
+    path, _, fmt = rest.partition(":")
+    if len(name.encode()) > 16:
+        raise SystemExit(f"sound name too long (max 16): {name}")
+    with wave.open(path, "rb") as wf:
+        if wf.getnchannels() != 1 or wf.getsampwidth() != 2:
+            raise SystemExit(f"{path}: need mono 16-bit PCM")
+        rate = wf.getframerate()
+        pcm = wf.readframes(wf.getnframes())
+    samples = list(struct.unpack(f"<{len(pcm) // 2}h", pcm))
+    if fmt == "adpcm":
+        return name, rate, SOUND_ADPCM, ima_encode(samples), len(samples)
+    return name, rate, SOUND_PCM16, pcm, len(samples)
+
+def build_bundle(inputs, out_path, w=None, h=None, fps=10, loop=True, sounds=()):
+    """inputs: "path.gif" or "path.gif:fps". Frame 0 full, later frames diff
+    boxes (same encoding as convert_gif.py), unchanged frames carry no data.
+    sounds: "name=file.wav[:adpcm]" earcons (lib/audio/EarconPlayer.hpp),
+    appended after the animations so the device maps only that tail."""
+    from convert_gif import compute_diff_block  # same directory
+
+    anims = []
+    for spec in inputs:
+        path, _, fps_s = spec.partition(":")
+        name = os.path.splitext(os.path.basename(path))[0].lower()
+        if len(name.encode()) > 16:
+            raise SystemExit(f"name too long (max 16): {name}")
+        frames_px = []
+        for frame in ImageSequence.Iterator(Image.open(path)):
+            f, fw, fh = resize_with_aspect(frame.convert("L"), w, h)
+            frames_px.append(to_2bit(f))
+        blocks = []
+        for i, px in enumerate(frames_px):
+            if i == 0:
+                blocks.append({"x": 0, "y": 0, "width": fw, "height": fh, "data": encode_rle_2bit(px)})
+            else:
+                blocks.append(compute_diff_block(frames_px[i - 1], px, fw, fh))
+        anims.append((name, fw, fh, int(fps_s) if fps_s else fps, blocks))
+
+    # Layout: header | anim table | frame tables | blobs
+    off = 16 + 32 * len(anims)
+    frame_offs = []
+    for a in anims:
+        frame_offs.append(off)
+        off += 16 * len(a[4])
+    blob = bytearray()
+    blob_base = _align4(off)
+
+    table = bytearray()
+    frames = bytearray()
+    for (name, fw, fh, afps, blocks), f_off in zip(anims, frame_offs):
+        table += struct.pack("<16sHHHHB3xI", name.encode(), fw, fh, len(blocks), afps, 1 if loop else 0, f_off)
+        for b in blocks:
+            if b is None:
+                frames += struct.pack("<HHHHII", 0, 0, 0, 0, 0, 0)
+                continue
+            d_off = blob_base + len(blob)
+            blob += bytes(b["data"])
+            blob += b"\0" * (_align4(len(blob)) - len(blob))
+            frames += struct.pack("<HHHHII", b["x"], b["y"], b["width"], b["height"], d_off, len(b["data"]))
+
+    # Sound section: table then samples, each 4-byte aligned
+    sound_off = 0
+    sound = bytearray()
+    snds = [load_sound(s) for s in sounds]
+    if snds:
+        sound_off = _align4(blob_base + len(blob))
+        data_base = sound_off + 4 + 32 * len(snds)
+        data = bytearray()
+        sound += struct.pack("<HH", len(snds), 0)
+        for name, rate, fmt, pcm, n in snds:
+            sound += struct.pack("<16sIB3xII", name.encode(), rate, fmt, data_base + len(data), n)
+            data += pcm
+            data += b"\0" * (_align4(len(data)) - len(data))
+        sound += data
+
+    total = (sound_off + len(sound)) if snds else blob_base + len(blob)
+    out = bytearray(struct.pack("<4sHHII", BUNDLE_MAGIC, BUNDLE_VERSION, len(anims), total, sound_off))
+    out += table + frames
+    out += b"\0" * (blob_base - len(out))
+    out += blob
+    if snds:
+        out += b"\0" * (sound_off - len(out))
+        out += sound
+    with open(out_path, "wb") as f:
+        f.write(out)
+
+    for name, fw, fh, afps, blocks in anims:
+        print(f"[BUNDLE] {name} → {fw}x{fh}, {len(blocks)} frames @ {afps} fps")
+    for name, rate, fmt, pcm, n in snds:
+        print(f"[BUNDLE] sound {name} → {n} samples @ {rate} Hz, {'adpcm' if fmt else 'pcm16'} {len(pcm)} B")
+    print(f"[BUNDLE] {out_path}: {total} bytes")
+    print("  flash: python -m esptool write_flash 0xC20000 " + out_path)
+
+
+# ============================================================
+# REGISTRY (constexpr asset table indexed by id, see asset_registry.hpp)
+# ============================================================
+
+# Animation slots the UI plays (DisplayManager), in AnimId order. A slot
+# without a built-in asset of the same name is filled by the bundle or by an
+# animation pack (AnimPackCache) only.
+ANIM_SLOTS = ["neutral", "idle", "listening", "happy", "sad", "thinking", "stun",
+              "speaking", "error", "maintenance", "reset",
+              "angry", "confused", "excited", "calm"]
+
+# Slot played while a slot has no animation yet (server packs not cached)
+ANIM_FALLBACK = {"angry": "idle", "confused": "stun", "excited": "idle", "calm": "idle"}
+
+# state::EmotionState (StateTypes.hpp order) -> animation slot
+EMOTION_ANIM = [("NEUTRAL", "neutral"), ("HAPPY", "happy"), ("SAD", "sad"), ("ANGRY", "angry"),
+                ("CONFUSED", "confused"), ("EXCITED", "excited"), ("CALM", "calm"), ("THINKING", "thinking")]
+
+# Icon slot -> icon asset (icons/<asset>.hpp)
+ICON_SLOTS = [("battery_charge", "battery_charge"), ("battery_full", "battery_full"),
+              ("battery_critical", "critical_power")]
+
+
+def build_registry(assets_root):
+    """Writes <assets_root>/asset_registry.hpp from the generated emotion /
+    icon headers: fixed tables indexed by AnimId / IconId / EmotionState,
+    constexpr (flash, no heap, no string lookups at runtime)."""
+    def have(kind, name):
+        return os.path.isfile(os.path.join(assets_root, kind, f"{name}.hpp"))
+
+    anims = [(slot, have("emotions", slot)) for slot in ANIM_SLOTS]
+    icons = [(slot, asset) for slot, asset in ICON_SLOTS if have("icons", asset)]
+    for slot, asset in ICON_SLOTS:
+        if not have("icons", asset):
+            print(f"[REGISTRY] icon {slot}: icons/{asset}.hpp missing, slot dropped")
+
+    L = []
+    L.append("#pragma once")
+    L.append("// Generated by scripts/convert_assets.py registry - do not edit.")
+    L.append("#include <cstddef>")
+    L.append("#include <cstdint>")
+    L.append("#include <string_view>\n")
+    L.append("#include \"system/StateTypes.hpp\"")
+    L.append("#include \"emotions/emotion_types.hpp\"")
+    for _, asset in icons:
+        L.append(f"#include \"icons/{asset}.hpp\"")
+    L.append("")
+    L.append("// Emotions compiled into the app image. Build with -DPTALK_BUILTIN_EMOTIONS=0")
+    L.append("// to ship them only in the \"assets\" partition (AssetBundle).")
+    L.append("#ifndef PTALK_BUILTIN_EMOTIONS")
+    L.append("#define PTALK_BUILTIN_EMOTIONS 1")
+    L.append("#endif")
+    L.append("#if PTALK_BUILTIN_EMOTIONS")
+    for slot, builtin in anims:
+        if builtin:
+            L.append(f"#include \"emotions/{slot}.hpp\"")
+    L.append("#endif\n")
+    L.append("namespace asset\n{")
+    L.append("    enum class AnimId : uint8_t\n    {")
+    for slot, _ in anims:
+        L.append(f"        {slot.upper()},")
+    L.append("        COUNT,")
+    L.append("        NONE = 0xFF")
+    L.append("    };")
+    L.append("    inline constexpr size_t ANIM_COUNT = static_cast<size_t>(AnimId::COUNT);\n")
+    L.append("    inline constexpr std::string_view ANIM_NAMES[ANIM_COUNT] = {")
+    L.append("        " + ", ".join(f"\"{slot}\"" for slot, _ in anims) + "};\n")
+    L.append("    // Built-in animation of each slot (nullptr: from the bundle only)")
+    L.append("    inline constexpr const emotion::Animation *BUILTIN_ANIMS[ANIM_COUNT] = {")
+    L.append("#if PTALK_BUILTIN_EMOTIONS")
+    for slot, builtin in anims:
+        L.append(f"        &emotion::{slot.upper()}," if builtin else "        nullptr,")
+    L.append("#else")
+    L.append("        nullptr,")
+    L.append("#endif")
+    L.append("    };\n")
+    L.append("    // Slot played instead of an empty one (NONE: nothing to fall back to)")
+    L.append("    inline constexpr AnimId ANIM_FALLBACK[ANIM_COUNT] = {")
+    for slot, _ in anims:
+        fb = ANIM_FALLBACK.get(slot)
+        L.append(f"        AnimId::{fb.upper()}, // {slot}" if fb else f"        AnimId::NONE, // {slot}")
+    L.append("    };\n")
+    L.append("    // state::EmotionState -> animation slot")
+    L.append("    inline constexpr AnimId EMOTION_ANIM[] = {")
+    for state, slot in EMOTION_ANIM:
+        L.append(f"        AnimId::{slot.upper()}, // {state}")
+    L.append("    };")
+    L.append("    static_assert(sizeof(EMOTION_ANIM) / sizeof(EMOTION_ANIM[0]) ==")
+    L.append(f"                  static_cast<size_t>(state::EmotionState::{EMOTION_ANIM[-1][0]}) + 1);\n")
+    L.append("    enum class IconId : uint8_t\n    {")
+    for slot, _ in icons:
+        L.append(f"        {slot.upper()},")
+    L.append("        COUNT,")
+    L.append("        NONE = 0xFF")
+    L.append("    };")
+    L.append("    inline constexpr size_t ICON_COUNT = static_cast<size_t>(IconId::COUNT);\n")
+    L.append("    inline constexpr std::string_view ICON_NAMES[ICON_COUNT] = {")
+    L.append("        " + ", ".join(f"\"{slot}\"" for slot, _ in icons) + "};\n")
+    L.append("    inline constexpr const icon::Icon *ICONS[ICON_COUNT] = {")
+    for _, asset in icons:
+        L.append(f"        &icon::{asset.upper()},")
+    L.append("    };\n")
+    L.append("    constexpr AnimId emotionAnim(state::EmotionState s)")
+    L.append("    {")
+    L.append("        const size_t i = static_cast<size_t>(s);")
+    L.append("        return i < sizeof(EMOTION_ANIM) / sizeof(EMOTION_ANIM[0]) ? EMOTION_ANIM[i] : AnimId::IDLE;")
+    L.append("    }\n")
+    L.append("    // Name -> slot, for assets named at runtime (bundle, packs, console); NONE if unknown")
+    L.append("    constexpr AnimId animIdFromName(std::string_view name)")
+    L.append("    {")
+    L.append("        for (size_t i = 0; i < ANIM_COUNT; i++)")
+    L.append("            if (ANIM_NAMES[i] == name)")
+    L.append("                return static_cast<AnimId>(i);")
+    L.append("        return AnimId::NONE;")
+    L.append("    }\n")
+    L.append("    constexpr IconId iconIdFromName(std::string_view name)")
+    L.append("    {")
+    L.append("        for (size_t i = 0; i < ICON_COUNT; i++)")
+    L.append("            if (ICON_NAMES[i] == name)")
+    L.append("                return static_cast<IconId>(i);")
+    L.append("        return IconId::NONE;")
+    L.append("    }")
+    L.append("} // namespace asset")
+
+    out = os.path.join(assets_root, "asset_registry.hpp")
+    with open(out, "w", encoding="utf-8") as f:
+        f.write("\n".join(L) + "\n")
+    print(f"[REGISTRY] {out}: {len(anims)} animation slots "
+          f"({sum(1 for _, b in anims if b)} built in), {len(icons)} icons")
+
+
 # ============================================================
 # MAIN
 # ============================================================
@@ -199,10 +482,27 @@ def main():
     em.add_argument("--fps", type=int, default=10)
     em.add_argument("--loop", action="store_true")
 
+    bd = sub.add_parser("bundle", help="pack GIFs into the assets partition image")
+    bd.add_argument("output", help="output .bin")
+    bd.add_argument("inputs", nargs="+", help="file.gif or file.gif:fps")
+    bd.add_argument("--width", type=int)
+    bd.add_argument("--height", type=int)
+    bd.add_argument("--fps", type=int, default=20)
+    bd.add_argument("--no-loop", action="store_true")
+    bd.add_argument("--sound", action="append", default=[],
+                    help="earcon name=file.wav[:adpcm] (listen_start, listen_end, error, low_battery)")
+
+    rg = sub.add_parser("registry", help="write asset_registry.hpp (id-indexed asset tables)")
+    rg.add_argument("assets_root", help="directory holding emotions/ and icons/ (src/assets)")
+
     args = ap.parse_args()
 
     if args.mode == "icon":
         convert_icon(args.input, args.output, args.width, args.height)
+    elif args.mode == "registry":
+        build_registry(args.assets_root)
+    elif args.mode == "bundle":
+        build_bundle(args.inputs, args.output, args.width, args.height, args.fps, not args.no_loop, args.sound)
     else:
         convert_emotion(args.input, args.output, args.width, args.height, args.fps, args.loop)
 
@@ -1,23 +1,3 @@
-def to_2bit(img: Image.Image) -> List[int]:
-    """Convert grayscale image to 2-bit per pixel (4 levels: 0-3)."""
-    pixels = list(img.getdata())
-    return [p // 64 for p in pixels]  # 0-63:0, 64-127:1, 128-191:2, 192-255:3
-
-def encode_rle_2bit(pixels: List[int]) -> List[int]:
-    """RLE encode 2-bit grayscale pixels. Format: [count, value]"""
-    if not pixels:
-        return []
-    encoded = []
-    i = 0
-    while i < len(pixels):
-        value = pixels[i] & 0x03
-        count = 1
-        while i + count < len(pixels) and pixels[i + count] == value and count < 255:
-            count += 1
-        encoded.append(count)
-        encoded.append(value)
-        i += count
-    return encoded
 #!/usr/bin/env python3
 import os
 import argparse
@@ -29,7 +9,8 @@ import io
 # To convert a PNG icon:
 #   python scripts/convert_assets.py icon path/to/icon.png output/directory --width 64 --height 64
 # To convert a GIF emotion:
-#   python scripts/convert_assets.py emotion path/to/emotion.gif output/directory --width 128 --height 128 --fps 10 --loop
+#   python scripts/convert_gif.py emotion path/to/emotion.gif output/directory --width 320 --height 218 --fps 10 --loop
+#   (frames 1+ are emitted as dirty-rect diffs; pass --no-delta for full frames)
 
 
 # ============================================================
@@ -44,6 +25,27 @@ def write_header_guard(f):
     f.write("#include <cstdint>\n")
     f.write("#include \"emotion_types.hpp\"\n\n")
 
+def to_2bit(img: Image.Image) -> List[int]:
+    """Convert grayscale image to 2-bit per pixel (4 levels: 0-3)."""
+    pixels = list(img.getdata())
+    return [p // 64 for p in pixels]  # 0-63:0, 64-127:1, 128-191:2, 192-255:3
+
+def encode_rle_2bit(pixels: List[int]) -> List[int]:
+    """RLE encode 2-bit grayscale pixels. Format: [count, value]"""
+    if not pixels:
+        return []
+    encoded = []
+    i = 0
+    while i < len(pixels):
+        value = pixels[i] & 0x03
+        count = 1
+        while i + count < len(pixels) and pixels[i + count] == value and count < 255:
+            count += 1
+        encoded.append(count)
+        encoded.append(value)
+        i += count
+    return encoded
+
 def ensure_dir(path):
     if not os.path.exists(path):
         os.makedirs(path)
@@ -156,104 +158,73 @@ def encode_rle_4bit(pixels: List[int]) -> List[int]:
     
     return encoded
 
-def compute_pixel_diff(prev_pixels: List[int], curr_pixels: List[int], w: int, h: int) -> List[dict]:
-    """Compute rectangular diff blocks between two 4-bit grayscale frames.
-    Returns: list of {x, y, width, height, data} dicts for changed regions
-    Data is RLE encoded (2 bytes per token: count_byte, value_byte)
+def compute_diff_block(prev_pixels: List[int], curr_pixels: List[int], w: int, h: int) -> Optional[dict]:
+    """Compute the bounding box of pixels that changed between two 2-bit frames.
+    Returns {x, y, width, height, data} with the box content of the current
+    frame RLE encoded (2-bit, [count, value]), or None if nothing changed.
     """
-    # Find all changed pixels
-    changed_coords = []
+    min_x, min_y, max_x, max_y = w, h, -1, -1
     for i, (p, c) in enumerate(zip(prev_pixels, curr_pixels)):
         if p != c:
             x = i % w
             y = i // w
-            changed_coords.append((x, y, c))
-    
-    if not changed_coords:
-        return []
-    
-    # Find bounding box of all changes
-    min_x = min(x for x, y, c in changed_coords)
-    max_x = max(x for x, y, c in changed_coords)
-    min_y = min(y for x, y, c in changed_coords)
-    max_y = max(y for x, y, c in changed_coords)
-    
+            min_x = min(min_x, x)
+            max_x = max(max_x, x)
+            min_y = min(min_y, y)
+            max_y = max(max_y, y)
+
+    if max_x < 0:
+        return None
+
     box_w = max_x - min_x + 1
     box_h = max_y - min_y + 1
-    
+
     # Extract pixels in bounding box from current frame
     box_pixels = []
-    for by in range(box_h):
-        for bx in range(box_w):
-            px = min_x + bx
-            py = min_y + by
-            idx = py * w + px
-            box_pixels.append(curr_pixels[idx])
-    
-    # RLE encode the diff block
-    rle_data = encode_rle_1bit(box_pixels)
-    
-    return [{
+    for py in range(min_y, max_y + 1):
+        row = py * w
+        box_pixels.extend(curr_pixels[row + min_x:row + max_x + 1])
+
+    return {
         'x': min_x,
         'y': min_y,
         'width': box_w,
         'height': box_h,
-        'data': rle_data
-    }]
-
-def convert_emotion(gif_path, out_dir, target_w=None, target_h=None, fps=10, loop=True):
-    name_upper = os.path.splitext(os.path.basename(gif_path))[0].upper()
+        'data': encode_rle_2bit(box_pixels),
+    }
+
+def write_emotion_sources(out_dir, name_upper, w, h, fps, loop, frames_pixels, delta=True):
+    """Emit <name>.hpp/.cpp for an animation given its 2-bit frames.
+    Frame 0 is always a full frame. With delta=True every later frame only
+    stores the bounding box that changed since the previous frame (nullptr
+    FrameInfo when nothing changed), which the player draws as a dirty rect.
+    """
     name_lower = name_upper.lower()
-    img = Image.open(gif_path)
-
-    frames_pixels = []
-    for frame in ImageSequence.Iterator(img):
-        resized, w, h = resize_with_aspect(frame.convert("L"), target_w, target_h)
-        pixels = to_2bit(resized)
-        frames_pixels.append(pixels)
-
-    if not frames_pixels:
-        print("No frames found!")
-        return
-
     frame_count = len(frames_pixels)
-    
-    # File paths
-    out_hpp = os.path.join(out_dir, f"{name_lower}.hpp")
-    out_cpp = os.path.join(out_dir, f"{name_lower}.cpp")
-    
-    # Encode each frame as full RLE (no diff)
-    frame_data = []
+
+    # Encode frames: full RLE for frame 0 (and all frames without delta)
+    blocks = []
     total_size = 0
     max_frame_size = 0
-
     for idx, pixels in enumerate(frames_pixels):
-        # RLE encode full frame (2-bit grayscale)
-        rle_data = encode_rle_2bit(pixels)
-        frame_data.append(rle_data)
-        total_size += len(rle_data)
-        max_frame_size = max(max_frame_size, len(rle_data))
-    
+        if idx == 0 or not delta:
+            block = {'x': 0, 'y': 0, 'width': w, 'height': h, 'data': encode_rle_2bit(pixels)}
+        else:
+            block = compute_diff_block(frames_pixels[idx - 1], pixels, w, h)
+        blocks.append(block)
+        if block:
+            total_size += len(block['data'])
+            max_frame_size = max(max_frame_size, len(block['data']))
+
     # Calculate max packed size (decoded buffer size for one frame)
     max_packed_size = (w * h + 7) // 8
 
-    # =====================
-    # Write header (.hpp)
-    # =====================
-    with open(out_hpp, "w", encoding="utf-8") as f:
-        write_header_guard(f)
-        f.write("namespace asset::emotion {\n\n")
-        f.write(f"extern const Animation {name_upper};\n\n")
-        f.write("} // namespace asset::emotion\n")
-
-    # =====================
-    # Write implementation (.cpp)
     # =====================
     # Write header (.hpp)
     # =====================
     out_hpp = os.path.join(out_dir, f"{name_lower}.hpp")
     out_cpp = os.path.join(out_dir, f"{name_lower}.cpp")
-    
+
     with open(out_hpp, "w", encoding="utf-8") as f:
         write_header_guard(f)
         f.write("namespace asset::emotion {\n\n")
@@ -267,10 +238,16 @@ def convert_emotion(gif_path, out_dir, target_w=None, target_h=None, fps=10, loo
         f.write(f"#include \"{name_lower}.hpp\"\n\n")
         f.write("namespace asset::emotion {\n\n")
 
-        # Emit frame data arrays (full RLE, not diff)
-        for idx, rle_data in enumerate(frame_data):
+        for idx, block in enumerate(blocks):
+            if block is None:
+                f.write(f"// Frame {idx}: no change\n\n")
+                continue
+
+            rle_data = block['data']
             data_len = len(rle_data)
-            f.write(f"// Frame {idx}: Full frame RLE ({data_len} bytes)\n")
+            is_full = block['width'] == w and block['height'] == h
+            kind = "Full frame" if is_full else "Diff"
+            f.write(f"// Frame {idx}: {kind} RLE ({data_len} bytes)\n")
             f.write(f"static const uint8_t {name_upper}_FRAME{idx}_DATA[{data_len}] = {{\n")
             for i, byte in enumerate(rle_data):
                 f.write(f"0x{byte:02X},")
@@ -278,17 +255,23 @@ def convert_emotion(gif_path, out_dir, target_w=None, target_h=None, fps=10, loo
                     f.write("\n")
             f.write("\n};\n")
 
-            # Store as DiffBlock for compatibility (x=0, y=0, width=w, height=h)
             f.write(f"static const DiffBlock {name_upper}_FRAME{idx}_BLOCK = {{\n")
-            f.write(f"    0, 0,  // Full frame starts at (0,0)\n")
-            f.write(f"    {w}, {h},  // Full frame dimensions\n")
+            if is_full:
+                f.write(f"    0, 0,  // Full frame starts at (0,0)\n")
+                f.write(f"    {w}, {h},  // Full frame dimensions\n")
+            else:
+                f.write(f"    {block['x']}, {block['y']},  // Changed box top-left\n")
+                f.write(f"    {block['width']}, {block['height']},  // Changed box dimensions\n")
             f.write(f"    {name_upper}_FRAME{idx}_DATA\n")
             f.write(f"}};\n\n")
 
         # FrameInfo array
         f.write(f"static const FrameInfo {name_upper}_FRAMES[{frame_count}] = {{\n")
-        for idx in range(frame_count):
-            f.write(f"    {{&{name_upper}_FRAME{idx}_BLOCK}},\n")
+        for idx, block in enumerate(blocks):
+            if block is None:
+                f.write(f"    {{nullptr}},\n")
+            else:
+                f.write(f"    {{&{name_upper}_FRAME{idx}_BLOCK}},\n")
         f.write("};\n\n")
 
         # Animation instance
@@ -308,6 +291,22 @@ def convert_emotion(gif_path, out_dir, target_w=None, target_h=None, fps=10, loo
     print(f"[EMOTION] {out_hpp} (+cpp) → {w}x{h}, {frame_count} frames, {total_size} bytes RLE")
     print(f"          Max RLE frame: {max_frame_size} bytes, packed buffer: {max_packed_size} bytes")
 
+def convert_emotion(gif_path, out_dir, target_w=None, target_h=None, fps=10, loop=True, delta=True):
+    name_upper = os.path.splitext(os.path.basename(gif_path))[0].upper()
+    img = Image.open(gif_path)
+
+    frames_pixels = []
+    for frame in ImageSequence.Iterator(img):
+        resized, w, h = resize_with_aspect(frame.convert("L"), target_w, target_h)
+        pixels = to_2bit(resized)
+        frames_pixels.append(pixels)
+
+    if not frames_pixels:
+        print("No frames found!")
+        return
+
+    write_emotion_sources(out_dir, name_upper, w, h, fps, loop, frames_pixels, delta)
+
 # ============================================================
 # MAIN
 # ============================================================
@@ -342,6 +341,12 @@ def parse_args():
         default=True,
         help="Enable/disable looping",
     )
+    emo_p.add_argument(
+        "--delta",
+        action=argparse.BooleanOptionalAction,
+        default=True,
+        help="Store frames 1+ as changed bounding boxes (dirty rects) instead of full frames",
+    )
 
     return parser.parse_args()
 
@@ -354,7 +359,7 @@ def main():
         convert_icon(args.input_path, args.output_dir, args.width, args.height, args.max_dim)
 
     elif args.mode == "emotion":
-        convert_emotion(args.input_path, args.output_dir, args.width, args.height, args.fps, args.loop)
+        convert_emotion(args.input_path, args.output_dir, args.width, args.height, args.fps, args.loop, args.delta)
 
 
 if __name__ == "__main__":
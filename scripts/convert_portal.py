@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Pack captive portal web files into a C++ header, gzip-compressed.
+
+Text files (html/css/js/json/svg) are minified lightly (leading whitespace,
+blank lines) and gzipped; WifiService serves the bytes as-is with
+`Content-Encoding: gzip`. Output is deterministic (gzip mtime = 0), so the
+header only changes when a page does. The ETag is a hash of the source.
+
+Usage:
+    python scripts/convert_portal.py [web_dir] [out_hpp]
+    (defaults: lib/network/web -> lib/network/portal_assets.hpp)
+
+Files map to URIs by name: index.html -> "/", other.css -> "/other.css".
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_WEB = os.path.join(ROOT, "lib", "network", "web")
+DEFAULT_OUT = os.path.join(ROOT, "lib", "network", "portal_assets.hpp")
+
+TYPES = {
+    ".html": "text/html; charset=utf-8",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+}
+
+
+def die(msg):
+    print("ERROR:", msg)
+    sys.exit(1)
+
+
+def minify(text):
+    lines = (l.strip() for l in text.splitlines())
+    return "\n".join(l for l in lines if l) + "\n"
+
+
+def symbol(name):
+    return "PORTAL_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper() + "_GZ"
+
+
+def emit_bytes(f, data):
+    for i, b in enumerate(data):
+        if i % 12 == 0:
+            f.write("    ")
+        f.write(f"0x{b:02X}, ")
+        if i % 12 == 11:
+            f.write("\n")
+    f.write("\n")
+
+
+def main():
+    web_dir = sys.argv[1] if len(sys.argv) > 1 else DEFAULT_WEB
+    out_file = sys.argv[2] if len(sys.argv) > 2 else DEFAULT_OUT
+    if not os.path.isdir(web_dir):
+        die(f"Directory not found: {web_dir}")
+
+    assets = []
+    for name in sorted(os.listdir(web_dir)):
+        ext = os.path.splitext(name)[1].lower()
+        if ext not in TYPES:
+            continue
+        with open(os.path.join(web_dir, name), "r", encoding="utf-8") as f:
+            src = f.read()
+        raw = minify(src).encode("utf-8")
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = hashlib.sha256(raw).hexdigest()[:16]
+        uri = "/" if name == "index.html" else "/" + name
+        assets.append((name, uri, TYPES[ext], gz, etag, len(raw)))
+    if not assets:
+        die(f"No web files in {web_dir}")
+
+    rel_web = os.path.relpath(web_dir, ROOT)
+    with open(out_file, "w", encoding="utf-8") as f:
+        f.write("#pragma once\n")
+        f.write("#include <stdint.h>\n")
+        f.write("#include <stddef.h>\n\n")
+        f.write(f"// Auto-generated from {rel_web}/ by scripts/convert_portal.py\n")
+        f.write("// Do not edit: change the web files and re-run the script.\n\n")
+        f.write("struct PortalAsset\n{\n")
+        f.write("    const char *uri;\n")
+        f.write("    const char *type;\n")
+        f.write("    const uint8_t *gz; // gzip body (Content-Encoding: gzip)\n")
+        f.write("    size_t gz_len;\n")
+        f.write("    const char *etag; // quoted, for If-None-Match\n")
+        f.write("};\n\n")
+
+        for name, uri, ctype, gz, etag, raw_len in assets:
+            f.write(f"// {name}: {raw_len} bytes -> {len(gz)} gzip\n")
+            f.write(f"static const uint8_t {symbol(name)}[] = {{\n")
+            emit_bytes(f, gz)
+            f.write("};\n\n")
+
+        f.write("static const PortalAsset PORTAL_ASSETS[] = {\n")
+        for name, uri, ctype, gz, etag, raw_len in assets:
+            f.write(f'    {{"{uri}", "{ctype}", {symbol(name)}, sizeof({symbol(name)}), "\\"{etag}\\""}},\n')
+        f.write("};\n\n")
+        f.write("static const size_t PORTAL_ASSET_COUNT = sizeof(PORTAL_ASSETS) / sizeof(PORTAL_ASSETS[0]);\n")
+
+    print("OK")
+    for name, uri, ctype, gz, etag, raw_len in assets:
+        print(f"{uri:<16} {raw_len:>6} -> {len(gz):>6} bytes gzip")
+    print(f"HPP : {out_file}")
+
+
+if __name__ == "__main__":
+    main()
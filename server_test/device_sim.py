@@ -0,0 +1,1161 @@
+"""
+PTalk device simulator — tải nhiều thiết bị ảo lên một backend (WS audio +
+MQTT control + OTA) để đo latency từng lượt nói, throughput OTA và tài nguyên
+broker / server trước khi phát hành firmware.
+
+Mỗi thiết bị ảo nói đúng giao thức của NetworkManager:
+  - MQTT `devices/{id}/...`: client id `PTalk_{id}`, subscribe `cmd` (QoS 1),
+    `ota_data` (QoS 1), `ota_ack` (QoS 0); status retain lúc kết nối; trả lời
+    lệnh `/cmd`; telemetry định kỳ.
+  - OTA qua MQTT: chunk `[seq u32][size u32][crc32 u32][data]`, cửa sổ trượt
+    như firmware (ACK chọn lọc + `base`, NACK khi CRC sai / ngoài cửa sổ,
+    NACK base một lần khi có lỗ), heatshrink, kiểm SHA-256, rồi "reboot".
+    `request_ota` có `url`: tải HTTP(S) bằng `Range: bytes=<got>-`.
+  - WebSocket: `device_handshake` (hoặc `session_resume` sau khi rớt),
+    uplink = header AudioPacket 12 byte + ADPCM, `START` / `END` quanh mỗi
+    lượt nói, downlink framed sau `AUDIO_PROTO:2`.
+
+Lượt nói: phát lại WAV ghi sẵn (16 kHz mono sau resample) theo thời gian
+thực, gói `--packet-ms` (40 ms như firmware). Latency tính từ lúc gửi `END`
+(người dùng nói xong): `processing` → `PROCESSING_START`, `first_audio` →
+gói audio downlink đầu tiên, `turn` → `TTS_END` / gói EOU. Downlink còn được
+phát lại trên một đồng hồ playout ảo (jitter `--jitter-ms`) để đếm underrun
+mà loa thật sẽ gặp.
+
+Ví dụ:
+  # 200 thiết bị, lượt nói mỗi ~20 s, chạy 5 phút, theo dõi server + broker
+  python device_sim.py --devices 200 --ramp-s 30 --think-s 20 --duration-s 300 \\
+      --ws ws://127.0.0.1:8000/ws --broker 127.0.0.1 \\
+      --watch-pid server=$(pgrep -f dummy_server_cmd) --watch-pid broker=$(pgrep mosquitto) \\
+      --broker-sys --json report.json
+
+  # Đo throughput OTA: simulator tự đóng vai server đẩy firmware tới 50 máy
+  python device_sim.py --devices 50 --turns 0 --push-ota 1.0.5.bin --ota-window 8
+
+Cần: `pip install paho-mqtt websockets`.
+"""
+
+import argparse
+import asyncio
+import glob
+import hashlib
+import json
+import math
+import os
+import random
+import struct
+import time
+import urllib.request
+import wave
+import zlib
+from datetime import datetime
+
+import paho.mqtt.client as mqtt
+import websockets
+
+# =====================================================
+# GIAO THỨC (khớp firmware)
+# =====================================================
+# lib/network/AudioPacket.hpp: version u8, codec u8, flags u8, kbps u8,
+# session u16, seq u16, timestamp_ms u32 — little-endian
+AUDIO_HDR = struct.Struct("<BBBBHHI")
+AUDIO_PROTO = 2
+CODEC_ADPCM = 1
+FLAG_EOU = 0x01
+FLAG_GAP = 0x02
+FLAG_SYNC = 0x04
+FLAG_CANCEL = 0x08
+SYNC_BYTES = 4
+
+# lib/network/OtaChunk.hpp: [seq u32][size u32][crc32 u32][data]
+OTA_CHUNK_HDR = struct.Struct("<III")
+OTA_MAX_WINDOW = 32  # firmware rx mask
+
+SAMPLE_RATE = 16000
+ADPCM_KBPS = 64  # 4 bit/mẫu ở 16 kHz
+FIRMWARE_VERSION = "sim"
+
+STEP_TABLE = [
+     7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8,
+               -1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def log(tag, msg):
+    print(f"[{datetime.now().strftime('%H:%M:%S.%f')[:-3]}] {tag} {msg}", flush=True)
+
+
+def ms32(t: float) -> int:
+    return int(t * 1000) & 0xFFFFFFFF
+
+
+# =====================================================
+# AUDIO: WAV → 16 kHz mono → gói ADPCM (mã hóa một lần, dùng chung)
+# =====================================================
+def adpcm_encode(samples, state=(0, 0)):
+    """IMA ADPCM, nibble cao trước (như AdpcmCodec của firmware)."""
+    predictor, index = state
+    out = bytearray()
+    byte, high = 0, True
+    for s in samples:
+        step = STEP_TABLE[index]
+        diff = s - predictor
+        code = 8 if diff < 0 else 0
+        if code:
+            diff = -diff
+        if diff >= step:
+            code |= 4
+            diff -= step
+        if diff >= step >> 1:
+            code |= 2
+            diff -= step >> 1
+        if diff >= step >> 2:
+            code |= 1
+        diffq = step >> 3
+        if code & 4:
+            diffq += step
+        if code & 2:
+            diffq += step >> 1
+        if code & 1:
+            diffq += step >> 2
+        predictor = max(-32768, min(32767, predictor - diffq if code & 8 else predictor + diffq))
+        index = max(0, min(88, index + INDEX_TABLE[code]))
+        if high:
+            byte = code << 4
+        else:
+            out.append(byte | code)
+        high = not high
+    return out, (predictor, index)
+
+
+def load_wav(path, max_s):
+    with wave.open(path, "rb") as wf:
+        ch, width, rate = wf.getnchannels(), wf.getsampwidth(), wf.getframerate()
+        frames = wf.readframes(min(wf.getnframes(), int(rate * max_s)) if max_s > 0 else wf.getnframes())
+    if width != 2:
+        raise ValueError(f"{path}: chỉ hỗ trợ PCM 16 bit")
+    pcm = struct.unpack(f"<{len(frames) // 2}h", frames)
+    if ch > 1:
+        pcm = [sum(pcm[i:i + ch]) // ch for i in range(0, len(pcm), ch)]
+    if rate != SAMPLE_RATE:
+        # Nội suy tuyến tính: đủ cho tải giả lập, không dùng để nghe
+        n = int(len(pcm) * SAMPLE_RATE / rate)
+        pcm = [pcm[min(int(i * rate / SAMPLE_RATE), len(pcm) - 1)] for i in range(n)]
+    return list(pcm)
+
+
+class Utterance:
+    """Payload ADPCM của từng gói uplink (chưa có header)."""
+
+    def __init__(self, path, packet_ms, max_s):
+        pcm = load_wav(path, max_s)
+        per_packet = SAMPLE_RATE * packet_ms // 1000
+        self.name = os.path.basename(path)
+        self.packet_ms = packet_ms
+        self.payloads = []
+        state = (0, 0)  # encoder reset mỗi lượt nói
+        for i in range(0, len(pcm) - per_packet + 1, per_packet):
+            adpcm, state = adpcm_encode(pcm[i:i + per_packet], state)
+            self.payloads.append(bytes(adpcm))
+        self.duration_s = len(self.payloads) * packet_ms / 1000
+
+
+# =====================================================
+# HEATSHRINK (giải nén để kiểm SHA-256 như OtaDecompressor)
+# =====================================================
+def heatshrink_decompress(data, window_sz2, lookahead_sz2):
+    out = bytearray()
+    pos, nbits, acc = 0, 0, 0
+
+    def get(n):
+        nonlocal pos, nbits, acc
+        while nbits < n:
+            if pos >= len(data):
+                return None
+            acc = (acc << 8) | data[pos]
+            pos += 1
+            nbits += 8
+        nbits -= n
+        v = (acc >> nbits) & ((1 << n) - 1)
+        acc &= (1 << nbits) - 1
+        return v
+
+    while True:
+        tag = get(1)
+        if tag is None:
+            break
+        if tag:
+            b = get(8)
+            if b is None:
+                break
+            out.append(b)
+        else:
+            off = get(window_sz2)
+            ln = get(lookahead_sz2)
+            if off is None or ln is None:
+                break
+            off, ln = off + 1, ln + 1
+            if off > len(out):
+                raise ValueError("backref trước đầu luồng")
+            for _ in range(ln):
+                out.append(out[-off])
+    return bytes(out)
+
+
+# =====================================================
+# THỐNG KÊ
+# =====================================================
+def percentile(values, p):
+    if not values:
+        return None
+    s = sorted(values)
+    return s[min(len(s) - 1, max(0, math.ceil(p / 100 * len(s)) - 1))]
+
+
+def summarize(values, scale=1.0):
+    if not values:
+        return {"n": 0}
+    return {"n": len(values),
+            "p50": round(percentile(values, 50) * scale, 1),
+            "p90": round(percentile(values, 90) * scale, 1),
+            "p99": round(percentile(values, 99) * scale, 1),
+            "max": round(max(values) * scale, 1)}
+
+
+class Stats:
+    def __init__(self):
+        self.counters = {}
+        self.latency = {"processing": [], "first_audio": [], "turn": []}  # giây
+        self.ul_send_lag = []  # trễ gửi gói uplink so với lịch (simulator quá tải?)
+        self.dl_gap = []       # khoảng cách lớn nhất giữa hai gói downlink mỗi lượt
+        self.ota = []          # {"bytes", "seconds", "ok", "transport"}
+        self.errors = {}       # lỗi giao thức theo loại (mẫu đầu tiên)
+
+    def inc(self, key, n=1):
+        self.counters[key] = self.counters.get(key, 0) + n
+
+    def error(self, kind, detail):
+        self.inc("protocol_errors")
+        first = kind not in self.errors
+        self.errors.setdefault(kind, {"count": 0, "first": detail})["count"] += 1
+        if first:
+            log("⚠️", f"{kind}: {detail}")
+
+
+# =====================================================
+# THEO DÕI TÀI NGUYÊN (/proc, $SYS của broker)
+# =====================================================
+class ProcWatch:
+    """CPU % và RSS của một process (Linux /proc)."""
+
+    def __init__(self, name, pid):
+        self.name, self.pid = name, pid
+        self.cpu = []
+        self.rss_max = 0
+        self.prev = None
+        self.tick = os.sysconf("SC_CLK_TCK")
+        self.page = os.sysconf("SC_PAGE_SIZE")
+
+    def sample(self):
+        try:
+            with open(f"/proc/{self.pid}/stat") as f:
+                fields = f.read().rsplit(")", 1)[1].split()
+        except OSError:
+            return
+        busy = (int(fields[11]) + int(fields[12])) / self.tick  # utime + stime
+        self.rss_max = max(self.rss_max, int(fields[21]) * self.page)
+        now = time.monotonic()
+        if self.prev:
+            self.cpu.append(100 * (busy - self.prev[1]) / max(now - self.prev[0], 1e-3))
+        self.prev = (now, busy)
+
+    def report(self):
+        return {"pid": self.pid,
+                "cpu_avg": round(sum(self.cpu) / len(self.cpu), 1) if self.cpu else None,
+                "cpu_max": round(max(self.cpu), 1) if self.cpu else None,
+                "rss_max_mb": round(self.rss_max / 1048576, 1)}
+
+
+BROKER_SYS_TOPICS = [
+    "$SYS/broker/clients/connected",
+    "$SYS/broker/load/messages/received/1min",
+    "$SYS/broker/load/messages/sent/1min",
+    "$SYS/broker/load/bytes/received/1min",
+    "$SYS/broker/load/bytes/sent/1min",
+    "$SYS/broker/heap/current",
+]
+
+
+class BrokerSys:
+    """Số liệu $SYS (mosquitto): giá trị cuối và lớn nhất."""
+
+    def __init__(self, args):
+        self.values = {}
+        self.client = mqtt.Client(mqtt.CallbackAPIVersion.VERSION2, client_id=f"ptalk-sim-sys-{os.getpid()}")
+        self.client.on_connect = lambda c, u, f, rc, p=None: [c.subscribe(t) for t in BROKER_SYS_TOPICS]
+        self.client.on_message = self.on_message
+        self.client.connect_async(args.broker, args.port, 60)
+        self.client.loop_start()
+
+    def on_message(self, client, userdata, msg):
+        try:
+            v = float(msg.payload.decode().split()[0])
+        except (ValueError, IndexError):
+            return
+        key = msg.topic[len("$SYS/broker/"):]
+        last, peak = self.values.get(key, (v, v))
+        self.values[key] = (v, max(peak, v))
+
+    def report(self):
+        return {k: {"last": v[0], "max": v[1]} for k, v in sorted(self.values.items())}
+
+    def stop(self):
+        self.client.loop_stop()
+        self.client.disconnect()
+
+
+# =====================================================
+# THIẾT BỊ ẢO
+# =====================================================
+class VirtualDevice:
+    def __init__(self, index, args, utterances, stats, loop):
+        self.args, self.stats, self.loop = args, stats, loop
+        self.utterances = utterances
+        self.device_id = f"{args.id_prefix}{index:06X}"[-12:]
+        self.base = f"devices/{self.device_id}"
+        self.rng = random.Random(args.seed * 100003 + index)
+        self.boot_at = time.monotonic()
+        self.name = f"Sim-{index}"
+        self.volume, self.brightness = 60, 100
+        self.running = True
+        self.rebooting = False
+
+        # MQTT (callback trên thread của paho → đưa vào event loop)
+        self.mqtt_up = False
+        self.mqtt = None
+        self.telemetry_seq = 0
+
+        # WS
+        self.ws = None
+        self.ws_ready = asyncio.Event()
+        self.session_token = None
+        self.ws_dropped_at = None
+        self.dl_framed = False
+        self.dl_rate = SAMPLE_RATE
+        self.ul_session = self.rng.randrange(0x10000)
+
+        # Lượt nói đang chạy
+        self.turn = None
+
+        # OTA
+        self.ota = None
+
+    # ---------------- vòng đời ----------------
+    async def run(self, start_delay):
+        """Xong khi hết --turns; kết nối (WS, MQTT, telemetry) chạy tới stop()."""
+        await asyncio.sleep(start_delay)
+        self.bg = [asyncio.create_task(self.ws_loop())]
+        if not self.args.no_mqtt:
+            self.mqtt_start()
+            self.bg.append(asyncio.create_task(self.telemetry_loop()))
+        await self.turn_loop()
+
+    def busy(self):
+        return self.ota is not None or self.rebooting
+
+    async def stop(self):
+        self.running = False
+        for t in getattr(self, "bg", []):
+            t.cancel()
+        if self.ws:
+            await self.ws.close()
+        self.mqtt_stop()
+
+    async def reboot(self, reason):
+        # Như esp_restart(): rớt MQTT + WS, boot lại sau reboot_s, phiên mới
+        log("🔄", f"{self.device_id} reboot ({reason})")
+        self.stats.inc("reboots")
+        self.rebooting = True
+        self.mqtt_stop()
+        if self.ws:
+            await self.ws.close()
+        await asyncio.sleep(self.args.reboot_s)
+        self.boot_at = time.monotonic()
+        self.session_token = None
+        self.ws_dropped_at = None
+        self.rebooting = False
+        if not self.args.no_mqtt:
+            self.mqtt_start()
+
+    # ---------------- MQTT ----------------
+    def mqtt_start(self):
+        c = mqtt.Client(mqtt.CallbackAPIVersion.VERSION2, client_id=f"PTalk_{self.device_id}",
+                        clean_session=self.args.clean_session)
+        c.on_connect = self.on_mqtt_connect
+        c.on_disconnect = self.on_mqtt_disconnect
+        c.on_message = self.on_mqtt_message
+        c.reconnect_delay_set(1, 30)
+        c.connect_async(self.args.broker, self.args.port, self.args.keepalive)
+        c.loop_start()
+        self.mqtt = c
+
+    def mqtt_stop(self):
+        if self.mqtt:
+            self.mqtt.disconnect()
+            self.mqtt.loop_stop()
+            self.mqtt = None
+        self.mqtt_up = False
+
+    def on_mqtt_connect(self, client, userdata, flags, rc, properties=None):
+        if rc.is_failure:
+            self.stats.inc("mqtt_connect_failed")
+            return
+        self.mqtt_up = True
+        self.stats.inc("mqtt_connects")
+        if not flags.session_present:
+            client.subscribe(f"{self.base}/cmd", 1)
+            client.subscribe(f"{self.base}/ota_data", 1)
+            client.subscribe(f"{self.base}/ota_ack", 0)
+        client.publish(f"{self.base}/status", json.dumps(self.status_doc()), qos=1, retain=True)
+
+    def on_mqtt_disconnect(self, client, userdata, flags, rc, properties=None):
+        if self.mqtt_up and not self.rebooting and self.running:
+            self.stats.inc("mqtt_drops")
+        self.mqtt_up = False
+
+    def on_mqtt_message(self, client, userdata, msg):
+        self.loop.call_soon_threadsafe(self.handle_mqtt, msg.topic, bytes(msg.payload))
+
+    def publish(self, suffix, obj, qos=1, retain=False):
+        if self.mqtt and self.mqtt_up:
+            self.mqtt.publish(f"{self.base}/{suffix}", obj if isinstance(obj, bytes) else json.dumps(obj),
+                              qos=qos, retain=retain)
+
+    def reply(self, status, message, with_id=False):
+        obj = {"status": status, "message": message}
+        if with_id:
+            obj["device_id"] = self.device_id
+        self.publish("status", obj)
+
+    def status_doc(self):
+        return {"status": "ok", "device_id": self.device_id, "device_name": self.name,
+                "battery_percent": 85, "connectivity_state": "ONLINE",
+                "firmware_version": FIRMWARE_VERSION, "ota_encodings": "raw,heatshrink",
+                "ota_transports": "mqtt,http", "encodings": "json",
+                "volume": self.volume, "brightness": self.brightness,
+                "uptime_sec": int(time.monotonic() - self.boot_at)}
+
+    def handle_mqtt(self, topic, payload):
+        if topic.endswith("/ota_data"):
+            self.ota_chunk(payload)
+            return
+        if not topic.endswith("/cmd"):
+            return  # ota_ack: firmware cũng chỉ subscribe cho đủ
+        if not payload.startswith(b"{"):
+            self.stats.error("cmd_msgpack", "simulator chỉ đọc /cmd JSON")
+            self.reply("not_supported", "msgpack")
+            return
+        try:
+            cmd = json.loads(payload)
+            name = cmd["cmd"]
+        except (ValueError, KeyError, TypeError):
+            self.stats.error("cmd_invalid", payload[:80])
+            self.reply("invalid_command", "bad json")
+            return
+        self.stats.inc(f"cmd_{name}")
+        if name == "request_status":
+            self.publish("status", self.status_doc(), retain=True)
+        elif name == "set_volume":
+            self.volume = int(cmd.get("volume", self.volume))
+            self.publish("status", {"status": "ok", "volume": self.volume})
+        elif name == "set_brightness":
+            self.brightness = int(cmd.get("brightness", self.brightness))
+            self.publish("status", {"status": "ok", "brightness": self.brightness})
+        elif name == "set_device_name":
+            self.name = str(cmd.get("device_name", self.name))
+            self.publish("status", {"status": "ok", "device_name": self.name})
+        elif name == "set_encoding":
+            if cmd.get("encoding") == "json":
+                self.publish("status", {"status": "ok", "encoding": "json"})
+            else:
+                self.reply("not_supported", "simulator: json only")
+        elif name == "reboot":
+            self.reply("ok", "Rebooting...")
+            asyncio.ensure_future(self.reboot("cmd"))
+        elif name == "request_ota":
+            self.ota_request(cmd)
+        else:
+            self.reply("not_supported", name)
+
+    async def telemetry_loop(self):
+        # Cùng nhịp và kích thước gần đúng với TelemetryAggregator (keyframe)
+        if self.args.telemetry_s <= 0:
+            return
+        await asyncio.sleep(self.rng.uniform(0, self.args.telemetry_s))
+        while self.running:
+            self.telemetry_seq += 1
+            self.publish("telemetry", {"seq": self.telemetry_seq, "up": int(time.monotonic() - self.boot_at),
+                                       "k": 1, "heap": 81234, "heap_min": 79010, "rssi": -60,
+                                       "rssi_min": -66, "bat": 85, "drop": 0, "slo": 0}, qos=0)
+            await asyncio.sleep(self.args.telemetry_s)
+
+    # ---------------- OTA ----------------
+    def ota_request(self, cmd):
+        size = int(cmd.get("size", 0))
+        sha = str(cmd.get("sha256", "")).lower()
+        enc = cmd.get("encoding", "raw")
+        if enc not in ("raw", "heatshrink") or (enc == "heatshrink" and "image_size" not in cmd):
+            self.reply("error", "unsupported_encoding")
+            return
+        url = cmd.get("url")
+        if url and (not size or len(sha) != 64):
+            self.reply("invalid_param", "url needs size and sha256")
+            return
+        self.ota = {"t0": time.monotonic(), "size": size, "sha256": sha, "encoding": enc,
+                    "window_sz2": int(cmd.get("window_sz2", 11)), "lookahead_sz2": int(cmd.get("lookahead_sz2", 4)),
+                    "chunk_size": int(cmd.get("chunk_size", 2048)), "total": int(cmd.get("total_chunks", 0)),
+                    "window": min(max(self.args.ota_window, 1), OTA_MAX_WINDOW),
+                    "base": 0, "mask": 0, "last_nack": None, "chunks": {}, "received": 0,
+                    "transport": "http" if url else "mqtt"}
+        reply = {"status": "ok"}
+        if url:
+            reply.update({"message": "Downloading firmware", "transport": "http"})
+        else:
+            reply.update({"message": "Ready to receive firmware", "transport": "mqtt", "window": self.ota["window"]})
+        if cmd.get("background"):
+            reply["background"] = True
+        if size:
+            reply["size"] = size
+        if sha:
+            reply["sha256"] = sha
+        reply["device_id"] = self.device_id
+        self.publish("status", reply)
+        self.stats.inc("ota_started")
+        if url:
+            asyncio.ensure_future(self.ota_http(url))
+
+    def ota_ack(self, seq):
+        self.publish("ota_ack", {"ota_ack": seq, "base": self.ota["base"]})
+
+    def ota_nack(self, seq, busy=False):
+        msg = {"ota_nack": seq, "expected_seq": self.ota["base"] if self.ota else 0}
+        if busy:
+            msg["busy"] = True
+        self.publish("ota_ack", msg)
+
+    def ota_chunk(self, payload):
+        o = self.ota
+        if not o:
+            self.ota_nack(0)
+            return
+        if o["transport"] != "mqtt":
+            return
+        if len(payload) < OTA_CHUNK_HDR.size:
+            self.stats.error("ota_chunk_short", f"{len(payload)} B")
+            return
+        seq, size, crc = OTA_CHUNK_HDR.unpack_from(payload)
+        data = payload[OTA_CHUNK_HDR.size:]
+        if size != len(data):
+            self.stats.error("ota_size_mismatch", f"chunk {seq}: header {size}, actual {len(data)}")
+            self.ota_nack(seq)
+            return
+        if zlib.crc32(data) & 0xFFFFFFFF != crc:
+            self.stats.inc("ota_crc_errors")
+            self.ota_nack(seq)
+            return
+        off = seq - o["base"]
+        if seq < o["base"] or (off < OTA_MAX_WINDOW and o["mask"] & (1 << off)):
+            self.stats.inc("ota_duplicates")
+            self.ota_ack(seq)
+            return
+        if off >= o["window"]:
+            self.stats.inc("ota_out_of_window")
+            self.ota_nack(seq, True)
+            return
+        o["chunks"][seq] = data
+        o["received"] += len(data)
+        o["mask"] |= 1 << off
+        while o["mask"] & 1:
+            o["mask"] >>= 1
+            o["base"] += 1
+        self.ota_ack(seq)
+        if o["mask"] and o["last_nack"] != o["base"]:
+            o["last_nack"] = o["base"]
+            self.ota_nack(o["base"])
+        done = o["base"] >= o["total"] if o["total"] else o["received"] >= o["size"]
+        if done:
+            image = b"".join(o["chunks"][i] for i in sorted(o["chunks"]))
+            asyncio.ensure_future(self.ota_finish(image))
+
+    async def ota_http(self, url):
+        o = self.ota
+        buf = bytearray()
+
+        def fetch(offset):
+            req = urllib.request.Request(url, headers={"Range": f"bytes={offset}-"})
+            with urllib.request.urlopen(req, timeout=30) as r:
+                if r.status != 206 and not (r.status == 200 and offset == 0):
+                    raise IOError(f"HTTP {r.status}")
+                while True:
+                    part = r.read(self.args.ota_http_chunk)
+                    if not part:
+                        return
+                    buf.extend(part)
+
+        for attempt in range(5):
+            try:
+                await self.loop.run_in_executor(None, fetch, len(buf))
+                break
+            except Exception as e:
+                self.stats.inc("ota_http_retries")
+                if attempt == 4:
+                    self.ota = None
+                    self.stats.ota.append({"bytes": len(buf), "seconds": time.monotonic() - o["t0"],
+                                           "ok": False, "transport": "http"})
+                    self.reply("error", str(e))
+                    return
+                await asyncio.sleep(min(2 ** attempt, 10))
+        await self.ota_finish(bytes(buf[:o["size"]]))
+
+    async def ota_finish(self, stream):
+        o, self.ota = self.ota, None
+        if not o:
+            return
+        seconds = time.monotonic() - o["t0"]
+        try:
+            image = stream
+            if o["encoding"] == "heatshrink":
+                image = heatshrink_decompress(stream, o["window_sz2"], o["lookahead_sz2"])
+            ok = not o["sha256"] or hashlib.sha256(image).hexdigest() == o["sha256"]
+        except ValueError as e:
+            ok = False
+            self.stats.error("ota_decompress", str(e))
+        self.stats.ota.append({"bytes": len(stream), "seconds": seconds, "ok": ok, "transport": o["transport"]})
+        self.stats.inc("ota_ok" if ok else "ota_failed")
+        log("📦" if ok else "❌", f"{self.device_id} OTA {o['transport']} {len(stream)} B in {seconds:.1f} s"
+            f" ({len(stream) / 1024 / max(seconds, 1e-3):.1f} KB/s){'' if ok else ' SHA-256 mismatch'}")
+        if not ok:
+            self.reply("error", "SHA-256 mismatch")
+        elif not self.args.no_reboot:
+            await self.reboot("ota")
+
+    # ---------------- WebSocket ----------------
+    def handshake(self):
+        return {"cmd": "device_handshake", "device_id": self.device_id, "firmware_version": FIRMWARE_VERSION,
+                "ota_encodings": "raw,heatshrink", "device_name": self.name, "battery_percent": 85,
+                "connectivity_state": "ONLINE", "audio_codec": "adpcm", "audio_frame_ms": 16,
+                "audio_framed": False, "audio_dl_sync": True, "audio_protocol": AUDIO_PROTO,
+                "audio_packet_ms": self.args.packet_ms, "audio_ul_kbps": str(ADPCM_KBPS),
+                "audio_ul_cancel": True, "audio_out_rate": SAMPLE_RATE,
+                "session": self.session_token, "resume_window_ms": self.args.resume_window_ms}
+
+    async def ws_loop(self):
+        backoff = 0.5
+        while self.running:
+            if self.rebooting:
+                await asyncio.sleep(0.2)
+                continue
+            t0 = time.monotonic()
+            try:
+                async with websockets.connect(self.args.ws, max_size=None, ping_interval=None,
+                                              open_timeout=10) as ws:
+                    self.stats.inc("ws_connects")
+                    self.stats.latency.setdefault("ws_connect", []).append(time.monotonic() - t0)
+                    self.ws = ws
+                    resume = (self.session_token and self.ws_dropped_at and
+                              time.monotonic() - self.ws_dropped_at < self.args.resume_window_ms / 1000)
+                    if resume:
+                        await ws.send(json.dumps({"cmd": "session_resume", "device_id": self.device_id,
+                                                  "session": self.session_token,
+                                                  "uplink_session": self.ul_session}))
+                    else:
+                        self.session_token = f"{self.rng.getrandbits(64):016x}"
+                        self.dl_framed = False
+                        await ws.send(json.dumps(self.handshake()))
+                        self.ws_ready.set()
+                    backoff = 0.5
+                    async for msg in ws:
+                        if isinstance(msg, bytes):
+                            self.on_ws_binary(msg)
+                        else:
+                            await self.on_ws_text(msg)
+                if self.running and not self.rebooting:
+                    self.stats.inc("ws_drops")  # server đóng kết nối
+            except (OSError, asyncio.TimeoutError, websockets.exceptions.WebSocketException) as e:
+                if self.running and not self.rebooting:
+                    self.stats.inc("ws_connect_failed" if self.ws is None else "ws_drops")
+                    if self.ws is None:
+                        self.stats.error("ws_connect", str(e))
+            if self.ws is not None:
+                self.ws_dropped_at = time.monotonic()
+            self.ws = None
+            self.ws_ready.clear()
+            if self.turn and not self.turn["done"].is_set():
+                self.turn["aborted"] = "ws_drop"
+                self.turn["done"].set()
+            if self.running and not self.rebooting:
+                await asyncio.sleep(backoff * self.rng.uniform(0.5, 1.0))
+                backoff = min(backoff * 2, 30)
+
+    async def on_ws_text(self, msg):
+        now = time.monotonic()
+        t = self.turn
+        if msg.startswith("AUDIO_PROTO:"):
+            self.dl_framed = msg[12:] == str(AUDIO_PROTO)
+        elif msg.startswith("AUDIO_RATE:"):
+            self.dl_rate = int(msg[11:] or 0) or SAMPLE_RATE
+        elif msg.startswith("AUDIO_UL_ADAPT:"):
+            pass  # simulator luôn gửi mức danh định
+        elif msg == "SESSION:RESUMED":
+            self.stats.inc("ws_resumed")
+            self.ws_ready.set()
+        elif msg == "SESSION:NEW":
+            self.stats.inc("ws_resume_refused")
+            self.session_token = f"{self.rng.getrandbits(64):016x}"
+            self.dl_framed = False
+            await self.ws.send(json.dumps(self.handshake()))
+            self.ws_ready.set()
+        elif msg in ("PROCESSING_START", "PROCESSING"):
+            if t and t["end_at"] and t["processing_at"] is None:
+                t["processing_at"] = now
+        elif msg in ("AUDIO_START", "SPEAKING", "SPEAK_START"):
+            if t:
+                t["speaking"] = True
+        elif msg in ("IDLE", "SPEAK_END", "DONE", "TTS_END"):
+            if t and t["end_at"]:
+                t["finished_at"] = t["finished_at"] or now
+                t["done"].set()
+        elif len(msg) == 2:
+            pass  # mã cảm xúc
+        else:
+            try:
+                obj = json.loads(msg)
+            except ValueError:
+                self.stats.error("ws_text_unknown", msg[:80])
+                return
+            if isinstance(obj, dict) and obj.get("cmd"):
+                # Firmware bỏ qua lệnh cấu hình qua WS (chỉ MQTT)
+                self.stats.inc("ws_json_ignored")
+
+    def on_ws_binary(self, pkt):
+        now = time.monotonic()
+        t = self.turn
+        if t is None or not t["end_at"]:
+            self.stats.inc("dl_unsolicited_packets")
+            return
+        payload = pkt
+        if self.dl_framed:
+            if len(pkt) < AUDIO_HDR.size:
+                self.stats.error("dl_short_packet", f"{len(pkt)} B")
+                return
+            ver, codec, flags, _kbps, session, seq, _ts = AUDIO_HDR.unpack_from(pkt)
+            if ver != AUDIO_PROTO or codec != CODEC_ADPCM:
+                self.stats.error("dl_bad_header", f"v{ver} codec {codec}")
+                return
+            hdr = AUDIO_HDR.size + (SYNC_BYTES if flags & FLAG_SYNC else 0)
+            payload = pkt[hdr:]
+            if t["dl_session"] != session:
+                t["dl_session"], t["dl_seq"] = session, None
+            elif t["dl_seq"] is not None and seq != (t["dl_seq"] + 1) & 0xFFFF:
+                t["dl_lost"] += (seq - t["dl_seq"] - 1) & 0xFFFF
+            t["dl_seq"] = seq
+            if flags & FLAG_EOU:
+                t["finished_at"] = t["finished_at"] or now
+        if payload:
+            if t["first_audio_at"] is None:
+                t["first_audio_at"] = now
+                t["play_at"] = now + self.args.jitter_ms / 1000  # loa bắt đầu sau jitter target
+            elif now - t["last_dl_at"] > t["dl_gap"]:
+                t["dl_gap"] = now - t["last_dl_at"]
+            # Playout ảo: gói phải tới trước khi loa phát hết phần trước nó
+            if now > t["play_at"]:
+                t["dl_underruns"] += 1
+                t["play_at"] = now + self.args.jitter_ms / 1000  # rebuffer như JitterBuffer
+            t["play_at"] += len(payload) * 2 / self.dl_rate  # ADPCM: 2 mẫu / byte
+            t["last_dl_at"] = now
+            t["dl_bytes"] += len(payload)
+
+    # ---------------- lượt nói ----------------
+    async def turn_loop(self):
+        done_turns = 0
+        while self.running and (self.args.turns < 0 or done_turns < self.args.turns):
+            await asyncio.sleep(self.rng.expovariate(1 / self.args.think_s) if self.args.think_s > 0 else 0)
+            try:
+                await asyncio.wait_for(self.ws_ready.wait(), timeout=30)
+            except asyncio.TimeoutError:
+                continue
+            if self.ota or self.rebooting or not self.running:
+                continue  # firmware không mở lượt nói khi đang cập nhật foreground
+            await self.one_turn(self.rng.choice(self.utterances))
+            done_turns += 1
+
+    async def one_turn(self, utt):
+        ws = self.ws
+        if ws is None:
+            return
+        self.ul_session = (self.ul_session + 1) & 0xFFFF
+        t = {"end_at": None, "processing_at": None, "first_audio_at": None, "finished_at": None,
+             "speaking": False, "done": asyncio.Event(), "aborted": None, "dl_session": None, "dl_seq": None,
+             "dl_lost": 0, "dl_gap": 0.0, "last_dl_at": 0.0, "dl_bytes": 0, "dl_underruns": 0, "play_at": 0.0}
+        self.turn = t
+        self.stats.inc("turns_started")
+        try:
+            await ws.send("START")
+            start = time.monotonic()
+            n = len(utt.payloads)
+            for seq, payload in enumerate(utt.payloads):
+                due = start + seq * utt.packet_ms / 1000
+                now = time.monotonic()
+                if due > now:
+                    await asyncio.sleep(due - now)
+                else:
+                    self.stats.ul_send_lag.append(now - due)
+                flags = FLAG_EOU if seq == n - 1 else 0
+                hdr = AUDIO_HDR.pack(AUDIO_PROTO, CODEC_ADPCM, flags, ADPCM_KBPS, self.ul_session,
+                                     seq & 0xFFFF, ms32(due))
+                await ws.send(hdr + payload)
+                self.stats.inc("ul_packets")
+                self.stats.inc("ul_bytes", len(hdr) + len(payload))
+            await ws.send("END")
+            t["end_at"] = time.monotonic()
+        except websockets.exceptions.WebSocketException:
+            t["aborted"] = "ws_drop"
+        if not t["aborted"]:
+            try:
+                await asyncio.wait_for(t["done"].wait(), timeout=self.args.turn_timeout_s)
+            except asyncio.TimeoutError:
+                t["aborted"] = "timeout"
+        self.turn = None
+        self.record_turn(t)
+
+    def record_turn(self, t):
+        s = self.stats
+        if t["aborted"]:
+            s.inc(f"turns_{t['aborted']}")
+            return
+        s.inc("turns_ok")
+        end = t["end_at"]
+        if t["processing_at"]:
+            s.latency["processing"].append(t["processing_at"] - end)
+        if t["first_audio_at"]:
+            s.latency["first_audio"].append(t["first_audio_at"] - end)
+            s.dl_gap.append(t["dl_gap"])
+        else:
+            s.inc("turns_no_audio")
+        if t["finished_at"]:
+            s.latency["turn"].append(t["finished_at"] - end)
+        s.inc("dl_bytes", t["dl_bytes"])
+        s.inc("dl_lost_packets", t["dl_lost"])
+        s.inc("dl_underruns", t["dl_underruns"])
+        if t["dl_underruns"]:
+            s.inc("turns_with_underrun")
+
+
+# =====================================================
+# OTA PUSHER (vai server: đẩy firmware tới các thiết bị ảo qua broker)
+# =====================================================
+class OtaPusher:
+    """Cùng thuật toán cửa sổ trượt với dummy_server.py, chạy song song cho nhiều máy."""
+
+    def __init__(self, args, devices, stats, loop):
+        self.args, self.stats, self.loop = args, stats, loop
+        with open(args.push_ota, "rb") as f:
+            image = f.read()
+        self.sha = hashlib.sha256(image).hexdigest()
+        self.data = image
+        self.params = {}
+        if args.push_ota_stream:
+            with open(args.push_ota_stream, "rb") as f:
+                self.data = f.read()
+            self.params = {"encoding": "heatshrink", "image_size": len(image), "window_sz2": 11, "lookahead_sz2": 4}
+        self.targets = [d.device_id for d in devices[:args.ota_devices or len(devices)]]
+        self.state = {}
+        self.client = mqtt.Client(mqtt.CallbackAPIVersion.VERSION2, client_id=f"ptalk-sim-ota-{os.getpid()}")
+        self.client.on_connect = self.on_connect
+        self.client.on_message = lambda c, u, m: self.loop.call_soon_threadsafe(self.on_message, m.topic, bytes(m.payload))
+        self.client.connect_async(args.broker, args.port, 60)
+        self.client.loop_start()
+
+    def on_connect(self, client, userdata, flags, rc, properties=None):
+        client.subscribe("devices/+/status", 1)
+        client.subscribe("devices/+/ota_ack", 1)
+
+    def on_message(self, topic, payload):
+        parts = topic.split("/")
+        st = self.state.get(parts[1])
+        if not st:
+            return
+        try:
+            msg = json.loads(payload)
+        except ValueError:
+            return
+        if parts[2] == "status":
+            if msg.get("message") == "Ready to receive firmware":
+                st["window"] = max(1, int(msg.get("window", 1)))
+                st["ready"].set()
+            elif msg.get("status") == "error":
+                st["error"] = msg.get("message")
+                st["ready"].set()
+        elif "ota_ack" in msg:
+            st["acked"].add(msg["ota_ack"])
+            st["acked"].update(range(st["base_hint"], msg.get("base", 0)))
+            st["base_hint"] = max(st["base_hint"], msg.get("base", 0))
+            st["wake"].set()
+        elif "ota_nack" in msg:
+            if msg["ota_nack"] not in st["acked"]:
+                st["resend"].add(msg["ota_nack"])
+            st["wake"].set()
+
+    async def run(self):
+        await asyncio.sleep(self.args.push_ota_at_s)
+        log("📤", f"Đẩy OTA {len(self.data)} B tới {len(self.targets)} thiết bị")
+        results = await asyncio.gather(*(self.push(dev) for dev in self.targets))
+        ok = [r for r in results if r]
+        self.stats.inc("push_ota_ok", len(ok))
+        self.stats.inc("push_ota_failed", len(results) - len(ok))
+        self.client.loop_stop()
+        self.client.disconnect()
+
+    async def push(self, dev):
+        size, cs = len(self.data), self.args.ota_chunk_size
+        total = (size + cs - 1) // cs
+        st = {"ready": asyncio.Event(), "wake": asyncio.Event(), "acked": set(), "resend": set(),
+              "base_hint": 0, "window": 1, "error": None}
+        self.state[dev] = st
+        t0 = time.monotonic()
+        self.client.publish(f"devices/{dev}/cmd", json.dumps(
+            {"cmd": "request_ota", "size": size, "sha256": self.sha, "chunk_size": cs, "total_chunks": total,
+             **self.params}), qos=1)
+        try:
+            await asyncio.wait_for(st["ready"].wait(), timeout=15)
+        except asyncio.TimeoutError:
+            st["error"] = "no Ready"
+        if st["error"]:
+            log("❌", f"push OTA {dev}: {st['error']}")
+            return False
+
+        def send(seq):
+            chunk = self.data[seq * cs:(seq + 1) * cs]
+            self.client.publish(f"devices/{dev}/ota_data",
+                                OTA_CHUNK_HDR.pack(seq, len(chunk), zlib.crc32(chunk) & 0xFFFFFFFF) + chunk, qos=1)
+            sent_at[seq] = time.monotonic()
+
+        sent_at, next_seq, last_progress = {}, 0, time.monotonic()
+        while True:
+            base = next((s for s in range(st["base_hint"], total) if s not in st["acked"]), total)
+            if base >= total:
+                break
+            now = time.monotonic()
+            for seq in sorted(st["resend"]):
+                if seq not in st["acked"]:
+                    send(seq)
+                    self.stats.inc("push_ota_resent")
+            st["resend"].clear()
+            for seq, at in list(sent_at.items()):
+                if seq in st["acked"]:
+                    del sent_at[seq]
+                    last_progress = now
+                elif now - at > 2:
+                    send(seq)
+                    self.stats.inc("push_ota_resent")
+            while next_seq < total and next_seq < base + st["window"]:
+                send(next_seq)
+                next_seq += 1
+            if now - last_progress > 30:
+                log("❌", f"push OTA {dev}: không có ACK mới trong 30 s (base {base})")
+                return False
+            st["wake"].clear()
+            try:
+                await asyncio.wait_for(st["wake"].wait(), timeout=0.5)
+            except asyncio.TimeoutError:
+                pass
+        seconds = time.monotonic() - t0
+        self.stats.latency.setdefault("push_ota", []).append(seconds)
+        return True
+
+
+# =====================================================
+# BÁO CÁO
+# =====================================================
+def build_report(args, stats, devices, watches, broker_sys, wall_s):
+    c = stats.counters
+    ota_ok = [o for o in stats.ota if o["ok"]]
+    report = {
+        "config": {"devices": args.devices, "duration_s": round(wall_s, 1), "think_s": args.think_s,
+                   "packet_ms": args.packet_ms, "ws": args.ws, "broker": f"{args.broker}:{args.port}"},
+        "connected": {"mqtt": sum(d.mqtt_up for d in devices), "ws": sum(d.ws is not None for d in devices)},
+        "turns": {k[6:]: v for k, v in c.items() if k.startswith("turns_")},
+        "latency_ms": {k: summarize(v, 1000) for k, v in stats.latency.items() if v},
+        "uplink": {"packets": c.get("ul_packets", 0), "kbps": round(c.get("ul_bytes", 0) * 8 / 1000 / max(wall_s, 1), 1),
+                   "send_lag_ms": summarize(stats.ul_send_lag, 1000)},
+        "downlink": {"kbps": round(c.get("dl_bytes", 0) * 8 / 1000 / max(wall_s, 1), 1),
+                     "lost_packets": c.get("dl_lost_packets", 0), "underruns": c.get("dl_underruns", 0),
+                     "max_gap_ms": summarize(stats.dl_gap, 1000)},
+        "ota": {"ok": len(ota_ok), "failed": len(stats.ota) - len(ota_ok),
+                "kBps_per_device": summarize([o["bytes"] / 1024 / max(o["seconds"], 1e-3) for o in ota_ok]),
+                "kBps_total": round(sum(o["bytes"] for o in ota_ok) / 1024 / max(wall_s, 1), 1),
+                "crc_errors": c.get("ota_crc_errors", 0), "duplicates": c.get("ota_duplicates", 0),
+                "out_of_window": c.get("ota_out_of_window", 0)},
+        "connections": {k: v for k, v in c.items() if k.startswith(("ws_", "mqtt_", "reboots"))},
+        "protocol_errors": stats.errors,
+        "resources": {w.name: w.report() for w in watches},
+    }
+    if broker_sys:
+        report["broker_sys"] = broker_sys.report()
+    return report
+
+
+def print_report(r):
+    print("\n==================== KẾT QUẢ ====================")
+    print(f"Thiết bị: {r['config']['devices']}  |  thời gian: {r['config']['duration_s']} s  |  "
+          f"đang kết nối MQTT {r['connected']['mqtt']} / WS {r['connected']['ws']}")
+    print(f"Lượt nói: {r['turns']}")
+    for k, v in r["latency_ms"].items():
+        if v["n"]:
+            print(f"  {k:<12} n={v['n']:<6} p50={v['p50']:>8} p90={v['p90']:>8} p99={v['p99']:>8} max={v['max']:>8} ms")
+    ul, dl = r["uplink"], r["downlink"]
+    print(f"Uplink: {ul['packets']} gói, {ul['kbps']} kbps; trễ gửi (simulator) {ul['send_lag_ms']}")
+    print(f"Downlink: {dl['kbps']} kbps, mất {dl['lost_packets']} gói, underrun {dl['underruns']}, gap {dl['max_gap_ms']}")
+    o = r["ota"]
+    print(f"OTA: ok {o['ok']} / lỗi {o['failed']}, KB/s mỗi máy {o['kBps_per_device']}, tổng {o['kBps_total']} KB/s, "
+          f"CRC {o['crc_errors']}, trùng {o['duplicates']}, ngoài cửa sổ {o['out_of_window']}")
+    print(f"Kết nối: {r['connections']}")
+    for name, res in r["resources"].items():
+        print(f"Tài nguyên {name} (pid {res['pid']}): CPU avg {res['cpu_avg']} % max {res['cpu_max']} %, "
+              f"RSS max {res['rss_max_mb']} MB")
+    for k, v in r.get("broker_sys", {}).items():
+        print(f"Broker {k}: cuối {v['last']}, max {v['max']}")
+    if r["protocol_errors"]:
+        print("LỖI GIAO THỨC:")
+        for k, v in r["protocol_errors"].items():
+            print(f"  {k}: {v['count']} (vd: {v['first']})")
+
+
+# =====================================================
+# MAIN
+# =====================================================
+def parse_args():
+    p = argparse.ArgumentParser(description="PTalk multi-device load simulator")
+    p.add_argument("--devices", type=int, default=10)
+    p.add_argument("--ramp-s", type=float, default=10, help="rải thời điểm boot các máy trong khoảng này")
+    p.add_argument("--duration-s", type=float, default=120, help="0 = tới khi mọi máy xong --turns")
+    p.add_argument("--turns", type=int, default=-1, help="số lượt nói mỗi máy (-1 = không giới hạn)")
+    p.add_argument("--think-s", type=float, default=15, help="trung bình nghỉ giữa hai lượt (phân phối mũ)")
+    p.add_argument("--turn-timeout-s", type=float, default=30)
+    p.add_argument("--wav", action="append", help="utterance ghi sẵn (lặp lại được); mặc định output_*.wav")
+    p.add_argument("--max-utt-s", type=float, default=4, help="cắt utterance (0 = cả file)")
+    p.add_argument("--packet-ms", type=int, default=40, help="NetworkManager::Config::uplink_packet_ms")
+    p.add_argument("--jitter-ms", type=int, default=120, help="jitter target của playout ảo")
+    p.add_argument("--ws", default="ws://127.0.0.1:8000/ws")
+    p.add_argument("--broker", default="127.0.0.1")
+    p.add_argument("--port", type=int, default=1883)
+    p.add_argument("--keepalive", type=int, default=60)
+    p.add_argument("--clean-session", action="store_true", help="firmware dùng persistent session")
+    p.add_argument("--no-mqtt", action="store_true")
+    p.add_argument("--telemetry-s", type=float, default=60, help="0 = không gửi telemetry")
+    p.add_argument("--resume-window-ms", type=int, default=15000)
+    p.add_argument("--ota-window", type=int, default=8, help="NetworkManager::Config::ota_window")
+    p.add_argument("--ota-http-chunk", type=int, default=4096)
+    p.add_argument("--reboot-s", type=float, default=3, help="thời gian boot lại sau OTA / reboot")
+    p.add_argument("--no-reboot", action="store_true", help="không reboot sau OTA thành công")
+    p.add_argument("--push-ota", help="đóng vai server: đẩy firmware này qua MQTT")
+    p.add_argument("--push-ota-stream", help="luồng heatshrink đã nén của --push-ota (-w 11 -l 4)")
+    p.add_argument("--push-ota-at-s", type=float, default=5)
+    p.add_argument("--ota-devices", type=int, default=0, help="số máy nhận --push-ota (0 = tất cả)")
+    p.add_argument("--ota-chunk-size", type=int, default=2048)
+    p.add_argument("--id-prefix", default="51D000", help="device_id = prefix + số thứ tự hex (12 ký tự)")
+    p.add_argument("--seed", type=int, default=1)
+    p.add_argument("--watch-pid", action="append", default=[], metavar="NAME=PID",
+                   help="theo dõi CPU / RSS của process (server, broker)")
+    p.add_argument("--broker-sys", action="store_true", help="đọc $SYS/broker/# (mosquitto)")
+    p.add_argument("--report-s", type=float, default=10, help="chu kỳ in tiến độ")
+    p.add_argument("--json", help="ghi báo cáo JSON (so sánh giữa các bản build)")
+    return p.parse_args()
+
+
+async def main():
+    args = parse_args()
+    loop = asyncio.get_running_loop()
+    here = os.path.dirname(os.path.abspath(__file__))
+    wavs = args.wav or sorted(glob.glob(os.path.join(here, "output_*.wav")))
+    if not wavs:
+        raise SystemExit("Không có utterance: dùng --wav <file.wav>")
+    utterances = [Utterance(w, args.packet_ms, args.max_utt_s) for w in wavs]
+    for u in utterances:
+        log("🎙️", f"{u.name}: {u.duration_s:.1f} s, {len(u.payloads)} gói {args.packet_ms} ms")
+
+    stats = Stats()
+    devices = [VirtualDevice(i, args, utterances, stats, loop) for i in range(args.devices)]
+    watches = []
+    for spec in args.watch_pid:
+        name, _, pid = spec.partition("=")
+        if pid.strip().isdigit():
+            watches.append(ProcWatch(name, int(pid)))
+        else:
+            log("⚠️", f"--watch-pid {spec}: cần NAME=PID")
+    broker_sys = BrokerSys(args) if args.broker_sys and not args.no_mqtt else None
+
+    t_start = time.monotonic()
+    tasks = [asyncio.create_task(d.run(args.ramp_s * i / max(args.devices, 1))) for i, d in enumerate(devices)]
+    pusher = OtaPusher(args, devices, stats, loop) if args.push_ota else None
+    pusher_task = asyncio.create_task(pusher.run()) if pusher else None
+
+    async def monitor():
+        next_report = time.monotonic() + args.report_s
+        while True:
+            for w in watches:
+                w.sample()
+            if time.monotonic() >= next_report:
+                next_report += args.report_s
+                c = stats.counters
+                fa = stats.latency["first_audio"]
+                log("📊", f"MQTT {sum(d.mqtt_up for d in devices)} WS {sum(d.ws is not None for d in devices)} | "
+                    f"turns ok {c.get('turns_ok', 0)} timeout {c.get('turns_timeout', 0)} | "
+                    f"first_audio p50 {1000 * (percentile(fa, 50) or 0):.0f} ms p99 {1000 * (percentile(fa, 99) or 0):.0f} ms | "
+                    f"OTA ok {c.get('ota_ok', 0)} | lỗi {c.get('protocol_errors', 0)}")
+            await asyncio.sleep(1)
+
+    mon = asyncio.create_task(monitor())
+    try:
+        waiters = tasks + ([pusher_task] if pusher_task else [])
+        if args.duration_s > 0:
+            await asyncio.wait(waiters, timeout=args.duration_s)
+        else:
+            await asyncio.wait(waiters)
+            # OTA đang ghi / reboot sau OTA: chờ xong để có số liệu
+            deadline = time.monotonic() + args.turn_timeout_s
+            while any(d.busy() for d in devices) and time.monotonic() < deadline:
+                await asyncio.sleep(0.2)
+    except asyncio.CancelledError:
+        pass
+    finally:
+        wall = time.monotonic() - t_start
+        report = build_report(args, stats, devices, watches, broker_sys, wall)
+        mon.cancel()
+        for t in waiters:
+            t.cancel()
+        await asyncio.gather(*(d.stop() for d in devices), return_exceptions=True)
+        await asyncio.gather(*waiters, return_exceptions=True)
+        if broker_sys:
+            broker_sys.stop()
+        print_report(report)
+        if args.json:
+            with open(args.json, "w", encoding="utf-8") as f:
+                json.dump(report, f, indent=2, ensure_ascii=False)
+            log("💾", f"Báo cáo: {args.json}")
+
+
+if __name__ == "__main__":
+    try:
+        asyncio.run(main())
+    except KeyboardInterrupt:
+        pass
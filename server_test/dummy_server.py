@@ -3,8 +3,10 @@ import time
 import paho.mqtt.client as mqtt
 import struct
 import zlib
+import hashlib
 import os
 import socket
+import threading
 
 # === CẤU HÌNH ===
 MQTT_BROKER = "127.0.0.1" 
@@ -17,10 +19,13 @@ selected_mac = None
 # Trạng thái luồng OTA
 ota_context = {
     "is_running": False,
-    "waiting_for_ack": -1,
+    "acked": set(),      # khối đã được ACK (selective)
+    "resend": set(),     # khối bị NACK, cần gửi lại
+    "window": 1,         # số khối được phép bay cùng lúc (ESP32 báo trong Ready)
     "is_ready": False,
     "error": False
 }
+ota_lock = threading.Lock()
 
 def get_local_ip():
     try:
@@ -33,6 +38,40 @@ def get_local_ip():
 
 local_ip = get_local_ip()
 
+# --- NÉN HEATSHRINK (LZSS, cùng định dạng với `heatshrink -w 11 -l 4`) ---
+# Encoder tham lam đơn giản, đủ cho test; ESP32 giải nén khi ghi flash.
+def heatshrink_compress(data, window_sz2=11, lookahead_sz2=4):
+    W, L = window_sz2, lookahead_sz2
+    max_off, max_len = 1 << W, 1 << L
+    out = bytearray(); acc = 0; nbits = 0
+    def put(v, n):
+        nonlocal acc, nbits
+        acc = (acc << n) | v; nbits += n
+        while nbits >= 8:
+            nbits -= 8; out.append((acc >> nbits) & 0xFF)
+        acc &= (1 << nbits) - 1
+    heads = {}
+    i, n = 0, len(data)
+    min_len = (1 + W + L) // 9 + 1
+    while i < n:
+        best_len, best_off = 0, 0
+        key = data[i:i + 3]
+        for j in reversed(heads.get(key, [])[-16:]):
+            if i - j > max_off: break
+            k = 0
+            while k < max_len and i + k < n and data[j + k] == data[i + k]: k += 1
+            if k > best_len: best_len, best_off = k, i - j
+            if k == max_len: break
+        step = best_len if best_len >= min_len else 1
+        if step > 1: put(0, 1); put(best_off - 1, W); put(best_len - 1, L)
+        else: put(1, 1); put(data[i], 8)
+        for p in range(i, i + step):
+            heads.setdefault(data[p:p + 3], []).append(p)
+        i += step
+    if nbits: put(0, 8 - nbits)
+    return bytes(out)
+
+
 # --- CALLBACKS MQTT ---
 def on_connect(client, userdata, flags, rc, properties=None):
     if rc == 0:
@@ -58,6 +97,7 @@ def on_message(client, userdata, msg):
             
             # Kiểm tra nếu ESP32 báo sẵn sàng nhận OTA
             if payload.get("message") == "Ready to receive firmware":
+                ota_context["window"] = max(1, int(payload.get("window", 1)))
                 ota_context["is_ready"] = True
             elif payload.get("status") == "error":
                 print(f"\n❌ ESP32 báo lỗi: {payload.get('message')}")
@@ -65,13 +105,17 @@ def on_message(client, userdata, msg):
 
         # 2. Xử lý ACK từ luồng OTA
         elif topic_parts[2] == "ota_ack":
-            if "ota_ack" in payload:
-                ack_seq = payload["ota_ack"]
-                if ack_seq == ota_context["waiting_for_ack"]:
-                    ota_context["waiting_for_ack"] = -1
-            elif "ota_nack" in payload:
-                print(f"\n⚠️ Nhận NACK cho khối {payload['ota_nack']}")
-                ota_context["error"] = True
+            with ota_lock:
+                if "ota_ack" in payload:
+                    ota_context["acked"].add(payload["ota_ack"])
+                    # "base": mọi khối < base đã nhận (ACK tích lũy)
+                    ota_context["acked"].update(range(payload.get("base", 0)))
+                elif "ota_nack" in payload:
+                    seq = payload["ota_nack"]
+                    if not payload.get("busy"):
+                        print(f"\n⚠️ Nhận NACK cho khối {seq}")
+                    if seq not in ota_context["acked"]:
+                        ota_context["resend"].add(seq)
 
     except: pass
 
@@ -103,12 +147,24 @@ def run_ota_flow():
     with open(fw_path, "rb") as f:
         fw_data = f.read()
     
+    image_sha256 = hashlib.sha256(fw_data).hexdigest()  # ESP32 kiểm tra khi ghi xong
+    ota_params = {"sha256": image_sha256}
+    if input("🗜️  Nén heatshrink? (y/N): ").strip().lower() == "y":
+        print("⏳ Đang nén...")
+        ota_params.update({"encoding": "heatshrink", "image_size": file_size,
+                           "window_sz2": 11, "lookahead_sz2": 4})
+        fw_data = heatshrink_compress(fw_data, 11, 4)
+        print(f"   {file_size} -> {len(fw_data)} bytes ({file_size / len(fw_data):.1f}x)")
+        file_size = len(fw_data)
+
     total_chunks = (file_size + CHUNK_SIZE - 1) // CHUNK_SIZE
     
     # Reset context
     ota_context["is_ready"] = False
     ota_context["error"] = False
-    ota_context["waiting_for_ack"] = -1
+    ota_context["acked"] = set()
+    ota_context["resend"] = set()
+    ota_context["window"] = 1
     
     print(f"📦 Bắt đầu OTA cho {selected_mac}...")
     print(f"   Size: {file_size} bytes | Chunks: {total_chunks}")
@@ -116,9 +172,9 @@ def run_ota_flow():
     # Gửi lệnh mồi request_ota
     send_cmd("request_ota", {
         "size": file_size,
-        "sha256": "dummy_hash",
         "chunk_size": CHUNK_SIZE,
-        "total_chunks": total_chunks
+        "total_chunks": total_chunks,
+        **ota_params
     })
 
     # Đợi phản hồi Ready
@@ -131,32 +187,56 @@ def run_ota_flow():
             return
         time.sleep(0.1)
 
-    # Gửi từng khối
+    # Cửa sổ trượt: tối đa `window` khối chưa ACK đang bay. Khối bị NACK
+    # (CRC sai / ESP32 bận) hoặc quá hạn ACK thì gửi lại.
     data_topic = f"devices/{selected_mac}/ota_data"
-    for seq in range(total_chunks):
-        if ota_context["error"]: break
+    window = ota_context["window"]
+    print(f"   Window: {window} khối")
 
+    def publish_chunk(seq):
         start_idx = seq * CHUNK_SIZE
-        end_idx = min(start_idx + CHUNK_SIZE, file_size)
-        chunk = fw_data[start_idx:end_idx]
-        
+        chunk = fw_data[start_idx:min(start_idx + CHUNK_SIZE, file_size)]
         # Đóng gói Header: [Seq 4B][Size 4B][CRC 4B]
         crc = zlib.crc32(chunk) & 0xFFFFFFFF
         header = struct.pack('<III', seq, len(chunk), crc)
-        
-        ota_context["waiting_for_ack"] = seq
         client.publish(data_topic, header + chunk, qos=1)
 
-        # Chờ ACK
-        ack_start = time.time()
-        while ota_context["waiting_for_ack"] != -1:
-            if time.time() - ack_start > 10: # 10s timeout mỗi khối
-                print(f"\n❌ Mất ACK khối {seq}")
-                return
-            time.sleep(0.01)
+    sent_at = {}     # seq -> thời điểm gửi gần nhất
+    next_seq = 0
+    last_progress = time.time()
+    while not ota_context["error"]:
+        with ota_lock:
+            acked = len(ota_context["acked"])
+            base = next(s for s in range(total_chunks + 1) if s == total_chunks or s not in ota_context["acked"])
+            resend = sorted(ota_context["resend"])
+            ota_context["resend"].clear()
+        if base >= total_chunks:
+            break
 
-        if seq % 5 == 0 or seq == total_chunks - 1:
-            print(f"📤 Progress: {(seq+1)/total_chunks*100:.1f}% ({seq+1}/{total_chunks})", end='\r')
+        now = time.time()
+        for seq in resend:
+            if seq not in ota_context["acked"]:
+                publish_chunk(seq)
+                sent_at[seq] = now
+        for seq, t in list(sent_at.items()):
+            if seq in ota_context["acked"]:
+                del sent_at[seq]
+            elif now - t > 2:  # 2s không có ACK → gửi lại
+                publish_chunk(seq)
+                sent_at[seq] = now
+        while next_seq < total_chunks and next_seq < base + window:
+            publish_chunk(next_seq)
+            sent_at[next_seq] = now
+            next_seq += 1
+
+        if acked != ota_context.get("last_acked"):
+            ota_context["last_acked"] = acked
+            last_progress = now
+            print(f"📤 Progress: {acked/total_chunks*100:.1f}% ({acked}/{total_chunks})", end='\r')
+        elif now - last_progress > 10:
+            print(f"\n❌ Không có ACK mới trong 10s (base {base})")
+            return
+        time.sleep(0.005)
 
     if not ota_context["error"]:
         print("\n✅ OTA Thành công! Thiết bị sẽ Reboot.")
@@ -28,6 +28,31 @@ STEP_TABLE = [
 INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8,
                -1, -1, -1, -1, 2, 4, 6, 8]
 
+# =====================================================
+# AUDIO PACKET HEADER (lib/network/AudioPacket.hpp), both directions
+# version u8, codec u8, flags u8, reserved u8, session u16, seq u16,
+# timestamp_ms u32 — little-endian
+# =====================================================
+AUDIO_HDR = struct.Struct("<BBBBHHI")
+AUDIO_PROTO = 2
+CODEC_ADPCM = 1
+FLAG_EOU = 0x01
+FLAG_GAP = 0x02
+FLAG_SYNC = 0x04  # downlink ADPCM: encoder state follows the header
+FLAG_CANCEL = 0x08  # uplink: device cancelled the turn (local voice command)
+SYNC_STATE = struct.Struct("<hBB")  # predictor i16, index u8, reserved u8
+
+DOWNLINK_SESSION = 0
+DOWNLINK_SYNC = False  # device handshake sent audio_dl_sync
+
+
+def now_ms() -> int:
+    return int(asyncio.get_event_loop().time() * 1000) & 0xFFFFFFFF
+
+
+def audio_packet(codec: int, flags: int, session: int, seq: int, payload: bytes = b"") -> bytes:
+    return AUDIO_HDR.pack(AUDIO_PROTO, codec, flags, 0, session & 0xFFFF, seq & 0xFFFF, now_ms()) + payload
+
 # =====================================================
 # ADPCM CODEC
 # =====================================================
@@ -114,6 +139,8 @@ def log(tag, msg):
 
 # Track the most recent/active WebSocket connection
 ACTIVE_WS = None  # type: WebSocket | None
+# Session token -> negotiated uplink header flag (device resumes after short drops)
+SESSIONS = {}
 
 
 def read_checksum(bin_path: str, provided: str | None) -> str:
@@ -292,16 +319,28 @@ async def send_wav(ws: WebSocket, path: str):
         await ws.send_text("01")
         await ws.send_text("SPEAK_START")
 
+        global DOWNLINK_SESSION
+        DOWNLINK_SESSION = (DOWNLINK_SESSION + 1) & 0xFFFF
+        seq = 0
+
         tx_state = (0, 0)
         with wave.open(path, "rb") as wf:
             while True:
                 pcm = wf.readframes(1024)
                 if not pcm:
                     break
+                flags, sync = 0, b""
+                if DOWNLINK_SYNC:
+                    # State at the packet's first sample: the device resyncs after a loss
+                    flags, sync = FLAG_SYNC, SYNC_STATE.pack(tx_state[0], tx_state[1], 0)
                 adpcm, tx_state = adpcm_encode(pcm, tx_state)
-                await ws.send_bytes(adpcm)
+                await ws.send_bytes(audio_packet(CODEC_ADPCM, flags, DOWNLINK_SESSION, seq, sync + adpcm))
+                seq += 1
                 await asyncio.sleep(0.060)
 
+        # Header-only end-of-stream: device drains its jitter buffer at once
+        await ws.send_bytes(audio_packet(CODEC_ADPCM, FLAG_EOU, DOWNLINK_SESSION, seq))
+
         await ws.send_text("TTS_END")
         log("🏁", "Playback finished naturally")
 
@@ -314,12 +353,15 @@ async def send_wav(ws: WebSocket, path: str):
 
 @app.websocket("/ws")
 async def websocket_endpoint(ws: WebSocket):
-    global ACTIVE_WS
+    global ACTIVE_WS, DOWNLINK_SYNC
     await ws.accept()
     ACTIVE_WS = ws
     log("📡", "ESP32 connected")
 
     rx_state = (0, 0)
+    rx_seq = None
+    rx_session = None
+    uplink_header = False
     pcm_buf = []
     recording = False
     current_tts_task = None
@@ -330,12 +372,38 @@ async def websocket_endpoint(ws: WebSocket):
 
             if "bytes" in data:
                 if recording:
-                    adpcm = data["bytes"]
+                    pkt = data["bytes"]
+                    adpcm = pkt
+                    if uplink_header and len(pkt) >= AUDIO_HDR.size:
+                        ver, codec, flags, _, session, seq, _ts = AUDIO_HDR.unpack_from(pkt)
+                        if ver != AUDIO_PROTO or codec != CODEC_ADPCM:
+                            log("⚠️", f"Unsupported uplink packet v{ver} codec {codec}")
+                            continue
+                        if session != rx_session:
+                            log("🎙️", f"Uplink session {session}")
+                            rx_session, rx_seq = session, None
+                        if rx_seq is not None and seq != (rx_seq + 1) & 0xFFFF:
+                            log("⚠️", f"Uplink seq jump {rx_seq} -> {seq}")
+                        if flags & FLAG_GAP:
+                            log("⚠️", f"Device dropped frames before seq {seq}")
+                        rx_seq = seq
+                        if flags & FLAG_CANCEL:
+                            log("✖️", f"Uplink session {session} cancelled on the device")
+                            pcm_buf.clear()
+                            recording = False
+                            continue
+                        adpcm = pkt[AUDIO_HDR.size:]
+                        if flags & FLAG_EOU:
+                            log("🏁", f"End of utterance (seq {seq})")
                     pcm, rx_state = adpcm_decode(adpcm, rx_state)
                     pcm_buf.append(pcm)
 
             elif "text" in data:
                 msg = data["text"]
+                # RTT probe: echo the device's stamp back (not logged, 1/s in a turn)
+                if msg.startswith("PING:"):
+                    await ws.send_text("PONG:" + msg[5:])
+                    continue
                 # Try JSON first (handshake/acks/status)
                 try:
                     obj = json.loads(msg)
@@ -344,6 +412,22 @@ async def websocket_endpoint(ws: WebSocket):
                         log("📩 JSON", obj)
                         if cmd == "device_handshake":
                             ACTIVE_WS = ws
+                            uplink_header = obj.get("audio_protocol") == AUDIO_PROTO
+                            DOWNLINK_SYNC = uplink_header and bool(obj.get("audio_dl_sync"))
+                            if obj.get("session"):
+                                SESSIONS[obj["session"]] = uplink_header
+                            if uplink_header:
+                                # Same header on our audio from now on
+                                await ws.send_text(f"AUDIO_PROTO:{AUDIO_PROTO}")
+                        elif cmd == "session_resume":
+                            ACTIVE_WS = ws
+                            token = obj.get("session")
+                            if token in SESSIONS:
+                                uplink_header = SESSIONS[token]
+                                log("🔁", f"Session {token} resumed")
+                                await ws.send_text("SESSION:RESUMED")
+                            else:
+                                await ws.send_text("SESSION:NEW")
                         # Handle OTA ACK/NACK
                         if "ota_ack" in obj or "ota_nack" in obj:
                             handle_ota_ack(obj)
@@ -360,6 +444,7 @@ async def websocket_endpoint(ws: WebSocket):
 
                     pcm_buf.clear()
                     rx_state = (0, 0)
+                    rx_seq = None
                     recording = True
                     log("🎙️", "Record START")
 
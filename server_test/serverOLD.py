@@ -406,6 +406,11 @@ async def websocket_endpoint(websocket: WebSocket):
                 # 1. Text control
                 if "text" in message:
                     text_data = message["text"]
+
+                    # RTT probe của thiết bị: trả lại nguyên stamp
+                    if text_data.startswith("PING:"):
+                        await websocket.send_text("PONG:" + text_data[5:])
+                        continue
                     
                     # XỬ LÝ "Start" - Bắt đầu thu âm
                     if text_data == "Start":
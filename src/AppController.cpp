@@ -5,9 +5,24 @@
 #include "system/PowerManager.hpp"
 #include "../../lib/touch/TouchInput.hpp"
 #include "system/OTAUpdater.hpp"
+#include "system/LatencyTrace.hpp"
+#include "system/MemTelemetry.hpp"
+#include "system/Profiler.hpp"
+#include "system/MemArena.hpp"
+#include "system/SerialConsole.hpp"
+#include "system/ResumeState.hpp"
+#include "system/InitGraph.hpp"
+#include "system/TaskPlan.hpp"
+#include "system/AnimPackCache.hpp"
+#include "system/ConfigStore.hpp"
+#include "system/EventLog.hpp"
+#include "system/AudioHealth.hpp"
+#include "system/MediaPlayer.hpp"
 
 #include "esp_log.h"
 
+#include <algorithm>
+#include <cstdlib>
 #include <utility>
 
 static const char *TAG = "AppController";
@@ -35,6 +50,12 @@ struct AppMessage
     event::AppEvent app_event;
 };
 
+// Lane storage (singleton controller → file scope)
+static StaticQueue_t s_high_queue_buf;
+static StaticQueue_t s_normal_queue_buf;
+static uint8_t s_high_storage[AppController::HIGH_DEPTH * sizeof(AppMessage)];
+static uint8_t s_normal_storage[AppController::NORMAL_DEPTH * sizeof(AppMessage)];
+
 // ===================== Emotion parsing =====================
 
 state::EmotionState AppController::parseEmotionCode(const std::string &code)
@@ -69,10 +90,16 @@ AppController::~AppController()
     if (sub_power_id != -1)
         sm.unsubscribePower(sub_power_id);
 
-    if (app_queue)
+    // Static queues: vQueueDelete only unregisters them
+    if (high_queue)
+    {
+        vQueueDelete(high_queue);
+        high_queue = nullptr;
+    }
+    if (normal_queue)
     {
-        vQueueDelete(app_queue);
-        app_queue = nullptr;
+        vQueueDelete(normal_queue);
+        normal_queue = nullptr;
     }
 }
 
@@ -101,12 +128,13 @@ bool AppController::init()
 {
     ESP_LOGI(TAG, "AppController init()");
 
-    if (app_queue == nullptr)
+    if (high_queue == nullptr)
     {
-        app_queue = xQueueCreate(16, sizeof(AppMessage));
-        if (!app_queue)
+        high_queue = xQueueCreateStatic(HIGH_DEPTH, sizeof(AppMessage), s_high_storage, &s_high_queue_buf);
+        normal_queue = xQueueCreateStatic(NORMAL_DEPTH, sizeof(AppMessage), s_normal_storage, &s_normal_queue_buf);
+        if (!high_queue || !normal_queue)
         {
-            ESP_LOGE(TAG, "Failed to create app_queue");
+            ESP_LOGE(TAG, "Failed to create controller queues");
             return false;
         }
     }
@@ -137,10 +165,7 @@ bool AppController::init()
             msg.type = AppMessage::Type::INTERACTION;
             msg.interaction_state = s;
             msg.interaction_source = src;
-            if (app_queue)
-            {
-                xQueueSend(app_queue, &msg, 0);
-            }
+            postMessage(Lane::HIGH, msg);
         });
 
     sub_conn_id = sm.subscribeConnectivity(
@@ -149,10 +174,7 @@ bool AppController::init()
             AppMessage msg{};
             msg.type = AppMessage::Type::CONNECTIVITY;
             msg.connectivity_state = s;
-            if (app_queue)
-            {
-                xQueueSend(app_queue, &msg, 0);
-            }
+            postMessage(Lane::NORMAL, msg);
         });
 
     sub_sys_id = sm.subscribeSystem(
@@ -161,22 +183,15 @@ bool AppController::init()
             AppMessage msg{};
             msg.type = AppMessage::Type::SYSTEM;
             msg.system_state = s;
-            if (app_queue)
-            {
-                xQueueSend(app_queue, &msg, 0);
-            }
+            postMessage(Lane::NORMAL, msg);
         });
 
     sub_power_id = sm.subscribePower(
         [this](state::PowerState s)
         {
-            AppMessage msg{};
-            msg.type = AppMessage::Type::POWER;
-            msg.power_state = s;
-            if (app_queue)
-            {
-                xQueueSend(app_queue, &msg, 0);
-            }
+            // Only the newest power state matters to the control logic
+            pending_power.store(s, std::memory_order_relaxed);
+            postCoalesced(COALESCE_POWER);
         });
 
     return true;
@@ -193,50 +208,16 @@ void AppController::start()
     started.store(true);
 
     // 1️⃣ Start the main controller task FIRST
-    BaseType_t res = xTaskCreatePinnedToCore(
-        &AppController::controllerTask,
-        "AppControllerTask",
-        4096,
-        this,
-        4,
-        &app_task,
-        1
-    );
-
-    if (res != pdPASS)
-    {
-        ESP_LOGE(TAG, "Failed to create AppControllerTask");
+    if (!TaskPlan::instance().spawn(TaskPlan::CONTROLLER, &AppController::controllerTask, this, &app_task))
+    {
         started.store(false);
         return;
     }
 
     vTaskDelay(pdMS_TO_TICKS(10));
 
-    // 2️⃣ Start PowerManager
-    if (power)
-    {
-        if (!power->init())
-        {
-            ESP_LOGE(TAG, "PowerManager init failed");
-        }
-        else
-        {
-            power->start();
-            power->sampleNow();
-        }
-    }
-
-    // 3️⃣ Start DisplayManager
-    if (display)
-    {
-        if (!display->isLoopRunning() && !display->startLoop(33, 3, 4096, 1))
-        {
-            ESP_LOGE(TAG, "DisplayManager startLoop failed");
-        }
-    }
-
     // ============================================================================
-    // 4️⃣ Start NetworkManager + Setup OTA callbacks
+    // 2️⃣ Setup OTA callbacks
     // ============================================================================
     if (network)
     {
@@ -245,19 +226,83 @@ void AppController::start()
         network->onServerOTARequest([this]()
         {
             ESP_LOGI(TAG, "🔄 Server initiated OTA via MQTT - setting up handlers");
-            
-            // Set system state (for UI)
-            StateManager::instance().setSystemState(state::SystemState::UPDATING_FIRMWARE);
+
+            // Background: no UPDATING_FIRMWARE screen, the conversation goes on;
+            // the transfer is throttled and paused outside IDLE
+            const bool background = network->isFirmwareBackground();
+            ota_background_ = background;
+            ota_apply_pending_ = false;
+            if (!background)
+                StateManager::instance().setSystemState(state::SystemState::UPDATING_FIRMWARE);
+            if (ota) {
+                ota->setRateLimit(background ? config_.ota_background_rate : 0);
+                ota->setPaused(background && StateManager::instance().getInteractionState() !=
+                                                 state::InteractionState::IDLE);
+            }
+
+            // Transfer finished (both transports): flash + reboot, or back out
+            auto on_complete = [this, background](bool success, const std::string &msg)
+            {
+                if (success) {
+                    ESP_LOGI(TAG, "✅ OTA transfer complete: %s", msg.c_str());
+                    postEvent(event::AppEvent::OTA_FINISHED);
+                } else {
+                    ESP_LOGE(TAG, "❌ OTA failed: %s", msg.c_str());
+                    if (ota)
+                        ota->abortUpdate();
+                    ota_background_ = false;
+                    // Background failure: reported on MQTT only, the device stays usable
+                    if (background)
+                        return;
+                    StateManager::instance().setSystemState(state::SystemState::ERROR);
+                    if (display)
+                        display->showOTAError(msg);
+                }
+            };
+
+            // HTTP(S) transport: the updater pulls the image itself, MQTT
+            // only reports the result
+            const OtaDownload &dl = network->getFirmwareDownload();
+            if (!dl.url.empty())
+            {
+                bool started = false;
+                if (ota) {
+                    // Writer task → latest-value slot, drawn by the display task
+                    if (background)
+                        ota->setProgressCallback(nullptr);
+                    else
+                        ota->setProgressCallback([this](uint32_t current, uint32_t total)
+                        {
+                            if (display && total)
+                                display->setOTAProgress(static_cast<uint8_t>(uint64_t(current) * 100 / total));
+                        });
+                    started = ota->startDownload(dl, [this, on_complete](bool success, const std::string &msg)
+                    {
+                        network->firmwareDownloadDone(success, msg);
+                        on_complete(success, msg);
+                    });
+                }
+                if (!started) {
+                    network->firmwareDownloadDone(false, "OTA download not started");
+                    ota_background_ = false;
+                    if (!background)
+                        StateManager::instance().setSystemState(state::SystemState::ERROR);
+                } else if (display && !background) {
+                    display->showOTAUpdating();
+                }
+                return;
+            }
             
             // ✅ Register chunk handler (called for each binary chunk)
-            network->onFirmwareChunk([this](const uint8_t *data, size_t size)
+            network->onFirmwareChunk([this, background](uint32_t seq, const uint8_t *data, size_t size) -> OtaChunkStatus
             {
                 if (!ota) {
                     ESP_LOGE(TAG, "OTA module not available!");
-                    return;
+                    return OtaChunkStatus::FAILED;
                 }
 
-                // Begin OTA on first chunk
+                // Begin OTA on first chunk; the updater's writer task flashes
+                // chunks in order while MQTT keeps receiving the window
                 if (!ota->isUpdating()) {
                     uint32_t expected_size = network->getFirmwareExpectedSize();
                     std::string expected_sha = network->getFirmwareExpectedChecksum();
@@ -265,76 +310,250 @@ void AppController::start()
                     ESP_LOGI(TAG, "📦 Beginning OTA: size=%u, sha256=%s", 
                              expected_size, expected_sha.c_str());
 
-                    if (!ota->beginUpdate(expected_size, expected_sha)) {
+                    if (!ota->beginUpdate(expected_size, expected_sha,
+                                          network->getFirmwareChunkSize(), network->getOtaWindow(),
+                                          network->getFirmwareEncoding())) {
                         ESP_LOGE(TAG, "❌ OTA begin failed!");
-                        StateManager::instance().setSystemState(state::SystemState::ERROR);
-                        return;
+                        if (!background)
+                            StateManager::instance().setSystemState(state::SystemState::ERROR);
+                        return OtaChunkStatus::FAILED;
                     }
+                    if (display && !background)
+                        display->showOTAUpdating();
                 }
 
-                // Write chunk to flash
-                int written = ota->writeChunk(data, size);
-                if (written < 0) {
-                    ESP_LOGE(TAG, "❌ OTA write failed, aborting");
-                    ota->abortUpdate();
-                    StateManager::instance().setSystemState(state::SystemState::ERROR);
-                }
+                // Queue chunk for the flash writer (BUSY while a background
+                // update is paused: the server backs off and resends)
+                OtaChunkStatus st = ota->submitChunk(seq, data, size);
+                // Progress only lands in a latest-value slot; the display task draws it
+                if (display && !background && st == OtaChunkStatus::ACCEPTED)
+                    display->setOTAProgress(ota->getProgressPercent());
+                return st;
             });
 
             // ✅ Register complete handler (called when all chunks received)
-            network->onFirmwareComplete([this](bool success, const std::string &msg)
-            {
-                if (success) {
-                    ESP_LOGI(TAG, "✅ OTA transfer complete: %s", msg.c_str());
-                    postEvent(event::AppEvent::OTA_FINISHED);
-                } else {
-                    ESP_LOGE(TAG, "❌ OTA failed: %s", msg.c_str());
-                    StateManager::instance().setSystemState(state::SystemState::ERROR);
-                }
-            });
+            network->onFirmwareComplete(on_complete);
             
             ESP_LOGI(TAG, "✅ OTA handlers registered successfully");
         });
+    }
 
-        // Check battery before starting network
-        auto ps = StateManager::instance().getPowerState();
-        if (ps == state::PowerState::CRITICAL)
-        {
-            ESP_LOGW(TAG, "Skipping NetworkManager start due to critical battery");
-        }
-        else
+    // ============================================================================
+    // 3️⃣ Start modules as a dependency graph (stage timings on the log)
+    // ============================================================================
+    // Power samples the battery first: a CRITICAL reading keeps audio, touch
+    // and network down. Display runs beside it. Network starts in parallel
+    // with audio / touch, or after them on fast resume (Config::defer_network).
+    auto batteryOk = [](const char *what)
+    {
+        if (StateManager::instance().getPowerState() != state::PowerState::CRITICAL)
+            return true;
+        ESP_LOGW(TAG, "Skipping %s start due to critical battery", what);
+        return false;
+    };
+
+    InitGraph graph("start");
+    const int g_power = graph.add("power", {}, 0, [this]()
+    {
+        if (!power)
+            return true;
+        if (!power->init())
         {
-            network->start();
+            ESP_LOGE(TAG, "PowerManager init failed");
+            return true; // the rest still starts (battery state unknown)
         }
-    }
+        power->start();
+        power->sampleNow();
+        return true;
+    });
 
-    // 5️⃣ Start AudioManager
-    if (audio)
+    const int g_display = graph.add("display", {}, 1, [this]()
     {
-        auto ps = StateManager::instance().getPowerState();
-        if (ps == state::PowerState::CRITICAL)
+        if (display && audio)
         {
-            ESP_LOGW(TAG, "Skipping AudioManager start due to critical battery");
+            // I2S glitches slow the animation down before they repeat
+            AudioManager *a = audio.get();
+            display->setAudioGlitchProbe([a]()
+                                         {
+                const AudioManager::GlitchStats g = a->glitchStats();
+                return g.spk_underruns + g.mic_overruns; });
         }
-        else
-        {
+        if (display && !display->isLoopRunning() && !display->startLoop(33))
+            ESP_LOGE(TAG, "DisplayManager startLoop failed");
+        return true;
+    });
+
+    const int g_audio = graph.add("audio", {g_power}, 1, [this, &batteryOk]()
+    {
+        if (audio && batteryOk("AudioManager"))
             audio->start();
-        }
-    }
+        return true;
+    });
 
-    // 6️⃣ Start TouchInput
-    if (touch)
+    const int g_touch = graph.add("touch", {g_power}, 0, [this, &batteryOk]()
     {
-        auto ps = StateManager::instance().getPowerState();
-        if (ps == state::PowerState::CRITICAL)
-        {
-            ESP_LOGW(TAG, "Skipping TouchInput start due to critical battery");
-        }
-        else
-        {
+        if (touch && batteryOk("TouchInput"))
             touch->start();
-        }
-    }
+        return true;
+    });
+
+    // Display, audio and touch are up: the device reacts from here on
+    const int g_ready = graph.add("ready", {g_display, g_audio, g_touch}, tskNO_AFFINITY, []()
+    {
+        ResumeState::instance().markInteractive();
+        return true;
+    });
+
+    auto startNetwork = [this, &batteryOk]()
+    {
+        if (network && batteryOk("NetworkManager"))
+            network->start(); // runs the deferred init on fast resume
+        return true;
+    };
+    if (config_.defer_network)
+        graph.add("network", {g_power, g_ready}, 0, startNetwork);
+    else
+        graph.add("network", {g_power}, 0, startNetwork);
+
+    graph.run();
+    graph.print();
+
+    // 4️⃣ Memory telemetry (status "mem", request_mem, console "mem") and
+    // the boot arena budget (every long-lived buffer is claimed by now)
+    MemTelemetry::instance().start();
+    MemArena::instance().print();
+
+    // 5️⃣ Debug console on the log UART
+    auto &console = SerialConsole::instance();
+    console.registerCommand("lat", "voice-turn latency p50/p95/max ('lat reset' clears)",
+                            [](const std::string &args)
+                            {
+                                if (args == "reset")
+                                    LatencyTrace::instance().clear();
+                                else
+                                    LatencyTrace::instance().print();
+                            });
+    console.registerCommand("mem", "heap, task stack headroom and ring fill ('mem now' samples first)",
+                            [](const std::string &args)
+                            {
+                                if (args == "now")
+                                    MemTelemetry::instance().sample();
+                                MemTelemetry::instance().print();
+                            });
+    console.registerCommand("cpu", "CPU load per task / core since the last 'cpu', probe times ('cpu reset' clears probes)",
+                            [](const std::string &args)
+                            {
+                                auto &prof = Profiler::instance();
+                                if (args == "reset")
+                                {
+                                    prof.clearProbes();
+                                    prof.sampleTasks(); // new load window starts now
+                                    return;
+                                }
+                                prof.sampleTasks();
+                                prof.print();
+                            });
+    console.registerCommand("tasks", "task placement plan (core / prio / stack), I2S glitch and display pacing counters",
+                            [this](const std::string &)
+                            {
+                                TaskPlan::instance().print();
+                                if (audio)
+                                {
+                                    const AudioManager::GlitchStats g = audio->glitchStats();
+                                    ESP_LOGI(TAG, "I2S glitches: speaker underruns %u, mic overruns %u",
+                                             (unsigned)g.spk_underruns, (unsigned)g.mic_overruns);
+                                    ESP_LOGI(TAG, "I2S DMA: speaker %s (%u underflows), mic %s (%u overflows)",
+                                             dmaPresetName(g.spk_dma), (unsigned)g.spk_dma_underflows,
+                                             dmaPresetName(g.mic_dma), (unsigned)g.mic_dma_overflows);
+                                }
+                                if (display)
+                                {
+                                    const DisplayManager::RenderStats r = display->renderStats();
+                                    ESP_LOGI(TAG, "Display: %u frames rendered, %u dropped, %u deferred, %u budget cuts, "
+                                                  "%u glitch backoffs",
+                                             (unsigned)r.frames_rendered, (unsigned)r.frames_dropped,
+                                             (unsigned)r.deferred, (unsigned)r.budget_cuts, (unsigned)r.glitch_backoffs);
+                                }
+                            });
+    console.registerCommand("earcon", "play a local cue (listen_start, listen_end, error, low_battery); 'earcon on/off'",
+                            [this](const std::string &args)
+                            {
+                                if (!audio)
+                                    return;
+                                if (args == "on" || args == "off")
+                                {
+                                    audio->setEarconsEnabled(args == "on");
+                                    ESP_LOGI(TAG, "Earcons %s", args.c_str());
+                                    return;
+                                }
+                                const Earcon cue = EarconPlayer::fromName(args.c_str());
+                                if (cue == Earcon::COUNT)
+                                {
+                                    ESP_LOGW(TAG, "Unknown earcon '%s'", args.c_str());
+                                    return;
+                                }
+                                audio->playEarcon(cue);
+                            });
+    console.registerCommand("arena", "boot arena budget: regions, blocks, heap fallbacks",
+                            [](const std::string &)
+                            { MemArena::instance().print(); });
+    console.registerCommand("packs", "cached animation packs: slots, uses, mapped, fetch / preload counters",
+                            [](const std::string &)
+                            { AnimPackCache::instance().print(); });
+    console.registerCommand("boot", "wake cause, RTC-retained state and boot-to-interactive time",
+                            [](const std::string &)
+                            { ResumeState::instance().print(); });
+    console.registerCommand("cfg", "cached user settings, pending writes and NVS commit counters ('cfg flush' writes now)",
+                            [](const std::string &args)
+                            {
+                                if (args == "flush")
+                                    ConfigStore::instance().flush();
+                                ConfigStore::instance().print();
+                            });
+    console.registerCommand("evlog", "crash / perf event log: counters and newest records ('evlog flush' writes now)",
+                            [](const std::string &args)
+                            {
+                                if (args == "flush")
+                                    EventLog::instance().flush();
+                                EventLog::instance().print();
+                            });
+    console.registerCommand("slo", "audio pipeline health: per-stage timing, underruns, stalls, SLO state ('slo reset')",
+                            [](const std::string &args)
+                            {
+                                if (args == "reset")
+                                    AudioHealth::instance().reset();
+                                AudioHealth::instance().print();
+                            });
+    console.registerCommand("link", "Wi-Fi link quality: RSSI, ping RTT / loss, modem sleep depth, roams ('link roam' searches now)",
+                            [this](const std::string &args)
+                            {
+                                if (!network)
+                                    return;
+                                if (args == "roam")
+                                    network->requestRoam();
+                                network->printLink();
+                            });
+    console.registerCommand("media", "media playback: state, buffer, counters ('media play <url>' / pause / resume / stop / seek <ms>)",
+                            [](const std::string &args)
+                            {
+                                MediaPlayer &player = MediaPlayer::instance();
+                                if (args.rfind("play ", 0) == 0)
+                                {
+                                    MediaRequest req;
+                                    req.url = args.substr(5);
+                                    player.play(req);
+                                }
+                                else if (args == "pause")
+                                    player.pause();
+                                else if (args == "resume")
+                                    player.resume();
+                                else if (args == "stop")
+                                    player.stop();
+                                else if (args.rfind("seek ", 0) == 0)
+                                    player.seek(static_cast<uint32_t>(strtoul(args.c_str() + 5, nullptr, 10)));
+                                player.print();
+                            });
+    console.start();
 
     ESP_LOGI(TAG, "AppController started");
 }
@@ -349,6 +568,9 @@ void AppController::stop()
     // Startup: PowerManager → DisplayManager → NetworkManager → AudioManager
     // Shutdown: AudioManager → NetworkManager → DisplayManager → PowerManager
 
+    SerialConsole::instance().stop();
+    MemTelemetry::instance().stop();
+
     if (network)
     {
         network->stopPortal();
@@ -358,6 +580,7 @@ void AppController::stop()
 
     if (audio)
     {
+        MediaPlayer::instance().stop();
         audio->stop();
         ESP_LOGD(TAG, "AudioManager stopped");
     }
@@ -374,7 +597,9 @@ void AppController::stop()
         ESP_LOGD(TAG, "PowerManager stopped");
     }
 
-    // Wait for controllerTask to exit
+    // Wait for controllerTask to exit (it sleeps on its notification)
+    if (app_task)
+        xTaskNotifyGive(app_task);
     vTaskDelay(pdMS_TO_TICKS(100));
     if (app_task)
     {
@@ -404,6 +629,20 @@ void AppController::enterSleep()
 
     ESP_LOGI(TAG, "Entering deep sleep due to critical battery");
 
+    retainResumeState();
+    // Pending setting changes (deep sleep skips the esp_restart() shutdown hook)
+    ConfigStore::instance().flush();
+    EventLog::instance().flush();
+    // Background OTA already written: the wake-up boots the new image
+    if (ota_apply_pending_.exchange(false) && ota && ota->isUpdating())
+    {
+        ota->setPaused(false);
+        if (ota->finishUpdate())
+            ESP_LOGI(TAG, "OTA image applied, active after wake-up");
+        else
+            ESP_LOGE(TAG, "OTA finishUpdate failed before sleep");
+    }
+
     // Stop all modules before deep sleep
     if (network)
     {
@@ -423,6 +662,12 @@ void AppController::enterSleep()
         display->setBacklight(false);
     }
 
+    // Touch pin wakes the device as well (if it is an RTC GPIO)
+    if (touch)
+    {
+        touch->enableDeepSleepWake();
+    }
+
     // Wake up periodically to check battery
     const uint64_t wakeup_time_us = static_cast<uint64_t>(config_.deep_sleep_wakeup_sec) * 1000000ULL;
     esp_sleep_enable_timer_wakeup(wakeup_time_us);
@@ -431,6 +676,23 @@ void AppController::enterSleep()
     esp_deep_sleep_start(); // DOES NOT RETURN
 }
 
+// What the next wake-up restores without a cold boot. Taken once, before
+// the modules stop (connectivity drops to OFFLINE with the network).
+void AppController::retainResumeState()
+{
+    if (resume_retained)
+        return;
+    resume_retained = true;
+
+    ResumeState::Snapshot snap{};
+    if (audio)
+        snap.volume = audio->getVolume();
+    if (display)
+        snap.brightness = display->getBrightness();
+    snap.connectivity = StateManager::instance().getConnectivityState();
+    ResumeState::instance().retain(snap);
+}
+
 void AppController::wake()
 {
     ESP_LOGI(TAG, "Wake requested");
@@ -455,13 +717,81 @@ void AppController::setConfig(const Config &cfg)
 
 void AppController::postEvent(event::AppEvent evt)
 {
-    if (!app_queue)
-        return;
-
     AppMessage msg{};
     msg.type = AppMessage::Type::APP_EVENT;
     msg.app_event = evt;
-    xQueueSend(app_queue, &msg, 0);
+
+    switch (evt)
+    {
+    // User input and cancel: must not wait behind housekeeping
+    case event::AppEvent::USER_BUTTON:
+    case event::AppEvent::RELEASE_BUTTON:
+    case event::AppEvent::WAKEWORD_DETECTED:
+    case event::AppEvent::SERVER_FORCE_LISTEN:
+    case event::AppEvent::END_OF_SPEECH:
+    case event::AppEvent::BARGE_IN:
+    case event::AppEvent::VOICE_VOLUME_UP:
+    case event::AppEvent::VOICE_VOLUME_DOWN:
+    case event::AppEvent::VOICE_CANCEL:
+    case event::AppEvent::VOICE_SLEEP:
+        postMessage(Lane::HIGH, msg);
+        break;
+    // Idempotent: one pending copy is enough
+    case event::AppEvent::BATTERY_PERCENT_CHANGED:
+        postCoalesced(COALESCE_BATTERY);
+        break;
+    default:
+        postMessage(Lane::NORMAL, msg);
+        break;
+    }
+}
+
+void AppController::postMessage(Lane lane, const AppMessage &msg)
+{
+    QueueHandle_t q = lane == Lane::HIGH ? high_queue : normal_queue;
+    if (!q)
+        return;
+
+    if (xQueueSend(q, &msg, 0) != pdTRUE)
+    {
+        auto &dropped = lane == Lane::HIGH ? high_dropped : normal_dropped;
+        uint32_t n = dropped.fetch_add(1, std::memory_order_relaxed) + 1;
+        ESP_LOGW(TAG, "%s lane full, message type %u dropped (total %u)",
+                 lane == Lane::HIGH ? "High" : "Normal", (unsigned)msg.type, (unsigned)n);
+        return;
+    }
+
+    auto &peak = lane == Lane::HIGH ? high_peak : normal_peak;
+    uint8_t depth = static_cast<uint8_t>(uxQueueMessagesWaiting(q));
+    if (depth > peak.load(std::memory_order_relaxed))
+        peak.store(depth, std::memory_order_relaxed);
+
+    TaskHandle_t t = app_task;
+    if (t)
+        xTaskNotifyGive(t);
+}
+
+void AppController::postCoalesced(uint32_t bit)
+{
+    if (coalesced_pending.fetch_or(bit, std::memory_order_acq_rel) & bit)
+    {
+        coalesced_count.fetch_add(1, std::memory_order_relaxed);
+        return; // merged into the pending one, task already notified
+    }
+    TaskHandle_t t = app_task;
+    if (t)
+        xTaskNotifyGive(t);
+}
+
+AppController::QueueStats AppController::queueStats() const
+{
+    QueueStats st;
+    st.high_dropped = high_dropped.load(std::memory_order_relaxed);
+    st.normal_dropped = normal_dropped.load(std::memory_order_relaxed);
+    st.coalesced = coalesced_count.load(std::memory_order_relaxed);
+    st.high_peak = high_peak.load(std::memory_order_relaxed);
+    st.normal_peak = normal_peak.load(std::memory_order_relaxed);
+    return st;
 }
 
 // ===================== Task & Queue loop =====================
@@ -475,172 +805,347 @@ void AppController::controllerTask(void *param)
 void AppController::processQueue()
 {
     ESP_LOGI(TAG, "AppController task started");
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::CONTROLLER));
 
-    AppMessage msg{};
     while (started.load())
     {
-        if (xQueueReceive(app_queue, &msg, portMAX_DELAY) == pdTRUE)
+        if (!dispatchOne())
+        {
+            // Posts after the empty check leave the notification pending
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
+    }
+
+    ESP_LOGW(TAG, "AppController task stopping");
+    MemTelemetry::instance().unregisterTask();
+    vTaskDelete(nullptr);
+}
+
+// High lane is re-checked before every message, so a button press waits for
+// at most the one handler already running.
+bool AppController::dispatchOne()
+{
+    AppMessage msg{};
+    if (high_queue && xQueueReceive(high_queue, &msg, 0) == pdTRUE)
+    {
+        handleMessage(msg);
+        return true;
+    }
+
+    uint32_t bits = coalesced_pending.exchange(0, std::memory_order_acq_rel);
+    if (bits)
+    {
+        if (bits & COALESCE_POWER)
+        {
+            msg.type = AppMessage::Type::POWER;
+            msg.power_state = pending_power.load(std::memory_order_relaxed);
+            handleMessage(msg);
+        }
+        if (bits & COALESCE_BATTERY)
+        {
+            msg.type = AppMessage::Type::APP_EVENT;
+            msg.app_event = event::AppEvent::BATTERY_PERCENT_CHANGED;
+            handleMessage(msg);
+        }
+        return true;
+    }
+
+    if (normal_queue && xQueueReceive(normal_queue, &msg, 0) == pdTRUE)
+    {
+        handleMessage(msg);
+        return true;
+    }
+    return false;
+}
+
+void AppController::handleMessage(const AppMessage &msg)
+{
+    switch (msg.type)
+    {
+    case AppMessage::Type::INTERACTION:
+        onInteractionStateChanged(msg.interaction_state, msg.interaction_source);
+        break;
+    case AppMessage::Type::CONNECTIVITY:
+        onConnectivityStateChanged(msg.connectivity_state);
+        break;
+    case AppMessage::Type::SYSTEM:
+        onSystemStateChanged(msg.system_state);
+        break;
+    case AppMessage::Type::POWER:
+        onPowerStateChanged(msg.power_state);
+        break;
+    case AppMessage::Type::APP_EVENT:
+        // Map AppEvent → state hoặc action
+        switch (msg.app_event)
         {
-            switch (msg.type)
+        case event::AppEvent::USER_BUTTON:
+            // check ws is online
+            if (network)
             {
-            case AppMessage::Type::INTERACTION:
-                onInteractionStateChanged(msg.interaction_state, msg.interaction_source);
-                break;
-            case AppMessage::Type::CONNECTIVITY:
-                onConnectivityStateChanged(msg.connectivity_state);
-                break;
-            case AppMessage::Type::SYSTEM:
-                onSystemStateChanged(msg.system_state);
-                break;
-            case AppMessage::Type::POWER:
-                onPowerStateChanged(msg.power_state);
-                break;
-            case AppMessage::Type::APP_EVENT:
-                // Map AppEvent → state hoặc action
-                switch (msg.app_event)
+                auto conn_state = StateManager::instance().getConnectivityState();
+                if (conn_state != state::ConnectivityState::ONLINE)
                 {
-                case event::AppEvent::USER_BUTTON:
-                    // check ws is online
-                    if (network)
-                    {
-                        auto conn_state = StateManager::instance().getConnectivityState();
-                        if (conn_state != state::ConnectivityState::ONLINE)
-                        {
-                            ESP_LOGW(TAG, "Ignoring button press - not online");
-                            break;
-                        }
-                    }
-                    ESP_LOGI(TAG, "Button Pressed -> Start Listening");
-                    // Interrupt any ongoing speaker output
-                    if (audio && StateManager::instance().getInteractionState() == state::InteractionState::SPEAKING)
-                    {
-                        ESP_LOGI(TAG, "Interrupting speaker for button press");
-                        audio->stopSpeaking();
-                    }
-                    // Chuyển thẳng sang LISTENING (hoặc TRIGGERED nếu muốn có tiếng Beep trước)
-                    StateManager::instance().setInteractionState(
-                        state::InteractionState::LISTENING,
-                        state::InputSource::BUTTON);
-                    break;
-                case event::AppEvent::WAKEWORD_DETECTED:
-                    StateManager::instance().setInteractionState(
-                        state::InteractionState::TRIGGERED,
-                        state::InputSource::WAKEWORD);
+                    ESP_LOGW(TAG, "Ignoring button press - not online");
                     break;
-                case event::AppEvent::SERVER_FORCE_LISTEN:
-                    StateManager::instance().setInteractionState(
-                        state::InteractionState::TRIGGERED,
-                        state::InputSource::SERVER_COMMAND);
-                    break;
-                case event::AppEvent::SLEEP_REQUEST:
-                    enterSleep();
-                    break;
-                case event::AppEvent::CONFIG_DONE_RESTART:
-                    ESP_LOGI(TAG, "Configuration done - restarting system");
-                    if (display)
-                    {
-                        display->playText("Config done. Restarting...", -1, -1, 0xFFFF, 1.5); // centered, white text
-                        vTaskDelay(pdMS_TO_TICKS(2000));
-                    }
+                }
+            }
+            ESP_LOGI(TAG, "Button Pressed -> Start Listening");
+            // Interrupt any ongoing speaker output
+            if (audio && StateManager::instance().getInteractionState() == state::InteractionState::SPEAKING)
+            {
+                ESP_LOGI(TAG, "Interrupting speaker for button press");
+                audio->stopSpeaking();
+            }
+            // Chuyển thẳng sang LISTENING (hoặc TRIGGERED nếu muốn có tiếng Beep trước)
+            StateManager::instance().setInteractionState(
+                state::InteractionState::LISTENING,
+                state::InputSource::BUTTON);
+            break;
+        case event::AppEvent::WAKEWORD_DETECTED:
+            if (network && StateManager::instance().getConnectivityState() != state::ConnectivityState::ONLINE)
+            {
+                ESP_LOGW(TAG, "Ignoring wake word - not online");
+                break;
+            }
+            // Only start a turn from IDLE (late detections after a button press are dropped)
+            if (StateManager::instance().getInteractionState() != state::InteractionState::IDLE)
+                break;
+            ESP_LOGI(TAG, "Wake word -> Start Listening");
+            StateManager::instance().setInteractionState(
+                state::InteractionState::TRIGGERED,
+                state::InputSource::WAKEWORD);
+            break;
+        case event::AppEvent::SERVER_FORCE_LISTEN:
+            StateManager::instance().setInteractionState(
+                state::InteractionState::TRIGGERED,
+                state::InputSource::SERVER_COMMAND);
+            break;
+        case event::AppEvent::SLEEP_REQUEST:
+            enterSleep();
+            break;
+        case event::AppEvent::CONFIG_DONE_RESTART:
+            ESP_LOGI(TAG, "Configuration done - restarting system");
+            // Settings are committed: radio off now, not after the notice
+            if (network)
+                network->stopBLEConfigMode();
+            if (display)
+            {
+                display->playText("Config done. Restarting...", -1, -1, 0xFFFF, 1.5); // centered, white text
+                vTaskDelay(pdMS_TO_TICKS(2000));
+            }
 
-                    esp_restart();
-                    break;
+            esp_restart();
+            break;
 
-                case event::AppEvent::WAKE_REQUEST:
-                    wake();
-                    break;
-                case event::AppEvent::RELEASE_BUTTON:
-                    if (network)
-                    {
-                        auto conn_state = StateManager::instance().getConnectivityState();
-                        if (conn_state != state::ConnectivityState::ONLINE)
-                        {
-                            ESP_LOGW(TAG, "Ignoring button release - not online");
-                            break;
-                        }
-                    }
-                    StateManager::instance().setInteractionState(
-                        state::InteractionState::IDLE,
-                        state::InputSource::BUTTON);
-                    break;
-                case event::AppEvent::BATTERY_PERCENT_CHANGED:
-                    // ✅ Removed: DisplayManager.update() queries power directly
-                    break;
-                 case event::AppEvent::OTA_BEGIN:
-                //     // ✅ Only set state; DisplayManager subscribes and handles UI
-                //     StateManager::instance().setSystemState(state::SystemState::UPDATING_FIRMWARE);
-
-                //     if (network)
-                //     {
-                //         // Request firmware from server
-                //         network->onFirmwareChunk([this](const uint8_t *data, size_t size)
-                //                                  {
-                //                     if (!ota) return;
-
-                //                     if (!ota->isUpdating()) {
-                //                         uint32_t expected_size = network->getFirmwareExpectedSize();
-                //                         std::string expected_sha = network->getFirmwareExpectedChecksum();
-
-                //                         if (!ota->beginUpdate(expected_size, expected_sha)) {
-                //                             ESP_LOGE(TAG, "OTA begin failed (size=%u)", expected_size);
-                //                             StateManager::instance().setSystemState(state::SystemState::ERROR);
-                //                             return;
-                //                         }
-                //                     }
-
-                //                     int written = ota->writeChunk(data, size);
-                //                     if (written < 0) {
-                //                         ESP_LOGE(TAG, "OTA write failed, aborting");
-                //                         ota->abortUpdate();
-                //                         StateManager::instance().setSystemState(state::SystemState::ERROR);
-                //                     }
-                //                     });
-
-                //         network->onFirmwareComplete([this](bool success, const std::string &msg)
-                //                                     {
-                //                     if (success) {
-                //                         postEvent(event::AppEvent::OTA_FINISHED);
-                //                     } else {
-                //                         StateManager::instance().setSystemState(state::SystemState::ERROR);
-                //                     } });
-
-                //         if (!network->requestFirmwareUpdate())
-                //         {
-                //             StateManager::instance().setSystemState(state::SystemState::ERROR);
-                //         }
-                //     }
-                   break;
-                case event::AppEvent::OTA_FINISHED:
-                    if (ota && ota->isUpdating())
-                    {
-                        if (ota->finishUpdate())
-                        {
-                            // OTA success - reboot immediately
-                            // Skip display update to avoid SPI conflict after flash operations
-                            ESP_LOGI(TAG, "✅ OTA completed successfully! Rebooting in 1 second...");
-                            vTaskDelay(pdMS_TO_TICKS(1000));
-                            reboot();
-                        }
-                        else
-                        {
-                            ESP_LOGE(TAG, "OTA finishUpdate failed");
-                            StateManager::instance().setSystemState(state::SystemState::ERROR);
-                        }
-                    }
-                    else
-                    {
-                        ESP_LOGW(TAG, "OTA_FINISHED but no update in progress");
-                        StateManager::instance().setSystemState(state::SystemState::ERROR);
-                    }
+        case event::AppEvent::WAKE_REQUEST:
+            wake();
+            break;
+        case event::AppEvent::RELEASE_BUTTON:
+            if (network)
+            {
+                auto conn_state = StateManager::instance().getConnectivityState();
+                if (conn_state != state::ConnectivityState::ONLINE)
+                {
+                    ESP_LOGW(TAG, "Ignoring button release - not online");
                     break;
                 }
+            }
+            // VAD already ended the turn: the release must not cancel the request
+            if (StateManager::instance().getInteractionState() == state::InteractionState::PROCESSING &&
+                StateManager::instance().getInteractionSource() == state::InputSource::VAD)
+            {
+                ESP_LOGI(TAG, "Button release after VAD endpoint - ignored");
                 break;
             }
+            StateManager::instance().setInteractionState(
+                state::InteractionState::IDLE,
+                state::InputSource::BUTTON);
+            break;
+        case event::AppEvent::END_OF_SPEECH:
+            // Only a live turn can be endpointed (late events after a release are dropped)
+            if (StateManager::instance().getInteractionState() != state::InteractionState::LISTENING)
+                break;
+            ESP_LOGI(TAG, "End of speech -> Processing");
+            StateManager::instance().setInteractionState(
+                state::InteractionState::PROCESSING,
+                state::InputSource::VAD);
+            break;
+        case event::AppEvent::BARGE_IN:
+            // Mic is already open and echo-cancelled: go straight to LISTENING,
+            // AudioManager stops playback and keeps the captured onset
+            if (StateManager::instance().getInteractionState() != state::InteractionState::SPEAKING)
+                break;
+            ESP_LOGI(TAG, "Barge-in -> Start Listening");
+            StateManager::instance().setInteractionState(
+                state::InteractionState::LISTENING,
+                state::InputSource::VAD);
+            break;
+        case event::AppEvent::VOICE_VOLUME_UP:
+        case event::AppEvent::VOICE_VOLUME_DOWN:
+        case event::AppEvent::VOICE_CANCEL:
+        case event::AppEvent::VOICE_SLEEP:
+            handleVoiceCommand(msg.app_event);
+            break;
+        case event::AppEvent::BATTERY_PERCENT_CHANGED:
+            // ✅ Removed: DisplayManager.update() queries power directly
+            break;
+         case event::AppEvent::OTA_BEGIN:
+        //     // ✅ Only set state; DisplayManager subscribes and handles UI
+        //     StateManager::instance().setSystemState(state::SystemState::UPDATING_FIRMWARE);
+
+        //     if (network)
+        //     {
+        //         // Request firmware from server
+        //         network->onFirmwareChunk([this](const uint8_t *data, size_t size)
+        //                                  {
+        //                     if (!ota) return;
+
+        //                     if (!ota->isUpdating()) {
+        //                         uint32_t expected_size = network->getFirmwareExpectedSize();
+        //                         std::string expected_sha = network->getFirmwareExpectedChecksum();
+
+        //                         if (!ota->beginUpdate(expected_size, expected_sha)) {
+        //                             ESP_LOGE(TAG, "OTA begin failed (size=%u)", expected_size);
+        //                             StateManager::instance().setSystemState(state::SystemState::ERROR);
+        //                             return;
+        //                         }
+        //                     }
+
+        //                     int written = ota->writeChunk(data, size);
+        //                     if (written < 0) {
+        //                         ESP_LOGE(TAG, "OTA write failed, aborting");
+        //                         ota->abortUpdate();
+        //                         StateManager::instance().setSystemState(state::SystemState::ERROR);
+        //                     }
+        //                     });
+
+        //         network->onFirmwareComplete([this](bool success, const std::string &msg)
+        //                                     {
+        //                     if (success) {
+        //                         postEvent(event::AppEvent::OTA_FINISHED);
+        //                     } else {
+        //                         StateManager::instance().setSystemState(state::SystemState::ERROR);
+        //                     } });
+
+        //         if (!network->requestFirmwareUpdate())
+        //         {
+        //             StateManager::instance().setSystemState(state::SystemState::ERROR);
+        //         }
+        //     }
+           break;
+        case event::AppEvent::OTA_FINISHED:
+            if (ota_background_ && ota && ota->isUpdating())
+            {
+                // Image written; reboot only once the device has been idle a while
+                ESP_LOGI(TAG, "Background OTA written, applying at the next idle/sleep boundary");
+                ota_apply_pending_ = true;
+                if (StateManager::instance().getInteractionState() == state::InteractionState::IDLE)
+                    armOtaApply();
+                break;
+            }
+            applyOta();
+            break;
+        case event::AppEvent::OTA_APPLY:
+            // Timer raced a new turn: onInteractionStateChanged re-arms it at IDLE
+            if (!ota_apply_pending_ ||
+                StateManager::instance().getInteractionState() != state::InteractionState::IDLE)
+                break;
+            ota_apply_pending_ = false;
+            ota_background_ = false;
+            if (ota)
+                ota->setPaused(false);
+            applyOta();
+            break;
         }
+        break;
     }
+}
 
-    ESP_LOGW(TAG, "AppController task stopping");
-    vTaskDelete(nullptr);
+void AppController::applyOta()
+{
+    if (ota && ota->isUpdating())
+    {
+        if (ota->finishUpdate())
+        {
+            // OTA success - reboot immediately. The screen is
+            // queued to the display task, so no SPI from here.
+            ESP_LOGI(TAG, "✅ OTA completed successfully! Rebooting in 1 second...");
+            if (display)
+                display->showRebooting();
+            vTaskDelay(pdMS_TO_TICKS(1000));
+            reboot();
+        }
+        else
+        {
+            ESP_LOGE(TAG, "OTA finishUpdate failed");
+            StateManager::instance().setSystemState(state::SystemState::ERROR);
+        }
+    }
+    else
+    {
+        ESP_LOGW(TAG, "OTA_FINISHED but no update in progress");
+        StateManager::instance().setSystemState(state::SystemState::ERROR);
+    }
+}
+
+void AppController::armOtaApply()
+{
+    if (!ota_apply_timer_)
+    {
+        esp_timer_create_args_t args{};
+        args.callback = [](void *)
+        { AppController::instance().postEvent(event::AppEvent::OTA_APPLY); };
+        args.name = "ota_apply";
+        if (esp_timer_create(&args, &ota_apply_timer_) != ESP_OK)
+        {
+            // No countdown: the image still goes in at the next deep sleep
+            ESP_LOGW(TAG, "ota_apply timer create failed");
+            ota_apply_timer_ = nullptr;
+            return;
+        }
+    }
+    esp_timer_stop(ota_apply_timer_); // restart the countdown
+    esp_timer_start_once(ota_apply_timer_, static_cast<uint64_t>(config_.ota_apply_idle_ms) * 1000ULL);
+}
+
+// Local intents: no ASR / NLU round trip. The turn is cancelled (CANCELLING →
+// the uplink marks the utterance FLAG_CANCEL so the server drops it), then
+// the action runs here.
+void AppController::handleVoiceCommand(event::AppEvent evt)
+{
+    auto &sm = StateManager::instance();
+    // Only the turn the command was heard in (late events after an endpoint are dropped)
+    if (sm.getInteractionState() != state::InteractionState::LISTENING)
+        return;
+    sm.setInteractionState(state::InteractionState::CANCELLING, state::InputSource::LOCAL_COMMAND);
+
+    switch (evt)
+    {
+    case event::AppEvent::VOICE_VOLUME_UP:
+    case event::AppEvent::VOICE_VOLUME_DOWN:
+    {
+        if (!audio)
+            break;
+        static constexpr int VOLUME_STEP = 15;
+        const int step = evt == event::AppEvent::VOICE_VOLUME_UP ? VOLUME_STEP : -VOLUME_STEP;
+        const uint8_t v = static_cast<uint8_t>(std::clamp(audio->getVolume() + step, 0, 100));
+        ESP_LOGI(TAG, "Voice command -> volume %u%%", (unsigned)v);
+        // Same path as SET_AUDIO_VOLUME: applied, saved, reported on MQTT
+        if (network)
+            network->applyVolumeConfig(v);
+        else
+            audio->setVolume(v);
+        break;
+    }
+    case event::AppEvent::VOICE_SLEEP:
+        ESP_LOGI(TAG, "Voice command -> sleep");
+        enterSleep();
+        break;
+    case event::AppEvent::VOICE_CANCEL:
+    default:
+        ESP_LOGI(TAG, "Voice command -> cancel");
+        break;
+    }
 }
 
 // NetworkManager now owns its own update task
@@ -663,6 +1168,20 @@ void AppController::onInteractionStateChanged(state::InteractionState s, state::
 
     auto &sm = StateManager::instance();
 
+    // Background OTA yields the radio and flash to the conversation
+    if (ota_background_ && ota)
+    {
+        const bool idle = s == state::InteractionState::IDLE;
+        ota->setPaused(!idle);
+        if (ota_apply_pending_)
+        {
+            if (idle)
+                armOtaApply();
+            else if (ota_apply_timer_)
+                esp_timer_stop(ota_apply_timer_);
+        }
+    }
+
     // DisplayManager subscribes InteractionState directly and handles UI
     // AppController handles only control logic (audio/device commands)
 
@@ -728,6 +1247,7 @@ void AppController::onConnectivityStateChanged(state::ConnectivityState s)
         // 1. Dừng Task và Xóa các StreamBuffer Audio (Giải phóng 72KB RAM)
         if (audio)
         {
+            MediaPlayer::instance().stop(); // its ring goes with freeResources()
             audio->stop();
             audio->freeResources(); // Bạn cần viết hàm này để delete StreamBuffers
         }
@@ -843,6 +1363,7 @@ void AppController::onPowerStateChanged(state::PowerState s)
         //     break;
 
     case state::PowerState::CRITICAL:
+        retainResumeState();
         if (audio)
         {
             audio->stop();
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <cstdint>
 #include "esp_sleep.h"
+#include "esp_timer.h"
 #include "system/StateManager.hpp"
 #include "system/StateTypes.hpp"
 #include "freertos/FreeRTOS.h"
@@ -23,10 +24,19 @@ namespace event
         RELEASE_BUTTON,          // User requests to cancel current interaction
         SLEEP_REQUEST,           // Request to enter sleep mode
         CONFIG_DONE_RESTART,     // Configuration done, request restart
-        WAKE_REQUEST             // Request to wake from sleep mode
+        WAKE_REQUEST,            // Request to wake from sleep mode
+        END_OF_SPEECH,           // VAD endpoint: user stopped talking
+        BARGE_IN,                // User talked over playback (full duplex)
+        VOICE_VOLUME_UP,         // On-device voice commands (CommandRecognizer):
+        VOICE_VOLUME_DOWN,       //   handled locally, the turn is cancelled
+        VOICE_CANCEL,
+        VOICE_SLEEP,
+        OTA_APPLY                // Background OTA: idle long enough, flash + reboot
     };
 }
 
+struct AppMessage;    // controller queue entry (AppController.cpp)
+
 class NetworkManager; // WiFi + WebSocket
 class AudioManager;   // Mic / Speaker
 class DisplayManager; // UI / Animation
@@ -42,6 +52,14 @@ class AppController {
 public:
     struct Config {
         uint32_t deep_sleep_wakeup_sec = 30; // interval to re-check battery while in deep sleep
+        // Fast resume: Wi-Fi / WS / MQTT come up only once display, audio and
+        // touch are running (NetworkManager::deferInit)
+        bool defer_network = false;
+        // Background OTA (REQUEST_OTA "background":true): download only while
+        // IDLE, at most this many bytes/s; the new image is applied after
+        // ota_apply_idle_ms of IDLE, or at the next deep sleep
+        uint32_t ota_background_rate = 32 * 1024;
+        uint32_t ota_apply_idle_ms = 30000;
     };
 
     // Singleton accessor
@@ -51,7 +69,9 @@ public:
     // Initialize controller: create queue and subscribe to StateManager; call before start().
     bool init();
 
-    // Start controller task then dependent managers (Power → Display → Network → Audio → Touch).
+    // Start controller task, then the managers as a dependency graph: Power ∥ Display,
+    // Audio / Touch / Network after Power (Network after Audio + Touch + Display
+    // with Config::defer_network).
     void start();
 
     // Stop controller and all managers in reverse order; safe to call multiple times.
@@ -67,9 +87,24 @@ public:
     void setConfig(const Config& cfg);
 
     // ======= Post application-level event to queue =======
-    // Post an application event to the internal queue.
+    // Post an application event to the internal queue. Never blocks: user
+    // input/cancel go to the high-priority lane, BATTERY_PERCENT_CHANGED is
+    // merged while pending, everything else is FIFO in the normal lane.
     void postEvent(event::AppEvent evt);
 
+    static constexpr UBaseType_t HIGH_DEPTH = 8;    // user input / cancel / interaction
+    static constexpr UBaseType_t NORMAL_DEPTH = 16; // everything else, FIFO
+
+    // Dispatcher counters (status JSON / diagnostics)
+    struct QueueStats {
+        uint32_t high_dropped = 0;   // high lane full
+        uint32_t normal_dropped = 0; // normal lane full
+        uint32_t coalesced = 0;      // posts merged into a pending one
+        uint8_t high_peak = 0;       // max depth seen
+        uint8_t normal_peak = 0;
+    };
+    QueueStats queueStats() const;
+
     // ======= Dependency injection =======
     // Attach owned module instances before init/start.
     void attachModules(std::unique_ptr<DisplayManager> displayIn,
@@ -95,17 +130,38 @@ private:
     // ✅ Guard to prevent enterSleep() re-entrance
     std::atomic<bool> sleeping{false};
 
+    // Snapshot for ResumeState before deep sleep (once)
+    void retainResumeState();
+    bool resume_retained = false;
+
     // ======= Task Loop =======
     // Controller Task
     static void controllerTask(void *param);
     void processQueue();
+    // Dispatch one pending message, high lane first; false if all empty.
+    bool dispatchOne();
+    void handleMessage(const AppMessage &msg);
+
+    // Queue into a lane and wake the controller task
+    enum class Lane : uint8_t { HIGH, NORMAL };
+    void postMessage(Lane lane, const AppMessage &msg);
+    // Latest-value slots: set the pending bit, merge if already set
+    void postCoalesced(uint32_t bit);
 
     // ======= State callbacks =======
     void onInteractionStateChanged(state::InteractionState, state::InputSource);
+    // Local intent heard at the start of a LISTENING turn
+    void handleVoiceCommand(event::AppEvent evt);
     void onConnectivityStateChanged(state::ConnectivityState);
     void onSystemStateChanged(state::SystemState);
     void onPowerStateChanged(state::PowerState);
 
+    // ======= OTA =======
+    // Flash the finished image and reboot (OTA_FINISHED, OTA_APPLY)
+    void applyOta();
+    // (Re)start the idle countdown to OTA_APPLY
+    void armOtaApply();
+
 private:
     // ======= Subscription ID =======
     int sub_inter_id = -1;
@@ -122,12 +178,32 @@ private:
     std::unique_ptr<OTAUpdater> ota;
     std::unique_ptr<TouchInput> touch;
 
-    // ======= Task & Queue =======
-    QueueHandle_t app_queue = nullptr;
+    // ======= Task & Queues =======
+    // Static storage (no allocation per event). The task sleeps on its
+    // notification; every post gives one.
+    static constexpr uint32_t COALESCE_BATTERY = 1u << 0;
+    static constexpr uint32_t COALESCE_POWER = 1u << 1;
+
+    QueueHandle_t high_queue = nullptr;
+    QueueHandle_t normal_queue = nullptr;
     TaskHandle_t app_task = nullptr;
 
+    std::atomic<uint32_t> coalesced_pending{0};     // COALESCE_* bits
+    std::atomic<state::PowerState> pending_power{state::PowerState::NORMAL};
+
+    std::atomic<uint32_t> high_dropped{0};
+    std::atomic<uint32_t> normal_dropped{0};
+    std::atomic<uint32_t> coalesced_count{0};
+    std::atomic<uint8_t> high_peak{0};
+    std::atomic<uint8_t> normal_peak{0};
+
     // ======= Internal state =======
     std::atomic<bool> started{false};
 
+    // Background OTA: paused outside IDLE, applied at an idle/sleep boundary
+    std::atomic<bool> ota_background_{false};
+    std::atomic<bool> ota_apply_pending_{false}; // image written, waiting for idle
+    esp_timer_handle_t ota_apply_timer_ = nullptr;
+
     Config config_{};
 };
@@ -0,0 +1,152 @@
+#pragma once
+// Generated by scripts/convert_assets.py registry - do not edit.
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "system/StateTypes.hpp"
+#include "emotions/emotion_types.hpp"
+#include "icons/battery_charge.hpp"
+#include "icons/battery_full.hpp"
+#include "icons/critical_power.hpp"
+
+// Emotions compiled into the app image. Build with -DPTALK_BUILTIN_EMOTIONS=0
+// to ship them only in the "assets" partition (AssetBundle).
+#ifndef PTALK_BUILTIN_EMOTIONS
+#define PTALK_BUILTIN_EMOTIONS 1
+#endif
+#if PTALK_BUILTIN_EMOTIONS
+#include "emotions/neutral.hpp"
+#include "emotions/idle.hpp"
+#include "emotions/listening.hpp"
+#include "emotions/happy.hpp"
+#include "emotions/sad.hpp"
+#include "emotions/thinking.hpp"
+#include "emotions/stun.hpp"
+#endif
+
+namespace asset
+{
+    enum class AnimId : uint8_t
+    {
+        NEUTRAL,
+        IDLE,
+        LISTENING,
+        HAPPY,
+        SAD,
+        THINKING,
+        STUN,
+        SPEAKING,
+        ERROR,
+        MAINTENANCE,
+        RESET,
+        ANGRY,
+        CONFUSED,
+        EXCITED,
+        CALM,
+        COUNT,
+        NONE = 0xFF
+    };
+    inline constexpr size_t ANIM_COUNT = static_cast<size_t>(AnimId::COUNT);
+
+    inline constexpr std::string_view ANIM_NAMES[ANIM_COUNT] = {
+        "neutral", "idle", "listening", "happy", "sad", "thinking", "stun", "speaking", "error", "maintenance", "reset", "angry", "confused", "excited", "calm"};
+
+    // Built-in animation of each slot (nullptr: from the bundle only)
+    inline constexpr const emotion::Animation *BUILTIN_ANIMS[ANIM_COUNT] = {
+#if PTALK_BUILTIN_EMOTIONS
+        &emotion::NEUTRAL,
+        &emotion::IDLE,
+        &emotion::LISTENING,
+        &emotion::HAPPY,
+        &emotion::SAD,
+        &emotion::THINKING,
+        &emotion::STUN,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+#else
+        nullptr,
+#endif
+    };
+
+    // Slot played instead of an empty one (NONE: nothing to fall back to)
+    inline constexpr AnimId ANIM_FALLBACK[ANIM_COUNT] = {
+        AnimId::NONE, // neutral
+        AnimId::NONE, // idle
+        AnimId::NONE, // listening
+        AnimId::NONE, // happy
+        AnimId::NONE, // sad
+        AnimId::NONE, // thinking
+        AnimId::NONE, // stun
+        AnimId::NONE, // speaking
+        AnimId::NONE, // error
+        AnimId::NONE, // maintenance
+        AnimId::NONE, // reset
+        AnimId::IDLE, // angry
+        AnimId::STUN, // confused
+        AnimId::IDLE, // excited
+        AnimId::IDLE, // calm
+    };
+
+    // state::EmotionState -> animation slot
+    inline constexpr AnimId EMOTION_ANIM[] = {
+        AnimId::NEUTRAL, // NEUTRAL
+        AnimId::HAPPY, // HAPPY
+        AnimId::SAD, // SAD
+        AnimId::ANGRY, // ANGRY
+        AnimId::CONFUSED, // CONFUSED
+        AnimId::EXCITED, // EXCITED
+        AnimId::CALM, // CALM
+        AnimId::THINKING, // THINKING
+    };
+    static_assert(sizeof(EMOTION_ANIM) / sizeof(EMOTION_ANIM[0]) ==
+                  static_cast<size_t>(state::EmotionState::THINKING) + 1);
+
+    enum class IconId : uint8_t
+    {
+        BATTERY_CHARGE,
+        BATTERY_FULL,
+        BATTERY_CRITICAL,
+        COUNT,
+        NONE = 0xFF
+    };
+    inline constexpr size_t ICON_COUNT = static_cast<size_t>(IconId::COUNT);
+
+    inline constexpr std::string_view ICON_NAMES[ICON_COUNT] = {
+        "battery_charge", "battery_full", "battery_critical"};
+
+    inline constexpr const icon::Icon *ICONS[ICON_COUNT] = {
+        &icon::BATTERY_CHARGE,
+        &icon::BATTERY_FULL,
+        &icon::CRITICAL_POWER,
+    };
+
+    constexpr AnimId emotionAnim(state::EmotionState s)
+    {
+        const size_t i = static_cast<size_t>(s);
+        return i < sizeof(EMOTION_ANIM) / sizeof(EMOTION_ANIM[0]) ? EMOTION_ANIM[i] : AnimId::IDLE;
+    }
+
+    // Name -> slot, for assets named at runtime (bundle, packs, console); NONE if unknown
+    constexpr AnimId animIdFromName(std::string_view name)
+    {
+        for (size_t i = 0; i < ANIM_COUNT; i++)
+            if (ANIM_NAMES[i] == name)
+                return static_cast<AnimId>(i);
+        return AnimId::NONE;
+    }
+
+    constexpr IconId iconIdFromName(std::string_view name)
+    {
+        for (size_t i = 0; i < ICON_COUNT; i++)
+            if (ICON_NAMES[i] == name)
+                return static_cast<IconId>(i);
+        return IconId::NONE;
+    }
+} // namespace asset
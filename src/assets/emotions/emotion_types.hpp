@@ -4,13 +4,15 @@
 namespace asset::emotion {
 
 struct DiffBlock {
-    uint8_t x, y;             // Top-left corner
+    uint16_t x, y;            // Top-left corner (relative to animation origin)
     uint16_t width, height;   // Block dimensions (support up to 320)
-    const uint8_t* data;      // 4-bit grayscale pixels (RLE encoded)
+    const uint8_t* data;      // 2-bit grayscale pixels (RLE encoded, [count, value])
 };
 
+// Frame 0 is always a full frame. Later frames either hold a full frame or
+// only the box that changed since the previous frame (dirty rect).
 struct FrameInfo {
-    const DiffBlock* diff;  // nullptr for frame 0 or no-change frames
+    const DiffBlock* diff;  // nullptr for no-change frames
 };
 
 struct Animation {
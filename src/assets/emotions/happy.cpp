@@ -106,2968 +106,2126 @@ static const DiffBlock HAPPY_FRAME0_BLOCK = {
     HAPPY_FRAME0_DATA
 };
 
-// Frame 1: Full frame RLE (1550 bytes)
-static const uint8_t HAPPY_FRAME1_DATA[1550] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x4B,0x00,0x0A,0x01,0x77,0x00,0x0A,0x01,0xAD,0x00,0x02,0x01,0x02,0x02,
-0x11,0x03,0x02,0x02,0x02,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,
-0x01,0x01,0xA2,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x60,0x00,
-0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0x9A,0x00,0x01,0x01,0x01,0x02,
-0x23,0x03,0x01,0x02,0x02,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,
-0x01,0x01,0x94,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x8F,0x00,0x01,0x01,0x2F,0x03,
-0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
-0x8B,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x33,0x03,0x01,0x01,0x87,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x01,0x02,0x37,0x03,0x01,0x01,0x83,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x81,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
-0x41,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x7D,0x00,0x01,0x01,0x41,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x76,0x00,0x01,0x02,0x48,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x74,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x72,0x00,0x4D,0x03,0x01,0x01,
-0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
-0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x2F,0x00,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
-0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,
-0x01,0x01,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,
-0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,
-0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5D,0x03,0x60,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,
-0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x5D,0x03,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x63,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x65,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,
-0x66,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x67,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x68,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x53,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,
-0x4C,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,
-0x01,0x01,0x74,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x48,0x03,
-0x01,0x01,0x76,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x45,0x03,
-0x01,0x01,0x78,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
-0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x40,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x02,0x82,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,
-0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x85,0x00,0x01,0x01,0x35,0x03,
-0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x89,0x00,
-0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x8D,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x01,0x2C,0x03,0x01,0x02,0x93,0x00,0x01,0x01,0x01,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,
-0x1E,0x03,0x01,0x02,0x01,0x01,0xA0,0x00,0x02,0x01,0x01,0x02,0x15,0x03,0x02,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0xAB,0x00,
-0x03,0x01,0x07,0x02,0x04,0x01,0x73,0x00,0x04,0x01,0x07,0x02,0x03,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE0,0x00,
+// Frame 1: Diff RLE (1208 bytes)
+static const uint8_t HAPPY_FRAME1_DATA[1208] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC4,0x00,0x0A,0x01,0x77,0x00,
+0x0A,0x01,0x54,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x02,0x02,0x02,0x01,0x69,0x00,
+0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x02,0x02,
+0x1C,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,
+0x02,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x02,0x01,0x59,0x00,
+0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,
+0x29,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,
+0x01,0x01,0x36,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
+0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,0x33,0x03,0x01,0x02,
+0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,
+0x37,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x2A,0x00,
+0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x28,0x00,
+0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,
+0x24,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,
+0x22,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x46,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x1B,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x19,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
+0x17,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
+0x15,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
+0x13,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x11,0x00,
+0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x11,0x00,
+0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,
+0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x57,0x03,
+0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
+0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
+0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
+0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x08,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,
+0x01,0x02,0x5D,0x03,0x07,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,
+0x01,0x01,0x06,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,
+0x06,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x06,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x06,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x06,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x06,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x06,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x06,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5D,0x03,0x08,0x00,0x5D,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
+0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
+0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x59,0x03,
+0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x0D,0x00,0x57,0x03,0x01,0x01,0x29,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,
+0x56,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x54,0x03,0x01,0x02,0x11,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,
+0x01,0x02,0x12,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,
+0x13,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x15,0x00,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
+0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x47,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x3B,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,
+0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
+0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
+0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x29,0x00,
+0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
+0x01,0x01,0x2C,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,
+0x34,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
+0x4E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x2C,0x03,0x01,0x02,
+0x3A,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x02,
+0x26,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,
+0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x02,0x01,0x01,0x02,0x15,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x02,0x02,
+0x14,0x03,0x02,0x02,0x01,0x01,0x52,0x00,0x03,0x01,0x07,0x02,0x04,0x01,0x73,0x00,
+0x04,0x01,0x07,0x02,0x03,0x01,0x2C,0x00,
 };
 static const DiffBlock HAPPY_FRAME1_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 75,  // Changed box top-left
+    231, 86,  // Changed box dimensions
     HAPPY_FRAME1_DATA
 };
 
-// Frame 2: Full frame RLE (1446 bytes)
-static const uint8_t HAPPY_FRAME2_DATA[1446] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x8A,0x00,0x03,0x01,0x07,0x02,0x03,0x01,0x75,0x00,0x02,0x01,
-0x08,0x02,0x03,0x01,0xAC,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x02,0x01,
-0x69,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0xA3,0x00,0x01,0x01,
-0x02,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,
-0x01,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x26,0x03,0x01,0x02,
-0x95,0x00,0x01,0x02,0x2A,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,
-0x91,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x2E,0x03,
-0x01,0x01,0x8D,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x30,0x03,
-0x01,0x02,0x8B,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x34,0x03,
-0x01,0x01,0x87,0x00,0x01,0x01,0x37,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,
-0x01,0x02,0x85,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x39,0x03,
-0x01,0x01,0x82,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x3C,0x03,
-0x01,0x01,0x80,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x3E,0x03,
-0x01,0x01,0x7E,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,0x01,0x01,
-0x7C,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x42,0x03,0x01,0x01,0x7A,0x00,
-0x01,0x01,0x43,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x79,0x00,
-0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x78,0x00,0x01,0x02,
-0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x76,0x00,0x01,0x01,
-0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,0x74,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x71,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,
-0x4D,0x03,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,
-0x6E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,
-0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x6C,0x00,0x01,0x02,
-0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,
-0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x53,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x53,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x53,0x03,
-0x01,0x02,0x2D,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x53,0x03,
-0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x69,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x69,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x69,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x69,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x69,0x00,
-0x01,0x01,0x53,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x69,0x00,
-0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,
-0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6B,0x00,
-0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x6B,0x00,
-0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x51,0x03,
-0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6D,0x00,0x01,0x02,0x50,0x03,
-0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x6F,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x02,0x71,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,
-0x4C,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,
-0x01,0x01,0x74,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x75,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,
-0x01,0x02,0x78,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x7A,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,0x01,0x01,0x7F,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x82,0x00,0x01,0x01,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x86,0x00,
-0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x34,0x03,
-0x01,0x02,0x8B,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x02,0x02,0x50,0x00,0x01,0x01,
-0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x02,0x02,0x26,0x03,
-0x01,0x02,0x01,0x01,0x56,0x00,0x02,0x01,0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,
-0x97,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,
-0x03,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0xA2,0x00,0x04,0x01,0x0E,0x02,0x04,0x01,
-0x6B,0x00,0x04,0x01,0x0E,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x23,0x00,
+// Frame 2: Diff RLE (1072 bytes)
+static const uint8_t HAPPY_FRAME2_DATA[1072] = {
+0xFF,0x00,0x0B,0x00,0x03,0x01,0x07,0x02,0x03,0x01,0x75,0x00,0x02,0x01,0x08,0x02,
+0x03,0x01,0x4D,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x69,0x00,
+0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x44,0x00,0x01,0x01,0x02,0x02,
+0x1A,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,
+0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,
+0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x26,0x03,0x01,0x02,0x36,0x00,
+0x01,0x02,0x2A,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,0x32,0x00,
+0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x2E,0x03,0x01,0x01,
+0x2E,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,
+0x2C,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x34,0x03,0x01,0x01,
+0x28,0x00,0x01,0x01,0x37,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
+0x26,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x39,0x03,0x01,0x01,
+0x23,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,
+0x21,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x42,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x43,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x1A,0x00,0x45,0x03,
+0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x46,0x03,
+0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x47,0x03,
+0x01,0x02,0x39,0x00,0x48,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
+0x37,0x00,0x01,0x02,0x49,0x03,0x15,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,
+0x4A,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x12,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x11,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,
+0x11,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
+0x0F,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x0F,0x00,
+0x01,0x02,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,
+0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x0D,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x52,0x03,
+0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x2D,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x2C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x53,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x53,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x53,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x53,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x53,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
+0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x51,0x03,
+0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
+0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x50,0x03,0x30,0x00,
+0x01,0x01,0x50,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,
+0x50,0x03,0x10,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x02,0x10,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x12,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
+0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,
+0x16,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
+0x19,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x1B,0x00,
+0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x3C,0x03,
+0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x01,0x02,
+0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x27,0x00,0x01,0x01,
+0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x34,0x03,0x01,0x02,
+0x2C,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x02,0x02,0x50,0x00,0x01,0x01,0x01,0x02,
+0x2E,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,
+0x01,0x01,0x56,0x00,0x02,0x01,0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x38,0x00,
+0x02,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,0x03,0x02,
+0x1B,0x03,0x02,0x02,0x02,0x01,0x43,0x00,0x04,0x01,0x0E,0x02,0x04,0x01,0x6B,0x00,
+0x04,0x01,0x0E,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x8E,0x00,
+
 };
 static const DiffBlock HAPPY_FRAME2_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    47, 90,  // Changed box top-left
+    225, 71,  // Changed box dimensions
     HAPPY_FRAME2_DATA
 };
 
-// Frame 3: Full frame RLE (1314 bytes)
-static const uint8_t HAPPY_FRAME3_DATA[1314] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x60,0x00,0x07,0x01,0x7A,0x00,
-0x08,0x01,0xB1,0x00,0x01,0x01,0x02,0x02,0x0D,0x03,0x02,0x02,0x02,0x01,0x6D,0x00,
-0x02,0x01,0x02,0x02,0x0D,0x03,0x02,0x02,0x01,0x01,0xA7,0x00,0x01,0x01,0x01,0x02,
-0x17,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x02,0x02,0x17,0x03,0x01,0x02,0x01,0x01,
-0xA0,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
-0x1E,0x03,0x01,0x02,0x9C,0x00,0x01,0x01,0x23,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,
-0x22,0x03,0x01,0x02,0x01,0x01,0x97,0x00,0x01,0x01,0x27,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x01,0x2B,0x03,0x01,0x01,
-0x55,0x00,0x01,0x02,0x2A,0x03,0x01,0x02,0x91,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,
-0x01,0x01,0x51,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,0x8D,0x00,0x01,0x01,0x31,0x03,
-0x01,0x02,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x8A,0x00,0x01,0x02,
-0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x34,0x03,0x01,0x01,0x88,0x00,0x01,0x02,
-0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x85,0x00,0x01,0x01,
-0x39,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x83,0x00,0x01,0x01,
-0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x82,0x00,0x3D,0x03,
-0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x80,0x00,0x3F,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x7C,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,
-0x01,0x01,0x42,0x03,0x01,0x01,0x7A,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3C,0x00,
-0x01,0x01,0x44,0x03,0x01,0x01,0x79,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,
-0x76,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
-0x74,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
-0x73,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x72,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,
-0x71,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x70,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6E,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x6E,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
-0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
-0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x02,0x51,0x03,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,
-0x01,0x02,0x51,0x03,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
-0x51,0x03,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,
-0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x6C,0x00,
-0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6C,0x00,
-0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x6D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
-0x6D,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6F,0x00,0x4F,0x03,
-0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6F,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x4D,0x03,0x01,0x01,
-0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x71,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x01,0x76,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x01,0x46,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x02,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x01,0x02,0x37,0x03,
-0x02,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x87,0x00,
-0x02,0x01,0x03,0x02,0x29,0x03,0x03,0x02,0x02,0x01,0x4E,0x00,0x02,0x01,0x04,0x02,
-0x28,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x4B,0x00,
+// Frame 3: Diff RLE (984 bytes)
+static const uint8_t HAPPY_FRAME3_DATA[984] = {
+0x27,0x00,0x07,0x01,0x7A,0x00,0x08,0x01,0x48,0x00,0x01,0x01,0x02,0x02,0x0D,0x03,
+0x02,0x02,0x02,0x01,0x6D,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x02,0x02,0x01,0x01,
+0x3E,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x02,0x02,
+0x17,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,
+0x01,0x01,0x61,0x00,0x01,0x01,0x1E,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x23,0x03,
+0x01,0x02,0x5D,0x00,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,
+0x27,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,
+0x01,0x01,0x2B,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x2A,0x03,0x01,0x02,0x28,0x00,
+0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
+0x24,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,
+0x01,0x01,0x21,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x34,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,
+0x01,0x02,0x1A,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,
+0x01,0x02,0x19,0x00,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x17,0x00,0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x15,0x00,
+0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x13,0x00,
+0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x11,0x00,0x01,0x01,
+0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x10,0x00,0x45,0x03,
+0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x46,0x03,
+0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x47,0x03,
+0x01,0x02,0x39,0x00,0x48,0x03,0x0D,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,
+0x01,0x01,0x48,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x01,0x0A,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x01,
+0x4A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,
+0x01,0x02,0x4B,0x03,0x01,0x01,0x08,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,
+0x4F,0x03,0x05,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x05,0x00,
+0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x04,0x00,
+0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x04,0x00,
+0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x03,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x03,0x00,0x01,0x01,0x51,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x03,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x2F,0x00,0x01,0x02,0x51,0x03,0x03,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x02,0x51,0x03,0x03,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,
+0x50,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x02,0x50,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,
+0x01,0x01,0x50,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,
+0x50,0x03,0x06,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
+0x06,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,
+0x07,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x08,0x00,
+0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,
+0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,
+0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x13,0x00,0x01,0x01,
+0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x18,0x00,
+0x01,0x01,0x01,0x02,0x37,0x03,0x02,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
+0x01,0x02,0x01,0x01,0x1E,0x00,0x02,0x01,0x03,0x02,0x29,0x03,0x03,0x02,0x02,0x01,
+0x4E,0x00,0x02,0x01,0x04,0x02,0x28,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2A,0x00,
 };
 static const DiffBlock HAPPY_FRAME3_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    52, 55,  // Changed box top-left
+    215, 101,  // Changed box dimensions
     HAPPY_FRAME3_DATA
 };
 
-// Frame 4: Full frame RLE (1278 bytes)
-static const uint8_t HAPPY_FRAME4_DATA[1278] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4D,0x00,0x03,0x01,
-0x09,0x02,0x03,0x01,0x73,0x00,0x03,0x01,0x09,0x02,0x02,0x01,0xAC,0x00,0x01,0x01,
-0x02,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,0x01,0x02,0x12,0x03,
-0x01,0x02,0x02,0x01,0xA4,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,
-0x64,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,
-0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x20,0x03,0x01,0x02,
-0x9A,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x24,0x03,
-0x01,0x02,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x01,0x57,0x00,0x01,0x02,
-0x28,0x03,0x01,0x02,0x93,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,0x54,0x00,0x01,0x01,
-0x2C,0x03,0x01,0x01,0x8F,0x00,0x01,0x01,0x2F,0x03,0x01,0x01,0x51,0x00,0x01,0x02,
-0x2E,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
-0x32,0x03,0x01,0x01,0x8A,0x00,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x02,0x88,0x00,0x37,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,
-0x01,0x02,0x85,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,
-0x01,0x02,0x83,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x82,0x00,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x80,0x00,0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x7E,0x00,
-0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x7A,0x00,0x01,0x01,
-0x43,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x79,0x00,
-0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x78,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x76,0x00,0x01,0x01,
-0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x47,0x03,0x76,0x00,0x01,0x02,0x48,0x03,
-0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
-0x37,0x00,0x01,0x02,0x49,0x03,0x74,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,
-0x4A,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x72,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,
-0x4C,0x03,0x01,0x01,0x71,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x4E,0x03,0x01,0x01,
-0x6F,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
-0x6F,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6E,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x6E,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,
-0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,
-0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,
-0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,
-0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,
-0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x4F,0x03,
-0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x6F,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,
-0x01,0x02,0x6F,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x01,0x6F,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
-0x4D,0x03,0x71,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x72,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,
-0x73,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x01,0x79,0x00,0x02,0x02,0x11,0x03,0x05,0x02,0x06,0x01,0x07,0x00,
-0x07,0x01,0x04,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x11,0x03,0x05,0x02,0x06,0x01,0x08,0x00,0x06,0x01,0x05,0x02,0x11,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x05,0x01,0x01,0x02,0x06,0x01,0x25,0x00,0x0C,0x01,0x45,0x00,
-0x04,0x01,0x01,0x02,0x07,0x01,0x24,0x00,0x0C,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x5B,0x00,
+// Frame 4: Diff RLE (890 bytes)
+static const uint8_t HAPPY_FRAME4_DATA[890] = {
+0x22,0x00,0x03,0x01,0x09,0x02,0x03,0x01,0x73,0x00,0x03,0x01,0x09,0x02,0x02,0x01,
+0x40,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,
+0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x19,0x03,
+0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,
+0x32,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,
+0x20,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x01,0x5B,0x00,
+0x01,0x02,0x24,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x01,
+0x57,0x00,0x01,0x02,0x28,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,
+0x54,0x00,0x01,0x01,0x2C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x2F,0x03,0x01,0x01,
+0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x31,0x03,0x01,0x02,
+0x4E,0x00,0x01,0x01,0x32,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x34,0x03,0x01,0x01,
+0x4B,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x1C,0x00,0x37,0x03,0x01,0x01,0x49,0x00,
+0x01,0x02,0x36,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x47,0x00,
+0x01,0x02,0x38,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,
+0x01,0x02,0x3A,0x03,0x01,0x02,0x16,0x00,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x14,0x00,0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,
+0x01,0x02,0x12,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
+0x01,0x01,0x10,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x47,0x03,0x0A,0x00,
+0x01,0x02,0x48,0x03,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,0x08,0x00,0x01,0x02,0x4A,0x03,
+0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,
+0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x05,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,
+0x01,0x01,0x4C,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,
+0x01,0x02,0x4C,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,
+0x4E,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x02,0x03,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x02,0x02,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,
+0x02,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x02,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x50,0x03,
+0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x50,0x03,0x30,0x00,
+0x01,0x01,0x50,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,
+0x50,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,
+0x01,0x01,0x01,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x01,0x00,
+0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x01,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x03,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,
+0x01,0x02,0x4E,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
+0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,
+0x33,0x00,0x01,0x02,0x4D,0x03,0x05,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,
+0x4A,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x48,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x0D,0x00,0x02,0x02,0x11,0x03,0x05,0x02,
+0x06,0x01,0x07,0x00,0x07,0x01,0x04,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
+0x01,0x01,0x01,0x02,0x11,0x03,0x05,0x02,0x06,0x01,0x08,0x00,0x06,0x01,0x05,0x02,
+0x11,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x05,0x01,0x01,0x02,0x06,0x01,0x25,0x00,
+0x0C,0x01,0x45,0x00,0x04,0x01,0x01,0x02,0x07,0x01,0x24,0x00,0x0C,0x01,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x58,0x00,
 };
 static const DiffBlock HAPPY_FRAME4_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    53, 43,  // Changed box top-left
+    212, 69,  // Changed box dimensions
     HAPPY_FRAME4_DATA
 };
 
-// Frame 5: Full frame RLE (1294 bytes)
-static const uint8_t HAPPY_FRAME5_DATA[1294] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xCE,0x00,0x02,0x01,0x03,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0x70,0x00,0x02,0x01,
-0x04,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x15,0x03,
-0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x01,0x01,
-0xA2,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,
-0x1C,0x03,0x01,0x02,0x01,0x01,0x9D,0x00,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x22,0x03,0x01,0x01,0x99,0x00,0x01,0x02,0x26,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x26,0x03,0x01,0x02,0x95,0x00,0x01,0x02,0x2A,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x01,0x91,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,
-0x52,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x01,0x8D,0x00,0x01,0x01,0x01,0x02,
-0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x33,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x33,0x03,0x01,0x01,0x88,0x00,0x01,0x02,
-0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x86,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x84,0x00,0x01,0x02,
-0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x82,0x00,0x3D,0x03,
-0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x80,0x00,0x01,0x02,0x3E,0x03,
-0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x7E,0x00,0x01,0x02,0x40,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x7C,0x00,0x01,0x02,0x42,0x03,
-0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x7A,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x79,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,
-0x48,0x03,0x75,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
-0x48,0x03,0x01,0x02,0x74,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,
-0x01,0x01,0x73,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x72,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x71,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x70,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x70,0x00,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x6F,0x00,
-0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,
-0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
-0x51,0x03,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,
-0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,
-0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,
-0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
-0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x01,0x01,0x6E,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x4E,0x03,
-0x01,0x01,0x70,0x00,0x01,0x02,0x1E,0x03,0x05,0x02,0x06,0x01,0x05,0x02,0x1E,0x03,
-0x34,0x00,0x01,0x01,0x1E,0x03,0x05,0x02,0x06,0x01,0x05,0x02,0x1E,0x03,0x01,0x01,
-0x72,0x00,0x01,0x01,0x14,0x03,0x03,0x02,0x03,0x01,0x16,0x00,0x02,0x01,0x03,0x02,
-0x14,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,0x03,0x01,
-0x16,0x00,0x03,0x01,0x03,0x02,0x14,0x03,0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x03,0x02,0x02,0x01,0x25,0x00,0x03,0x01,0x03,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x03,0x02,0x03,0x01,0x24,0x00,
-0x03,0x01,0x03,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,0x05,0x01,0x36,0x00,
-0x05,0x01,0x41,0x00,0x05,0x01,0x36,0x00,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x59,0x00,
+// Frame 5: Diff RLE (856 bytes)
+static const uint8_t HAPPY_FRAME5_DATA[856] = {
+0xFF,0x00,0xCC,0x00,0x02,0x01,0x03,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0x70,0x00,
+0x02,0x01,0x04,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,
+0x15,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,
+0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x62,0x00,0x01,0x01,
+0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,0x21,0x03,0x01,0x02,
+0x01,0x01,0x5D,0x00,0x01,0x01,0x22,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,0x26,0x03,
+0x01,0x01,0x59,0x00,0x01,0x01,0x26,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,0x2A,0x03,
+0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x2D,0x03,
+0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,
+0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x20,0x00,
+0x01,0x01,0x33,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x33,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x19,0x00,
+0x01,0x02,0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x17,0x00,
+0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x15,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x13,0x00,0x01,0x02,
+0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x11,0x00,0x01,0x02,
+0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x43,0x03,
+0x01,0x02,0x3D,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x0E,0x00,0x45,0x03,0x01,0x01,
+0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x46,0x03,0x01,0x01,
+0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
+0x39,0x00,0x48,0x03,0x0A,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x48,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,
+0x4A,0x03,0x01,0x01,0x08,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,
+0x01,0x01,0x06,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x05,0x00,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,
+0x04,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x03,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x50,0x03,0x30,0x00,
+0x01,0x01,0x50,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x02,0x51,0x03,0x01,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,
+0x02,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x01,0x02,0x51,0x03,
+0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,
+0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,
+0x01,0x01,0x52,0x03,0x02,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x02,0x01,
+0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x02,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x02,0x51,0x03,0x01,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,
+0x50,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
+0x50,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
+0x01,0x01,0x03,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
+0x04,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x4E,0x03,0x01,0x01,0x05,0x00,
+0x01,0x02,0x1E,0x03,0x05,0x02,0x06,0x01,0x05,0x02,0x1E,0x03,0x34,0x00,0x01,0x01,
+0x1E,0x03,0x05,0x02,0x06,0x01,0x05,0x02,0x1E,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x14,0x03,0x03,0x02,0x03,0x01,0x16,0x00,0x02,0x01,0x03,0x02,0x14,0x03,0x01,0x02,
+0x36,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,0x03,0x01,0x16,0x00,0x03,0x01,
+0x03,0x02,0x14,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x03,0x02,
+0x02,0x01,0x25,0x00,0x03,0x01,0x03,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x03,0x02,0x03,0x01,0x24,0x00,0x03,0x01,0x03,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x05,0x01,0x36,0x00,0x05,0x01,0x41,0x00,
+0x05,0x01,0x36,0x00,0x05,0x01,0x0A,0x00,
 };
 static const DiffBlock HAPPY_FRAME5_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    53, 43,  // Changed box top-left
+    213, 53,  // Changed box dimensions
     HAPPY_FRAME5_DATA
 };
 
-// Frame 6: Full frame RLE (1278 bytes)
-static const uint8_t HAPPY_FRAME6_DATA[1278] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE5,0x00,0x0B,0x01,0x76,0x00,0x0C,0x01,
-0xAC,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x69,0x00,0x01,0x01,
-0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0xA1,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,
-0x01,0x02,0x01,0x01,0x60,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,
-0x9A,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x02,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x94,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x01,0x90,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,
-0x01,0x02,0x89,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,
-0x01,0x02,0x85,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x3A,0x03,
-0x01,0x01,0x82,0x00,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x7F,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x78,0x00,0x47,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x74,0x00,0x4B,0x03,0x01,0x01,
-0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x72,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,
-0x01,0x02,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,
-0x01,0x02,0x6A,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,
-0x01,0x01,0x69,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
-0x67,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,
-0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x66,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,
-0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x20,0x03,0x03,0x02,0x07,0x01,0x03,0x00,
+// Frame 6: Diff RLE (860 bytes)
+static const uint8_t HAPPY_FRAME6_DATA[860] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x27,0x00,0x0B,0x01,
+0x76,0x00,0x0C,0x01,0x4B,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x02,0x01,
+0x69,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x40,0x00,0x01,0x01,
+0x02,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,
+0x01,0x02,0x02,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,
+0x5A,0x00,0x01,0x01,0x02,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,
+0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x51,0x00,0x01,0x02,
+0x2E,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0x4D,0x00,
+0x01,0x02,0x32,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,
+0x01,0x01,0x36,0x03,0x01,0x02,0x24,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x46,0x00,
+0x01,0x01,0x3A,0x03,0x01,0x01,0x21,0x00,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,
+0x19,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x17,0x00,0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x14,0x00,
+0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x13,0x00,
+0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x11,0x00,0x4D,0x03,
+0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x51,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x0B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,
+0x01,0x01,0x54,0x03,0x01,0x01,0x08,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,
+0x54,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
+0x56,0x03,0x01,0x01,0x06,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x05,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x03,0x00,
+0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,
+0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x02,0x01,0x5B,0x03,
+0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x02,0x01,0x5B,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x20,0x03,0x03,0x02,0x07,0x01,0x03,0x00,
 0x07,0x01,0x03,0x02,0x20,0x03,0x01,0x02,0x29,0x00,0x21,0x03,0x03,0x02,0x06,0x01,
-0x04,0x00,0x06,0x01,0x03,0x02,0x21,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x18,0x03,
+0x04,0x00,0x06,0x01,0x03,0x02,0x21,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x18,0x03,
 0x02,0x02,0x02,0x01,0x1D,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x2B,0x00,
 0x18,0x03,0x02,0x02,0x03,0x01,0x1D,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x01,0x01,
-0x68,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x2B,0x00,0x02,0x01,
+0x07,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x2B,0x00,0x02,0x01,
 0x02,0x02,0x10,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x10,0x03,0x02,0x02,0x02,0x01,
-0x2A,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,0x08,0x02,
+0x2A,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x08,0x02,
 0x02,0x01,0x39,0x00,0x02,0x01,0x08,0x02,0x01,0x01,0x32,0x00,0x02,0x01,0x07,0x02,
-0x03,0x01,0x38,0x00,0x03,0x01,0x07,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x01,0x00,
+0x03,0x01,0x38,0x00,0x03,0x01,0x07,0x02,0x02,0x01,0x07,0x00,
 };
 static const DiffBlock HAPPY_FRAME6_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    48, 45,  // Changed box top-left
+    223, 64,  // Changed box dimensions
     HAPPY_FRAME6_DATA
 };
 
-// Frame 7: Full frame RLE (1280 bytes)
-static const uint8_t HAPPY_FRAME7_DATA[1280] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+// Frame 7: Diff RLE (856 bytes)
+static const uint8_t HAPPY_FRAME7_DATA[856] = {
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x2F,0x00,0x04,0x01,0x08,0x02,0x03,0x01,0x72,0x00,0x04,0x01,0x08,0x02,0x04,0x01,
-0xA9,0x00,0x01,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x02,0x01,
-0x01,0x02,0x16,0x03,0x01,0x02,0x02,0x01,0x9F,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
+0x3F,0x00,0x04,0x01,0x08,0x02,0x03,0x01,0x72,0x00,0x04,0x01,0x08,0x02,0x04,0x01,
+0x4E,0x00,0x01,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x02,0x01,
+0x01,0x02,0x16,0x03,0x01,0x02,0x02,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
 0x01,0x02,0x02,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
-0x97,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,
-0x01,0x02,0x26,0x03,0x01,0x02,0x02,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
+0x3C,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,
+0x01,0x02,0x26,0x03,0x01,0x02,0x02,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
 0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x87,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x49,0x00,0x01,0x02,
-0x36,0x03,0x01,0x02,0x01,0x01,0x83,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x81,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x3E,0x03,0x01,0x02,0x7D,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3E,0x00,
-0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x47,0x03,0x75,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,
-0x4C,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x6A,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,
-0x01,0x01,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,
-0x67,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x66,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x64,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,0x5B,0x03,
-0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,
-0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
-0x5E,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5C,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5C,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
-0x01,0x02,0x61,0x03,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x61,0x03,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x2C,0x03,0x07,0x02,0x2C,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
-0x2C,0x03,0x07,0x02,0x2C,0x03,0x5F,0x00,0x01,0x01,0x20,0x03,0x02,0x02,0x04,0x01,
-0x12,0x00,0x03,0x01,0x03,0x02,0x1F,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x20,0x03,
-0x03,0x02,0x03,0x01,0x12,0x00,0x03,0x01,0x03,0x02,0x20,0x03,0x01,0x01,0x60,0x00,
-0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x23,0x00,0x02,0x01,0x03,0x02,0x18,0x03,
-0x24,0x00,0x01,0x01,0x18,0x03,0x02,0x02,0x03,0x01,0x22,0x00,0x03,0x01,0x02,0x02,
-0x18,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x10,0x03,0x03,0x02,0x02,0x01,0x2F,0x00,
-0x03,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x10,0x03,0x02,0x02,
-0x02,0x01,0x30,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x03,0x03,0x04,0x02,0x02,0x01,0x3D,0x00,0x03,0x01,0x04,0x02,
-0x02,0x03,0x03,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x03,0x02,0x02,0x03,0x04,0x02,
-0x03,0x01,0x3C,0x00,0x03,0x01,0x04,0x02,0x03,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x35,0x00,
-
+0x31,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x49,0x00,0x01,0x02,
+0x36,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,
+0x01,0x02,0x3A,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,
+0x01,0x01,0x3E,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3E,0x00,
+0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
+0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x47,0x03,0x1A,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
+0x50,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,
+0x0C,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x08,0x00,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x06,0x00,0x5D,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x23,0x00,0x5E,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,
+0x01,0x01,0x5E,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,
+0x01,0x02,0x5F,0x03,0x03,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
+0x03,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x00,0x01,0x01,
+0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x1F,0x00,0x62,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,
+0x02,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x00,0x01,0x01,
+0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x60,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x2C,0x03,0x07,0x02,
+0x2C,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x2C,0x03,0x07,0x02,0x2C,0x03,0x04,0x00,
+0x01,0x01,0x20,0x03,0x02,0x02,0x04,0x01,0x12,0x00,0x03,0x01,0x03,0x02,0x1F,0x03,
+0x01,0x02,0x22,0x00,0x01,0x01,0x20,0x03,0x03,0x02,0x03,0x01,0x12,0x00,0x03,0x01,
+0x03,0x02,0x20,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
+0x23,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x24,0x00,0x01,0x01,0x18,0x03,0x02,0x02,
+0x03,0x01,0x22,0x00,0x03,0x01,0x02,0x02,0x18,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x10,0x03,0x03,0x02,0x02,0x01,0x2F,0x00,0x03,0x01,0x02,0x02,0x10,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x02,0x01,0x30,0x00,0x02,0x01,0x02,0x02,
+0x10,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x02,0x01,0x02,0x02,0x03,0x03,0x04,0x02,
+0x02,0x01,0x3D,0x00,0x03,0x01,0x04,0x02,0x02,0x03,0x03,0x02,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x03,0x02,0x02,0x03,0x04,0x02,0x03,0x01,0x3C,0x00,0x03,0x01,0x04,0x02,
+0x03,0x03,0x02,0x02,0x01,0x01,0x07,0x00,
 };
 static const DiffBlock HAPPY_FRAME7_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 61,  // Changed box top-left
+    229, 55,  // Changed box dimensions
     HAPPY_FRAME7_DATA
 };
 
-// Frame 8: Full frame RLE (1294 bytes)
-static const uint8_t HAPPY_FRAME8_DATA[1294] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF5,0x00,0x09,0x01,0x78,0x00,0x0A,0x01,0xAD,0x00,
-0x02,0x01,0x03,0x02,0x10,0x03,0x02,0x02,0x03,0x01,0x67,0x00,0x02,0x01,0x03,0x02,
-0x10,0x03,0x03,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x98,0x00,
-0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,
-0x26,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x8C,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,
-0x88,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,
-0x01,0x02,0x84,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x7D,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x79,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x01,0x02,0x47,0x03,
-0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x73,0x00,0x01,0x01,
-0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x71,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6D,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
-0x2D,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x2B,0x00,0x01,0x02,0x55,0x03,0x67,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,
-0x01,0x02,0x57,0x03,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,
-0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x5E,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5E,0x00,0x01,0x02,0x60,0x03,
-0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x23,0x03,0x03,0x02,0x05,0x01,
-0x0B,0x00,0x05,0x01,0x03,0x02,0x23,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x23,0x03,
-0x03,0x02,0x05,0x01,0x0A,0x00,0x05,0x01,0x03,0x02,0x23,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x1C,0x03,0x02,0x02,0x02,0x01,0x1F,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,
-0x01,0x02,0x21,0x00,0x1C,0x03,0x02,0x02,0x02,0x01,0x20,0x00,0x02,0x01,0x02,0x02,
-0x1C,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x15,0x03,0x02,0x02,0x01,0x01,0x2D,0x00,
-0x02,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x23,0x00,0x15,0x03,0x02,0x02,0x02,0x01,
-0x2C,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x0D,0x03,
-0x02,0x02,0x01,0x01,0x39,0x00,0x02,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x25,0x00,0x01,0x01,0x0D,0x03,0x02,0x02,0x02,0x01,0x38,0x00,0x02,0x01,0x02,0x02,
-0x0D,0x03,0x01,0x01,0x66,0x00,0x02,0x01,0x02,0x02,0x04,0x01,0x46,0x00,0x04,0x01,
-0x01,0x02,0x03,0x01,0x2B,0x00,0x03,0x01,0x01,0x02,0x04,0x01,0x46,0x00,0x04,0x01,
-0x01,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x71,0x00,
+// Frame 8: Diff RLE (848 bytes)
+static const uint8_t HAPPY_FRAME8_DATA[848] = {
+0xFF,0x00,0xFF,0x00,0xE5,0x00,0x09,0x01,0x78,0x00,0x0A,0x01,0x54,0x00,0x02,0x01,
+0x03,0x02,0x10,0x03,0x02,0x02,0x03,0x01,0x67,0x00,0x02,0x01,0x03,0x02,0x10,0x03,
+0x03,0x02,0x02,0x01,0x47,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,
+0x5F,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
+0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x52,0x00,
+0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
+0x2B,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x24,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
+0x01,0x01,0x42,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,
+0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
+0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,
+0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x18,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x16,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x14,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x2F,0x00,0x52,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x2D,0x00,
+0x01,0x02,0x53,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,
+0x01,0x02,0x55,0x03,0x0E,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,
+0x57,0x03,0x0D,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x07,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x06,0x00,
+0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x05,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x05,0x00,0x01,0x02,0x60,0x03,0x20,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1F,0x00,
+0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,
+0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x02,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x23,0x03,0x03,0x02,0x05,0x01,0x0B,0x00,0x05,0x01,0x03,0x02,
+0x23,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x23,0x03,0x03,0x02,0x05,0x01,0x0A,0x00,
+0x05,0x01,0x03,0x02,0x23,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x1C,0x03,0x02,0x02,
+0x02,0x01,0x1F,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,0x01,0x02,0x21,0x00,0x1C,0x03,
+0x02,0x02,0x02,0x01,0x20,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x01,0x01,0x05,0x00,
+0x01,0x01,0x15,0x03,0x02,0x02,0x01,0x01,0x2D,0x00,0x02,0x01,0x02,0x02,0x14,0x03,
+0x01,0x02,0x23,0x00,0x15,0x03,0x02,0x02,0x02,0x01,0x2C,0x00,0x02,0x01,0x02,0x02,
+0x15,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0D,0x03,0x02,0x02,0x01,0x01,0x39,0x00,
+0x02,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x0D,0x03,
+0x02,0x02,0x02,0x01,0x38,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,0x0D,0x00,
+0x02,0x01,0x02,0x02,0x04,0x01,0x46,0x00,0x04,0x01,0x01,0x02,0x03,0x01,0x2B,0x00,
+0x03,0x01,0x01,0x02,0x04,0x01,0x46,0x00,0x04,0x01,0x01,0x02,0x03,0x01,0x08,0x00,
+
 };
 static const DiffBlock HAPPY_FRAME8_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 70,  // Changed box top-left
+    231, 49,  // Changed box dimensions
     HAPPY_FRAME8_DATA
 };
 
-// Frame 9: Full frame RLE (1284 bytes)
-static const uint8_t HAPPY_FRAME9_DATA[1284] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x39,0x00,0x05,0x01,0x7C,0x00,
-0x06,0x01,0xAF,0x00,0x02,0x01,0x04,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,0x69,0x00,
-0x02,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,0xA2,0x00,0x01,0x01,0x01,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,
-0x01,0x01,0x99,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
-0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x01,0x53,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x8D,0x00,0x01,0x02,
-0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x01,0x88,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
-0x84,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x01,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x7D,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x42,0x03,0x01,0x01,0x79,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x76,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,
-0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x71,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
-0x33,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
-0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,
-0x01,0x01,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,
-0x01,0x01,0x54,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,
-0x58,0x03,0x65,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x62,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x60,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5E,0x00,0x01,0x02,
-0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
-0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
-0x01,0x01,0x5A,0x00,0x01,0x02,0x2B,0x03,0x0B,0x02,0x2C,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x01,0x2B,0x03,0x0C,0x02,0x2B,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x21,0x03,
+// Frame 9: Diff RLE (830 bytes)
+static const uint8_t HAPPY_FRAME9_DATA[830] = {
+0xFF,0x00,0x18,0x00,0x05,0x01,0x7C,0x00,0x06,0x01,0x56,0x00,0x02,0x01,0x04,0x02,
+0x0E,0x03,0x03,0x02,0x02,0x01,0x69,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,
+0x02,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5F,0x00,
+0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,
+0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
+0x01,0x01,0x32,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,
+0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x24,0x00,0x01,0x02,
+0x41,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x20,0x00,
+0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
+0x18,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,
+0x15,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
+0x13,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x11,0x00,
+0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x0C,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x08,0x00,0x5D,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x21,0x00,0x60,0x03,0x05,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,
+0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x02,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,
+0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x02,
+0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x01,0x01,0x01,0x00,0x01,0x02,0x2B,0x03,0x0B,0x02,0x2C,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x2B,0x03,0x0C,0x02,0x2B,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x21,0x03,
 0x03,0x02,0x03,0x01,0x13,0x00,0x03,0x01,0x03,0x02,0x21,0x03,0x01,0x02,0x1F,0x00,
 0x22,0x03,0x02,0x02,0x03,0x01,0x14,0x00,0x03,0x01,0x02,0x02,0x22,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x23,0x00,0x02,0x01,0x02,0x02,
+0x03,0x00,0x01,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x23,0x00,0x02,0x01,0x02,0x02,
 0x1B,0x03,0x20,0x00,0x01,0x01,0x1B,0x03,0x01,0x02,0x02,0x01,0x24,0x00,0x02,0x01,
-0x02,0x02,0x1A,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x02,0x01,
+0x02,0x02,0x1A,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x02,0x01,
 0x30,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
 0x14,0x03,0x01,0x02,0x02,0x01,0x30,0x00,0x02,0x01,0x01,0x02,0x14,0x03,0x01,0x01,
-0x60,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x02,0x01,0x3B,0x00,0x02,0x01,
+0x07,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x02,0x01,0x3B,0x00,0x02,0x01,
 0x02,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x0C,0x03,0x02,0x02,
-0x01,0x01,0x3C,0x00,0x02,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x66,0x00,0x06,0x01,
-0x4A,0x00,0x06,0x01,0x2B,0x00,0x06,0x01,0x4A,0x00,0x06,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x30,0x00,
+0x01,0x01,0x3C,0x00,0x02,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0D,0x00,0x06,0x01,
+0x4A,0x00,0x06,0x01,0x2B,0x00,0x06,0x01,0x4A,0x00,0x06,0x01,0x08,0x00,
 };
 static const DiffBlock HAPPY_FRAME9_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 73,  // Changed box top-left
+    231, 47,  // Changed box dimensions
     HAPPY_FRAME9_DATA
 };
 
-// Frame 10: Full frame RLE (1280 bytes)
-static const uint8_t HAPPY_FRAME10_DATA[1280] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x73,0x00,0x02,0x01,
-0x0F,0x02,0x03,0x01,0x6D,0x00,0x03,0x01,0x0E,0x02,0x03,0x01,0xA5,0x00,0x02,0x01,
-0x01,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0x62,0x00,0x02,0x01,0x02,0x02,0x18,0x03,
-0x02,0x02,0x02,0x01,0x9B,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x95,0x00,0x01,0x01,
-0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x2A,0x03,0x01,0x02,
-0x01,0x01,0x8E,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x30,0x03,0x01,0x02,0x8A,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4A,0x00,
-0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x85,0x00,0x01,0x01,0x39,0x03,
-0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x81,0x00,0x01,0x01,
-0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x7D,0x00,
-0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
-0x7A,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x47,0x03,0x01,0x01,
-0x74,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
-0x72,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x68,0x00,0x01,0x01,
-0x55,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,0x67,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
-0x5F,0x03,0x5E,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x5C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,
-0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,
-0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x23,0x03,0x03,0x02,
-0x04,0x01,0x0E,0x00,0x03,0x01,0x03,0x02,0x24,0x03,0x1E,0x00,0x01,0x01,0x24,0x03,
-0x02,0x02,0x04,0x01,0x0E,0x00,0x04,0x01,0x03,0x02,0x23,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x1D,0x03,0x01,0x02,0x03,0x01,0x20,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x20,0x00,0x02,0x01,
-0x02,0x02,0x1C,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x16,0x03,0x02,0x02,0x01,0x01,
-0x2D,0x00,0x02,0x01,0x01,0x02,0x16,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x15,0x03,
-0x02,0x02,0x02,0x01,0x2C,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x60,0x00,
-0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x02,0x02,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x02,0x01,0x38,0x00,
-0x02,0x01,0x02,0x02,0x0E,0x03,0x01,0x01,0x63,0x00,0x02,0x01,0x06,0x02,0x02,0x01,
-0x45,0x00,0x02,0x01,0x07,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x06,0x02,0x03,0x01,
-0x45,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2E,0x00,
-
+// Frame 10: Diff RLE (814 bytes)
+static const uint8_t HAPPY_FRAME10_DATA[814] = {
+0xFF,0x00,0x11,0x00,0x02,0x01,0x0F,0x02,0x03,0x01,0x6D,0x00,0x03,0x01,0x0E,0x02,
+0x03,0x01,0x4C,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0x62,0x00,
+0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x42,0x00,0x01,0x01,0x01,0x02,
+0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,
+0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
+0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
+0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x31,0x00,0x01,0x01,
+0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
+0x2C,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x01,0x01,0x28,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,
+0x3D,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,
+0x40,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,
+0x01,0x02,0x44,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x47,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x01,0x19,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,
+0x4F,0x03,0x14,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,
+0x01,0x01,0x11,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x53,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,
+0x0E,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x0D,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x08,0x00,0x5D,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x05,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
+0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x1F,0x00,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x02,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,
+0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
+0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
+0x02,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x02,0x01,
+0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,
+0x23,0x03,0x03,0x02,0x04,0x01,0x0E,0x00,0x03,0x01,0x03,0x02,0x24,0x03,0x1E,0x00,
+0x01,0x01,0x24,0x03,0x02,0x02,0x04,0x01,0x0E,0x00,0x04,0x01,0x03,0x02,0x23,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x1D,0x03,0x01,0x02,0x03,0x01,0x20,0x00,0x02,0x01,
+0x02,0x02,0x1C,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,
+0x20,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x16,0x03,
+0x02,0x02,0x01,0x01,0x2D,0x00,0x02,0x01,0x01,0x02,0x16,0x03,0x01,0x01,0x21,0x00,
+0x01,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x2C,0x00,0x02,0x01,0x02,0x02,0x15,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
+0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,
+0x02,0x01,0x38,0x00,0x02,0x01,0x02,0x02,0x0E,0x03,0x01,0x01,0x0A,0x00,0x02,0x01,
+0x06,0x02,0x02,0x01,0x45,0x00,0x02,0x01,0x07,0x02,0x01,0x01,0x29,0x00,0x01,0x01,
+0x06,0x02,0x03,0x01,0x45,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0x06,0x00,
 };
 static const DiffBlock HAPPY_FRAME10_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 74,  // Changed box top-left
+    231, 46,  // Changed box dimensions
     HAPPY_FRAME10_DATA
 };
 
-// Frame 11: Full frame RLE (1302 bytes)
-static const uint8_t HAPPY_FRAME11_DATA[1302] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xEF,0x00,0x03,0x01,0x04,0x02,0x07,0x03,0x05,0x02,
-0x02,0x01,0x6C,0x00,0x03,0x01,0x05,0x02,0x07,0x03,0x04,0x02,0x03,0x01,0xA4,0x00,
-0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0x61,0x00,0x02,0x01,0x02,0x02,
-0x19,0x03,0x02,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,
-0x01,0x01,0x5A,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x94,0x00,
-0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
-0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x8A,0x00,0x01,0x01,0x35,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x85,0x00,0x01,0x01,
-0x39,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x81,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,
-0x7D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x44,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,
-0x4A,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,
-0x01,0x02,0x6D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x6C,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,
-0x01,0x02,0x6A,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x64,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x64,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,
-0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x21,0x00,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
-0x01,0x02,0x61,0x03,0x5C,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,
-0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
-0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x25,0x03,0x03,0x02,0x06,0x01,0x05,0x00,0x06,0x01,0x04,0x02,0x24,0x03,
-0x01,0x02,0x1F,0x00,0x01,0x02,0x24,0x03,0x04,0x02,0x06,0x01,0x04,0x00,0x06,0x01,
-0x04,0x02,0x25,0x03,0x5D,0x00,0x01,0x02,0x1D,0x03,0x02,0x02,0x03,0x01,0x1C,0x00,
-0x02,0x01,0x03,0x02,0x1D,0x03,0x20,0x00,0x01,0x01,0x1D,0x03,0x02,0x02,0x03,0x01,
-0x1C,0x00,0x03,0x01,0x02,0x02,0x1D,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,0x16,0x03,
-0x02,0x02,0x02,0x01,0x2A,0x00,0x01,0x01,0x02,0x02,0x17,0x03,0x01,0x01,0x21,0x00,
-0x01,0x01,0x16,0x03,0x02,0x02,0x02,0x01,0x2A,0x00,0x02,0x01,0x02,0x02,0x16,0x03,
-0x01,0x02,0x60,0x00,0x01,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0x35,0x00,0x02,0x01,
-0x02,0x02,0x0F,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x10,0x03,0x02,0x02,0x01,0x01,
-0x36,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x02,0x02,
-0x04,0x03,0x03,0x02,0x02,0x01,0x41,0x00,0x03,0x01,0x02,0x02,0x04,0x03,0x02,0x02,
-0x01,0x01,0x28,0x00,0x02,0x01,0x01,0x02,0x04,0x03,0x03,0x02,0x02,0x01,0x42,0x00,
-0x02,0x01,0x03,0x02,0x04,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xB0,0x00,
+// Frame 11: Diff RLE (856 bytes)
+static const uint8_t HAPPY_FRAME11_DATA[856] = {
+0x28,0x00,0x03,0x01,0x04,0x02,0x07,0x03,0x05,0x02,0x02,0x01,0x6C,0x00,0x03,0x01,
+0x05,0x02,0x07,0x03,0x04,0x02,0x03,0x01,0x4B,0x00,0x01,0x01,0x02,0x02,0x19,0x03,
+0x02,0x02,0x02,0x01,0x61,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,
+0x42,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
+0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x35,0x00,
+0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,
+0x01,0x02,0x31,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,
+0x34,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,
+0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,
+0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,
+0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x22,0x00,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x1E,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x19,0x00,
+0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x17,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
+0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x13,0x00,
+0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x11,0x00,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x59,0x03,0x0B,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x01,0x08,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
+0x5F,0x03,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,
+0x04,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x03,0x00,
+0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,
+0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,
+0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x01,
+0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x00,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,
+0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x25,0x03,0x03,0x02,
+0x06,0x01,0x05,0x00,0x06,0x01,0x04,0x02,0x24,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
+0x24,0x03,0x04,0x02,0x06,0x01,0x04,0x00,0x06,0x01,0x04,0x02,0x25,0x03,0x04,0x00,
+0x01,0x02,0x1D,0x03,0x02,0x02,0x03,0x01,0x1C,0x00,0x02,0x01,0x03,0x02,0x1D,0x03,
+0x20,0x00,0x01,0x01,0x1D,0x03,0x02,0x02,0x03,0x01,0x1C,0x00,0x03,0x01,0x02,0x02,
+0x1D,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0x2A,0x00,
+0x01,0x01,0x02,0x02,0x17,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x16,0x03,0x02,0x02,
+0x02,0x01,0x2A,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x01,0x02,0x07,0x00,0x01,0x02,
+0x0F,0x03,0x02,0x02,0x02,0x01,0x35,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,
+0x24,0x00,0x01,0x01,0x10,0x03,0x02,0x02,0x01,0x01,0x36,0x00,0x02,0x01,0x01,0x02,
+0x10,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x02,0x02,0x04,0x03,0x03,0x02,0x02,0x01,
+0x41,0x00,0x03,0x01,0x02,0x02,0x04,0x03,0x02,0x02,0x01,0x01,0x28,0x00,0x02,0x01,
+0x01,0x02,0x04,0x03,0x03,0x02,0x02,0x01,0x42,0x00,0x02,0x01,0x03,0x02,0x04,0x03,
+0x02,0x02,0x01,0x01,0xFF,0x00,0xD5,0x00,
 };
 static const DiffBlock HAPPY_FRAME11_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 73,  // Changed box top-left
+    231, 47,  // Changed box dimensions
     HAPPY_FRAME11_DATA
 };
 
-// Frame 12: Full frame RLE (1294 bytes)
-static const uint8_t HAPPY_FRAME12_DATA[1294] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x64,0x00,
-0x02,0x01,0x05,0x02,0x05,0x03,0x05,0x02,0x03,0x01,0x6D,0x00,0x03,0x01,0x04,0x02,
-0x06,0x03,0x04,0x02,0x03,0x01,0xA6,0x00,0x01,0x01,0x02,0x02,0x17,0x03,0x02,0x02,
-0x02,0x01,0x63,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x9D,0x00,
-0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x02,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x92,0x00,0x01,0x01,
-0x2D,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x8D,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,
-0x01,0x01,0x89,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,
-0x36,0x03,0x01,0x01,0x85,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x01,0x81,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x02,0x7F,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x40,0x00,
-0x01,0x01,0x40,0x03,0x01,0x01,0x7C,0x00,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
-0x42,0x03,0x01,0x02,0x79,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,
-0x45,0x03,0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x01,0x01,
-0x74,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
-0x72,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x70,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x6E,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x6C,0x00,0x53,0x03,0x01,0x01,
-0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x2B,0x00,0x56,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x29,0x00,
-0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x61,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x61,0x00,
-0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x60,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,0x5F,0x03,0x01,0x01,
-0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x02,0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x02,0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x60,0x00,
-0x26,0x03,0x04,0x02,0x09,0x01,0x04,0x02,0x26,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x25,0x03,0x05,0x02,0x08,0x01,0x05,0x02,0x25,0x03,0x01,0x02,0x61,0x00,0x01,0x02,
-0x1E,0x03,0x02,0x02,0x02,0x01,0x17,0x00,0x02,0x01,0x03,0x02,0x1E,0x03,0x24,0x00,
-0x01,0x01,0x1E,0x03,0x02,0x02,0x03,0x01,0x16,0x00,0x03,0x01,0x02,0x02,0x1E,0x03,
-0x01,0x02,0x62,0x00,0x18,0x03,0x02,0x02,0x02,0x01,0x24,0x00,0x02,0x01,0x01,0x02,
-0x18,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,0x24,0x00,
-0x02,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
-0x02,0x02,0x01,0x01,0x2F,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x01,0x27,0x00,
-0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x2F,0x00,0x01,0x01,0x02,0x02,0x11,0x03,
-0x01,0x02,0x66,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x02,0x01,0x39,0x00,0x02,0x01,
-0x02,0x02,0x0A,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x02,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
-0x04,0x01,0x47,0x00,0x05,0x01,0x31,0x00,0x04,0x01,0x48,0x00,0x04,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xBF,0x00,
+// Frame 12: Diff RLE (880 bytes)
+static const uint8_t HAPPY_FRAME12_DATA[880] = {
+0x29,0x00,0x02,0x01,0x05,0x02,0x05,0x03,0x05,0x02,0x03,0x01,0x6D,0x00,0x03,0x01,
+0x04,0x02,0x06,0x03,0x04,0x02,0x03,0x01,0x4D,0x00,0x01,0x01,0x02,0x02,0x17,0x03,
+0x02,0x02,0x02,0x01,0x63,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x02,0x01,
+0x44,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,
+0x01,0x02,0x20,0x03,0x01,0x02,0x02,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x2D,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
+0x01,0x01,0x34,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,
+0x32,0x03,0x01,0x01,0x30,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
+0x01,0x01,0x36,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,
+0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,
+0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
+0x40,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x23,0x00,0x43,0x03,0x01,0x01,0x3D,0x00,
+0x01,0x02,0x42,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,
+0x01,0x02,0x45,0x03,0x1E,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x01,0x19,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
+0x17,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,
+0x15,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x13,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x13,0x00,0x53,0x03,
+0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x54,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x55,0x03,
+0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
+0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x29,0x00,0x58,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x0A,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x08,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x07,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x07,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x06,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x06,0x00,0x5F,0x03,
+0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x06,0x00,0x5F,0x03,0x01,0x01,
+0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x06,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x06,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x02,0x06,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x06,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x06,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x02,0x06,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,
+0x07,0x00,0x26,0x03,0x04,0x02,0x09,0x01,0x04,0x02,0x26,0x03,0x01,0x01,0x23,0x00,
+0x01,0x02,0x25,0x03,0x05,0x02,0x08,0x01,0x05,0x02,0x25,0x03,0x01,0x02,0x08,0x00,
+0x01,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0x17,0x00,0x02,0x01,0x03,0x02,0x1E,0x03,
+0x24,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,0x03,0x01,0x16,0x00,0x03,0x01,0x02,0x02,
+0x1E,0x03,0x01,0x02,0x09,0x00,0x18,0x03,0x02,0x02,0x02,0x01,0x24,0x00,0x02,0x01,
+0x01,0x02,0x18,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,
+0x24,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x11,0x03,0x02,0x02,0x01,0x01,0x2F,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x01,
+0x27,0x00,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x2F,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x02,0x01,0x39,0x00,
+0x02,0x01,0x02,0x02,0x0A,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x02,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x12,0x00,0x04,0x01,0x47,0x00,0x05,0x01,0x31,0x00,0x04,0x01,0x48,0x00,0x04,0x01,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4A,0x00,
+
 };
 static const DiffBlock HAPPY_FRAME12_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 63,  // Changed box top-left
+    231, 55,  // Changed box dimensions
     HAPPY_FRAME12_DATA
 };
 
-// Frame 13: Full frame RLE (1312 bytes)
-static const uint8_t HAPPY_FRAME13_DATA[1312] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x21,0x00,0x03,0x01,0x07,0x02,0x03,0x01,0x74,0x00,0x03,0x01,0x08,0x02,
-0x03,0x01,0xAB,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x68,0x00,
-0x02,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x02,0x01,0xA1,0x00,0x01,0x01,0x01,0x02,
-0x1D,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,
-0x01,0x01,0x9A,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x94,0x00,0x01,0x01,0x01,0x02,
-0x29,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x01,0x90,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x8B,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,
-0x32,0x03,0x01,0x02,0x01,0x01,0x87,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,
-0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x85,0x00,0x01,0x02,0x39,0x03,0x01,0x02,
-0x46,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x81,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,
-0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x7F,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x7C,0x00,0x01,0x02,0x42,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7A,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,
-0x01,0x02,0x48,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x72,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,
-0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,
-0x01,0x01,0x6B,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
-0x6A,0x00,0x01,0x02,0x54,0x03,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x68,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,
-0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x66,0x00,
-0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x66,0x00,0x01,0x02,0x58,0x03,
-0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
-0x27,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x61,0x00,
-0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,0x5D,0x03,
-0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,0x5D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x61,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x61,0x00,0x01,0x01,0x2B,0x03,0x05,0x02,0x2B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
-0x2A,0x03,0x06,0x02,0x2B,0x03,0x01,0x01,0x62,0x00,0x01,0x02,0x20,0x03,0x02,0x02,
-0x02,0x01,0x11,0x00,0x02,0x01,0x03,0x02,0x20,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
-0x20,0x03,0x02,0x02,0x03,0x01,0x10,0x00,0x03,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x63,0x00,0x01,0x01,0x1A,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,0x02,0x01,0x02,0x02,
-0x19,0x03,0x01,0x02,0x27,0x00,0x1A,0x03,0x02,0x02,0x02,0x01,0x1E,0x00,0x02,0x01,
-0x02,0x02,0x1A,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x13,0x03,0x02,0x02,0x02,0x01,
-0x29,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x29,0x00,0x14,0x03,0x02,0x02,
-0x02,0x01,0x29,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x01,0x01,0x66,0x00,0x01,0x01,
-0x0D,0x03,0x02,0x02,0x02,0x01,0x33,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,
-0x2B,0x00,0x01,0x02,0x0D,0x03,0x02,0x02,0x01,0x01,0x34,0x00,0x02,0x01,0x02,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0x3F,0x00,
-0x02,0x01,0x07,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x06,0x02,0x03,0x01,0x3E,0x00,
-0x03,0x01,0x06,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC2,0x00,
-
+// Frame 13: Diff RLE (892 bytes)
+static const uint8_t HAPPY_FRAME13_DATA[892] = {
+0x29,0x00,0x03,0x01,0x07,0x02,0x03,0x01,0x74,0x00,0x03,0x01,0x08,0x02,0x03,0x01,
+0x4C,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x68,0x00,0x02,0x01,
+0x01,0x02,0x14,0x03,0x01,0x02,0x02,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,
+0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,
+0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
+0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
+0x01,0x02,0x2E,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x2C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,
+0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,
+0x01,0x02,0x36,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x46,0x00,
+0x01,0x01,0x3A,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x43,0x00,
+0x01,0x02,0x3C,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x40,0x00,
+0x01,0x01,0x40,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x3D,0x00,
+0x01,0x01,0x42,0x03,0x01,0x02,0x1B,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,
+0x44,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x46,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,
+0x4A,0x03,0x01,0x02,0x13,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x11,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x02,0x0F,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,
+0x0C,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x02,0x54,0x03,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x07,0x00,0x01,0x01,
+0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x07,0x00,0x01,0x02,0x58,0x03,0x28,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,
+0x5A,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x01,0x04,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x03,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x02,0x00,
+0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x02,0x00,0x5D,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x02,0x00,0x5D,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x02,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x02,0x02,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x02,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x02,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x2B,0x03,0x05,0x02,0x2B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x2A,0x03,
+0x06,0x02,0x2B,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x20,0x03,0x02,0x02,0x02,0x01,
+0x11,0x00,0x02,0x01,0x03,0x02,0x20,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x20,0x03,
+0x02,0x02,0x03,0x01,0x10,0x00,0x03,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x04,0x00,
+0x01,0x01,0x1A,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,0x02,0x01,0x02,0x02,0x19,0x03,
+0x01,0x02,0x27,0x00,0x1A,0x03,0x02,0x02,0x02,0x01,0x1E,0x00,0x02,0x01,0x02,0x02,
+0x1A,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x13,0x03,0x02,0x02,0x02,0x01,0x29,0x00,
+0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x29,0x00,0x14,0x03,0x02,0x02,0x02,0x01,
+0x29,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x0D,0x03,
+0x02,0x02,0x02,0x01,0x33,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x02,0x0D,0x03,0x02,0x02,0x01,0x01,0x34,0x00,0x02,0x01,0x02,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0x3F,0x00,0x02,0x01,
+0x07,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x06,0x02,0x03,0x01,0x3E,0x00,0x03,0x01,
+0x06,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x8D,0x00,
 };
 static const DiffBlock HAPPY_FRAME13_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    47, 58,  // Changed box top-left
+    225, 52,  // Changed box dimensions
     HAPPY_FRAME13_DATA
 };
 
-// Frame 14: Full frame RLE (1342 bytes)
-static const uint8_t HAPPY_FRAME14_DATA[1342] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x5C,0x00,0x03,0x01,0x09,0x02,
-0x03,0x01,0x72,0x00,0x04,0x01,0x09,0x02,0x03,0x01,0xAA,0x00,0x01,0x01,0x02,0x02,
-0x14,0x03,0x01,0x02,0x02,0x01,0x67,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,
-0x01,0x01,0xA1,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x60,0x00,
-0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x9A,0x00,0x01,0x01,0x01,0x02,
-0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,
-0x95,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x01,0x91,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,
-0x2E,0x03,0x01,0x01,0x8D,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x01,0x32,0x03,0x01,0x01,0x89,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4A,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x01,0x85,0x00,0x01,0x01,0x39,0x03,0x01,0x01,
-0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x83,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x44,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x80,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x7D,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
-0x3F,0x00,0x01,0x02,0x41,0x03,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3C,0x00,
-0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
-0x39,0x00,0x48,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x37,0x00,
-0x4A,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,
-0x4B,0x03,0x01,0x01,0x71,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x70,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x6E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
-0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x01,0x01,
-0x6B,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x6A,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
-0x69,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x67,0x00,0x57,0x03,
-0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x29,0x00,0x58,0x03,0x66,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x25,0x03,
-0x03,0x02,0x0A,0x01,0x02,0x02,0x26,0x03,0x26,0x00,0x01,0x01,0x25,0x03,0x03,0x02,
-0x0A,0x01,0x03,0x02,0x25,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x1E,0x03,0x01,0x02,
-0x02,0x01,0x17,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
-0x1D,0x03,0x02,0x02,0x02,0x01,0x16,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,
-0x65,0x00,0x01,0x01,0x18,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x02,0x02,
-0x17,0x03,0x01,0x02,0x29,0x00,0x18,0x03,0x01,0x02,0x02,0x01,0x22,0x00,0x02,0x01,
-0x01,0x02,0x18,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,
-0x2C,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x12,0x03,
-0x02,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x01,0x01,0x68,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x02,0x02,0x02,0x01,0x35,0x00,0x02,0x01,0x02,0x02,
-0x0B,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x0B,0x03,0x02,0x02,0x01,0x01,0x36,0x00,
-0x02,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x07,0x01,0x41,0x00,
-0x04,0x01,0x01,0x02,0x03,0x01,0x31,0x00,0x08,0x01,0x40,0x00,0x08,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x47,0x00,
+// Frame 14: Diff RLE (892 bytes)
+static const uint8_t HAPPY_FRAME14_DATA[892] = {
+0x27,0x00,0x03,0x01,0x09,0x02,0x03,0x01,0x72,0x00,0x04,0x01,0x09,0x02,0x03,0x01,
+0x49,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x02,0x01,0x67,0x00,0x01,0x01,
+0x02,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,
+0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x02,
+0x24,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x56,0x00,
+0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x01,0x30,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,
+0x01,0x01,0x51,0x00,0x01,0x01,0x2E,0x03,0x01,0x01,0x2C,0x00,0x01,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x01,0x28,0x00,0x01,0x01,
+0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x01,0x24,0x00,
+0x01,0x01,0x39,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x22,0x00,
+0x01,0x02,0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x41,0x03,0x1A,0x00,0x01,0x01,
+0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x17,0x00,
+0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x01,0x01,0x13,0x00,0x01,0x02,
+0x49,0x03,0x01,0x02,0x37,0x00,0x4A,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x4B,0x03,
+0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x10,0x00,0x4D,0x03,0x01,0x01,
+0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x0F,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,
+0x01,0x02,0x4E,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,
+0x01,0x01,0x50,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x02,0x51,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,
+0x01,0x01,0x54,0x03,0x01,0x01,0x08,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,
+0x54,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,
+0x01,0x01,0x06,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x05,0x00,0x01,0x02,
+0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x03,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x02,0x00,0x01,0x02,
+0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x5A,0x03,
+0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
+0x5B,0x03,0x02,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,
+0x02,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x02,0x01,
+0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x02,0x01,0x5B,0x03,
+0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x02,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x25,0x03,0x03,0x02,0x0A,0x01,0x02,0x02,
+0x26,0x03,0x26,0x00,0x01,0x01,0x25,0x03,0x03,0x02,0x0A,0x01,0x03,0x02,0x25,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x1E,0x03,0x01,0x02,0x02,0x01,0x17,0x00,0x02,0x01,
+0x02,0x02,0x1D,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,
+0x16,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x18,0x03,
+0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x29,0x00,
+0x18,0x03,0x01,0x02,0x02,0x01,0x22,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x2C,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x12,0x03,0x02,0x02,0x01,0x01,0x2C,0x00,
+0x01,0x01,0x02,0x02,0x12,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x02,0x02,0x02,0x01,0x35,0x00,0x02,0x01,0x02,0x02,0x0B,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x02,0x0B,0x03,0x02,0x02,0x01,0x01,0x36,0x00,0x02,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x07,0x01,0x41,0x00,0x04,0x01,0x01,0x02,0x03,0x01,
+0x31,0x00,0x08,0x01,0x40,0x00,0x08,0x01,0xFF,0x00,0xC6,0x00,
 };
 static const DiffBlock HAPPY_FRAME14_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    48, 55,  // Changed box top-left
+    223, 51,  // Changed box dimensions
     HAPPY_FRAME14_DATA
 };
 
-// Frame 15: Full frame RLE (1320 bytes)
-static const uint8_t HAPPY_FRAME15_DATA[1320] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xDC,0x00,0x09,0x01,0x78,0x00,0x0A,0x01,0xAE,0x00,0x02,0x01,
-0x02,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0x6A,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,
-0x03,0x02,0x02,0x01,0xA3,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,
-0x63,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x9C,0x00,0x01,0x01,
-0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x02,0x02,0x21,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,
-0x01,0x02,0x27,0x03,0x01,0x01,0x93,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x01,0x2C,0x03,0x01,0x02,0x8F,0x00,0x01,0x02,0x30,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x8B,0x00,0x01,0x02,0x33,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x34,0x03,0x01,0x01,0x87,0x00,0x01,0x01,0x37,0x03,0x01,0x02,
-0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x84,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,
-0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x7F,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
-0x41,0x00,0x40,0x03,0x01,0x01,0x7C,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,
-0x42,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x44,0x03,0x01,0x02,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x48,0x03,0x38,0x00,0x01,0x01,0x48,0x03,
-0x01,0x01,0x74,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
-0x72,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4D,0x03,0x70,0x00,
-0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,
-0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x69,0x00,
-0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x01,
-0x55,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x67,0x00,0x01,0x02,
-0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x66,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x27,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,
-0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x63,0x00,
-0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x5B,0x03,
-0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x5B,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,
-0x63,0x00,0x01,0x01,0x22,0x03,0x03,0x02,0x03,0x01,0x0A,0x00,0x03,0x01,0x02,0x02,
-0x22,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x22,0x03,0x02,0x02,0x03,0x01,0x0A,0x00,
-0x03,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x1B,0x03,0x02,0x02,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x28,0x00,0x01,0x01,0x1C,0x03,
-0x01,0x02,0x02,0x01,0x1A,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,0x66,0x00,
-0x16,0x03,0x02,0x02,0x01,0x01,0x25,0x00,0x02,0x01,0x01,0x02,0x16,0x03,0x01,0x01,
-0x29,0x00,0x01,0x02,0x16,0x03,0x01,0x02,0x02,0x01,0x25,0x00,0x01,0x01,0x01,0x02,
-0x16,0x03,0x01,0x02,0x68,0x00,0x11,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x02,0x02,0x10,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,
-0x2E,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x09,0x03,
-0x02,0x02,0x02,0x01,0x38,0x00,0x01,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x2E,0x00,
-0x01,0x01,0x01,0x02,0x09,0x03,0x02,0x02,0x01,0x01,0x38,0x00,0x02,0x01,0x01,0x02,
-0x09,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x04,0x01,0x45,0x00,0x04,0x01,0x35,0x00,
-0x04,0x01,0x44,0x00,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x8A,0x00,
+// Frame 15: Diff RLE (900 bytes)
+static const uint8_t HAPPY_FRAME15_DATA[900] = {
+0x2A,0x00,0x09,0x01,0x78,0x00,0x0A,0x01,0x4D,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,
+0x02,0x02,0x02,0x01,0x6A,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,
+0x42,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
+0x01,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x01,0x02,0x01,0x01,0x5D,0x00,0x02,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
+0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x01,0x32,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
+0x2C,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
+0x30,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,
+0x34,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x49,0x00,0x01,0x02,
+0x37,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
+0x3A,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,
+0x19,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
+0x17,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x15,0x00,0x01,0x02,0x48,0x03,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x13,0x00,
+0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x11,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4D,0x03,0x0F,0x00,0x4F,0x03,0x01,0x01,
+0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
+0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x2F,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x2C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x08,0x00,0x55,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
+0x2B,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
+0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x01,0x02,0x57,0x03,0x05,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,
+0x58,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
+0x58,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,
+0x01,0x01,0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x02,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
+0x22,0x03,0x03,0x02,0x03,0x01,0x0A,0x00,0x03,0x01,0x02,0x02,0x22,0x03,0x01,0x01,
+0x27,0x00,0x01,0x02,0x22,0x03,0x02,0x02,0x03,0x01,0x0A,0x00,0x03,0x01,0x02,0x02,
+0x22,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x02,0x02,0x1C,0x03,0x28,0x00,0x01,0x01,0x1C,0x03,0x01,0x02,0x02,0x01,
+0x1A,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,0x05,0x00,0x16,0x03,0x02,0x02,
+0x01,0x01,0x25,0x00,0x02,0x01,0x01,0x02,0x16,0x03,0x01,0x01,0x29,0x00,0x01,0x02,
+0x16,0x03,0x01,0x02,0x02,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x02,
+0x07,0x00,0x11,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x02,0x02,0x10,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x2E,0x00,0x02,0x01,
+0x01,0x02,0x10,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x09,0x03,0x02,0x02,0x02,0x01,
+0x38,0x00,0x01,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,
+0x09,0x03,0x02,0x02,0x01,0x01,0x38,0x00,0x02,0x01,0x01,0x02,0x09,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x04,0x01,0x45,0x00,0x04,0x01,0x35,0x00,0x04,0x01,0x44,0x00,
+0x04,0x01,0xE8,0x00,
 };
 static const DiffBlock HAPPY_FRAME15_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    48, 53,  // Changed box top-left
+    223, 51,  // Changed box dimensions
     HAPPY_FRAME15_DATA
 };
 
-// Frame 16: Full frame RLE (1324 bytes)
-static const uint8_t HAPPY_FRAME16_DATA[1324] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xD6,0x00,0x03,0x01,0x03,0x02,0x0A,0x03,0x03,0x02,0x02,0x01,
-0x6D,0x00,0x02,0x01,0x03,0x02,0x0A,0x03,0x03,0x02,0x02,0x01,0xA6,0x00,0x01,0x01,
-0x02,0x02,0x17,0x03,0x02,0x02,0x01,0x01,0x64,0x00,0x02,0x01,0x01,0x02,0x18,0x03,
-0x01,0x02,0x02,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x26,0x03,0x01,0x02,
-0x94,0x00,0x01,0x01,0x2B,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x2A,0x03,0x01,0x02,
-0x01,0x01,0x8F,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,0x33,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,
-0x32,0x03,0x01,0x02,0x89,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x01,
-0x36,0x03,0x01,0x02,0x85,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x02,
-0x39,0x03,0x01,0x01,0x82,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x01,0x3C,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x41,0x00,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x7D,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x02,0x40,0x03,0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3D,0x00,
-0x01,0x02,0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,
-0x01,0x02,0x45,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,
-0x48,0x03,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,
-0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x72,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x70,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x6E,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6E,0x00,0x01,0x02,0x50,0x03,
-0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x52,0x03,
-0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x54,0x03,0x2C,0x00,
-0x01,0x01,0x54,0x03,0x01,0x01,0x69,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,
-0x01,0x01,0x67,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x66,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x64,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,
-0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,
-0x26,0x03,0x04,0x02,0x06,0x01,0x04,0x02,0x25,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
-0x25,0x03,0x04,0x02,0x06,0x01,0x04,0x02,0x25,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x1E,0x03,0x01,0x02,0x02,0x01,0x15,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x28,0x00,
-0x01,0x01,0x1E,0x03,0x02,0x02,0x02,0x01,0x14,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,
-0x01,0x01,0x65,0x00,0x01,0x01,0x19,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
-0x02,0x02,0x18,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,
-0x20,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x67,0x00,0x01,0x01,0x13,0x03,0x01,0x02,
-0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,
-0x12,0x03,0x02,0x02,0x01,0x01,0x2A,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x69,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,0x01,0x01,0x33,0x00,0x02,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x0C,0x03,0x02,0x02,0x01,0x01,0x34,0x00,
-0x01,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,0x06,0x02,0x02,0x01,
-0x3E,0x00,0x02,0x01,0x06,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x06,0x02,0x02,0x01,
-0x3E,0x00,0x02,0x01,0x06,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC9,0x00,
+// Frame 16: Diff RLE (866 bytes)
+static const uint8_t HAPPY_FRAME16_DATA[866] = {
+0x23,0x00,0x03,0x01,0x03,0x02,0x0A,0x03,0x03,0x02,0x02,0x01,0x6D,0x00,0x02,0x01,
+0x03,0x02,0x0A,0x03,0x03,0x02,0x02,0x01,0x43,0x00,0x01,0x01,0x02,0x02,0x17,0x03,
+0x02,0x02,0x01,0x01,0x64,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,
+0x02,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x25,0x03,
+0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x26,0x03,0x01,0x02,0x31,0x00,0x01,0x01,
+0x2B,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,
+0x01,0x01,0x2F,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x28,0x00,0x01,0x01,0x33,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,0x01,0x02,
+0x26,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x02,
+0x22,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x39,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,
+0x01,0x01,0x1C,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,
+0x01,0x02,0x1A,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x40,0x03,
+0x01,0x02,0x18,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,0x43,0x03,
+0x01,0x01,0x15,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x45,0x03,
+0x01,0x01,0x13,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x12,0x00,
+0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,0x10,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x0F,0x00,0x4D,0x03,
+0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x02,0x31,0x00,0x50,0x03,0x0B,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,
+0x52,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x54,0x03,0x2C,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x06,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x04,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x03,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x59,0x03,0x01,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x01,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x01,0x02,
+0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x02,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x5A,0x03,0x02,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
+0x02,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x02,0x02,0x5A,0x03,
+0x26,0x00,0x01,0x01,0x5A,0x03,0x02,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x02,0x01,0x59,0x03,
+0x01,0x02,0x27,0x00,0x5A,0x03,0x02,0x01,0x26,0x03,0x04,0x02,0x06,0x01,0x04,0x02,
+0x25,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x25,0x03,0x04,0x02,0x06,0x01,0x04,0x02,
+0x25,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0x15,0x00,
+0x02,0x01,0x02,0x02,0x1E,0x03,0x28,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,0x02,0x01,
+0x14,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x19,0x03,
+0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x29,0x00,
+0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,0x20,0x00,0x02,0x01,0x01,0x02,0x19,0x03,
+0x04,0x00,0x01,0x01,0x13,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,
+0x13,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x2A,0x00,
+0x02,0x01,0x01,0x02,0x13,0x03,0x06,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,
+0x01,0x01,0x33,0x00,0x02,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,
+0x0C,0x03,0x02,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x06,0x02,0x02,0x01,0x3E,0x00,0x02,0x01,0x06,0x02,0x01,0x01,
+0x31,0x00,0x01,0x01,0x06,0x02,0x02,0x01,0x3E,0x00,0x02,0x01,0x06,0x02,0x01,0x01,
+0xE3,0x00,
 };
 static const DiffBlock HAPPY_FRAME16_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    49, 53,  // Changed box top-left
+    221, 50,  // Changed box dimensions
     HAPPY_FRAME16_DATA
 };
 
-// Frame 17: Full frame RLE (1320 bytes)
-static const uint8_t HAPPY_FRAME17_DATA[1320] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x99,0x00,0x04,0x01,0x05,0x02,0x04,0x01,0x75,0x00,0x04,0x01,0x04,0x02,
-0x05,0x01,0xAB,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x69,0x00,
-0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0xA2,0x00,0x01,0x01,0x01,0x02,
-0x1B,0x03,0x02,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x02,0x02,0x1B,0x03,0x01,0x02,
-0x01,0x01,0x9C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,
-0x27,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x02,0x28,0x03,0x01,0x02,0x92,0x00,
-0x01,0x01,0x2D,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x8D,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,
-0x01,0x02,0x8B,0x00,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x34,0x03,
-0x01,0x02,0x87,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x49,0x00,0x38,0x03,0x01,0x01,
-0x84,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,
-0x81,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x3D,0x03,0x7F,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,
-0x44,0x03,0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x48,0x03,
-0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x71,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
-0x01,0x01,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
-0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,
-0x69,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,
-0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x66,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x29,0x00,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,
-0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,
-0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,
-0x63,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x65,0x00,
-0x01,0x02,0x22,0x03,0x02,0x02,0x04,0x01,0x07,0x00,0x04,0x01,0x03,0x02,0x22,0x03,
-0x01,0x01,0x27,0x00,0x01,0x01,0x22,0x03,0x02,0x02,0x04,0x01,0x08,0x00,0x04,0x01,
-0x02,0x02,0x22,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x1C,0x03,0x01,0x02,0x02,0x01,
-0x19,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x01,0x02,0x29,0x00,0x1C,0x03,0x02,0x02,
-0x01,0x01,0x1A,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x67,0x00,0x01,0x02,0x16,0x03,
-0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x16,0x03,0x02,0x02,0x01,0x01,0x24,0x00,0x02,0x01,0x01,0x02,0x16,0x03,
-0x01,0x02,0x68,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x2E,0x00,0x01,0x01,
-0x01,0x02,0x11,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,
-0x2E,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x0A,0x03,
-0x02,0x02,0x01,0x01,0x37,0x00,0x02,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x2F,0x00,
-0x01,0x02,0x09,0x03,0x02,0x02,0x02,0x01,0x37,0x00,0x01,0x01,0x02,0x02,0x09,0x03,
-0x01,0x02,0x01,0x01,0x6E,0x00,0x05,0x01,0x43,0x00,0x05,0x01,0x35,0x00,0x05,0x01,
-0x43,0x00,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCA,0x00,
+// Frame 17: Diff RLE (878 bytes)
+static const uint8_t HAPPY_FRAME17_DATA[878] = {
+0x27,0x00,0x04,0x01,0x05,0x02,0x04,0x01,0x75,0x00,0x04,0x01,0x04,0x02,0x05,0x01,
+0x48,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x69,0x00,0x01,0x01,
+0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,
+0x02,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x02,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x02,0x28,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,
+0x2D,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,
+0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,
+0x28,0x00,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x34,0x03,0x01,0x02,
+0x24,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x49,0x00,0x38,0x03,0x01,0x01,0x21,0x00,
+0x01,0x02,0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x1E,0x00,
+0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x3D,0x03,0x1C,0x00,0x01,0x01,
+0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
+0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x44,0x03,
+0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x46,0x03,0x01,0x01,
+0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x48,0x03,0x38,0x00,
+0x01,0x01,0x48,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,
+0x4A,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x0E,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
+0x09,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x07,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x06,0x00,
+0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x05,0x00,0x01,0x02,
+0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x04,0x00,0x57,0x03,
+0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x29,0x00,0x58,0x03,0x03,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x29,0x00,
+0x58,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,
+0x59,0x03,0x01,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,
+0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x01,0x02,0x5A,0x03,
+0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x01,0x02,0x5A,0x03,
+0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x02,0x01,0x59,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x59,0x03,0x02,0x00,0x01,0x02,0x22,0x03,0x02,0x02,0x04,0x01,
+0x07,0x00,0x04,0x01,0x03,0x02,0x22,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x22,0x03,
+0x02,0x02,0x04,0x01,0x08,0x00,0x04,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x00,
+0x01,0x01,0x1C,0x03,0x01,0x02,0x02,0x01,0x19,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,
+0x01,0x02,0x29,0x00,0x1C,0x03,0x02,0x02,0x01,0x01,0x1A,0x00,0x02,0x01,0x01,0x02,
+0x1C,0x03,0x04,0x00,0x01,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,
+0x01,0x02,0x17,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x16,0x03,0x02,0x02,0x01,0x01,
+0x24,0x00,0x02,0x01,0x01,0x02,0x16,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x10,0x03,
+0x01,0x02,0x02,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x02,0x02,0x10,0x03,
+0x01,0x02,0x07,0x00,0x01,0x01,0x0A,0x03,0x02,0x02,0x01,0x01,0x37,0x00,0x02,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x09,0x03,0x02,0x02,0x02,0x01,
+0x37,0x00,0x01,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x05,0x01,
+0x43,0x00,0x05,0x01,0x35,0x00,0x05,0x01,0x43,0x00,0x05,0x01,0x07,0x00,
 };
 static const DiffBlock HAPPY_FRAME17_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    49, 52,  // Changed box top-left
+    221, 50,  // Changed box dimensions
     HAPPY_FRAME17_DATA
 };
 
-// Frame 18: Full frame RLE (1342 bytes)
-static const uint8_t HAPPY_FRAME18_DATA[1342] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x98,0x00,0x04,0x01,0x08,0x02,0x03,0x01,0x73,0x00,0x03,0x01,0x08,0x02,
-0x03,0x01,0xAB,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x68,0x00,
-0x02,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0xA1,0x00,0x01,0x01,0x02,0x02,
-0x1C,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,
-0x02,0x01,0x9A,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x91,0x00,
-0x01,0x01,0x2D,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0x8D,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x8A,0x00,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x34,0x03,0x01,0x02,0x87,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x38,0x03,0x01,0x01,0x83,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x3A,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x02,
-0x3D,0x03,0x01,0x01,0x7E,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x40,0x03,0x01,0x01,0x7C,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,
-0x01,0x01,0x7A,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,
-0x01,0x02,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x76,0x00,0x01,0x02,0x48,0x03,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,
-0x74,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x72,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,
-0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
-0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6C,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6C,0x00,
-0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x69,0x00,
-0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x68,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,
-0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x66,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x27,0x00,0x01,0x02,0x59,0x03,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,
-0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,
-0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,
-0x01,0x01,0x63,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x65,0x00,0x01,0x02,0x21,0x03,0x02,0x02,0x04,0x01,0x0A,0x00,0x03,0x01,
+// Frame 18: Diff RLE (876 bytes)
+static const uint8_t HAPPY_FRAME18_DATA[876] = {
+0x26,0x00,0x04,0x01,0x08,0x02,0x03,0x01,0x73,0x00,0x03,0x01,0x08,0x02,0x03,0x01,
+0x47,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x68,0x00,0x02,0x01,
+0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x3D,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,
+0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,
+0x36,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x57,0x00,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x2D,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x29,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,
+0x01,0x01,0x26,0x00,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,
+0x01,0x02,0x23,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x38,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x3D,0x03,
+0x01,0x01,0x1A,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x40,0x03,
+0x01,0x01,0x18,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,
+0x16,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
+0x14,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x12,0x00,0x01,0x02,0x48,0x03,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x10,0x00,
+0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x0C,0x00,
+0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x08,0x00,0x01,0x02,
+0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x53,0x03,
+0x01,0x02,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x02,
+0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x04,0x00,0x01,0x01,
+0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x04,0x00,0x01,0x02,
+0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x03,0x00,0x57,0x03,
+0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x29,0x00,0x58,0x03,0x02,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x28,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,
+0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x02,0x5A,0x03,0x26,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,
+0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x5A,0x03,
+0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x59,0x03,0x01,0x02,
+0x27,0x00,0x5A,0x03,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x00,0x01,0x02,0x21,0x03,0x02,0x02,0x04,0x01,0x0A,0x00,0x03,0x01,
 0x02,0x02,0x22,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x21,0x03,0x03,0x02,0x03,0x01,
-0x0A,0x00,0x03,0x01,0x03,0x02,0x21,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x1B,0x03,
+0x0A,0x00,0x03,0x01,0x03,0x02,0x21,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x1B,0x03,
 0x02,0x02,0x01,0x01,0x1B,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x29,0x00,
-0x1C,0x03,0x01,0x02,0x02,0x01,0x1A,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x67,0x00,
+0x1C,0x03,0x01,0x02,0x02,0x01,0x1A,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x03,0x00,
 0x01,0x02,0x15,0x03,0x02,0x02,0x01,0x01,0x25,0x00,0x02,0x01,0x01,0x02,0x15,0x03,
 0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x16,0x03,0x01,0x02,0x01,0x01,0x26,0x00,
-0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x01,0x68,0x00,0x01,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x10,0x03,0x01,0x02,
 0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
 0x10,0x03,0x02,0x02,0x01,0x01,0x2E,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x02,0x01,0x38,0x00,0x01,0x01,
+0x06,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x02,0x01,0x38,0x00,0x01,0x01,
 0x02,0x02,0x09,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x09,0x03,0x02,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x70,0x00,0x03,0x01,0x45,0x00,
-0x04,0x01,0x35,0x00,0x04,0x01,0x44,0x00,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCB,0x00,
+0x38,0x00,0x01,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x0C,0x00,0x03,0x01,0x45,0x00,
+0x04,0x01,0x35,0x00,0x04,0x01,0x44,0x00,0x04,0x01,0x07,0x00,
 };
 static const DiffBlock HAPPY_FRAME18_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    49, 52,  // Changed box top-left
+    220, 50,  // Changed box dimensions
     HAPPY_FRAME18_DATA
 };
 
-// Frame 19: Full frame RLE (1336 bytes)
-static const uint8_t HAPPY_FRAME19_DATA[1336] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x1B,0x00,0x04,0x01,0x07,0x02,0x04,0x01,
-0x73,0x00,0x05,0x01,0x04,0x02,0x05,0x01,0xAB,0x00,0x02,0x01,0x01,0x02,0x13,0x03,
-0x02,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x01,0x01,
-0xA2,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
-0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x01,0x02,0x23,0x03,
-0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
-0x96,0x00,0x01,0x01,0x29,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x28,0x03,0x01,0x02,
-0x92,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x8D,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,
-0x30,0x03,0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,0x35,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x34,0x03,0x01,0x02,0x87,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,
-0x01,0x01,0x38,0x03,0x01,0x01,0x83,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x45,0x00,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x81,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x3E,0x03,0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x40,0x03,0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x02,0x42,0x03,0x01,0x02,0x79,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x47,0x03,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
-0x48,0x03,0x01,0x02,0x74,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x72,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
-0x70,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,
-0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6D,0x00,0x01,0x01,
-0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,
-0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x66,0x00,
-0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,
-0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x66,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,
-0x63,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,
-0x01,0x01,0x21,0x03,0x02,0x02,0x02,0x01,0x0F,0x00,0x03,0x01,0x01,0x02,0x21,0x03,
-0x01,0x02,0x27,0x00,0x01,0x02,0x20,0x03,0x02,0x02,0x02,0x01,0x10,0x00,0x02,0x01,
-0x02,0x02,0x21,0x03,0x65,0x00,0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x1D,0x00,
-0x02,0x01,0x01,0x02,0x1B,0x03,0x28,0x00,0x01,0x01,0x1A,0x03,0x02,0x02,0x01,0x01,
-0x1E,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x01,0x01,0x66,0x00,0x15,0x03,0x02,0x02,
-0x01,0x01,0x27,0x00,0x02,0x01,0x01,0x02,0x15,0x03,0x01,0x01,0x29,0x00,0x01,0x02,
-0x15,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x01,0x02,
-0x68,0x00,0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x02,0x02,
-0x0F,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x02,0x01,0x30,0x00,
-0x02,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x01,0x02,0x06,0x03,
-0x03,0x02,0x01,0x01,0x3B,0x00,0x02,0x01,0x02,0x02,0x06,0x03,0x01,0x02,0x01,0x01,
-0x2F,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x03,0x02,0x02,0x01,0x3A,0x00,0x02,0x01,
-0x03,0x02,0x05,0x03,0x02,0x02,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x87,0x00,
+// Frame 19: Diff RLE (906 bytes)
+static const uint8_t HAPPY_FRAME19_DATA[906] = {
+0xFF,0x00,0xE6,0x00,0x04,0x01,0x07,0x02,0x04,0x01,0x73,0x00,0x05,0x01,0x04,0x02,
+0x05,0x01,0x4A,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x69,0x00,
+0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,
+0x1D,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,
+0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,
+0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x29,0x03,
+0x01,0x02,0x57,0x00,0x01,0x02,0x28,0x03,0x01,0x02,0x31,0x00,0x01,0x01,0x2D,0x03,
+0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,
+0x01,0x01,0x31,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0x28,0x00,0x01,0x01,0x35,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,0x01,0x02,
+0x26,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x01,
+0x22,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x20,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
+0x18,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x16,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x47,0x03,0x14,0x00,
+0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x13,0x00,
+0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x11,0x00,0x4D,0x03,
+0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x02,0x31,0x00,0x50,0x03,0x0C,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x02,0x52,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x54,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x02,0x54,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,
+0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
+0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x58,0x03,0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
+0x58,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,
+0x01,0x01,0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,
+0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x02,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x21,0x03,0x02,0x02,0x02,0x01,0x0F,0x00,0x03,0x01,0x01,0x02,
+0x21,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x20,0x03,0x02,0x02,0x02,0x01,0x10,0x00,
+0x02,0x01,0x02,0x02,0x21,0x03,0x04,0x00,0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,
+0x1D,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x28,0x00,0x01,0x01,0x1A,0x03,0x02,0x02,
+0x01,0x01,0x1E,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x01,0x01,0x05,0x00,0x15,0x03,
+0x02,0x02,0x01,0x01,0x27,0x00,0x02,0x01,0x01,0x02,0x15,0x03,0x01,0x01,0x29,0x00,
+0x01,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x02,0x02,0x14,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0x31,0x00,0x01,0x01,
+0x02,0x02,0x0F,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x02,0x01,
+0x30,0x00,0x02,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x06,0x03,0x03,0x02,0x01,0x01,0x3B,0x00,0x02,0x01,0x02,0x02,0x06,0x03,0x01,0x02,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x03,0x02,0x02,0x01,0x3A,0x00,
+0x02,0x01,0x03,0x02,0x05,0x03,0x02,0x02,0x06,0x00,
 };
 static const DiffBlock HAPPY_FRAME19_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    48, 52,  // Changed box top-left
+    223, 51,  // Changed box dimensions
     HAPPY_FRAME19_DATA
 };
 
-// Frame 20: Full frame RLE (1290 bytes)
-static const uint8_t HAPPY_FRAME20_DATA[1290] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xA4,0x00,0x03,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x02,0x01,0x71,0x00,0x0C,0x01,
-0xA9,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,0x65,0x00,0x02,0x01,
-0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x9F,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x24,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x02,
-0x31,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x30,0x03,0x01,0x01,0x8A,0x00,
-0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x34,0x03,0x01,0x02,
-0x86,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x01,
-0x82,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,
-0x01,0x01,0x7F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x7C,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,
-0x01,0x01,0x79,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x77,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x46,0x03,
-0x01,0x02,0x75,0x00,0x01,0x02,0x4A,0x03,0x37,0x00,0x01,0x02,0x49,0x03,0x01,0x01,
-0x72,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x32,0x00,0x4E,0x03,0x01,0x01,
-0x6E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6D,0x00,0x01,0x02,
-0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x6B,0x00,0x01,0x01,0x53,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,0x55,0x03,0x01,0x01,
-0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x2B,0x00,0x56,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,
-0x01,0x02,0x57,0x03,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,
-0x59,0x03,0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x60,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,0x5F,0x03,0x01,0x01,
-0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x21,0x00,0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,
-0x60,0x03,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5E,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x21,0x00,0x60,0x03,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
-0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x5F,0x00,
-0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x5F,0x00,0x01,0x02,
-0x25,0x03,0x03,0x02,0x0D,0x01,0x03,0x02,0x25,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
-0x25,0x03,0x02,0x02,0x05,0x01,0x06,0x00,0x05,0x01,0x03,0x02,0x24,0x03,0x01,0x01,
-0x60,0x00,0x1E,0x03,0x02,0x02,0x02,0x01,0x19,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,
-0x01,0x01,0x23,0x00,0x01,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0x1B,0x00,0x02,0x01,
-0x01,0x02,0x1D,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x18,0x03,0x01,0x02,0x02,0x01,
-0x26,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x17,0x03,
-0x01,0x02,0x02,0x01,0x27,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x01,0x02,0x01,0x01,
-0x62,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x02,0x01,0x30,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x32,0x00,
-0x01,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x0A,0x03,0x02,0x02,
-0x02,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x29,0x00,
-0x01,0x01,0x01,0x02,0x08,0x03,0x02,0x02,0x02,0x01,0x3C,0x00,0x02,0x01,0x02,0x02,
-0x08,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x05,0x01,0x47,0x00,0x05,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xBE,0x00,
+// Frame 20: Diff RLE (870 bytes)
+static const uint8_t HAPPY_FRAME20_DATA[870] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0x0D,0x00,0x03,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x02,0x01,0x71,0x00,
+0x0C,0x01,0x4C,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,0x65,0x00,
+0x02,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x42,0x00,0x01,0x01,0x01,0x02,
+0x21,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,
+0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
+0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,
+0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
+0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x30,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x34,0x03,
+0x01,0x02,0x29,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x38,0x03,
+0x01,0x01,0x25,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,
+0x3B,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x40,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x42,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,
+0x44,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x46,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x4A,0x03,0x37,0x00,0x01,0x02,0x49,0x03,
+0x01,0x01,0x15,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x32,0x00,0x4E,0x03,
+0x01,0x01,0x11,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x10,0x00,
+0x01,0x02,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x0E,0x00,0x01,0x01,
+0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x0D,0x00,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x55,0x03,
+0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x01,0x02,0x57,0x03,0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,
+0x01,0x02,0x59,0x03,0x07,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x05,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x04,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x03,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x02,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x02,0x00,0x5F,0x03,
+0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x21,0x00,0x60,0x03,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
+0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x02,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x60,0x03,0x02,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
+0x02,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,
+0x01,0x02,0x5F,0x03,0x02,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x25,0x03,0x03,0x02,0x0D,0x01,0x03,0x02,0x25,0x03,
+0x01,0x02,0x22,0x00,0x01,0x01,0x25,0x03,0x02,0x02,0x05,0x01,0x06,0x00,0x05,0x01,
+0x03,0x02,0x24,0x03,0x01,0x01,0x03,0x00,0x1E,0x03,0x02,0x02,0x02,0x01,0x19,0x00,
+0x02,0x01,0x02,0x02,0x1E,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x1D,0x03,0x02,0x02,
+0x02,0x01,0x1B,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x04,0x00,0x01,0x01,
+0x18,0x03,0x01,0x02,0x02,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,
+0x25,0x00,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x27,0x00,0x01,0x01,0x02,0x02,
+0x16,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x02,0x01,
+0x30,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x10,0x03,
+0x02,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x0A,0x03,0x02,0x02,0x02,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x02,0x02,0x02,0x01,
+0x3C,0x00,0x02,0x01,0x02,0x02,0x08,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x05,0x01,
+0x47,0x00,0x05,0x01,0x8A,0x00,
 };
 static const DiffBlock HAPPY_FRAME20_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    46, 54,  // Changed box top-left
+    227, 58,  // Changed box dimensions
     HAPPY_FRAME20_DATA
 };
 
-// Frame 21: Full frame RLE (1302 bytes)
-static const uint8_t HAPPY_FRAME21_DATA[1302] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB1,0x00,0x06,0x01,0xFF,0x00,
-0x32,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,
-0x04,0x02,0x06,0x03,0x04,0x02,0x02,0x01,0xA5,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,
-0x01,0x02,0x01,0x01,0x62,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,
-0x9C,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x02,0x01,
-0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,
-0x8F,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0x8A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x01,
-0x4B,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x86,0x00,0x01,0x01,
-0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x82,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x7F,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x42,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x3B,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x77,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x38,0x00,
-0x48,0x03,0x01,0x01,0x74,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,
-0x01,0x01,0x71,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x6F,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4E,0x03,
-0x01,0x02,0x6D,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x6C,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x6A,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x68,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x66,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x65,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,
-0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5C,0x03,
-0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x01,0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
-0x5E,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5C,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x61,0x03,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x01,0x24,0x03,0x03,0x02,0x03,0x01,0x0B,0x00,0x03,0x01,
-0x03,0x02,0x24,0x03,0x01,0x02,0x21,0x00,0x24,0x03,0x03,0x02,0x03,0x01,0x0D,0x00,
-0x03,0x01,0x02,0x02,0x24,0x03,0x5F,0x00,0x1D,0x03,0x02,0x02,0x02,0x01,0x1D,0x00,
-0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x1C,0x03,0x02,0x02,
-0x02,0x01,0x1E,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x60,0x00,0x16,0x03,
-0x02,0x02,0x02,0x01,0x29,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x01,0x01,0x23,0x00,
-0x01,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x2A,0x00,0x02,0x01,0x02,0x02,0x15,0x03,
-0x01,0x02,0x62,0x00,0x01,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0x33,0x00,0x02,0x01,
-0x02,0x02,0x10,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x0F,0x03,0x02,0x02,0x02,0x01,
-0x34,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,0x01,0x01,0x64,0x00,0x02,0x01,0x02,0x02,
-0x03,0x03,0x04,0x02,0x02,0x01,0x3F,0x00,0x02,0x01,0x04,0x02,0x04,0x03,0x02,0x02,
-0x01,0x01,0x29,0x00,0x01,0x01,0x08,0x02,0x03,0x01,0x40,0x00,0x03,0x01,0x08,0x02,
-0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x75,0x00,
+// Frame 21: Diff RLE (860 bytes)
+static const uint8_t HAPPY_FRAME21_DATA[860] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC6,0x00,0x06,0x01,0xD6,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,0x04,0x02,0x06,0x03,0x04,0x02,
+0x02,0x01,0x4A,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x62,0x00,
+0x02,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,0x41,0x00,0x01,0x01,0x01,0x02,
+0x24,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
+0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,
+0x2F,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
+0x32,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x47,0x00,
+0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
+0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x24,0x00,
+0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,
+0x21,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,
+0x1E,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x38,0x00,0x48,0x03,0x01,0x01,0x19,0x00,
+0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x16,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x12,0x00,0x01,0x01,
+0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x11,0x00,0x53,0x03,
+0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x0F,0x00,0x55,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x2B,0x00,0x56,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,
+0x01,0x02,0x57,0x03,0x0A,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x01,0x06,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x05,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x04,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x03,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
+0x62,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x01,0x02,
+0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x62,0x03,
+0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,
+0x01,0x01,0x62,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x02,0x01,
+0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x60,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x24,0x03,
+0x03,0x02,0x03,0x01,0x0B,0x00,0x03,0x01,0x03,0x02,0x24,0x03,0x01,0x02,0x21,0x00,
+0x24,0x03,0x03,0x02,0x03,0x01,0x0D,0x00,0x03,0x01,0x02,0x02,0x24,0x03,0x04,0x00,
+0x1D,0x03,0x02,0x02,0x02,0x01,0x1D,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x01,
+0x21,0x00,0x01,0x01,0x1C,0x03,0x02,0x02,0x02,0x01,0x1E,0x00,0x02,0x01,0x02,0x02,
+0x1C,0x03,0x01,0x02,0x05,0x00,0x16,0x03,0x02,0x02,0x02,0x01,0x29,0x00,0x02,0x01,
+0x02,0x02,0x16,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x15,0x03,0x02,0x02,0x02,0x01,
+0x2A,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x0F,0x03,
+0x02,0x02,0x02,0x01,0x33,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x0F,0x03,0x02,0x02,0x02,0x01,0x34,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,
+0x01,0x01,0x09,0x00,0x02,0x01,0x02,0x02,0x03,0x03,0x04,0x02,0x02,0x01,0x3F,0x00,
+0x02,0x01,0x04,0x02,0x04,0x03,0x02,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x08,0x02,
+0x03,0x01,0x40,0x00,0x03,0x01,0x08,0x02,0x01,0x01,0x06,0x00,
 };
 static const DiffBlock HAPPY_FRAME21_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 64,  // Changed box top-left
+    229, 51,  // Changed box dimensions
     HAPPY_FRAME21_DATA
 };
 
-// Frame 22: Full frame RLE (1274 bytes)
-static const uint8_t HAPPY_FRAME22_DATA[1274] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xAD,0x00,0x03,0x01,0x03,0x02,0x0C,0x03,0x03,0x02,0x02,0x01,
-0x6C,0x00,0x03,0x01,0x05,0x02,0x04,0x03,0x05,0x02,0x03,0x01,0xA4,0x00,0x02,0x01,
-0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x62,0x00,0x01,0x01,0x02,0x02,0x18,0x03,
-0x02,0x02,0x02,0x01,0x9B,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x02,0x02,0x01,0x01,
-0x5A,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x94,0x00,0x02,0x02,
-0x2A,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x02,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x8E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x01,0x01,0x8A,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,
-0x34,0x03,0x01,0x02,0x86,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x02,0x82,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x7E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x3D,0x00,
-0x01,0x02,0x43,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,
-0x01,0x02,0x48,0x03,0x01,0x02,0x73,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,
-0x01,0x01,0x4C,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,0x54,0x03,0x2C,0x00,0x01,0x01,0x54,0x03,
-0x01,0x01,0x68,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,
-0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x65,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,
-0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
-0x5E,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5C,0x00,0x01,0x02,
-0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x28,0x03,0x06,0x02,0x05,0x01,0x06,0x02,0x28,0x03,
-0x01,0x02,0x1F,0x00,0x01,0x02,0x27,0x03,0x05,0x02,0x08,0x01,0x05,0x02,0x28,0x03,
-0x5D,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,0x03,0x01,0x17,0x00,0x03,0x01,0x02,0x02,
-0x20,0x03,0x20,0x00,0x01,0x01,0x1F,0x03,0x03,0x02,0x02,0x01,0x18,0x00,0x03,0x01,
-0x02,0x02,0x1F,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x19,0x03,0x02,0x02,0x02,0x01,
-0x25,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x18,0x03,
-0x02,0x02,0x02,0x01,0x26,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x60,0x00,
-0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x31,0x00,0x02,0x01,0x02,0x02,0x12,0x03,
-0x01,0x01,0x23,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x02,0x01,0x32,0x00,0x02,0x01,
-0x02,0x02,0x11,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x02,0x02,
-0x02,0x01,0x3D,0x00,0x02,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x27,0x00,
-0x01,0x01,0x01,0x02,0x08,0x03,0x02,0x02,0x02,0x01,0x3E,0x00,0x02,0x01,0x02,0x02,
-0x09,0x03,0x01,0x02,0x69,0x00,0x02,0x01,0x4D,0x00,0x02,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x37,0x00,
+// Frame 22: Diff RLE (840 bytes)
+static const uint8_t HAPPY_FRAME22_DATA[840] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC2,0x00,0x03,0x01,0x03,0x02,0x0C,0x03,0x03,0x02,
+0x02,0x01,0x6C,0x00,0x03,0x01,0x05,0x02,0x04,0x03,0x05,0x02,0x03,0x01,0x4A,0x00,
+0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x62,0x00,0x01,0x01,0x02,0x02,
+0x18,0x03,0x02,0x02,0x02,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x02,0x02,
+0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,
+0x02,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x02,0x02,0x29,0x03,0x01,0x02,
+0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4B,0x00,
+0x01,0x02,0x34,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x47,0x00,
+0x01,0x02,0x38,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,
+0x01,0x02,0x3C,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x43,0x03,0x01,0x02,
+0x3D,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
+0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
+0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
+0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x54,0x03,0x2C,0x00,0x01,0x01,
+0x54,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,
+0x01,0x01,0x0C,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x0B,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x07,0x00,0x5D,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x05,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,
+0x60,0x03,0x04,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
+0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x02,0x00,
+0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x62,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x01,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x28,0x03,0x06,0x02,0x05,0x01,0x06,0x02,0x28,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
+0x27,0x03,0x05,0x02,0x08,0x01,0x05,0x02,0x28,0x03,0x03,0x00,0x01,0x02,0x1F,0x03,
+0x02,0x02,0x03,0x01,0x17,0x00,0x03,0x01,0x02,0x02,0x20,0x03,0x20,0x00,0x01,0x01,
+0x1F,0x03,0x03,0x02,0x02,0x01,0x18,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,0x01,0x01,
+0x03,0x00,0x01,0x01,0x19,0x03,0x02,0x02,0x02,0x01,0x25,0x00,0x02,0x01,0x02,0x02,
+0x19,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x26,0x00,
+0x02,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x12,0x03,0x01,0x02,
+0x02,0x01,0x31,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x01,0x23,0x00,0x01,0x01,
+0x12,0x03,0x01,0x02,0x02,0x01,0x32,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x02,0x02,0x02,0x01,0x3D,0x00,0x02,0x01,
+0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x08,0x03,
+0x02,0x02,0x02,0x01,0x3E,0x00,0x02,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x0F,0x00,
+0x02,0x01,0x4D,0x00,0x02,0x01,0x8B,0x00,
 };
 static const DiffBlock HAPPY_FRAME22_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 68,  // Changed box top-left
+    230, 50,  // Changed box dimensions
     HAPPY_FRAME22_DATA
 };
 
-// Frame 23: Full frame RLE (1286 bytes)
-static const uint8_t HAPPY_FRAME23_DATA[1286] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF4,0x00,0x0B,0x01,0x78,0x00,0x08,0x01,0xAD,0x00,
-0x03,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0x67,0x00,0x02,0x01,0x03,0x02,
-0x10,0x03,0x03,0x02,0x02,0x01,0xA0,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x99,0x00,
-0x02,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
-0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x8C,0x00,0x01,0x01,0x01,0x02,
-0x32,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x88,0x00,0x01,0x01,
-0x37,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x84,0x00,0x01,0x01,
-0x3B,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x7D,0x00,
-0x01,0x02,0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x79,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x76,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x01,
-0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x71,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,
-0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6C,0x00,
-0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6A,0x00,
-0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x68,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x66,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x65,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,
-0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,
-0x5C,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,
-0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x2C,0x03,0x09,0x02,0x2D,0x03,0x1E,0x00,0x01,0x01,0x2C,0x03,0x0A,0x02,0x2C,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x22,0x03,0x03,0x02,0x03,0x01,0x11,0x00,0x04,0x01,
-0x02,0x02,0x22,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x21,0x03,0x03,0x02,0x03,0x01,
-0x12,0x00,0x03,0x01,0x03,0x02,0x22,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,0x1B,0x03,
-0x01,0x02,0x03,0x01,0x22,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x20,0x00,0x01,0x01,
-0x1B,0x03,0x02,0x02,0x02,0x01,0x22,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0x2F,0x00,0x02,0x01,0x01,0x02,
-0x14,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x14,0x03,0x02,0x02,0x02,0x01,
-0x2E,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x02,0x02,0x02,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,0x02,0x01,0x02,0x02,
-0x0C,0x03,0x01,0x02,0x65,0x00,0x03,0x01,0x02,0x02,0x03,0x01,0x47,0x00,0x04,0x01,
-0x02,0x02,0x02,0x01,0x2B,0x00,0x07,0x01,0x48,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x71,0x00,
+// Frame 23: Diff RLE (842 bytes)
+static const uint8_t HAPPY_FRAME23_DATA[842] = {
+0xFF,0x00,0x15,0x00,0x0B,0x01,0x78,0x00,0x08,0x01,0x54,0x00,0x03,0x01,0x02,0x02,
+0x11,0x03,0x03,0x02,0x02,0x01,0x67,0x00,0x02,0x01,0x03,0x02,0x10,0x03,0x03,0x02,
+0x02,0x01,0x47,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,
+0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x40,0x00,0x02,0x02,0x26,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,
+0x2C,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,
+0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x37,0x03,0x01,0x02,
+0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
+0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x3F,0x03,
+0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x24,0x00,0x01,0x02,0x42,0x03,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x18,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x53,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x55,0x03,
+0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x01,0x02,0x57,0x03,0x0C,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
+0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,
+0x01,0x02,0x5B,0x03,0x01,0x01,0x08,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,
+0x01,0x01,0x06,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x04,0x00,
+0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x03,0x00,0x01,0x02,
+0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,
+0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x2C,0x03,0x09,0x02,
+0x2D,0x03,0x1E,0x00,0x01,0x01,0x2C,0x03,0x0A,0x02,0x2C,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x22,0x03,0x03,0x02,0x03,0x01,0x11,0x00,0x04,0x01,0x02,0x02,0x22,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x21,0x03,0x03,0x02,0x03,0x01,0x12,0x00,0x03,0x01,
+0x03,0x02,0x22,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x1B,0x03,0x01,0x02,0x03,0x01,
+0x22,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x20,0x00,0x01,0x01,0x1B,0x03,0x02,0x02,
+0x02,0x01,0x22,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,0x05,0x00,0x01,0x02,
+0x14,0x03,0x02,0x02,0x01,0x01,0x2F,0x00,0x02,0x01,0x01,0x02,0x14,0x03,0x01,0x02,
+0x01,0x01,0x21,0x00,0x01,0x01,0x14,0x03,0x02,0x02,0x02,0x01,0x2E,0x00,0x02,0x01,
+0x02,0x02,0x14,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,
+0x02,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,0x02,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,
+0x0C,0x00,0x03,0x01,0x02,0x02,0x03,0x01,0x47,0x00,0x04,0x01,0x02,0x02,0x02,0x01,
+0x2B,0x00,0x07,0x01,0x48,0x00,0x07,0x01,0x08,0x00,
 };
 static const DiffBlock HAPPY_FRAME23_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 72,  // Changed box top-left
+    231, 47,  // Changed box dimensions
     HAPPY_FRAME23_DATA
 };
 
-// Frame 24: Full frame RLE (1280 bytes)
-static const uint8_t HAPPY_FRAME24_DATA[1280] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x34,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0x72,0x00,0x05,0x01,0x04,0x02,0x06,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,
-0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,
-0x02,0x01,0x9E,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,
-0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x97,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,
-0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x8C,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x01,0x87,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
-0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x01,0x83,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,
-0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x7F,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x01,0x43,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x02,
-0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x01,
-0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x73,0x00,0x01,0x02,
-0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x70,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,
-0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x6A,0x00,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x56,0x03,
-0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
-0x5D,0x03,0x60,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5E,0x00,
-0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,
-0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x27,0x03,0x04,0x02,0x0B,0x01,0x04,0x02,
-0x28,0x03,0x1E,0x00,0x01,0x01,0x27,0x03,0x05,0x02,0x0B,0x01,0x04,0x02,0x27,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x1F,0x03,0x02,0x02,0x03,0x01,0x19,0x00,0x03,0x01,
-0x02,0x02,0x1F,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,
-0x1A,0x00,0x02,0x01,0x03,0x02,0x1F,0x03,0x5D,0x00,0x01,0x01,0x18,0x03,0x02,0x02,
-0x02,0x01,0x27,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x21,0x00,0x19,0x03,
-0x01,0x02,0x02,0x01,0x28,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x12,0x03,0x01,0x02,0x02,0x01,0x33,0x00,0x02,0x01,0x02,0x02,0x11,0x03,
-0x01,0x02,0x23,0x00,0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x34,0x00,0x01,0x01,
-0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x08,0x03,
-0x02,0x02,0x02,0x01,0x3F,0x00,0x02,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x01,0x02,0x09,0x03,0x02,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,0x02,0x02,
-0x09,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x6E,0x00,
-
+// Frame 24: Diff RLE (826 bytes)
+static const uint8_t HAPPY_FRAME24_DATA[826] = {
+0xFF,0x00,0x13,0x00,0x05,0x01,0x06,0x02,0x05,0x01,0x72,0x00,0x05,0x01,0x04,0x02,
+0x06,0x01,0x4F,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
+0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x45,0x00,0x01,0x01,0x02,0x02,
+0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
+0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x01,0x56,0x00,0x01,0x01,
+0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
+0x01,0x01,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x33,0x03,
+0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x01,0x2E,0x00,
+0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x01,
+0x2A,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,
+0x26,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
+0x01,0x01,0x22,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,0x42,0x03,
+0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
+0x46,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
+0x50,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x52,0x03,0x01,0x02,0x11,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,
+0x01,0x02,0x0F,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,
+0x0A,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x07,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x60,0x03,0x05,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,
+0x60,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
+0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x02,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
+0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
+0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,0x63,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x27,0x03,0x04,0x02,0x0B,0x01,
+0x04,0x02,0x28,0x03,0x1E,0x00,0x01,0x01,0x27,0x03,0x05,0x02,0x0B,0x01,0x04,0x02,
+0x27,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x1F,0x03,0x02,0x02,0x03,0x01,0x19,0x00,
+0x03,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,
+0x02,0x01,0x1A,0x00,0x02,0x01,0x03,0x02,0x1F,0x03,0x04,0x00,0x01,0x01,0x18,0x03,
+0x02,0x02,0x02,0x01,0x27,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x21,0x00,
+0x19,0x03,0x01,0x02,0x02,0x01,0x28,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x01,
+0x05,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x02,0x01,0x33,0x00,0x02,0x01,0x02,0x02,
+0x11,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x34,0x00,
+0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
+0x08,0x03,0x02,0x02,0x02,0x01,0x3F,0x00,0x02,0x01,0x02,0x02,0x09,0x03,0x01,0x02,
+0x26,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x02,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,
+0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x05,0x00,
 };
 static const DiffBlock HAPPY_FRAME24_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 73,  // Changed box top-left
+    231, 46,  // Changed box dimensions
     HAPPY_FRAME24_DATA
 };
 
-// Frame 25: Full frame RLE (1298 bytes)
-static const uint8_t HAPPY_FRAME25_DATA[1298] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x71,0x00,0x03,0x01,
-0x03,0x02,0x0B,0x03,0x04,0x02,0x02,0x01,0x6B,0x00,0x02,0x01,0x04,0x02,0x0A,0x03,
-0x04,0x02,0x02,0x01,0xA3,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,
-0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x01,0x02,0x01,0x01,0x94,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
-0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x01,0x31,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x89,0x00,
-0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x01,
-0x84,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x3A,0x03,
-0x01,0x02,0x81,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
-0x3E,0x03,0x01,0x02,0x7D,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,
-0x42,0x03,0x01,0x01,0x79,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x77,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x01,
-0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x71,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
-0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,
-0x01,0x01,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,
-0x01,0x01,0x54,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,
-0x56,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,
-0x65,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x02,
-0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,
-0x01,0x01,0x5A,0x00,0x2D,0x03,0x09,0x02,0x2D,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x2D,0x03,0x08,0x02,0x2D,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x22,0x03,0x02,0x02,
-0x04,0x01,0x12,0x00,0x03,0x01,0x02,0x02,0x23,0x03,0x1E,0x00,0x01,0x01,0x22,0x03,
-0x03,0x02,0x03,0x01,0x12,0x00,0x03,0x01,0x03,0x02,0x22,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x23,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x1B,0x03,0x02,0x02,0x02,0x01,0x22,0x00,0x02,0x01,
-0x02,0x02,0x1B,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,0x14,0x03,0x02,0x02,0x01,0x01,
-0x2F,0x00,0x02,0x01,0x01,0x02,0x15,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x14,0x03,
-0x02,0x02,0x02,0x01,0x2E,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x60,0x00,
-0x01,0x01,0x0D,0x03,0x02,0x02,0x02,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x0D,0x03,
-0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,
-0x02,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x02,0x01,0x03,0x02,
-0x03,0x01,0x47,0x00,0x04,0x01,0x02,0x02,0x02,0x01,0x2A,0x00,0x03,0x01,0x02,0x02,
-0x03,0x01,0x48,0x00,0x03,0x01,0x02,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x2F,0x00,
+// Frame 25: Diff RLE (838 bytes)
+static const uint8_t HAPPY_FRAME25_DATA[838] = {
+0xFF,0x00,0x0F,0x00,0x03,0x01,0x03,0x02,0x0B,0x03,0x04,0x02,0x02,0x01,0x6B,0x00,
+0x02,0x01,0x04,0x02,0x0A,0x03,0x04,0x02,0x02,0x01,0x4A,0x00,0x02,0x01,0x01,0x02,
+0x1B,0x03,0x02,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,
+0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
+0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x2B,0x03,
+0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,
+0x35,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
+0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
+0x01,0x01,0x36,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x01,
+0x45,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x41,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x24,0x00,0x01,0x02,0x41,0x03,
+0x01,0x02,0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x45,0x03,
+0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x47,0x03,
+0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
+0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x18,0x00,
+0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x16,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x13,0x00,0x01,0x02,
+0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x11,0x00,0x01,0x02,
+0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x29,0x00,0x58,0x03,0x0C,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x01,0x08,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
+0x5F,0x03,0x05,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
+0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
+0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,
+0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,
+0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x01,0x02,
+0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,
+0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,
+0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x00,0x2D,0x03,
+0x09,0x02,0x2D,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x2D,0x03,0x08,0x02,0x2D,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x22,0x03,0x02,0x02,0x04,0x01,0x12,0x00,0x03,0x01,
+0x02,0x02,0x23,0x03,0x1E,0x00,0x01,0x01,0x22,0x03,0x03,0x02,0x03,0x01,0x12,0x00,
+0x03,0x01,0x03,0x02,0x22,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x1B,0x03,0x01,0x02,
+0x02,0x01,0x23,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x1B,0x03,0x02,0x02,0x02,0x01,0x22,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x01,0x02,
+0x05,0x00,0x01,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0x2F,0x00,0x02,0x01,0x01,0x02,
+0x15,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x2E,0x00,
+0x02,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x0D,0x03,0x02,0x02,
+0x02,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x0D,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,0x02,0x01,0x02,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x02,0x01,0x03,0x02,0x03,0x01,0x47,0x00,0x04,0x01,
+0x02,0x02,0x02,0x01,0x2A,0x00,0x03,0x01,0x02,0x02,0x03,0x01,0x48,0x00,0x03,0x01,
+0x02,0x02,0x03,0x01,0x07,0x00,
 };
 static const DiffBlock HAPPY_FRAME25_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 74,  // Changed box top-left
+    231, 46,  // Changed box dimensions
     HAPPY_FRAME25_DATA
 };
 
-// Frame 26: Full frame RLE (1290 bytes)
-static const uint8_t HAPPY_FRAME26_DATA[1290] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x72,0x00,0x03,0x01,
-0x06,0x02,0x03,0x03,0x06,0x02,0x03,0x01,0x6D,0x00,0x02,0x01,0x06,0x02,0x04,0x03,
-0x06,0x02,0x02,0x01,0xA5,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,
-0x62,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x01,0x02,0x02,0x01,0x9B,0x00,0x01,0x01,
-0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
-0x02,0x02,0x01,0x01,0x94,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x54,0x00,
-0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x01,0x01,0x02,
-0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x8A,0x00,0x01,0x01,
-0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0x85,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,
-0x39,0x03,0x01,0x01,0x81,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x7D,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x77,0x00,
-0x01,0x01,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x74,0x00,
-0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x71,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x53,0x03,
-0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x68,0x00,0x01,0x01,
-0x55,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,0x67,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x65,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
-0x5F,0x03,0x5E,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x5C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,
-0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x23,0x03,0x03,0x02,0x03,0x01,0x0F,0x00,
-0x04,0x01,0x02,0x02,0x24,0x03,0x1E,0x00,0x01,0x01,0x23,0x03,0x03,0x02,0x04,0x01,
-0x0F,0x00,0x03,0x01,0x03,0x02,0x23,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x1C,0x03,
-0x02,0x02,0x02,0x01,0x21,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x01,0x01,0x1F,0x00,
-0x01,0x02,0x1C,0x03,0x01,0x02,0x03,0x01,0x20,0x00,0x03,0x01,0x01,0x02,0x1C,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x01,0x16,0x03,0x01,0x02,0x02,0x01,0x2D,0x00,0x02,0x01,
-0x02,0x02,0x15,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x15,0x03,0x02,0x02,0x01,0x01,
-0x2E,0x00,0x02,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x02,0x01,0x39,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x0E,0x03,0x02,0x02,0x02,0x01,0x39,0x00,0x01,0x01,0x02,0x02,0x0E,0x03,
-0x01,0x01,0x63,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0x45,0x00,0x03,0x01,0x06,0x02,
-0x01,0x01,0x29,0x00,0x01,0x01,0x06,0x02,0x02,0x01,0x46,0x00,0x02,0x01,0x06,0x02,
-0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2F,0x00,
+// Frame 26: Diff RLE (826 bytes)
+static const uint8_t HAPPY_FRAME26_DATA[826] = {
+0x28,0x00,0x03,0x01,0x06,0x02,0x03,0x03,0x06,0x02,0x03,0x01,0x6D,0x00,0x02,0x01,
+0x06,0x02,0x04,0x03,0x06,0x02,0x02,0x01,0x4C,0x00,0x01,0x01,0x02,0x02,0x19,0x03,
+0x02,0x02,0x01,0x01,0x62,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x01,0x02,0x02,0x01,
+0x42,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
+0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x35,0x00,
+0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,
+0x31,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
+0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x24,0x00,0x01,0x01,
+0x41,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
+0x20,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x48,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x18,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x16,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,
+0x14,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x11,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,0x0E,0x00,
+0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x0C,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,
+0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x08,0x00,0x5D,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
+0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x21,0x00,0x01,0x02,0x5F,0x03,0x05,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,
+0x60,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,
+0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x02,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
+0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x64,0x03,0x01,0x02,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
+0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,
+0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x23,0x03,
+0x03,0x02,0x03,0x01,0x0F,0x00,0x04,0x01,0x02,0x02,0x24,0x03,0x1E,0x00,0x01,0x01,
+0x23,0x03,0x03,0x02,0x04,0x01,0x0F,0x00,0x03,0x01,0x03,0x02,0x23,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x1C,0x03,0x02,0x02,0x02,0x01,0x21,0x00,0x02,0x01,0x02,0x02,
+0x1C,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x1C,0x03,0x01,0x02,0x03,0x01,0x20,0x00,
+0x03,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x16,0x03,0x01,0x02,
+0x02,0x01,0x2D,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
+0x15,0x03,0x02,0x02,0x01,0x01,0x2E,0x00,0x02,0x01,0x01,0x02,0x15,0x03,0x01,0x02,
+0x07,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x02,0x01,0x39,0x00,0x02,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x0E,0x03,0x02,0x02,0x02,0x01,0x39,0x00,
+0x01,0x01,0x02,0x02,0x0E,0x03,0x01,0x01,0x0A,0x00,0x02,0x01,0x06,0x02,0x02,0x01,
+0x45,0x00,0x03,0x01,0x06,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x06,0x02,0x02,0x01,
+0x46,0x00,0x02,0x01,0x06,0x02,0x01,0x01,0x07,0x00,
 };
 static const DiffBlock HAPPY_FRAME26_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 75,  // Changed box top-left
+    231, 45,  // Changed box dimensions
     HAPPY_FRAME26_DATA
 };
 
-// Frame 27: Full frame RLE (1280 bytes)
-static const uint8_t HAPPY_FRAME27_DATA[1280] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x19,0x00,0x02,0x01,0x03,0x02,0x09,0x03,
-0x03,0x02,0x03,0x01,0x6D,0x00,0x02,0x01,0x04,0x02,0x09,0x03,0x03,0x02,0x02,0x01,
-0xA7,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x65,0x00,0x01,0x01,
-0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x9F,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
-0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,
-0x9A,0x00,0x01,0x01,0x25,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x01,0x02,0x01,0x01,0x95,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x2A,0x03,0x01,0x01,0x91,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x2E,0x03,0x01,0x01,0x8D,0x00,0x01,0x01,0x31,0x03,0x01,0x02,
-0x4E,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x01,0x89,0x00,0x01,0x01,0x35,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x87,0x00,0x01,0x02,0x37,0x03,
-0x01,0x02,0x48,0x00,0x01,0x01,0x38,0x03,0x01,0x01,0x84,0x00,0x01,0x02,0x3A,0x03,
-0x01,0x01,0x45,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x3D,0x03,
-0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x7F,0x00,0x01,0x01,0x3F,0x03,
-0x01,0x02,0x41,0x00,0x40,0x03,0x7D,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,
-0x42,0x03,0x01,0x01,0x7A,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x44,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x46,0x03,
-0x01,0x01,0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x75,0x00,
-0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x74,0x00,
-0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x72,0x00,0x01,0x02,
-0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x70,0x00,0x01,0x01,
-0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,
-0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,
-0x54,0x03,0x01,0x01,0x69,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,
-0x67,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
-0x67,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x67,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,
-0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,
-0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x66,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x66,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x29,0x00,0x58,0x03,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,
-0x01,0x02,0x57,0x03,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,
-0x57,0x03,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x67,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x67,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x67,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x68,0x00,
-0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x69,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,
-0x21,0x03,0x04,0x02,0x08,0x01,0x04,0x02,0x21,0x03,0x2E,0x00,0x01,0x01,0x21,0x03,
-0x04,0x02,0x08,0x01,0x04,0x02,0x21,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x17,0x03,
-0x02,0x02,0x03,0x01,0x18,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x18,0x03,0x02,0x02,0x02,0x01,0x18,0x00,0x02,0x01,0x02,0x02,0x18,0x03,
-0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x02,0x02,0x02,0x01,0x27,0x00,
-0x02,0x01,0x02,0x02,0x0F,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x0F,0x03,0x02,0x02,
-0x02,0x01,0x26,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x72,0x00,
-0x02,0x01,0x05,0x02,0x03,0x01,0x35,0x00,0x03,0x01,0x06,0x02,0x02,0x01,0x37,0x00,
-0x02,0x01,0x06,0x02,0x03,0x01,0x34,0x00,0x03,0x01,0x06,0x02,0x02,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+// Frame 27: Diff RLE (886 bytes)
+static const uint8_t HAPPY_FRAME27_DATA[886] = {
+0x29,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x03,0x02,0x03,0x01,0x6D,0x00,0x02,0x01,
+0x04,0x02,0x09,0x03,0x03,0x02,0x02,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x17,0x03,
+0x01,0x02,0x02,0x01,0x65,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,
+0x46,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,
+0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x25,0x03,0x01,0x02,
+0x5A,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
+0x29,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x01,0x38,0x00,
+0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x2E,0x03,0x01,0x01,
+0x34,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x01,0x30,0x00,0x01,0x01,0x35,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,
+0x01,0x02,0x2E,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x38,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x3A,0x03,
+0x01,0x02,0x28,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,
+0x01,0x02,0x26,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,0x24,0x00,
+0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x42,0x03,0x01,0x01,0x21,0x00,0x01,0x01,
+0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x45,0x03,0x01,0x02,0x3B,0x00,0x46,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x47,0x03,
+0x01,0x02,0x39,0x00,0x48,0x03,0x1C,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x48,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,
+0x4A,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
+0x15,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x12,0x00,
+0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x11,0x00,0x01,0x01,
+0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x11,0x00,0x01,0x02,
+0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x10,0x00,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x55,0x03,
+0x01,0x02,0x2B,0x00,0x56,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
+0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x0E,0x00,0x57,0x03,0x01,0x01,0x29,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,
+0x01,0x02,0x57,0x03,0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,
+0x57,0x03,0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x0D,0x00,
+0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x0D,0x00,0x01,0x01,
+0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x0D,0x00,0x01,0x01,0x57,0x03,
+0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0E,0x00,0x57,0x03,0x01,0x01,
+0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
+0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
+0x2B,0x00,0x56,0x03,0x01,0x01,0x0F,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,
+0x54,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,
+0x54,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x21,0x03,0x04,0x02,0x08,0x01,0x04,0x02,
+0x21,0x03,0x2E,0x00,0x01,0x01,0x21,0x03,0x04,0x02,0x08,0x01,0x04,0x02,0x21,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x17,0x03,0x02,0x02,0x03,0x01,0x18,0x00,0x02,0x01,
+0x02,0x02,0x18,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x18,0x03,0x02,0x02,0x02,0x01,
+0x18,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x02,0x02,0x02,0x01,0x27,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x01,0x01,
+0x33,0x00,0x01,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0x26,0x00,0x02,0x01,0x02,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x02,0x01,0x05,0x02,0x03,0x01,0x35,0x00,
+0x03,0x01,0x06,0x02,0x02,0x01,0x37,0x00,0x02,0x01,0x06,0x02,0x03,0x01,0x34,0x00,
+0x03,0x01,0x06,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x8B,0x00,
-
+0xFF,0x00,0xFF,0x00,0x74,0x00,
 };
 static const DiffBlock HAPPY_FRAME27_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 54,  // Changed box top-left
+    231, 66,  // Changed box dimensions
     HAPPY_FRAME27_DATA
 };
 
-// Frame 28: Full frame RLE (1288 bytes)
-static const uint8_t HAPPY_FRAME28_DATA[1288] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xCD,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x03,0x02,0x02,0x01,0x6F,0x00,0x02,0x01,
-0x02,0x02,0x0A,0x03,0x03,0x02,0x01,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x15,0x03,
+// Frame 28: Diff RLE (884 bytes)
+static const uint8_t HAPPY_FRAME28_DATA[884] = {
+0x23,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x03,0x02,0x02,0x01,0x6F,0x00,0x02,0x01,
+0x02,0x02,0x0A,0x03,0x03,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x15,0x03,
 0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x02,0x01,0x01,
-0xA2,0x00,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
-0x1C,0x03,0x01,0x02,0x01,0x01,0x9C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x02,0x22,0x03,0x01,0x02,0x98,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
-0x01,0x01,0x59,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x95,0x00,0x01,0x02,0x2A,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,0x91,0x00,0x01,0x02,0x2D,0x03,
-0x01,0x02,0x52,0x00,0x01,0x01,0x2E,0x03,0x01,0x01,0x8D,0x00,0x01,0x01,0x31,0x03,
-0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x8B,0x00,0x01,0x02,0x33,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x01,0x34,0x03,0x01,0x01,0x88,0x00,0x01,0x02,0x36,0x03,
-0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x86,0x00,0x01,0x02,0x38,0x03,
-0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x84,0x00,0x3B,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x82,0x00,0x3D,0x03,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x02,0x80,0x00,0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x40,0x03,0x01,0x02,0x7C,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,
-0x01,0x01,0x7A,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x44,0x03,
-0x01,0x01,0x79,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x75,0x00,0x01,0x01,
-0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x74,0x00,0x01,0x02,
-0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x73,0x00,0x4B,0x03,0x01,0x01,
-0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x72,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x71,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,
-0x01,0x02,0x4D,0x03,0x70,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x01,0x6F,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
-0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,
-0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,
-0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x6C,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2F,0x00,
-0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,
-0x01,0x01,0x6B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x6C,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6C,0x00,
+0x3C,0x00,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
+0x1C,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x01,
+0x5D,0x00,0x01,0x02,0x22,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
+0x01,0x01,0x59,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x2A,0x03,
+0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x2D,0x03,
+0x01,0x02,0x52,0x00,0x01,0x01,0x2E,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x31,0x03,
+0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x33,0x03,
+0x01,0x02,0x4C,0x00,0x01,0x01,0x34,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x36,0x03,
+0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x38,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x1E,0x00,0x3B,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x1C,0x00,0x3D,0x03,0x01,0x01,0x43,0x00,
+0x01,0x02,0x3C,0x03,0x01,0x02,0x1A,0x00,0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x40,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,
+0x01,0x01,0x14,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x44,0x03,
+0x01,0x01,0x13,0x00,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x12,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x10,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x0F,0x00,0x01,0x01,
+0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,
+0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x0D,0x00,0x4B,0x03,0x01,0x01,
+0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x0B,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,
+0x01,0x02,0x4C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,
+0x01,0x02,0x4D,0x03,0x0A,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x09,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
+0x08,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x07,0x00,
+0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
+0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x06,0x00,0x01,0x01,
+0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x06,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x06,0x00,0x01,0x01,0x51,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x51,0x03,
+0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
+0x2F,0x00,0x52,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2F,0x00,
+0x52,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,
+0x05,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x06,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x06,0x00,
 0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x6D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x6F,0x00,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,
-0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x71,0x00,0x01,0x01,
-0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x72,0x00,0x01,0x02,
-0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x74,0x00,0x01,0x01,
-0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x47,0x03,0x78,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x7B,0x00,0x01,0x01,
+0x07,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
+0x07,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x09,0x00,0x01,0x02,
+0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x0A,0x00,
+0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,
+0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x47,0x03,0x12,0x00,0x01,0x02,0x43,0x03,
+0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
 0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x01,0x01,0x81,0x00,0x02,0x01,0x04,0x02,0x06,0x03,0x08,0x02,0x12,0x01,
+0x01,0x02,0x01,0x01,0x1B,0x00,0x02,0x01,0x04,0x02,0x06,0x03,0x08,0x02,0x12,0x01,
 0x07,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0x48,0x00,0x02,0x01,0x04,0x02,0x06,0x03,
 0x08,0x02,0x12,0x01,0x08,0x02,0x06,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x98,0x00,
+0xFF,0x00,0x7A,0x00,
 };
 static const DiffBlock HAPPY_FRAME28_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    50, 45,  // Changed box top-left
+    218, 58,  // Changed box dimensions
     HAPPY_FRAME28_DATA
 };
 
-// Frame 29: Full frame RLE (1350 bytes)
-static const uint8_t HAPPY_FRAME29_DATA[1350] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4B,0x00,0x02,0x01,
-0x03,0x02,0x0A,0x03,0x02,0x02,0x02,0x01,0x6F,0x00,0x02,0x01,0x02,0x02,0x0A,0x03,
-0x03,0x02,0x01,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x02,0x02,0x01,0x01,
-0x67,0x00,0x01,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0xA2,0x00,0x01,0x01,
-0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,
-0x01,0x02,0x01,0x01,0x9C,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x22,0x03,0x01,0x02,0x99,0x00,0x01,0x02,0x25,0x03,0x01,0x02,
-0x01,0x01,0x59,0x00,0x01,0x01,0x26,0x03,0x01,0x02,0x95,0x00,0x01,0x02,0x29,0x03,
-0x01,0x02,0x56,0x00,0x01,0x01,0x2A,0x03,0x01,0x01,0x91,0x00,0x01,0x01,0x2D,0x03,
-0x01,0x02,0x53,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x02,
-0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x30,0x03,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x33,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x89,0x00,0x01,0x01,
-0x35,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x35,0x03,0x01,0x01,0x86,0x00,0x01,0x01,
-0x37,0x03,0x01,0x02,0x49,0x00,0x38,0x03,0x01,0x01,0x84,0x00,0x01,0x02,0x39,0x03,
-0x01,0x02,0x46,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x82,0x00,0x01,0x02,0x3B,0x03,
-0x01,0x02,0x44,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x80,0x00,0x01,0x01,0x3D,0x03,
-0x01,0x02,0x43,0x00,0x3E,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
-0x41,0x00,0x40,0x03,0x7D,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x40,0x03,0x01,0x02,0x7C,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x7A,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x44,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,
-0x45,0x03,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x76,0x00,
-0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x74,0x00,
-0x01,0x02,0x49,0x03,0x01,0x02,0x37,0x00,0x4A,0x03,0x01,0x01,0x73,0x00,0x01,0x02,
-0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x71,0x00,
-0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x71,0x00,0x4D,0x03,
-0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x01,0x4D,0x03,
-0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x70,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x6F,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,
-0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
-0x6E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,
-0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,
-0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,
-0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,
-0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,
-0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,
-0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,0x30,0x00,
-0x01,0x01,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x31,0x00,
-0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
-0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x6F,0x00,
-0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6F,0x00,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6F,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x71,0x00,0x4D,0x03,
-0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x71,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x4A,0x03,
-0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
-0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
-0x39,0x00,0x48,0x03,0x77,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
-0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x40,0x03,0x01,0x01,0x7F,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,
-0x01,0x01,0x3C,0x03,0x01,0x02,0x83,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,
-0x47,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x88,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x8F,0x00,0x02,0x01,0x03,0x02,0x22,0x03,0x02,0x02,0x02,0x01,
-0x57,0x00,0x01,0x01,0x03,0x02,0x22,0x03,0x03,0x02,0x02,0x01,0x9D,0x00,0x17,0x01,
-0x6B,0x00,0x16,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xA5,0x00,
+// Frame 29: Diff RLE (954 bytes)
+static const uint8_t HAPPY_FRAME29_DATA[954] = {
+0x20,0x00,0x02,0x01,0x03,0x02,0x0A,0x03,0x02,0x02,0x02,0x01,0x6F,0x00,0x02,0x01,
+0x02,0x02,0x0A,0x03,0x03,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x15,0x03,
+0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,
+0x37,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
+0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x22,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,
+0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x26,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x02,0x29,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x2A,0x03,0x01,0x01,0x26,0x00,
+0x01,0x01,0x2D,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x23,0x00,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x30,0x03,0x01,0x01,
+0x20,0x00,0x01,0x01,0x33,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,0x01,0x02,
+0x1E,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x35,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x49,0x00,0x38,0x03,0x01,0x01,0x19,0x00,
+0x01,0x02,0x39,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x3E,0x03,0x01,0x01,0x13,0x00,0x01,0x01,
+0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,0x12,0x00,0x01,0x01,0x41,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x42,0x03,0x01,0x01,
+0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x43,0x03,0x01,0x02,
+0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x45,0x03,0x01,0x01,
+0x3B,0x00,0x01,0x02,0x45,0x03,0x0D,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,
+0x01,0x01,0x46,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,
+0x48,0x03,0x0B,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x09,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x37,0x00,0x4A,0x03,0x01,0x01,
+0x08,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,
+0x07,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
+0x01,0x01,0x06,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
+0x06,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x05,0x00,
+0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x05,0x00,0x01,0x02,
+0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x04,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x03,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x03,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x03,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
+0x31,0x00,0x50,0x03,0x03,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
+0x01,0x01,0x02,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x02,0x00,0x01,0x02,
+0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
+0x31,0x00,0x50,0x03,0x03,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,
+0x4F,0x03,0x04,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
+0x04,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x02,0x04,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,
+0x06,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x06,0x00,
+0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x07,0x00,
+0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
+0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x0C,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
+0x3B,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x43,0x03,0x01,0x01,
+0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x3C,0x03,
+0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x37,0x03,
+0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,
+0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x02,0x01,0x03,0x02,0x22,0x03,
+0x02,0x02,0x02,0x01,0x57,0x00,0x01,0x01,0x03,0x02,0x22,0x03,0x03,0x02,0x02,0x01,
+0x32,0x00,0x17,0x01,0x6B,0x00,0x16,0x01,0x1F,0x00,
 };
 static const DiffBlock HAPPY_FRAME29_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    53, 43,  // Changed box top-left
+    213, 60,  // Changed box dimensions
     HAPPY_FRAME29_DATA
 };
 
-// Frame 30: Full frame RLE (1432 bytes)
-static const uint8_t HAPPY_FRAME30_DATA[1432] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x10,0x00,0x02,0x01,0x03,0x02,0x07,0x03,0x03,0x02,0x02,0x01,
-0x71,0x00,0x01,0x01,0x03,0x02,0x08,0x03,0x03,0x02,0x02,0x01,0xA9,0x00,0x01,0x01,
+// Frame 30: Diff RLE (1028 bytes)
+static const uint8_t HAPPY_FRAME30_DATA[1028] = {
+0xFF,0x00,0xFF,0x00,0xA2,0x00,0x02,0x01,0x03,0x02,0x07,0x03,0x03,0x02,0x02,0x01,
+0x71,0x00,0x01,0x01,0x03,0x02,0x08,0x03,0x03,0x02,0x02,0x01,0x3E,0x00,0x01,0x01,
 0x01,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x02,0x02,0x14,0x03,
-0x02,0x02,0x01,0x01,0xA2,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,0x62,0x00,
-0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x9D,0x00,0x01,0x02,0x21,0x03,
-0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x22,0x03,0x01,0x01,0x98,0x00,0x01,0x01,
-0x01,0x02,0x26,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x95,0x00,
-0x01,0x02,0x2A,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,0x91,0x00,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x2E,0x03,0x01,0x01,0x8D,0x00,
-0x01,0x01,0x31,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x8B,0x00,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x34,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x85,0x00,
-0x01,0x01,0x39,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x83,0x00,
-0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x81,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x7F,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x7D,0x00,0x01,0x01,
-0x41,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x7C,0x00,0x01,0x02,
-0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7A,0x00,0x01,0x02,
-0x44,0x03,0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x45,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x45,0x03,0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
-0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x48,0x03,0x38,0x00,
-0x01,0x01,0x48,0x03,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,
-0x01,0x02,0x49,0x03,0x74,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,
-0x01,0x01,0x72,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x71,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x70,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x01,0x6F,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x6E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6E,0x00,0x01,0x02,
-0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x50,0x03,
-0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,
-0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
-0x6B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,
-0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,
-0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,
-0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,
-0x01,0x01,0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,
-0x01,0x01,0x6B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,
-0x6C,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,
-0x01,0x02,0x6D,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6E,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6F,0x00,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x4D,0x03,
-0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x71,0x00,0x01,0x02,0x4C,0x03,
-0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x72,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,
-0x4A,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x48,0x03,0x01,0x01,0x76,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x78,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x44,0x03,0x01,0x02,0x7A,0x00,0x01,0x02,0x42,0x03,0x3E,0x00,0x01,0x01,0x42,0x03,
-0x01,0x01,0x7C,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x40,0x03,0x01,0x01,
-0x7E,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x82,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x01,0x85,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,
-0x36,0x03,0x01,0x01,0x89,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x8D,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x2C,0x03,0x01,0x01,0x93,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x01,0x02,0x01,0x01,0x9A,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xA4,0x00,0x04,0x01,
-0x0E,0x02,0x03,0x01,0x6D,0x00,0x03,0x01,0x0E,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x5B,0x00,
+0x02,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,0x62,0x00,
+0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,0x21,0x03,
+0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x22,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x01,0x02,0x26,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x02,0x2A,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,0x26,0x00,
+0x01,0x02,0x2D,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x2E,0x03,0x01,0x01,0x22,0x00,
+0x01,0x01,0x31,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x20,0x00,
+0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x34,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x1A,0x00,
+0x01,0x01,0x39,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x18,0x00,
+0x01,0x01,0x3B,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x16,0x00,
+0x01,0x01,0x3D,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x14,0x00,
+0x01,0x01,0x3F,0x03,0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x12,0x00,0x01,0x01,
+0x41,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x11,0x00,0x01,0x02,
+0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,
+0x44,0x03,0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x3B,0x00,0x01,0x02,0x45,0x03,0x0C,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x48,0x03,0x38,0x00,
+0x01,0x01,0x48,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,
+0x01,0x02,0x49,0x03,0x09,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x01,0x07,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,
+0x01,0x01,0x06,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x05,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x04,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
+0x03,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x03,0x00,0x01,0x02,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x50,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x51,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x51,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,0x01,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x2F,0x00,0x52,0x03,0x01,0x01,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,
+0x01,0x01,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x01,0x02,
+0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x01,0x02,0x52,0x03,0x2E,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,
+0x01,0x01,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x01,0x02,
+0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x01,0x02,0x52,0x03,0x2E,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,
+0x02,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x02,0x01,0x51,0x03,0x01,0x02,
+0x2F,0x00,0x01,0x02,0x51,0x03,0x01,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,
+0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x50,0x03,0x30,0x00,
+0x01,0x01,0x50,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,
+0x50,0x03,0x03,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x02,0x04,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x05,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
+0x06,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x07,0x00,
+0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
+0x49,0x03,0x01,0x02,0x37,0x00,0x4A,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x47,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x46,0x03,
+0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x42,0x03,
+0x3E,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
+0x41,0x00,0x40,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x43,0x00,
+0x01,0x02,0x3C,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,
+0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x35,0x03,0x01,0x02,
+0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x31,0x03,
+0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x22,0x00,
+0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x2C,0x03,
+0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
+0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x02,0x01,0x01,0x02,
+0x1B,0x03,0x02,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,
+0x01,0x01,0x39,0x00,0x04,0x01,0x0E,0x02,0x03,0x01,0x6D,0x00,0x03,0x01,0x0E,0x02,
+0x03,0x01,0x20,0x00,
 };
 static const DiffBlock HAPPY_FRAME30_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    53, 43,  // Changed box top-left
+    213, 69,  // Changed box dimensions
     HAPPY_FRAME30_DATA
 };
 
-// Frame 31: Full frame RLE (1514 bytes)
-static const uint8_t HAPPY_FRAME31_DATA[1514] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA8,0x00,0x03,0x01,0x7F,0x00,0x02,0x01,0xB3,0x00,
-0x01,0x01,0x03,0x02,0x0E,0x03,0x02,0x02,0x02,0x01,0x6B,0x00,0x02,0x01,0x02,0x02,
-0x0E,0x03,0x02,0x02,0x02,0x01,0xA4,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x02,0x02,
-0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x9D,0x00,
-0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x02,0x01,0x01,0x02,
-0x21,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x92,0x00,0x01,0x01,
-0x01,0x02,0x2C,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0x8D,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,
-0x30,0x03,0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,0x35,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x34,0x03,0x01,0x02,0x87,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,
-0x01,0x01,0x38,0x03,0x01,0x02,0x83,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x44,0x00,
-0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x80,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x7D,0x00,0x01,0x01,0x41,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x3B,0x00,0x46,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,
-0x48,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x37,0x00,0x4A,0x03,
-0x01,0x01,0x72,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x70,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x6E,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6C,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6B,0x00,0x53,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x53,0x03,
-0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x69,0x00,0x55,0x03,0x01,0x01,
-0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x57,0x03,0x01,0x01,0x29,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,
-0x58,0x03,0x66,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,
-0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x5B,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,
-0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
-0x29,0x00,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x67,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x68,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x69,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,
-0x54,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x6B,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,
-0x01,0x02,0x6D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6F,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x72,0x00,
-0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x74,0x00,0x01,0x01,
-0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x45,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x43,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
-0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x82,0x00,0x01,0x01,0x39,0x03,
-0x01,0x02,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x85,0x00,0x01,0x01,
-0x01,0x02,0x34,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
-0x01,0x01,0x89,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x30,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,
-0x94,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x02,0x01,0x59,0x00,0x01,0x01,
-0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,
-0x01,0x02,0x02,0x01,0x61,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,
-0xA4,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x03,0x02,0x02,0x01,0x6B,0x00,0x02,0x01,
-0x03,0x02,0x0C,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x05,0x00,
+// Frame 31: Diff RLE (1152 bytes)
+static const uint8_t HAPPY_FRAME31_DATA[1152] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x6B,0x00,0x03,0x01,0x7F,0x00,0x02,0x01,
+0x52,0x00,0x01,0x01,0x03,0x02,0x0E,0x03,0x02,0x02,0x02,0x01,0x6B,0x00,0x02,0x01,
+0x02,0x02,0x0E,0x03,0x02,0x02,0x02,0x01,0x43,0x00,0x02,0x01,0x01,0x02,0x19,0x03,
+0x02,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,
+0x3C,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x02,0x01,
+0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x31,0x00,
+0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
+0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x35,0x03,0x01,0x01,
+0x4B,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x38,0x03,0x01,0x01,
+0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
+0x44,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x3E,0x03,
+0x01,0x01,0x41,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x41,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x43,0x03,
+0x01,0x02,0x3D,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x3B,0x00,0x46,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
+0x39,0x00,0x48,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x37,0x00,
+0x4A,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x0F,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x0A,0x00,
+0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x08,0x00,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x55,0x03,
+0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x06,0x00,0x57,0x03,0x01,0x01,
+0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x58,0x03,0x05,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x02,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x02,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x04,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x04,0x00,
+0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x04,0x00,0x01,0x01,
+0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x06,0x00,0x01,0x02,
+0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x07,0x00,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x53,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x52,0x03,
+0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
+0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
+0x31,0x00,0x50,0x03,0x0E,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x4A,0x03,0x36,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x01,0x13,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x48,0x03,0x01,0x01,
+0x15,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
+0x18,0x00,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x1B,0x00,
+0x01,0x02,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x21,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,
+0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,
+0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
+0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,
+0x2A,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,
+0x02,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
+0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x61,0x00,0x01,0x01,0x02,0x02,
+0x1A,0x03,0x02,0x02,0x01,0x01,0x43,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x03,0x02,
+0x02,0x01,0x6B,0x00,0x02,0x01,0x03,0x02,0x0C,0x03,0x03,0x02,0x02,0x01,0x24,0x00,
+
 };
 static const DiffBlock HAPPY_FRAME31_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    48, 46,  // Changed box top-left
+    223, 83,  // Changed box dimensions
     HAPPY_FRAME31_DATA
 };
 
-// Frame 32: Full frame RLE (1496 bytes)
-static const uint8_t HAPPY_FRAME32_DATA[1496] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+// Frame 32: Diff RLE (1120 bytes)
+static const uint8_t HAPPY_FRAME32_DATA[1120] = {
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xAF,0x00,0x03,0x01,0x0D,0x02,0x03,0x01,0x6F,0x00,0x03,0x01,
-0x0D,0x02,0x03,0x01,0xA5,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,
-0x63,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0x9C,0x00,0x02,0x01,
+0xFF,0x00,0xFF,0x00,0xEE,0x00,0x03,0x01,0x0D,0x02,0x03,0x01,0x6F,0x00,0x03,0x01,
+0x0D,0x02,0x03,0x01,0x4A,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,
+0x63,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0x41,0x00,0x02,0x01,
 0x01,0x02,0x21,0x03,0x01,0x02,0x02,0x01,0x5B,0x00,0x01,0x01,0x02,0x02,0x21,0x03,
-0x01,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,
-0x55,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,
+0x55,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,
 0x2F,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
-0x8B,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x34,0x03,
-0x01,0x01,0x87,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,
-0x01,0x02,0x83,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,
-0x3C,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
-0x42,0x03,0x01,0x02,0x79,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x46,0x03,0x01,0x01,0x76,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x48,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x71,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,
-0x4D,0x03,0x6F,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x6D,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x69,0x00,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,0x57,0x03,0x01,0x01,
-0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x28,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x01,0x5F,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5E,0x00,0x01,0x02,
-0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x60,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,
-0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x60,0x00,
-0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x62,0x00,0x01,0x02,
-0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x29,0x00,0x58,0x03,0x67,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x02,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,
-0x01,0x02,0x4E,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,
-0x01,0x01,0x4C,0x03,0x01,0x02,0x72,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x01,0x74,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x46,0x03,0x01,0x02,0x78,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x44,0x03,0x01,0x02,0x7A,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x02,0x40,0x03,0x01,0x02,0x7E,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x81,0x00,0x01,0x01,0x39,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,
-0x85,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
-0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x8F,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x94,0x00,
-0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x23,0x03,0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0xA4,0x00,
-0x02,0x01,0x04,0x02,0x09,0x03,0x04,0x02,0x02,0x01,0x6D,0x00,0x02,0x01,0x03,0x02,
-0x0A,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF6,0x00,
+0x30,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x34,0x03,
+0x01,0x01,0x2C,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,
+0x01,0x02,0x28,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,
+0x3C,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
+0x40,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
+0x42,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
+0x46,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
+0x48,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,
+0x4A,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,
+0x4D,0x03,0x14,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x12,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x52,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x53,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x0E,0x00,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0D,0x00,0x57,0x03,0x01,0x01,
+0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x58,0x03,0x28,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,
+0x5A,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x01,0x06,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x01,0x04,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x03,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x03,0x00,0x01,0x02,
+0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x60,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x1F,0x00,0x62,0x03,0x01,0x01,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,
+0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x62,0x03,0x1E,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,
+0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x62,0x03,0x1E,0x00,
+0x01,0x01,0x62,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x02,0x01,
+0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x02,0x00,0x01,0x02,
+0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x02,0x00,0x01,0x02,
+0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x04,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x23,0x00,0x5E,0x03,0x01,0x01,0x05,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x0C,0x00,
+0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x0D,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x0F,0x00,
+0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x11,0x00,
+0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x13,0x00,
+0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x15,0x00,
+0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x17,0x00,
+0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x19,0x00,
+0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x1F,0x00,
+0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x23,0x00,
+0x01,0x01,0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x01,0x01,0x26,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,
+0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x35,0x03,0x01,0x02,
+0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x30,0x03,0x01,0x02,
+0x34,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
+0x2A,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,
+0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
+0x01,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x02,0x01,0x01,0x02,
+0x1A,0x03,0x01,0x02,0x02,0x01,0x49,0x00,0x02,0x01,0x04,0x02,0x09,0x03,0x04,0x02,
+0x02,0x01,0x6D,0x00,0x02,0x01,0x03,0x02,0x0A,0x03,0x03,0x02,0x02,0x01,0x28,0x00,
+
 };
 static const DiffBlock HAPPY_FRAME32_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 60,  // Changed box top-left
+    229, 81,  // Changed box dimensions
     HAPPY_FRAME32_DATA
 };
 
@@ -107,3223 +107,1329 @@ static const DiffBlock IDLE_FRAME0_BLOCK = {
     IDLE_FRAME0_DATA
 };
 
-// Frame 1: Full frame RLE (1072 bytes)
-static const uint8_t IDLE_FRAME1_DATA[1072] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x3F,0x00,0x35,0x01,0x4D,0x00,0x35,0x01,0x82,0x00,
-0x01,0x01,0x02,0x02,0x3E,0x03,0x01,0x02,0x02,0x01,0x3D,0x00,0x02,0x01,0x01,0x02,
-0x3E,0x03,0x02,0x02,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x72,0x00,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x69,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,
-0x01,0x01,0x65,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,
-0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
-0x5A,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x58,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x58,0x00,0x01,0x02,
-0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x56,0x00,0x01,0x01,
-0x67,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x67,0x03,0x56,0x00,0x01,0x01,0x67,0x03,
-0x01,0x02,0x19,0x00,0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x67,0x03,0x01,0x02,
-0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x68,0x03,0x18,0x00,
-0x01,0x01,0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,
-0x01,0x01,0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x68,0x03,0x18,0x00,0x01,0x01,
-0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x68,0x03,0x18,0x00,0x01,0x01,0x68,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,0x68,0x03,0x56,0x00,
-0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x67,0x03,0x57,0x00,0x01,0x02,
-0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x57,0x00,0x01,0x01,
-0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x59,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x63,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x21,0x00,0x60,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x22,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x69,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,
-0x71,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,
-0x01,0x02,0x46,0x03,0x01,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x02,0x02,0x3D,0x03,
-0x02,0x02,0x01,0x01,0x3E,0x00,0x02,0x01,0x02,0x02,0x3C,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x25,0x00,
-
+// Frame 1: Diff RLE (662 bytes)
+static const uint8_t IDLE_FRAME1_DATA[662] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4C,0x00,0x35,0x01,0x4D,0x00,
+0x35,0x01,0x2D,0x00,0x01,0x01,0x02,0x02,0x3E,0x03,0x01,0x02,0x02,0x01,0x3D,0x00,
+0x02,0x01,0x01,0x02,0x3E,0x03,0x02,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,
+0x47,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,
+0x4D,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x01,0x56,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
+0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x21,0x00,0x60,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
+0x62,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x05,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
+0x01,0x02,0x03,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,
+0x03,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x67,0x03,0x01,0x00,
+0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,0x68,0x03,0x01,0x01,0x01,0x02,0x67,0x03,
+0x01,0x02,0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x01,0x02,0x68,0x03,0x18,0x00,
+0x01,0x01,0x68,0x03,0x01,0x01,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,
+0x68,0x03,0x01,0x01,0x01,0x02,0x68,0x03,0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,
+0x01,0x02,0x68,0x03,0x18,0x00,0x01,0x01,0x68,0x03,0x02,0x01,0x67,0x03,0x01,0x02,
+0x19,0x00,0x68,0x03,0x01,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,0x01,0x02,
+0x67,0x03,0x02,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,
+0x01,0x02,0x02,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,
+0x04,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
+0x04,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x11,0x00,
+0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x14,0x00,
+0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
+0x18,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
+0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x02,0x01,0x22,0x00,
+0x01,0x01,0x02,0x02,0x3D,0x03,0x02,0x02,0x01,0x01,0x3E,0x00,0x02,0x01,0x02,0x02,
+0x3C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0x72,0x00,
 };
 static const DiffBlock IDLE_FRAME1_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    42, 75,  // Changed box top-left
+    235, 69,  // Changed box dimensions
     IDLE_FRAME1_DATA
 };
 
-// Frame 2: Full frame RLE (762 bytes)
-static const uint8_t IDLE_FRAME2_DATA[762] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x80,0x00,0x02,0x01,0x59,0x02,0x03,0x01,0x23,0x00,0x03,0x01,0x59,0x02,0x02,0x01,
-0x5E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x01,0x02,0x60,0x03,
-0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x68,0x03,0x18,0x00,0x01,0x01,
-0x68,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x6A,0x03,0x16,0x00,0x01,0x01,0x6A,0x03,
-0x01,0x01,0x52,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x6A,0x03,
-0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x6C,0x03,0x14,0x00,0x01,0x01,0x6C,0x03,
-0x01,0x02,0x51,0x00,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,
-0x51,0x00,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x51,0x00,
-0x01,0x02,0x6C,0x03,0x14,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x6B,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x01,0x01,0x52,0x00,
-0x01,0x02,0x6A,0x03,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x54,0x00,0x01,0x02,
-0x68,0x03,0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x1E,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,
+// Frame 2: Diff RLE (280 bytes)
+static const uint8_t IDLE_FRAME2_DATA[280] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF6,0x00,
+0x02,0x01,0x59,0x02,0x03,0x01,0x23,0x00,0x03,0x01,0x59,0x02,0x02,0x01,0x0D,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x01,0x02,
+0x65,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x68,0x03,0x18,0x00,0x01,0x01,0x68,0x03,
+0x01,0x01,0x03,0x00,0x01,0x02,0x6A,0x03,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,
+0x01,0x01,0x01,0x02,0x6C,0x03,0x14,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0x6D,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x6D,0x03,0x01,0x01,0x13,0x00,
+0x01,0x02,0x6C,0x03,0x02,0x02,0x6C,0x03,0x14,0x00,0x01,0x01,0x6C,0x03,0x02,0x01,
+0x6B,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x01,0x01,0x01,0x00,
+0x01,0x02,0x6A,0x03,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x03,0x00,0x01,0x02,
+0x68,0x03,0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x65,0x03,
+0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
 0x03,0x01,0x57,0x02,0x03,0x01,0x25,0x00,0x02,0x01,0x58,0x02,0x03,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x5E,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB7,0x00,
 };
 static const DiffBlock IDLE_FRAME2_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    40, 98,  // Changed box top-left
+    239, 38,  // Changed box dimensions
     IDLE_FRAME2_DATA
 };
 
-// Frame 3: Full frame RLE (696 bytes)
-static const uint8_t IDLE_FRAME3_DATA[696] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x40,0x00,0x02,0x01,0x61,0x02,0x02,0x01,
-0x1D,0x00,0x02,0x01,0x60,0x02,0x03,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x68,0x03,
-0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x6B,0x03,
-0x01,0x02,0x14,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x6D,0x03,
-0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,
-0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,
-0x11,0x00,0x70,0x03,0x4E,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,0x11,0x00,0x70,0x03,
-0x4E,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,
-0x4F,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,0x50,0x00,
-0x01,0x01,0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x01,
-0x53,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,
-0x01,0x02,0x57,0x00,0x65,0x01,0x1D,0x00,0x64,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x9C,0x00,
+// Frame 3: Diff RLE (174 bytes)
+static const uint8_t IDLE_FRAME3_DATA[174] = {
+0xFF,0x00,0xFF,0x00,0xDE,0x00,0x02,0x01,0x61,0x02,0x02,0x01,0x1D,0x00,0x02,0x01,
+0x60,0x02,0x03,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,
+0x01,0x01,0x68,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,
+0x01,0x01,0x6C,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,
+0x6E,0x03,0x02,0x01,0x6F,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,
+0x01,0x01,0x6F,0x03,0x01,0x02,0x11,0x00,0x70,0x03,0x01,0x01,0x6F,0x03,0x01,0x02,
+0x11,0x00,0x70,0x03,0x01,0x01,0x6F,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,
+0x01,0x01,0x05,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,
+0x68,0x03,0x01,0x02,0x09,0x00,0x65,0x01,0x1D,0x00,0x64,0x01,0xF8,0x00,
 };
 static const DiffBlock IDLE_FRAME3_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    38, 115,  // Changed box top-left
+    242, 16,  // Changed box dimensions
     IDLE_FRAME3_DATA
 };
 
-// Frame 4: Full frame RLE (994 bytes)
-static const uint8_t IDLE_FRAME4_DATA[994] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xB8,0x00,0x02,0x01,0x03,0x02,0x47,0x03,0x03,0x02,0x02,0x01,
-0x31,0x00,0x01,0x01,0x03,0x02,0x48,0x03,0x03,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x02,0x02,0x52,0x03,0x02,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x22,0x00,
-0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x60,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x67,0x03,
-0x01,0x02,0x19,0x00,0x68,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x69,0x03,0x01,0x02,
-0x17,0x00,0x01,0x02,0x69,0x03,0x54,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x15,0x00,
-0x01,0x01,0x6A,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,
-0x01,0x01,0x6C,0x03,0x01,0x01,0x51,0x00,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,
-0x6C,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,
-0x6D,0x03,0x50,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x6D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x6E,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x6D,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x6E,0x03,
-0x01,0x01,0x4F,0x00,0x01,0x02,0x6D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x6E,0x03,
-0x01,0x01,0x4F,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,
-0x51,0x00,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x01,
-0x52,0x00,0x01,0x02,0x6A,0x03,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x53,0x00,
-0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x55,0x00,
-0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,0x68,0x03,0x57,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,
-0x01,0x02,0x51,0x03,0x02,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x52,0x03,
-0x01,0x02,0x01,0x01,0x6C,0x00,0x02,0x01,0x05,0x02,0x01,0x03,0x3F,0x02,0x02,0x03,
-0x04,0x02,0x02,0x01,0x33,0x00,0x02,0x01,0x45,0x02,0x01,0x03,0x04,0x02,0x03,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x60,0x00,
+// Frame 4: Diff RLE (526 bytes)
+static const uint8_t IDLE_FRAME4_DATA[526] = {
+0x10,0x00,0x02,0x01,0x03,0x02,0x47,0x03,0x03,0x02,0x02,0x01,0x31,0x00,0x01,0x01,
+0x03,0x02,0x48,0x03,0x03,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x01,0x02,0x01,0x01,0x2B,0x00,0x02,0x02,0x52,0x03,0x02,0x02,0x01,0x01,0x17,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,
+0x01,0x01,0x13,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x01,0x02,
+0x5D,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x63,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1A,0x00,
+0x01,0x01,0x66,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,
+0x68,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,
+0x69,0x03,0x06,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,
+0x01,0x02,0x04,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x6C,0x03,
+0x01,0x01,0x03,0x00,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,
+0x02,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6D,0x03,0x02,0x00,
+0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x6D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x6E,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x6D,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x6E,0x03,0x01,0x01,0x01,0x00,
+0x01,0x02,0x6D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x6E,0x03,0x01,0x01,0x01,0x00,
+0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x03,0x00,0x6D,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x6B,0x03,
+0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x01,0x04,0x00,0x01,0x02,
+0x6A,0x03,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x69,0x03,
+0x01,0x02,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x67,0x03,
+0x01,0x02,0x19,0x00,0x68,0x03,0x09,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,
+0x01,0x02,0x65,0x03,0x0B,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x60,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x51,0x03,
+0x02,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,
+0x1E,0x00,0x02,0x01,0x05,0x02,0x01,0x03,0x3F,0x02,0x02,0x03,0x04,0x02,0x02,0x01,
+0x33,0x00,0x02,0x01,0x45,0x02,0x01,0x03,0x04,0x02,0x03,0x01,0x10,0x00,
 };
 static const DiffBlock IDLE_FRAME4_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    38, 104,  // Changed box top-left
+    242, 31,  // Changed box dimensions
     IDLE_FRAME4_DATA
 };
 
-// Frame 5: Full frame RLE (1458 bytes)
-static const uint8_t IDLE_FRAME5_DATA[1458] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x36,0x00,0x15,0x01,0x6C,0x00,0x16,0x01,0xA1,0x00,0x02,0x01,
-0x02,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0x5D,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,
-0x02,0x02,0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x55,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x02,0x01,0x8E,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x88,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x82,0x00,0x01,0x01,0x01,0x02,
-0x3B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x7E,0x00,
-0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,
-0x01,0x01,0x79,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x77,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x34,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x02,0x51,0x03,0x6B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,
-0x01,0x01,0x54,0x03,0x01,0x01,0x68,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x62,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,
-0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x63,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x64,0x03,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
-0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x57,0x00,0x67,0x03,0x01,0x01,0x19,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,
-0x68,0x03,0x56,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x68,0x03,
-0x01,0x01,0x55,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,
-0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x02,
-0x68,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,
-0x68,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,
-0x69,0x03,0x54,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,
-0x54,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x54,0x00,
-0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x54,0x00,0x01,0x01,
-0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x54,0x00,0x01,0x01,0x69,0x03,
-0x01,0x01,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x68,0x03,
-0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x68,0x03,
-0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x67,0x03,0x01,0x02,
-0x19,0x00,0x68,0x03,0x56,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
-0x65,0x03,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x5A,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5F,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x60,0x00,0x5D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x62,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x66,0x00,0x57,0x03,0x01,0x01,0x29,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,
-0x01,0x01,0x52,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,
-0x01,0x02,0x4F,0x03,0x01,0x01,0x6F,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,
-0x01,0x01,0x4C,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,
-0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x41,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x7D,0x00,0x01,0x01,0x3D,0x03,
-0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x81,0x00,0x01,0x01,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,
-0x32,0x03,0x01,0x02,0x01,0x01,0x8C,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
-0x01,0x01,0x52,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,0x02,0x02,0x01,0x01,0x93,0x00,
-0x01,0x01,0x02,0x02,0x21,0x03,0x02,0x02,0x02,0x01,0x59,0x00,0x02,0x01,0x02,0x02,
-0x20,0x03,0x02,0x02,0x02,0x01,0x9C,0x00,0x04,0x01,0x16,0x02,0x03,0x01,0x65,0x00,
-0x03,0x01,0x16,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x2F,0x00,
+// Frame 5: Diff RLE (1076 bytes)
+static const uint8_t IDLE_FRAME5_DATA[1076] = {
+0x2D,0x00,0x15,0x01,0x6C,0x00,0x16,0x01,0x52,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,
+0x01,0x02,0x02,0x01,0x5D,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,
+0x47,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,
+0x01,0x02,0x28,0x03,0x01,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
+0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,
+0x36,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
+0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x01,0x02,
+0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,
+0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x28,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x24,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
+0x51,0x03,0x1C,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x19,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,
+0x01,0x01,0x17,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
+0x15,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x13,0x00,
+0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x11,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x0F,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,
+0x66,0x03,0x01,0x01,0x08,0x00,0x67,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x07,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,0x68,0x03,0x07,0x00,
+0x01,0x02,0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x06,0x00,
+0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x05,0x00,
+0x01,0x01,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x05,0x00,
+0x01,0x01,0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x05,0x00,0x01,0x01,
+0x69,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x05,0x00,0x01,0x01,0x69,0x03,
+0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x05,0x00,0x01,0x01,0x69,0x03,0x01,0x02,
+0x17,0x00,0x01,0x02,0x69,0x03,0x05,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x68,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,
+0x01,0x01,0x68,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x68,0x03,0x18,0x00,0x01,0x01,
+0x68,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x19,0x00,0x68,0x03,
+0x07,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x08,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x0A,0x00,
+0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,
+0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x60,0x03,0x10,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,
+0x01,0x01,0x5E,0x03,0x01,0x01,0x11,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x13,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x17,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x19,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,
+0x01,0x02,0x1B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x01,0x20,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,
+0x01,0x02,0x23,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x48,0x03,
+0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
+0x46,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
+0x01,0x01,0x42,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x42,0x00,
+0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,
+0x01,0x02,0x32,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x52,0x00,
+0x01,0x01,0x02,0x02,0x2A,0x03,0x02,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x02,0x02,
+0x21,0x03,0x02,0x02,0x02,0x01,0x59,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,
+0x02,0x01,0x4D,0x00,0x04,0x01,0x16,0x02,0x03,0x01,0x65,0x00,0x03,0x01,0x16,0x02,
+0x03,0x01,0x2A,0x00,
 };
 static const DiffBlock IDLE_FRAME5_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    39, 78,  // Changed box top-left
+    241, 66,  // Changed box dimensions
     IDLE_FRAME5_DATA
 };
 
-// Frame 6: Full frame RLE (1530 bytes)
-static const uint8_t IDLE_FRAME6_DATA[1530] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x72,0x00,0x02,0x01,
-0x06,0x02,0x05,0x03,0x06,0x02,0x03,0x01,0x6B,0x00,0x03,0x01,0x06,0x02,0x04,0x03,
-0x06,0x02,0x03,0x01,0xA3,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x99,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x8C,0x00,0x01,0x01,0x01,0x02,
-0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x01,0x88,0x00,
-0x01,0x01,0x37,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
-0x83,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x7F,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x79,0x00,0x01,0x02,0x46,0x03,0x01,0x01,
-0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
-0x37,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,
-0x01,0x01,0x4C,0x03,0x01,0x01,0x70,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,
-0x52,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2B,0x00,
-0x01,0x02,0x55,0x03,0x67,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,
-0x57,0x03,0x65,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x62,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x60,0x00,
-0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x62,0x03,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,
-0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,
-0x01,0x02,0x64,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,
-0x01,0x02,0x65,0x03,0x58,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x66,0x03,
-0x01,0x01,0x57,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x57,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x57,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x57,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x57,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x57,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x57,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x66,0x03,
-0x01,0x01,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,
-0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x60,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x62,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,
-0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
-0x6C,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
-0x6E,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,
-0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x74,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,
-0x76,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x7A,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x7D,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x01,0x81,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x46,0x00,
-0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x85,0x00,0x01,0x01,0x01,0x02,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x8A,0x00,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x01,0x01,0x90,0x00,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x01,0x02,0x02,
-0x1F,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x02,0x01,0x9D,0x00,0x03,0x01,0x02,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0x65,0x00,
-0x02,0x01,0x03,0x02,0x12,0x03,0x03,0x02,0x02,0x01,0xAA,0x00,0x0D,0x01,0x74,0x00,
-0x0E,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF4,0x00,
+// Frame 6: Diff RLE (1160 bytes)
+static const uint8_t IDLE_FRAME6_DATA[1160] = {
+0x2B,0x00,0x02,0x01,0x06,0x02,0x05,0x03,0x06,0x02,0x03,0x01,0x6B,0x00,0x03,0x01,
+0x06,0x02,0x04,0x03,0x06,0x02,0x03,0x01,0x4F,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,
+0x02,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,
+0x45,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
+0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
+0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
+0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,
+0x01,0x01,0x34,0x00,0x01,0x01,0x37,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,
+0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,
+0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
+0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,
+0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
+0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x21,0x00,0x01,0x01,
+0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,
+0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x1C,0x00,0x4F,0x03,0x01,0x01,
+0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x55,0x03,
+0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,0x13,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x01,0x02,0x57,0x03,0x11,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x27,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
+0x5D,0x03,0x0C,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x08,0x00,
+0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x07,0x00,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x05,0x00,0x01,0x02,
+0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x05,0x00,0x65,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x65,0x03,
+0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x04,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
+0x1B,0x00,0x66,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,
+0x01,0x01,0x66,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
+0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
+0x1B,0x00,0x66,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x02,0x64,0x03,0x01,0x02,0x05,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x07,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,
+0x08,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x09,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x0B,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x0C,0x00,0x5D,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x5A,0x03,
+0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x58,0x03,0x28,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
+0x01,0x01,0x56,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x54,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,
+0x50,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,
+0x4D,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,
+0x4A,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
+0x48,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,
+0x01,0x02,0x44,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x3F,0x00,
+0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,
+0x42,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x39,0x03,
+0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
+0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,0x01,0x02,
+0x01,0x01,0x36,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
+0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x02,0x02,0x28,0x03,0x01,0x02,
+0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
+0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x02,0x01,0x01,0x02,
+0x20,0x03,0x01,0x02,0x02,0x01,0x49,0x00,0x03,0x01,0x02,0x02,0x13,0x03,0x03,0x02,
+0x02,0x01,0x65,0x00,0x02,0x01,0x03,0x02,0x12,0x03,0x03,0x02,0x02,0x01,0x56,0x00,
+0x0D,0x01,0x74,0x00,0x0E,0x01,0x2E,0x00,
 };
 static const DiffBlock IDLE_FRAME6_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    41, 75,  // Changed box top-left
+    236, 70,  // Changed box dimensions
     IDLE_FRAME6_DATA
 };
 
-// Frame 7: Full frame RLE (1334 bytes)
-static const uint8_t IDLE_FRAME7_DATA[1334] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xF5,0x00,0x05,0x01,0x1B,0x02,0x04,0x01,0x5C,0x00,0x04,0x01,
-0x1F,0x02,0x03,0x01,0x94,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x02,0x01,
-0x50,0x00,0x02,0x01,0x02,0x02,0x2A,0x03,0x02,0x02,0x02,0x01,0x8A,0x00,0x01,0x01,
-0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
-0x01,0x02,0x01,0x01,0x84,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,
-0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x7E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x79,0x00,0x01,0x01,
-0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x01,
-0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x71,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,
-0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
-0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x01,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x62,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x01,0x60,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x5A,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x58,0x00,0x01,0x01,
-0x66,0x03,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x57,0x00,0x68,0x03,0x18,0x00,
-0x01,0x01,0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,
-0x01,0x01,0x68,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x17,0x00,
-0x01,0x02,0x68,0x03,0x01,0x02,0x55,0x00,0x69,0x03,0x01,0x02,0x01,0x01,0x16,0x00,
-0x6A,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
-0x6A,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
-0x6A,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
-0x6A,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,0x15,0x00,0x01,0x01,
-0x6A,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
-0x6A,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
-0x6A,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
-0x6A,0x03,0x01,0x01,0x54,0x00,0x69,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x02,
-0x69,0x03,0x55,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x68,0x03,
-0x01,0x02,0x55,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,
-0x01,0x01,0x56,0x00,0x68,0x03,0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,
-0x56,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x57,0x00,0x01,0x01,0x66,0x03,0x1B,0x00,0x66,0x03,0x59,0x00,0x01,0x01,0x64,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x5A,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5C,0x00,0x61,0x03,0x01,0x02,
-0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
-0x20,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
-0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x24,0x00,0x5C,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,
-0x26,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
-0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x50,0x03,
-0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,0x71,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,
-0x01,0x01,0x75,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x7F,0x00,0x01,0x01,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x84,0x00,0x01,0x01,0x02,0x02,0x32,0x03,0x02,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x8D,0x00,0x01,0x01,
-0x02,0x02,0x28,0x03,0x02,0x02,0x01,0x01,0x53,0x00,0x02,0x01,0x02,0x02,0x27,0x03,
-0x01,0x02,0x02,0x01,0x97,0x00,0x04,0x01,0x1A,0x02,0x04,0x01,0x61,0x00,0x1E,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x35,0x00,
+// Frame 7: Diff RLE (930 bytes)
+static const uint8_t IDLE_FRAME7_DATA[930] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0x6F,0x00,0x05,0x01,0x1B,0x02,0x04,0x01,0x5C,0x00,0x04,0x01,0x1F,0x02,
+0x03,0x01,0x41,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x02,0x01,0x50,0x00,
+0x02,0x01,0x02,0x02,0x2A,0x03,0x02,0x02,0x02,0x01,0x37,0x00,0x01,0x01,0x01,0x02,
+0x34,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
+0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
+0x01,0x02,0x3C,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x46,0x03,
+0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x01,0x02,
+0x50,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x15,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,
+0x11,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
+0x0A,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x07,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x66,0x03,
+0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
+0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x04,0x00,0x68,0x03,0x18,0x00,0x01,0x01,
+0x68,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,
+0x68,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x17,0x00,0x01,0x02,
+0x68,0x03,0x01,0x02,0x02,0x00,0x69,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x6A,0x03,
+0x02,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,0x02,0x01,0x6A,0x03,
+0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,0x02,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x6A,0x03,0x01,0x02,0x01,0x01,0x6A,0x03,0x01,0x02,0x15,0x00,0x01,0x01,
+0x6A,0x03,0x01,0x02,0x01,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,
+0x01,0x02,0x01,0x01,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,0x02,0x01,
+0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x01,0x00,0x69,0x03,
+0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x02,0x69,0x03,0x02,0x00,0x01,0x02,0x68,0x03,
+0x01,0x02,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x68,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x03,0x00,0x68,0x03,0x19,0x00,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
+0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x66,0x03,0x1B,0x00,
+0x66,0x03,0x06,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x07,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x09,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x13,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x15,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x02,
+0x50,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
+0x01,0x02,0x4D,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x35,0x00,
+0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
+0x26,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,
+0x40,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,
+0x43,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,
+0x02,0x02,0x32,0x03,0x02,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x02,0x02,0x01,0x01,
+0x53,0x00,0x02,0x01,0x02,0x02,0x27,0x03,0x01,0x02,0x02,0x01,0x44,0x00,0x04,0x01,
+0x1A,0x02,0x04,0x01,0x61,0x00,0x1E,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xCC,0x00,
 };
 static const DiffBlock IDLE_FRAME7_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    39, 75,  // Changed box top-left
+    237, 70,  // Changed box dimensions
     IDLE_FRAME7_DATA
 };
 
-// Frame 8: Full frame RLE (766 bytes)
-static const uint8_t IDLE_FRAME8_DATA[766] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x7C,0x00,0x01,0x01,0x02,0x02,0x5C,0x03,0x02,0x02,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x02,0x02,0x5C,0x03,0x02,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,
-0x56,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,
-0x54,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,
-0x52,0x00,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0x50,0x00,
-0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,
-0x6E,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x6E,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,
-0x6E,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,
-0x6E,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x6E,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,
-0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x6C,0x03,
-0x01,0x01,0x13,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x6A,0x03,
-0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x67,0x03,
-0x01,0x02,0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x02,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x9F,0x00,
+// Frame 8: Diff RLE (336 bytes)
+static const uint8_t IDLE_FRAME8_DATA[336] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x22,0x00,0x01,0x01,0x02,0x02,
+0x5C,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x02,0x02,0x5C,0x03,0x02,0x02,
+0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,
+0x01,0x01,0x68,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x6A,0x03,0x01,0x02,0x0B,0x00,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x01,
+0x6C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x6E,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x6E,0x03,
+0x01,0x02,0x08,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x6E,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,
+0x0D,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,
+0x10,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x14,0x00,0x01,0x01,0x02,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x21,0x00,
+0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0x03,0x00,
+
 };
 static const DiffBlock IDLE_FRAME8_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    27, 85,  // Changed box top-left
+    249, 55,  // Changed box dimensions
     IDLE_FRAME8_DATA
 };
 
-// Frame 9: Full frame RLE (1144 bytes)
-static const uint8_t IDLE_FRAME9_DATA[1144] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE7,0x00,
-0x03,0x01,0x2C,0x02,0x03,0x01,0x4F,0x00,0x04,0x01,0x2B,0x02,0x04,0x01,0x87,0x00,
-0x01,0x01,0x01,0x02,0x38,0x03,0x02,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x02,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x77,0x00,
-0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x47,0x03,
-0x01,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x34,0x00,0x01,0x02,
-0x4B,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,
-0x30,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
-0x01,0x01,0x2C,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,
-0x55,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x66,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x58,0x03,0x64,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x26,0x00,0x5B,0x03,0x62,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x24,0x00,
-0x5D,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x5F,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,
-0x61,0x03,0x01,0x01,0x5C,0x00,0x62,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,
-0x5B,0x00,0x01,0x02,0x63,0x03,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x59,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,0x65,0x03,0x01,0x01,0x58,0x00,0x01,0x02,
-0x65,0x03,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x1A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x1A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,
-0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x1C,0x00,0x65,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x63,0x03,0x1D,0x00,0x01,0x01,
-0x63,0x03,0x01,0x01,0x5B,0x00,0x62,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,
-0x5C,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x5E,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x24,0x00,0x5D,0x03,0x01,0x01,
-0x61,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x5A,0x03,0x64,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x58,0x03,0x67,0x00,0x01,0x02,
-0x55,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x69,0x00,0x01,0x02,
-0x52,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,
-0x4F,0x03,0x01,0x01,0x30,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x34,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x74,0x00,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
-0x78,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,0x02,0x01,0x01,0x02,0x38,0x03,0x02,0x02,
-0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x87,0x00,
-0x03,0x01,0x2D,0x02,0x03,0x01,0x4E,0x00,0x03,0x01,0x2D,0x02,0x03,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x40,0x00,
+// Frame 9: Diff RLE (716 bytes)
+static const uint8_t IDLE_FRAME9_DATA[716] = {
+0x1D,0x00,0x03,0x01,0x2C,0x02,0x03,0x01,0x4F,0x00,0x04,0x01,0x2B,0x02,0x04,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x02,0x02,0x01,0x01,0x44,0x00,0x01,0x01,
+0x02,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
+0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,
+0x28,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x47,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x34,0x00,
+0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,
+0x01,0x01,0x30,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x52,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x19,0x00,0x01,0x01,
+0x01,0x02,0x55,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x17,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x58,0x03,0x15,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x26,0x00,0x5B,0x03,0x13,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x24,0x00,0x5D,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x22,0x00,
+0x01,0x02,0x5D,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,
+0x01,0x01,0x61,0x03,0x01,0x01,0x0D,0x00,0x62,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,
+0x62,0x03,0x0C,0x00,0x01,0x02,0x63,0x03,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,0x65,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x65,0x03,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x65,0x03,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x64,0x03,
+0x01,0x02,0x1C,0x00,0x65,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x63,0x03,0x1D,0x00,
+0x01,0x01,0x63,0x03,0x01,0x01,0x0C,0x00,0x62,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,
+0x62,0x03,0x0D,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,
+0x61,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x02,
+0x5F,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x24,0x00,0x5D,0x03,
+0x01,0x01,0x12,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x5A,0x03,
+0x15,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x58,0x03,0x18,0x00,
+0x01,0x02,0x55,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x1A,0x00,
+0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x4F,0x03,0x01,0x01,0x30,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x20,0x00,
+0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x34,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x25,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x47,0x03,
+0x01,0x02,0x29,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x02,0x01,0x01,0x02,0x38,0x03,
+0x02,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x03,0x01,0x2D,0x02,0x03,0x01,0x4E,0x00,0x03,0x01,0x2D,0x02,0x03,0x01,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCB,0x00,
 };
 static const DiffBlock IDLE_FRAME9_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    27, 89,  // Changed box top-left
+    241, 49,  // Changed box dimensions
     IDLE_FRAME9_DATA
 };
 
-// Frame 10: Full frame RLE (1528 bytes)
-static const uint8_t IDLE_FRAME10_DATA[1528] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x82,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x66,0x00,0x58,0x03,0x01,0x02,0x28,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x61,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x01,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,
-0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,
-0x61,0x03,0x01,0x02,0x5D,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x5F,0x00,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x61,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x55,0x03,
-0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,
-0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6A,0x00,0x52,0x03,
-0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6C,0x00,0x50,0x03,0x01,0x02,
-0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,
-0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,0x01,0x01,
-0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,0x42,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,
-0x3F,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x80,0x00,
-0x01,0x02,0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x84,0x00,
-0x01,0x02,0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0x88,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,
-0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x02,0x25,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,0x01,0x02,
-0x1D,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x02,0x01,0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0xAE,0x00,
-0x07,0x01,0x7A,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+// Frame 10: Diff RLE (1158 bytes)
+static const uint8_t IDLE_FRAME10_DATA[1158] = {
+0x2B,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,0x05,0x01,
+0x51,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x01,0x01,
+0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x20,0x03,
+0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
+0x28,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x38,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
+0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x43,0x03,0x01,0x02,
+0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x47,0x03,
+0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x49,0x03,
+0x01,0x02,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x18,0x00,0x01,0x01,
+0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x51,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x53,0x03,
+0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x57,0x03,0x2A,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x0F,0x00,0x58,0x03,0x01,0x02,0x28,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x0C,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x08,0x00,0x01,0x01,
+0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x61,0x03,
+0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x03,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x03,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x02,0x64,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x02,0x64,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x02,0x64,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x03,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x03,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,
+0x01,0x02,0x03,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x61,0x03,
+0x01,0x02,0x06,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x06,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x08,0x00,
+0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x13,0x00,0x52,0x03,0x01,0x02,
+0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x15,0x00,0x50,0x03,0x01,0x02,0x30,0x00,
+0x01,0x02,0x50,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x34,0x00,
+0x01,0x01,0x4B,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x48,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x3A,0x00,
+0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x42,0x03,0x01,0x02,
+0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x3F,0x03,
+0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x29,0x00,0x01,0x02,
+0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,
+0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x31,0x00,
+0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,
+0x01,0x02,0x36,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,
+0x2C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
+0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
+0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,
+0x02,0x02,0x01,0x01,0x4A,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,
+0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0x57,0x00,0x07,0x01,
+0x7A,0x00,0x08,0x01,0x30,0x00,
 };
 static const DiffBlock IDLE_FRAME10_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    29, 65,  // Changed box top-left
+    233, 70,  // Changed box dimensions
     IDLE_FRAME10_DATA
 };
 
-// Frame 11: Full frame RLE (1530 bytes)
-static const uint8_t IDLE_FRAME11_DATA[1530] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x82,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x66,0x00,0x58,0x03,0x01,0x02,0x28,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x61,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x01,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x61,0x03,0x01,0x02,0x5D,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x5F,0x00,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x61,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6A,0x00,
-0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6C,0x00,0x50,0x03,
-0x01,0x02,0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x80,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
-0x84,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x88,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,
-0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,
-0x03,0x02,0x02,0x01,0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,
-0xAE,0x00,0x07,0x01,0x7A,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+// Frame 11: Diff RLE (532 bytes)
+static const uint8_t IDLE_FRAME11_DATA[532] = {
+0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x0B,0x00,0x01,0x03,0x01,0x02,
+0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x09,0x00,0x03,0x03,0x32,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x01,0x08,0x00,0x04,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,
+0x01,0x02,0x07,0x00,0x05,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x06,0x00,
+0x06,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x05,0x00,0x07,0x03,
+0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x04,0x00,0x07,0x03,0x01,0x02,0x28,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x03,0x00,0x08,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x03,0x00,0x09,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x02,0x00,
+0x0A,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x01,0x00,0x0A,0x03,0x01,0x02,
+0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x00,0x0B,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x6D,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x6E,0x03,
+0x01,0x01,0x1D,0x00,0x6F,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x1D,0x00,0x6E,0x03,0x01,0x02,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x6D,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,
+0x1F,0x00,0x6D,0x03,0x20,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x20,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x0B,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x0A,0x03,
+0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x00,0x09,0x03,0x01,0x02,
+0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x01,0x00,0x09,0x03,0x01,0x01,0x25,0x00,
+0x5B,0x03,0x01,0x02,0x02,0x00,0x08,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x03,0x00,0x07,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
+0x03,0x00,0x06,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x04,0x00,
+0x05,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x05,0x00,0x04,0x03,
+0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x06,0x00,0x03,0x03,0x01,0x02,
+0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x07,0x00,0x02,0x03,0x01,0x02,0x32,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x08,0x00,0x01,0x03,0x01,0x01,0x34,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,
+0x44,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x42,0x03,
+0x01,0x01,0x0E,0x00,
 };
 static const DiffBlock IDLE_FRAME11_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    117, 76,  // Changed box top-left
+    141, 50,  // Changed box dimensions
     IDLE_FRAME11_DATA
 };
 
-// Frame 12: Full frame RLE (1530 bytes)
-static const uint8_t IDLE_FRAME12_DATA[1530] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x82,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x66,0x00,0x58,0x03,0x01,0x02,0x28,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x61,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x01,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x61,0x03,0x01,0x02,0x5D,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x5F,0x00,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x61,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6A,0x00,
-0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6C,0x00,0x50,0x03,
-0x01,0x02,0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x80,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
-0x84,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x88,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,
-0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,
-0x03,0x02,0x02,0x01,0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,
-0xAE,0x00,0x07,0x01,0x7A,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+// Frame 12: no change
+
+// Frame 13: no change
+
+// Frame 14: no change
+
+// Frame 15: no change
+
+// Frame 16: no change
+
+// Frame 17: no change
+
+// Frame 18: Diff RLE (1034 bytes)
+static const uint8_t IDLE_FRAME18_DATA[1034] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFE,0x00,0x08,0x01,
+0x79,0x00,0x09,0x01,0x61,0x00,0x03,0x01,0x03,0x02,0x14,0x03,0x03,0x02,0x03,0x01,
+0x61,0x00,0x03,0x01,0x04,0x02,0x13,0x03,0x04,0x02,0x02,0x01,0x50,0x00,0x02,0x01,
+0x02,0x02,0x24,0x03,0x02,0x02,0x02,0x01,0x56,0x00,0x01,0x01,0x03,0x02,0x23,0x03,
+0x02,0x02,0x02,0x01,0x46,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,
+0x4D,0x00,0x02,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,
+0x02,0x02,0x36,0x03,0x02,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x37,0x03,
+0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,
+0x44,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,
+0x2C,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,
+0x49,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
+0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
+0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x68,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x69,0x03,0x0B,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,0x16,0x00,
+0x6B,0x03,0x09,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x14,0x00,0x6C,0x03,0x01,0x02,
+0x07,0x00,0x01,0x01,0x6E,0x03,0x13,0x00,0x01,0x02,0x6D,0x03,0x01,0x01,0x06,0x00,
+0x01,0x02,0x6E,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x70,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x04,0x00,
+0x71,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x71,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
+0x72,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x71,0x03,0x01,0x02,0x02,0x00,0x01,0x02,
+0x72,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x73,0x03,0x01,0x00,0x01,0x01,0x74,0x03,
+0x0D,0x00,0x01,0x02,0x73,0x03,0x02,0x01,0x74,0x03,0x01,0x01,0x0C,0x00,0x74,0x03,
+0x01,0x02,0x01,0x01,0x74,0x03,0x01,0x02,0x0C,0x00,0x74,0x03,0x02,0x02,0x74,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x75,0x03,0x01,0x02,0x74,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x01,0x75,0x03,0x01,0x02,0x74,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x75,0x03,
+0x01,0x02,0x74,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x75,0x03,0x01,0x01,0x74,0x03,
+0x01,0x01,0x0C,0x00,0x74,0x03,0x01,0x02,0x01,0x01,0x74,0x03,0x01,0x01,0x0C,0x00,
+0x74,0x03,0x01,0x02,0x01,0x00,0x74,0x03,0x0D,0x00,0x01,0x02,0x73,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x72,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x73,0x03,0x02,0x00,
+0x01,0x01,0x72,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x71,0x03,0x01,0x02,0x03,0x00,
+0x71,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x71,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
+0x70,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x05,0x00,0x01,0x02,
+0x6E,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x05,0x00,0x01,0x01,
+0x6E,0x03,0x13,0x00,0x01,0x02,0x6D,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x6C,0x03,
+0x01,0x01,0x14,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x6A,0x03,
+0x01,0x01,0x16,0x00,0x6A,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x68,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
+0x1A,0x00,0x66,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,
+0x64,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x21,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x27,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
+0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x50,0x03,
+0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,
+0x29,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x3D,0x03,
+0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,
+0x01,0x02,0x37,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,
+0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,0x47,0x00,
+0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x57,0x00,0x02,0x01,0x02,0x02,
+0x23,0x03,0x02,0x02,0x01,0x01,0x52,0x00,0x02,0x01,0x04,0x02,0x12,0x03,0x04,0x02,
+0x02,0x01,0x63,0x00,0x03,0x01,0x04,0x02,0x11,0x03,0x04,0x02,0x03,0x01,0x63,0x00,
+0x06,0x01,0x7B,0x00,0x07,0x01,0xFF,0x00,0x2F,0x00,
 };
-static const DiffBlock IDLE_FRAME12_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME12_DATA
+static const DiffBlock IDLE_FRAME18_BLOCK = {
+    26, 65,  // Changed box top-left
+    247, 70,  // Changed box dimensions
+    IDLE_FRAME18_DATA
 };
 
-// Frame 13: Full frame RLE (1530 bytes)
-static const uint8_t IDLE_FRAME13_DATA[1530] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x82,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x66,0x00,0x58,0x03,0x01,0x02,0x28,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x61,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x01,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x61,0x03,0x01,0x02,0x5D,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x5F,0x00,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x61,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6A,0x00,
-0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6C,0x00,0x50,0x03,
-0x01,0x02,0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x80,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
-0x84,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x88,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,
-0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,
-0x03,0x02,0x02,0x01,0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,
-0xAE,0x00,0x07,0x01,0x7A,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+// Frame 19: Diff RLE (1022 bytes)
+static const uint8_t IDLE_FRAME19_DATA[1022] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4D,0x00,0x03,0x01,
+0x7E,0x00,0x04,0x01,0x6E,0x00,0x02,0x01,0x03,0x02,0x15,0x03,0x03,0x02,0x02,0x01,
+0x62,0x00,0x02,0x01,0x03,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x59,0x00,0x02,0x01,
+0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x02,0x02,0x26,0x03,
+0x01,0x02,0x02,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
+0x4C,0x00,0x01,0x01,0x02,0x02,0x30,0x03,0x01,0x02,0x02,0x01,0x46,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x01,0x02,0x02,0x01,0x3E,0x00,0x01,0x01,0x02,0x02,0x3F,0x03,0x01,0x02,0x02,0x01,
+0x3D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x46,0x03,
+0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,
+0x32,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x2E,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x02,
+0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x26,0x00,
+0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,
+0x22,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x1C,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
+0x1A,0x00,0x66,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x16,0x00,
+0x01,0x01,0x69,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x14,0x00,
+0x01,0x01,0x6B,0x03,0x01,0x01,0x15,0x00,0x6B,0x03,0x01,0x02,0x12,0x00,0x01,0x01,
+0x6D,0x03,0x01,0x01,0x13,0x00,0x6D,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x6F,0x03,
+0x12,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x71,0x03,0x10,0x00,
+0x01,0x02,0x70,0x03,0x01,0x01,0x0D,0x00,0x72,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,
+0x72,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x73,0x03,0x01,0x01,0x0D,0x00,0x74,0x03,
+0x0A,0x00,0x01,0x01,0x75,0x03,0x0C,0x00,0x01,0x02,0x74,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x75,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x76,0x03,0x08,0x00,0x01,0x01,
+0x77,0x03,0x0A,0x00,0x01,0x02,0x76,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x77,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x77,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x77,0x03,
+0x01,0x02,0x08,0x00,0x01,0x01,0x77,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x78,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x06,0x00,0x79,0x03,0x08,0x00,
+0x01,0x02,0x78,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x79,0x03,0x08,0x00,0x01,0x02,
+0x78,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x79,0x03,0x08,0x00,0x01,0x02,0x78,0x03,
+0x01,0x01,0x06,0x00,0x79,0x03,0x08,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x06,0x00,
+0x78,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x06,0x00,0x01,0x02,
+0x77,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x77,0x03,0x01,0x02,0x01,0x01,0x06,0x00,
+0x01,0x02,0x77,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x77,0x03,0x01,0x02,0x07,0x00,
+0x01,0x01,0x77,0x03,0x0A,0x00,0x01,0x02,0x76,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
+0x75,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x76,0x03,0x09,0x00,0x01,0x01,0x75,0x03,
+0x0C,0x00,0x01,0x02,0x74,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x73,0x03,0x01,0x01,
+0x0D,0x00,0x74,0x03,0x0C,0x00,0x72,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x72,0x03,
+0x01,0x01,0x0C,0x00,0x01,0x01,0x71,0x03,0x10,0x00,0x01,0x02,0x70,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x6F,0x03,0x12,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,0x10,0x00,
+0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x6D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,
+0x6B,0x03,0x01,0x01,0x15,0x00,0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x69,0x03,
+0x01,0x01,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x65,0x03,
+0x01,0x02,0x1A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x63,0x03,
+0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x60,0x03,
+0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
+0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x26,0x00,
+0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,
+0x2A,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x01,0x01,0x2E,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,
+0x01,0x02,0x4C,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
+0x38,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x40,0x03,0x02,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
+0x01,0x02,0x01,0x01,0x3E,0x00,0x02,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0x44,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x02,0x02,0x01,0x01,0x45,0x00,0x02,0x01,
+0x01,0x02,0x30,0x03,0x02,0x02,0x02,0x01,0x4B,0x00,0x01,0x01,0x02,0x02,0x30,0x03,
+0x01,0x02,0x02,0x01,0x4E,0x00,0x02,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,
+0x55,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x5A,0x00,0x02,0x01,
+0x03,0x02,0x15,0x03,0x03,0x02,0x02,0x01,0x62,0x00,0x03,0x01,0x03,0x02,0x14,0x03,
+0x03,0x02,0x03,0x01,0x6F,0x00,0x01,0x01,0x80,0x00,0x02,0x01,0x3C,0x00,
 };
-static const DiffBlock IDLE_FRAME13_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME13_DATA
+static const DiffBlock IDLE_FRAME19_BLOCK = {
+    26, 72,  // Changed box top-left
+    257, 66,  // Changed box dimensions
+    IDLE_FRAME19_DATA
 };
 
-// Frame 14: Full frame RLE (1530 bytes)
-static const uint8_t IDLE_FRAME14_DATA[1530] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x82,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x66,0x00,0x58,0x03,0x01,0x02,0x28,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x61,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x01,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x61,0x03,0x01,0x02,0x5D,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x5F,0x00,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x61,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6A,0x00,
-0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6C,0x00,0x50,0x03,
-0x01,0x02,0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x80,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
-0x84,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x88,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,
-0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,
-0x03,0x02,0x02,0x01,0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,
-0xAE,0x00,0x07,0x01,0x7A,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+// Frame 20: Diff RLE (1126 bytes)
+static const uint8_t IDLE_FRAME20_DATA[1126] = {
+0x36,0x00,0x04,0x01,0x0B,0x02,0x04,0x01,0x6F,0x00,0x03,0x01,0x0B,0x02,0x04,0x01,
+0x62,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0x63,0x00,0x01,0x01,
+0x02,0x02,0x18,0x03,0x01,0x02,0x02,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
+0x02,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
+0x51,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x2A,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,
+0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x35,0x03,
+0x01,0x02,0x4A,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x3C,0x00,
+0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
+0x01,0x01,0x35,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,
+0x44,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,
+0x01,0x02,0x48,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x34,0x00,
+0x01,0x01,0x4B,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,
+0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x53,0x03,0x2E,0x00,
+0x01,0x02,0x52,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x55,0x03,0x2C,0x00,0x01,0x02,
+0x54,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,
+0x56,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x28,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x24,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x1C,0x00,0x5E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,0x5F,0x03,0x01,0x02,
+0x19,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x18,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x18,0x00,0x62,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x16,0x00,
+0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x16,0x00,
+0x01,0x02,0x63,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x16,0x00,
+0x64,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
+0x65,0x03,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x65,0x03,
+0x01,0x01,0x1B,0x00,0x65,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
+0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
+0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x01,0x66,0x03,0x14,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,
+0x01,0x01,0x66,0x03,0x14,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
+0x66,0x03,0x14,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,
+0x01,0x02,0x14,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,0x65,0x03,0x01,0x02,
+0x14,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
+0x15,0x00,0x65,0x03,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x15,0x00,0x64,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x63,0x03,
+0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x63,0x03,
+0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x1F,0x00,0x61,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x20,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,
+0x5F,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
+0x5E,0x03,0x1D,0x00,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x1F,0x00,
+0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x21,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x23,0x00,0x01,0x02,0x55,0x03,
+0x01,0x02,0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x24,0x00,0x54,0x03,0x01,0x02,
+0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
+0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
+0x30,0x00,0x01,0x01,0x50,0x03,0x2B,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x32,0x00,
+0x01,0x01,0x4D,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x4B,0x03,0x36,0x00,0x01,0x02,
+0x4A,0x03,0x01,0x01,0x30,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
+0x47,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x41,0x03,0x01,0x01,
+0x3E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x3D,0x03,
+0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,
+0x39,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x42,0x00,
+0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x2F,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,
+0x2E,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x02,0x02,0x27,0x03,0x01,0x02,0x01,0x01,
+0x56,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,
+0x02,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x02,0x01,0x01,0x02,0x20,0x03,
+0x01,0x02,0x01,0x01,0x5A,0x00,0x02,0x01,0x03,0x02,0x13,0x03,0x03,0x02,0x02,0x01,
+0x65,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x0F,0x01,
+0x73,0x00,0x0E,0x01,0x34,0x00,
 };
-static const DiffBlock IDLE_FRAME14_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME14_DATA
+static const DiffBlock IDLE_FRAME20_BLOCK = {
+    31, 75,  // Changed box top-left
+    252, 69,  // Changed box dimensions
+    IDLE_FRAME20_DATA
 };
 
-// Frame 15: Full frame RLE (1530 bytes)
-static const uint8_t IDLE_FRAME15_DATA[1530] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x82,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x66,0x00,0x58,0x03,0x01,0x02,0x28,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x61,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x01,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x61,0x03,0x01,0x02,0x5D,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x5F,0x00,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x61,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6A,0x00,
-0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6C,0x00,0x50,0x03,
-0x01,0x02,0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x80,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
-0x84,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x88,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,
-0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,
-0x03,0x02,0x02,0x01,0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,
-0xAE,0x00,0x07,0x01,0x7A,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+// Frame 21: Diff RLE (1112 bytes)
+static const uint8_t IDLE_FRAME21_DATA[1112] = {
+0xFF,0x00,0xFD,0x00,0x05,0x01,0x0A,0x02,0x05,0x01,0x6B,0x00,0x02,0x01,0x06,0x02,
+0x09,0x03,0x06,0x02,0x02,0x01,0x4A,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,
+0x02,0x01,0x5E,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0x40,0x00,
+0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
+0x29,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,
+0x50,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x02,
+0x34,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x41,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x41,0x03,
+0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x21,0x00,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x1E,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x49,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,
+0x01,0x02,0x19,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x01,0x16,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x51,0x03,
+0x01,0x01,0x14,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x53,0x03,
+0x01,0x02,0x12,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,
+0x01,0x02,0x10,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,
+0x01,0x01,0x0E,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x0C,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x0A,0x00,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
+0x08,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x06,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x06,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x62,0x03,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x04,0x00,0x01,0x02,
+0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x03,0x00,0x63,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x1C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x64,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x02,0x00,0x01,0x02,0x64,0x03,
+0x01,0x02,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x01,0x00,0x65,0x03,0x01,0x02,
+0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x01,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,
+0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x00,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
+0x65,0x03,0x01,0x02,0x01,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x65,0x03,
+0x01,0x01,0x01,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x64,0x03,
+0x02,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
+0x02,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x03,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x03,0x00,
+0x01,0x02,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x04,0x00,
+0x01,0x01,0x01,0x02,0x61,0x03,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x05,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x07,0x00,
+0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x0B,0x00,0x5B,0x03,
+0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x5A,0x03,
+0x27,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
+0x28,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
+0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
+0x2C,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
+0x2E,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
+0x31,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
+0x34,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
+0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x01,0x02,0x46,0x03,
+0x01,0x02,0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,
+0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,
+0x24,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,
+0x28,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
+0x39,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
+0x01,0x01,0x49,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x31,0x03,
+0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
+0x37,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,
+0x01,0x02,0x02,0x01,0x5B,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,
+0x46,0x00,0x02,0x01,0x03,0x02,0x14,0x03,0x03,0x02,0x02,0x01,0x66,0x00,0x02,0x01,
+0x15,0x02,0x02,0x01,0xFF,0x00,0xFA,0x00,
 };
-static const DiffBlock IDLE_FRAME15_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME15_DATA
+static const DiffBlock IDLE_FRAME21_BLOCK = {
+    43, 75,  // Changed box top-left
+    233, 69,  // Changed box dimensions
+    IDLE_FRAME21_DATA
 };
 
-// Frame 16: Full frame RLE (1530 bytes)
-static const uint8_t IDLE_FRAME16_DATA[1530] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x82,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x66,0x00,0x58,0x03,0x01,0x02,0x28,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x61,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x01,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x61,0x03,0x01,0x02,0x5D,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x5F,0x00,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x61,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6A,0x00,
-0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6C,0x00,0x50,0x03,
-0x01,0x02,0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x80,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
-0x84,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x88,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,
-0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,
-0x03,0x02,0x02,0x01,0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,
-0xAE,0x00,0x07,0x01,0x7A,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+// Frame 22: Diff RLE (466 bytes)
+static const uint8_t IDLE_FRAME22_DATA[466] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x3A,0x00,0x03,0x01,
+0x50,0x02,0x02,0x01,0x9F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,
+0x28,0x00,0x03,0x01,0x50,0x02,0x02,0x01,0x1C,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x16,0x00,
+0x01,0x01,0x63,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,
+0x12,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
+0x10,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x68,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x6C,0x03,0x15,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x6C,0x03,0x09,0x00,0x01,0x01,
+0x6E,0x03,0x13,0x00,0x6D,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x6E,0x03,0x01,0x01,
+0x11,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,
+0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,
+0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x6E,0x03,0x01,0x01,
+0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x6E,0x03,0x12,0x00,
+0x01,0x02,0x6E,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x12,0x00,
+0x01,0x01,0x6D,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x6C,0x03,0x14,0x00,0x6D,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x6C,0x03,
+0x0C,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x68,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
+0x12,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
+0x01,0x02,0x16,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x02,0x01,0x52,0x02,0x02,0x01,0x27,0x00,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x9F,0x00,0x02,0x01,0x51,0x02,0x03,0x01,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xCD,0x00,
 };
-static const DiffBlock IDLE_FRAME16_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME16_DATA
+static const DiffBlock IDLE_FRAME22_BLOCK = {
+    43, 77,  // Changed box top-left
+    248, 65,  // Changed box dimensions
+    IDLE_FRAME22_DATA
 };
 
-// Frame 17: Full frame RLE (1530 bytes)
-static const uint8_t IDLE_FRAME17_DATA[1530] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x05,0x01,0x07,0x02,0x04,0x01,0x72,0x00,0x05,0x01,0x06,0x02,
-0x05,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
-0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x01,0x82,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x4F,0x03,0x32,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x53,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x66,0x00,0x58,0x03,0x01,0x02,0x28,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x61,0x00,0x01,0x01,0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x01,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x1D,0x00,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x61,0x03,0x01,0x02,0x5D,0x00,0x61,0x03,0x20,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x5F,0x00,0x5F,0x03,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x61,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6A,0x00,
-0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6C,0x00,0x50,0x03,
-0x01,0x02,0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x80,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
-0x84,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x88,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,0x52,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x02,0x01,
-0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,
-0x03,0x02,0x02,0x01,0x68,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,
-0xAE,0x00,0x07,0x01,0x7A,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+// Frame 23: Diff RLE (720 bytes)
+static const uint8_t IDLE_FRAME23_DATA[720] = {
+0x21,0x00,0x05,0x01,0x28,0x02,0x05,0x01,0x4F,0x00,0x06,0x01,0x27,0x02,0x06,0x01,
+0x38,0x00,0x01,0x01,0x02,0x02,0x37,0x03,0x01,0x02,0x02,0x01,0x44,0x00,0x01,0x01,
+0x02,0x02,0x37,0x03,0x02,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
+0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,
+0x01,0x01,0x21,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x31,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x02,0x55,0x03,0x2B,0x00,0x01,0x01,0x55,0x03,
+0x01,0x01,0x18,0x00,0x58,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x15,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
+0x12,0x00,0x5E,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x10,0x00,
+0x01,0x02,0x5F,0x03,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x60,0x03,0x01,0x02,0x20,0x00,0x61,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x1E,0x00,0x63,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
+0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x64,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x0A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
+0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x65,0x03,0x1B,0x00,
+0x01,0x01,0x65,0x03,0x01,0x01,0x09,0x00,0x66,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
+0x65,0x03,0x01,0x02,0x09,0x00,0x66,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x65,0x03,
+0x01,0x02,0x09,0x00,0x66,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
+0x09,0x00,0x66,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x65,0x03,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x64,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x63,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x1E,0x00,0x63,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x60,0x03,
+0x01,0x02,0x20,0x00,0x61,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x5F,0x03,0x21,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x01,0x10,0x00,0x5E,0x03,0x01,0x01,0x22,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,
+0x5C,0x03,0x13,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
+0x01,0x02,0x16,0x00,0x58,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x18,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x55,0x03,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x30,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
+0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x46,0x03,
+0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
+0x29,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,
+0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x02,0x02,0x37,0x03,
+0x01,0x02,0x01,0x01,0x45,0x00,0x02,0x01,0x01,0x02,0x37,0x03,0x02,0x02,0x01,0x01,
+0x39,0x00,0x30,0x01,0x51,0x00,0x31,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE4,0x00,
+
 };
-static const DiffBlock IDLE_FRAME17_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME17_DATA
+static const DiffBlock IDLE_FRAME23_BLOCK = {
+    50, 85,  // Changed box top-left
+    241, 48,  // Changed box dimensions
+    IDLE_FRAME23_DATA
 };
 
-// Frame 18: Full frame RLE (1430 bytes)
-static const uint8_t IDLE_FRAME18_DATA[1430] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xAB,0x00,0x08,0x01,0x79,0x00,0x09,0x01,0xAA,0x00,0x03,0x01,
-0x03,0x02,0x14,0x03,0x03,0x02,0x03,0x01,0x61,0x00,0x03,0x01,0x04,0x02,0x13,0x03,
-0x04,0x02,0x02,0x01,0x99,0x00,0x02,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x02,0x01,
-0x56,0x00,0x01,0x01,0x03,0x02,0x23,0x03,0x02,0x02,0x02,0x01,0x8F,0x00,0x01,0x01,
-0x02,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,0x4D,0x00,0x02,0x01,0x01,0x02,0x2F,0x03,
-0x01,0x02,0x01,0x01,0x87,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x02,0x02,0x01,0x01,
-0x46,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x80,0x00,0x01,0x01,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x01,0x01,0x7B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x71,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x6D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,
-0x69,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x65,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x62,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x5A,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x58,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x56,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x69,0x03,0x54,0x00,
-0x01,0x01,0x6A,0x03,0x01,0x02,0x16,0x00,0x6B,0x03,0x52,0x00,0x01,0x01,0x6C,0x03,
-0x01,0x01,0x14,0x00,0x6C,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x6E,0x03,0x13,0x00,
-0x01,0x02,0x6D,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,0x11,0x00,
-0x01,0x01,0x6F,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x70,0x03,0x01,0x01,0x10,0x00,
-0x01,0x02,0x6F,0x03,0x01,0x02,0x4D,0x00,0x71,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,
-0x71,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x72,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,
-0x71,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x72,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,
-0x73,0x03,0x4A,0x00,0x01,0x01,0x74,0x03,0x0D,0x00,0x01,0x02,0x73,0x03,0x01,0x01,
-0x49,0x00,0x01,0x01,0x74,0x03,0x01,0x01,0x0C,0x00,0x74,0x03,0x01,0x02,0x49,0x00,
-0x01,0x01,0x74,0x03,0x01,0x02,0x0C,0x00,0x74,0x03,0x01,0x02,0x49,0x00,0x01,0x02,
-0x74,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x75,0x03,0x49,0x00,0x01,0x02,0x74,0x03,
-0x01,0x02,0x0B,0x00,0x01,0x01,0x75,0x03,0x49,0x00,0x01,0x02,0x74,0x03,0x01,0x02,
-0x0B,0x00,0x01,0x01,0x75,0x03,0x49,0x00,0x01,0x02,0x74,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x01,0x75,0x03,0x49,0x00,0x01,0x01,0x74,0x03,0x01,0x01,0x0C,0x00,0x74,0x03,
-0x01,0x02,0x49,0x00,0x01,0x01,0x74,0x03,0x01,0x01,0x0C,0x00,0x74,0x03,0x01,0x02,
-0x4A,0x00,0x74,0x03,0x0D,0x00,0x01,0x02,0x73,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x72,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x73,0x03,0x4B,0x00,0x01,0x01,0x72,0x03,
-0x01,0x01,0x0E,0x00,0x01,0x02,0x71,0x03,0x01,0x02,0x4C,0x00,0x71,0x03,0x01,0x02,
-0x0F,0x00,0x01,0x01,0x71,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x70,0x03,0x01,0x01,
-0x10,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x4E,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,
-0x11,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x6E,0x03,0x13,0x00,
-0x01,0x02,0x6D,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x14,0x00,
-0x01,0x02,0x6B,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x16,0x00,
-0x6A,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,
-0x68,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x1A,0x00,0x66,0x03,
-0x01,0x02,0x58,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5D,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0x63,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x65,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x02,
-0x55,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,
-0x2E,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x72,0x00,0x01,0x02,
-0x48,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,
-0x76,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,
-0x41,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x81,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x37,0x03,
-0x01,0x02,0x89,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x02,0x02,
-0x24,0x03,0x02,0x02,0x01,0x01,0x57,0x00,0x02,0x01,0x02,0x02,0x23,0x03,0x02,0x02,
-0x01,0x01,0x9B,0x00,0x02,0x01,0x04,0x02,0x12,0x03,0x04,0x02,0x02,0x01,0x63,0x00,
-0x03,0x01,0x04,0x02,0x11,0x03,0x04,0x02,0x03,0x01,0xAC,0x00,0x06,0x01,0x7B,0x00,
-0x07,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xCF,0x00,
+// Frame 24: Diff RLE (1142 bytes)
+static const uint8_t IDLE_FRAME24_DATA[1142] = {
+0x2C,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,0x04,0x01,
+0x51,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,0x02,0x01,
+0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x45,0x00,0x02,0x01,0x01,0x02,0x20,0x03,
+0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
+0x3E,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,
+0x28,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,
+0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x34,0x03,
+0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
+0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,
+0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,
+0x26,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x02,
+0x23,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x43,0x03,
+0x01,0x01,0x20,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
+0x01,0x02,0x49,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x33,0x00,
+0x01,0x01,0x4C,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x01,0x51,0x03,0x14,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,
+0x53,0x03,0x12,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x55,0x03,
+0x10,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x0E,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x07,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x06,0x00,
+0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x05,0x00,0x01,0x02,
+0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x05,0x00,0x61,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x01,0x63,0x03,0x03,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x63,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,0x63,0x03,
+0x01,0x01,0x01,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x01,0x00,0x01,0x02,
+0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x01,0x00,0x01,0x02,
+0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x01,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,
+0x64,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x63,0x03,0x01,0x01,0x02,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,
+0x03,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,0x03,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x04,0x00,
+0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x04,0x00,0x01,0x02,
+0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x05,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x06,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x07,0x00,0x01,0x01,
+0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x25,0x00,0x01,0x01,0x5B,0x03,0x0C,0x00,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,
+0x59,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,
+0x56,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x54,0x03,0x01,0x02,0x12,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x52,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
+0x50,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,0x01,0x02,
+0x4D,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x48,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x3A,0x00,
+0x01,0x02,0x45,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x3D,0x00,
+0x01,0x01,0x42,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
+0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
+0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,
+0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x30,0x00,0x01,0x02,
+0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x34,0x00,
+0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
+0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x02,0x01,
+0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,
+0x01,0x02,0x02,0x01,0x48,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,
+0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0x56,0x00,0x08,0x01,
+0x79,0x00,0x08,0x01,0x2F,0x00,
 };
-static const DiffBlock IDLE_FRAME18_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME18_DATA
+static const DiffBlock IDLE_FRAME24_BLOCK = {
+    57, 65,  // Changed box top-left
+    232, 70,  // Changed box dimensions
+    IDLE_FRAME24_DATA
 };
 
-// Frame 19: Full frame RLE (1406 bytes)
-static const uint8_t IDLE_FRAME19_DATA[1406] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x3D,0x00,0x03,0x01,0x7E,0x00,0x04,0x01,0xAD,0x00,0x02,0x01,
-0x03,0x02,0x15,0x03,0x03,0x02,0x02,0x01,0x62,0x00,0x02,0x01,0x03,0x02,0x16,0x03,
-0x02,0x02,0x03,0x01,0x98,0x00,0x02,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,
-0x56,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,0x02,0x01,0x8E,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x02,0x02,0x30,0x03,
-0x01,0x02,0x02,0x01,0x85,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
-0x44,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x7D,0x00,0x01,0x01,
-0x02,0x02,0x3F,0x03,0x01,0x02,0x02,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x6E,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
-0x55,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x22,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x59,0x00,0x66,0x03,0x01,0x02,0x1A,0x00,
-0x01,0x02,0x66,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x17,0x00,
-0x01,0x02,0x68,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x15,0x00,
-0x6B,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x6D,0x03,
-0x01,0x02,0x4F,0x00,0x01,0x01,0x6F,0x03,0x12,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x71,0x03,0x10,0x00,0x01,0x02,0x70,0x03,0x01,0x01,0x4C,0x00,
-0x72,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x72,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x73,0x03,0x01,0x01,0x0D,0x00,0x74,0x03,0x49,0x00,0x01,0x01,0x75,0x03,0x0C,0x00,
-0x01,0x02,0x74,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x75,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x76,0x03,0x47,0x00,0x01,0x01,0x77,0x03,0x0A,0x00,0x01,0x02,0x76,0x03,
-0x01,0x01,0x46,0x00,0x01,0x02,0x77,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x77,0x03,
-0x01,0x02,0x46,0x00,0x01,0x02,0x77,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x77,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x78,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x78,0x03,
-0x01,0x01,0x45,0x00,0x79,0x03,0x08,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x44,0x00,
-0x01,0x01,0x79,0x03,0x08,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x44,0x00,0x01,0x01,
-0x79,0x03,0x08,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x45,0x00,0x79,0x03,0x08,0x00,
-0x01,0x02,0x78,0x03,0x01,0x01,0x45,0x00,0x78,0x03,0x01,0x02,0x08,0x00,0x01,0x02,
-0x78,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x77,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
-0x77,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x77,0x03,0x01,0x01,0x08,0x00,
-0x01,0x01,0x77,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x77,0x03,0x0A,0x00,0x01,0x02,
-0x76,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x75,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x76,0x03,0x48,0x00,0x01,0x01,0x75,0x03,0x0C,0x00,0x01,0x02,0x74,0x03,0x01,0x01,
-0x49,0x00,0x01,0x02,0x73,0x03,0x01,0x01,0x0D,0x00,0x74,0x03,0x4B,0x00,0x72,0x03,
-0x01,0x02,0x0E,0x00,0x01,0x02,0x72,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x71,0x03,
-0x10,0x00,0x01,0x02,0x70,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x6F,0x03,0x12,0x00,
-0x01,0x02,0x6E,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,
-0x6D,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x15,0x00,0x6B,0x03,
-0x01,0x02,0x53,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x68,0x03,
-0x01,0x01,0x56,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x58,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x5B,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x2E,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x72,0x00,
-0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x46,0x03,
-0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x02,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,0x02,0x01,
-0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x02,0x02,0x38,0x03,
-0x02,0x02,0x01,0x01,0x84,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x02,0x02,0x02,0x01,
-0x4B,0x00,0x01,0x01,0x02,0x02,0x30,0x03,0x01,0x02,0x02,0x01,0x8D,0x00,0x02,0x01,
-0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x55,0x00,0x01,0x01,0x02,0x02,0x25,0x03,
-0x02,0x02,0x02,0x01,0x99,0x00,0x02,0x01,0x03,0x02,0x15,0x03,0x03,0x02,0x02,0x01,
-0x62,0x00,0x03,0x01,0x03,0x02,0x14,0x03,0x03,0x02,0x03,0x01,0xAE,0x00,0x01,0x01,
-0x80,0x00,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC5,0x00,
-};
-static const DiffBlock IDLE_FRAME19_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME19_DATA
-};
-
-// Frame 20: Full frame RLE (1500 bytes)
-static const uint8_t IDLE_FRAME20_DATA[1500] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x73,0x00,0x04,0x01,
-0x0B,0x02,0x04,0x01,0x6F,0x00,0x03,0x01,0x0B,0x02,0x04,0x01,0xA6,0x00,0x02,0x01,
-0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0x63,0x00,0x01,0x01,0x02,0x02,0x18,0x03,
-0x01,0x02,0x02,0x01,0x9C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x95,0x00,0x01,0x01,
-0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
-0x01,0x02,0x8F,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
-0x01,0x02,0x30,0x03,0x01,0x01,0x8A,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x4A,0x00,
-0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,0x84,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x02,0x46,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x80,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x7D,0x00,0x01,0x02,
-0x41,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x01,0x01,0x79,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x76,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x48,0x03,
-0x01,0x01,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,
-0x01,0x02,0x71,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x02,
-0x50,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x53,0x03,0x2E,0x00,0x01,0x02,0x52,0x03,
-0x01,0x01,0x69,0x00,0x01,0x01,0x55,0x03,0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x67,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
-0x65,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x62,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x61,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x60,0x00,0x5E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,0x5F,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5C,0x00,0x62,0x03,
-0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x63,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x5A,0x00,0x64,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x65,0x03,0x1C,0x00,
-0x01,0x02,0x64,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,
-0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
-0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
-0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,
-0x66,0x03,0x58,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,
-0x58,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x66,0x03,0x58,0x00,
-0x01,0x02,0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x58,0x00,
-0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,0x65,0x03,0x01,0x02,0x58,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x59,0x00,0x65,0x03,
-0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x64,0x03,0x01,0x02,0x1C,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x1C,0x00,
-0x01,0x01,0x63,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x1E,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x61,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,0x5F,0x03,0x01,0x02,
-0x5F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x61,0x00,
-0x5D,0x03,0x24,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x65,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x28,0x00,0x01,0x01,0x58,0x03,0x67,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x02,0x56,0x03,0x01,0x01,0x68,0x00,0x54,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,
-0x50,0x03,0x6F,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x4D,0x03,
-0x01,0x02,0x71,0x00,0x01,0x01,0x4B,0x03,0x36,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,
-0x74,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
-0x01,0x01,0x76,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x7A,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x02,0x7E,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x82,0x00,0x01,0x01,0x39,0x03,0x01,0x01,
-0x46,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x86,0x00,0x01,0x01,0x01,0x02,
-0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,0x01,0x01,0x8B,0x00,
-0x01,0x02,0x2F,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x90,0x00,0x02,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,
-0x02,0x02,0x01,0x01,0x5C,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
-0x9E,0x00,0x02,0x01,0x03,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0x65,0x00,0x02,0x01,
-0x02,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0xA9,0x00,0x0F,0x01,0x73,0x00,0x0E,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x36,0x00,
-};
-static const DiffBlock IDLE_FRAME20_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME20_DATA
-};
-
-// Frame 21: Full frame RLE (1494 bytes)
-static const uint8_t IDLE_FRAME21_DATA[1494] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xF5,0x00,0x05,0x01,0x0A,0x02,0x05,0x01,0x6B,0x00,0x02,0x01,0x06,0x02,0x09,0x03,
-0x06,0x02,0x02,0x01,0xA1,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,
-0x5E,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0x97,0x00,0x01,0x01,
-0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x01,0x01,0x8F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x50,0x00,
-0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x8A,0x00,0x01,0x02,0x34,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x84,0x00,
-0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,
-0x39,0x03,0x01,0x02,0x01,0x01,0x80,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,
-0x41,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x7C,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x75,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x49,0x03,0x01,0x01,
-0x72,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x70,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
-0x6B,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
-0x69,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x67,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x65,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x61,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0x61,0x00,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x5D,0x00,
-0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,
-0x60,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
-0x1C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x58,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,
-0x01,0x01,0x65,0x03,0x01,0x01,0x58,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x58,0x00,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,
-0x1A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x58,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x58,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x58,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x65,0x03,
-0x01,0x01,0x58,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,
-0x64,0x03,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
-0x5A,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x5E,0x00,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x60,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x62,0x00,
-0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,
-0x5A,0x03,0x27,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x28,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x56,0x03,
-0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x54,0x03,
-0x01,0x01,0x2C,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x2E,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x4F,0x03,
-0x01,0x02,0x31,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,0x6F,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x34,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x4A,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x74,0x00,0x01,0x01,0x01,0x02,
-0x46,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x77,0x00,
-0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x01,0x7B,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x3F,0x03,
-0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x83,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x89,0x00,0x01,0x01,
-0x31,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,
-0x01,0x01,0x8E,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x94,0x00,0x01,0x01,0x02,0x02,
-0x22,0x03,0x01,0x02,0x02,0x01,0x5B,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,
-0x01,0x01,0x9D,0x00,0x02,0x01,0x03,0x02,0x14,0x03,0x03,0x02,0x02,0x01,0x66,0x00,
-0x02,0x01,0x15,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xB2,0x00,
-};
-static const DiffBlock IDLE_FRAME21_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME21_DATA
-};
-
-// Frame 22: Full frame RLE (872 bytes)
-static const uint8_t IDLE_FRAME22_DATA[872] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC6,0x00,
-0x03,0x01,0x50,0x02,0x02,0x01,0xE7,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,
-0x01,0x01,0x28,0x00,0x03,0x01,0x50,0x02,0x02,0x01,0x64,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x01,0x01,0x5A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x58,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x55,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x68,0x03,
-0x01,0x01,0x53,0x00,0x01,0x01,0x6C,0x03,0x15,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,
-0x52,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x6C,0x03,0x51,0x00,
-0x01,0x01,0x6E,0x03,0x13,0x00,0x6D,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x6E,0x03,
-0x01,0x01,0x11,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x6E,0x03,
-0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x6E,0x03,
-0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x6E,0x03,
-0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x6E,0x03,
-0x12,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,
-0x12,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x6C,0x03,0x14,0x00,
-0x6D,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
-0x6C,0x03,0x54,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x6A,0x03,
-0x01,0x01,0x55,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x68,0x03,
-0x01,0x01,0x57,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x5A,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x22,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x02,0x01,0x52,0x02,0x02,0x01,
-0x27,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0xE7,0x00,0x02,0x01,0x51,0x02,
-0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD4,0x00,
-};
-static const DiffBlock IDLE_FRAME22_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME22_DATA
-};
-
-// Frame 23: Full frame RLE (1148 bytes)
-static const uint8_t IDLE_FRAME23_DATA[1148] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFD,0x00,0x05,0x01,0x28,0x02,0x05,0x01,0x4F,0x00,0x06,0x01,
-0x27,0x02,0x06,0x01,0x87,0x00,0x01,0x01,0x02,0x02,0x37,0x03,0x01,0x02,0x02,0x01,
-0x44,0x00,0x01,0x01,0x02,0x02,0x37,0x03,0x02,0x02,0x01,0x01,0x7E,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x02,0x79,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x46,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x34,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x31,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x2E,0x00,
-0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x55,0x03,0x2B,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0x67,0x00,0x58,0x03,0x01,0x01,0x28,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,
-0x59,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x24,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x61,0x00,0x5E,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x02,0x5F,0x00,0x01,0x02,0x5F,0x03,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x20,0x00,0x61,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x1E,0x00,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,
-0x01,0x02,0x63,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x59,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x59,0x00,0x01,0x02,
-0x64,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x58,0x00,0x01,0x02,
-0x65,0x03,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x58,0x00,0x66,0x03,0x01,0x01,
-0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x58,0x00,0x66,0x03,0x01,0x01,0x1A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x58,0x00,0x66,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x58,0x00,0x66,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x58,0x00,0x01,0x02,0x65,0x03,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x58,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x58,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x59,0x00,
-0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x1E,0x00,0x63,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x20,0x00,0x61,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,
-0x5F,0x03,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x5F,0x00,0x5E,0x03,0x01,0x01,
-0x22,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x24,0x00,0x01,0x02,0x5C,0x03,0x62,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,
-0x01,0x02,0x59,0x03,0x01,0x02,0x65,0x00,0x58,0x03,0x01,0x01,0x28,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x67,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x2E,0x00,
-0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x01,0x01,0x30,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x74,0x00,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x01,0x01,
-0x02,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x02,0x01,0x01,0x02,0x37,0x03,
-0x02,0x02,0x01,0x01,0x88,0x00,0x30,0x01,0x51,0x00,0x31,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE9,0x00,
-};
-static const DiffBlock IDLE_FRAME23_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME23_DATA
-};
-
-// Frame 24: Full frame RLE (1512 bytes)
-static const uint8_t IDLE_FRAME24_DATA[1512] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF6,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,
-0x04,0x01,0xA9,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x87,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,
-0x82,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x53,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x55,0x03,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x5B,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,
-0x1D,0x00,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
-0x5B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5C,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x64,0x00,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x73,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x03,0x01,0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xAE,0x00,
-0x08,0x01,0x79,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x76,0x00,
-};
-static const DiffBlock IDLE_FRAME24_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME24_DATA
-};
-
-// Frame 25: Full frame RLE (1512 bytes)
-static const uint8_t IDLE_FRAME25_DATA[1512] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF6,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,
-0x04,0x01,0xA9,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x87,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,
-0x82,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x53,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x55,0x03,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x5B,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,
-0x1D,0x00,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
-0x5B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5C,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x64,0x00,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x73,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x03,0x01,0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xAE,0x00,
-0x08,0x01,0x79,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x76,0x00,
+// Frame 25: Diff RLE (2 bytes)
+static const uint8_t IDLE_FRAME25_DATA[2] = {
+0x01,0x02,
 };
 static const DiffBlock IDLE_FRAME25_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    58, 101,  // Changed box top-left
+    1, 1,  // Changed box dimensions
     IDLE_FRAME25_DATA
 };
 
-// Frame 26: Full frame RLE (1512 bytes)
-static const uint8_t IDLE_FRAME26_DATA[1512] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF6,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,
-0x04,0x01,0xA9,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x87,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,
-0x82,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x53,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x55,0x03,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x5B,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,
-0x1D,0x00,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
-0x5B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5C,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x64,0x00,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x73,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x03,0x01,0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xAE,0x00,
-0x08,0x01,0x79,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x76,0x00,
-};
-static const DiffBlock IDLE_FRAME26_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME26_DATA
-};
+// Frame 26: no change
 
-// Frame 27: Full frame RLE (1512 bytes)
-static const uint8_t IDLE_FRAME27_DATA[1512] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF6,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,
-0x04,0x01,0xA9,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x87,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,
-0x82,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x53,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x55,0x03,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x5B,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,
-0x1D,0x00,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
-0x5B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5C,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x64,0x00,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x73,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x03,0x01,0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xAE,0x00,
-0x08,0x01,0x79,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x76,0x00,
-};
-static const DiffBlock IDLE_FRAME27_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME27_DATA
-};
+// Frame 27: no change
 
-// Frame 28: Full frame RLE (1512 bytes)
-static const uint8_t IDLE_FRAME28_DATA[1512] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF6,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,
-0x04,0x01,0xA9,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x87,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,
-0x82,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x53,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x55,0x03,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x5B,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,
-0x1D,0x00,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
-0x5B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5C,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x64,0x00,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x73,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x03,0x01,0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xAE,0x00,
-0x08,0x01,0x79,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x76,0x00,
-};
-static const DiffBlock IDLE_FRAME28_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME28_DATA
-};
+// Frame 28: no change
 
-// Frame 29: Full frame RLE (1512 bytes)
-static const uint8_t IDLE_FRAME29_DATA[1512] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF6,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,
-0x04,0x01,0xA9,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x87,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,
-0x82,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x53,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x55,0x03,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x5B,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,
-0x1D,0x00,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
-0x5B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5C,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x64,0x00,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x73,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x03,0x01,0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xAE,0x00,
-0x08,0x01,0x79,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x76,0x00,
-};
-static const DiffBlock IDLE_FRAME29_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME29_DATA
-};
+// Frame 29: no change
 
-// Frame 30: Full frame RLE (1512 bytes)
-static const uint8_t IDLE_FRAME30_DATA[1512] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF6,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,
-0x04,0x01,0xA9,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x87,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,
-0x82,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x53,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x55,0x03,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x5B,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,
-0x1D,0x00,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
-0x5B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5C,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x64,0x00,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x73,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x03,0x01,0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xAE,0x00,
-0x08,0x01,0x79,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x76,0x00,
-};
-static const DiffBlock IDLE_FRAME30_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME30_DATA
-};
+// Frame 30: no change
 
-// Frame 31: Full frame RLE (1512 bytes)
-static const uint8_t IDLE_FRAME31_DATA[1512] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF6,0x00,0x04,0x01,0x07,0x02,0x05,0x01,0x71,0x00,0x05,0x01,0x07,0x02,
-0x04,0x01,0xA9,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,
-0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x87,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,
-0x82,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x51,0x03,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x53,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x55,0x03,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1E,0x00,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x5B,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x1C,0x00,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x64,0x03,
-0x1D,0x00,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,
-0x5B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x5C,0x00,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5E,0x03,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x24,0x00,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x64,0x00,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x73,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x41,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x7F,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x88,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x98,0x00,
-0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,
-0x03,0x01,0x67,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xAE,0x00,
-0x08,0x01,0x79,0x00,0x08,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x76,0x00,
-};
-static const DiffBlock IDLE_FRAME31_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    IDLE_FRAME31_DATA
-};
+// Frame 31: no change
+
+// Frame 32: Diff RLE (1072 bytes)
+static const uint8_t IDLE_FRAME32_DATA[1072] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x01,0x00,0x05,0x01,0x05,0x02,0x05,0x01,
+0x72,0x00,0x05,0x01,0x06,0x02,0x05,0x01,0x59,0x00,0x02,0x01,0x02,0x02,0x19,0x03,
+0x02,0x02,0x02,0x01,0x61,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
+0x4C,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x57,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x02,0x02,0x2D,0x03,
+0x02,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x3C,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,
+0x01,0x02,0x35,0x03,0x02,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,
+0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x41,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x4B,0x03,
+0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x23,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,
+0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x1C,0x00,
+0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x19,0x00,
+0x01,0x01,0x59,0x03,0x28,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x16,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x14,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x12,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x65,0x03,
+0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,0x0A,0x00,0x01,0x01,0x67,0x03,0x01,0x02,
+0x19,0x00,0x67,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x68,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x69,0x03,0x01,0x02,0x16,0x00,
+0x01,0x01,0x6A,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x14,0x00,
+0x01,0x01,0x6B,0x03,0x01,0x02,0x05,0x00,0x6C,0x03,0x01,0x02,0x14,0x00,0x01,0x02,
+0x6C,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x6D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,
+0x6E,0x03,0x03,0x00,0x6E,0x03,0x01,0x02,0x12,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,0x11,0x00,0x6F,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x6F,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x70,0x03,0x01,0x01,0x01,0x02,
+0x6F,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x70,0x03,0x01,0x01,0x71,0x03,0x10,0x00,
+0x01,0x02,0x70,0x03,0x01,0x01,0x71,0x03,0x10,0x00,0x01,0x02,0x70,0x03,0x01,0x01,
+0x71,0x03,0x10,0x00,0x01,0x02,0x70,0x03,0x01,0x01,0x71,0x03,0x10,0x00,0x01,0x02,
+0x70,0x03,0x01,0x01,0x01,0x02,0x6F,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x70,0x03,
+0x01,0x01,0x01,0x02,0x6F,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x70,0x03,0x01,0x00,
+0x01,0x01,0x6F,0x03,0x01,0x01,0x11,0x00,0x6F,0x03,0x01,0x02,0x02,0x00,0x6F,0x03,
+0x12,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x6D,0x03,0x01,0x02,
+0x12,0x00,0x01,0x01,0x6E,0x03,0x03,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,
+0x01,0x01,0x6C,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x15,0x00,
+0x01,0x02,0x6A,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x69,0x03,0x01,0x02,0x16,0x00,
+0x01,0x01,0x69,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x69,0x03,0x18,0x00,0x01,0x02,
+0x68,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x63,0x03,
+0x01,0x02,0x0E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x61,0x03,0x01,0x02,
+0x10,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x12,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x15,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,
+0x01,0x02,0x21,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x36,0x00,
+0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
+0x2D,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x3F,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,
+0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x02,0x02,0x21,0x03,
+0x02,0x02,0x01,0x01,0x5A,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x02,0x01,
+0x4F,0x00,0x03,0x01,0x03,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0x66,0x00,0x02,0x01,
+0x03,0x02,0x11,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x07,0x00,
 
-// Frame 32: Full frame RLE (1460 bytes)
-static const uint8_t IDLE_FRAME32_DATA[1460] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFA,0x00,0x05,0x01,
-0x05,0x02,0x05,0x01,0x72,0x00,0x05,0x01,0x06,0x02,0x05,0x01,0xA6,0x00,0x02,0x01,
-0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0x61,0x00,0x02,0x01,0x02,0x02,0x18,0x03,
-0x02,0x02,0x02,0x01,0x99,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,
-0x57,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x90,0x00,0x01,0x01,
-0x02,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x02,0x02,0x01,0x01,0x82,0x00,0x01,0x01,
-0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
-0x01,0x02,0x01,0x01,0x7C,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x74,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x70,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x6C,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,
-0x01,0x01,0x69,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x55,0x03,
-0x01,0x02,0x66,0x00,0x01,0x01,0x59,0x03,0x28,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x61,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x5F,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x58,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,0x57,0x00,0x01,0x01,
-0x67,0x03,0x01,0x02,0x19,0x00,0x67,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x69,0x03,
-0x01,0x01,0x17,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x69,0x03,
-0x01,0x02,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x6B,0x03,
-0x01,0x01,0x14,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x52,0x00,0x6C,0x03,0x01,0x02,
-0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x6D,0x03,0x01,0x02,
-0x12,0x00,0x01,0x01,0x6E,0x03,0x50,0x00,0x6E,0x03,0x01,0x02,0x12,0x00,0x01,0x02,
-0x6E,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x11,0x00,0x01,0x02,
-0x6E,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,0x11,0x00,0x6F,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x70,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x70,0x03,
-0x01,0x01,0x4D,0x00,0x71,0x03,0x10,0x00,0x01,0x02,0x70,0x03,0x01,0x01,0x4D,0x00,
-0x71,0x03,0x10,0x00,0x01,0x02,0x70,0x03,0x01,0x01,0x4D,0x00,0x71,0x03,0x10,0x00,
-0x01,0x02,0x70,0x03,0x01,0x01,0x4D,0x00,0x71,0x03,0x10,0x00,0x01,0x02,0x70,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x70,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x70,0x03,
-0x4E,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x11,0x00,0x6F,0x03,0x01,0x02,0x4F,0x00,
-0x6F,0x03,0x12,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x6D,0x03,
-0x01,0x02,0x12,0x00,0x01,0x01,0x6E,0x03,0x50,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,
-0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,
-0x14,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,
-0x15,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x69,0x03,0x01,0x02,
-0x16,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x69,0x03,0x18,0x00,
-0x01,0x02,0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x19,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,
-0x01,0x02,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x63,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x61,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x02,0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x62,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x64,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x67,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x32,0x00,0x01,0x01,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x49,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x02,0x7A,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x85,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x33,0x03,0x01,0x02,
-0x01,0x01,0x8C,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x52,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x01,0x02,0x02,
-0x21,0x03,0x02,0x02,0x01,0x01,0x5A,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,
-0x02,0x01,0x9C,0x00,0x03,0x01,0x03,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0x66,0x00,
-0x02,0x01,0x03,0x02,0x11,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x31,0x00,
 };
 static const DiffBlock IDLE_FRAME32_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    51, 65,  // Changed box top-left
+    243, 70,  // Changed box dimensions
     IDLE_FRAME32_DATA
 };
 
-// Frame 33: Full frame RLE (1444 bytes)
-static const uint8_t IDLE_FRAME33_DATA[1444] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x41,0x00,0x04,0x01,0x7D,0x00,0x04,0x01,0xAD,0x00,0x02,0x01,
-0x03,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x62,0x00,0x02,0x01,0x03,0x02,0x15,0x03,
-0x03,0x02,0x02,0x01,0x99,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,0x02,0x01,
-0x55,0x00,0x02,0x01,0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x8E,0x00,0x01,0x01,
-0x02,0x02,0x30,0x03,0x01,0x02,0x02,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
-0x02,0x02,0x01,0x01,0x85,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x01,0x02,0x02,0x01,
-0x44,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x7E,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x01,0x01,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,
-0x01,0x02,0x51,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x58,0x00,0x01,0x02,
-0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x56,0x00,0x01,0x02,
-0x68,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x54,0x00,0x01,0x02,
-0x6A,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x6B,0x03,0x52,0x00,0x01,0x02,0x6C,0x03,
-0x01,0x02,0x13,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x6E,0x03,
-0x01,0x02,0x11,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x70,0x03,
-0x01,0x01,0x0F,0x00,0x01,0x01,0x70,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x72,0x03,
-0x01,0x01,0x0E,0x00,0x72,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x73,0x03,0x01,0x02,
-0x0D,0x00,0x01,0x02,0x73,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x74,0x03,0x01,0x02,
-0x0B,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x76,0x03,0x0B,0x00,
-0x01,0x02,0x75,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x76,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x76,0x03,0x01,0x02,0x47,0x00,0x77,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x77,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x78,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
-0x77,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
-0x78,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
-0x78,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
-0x78,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
-0x78,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
-0x78,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
-0x78,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x78,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
-0x77,0x03,0x01,0x02,0x46,0x00,0x77,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x77,0x03,
-0x01,0x01,0x46,0x00,0x01,0x02,0x76,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x76,0x03,
-0x01,0x02,0x47,0x00,0x01,0x01,0x76,0x03,0x0B,0x00,0x01,0x02,0x75,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x74,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x75,0x03,0x49,0x00,
-0x01,0x01,0x73,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x73,0x03,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x72,0x03,0x01,0x01,0x0E,0x00,0x72,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x70,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x70,0x03,0x01,0x02,0x4E,0x00,0x01,0x02,
-0x6E,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,
-0x6C,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x51,0x00,0x01,0x02,
-0x6A,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x6B,0x03,0x54,0x00,0x01,0x02,0x68,0x03,
-0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x61,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x65,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x69,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x02,0x51,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x01,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x78,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x02,0x02,
-0x01,0x01,0x7D,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x02,0x02,0x01,0x01,0x43,0x00,
-0x02,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x85,0x00,0x01,0x01,0x02,0x02,
-0x30,0x03,0x01,0x02,0x02,0x01,0x4B,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x02,0x02,
-0x02,0x01,0x8D,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x55,0x00,
-0x02,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x98,0x00,0x03,0x01,0x03,0x02,
-0x14,0x03,0x03,0x02,0x03,0x01,0x61,0x00,0x03,0x01,0x03,0x02,0x15,0x03,0x03,0x02,
-0x02,0x01,0xAE,0x00,0x01,0x01,0x81,0x00,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xC1,0x00,
+// Frame 33: Diff RLE (1066 bytes)
+static const uint8_t IDLE_FRAME33_DATA[1066] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0x56,0x00,0x04,0x01,0x7D,0x00,0x04,0x01,0x6F,0x00,0x02,0x01,0x03,0x02,
+0x16,0x03,0x02,0x02,0x03,0x01,0x62,0x00,0x02,0x01,0x03,0x02,0x15,0x03,0x03,0x02,
+0x02,0x01,0x5B,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,0x02,0x01,0x55,0x00,
+0x02,0x01,0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x02,0x02,
+0x30,0x03,0x01,0x02,0x02,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x02,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x01,0x02,0x02,0x01,0x44,0x00,
+0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,
+0x40,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
+0x02,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x37,0x00,
+0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
+0x51,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,
+0x01,0x02,0x55,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,
+0x26,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x60,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x66,0x03,
+0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x68,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x6A,0x03,
+0x01,0x02,0x15,0x00,0x01,0x01,0x6B,0x03,0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x6E,0x03,0x01,0x02,
+0x11,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x70,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x01,0x70,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x72,0x03,0x01,0x01,
+0x0E,0x00,0x72,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x73,0x03,0x01,0x02,0x0D,0x00,
+0x01,0x02,0x73,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x74,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x01,0x74,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x76,0x03,0x0B,0x00,0x01,0x02,
+0x75,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x76,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x76,0x03,0x01,0x02,0x09,0x00,0x77,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x77,0x03,
+0x01,0x01,0x07,0x00,0x01,0x01,0x78,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x77,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x78,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x78,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x78,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x78,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x78,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x78,0x03,
+0x01,0x02,0x07,0x00,0x01,0x01,0x78,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x77,0x03,
+0x01,0x02,0x08,0x00,0x77,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x77,0x03,0x01,0x01,
+0x08,0x00,0x01,0x02,0x76,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x76,0x03,0x01,0x02,
+0x09,0x00,0x01,0x01,0x76,0x03,0x0B,0x00,0x01,0x02,0x75,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x74,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x75,0x03,0x0B,0x00,0x01,0x01,
+0x73,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x73,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x72,0x03,0x01,0x01,0x0E,0x00,0x72,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x70,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x70,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x6E,0x03,
+0x01,0x02,0x11,0x00,0x01,0x01,0x6F,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x6C,0x03,
+0x01,0x02,0x13,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6A,0x03,
+0x01,0x02,0x15,0x00,0x01,0x01,0x6B,0x03,0x16,0x00,0x01,0x02,0x68,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
+0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
+0x56,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
+0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x37,0x00,
+0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
+0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x02,0x02,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x02,0x02,0x01,0x01,0x43,0x00,0x02,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x02,0x02,0x30,0x03,
+0x01,0x02,0x02,0x01,0x4B,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x02,0x02,0x02,0x01,
+0x4F,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x55,0x00,0x02,0x01,
+0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x5A,0x00,0x03,0x01,0x03,0x02,0x14,0x03,
+0x03,0x02,0x03,0x01,0x61,0x00,0x03,0x01,0x03,0x02,0x15,0x03,0x03,0x02,0x02,0x01,
+0x70,0x00,0x01,0x01,0x81,0x00,0x01,0x01,0x43,0x00,
 };
 static const DiffBlock IDLE_FRAME33_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    36, 69,  // Changed box top-left
+    258, 69,  // Changed box dimensions
     IDLE_FRAME33_DATA
 };
 
-// Frame 34: Full frame RLE (1518 bytes)
-static const uint8_t IDLE_FRAME34_DATA[1518] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x74,0x00,0x03,0x01,
-0x0C,0x02,0x03,0x01,0x6F,0x00,0x04,0x01,0x0B,0x02,0x03,0x01,0xA7,0x00,0x01,0x01,
-0x02,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0x63,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
-0x02,0x02,0x01,0x01,0x9D,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x94,0x00,0x01,0x01,
-0x01,0x02,0x2A,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,
-0x01,0x01,0x8F,0x00,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,
-0x49,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x01,0x85,0x00,0x01,0x01,0x3A,0x03,
-0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x81,0x00,0x01,0x02,
-0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x7D,0x00,
-0x01,0x01,0x41,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x41,0x03,
-0x01,0x02,0x79,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x76,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x48,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x28,0x00,
-0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x27,0x00,0x5A,0x03,0x01,0x01,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x61,0x00,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x60,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x22,0x00,0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x20,0x00,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x62,0x03,0x1F,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x64,0x03,0x1D,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x58,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x02,
-0x65,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,
-0x01,0x02,0x65,0x03,0x01,0x01,0x58,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
-0x65,0x03,0x01,0x01,0x58,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,
-0x01,0x01,0x5A,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x62,0x03,0x1F,0x00,0x62,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x20,0x00,0x60,0x03,0x01,0x02,
-0x5E,0x00,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x5F,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x60,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x62,0x00,0x5B,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x5A,0x03,
-0x27,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x28,0x00,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x2A,0x00,
-0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
-0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x2E,0x00,0x52,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x01,0x50,0x03,0x31,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,
-0x6F,0x00,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x71,0x00,
-0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x74,0x00,
-0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x47,0x03,0x01,0x01,
-0x77,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
-0x7A,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x7D,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x43,0x00,
-0x01,0x02,0x3D,0x03,0x01,0x01,0x81,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
-0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x86,0x00,0x01,0x02,0x34,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,0x8A,0x00,0x01,0x01,
-0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x02,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x9E,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x02,0x01,0x03,0x02,0x13,0x03,0x02,0x02,0x02,0x01,0xAA,0x00,0x0E,0x01,0x73,0x00,
-0x0E,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x36,0x00,
+// Frame 34: Diff RLE (1144 bytes)
+static const uint8_t IDLE_FRAME34_DATA[1144] = {
+0x32,0x00,0x03,0x01,0x0C,0x02,0x03,0x01,0x6F,0x00,0x04,0x01,0x0B,0x02,0x03,0x01,
+0x62,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0x63,0x00,0x02,0x01,
+0x02,0x02,0x17,0x03,0x02,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
+0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,
+0x4F,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,
+0x29,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,
+0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x35,0x03,
+0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,
+0x3C,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x01,0x02,0x41,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
+0x3B,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x37,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,
+0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x32,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x50,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x52,0x03,
+0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x54,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x28,0x00,0x58,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x5A,0x03,0x27,0x00,
+0x5A,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x1C,0x00,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,
+0x1B,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x22,0x00,0x5E,0x03,0x01,0x02,0x19,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x18,0x00,
+0x01,0x02,0x60,0x03,0x01,0x01,0x20,0x00,0x60,0x03,0x01,0x02,0x17,0x00,0x01,0x01,
+0x62,0x03,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x62,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x64,0x03,
+0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x14,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,
+0x01,0x02,0x65,0x03,0x01,0x01,0x13,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x02,0x65,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,
+0x1A,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x65,0x03,
+0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x13,0x00,0x65,0x03,0x01,0x02,
+0x1B,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x13,0x00,0x65,0x03,0x01,0x02,0x1B,0x00,
+0x01,0x02,0x65,0x03,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x64,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x63,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x62,0x03,0x1F,0x00,
+0x62,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x1F,0x00,
+0x01,0x01,0x61,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x20,0x00,
+0x60,0x03,0x01,0x02,0x19,0x00,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,
+0x1A,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
+0x1B,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x1D,0x00,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x5A,0x03,0x27,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x58,0x03,0x01,0x01,0x28,0x00,0x58,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x56,0x03,
+0x01,0x01,0x2A,0x00,0x56,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
+0x2E,0x00,0x52,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x50,0x03,0x31,0x00,0x01,0x02,
+0x4F,0x03,0x01,0x01,0x2A,0x00,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,
+0x01,0x01,0x2C,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,
+0x47,0x03,0x01,0x01,0x32,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
+0x44,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x3F,0x00,
+0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
+0x01,0x02,0x43,0x00,0x01,0x02,0x3D,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,
+0x38,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
+0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,
+0x45,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,
+0x2E,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
+0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x51,0x00,
+0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,
+0x20,0x03,0x02,0x02,0x01,0x01,0x59,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,
+0x02,0x01,0x65,0x00,0x02,0x01,0x03,0x02,0x13,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
+0x0E,0x01,0x73,0x00,0x0E,0x01,0x38,0x00,
 };
 static const DiffBlock IDLE_FRAME34_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    36, 75,  // Changed box top-left
+    251, 69,  // Changed box dimensions
     IDLE_FRAME34_DATA
 };
 
@@ -3340,12 +1446,12 @@ static const FrameInfo IDLE_FRAMES[35] = {
     {&IDLE_FRAME9_BLOCK},
     {&IDLE_FRAME10_BLOCK},
     {&IDLE_FRAME11_BLOCK},
-    {&IDLE_FRAME12_BLOCK},
-    {&IDLE_FRAME13_BLOCK},
-    {&IDLE_FRAME14_BLOCK},
-    {&IDLE_FRAME15_BLOCK},
-    {&IDLE_FRAME16_BLOCK},
-    {&IDLE_FRAME17_BLOCK},
+    {nullptr},
+    {nullptr},
+    {nullptr},
+    {nullptr},
+    {nullptr},
+    {nullptr},
     {&IDLE_FRAME18_BLOCK},
     {&IDLE_FRAME19_BLOCK},
     {&IDLE_FRAME20_BLOCK},
@@ -3354,12 +1460,12 @@ static const FrameInfo IDLE_FRAMES[35] = {
     {&IDLE_FRAME23_BLOCK},
     {&IDLE_FRAME24_BLOCK},
     {&IDLE_FRAME25_BLOCK},
-    {&IDLE_FRAME26_BLOCK},
-    {&IDLE_FRAME27_BLOCK},
-    {&IDLE_FRAME28_BLOCK},
-    {&IDLE_FRAME29_BLOCK},
-    {&IDLE_FRAME30_BLOCK},
-    {&IDLE_FRAME31_BLOCK},
+    {nullptr},
+    {nullptr},
+    {nullptr},
+    {nullptr},
+    {nullptr},
+    {nullptr},
     {&IDLE_FRAME32_BLOCK},
     {&IDLE_FRAME33_BLOCK},
     {&IDLE_FRAME34_BLOCK},
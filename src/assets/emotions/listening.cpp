@@ -138,4075 +138,2730 @@ static const DiffBlock LISTENING_FRAME0_BLOCK = {
     LISTENING_FRAME0_DATA
 };
 
-// Frame 1: Full frame RLE (2094 bytes)
-static const uint8_t LISTENING_FRAME1_DATA[2094] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD0,0x00,0x0C,0x01,0xFF,0x00,0x2D,0x00,
-0x03,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,0x23,0x00,0x02,0x01,
-0x02,0x02,0x1B,0x03,0x03,0x02,0x01,0x01,0x8D,0x00,0x04,0x01,0x07,0x02,0x05,0x01,
-0x7C,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x84,0x00,0x02,0x01,
-0x02,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x7D,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x36,0x03,0x01,0x02,
-0x01,0x01,0x72,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
-0x02,0x02,0x35,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,
-0x43,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,0x55,0x00,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x59,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x48,0x00,0x01,0x01,
-0x52,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x43,0x00,
-0x01,0x02,0x57,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x01,0x01,0x49,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x38,0x00,
-0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x44,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x43,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x43,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x43,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0x42,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
-0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x60,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x41,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,
-0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
-0x4B,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
-0x43,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x5B,0x00,0x02,0x01,
-0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x74,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
-0x01,0x02,0x01,0x01,0x73,0x00,0x03,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0x80,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x7C,0x00,0x02,0x01,
-0x03,0x02,0x0B,0x03,0x03,0x02,0x02,0x01,0x89,0x00,0x01,0x01,0x03,0x02,0x1C,0x03,
-0x02,0x02,0x01,0x01,0x85,0x00,0x06,0x01,0x96,0x00,0x03,0x01,0x02,0x02,0x12,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x2D,0x00,0x0F,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x01,0x01,0x01,0x02,
+// Frame 1: Diff RLE (1790 bytes)
+static const uint8_t LISTENING_FRAME1_DATA[1790] = {
+0xD5,0x00,0x0C,0x01,0xF9,0x00,0x03,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x01,0x01,
+0xEF,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x03,0x02,0x01,0x01,0x5A,0x00,0x04,0x01,
+0x07,0x02,0x05,0x01,0x7C,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
+0x51,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x72,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
+0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
+0x44,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
+0x36,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,0x01,0x02,
+0x01,0x01,0x63,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x02,0x02,0x35,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x40,0x03,
+0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x58,0x00,
+0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
+0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x49,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
+0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x4A,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,
+0x48,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
+0x46,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x50,0x03,
+0x01,0x01,0x45,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x52,0x03,
+0x01,0x01,0x43,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,
+0x55,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,
+0x56,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,
+0x18,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x3B,0x00,
+0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x3A,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x01,0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x11,0x00,
+0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,
+0x11,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
+0x10,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,
+0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,
+0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,
+0x61,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,
+0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,
+0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,
+0x61,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x38,0x00,0x01,0x02,
+0x60,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x38,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x38,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x3A,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x3A,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x3C,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x18,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,
+0x19,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x55,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x01,0x01,0x1C,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
+0x51,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x01,0x02,0x4F,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,
+0x01,0x01,0x49,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x24,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,
+0x26,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
+0x01,0x02,0x29,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x53,0x00,0x01,0x02,
+0x42,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,
+0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
+0x3B,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
+0x5B,0x00,0x02,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,
+0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x33,0x03,
+0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0x63,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
+0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,0x29,0x03,
+0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x02,0x02,0x01,0x01,
+0x6D,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x03,0x01,0x02,0x02,0x18,0x03,
+0x02,0x02,0x02,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
+0x7C,0x00,0x02,0x01,0x03,0x02,0x0B,0x03,0x03,0x02,0x02,0x01,0x56,0x00,0x01,0x01,
+0x03,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x85,0x00,0x06,0x01,0x63,0x00,0x03,0x01,
+0x02,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0xF9,0x00,0x0F,0x01,0xC5,0x00,
 };
 static const DiffBlock LISTENING_FRAME1_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    15, 35,  // Changed box top-left
+    269, 101,  // Changed box dimensions
     LISTENING_FRAME1_DATA
 };
 
-// Frame 2: Full frame RLE (2094 bytes)
-static const uint8_t LISTENING_FRAME2_DATA[2094] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD0,0x00,0x0C,0x01,0xFF,0x00,0x2D,0x00,
-0x03,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,0x23,0x00,0x02,0x01,
-0x02,0x02,0x1B,0x03,0x03,0x02,0x01,0x01,0x8D,0x00,0x04,0x01,0x07,0x02,0x05,0x01,
-0x7C,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x84,0x00,0x02,0x01,
-0x02,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x7D,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x36,0x03,0x01,0x02,
-0x01,0x01,0x72,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
-0x02,0x02,0x35,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,
-0x43,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,0x55,0x00,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x59,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x48,0x00,0x01,0x01,
-0x52,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x43,0x00,
-0x01,0x02,0x57,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x01,0x01,0x49,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x38,0x00,
-0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x44,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x43,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x43,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x43,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0x42,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
-0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x37,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x60,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x41,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,
-0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
-0x4B,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
-0x43,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x5B,0x00,0x02,0x01,
-0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x74,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
-0x01,0x02,0x01,0x01,0x73,0x00,0x03,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0x80,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x7C,0x00,0x02,0x01,
-0x03,0x02,0x0B,0x03,0x03,0x02,0x02,0x01,0x89,0x00,0x01,0x01,0x03,0x02,0x1C,0x03,
-0x02,0x02,0x01,0x01,0x85,0x00,0x06,0x01,0x96,0x00,0x03,0x01,0x02,0x02,0x12,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x2D,0x00,0x0F,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x01,0x01,0x01,0x02,
-};
-static const DiffBlock LISTENING_FRAME2_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    LISTENING_FRAME2_DATA
-};
+// Frame 2: no change
 
-// Frame 3: Full frame RLE (2002 bytes)
-static const uint8_t LISTENING_FRAME3_DATA[2002] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x0B,0x00,0x04,0x01,0x07,0x02,0x04,0x01,0xFF,0x00,0x2B,0x00,0x02,0x01,
-0x02,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x21,0x00,0x02,0x01,0x01,0x02,
-0x1E,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x1A,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x0F,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x05,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x02,0x00,
-0x01,0x02,0x3E,0x03,0x01,0x01,0xFE,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
-0x01,0x01,0xFB,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0xF8,0x00,0x01,0x01,0x01,0x02,
-0x46,0x03,0x01,0x02,0x01,0x01,0xF5,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0xF3,0x00,
-0x01,0x01,0x4C,0x03,0x01,0x02,0xF0,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,
-0xEF,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x78,0x00,0x0C,0x01,0x69,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x01,0x01,
-0x63,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x6D,0x00,0x02,0x01,0x01,0x02,0x18,0x03,
-0x01,0x02,0x02,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0x5B,0x00,0x01,0x02,
-0x56,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,
-0x01,0x02,0x2C,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x60,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x32,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,
-0x49,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x3F,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x54,0x00,0x01,0x02,
-0x40,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x02,0x01,0x50,0x00,
-0x01,0x01,0x41,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x4E,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x68,0x03,
-0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x45,0x00,
-0x01,0x01,0x6A,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x6B,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x43,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x44,0x00,0x01,0x01,0x6E,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x44,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x44,0x03,
-0x01,0x01,0x44,0x00,0x01,0x01,0x70,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x44,0x03,
-0x01,0x01,0x44,0x00,0x01,0x01,0x71,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x44,0x03,
-0x01,0x01,0x44,0x00,0x01,0x01,0x72,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x44,0x03,
-0x01,0x01,0x44,0x00,0x01,0x01,0x72,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x73,0x03,0x01,0x02,0x41,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x73,0x03,0x01,0x02,0x41,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x01,0x40,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x73,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x73,0x03,0x01,0x02,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x73,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x73,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x02,0x72,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x02,0x72,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x02,0x45,0x00,0x01,0x02,0x71,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x70,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,
-0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x6E,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x02,0x6E,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x45,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x67,0x03,0x02,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x65,0x03,0x02,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x01,0x02,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x43,0x03,0x01,0x02,
-0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x51,0x00,0x01,0x01,
-0x43,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x52,0x00,0x01,0x02,
-0x42,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x41,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x53,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x54,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x01,0x55,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x4D,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x38,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x02,0x36,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
-0x33,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x31,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x61,0x00,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x02,0x55,0x03,0x01,0x01,
-0x63,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,
-0x53,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,
-0x21,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x6B,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x62,0x00,
-0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,
-0x15,0x03,0x02,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x75,0x00,0x01,0x01,0x06,0x02,0x06,0x03,0x05,0x02,0x01,0x01,0x6C,0x00,0x01,0x02,
-0x49,0x03,0x01,0x02,0xF6,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0xF8,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0xFB,0x00,0x01,0x01,0x40,0x03,0x01,0x02,
-0x01,0x01,0xFE,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0xFF,0x00,0x03,0x00,
-0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,
-0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x31,0x03,0x01,0x02,0xFF,0x00,0x0F,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0x19,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x22,0x00,0x03,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,0x2E,0x00,
-0x0C,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF2,0x00,0x01,0x01,
-0x01,0x02,
+// Frame 3: Diff RLE (1682 bytes)
+static const uint8_t LISTENING_FRAME3_DATA[1682] = {
+0xC4,0x00,0x04,0x01,0x07,0x02,0x04,0x01,0xF9,0x00,0x02,0x01,0x02,0x02,0x14,0x03,
+0x02,0x02,0x02,0x01,0xEF,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,
+0xE8,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x02,0x01,0xE1,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0xDD,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0xD7,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
+0xD3,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0xD0,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x01,0xCD,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
+0xCA,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0xC7,0x00,0x01,0x01,0x01,0x02,0x46,0x03,
+0x01,0x02,0x01,0x01,0xC4,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0xC2,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x02,0xBF,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0xBE,0x00,
+0x01,0x02,0x50,0x03,0x01,0x02,0x47,0x00,0x0C,0x01,0x69,0x00,0x01,0x02,0x52,0x03,
+0x01,0x01,0x41,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x63,0x00,
+0x01,0x01,0x54,0x03,0x01,0x01,0x3C,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x01,0x02,
+0x02,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0x5B,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,
+0x58,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x31,0x00,0x01,0x02,
+0x2C,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,
+0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x32,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x4C,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x4A,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x49,0x00,
+0x01,0x01,0x60,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x3F,0x03,
+0x01,0x02,0x48,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x40,0x03,
+0x01,0x01,0x46,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x02,0x01,0x1F,0x00,0x01,0x01,
+0x41,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x68,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
+0x6A,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x6B,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x6D,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,
+0x01,0x01,0x6E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x44,0x00,0x01,0x01,0x6F,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
+0x44,0x00,0x01,0x01,0x70,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
+0x44,0x00,0x01,0x01,0x71,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
+0x44,0x00,0x01,0x01,0x72,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
+0x44,0x00,0x01,0x01,0x72,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x73,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x73,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x44,0x03,
+0x01,0x02,0x44,0x00,0x01,0x01,0x74,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x73,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x73,0x03,0x01,0x02,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x73,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x73,0x03,
+0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
+0x72,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x02,0x72,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
+0x45,0x00,0x01,0x02,0x71,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
+0x01,0x02,0x45,0x00,0x01,0x02,0x70,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,0x01,0x01,
+0x11,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x6E,0x03,
+0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x02,0x6E,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x45,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x02,0x44,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x02,
+0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x67,0x03,0x02,0x02,0x01,0x01,0x19,0x00,
+0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x65,0x03,0x02,0x02,0x01,0x01,
+0x1B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
+0x62,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
+0x01,0x02,0x61,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,
+0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x43,0x03,
+0x01,0x02,0x47,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x42,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x41,0x03,
+0x01,0x02,0x48,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x01,0x02,
+0x40,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x23,0x00,
+0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x24,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x24,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x02,0x26,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,
+0x01,0x02,0x5B,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x4F,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x02,0x36,0x03,0x01,0x01,
+0x50,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x33,0x03,
+0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,
+0x31,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x30,0x00,0x01,0x02,
+0x2D,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x32,0x00,
+0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x01,0x02,0x35,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x02,0x02,0x15,0x03,
+0x02,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x44,0x00,
+0x01,0x01,0x06,0x02,0x06,0x03,0x05,0x02,0x01,0x01,0x6C,0x00,0x01,0x02,0x49,0x03,
+0x01,0x02,0xC5,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0xC7,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0xCA,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,
+0xCD,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0xD1,0x00,0x01,0x01,0x01,0x02,
+0x39,0x03,0x01,0x02,0x01,0x01,0xD4,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
+0x01,0x01,0xD8,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0xDD,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0xE1,0x00,0x01,0x01,0x02,0x02,0x24,0x03,
+0x02,0x02,0x02,0x01,0xE7,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,
+0xF0,0x00,0x03,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,0xFC,0x00,0x0C,0x01,
+0x3C,0x00,
 };
 static const DiffBlock LISTENING_FRAME3_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    30, 32,  // Changed box top-left
+    271, 105,  // Changed box dimensions
     LISTENING_FRAME3_DATA
 };
 
-// Frame 4: Full frame RLE (1834 bytes)
-static const uint8_t LISTENING_FRAME4_DATA[1834] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD0,0x00,0x02,0x01,0x05,0x02,0x08,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,
-0x27,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1E,0x00,
-0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,
-0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x11,0x00,0x01,0x01,0x01,0x02,
-0x2E,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x0C,0x00,0x01,0x01,0x01,0x02,0x33,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x07,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x04,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0xFD,0x00,0x01,0x01,0x42,0x03,
-0x01,0x02,0x01,0x01,0xF9,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0xF7,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x82,0x00,0x01,0x01,0x71,0x00,0x01,0x01,
-0x4A,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x02,0x01,0x05,0x02,0x08,0x03,0x03,0x02,
-0x02,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,0x71,0x00,0x02,0x01,
-0x01,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x22,0x03,
-0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x66,0x00,0x01,0x01,
-0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x64,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x55,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x33,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x02,
-0x36,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x01,0x02,0x38,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x59,0x00,
-0x01,0x02,0x3A,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x58,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x57,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
-0x56,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x55,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x53,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x46,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x01,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,
+// Frame 4: Diff RLE (1512 bytes)
+static const uint8_t LISTENING_FRAME4_DATA[1512] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC1,0x00,
+0x02,0x01,0x05,0x02,0x08,0x03,0x04,0x02,0x02,0x01,0xE7,0x00,0x02,0x01,0x02,0x02,
+0x17,0x03,0x02,0x02,0x02,0x01,0xDE,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,
+0x02,0x01,0xD6,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0xD1,0x00,
+0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x02,0x01,0xCC,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0xC7,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
+0x01,0x01,0xC4,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0xC0,0x00,
+0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0xBE,0x00,0x01,0x01,0x42,0x03,0x01,0x02,
+0x01,0x01,0xBA,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0xB8,0x00,0x01,0x01,
+0x48,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x71,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x01,0x01,0x37,0x00,0x02,0x01,0x05,0x02,0x08,0x03,0x03,0x02,0x02,0x01,
+0x67,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,0x32,0x00,0x02,0x01,0x01,0x02,
+0x16,0x03,0x02,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,
+0x2E,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,
+0x01,0x02,0x51,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,
+0x01,0x01,0x5C,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,
+0x27,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x55,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x01,0x01,0x52,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,
+0x50,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,0x36,0x03,
+0x01,0x01,0x4F,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x01,0x02,
+0x38,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,
+0x3A,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x18,0x00,0x01,0x01,
+0x3D,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x3E,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x16,0x00,
+0x01,0x02,0x40,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,
+0x14,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x14,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,0x61,0x03,
+0x01,0x01,0x14,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x61,0x03,
+0x01,0x01,0x13,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,
+0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,
+0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x11,0x00,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x11,0x00,
 0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x46,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,
-0x01,0x01,0x46,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x52,0x00,0x01,0x01,
-0x43,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,0x53,0x00,
-0x01,0x02,0x42,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x53,0x00,
-0x01,0x01,0x41,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x54,0x00,
-0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x3D,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x3B,0x03,
-0x01,0x02,0x4F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x01,0x02,
-0x39,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x38,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,
-0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x60,0x00,
-0x01,0x02,0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x62,0x00,
-0x01,0x02,0x31,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x64,0x00,
-0x01,0x02,0x2E,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x66,0x00,
-0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x69,0x00,0x01,0x01,0x27,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,
-0x4A,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
-0x63,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,
-0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x6B,0x00,
-0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x77,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,
-0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,
-0x09,0x01,0x79,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,
-0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,
-0x32,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x12,0x00,0x02,0x01,0x02,0x02,0x25,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x19,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x21,0x00,0x03,0x01,0x03,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x2C,0x00,0x09,0x01,0x01,0x02,0x06,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xB9,0x00,0x01,0x01,0x01,0x02,
+0x11,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x46,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
+0x46,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x43,0x03,0x01,0x02,
+0x01,0x01,0x46,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x43,0x03,
+0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,0x14,0x00,0x01,0x02,
+0x42,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
+0x41,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x15,0x00,0x01,0x01,
+0x01,0x02,0x40,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,
+0x16,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x17,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,
+0x4D,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,
+0x4F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x01,0x02,0x51,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x38,0x03,
+0x01,0x02,0x52,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,
+0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
+0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
+0x31,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
+0x2E,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x27,0x00,0x01,0x01,
+0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x27,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x2D,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
+0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,
+0x1D,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
+0x33,0x00,0x02,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,
+0x01,0x02,0x41,0x03,0x01,0x01,0x38,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,
+0x01,0x01,0x71,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x09,0x01,
+0x79,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x01,0x01,0xC6,0x00,0x01,0x02,0x36,0x03,
+0x01,0x02,0x01,0x01,0xC9,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,
+0xCE,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0xD2,0x00,0x02,0x01,
+0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0xD9,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,
+0x01,0x02,0x01,0x01,0xE1,0x00,0x03,0x01,0x03,0x02,0x12,0x03,0x02,0x02,0x02,0x01,
+0xEC,0x00,0x09,0x01,0x01,0x02,0x06,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0x48,0x00,
 };
 static const DiffBlock LISTENING_FRAME4_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 32,  // Changed box top-left
+    257, 105,  // Changed box dimensions
     LISTENING_FRAME4_DATA
 };
 
-// Frame 5: Full frame RLE (1964 bytes)
-static const uint8_t LISTENING_FRAME5_DATA[1964] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCC,0x00,0x04,0x01,0x0B,0x02,0x03,0x01,
-0xFF,0x00,0x2A,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,
-0x1F,0x00,0x02,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x19,0x00,
-0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,
-0x31,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x05,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x02,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0xFD,0x00,
-0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0xFB,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
-0x01,0x01,0xF7,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0xF5,0x00,
-0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x79,0x00,0x04,0x01,0x08,0x02,0x03,0x01,
-0x6B,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x01,0x01,0x02,0x02,
-0x12,0x03,0x02,0x02,0x01,0x01,0x65,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,
-0x6E,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x60,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x5D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x54,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,
-0x01,0x02,0x55,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0x55,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x30,0x03,
-0x01,0x01,0x53,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,
-0x32,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
-0x01,0x02,0x34,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x4A,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,
-0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
-0x48,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x40,0x03,
-0x01,0x02,0x47,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x41,0x03,
-0x01,0x02,0x47,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,
-0x42,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,
-0x52,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,
-0x01,0x01,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,
-0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,
-0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x50,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x01,0x02,0x61,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x46,0x00,
-0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x46,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
-0x47,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x48,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,
-0x40,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x55,0x00,0x01,0x01,
-0x40,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x02,0x3E,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x57,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,
-0x58,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x01,0x5A,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x56,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x53,0x00,
-0x01,0x02,0x55,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x31,0x03,
-0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x66,0x00,0x01,0x01,0x2B,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x69,0x00,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
-0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,
-0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x01,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x69,0x00,
-0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x02,0x01,0x03,0x02,
-0x0B,0x03,0x03,0x02,0x02,0x01,0x6F,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,
-0x81,0x00,0x06,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0xFF,0x00,
-0x03,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x14,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x1A,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x22,0x00,0x03,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,
-0x2D,0x00,0x0D,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB6,0x00,0x01,0x01,0x01,0x02,
+// Frame 5: Diff RLE (1586 bytes)
+static const uint8_t LISTENING_FRAME5_DATA[1586] = {
+0xB4,0x00,0x04,0x01,0x0B,0x02,0x03,0x01,0xD9,0x00,0x02,0x01,0x02,0x02,0x14,0x03,
+0x03,0x02,0x02,0x01,0xCE,0x00,0x02,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x02,0x01,
+0xC8,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0xC2,0x00,0x01,0x01,
+0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0xBD,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0xB8,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
+0xB4,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0xB1,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x01,0x01,0xAD,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,
+0xAB,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0xA7,0x00,0x01,0x01,0x01,0x02,
+0x46,0x03,0x01,0x02,0x01,0x01,0xA5,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,
+0x29,0x00,0x04,0x01,0x08,0x02,0x03,0x01,0x6B,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
+0x01,0x01,0x23,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
+0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,
+0x01,0x02,0x02,0x01,0x60,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x52,0x03,
+0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
+0x5A,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x02,0x29,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x13,0x00,
+0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x57,0x03,
+0x01,0x01,0x11,0x00,0x01,0x01,0x30,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x58,0x03,
+0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x51,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x50,0x00,
+0x01,0x02,0x5B,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,
+0x4D,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x39,0x03,0x01,0x02,
+0x01,0x01,0x4C,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
+0x3A,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x08,0x00,
+0x01,0x02,0x3C,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,
+0x06,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x05,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x05,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x60,0x03,
+0x01,0x02,0x04,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x46,0x00,0x01,0x02,
+0x61,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x44,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x02,0x00,0x01,0x02,
+0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x02,0x00,
+0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x02,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x62,0x03,0x02,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
+0x02,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x02,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x02,0x01,0x01,0x02,
+0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x62,0x03,0x02,0x01,0x01,0x02,0x44,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x02,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x62,0x03,0x02,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x02,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x62,0x03,0x02,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
+0x02,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,
+0x01,0x01,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x46,0x00,0x01,0x01,
+0x60,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
+0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x48,0x00,0x01,0x02,
+0x5F,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x02,0x40,0x03,0x01,0x02,
+0x49,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x40,0x03,0x01,0x01,
+0x4A,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x3E,0x03,
+0x01,0x01,0x4B,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x3D,0x03,
+0x01,0x02,0x4D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,
+0x3B,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x55,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x53,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x01,0x01,
+0x56,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x01,0x02,
+0x2E,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x16,0x00,
+0x01,0x01,0x2B,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x19,0x00,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
+0x62,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,
+0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x23,0x00,
+0x01,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x69,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x02,0x01,0x03,0x02,0x0B,0x03,0x03,0x02,
+0x02,0x01,0x6F,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x06,0x01,
+0x77,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0xB2,0x00,0x01,0x01,0x01,0x02,
+0x39,0x03,0x01,0x02,0x01,0x01,0xB5,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
+0x01,0x01,0xB9,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0xBF,0x00,0x01,0x01,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xC3,0x00,0x02,0x01,0x01,0x02,0x25,0x03,
+0x01,0x02,0x02,0x01,0xC9,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,
+0xD1,0x00,0x03,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,0xDC,0x00,0x0D,0x01,
+0x2B,0x00,
 };
 static const DiffBlock LISTENING_FRAME5_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 35,  // Changed box top-left
+    240, 99,  // Changed box dimensions
     LISTENING_FRAME5_DATA
 };
 
-// Frame 6: Full frame RLE (1948 bytes)
-static const uint8_t LISTENING_FRAME6_DATA[1948] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x0E,0x01,0xFF,0x00,0x2D,0x00,
-0x02,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x03,0x01,0xFF,0x00,0x22,0x00,0x01,0x01,
-0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1A,0x00,0x01,0x01,0x02,0x02,
-0x25,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x0F,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x02,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x06,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0xFF,0x00,0x03,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x01,0xFE,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
-0x01,0x01,0xFB,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0xF9,0x00,0x01,0x02,
-0x46,0x03,0x01,0x02,0x01,0x01,0xF5,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x01,
-0x7A,0x00,0x07,0x01,0x03,0x02,0x03,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x74,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x02,0x70,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,
-0x01,0x01,0x61,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x02,0x01,
-0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,
-0x68,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x61,0x00,0x01,0x01,0x30,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x50,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x4D,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x58,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x01,0x3E,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x56,0x00,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x55,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x54,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x53,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x01,0x02,0x61,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,
-0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x44,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x44,0x03,
-0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x51,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x01,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x50,0x00,
+// Frame 6: Diff RLE (1546 bytes)
+static const uint8_t LISTENING_FRAME6_DATA[1546] = {
+0xB5,0x00,0x0E,0x01,0xDB,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x03,0x01,
+0xD0,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xC8,0x00,0x01,0x01,
+0x02,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0xC1,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0xBD,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
+0xB7,0x00,0x01,0x01,0x02,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xB4,0x00,0x01,0x02,
+0x3A,0x03,0x01,0x02,0xB1,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0xAD,0x00,
+0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0xAA,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x02,0xA8,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0xA4,0x00,
+0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x01,0x29,0x00,0x07,0x01,0x03,0x02,0x03,0x01,
+0x6C,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x23,0x00,0x02,0x01,0x02,0x02,
+0x10,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x1F,0x00,
+0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x50,0x03,
+0x01,0x02,0x01,0x01,0x1A,0x00,0x02,0x01,0x20,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
+0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,
+0x14,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,
+0x55,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x55,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x30,0x03,0x01,0x01,
+0x53,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x32,0x03,
+0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,
+0x34,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x37,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x49,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x40,0x03,0x01,0x02,
+0x47,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
+0x47,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,0x42,0x03,
+0x01,0x01,0x46,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x42,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x43,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x01,0x00,
+0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,
+0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x61,0x03,
+0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
+0x61,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
 0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x46,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x44,0x03,
-0x01,0x01,0x46,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x43,0x03,
-0x01,0x02,0x47,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x42,0x03,
-0x01,0x02,0x48,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x41,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x02,0x40,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x55,0x00,
-0x01,0x01,0x40,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,
-0x56,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x57,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x01,0x02,0x59,0x03,0x01,0x01,0x5A,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x51,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x36,0x03,0x01,0x01,
-0x53,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x33,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x61,0x00,0x01,0x01,
-0x31,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x66,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,
-0x4D,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
-0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x01,0x01,0x02,0x02,0x15,0x03,0x02,0x02,
-0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x78,0x00,
-0x02,0x01,0x06,0x02,0x06,0x03,0x04,0x02,0x02,0x01,0x70,0x00,0x01,0x01,0x01,0x02,
-0x3F,0x03,0x01,0x02,0xFF,0x00,0x01,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x04,0x00,0x01,0x02,0x39,0x03,0x01,0x01,0xFF,0x00,0x08,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x02,0x02,0x29,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x15,0x00,0x01,0x01,0x02,0x02,0x23,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x1B,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x25,0x00,0x03,0x01,0x02,0x02,0x0C,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,
-0x32,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB9,0x00,0x01,0x01,0x01,0x02,
+0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,
+0x44,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,
+0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x61,0x03,
+0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
+0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x49,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x4B,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x4D,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,
+0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x3A,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,
+0x38,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
+0x01,0x02,0x36,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x01,0x02,0x10,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,
+0x51,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,
+0x5A,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
+0x01,0x02,0x5D,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,
+0x26,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
+0x66,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,
+0x02,0x02,0x15,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
+0x01,0x02,0x01,0x01,0x27,0x00,0x02,0x01,0x06,0x02,0x06,0x03,0x04,0x02,0x02,0x01,
+0x70,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0xAF,0x00,0x01,0x02,0x3C,0x03,
+0x01,0x02,0x01,0x01,0xB2,0x00,0x01,0x02,0x39,0x03,0x01,0x01,0xB6,0x00,0x01,0x01,
+0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0xBA,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
+0x01,0x02,0x01,0x01,0xBE,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,0x02,0x01,
+0xC3,0x00,0x01,0x01,0x02,0x02,0x23,0x03,0x01,0x02,0x02,0x01,0xC9,0x00,0x02,0x01,
+0x02,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0xD3,0x00,0x03,0x01,0x02,0x02,0x0C,0x03,
+0x04,0x02,0x02,0x01,0xE0,0x00,0x07,0x01,0x2E,0x00,
 };
 static const DiffBlock LISTENING_FRAME6_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 35,  // Changed box top-left
+    239, 99,  // Changed box dimensions
     LISTENING_FRAME6_DATA
 };
 
-// Frame 7: Full frame RLE (1348 bytes)
-static const uint8_t LISTENING_FRAME7_DATA[1348] = {
+// Frame 7: Diff RLE (1012 bytes)
+static const uint8_t LISTENING_FRAME7_DATA[1012] = {
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xA3,0x00,0x11,0x01,0x1F,0x02,0x02,0x01,0xFB,0x00,0x03,0x01,0x09,0x02,
-0x3A,0x03,0x02,0x02,0x02,0x01,0xF2,0x00,0x01,0x01,0x02,0x02,0x4B,0x03,0x02,0x02,
-0x01,0x01,0xEB,0x00,0x02,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0xE7,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0xE3,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x01,0x01,0x83,0x00,0x03,0x01,0x05,0x00,0x08,0x01,0x4C,0x00,
-0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x0A,0x01,0x01,0x02,
+0xFF,0x00,0x4B,0x00,0x11,0x01,0x1F,0x02,0x02,0x01,0xCB,0x00,0x03,0x01,0x09,0x02,
+0x3A,0x03,0x02,0x02,0x02,0x01,0xC2,0x00,0x01,0x01,0x02,0x02,0x4B,0x03,0x02,0x02,
+0x01,0x01,0xBB,0x00,0x02,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0xB7,0x00,
+0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0xB3,0x00,0x01,0x01,0x01,0x02,
+0x5B,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x03,0x01,0x05,0x00,0x08,0x01,0x4C,0x00,
+0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x0A,0x01,0x01,0x02,
 0x0D,0x01,0x0F,0x02,0x15,0x03,0x03,0x02,0x02,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x01,0x4F,0x00,0x02,0x01,0x02,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x40,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
-0x02,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x63,0x03,0x01,0x01,0x1F,0x00,0x02,0x01,0x02,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
+0x02,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x01,0x01,0x17,0x00,
 0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x6A,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x35,0x00,0x01,0x01,
-0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x6E,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,
+0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x35,0x00,0x01,0x01,
+0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x6E,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
 0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x70,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x72,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x74,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
-0x01,0x02,0x74,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x2A,0x00,0x01,0x02,0x76,0x03,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x01,0x01,0x28,0x00,0x01,0x01,0x77,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x68,0x03,
-0x01,0x02,0x28,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x6A,0x03,
-0x01,0x01,0x27,0x00,0x01,0x02,0x78,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x6A,0x03,
-0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x79,0x03,0x01,0x02,0x32,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x7A,0x03,0x01,0x01,0x31,0x00,0x01,0x02,
-0x6C,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x7A,0x03,0x01,0x01,0x30,0x00,0x01,0x01,
-0x01,0x02,0x6D,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x7A,0x03,0x01,0x01,0x30,0x00,
-0x01,0x01,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x7A,0x03,0x01,0x01,0x30,0x00,
-0x01,0x02,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x7A,0x03,0x01,0x01,0x30,0x00,
-0x01,0x02,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x7A,0x03,0x01,0x01,0x30,0x00,
-0x01,0x02,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x7A,0x03,0x01,0x01,0x30,0x00,
-0x01,0x02,0x6E,0x03,0x01,0x02,0x24,0x00,0x01,0x02,0x79,0x03,0x01,0x02,0x31,0x00,
-0x01,0x02,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x79,0x03,0x01,0x02,0x31,0x00,
-0x01,0x02,0x6D,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x79,0x03,0x01,0x01,0x31,0x00,
+0x01,0x02,0x0D,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x72,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x74,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,
+0x01,0x02,0x74,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
+0x2A,0x00,0x01,0x02,0x76,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x01,0x01,0x28,0x00,0x01,0x01,0x77,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x68,0x03,
+0x01,0x02,0x28,0x00,0x01,0x02,0x78,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x6A,0x03,
+0x01,0x01,0x27,0x00,0x01,0x02,0x78,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x6A,0x03,
+0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x79,0x03,0x01,0x02,0x02,0x00,0x01,0x01,
+0x6C,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x7A,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x6C,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x7A,0x03,0x02,0x01,0x01,0x02,0x6D,0x03,
+0x01,0x01,0x24,0x00,0x01,0x02,0x7A,0x03,0x02,0x01,0x6E,0x03,0x01,0x01,0x24,0x00,
+0x01,0x02,0x7A,0x03,0x01,0x01,0x01,0x02,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x02,
+0x7A,0x03,0x01,0x01,0x01,0x02,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x7A,0x03,
+0x01,0x01,0x01,0x02,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x7A,0x03,0x01,0x01,
+0x01,0x02,0x6E,0x03,0x01,0x02,0x24,0x00,0x01,0x02,0x79,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x6E,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x79,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x6D,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x79,0x03,0x01,0x01,0x01,0x00,
 0x01,0x01,0x6D,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x77,0x03,0x01,0x02,0x01,0x01,
-0x31,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x77,0x03,0x01,0x01,
-0x33,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
-0x75,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x28,0x00,0x01,0x01,
-0x75,0x03,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x02,0x73,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x01,0x01,
-0x2A,0x00,0x01,0x01,0x73,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x67,0x03,0x01,0x01,
-0x2C,0x00,0x01,0x01,0x71,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x2E,0x00,0x01,0x02,0x6F,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x01,0x02,0x6D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,
+0x01,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x77,0x03,0x01,0x01,
+0x03,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x75,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x28,0x00,0x01,0x01,
+0x75,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x02,0x73,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x01,0x01,
+0x2A,0x00,0x01,0x01,0x73,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x67,0x03,0x01,0x01,
+0x2C,0x00,0x01,0x01,0x71,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x2E,0x00,0x01,0x02,0x6F,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
+0x2F,0x00,0x01,0x01,0x01,0x02,0x6D,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x62,0x03,
+0x01,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
 0x60,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x68,0x03,0x01,0x02,0x01,0x01,
-0x40,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
+0x10,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
 0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,
-0x46,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x02,0x01,0x01,0x02,0x51,0x03,0x02,0x02,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,
+0x16,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x01,0x01,0x18,0x00,0x02,0x01,0x01,0x02,0x51,0x03,0x02,0x02,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,
 0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x51,0x00,0x02,0x01,0x01,0x02,0x44,0x03,0x03,0x02,0x02,0x01,
-0x49,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x02,0x01,
+0x01,0x02,0x01,0x01,0x21,0x00,0x02,0x01,0x01,0x02,0x44,0x03,0x03,0x02,0x02,0x01,
+0x49,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x02,0x01,
 0x01,0x02,0x26,0x03,0x16,0x02,0x03,0x01,0x51,0x00,0x02,0x01,0x01,0x02,0x4C,0x03,
-0x02,0x02,0x02,0x01,0x5E,0x00,0x0F,0x01,0x83,0x00,0x02,0x01,0x02,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0xFA,0x00,0x03,0x01,0x2A,0x02,0x01,0x01,0x01,0x02,0x10,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0x02,0x02,0x02,0x01,0x2E,0x00,0x0F,0x01,0x83,0x00,0x02,0x01,0x02,0x02,0x45,0x03,
+0x01,0x02,0x01,0x01,0xCA,0x00,0x03,0x01,0x2A,0x02,0x01,0x01,0x01,0x02,0x10,0x01,
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xBF,0x00,
-0x01,0x01,0x01,0x02,
+0xFF,0x00,0xBB,0x00,
 };
 static const DiffBlock LISTENING_FRAME7_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    24, 35,  // Changed box top-left
+    272, 99,  // Changed box dimensions
     LISTENING_FRAME7_DATA
 };
 
-// Frame 8: Full frame RLE (1922 bytes)
-static const uint8_t LISTENING_FRAME8_DATA[1922] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF6,0x00,
-0x04,0x01,0x0A,0x02,0x02,0x01,0xFF,0x00,0x2C,0x00,0x02,0x01,0x03,0x02,0x11,0x03,
-0x04,0x02,0x03,0x01,0xFF,0x00,0x20,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x1A,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x14,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x0F,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x03,0x01,0x85,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x02,0x70,0x00,0x02,0x01,0x02,0x02,0x0A,0x03,0x03,0x02,
-0x02,0x01,0x7C,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x02,0x01,0x68,0x00,0x02,0x01,
-0x02,0x02,0x16,0x03,0x01,0x02,0x02,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,
-0x71,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x01,0x02,0x23,0x03,
-0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,
-0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x2F,0x03,0x01,0x01,0x65,0x00,0x01,0x01,
-0x50,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x52,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,
-0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x36,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x4F,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,
-0x59,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,
-0x57,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x40,0x03,0x01,0x02,
-0x57,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x41,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,
-0x01,0x02,0x55,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x43,0x03,
-0x01,0x01,0x54,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x44,0x03,
-0x01,0x01,0x53,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x44,0x03,
-0x01,0x02,0x53,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x53,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,
-0x01,0x01,0x52,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,
-0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,
-0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x43,0x03,
-0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,
-0x01,0x01,0x42,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x60,0x03,0x49,0x00,0x01,0x02,
-0x41,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x49,0x00,0x01,0x01,
-0x01,0x02,0x3F,0x03,0x01,0x02,0x55,0x00,0x5F,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x02,0x3B,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4E,0x00,
-0x01,0x02,0x39,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x50,0x00,
-0x01,0x02,0x37,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x51,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x53,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x2F,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x01,0x02,0x56,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x62,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,
-0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x02,
-0x4F,0x03,0x01,0x01,0x63,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,
-0x6F,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x67,0x00,0x02,0x01,0x02,0x02,0x10,0x03,
-0x02,0x02,0x02,0x01,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x6D,0x00,0x05,0x01,
-0x01,0x02,0x01,0x01,0x05,0x02,0x03,0x01,0x78,0x00,0x01,0x01,0x49,0x03,0x01,0x01,
-0xF6,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0xF9,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x02,0xFC,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,0xFE,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x02,0xFF,0x00,0x03,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x0B,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x0F,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x15,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1A,0x00,
-0x02,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x23,0x00,0x02,0x01,
-0x02,0x02,0x10,0x03,0x02,0x02,0x04,0x01,0xFF,0x00,0x2D,0x00,0x0D,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCF,0x00,0x01,0x01,
-0x01,0x02,
+// Frame 8: Diff RLE (1588 bytes)
+static const uint8_t LISTENING_FRAME8_DATA[1588] = {
+0x2F,0x00,0x04,0x01,0x0A,0x02,0x02,0x01,0xFB,0x00,0x02,0x01,0x03,0x02,0x11,0x03,
+0x04,0x02,0x03,0x01,0xEF,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
+0xE9,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0xE3,0x00,0x01,0x01,
+0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xDE,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
+0x01,0x02,0x01,0x01,0xDA,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
+0xD5,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x03,0x01,
+0x55,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x70,0x00,0x02,0x01,0x02,0x02,
+0x0A,0x03,0x03,0x02,0x02,0x01,0x4C,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x02,0x01,
+0x68,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x01,0x02,0x02,0x01,0x45,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,
+0x01,0x02,0x02,0x01,0x41,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x61,0x00,0x01,0x01,
+0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x02,0x49,0x03,0x01,0x02,
+0x5E,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
+0x37,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x2F,0x03,0x01,0x01,
+0x35,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x02,0x33,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,
+0x52,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,
+0x55,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
+0x3D,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,
+0x3F,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x49,0x00,0x01,0x01,
+0x40,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x49,0x00,0x01,0x02,
+0x41,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x01,0x01,0x42,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x47,0x00,
+0x01,0x02,0x43,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x46,0x00,
+0x01,0x01,0x44,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x46,0x00,
+0x01,0x01,0x44,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x45,0x00,
+0x01,0x02,0x44,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,
+0x01,0x02,0x45,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,
+0x01,0x02,0x45,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,
+0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x20,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,
+0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
+0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x46,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x46,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x01,0x02,0x45,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x20,0x00,0x01,0x01,
+0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x20,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
+0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,
+0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x44,0x03,
+0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
+0x01,0x01,0x44,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x47,0x00,
+0x01,0x02,0x43,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,
+0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x02,0x60,0x03,
+0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x60,0x03,
+0x49,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x49,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x25,0x00,0x5F,0x03,0x01,0x02,
+0x4A,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x4B,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x02,0x4D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x01,0x4E,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x50,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,
+0x5A,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
+0x2E,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x2F,0x03,0x01,0x01,
+0x30,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
+0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x5C,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x51,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x63,0x00,0x02,0x01,0x01,0x02,0x19,0x03,
+0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x67,0x00,0x02,0x01,
+0x02,0x02,0x10,0x03,0x02,0x02,0x02,0x01,0x43,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,
+0x6D,0x00,0x05,0x01,0x01,0x02,0x01,0x01,0x05,0x02,0x03,0x01,0x48,0x00,0x01,0x01,
+0x49,0x03,0x01,0x01,0xC6,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0xC9,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x02,0xCC,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,
+0xCE,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x01,0x02,
+0x39,0x03,0x01,0x02,0x01,0x01,0xD5,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
+0x01,0x01,0xDA,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0xDE,0x00,
+0x01,0x01,0x02,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0xE4,0x00,0x01,0x01,0x01,0x02,
+0x24,0x03,0x02,0x02,0x02,0x01,0xE9,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,
+0x02,0x01,0xF2,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x04,0x01,0xFC,0x00,
+0x0D,0x01,0xD2,0x00,
 };
 static const DiffBlock LISTENING_FRAME8_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    24, 38,  // Changed box top-left
+    272, 98,  // Changed box dimensions
     LISTENING_FRAME8_DATA
 };
 
-// Frame 9: Full frame RLE (1920 bytes)
-static const uint8_t LISTENING_FRAME9_DATA[1920] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF7,0x00,
-0x04,0x01,0x09,0x02,0x03,0x01,0xFF,0x00,0x2B,0x00,0x03,0x01,0x03,0x02,0x11,0x03,
-0x03,0x02,0x02,0x01,0xFF,0x00,0x21,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x1A,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x14,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x0F,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x01,0x7A,0x00,0x03,0x01,0x85,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x01,0x70,0x00,0x02,0x01,0x03,0x02,0x06,0x03,0x04,0x02,0x03,0x01,
-0x7D,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x02,0x02,
-0x14,0x03,0x02,0x02,0x02,0x01,0x76,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0x72,0x00,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
-0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,
-0x4B,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,
-0x68,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
-0x53,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x60,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x38,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,
-0x56,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x58,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x40,0x03,
-0x01,0x01,0x57,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x42,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x47,0x00,
-0x01,0x02,0x42,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x46,0x00,
-0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x46,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x60,0x03,0x46,0x00,
-0x01,0x01,0x44,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x45,0x03,0x52,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x46,0x00,
-0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,
-0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,
-0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,
-0x01,0x01,0x42,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,
-0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x60,0x03,0x49,0x00,
-0x01,0x02,0x40,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x4A,0x00,
-0x01,0x02,0x3F,0x03,0x01,0x01,0x55,0x00,0x5F,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,
-0x3E,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x02,0x3B,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4E,0x00,
-0x01,0x02,0x39,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x4F,0x00,
-0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,
-0x01,0x01,0x51,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+// Frame 9: Diff RLE (1550 bytes)
+static const uint8_t LISTENING_FRAME9_DATA[1550] = {
+0x2A,0x00,0x04,0x01,0x09,0x02,0x03,0x01,0xDA,0x00,0x03,0x01,0x03,0x02,0x11,0x03,
+0x03,0x02,0x02,0x01,0xD0,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,
+0xC9,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0xC3,0x00,0x01,0x01,
+0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xBE,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
+0x01,0x02,0x01,0x01,0xBA,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
+0xB5,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x7A,0x00,0x03,0x01,0x35,0x00,
+0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x70,0x00,0x02,0x01,0x03,0x02,0x06,0x03,
+0x04,0x02,0x03,0x01,0x2D,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,
+0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,
+0x02,0x01,0x22,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x49,0x03,
+0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
+0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
+0x2E,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x57,0x00,
+0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x51,0x03,
+0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x11,0x00,
+0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x36,0x03,0x01,0x01,
+0x10,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x38,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x3C,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
+0x01,0x01,0x40,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x49,0x00,
+0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x03,0x00,0x01,0x01,
+0x60,0x03,0x46,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x60,0x03,
+0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x60,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x00,0x01,0x01,
+0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x02,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x02,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x02,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x01,0x02,0x45,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x01,0x02,0x45,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x45,0x03,
+0x02,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x02,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
+0x02,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,
+0x01,0x01,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x42,0x03,
+0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,
+0x01,0x01,0x42,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,
+0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x60,0x03,0x49,0x00,
+0x01,0x02,0x40,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x4A,0x00,
+0x01,0x02,0x3F,0x03,0x01,0x01,0x05,0x00,0x5F,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,
+0x3E,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,
+0x3C,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x4D,0x00,
+0x01,0x02,0x3B,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4E,0x00,
+0x01,0x02,0x39,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x4F,0x00,
+0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,
+0x01,0x01,0x51,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
 0x59,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
-0x5C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
+0x0E,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
+0x01,0x01,0x11,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
+0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x5C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x51,0x03,
+0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
 0x01,0x02,0x4F,0x03,0x01,0x01,0x63,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,
-0x01,0x01,0x6F,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x68,0x00,0x02,0x01,0x02,0x02,
-0x0E,0x03,0x03,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x6F,0x00,
-0x0B,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0xF6,0x00,0x01,0x01,
-0x01,0x02,0x46,0x03,0x01,0x01,0xF9,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,
-0xFB,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0xFF,0x00,0x01,0x01,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x03,0x00,0x01,0x02,0x39,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x06,0x00,0x02,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x0B,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x0F,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x15,0x00,
-0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x1B,0x00,0x02,0x01,
-0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x23,0x00,0x02,0x01,0x03,0x02,
-0x0E,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,0x2E,0x00,0x0C,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD0,0x00,0x01,0x01,0x01,0x02,
-
+0x01,0x01,0x1F,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x68,0x00,0x02,0x01,0x02,0x02,
+0x0E,0x03,0x03,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x6F,0x00,
+0x0B,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0xA6,0x00,0x01,0x01,
+0x01,0x02,0x46,0x03,0x01,0x01,0xA9,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,
+0xAB,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0xAF,0x00,0x01,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x01,0x01,0xB2,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0xB5,0x00,0x02,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0xBA,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0xBE,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,
+0x01,0x02,0x01,0x01,0xC4,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,
+0xCA,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0xD2,0x00,0x02,0x01,
+0x03,0x02,0x0E,0x03,0x03,0x02,0x03,0x01,0xDD,0x00,0x0C,0x01,0xB9,0x00,
 };
 static const DiffBlock LISTENING_FRAME9_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    30, 38,  // Changed box top-left
+    240, 98,  // Changed box dimensions
     LISTENING_FRAME9_DATA
 };
 
-// Frame 10: Full frame RLE (1926 bytes)
-static const uint8_t LISTENING_FRAME10_DATA[1926] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF7,0x00,
-0x04,0x01,0x09,0x02,0x03,0x01,0xFF,0x00,0x2B,0x00,0x03,0x01,0x03,0x02,0x12,0x03,
-0x02,0x02,0x03,0x01,0xFF,0x00,0x21,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x1A,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x15,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x0F,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x01,0xFF,0x00,0x07,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x03,0x01,0x85,0x00,0x01,0x01,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x70,0x00,0x02,0x01,0x03,0x02,0x08,0x03,0x03,0x02,
-0x03,0x01,0x7C,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x02,0x02,0x15,0x03,0x02,0x02,0x01,0x01,0x76,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x72,0x00,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
-0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,
-0x01,0x01,0x68,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x57,0x00,0x01,0x02,
-0x31,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
-0x01,0x01,0x52,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x51,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x4F,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x59,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x57,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x40,0x03,0x01,0x02,
-0x57,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x41,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,
-0x01,0x02,0x55,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x43,0x03,
-0x01,0x01,0x54,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,
-0x43,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x44,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x44,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,
-0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
-0x01,0x01,0x44,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,
-0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x47,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x60,0x03,
-0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x53,0x00,0x01,0x01,
-0x60,0x03,0x49,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x55,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x56,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x01,0x5D,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x58,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x39,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x34,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x01,0x02,
-0x31,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x55,0x00,
-0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
-0x57,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,
-0x55,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
-0x01,0x01,0x53,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x01,
-0x68,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
-0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x64,0x00,0x01,0x01,
-0x02,0x02,0x17,0x03,0x02,0x02,0x01,0x01,0x6F,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x69,0x00,0x01,0x01,0x03,0x02,0x0D,0x03,0x03,0x02,0x01,0x01,0x74,0x00,0x01,0x01,
-0x4B,0x03,0x01,0x02,0x6F,0x00,0x0B,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x01,0xF6,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0xF9,0x00,
-0x01,0x01,0x43,0x03,0x01,0x02,0xFC,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0xFF,0x00,0x04,0x00,
-0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x02,0x01,0x01,0x02,
-0x34,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0B,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x0F,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x15,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x1B,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x24,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,0x2F,0x00,
-0x0C,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xCF,0x00,0x01,0x01,0x01,0x02,
+// Frame 10: Diff RLE (1414 bytes)
+static const uint8_t LISTENING_FRAME10_DATA[1414] = {
+0x23,0x00,0x03,0x01,0x03,0x02,0x12,0x03,0x02,0x02,0x03,0x01,0xCE,0x00,0x01,0x01,
+0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,0xC7,0x00,0x02,0x01,0x01,0x02,0x25,0x03,
+0x01,0x02,0x01,0x01,0xC2,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
+0xBC,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0xB8,0x00,0x01,0x01,
+0x01,0x02,0x35,0x03,0x01,0x01,0xB4,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
+0x01,0x01,0x7A,0x00,0x03,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x01,0x01,0x70,0x00,0x02,0x01,0x03,0x02,0x08,0x03,0x03,0x02,0x03,0x01,0x2A,0x00,
+0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x02,0x02,0x15,0x03,
+0x02,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x66,0x00,
+0x01,0x01,0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x20,0x00,0x01,0x02,0x46,0x03,
+0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
+0x1C,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,
+0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
+0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x16,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x13,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x31,0x03,0x01,0x01,
+0x11,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,0x52,0x00,
+0x01,0x01,0x36,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x51,0x00,
+0x01,0x01,0x38,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,
+0x01,0x01,0x3A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x01,0x01,
+0x4D,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x4C,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x01,0x4B,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x05,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x03,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
+0x01,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
+0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x61,0x03,
+0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
+0x01,0x02,0x45,0x03,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,
+0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x61,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,
+0x01,0x02,0x45,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
+0x44,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
+0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
+0x44,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0xA6,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x01,0x02,0xA6,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0xA6,0x03,0x01,0x02,0x01,0x01,
+0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
+0x01,0x01,0x44,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,
+0x44,0x03,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,
+0x01,0x01,0x61,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x01,0x02,
+0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x01,0x00,0x01,0x02,
+0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x01,0x00,
+0x01,0x01,0x60,0x03,0x49,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x01,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x03,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x04,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,
+0x04,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,
+0x06,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x39,0x03,0x01,0x01,
+0x07,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x37,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x34,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x53,0x00,0x01,0x01,
+0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x55,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x10,0x00,
+0x01,0x01,0x55,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x28,0x03,0x01,0x02,0x01,0x01,
+0x13,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
+0x01,0x01,0x16,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,
+0x1F,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x64,0x00,
+0x01,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x69,0x00,0x01,0x01,0x03,0x02,0x0D,0x03,0x03,0x02,0x01,0x01,0x22,0x00,
+0x01,0x01,0x4B,0x03,0x01,0x02,0x6F,0x00,0x0B,0x01,0x28,0x00,0x01,0x01,0x01,0x02,
+0x48,0x03,0x01,0x01,0xA4,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
+0xA7,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0xAA,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,
+0x01,0x02,0x01,0x01,0xAD,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0xB1,0x00,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xB3,0x00,0x02,0x01,0x01,0x02,0x34,0x03,
+0x01,0x02,0x01,0x01,0xB8,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x02,0x01,
+0xBC,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0xC2,0x00,0x01,0x01,
+0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,0xC8,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,
+0x02,0x02,0x01,0x01,0xD1,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x03,0x01,
+0xDC,0x00,0x0C,0x01,0xB7,0x00,
 };
 static const DiffBlock LISTENING_FRAME10_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    31, 39,  // Changed box top-left
+    238, 97,  // Changed box dimensions
     LISTENING_FRAME10_DATA
 };
 
-// Frame 11: Full frame RLE (1930 bytes)
-static const uint8_t LISTENING_FRAME11_DATA[1930] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF6,0x00,
-0x03,0x01,0x0C,0x02,0x03,0x01,0xFF,0x00,0x29,0x00,0x03,0x01,0x02,0x02,0x14,0x03,
-0x03,0x02,0x02,0x01,0xFF,0x00,0x20,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x19,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x13,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x0E,0x00,0x01,0x01,0x02,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,
-0x3A,0x03,0x01,0x02,0x7D,0x00,0x02,0x01,0x83,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
-0x01,0x01,0x6F,0x00,0x03,0x01,0x02,0x02,0x0B,0x03,0x02,0x02,0x02,0x01,0x7B,0x00,
-0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,
-0x16,0x03,0x02,0x02,0x02,0x01,0x75,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,
-0x64,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,
-0x01,0x02,0x47,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x02,0x02,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x2C,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x58,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x50,0x03,
-0x01,0x02,0x56,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x52,0x03,
-0x01,0x02,0x54,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,
-0x54,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x3C,0x03,
-0x01,0x02,0x5A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x4B,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x01,0x01,0x49,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x55,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x55,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x54,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x53,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
-0x53,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x53,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x46,0x00,0x01,0x02,
-0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x43,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,
-0x01,0x02,0x53,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,
-0x01,0x01,0x53,0x00,0x01,0x01,0x60,0x03,0x49,0x00,0x01,0x02,0x40,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,
-0x3F,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,
-0x3E,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x02,0x3B,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4D,0x00,
-0x01,0x01,0x3A,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,
-0x4E,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x30,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x58,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x53,0x03,
-0x01,0x02,0x5C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x6A,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x62,0x00,0x02,0x01,0x02,0x02,
-0x19,0x03,0x02,0x02,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x03,0x02,0x01,0x01,0x73,0x00,0x01,0x01,
-0x4B,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x05,0x01,0x07,0x02,0x02,0x01,0x79,0x00,
-0x01,0x01,0x49,0x03,0x01,0x01,0xF6,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,
-0xF9,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0xFB,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x01,0xFF,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x02,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0F,0x00,0x01,0x01,0x01,0x02,
-0x2B,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x15,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x1A,0x00,0x01,0x01,0x03,0x02,0x1C,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x22,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x03,0x01,
-0xFF,0x00,0x2C,0x00,0x0F,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xCE,0x00,0x01,0x01,0x01,0x02,
+// Frame 11: Diff RLE (1282 bytes)
+static const uint8_t LISTENING_FRAME11_DATA[1282] = {
+0x28,0x00,0x03,0x01,0x0C,0x02,0x03,0x01,0xD5,0x00,0x03,0x01,0x02,0x02,0x14,0x03,
+0x03,0x02,0x02,0x01,0xCC,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x02,0x01,
+0xC5,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0xBF,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0xBA,0x00,0x01,0x01,0x02,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0xB5,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
+0xB2,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x7D,0x00,0x02,0x01,0x30,0x00,0x01,0x01,
+0x01,0x02,0x3D,0x03,0x01,0x01,0x6F,0x00,0x03,0x01,0x02,0x02,0x0B,0x03,0x02,0x02,
+0x02,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,
+0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0x22,0x00,0x01,0x01,0x44,0x03,
+0x01,0x02,0x01,0x01,0x64,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
+0x1E,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x02,0x02,
+0x22,0x03,0x02,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x5D,0x00,
+0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x5B,0x00,0x01,0x01,0x2C,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x01,0x12,0x00,
+0x01,0x02,0x50,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x10,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x38,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,
+0x3A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x4D,0x00,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,
+0x4B,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x04,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x41,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x43,0x03,
+0x01,0x01,0x01,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x5F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x44,0x03,
+0x01,0x02,0x01,0x01,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
+0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0xA6,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0xA6,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0xA6,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0xA6,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0xA6,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
+0xA6,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0xA6,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0xA5,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0xA6,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0xA6,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x01,0x02,0xA5,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0xA5,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0xA5,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x01,0x02,0xA5,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0xA5,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x01,0x02,0xA5,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
+0xA5,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0xA5,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
+0x01,0x02,0xA5,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0xA5,0x03,0x01,0x02,
+0x01,0x01,0x45,0x00,0x01,0x01,0xA5,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,
+0xA5,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x60,0x03,0x01,0x01,
+0x47,0x00,0x01,0x01,0x42,0x03,0x02,0x02,0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
+0x42,0x03,0x02,0x01,0x60,0x03,0x49,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x02,0x01,
+0x5F,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x02,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x03,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,
+0x06,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,
+0x37,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
+0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x53,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x30,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,
+0x56,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
+0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x5F,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x17,0x00,0x01,0x02,
+0x4F,0x03,0x01,0x02,0x62,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,
+0x1B,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x02,0x01,0x02,0x02,
+0x10,0x03,0x03,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x01,0x01,
+0x6C,0x00,0x05,0x01,0x07,0x02,0x02,0x01,0x26,0x00,0x01,0x01,0x49,0x03,0x01,0x01,
+0xA3,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,0xA6,0x00,0x01,0x02,0x43,0x03,
+0x01,0x02,0x01,0x01,0xA8,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0xAC,0x00,
+0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0xAE,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x01,0x02,0x01,0x01,0xB2,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
+0xB6,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0xBB,0x00,0x01,0x01,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xC1,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
+0x02,0x02,0x02,0x01,0xC6,0x00,0x01,0x01,0x03,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,
+0xCE,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x03,0x01,0xD8,0x00,0x0F,0x01,
+0xB5,0x00,
 };
 static const DiffBlock LISTENING_FRAME11_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    31, 38,  // Changed box top-left
+    237, 98,  // Changed box dimensions
     LISTENING_FRAME11_DATA
 };
 
-// Frame 12: Full frame RLE (1932 bytes)
-static const uint8_t LISTENING_FRAME12_DATA[1932] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF6,0x00,
-0x03,0x01,0x0C,0x02,0x03,0x01,0xFF,0x00,0x2A,0x00,0x02,0x01,0x02,0x02,0x15,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x20,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x18,0x00,0x02,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x14,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x0E,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,
-0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x78,0x00,0x08,0x01,0x81,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x6F,0x00,0x02,0x01,0x03,0x02,0x0C,0x03,0x01,0x02,0x03,0x01,0x7A,0x00,
-0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,
-0x17,0x03,0x02,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,
-0x64,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,0x70,0x00,0x01,0x01,
-0x01,0x02,0x47,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x58,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x50,0x03,
-0x01,0x02,0x56,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,
-0x52,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x60,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x39,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,
-0x01,0x02,0x3B,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x4D,0x00,
-0x01,0x01,0x3C,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x4B,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x01,0x49,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x55,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x55,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x54,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x53,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
-0x53,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x52,0x00,
-0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,
-0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x45,0x03,
-0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x46,0x00,
-0x01,0x02,0x45,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,
-0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0x50,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,
-0x01,0x01,0x51,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x43,0x03,
-0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x42,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x60,0x03,0x49,0x00,0x01,0x02,0x40,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x49,0x00,0x01,0x01,
-0x01,0x02,0x3F,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x4A,0x00,
-0x01,0x01,0x3E,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x38,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x30,0x03,
-0x01,0x01,0x61,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
-0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,
-0x01,0x02,0x02,0x01,0x6A,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x63,0x00,0x02,0x01,
-0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x66,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x02,0x01,0x73,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x05,0x01,0x06,0x02,0x02,0x01,
-0x79,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0xF6,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
-0xF8,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0xFB,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x01,0xFF,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x02,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x06,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,
-0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0F,0x00,0x01,0x01,
-0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x14,0x00,0x02,0x01,0x01,0x02,
-0x24,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x1A,0x00,0x02,0x01,0x03,0x02,0x1C,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x23,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x03,0x02,
-0x03,0x01,0xFF,0x00,0x2D,0x00,0x0E,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x01,0x01,0x01,0x02,
+// Frame 12: Diff RLE (1422 bytes)
+static const uint8_t LISTENING_FRAME12_DATA[1422] = {
+0x24,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0xCC,0x00,0x01,0x01,
+0x02,0x02,0x1F,0x03,0x01,0x02,0x02,0x01,0xC4,0x00,0x02,0x01,0x01,0x02,0x26,0x03,
+0x01,0x02,0x01,0x01,0xC0,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0xBA,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0xB6,0x00,0x01,0x02,
+0x36,0x03,0x01,0x02,0x01,0x01,0xB2,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,
+0x78,0x00,0x08,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x6F,0x00,
+0x02,0x01,0x03,0x02,0x0C,0x03,0x01,0x02,0x03,0x01,0x27,0x00,0x01,0x01,0x01,0x02,
+0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x17,0x03,0x02,0x02,
+0x01,0x01,0x22,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,
+0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,0x01,0x02,0x47,0x03,
+0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
+0x01,0x01,0x17,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x58,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x01,0x02,0x12,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x56,0x00,
+0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
+0x54,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x54,0x03,
+0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x56,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x3B,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x3C,0x03,
+0x01,0x02,0x07,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
+0x3D,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x4B,0x00,
+0x01,0x02,0x3F,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x49,0x00,
+0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x49,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x43,0x03,0x02,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x46,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x46,0x00,0x01,0x01,0x44,0x03,0x01,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,
+0x01,0x01,0x44,0x03,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
+0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
+0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,
+0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,
+0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,
+0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,
+0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x44,0x03,
+0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x61,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
+0x01,0x01,0x61,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,
+0x61,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,
+0x01,0x01,0x45,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,
+0x45,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
+0x01,0x01,0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,
+0x43,0x03,0x01,0x01,0x61,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x42,0x03,0x01,0x01,
+0x01,0x02,0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x00,0x01,0x02,
+0x60,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x42,0x03,0x01,0x00,0x01,0x01,0x60,0x03,
+0x49,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x49,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x4A,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x4B,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x05,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x06,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x38,0x03,0x01,0x01,0x08,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x32,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x30,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x56,0x00,
+0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
+0x59,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,
+0x53,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
+0x01,0x01,0x14,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,
+0x02,0x02,0x1F,0x03,0x01,0x02,0x02,0x01,0x17,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
+0x63,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,0x1B,0x00,0x01,0x02,
+0x4D,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,
+0x02,0x01,0x20,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x05,0x01,
+0x06,0x02,0x02,0x01,0x26,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0xA3,0x00,0x01,0x01,
+0x47,0x03,0x01,0x01,0xA5,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,
+0xA8,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0xAC,0x00,0x01,0x02,0x3D,0x03,
+0x01,0x02,0x01,0x01,0xAE,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0xB2,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xB6,0x00,0x01,0x01,
+0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0xBB,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
+0x01,0x02,0x01,0x01,0xC0,0x00,0x02,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,
+0xC6,0x00,0x02,0x01,0x03,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0xCF,0x00,0x02,0x01,
+0x02,0x02,0x10,0x03,0x03,0x02,0x03,0x01,0xD9,0x00,0x0E,0x01,0xB4,0x00,
 };
 static const DiffBlock LISTENING_FRAME12_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    30, 39,  // Changed box top-left
+    237, 97,  // Changed box dimensions
     LISTENING_FRAME12_DATA
 };
 
-// Frame 13: Full frame RLE (1230 bytes)
-static const uint8_t LISTENING_FRAME13_DATA[1230] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFA,0x00,
-0x16,0x01,0x17,0x02,0x01,0x01,0xE4,0x00,0x08,0x01,0x17,0x02,0x3E,0x03,0x01,0x02,
-0x02,0x01,0xDA,0x00,0x02,0x01,0x02,0x02,0x63,0x03,0x01,0x02,0x02,0x01,0xD3,0x00,
-0x01,0x01,0x01,0x02,0x6A,0x03,0x02,0x02,0x01,0x01,0x7F,0x00,0x1A,0x01,0x35,0x00,
-0x01,0x01,0x01,0x02,0x70,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x02,0x00,0x21,0x01,
-0x13,0x02,0x20,0x03,0x02,0x02,0x02,0x01,0x2F,0x00,0x01,0x01,0x73,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x02,0x01,0x02,0x02,0x5C,0x03,0x02,0x02,0x01,0x01,0x2A,0x00,
-0x01,0x01,0x01,0x02,0x76,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x02,0x02,
-0x64,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x02,0x79,0x03,0x01,0x02,0x01,0x01,
-0x31,0x00,0x01,0x01,0x02,0x02,0x69,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,
-0x01,0x02,0x7B,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x6E,0x03,0x01,0x02,
-0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x7D,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,
-0x01,0x01,0x72,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x80,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x01,0x01,0x02,0x74,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x81,0x03,
-0x01,0x01,0x28,0x00,0x01,0x01,0x77,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x83,0x03,
-0x01,0x01,0x26,0x00,0x01,0x01,0x79,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x84,0x03,
-0x01,0x02,0x25,0x00,0x01,0x01,0x7B,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,
-0x85,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x7C,0x03,0x01,0x02,0x01,0x01,0x16,0x00,
-0x01,0x02,0x86,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x7D,0x03,0x01,0x02,0x16,0x00,
-0x01,0x02,0x86,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x7F,0x03,0x01,0x01,0x14,0x00,
-0x01,0x01,0x87,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x80,0x03,0x01,0x01,
-0x14,0x00,0x01,0x02,0x87,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x02,0x80,0x03,
-0x01,0x01,0x14,0x00,0x01,0x02,0x88,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,
-0x80,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x88,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x81,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x88,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x81,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x02,0x88,0x03,0x01,0x01,0x1F,0x00,
-0x01,0x01,0x81,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x02,0x88,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x81,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x02,0x87,0x03,
-0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x81,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
-0x87,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x81,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
-0x01,0x02,0x85,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x81,0x03,0x01,0x01,
-0x15,0x00,0x01,0x02,0x85,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x01,0x02,0x7F,0x03,
-0x01,0x02,0x16,0x00,0x01,0x01,0x84,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,
-0x7F,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x83,0x03,0x01,0x01,0x23,0x00,0x01,0x01,
-0x7E,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x82,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
-0x7C,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x80,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x01,0x02,0x7A,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x02,0x7E,0x03,
-0x01,0x02,0x28,0x00,0x01,0x01,0x7A,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x7C,0x03,
-0x01,0x02,0x2A,0x00,0x01,0x01,0x78,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x7A,0x03,
-0x01,0x02,0x2C,0x00,0x01,0x01,0x75,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
-0x01,0x02,0x75,0x03,0x02,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x72,0x03,
-0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x72,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
-0x01,0x01,0x01,0x02,0x6F,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,0x6F,0x03,
-0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x6C,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x01,0x02,0x6A,0x03,0x02,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x03,0x02,
-0x02,0x01,0x3E,0x00,0x01,0x01,0x02,0x02,0x5E,0x03,0x02,0x02,0x02,0x01,0x36,0x00,
-0x01,0x01,0x02,0x02,0x51,0x03,0x01,0x02,0x02,0x03,0x08,0x02,0x03,0x01,0x46,0x00,
-0x02,0x01,0x01,0x02,0x35,0x03,0x15,0x02,0x04,0x01,0x4A,0x00,0x02,0x01,0x2A,0x02,
-0x02,0x01,0x01,0x02,0x01,0x01,0x01,0x02,0x17,0x01,0x64,0x00,0x25,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x81,0x00,0x01,0x01,0x01,0x02,
+// Frame 13: Diff RLE (888 bytes)
+static const uint8_t LISTENING_FRAME13_DATA[888] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x33,0x00,0x16,0x01,0x17,0x02,
+0x01,0x01,0xC5,0x00,0x08,0x01,0x17,0x02,0x3E,0x03,0x01,0x02,0x02,0x01,0xBB,0x00,
+0x02,0x01,0x02,0x02,0x63,0x03,0x01,0x02,0x02,0x01,0xB4,0x00,0x01,0x01,0x01,0x02,
+0x6A,0x03,0x02,0x02,0x01,0x01,0x60,0x00,0x1A,0x01,0x35,0x00,0x01,0x01,0x01,0x02,
+0x70,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x02,0x00,0x21,0x01,0x13,0x02,0x20,0x03,
+0x02,0x02,0x02,0x01,0x2F,0x00,0x01,0x01,0x73,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,
+0x02,0x01,0x02,0x02,0x5C,0x03,0x02,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,
+0x76,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x02,0x02,0x64,0x03,0x01,0x02,
+0x01,0x01,0x27,0x00,0x01,0x02,0x79,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,
+0x02,0x02,0x69,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x01,0x02,0x7B,0x03,
+0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x6E,0x03,0x01,0x02,0x01,0x01,0x20,0x00,
+0x01,0x01,0x01,0x02,0x7D,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x72,0x03,
+0x01,0x01,0x1E,0x00,0x01,0x01,0x80,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x74,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x81,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x77,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x83,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x79,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x84,0x03,0x01,0x02,0x06,0x00,
+0x01,0x01,0x7B,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x85,0x03,0x01,0x01,
+0x04,0x00,0x01,0x01,0x7C,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x02,0x86,0x03,
+0x01,0x01,0x04,0x00,0x01,0x02,0x7D,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x86,0x03,
+0x01,0x02,0x03,0x00,0x01,0x02,0x7F,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x87,0x03,
+0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x80,0x03,0x01,0x01,0x14,0x00,0x01,0x02,
+0x87,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x02,0x80,0x03,0x01,0x01,0x14,0x00,
+0x01,0x02,0x88,0x03,0x02,0x01,0x01,0x02,0x80,0x03,0x01,0x02,0x14,0x00,0x01,0x02,
+0x88,0x03,0x02,0x01,0x81,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x88,0x03,0x02,0x01,
+0x81,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x02,0x88,0x03,0x02,0x01,0x81,0x03,
+0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x02,0x88,0x03,0x02,0x01,0x81,0x03,0x01,0x02,
+0x01,0x01,0x13,0x00,0x01,0x02,0x87,0x03,0x01,0x02,0x02,0x01,0x81,0x03,0x01,0x02,
+0x14,0x00,0x01,0x01,0x87,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x81,0x03,0x01,0x02,
+0x14,0x00,0x01,0x01,0x01,0x02,0x85,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,
+0x81,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x85,0x03,0x01,0x02,0x02,0x00,0x01,0x01,
+0x01,0x02,0x7F,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x84,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x01,0x01,0x7F,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x83,0x03,0x01,0x01,
+0x04,0x00,0x01,0x01,0x7E,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x82,0x03,0x01,0x02,
+0x06,0x00,0x01,0x02,0x7C,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x80,0x03,
+0x01,0x02,0x07,0x00,0x01,0x01,0x01,0x02,0x7A,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
+0x01,0x02,0x7E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x7A,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x7C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x78,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x7A,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x75,0x03,0x01,0x02,0x01,0x01,
+0x21,0x00,0x01,0x01,0x01,0x02,0x75,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x01,0x02,0x72,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x72,0x03,0x01,0x02,
+0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x6F,0x03,0x01,0x02,0x28,0x00,0x01,0x01,
+0x01,0x02,0x6F,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x6C,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x6A,0x03,0x02,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,
+0x62,0x03,0x03,0x02,0x02,0x01,0x1F,0x00,0x01,0x01,0x02,0x02,0x5E,0x03,0x02,0x02,
+0x02,0x01,0x36,0x00,0x01,0x01,0x02,0x02,0x51,0x03,0x01,0x02,0x02,0x03,0x08,0x02,
+0x03,0x01,0x27,0x00,0x02,0x01,0x01,0x02,0x35,0x03,0x15,0x02,0x04,0x01,0x4A,0x00,
+0x02,0x01,0x2A,0x02,0x02,0x01,0x01,0x02,0x01,0x01,0x01,0x02,0x17,0x01,0x45,0x00,
+0x25,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE5,0x00,
 };
 static const DiffBlock LISTENING_FRAME13_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    14, 38,  // Changed box top-left
+    289, 98,  // Changed box dimensions
     LISTENING_FRAME13_DATA
 };
 
-// Frame 14: Full frame RLE (2054 bytes)
-static const uint8_t LISTENING_FRAME14_DATA[2054] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x50,0x00,
-0x0F,0x01,0xFF,0x00,0x2C,0x00,0x03,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x02,0x01,
-0xFF,0x00,0x22,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x8A,0x00,
-0x03,0x01,0x03,0x02,0x0A,0x03,0x03,0x02,0x03,0x01,0x79,0x00,0x02,0x01,0x01,0x02,
-0x25,0x03,0x01,0x02,0x01,0x01,0x82,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,
-0x02,0x01,0x71,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,
-0x30,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x72,0x00,0x02,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,
-0x36,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,
-0x43,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x54,0x00,0x01,0x02,
-0x46,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x57,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x55,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,
-0x53,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x43,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,
-0x56,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x44,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,
-0x43,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x01,0x02,0x61,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
+// Frame 14: Diff RLE (1744 bytes)
+static const uint8_t LISTENING_FRAME14_DATA[1744] = {
+0xD3,0x00,0x0F,0x01,0xFF,0x00,0x0D,0x00,0x03,0x01,0x02,0x02,0x11,0x03,0x03,0x02,
+0x02,0x01,0xFF,0x00,0x03,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,
+0x6B,0x00,0x03,0x01,0x03,0x02,0x0A,0x03,0x03,0x02,0x03,0x01,0x79,0x00,0x02,0x01,
+0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x02,0x01,0x02,0x02,0x18,0x03,
+0x02,0x02,0x02,0x01,0x71,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
+0x5D,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,
+0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x53,0x00,
+0x02,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
+0x39,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,
+0x5E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
+0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x02,0x40,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x57,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x54,0x00,
+0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x41,0x03,
+0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,
+0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,
+0x50,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x36,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
+0x01,0x02,0x53,0x03,0x01,0x01,0x34,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x45,0x00,
+0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
+0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x02,0x54,0x03,
+0x01,0x01,0x41,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,
+0x55,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x2D,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x3C,0x00,
+0x01,0x02,0x5D,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x3A,0x00,
+0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x3A,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,
+0x25,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x61,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,
+0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
+0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x61,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x36,0x00,
+0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x61,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x24,0x00,
 0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,
-0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x01,0x02,0x60,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,0x60,0x03,
-0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x60,0x03,0x3A,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x01,0x02,0x5C,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x49,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
-0x56,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x42,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
-0x44,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x01,0x55,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x43,0x03,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,
-0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,
-0x5A,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x33,0x03,
-0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x63,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x74,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x6C,0x00,0x01,0x01,0x02,0x02,
-0x23,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,
-0x01,0x01,0x71,0x00,0x02,0x01,0x03,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x7F,0x00,
-0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x02,0x01,0x79,0x00,0x02,0x01,0x03,0x02,
-0x0D,0x03,0x04,0x02,0x02,0x01,0x86,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x02,0x01,0x84,0x00,0x09,0x01,0x92,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x03,0x02,
-0x02,0x01,0xFF,0x00,0x29,0x00,0x05,0x01,0x0B,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x50,0x00,0x01,0x01,0x01,0x02,
+0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
+0x01,0x02,0x61,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x37,0x00,
+0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x37,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,
+0x60,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x60,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
+0x60,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x02,0x26,0x00,
+0x01,0x01,0x60,0x03,0x3A,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x28,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x28,0x00,
+0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x2C,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x41,0x00,
+0x01,0x01,0x56,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x56,0x03,
+0x01,0x02,0x44,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,
+0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x32,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,
+0x01,0x01,0x34,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,
+0x4D,0x03,0x01,0x01,0x36,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
+0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,
+0x3D,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x43,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,
+0x3F,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x58,0x00,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x41,0x03,0x01,0x02,
+0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x63,0x00,
+0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,
+0x36,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,
+0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x6C,0x00,0x01,0x01,
+0x02,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
+0x01,0x02,0x01,0x01,0x71,0x00,0x02,0x01,0x03,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,
+0x60,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x02,0x01,0x79,0x00,0x02,0x01,
+0x03,0x02,0x0D,0x03,0x04,0x02,0x02,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x20,0x03,
+0x01,0x02,0x02,0x01,0x84,0x00,0x09,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x14,0x03,
+0x03,0x02,0x02,0x01,0xFF,0x00,0x0A,0x00,0x05,0x01,0x0B,0x02,0x02,0x01,0xD7,0x00,
+
 };
 static const DiffBlock LISTENING_FRAME14_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    14, 37,  // Changed box top-left
+    289, 97,  // Changed box dimensions
     LISTENING_FRAME14_DATA
 };
 
-// Frame 15: Full frame RLE (2190 bytes)
-static const uint8_t LISTENING_FRAME15_DATA[2190] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x07,0x00,0x03,0x01,0x04,0x02,0x08,0x03,0x02,0x02,0x01,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x26,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0x93,0x00,0x0A,0x01,0x80,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
-0x87,0x00,0x03,0x01,0x02,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x01,0x01,
-0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x81,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,
-0x02,0x02,0x02,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x7C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x73,0x00,
-0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x5C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x68,0x00,
-0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x41,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x01,0x44,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,
-0x54,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x42,0x03,0x01,0x02,
-0x52,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x50,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x46,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,0x57,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x56,0x00,0x01,0x01,
-0x4D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x55,0x00,
-0x01,0x02,0x4E,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,
-0x54,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
-0x52,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
-0x50,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x4F,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,
-0x57,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,
-0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
+// Frame 15: Diff RLE (1900 bytes)
+static const uint8_t LISTENING_FRAME15_DATA[1900] = {
+0xC0,0x00,0x03,0x01,0x04,0x02,0x08,0x03,0x02,0x02,0x01,0x03,0x02,0x02,0x02,0x01,
+0xE3,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x51,0x00,0x0A,0x01,
+0x80,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x45,0x00,0x03,0x01,
+0x02,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,
+0x70,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
+0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,
+0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
+0x01,0x01,0x2D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x5C,0x00,
+0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x38,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,
+0x24,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x44,0x03,
+0x01,0x02,0x21,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0x54,0x00,0x01,0x02,
+0x46,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x50,0x00,
+0x01,0x02,0x4A,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x4E,0x00,
+0x01,0x02,0x4C,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x4C,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x4A,0x00,
+0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,
+0x49,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x12,0x00,0x01,0x02,
+0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x10,0x00,0x01,0x02,
+0x52,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,
+0x53,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0E,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0D,0x00,
+0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x0A,0x00,
 0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,
+0x0A,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
 0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,
-0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,
-0x56,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
-0x56,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
-0x55,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x4F,0x00,
-0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x50,0x00,
-0x01,0x01,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x51,0x03,
-0x01,0x01,0x52,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x53,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,
-0x49,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,
-0x47,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,
-0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x59,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x02,0x5C,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
-0x01,0x01,0x6A,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,
-0x31,0x03,0x02,0x02,0x6D,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,
-0x01,0x02,0x34,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,
-0x01,0x01,0x02,0x02,0x21,0x03,0x02,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,
-0x2A,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,
-0x02,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,
-0x03,0x01,0x02,0x02,0x0E,0x03,0x04,0x02,0x02,0x01,0x87,0x00,0x01,0x01,0x02,0x02,
-0x1E,0x03,0x01,0x02,0x01,0x01,0x84,0x00,0x0A,0x01,0x93,0x00,0x01,0x01,0x02,0x02,
-0x15,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x29,0x00,0x05,0x01,0x0A,0x02,0x03,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
+0x01,0x02,0x57,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x41,0x00,
+0x01,0x02,0x57,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x41,0x00,
+0x01,0x02,0x57,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
+0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x43,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
+0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x54,0x03,
+0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x53,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x10,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x11,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
+0x01,0x01,0x12,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x4E,0x00,
+0x01,0x01,0x49,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x01,0x01,
+0x4F,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
+0x52,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
+0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x45,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
+0x1F,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x5C,0x00,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x28,0x00,
+0x01,0x01,0x3B,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
+0x2B,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,
+0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
+0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x33,0x00,
+0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x02,0x02,
+0x21,0x03,0x02,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x02,0x02,
+0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x3E,0x00,
+0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x03,0x01,0x02,0x02,
+0x0E,0x03,0x04,0x02,0x02,0x01,0x45,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,
+0x01,0x01,0x84,0x00,0x0A,0x01,0x51,0x00,0x01,0x01,0x02,0x02,0x15,0x03,0x02,0x02,
+0x02,0x01,0xE6,0x00,0x05,0x01,0x0A,0x02,0x03,0x01,0xC4,0x00,
 };
 static const DiffBlock LISTENING_FRAME15_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    30, 32,  // Changed box top-left
+    254, 107,  // Changed box dimensions
     LISTENING_FRAME15_DATA
 };
 
-// Frame 16: Full frame RLE (2188 bytes)
-static const uint8_t LISTENING_FRAME16_DATA[2188] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x07,0x00,0x03,0x01,0x04,0x02,0x08,0x03,0x02,0x02,0x01,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x26,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0x93,0x00,0x0A,0x01,0x80,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
-0x87,0x00,0x03,0x01,0x02,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x01,0x01,
-0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x81,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,
-0x02,0x02,0x02,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x7C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x73,0x00,
-0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x5C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x68,0x00,
-0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x41,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x01,0x44,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,
-0x54,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x42,0x03,0x01,0x02,
-0x52,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x50,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x46,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,0x57,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x56,0x00,0x01,0x01,
-0x4D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x55,0x00,
-0x01,0x02,0x4E,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,
-0x54,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
-0x52,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
-0x50,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x4F,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,
-0x57,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,
-0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,
-0x01,0x02,0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x4E,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x4E,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x4F,0x00,
-0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x50,0x00,
-0x01,0x01,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
-0x52,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
-0x53,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,
-0x4E,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,
-0x50,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
-0x52,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,
-0x01,0x01,0x3B,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
-0x6D,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x33,0x03,
-0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,
-0x75,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,
-0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
-0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,
-0x80,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x03,0x01,
-0x02,0x02,0x0E,0x03,0x04,0x02,0x02,0x01,0x87,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,
-0x02,0x02,0x01,0x01,0x84,0x00,0x0A,0x01,0x93,0x00,0x01,0x01,0x02,0x02,0x15,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x2A,0x00,0x05,0x01,0x0A,0x02,0x03,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0A,0x00,0x01,0x01,0x01,0x02,
+// Frame 16: Diff RLE (424 bytes)
+static const uint8_t LISTENING_FRAME16_DATA[424] = {
+0x1F,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,
+0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,
+0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,
+0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
+0x01,0x01,0x41,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x42,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x01,0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x47,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x54,0x03,
+0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x4E,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x52,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x47,0x03,
+0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
+0x01,0x02,0x42,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
+0x5E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,
+0x38,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
+0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,
+0x01,0x01,0x02,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,
+0x1B,0x03,0x01,0x02,0x02,0x01,0x01,0x00,0x05,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,
+0x03,0x01,0x02,0x02,0x0E,0x03,0x04,0x02,0x02,0x01,0x05,0x00,0x01,0x03,0x02,0x02,
+0x01,0x01,0x84,0x00,0x0A,0x01,0xAC,0x00,
 };
 static const DiffBlock LISTENING_FRAME16_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    93, 92,  // Changed box top-left
+    159, 46,  // Changed box dimensions
     LISTENING_FRAME16_DATA
 };
 
-// Frame 17: Full frame RLE (2184 bytes)
-static const uint8_t LISTENING_FRAME17_DATA[2184] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x07,0x00,0x03,0x01,0x04,0x02,0x09,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,
-0x27,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x93,0x00,0x0A,0x01,
-0x80,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x87,0x00,0x03,0x01,
-0x02,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
-0x01,0x02,0x01,0x01,0x81,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,
-0x70,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x7C,0x00,0x01,0x01,
-0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
-0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
-0x01,0x01,0x6F,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,
-0x66,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x44,0x03,
-0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0x54,0x00,0x01,0x02,
-0x46,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x48,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x50,0x00,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x4E,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,
-0x49,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4E,0x03,
-0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x54,0x00,0x01,0x02,
-0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x52,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x50,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x50,0x00,
-0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,
-0x4E,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,
-0x57,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x56,0x03,
-0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x43,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x56,0x03,
-0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x56,0x03,
-0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x54,0x03,
-0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x53,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x4D,0x03,
-0x01,0x01,0x56,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x4B,0x03,
-0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
-0x49,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x50,0x00,0x01,0x01,
-0x47,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x52,0x00,0x01,0x01,
-0x45,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
-0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x64,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x39,0x03,
-0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x6D,0x00,0x01,0x01,
-0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
-0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
-0x69,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x02,0x02,0x22,0x03,
-0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x02,0x01,
-0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x80,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x03,0x01,0x03,0x02,0x0D,0x03,
-0x04,0x02,0x02,0x01,0x87,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,
-0x84,0x00,0x0A,0x01,0x93,0x00,0x01,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x2A,0x00,0x05,0x01,0x0A,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x0B,0x00,0x01,0x01,0x01,0x02,
+// Frame 17: Diff RLE (978 bytes)
+static const uint8_t LISTENING_FRAME17_DATA[978] = {
+0x87,0x00,0x03,0x01,0x04,0x02,0x09,0x03,0x03,0x02,0x01,0x01,0x83,0x00,0x01,0x01,
+0x02,0x02,0x15,0x03,0x7F,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x03,0x02,0x02,0x01,
+0x78,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x02,0x01,0x70,0x00,0x01,0x01,
+0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
+0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
+0x62,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,
+0x3B,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
+0x59,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
+0x44,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x4E,0x00,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,
+0x01,0x02,0x4F,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,
+0x47,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x55,0x03,
+0x01,0x02,0x43,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,
+0x57,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
+0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x59,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
+0x59,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x59,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x41,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x42,0x00,
+0x01,0x01,0x57,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,
+0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x45,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x49,0x00,
+0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x4C,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x50,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x56,0x00,
+0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
+0x01,0x02,0x5C,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,
+0x01,0x02,0x38,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
+0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x69,0x00,
+0x01,0x01,0x02,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x02,0x02,
+0x25,0x03,0x01,0x02,0x02,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
+0x01,0x01,0x7A,0x00,0x03,0x01,0x03,0x02,0x0D,0x03,0x01,0x02,0x07,0x03,0x02,0x02,
+0x01,0x01,0x84,0x00,0x0A,0x01,0x03,0x00,0x03,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
+0x31,0x00,
 };
 static const DiffBlock LISTENING_FRAME17_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    87, 32,  // Changed box top-left
+    155, 107,  // Changed box dimensions
     LISTENING_FRAME17_DATA
 };
 
-// Frame 18: Full frame RLE (2222 bytes)
-static const uint8_t LISTENING_FRAME18_DATA[2222] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x09,0x00,0x03,0x01,0x04,0x02,0x09,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,
-0x26,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x1E,0x00,
-0x02,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x8F,0x00,0x0B,0x01,0x7D,0x00,
-0x02,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x86,0x00,0x02,0x01,0x02,0x02,
-0x0E,0x03,0x03,0x02,0x02,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x01,
-0x80,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x01,0x02,0x21,0x03,
-0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x76,0x00,
-0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x02,0x02,0x5E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x42,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x58,0x00,
-0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x49,0x03,0x01,0x01,
-0x60,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
-0x4B,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,
-0x49,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x01,0x48,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x54,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x50,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x52,0x00,
-0x01,0x02,0x50,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x57,0x03,
-0x01,0x01,0x50,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x57,0x03,
-0x01,0x01,0x50,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,
-0x57,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,
-0x01,0x02,0x57,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,
-0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,
+// Frame 18: Diff RLE (1932 bytes)
+static const uint8_t LISTENING_FRAME18_DATA[1932] = {
+0xBE,0x00,0x03,0x01,0x04,0x02,0x09,0x03,0x04,0x02,0x03,0x01,0xDD,0x00,0x01,0x01,
+0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0xD5,0x00,0x02,0x01,0x01,0x02,0x21,0x03,
+0x01,0x02,0x01,0x01,0x47,0x00,0x0B,0x01,0x7D,0x00,0x02,0x01,0x01,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x3E,0x00,0x02,0x01,0x02,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,
+0x75,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x02,0x02,
+0x19,0x03,0x02,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
+0x01,0x01,0x31,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,
+0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,
+0x29,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x02,0x02,
+0x5E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,
+0x34,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x20,0x00,
+0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x44,0x03,0x01,0x02,
+0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x56,0x00,0x01,0x01,
+0x46,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x53,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x40,0x03,
+0x01,0x02,0x52,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x42,0x03,
+0x01,0x02,0x50,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x02,
+0x44,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x01,0x11,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x51,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,
+0x51,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
+0x53,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
+0x01,0x02,0x53,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x46,0x00,
+0x01,0x02,0x55,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x44,0x00,
+0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
+0x44,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
+0x51,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
+0x52,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
+0x52,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x07,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,
+0x07,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x58,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x06,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x06,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,
+0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,
+0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,
+0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,
+0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x05,0x00,
 0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,
-0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,
-0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,
-0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
-0x40,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,
-0x42,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x54,0x03,
-0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,
-0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x01,0x01,0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,
-0x42,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,
-0x42,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x54,0x03,0x01,0x02,
-0x01,0x01,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,
-0x53,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x50,0x00,
-0x01,0x01,0x52,0x03,0x01,0x02,0x46,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x51,0x00,
-0x01,0x02,0x51,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
-0x52,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x50,0x03,
-0x01,0x02,0x54,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x4E,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,
-0x46,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x53,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x44,0x03,0x01,0x01,
-0x56,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x41,0x03,
-0x01,0x01,0x58,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x67,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x39,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x61,0x00,
-0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x02,0x36,0x03,0x01,0x01,
-0x64,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,
-0x32,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0x74,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,
-0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,0x01,0x02,
-0x29,0x03,0x01,0x02,0x02,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,
-0x01,0x01,0x7E,0x00,0x01,0x01,0x02,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x77,0x00,
-0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x84,0x00,0x02,0x01,0x01,0x02,
-0x1C,0x03,0x01,0x02,0x02,0x01,0x7E,0x00,0x03,0x01,0x02,0x02,0x0D,0x03,0x04,0x02,
-0x03,0x01,0x8B,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x89,0x00,
-0x09,0x01,0x99,0x00,0x05,0x01,0x03,0x02,0x03,0x01,0x02,0x02,0x03,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x49,0x00,0x01,0x01,0x01,0x02,
+0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,
+0x41,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,
+0x54,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x05,0x00,
+0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x41,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,
+0x01,0x02,0x42,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,
+0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
+0x04,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,
+0x01,0x01,0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,
+0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x01,0x01,0x05,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
+0x41,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
+0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x54,0x03,
+0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x05,0x00,0x01,0x02,
+0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x05,0x00,
+0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x01,0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,
+0x57,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x44,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x44,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x44,0x00,
+0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
+0x46,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x51,0x03,0x01,0x01,
+0x46,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x51,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x50,0x03,
+0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x0D,0x00,
+0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,
+0x10,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,
+0x4A,0x03,0x01,0x02,0x12,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
+0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x01,0x02,0x46,0x03,
+0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
+0x14,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x42,0x03,
+0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
+0x3F,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
+0x5A,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x3C,0x03,
+0x01,0x02,0x5E,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
+0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x02,0x35,0x03,0x01,0x02,
+0x01,0x01,0x25,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,
+0x68,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,
+0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x02,0x01,
+0x71,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
+0x02,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,
+0x02,0x02,0x01,0x01,0x3C,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,
+0x7E,0x00,0x03,0x01,0x02,0x02,0x0D,0x03,0x04,0x02,0x03,0x01,0x43,0x00,0x02,0x01,
+0x02,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x89,0x00,0x09,0x01,0x51,0x00,0x05,0x01,
+0x03,0x02,0x03,0x01,0x02,0x02,0x03,0x01,0xFF,0x00,0xB9,0x00,
 };
 static const DiffBlock LISTENING_FRAME18_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    34, 32,  // Changed box top-left
+    248, 107,  // Changed box dimensions
     LISTENING_FRAME18_DATA
 };
 
-// Frame 19: Full frame RLE (2080 bytes)
-static const uint8_t LISTENING_FRAME19_DATA[2080] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xDF,0x00,
-0x02,0x01,0xFF,0x00,0x32,0x00,0x04,0x01,0x04,0x02,0x0A,0x03,0x04,0x02,0x03,0x01,
-0xFF,0x00,0x25,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x1D,0x00,0x02,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,
-0x02,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x12,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,
-0x32,0x03,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x07,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x03,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x04,0x01,0x08,0x02,
-0x03,0x01,0x71,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,
+// Frame 19: Diff RLE (1770 bytes)
+static const uint8_t LISTENING_FRAME19_DATA[1770] = {
+0xD2,0x00,0x02,0x01,0xF2,0x00,0x04,0x01,0x04,0x02,0x0A,0x03,0x04,0x02,0x03,0x01,
+0xE5,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xDD,0x00,0x02,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0xD7,0x00,0x02,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x01,0x01,0xD2,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,
+0xCE,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0xCA,0x00,0x01,0x01,0x01,0x02,
+0x35,0x03,0x01,0x02,0x01,0x01,0xC7,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0xC3,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x04,0x01,0x08,0x02,
+0x03,0x01,0x71,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,
 0x02,0x02,0x11,0x03,0x02,0x02,0x02,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x01,0x76,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x63,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x01,0x02,
+0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
+0x01,0x02,0x44,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
+0x01,0x01,0x63,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x01,0x02,
 0x24,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x29,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x69,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x58,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x33,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x35,0x03,
-0x01,0x02,0x55,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x61,0x00,0x01,0x02,0x37,0x03,
-0x01,0x02,0x53,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x39,0x03,
-0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,
-0x3B,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x3D,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x5C,0x00,
+0x2C,0x00,0x01,0x01,0x29,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x4A,0x03,
+0x01,0x02,0x2A,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x58,0x00,
+0x01,0x01,0x4D,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x33,0x03,0x01,0x01,
+0x56,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x35,0x03,
+0x01,0x02,0x55,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x37,0x03,
+0x01,0x02,0x53,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x39,0x03,
+0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,
+0x3B,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x3D,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x1D,0x00,
 0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x01,0x01,0x5A,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x56,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x43,0x03,0x4B,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x57,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x57,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
+0x56,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,
+0x57,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x43,0x03,0x4B,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x18,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x18,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x15,0x00,
 0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x15,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x15,0x00,
 0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
+0x01,0x01,0x15,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
+0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x15,0x00,
 0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x57,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x58,0x00,0x01,0x02,
-0x42,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
-0x41,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,
-0x40,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x3F,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,
+0x15,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x15,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x15,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
+0x01,0x01,0x15,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
+0x01,0x02,0x57,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x4B,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,
+0x4B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,
+0x42,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
+0x42,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x19,0x00,0x01,0x01,
+0x41,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
+0x40,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x3F,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,
 0x3D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
-0x4B,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x37,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
-0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
-0x01,0x01,0x5A,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,
+0x1E,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x21,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x37,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
+0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
+0x01,0x01,0x5A,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,
 0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
-0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,
-0x28,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x71,0x00,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
+0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,
+0x28,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x32,0x00,
 0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x74,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,
-0x01,0x01,0x39,0x03,0x01,0x01,0x79,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,
-0x02,0x01,0x70,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x7E,0x00,0x02,0x01,0x02,0x02,
+0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,
+0x01,0x01,0x39,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,
+0x02,0x01,0x70,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x3F,0x00,0x02,0x01,0x02,0x02,
 0x0F,0x03,0x02,0x02,0x02,0x01,0x76,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
-0x84,0x00,0x05,0x01,0x02,0x02,0x05,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x19,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x1F,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x27,0x00,0x03,0x01,0x05,0x02,0x03,0x03,0x07,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x22,0x00,0x01,0x01,0x01,0x02,
-
+0x45,0x00,0x05,0x01,0x02,0x02,0x05,0x01,0x7E,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0xD3,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,
+0xD9,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0xDF,0x00,0x02,0x01,
+0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xE7,0x00,0x03,0x01,0x05,0x02,0x03,0x03,
+0x07,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0x28,0x00,
 };
 static const DiffBlock LISTENING_FRAME19_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    38, 31,  // Changed box top-left
+    257, 107,  // Changed box dimensions
     LISTENING_FRAME19_DATA
 };
 
-// Frame 20: Full frame RLE (2090 bytes)
-static const uint8_t LISTENING_FRAME20_DATA[2090] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xDA,0x00,
-0x0A,0x01,0xFF,0x00,0x30,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x03,0x02,0x03,0x01,
-0xFF,0x00,0x24,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x1D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,
-0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x12,0x00,0x01,0x01,
-0x01,0x02,0x2E,0x03,0x01,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,
-0xFF,0x00,0x07,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x03,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x03,0x01,0x09,0x02,0x03,0x01,
-0x71,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x01,0x02,
+// Frame 20: Diff RLE (1688 bytes)
+static const uint8_t LISTENING_FRAME20_DATA[1688] = {
+0xB8,0x00,0x0A,0x01,0xDB,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x03,0x02,0x03,0x01,
+0xCF,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xC8,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0xC2,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
+0x01,0x02,0x01,0x01,0xBD,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0xB9,0x00,
+0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0xB4,0x00,0x01,0x01,0x01,0x02,
+0x36,0x03,0x01,0x01,0xB2,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xAE,0x00,
+0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x03,0x01,0x09,0x02,0x03,0x01,
+0x71,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x02,0x01,0x01,0x02,
 0x12,0x03,0x02,0x02,0x02,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,
-0x75,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,
+0x21,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
+0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,
 0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x69,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
+0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
+0x5D,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,
+0x5B,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
+0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,
 0x01,0x01,0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,
-0x62,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x50,0x03,
-0x01,0x02,0x61,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x51,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x50,0x00,
-0x01,0x02,0x54,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x5A,0x00,0x01,0x02,0x3F,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x41,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x59,0x00,0x01,0x02,
-0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x57,0x00,0x01,0x01,
-0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x57,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x56,0x00,0x01,0x01,
-0x44,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x56,0x00,0x01,0x01,
-0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x56,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x56,0x00,
-0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x56,0x00,
-0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x56,0x00,
-0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x56,0x00,
+0x0E,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x50,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
+0x52,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x51,0x00,0x01,0x01,
+0x53,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x50,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x4E,0x00,
+0x01,0x01,0x55,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x3F,0x03,
+0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x41,0x03,
+0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x05,0x00,0x01,0x02,
+0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
+0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x03,0x00,0x01,0x02,
+0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
+0x44,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
+0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
+0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x02,0x00,0x01,0x01,
+0x45,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x02,0x00,
+0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x02,0x00,
+0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x02,0x00,
+0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x02,0x00,
 0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x49,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x02,
-0x44,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x56,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x56,0x00,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x58,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x58,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
-0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x51,0x00,0x01,0x02,
-0x51,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,
-0x01,0x01,0x51,0x03,0x01,0x01,0x5D,0x00,0x3C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
-0x01,0x02,0x4F,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x55,0x00,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x56,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x37,0x03,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
-0x01,0x01,0x35,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x02,0x2F,0x03,
-0x01,0x02,0x5F,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,
-0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x02,0x41,0x03,
-0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x70,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,
-0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x39,0x03,0x01,0x02,
-0x78,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,0x70,0x00,0x01,0x02,
-0x35,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,
-0x02,0x01,0x76,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x84,0x00,0x05,0x01,
-0x02,0x02,0x05,0x01,0x7E,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x13,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x18,0x00,
-0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x1E,0x00,0x02,0x01,
-0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x27,0x00,0x03,0x01,0x05,0x02,
-0x03,0x03,0x08,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x21,0x00,0x01,0x01,0x01,0x02,
+0x01,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x02,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,
+0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x02,0x01,
+0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x02,0x01,0x47,0x03,
+0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x59,0x03,0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x59,0x03,0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
+0x59,0x03,0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
+0x02,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x02,0x01,0x47,0x03,
+0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x02,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
+0x01,0x02,0x59,0x03,0x02,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
+0x02,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x02,0x01,
+0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x02,0x01,0x46,0x03,0x01,0x02,
+0x49,0x00,0x01,0x01,0x59,0x03,0x02,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x02,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,
+0x57,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
+0x01,0x02,0x57,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4B,0x00,
+0x01,0x02,0x57,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,
+0x4B,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
+0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x42,0x03,0x01,0x01,
+0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
+0x4E,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,
+0x40,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x06,0x00,0x01,0x01,
+0x3F,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x08,0x00,0x01,0x02,
+0x3D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x09,0x00,
+0x3C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x3B,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x0C,0x00,
+0x01,0x01,0x39,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x37,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
+0x49,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x35,0x03,0x01,0x01,0x5A,0x00,
+0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x14,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
+0x01,0x01,0x62,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x02,
+0x28,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x3B,0x03,
+0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
+0x6C,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x24,0x00,0x02,0x01,0x01,0x02,0x19,0x03,
+0x01,0x02,0x02,0x01,0x70,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x29,0x00,
+0x02,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0x76,0x00,0x01,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0x30,0x00,0x05,0x01,0x02,0x02,0x05,0x01,0x7E,0x00,0x01,0x01,
+0x2D,0x03,0x01,0x02,0x01,0x01,0xBE,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,
+0x02,0x01,0xC3,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,0xC9,0x00,
+0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xD2,0x00,0x03,0x01,0x05,0x02,
+0x03,0x03,0x08,0x02,0x02,0x01,0x23,0x00,
 };
 static const DiffBlock LISTENING_FRAME20_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    59, 31,  // Changed box top-left
+    236, 105,  // Changed box dimensions
     LISTENING_FRAME20_DATA
 };
 
-// Frame 21: Full frame RLE (2094 bytes)
-static const uint8_t LISTENING_FRAME21_DATA[2094] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD9,0x00,
-0x0B,0x01,0xFF,0x00,0x30,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x04,0x02,0x02,0x01,
-0xFF,0x00,0x24,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1C,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,
-0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x12,0x00,0x01,0x01,
-0x01,0x02,0x2E,0x03,0x01,0x02,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0xFF,0x00,0x07,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x03,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x03,0x01,0x09,0x02,0x03,0x01,
-0x71,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x01,0x02,
+// Frame 21: Diff RLE (1532 bytes)
+static const uint8_t LISTENING_FRAME21_DATA[1532] = {
+0xB7,0x00,0x0B,0x01,0xD7,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x04,0x02,0x02,0x01,
+0xCB,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xC3,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xBD,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
+0x01,0x02,0x01,0x01,0xB9,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0xB5,0x00,
+0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0xB0,0x00,0x01,0x01,0x01,0x02,
+0x36,0x03,0x01,0x02,0xAE,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xAA,0x00,
+0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x03,0x01,0x09,0x02,0x03,0x01,
+0x71,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x02,0x01,0x01,0x02,
 0x13,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,
-0x75,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x71,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x19,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
+0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x16,0x00,0x01,0x01,
 0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x66,0x00,0x01,0x01,
+0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
+0x5C,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x01,0x02,
+0x2D,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
 0x30,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x64,0x00,0x01,0x01,0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x39,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x3B,0x03,
-0x01,0x02,0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x3D,0x03,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x02,0x3F,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x41,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x57,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x57,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x48,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x56,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x57,0x03,
-0x01,0x01,0x56,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x5A,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x3C,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,
-0x3B,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x60,0x00,0x01,0x01,
-0x39,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x37,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,
-0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x02,0x35,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x68,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x2C,0x03,0x01,0x02,0x01,0x01,0x62,0x00,
-0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x70,0x00,0x01,0x01,0x01,0x02,
-0x24,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,
-0x73,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x39,0x03,0x01,0x02,0x78,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,
-0x70,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,
-0x0F,0x03,0x02,0x02,0x02,0x01,0x76,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
-0x84,0x00,0x05,0x01,0x02,0x02,0x05,0x01,0x7E,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x17,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,
-0x1E,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x27,0x00,
-0x03,0x01,0x05,0x02,0x03,0x03,0x08,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x21,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,
+0x50,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
+0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x39,0x03,0x01,0x02,
+0x51,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x02,0x3B,0x03,
+0x01,0x02,0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x3D,0x03,
+0x01,0x01,0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x01,0x02,
+0x3D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,0x03,0x00,0x01,0x02,
+0x3F,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,0x02,0x00,0x01,0x01,0x41,0x03,
+0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x02,0x00,0x01,0x02,0x41,0x03,
+0x01,0x02,0x4B,0x00,0x01,0x01,0x57,0x03,0x01,0x00,0x01,0x01,0x43,0x03,0x01,0x01,
+0x4A,0x00,0x01,0x01,0x57,0x03,0x01,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x4A,0x00,
+0x01,0x02,0x57,0x03,0x01,0x01,0x44,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,
+0x57,0x03,0x01,0x01,0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
+0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x45,0x03,0x01,0x02,
+0x01,0x01,0x48,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,
+0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x03,
+0x01,0x02,0x48,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x03,
+0x01,0x02,0x48,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x57,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x57,0x03,
+0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x46,0x03,
+0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,
+0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x03,
+0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,
+0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x03,
+0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,
+0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,
+0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,
+0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
+0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,
+0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x47,0x03,
+0x01,0x01,0x48,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
+0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
+0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x01,
+0x49,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,
+0x56,0x03,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,
+0x55,0x03,0x01,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x55,0x03,
+0x01,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x55,0x03,
+0x01,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x54,0x03,0x02,0x00,
+0x01,0x02,0x42,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x54,0x03,0x02,0x00,0x01,0x01,
+0x41,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x02,0x00,0x01,0x01,
+0x01,0x02,0x40,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x53,0x03,0x03,0x00,0x01,0x02,
+0x3F,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x04,0x00,0x01,0x02,
+0x3D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,
+0x06,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x37,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
+0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x35,0x03,0x01,0x01,
+0x5A,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
+0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x2C,0x03,0x01,0x02,
+0x01,0x01,0x62,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x02,
+0x28,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x18,0x00,
+0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x3B,0x03,
+0x01,0x02,0x01,0x01,0x1B,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
+0x6C,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x20,0x00,0x02,0x01,0x01,0x02,0x19,0x03,
+0x01,0x02,0x02,0x01,0x70,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x25,0x00,
+0x02,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0x76,0x00,0x01,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x05,0x01,0x02,0x02,0x05,0x01,0x7E,0x00,0x01,0x02,
+0x2D,0x03,0x01,0x02,0x01,0x01,0xBA,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,
+0x02,0x01,0xBE,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,0xC5,0x00,
+0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x1A,0x00,
 };
 static const DiffBlock LISTENING_FRAME21_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    59, 31,  // Changed box top-left
+    232, 104,  // Changed box dimensions
     LISTENING_FRAME21_DATA
 };
 
-// Frame 22: Full frame RLE (2090 bytes)
-static const uint8_t LISTENING_FRAME22_DATA[2090] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD9,0x00,
-0x0B,0x01,0xFF,0x00,0x30,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x04,0x02,0x02,0x01,
-0xFF,0x00,0x24,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1C,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,
-0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x12,0x00,0x01,0x01,
-0x01,0x02,0x2E,0x03,0x01,0x02,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0xFF,0x00,0x07,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x03,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x03,0x01,0x09,0x02,0x03,0x01,
-0x71,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x01,0x02,
-0x13,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,
-0x75,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x71,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x66,0x00,0x01,0x01,
-0x30,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x64,0x00,0x01,0x01,0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x39,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x3B,0x03,
-0x01,0x02,0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x3D,0x03,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x02,0x3F,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x41,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x57,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x57,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x48,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x56,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x57,0x03,
-0x01,0x01,0x56,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x5A,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x3D,0x03,
-0x01,0x01,0x53,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x39,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x61,0x00,
-0x01,0x01,0x37,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,
-0x01,0x01,0x63,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x01,0x02,
-0x47,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x68,0x00,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x2C,0x03,0x01,0x02,0x01,0x01,0x62,0x00,
-0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x02,0x29,0x03,0x01,0x02,
-0x65,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x73,0x00,
-0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x39,0x03,0x01,0x01,
-0x78,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,0x70,0x00,0x01,0x02,
-0x35,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x03,0x02,
-0x01,0x01,0x76,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x84,0x00,0x05,0x01,
-0x02,0x02,0x05,0x01,0x7E,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x13,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x17,0x00,
-0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x1F,0x00,0x02,0x01,
-0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x27,0x00,0x03,0x01,0x05,0x02,
-0x03,0x03,0x08,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x21,0x00,0x01,0x01,0x01,0x02,
+// Frame 22: Diff RLE (956 bytes)
+static const uint8_t LISTENING_FRAME22_DATA[956] = {
+0x2A,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x01,0x00,0x2B,0x03,
+0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x01,0x00,0x2B,0x03,0x01,0x02,
+0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x2B,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x2C,0x03,0x01,0x01,0x48,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x2C,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x00,0x2C,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x01,0x01,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x2C,0x03,
+0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x2C,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x2C,0x03,
+0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x2C,0x03,0x01,0x02,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x2C,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x85,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x86,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x85,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x85,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x85,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x85,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x86,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x86,0x03,0x01,0x01,0x48,0x00,
+0x01,0x02,0x86,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x86,0x03,0x01,0x01,0x48,0x00,
+0x01,0x02,0x85,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x85,0x03,0x01,0x02,
+0x49,0x00,0x01,0x01,0x85,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x85,0x03,0x01,0x01,
+0x49,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x2C,0x03,0x01,0x01,0x49,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x2A,0x03,
+0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x2A,0x03,0x01,0x02,
+0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x00,0x2A,0x03,0x01,0x01,0x4D,0x00,
+0x01,0x01,0x55,0x03,0x01,0x01,0x01,0x00,0x29,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,
+0x01,0x02,0x53,0x03,0x01,0x02,0x02,0x00,0x29,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,
+0x53,0x03,0x01,0x01,0x02,0x00,0x28,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x03,0x00,0x27,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,
+0x01,0x01,0x03,0x00,0x27,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,
+0x04,0x00,0x26,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x05,0x00,
+0x25,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,
+0x05,0x00,0x24,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,
+0x01,0x01,0x06,0x00,0x23,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x01,0x02,0x47,0x03,
+0x01,0x02,0x01,0x01,0x07,0x00,0x21,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x20,0x03,0x01,0x02,0x01,0x01,
+0x5E,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x1E,0x03,
+0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x1D,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x0C,0x00,0x1A,0x03,
+0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
+0x19,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x0F,0x00,0x15,0x03,
+0x01,0x02,0x02,0x01,0x70,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x10,0x00,
+0x10,0x03,0x03,0x02,0x01,0x01,0x76,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
+0x14,0x00,0x05,0x01,0x02,0x02,0x05,0x01,0x7E,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,
+0x01,0x01,0xA2,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x02,0x01,0xA6,0x00,
+0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
 };
 static const DiffBlock LISTENING_FRAME22_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    86, 61,  // Changed box top-left
+    208, 73,  // Changed box dimensions
     LISTENING_FRAME22_DATA
 };
 
-// Frame 23: Full frame RLE (2136 bytes)
-static const uint8_t LISTENING_FRAME23_DATA[2136] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x0B,0x00,0x02,0x01,0x04,0x02,0x0B,0x03,0x05,0x02,0x03,0x01,0xFF,0x00,
-0x23,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1B,0x00,
-0x01,0x01,0x02,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x15,0x00,0x01,0x01,
-0x01,0x02,0x2A,0x03,0x02,0x02,0x01,0x01,0x83,0x00,0x03,0x01,0x05,0x02,0x04,0x03,
-0x05,0x02,0x03,0x01,0x78,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x7D,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,
-0x01,0x02,0x35,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,
-0x02,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x02,0x01,0x72,0x00,
-0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x02,0x3C,0x03,
-0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,
-0x63,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,
-0x67,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x01,0x02,0x45,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0x59,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x39,0x03,
-0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x60,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x50,0x00,
-0x01,0x01,0x50,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x52,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,
-0x47,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x54,0x00,0x01,0x01,
-0x49,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x53,0x00,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x50,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x50,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x4E,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,
-0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x54,0x03,
-0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,
-0x49,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x43,0x00,0x5C,0x03,0x01,0x02,0x4A,0x00,
-0x01,0x01,0x54,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x54,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x53,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x01,0x02,0x57,0x03,0x01,0x02,0x4E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x47,0x00,
-0x01,0x02,0x57,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x49,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x53,0x00,0x01,0x01,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x52,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x40,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
-0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,
-0x01,0x02,0x64,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x01,0x02,
-0x33,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
-0x02,0x01,0x6D,0x00,0x01,0x01,0x31,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,
-0x30,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
-0x01,0x01,0x6D,0x00,0x02,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x02,0x01,0x76,0x00,
-0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,
-0x24,0x03,0x01,0x02,0x02,0x01,0x7C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x79,0x00,0x01,0x01,0x03,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0x83,0x00,
-0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0x80,0x00,0x03,0x01,0x05,0x02,
-0x09,0x03,0x06,0x02,0x03,0x01,0x8C,0x00,0x01,0x01,0x05,0x02,0x0A,0x03,0x03,0x02,
-0x02,0x01,0xFF,0x00,0x34,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x4D,0x00,0x01,0x01,0x01,0x02,
+// Frame 23: Diff RLE (1842 bytes)
+static const uint8_t LISTENING_FRAME23_DATA[1842] = {
+0xFF,0x00,0xBC,0x00,0x02,0x01,0x04,0x02,0x0B,0x03,0x05,0x02,0x03,0x01,0xE2,0x00,
+0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0xDA,0x00,0x01,0x01,0x02,0x02,
+0x23,0x03,0x02,0x02,0x01,0x01,0xD4,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x02,0x02,
+0x01,0x01,0x43,0x00,0x03,0x01,0x05,0x02,0x04,0x03,0x05,0x02,0x03,0x01,0x78,0x00,
+0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x02,0x02,
+0x16,0x03,0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x01,
+0x37,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,
+0x01,0x02,0x38,0x03,0x01,0x02,0x02,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
+0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,
+0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x40,0x03,
+0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x60,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,
+0x32,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x01,
+0x24,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
+0x48,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x55,0x00,
+0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
+0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
+0x19,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x52,0x03,
+0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x01,0x4B,0x00,
+0x01,0x02,0x54,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
+0x49,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
+0x49,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x4C,0x03,
+0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x10,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,
+0x50,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x54,0x03,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,
+0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
+0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x54,0x03,
+0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,
+0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,
+0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x42,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x43,0x00,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
+0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
+0x43,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x44,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x52,0x03,
+0x01,0x02,0x45,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x52,0x03,
+0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x01,0x02,0x51,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,
+0x0E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x0F,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x54,0x03,
+0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
+0x53,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,
+0x01,0x02,0x51,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
+0x4D,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x49,0x03,
+0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x17,0x00,
+0x01,0x02,0x48,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x19,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
+0x45,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x59,0x00,0x01,0x01,
+0x42,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x01,0x02,0x3A,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,
+0x27,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
+0x39,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
+0x65,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x02,0x01,0x2D,0x00,0x01,0x01,
+0x31,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0x32,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,
+0x01,0x02,0x2A,0x03,0x01,0x02,0x02,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,
+0x3C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x01,0x01,
+0x03,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0x43,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
+0x02,0x02,0x02,0x01,0x80,0x00,0x03,0x01,0x05,0x02,0x09,0x03,0x06,0x02,0x03,0x01,
+0x4C,0x00,0x01,0x01,0x05,0x02,0x0A,0x03,0x03,0x02,0x02,0x01,0xF3,0x00,0x07,0x01,
+0xD1,0x00,
 };
 static const DiffBlock LISTENING_FRAME23_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    39, 31,  // Changed box top-left
+    256, 107,  // Changed box dimensions
     LISTENING_FRAME23_DATA
 };
 
-// Frame 24: Full frame RLE (2176 bytes)
-static const uint8_t LISTENING_FRAME24_DATA[2176] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x08,0x00,0x02,0x01,0x04,0x02,0x08,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,
-0x27,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0x92,0x00,0x08,0x01,
-0x01,0x00,0x02,0x01,0x80,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
-0x88,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x01,0x01,
-0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x81,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,
-0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x7C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x73,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x01,
-0x60,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,
-0x34,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
-0x01,0x01,0x42,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x57,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x42,0x03,
-0x01,0x01,0x52,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x5F,0x00,0x01,0x02,0x44,0x03,
-0x01,0x01,0x50,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x46,0x03,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x48,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x56,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
-0x54,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
-0x52,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0x43,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x43,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
+// Frame 24: Diff RLE (1886 bytes)
+static const uint8_t LISTENING_FRAME24_DATA[1886] = {
+0xBC,0x00,0x02,0x01,0x04,0x02,0x08,0x03,0x04,0x02,0x03,0x01,0xE1,0x00,0x02,0x01,
+0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0x4D,0x00,0x08,0x01,0x01,0x00,0x02,0x01,
+0x80,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x43,0x00,0x02,0x01,
+0x03,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
+0x02,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,
+0x71,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
+0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,
+0x2C,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
+0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
+0x3C,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
+0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x23,0x00,
+0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x42,0x03,
+0x01,0x02,0x20,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x57,0x00,0x01,0x01,
+0x44,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x46,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x52,0x00,
+0x01,0x02,0x48,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x50,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x4E,0x00,
+0x01,0x01,0x4C,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x4C,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x4A,0x00,
+0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x01,0x49,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x47,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,
+0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x56,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x40,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x07,0x00,
+0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x01,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x06,0x00,
 0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x55,0x03,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x52,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,
-0x01,0x01,0x51,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x4F,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x4E,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x4B,0x03,
-0x01,0x02,0x50,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x49,0x03,
-0x01,0x02,0x52,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x47,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,
-0x5F,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x3F,0x03,
-0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,
-0x58,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
-0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x02,0x37,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x71,0x00,
-0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x29,0x03,
-0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x6E,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,0x02,0x02,
-0x29,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,
-0x02,0x01,0x80,0x00,0x01,0x01,0x02,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0x7B,0x00,
-0x02,0x01,0x03,0x02,0x0B,0x03,0x06,0x02,0x03,0x01,0x86,0x00,0x02,0x01,0x01,0x02,
-0x1D,0x03,0x02,0x02,0x85,0x00,0x06,0x01,0x96,0x00,0x03,0x01,0x01,0x02,0x14,0x03,
-0x03,0x02,0x02,0x01,0xFF,0x00,0x2B,0x00,0x05,0x01,0x03,0x02,0x02,0x01,0x01,0x02,
-0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0A,0x00,0x01,0x01,0x01,0x02,
-
+0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
+0x01,0x01,0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,
+0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x41,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x01,0x02,
+0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
+0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x51,0x03,
+0x01,0x01,0x0D,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x02,0x0E,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
+0x01,0x01,0x4D,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x4C,0x00,
+0x01,0x01,0x4B,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x4E,0x00,
+0x01,0x02,0x49,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x50,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x52,0x00,
+0x01,0x01,0x45,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,
+0x53,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,
+0x45,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
+0x1C,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,
+0x01,0x02,0x3C,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
+0x5C,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x02,0x3D,0x03,
+0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
+0x25,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
+0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
+0x30,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x02,0x02,0x29,0x03,0x02,0x02,
+0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x3B,0x00,
+0x01,0x01,0x02,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0x7B,0x00,0x02,0x01,0x03,0x02,
+0x0B,0x03,0x06,0x02,0x03,0x01,0x41,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,0x02,0x02,
+0x85,0x00,0x06,0x01,0x51,0x00,0x03,0x01,0x01,0x02,0x14,0x03,0x03,0x02,0x02,0x01,
+0xE5,0x00,0x05,0x01,0x03,0x02,0x02,0x01,0x01,0x02,0x05,0x01,0xC6,0x00,
 };
 static const DiffBlock LISTENING_FRAME24_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    35, 32,  // Changed box top-left
+    251, 107,  // Changed box dimensions
     LISTENING_FRAME24_DATA
 };
 
-// Frame 25: Full frame RLE (2162 bytes)
-static const uint8_t LISTENING_FRAME25_DATA[2162] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x08,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,
-0x27,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x92,0x00,0x08,0x01,
-0x01,0x00,0x02,0x01,0x80,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
-0x88,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x02,0x02,0x03,0x01,0x77,0x00,0x01,0x01,
-0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x81,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,
-0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x7C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x60,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x65,0x00,0x01,0x01,
-0x01,0x02,0x3C,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
-0x61,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x48,0x03,0x01,0x02,
-0x5F,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x5B,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,
-0x4F,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x01,0x01,0x44,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x53,0x03,
-0x01,0x01,0x43,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x53,0x03,
-0x01,0x02,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x54,0x03,
-0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x4E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x4E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x4E,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
-0x50,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x51,0x03,
-0x01,0x01,0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x53,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x4E,0x00,
-0x01,0x02,0x49,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x50,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x52,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x02,0x01,0x70,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x29,0x03,0x01,0x02,
-0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,
-0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,
-0x2A,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,
-0x02,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x7B,0x00,
-0x02,0x01,0x03,0x02,0x0B,0x03,0x06,0x02,0x03,0x01,0x86,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x02,0x02,0x01,0x01,0x84,0x00,0x06,0x01,0x96,0x00,0x03,0x01,0x01,0x02,
-0x14,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,0x2C,0x00,0x05,0x01,0x03,0x02,0x02,0x01,
-0x01,0x02,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0A,0x00,0x01,0x01,
-0x01,0x02,
+// Frame 25: Diff RLE (1638 bytes)
+static const uint8_t LISTENING_FRAME25_DATA[1638] = {
+0xBB,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x03,0x01,0xD9,0x00,0x02,0x01,
+0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x45,0x00,0x08,0x01,0x01,0x00,0x02,0x01,
+0x80,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x3B,0x00,0x02,0x01,
+0x03,0x02,0x0F,0x03,0x02,0x02,0x03,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
+0x02,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,
+0x71,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
+0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
+0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,
+0x22,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x01,0x01,0x1E,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,
+0x3F,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,
+0x59,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
+0x01,0x02,0x57,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x3F,0x03,
+0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
+0x42,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x12,0x00,0x01,0x02,
+0x44,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
+0x01,0x02,0x46,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x0E,0x00,
+0x01,0x02,0x48,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x0C,0x00,
+0x01,0x02,0x4A,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
+0x09,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
+0x07,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x52,0x03,
+0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
+0x54,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x44,0x00,
+0x01,0x02,0x55,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x43,0x00,
+0x01,0x01,0x56,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x43,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x41,0x00,
+0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x55,0x03,
+0x01,0x02,0x41,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x55,0x03,
+0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x56,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x01,0x00,0x57,0x03,
+0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x57,0x03,0x01,0x02,
+0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x57,0x03,0x01,0x02,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x00,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x00,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x01,0x00,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,
+0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x57,0x03,
+0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x00,0x57,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x57,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x57,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x58,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x58,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x57,0x03,
+0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x58,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x01,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
+0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x58,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x58,0x03,0x01,0x01,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x01,0xB1,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0xB1,0x03,
+0x01,0x01,0x40,0x00,0x01,0x01,0xB1,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,
+0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0xB1,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0xB1,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0xB1,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0xB1,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x58,0x03,
+0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x58,0x03,0x01,0x01,
+0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x57,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
+0x01,0x02,0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
+0x01,0x01,0x07,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x4E,0x00,0x01,0x02,
+0x49,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x50,0x00,0x01,0x01,
+0x47,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x52,0x00,0x01,0x01,
+0x45,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
+0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x14,0x00,
+0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x5C,0x00,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x3B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
+0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
+0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x02,0x01,0x23,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
+0x28,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
+0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,
+0x33,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x7B,0x00,0x02,0x01,
+0x03,0x02,0x0B,0x03,0x06,0x02,0x03,0x01,0x39,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,
+0x02,0x02,0x01,0x01,0x84,0x00,0x06,0x01,0x49,0x00,0x03,0x01,0x01,0x02,0x14,0x03,
+0x03,0x02,0x01,0x01,0xBA,0x00,
 };
 static const DiffBlock LISTENING_FRAME25_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    36, 32,  // Changed box top-left
+    243, 106,  // Changed box dimensions
     LISTENING_FRAME25_DATA
 };
 
-// Frame 26: Full frame RLE (2162 bytes)
-static const uint8_t LISTENING_FRAME26_DATA[2162] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x08,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,
-0x27,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x92,0x00,0x08,0x01,
-0x01,0x00,0x02,0x01,0x80,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
-0x88,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x02,0x02,0x03,0x01,0x77,0x00,0x01,0x01,
-0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x81,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,
-0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x7C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x60,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x65,0x00,0x01,0x01,
-0x01,0x02,0x3C,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
-0x61,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x48,0x03,0x01,0x02,
-0x5F,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x5B,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,
-0x4F,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x01,0x01,0x44,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x53,0x03,
-0x01,0x01,0x43,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x53,0x03,
-0x01,0x02,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x54,0x03,
-0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x4E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x4E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x4E,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
-0x50,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x51,0x03,
-0x01,0x01,0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x53,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x4D,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x4E,0x00,
-0x01,0x02,0x49,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x50,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x52,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x02,0x01,0x70,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x29,0x03,0x01,0x02,
-0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,
-0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,
-0x2A,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,
-0x02,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x7B,0x00,
-0x02,0x01,0x03,0x02,0x0B,0x03,0x06,0x02,0x03,0x01,0x86,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x02,0x02,0x01,0x01,0x84,0x00,0x06,0x01,0x96,0x00,0x03,0x01,0x01,0x02,
-0x14,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,0x2C,0x00,0x05,0x01,0x03,0x02,0x02,0x01,
-0x01,0x02,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0A,0x00,0x01,0x01,
-0x01,0x02,
-};
-static const DiffBlock LISTENING_FRAME26_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    LISTENING_FRAME26_DATA
-};
+// Frame 26: no change
 
-// Frame 27: Full frame RLE (2164 bytes)
-static const uint8_t LISTENING_FRAME27_DATA[2164] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x08,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,
-0x27,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x92,0x00,0x08,0x01,
-0x01,0x00,0x02,0x01,0x80,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
-0x88,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x02,0x02,0x03,0x01,0x77,0x00,0x01,0x01,
-0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x81,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,
-0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x7C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x60,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x65,0x00,0x01,0x01,
-0x01,0x02,0x3C,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
-0x61,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x48,0x03,0x01,0x02,
-0x5F,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x02,0x5B,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,
-0x4F,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x49,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x01,0x01,0x44,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x50,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x50,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,
-0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x4E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x4D,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x57,0x03,
-0x01,0x01,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x55,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x53,0x03,
-0x01,0x02,0x50,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x52,0x03,
-0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x4F,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
-0x4E,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,
-0x50,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
-0x52,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
-0x01,0x01,0x6A,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
-0x31,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x02,0x01,0x70,0x00,
-0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x29,0x03,
-0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x6E,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,
-0x01,0x02,0x2A,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,
-0x01,0x02,0x02,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,
-0x7B,0x00,0x02,0x01,0x03,0x02,0x0B,0x03,0x06,0x02,0x03,0x01,0x86,0x00,0x01,0x01,
-0x02,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x84,0x00,0x06,0x01,0x96,0x00,0x03,0x01,
-0x01,0x02,0x14,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,0x2C,0x00,0x05,0x01,0x03,0x02,
-0x02,0x01,0x01,0x02,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0A,0x00,
+// Frame 27: Diff RLE (4 bytes)
+static const uint8_t LISTENING_FRAME27_DATA[4] = {
 0x01,0x01,0x01,0x02,
 };
 static const DiffBlock LISTENING_FRAME27_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    275, 53,  // Changed box top-left
+    1, 2,  // Changed box dimensions
     LISTENING_FRAME27_DATA
 };
 
-// Frame 28: Full frame RLE (2128 bytes)
-static const uint8_t LISTENING_FRAME28_DATA[2128] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x13,0x00,0x01,0x01,0x04,0x02,0x0B,0x03,0x05,0x02,0x03,0x01,0xFF,0x00,
-0x24,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x1D,0x00,
-0x01,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,0x01,0x01,
-0x01,0x02,0x28,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x12,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0E,0x00,0x01,0x02,0x32,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x06,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x82,0x00,0x03,0x01,
-0x08,0x02,0x02,0x01,0x73,0x00,0x01,0x02,0x3D,0x03,0x01,0x01,0x7B,0x00,0x02,0x01,
+// Frame 28: Diff RLE (1822 bytes)
+static const uint8_t LISTENING_FRAME28_DATA[1822] = {
+0xC7,0x00,0x01,0x01,0x04,0x02,0x0B,0x03,0x05,0x02,0x03,0x01,0xE4,0x00,0x02,0x01,
+0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0xDD,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
+0x02,0x02,0x01,0x01,0xD7,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x02,0x01,
+0xD2,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0xCE,0x00,0x01,0x02,
+0x32,0x03,0x01,0x02,0x01,0x01,0xCA,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,
+0xC6,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x03,0x01,
+0x08,0x02,0x02,0x01,0x73,0x00,0x01,0x02,0x3D,0x03,0x01,0x01,0x3C,0x00,0x02,0x01,
 0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x6C,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x77,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x38,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
+0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
 0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,
-0x6F,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x47,0x03,
-0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x01,0x01,0x66,0x00,
+0x30,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x47,0x03,
+0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,
+0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
+0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x01,0x01,0x27,0x00,
 0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x56,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,
+0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x56,0x00,0x01,0x01,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
+0x01,0x01,0x54,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x38,0x03,
+0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x01,0x01,0x20,0x00,
 0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x5A,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x59,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x02,0x58,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x57,0x03,
-0x01,0x01,0x57,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x57,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x47,0x03,0x48,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x55,0x00,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
-0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x48,0x03,
-0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x01,
-0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,
+0x1F,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
+0x01,0x02,0x19,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x57,0x03,
+0x01,0x01,0x18,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x57,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x47,0x03,0x48,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x16,0x00,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
+0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x01,
+0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,
 0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,
-0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x48,0x03,
-0x01,0x02,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x48,0x03,
-0x01,0x02,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x48,0x03,
-0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
+0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x02,0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x47,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x14,0x00,
 0x01,0x01,0x48,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
+0x14,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,
+0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,
 0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x59,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,
-0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x48,0x03,
-0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x47,0x03,
-0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x02,
+0x14,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x58,0x03,
+0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x01,0x01,
+0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x48,0x03,
+0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x47,0x03,
+0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x15,0x00,0x01,0x02,
 0x47,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x01,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x02,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x48,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x54,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,
-0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x46,0x03,0x4B,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x56,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x56,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x57,0x00,
+0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x01,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x47,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x02,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
+0x48,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
+0x01,0x01,0x48,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x47,0x03,
+0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
+0x47,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x15,0x00,
+0x01,0x01,0x01,0x02,0x46,0x03,0x4B,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x17,0x00,
+0x01,0x02,0x45,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x17,0x00,
+0x01,0x01,0x45,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x18,0x00,
 0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x54,0x03,
-0x01,0x01,0x58,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x52,0x03,
-0x01,0x02,0x59,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x50,0x00,0x01,0x01,
-0x50,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x53,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,
-0x39,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x62,0x00,
+0x01,0x01,0x19,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x52,0x03,
+0x01,0x02,0x1A,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x50,0x00,0x01,0x01,
+0x50,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x53,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
+0x01,0x01,0x54,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,
+0x39,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x23,0x00,
 0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
-0x64,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x66,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
+0x25,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x27,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
+0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,
 0x01,0x01,0x2E,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x6E,0x00,0x02,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,
-0x3B,0x03,0x01,0x01,0x71,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
-0x69,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,
+0x2F,0x00,0x02,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,
+0x3B,0x03,0x01,0x01,0x32,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
+0x69,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,
 0x20,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
-0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x71,0x00,
-0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x02,0x01,0x02,0x02,
+0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x71,0x00,
+0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x02,0x01,0x02,0x02,
 0x10,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0x87,0x00,0x0C,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x18,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x1F,0x00,0x01,0x01,0x03,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x27,0x00,0x02,0x01,0x03,0x02,0x07,0x03,0x06,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x22,0x00,0x01,0x01,0x01,0x02,
-
+0x01,0x01,0x48,0x00,0x0C,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x02,0x02,
+0x01,0x01,0xD8,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0xDF,0x00,
+0x01,0x01,0x03,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xE7,0x00,0x02,0x01,0x03,0x02,
+0x07,0x03,0x06,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x27,0x00,
 };
 static const DiffBlock LISTENING_FRAME28_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    35, 32,  // Changed box top-left
+    257, 107,  // Changed box dimensions
     LISTENING_FRAME28_DATA
 };
 
-// Frame 29: Full frame RLE (2098 bytes)
-static const uint8_t LISTENING_FRAME29_DATA[2098] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xDC,0x00,
-0x07,0x01,0xFF,0x00,0x31,0x00,0x01,0x01,0x03,0x02,0x0F,0x03,0x02,0x02,0x04,0x01,
-0xFF,0x00,0x23,0x00,0x03,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x1D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x17,0x00,
-0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x12,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x0D,0x00,0x01,0x01,0x01,0x02,
-0x32,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0xFF,0x00,
-0x03,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x7E,0x00,0x04,0x01,0x09,0x02,
-0x03,0x01,0x71,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x79,0x00,0x02,0x01,0x01,0x02,
-0x12,0x03,0x02,0x02,0x02,0x01,0x6B,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x75,0x00,
+// Frame 29: Diff RLE (1784 bytes)
+static const uint8_t LISTENING_FRAME29_DATA[1784] = {
+0xBE,0x00,0x07,0x01,0xE0,0x00,0x01,0x01,0x03,0x02,0x0F,0x03,0x02,0x02,0x04,0x01,
+0xD2,0x00,0x03,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xCC,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xC6,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x01,0x01,0xC1,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,
+0xBC,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0xB8,0x00,0x01,0x01,
+0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xB5,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,
+0xB2,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x04,0x01,0x09,0x02,
+0x03,0x01,0x71,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x29,0x00,0x02,0x01,0x01,0x02,
+0x12,0x03,0x02,0x02,0x02,0x01,0x6B,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x25,0x00,
 0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x65,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
-0x62,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,
+0x44,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
+0x62,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,0x01,0x02,
 0x25,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
+0x1A,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
 0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4E,0x03,
-0x01,0x02,0x64,0x00,0x01,0x02,0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x50,0x03,
-0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,
-0x01,0x02,0x50,0x03,0x01,0x02,0x61,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x53,0x00,
-0x01,0x02,0x52,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,
-0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,
-0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x02,0x3F,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x59,0x00,
-0x01,0x01,0x41,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x58,0x00,
-0x01,0x01,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x57,0x00,
-0x01,0x02,0x43,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x56,0x00,
+0x15,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x02,0x14,0x00,0x01,0x02,0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x50,0x03,
+0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,
+0x01,0x02,0x50,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x53,0x00,
+0x01,0x02,0x52,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x51,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,
+0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,
+0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x3D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x3F,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x41,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x08,0x00,
+0x01,0x01,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x07,0x00,
+0x01,0x02,0x43,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x06,0x00,
 0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x06,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x06,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x04,0x00,
 0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x04,0x00,
 0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
+0x01,0x01,0x04,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
+0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x04,0x00,0x01,0x01,
+0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x04,0x00,0x01,0x01,
+0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x04,0x00,
 0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x42,0x03,0x4E,0x00,0x01,0x01,0x01,0x02,
-0x53,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
-0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x02,0x3E,0x03,
-0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,
-0x3C,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,
-0x3B,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x60,0x00,0x01,0x01,
+0x04,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x04,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,
+0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,
+0x57,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,
+0x57,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,
+0x55,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,
+0x55,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x42,0x03,0x4E,0x00,0x01,0x01,0x01,0x02,
+0x53,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
+0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
+0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x3E,0x03,
+0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,
+0x3B,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x10,0x00,0x01,0x01,
 0x39,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,
-0x63,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,0x68,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,
+0x11,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,
+0x13,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
+0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
+0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,
+0x01,0x01,0x5F,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,
 0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x02,0x41,0x03,0x01,0x02,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x74,0x00,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
+0x01,0x01,0x3F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
+0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x24,0x00,
 0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x39,0x03,
-0x01,0x01,0x78,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,0x01,0x01,0x02,0x02,
+0x01,0x01,0x28,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0x6F,0x00,
+0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x02,0x02,
 0x10,0x03,0x02,0x02,0x02,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
-0x01,0x01,0x84,0x00,0x06,0x01,0x02,0x02,0x04,0x01,0x7D,0x00,0x02,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x18,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x1F,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x27,0x00,0x03,0x01,0x03,0x02,0x07,0x03,0x05,0x02,0x04,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x20,0x00,0x01,0x01,
-0x01,0x02,
+0x01,0x01,0x34,0x00,0x06,0x01,0x02,0x02,0x04,0x01,0x7D,0x00,0x02,0x01,0x01,0x02,
+0x2C,0x03,0x01,0x02,0x01,0x01,0xC2,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,
+0x01,0x01,0xC7,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0xCE,0x00,
+0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0xD6,0x00,0x03,0x01,0x03,0x02,
+0x07,0x03,0x05,0x02,0x04,0x01,0x22,0x00,
 };
 static const DiffBlock LISTENING_FRAME29_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    55, 31,  // Changed box top-left
+    240, 105,  // Changed box dimensions
     LISTENING_FRAME29_DATA
 };
 
-// Frame 30: Full frame RLE (2104 bytes)
-static const uint8_t LISTENING_FRAME30_DATA[2104] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xDC,0x00,
-0x07,0x01,0xFF,0x00,0x31,0x00,0x01,0x01,0x03,0x02,0x0F,0x03,0x02,0x02,0x04,0x01,
-0xFF,0x00,0x23,0x00,0x03,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x1D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x17,0x00,
-0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x12,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x0D,0x00,0x01,0x01,0x01,0x02,
-0x32,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0xFF,0x00,
-0x03,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,0x7E,0x00,0x04,0x01,0x09,0x02,
-0x03,0x01,0x71,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x79,0x00,0x02,0x01,0x01,0x02,
-0x12,0x03,0x02,0x02,0x02,0x01,0x6B,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x75,0x00,
-0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x65,0x00,0x01,0x01,0x01,0x02,
-0x44,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
-0x62,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,
-0x25,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
-0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4E,0x03,
-0x01,0x02,0x64,0x00,0x01,0x02,0x33,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x50,0x03,
-0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x54,0x00,0x01,0x01,
-0x01,0x02,0x50,0x03,0x01,0x02,0x61,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x53,0x00,
-0x01,0x02,0x52,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,
-0x50,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,
-0x4E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x02,0x3F,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x59,0x00,
-0x01,0x01,0x41,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x41,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x58,0x00,
-0x01,0x01,0x43,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x57,0x00,
-0x01,0x02,0x43,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x56,0x00,
-0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x56,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x49,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x54,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
-0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x57,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x42,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
-0x4E,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x3E,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x4F,0x03,
-0x01,0x02,0x5E,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x55,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x60,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,
-0x4B,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x58,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,0x68,0x00,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,0x43,0x03,0x01,0x02,
-0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x62,0x00,
-0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x70,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x02,0x02,0x19,0x03,
-0x02,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x7D,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x02,0x01,0x75,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x84,0x00,0x06,0x01,0x02,0x02,0x04,0x01,
-0x7D,0x00,0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x13,0x00,
-0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x18,0x00,0x02,0x01,
-0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x1F,0x00,0x02,0x01,0x02,0x02,
-0x18,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x27,0x00,0x03,0x01,0x03,0x02,0x07,0x03,
-0x05,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x20,0x00,0x01,0x01,0x01,0x02,
+// Frame 30: Diff RLE (30 bytes)
+static const uint8_t LISTENING_FRAME30_DATA[30] = {
+0x02,0x03,0x01,0x02,0x02,0x03,0x01,0x01,0x01,0x03,0x01,0x02,0x01,0x01,0x01,0x03,
+0x01,0x02,0x01,0x00,0x01,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x02,0x00,
 };
 static const DiffBlock LISTENING_FRAME30_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    127, 109,  // Changed box top-left
+    3, 6,  // Changed box dimensions
     LISTENING_FRAME30_DATA
 };
 
 static const FrameInfo LISTENING_FRAMES[31] = {
     {&LISTENING_FRAME0_BLOCK},
     {&LISTENING_FRAME1_BLOCK},
-    {&LISTENING_FRAME2_BLOCK},
+    {nullptr},
     {&LISTENING_FRAME3_BLOCK},
     {&LISTENING_FRAME4_BLOCK},
     {&LISTENING_FRAME5_BLOCK},
@@ -4230,7 +2885,7 @@ static const FrameInfo LISTENING_FRAMES[31] = {
     {&LISTENING_FRAME23_BLOCK},
     {&LISTENING_FRAME24_BLOCK},
     {&LISTENING_FRAME25_BLOCK},
-    {&LISTENING_FRAME26_BLOCK},
+    {nullptr},
     {&LISTENING_FRAME27_BLOCK},
     {&LISTENING_FRAME28_BLOCK},
     {&LISTENING_FRAME29_BLOCK},
@@ -148,3054 +148,1389 @@ static const DiffBlock NEUTRAL_FRAME0_BLOCK = {
     NEUTRAL_FRAME0_DATA
 };
 
-// Frame 1: Full frame RLE (2146 bytes)
-static const uint8_t NEUTRAL_FRAME1_DATA[2146] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x04,0x01,0x0E,0x02,0x04,0x01,
-0xFF,0x00,0x26,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x15,0x00,
-0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x02,0x02,
-0x34,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,
-0xFD,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x10,0x01,
-0x74,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x02,0x01,0x03,0x02,
-0x12,0x03,0x03,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0x66,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x02,0x02,
-0x26,0x03,0x01,0x02,0x02,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x5D,0x00,
-0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
-0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x49,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x49,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x44,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x42,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x3E,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x3C,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3E,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x57,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x48,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x01,0x02,0x48,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x54,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x64,0x00,
-0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,
-0x02,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,
-0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,0x03,0x01,0x79,0x00,0x01,0x01,0x02,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x11,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x1F,0x00,0x03,0x01,0x02,0x02,0x14,0x03,0x03,0x02,0x02,0x01,
-0xFF,0x00,0x29,0x00,0x11,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x51,0x00,
+// Frame 1: Diff RLE (1766 bytes)
+static const uint8_t NEUTRAL_FRAME1_DATA[1766] = {
+0xC5,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xE6,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xDE,0x00,0x02,0x01,0x01,0x02,0x29,0x03,
+0x02,0x02,0x01,0x01,0xD9,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0xD3,0x00,0x01,0x01,0x02,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0xCF,0x00,0x01,0x01,
+0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0xCA,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
+0x01,0x01,0xC7,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
+0x10,0x01,0x74,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x02,0x01,
+0x03,0x02,0x12,0x03,0x03,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x47,0x03,
+0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,
+0x66,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x02,0x02,0x26,0x03,0x01,0x02,0x02,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,
+0x5D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x32,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x22,0x00,
+0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x55,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
+0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x19,0x00,
+0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,
+0x59,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x15,0x00,0x01,0x01,
+0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
+0x13,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
+0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
+0x45,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
+0x44,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x55,0x03,
+0x01,0x02,0x42,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x57,0x03,
+0x01,0x01,0x41,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x01,0x02,0x5B,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x06,0x00,
+0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
+0x01,0x02,0x06,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,
+0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x3B,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x02,
+0x61,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
+0x03,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,
+0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,
+0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x01,0x01,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
+0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
+0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
+0x65,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x01,0x65,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
+0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x01,0x00,
+0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
+0x03,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
+0x03,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x04,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x06,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x42,0x00,0x01,0x01,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,
+0x43,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,
+0x01,0x01,0x45,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x47,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x10,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,
+0x50,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
+0x4F,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x54,0x03,
+0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x19,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x54,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x41,0x03,
+0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,
+0x59,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
+0x01,0x02,0x4A,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,
+0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x60,0x00,
+0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,
+0x44,0x03,0x01,0x02,0x64,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0x2C,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,
+0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
+0x01,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,
+0x36,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,
+0x03,0x02,0x18,0x03,0x03,0x02,0x02,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
+0x01,0x02,0x01,0x01,0x7B,0x00,0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,0x03,0x01,
+0x43,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0xDA,0x00,0x01,0x01,
+0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0xE0,0x00,0x02,0x01,0x02,0x02,0x20,0x03,
+0x01,0x02,0x02,0x01,0xE8,0x00,0x03,0x01,0x02,0x02,0x14,0x03,0x03,0x02,0x02,0x01,
+0xF2,0x00,0x11,0x01,0xCE,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME1_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    24, 36,  // Changed box top-left
+    266, 102,  // Changed box dimensions
     NEUTRAL_FRAME1_DATA
 };
 
-// Frame 2: Full frame RLE (2146 bytes)
-static const uint8_t NEUTRAL_FRAME2_DATA[2146] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x04,0x01,0x0E,0x02,0x04,0x01,
-0xFF,0x00,0x26,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x15,0x00,
-0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x02,0x02,
-0x34,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,
-0xFD,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x10,0x01,
-0x74,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x02,0x01,0x03,0x02,
-0x12,0x03,0x03,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0x66,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x02,0x02,
-0x26,0x03,0x01,0x02,0x02,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x5D,0x00,
-0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
-0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x49,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x49,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x44,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x42,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x3E,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x3C,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3E,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x57,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x48,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x01,0x02,0x48,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x54,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x64,0x00,
-0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,
-0x02,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,
-0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,0x03,0x01,0x79,0x00,0x01,0x01,0x02,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x11,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x1F,0x00,0x03,0x01,0x02,0x02,0x14,0x03,0x03,0x02,0x02,0x01,
-0xFF,0x00,0x29,0x00,0x11,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x51,0x00,
-};
-static const DiffBlock NEUTRAL_FRAME2_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    NEUTRAL_FRAME2_DATA
-};
+// Frame 2: no change
 
-// Frame 3: Full frame RLE (2146 bytes)
-static const uint8_t NEUTRAL_FRAME3_DATA[2146] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x04,0x01,0x0E,0x02,0x04,0x01,
-0xFF,0x00,0x26,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x15,0x00,
-0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x02,0x02,
-0x34,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,
-0xFD,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x10,0x01,
-0x74,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x02,0x01,0x03,0x02,
-0x12,0x03,0x03,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0x66,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x02,0x02,
-0x26,0x03,0x01,0x02,0x02,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x5D,0x00,
-0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
-0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x49,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x49,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x44,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x42,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x3E,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x3C,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3E,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x57,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x48,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x01,0x02,0x48,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x54,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x64,0x00,
-0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,
-0x02,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,
-0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,0x03,0x01,0x79,0x00,0x01,0x01,0x02,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x11,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x1F,0x00,0x03,0x01,0x02,0x02,0x14,0x03,0x03,0x02,0x02,0x01,
-0xFF,0x00,0x29,0x00,0x11,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x51,0x00,
-};
-static const DiffBlock NEUTRAL_FRAME3_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    NEUTRAL_FRAME3_DATA
-};
+// Frame 3: no change
 
-// Frame 4: Full frame RLE (2146 bytes)
-static const uint8_t NEUTRAL_FRAME4_DATA[2146] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x04,0x01,0x0E,0x02,0x04,0x01,
-0xFF,0x00,0x26,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x15,0x00,
-0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x02,0x02,
-0x34,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,
-0xFD,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x10,0x01,
-0x74,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x02,0x01,0x03,0x02,
-0x12,0x03,0x03,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0x66,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x02,0x02,
-0x26,0x03,0x01,0x02,0x02,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x5D,0x00,
-0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x58,0x00,0x01,0x01,
-0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x55,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x49,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x49,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x44,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x42,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x3E,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x3C,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3E,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x40,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x45,0x00,0x01,0x02,
-0x57,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x48,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x01,0x02,0x48,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x54,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x64,0x00,
-0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x03,0x02,
-0x02,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,
-0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,0x03,0x01,0x79,0x00,0x01,0x01,0x02,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x11,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x1F,0x00,0x03,0x01,0x02,0x02,0x14,0x03,0x03,0x02,0x02,0x01,
-0xFF,0x00,0x29,0x00,0x11,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x51,0x00,
+// Frame 4: Diff RLE (664 bytes)
+static const uint8_t NEUTRAL_FRAME4_DATA[664] = {
+0x15,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x02,0x02,0x01,0x01,0x27,0x00,0x01,0x01,
+0x01,0x02,0x3E,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,
+0x01,0x01,0x21,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
+0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
+0x15,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x53,0x03,
+0x01,0x01,0x11,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x57,0x03,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x5B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
+0x01,0x01,0x04,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x02,0x00,0x01,0x02,
+0x63,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x02,0x01,0x65,0x03,
+0x01,0x01,0x01,0x02,0x65,0x03,0x02,0x02,0x65,0x03,0x02,0x02,0x65,0x03,0x01,0x02,
+0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0xCE,0x03,0x01,0x02,0x66,0x03,0x01,0x02,
+0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,
+0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,
+0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,
+0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,
+0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x02,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x01,
+0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x01,
+0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x01,
+0x01,0x02,0x65,0x03,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x00,0x01,0x02,0x65,0x03,
+0x01,0x00,0x01,0x02,0x65,0x03,0x01,0x00,0x01,0x01,0x65,0x03,0x01,0x00,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x02,0x00,
+0x01,0x01,0x63,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x04,0x00,
+0x01,0x01,0x61,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x09,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x57,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x53,0x03,
+0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,
+0x45,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,
+0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x28,0x00,
+0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,
+0x35,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
+0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x3B,0x00,
+0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x42,0x00,0x02,0x01,0x02,0x02,
+0x19,0x03,0x03,0x02,0x02,0x01,0x21,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME4_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    185, 41,  // Changed box top-left
+    103, 91,  // Changed box dimensions
     NEUTRAL_FRAME4_DATA
 };
 
-// Frame 5: Full frame RLE (2088 bytes)
-static const uint8_t NEUTRAL_FRAME5_DATA[2088] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x05,0x01,0x0D,0x02,0x04,0x01,
-0xFF,0x00,0x26,0x00,0x02,0x01,0x03,0x02,0x16,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,
-0x1D,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x02,0x02,
-0x34,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x02,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x01,0x01,0xFD,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0xFA,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0xF7,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0xF4,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0xF0,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0xEE,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x01,0x01,0xEC,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0xEA,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0xE8,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,
-0xE6,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0xE4,0x00,0x01,0x01,
-0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0xE3,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0xE2,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0xE0,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,
-0x01,0x02,0x01,0x01,0xDF,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
-0x07,0x01,0x09,0x02,0x05,0x01,0x64,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5F,0x00,
-0x02,0x01,0x03,0x02,0x16,0x03,0x03,0x02,0x02,0x01,0x5E,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x02,0x01,
-0x59,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,
-0x28,0x03,0x01,0x02,0x02,0x01,0x56,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x54,0x00,
-0x01,0x01,0x02,0x02,0x2E,0x03,0x01,0x02,0x02,0x01,0x53,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x4E,0x00,0x02,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
-0x4B,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x48,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
-0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x44,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x3C,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x3D,0x00,
-0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x3E,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,
-0x52,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x01,0x02,0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x49,0x00,
-0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x47,0x03,
-0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x50,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,
-0x56,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x02,0x02,0x56,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,
-0x5A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
-0x50,0x03,0x01,0x02,0x5E,0x00,0x02,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x02,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x66,0x00,
-0x02,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x65,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x01,0x01,0x6B,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x03,0x01,
-0x07,0x02,0x02,0x03,0x07,0x02,0x04,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0xFC,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x05,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,
-0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,
-0x02,0x02,0x2A,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x14,0x00,0x01,0x01,0x02,0x02,
-0x24,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x1B,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x24,0x00,0x02,0x01,0x04,0x02,0x0C,0x03,0x04,0x02,
-0x03,0x01,0xFF,0x00,0x34,0x00,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x11,0x00,
+// Frame 5: Diff RLE (1728 bytes)
+static const uint8_t NEUTRAL_FRAME5_DATA[1728] = {
+0xCA,0x00,0x05,0x01,0x0D,0x02,0x04,0x01,0xEF,0x00,0x02,0x01,0x03,0x02,0x16,0x03,
+0x03,0x02,0x02,0x01,0xE6,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x01,0x01,
+0xE0,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0xD9,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0xD3,0x00,0x01,0x01,0x02,0x02,0x34,0x03,
+0x01,0x02,0x01,0x01,0xCF,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0xCB,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0xC7,0x00,0x01,0x01,
+0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0xC4,0x00,0x01,0x02,0x45,0x03,0x01,0x02,
+0xC1,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0xBE,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x01,0x01,0xBA,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
+0x01,0x01,0xB8,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0xB6,0x00,
+0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0xB4,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
+0xB2,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0xB0,0x00,0x01,0x01,0x01,0x02,
+0x57,0x03,0x01,0x02,0x01,0x01,0xAE,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,
+0x01,0x01,0xAD,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0xAC,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x01,0xAA,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0xA9,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x07,0x01,0x09,0x02,0x05,0x01,
+0x64,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x29,0x00,0x02,0x01,0x03,0x02,0x16,0x03,
+0x03,0x02,0x02,0x01,0x5E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x24,0x00,
+0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x02,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
+0x62,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x02,0x01,
+0x56,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,
+0x01,0x02,0x02,0x01,0x53,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x65,0x03,
+0x01,0x01,0x18,0x00,0x02,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
+0x01,0x01,0x65,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x4C,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x01,0x02,
+0x40,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
+0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x46,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x01,0x0C,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
+0x08,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
+0x66,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,
+0x66,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,
+0x3D,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
+0x3D,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x3C,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x04,0x00,0x01,0x02,
+0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x03,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x03,0x00,0x01,0x01,
+0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x03,0x00,0x01,0x02,
+0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x00,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x00,
+0x01,0x01,0x64,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x02,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x02,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
+0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
+0x65,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x02,0x65,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
+0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,
+0x65,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x01,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
+0x02,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x63,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
+0x01,0x02,0x3D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x02,
+0x65,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x05,0x00,
+0x01,0x01,0x65,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x06,0x00,
+0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x08,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,
+0x5A,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x41,0x00,0x01,0x01,
+0x59,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x44,0x00,
+0x01,0x01,0x55,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,
+0x45,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
+0x11,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x4B,0x03,
+0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x4D,0x00,
+0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x02,0x50,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
+0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x02,0x02,0x20,0x00,0x01,0x02,
+0x52,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
+0x01,0x01,0x23,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x5E,0x00,0x02,0x01,0x01,0x02,
+0x2F,0x03,0x02,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x63,0x00,
+0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x02,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x66,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,
+0x2F,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x02,0x01,0x03,0x02,
+0x18,0x03,0x02,0x02,0x02,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x72,0x00,0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,0x04,0x01,0x39,0x00,
+0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0xC6,0x00,0x01,0x01,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x01,0x01,0xCA,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x01,0x01,0xCE,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xD2,0x00,
+0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x02,0x01,0xD7,0x00,0x01,0x01,0x02,0x02,
+0x2A,0x03,0x01,0x02,0x02,0x01,0xDD,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,
+0x01,0x01,0xE4,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xED,0x00,
+0x02,0x01,0x04,0x02,0x0C,0x03,0x04,0x02,0x03,0x01,0xFD,0x00,0x02,0x01,0xD4,0x00,
+
 };
 static const DiffBlock NEUTRAL_FRAME5_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    24, 35,  // Changed box top-left
+    266, 108,  // Changed box dimensions
     NEUTRAL_FRAME5_DATA
 };
 
-// Frame 6: Full frame RLE (2222 bytes)
-static const uint8_t NEUTRAL_FRAME6_DATA[2222] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2A,0x00,
-0x06,0x01,0x06,0x02,0x07,0x01,0xFF,0x00,0x28,0x00,0x03,0x01,0x02,0x02,0x16,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x1F,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x17,0x00,0x01,0x01,0x02,0x02,0x27,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x11,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,0x01,0x02,0x02,0x01,0x7B,0x00,
-0x05,0x01,0x0D,0x02,0x04,0x01,0x79,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
-0x01,0x01,0x74,0x00,0x02,0x01,0x03,0x02,0x16,0x03,0x03,0x02,0x02,0x01,0x71,0x00,
-0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x02,0x01,0x01,0x02,
-0x21,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x41,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,
-0x62,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,
-0x02,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x55,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,
-0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x60,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x3E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x3C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x37,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,
-0x65,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3C,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x60,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x3F,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0x41,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
-0x4B,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x51,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
-0x54,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,
-0x4B,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x02,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,
-0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x02,0x3B,0x03,0x02,0x02,
-0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x67,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,
-0x29,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
-0x01,0x01,0x72,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x71,0x00,
-0x01,0x01,0x02,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x03,0x02,
-0x18,0x03,0x02,0x02,0x02,0x01,0x78,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,
-0x01,0x01,0x82,0x00,0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,0x04,0x01,0x80,0x00,
-0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x22,0x00,0x02,0x01,
-0x04,0x02,0x0E,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,0x2E,0x00,0x0B,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD6,0x00,
+// Frame 6: Diff RLE (1678 bytes)
+static const uint8_t NEUTRAL_FRAME6_DATA[1678] = {
+0x2B,0x00,0x06,0x01,0x06,0x02,0x07,0x01,0xE4,0x00,0x03,0x01,0x02,0x02,0x16,0x03,
+0x02,0x02,0x02,0x01,0xDB,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,
+0xD3,0x00,0x01,0x01,0x02,0x02,0x27,0x03,0x02,0x02,0x01,0x01,0xCD,0x00,0x01,0x01,
+0x02,0x02,0x2E,0x03,0x01,0x02,0x02,0x01,0x7B,0x00,0x05,0x01,0x0D,0x02,0x04,0x01,
+0x36,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x02,0x01,
+0x03,0x02,0x16,0x03,0x03,0x02,0x02,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x01,0x02,0x01,0x01,0x6E,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x01,0x01,
+0x29,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x01,0x02,
+0x29,0x03,0x02,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x65,0x00,
+0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x02,0x02,0x34,0x03,0x01,0x02,
+0x01,0x01,0x1C,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x49,0x03,
+0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
+0x15,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,
+0x41,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,
+0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,
+0x47,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,
+0x01,0x01,0x4E,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x55,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,
+0x50,0x03,0x07,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,
+0x51,0x03,0x06,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x53,0x03,
+0x05,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x04,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,
+0x54,0x03,0x04,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
+0x01,0x02,0x55,0x03,0x03,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x41,0x00,
+0x01,0x02,0x56,0x03,0x03,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
+0x01,0x01,0x57,0x03,0x02,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,
+0x01,0x02,0x57,0x03,0x02,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,
+0x58,0x03,0x02,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
+0x59,0x03,0x01,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x59,0x03,
+0x01,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
+0x01,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
+0x01,0x02,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x65,0x03,
+0x01,0x02,0x3A,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x02,0x5B,0x03,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x5B,0x03,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x66,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
+0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,
+0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
+0x01,0x01,0x5B,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
+0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x5A,0x03,0x01,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x59,0x03,0x01,0x00,0x01,0x01,0x64,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x02,0x59,0x03,0x01,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x01,0x59,0x03,0x02,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
+0x3D,0x00,0x01,0x02,0x58,0x03,0x02,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3E,0x00,
+0x01,0x01,0x58,0x03,0x02,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x02,0x57,0x03,0x03,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
+0x01,0x02,0x56,0x03,0x03,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,0x41,0x00,
+0x01,0x01,0x56,0x03,0x04,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,
+0x55,0x03,0x05,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,
+0x01,0x02,0x54,0x03,0x05,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
+0x54,0x03,0x06,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x53,0x03,
+0x07,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x52,0x03,
+0x07,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
+0x50,0x03,0x09,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,
+0x01,0x02,0x4F,0x03,0x0A,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
+0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
+0x01,0x01,0x51,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
+0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
+0x5D,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,
+0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x02,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
+0x64,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x02,
+0x3B,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,
+0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,
+0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x02,0x02,0x01,0x01,0x72,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,
+0x01,0x01,0x2E,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x79,0x00,
+0x02,0x01,0x03,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x35,0x00,0x01,0x01,0x02,0x02,
+0x25,0x03,0x02,0x02,0x01,0x01,0x82,0x00,0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,
+0x04,0x01,0x3D,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xDE,0x00,
+0x02,0x01,0x04,0x02,0x0E,0x03,0x03,0x02,0x03,0x01,0xEA,0x00,0x0B,0x01,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB6,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME6_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    24, 31,  // Changed box top-left
+    253, 112,  // Changed box dimensions
     NEUTRAL_FRAME6_DATA
 };
 
-// Frame 7: Full frame RLE (2222 bytes)
-static const uint8_t NEUTRAL_FRAME7_DATA[2222] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2A,0x00,
-0x06,0x01,0x06,0x02,0x07,0x01,0xFF,0x00,0x28,0x00,0x03,0x01,0x02,0x02,0x16,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x1F,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x17,0x00,0x01,0x01,0x02,0x02,0x27,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x11,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,0x01,0x02,0x02,0x01,0x7B,0x00,
-0x05,0x01,0x0D,0x02,0x04,0x01,0x79,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
-0x01,0x01,0x74,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x03,0x02,0x02,0x01,0x71,0x00,
-0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x02,0x01,0x01,0x02,
-0x21,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x41,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,
-0x62,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,
-0x02,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x55,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
-0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x50,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x43,0x00,
-0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x40,0x00,0x01,0x02,
-0x60,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x3E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x3C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x37,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3B,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,
-0x01,0x02,0x60,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x3F,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0x41,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x57,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
-0x4B,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x51,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
-0x54,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,
-0x4B,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
-0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x02,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,
-0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x02,0x3B,0x03,0x02,0x02,
-0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x67,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,
-0x29,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
-0x01,0x01,0x72,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x71,0x00,
-0x01,0x01,0x02,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x03,0x02,
-0x18,0x03,0x02,0x02,0x02,0x01,0x78,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,
-0x01,0x01,0x82,0x00,0x03,0x01,0x07,0x02,0x02,0x03,0x07,0x02,0x04,0x01,0x80,0x00,
-0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x22,0x00,0x02,0x01,
-0x04,0x02,0x0E,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,0x2E,0x00,0x0B,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD6,0x00,
+// Frame 7: Diff RLE (520 bytes)
+static const uint8_t NEUTRAL_FRAME7_DATA[520] = {
+0x5D,0x00,0x02,0x01,0x02,0x02,0x01,0x03,0x59,0x00,0x02,0x01,0x01,0x02,0x06,0x03,
+0x56,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x53,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x50,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,0x4E,0x00,0x01,0x01,0x01,0x02,0x12,0x03,
+0x4C,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x4A,0x00,0x01,0x01,0x01,0x02,0x16,0x03,
+0x48,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x47,0x00,0x01,0x01,0x01,0x02,0x19,0x03,
+0x46,0x00,0x01,0x02,0x1B,0x03,0x44,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x43,0x00,
+0x01,0x01,0x01,0x02,0x1D,0x03,0x42,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x41,0x00,
+0x01,0x01,0x20,0x03,0x40,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x21,0x03,0x3E,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x3E,0x00,0x01,0x02,
+0x23,0x03,0x3D,0x00,0x01,0x01,0x24,0x03,0x3C,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
+0x3C,0x00,0x01,0x02,0x25,0x03,0x3B,0x00,0x01,0x01,0x26,0x03,0x3B,0x00,0x01,0x02,
+0x26,0x03,0x3A,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x3A,0x00,0x01,0x02,0x27,0x03,
+0x3A,0x00,0x01,0x02,0x27,0x03,0x39,0x00,0x01,0x01,0x28,0x03,0x39,0x00,0x01,0x01,
+0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,0x38,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x38,0x00,0x01,0x01,0x29,0x03,0x38,0x00,0x01,0x01,0x29,0x03,0x38,0x00,0x01,0x01,
+0x29,0x03,0x38,0x00,0x01,0x01,0x29,0x03,0x38,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x38,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x38,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x38,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x38,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x38,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,0x39,0x00,
+0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,
+0x39,0x00,0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x02,
+0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,0x39,0x00,
+0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x02,0x28,0x03,
+0x39,0x00,0x01,0x02,0x28,0x03,0x39,0x00,0x01,0x01,0x28,0x03,0x39,0x00,0x01,0x01,
+0x28,0x03,0x39,0x00,0x01,0x01,0x28,0x03,0x39,0x00,0x01,0x01,0x28,0x03,0x39,0x00,
+0x01,0x01,0x28,0x03,0x39,0x00,0x01,0x01,0x28,0x03,0x39,0x00,0x01,0x01,0x28,0x03,
+0x39,0x00,0x01,0x01,0x28,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x28,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x28,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x27,0x03,0x3A,0x00,0x01,0x02,0x27,0x03,0x3A,0x00,0x01,0x01,0x27,0x03,0x3B,0x00,
+0x01,0x02,0x26,0x03,0x3B,0x00,0x01,0x02,0x26,0x03,0x3B,0x00,0x01,0x01,0x26,0x03,
+0x3C,0x00,0x01,0x02,0x25,0x03,0x3C,0x00,0x01,0x01,0x25,0x03,0x3D,0x00,0x01,0x02,
+0x24,0x03,0x3D,0x00,0x01,0x01,0x24,0x03,
 };
 static const DiffBlock NEUTRAL_FRAME7_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    128, 36,  // Changed box top-left
+    98, 76,  // Changed box dimensions
     NEUTRAL_FRAME7_DATA
 };
 
-// Frame 8: Full frame RLE (2172 bytes)
-static const uint8_t NEUTRAL_FRAME8_DATA[2172] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2E,0x00,0x05,0x01,0x0C,0x02,0x04,0x01,
-0x8B,0x00,0x05,0x01,0x0D,0x02,0x04,0x01,0x85,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
+// Frame 8: Diff RLE (1814 bytes)
+static const uint8_t NEUTRAL_FRAME8_DATA[1814] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x56,0x00,0x05,0x01,0x0C,0x02,0x04,0x01,
+0x8B,0x00,0x05,0x01,0x0D,0x02,0x04,0x01,0x4F,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
 0x02,0x02,0x02,0x01,0x81,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0x7C,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x01,0x01,
-0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x75,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
+0x46,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
 0x01,0x02,0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,
-0x6F,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
+0x39,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,
+0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
 0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
+0x2F,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
 0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
+0x28,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
+0x41,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
+0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x21,0x00,
 0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
+0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
+0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
+0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x18,0x00,
 0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x48,0x00,0x01,0x01,
-0x01,0x02,0x55,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x00,
+0x50,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
+0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x12,0x00,0x01,0x01,
+0x01,0x02,0x55,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x10,0x00,
 0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x44,0x00,0x01,0x01,
-0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
+0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x44,0x00,0x01,0x01,
+0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x42,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
 0x01,0x02,0x5D,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x38,0x00,
+0x09,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
+0x01,0x01,0x07,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x07,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
+0x63,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
+0x01,0x02,0x63,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,
+0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x03,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x02,0x00,0x01,0x01,
+0x01,0x02,0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x02,0x00,
 0x01,0x01,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
+0x01,0x01,0x01,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
+0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,
 0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x41,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x47,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x49,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x4B,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4E,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x4B,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x55,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
-0x3A,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,
-0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,
-0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0x83,0x00,0x03,0x01,0x07,0x02,0x04,0x03,0x05,0x02,
-0x03,0x01,0x82,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,
-0x25,0x00,0x04,0x01,0x0E,0x02,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x12,0x00,
+0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x02,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
+0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
+0x66,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
+0x66,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,
+0x01,0x02,0x02,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
+0x65,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
+0x01,0x02,0x64,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3C,0x00,
+0x01,0x02,0x63,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3C,0x00,
+0x01,0x01,0x63,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3D,0x00,
+0x01,0x02,0x61,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3E,0x00,
+0x01,0x01,0x61,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x40,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
+0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x44,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x58,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x11,0x00,0x01,0x02,
+0x56,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x13,0x00,0x01,0x02,
+0x54,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x15,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x48,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
+0x01,0x01,0x57,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,
+0x22,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,
+0x01,0x02,0x3E,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,
+0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x28,0x00,
+0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,
+0x35,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x68,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
+0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,
+0x29,0x03,0x02,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,
+0x01,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x3C,0x00,
+0x02,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x02,0x01,0x03,0x02,
+0x18,0x03,0x03,0x02,0x02,0x01,0x42,0x00,0x02,0x01,0x01,0x02,0x23,0x03,0x02,0x02,
+0x01,0x01,0x83,0x00,0x03,0x01,0x07,0x02,0x04,0x03,0x05,0x02,0x03,0x01,0x4C,0x00,
+0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,0x01,0x01,0xEE,0x00,0x04,0x01,0x0E,0x02,
+0x05,0x01,0xFF,0x00,0xD6,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME8_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    24, 31,  // Changed box top-left
+    266, 105,  // Changed box dimensions
     NEUTRAL_FRAME8_DATA
 };
 
-// Frame 9: Full frame RLE (2172 bytes)
-static const uint8_t NEUTRAL_FRAME9_DATA[2172] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2E,0x00,0x05,0x01,0x0C,0x02,0x04,0x01,
-0x8B,0x00,0x05,0x01,0x0D,0x02,0x04,0x01,0x85,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
-0x02,0x02,0x02,0x01,0x81,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0x7C,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x01,0x01,
-0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x75,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,
-0x6F,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
-0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x48,0x00,0x01,0x01,
-0x01,0x02,0x55,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x44,0x00,0x01,0x01,
-0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x41,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x47,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x49,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x4B,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4E,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x4B,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x55,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
-0x3A,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,
-0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,
-0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0x83,0x00,0x03,0x01,0x07,0x02,0x04,0x03,0x05,0x02,
-0x03,0x01,0x82,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,
-0x25,0x00,0x04,0x01,0x0E,0x02,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x12,0x00,
-};
-static const DiffBlock NEUTRAL_FRAME9_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    NEUTRAL_FRAME9_DATA
-};
-
-// Frame 10: Full frame RLE (2172 bytes)
-static const uint8_t NEUTRAL_FRAME10_DATA[2172] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2E,0x00,0x05,0x01,0x0C,0x02,0x04,0x01,
-0x8B,0x00,0x05,0x01,0x0D,0x02,0x04,0x01,0x85,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
-0x02,0x02,0x02,0x01,0x81,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0x7C,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x01,0x01,
-0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x75,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,
-0x6F,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
-0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x02,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x48,0x00,0x01,0x01,
-0x01,0x02,0x55,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x46,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x44,0x00,0x01,0x01,
-0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x40,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x64,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x63,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x41,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x47,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x49,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x4B,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4E,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x52,0x00,0x01,0x02,
-0x4B,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
-0x55,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
-0x3A,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,
-0x01,0x01,0x72,0x00,0x02,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,
-0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0x83,0x00,0x03,0x01,0x07,0x02,0x04,0x03,0x05,0x02,
-0x03,0x01,0x82,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,
-0x25,0x00,0x04,0x01,0x0E,0x02,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x12,0x00,
-};
-static const DiffBlock NEUTRAL_FRAME10_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    NEUTRAL_FRAME10_DATA
-};
-
-// Frame 11: Full frame RLE (2126 bytes)
-static const uint8_t NEUTRAL_FRAME11_DATA[2126] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF0,0x00,
-0x02,0x01,0x08,0x02,0x04,0x03,0x07,0x02,0x03,0x01,0xFF,0x00,0x25,0x00,0x01,0x01,
-0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1D,0x00,0x01,0x01,0x02,0x02,
-0x21,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,
-0x02,0x01,0x7B,0x00,0x03,0x01,0x0F,0x02,0x04,0x01,0x78,0x00,0x02,0x01,0x01,0x02,
+// Frame 9: no change
+
+// Frame 10: no change
+
+// Frame 11: Diff RLE (1772 bytes)
+static const uint8_t NEUTRAL_FRAME11_DATA[1772] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4A,0x00,0x02,0x01,0x08,0x02,0x04,0x03,0x07,0x02,
+0x03,0x01,0xEE,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0xE6,0x00,
+0x01,0x01,0x02,0x02,0x21,0x03,0x02,0x02,0x02,0x01,0xDF,0x00,0x01,0x01,0x01,0x02,
+0x29,0x03,0x01,0x02,0x02,0x01,0xD9,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,
+0x02,0x01,0x7B,0x00,0x03,0x01,0x0F,0x02,0x04,0x01,0x42,0x00,0x02,0x01,0x01,0x02,
 0x34,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x02,0x02,
-0x03,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,
+0x03,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
+0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,
 0x3D,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
+0x01,0x01,0x31,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,
+0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
 0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,
-0x59,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x4D,0x03,
+0x28,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,
+0x59,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x4D,0x03,
 0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,
+0x1E,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,
+0x45,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,
+0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x19,0x00,0x01,0x01,
 0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x49,0x00,
-0x01,0x02,0x59,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
+0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
+0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x13,0x00,
+0x01,0x02,0x59,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x11,0x00,
+0x01,0x02,0x5B,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x0F,0x00,
 0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
-0x43,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,
-0x01,0x02,0x5A,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
+0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x61,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x62,0x03,
+0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
 0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,
-0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x62,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,
+0x06,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x01,0x01,0x04,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
+0x62,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
+0x63,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,
+0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x65,0x03,
+0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x02,0x00,
 0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x64,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x65,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x02,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
+0x65,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
+0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x66,0x03,
+0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x65,0x03,
+0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,
 0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,
+0x01,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
+0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x01,0x02,
+0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,
+0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,
 0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
-0x01,0x01,0x37,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x65,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x64,0x03,
-0x3A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x44,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x43,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x56,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x47,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x49,0x00,
-0x01,0x02,0x52,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x51,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x53,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,
-0x48,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x55,0x00,
-0x01,0x01,0x46,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
-0x3A,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x66,0x00,
-0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x31,0x03,0x02,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,
-0x01,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x70,0x00,
-0x02,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x77,0x00,0x02,0x01,0x02,0x02,
-0x24,0x03,0x01,0x02,0x02,0x01,0x77,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,
-0x02,0x01,0x7E,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x03,0x02,0x01,0x01,0x80,0x00,
-0x03,0x01,0x03,0x02,0x0D,0x03,0x04,0x02,0x03,0x01,0x88,0x00,0x03,0x01,0x03,0x02,
-0x0D,0x03,0x04,0x02,0x02,0x01,0x8D,0x00,0x0A,0x01,0x98,0x00,0x09,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x35,0x00,
+0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x02,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
+0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x67,0x03,0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
+0x02,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x02,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x02,0x01,0x01,0x02,
+0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x01,0x00,
+0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x02,0x00,
+0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x03,0x00,
+0x01,0x02,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x03,0x00,
+0x01,0x02,0x63,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x64,0x03,0x04,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x05,0x00,0x01,0x02,
+0x61,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x05,0x00,
+0x01,0x01,0x60,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x07,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,
+0x07,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
+0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x49,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
+0x01,0x01,0x4A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x52,0x03,
+0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,0x15,0x00,0x01,0x02,
+0x50,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,
+0x17,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
+0x19,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,
+0x01,0x01,0x56,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x46,0x03,
+0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x21,0x00,
+0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x43,0x03,
+0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
+0x60,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x68,0x00,
+0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
+0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x72,0x00,
+0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x3A,0x00,0x02,0x01,0x02,0x02,
+0x24,0x03,0x02,0x02,0x01,0x01,0x77,0x00,0x02,0x01,0x02,0x02,0x24,0x03,0x01,0x02,
+0x02,0x01,0x41,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x7E,0x00,
+0x02,0x01,0x02,0x02,0x1B,0x03,0x03,0x02,0x01,0x01,0x4A,0x00,0x03,0x01,0x03,0x02,
+0x0D,0x03,0x04,0x02,0x03,0x01,0x88,0x00,0x03,0x01,0x03,0x02,0x0D,0x03,0x04,0x02,
+0x02,0x01,0x57,0x00,0x0A,0x01,0x98,0x00,0x09,0x01,0x30,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME11_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    24, 35,  // Changed box top-left
+    266, 101,  // Changed box dimensions
     NEUTRAL_FRAME11_DATA
 };
 
-// Frame 12: Full frame RLE (2128 bytes)
-static const uint8_t NEUTRAL_FRAME12_DATA[2128] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF0,0x00,
-0x02,0x01,0x08,0x02,0x04,0x03,0x07,0x02,0x03,0x01,0xFF,0x00,0x25,0x00,0x01,0x01,
-0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1D,0x00,0x01,0x01,0x02,0x02,
-0x21,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,
-0x02,0x01,0x7B,0x00,0x03,0x01,0x0F,0x02,0x04,0x01,0x78,0x00,0x02,0x01,0x01,0x02,
-0x34,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x02,0x02,
-0x03,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
-0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,
-0x59,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x58,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,
-0x45,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x49,0x00,
-0x01,0x02,0x59,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x47,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x45,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
-0x43,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,
-0x58,0x03,0x01,0x01,0x42,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,
-0x01,0x02,0x5A,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x41,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,
-0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x62,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x64,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x65,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
-0x01,0x01,0x37,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x65,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x64,0x03,
-0x3A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x3D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x44,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x43,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x56,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x47,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x49,0x00,
-0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x52,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,
-0x01,0x02,0x50,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x51,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,
-0x53,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,
-0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
-0x02,0x02,0x01,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,
-0x70,0x00,0x02,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x77,0x00,0x02,0x01,
-0x02,0x02,0x24,0x03,0x01,0x02,0x02,0x01,0x77,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,
-0x02,0x02,0x02,0x01,0x7E,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x03,0x02,0x01,0x01,
-0x80,0x00,0x03,0x01,0x03,0x02,0x0D,0x03,0x04,0x02,0x03,0x01,0x88,0x00,0x03,0x01,
-0x03,0x02,0x0D,0x03,0x04,0x02,0x02,0x01,0x8D,0x00,0x0A,0x01,0x98,0x00,0x09,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x35,0x00,
-
+// Frame 12: Diff RLE (2 bytes)
+static const uint8_t NEUTRAL_FRAME12_DATA[2] = {
+0x01,0x01,
 };
 static const DiffBlock NEUTRAL_FRAME12_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    118, 120,  // Changed box top-left
+    1, 1,  // Changed box dimensions
     NEUTRAL_FRAME12_DATA
 };
 
-// Frame 13: Full frame RLE (2142 bytes)
-static const uint8_t NEUTRAL_FRAME13_DATA[2142] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF0,0x00,
-0x02,0x01,0x07,0x02,0x05,0x03,0x07,0x02,0x03,0x01,0xFF,0x00,0x25,0x00,0x01,0x01,
-0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1D,0x00,0x01,0x01,0x02,0x02,
-0x21,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x0A,0x00,0x02,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x02,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0xFE,0x00,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0xFA,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x01,0x01,0xF6,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x76,0x00,
-0x0B,0x01,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x6C,0x00,0x03,0x01,0x03,0x02,
-0x0F,0x03,0x04,0x02,0x02,0x01,0x6B,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x64,0x00,0x01,0x01,
-0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x02,0x01,0x01,0x02,0x25,0x03,
-0x02,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,
-0x57,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x52,0x00,0x01,0x01,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x48,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x49,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x47,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,
-0x42,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x3C,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,
-0x3C,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x65,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x60,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,
-0x64,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
-0x64,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x02,0x62,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x40,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,
-0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x01,0x02,0x59,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
-0x01,0x01,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x59,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,
-0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
-0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x37,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,0x02,0x02,0x24,0x03,
-0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
-0x71,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0x78,0x00,0x03,0x01,0x03,0x02,0x0D,0x03,
-0x04,0x02,0x03,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x02,0x02,0x01,0x01,
-0x83,0x00,0x0A,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0x1F,0x00,0x03,0x01,0x03,0x02,0x11,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,
-0x2A,0x00,0x0F,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xAF,0x00,
+// Frame 13: Diff RLE (1520 bytes)
+static const uint8_t NEUTRAL_FRAME13_DATA[1520] = {
+0x05,0x03,0x07,0x02,0x03,0x01,0xC9,0x00,0x0F,0x03,0x02,0x02,0x02,0x01,0xC5,0x00,
+0x13,0x03,0x02,0x02,0x02,0x01,0xC1,0x00,0x17,0x03,0x01,0x02,0x02,0x01,0xBE,0x00,
+0x1A,0x03,0x01,0x02,0x02,0x01,0xBB,0x00,0x1D,0x03,0x01,0x02,0x01,0x01,0xB9,0x00,
+0x1F,0x03,0x01,0x02,0x01,0x01,0xB7,0x00,0x21,0x03,0x01,0x02,0x01,0x01,0xB5,0x00,
+0x23,0x03,0x01,0x02,0x01,0x01,0xB3,0x00,0x25,0x03,0x01,0x02,0x01,0x01,0xB1,0x00,
+0x26,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x0B,0x01,0x2F,0x00,0x28,0x03,0x01,0x02,
+0x6C,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x04,0x02,0x02,0x01,0x28,0x00,0x29,0x03,
+0x01,0x02,0x01,0x01,0x66,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,
+0x23,0x00,0x2A,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x02,0x01,0x01,0x02,0x25,0x03,
+0x02,0x02,0x01,0x01,0x20,0x00,0x2B,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,
+0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x1C,0x00,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x5A,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x2D,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
+0x18,0x00,0x2E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
+0x01,0x02,0x01,0x01,0x16,0x00,0x2F,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
+0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x30,0x03,0x01,0x02,0x01,0x01,
+0x4D,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x31,0x03,0x01,0x02,
+0x4B,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x32,0x03,
+0x01,0x01,0x49,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x0E,0x00,0x32,0x03,0x01,0x02,
+0x47,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x33,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x33,0x03,
+0x01,0x02,0x44,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x33,0x03,
+0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x34,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x34,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x01,0x07,0x00,0x34,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x07,0x00,0x34,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x01,0x06,0x00,0x34,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x02,0x01,0x01,0x05,0x00,0x34,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x34,0x03,0x01,0x02,0x01,0x01,
+0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x04,0x00,0x34,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x34,0x03,
+0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x03,0x00,0x34,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x03,0x00,
+0x34,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x01,0x01,
+0x02,0x00,0x34,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,
+0x02,0x00,0x35,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,
+0x01,0x00,0x35,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
+0x01,0x00,0x35,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x01,0x00,
+0x35,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x01,0x00,0x35,0x03,
+0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x35,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x35,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x35,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
+0x01,0x02,0x01,0x00,0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x01,0x00,0x35,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,
+0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x35,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x35,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x35,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x35,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x01,0x01,0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
+0x01,0x02,0x01,0x01,0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x01,0x01,0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
+0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x35,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x35,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x67,0x03,0x01,0x01,0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x01,0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
+0x35,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x35,0x03,
+0x01,0x02,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x35,0x03,0x01,0x01,0x3A,0x00,
+0x01,0x02,0x66,0x03,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,
+0x66,0x03,0x01,0x01,0x34,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
+0x01,0x01,0x34,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x00,
+0x34,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x01,0x00,0x33,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x01,0x00,0x33,0x03,
+0x01,0x01,0x3D,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x01,0x00,0x32,0x03,0x01,0x02,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x02,0x00,0x32,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x02,0x00,0x31,0x03,0x01,0x02,0x40,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x03,0x00,0x30,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
+0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x03,0x00,0x30,0x03,0x01,0x01,0x42,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x04,0x00,0x2F,0x03,0x01,0x02,0x44,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x01,0x04,0x00,0x2E,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x05,0x00,0x2D,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x02,0x06,0x00,0x2C,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
+0x59,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x2B,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x07,0x00,0x2A,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
+0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x29,0x03,0x01,0x02,0x4F,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x28,0x03,0x01,0x01,0x51,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x26,0x03,0x01,0x02,0x01,0x01,
+0x53,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x25,0x03,0x01,0x01,
+0x56,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x23,0x03,
+0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,
+0x0E,0x00,0x21,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x46,0x03,
+0x01,0x02,0x01,0x01,0x0F,0x00,0x20,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x1D,0x03,0x01,0x02,0x01,0x01,
+0x63,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x13,0x00,0x1A,0x03,0x02,0x02,
+0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x14,0x00,
+0x17,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x02,0x02,
+0x01,0x01,0x16,0x00,0x14,0x03,0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x10,0x03,0x02,0x02,0x02,0x01,0x77,0x00,
+0x01,0x01,0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0x1B,0x00,0x08,0x03,0x04,0x02,
+0x03,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x02,0x02,0x01,0x01,0x1E,0x00,
+0x07,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0xB6,0x00,
+0x03,0x01,0x03,0x02,0x11,0x03,0x04,0x02,0x03,0x01,0xC1,0x00,0x0F,0x01,0x2D,0x00,
+
 };
 static const DiffBlock NEUTRAL_FRAME13_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    74, 38,  // Changed box top-left
+    216, 100,  // Changed box dimensions
     NEUTRAL_FRAME13_DATA
 };
 
-// Frame 14: Full frame RLE (2142 bytes)
-static const uint8_t NEUTRAL_FRAME14_DATA[2142] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF0,0x00,
-0x02,0x01,0x07,0x02,0x05,0x03,0x07,0x02,0x03,0x01,0xFF,0x00,0x25,0x00,0x01,0x01,
-0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1D,0x00,0x01,0x01,0x02,0x02,
-0x21,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x0A,0x00,0x02,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x02,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0xFE,0x00,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0xFA,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x01,0x01,0xF6,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x76,0x00,
-0x0B,0x01,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x6C,0x00,0x03,0x01,0x03,0x02,
-0x0F,0x03,0x04,0x02,0x02,0x01,0x6B,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x64,0x00,0x01,0x01,
-0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x02,0x01,0x01,0x02,0x25,0x03,
-0x02,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,
-0x57,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x52,0x00,0x01,0x01,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x48,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x49,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x47,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x42,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x01,0x41,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,
-0x56,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x40,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,
-0x64,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,
-0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x01,0x02,0x62,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
-0x64,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x39,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x64,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
-0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
-0x01,0x01,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x59,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x56,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,
-0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
-0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+// Frame 14: Diff RLE (898 bytes)
+static const uint8_t NEUTRAL_FRAME14_DATA[898] = {
+0x3E,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x05,0x00,0x3E,0x03,
+0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x01,0x04,0x00,
+0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,
+0x01,0x01,0x02,0x00,0x3F,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x02,0x00,0x3F,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
+0x01,0x00,0x3F,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x9F,0x03,0x01,0x02,
+0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x9F,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
+0x01,0x01,0xA0,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0xA0,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0xA1,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
+0x01,0x02,0xA2,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0xA2,0x03,0x01,0x01,0x39,0x00,
+0x01,0x01,0x01,0x02,0xA2,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x01,
+0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0xA3,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0xA3,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0xA3,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0xA3,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x01,
+0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0xA3,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x01,0x02,0xA2,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
+0xA2,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0xA2,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x01,0x02,0xA2,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0xA1,0x03,0x01,0x02,
+0x01,0x01,0x3A,0x00,0x01,0x02,0xA1,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0xA1,0x03,
+0x01,0x02,0x3B,0x00,0x01,0x02,0xA1,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0xA0,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x9F,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
+0x9E,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x9E,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x02,0x9C,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x9B,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x01,0x01,0x02,0x9A,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x99,0x03,
+0x01,0x02,0x44,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0x44,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x38,0x03,0x01,0x02,0x47,0x00,
+0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x00,0x37,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x59,0x03,0x01,0x02,0x02,0x00,0x36,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
+0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x35,0x03,0x01,0x02,0x01,0x01,
+0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x34,0x03,0x01,0x02,
+0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x33,0x03,0x01,0x01,
+0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x31,0x03,0x01,0x02,
+0x01,0x01,0x53,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x30,0x03,
+0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
+0x2E,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x2C,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,
+0x46,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x2B,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,
+0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x28,0x03,0x01,0x02,
+0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x0E,0x00,0x25,0x03,
 0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x01,0x02,0x37,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,0x02,0x02,0x24,0x03,
-0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
-0x71,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,
-0x04,0x02,0x03,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x02,0x02,0x01,0x01,
-0x83,0x00,0x0A,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0x1F,0x00,0x03,0x01,0x04,0x02,0x10,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,
-0x2A,0x00,0x0F,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xAF,0x00,
+0x0F,0x00,0x22,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x37,0x03,
+0x02,0x02,0x01,0x01,0x11,0x00,0x1F,0x03,0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,
+0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x1B,0x03,0x02,0x02,0x02,0x01,
+0x77,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0x17,0x00,0x02,0x01,
+0x03,0x02,0x0D,0x03,0x04,0x02,0x03,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x02,0x02,0x01,0x01,0x21,0x00,0x0A,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,
+0x02,0x02,0x02,0x01,0xBC,0x00,0x03,0x01,0x04,0x02,0x10,0x03,0x04,0x02,0x03,0x01,
+0x20,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME14_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    63, 63,  // Changed box top-left
+    222, 74,  // Changed box dimensions
     NEUTRAL_FRAME14_DATA
 };
 
-// Frame 15: Full frame RLE (2140 bytes)
-static const uint8_t NEUTRAL_FRAME15_DATA[2140] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF0,0x00,
-0x02,0x01,0x07,0x02,0x05,0x03,0x07,0x02,0x03,0x01,0xFF,0x00,0x25,0x00,0x01,0x01,
-0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1D,0x00,0x01,0x01,0x02,0x02,
-0x21,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x0A,0x00,0x02,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x02,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0xFE,0x00,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0xFA,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x01,0x01,0xF6,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x76,0x00,
-0x0B,0x01,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x6C,0x00,0x03,0x01,0x03,0x02,
-0x0F,0x03,0x04,0x02,0x02,0x01,0x6B,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x64,0x00,0x01,0x01,
-0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x02,0x01,0x01,0x02,0x25,0x03,
-0x02,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x02,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,
-0x57,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,
-0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x52,0x00,0x01,0x01,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x48,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x49,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x47,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x42,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x01,0x41,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,
-0x56,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x40,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,
-0x64,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,
-0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x01,0x02,0x62,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x64,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x39,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x64,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x62,0x03,
-0x01,0x01,0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,
-0x01,0x02,0x60,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x44,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x47,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x02,0x4E,0x03,
-0x01,0x02,0x4F,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,
-0x01,0x02,0x4B,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x01,0x01,
-0x4E,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x56,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,
-0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x02,0x3C,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,
-0x5E,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x66,0x00,
-0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x37,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,0x02,0x02,0x24,0x03,0x02,0x02,
-0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x71,0x00,
-0x03,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x04,0x02,
-0x03,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x02,0x02,0x01,0x01,0x83,0x00,
-0x0A,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1F,0x00,0x03,0x01,0x04,0x02,0x10,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,0x2A,0x00,
-0x0F,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xAF,0x00,
+// Frame 15: Diff RLE (2 bytes)
+static const uint8_t NEUTRAL_FRAME15_DATA[2] = {
+0x01,0x03,
 };
 static const DiffBlock NEUTRAL_FRAME15_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    186, 100,  // Changed box top-left
+    1, 1,  // Changed box dimensions
     NEUTRAL_FRAME15_DATA
 };
 
-// Frame 16: Full frame RLE (2092 bytes)
-static const uint8_t NEUTRAL_FRAME16_DATA[2092] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF0,0x00,
-0x02,0x01,0x07,0x02,0x05,0x03,0x07,0x02,0x03,0x01,0xFF,0x00,0x24,0x00,0x02,0x01,
-0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x1C,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x15,0x00,0x01,0x01,0x02,0x02,0x29,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x02,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,0xFD,0x00,0x01,0x01,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x0F,0x01,0x75,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,0x03,0x02,0x12,0x03,0x04,0x02,0x02,0x01,
-0x6C,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x68,0x00,0x02,0x01,0x02,0x02,
-0x1E,0x03,0x03,0x02,0x02,0x01,0x65,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,
-0x63,0x00,0x01,0x01,0x02,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x5B,0x00,
-0x02,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x02,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x51,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,
-0x55,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x46,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x44,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x43,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,
-0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x3B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x46,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,
-0x52,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x56,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x51,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
-0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x3C,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x02,0x02,
-0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x70,0x00,
-0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x02,0x02,0x01,0x01,0x78,0x00,0x03,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,
-0x03,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x82,0x00,
-0x0B,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1F,0x00,0x03,0x01,0x04,0x02,0x10,0x03,0x03,0x02,0x04,0x01,0xFF,0x00,0x2A,0x00,
-0x0F,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xAF,0x00,
+// Frame 16: Diff RLE (1656 bytes)
+static const uint8_t NEUTRAL_FRAME16_DATA[1656] = {
+0x23,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0xE4,0x00,0x02,0x01,
+0x01,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0xDD,0x00,0x01,0x01,0x02,0x02,0x29,0x03,
+0x02,0x02,0x01,0x01,0xD8,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,
+0xD2,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xCE,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xCA,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
+0x01,0x01,0xC6,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x76,0x00,
+0x0F,0x01,0x3E,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,
+0x03,0x02,0x12,0x03,0x04,0x02,0x02,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
+0x01,0x01,0x68,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x03,0x02,0x02,0x01,0x2E,0x00,
+0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x02,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
+0x5F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,
+0x01,0x02,0x50,0x03,0x01,0x01,0x5B,0x00,0x02,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
+0x02,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x58,0x00,
+0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,
+0x53,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x52,0x00,
+0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,
+0x57,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
+0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
+0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x4B,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,
+0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x50,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x46,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x43,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x42,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
+0x3E,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x64,0x03,
+0x01,0x02,0x3E,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x64,0x03,
+0x01,0x02,0x3D,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x04,0x00,
+0x66,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x03,0x00,
+0x66,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x03,0x00,0x66,0x03,
+0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x02,0x00,
+0x66,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x02,0x00,0x66,0x03,
+0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x02,0x00,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,0x02,0x00,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
+0x01,0x01,0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x01,0x39,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,
+0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
+0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
+0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,
+0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,
+0x66,0x03,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,
+0x02,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,
+0x01,0x02,0x63,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
+0x01,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,
+0x64,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x3D,0x00,
+0x01,0x02,0x64,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,
+0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
+0x40,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x02,0x0E,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
+0x59,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,
+0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x11,0x00,0x01,0x02,
+0x50,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,
+0x13,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
+0x15,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,
+0x50,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
+0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,
+0x1F,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x47,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,
+0x5E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x01,0x02,
+0x36,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
+0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
+0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x02,0x01,0x01,0x02,
+0x2C,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
+0x01,0x01,0x33,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x71,0x00,
+0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x02,0x01,0x02,0x02,
+0x1C,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x02,0x02,
+0x01,0x01,0x41,0x00,0x03,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x03,0x01,0x7F,0x00,
+0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x0B,0x01,0x8A,0x00,
+0x02,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0xE7,0x00,0x03,0x01,0x04,0x02,
+0x10,0x03,0x03,0x02,0x04,0x01,0x25,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME16_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    25, 39,  // Changed box top-left
+    265, 98,  // Changed box dimensions
     NEUTRAL_FRAME16_DATA
 };
 
-// Frame 17: Full frame RLE (2092 bytes)
-static const uint8_t NEUTRAL_FRAME17_DATA[2092] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF0,0x00,
-0x02,0x01,0x07,0x02,0x06,0x03,0x06,0x02,0x03,0x01,0xFF,0x00,0x24,0x00,0x02,0x01,
-0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x1C,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x15,0x00,0x02,0x01,0x01,0x02,0x29,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x0A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x06,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x02,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,0xFD,0x00,0x01,0x01,0x01,0x02,
-0x41,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x0F,0x01,0x75,0x00,0x01,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,0x03,0x02,0x12,0x03,0x04,0x02,0x02,0x01,
-0x6C,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x68,0x00,0x02,0x01,0x02,0x02,
-0x1E,0x03,0x03,0x02,0x02,0x01,0x65,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,
-0x63,0x00,0x01,0x01,0x02,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x5B,0x00,
-0x02,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x02,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x51,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,
-0x55,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,
-0x4C,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x46,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x44,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x43,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x40,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,
-0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x3B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x61,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x46,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,
-0x52,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x48,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x56,0x03,0x01,0x01,0x4A,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x51,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
-0x01,0x01,0x55,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x3C,0x03,
-0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
-0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x02,0x02,
-0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x70,0x00,
-0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x02,0x02,0x01,0x01,0x78,0x00,0x03,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,
-0x03,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x82,0x00,
-0x0B,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x1F,0x00,0x03,0x01,0x04,0x02,0x10,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,0x2A,0x00,
-0x0F,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xAF,0x00,
+// Frame 17: Diff RLE (968 bytes)
+static const uint8_t NEUTRAL_FRAME17_DATA[968] = {
+0x0B,0x00,0x02,0x01,0x07,0x02,0x06,0x03,0x06,0x02,0x03,0x01,0xA7,0x00,0x02,0x01,
+0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x9F,0x00,0x02,0x01,0x01,0x02,0x23,0x03,
+0x02,0x02,0x01,0x01,0x99,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,
+0x96,0x00,0x2E,0x03,0x02,0x02,0x01,0x01,0x93,0x00,0x31,0x03,0x01,0x02,0x01,0x01,
+0x91,0x00,0x33,0x03,0x01,0x02,0x01,0x01,0x8F,0x00,0x36,0x03,0x01,0x01,0x8D,0x00,
+0x37,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x0F,0x01,0x06,0x00,0x39,0x03,0x01,0x02,
+0x01,0x01,0x6D,0x00,0x02,0x01,0x03,0x02,0x12,0x03,0x04,0x02,0x01,0x01,0x3B,0x03,
+0x01,0x01,0x68,0x00,0x02,0x01,0x02,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
+0x01,0x01,0x02,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,
+0x63,0x03,0x01,0x01,0x5B,0x00,0x02,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
+0x58,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,
+0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x6F,0x03,
+0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x72,0x03,0x01,0x02,0x01,0x01,
+0x4D,0x00,0x01,0x01,0x75,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x76,0x03,
+0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x78,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x7B,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x7C,0x03,0x01,0x02,0x01,0x01,
+0x44,0x00,0x01,0x02,0x7E,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x7F,0x03,0x01,0x02,
+0x42,0x00,0x01,0x02,0x80,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x82,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x83,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,
+0x83,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x84,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,
+0x85,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x86,0x03,0x01,0x01,0x3B,0x00,
+0x01,0x01,0x87,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x87,0x03,0x01,0x01,0x3A,0x00,
+0x01,0x01,0x01,0x02,0x87,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x88,0x03,0x01,0x01,
+0x3A,0x00,0x01,0x02,0x88,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x88,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x02,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x02,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x02,0x89,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x89,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
+0x88,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x88,0x03,0x01,0x02,0x3A,0x00,
+0x01,0x02,0x88,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x88,0x03,0x01,0x01,0x3A,0x00,
+0x01,0x02,0x87,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x87,0x03,0x01,0x02,0x3B,0x00,
+0x01,0x02,0x87,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x86,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x85,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x84,0x03,
+0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x84,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,
+0x82,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x81,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
+0x01,0x01,0x01,0x02,0x80,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x7F,0x03,0x01,0x02,
+0x44,0x00,0x01,0x02,0x7D,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
+0x7B,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x7A,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x78,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,
+0x76,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x74,0x03,0x01,0x02,
+0x4F,0x00,0x01,0x02,0x72,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x6F,0x03,0x01,0x02,
+0x01,0x01,0x53,0x00,0x01,0x02,0x6D,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,
+0x6A,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
+0x01,0x01,0x5C,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,
+0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,
+0x6C,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x02,0x01,0x01,0x02,0x25,0x03,0x02,0x02,
+0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x04,0x00,0x02,0x01,0x02,0x02,
+0x1C,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x09,0x00,
+0x03,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x03,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,
+0x20,0x03,0x10,0x00,0x0B,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0xA9,0x00,
+0x03,0x01,0x04,0x02,0x10,0x03,0x04,0x02,
 };
 static const DiffBlock NEUTRAL_FRAME17_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    54, 38,  // Changed box top-left
+    196, 99,  // Changed box dimensions
     NEUTRAL_FRAME17_DATA
 };
 
-// Frame 18: Full frame RLE (2238 bytes)
-static const uint8_t NEUTRAL_FRAME18_DATA[2238] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4F,0x00,0x07,0x01,0xFF,0x00,
-0x30,0x00,0x02,0x01,0x06,0x02,0x0C,0x03,0x02,0x02,0x04,0x01,0xFF,0x00,0x22,0x00,
-0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x19,0x00,0x02,0x01,
-0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x02,0x02,
-0x2B,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x08,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x04,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,
-0x07,0x02,0x08,0x03,0x04,0x02,0x03,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x6C,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x61,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x02,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x02,0x02,0x5A,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x58,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x56,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x01,0x51,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x4D,0x00,
-0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x51,0x03,
-0x01,0x01,0x46,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,
-0x53,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x44,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,
-0x42,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,
-0x40,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x39,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x67,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
+// Frame 18: Diff RLE (1842 bytes)
+static const uint8_t NEUTRAL_FRAME18_DATA[1842] = {
+0xD1,0x00,0x07,0x01,0xF8,0x00,0x02,0x01,0x06,0x02,0x0C,0x03,0x02,0x02,0x04,0x01,
+0xEA,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xE1,0x00,0x02,0x01,
+0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0xDB,0x00,0x01,0x01,0x02,0x02,0x2B,0x03,
+0x02,0x02,0x01,0x01,0xD6,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,
+0xD0,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xCC,0x00,0x01,0x01,
+0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0xC8,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,
+0x01,0x02,0x01,0x01,0x3C,0x00,0x02,0x01,0x07,0x02,0x08,0x03,0x04,0x02,0x03,0x01,
+0x70,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x02,0x01,
+0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x46,0x03,
+0x01,0x01,0x30,0x00,0x02,0x01,0x01,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0x65,0x00,
+0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x02,0x02,
+0x29,0x03,0x02,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x5D,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x02,0x02,
+0x5A,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x01,0x02,0x02,0x01,0x56,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,
+0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x1B,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x18,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,
+0x4C,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
+0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x12,0x00,
+0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x44,0x00,0x01,0x01,
+0x01,0x02,0x5F,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x01,0x01,
+0x43,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
+0x08,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,
+0x63,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x3E,0x00,
+0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x05,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x02,0x3D,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x05,0x00,0x01,0x02,
+0x5F,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x04,0x00,
+0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3A,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x01,0x01,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,
+0x63,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,
+0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x66,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x02,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x01,0x00,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,
+0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,
+0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,
 0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3C,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x02,0x43,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x42,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x02,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4C,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,
-0x53,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x46,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x61,0x00,
-0x02,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x01,0x02,0x2B,0x03,0x01,0x02,0x02,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x02,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x01,0x02,0x02,0x01,
-0x6E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x02,0x01,
-0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x74,0x00,0x02,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x7D,0x00,0x03,0x01,0x05,0x02,0x08,0x03,0x06,0x02,0x03,0x01,
-0x7C,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x19,0x00,
-0x02,0x01,0x03,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x21,0x00,0x03,0x01,
-0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,0x2D,0x00,0x0C,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD6,0x00,
+0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x66,0x03,
+0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x66,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x66,0x03,0x01,0x02,
+0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x65,0x03,
+0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x65,0x03,
+0x01,0x01,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x65,0x03,
+0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x64,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x01,0x02,
+0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x04,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
+0x5F,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x01,0x01,0x02,
+0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x01,0x01,0x0C,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,
+0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x01,0x01,0x49,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x01,0x02,
+0x56,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x12,0x00,
+0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
+0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x50,0x03,
+0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,0x18,0x00,
+0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
+0x46,0x03,0x01,0x01,0x1C,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x58,0x00,0x01,0x01,
+0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x49,0x03,
+0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x21,0x00,
+0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,
+0x3B,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,
+0x01,0x01,0x61,0x00,0x02,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x29,0x00,
+0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x02,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,
+0x6A,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x02,0x01,0x32,0x00,0x01,0x01,
+0x01,0x02,0x36,0x03,0x01,0x02,0x02,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,0x24,0x03,
+0x01,0x02,0x02,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,
+0x75,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x3D,0x00,0x02,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,0x03,0x01,0x05,0x02,0x08,0x03,
+0x06,0x02,0x03,0x01,0x45,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,
+0xE1,0x00,0x02,0x01,0x03,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xE9,0x00,0x03,0x01,
+0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0xF5,0x00,0x0C,0x01,0xFF,0x00,0xFF,0x00,
+0xE5,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME18_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    25, 29,  // Changed box top-left
+    265, 109,  // Changed box dimensions
     NEUTRAL_FRAME18_DATA
 };
 
-// Frame 19: Full frame RLE (2238 bytes)
-static const uint8_t NEUTRAL_FRAME19_DATA[2238] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4F,0x00,0x07,0x01,0xFF,0x00,
-0x30,0x00,0x02,0x01,0x06,0x02,0x0C,0x03,0x02,0x02,0x04,0x01,0xFF,0x00,0x22,0x00,
-0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x19,0x00,0x02,0x01,
-0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x02,0x02,
-0x2B,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x08,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x04,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,
-0x07,0x02,0x08,0x03,0x04,0x02,0x03,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x6C,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x61,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x02,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x02,0x51,0x03,
-0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x56,0x00,
-0x01,0x02,0x53,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
-0x01,0x01,0x53,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x44,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x01,0x01,0x40,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3E,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x65,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x3D,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,
-0x01,0x02,0x61,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x39,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
-0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x39,0x00,
-0x01,0x02,0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3C,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x02,0x43,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x42,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x02,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4C,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,
-0x53,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x46,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x61,0x00,
-0x02,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x01,0x02,0x2B,0x03,0x01,0x02,0x02,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x02,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x01,0x02,0x02,0x01,
-0x6E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x02,0x01,
-0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x74,0x00,0x02,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x7D,0x00,0x03,0x01,0x05,0x02,0x08,0x03,0x06,0x02,0x03,0x01,
-0x7C,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x18,0x00,
-0x02,0x01,0x03,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x21,0x00,0x03,0x01,
-0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,0x2D,0x00,0x0C,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD6,0x00,
+// Frame 19: Diff RLE (414 bytes)
+static const uint8_t NEUTRAL_FRAME19_DATA[414] = {
+0x17,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x13,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x11,0x00,0x01,0x01,
+0x01,0x02,0x3D,0x03,0x0F,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x0E,0x00,0x01,0x01,
+0x01,0x02,0x40,0x03,0x0C,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x43,0x03,0x0A,0x00,0x01,0x01,0x45,0x03,0x09,0x00,0x01,0x01,0x46,0x03,
+0x08,0x00,0x01,0x01,0x47,0x03,0x07,0x00,0x01,0x01,0x48,0x03,0x06,0x00,0x01,0x01,
+0x49,0x03,0x05,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x04,0x00,0x01,0x01,0x01,0x02,
+0x4A,0x03,0x04,0x00,0x01,0x02,0x4B,0x03,0x03,0x00,0x01,0x01,0x4C,0x03,0x03,0x00,
+0x01,0x02,0x4C,0x03,0x02,0x00,0x01,0x01,0x4D,0x03,0x01,0x00,0x01,0x01,0x01,0x02,
+0x4D,0x03,0x01,0x00,0x01,0x01,0x4E,0x03,0x01,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
+0x01,0x02,0x4E,0x03,0x01,0x01,0x4F,0x03,0x01,0x02,0x4F,0x03,0x01,0x02,0x4F,0x03,
+0x01,0x02,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,0xFF,0x03,
+0xFF,0x03,0xFF,0x03,0xFF,0x03,0xF9,0x03,0x01,0x02,0x4F,0x03,0x01,0x02,0x4F,0x03,
+0x01,0x01,0x4F,0x03,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x00,0x01,0x01,0x4E,0x03,0x01,0x00,0x01,0x01,0x4E,0x03,0x02,0x00,0x01,0x02,
+0x4D,0x03,0x02,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x03,0x00,0x01,0x01,0x4C,0x03,
+0x04,0x00,0x01,0x02,0x4B,0x03,0x04,0x00,0x01,0x01,0x4B,0x03,0x05,0x00,0x01,0x02,
+0x4A,0x03,0x06,0x00,0x01,0x02,0x49,0x03,0x06,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
+0x07,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x08,0x00,0x01,0x01,0x01,0x02,0x46,0x03,
+0x09,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x0A,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
+0x0C,0x00,0x01,0x02,0x43,0x03,0x0D,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x40,0x03,0x10,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x12,0x00,
+0x01,0x01,0x01,0x02,0x3C,0x03,0x14,0x00,0x01,0x01,0x3B,0x03,0x16,0x00,0x01,0x01,
+0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
+0x01,0x02,0x01,0x01,0x1C,0x00,0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x22,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x07,0x00,
 };
 static const DiffBlock NEUTRAL_FRAME19_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    25, 43,  // Changed box top-left
+    80, 90,  // Changed box dimensions
     NEUTRAL_FRAME19_DATA
 };
 
-// Frame 20: Full frame RLE (2238 bytes)
-static const uint8_t NEUTRAL_FRAME20_DATA[2238] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4F,0x00,0x07,0x01,0xFF,0x00,
-0x30,0x00,0x02,0x01,0x06,0x02,0x0C,0x03,0x02,0x02,0x04,0x01,0xFF,0x00,0x22,0x00,
-0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x19,0x00,0x02,0x01,
-0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x13,0x00,0x01,0x01,0x02,0x02,
-0x2B,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x08,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x04,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x02,0x01,
-0x07,0x02,0x08,0x03,0x04,0x02,0x03,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x6C,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,0x67,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x61,0x00,
-0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x02,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x02,0x51,0x03,
-0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x56,0x00,
-0x01,0x02,0x53,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,
-0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
-0x01,0x01,0x53,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x44,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
-0x3B,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x02,0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
-0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x64,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x65,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x3C,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x02,0x43,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x42,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x02,0x53,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x02,
-0x01,0x01,0x4B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4C,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,
-0x4E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x01,
-0x53,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x46,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x61,0x00,
-0x02,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x01,0x02,0x2B,0x03,0x01,0x02,0x02,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x02,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x01,0x02,0x02,0x01,
-0x6E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x02,0x01,
-0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x74,0x00,0x02,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x7D,0x00,0x03,0x01,0x05,0x02,0x08,0x03,0x06,0x02,0x03,0x01,
-0x7C,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x18,0x00,
-0x02,0x01,0x03,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x21,0x00,0x03,0x01,
-0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,0x2D,0x00,0x0C,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD6,0x00,
+// Frame 20: Diff RLE (370 bytes)
+static const uint8_t NEUTRAL_FRAME20_DATA[370] = {
+0x15,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x68,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
+0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,
+0x59,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,
+0x01,0x02,0x42,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x4D,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
+0x53,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
+0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x59,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x5A,0x03,0x01,0x01,
+0x3E,0x00,0x5A,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x5B,0x03,0x01,0x02,0x3D,0x00,
+0x5C,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3A,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x39,0x00,0x5F,0x03,0x01,0x02,0x39,0x00,0x5F,0x03,0x01,0x02,0x38,0x00,
+0x01,0x01,
 };
 static const DiffBlock NEUTRAL_FRAME20_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    32, 41,  // Changed box top-left
+    153, 41,  // Changed box dimensions
     NEUTRAL_FRAME20_DATA
 };
 
-// Frame 21: Full frame RLE (2212 bytes)
-static const uint8_t NEUTRAL_FRAME21_DATA[2212] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCE,0x00,0x04,0x01,0x0E,0x02,0x04,0x01,
-0xFF,0x00,0x26,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,
-0x1D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x80,0x00,0x02,0x01,
-0x07,0x02,0x08,0x03,0x04,0x02,0x03,0x01,0x7C,0x00,0x02,0x01,0x01,0x02,0x29,0x03,
-0x02,0x02,0x01,0x01,0x78,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,
-0x76,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x71,0x00,0x02,0x01,
-0x01,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
-0x01,0x02,0x01,0x01,0x6C,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
-0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x02,0x02,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x45,0x03,
-0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x59,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x55,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,
-0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x50,0x00,
-0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x48,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x54,0x03,
-0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,
-0x45,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x5B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,
-0x43,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x01,0x01,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x3A,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x64,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
-0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,
-0x63,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x3D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x02,0x3F,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x01,0x01,0x46,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x46,0x00,0x01,0x01,
-0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x48,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,
-0x01,0x02,0x50,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,
-0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
-0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x41,0x03,
-0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x5F,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
-0x67,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,
-0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x72,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,
-0x71,0x00,0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,
-0x03,0x02,0x18,0x03,0x03,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x02,0x02,0x25,0x03,
-0x02,0x02,0x01,0x01,0x82,0x00,0x03,0x01,0x05,0x02,0x02,0x03,0x01,0x02,0x02,0x03,
-0x06,0x02,0x04,0x01,0x7F,0x00,0x02,0x01,0x03,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0x21,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,
-0x2D,0x00,0x0C,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD6,0x00,
+// Frame 21: Diff RLE (1568 bytes)
+static const uint8_t NEUTRAL_FRAME21_DATA[1568] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0C,0x00,0x04,0x01,0x0E,0x02,
+0x04,0x01,0xA6,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x03,0x02,0x02,0x01,0x9D,0x00,
+0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x95,0x00,0x02,0x01,0x01,0x02,
+0x29,0x03,0x02,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,
+0x01,0x01,0x8A,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x19,0x00,
+0x02,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x02,0x02,0x01,0x01,
+0x16,0x00,0x03,0x03,0x02,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,
+0x01,0x02,0x01,0x01,0x15,0x00,0x06,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
+0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x08,0x03,0x01,0x02,0x02,0x01,
+0x5C,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,
+0x10,0x00,0x0D,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x0F,0x00,0x0E,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x10,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,
+0x4F,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x11,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x12,0x03,0x01,0x02,0x01,0x01,
+0x4C,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x0A,0x00,0x14,0x03,0x01,0x01,0x4A,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x09,0x00,0x15,0x03,0x01,0x01,0x48,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x01,0x08,0x00,0x15,0x03,0x01,0x02,0x01,0x01,0x46,0x00,
+0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x16,0x03,0x01,0x02,
+0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x07,0x00,0x17,0x03,
+0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x06,0x00,0x18,0x03,
+0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x01,0x05,0x00,
+0x19,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,
+0x04,0x00,0x19,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x04,0x00,0x1A,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x1B,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x03,0x00,
+0x1B,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x03,0x00,
+0x1C,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x02,0x00,
+0x1C,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x02,0x00,0x1C,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x02,0x00,0x1D,0x03,
+0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x02,0x00,0x1D,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x1D,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x1D,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x1D,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x02,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x02,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x02,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x02,
+0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x1E,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x1E,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x1E,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x1E,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x66,0x03,0x01,0x02,0x01,0x00,0x1E,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x1E,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x01,0x00,0x1E,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,
+0x1E,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x1E,0x03,
+0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x1E,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x1E,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x1E,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x01,0x01,0x1E,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,
+0x01,0x02,0x01,0x01,0x1E,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x01,0x01,0x1E,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
+0x1E,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x1E,0x03,
+0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x1E,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x1E,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x1E,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x1E,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x01,0x01,0x1E,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x66,0x03,0x01,0x01,0x1E,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
+0x65,0x03,0x01,0x02,0x01,0x01,0x1E,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,
+0x01,0x01,0x01,0x00,0x1E,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
+0x01,0x00,0x1E,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,
+0x01,0x00,0x1D,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x02,0x00,
+0x1D,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x02,0x00,0x1D,0x03,
+0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x03,0x00,0x1C,0x03,0x01,0x02,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x03,0x00,0x1C,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x04,0x00,0x1B,0x03,0x01,0x02,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x04,0x00,0x1B,0x03,0x01,0x01,0x41,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x02,0x05,0x00,0x1A,0x03,0x01,0x02,0x43,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x19,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x06,0x00,0x19,0x03,0x01,0x01,0x45,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x07,0x00,0x18,0x03,0x01,0x02,0x01,0x01,0x46,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x08,0x00,0x17,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x01,0x55,0x03,0x01,0x01,0x09,0x00,0x16,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
+0x01,0x01,0x53,0x03,0x01,0x01,0x0A,0x00,0x15,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
+0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x0B,0x00,0x14,0x03,0x01,0x02,0x01,0x01,
+0x4E,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x01,0x0C,0x00,0x13,0x03,0x01,0x02,
+0x01,0x01,0x51,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x12,0x03,
+0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,
+0x0F,0x00,0x11,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x10,0x00,0x10,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x41,0x03,
+0x01,0x02,0x01,0x01,0x12,0x00,0x0E,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x60,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x16,0x00,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x18,0x00,
+0x08,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x06,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,0x01,0x02,
+0x29,0x03,0x02,0x02,0x01,0x01,0x1D,0x00,0x04,0x03,0x01,0x02,0x01,0x01,0x72,0x00,
+0x02,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x20,0x00,0x01,0x03,0x01,0x02,
+0x01,0x01,0x79,0x00,0x02,0x01,0x03,0x02,0x18,0x03,0x03,0x02,0x02,0x01,0xA5,0x00,
+0x03,0x01,0x05,0x02,0x02,0x03,0x01,0x02,0x02,0x03,0x06,0x02,0x04,0x01,0x28,0x00,
+
 };
 static const DiffBlock NEUTRAL_FRAME21_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    97, 29,  // Changed box top-left
+    193, 104,  // Changed box dimensions
     NEUTRAL_FRAME21_DATA
 };
 
 static const FrameInfo NEUTRAL_FRAMES[22] = {
     {&NEUTRAL_FRAME0_BLOCK},
     {&NEUTRAL_FRAME1_BLOCK},
-    {&NEUTRAL_FRAME2_BLOCK},
-    {&NEUTRAL_FRAME3_BLOCK},
+    {nullptr},
+    {nullptr},
     {&NEUTRAL_FRAME4_BLOCK},
     {&NEUTRAL_FRAME5_BLOCK},
     {&NEUTRAL_FRAME6_BLOCK},
     {&NEUTRAL_FRAME7_BLOCK},
     {&NEUTRAL_FRAME8_BLOCK},
-    {&NEUTRAL_FRAME9_BLOCK},
-    {&NEUTRAL_FRAME10_BLOCK},
+    {nullptr},
+    {nullptr},
     {&NEUTRAL_FRAME11_BLOCK},
     {&NEUTRAL_FRAME12_BLOCK},
     {&NEUTRAL_FRAME13_BLOCK},
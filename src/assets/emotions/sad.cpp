@@ -59,2562 +59,1640 @@ static const DiffBlock SAD_FRAME0_BLOCK = {
     SAD_FRAME0_DATA
 };
 
-// Frame 1: Full frame RLE (848 bytes)
-static const uint8_t SAD_FRAME1_DATA[848] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xC2,0x00,0x08,0x01,0x09,0x02,0x03,0x03,0x03,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,
-0x02,0x02,0x03,0x03,0x09,0x02,0x09,0x01,0xCB,0x00,0x08,0x01,0x08,0x02,0x23,0x03,
-0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x08,0x02,0x07,0x01,0x99,0x00,
+// Frame 1: Diff RLE (366 bytes)
+static const uint8_t SAD_FRAME1_DATA[366] = {
+0x46,0x00,0x08,0x01,0x09,0x02,0x03,0x03,0x03,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x02,0x02,0x03,0x03,0x09,0x02,0x09,0x01,0x72,0x00,0x08,0x01,0x08,0x02,0x23,0x03,
+0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x08,0x02,0x07,0x01,0x40,0x00,
 0x07,0x01,0x08,0x02,0x3F,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x3F,0x03,0x08,0x02,
-0x07,0x01,0x73,0x00,0x01,0x01,0x02,0x02,0x58,0x03,0x01,0x02,0x21,0x00,0x59,0x03,
-0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x63,0x03,0x1C,0x00,0x01,0x01,0x63,0x03,
-0x01,0x01,0x5B,0x00,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x5D,0x00,0x01,0x01,0x53,0x03,0x06,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x05,0x02,
-0x53,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x36,0x03,0x09,0x02,0x09,0x01,0x4D,0x00,
-0x09,0x01,0x09,0x02,0x36,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x18,0x03,0x0B,0x02,
-0x09,0x01,0x81,0x00,0x09,0x01,0x0A,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x67,0x00,
-0x03,0x01,0x04,0x02,0x09,0x01,0xB6,0x00,0x0A,0x01,0x04,0x02,0x02,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x5E,0x00,
-
+0x07,0x01,0x1A,0x00,0x01,0x01,0x02,0x02,0x58,0x03,0x01,0x02,0x21,0x00,0x59,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x5F,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x63,0x03,0x1C,0x00,0x01,0x01,0x63,0x03,
+0x01,0x01,0x02,0x00,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
+0x01,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,
+0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x02,0x02,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x63,0x03,0x02,0x02,0x62,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
+0x62,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x61,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x02,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x04,0x00,0x01,0x01,0x53,0x03,0x06,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x05,0x02,0x53,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x36,0x03,0x09,0x02,0x09,0x01,
+0x4D,0x00,0x09,0x01,0x09,0x02,0x36,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x18,0x03,
+0x0B,0x02,0x09,0x01,0x81,0x00,0x09,0x01,0x0A,0x02,0x18,0x03,0x01,0x02,0x01,0x01,
+0x0E,0x00,0x03,0x01,0x04,0x02,0x09,0x01,0xB6,0x00,0x0A,0x01,0x04,0x02,0x02,0x01,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x87,0x00,
 };
 static const DiffBlock SAD_FRAME1_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 115,  // Changed box top-left
+    231, 36,  // Changed box dimensions
     SAD_FRAME1_DATA
 };
 
-// Frame 2: Full frame RLE (1012 bytes)
-static const uint8_t SAD_FRAME2_DATA[1012] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x1C,0x00,0x03,0x01,
-0x03,0x02,0x08,0x03,0x02,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x09,0x03,
-0x03,0x02,0x03,0x01,0xE3,0x00,0x03,0x01,0x03,0x02,0x16,0x03,0x01,0x02,0x01,0x01,
-0x2B,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x03,0x01,0xCE,0x00,0x04,0x01,
-0x03,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x23,0x03,0x03,0x02,
-0x04,0x01,0xB9,0x00,0x03,0x01,0x04,0x02,0x2E,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
-0x2E,0x03,0x03,0x02,0x04,0x01,0xA5,0x00,0x03,0x01,0x04,0x02,0x39,0x03,0x01,0x02,
-0x23,0x00,0x3A,0x03,0x04,0x02,0x03,0x01,0x91,0x00,0x03,0x01,0x03,0x02,0x45,0x03,
-0x01,0x02,0x21,0x00,0x46,0x03,0x03,0x02,0x03,0x01,0x7D,0x00,0x03,0x01,0x03,0x02,
-0x50,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x50,0x03,0x03,0x02,0x02,0x01,0x70,0x00,
-0x01,0x01,0x01,0x02,0x59,0x03,0x1E,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x6A,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,
-0x65,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x63,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x5E,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x61,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x5C,0x00,
-0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x21,0x00,0x62,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x23,0x00,0x61,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x01,0x01,0x27,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x5B,0x03,
-0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x56,0x03,0x02,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x02,0x02,0x56,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x02,0x4B,0x03,0x04,0x02,0x04,0x01,0x3B,0x00,0x04,0x01,
-0x04,0x02,0x4B,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x41,0x03,0x04,0x02,0x03,0x01,
-0x50,0x00,0x04,0x01,0x04,0x02,0x40,0x03,0x01,0x02,0x60,0x00,0x36,0x03,0x03,0x02,
-0x04,0x01,0x65,0x00,0x03,0x01,0x04,0x02,0x35,0x03,0x01,0x02,0x62,0x00,0x01,0x02,
-0x2A,0x03,0x03,0x02,0x03,0x01,0x7A,0x00,0x04,0x01,0x03,0x02,0x2A,0x03,0x01,0x01,
-0x64,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x03,0x02,0x03,0x01,0x8F,0x00,0x03,0x01,
-0x02,0x02,0x1F,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,
-0x03,0x01,0xA3,0x00,0x03,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,
-0x02,0x02,0x03,0x03,0x03,0x02,0x03,0x01,0xB7,0x00,0x02,0x01,0x03,0x02,0x03,0x03,
-0x03,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xC0,0x00,
+// Frame 2: Diff RLE (574 bytes)
+static const uint8_t SAD_FRAME2_DATA[574] = {
+0x4A,0x00,0x03,0x01,0x03,0x02,0x08,0x03,0x02,0x02,0x01,0x01,0x31,0x00,0x01,0x01,
+0x01,0x02,0x09,0x03,0x03,0x02,0x03,0x01,0x8A,0x00,0x03,0x01,0x03,0x02,0x16,0x03,
+0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x03,0x01,
+0x75,0x00,0x04,0x01,0x03,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,
+0x23,0x03,0x03,0x02,0x04,0x01,0x60,0x00,0x03,0x01,0x04,0x02,0x2E,0x03,0x01,0x02,
+0x25,0x00,0x01,0x02,0x2E,0x03,0x03,0x02,0x04,0x01,0x4C,0x00,0x03,0x01,0x04,0x02,
+0x39,0x03,0x01,0x02,0x23,0x00,0x3A,0x03,0x04,0x02,0x03,0x01,0x38,0x00,0x03,0x01,
+0x03,0x02,0x45,0x03,0x01,0x02,0x21,0x00,0x46,0x03,0x03,0x02,0x03,0x01,0x24,0x00,
+0x03,0x01,0x03,0x02,0x50,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x50,0x03,0x03,0x02,
+0x02,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x1E,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x11,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x60,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x61,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x61,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x03,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x01,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x21,0x00,0x62,0x03,0x01,0x01,0x01,0x02,
+0x60,0x03,0x01,0x02,0x23,0x00,0x61,0x03,0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x5F,0x03,0x02,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x27,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x5B,0x03,0x01,0x02,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x56,0x03,
+0x02,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x02,0x02,0x56,0x03,0x01,0x01,0x03,0x00,
+0x01,0x02,0x4B,0x03,0x04,0x02,0x04,0x01,0x3B,0x00,0x04,0x01,0x04,0x02,0x4B,0x03,
+0x01,0x02,0x04,0x00,0x01,0x01,0x41,0x03,0x04,0x02,0x03,0x01,0x50,0x00,0x04,0x01,
+0x04,0x02,0x40,0x03,0x01,0x02,0x07,0x00,0x36,0x03,0x03,0x02,0x04,0x01,0x65,0x00,
+0x03,0x01,0x04,0x02,0x35,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x2A,0x03,0x03,0x02,
+0x03,0x01,0x7A,0x00,0x04,0x01,0x03,0x02,0x2A,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x1E,0x03,0x03,0x02,0x03,0x01,0x8F,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,
+0x01,0x02,0x0F,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x03,0x01,0xA3,0x00,
+0x03,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x02,0x02,0x03,0x03,
+0x03,0x02,0x03,0x01,0xB7,0x00,0x02,0x01,0x03,0x02,0x03,0x03,0x03,0x02,0x01,0x01,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB1,0x00,
 };
 static const DiffBlock SAD_FRAME2_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 81,  // Changed box top-left
+    231, 54,  // Changed box dimensions
     SAD_FRAME2_DATA
 };
 
-// Frame 3: Full frame RLE (1096 bytes)
-static const uint8_t SAD_FRAME3_DATA[1096] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x8E,0x00,0x02,0x01,0x03,0x02,0x04,0x03,0x03,0x02,0x01,0x01,0x3A,0x00,
-0x02,0x01,0x03,0x02,0x04,0x03,0x02,0x02,0x03,0x01,0xE2,0x00,0x03,0x01,0x02,0x02,
-0x13,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x03,0x02,
-0x03,0x01,0xCF,0x00,0x04,0x01,0x03,0x02,0x1E,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,
-0x01,0x02,0x1E,0x03,0x03,0x02,0x03,0x01,0xBD,0x00,0x04,0x01,0x03,0x02,0x29,0x03,
-0x01,0x02,0x2B,0x00,0x01,0x02,0x29,0x03,0x03,0x02,0x03,0x01,0xAC,0x00,0x03,0x01,
-0x03,0x02,0x34,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x34,0x03,0x03,0x02,0x03,0x01,
-0x9A,0x00,0x03,0x01,0x02,0x02,0x3F,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x3E,0x03,
-0x03,0x02,0x03,0x01,0x88,0x00,0x03,0x01,0x02,0x02,0x49,0x03,0x01,0x01,0x23,0x00,
-0x01,0x02,0x48,0x03,0x03,0x02,0x02,0x01,0x7B,0x00,0x01,0x01,0x01,0x02,0x52,0x03,
-0x01,0x01,0x21,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x01,0x02,
-0x57,0x03,0x20,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x69,0x00,0x01,0x02,
-0x5C,0x03,0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x5E,0x00,0x01,0x02,
-0x61,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x21,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x23,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x25,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x5E,0x03,0x01,0x01,
-0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0x01,0x01,0x29,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x5A,0x03,0x5D,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x5E,0x00,
-0x52,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x02,0x02,0x51,0x03,0x01,0x02,
-0x60,0x00,0x48,0x03,0x03,0x02,0x02,0x01,0x45,0x00,0x02,0x01,0x02,0x02,0x48,0x03,
-0x01,0x02,0x62,0x00,0x3F,0x03,0x02,0x02,0x02,0x01,0x56,0x00,0x03,0x01,0x02,0x02,
-0x3E,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x34,0x03,0x02,0x02,0x03,0x01,0x67,0x00,
-0x02,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x29,0x03,0x03,0x02,
-0x03,0x01,0x78,0x00,0x03,0x01,0x03,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x69,0x00,
-0x01,0x01,0x01,0x02,0x1D,0x03,0x04,0x02,0x03,0x01,0x89,0x00,0x03,0x01,0x04,0x02,
-0x1D,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x04,0x02,
-0x03,0x01,0x9B,0x00,0x03,0x01,0x03,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x74,0x00,
-0x02,0x01,0x09,0x02,0x03,0x01,0xAD,0x00,0x03,0x01,0x09,0x02,0x02,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC8,0x00,
+// Frame 3: Diff RLE (634 bytes)
+static const uint8_t SAD_FRAME3_DATA[634] = {
+0x49,0x00,0x02,0x01,0x03,0x02,0x04,0x03,0x03,0x02,0x01,0x01,0x3A,0x00,0x02,0x01,
+0x03,0x02,0x04,0x03,0x02,0x02,0x03,0x01,0x89,0x00,0x03,0x01,0x02,0x02,0x13,0x03,
+0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x03,0x02,0x03,0x01,
+0x76,0x00,0x04,0x01,0x03,0x02,0x1E,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,
+0x1E,0x03,0x03,0x02,0x03,0x01,0x64,0x00,0x04,0x01,0x03,0x02,0x29,0x03,0x01,0x02,
+0x2B,0x00,0x01,0x02,0x29,0x03,0x03,0x02,0x03,0x01,0x53,0x00,0x03,0x01,0x03,0x02,
+0x34,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x34,0x03,0x03,0x02,0x03,0x01,0x41,0x00,
+0x03,0x01,0x02,0x02,0x3F,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x3E,0x03,0x03,0x02,
+0x03,0x01,0x2F,0x00,0x03,0x01,0x02,0x02,0x49,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x48,0x03,0x03,0x02,0x02,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x01,
+0x21,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x02,0x57,0x03,
+0x20,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x5C,0x03,
+0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x05,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x62,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,
+0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
+0x1F,0x00,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
+0x61,0x03,0x02,0x01,0x60,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x60,0x03,0x02,0x01,
+0x5F,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x01,0x00,
+0x5E,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x02,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x5A,0x03,0x04,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x56,0x03,
+0x01,0x01,0x05,0x00,0x52,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x02,0x02,
+0x51,0x03,0x01,0x02,0x07,0x00,0x48,0x03,0x03,0x02,0x02,0x01,0x45,0x00,0x02,0x01,
+0x02,0x02,0x48,0x03,0x01,0x02,0x09,0x00,0x3F,0x03,0x02,0x02,0x02,0x01,0x56,0x00,
+0x03,0x01,0x02,0x02,0x3E,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x34,0x03,0x02,0x02,
+0x03,0x01,0x67,0x00,0x02,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x29,0x03,0x03,0x02,0x03,0x01,0x78,0x00,0x03,0x01,0x03,0x02,0x29,0x03,0x01,0x02,
+0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x04,0x02,0x03,0x01,0x89,0x00,
+0x03,0x01,0x04,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x04,0x02,0x03,0x01,0x9B,0x00,0x03,0x01,0x03,0x02,0x12,0x03,0x01,0x02,
+0x01,0x01,0x1B,0x00,0x02,0x01,0x09,0x02,0x03,0x01,0xAD,0x00,0x03,0x01,0x09,0x02,
+0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xAE,0x00,
 };
 static const DiffBlock SAD_FRAME3_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 71,  // Changed box top-left
+    231, 39,  // Changed box dimensions
     SAD_FRAME3_DATA
 };
 
-// Frame 4: Full frame RLE (1182 bytes)
-static const uint8_t SAD_FRAME4_DATA[1182] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x01,0x00,0x03,0x01,0x04,0x02,0x03,0x03,0x04,0x02,0x02,0x01,
-0x41,0x00,0x02,0x01,0x04,0x02,0x03,0x03,0x04,0x02,0x03,0x01,0xD7,0x00,0x02,0x01,
-0x03,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x14,0x03,
-0x03,0x02,0x02,0x01,0xC6,0x00,0x03,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
-0x35,0x00,0x01,0x01,0x20,0x03,0x03,0x02,0x02,0x01,0xB6,0x00,0x02,0x01,0x03,0x02,
-0x2B,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x2B,0x03,0x02,0x02,0x02,0x01,0xA6,0x00,
-0x02,0x01,0x03,0x02,0x35,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x35,0x03,0x02,0x02,
-0x03,0x01,0x95,0x00,0x02,0x01,0x02,0x02,0x3F,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,
-0x3E,0x03,0x03,0x02,0x02,0x01,0x86,0x00,0x01,0x01,0x02,0x02,0x48,0x03,0x01,0x02,
-0x28,0x00,0x01,0x01,0x48,0x03,0x02,0x02,0x02,0x01,0x7B,0x00,0x01,0x01,0x01,0x02,
-0x4F,0x03,0x26,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,
-0x01,0x02,0x53,0x03,0x24,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x56,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x21,0x00,0x59,0x03,0x01,0x02,
-0x69,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x66,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x1F,0x00,0x5D,0x03,0x01,0x01,0x64,0x00,
-0x01,0x02,0x5E,0x03,0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x62,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x60,0x00,0x01,0x02,
-0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x5E,0x00,0x01,0x02,
-0x61,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x1E,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x1F,0x00,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x62,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x21,0x00,0x62,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x01,0x01,0x21,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x60,0x03,
-0x01,0x01,0x23,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x25,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x01,0x27,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x2A,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x02,0x59,0x03,0x5F,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x31,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x60,0x00,0x01,0x02,0x53,0x03,0x01,0x01,
-0x35,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,0x64,0x00,0x01,0x02,
-0x49,0x03,0x02,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x02,0x02,0x49,0x03,0x01,0x01,
-0x66,0x00,0x01,0x01,0x3F,0x03,0x03,0x02,0x02,0x01,0x4F,0x00,0x02,0x01,0x02,0x02,
-0x40,0x03,0x01,0x01,0x69,0x00,0x01,0x02,0x35,0x03,0x03,0x02,0x02,0x01,0x5F,0x00,
-0x02,0x01,0x03,0x02,0x35,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
-0x03,0x02,0x03,0x01,0x6F,0x00,0x02,0x01,0x03,0x02,0x2B,0x03,0x01,0x02,0x70,0x00,
-0x01,0x01,0x01,0x02,0x20,0x03,0x03,0x02,0x03,0x01,0x7F,0x00,0x03,0x01,0x03,0x02,
-0x20,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x03,0x02,0x03,0x01,
-0x90,0x00,0x04,0x01,0x03,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x7B,0x00,0x02,0x01,
-0x03,0x02,0x04,0x03,0x04,0x02,0x03,0x01,0xA1,0x00,0x03,0x01,0x04,0x02,0x04,0x03,
-0x03,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCC,0x00,
+// Frame 4: Diff RLE (724 bytes)
+static const uint8_t SAD_FRAME4_DATA[724] = {
+0x43,0x00,0x03,0x01,0x04,0x02,0x03,0x03,0x04,0x02,0x02,0x01,0x41,0x00,0x02,0x01,
+0x04,0x02,0x03,0x03,0x04,0x02,0x03,0x01,0x7E,0x00,0x02,0x01,0x03,0x02,0x14,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x03,0x02,0x02,0x01,
+0x6D,0x00,0x03,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,
+0x20,0x03,0x03,0x02,0x02,0x01,0x5D,0x00,0x02,0x01,0x03,0x02,0x2B,0x03,0x01,0x01,
+0x31,0x00,0x01,0x02,0x2B,0x03,0x02,0x02,0x02,0x01,0x4D,0x00,0x02,0x01,0x03,0x02,
+0x35,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x35,0x03,0x02,0x02,0x03,0x01,0x3C,0x00,
+0x02,0x01,0x02,0x02,0x3F,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x3E,0x03,0x03,0x02,
+0x02,0x01,0x2D,0x00,0x01,0x01,0x02,0x02,0x48,0x03,0x01,0x02,0x28,0x00,0x01,0x01,
+0x48,0x03,0x02,0x02,0x02,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x26,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x53,0x03,
+0x24,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x56,0x03,
+0x01,0x02,0x22,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,
+0x01,0x02,0x58,0x03,0x01,0x02,0x21,0x00,0x59,0x03,0x01,0x02,0x10,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x1F,0x00,0x5D,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x5E,0x03,
+0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x05,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,
+0x1E,0x00,0x01,0x01,0x63,0x03,0x02,0x01,0x62,0x03,0x01,0x02,0x1F,0x00,0x63,0x03,
+0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x62,0x03,0x02,0x01,
+0x61,0x03,0x01,0x02,0x21,0x00,0x62,0x03,0x02,0x01,0x60,0x03,0x01,0x02,0x01,0x01,
+0x21,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x60,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x25,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,
+0x27,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x02,0x59,0x03,0x06,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x31,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x35,0x00,
+0x01,0x02,0x53,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x49,0x03,
+0x02,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x02,0x02,0x49,0x03,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x3F,0x03,0x03,0x02,0x02,0x01,0x4F,0x00,0x02,0x01,0x02,0x02,0x40,0x03,
+0x01,0x01,0x10,0x00,0x01,0x02,0x35,0x03,0x03,0x02,0x02,0x01,0x5F,0x00,0x02,0x01,
+0x03,0x02,0x35,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x03,0x02,
+0x03,0x01,0x6F,0x00,0x02,0x01,0x03,0x02,0x2B,0x03,0x01,0x02,0x17,0x00,0x01,0x01,
+0x01,0x02,0x20,0x03,0x03,0x02,0x03,0x01,0x7F,0x00,0x03,0x01,0x03,0x02,0x20,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x03,0x02,0x03,0x01,0x90,0x00,
+0x04,0x01,0x03,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x22,0x00,0x02,0x01,0x03,0x02,
+0x04,0x03,0x04,0x02,0x03,0x01,0xA1,0x00,0x03,0x01,0x04,0x02,0x04,0x03,0x03,0x02,
+0x02,0x01,0x13,0x00,
 };
 static const DiffBlock SAD_FRAME4_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 65,  // Changed box top-left
+    231, 41,  // Changed box dimensions
     SAD_FRAME4_DATA
 };
 
-// Frame 5: Full frame RLE (1178 bytes)
-static const uint8_t SAD_FRAME5_DATA[1178] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x89,0x00,0x04,0x01,0x4D,0x00,0x04,0x01,
-0xE2,0x00,0x02,0x01,0x03,0x02,0x0C,0x03,0x01,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,
-0x02,0x02,0x0C,0x03,0x02,0x02,0x03,0x01,0xD1,0x00,0x02,0x01,0x02,0x02,0x19,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x19,0x03,0x03,0x02,0x02,0x01,0xC1,0x00,
-0x02,0x01,0x02,0x02,0x24,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x02,0x02,0x02,0x01,0xB0,0x00,0x03,0x01,0x02,0x02,0x2E,0x03,0x01,0x02,0x30,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x02,0x02,0x03,0x01,0x9F,0x00,0x02,0x01,0x03,0x02,
-0x38,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x38,0x03,0x02,0x02,0x03,0x01,0x8E,0x00,
-0x03,0x01,0x03,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x42,0x03,
-0x03,0x02,0x03,0x01,0x80,0x00,0x01,0x01,0x02,0x02,0x4B,0x03,0x01,0x01,0x27,0x00,
-0x01,0x01,0x4B,0x03,0x02,0x02,0x01,0x01,0x78,0x00,0x01,0x01,0x01,0x02,0x50,0x03,
-0x01,0x01,0x25,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x01,0x01,
-0x01,0x02,0x54,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x6F,0x00,
-0x01,0x02,0x57,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x6B,0x00,
-0x01,0x02,0x59,0x03,0x01,0x02,0x21,0x00,0x5A,0x03,0x01,0x01,0x68,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x65,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x5F,0x03,0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x62,0x00,0x60,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x63,0x03,0x1E,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x1F,0x00,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x62,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x21,0x00,0x62,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x22,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x60,0x03,0x01,0x01,0x23,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x5E,0x03,0x26,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x5D,0x03,0x28,0x00,0x01,0x01,0x5D,0x03,
-0x5D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x59,0x03,0x5F,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x60,0x00,
-0x01,0x02,0x53,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x62,0x00,
+// Frame 5: Diff RLE (728 bytes)
+static const uint8_t SAD_FRAME5_DATA[728] = {
+0xFF,0x00,0xFF,0x00,0x19,0x00,0x04,0x01,0x4D,0x00,0x04,0x01,0x89,0x00,0x02,0x01,
+0x03,0x02,0x0C,0x03,0x01,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,0x02,0x02,0x0C,0x03,
+0x02,0x02,0x03,0x01,0x78,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x19,0x03,0x03,0x02,0x02,0x01,0x68,0x00,0x02,0x01,0x02,0x02,
+0x24,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x02,0x01,
+0x57,0x00,0x03,0x01,0x02,0x02,0x2E,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x01,0x02,
+0x2E,0x03,0x02,0x02,0x03,0x01,0x46,0x00,0x02,0x01,0x03,0x02,0x38,0x03,0x01,0x02,
+0x2D,0x00,0x01,0x02,0x38,0x03,0x02,0x02,0x03,0x01,0x35,0x00,0x03,0x01,0x03,0x02,
+0x41,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x42,0x03,0x03,0x02,0x03,0x01,
+0x27,0x00,0x01,0x01,0x02,0x02,0x4B,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x4B,0x03,
+0x02,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x54,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x57,0x03,
+0x01,0x01,0x21,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x12,0x00,0x01,0x02,0x59,0x03,
+0x01,0x02,0x21,0x00,0x5A,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x1E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x5F,0x03,0x1E,0x00,
+0x01,0x01,0x5E,0x03,0x01,0x02,0x09,0x00,0x60,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x5F,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x60,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x01,0x02,0x61,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x62,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x1E,0x00,
+0x01,0x01,0x63,0x03,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x1F,0x00,0x63,0x03,
+0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x62,0x03,0x02,0x01,
+0x61,0x03,0x01,0x02,0x21,0x00,0x62,0x03,0x02,0x01,0x60,0x03,0x01,0x02,0x22,0x00,
+0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x60,0x03,0x01,0x01,0x23,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5E,0x03,0x26,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x5D,0x03,0x28,0x00,0x01,0x01,0x5D,0x03,
+0x04,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
+0x04,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x59,0x03,0x06,0x00,
+0x01,0x01,0x56,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x07,0x00,
+0x01,0x02,0x53,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x09,0x00,
 0x01,0x02,0x4E,0x03,0x02,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x4F,0x03,0x01,0x01,
-0x64,0x00,0x01,0x01,0x48,0x03,0x02,0x02,0x02,0x01,0x41,0x00,0x01,0x01,0x03,0x02,
-0x48,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x3E,0x03,0x03,0x02,0x03,0x01,0x4E,0x00,
-0x03,0x01,0x04,0x02,0x3D,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x34,0x03,0x03,0x02,
-0x03,0x01,0x5F,0x00,0x03,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,
+0x0B,0x00,0x01,0x01,0x48,0x03,0x02,0x02,0x02,0x01,0x41,0x00,0x01,0x01,0x03,0x02,
+0x48,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x3E,0x03,0x03,0x02,0x03,0x01,0x4E,0x00,
+0x03,0x01,0x04,0x02,0x3D,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x34,0x03,0x03,0x02,
+0x03,0x01,0x5F,0x00,0x03,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0x14,0x00,0x01,0x02,
 0x2A,0x03,0x02,0x02,0x03,0x01,0x70,0x00,0x03,0x01,0x03,0x02,0x2A,0x03,0x01,0x01,
-0x71,0x00,0x01,0x01,0x1F,0x03,0x03,0x02,0x03,0x01,0x81,0x00,0x03,0x01,0x02,0x02,
-0x1F,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,
-0x02,0x01,0x93,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,
+0x18,0x00,0x01,0x01,0x1F,0x03,0x03,0x02,0x03,0x01,0x81,0x00,0x03,0x01,0x02,0x02,
+0x1F,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,
+0x02,0x01,0x93,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x24,0x00,
 0x01,0x01,0x03,0x02,0x05,0x03,0x03,0x02,0x02,0x01,0xA3,0x00,0x02,0x01,0x03,0x02,
-0x05,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0A,0x00,
+0x05,0x03,0x02,0x02,0x02,0x01,0x14,0x00,
 };
 static const DiffBlock SAD_FRAME5_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 65,  // Changed box top-left
+    231, 44,  // Changed box dimensions
     SAD_FRAME5_DATA
 };
 
-// Frame 6: Full frame RLE (1152 bytes)
-static const uint8_t SAD_FRAME6_DATA[1152] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x23,0x00,0x03,0x01,0x06,0x02,0x02,0x01,0x43,0x00,0x02,0x01,0x06,0x02,0x02,0x01,
-0xE0,0x00,0x02,0x01,0x03,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x02,0x02,0x10,0x03,0x02,0x02,0x03,0x01,0xCF,0x00,0x02,0x01,0x03,0x02,0x1C,0x03,
-0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x03,0x02,0x02,0x01,0xBE,0x00,
-0x03,0x01,0x02,0x02,0x27,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
-0x03,0x02,0x03,0x01,0xAC,0x00,0x03,0x01,0x03,0x02,0x31,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x31,0x03,0x03,0x02,0x03,0x01,0x9B,0x00,0x03,0x01,0x03,0x02,0x3B,0x03,
-0x01,0x01,0x29,0x00,0x01,0x01,0x3B,0x03,0x03,0x02,0x03,0x01,0x8B,0x00,0x02,0x01,
-0x03,0x02,0x45,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x45,0x03,0x02,0x02,0x03,0x01,
-0x7E,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x4D,0x03,
-0x02,0x02,0x01,0x01,0x76,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x52,0x03,0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,
-0x21,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x6D,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x20,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x1F,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x5D,0x03,0x1E,0x00,
-0x01,0x01,0x5D,0x03,0x01,0x02,0x64,0x00,0x5F,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x62,0x00,0x60,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x60,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x5E,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,
-0x61,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
-0x01,0x02,0x61,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x1E,0x00,0x01,0x01,
-0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x1F,0x00,0x63,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x59,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x21,0x00,0x62,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x02,0x5E,0x03,0x26,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x60,0x00,0x53,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,
-0x61,0x00,0x01,0x01,0x4D,0x03,0x02,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x43,0x03,0x03,0x02,0x02,0x01,0x48,0x00,
-0x03,0x01,0x03,0x02,0x43,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x39,0x03,0x03,0x02,
-0x03,0x01,0x58,0x00,0x04,0x01,0x03,0x02,0x39,0x03,0x01,0x01,0x68,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x03,0x02,0x03,0x01,0x69,0x00,0x03,0x01,0x03,0x02,0x2F,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,0x03,0x01,0x7B,0x00,
-0x03,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,
-0x1A,0x03,0x03,0x02,0x02,0x01,0x8C,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,
-0x75,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,
-0x02,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x7E,0x00,0x08,0x01,0xAD,0x00,0x08,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xF1,0x00,
-
+// Frame 6: Diff RLE (732 bytes)
+static const uint8_t SAD_FRAME6_DATA[732] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x35,0x00,0x03,0x01,0x06,0x02,0x02,0x01,
+0x43,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0x87,0x00,0x02,0x01,0x03,0x02,0x10,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x03,0x01,
+0x76,0x00,0x02,0x01,0x03,0x02,0x1C,0x03,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,
+0x1C,0x03,0x03,0x02,0x02,0x01,0x65,0x00,0x03,0x01,0x02,0x02,0x27,0x03,0x01,0x02,
+0x30,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x03,0x02,0x03,0x01,0x53,0x00,0x03,0x01,
+0x03,0x02,0x31,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x31,0x03,0x03,0x02,0x03,0x01,
+0x42,0x00,0x03,0x01,0x03,0x02,0x3B,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x3B,0x03,
+0x03,0x02,0x03,0x01,0x32,0x00,0x02,0x01,0x03,0x02,0x45,0x03,0x01,0x01,0x27,0x00,
+0x01,0x02,0x45,0x03,0x02,0x02,0x03,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x4E,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x4D,0x03,0x02,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x53,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x17,0x00,
+0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x14,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x10,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x02,0x5D,0x03,0x1E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x0B,0x00,
+0x5F,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x09,0x00,0x60,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x03,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x63,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x1F,0x00,0x63,0x03,0x02,0x01,0x62,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x21,0x00,0x62,0x03,
+0x02,0x01,0x60,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x61,0x03,0x02,0x01,0x60,0x03,
+0x01,0x01,0x23,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5E,0x03,
+0x26,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x28,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
+0x2B,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
+0x2E,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x01,0x01,0x31,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x07,0x00,0x53,0x03,0x01,0x01,
+0x36,0x00,0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x4D,0x03,
+0x02,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x02,0x43,0x03,0x03,0x02,0x02,0x01,0x48,0x00,0x03,0x01,0x03,0x02,0x43,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x02,0x39,0x03,0x03,0x02,0x03,0x01,0x58,0x00,0x04,0x01,
+0x03,0x02,0x39,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x03,0x02,
+0x03,0x01,0x69,0x00,0x03,0x01,0x03,0x02,0x2F,0x03,0x01,0x02,0x13,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x02,0x02,0x03,0x01,0x7B,0x00,0x03,0x01,0x02,0x02,0x25,0x03,
+0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x03,0x02,0x02,0x01,
+0x8C,0x00,0x03,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,0x1C,0x00,0x02,0x01,0x01,0x02,
+0x0E,0x03,0x03,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x25,0x00,0x08,0x01,0xAD,0x00,0x08,0x01,0x15,0x00,
 };
 static const DiffBlock SAD_FRAME6_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 67,  // Changed box top-left
+    231, 62,  // Changed box dimensions
     SAD_FRAME6_DATA
 };
 
-// Frame 7: Full frame RLE (1118 bytes)
-static const uint8_t SAD_FRAME7_DATA[1118] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x71,0x00,0x03,0x01,0x03,0x02,0x08,0x03,0x02,0x02,0x02,0x01,0x39,0x00,0x02,0x01,
-0x02,0x02,0x08,0x03,0x02,0x02,0x03,0x01,0xDC,0x00,0x03,0x01,0x03,0x02,0x15,0x03,
-0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x03,0x02,0x03,0x01,
-0xCA,0x00,0x03,0x01,0x03,0x02,0x21,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x20,0x03,
-0x03,0x02,0x03,0x01,0xBA,0x00,0x03,0x01,0x03,0x02,0x2B,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x02,0x2B,0x03,0x03,0x02,0x03,0x01,0xA9,0x00,0x02,0x01,0x03,0x02,0x35,0x03,
-0x01,0x02,0x28,0x00,0x01,0x01,0x36,0x03,0x02,0x02,0x03,0x01,0x99,0x00,0x02,0x01,
-0x03,0x02,0x3F,0x03,0x26,0x00,0x01,0x01,0x3F,0x03,0x03,0x02,0x02,0x01,0x89,0x00,
-0x02,0x01,0x02,0x02,0x49,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x48,0x03,0x03,0x02,
-0x02,0x01,0x7B,0x00,0x01,0x01,0x02,0x02,0x51,0x03,0x01,0x01,0x21,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x02,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,
-0x21,0x00,0x56,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x5C,0x03,
-0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x62,0x00,0x60,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x62,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,0x1E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x1F,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x21,0x00,
-0x62,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x21,0x00,0x01,0x01,
-0x61,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x32,0x00,
-0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x02,0x02,0x51,0x03,0x01,0x02,0x60,0x00,0x01,0x02,
-0x48,0x03,0x03,0x02,0x02,0x01,0x43,0x00,0x02,0x01,0x03,0x02,0x48,0x03,0x01,0x02,
-0x62,0x00,0x01,0x02,0x3E,0x03,0x03,0x02,0x03,0x01,0x53,0x00,0x02,0x01,0x03,0x02,
-0x3F,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x35,0x03,0x03,0x02,0x03,0x01,0x63,0x00,
-0x03,0x01,0x03,0x02,0x35,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
-0x03,0x02,0x03,0x01,0x74,0x00,0x03,0x01,0x03,0x02,0x2B,0x03,0x01,0x02,0x6A,0x00,
-0x01,0x01,0x01,0x02,0x20,0x03,0x03,0x02,0x03,0x01,0x85,0x00,0x03,0x01,0x03,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,
-0x97,0x00,0x02,0x01,0x03,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x74,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x02,0x02,0x03,0x01,0xA7,0x00,0x02,0x01,0x03,0x02,0x09,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA0,0x00,
+// Frame 7: Diff RLE (674 bytes)
+static const uint8_t SAD_FRAME7_DATA[674] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0C,0x00,0x03,0x01,0x03,0x02,0x08,0x03,
+0x02,0x02,0x02,0x01,0x39,0x00,0x02,0x01,0x02,0x02,0x08,0x03,0x02,0x02,0x03,0x01,
+0x83,0x00,0x03,0x01,0x03,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,
+0x01,0x02,0x15,0x03,0x03,0x02,0x03,0x01,0x71,0x00,0x03,0x01,0x03,0x02,0x21,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x02,0x20,0x03,0x03,0x02,0x03,0x01,0x61,0x00,0x03,0x01,
+0x03,0x02,0x2B,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x2B,0x03,0x03,0x02,0x03,0x01,
+0x50,0x00,0x02,0x01,0x03,0x02,0x35,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x36,0x03,
+0x02,0x02,0x03,0x01,0x40,0x00,0x02,0x01,0x03,0x02,0x3F,0x03,0x26,0x00,0x01,0x01,
+0x3F,0x03,0x03,0x02,0x02,0x01,0x30,0x00,0x02,0x01,0x02,0x02,0x49,0x03,0x01,0x01,
+0x23,0x00,0x01,0x01,0x48,0x03,0x03,0x02,0x02,0x01,0x22,0x00,0x01,0x01,0x02,0x02,
+0x51,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x02,0x01,0x19,0x00,
+0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x02,0x21,0x00,0x56,0x03,0x01,0x02,0x01,0x01,
+0x14,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x01,0x01,0x10,0x00,0x01,0x01,0x5C,0x03,0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x09,0x00,0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
+0x07,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x60,0x03,
+0x01,0x02,0x05,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x61,0x03,
+0x01,0x01,0x03,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x03,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x01,0x02,0x00,0x63,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x62,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x21,0x00,0x62,0x03,0x02,0x01,0x61,0x03,0x01,0x01,
+0x21,0x00,0x01,0x01,0x61,0x03,0x02,0x01,0x60,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x60,0x03,0x02,0x01,0x5F,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x02,0x04,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x01,0x02,
+0x56,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
+0x01,0x01,0x02,0x02,0x51,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x48,0x03,0x03,0x02,
+0x02,0x01,0x43,0x00,0x02,0x01,0x03,0x02,0x48,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x3E,0x03,0x03,0x02,0x03,0x01,0x53,0x00,0x02,0x01,0x03,0x02,0x3F,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x35,0x03,0x03,0x02,0x03,0x01,0x63,0x00,0x03,0x01,0x03,0x02,
+0x35,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x03,0x02,0x03,0x01,
+0x74,0x00,0x03,0x01,0x03,0x02,0x2B,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x01,0x02,
+0x20,0x03,0x03,0x02,0x03,0x01,0x85,0x00,0x03,0x01,0x03,0x02,0x20,0x03,0x01,0x02,
+0x01,0x01,0x15,0x00,0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x97,0x00,0x02,0x01,
+0x03,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x02,0x02,0x03,0x01,0xA7,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x02,0x02,0x01,0x01,
+0x0F,0x00,
 };
 static const DiffBlock SAD_FRAME7_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 89,  // Changed box top-left
+    231, 49,  // Changed box dimensions
     SAD_FRAME7_DATA
 };
 
-// Frame 8: Full frame RLE (1084 bytes)
-static const uint8_t SAD_FRAME8_DATA[1084] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xBF,0x00,0x03,0x01,
-0x03,0x02,0x03,0x01,0x3B,0x00,0x03,0x01,0x02,0x02,0x03,0x01,0xEC,0x00,0x03,0x01,
-0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
-0x02,0x02,0x02,0x01,0xDC,0x00,0x02,0x01,0x03,0x02,0x19,0x03,0x01,0x02,0x2E,0x00,
-0x01,0x01,0x01,0x02,0x19,0x03,0x02,0x02,0x03,0x01,0xCB,0x00,0x02,0x01,0x02,0x02,
-0x24,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x02,0x02,0x03,0x01,
-0xBA,0x00,0x03,0x01,0x02,0x02,0x2E,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x2D,0x03,
-0x03,0x02,0x02,0x01,0xAA,0x00,0x03,0x01,0x02,0x02,0x37,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x36,0x03,0x03,0x02,0x03,0x01,0x98,0x00,0x03,0x01,0x03,0x02,0x40,0x03,
-0x01,0x02,0x23,0x00,0x01,0x02,0x40,0x03,0x03,0x02,0x03,0x01,0x87,0x00,0x03,0x01,
-0x03,0x02,0x49,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x49,0x03,0x03,0x02,0x03,0x01,
-0x79,0x00,0x01,0x01,0x02,0x02,0x53,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x53,0x03,
-0x02,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x1F,0x00,
-0x58,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x02,0x5B,0x03,0x1E,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x01,0x67,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x01,0x62,0x00,0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x60,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x5E,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x62,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x21,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x59,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x59,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x5B,0x00,0x5C,0x03,
-0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x59,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x5B,0x00,
+// Frame 8: Diff RLE (620 bytes)
+static const uint8_t SAD_FRAME8_DATA[620] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD4,0x00,0x03,0x01,0x03,0x02,0x03,0x01,
+0x3B,0x00,0x03,0x01,0x02,0x02,0x03,0x01,0x93,0x00,0x03,0x01,0x02,0x02,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x02,0x02,0x02,0x01,
+0x83,0x00,0x02,0x01,0x03,0x02,0x19,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,
+0x19,0x03,0x02,0x02,0x03,0x01,0x72,0x00,0x02,0x01,0x02,0x02,0x24,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x02,0x02,0x03,0x01,0x61,0x00,0x03,0x01,
+0x02,0x02,0x2E,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x2D,0x03,0x03,0x02,0x02,0x01,
+0x51,0x00,0x03,0x01,0x02,0x02,0x37,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x36,0x03,
+0x03,0x02,0x03,0x01,0x3F,0x00,0x03,0x01,0x03,0x02,0x40,0x03,0x01,0x02,0x23,0x00,
+0x01,0x02,0x40,0x03,0x03,0x02,0x03,0x01,0x2E,0x00,0x03,0x01,0x03,0x02,0x49,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x49,0x03,0x03,0x02,0x03,0x01,0x20,0x00,0x01,0x01,
+0x02,0x02,0x53,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x53,0x03,0x02,0x02,0x01,0x01,
+0x17,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x1F,0x00,0x58,0x03,0x01,0x02,
+0x01,0x01,0x12,0x00,0x01,0x02,0x5B,0x03,0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x09,0x00,0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x07,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x05,0x00,
+0x01,0x02,0x61,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x03,0x00,
+0x01,0x01,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x03,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x02,0x00,0x62,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x21,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x02,0x01,0x60,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
+0x60,0x03,0x02,0x01,0x5F,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5F,0x03,0x02,0x01,
+0x5E,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x02,0x00,0x5C,0x03,
+0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x02,0x00,0x01,0x02,
+0x59,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x02,0x00,
 0x01,0x01,0x56,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x01,0x4D,0x03,0x03,0x02,0x03,0x01,0x3B,0x00,0x03,0x01,
-0x03,0x02,0x4D,0x03,0x01,0x01,0x5E,0x00,0x01,0x02,0x44,0x03,0x03,0x02,0x03,0x01,
-0x4B,0x00,0x03,0x01,0x03,0x02,0x44,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x3B,0x03,
-0x02,0x02,0x03,0x01,0x5D,0x00,0x03,0x01,0x02,0x02,0x3B,0x03,0x01,0x02,0x62,0x00,
+0x01,0x02,0x04,0x00,0x01,0x01,0x4D,0x03,0x03,0x02,0x03,0x01,0x3B,0x00,0x03,0x01,
+0x03,0x02,0x4D,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x44,0x03,0x03,0x02,0x03,0x01,
+0x4B,0x00,0x03,0x01,0x03,0x02,0x44,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x3B,0x03,
+0x02,0x02,0x03,0x01,0x5D,0x00,0x03,0x01,0x02,0x02,0x3B,0x03,0x01,0x02,0x09,0x00,
 0x01,0x02,0x31,0x03,0x03,0x02,0x02,0x01,0x6E,0x00,0x03,0x01,0x02,0x02,0x32,0x03,
-0x01,0x01,0x64,0x00,0x01,0x01,0x28,0x03,0x03,0x02,0x02,0x01,0x7F,0x00,0x02,0x01,
-0x02,0x02,0x28,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,0x03,0x01,
-0x8F,0x00,0x02,0x01,0x03,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x28,0x03,0x03,0x02,0x02,0x01,0x7F,0x00,0x02,0x01,
+0x02,0x02,0x28,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,0x03,0x01,
+0x8F,0x00,0x02,0x01,0x03,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,
 0x01,0x02,0x13,0x03,0x02,0x02,0x03,0x01,0x9F,0x00,0x02,0x01,0x03,0x02,0x13,0x03,
-0x01,0x02,0x71,0x00,0x02,0x01,0x02,0x02,0x06,0x03,0x02,0x02,0x02,0x01,0xB0,0x00,
-0x03,0x01,0x02,0x02,0x06,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xDB,0x00,
+0x01,0x02,0x18,0x00,0x02,0x01,0x02,0x02,0x06,0x03,0x02,0x02,0x02,0x01,0xB0,0x00,
+0x03,0x01,0x02,0x02,0x06,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,
 };
 static const DiffBlock SAD_FRAME8_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 102,  // Changed box top-left
+    231, 39,  // Changed box dimensions
     SAD_FRAME8_DATA
 };
 
-// Frame 9: Full frame RLE (1058 bytes)
-static const uint8_t SAD_FRAME9_DATA[1058] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x81,0x00,0x03,0x01,0x02,0x02,0x07,0x03,0x01,0x02,0x02,0x01,
-0x33,0x00,0x01,0x01,0x02,0x02,0x07,0x03,0x02,0x02,0x03,0x01,0xE7,0x00,0x02,0x01,
-0x03,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x13,0x03,
-0x02,0x02,0x03,0x01,0xD6,0x00,0x03,0x01,0x03,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
-0x29,0x00,0x01,0x01,0x1E,0x03,0x03,0x02,0x03,0x01,0xC4,0x00,0x03,0x01,0x04,0x02,
-0x27,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x03,0x02,0x03,0x01,
-0xB4,0x00,0x03,0x01,0x03,0x02,0x32,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x32,0x03,
-0x03,0x02,0x03,0x01,0xA3,0x00,0x03,0x01,0x02,0x02,0x3C,0x03,0x01,0x01,0x21,0x00,
-0x01,0x01,0x3B,0x03,0x03,0x02,0x03,0x01,0x93,0x00,0x02,0x01,0x03,0x02,0x44,0x03,
-0x01,0x02,0x21,0x00,0x45,0x03,0x03,0x02,0x02,0x01,0x83,0x00,0x02,0x01,0x02,0x02,
-0x4E,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x4D,0x03,0x03,0x02,0x02,0x01,0x75,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x1E,0x00,0x01,0x01,0x56,0x03,0x02,0x02,0x01,0x01,
-0x6C,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x68,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x01,0x62,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x60,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,0x61,0x03,0x1E,0x00,0x01,0x01,0x61,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5B,0x00,
-0x61,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x60,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x5D,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x01,0x01,
-0x59,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x4F,0x03,0x03,0x02,
-0x03,0x01,0x39,0x00,0x03,0x01,0x03,0x02,0x4F,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,
-0x46,0x03,0x03,0x02,0x03,0x01,0x49,0x00,0x03,0x01,0x03,0x02,0x46,0x03,0x01,0x01,
-0x5E,0x00,0x3E,0x03,0x02,0x02,0x03,0x01,0x5B,0x00,0x03,0x01,0x02,0x02,0x3D,0x03,
-0x01,0x02,0x60,0x00,0x34,0x03,0x03,0x02,0x02,0x01,0x6C,0x00,0x03,0x01,0x02,0x02,
-0x34,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x2A,0x03,0x03,0x02,0x02,0x01,0x7D,0x00,
-0x02,0x01,0x02,0x02,0x2B,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x21,0x03,0x02,0x02,
-0x03,0x01,0x8D,0x00,0x02,0x01,0x03,0x02,0x20,0x03,0x01,0x02,0x68,0x00,0x01,0x01,
-0x17,0x03,0x02,0x02,0x02,0x01,0x9E,0x00,0x02,0x01,0x03,0x02,0x16,0x03,0x01,0x02,
-0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x02,0x02,0x02,0x01,0xAE,0x00,
-0x03,0x01,0x02,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x73,0x00,0x05,0x01,0xBF,0x00,
-0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x9C,0x00,
+// Frame 9: Diff RLE (586 bytes)
+static const uint8_t SAD_FRAME9_DATA[586] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0x03,0x00,0x03,0x01,0x02,0x02,0x07,0x03,0x01,0x02,
+0x02,0x01,0x33,0x00,0x01,0x01,0x02,0x02,0x07,0x03,0x02,0x02,0x03,0x01,0x8E,0x00,
+0x02,0x01,0x03,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
+0x13,0x03,0x02,0x02,0x03,0x01,0x7D,0x00,0x03,0x01,0x03,0x02,0x1D,0x03,0x01,0x02,
+0x01,0x01,0x29,0x00,0x01,0x01,0x1E,0x03,0x03,0x02,0x03,0x01,0x6B,0x00,0x03,0x01,
+0x04,0x02,0x27,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x03,0x02,
+0x03,0x01,0x5B,0x00,0x03,0x01,0x03,0x02,0x32,0x03,0x01,0x01,0x23,0x00,0x01,0x01,
+0x32,0x03,0x03,0x02,0x03,0x01,0x4A,0x00,0x03,0x01,0x02,0x02,0x3C,0x03,0x01,0x01,
+0x21,0x00,0x01,0x01,0x3B,0x03,0x03,0x02,0x03,0x01,0x3A,0x00,0x02,0x01,0x03,0x02,
+0x44,0x03,0x01,0x02,0x21,0x00,0x45,0x03,0x03,0x02,0x02,0x01,0x2A,0x00,0x02,0x01,
+0x02,0x02,0x4E,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x4D,0x03,0x03,0x02,0x02,0x01,
+0x1C,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x1E,0x00,0x01,0x01,0x56,0x03,0x02,0x02,
+0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x61,0x03,0x1E,0x00,0x01,0x01,
+0x61,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,
+0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
+0x02,0x00,0x61,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x02,0x01,
+0x5F,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5F,0x03,0x02,0x01,0x5D,0x03,0x01,0x02,
+0x28,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x57,0x03,
+0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x4F,0x03,0x03,0x02,0x03,0x01,0x39,0x00,0x03,0x01,0x03,0x02,0x4F,0x03,
+0x01,0x01,0x03,0x00,0x01,0x02,0x46,0x03,0x03,0x02,0x03,0x01,0x49,0x00,0x03,0x01,
+0x03,0x02,0x46,0x03,0x01,0x01,0x05,0x00,0x3E,0x03,0x02,0x02,0x03,0x01,0x5B,0x00,
+0x03,0x01,0x02,0x02,0x3D,0x03,0x01,0x02,0x07,0x00,0x34,0x03,0x03,0x02,0x02,0x01,
+0x6C,0x00,0x03,0x01,0x02,0x02,0x34,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x2A,0x03,
+0x03,0x02,0x02,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,0x2B,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x21,0x03,0x02,0x02,0x03,0x01,0x8D,0x00,0x02,0x01,0x03,0x02,0x20,0x03,
+0x01,0x02,0x0F,0x00,0x01,0x01,0x17,0x03,0x02,0x02,0x02,0x01,0x9E,0x00,0x02,0x01,
+0x03,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x02,0x02,0x02,0x01,0xAE,0x00,0x03,0x01,0x02,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x1A,0x00,0x05,0x01,0xBF,0x00,0x04,0x01,0x10,0x00,
 };
 static const DiffBlock SAD_FRAME9_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 107,  // Changed box top-left
+    231, 35,  // Changed box dimensions
     SAD_FRAME9_DATA
 };
 
-// Frame 10: Full frame RLE (1032 bytes)
-static const uint8_t SAD_FRAME10_DATA[1032] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC4,0x00,0x02,0x01,0x03,0x02,0x06,0x03,0x01,0x02,
-0x02,0x01,0x31,0x00,0x02,0x01,0x01,0x02,0x06,0x03,0x02,0x02,0x03,0x01,0xEA,0x00,
-0x03,0x01,0x03,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x03,0x02,0x03,0x01,0xD8,0x00,0x03,0x01,0x03,0x02,0x1D,0x03,0x01,0x02,
-0x28,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x03,0x02,0x03,0x01,0xC8,0x00,0x03,0x01,
-0x03,0x02,0x27,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x27,0x03,0x03,0x02,0x03,0x01,
-0xB7,0x00,0x02,0x01,0x03,0x02,0x31,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x30,0x03,
-0x03,0x02,0x03,0x01,0xA7,0x00,0x02,0x01,0x03,0x02,0x3A,0x03,0x01,0x02,0x21,0x00,
-0x01,0x02,0x3A,0x03,0x03,0x02,0x02,0x01,0x97,0x00,0x02,0x01,0x02,0x02,0x44,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x44,0x03,0x02,0x02,0x02,0x01,0x87,0x00,0x02,0x01,
-0x02,0x02,0x4D,0x03,0x1E,0x00,0x01,0x01,0x4D,0x03,0x02,0x02,0x02,0x01,0x77,0x00,
-0x02,0x01,0x02,0x02,0x55,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x55,0x03,0x02,0x02,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x62,0x00,0x60,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x5F,0x00,0x01,0x01,0x61,0x03,0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1F,0x00,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x60,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x5D,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x59,0x00,
+// Frame 10: Diff RLE (552 bytes)
+static const uint8_t SAD_FRAME10_DATA[552] = {
+0xFF,0x00,0x33,0x00,0x02,0x01,0x03,0x02,0x06,0x03,0x01,0x02,0x02,0x01,0x31,0x00,
+0x02,0x01,0x01,0x02,0x06,0x03,0x02,0x02,0x03,0x01,0x90,0x00,0x03,0x01,0x03,0x02,
+0x12,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x03,0x02,
+0x03,0x01,0x7E,0x00,0x03,0x01,0x03,0x02,0x1D,0x03,0x01,0x02,0x28,0x00,0x01,0x01,
+0x01,0x02,0x1C,0x03,0x03,0x02,0x03,0x01,0x6E,0x00,0x03,0x01,0x03,0x02,0x27,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x27,0x03,0x03,0x02,0x03,0x01,0x5D,0x00,0x02,0x01,
+0x03,0x02,0x31,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x30,0x03,0x03,0x02,0x03,0x01,
+0x4D,0x00,0x02,0x01,0x03,0x02,0x3A,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x3A,0x03,
+0x03,0x02,0x02,0x01,0x3D,0x00,0x02,0x01,0x02,0x02,0x44,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x44,0x03,0x02,0x02,0x02,0x01,0x2D,0x00,0x02,0x01,0x02,0x02,0x4D,0x03,
+0x1E,0x00,0x01,0x01,0x4D,0x03,0x02,0x02,0x02,0x01,0x1D,0x00,0x02,0x01,0x02,0x02,
+0x55,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x55,0x03,0x02,0x02,0x01,0x01,0x13,0x00,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x0E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x08,0x00,0x60,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x05,0x00,
+0x01,0x01,0x61,0x03,0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x04,0x00,0x01,0x02,
+0x60,0x03,0x01,0x02,0x1F,0x00,0x61,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x61,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x60,0x03,
+0x01,0x01,0x21,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x00,0x60,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x00,0x5F,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x01,0x5D,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x5D,0x03,
 0x01,0x01,0x5A,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x02,0x54,0x03,0x03,0x02,0x01,0x01,0x32,0x00,0x02,0x01,0x03,0x02,
-0x54,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x4B,0x03,0x04,0x02,0x03,0x01,0x3F,0x00,
-0x03,0x01,0x03,0x02,0x4C,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,0x42,0x03,0x03,0x02,
-0x03,0x01,0x50,0x00,0x04,0x01,0x03,0x02,0x42,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
-0x3A,0x03,0x03,0x02,0x02,0x01,0x62,0x00,0x03,0x01,0x03,0x02,0x3A,0x03,0x5F,0x00,
+0x01,0x00,0x01,0x02,0x54,0x03,0x03,0x02,0x01,0x01,0x32,0x00,0x02,0x01,0x03,0x02,
+0x54,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x4B,0x03,0x04,0x02,0x03,0x01,0x3F,0x00,
+0x03,0x01,0x03,0x02,0x4C,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x42,0x03,0x03,0x02,
+0x03,0x01,0x50,0x00,0x04,0x01,0x03,0x02,0x42,0x03,0x01,0x02,0x03,0x00,0x01,0x01,
+0x3A,0x03,0x03,0x02,0x02,0x01,0x62,0x00,0x03,0x01,0x03,0x02,0x3A,0x03,0x05,0x00,
 0x01,0x01,0x31,0x03,0x02,0x02,0x03,0x01,0x73,0x00,0x02,0x01,0x03,0x02,0x31,0x03,
-0x61,0x00,0x01,0x01,0x28,0x03,0x02,0x02,0x02,0x01,0x84,0x00,0x03,0x01,0x02,0x02,
-0x27,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,0x02,0x01,0x95,0x00,
-0x02,0x01,0x02,0x02,0x1E,0x03,0x01,0x01,0x67,0x00,0x01,0x01,0x13,0x03,0x03,0x02,
-0x02,0x01,0xA5,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,
+0x07,0x00,0x01,0x01,0x28,0x03,0x02,0x02,0x02,0x01,0x84,0x00,0x03,0x01,0x02,0x02,
+0x27,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,0x02,0x01,0x95,0x00,
+0x02,0x01,0x02,0x02,0x1E,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x13,0x03,0x03,0x02,
+0x02,0x01,0xA5,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x12,0x00,
 0x01,0x01,0x01,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0xB5,0x00,0x02,0x01,0x03,0x02,
-0x06,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD8,0x00,
+0x06,0x03,0x02,0x02,0x01,0x01,0xF1,0x00,
 };
 static const DiffBlock SAD_FRAME10_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 110,  // Changed box top-left
+    230, 32,  // Changed box dimensions
     SAD_FRAME10_DATA
 };
 
-// Frame 11: Full frame RLE (1048 bytes)
-static const uint8_t SAD_FRAME11_DATA[1048] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x85,0x00,0x03,0x01,0x05,0x02,0x02,0x01,0x36,0x00,0x07,0x01,
-0xF1,0x00,0x03,0x01,0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x02,0x02,0x03,0x01,0xE0,0x00,0x03,0x01,0x02,0x02,0x19,0x03,
-0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x03,0x01,
-0xD0,0x00,0x03,0x01,0x02,0x02,0x23,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x22,0x03,
-0x03,0x02,0x03,0x01,0xBF,0x00,0x03,0x01,0x03,0x02,0x2B,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x2C,0x03,0x03,0x02,0x03,0x01,0xAF,0x00,0x02,0x01,0x03,0x02,0x36,0x03,
-0x01,0x01,0x21,0x00,0x01,0x01,0x36,0x03,0x02,0x02,0x03,0x01,0x9F,0x00,0x03,0x01,
-0x02,0x02,0x3E,0x03,0x01,0x02,0x21,0x00,0x3F,0x03,0x03,0x02,0x02,0x01,0x90,0x00,
-0x02,0x01,0x02,0x02,0x47,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x47,0x03,0x03,0x02,
-0x02,0x01,0x80,0x00,0x02,0x01,0x02,0x02,0x50,0x03,0x1E,0x00,0x01,0x01,0x51,0x03,
-0x02,0x02,0x02,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x60,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x61,0x03,
-0x1E,0x00,0x01,0x01,0x61,0x03,0x5E,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1F,0x00,
-0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x20,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,
-0x21,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x24,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x26,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x01,0x01,0x29,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x52,0x03,0x03,0x02,0x02,0x01,0x34,0x00,0x01,0x01,0x03,0x02,0x54,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x4A,0x03,0x03,0x02,0x03,0x01,0x42,0x00,0x03,0x01,
-0x03,0x02,0x4B,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,0x41,0x03,0x03,0x02,0x03,0x01,
-0x52,0x00,0x03,0x01,0x03,0x02,0x42,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x39,0x03,
-0x03,0x02,0x03,0x01,0x63,0x00,0x02,0x01,0x03,0x02,0x39,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x31,0x03,0x02,0x02,0x03,0x01,0x73,0x00,0x03,0x01,0x02,0x02,0x30,0x03,
-0x01,0x02,0x62,0x00,0x28,0x03,0x02,0x02,0x03,0x01,0x83,0x00,0x03,0x01,0x02,0x02,
-0x27,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x1E,0x03,0x03,0x02,0x02,0x01,0x93,0x00,
-0x03,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x15,0x03,0x02,0x02,
-0x02,0x01,0xA4,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
-0x01,0x01,0x02,0x02,0x09,0x03,0x02,0x02,0x02,0x01,0xB4,0x00,0x02,0x01,0x02,0x02,
-0x07,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD8,0x00,
+// Frame 11: Diff RLE (534 bytes)
+static const uint8_t SAD_FRAME11_DATA[534] = {
+0x4C,0x00,0x03,0x01,0x05,0x02,0x02,0x01,0x36,0x00,0x07,0x01,0x94,0x00,0x03,0x01,
+0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x02,0x02,0x03,0x01,0x83,0x00,0x03,0x01,0x02,0x02,0x19,0x03,0x01,0x02,0x01,0x01,
+0x29,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x03,0x01,0x73,0x00,0x03,0x01,
+0x02,0x02,0x23,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x22,0x03,0x03,0x02,0x03,0x01,
+0x62,0x00,0x03,0x01,0x03,0x02,0x2B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x2C,0x03,
+0x03,0x02,0x03,0x01,0x52,0x00,0x02,0x01,0x03,0x02,0x36,0x03,0x01,0x01,0x21,0x00,
+0x01,0x01,0x36,0x03,0x02,0x02,0x03,0x01,0x42,0x00,0x03,0x01,0x02,0x02,0x3E,0x03,
+0x01,0x02,0x21,0x00,0x3F,0x03,0x03,0x02,0x02,0x01,0x33,0x00,0x02,0x01,0x02,0x02,
+0x47,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x47,0x03,0x03,0x02,0x02,0x01,0x23,0x00,
+0x02,0x01,0x02,0x02,0x50,0x03,0x1E,0x00,0x01,0x01,0x51,0x03,0x02,0x02,0x02,0x01,
+0x16,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x60,0x03,0x01,0x01,0x02,0x00,0x61,0x03,0x1E,0x00,0x01,0x01,0x61,0x03,
+0x02,0x00,0x60,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x00,
+0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5E,0x03,0x01,0x02,
+0x01,0x01,0x21,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5D,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x5C,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0xB9,0x03,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x58,0x03,0x01,0x02,
+0x2E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x51,0x03,0x03,0x02,0x02,0x01,
+0x34,0x00,0x01,0x01,0x03,0x02,0x54,0x03,0x01,0x01,0x49,0x03,0x03,0x02,0x03,0x01,
+0x42,0x00,0x03,0x01,0x03,0x02,0x4B,0x03,0x01,0x01,0x41,0x03,0x03,0x02,0x03,0x01,
+0x52,0x00,0x03,0x01,0x03,0x02,0x42,0x03,0x01,0x01,0x01,0x00,0x39,0x03,0x03,0x02,
+0x03,0x01,0x63,0x00,0x02,0x01,0x03,0x02,0x39,0x03,0x01,0x02,0x02,0x00,0x01,0x01,
+0x31,0x03,0x02,0x02,0x03,0x01,0x73,0x00,0x03,0x01,0x02,0x02,0x30,0x03,0x01,0x02,
+0x05,0x00,0x28,0x03,0x02,0x02,0x03,0x01,0x83,0x00,0x03,0x01,0x02,0x02,0x27,0x03,
+0x01,0x02,0x07,0x00,0x01,0x01,0x1E,0x03,0x03,0x02,0x02,0x01,0x93,0x00,0x03,0x01,
+0x02,0x02,0x1D,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x15,0x03,0x02,0x02,0x02,0x01,
+0xA4,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x02,0x02,0x09,0x03,0x02,0x02,0x02,0x01,0xB4,0x00,0x02,0x01,0x02,0x02,0x07,0x03,
+0x02,0x02,0x01,0x01,0x0A,0x00,
 };
 static const DiffBlock SAD_FRAME11_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    47, 110,  // Changed box top-left
+    227, 31,  // Changed box dimensions
     SAD_FRAME11_DATA
 };
 
-// Frame 12: Full frame RLE (1064 bytes)
-static const uint8_t SAD_FRAME12_DATA[1064] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x03,0x00,0x02,0x01,0x05,0x02,0x02,0x01,0x39,0x00,0x05,0x01,0xF2,0x00,0x02,0x01,
+// Frame 12: Diff RLE (596 bytes)
+static const uint8_t SAD_FRAME12_DATA[596] = {
+0x4F,0x00,0x02,0x01,0x05,0x02,0x02,0x01,0x39,0x00,0x05,0x01,0x99,0x00,0x02,0x01,
 0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x02,0x02,0x02,0x01,0xE3,0x00,0x03,0x01,0x02,0x02,0x18,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0xD4,0x00,0x02,0x01,0x03,0x02,
+0x02,0x02,0x02,0x01,0x8A,0x00,0x03,0x01,0x02,0x02,0x18,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0x7B,0x00,0x02,0x01,0x03,0x02,
 0x20,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,0x03,0x01,
-0xC5,0x00,0x02,0x01,0x03,0x02,0x29,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x29,0x03,
-0x02,0x02,0x03,0x01,0xB5,0x00,0x03,0x01,0x02,0x02,0x32,0x03,0x01,0x02,0x23,0x00,
-0x01,0x02,0x31,0x03,0x03,0x02,0x03,0x01,0xA6,0x00,0x02,0x01,0x03,0x02,0x3A,0x03,
-0x01,0x02,0x21,0x00,0x01,0x02,0x3A,0x03,0x03,0x02,0x03,0x01,0x97,0x00,0x02,0x01,
+0x6C,0x00,0x02,0x01,0x03,0x02,0x29,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x29,0x03,
+0x02,0x02,0x03,0x01,0x5C,0x00,0x03,0x01,0x02,0x02,0x32,0x03,0x01,0x02,0x23,0x00,
+0x01,0x02,0x31,0x03,0x03,0x02,0x03,0x01,0x4D,0x00,0x02,0x01,0x03,0x02,0x3A,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x3A,0x03,0x03,0x02,0x03,0x01,0x3E,0x00,0x02,0x01,
 0x02,0x02,0x43,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x43,0x03,0x03,0x02,0x02,0x01,
-0x89,0x00,0x02,0x01,0x02,0x02,0x4A,0x03,0x01,0x02,0x1F,0x00,0x4C,0x03,0x03,0x02,
-0x02,0x01,0x7A,0x00,0x02,0x01,0x02,0x02,0x52,0x03,0x1E,0x00,0x01,0x01,0x54,0x03,
-0x02,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x60,0x03,0x1E,0x00,
-0x01,0x01,0x60,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x1E,0x00,
-0x01,0x01,0x61,0x03,0x5E,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,
-0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x21,0x00,0x61,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x5B,0x00,0x5F,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x01,0x01,0x59,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x5B,0x00,0x59,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x52,0x03,0x02,0x02,0x02,0x01,0x35,0x00,
-0x02,0x01,0x02,0x02,0x54,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x4A,0x03,0x03,0x02,
-0x02,0x01,0x43,0x00,0x02,0x01,0x03,0x02,0x4C,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,
-0x42,0x03,0x03,0x02,0x02,0x01,0x51,0x00,0x03,0x01,0x03,0x02,0x43,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x3B,0x03,0x02,0x02,0x03,0x01,0x60,0x00,0x03,0x01,0x03,0x02,
-0x3A,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x33,0x03,0x02,0x02,0x02,0x01,0x70,0x00,
-0x03,0x01,0x02,0x02,0x32,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x2B,0x03,0x02,0x02,
-0x02,0x01,0x7F,0x00,0x02,0x01,0x03,0x02,0x29,0x03,0x01,0x02,0x64,0x00,0x01,0x02,
-0x21,0x03,0x02,0x02,0x02,0x01,0x8F,0x00,0x02,0x01,0x02,0x02,0x21,0x03,0x01,0x01,
-0x66,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x9E,0x00,0x02,0x01,
-0x02,0x02,0x17,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,
-0xAC,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x01,0x02,0x71,0x00,0x02,0x01,0x06,0x02,
-0x02,0x01,0xBB,0x00,0x06,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xDC,0x00,
+0x30,0x00,0x02,0x01,0x02,0x02,0x4A,0x03,0x01,0x02,0x1F,0x00,0x4C,0x03,0x03,0x02,
+0x02,0x01,0x21,0x00,0x02,0x01,0x02,0x02,0x52,0x03,0x1E,0x00,0x01,0x01,0x54,0x03,
+0x02,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x60,0x03,0x1E,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x1E,0x00,
+0x01,0x01,0x61,0x03,0x05,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,
+0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x21,0x00,0x61,0x03,
+0x01,0x01,0x02,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x60,0x03,
+0x01,0x02,0x02,0x00,0x5F,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
+0x02,0x01,0x5C,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x02,0x00,
+0x59,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x52,0x03,0x02,0x02,0x02,0x01,0x35,0x00,0x02,0x01,0x02,0x02,
+0x54,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x4A,0x03,0x03,0x02,0x02,0x01,0x43,0x00,
+0x02,0x01,0x03,0x02,0x4C,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x42,0x03,0x03,0x02,
+0x02,0x01,0x51,0x00,0x03,0x01,0x03,0x02,0x43,0x03,0x01,0x01,0x04,0x00,0x01,0x01,
+0x3B,0x03,0x02,0x02,0x03,0x01,0x60,0x00,0x03,0x01,0x03,0x02,0x3A,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x33,0x03,0x02,0x02,0x02,0x01,0x70,0x00,0x03,0x01,0x02,0x02,
+0x32,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x2B,0x03,0x02,0x02,0x02,0x01,0x7F,0x00,
+0x02,0x01,0x03,0x02,0x29,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x21,0x03,0x02,0x02,
+0x02,0x01,0x8F,0x00,0x02,0x01,0x02,0x02,0x21,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x9E,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
+0x01,0x01,0x12,0x00,0x01,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0xAC,0x00,0x02,0x01,
+0x02,0x02,0x0D,0x03,0x01,0x02,0x18,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0xBB,0x00,
+0x06,0x01,0x0F,0x00,
 };
 static const DiffBlock SAD_FRAME12_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 108,  // Changed box top-left
+    231, 33,  // Changed box dimensions
     SAD_FRAME12_DATA
 };
 
-// Frame 13: Full frame RLE (1084 bytes)
-static const uint8_t SAD_FRAME13_DATA[1084] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x3E,0x00,0x03,0x01,0x04,0x02,0x02,0x01,
-0x39,0x00,0x08,0x01,0xF0,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x31,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,0x02,0x01,0xE3,0x00,0x02,0x01,
-0x02,0x02,0x17,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x16,0x03,0x02,0x02,0x02,0x01,
-0xD5,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x1F,0x03,
-0x02,0x02,0x02,0x01,0xC8,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x26,0x00,0x01,0x01,
-0x28,0x03,0x02,0x02,0x02,0x01,0xBA,0x00,0x02,0x01,0x02,0x02,0x30,0x03,0x01,0x01,
-0x23,0x00,0x01,0x01,0x30,0x03,0x02,0x02,0x02,0x01,0xAC,0x00,0x02,0x01,0x02,0x02,
-0x38,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x38,0x03,0x02,0x02,0x02,0x01,0x9E,0x00,
-0x02,0x01,0x03,0x02,0x3E,0x03,0x01,0x02,0x21,0x00,0x3F,0x03,0x03,0x02,0x02,0x01,
-0x90,0x00,0x03,0x01,0x02,0x02,0x46,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x46,0x03,
-0x03,0x02,0x02,0x01,0x82,0x00,0x03,0x01,0x02,0x02,0x4E,0x03,0x1E,0x00,0x01,0x01,
-0x4E,0x03,0x03,0x02,0x02,0x01,0x76,0x00,0x01,0x01,0x02,0x02,0x55,0x03,0x1E,0x00,
-0x01,0x01,0x55,0x03,0x02,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x65,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x5F,0x03,0x1E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x60,0x03,0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x60,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x5E,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x21,0x00,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x60,0x03,0x22,0x00,0x01,0x01,
-0x60,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5F,0x03,0x24,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x5B,0x00,0x5E,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x5B,0x00,0x58,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,
-0x57,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,
-0x02,0x01,0x02,0x02,0x51,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x4A,0x03,0x02,0x02,
-0x02,0x01,0x47,0x00,0x01,0x01,0x03,0x02,0x4A,0x03,0x5D,0x00,0x01,0x02,0x42,0x03,
-0x02,0x02,0x02,0x01,0x54,0x00,0x02,0x01,0x03,0x02,0x42,0x03,0x01,0x01,0x5D,0x00,
-0x01,0x01,0x3B,0x03,0x02,0x02,0x02,0x01,0x62,0x00,0x02,0x01,0x03,0x02,0x3A,0x03,
-0x01,0x02,0x5F,0x00,0x01,0x01,0x33,0x03,0x02,0x02,0x03,0x01,0x6F,0x00,0x02,0x01,
-0x03,0x02,0x32,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x2B,0x03,0x02,0x02,0x03,0x01,
-0x7D,0x00,0x02,0x01,0x03,0x02,0x2A,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x22,0x03,
-0x02,0x02,0x03,0x01,0x8B,0x00,0x03,0x01,0x02,0x02,0x22,0x03,0x01,0x01,0x66,0x00,
-0x01,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x99,0x00,0x03,0x01,0x01,0x02,
-0x1A,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x02,0x01,
-0xA7,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,
-0x02,0x02,0x05,0x03,0x02,0x02,0x02,0x01,0xB5,0x00,0x02,0x01,0x03,0x02,0x03,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x5D,0x00,
+// Frame 13: Diff RLE (624 bytes)
+static const uint8_t SAD_FRAME13_DATA[624] = {
+0x4E,0x00,0x03,0x01,0x04,0x02,0x02,0x01,0x39,0x00,0x08,0x01,0x97,0x00,0x02,0x01,
+0x02,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x02,0x02,0x02,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x2D,0x00,
+0x01,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0x7C,0x00,0x02,0x01,0x02,0x02,0x20,0x03,
+0x01,0x02,0x29,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,0x6F,0x00,0x02,0x01,
+0x01,0x02,0x29,0x03,0x26,0x00,0x01,0x01,0x28,0x03,0x02,0x02,0x02,0x01,0x61,0x00,
+0x02,0x01,0x02,0x02,0x30,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x30,0x03,0x02,0x02,
+0x02,0x01,0x53,0x00,0x02,0x01,0x02,0x02,0x38,0x03,0x01,0x01,0x21,0x00,0x01,0x01,
+0x38,0x03,0x02,0x02,0x02,0x01,0x45,0x00,0x02,0x01,0x03,0x02,0x3E,0x03,0x01,0x02,
+0x21,0x00,0x3F,0x03,0x03,0x02,0x02,0x01,0x37,0x00,0x03,0x01,0x02,0x02,0x46,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x46,0x03,0x03,0x02,0x02,0x01,0x29,0x00,0x03,0x01,
+0x02,0x02,0x4E,0x03,0x1E,0x00,0x01,0x01,0x4E,0x03,0x03,0x02,0x02,0x01,0x1D,0x00,
+0x01,0x01,0x02,0x02,0x55,0x03,0x1E,0x00,0x01,0x01,0x55,0x03,0x02,0x02,0x01,0x01,
+0x15,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x59,0x03,
+0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x5D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x5F,0x03,0x1E,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x60,0x03,0x1E,0x00,0x01,0x01,0x60,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,
+0x05,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x60,0x03,0x22,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x02,0x00,0x01,0x02,
+0x5F,0x03,0x24,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x02,0x00,0x5E,0x03,0x01,0x02,
+0x26,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,
+0x29,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x2C,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x02,0x00,0x58,0x03,0x01,0x02,
+0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x02,0x00,0x01,0x02,
+0x51,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,0x02,0x01,0x02,0x02,0x51,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x4A,0x03,0x02,0x02,0x02,0x01,0x47,0x00,0x01,0x01,0x03,0x02,
+0x4A,0x03,0x04,0x00,0x01,0x02,0x42,0x03,0x02,0x02,0x02,0x01,0x54,0x00,0x02,0x01,
+0x03,0x02,0x42,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x3B,0x03,0x02,0x02,0x02,0x01,
+0x62,0x00,0x02,0x01,0x03,0x02,0x3A,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x33,0x03,
+0x02,0x02,0x03,0x01,0x6F,0x00,0x02,0x01,0x03,0x02,0x32,0x03,0x01,0x02,0x08,0x00,
+0x01,0x01,0x2B,0x03,0x02,0x02,0x03,0x01,0x7D,0x00,0x02,0x01,0x03,0x02,0x2A,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x22,0x03,0x02,0x02,0x03,0x01,0x8B,0x00,0x03,0x01,
+0x02,0x02,0x22,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,
+0x02,0x01,0x99,0x00,0x03,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x11,0x00,0x01,0x01,
+0x01,0x02,0x11,0x03,0x02,0x02,0x02,0x01,0xA7,0x00,0x02,0x01,0x02,0x02,0x10,0x03,
+0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x02,0x02,0x05,0x03,0x02,0x02,0x02,0x01,
+0xB5,0x00,0x02,0x01,0x03,0x02,0x03,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0xDC,0x00,
+
 };
 static const DiffBlock SAD_FRAME13_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 105,  // Changed box top-left
+    231, 36,  // Changed box dimensions
     SAD_FRAME13_DATA
 };
 
-// Frame 14: Full frame RLE (1116 bytes)
-static const uint8_t SAD_FRAME14_DATA[1116] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x3B,0x00,
-0x05,0x01,0x3C,0x00,0x08,0x01,0xF0,0x00,0x02,0x01,0x02,0x02,0x0A,0x03,0x02,0x02,
-0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,0x02,0x01,0xE3,0x00,
-0x02,0x01,0x03,0x02,0x14,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x15,0x03,
-0x02,0x02,0x02,0x01,0xD7,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,0x2A,0x00,
-0x01,0x01,0x1E,0x03,0x02,0x02,0x02,0x01,0xCA,0x00,0x03,0x01,0x02,0x02,0x25,0x03,
-0x01,0x01,0x27,0x00,0x01,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0xBE,0x00,0x02,0x01,
-0x02,0x02,0x2D,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,
-0xB2,0x00,0x02,0x01,0x02,0x02,0x34,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x34,0x03,
-0x02,0x02,0x01,0x01,0xA6,0x00,0x02,0x01,0x02,0x02,0x3B,0x03,0x01,0x01,0x21,0x00,
-0x01,0x02,0x3B,0x03,0x02,0x02,0x01,0x01,0x9A,0x00,0x02,0x01,0x01,0x02,0x43,0x03,
-0x20,0x00,0x01,0x01,0x42,0x03,0x02,0x02,0x01,0x01,0x8E,0x00,0x02,0x01,0x01,0x02,
-0x49,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x02,0x01,0x81,0x00,
-0x02,0x01,0x02,0x02,0x50,0x03,0x1E,0x00,0x01,0x01,0x4F,0x03,0x02,0x02,0x01,0x01,
-0x76,0x00,0x02,0x01,0x01,0x02,0x56,0x03,0x1E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x02,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x01,0x5D,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x5F,0x03,0x1E,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x27,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x01,0x5B,0x00,0x5C,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,
-0x01,0x02,0x5B,0x03,0x01,0x02,0x5B,0x00,0x5A,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x01,0x01,0x33,0x00,0x01,0x01,0x02,0x02,0x55,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x50,0x03,0x02,0x02,0x02,0x01,0x3C,0x00,0x02,0x01,0x01,0x02,0x50,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x4A,0x03,0x02,0x02,0x02,0x01,0x48,0x00,0x02,0x01,0x01,0x02,
-0x4A,0x03,0x5D,0x00,0x01,0x02,0x43,0x03,0x02,0x02,0x01,0x01,0x55,0x00,0x02,0x01,
-0x01,0x02,0x43,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x02,0x01,
-0x61,0x00,0x02,0x01,0x01,0x02,0x3D,0x03,0x5F,0x00,0x01,0x01,0x35,0x03,0x02,0x02,
-0x02,0x01,0x6D,0x00,0x02,0x01,0x01,0x02,0x36,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x2E,0x03,0x02,0x02,0x02,0x01,0x79,0x00,0x02,0x01,0x02,0x02,0x2E,0x03,0x01,0x01,
-0x62,0x00,0x01,0x01,0x26,0x03,0x03,0x02,0x02,0x01,0x85,0x00,0x02,0x01,0x02,0x02,
-0x27,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x1E,0x03,0x02,0x02,0x03,0x01,0x91,0x00,
-0x02,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x69,0x00,0x01,0x02,0x16,0x03,0x02,0x02,
-0x02,0x01,0x9E,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x02,0x02,0x03,0x01,0xAA,0x00,0x02,0x01,0x02,0x02,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x73,0x00,0x08,0x01,0xB8,0x00,0x02,0x01,0x05,0x02,0x02,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE1,0x00,
+// Frame 14: Diff RLE (662 bytes)
+static const uint8_t SAD_FRAME14_DATA[662] = {
+0x50,0x00,0x05,0x01,0x3C,0x00,0x08,0x01,0x96,0x00,0x02,0x01,0x02,0x02,0x0A,0x03,
+0x02,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,0x02,0x01,
+0x89,0x00,0x02,0x01,0x03,0x02,0x14,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,
+0x15,0x03,0x02,0x02,0x02,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,0x02,0x01,0x70,0x00,0x03,0x01,0x02,0x02,
+0x25,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x64,0x00,
+0x02,0x01,0x02,0x02,0x2D,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x2D,0x03,0x02,0x02,
+0x01,0x01,0x58,0x00,0x02,0x01,0x02,0x02,0x34,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x34,0x03,0x02,0x02,0x01,0x01,0x4C,0x00,0x02,0x01,0x02,0x02,0x3B,0x03,0x01,0x01,
+0x21,0x00,0x01,0x02,0x3B,0x03,0x02,0x02,0x01,0x01,0x40,0x00,0x02,0x01,0x01,0x02,
+0x43,0x03,0x20,0x00,0x01,0x01,0x42,0x03,0x02,0x02,0x01,0x01,0x34,0x00,0x02,0x01,
+0x01,0x02,0x49,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x02,0x01,
+0x27,0x00,0x02,0x01,0x02,0x02,0x50,0x03,0x1E,0x00,0x01,0x01,0x4F,0x03,0x02,0x02,
+0x01,0x01,0x1C,0x00,0x02,0x01,0x01,0x02,0x56,0x03,0x1E,0x00,0x01,0x01,0x55,0x03,
+0x01,0x02,0x02,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x5B,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x5F,0x03,0x1E,0x00,
+0x01,0x01,0x5E,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x1F,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x21,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x23,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x25,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x27,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x01,0x01,0x00,0x5C,0x03,0x01,0x02,0x01,0x01,0x29,0x00,
+0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x00,0x5A,0x03,0x01,0x02,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x02,0x02,0x55,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x50,0x03,0x02,0x02,0x02,0x01,0x3C,0x00,0x02,0x01,0x01,0x02,0x50,0x03,
+0x01,0x01,0x01,0x00,0x01,0x01,0x4A,0x03,0x02,0x02,0x02,0x01,0x48,0x00,0x02,0x01,
+0x01,0x02,0x4A,0x03,0x03,0x00,0x01,0x02,0x43,0x03,0x02,0x02,0x01,0x01,0x55,0x00,
+0x02,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,
+0x02,0x01,0x61,0x00,0x02,0x01,0x01,0x02,0x3D,0x03,0x05,0x00,0x01,0x01,0x35,0x03,
+0x02,0x02,0x02,0x01,0x6D,0x00,0x02,0x01,0x01,0x02,0x36,0x03,0x01,0x01,0x06,0x00,
+0x01,0x01,0x2E,0x03,0x02,0x02,0x02,0x01,0x79,0x00,0x02,0x01,0x02,0x02,0x2E,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x26,0x03,0x03,0x02,0x02,0x01,0x85,0x00,0x02,0x01,
+0x02,0x02,0x27,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x1E,0x03,0x02,0x02,0x03,0x01,
+0x91,0x00,0x02,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x16,0x03,
+0x02,0x02,0x02,0x01,0x9E,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x13,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,0x03,0x01,0xAA,0x00,0x02,0x01,0x02,0x02,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x08,0x01,0xB8,0x00,0x02,0x01,0x05,0x02,
+0x02,0x01,0xFF,0x00,0xDB,0x00,
 };
 static const DiffBlock SAD_FRAME14_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 101,  // Changed box top-left
+    230, 38,  // Changed box dimensions
     SAD_FRAME14_DATA
 };
 
-// Frame 15: Full frame RLE (1138 bytes)
-static const uint8_t SAD_FRAME15_DATA[1138] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB6,0x00,0x02,0x01,0x02,0x02,0x03,0x01,
-0x3B,0x00,0x02,0x01,0x07,0x02,0x01,0x01,0xED,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x02,0x01,0xE1,0x00,
-0x02,0x01,0x02,0x02,0x16,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x16,0x03,
-0x02,0x02,0x02,0x01,0xD5,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x01,0x01,0x2A,0x00,
-0x01,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0xC9,0x00,0x02,0x01,0x02,0x02,
-0x26,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x26,0x03,0x02,0x02,0x02,0x01,0xBD,0x00,
-0x02,0x01,0x03,0x02,0x2C,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x2C,0x03,0x02,0x02,
-0x03,0x01,0xB1,0x00,0x02,0x01,0x02,0x02,0x34,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x33,0x03,0x02,0x02,0x02,0x01,0xA7,0x00,0x01,0x01,0x02,0x02,0x3B,0x03,0x01,0x01,
-0x21,0x00,0x01,0x02,0x3A,0x03,0x02,0x02,0x02,0x01,0x9B,0x00,0x01,0x01,0x02,0x02,
-0x41,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x41,0x03,0x02,0x02,0x01,0x01,0x90,0x00,
-0x02,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
-0x02,0x01,0x84,0x00,0x02,0x01,0x01,0x02,0x4E,0x03,0x01,0x02,0x1F,0x00,0x4D,0x03,
-0x02,0x02,0x02,0x01,0x79,0x00,0x01,0x01,0x02,0x02,0x54,0x03,0x1E,0x00,0x01,0x01,
-0x53,0x03,0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x5D,0x03,
-0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x5E,0x03,0x1E,0x00,
-0x01,0x01,0x5E,0x03,0x63,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x01,0x60,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
-0x5F,0x03,0x5E,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x5F,0x03,0x24,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,
-0x5C,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x02,0x57,0x03,0x02,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x53,0x03,0x02,0x02,0x02,0x01,0x36,0x00,0x02,0x01,
-0x02,0x02,0x52,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x4D,0x03,0x02,0x02,0x02,0x01,
-0x42,0x00,0x02,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x47,0x03,
-0x02,0x02,0x02,0x01,0x4D,0x00,0x02,0x01,0x02,0x02,0x46,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x41,0x03,0x01,0x02,0x02,0x01,0x59,0x00,0x02,0x01,0x01,0x02,0x41,0x03,
-0x01,0x01,0x5E,0x00,0x01,0x02,0x3A,0x03,0x02,0x02,0x01,0x01,0x65,0x00,0x02,0x01,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x60,0x00,0x34,0x03,0x02,0x02,0x01,0x01,0x71,0x00,
-0x01,0x01,0x02,0x02,0x33,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x2C,0x03,0x02,0x02,
-0x01,0x01,0x7C,0x00,0x02,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x64,0x00,0x01,0x02,
-0x25,0x03,0x02,0x02,0x02,0x01,0x87,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,
-0x66,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,0x02,0x01,0x92,0x00,0x02,0x01,0x02,0x02,
-0x1E,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x02,0x02,
-0x02,0x01,0x9E,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,0x02,0x01,0xAA,0x00,0x02,0x01,0x02,0x02,
-0x0D,0x03,0x02,0x02,0x01,0x01,0x74,0x00,0x08,0x01,0xB6,0x00,0x02,0x01,0x05,0x02,
-0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x23,0x00,
+// Frame 15: Diff RLE (668 bytes)
+static const uint8_t SAD_FRAME15_DATA[668] = {
+0x4D,0x00,0x02,0x01,0x02,0x02,0x03,0x01,0x3B,0x00,0x02,0x01,0x07,0x02,0x01,0x01,
+0x92,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,
+0x0F,0x03,0x01,0x02,0x02,0x01,0x86,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x01,0x01,
+0x2E,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0x7A,0x00,0x02,0x01,
+0x02,0x02,0x1E,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,
+0x02,0x01,0x6E,0x00,0x02,0x01,0x02,0x02,0x26,0x03,0x01,0x01,0x27,0x00,0x01,0x02,
+0x26,0x03,0x02,0x02,0x02,0x01,0x62,0x00,0x02,0x01,0x03,0x02,0x2C,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x2C,0x03,0x02,0x02,0x03,0x01,0x56,0x00,0x02,0x01,0x02,0x02,
+0x34,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x33,0x03,0x02,0x02,0x02,0x01,0x4C,0x00,
+0x01,0x01,0x02,0x02,0x3B,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x3A,0x03,0x02,0x02,
+0x02,0x01,0x40,0x00,0x01,0x01,0x02,0x02,0x41,0x03,0x01,0x02,0x20,0x00,0x01,0x01,
+0x41,0x03,0x02,0x02,0x01,0x01,0x35,0x00,0x02,0x01,0x01,0x02,0x48,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x02,0x01,0x29,0x00,0x02,0x01,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x1F,0x00,0x4D,0x03,0x02,0x02,0x02,0x01,0x1E,0x00,0x01,0x01,
+0x02,0x02,0x54,0x03,0x1E,0x00,0x01,0x01,0x53,0x03,0x02,0x02,0x01,0x01,0x16,0x00,
+0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x01,0x01,0x11,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x01,0x5D,0x03,0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x5E,0x03,0x1E,0x00,0x01,0x01,0x5E,0x03,0x08,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x02,
+0x5F,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x03,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x23,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x5F,0x03,
+0x24,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x29,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,
+0x5A,0x03,0x02,0x02,0x57,0x03,0x02,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
+0x01,0x01,0x01,0x02,0x53,0x03,0x02,0x02,0x02,0x01,0x36,0x00,0x02,0x01,0x02,0x02,
+0x52,0x03,0x01,0x01,0x01,0x02,0x4D,0x03,0x02,0x02,0x02,0x01,0x42,0x00,0x02,0x01,
+0x01,0x02,0x4D,0x03,0x02,0x01,0x47,0x03,0x02,0x02,0x02,0x01,0x4D,0x00,0x02,0x01,
+0x02,0x02,0x46,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x02,0x01,
+0x59,0x00,0x02,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x3A,0x03,
+0x02,0x02,0x01,0x01,0x65,0x00,0x02,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x05,0x00,
+0x34,0x03,0x02,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x02,0x02,0x33,0x03,0x01,0x02,
+0x07,0x00,0x01,0x02,0x2C,0x03,0x02,0x02,0x01,0x01,0x7C,0x00,0x02,0x01,0x01,0x02,
+0x2D,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x25,0x03,0x02,0x02,0x02,0x01,0x87,0x00,
+0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x1E,0x03,0x02,0x02,
+0x02,0x01,0x92,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x9E,0x00,0x02,0x01,0x02,0x02,
+0x16,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,
+0x02,0x01,0xAA,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x02,0x02,0x01,0x01,0x19,0x00,
+0x08,0x01,0xB6,0x00,0x02,0x01,0x05,0x02,0x03,0x01,0xF3,0x00,
 };
 static const DiffBlock SAD_FRAME15_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 99,  // Changed box top-left
+    229, 38,  // Changed box dimensions
     SAD_FRAME15_DATA
 };
 
-// Frame 16: Full frame RLE (1146 bytes)
-static const uint8_t SAD_FRAME16_DATA[1146] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x74,0x00,0x02,0x01,0x04,0x02,0x02,0x01,0x3C,0x00,
-0x02,0x01,0x06,0x02,0x02,0x01,0xEC,0x00,0x02,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0xE1,0x00,
-0x02,0x01,0x02,0x02,0x16,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x17,0x03,0x01,0x02,
-0x02,0x01,0xD6,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,
-0x1E,0x03,0x02,0x02,0x01,0x01,0xCB,0x00,0x02,0x01,0x02,0x02,0x24,0x03,0x01,0x02,
-0x28,0x00,0x01,0x01,0x25,0x03,0x02,0x02,0x02,0x01,0xBF,0x00,0x02,0x01,0x02,0x02,
-0x2C,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x2C,0x03,0x02,0x02,0x02,0x01,0xB3,0x00,
-0x02,0x01,0x02,0x02,0x33,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x33,0x03,0x02,0x02,
-0x02,0x01,0xA7,0x00,0x02,0x01,0x02,0x02,0x3A,0x03,0x01,0x01,0x21,0x00,0x01,0x01,
-0x39,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,0x01,0x01,0x02,0x02,0x40,0x03,0x01,0x02,
-0x21,0x00,0x40,0x03,0x02,0x02,0x02,0x01,0x91,0x00,0x02,0x01,0x01,0x02,0x47,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x46,0x03,0x02,0x02,0x01,0x01,0x87,0x00,0x01,0x01,
-0x02,0x02,0x4C,0x03,0x01,0x02,0x1F,0x00,0x4C,0x03,0x02,0x02,0x01,0x01,0x7C,0x00,
-0x02,0x01,0x01,0x02,0x53,0x03,0x1E,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x02,0x01,
-0x73,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x1E,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
-0x01,0x01,0x6D,0x00,0x01,0x02,0x5A,0x03,0x1E,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x02,0x5C,0x03,0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x5E,0x03,0x1E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x63,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x61,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x60,0x00,0x5F,0x03,0x01,0x02,0x21,0x00,0x5F,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x55,0x03,0x02,0x02,0x01,0x01,0x33,0x00,0x02,0x01,0x01,0x02,
-0x55,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x50,0x03,0x02,0x02,0x02,0x01,0x3C,0x00,
-0x02,0x01,0x02,0x02,0x4F,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x4A,0x03,0x02,0x02,
-0x02,0x01,0x47,0x00,0x02,0x01,0x02,0x02,0x4A,0x03,0x5D,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x02,0x01,0x53,0x00,0x02,0x01,0x02,0x02,0x43,0x03,0x01,0x01,0x5D,0x00,
-0x01,0x01,0x3E,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x3E,0x03,
-0x5F,0x00,0x01,0x01,0x37,0x03,0x02,0x02,0x02,0x01,0x69,0x00,0x02,0x01,0x01,0x02,
-0x38,0x03,0x01,0x01,0x60,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x02,0x01,0x75,0x00,
-0x01,0x01,0x02,0x02,0x31,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x2A,0x03,0x02,0x02,
-0x01,0x01,0x80,0x00,0x02,0x01,0x02,0x02,0x2A,0x03,0x01,0x01,0x64,0x00,0x01,0x01,
-0x23,0x03,0x02,0x02,0x02,0x01,0x8B,0x00,0x01,0x01,0x02,0x02,0x23,0x03,0x01,0x02,
-0x68,0x00,0x01,0x01,0x1B,0x03,0x02,0x02,0x02,0x01,0x96,0x00,0x02,0x01,0x02,0x02,
-0x1C,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x03,0x01,
-0xA1,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,
-0x02,0x02,0x08,0x03,0x03,0x02,0x02,0x01,0xAC,0x00,0x03,0x01,0x01,0x02,0x0A,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x37,0x00,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x26,0x00,
+// Frame 16: Diff RLE (678 bytes)
+static const uint8_t SAD_FRAME16_DATA[678] = {
+0x4C,0x00,0x02,0x01,0x04,0x02,0x02,0x01,0x3C,0x00,0x02,0x01,0x06,0x02,0x02,0x01,
+0x91,0x00,0x02,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0x86,0x00,0x02,0x01,0x02,0x02,0x16,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x7B,0x00,0x01,0x01,
+0x02,0x02,0x1E,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,
+0x70,0x00,0x02,0x01,0x02,0x02,0x24,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x25,0x03,
+0x02,0x02,0x02,0x01,0x64,0x00,0x02,0x01,0x02,0x02,0x2C,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x2C,0x03,0x02,0x02,0x02,0x01,0x58,0x00,0x02,0x01,0x02,0x02,0x33,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x33,0x03,0x02,0x02,0x02,0x01,0x4C,0x00,0x02,0x01,
+0x02,0x02,0x3A,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x39,0x03,0x02,0x02,0x02,0x01,
+0x42,0x00,0x01,0x01,0x02,0x02,0x40,0x03,0x01,0x02,0x21,0x00,0x40,0x03,0x02,0x02,
+0x02,0x01,0x36,0x00,0x02,0x01,0x01,0x02,0x47,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x46,0x03,0x02,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x02,0x02,0x4C,0x03,0x01,0x02,
+0x1F,0x00,0x4C,0x03,0x02,0x02,0x01,0x01,0x21,0x00,0x02,0x01,0x01,0x02,0x53,0x03,
+0x1E,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x02,0x01,0x18,0x00,0x01,0x01,0x01,0x02,
+0x57,0x03,0x1E,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,
+0x5A,0x03,0x1E,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,
+0x5C,0x03,0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x5E,0x03,0x1E,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x05,0x00,0x5F,0x03,0x01,0x02,
+0x21,0x00,0x5F,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,
+0x21,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x23,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x25,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x29,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x01,0x01,0x02,0x55,0x03,0x02,0x02,0x01,0x01,0x33,0x00,0x02,0x01,
+0x01,0x02,0x55,0x03,0x01,0x01,0x01,0x02,0x50,0x03,0x02,0x02,0x02,0x01,0x3C,0x00,
+0x02,0x01,0x02,0x02,0x4F,0x03,0x02,0x01,0x4A,0x03,0x02,0x02,0x02,0x01,0x47,0x00,
+0x02,0x01,0x02,0x02,0x4A,0x03,0x02,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x02,0x01,
+0x53,0x00,0x02,0x01,0x02,0x02,0x43,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x3E,0x03,
+0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x3E,0x03,0x04,0x00,0x01,0x01,
+0x37,0x03,0x02,0x02,0x02,0x01,0x69,0x00,0x02,0x01,0x01,0x02,0x38,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x02,0x01,0x75,0x00,0x01,0x01,0x02,0x02,
+0x31,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x2A,0x03,0x02,0x02,0x01,0x01,0x80,0x00,
+0x02,0x01,0x02,0x02,0x2A,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x23,0x03,0x02,0x02,
+0x02,0x01,0x8B,0x00,0x01,0x01,0x02,0x02,0x23,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,
+0x1B,0x03,0x02,0x02,0x02,0x01,0x96,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x01,0x01,
+0x10,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x03,0x01,0xA1,0x00,0x02,0x01,
+0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x02,0x02,0x08,0x03,
+0x03,0x02,0x02,0x01,0xAC,0x00,0x03,0x01,0x01,0x02,0x0A,0x03,0x02,0x02,0x01,0x01,
+0xDB,0x00,0x05,0x01,0x11,0x00,
 };
 static const DiffBlock SAD_FRAME16_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 98,  // Changed box top-left
+    229, 38,  // Changed box dimensions
     SAD_FRAME16_DATA
 };
 
-// Frame 17: Full frame RLE (1154 bytes)
-static const uint8_t SAD_FRAME17_DATA[1154] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x35,0x00,0x03,0x01,0x42,0x00,0x04,0x01,0xF0,0x00,0x02,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x02,0x02,0x0B,0x03,
-0x01,0x02,0x02,0x01,0xE4,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x01,0x01,0x31,0x00,
-0x01,0x02,0x14,0x03,0x01,0x02,0x02,0x01,0xD9,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0xCF,0x00,0x02,0x01,
-0x01,0x02,0x23,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x23,0x03,0x01,0x02,0x02,0x01,
-0xC3,0x00,0x02,0x01,0x02,0x02,0x29,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x29,0x03,
-0x02,0x02,0x02,0x01,0xB7,0x00,0x02,0x01,0x02,0x02,0x30,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x2F,0x03,0x02,0x02,0x03,0x01,0xAC,0x00,0x02,0x01,0x02,0x02,0x36,0x03,
-0x01,0x02,0x23,0x00,0x01,0x02,0x36,0x03,0x02,0x02,0x02,0x01,0xA1,0x00,0x02,0x01,
-0x02,0x02,0x3D,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x3D,0x03,0x02,0x02,0x01,0x01,
-0x97,0x00,0x01,0x01,0x02,0x02,0x43,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x43,0x03,
-0x02,0x02,0x02,0x01,0x8B,0x00,0x02,0x01,0x02,0x02,0x49,0x03,0x01,0x01,0x1F,0x00,
-0x01,0x02,0x49,0x03,0x02,0x02,0x01,0x01,0x81,0x00,0x02,0x01,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x1F,0x00,0x50,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x01,0x01,0x02,
-0x55,0x03,0x1E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,
-0x59,0x03,0x1E,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,
-0x5B,0x03,0x1E,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x5D,0x03,0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x02,0x1F,0x00,0x5E,0x03,0x01,0x01,0x62,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x5F,0x03,0x20,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,
-0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x27,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x29,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x53,0x03,0x02,0x02,0x02,0x01,
-0x35,0x00,0x02,0x01,0x02,0x02,0x53,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x4E,0x03,
-0x02,0x02,0x02,0x01,0x3F,0x00,0x02,0x01,0x02,0x02,0x4E,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x48,0x03,0x02,0x02,0x02,0x01,0x4B,0x00,0x02,0x01,0x01,0x02,0x48,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x01,0x42,0x03,0x02,0x02,0x01,0x01,0x57,0x00,0x01,0x01,
-0x02,0x02,0x42,0x03,0x01,0x01,0x5E,0x00,0x3D,0x03,0x01,0x02,0x02,0x01,0x61,0x00,
-0x02,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x36,0x03,0x02,0x02,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x02,0x02,0x35,0x03,0x01,0x02,0x61,0x00,0x01,0x01,
-0x30,0x03,0x01,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x02,0x02,0x2F,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x01,0x29,0x03,0x02,0x02,0x01,0x01,0x82,0x00,0x02,0x01,
-0x01,0x02,0x29,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,
-0x8D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,
-0x1A,0x03,0x02,0x02,0x02,0x01,0x97,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,
-0x6C,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0xA2,0x00,0x02,0x01,
-0x02,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x02,0x01,0x02,0x02,0x07,0x03,
-0x02,0x02,0x03,0x01,0xAD,0x00,0x02,0x01,0x02,0x02,0x08,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x63,0x00,
+// Frame 17: Diff RLE (670 bytes)
+static const uint8_t SAD_FRAME17_DATA[670] = {
+0x4E,0x00,0x03,0x01,0x42,0x00,0x04,0x01,0x94,0x00,0x02,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x02,0x02,0x0B,0x03,0x01,0x02,0x02,0x01,
+0x88,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x14,0x03,
+0x01,0x02,0x02,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x02,0x01,0x01,0x02,0x23,0x03,
+0x01,0x01,0x29,0x00,0x01,0x02,0x23,0x03,0x01,0x02,0x02,0x01,0x67,0x00,0x02,0x01,
+0x02,0x02,0x29,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x29,0x03,0x02,0x02,0x02,0x01,
+0x5B,0x00,0x02,0x01,0x02,0x02,0x30,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x2F,0x03,
+0x02,0x02,0x03,0x01,0x50,0x00,0x02,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x23,0x00,
+0x01,0x02,0x36,0x03,0x02,0x02,0x02,0x01,0x45,0x00,0x02,0x01,0x02,0x02,0x3D,0x03,
+0x01,0x01,0x21,0x00,0x01,0x02,0x3D,0x03,0x02,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,
+0x02,0x02,0x43,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x43,0x03,0x02,0x02,0x02,0x01,
+0x2F,0x00,0x02,0x01,0x02,0x02,0x49,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x49,0x03,
+0x02,0x02,0x01,0x01,0x25,0x00,0x02,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x1F,0x00,
+0x50,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x1E,0x00,
+0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x59,0x03,0x1E,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x5B,0x03,0x1E,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x5D,0x03,0x1E,0x00,
+0x01,0x01,0x5C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x1F,0x00,
+0x5E,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x5F,0x03,0x20,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5F,0x03,
+0x02,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5E,0x03,0x02,0x01,
+0x5E,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5D,0x03,0x02,0x02,0x5D,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x5C,0x03,0x01,0x01,0x29,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x02,0x5A,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x57,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x53,0x03,
+0x02,0x02,0x02,0x01,0x35,0x00,0x02,0x01,0x02,0x02,0x53,0x03,0x01,0x01,0x4E,0x03,
+0x02,0x02,0x02,0x01,0x3F,0x00,0x02,0x01,0x02,0x02,0x4E,0x03,0x01,0x01,0x48,0x03,
+0x02,0x02,0x02,0x01,0x4B,0x00,0x02,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x42,0x03,0x02,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x42,0x03,
+0x01,0x01,0x02,0x00,0x3D,0x03,0x01,0x02,0x02,0x01,0x61,0x00,0x02,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x36,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,
+0x01,0x01,0x02,0x02,0x35,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x30,0x03,0x01,0x02,
+0x02,0x01,0x77,0x00,0x01,0x01,0x02,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x06,0x00,
+0x01,0x01,0x29,0x03,0x02,0x02,0x01,0x01,0x82,0x00,0x02,0x01,0x01,0x02,0x29,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0x8D,0x00,0x01,0x01,
+0x02,0x02,0x22,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,
+0x02,0x01,0x97,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x10,0x00,0x01,0x01,
+0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0xA2,0x00,0x02,0x01,0x02,0x02,0x12,0x03,
+0x01,0x02,0x01,0x01,0x15,0x00,0x02,0x01,0x02,0x02,0x07,0x03,0x02,0x02,0x03,0x01,
+0xAD,0x00,0x02,0x01,0x02,0x02,0x08,0x03,0x02,0x02,0x01,0x01,0xF0,0x00,
 };
 static const DiffBlock SAD_FRAME17_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 97,  // Changed box top-left
+    228, 39,  // Changed box dimensions
     SAD_FRAME17_DATA
 };
 
-// Frame 18: Full frame RLE (1160 bytes)
-static const uint8_t SAD_FRAME18_DATA[1160] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x33,0x00,0x03,0x01,0x01,0x02,0x03,0x01,0x3E,0x00,0x04,0x01,
-0x01,0x02,0x03,0x01,0xED,0x00,0x02,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x35,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x02,0x01,0xE2,0x00,0x01,0x01,
-0x02,0x02,0x15,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,
-0x02,0x01,0xD7,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,
-0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0xCD,0x00,0x01,0x01,0x02,0x02,0x24,0x03,
-0x01,0x01,0x29,0x00,0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,0xC1,0x00,0x02,0x01,
-0x02,0x02,0x2A,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x2B,0x03,0x02,0x02,0x02,0x01,
-0xB5,0x00,0x02,0x01,0x02,0x02,0x31,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x31,0x03,
-0x02,0x02,0x02,0x01,0xAB,0x00,0x02,0x01,0x02,0x02,0x37,0x03,0x01,0x02,0x23,0x00,
-0x38,0x03,0x02,0x02,0x02,0x01,0x9F,0x00,0x02,0x01,0x02,0x02,0x3E,0x03,0x01,0x02,
-0x21,0x00,0x01,0x02,0x3E,0x03,0x02,0x02,0x01,0x01,0x95,0x00,0x02,0x01,0x01,0x02,
-0x45,0x03,0x20,0x00,0x01,0x01,0x44,0x03,0x02,0x02,0x02,0x01,0x8A,0x00,0x01,0x01,
-0x02,0x02,0x4A,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x4A,0x03,0x02,0x02,0x01,0x01,
-0x7F,0x00,0x02,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x50,0x03,
-0x02,0x02,0x01,0x01,0x76,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x1E,0x00,0x01,0x01,
-0x56,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x59,0x03,0x1E,0x00,0x01,0x01,0x59,0x03,
-0x01,0x01,0x6B,0x00,0x01,0x02,0x5B,0x03,0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x67,0x00,0x01,0x01,0x5D,0x03,0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x65,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x1F,0x00,0x5E,0x03,0x01,0x01,0x62,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x21,0x00,0x5F,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x21,0x00,0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x25,0x00,0x01,0x02,0x5E,0x03,0x5C,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x27,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,
-0x29,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x2D,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,
-0x53,0x03,0x02,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x02,0x02,0x53,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x4D,0x03,0x02,0x02,0x02,0x01,0x40,0x00,0x02,0x01,0x02,0x02,
-0x4E,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x02,0x02,0x02,0x01,
-0x4B,0x00,0x02,0x01,0x02,0x02,0x47,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x42,0x03,
-0x01,0x02,0x02,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x42,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x02,0x3B,0x03,0x02,0x02,0x01,0x01,0x62,0x00,0x02,0x01,0x01,0x02,0x3C,0x03,
-0x01,0x02,0x60,0x00,0x36,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x02,0x02,
-0x35,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x02,0x01,0x77,0x00,
-0x02,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
-0x02,0x02,0x01,0x01,0x82,0x00,0x02,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x66,0x00,
-0x01,0x02,0x21,0x03,0x02,0x02,0x02,0x01,0x8D,0x00,0x01,0x01,0x02,0x02,0x22,0x03,
-0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x97,0x00,
-0x02,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x6D,0x00,0x02,0x02,0x11,0x03,0x02,0x02,
-0x02,0x01,0xA2,0x00,0x03,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x71,0x00,
-0x02,0x01,0x02,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0xAD,0x00,0x02,0x01,0x02,0x02,
-0x08,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x63,0x00,
+// Frame 18: Diff RLE (650 bytes)
+static const uint8_t SAD_FRAME18_DATA[650] = {
+0x4B,0x00,0x03,0x01,0x01,0x02,0x03,0x01,0x3E,0x00,0x04,0x01,0x01,0x02,0x03,0x01,
+0x90,0x00,0x02,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x02,0x01,0x85,0x00,0x01,0x01,0x02,0x02,0x15,0x03,
+0x01,0x02,0x30,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x02,0x01,0x7A,0x00,
+0x02,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,
+0x02,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x01,0x01,0x29,0x00,
+0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,0x64,0x00,0x02,0x01,0x02,0x02,0x2A,0x03,
+0x01,0x02,0x26,0x00,0x01,0x01,0x2B,0x03,0x02,0x02,0x02,0x01,0x58,0x00,0x02,0x01,
+0x02,0x02,0x31,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x31,0x03,0x02,0x02,0x02,0x01,
+0x4E,0x00,0x02,0x01,0x02,0x02,0x37,0x03,0x01,0x02,0x23,0x00,0x38,0x03,0x02,0x02,
+0x02,0x01,0x42,0x00,0x02,0x01,0x02,0x02,0x3E,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
+0x3E,0x03,0x02,0x02,0x01,0x01,0x38,0x00,0x02,0x01,0x01,0x02,0x45,0x03,0x20,0x00,
+0x01,0x01,0x44,0x03,0x02,0x02,0x02,0x01,0x2D,0x00,0x01,0x01,0x02,0x02,0x4A,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x4A,0x03,0x02,0x02,0x01,0x01,0x22,0x00,0x02,0x01,
+0x01,0x02,0x50,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x50,0x03,0x02,0x02,0x01,0x01,
+0x19,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x1E,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x13,0x00,0x01,0x02,0x59,0x03,0x1E,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x0E,0x00,
+0x01,0x02,0x5B,0x03,0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x5D,0x03,0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x02,0x1F,0x00,0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
+0x21,0x00,0x5F,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x01,0x5E,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0xBB,0x03,0x01,0x01,
+0x27,0x00,0x01,0x02,0xB8,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0xB6,0x03,
+0x01,0x01,0x2D,0x00,0x01,0x02,0xB1,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,
+0x01,0x02,0xAA,0x03,0x02,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x02,0x02,0xA0,0x03,
+0x02,0x02,0x02,0x01,0x40,0x00,0x02,0x01,0x02,0x02,0x4E,0x03,0x01,0x02,0x47,0x03,
+0x02,0x02,0x02,0x01,0x4B,0x00,0x02,0x01,0x02,0x02,0x47,0x03,0x01,0x02,0x01,0x01,
+0x42,0x03,0x01,0x02,0x02,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x42,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x3B,0x03,0x02,0x02,0x01,0x01,0x62,0x00,0x02,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x03,0x00,0x36,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,
+0x02,0x02,0x35,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x02,0x01,
+0x77,0x00,0x02,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x01,0x02,
+0x28,0x03,0x02,0x02,0x01,0x01,0x82,0x00,0x02,0x01,0x02,0x02,0x28,0x03,0x01,0x02,
+0x09,0x00,0x01,0x02,0x21,0x03,0x02,0x02,0x02,0x01,0x8D,0x00,0x01,0x01,0x02,0x02,
+0x22,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,
+0x97,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x10,0x00,0x02,0x02,0x11,0x03,
+0x02,0x02,0x02,0x01,0xA2,0x00,0x03,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
+0x14,0x00,0x02,0x01,0x02,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0xAD,0x00,0x02,0x01,
+0x02,0x02,0x08,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,
 };
 static const DiffBlock SAD_FRAME18_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    46, 97,  // Changed box top-left
+    227, 38,  // Changed box dimensions
     SAD_FRAME18_DATA
 };
 
-// Frame 19: Full frame RLE (1154 bytes)
-static const uint8_t SAD_FRAME19_DATA[1154] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB1,0x00,0x01,0x01,0x02,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x02,0x01,
-0xE5,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,
-0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0xDA,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0xCF,0x00,0x02,0x01,
-0x02,0x02,0x22,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x22,0x03,0x02,0x02,0x02,0x01,
-0xC3,0x00,0x02,0x01,0x02,0x02,0x29,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x28,0x03,
-0x03,0x02,0x02,0x01,0xB7,0x00,0x03,0x01,0x02,0x02,0x2F,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x2F,0x03,0x02,0x02,0x02,0x01,0xAD,0x00,0x02,0x01,0x02,0x02,0x36,0x03,
-0x01,0x01,0x23,0x00,0x01,0x02,0x36,0x03,0x02,0x02,0x02,0x01,0xA2,0x00,0x01,0x01,
-0x02,0x02,0x3D,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x3D,0x03,0x02,0x02,0x01,0x01,
-0x97,0x00,0x02,0x01,0x01,0x02,0x43,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x44,0x03,
-0x01,0x02,0x02,0x01,0x8C,0x00,0x01,0x01,0x02,0x02,0x49,0x03,0x01,0x01,0x1F,0x00,
-0x01,0x02,0x49,0x03,0x02,0x02,0x01,0x01,0x81,0x00,0x02,0x01,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x1F,0x00,0x50,0x03,0x01,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x01,0x02,
-0x55,0x03,0x1E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x1E,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
-0x01,0x01,0x5B,0x03,0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x5C,0x03,0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x65,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x62,0x00,0x01,0x02,
-0x5E,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5F,0x03,0x20,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x21,0x00,0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
-0x23,0x00,0x5F,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x5F,0x03,0x5C,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x29,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,
-0x01,0x02,0x5A,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x30,0x00,
-0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x02,0x01,0x35,0x00,0x01,0x01,0x02,0x02,0x54,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,
-0x4E,0x03,0x02,0x02,0x02,0x01,0x3E,0x00,0x02,0x01,0x02,0x02,0x4F,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x49,0x03,0x02,0x02,0x01,0x01,0x4A,0x00,0x02,0x01,0x01,0x02,
-0x49,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x02,0x01,0x55,0x00,
-0x01,0x01,0x02,0x02,0x43,0x03,0x01,0x01,0x5E,0x00,0x3D,0x03,0x02,0x02,0x01,0x01,
-0x60,0x00,0x02,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x37,0x03,
-0x01,0x02,0x02,0x01,0x6B,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x61,0x00,
-0x01,0x01,0x30,0x03,0x02,0x02,0x01,0x01,0x76,0x00,0x02,0x01,0x02,0x02,0x2F,0x03,
-0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,0x02,0x01,0x81,0x00,
-0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x22,0x03,0x02,0x02,
-0x02,0x01,0x8B,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x01,0x01,0x68,0x00,0x01,0x01,
-0x01,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x97,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x02,0x01,0xA1,0x00,
-0x03,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x02,0x01,0x01,0x02,
-0x09,0x03,0x02,0x02,0x02,0x01,0xAD,0x00,0x02,0x01,0x02,0x02,0x08,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x22,0x00,
+// Frame 19: Diff RLE (690 bytes)
+static const uint8_t SAD_FRAME19_DATA[690] = {
+0xFF,0x00,0xFF,0x00,0x14,0x00,0x01,0x01,0x02,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x37,0x00,0x01,0x01,0x02,0x02,0x09,0x03,0x01,0x02,0x02,0x01,0x8A,0x00,0x02,0x01,
+0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x12,0x03,
+0x02,0x02,0x01,0x01,0x7F,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x02,0x1B,0x03,0x01,0x02,0x02,0x01,0x74,0x00,0x02,0x01,0x02,0x02,0x22,0x03,
+0x01,0x01,0x29,0x00,0x01,0x01,0x22,0x03,0x02,0x02,0x02,0x01,0x68,0x00,0x02,0x01,
+0x02,0x02,0x29,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x28,0x03,0x03,0x02,0x02,0x01,
+0x5C,0x00,0x03,0x01,0x02,0x02,0x2F,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x2F,0x03,
+0x02,0x02,0x02,0x01,0x52,0x00,0x02,0x01,0x02,0x02,0x36,0x03,0x01,0x01,0x23,0x00,
+0x01,0x02,0x36,0x03,0x02,0x02,0x02,0x01,0x47,0x00,0x01,0x01,0x02,0x02,0x3D,0x03,
+0x01,0x01,0x21,0x00,0x01,0x02,0x3D,0x03,0x02,0x02,0x01,0x01,0x3C,0x00,0x02,0x01,
+0x01,0x02,0x43,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x02,0x01,
+0x31,0x00,0x01,0x01,0x02,0x02,0x49,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x49,0x03,
+0x02,0x02,0x01,0x01,0x26,0x00,0x02,0x01,0x01,0x02,0x4F,0x03,0x01,0x02,0x1F,0x00,
+0x50,0x03,0x01,0x02,0x02,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x1E,0x00,
+0x01,0x01,0x55,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x1E,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x5B,0x03,
+0x1E,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,
+0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
+0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x1F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,0x20,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,
+0x01,0x02,0x5F,0x03,0x03,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x23,0x00,0x5F,0x03,
+0x01,0x01,0x01,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x01,0x02,0x5C,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x01,0x02,
+0x58,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x01,0x02,
+0x54,0x03,0x01,0x02,0x02,0x01,0x35,0x00,0x01,0x01,0x02,0x02,0x54,0x03,0x01,0x01,
+0x01,0x02,0x4E,0x03,0x02,0x02,0x02,0x01,0x3E,0x00,0x02,0x01,0x02,0x02,0x4F,0x03,
+0x02,0x01,0x49,0x03,0x02,0x02,0x01,0x01,0x4A,0x00,0x02,0x01,0x01,0x02,0x49,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x02,0x01,0x55,0x00,0x01,0x01,
+0x02,0x02,0x43,0x03,0x01,0x01,0x03,0x00,0x3D,0x03,0x02,0x02,0x01,0x01,0x60,0x00,
+0x02,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x37,0x03,0x01,0x02,
+0x02,0x01,0x6B,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x06,0x00,0x01,0x01,
+0x30,0x03,0x02,0x02,0x01,0x01,0x76,0x00,0x02,0x01,0x02,0x02,0x2F,0x03,0x01,0x02,
+0x01,0x01,0x07,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,0x02,0x01,0x81,0x00,0x01,0x01,
+0x02,0x02,0x29,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x22,0x03,0x02,0x02,0x02,0x01,
+0x8B,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x1A,0x03,0x02,0x02,0x02,0x01,0x97,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,
+0x11,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x02,0x01,0xA1,0x00,0x03,0x01,
+0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x02,0x01,0x01,0x02,0x09,0x03,
+0x02,0x02,0x02,0x01,0xAD,0x00,0x02,0x01,0x02,0x02,0x08,0x03,0x02,0x02,0x01,0x01,
+0x0D,0x00,
 };
 static const DiffBlock SAD_FRAME19_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 97,  // Changed box top-left
+    229, 39,  // Changed box dimensions
     SAD_FRAME19_DATA
 };
 
-// Frame 20: Full frame RLE (1134 bytes)
-static const uint8_t SAD_FRAME20_DATA[1134] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x79,0x00,0x08,0x01,0x3E,0x00,0x05,0x01,0xEF,0x00,0x02,0x01,0x02,0x02,0x0C,0x03,
-0x01,0x02,0x02,0x01,0x34,0x00,0x01,0x01,0x02,0x02,0x09,0x03,0x03,0x02,0x02,0x01,
-0xE2,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x01,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0xD6,0x00,0x02,0x01,0x02,0x02,0x1E,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0xCB,0x00,
-0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x24,0x03,0x02,0x02,
-0x02,0x01,0xBF,0x00,0x02,0x01,0x02,0x02,0x2C,0x03,0x26,0x00,0x01,0x01,0x2C,0x03,
-0x02,0x02,0x01,0x01,0xB5,0x00,0x01,0x01,0x02,0x02,0x33,0x03,0x01,0x01,0x23,0x00,
-0x01,0x01,0x33,0x03,0x02,0x02,0x01,0x01,0xA9,0x00,0x02,0x01,0x01,0x02,0x39,0x03,
-0x01,0x02,0x22,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x02,0x01,0x9D,0x00,0x02,0x01,
-0x02,0x02,0x3F,0x03,0x01,0x02,0x21,0x00,0x41,0x03,0x01,0x02,0x02,0x01,0x92,0x00,
-0x01,0x01,0x02,0x02,0x46,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x46,0x03,0x02,0x02,
-0x02,0x01,0x86,0x00,0x02,0x01,0x02,0x02,0x4B,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x4C,0x03,0x02,0x02,0x02,0x01,0x7A,0x00,0x02,0x01,0x02,0x02,0x52,0x03,0x1E,0x00,
-0x01,0x01,0x53,0x03,0x02,0x02,0x02,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x1E,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x02,0x5A,0x03,
-0x1E,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x5C,0x03,
-0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,
-0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x61,0x00,0x5F,0x03,0x01,0x01,0x1F,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x20,0x00,
-0x01,0x01,0x60,0x03,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x5F,0x03,0x5C,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x5B,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x5B,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,
-0x01,0x02,0x57,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x02,0x01,
-0x3A,0x00,0x01,0x01,0x02,0x02,0x52,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x4B,0x03,
-0x02,0x02,0x01,0x01,0x45,0x00,0x02,0x01,0x02,0x02,0x4C,0x03,0x5D,0x00,0x01,0x02,
-0x44,0x03,0x02,0x02,0x02,0x01,0x50,0x00,0x02,0x01,0x02,0x02,0x45,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x3F,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x02,0x01,0x02,0x02,
-0x3F,0x03,0x5F,0x00,0x01,0x01,0x38,0x03,0x02,0x02,0x02,0x01,0x67,0x00,0x02,0x01,
-0x02,0x02,0x38,0x03,0x01,0x01,0x60,0x00,0x01,0x02,0x31,0x03,0x02,0x02,0x02,0x01,
-0x73,0x00,0x02,0x01,0x02,0x02,0x31,0x03,0x01,0x01,0x62,0x00,0x01,0x02,0x2A,0x03,
-0x02,0x02,0x02,0x01,0x7F,0x00,0x02,0x01,0x02,0x02,0x2A,0x03,0x01,0x01,0x64,0x00,
-0x01,0x01,0x24,0x03,0x01,0x02,0x02,0x01,0x8B,0x00,0x02,0x01,0x02,0x02,0x22,0x03,
-0x01,0x02,0x68,0x00,0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x97,0x00,0x02,0x01,
-0x02,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x14,0x03,0x02,0x02,
-0x02,0x01,0xA2,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x71,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x02,0x01,0xAE,0x00,0x02,0x01,0x01,0x02,0x09,0x03,
-0x01,0x02,0x01,0x01,0x79,0x00,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xDF,0x00,
+// Frame 20: Diff RLE (668 bytes)
+static const uint8_t SAD_FRAME20_DATA[668] = {
+0xFF,0x00,0xFF,0x00,0xFD,0x00,0x08,0x01,0x3E,0x00,0x05,0x01,0x94,0x00,0x02,0x01,
+0x02,0x02,0x0C,0x03,0x01,0x02,0x02,0x01,0x34,0x00,0x01,0x01,0x02,0x02,0x09,0x03,
+0x03,0x02,0x02,0x01,0x87,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0x7B,0x00,0x02,0x01,
+0x02,0x02,0x1E,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x02,0x02,
+0x02,0x01,0x70,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x29,0x00,0x01,0x02,
+0x24,0x03,0x02,0x02,0x02,0x01,0x64,0x00,0x02,0x01,0x02,0x02,0x2C,0x03,0x26,0x00,
+0x01,0x01,0x2C,0x03,0x02,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x02,0x02,0x33,0x03,
+0x01,0x01,0x23,0x00,0x01,0x01,0x33,0x03,0x02,0x02,0x01,0x01,0x4E,0x00,0x02,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x02,0x01,
+0x42,0x00,0x02,0x01,0x02,0x02,0x3F,0x03,0x01,0x02,0x21,0x00,0x41,0x03,0x01,0x02,
+0x02,0x01,0x37,0x00,0x01,0x01,0x02,0x02,0x46,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x46,0x03,0x02,0x02,0x02,0x01,0x2B,0x00,0x02,0x01,0x02,0x02,0x4B,0x03,0x01,0x02,
+0x1F,0x00,0x01,0x02,0x4C,0x03,0x02,0x02,0x02,0x01,0x1F,0x00,0x02,0x01,0x02,0x02,
+0x52,0x03,0x1E,0x00,0x01,0x01,0x53,0x03,0x02,0x02,0x02,0x01,0x16,0x00,0x01,0x01,
+0x01,0x02,0x57,0x03,0x1E,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x11,0x00,
+0x01,0x02,0x5A,0x03,0x1E,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x5C,0x03,0x1E,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x5D,0x03,0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x06,0x00,0x5F,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x03,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x21,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5F,0x03,0x01,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x02,0x28,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x5C,0x03,
+0x02,0x02,0x59,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x5A,0x03,0x02,0x02,0x56,0x03,
+0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x01,0x01,0x02,
+0x51,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,0x01,0x01,0x02,0x02,0x52,0x03,0x02,0x01,
+0x4B,0x03,0x02,0x02,0x01,0x01,0x45,0x00,0x02,0x01,0x02,0x02,0x4C,0x03,0x02,0x00,
+0x01,0x02,0x44,0x03,0x02,0x02,0x02,0x01,0x50,0x00,0x02,0x01,0x02,0x02,0x45,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x3F,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,0x02,0x01,
+0x02,0x02,0x3F,0x03,0x04,0x00,0x01,0x01,0x38,0x03,0x02,0x02,0x02,0x01,0x67,0x00,
+0x02,0x01,0x02,0x02,0x38,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x31,0x03,0x02,0x02,
+0x02,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x31,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
+0x2A,0x03,0x02,0x02,0x02,0x01,0x7F,0x00,0x02,0x01,0x02,0x02,0x2A,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x24,0x03,0x01,0x02,0x02,0x01,0x8B,0x00,0x02,0x01,0x02,0x02,
+0x22,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x97,0x00,
+0x02,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x14,0x03,
+0x02,0x02,0x02,0x01,0xA2,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x16,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x02,0x01,0xAE,0x00,0x02,0x01,0x01,0x02,
+0x09,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x05,0x01,0xCF,0x00,
 };
 static const DiffBlock SAD_FRAME20_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 99,  // Changed box top-left
+    229, 41,  // Changed box dimensions
     SAD_FRAME20_DATA
 };
 
-// Frame 21: Full frame RLE (1120 bytes)
-static const uint8_t SAD_FRAME21_DATA[1120] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x7C,0x00,0x01,0x01,0x03,0x02,
-0x05,0x03,0x02,0x02,0x02,0x01,0x39,0x00,0x02,0x01,0x05,0x02,0x02,0x01,0xEB,0x00,
-0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x02,0x02,0x02,0x01,0xDF,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x01,0x01,
-0x2D,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x02,0x02,0x01,0x01,0xD3,0x00,0x02,0x01,
-0x01,0x02,0x22,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,
-0xC6,0x00,0x02,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x27,0x03,
-0x02,0x02,0x02,0x01,0xBA,0x00,0x02,0x01,0x02,0x02,0x2F,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x2E,0x03,0x02,0x02,0x02,0x01,0xAE,0x00,0x02,0x01,0x02,0x02,0x36,0x03,
-0x01,0x02,0x23,0x00,0x01,0x02,0x36,0x03,0x02,0x02,0x02,0x01,0xA1,0x00,0x02,0x01,
-0x03,0x02,0x3C,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x3D,0x03,0x02,0x02,0x03,0x01,
-0x94,0x00,0x02,0x01,0x03,0x02,0x43,0x03,0x20,0x00,0x01,0x01,0x44,0x03,0x03,0x02,
-0x02,0x01,0x88,0x00,0x02,0x01,0x02,0x02,0x4A,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x4B,0x03,0x02,0x02,0x02,0x01,0x7D,0x00,0x01,0x01,0x02,0x02,0x51,0x03,0x1E,0x00,
-0x01,0x01,0x53,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x56,0x03,
-0x1E,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x5D,0x03,
-0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x63,0x00,0x5F,0x03,0x1E,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x01,0x61,0x00,0x5F,0x03,0x01,0x02,0x1F,0x00,0x60,0x03,0x01,0x01,
-0x5F,0x00,0x01,0x02,0x5F,0x03,0x20,0x00,0x01,0x02,0x60,0x03,0x5E,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x01,0x21,0x00,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x22,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x02,0x24,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x01,0x26,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x02,0x2A,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x52,0x03,0x01,0x02,0x02,0x01,0x37,0x00,0x01,0x01,0x02,0x02,0x54,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x4B,0x03,0x03,0x02,0x01,0x01,0x42,0x00,0x02,0x01,
-0x02,0x02,0x4E,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,0x44,0x03,0x03,0x02,0x02,0x01,
-0x4D,0x00,0x03,0x01,0x02,0x02,0x46,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x3E,0x03,
-0x03,0x02,0x02,0x01,0x5A,0x00,0x02,0x01,0x02,0x02,0x40,0x03,0x5F,0x00,0x01,0x02,
-0x38,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x03,0x01,0x02,0x02,0x38,0x03,0x01,0x01,
-0x60,0x00,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0x74,0x00,0x02,0x01,0x02,0x02,
-0x31,0x03,0x01,0x01,0x62,0x00,0x01,0x02,0x2A,0x03,0x02,0x02,0x02,0x01,0x7F,0x00,
-0x02,0x01,0x02,0x02,0x2A,0x03,0x65,0x00,0x01,0x01,0x23,0x03,0x02,0x02,0x02,0x01,
-0x8C,0x00,0x02,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x1C,0x03,
-0x01,0x02,0x02,0x01,0x98,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x01,0x02,0x6C,0x00,
-0x01,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0xA4,0x00,0x02,0x01,0x02,0x02,0x10,0x03,
-0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x02,0x02,0x01,0x01,
-0xB0,0x00,0x02,0x01,0x03,0x02,0x04,0x03,0x02,0x02,0x02,0x01,0x79,0x00,0x04,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x1D,0x00,
-
+// Frame 21: Diff RLE (646 bytes)
+static const uint8_t SAD_FRAME21_DATA[646] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE1,0x00,0x01,0x01,0x03,0x02,0x05,0x03,0x02,0x02,
+0x02,0x01,0x39,0x00,0x02,0x01,0x05,0x02,0x02,0x01,0x90,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x02,0x02,
+0x02,0x01,0x84,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x01,0x02,0x17,0x03,0x02,0x02,0x01,0x01,0x78,0x00,0x02,0x01,0x01,0x02,0x22,0x03,
+0x01,0x01,0x2A,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,0x6B,0x00,0x02,0x01,
+0x02,0x02,0x28,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x27,0x03,0x02,0x02,0x02,0x01,
+0x5F,0x00,0x02,0x01,0x02,0x02,0x2F,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x2E,0x03,
+0x02,0x02,0x02,0x01,0x53,0x00,0x02,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x23,0x00,
+0x01,0x02,0x36,0x03,0x02,0x02,0x02,0x01,0x46,0x00,0x02,0x01,0x03,0x02,0x3C,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x3D,0x03,0x02,0x02,0x03,0x01,0x39,0x00,0x02,0x01,
+0x03,0x02,0x43,0x03,0x20,0x00,0x01,0x01,0x44,0x03,0x03,0x02,0x02,0x01,0x2D,0x00,
+0x02,0x01,0x02,0x02,0x4A,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x4B,0x03,0x02,0x02,
+0x02,0x01,0x22,0x00,0x01,0x01,0x02,0x02,0x51,0x03,0x1E,0x00,0x01,0x01,0x53,0x03,
+0x02,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x1E,0x00,0x01,0x01,
+0x58,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x5D,0x03,0x1E,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x01,0x08,0x00,0x5F,0x03,0x1E,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x06,0x00,0x5F,0x03,0x01,0x02,0x1F,0x00,0x60,0x03,0x01,0x01,0x04,0x00,0x01,0x02,
+0x5F,0x03,0x20,0x00,0x01,0x02,0x60,0x03,0x03,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x21,0x00,0x60,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x22,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x5E,0x03,
+0x02,0x02,0x5B,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,0x5C,0x03,0x02,0x02,0x59,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x5B,0x03,0x02,0x02,0x57,0x03,0x01,0x02,
+0x31,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x02,0x02,0x52,0x03,0x01,0x02,0x02,0x01,
+0x37,0x00,0x01,0x01,0x02,0x02,0x54,0x03,0x02,0x01,0x4B,0x03,0x03,0x02,0x01,0x01,
+0x42,0x00,0x02,0x01,0x02,0x02,0x4E,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x44,0x03,
+0x03,0x02,0x02,0x01,0x4D,0x00,0x03,0x01,0x02,0x02,0x46,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x3E,0x03,0x03,0x02,0x02,0x01,0x5A,0x00,0x02,0x01,0x02,0x02,0x40,0x03,
+0x04,0x00,0x01,0x02,0x38,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x03,0x01,0x02,0x02,
+0x38,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0x74,0x00,
+0x02,0x01,0x02,0x02,0x31,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x2A,0x03,0x02,0x02,
+0x02,0x01,0x7F,0x00,0x02,0x01,0x02,0x02,0x2A,0x03,0x0A,0x00,0x01,0x01,0x23,0x03,
+0x02,0x02,0x02,0x01,0x8C,0x00,0x02,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x0D,0x00,
+0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0x98,0x00,0x02,0x01,0x02,0x02,0x19,0x03,
+0x01,0x02,0x11,0x00,0x01,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0xA4,0x00,0x02,0x01,
+0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x02,0x02,0x01,0x01,0xB0,0x00,0x02,0x01,0x03,0x02,0x04,0x03,0x02,0x02,0x02,0x01,
+0x1E,0x00,0x04,0x01,0xD0,0x00,
 };
 static const DiffBlock SAD_FRAME21_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 102,  // Changed box top-left
+    229, 41,  // Changed box dimensions
     SAD_FRAME21_DATA
 };
 
-// Frame 22: Full frame RLE (1114 bytes)
-static const uint8_t SAD_FRAME22_DATA[1114] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x85,0x00,0x06,0x01,0xFF,0x00,0x34,0x00,0x02,0x01,0x02,0x02,
+// Frame 22: Diff RLE (638 bytes)
+static const uint8_t SAD_FRAME22_DATA[638] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE5,0x00,0x06,0x01,0xD8,0x00,0x02,0x01,0x02,0x02,
 0x0B,0x03,0x02,0x02,0x01,0x01,0x34,0x00,0x02,0x01,0x02,0x02,0x05,0x03,0x02,0x02,
-0x03,0x01,0xE6,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,
-0x01,0x02,0x11,0x03,0x02,0x02,0x03,0x01,0xD8,0x00,0x03,0x01,0x02,0x02,0x1D,0x03,
-0x01,0x02,0x2B,0x00,0x01,0x01,0x1B,0x03,0x02,0x02,0x03,0x01,0xCB,0x00,0x02,0x01,
+0x03,0x01,0x8B,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,
+0x01,0x02,0x11,0x03,0x02,0x02,0x03,0x01,0x7D,0x00,0x03,0x01,0x02,0x02,0x1D,0x03,
+0x01,0x02,0x2B,0x00,0x01,0x01,0x1B,0x03,0x02,0x02,0x03,0x01,0x70,0x00,0x02,0x01,
 0x03,0x02,0x25,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x02,0x02,
-0x03,0x01,0xBE,0x00,0x02,0x01,0x02,0x02,0x2D,0x03,0x01,0x02,0x25,0x00,0x01,0x01,
-0x2C,0x03,0x02,0x02,0x03,0x01,0xB1,0x00,0x02,0x01,0x02,0x02,0x34,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x34,0x03,0x02,0x02,0x02,0x01,0xA5,0x00,0x02,0x01,0x01,0x02,
-0x3C,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x3C,0x03,0x02,0x02,0x02,0x01,0x98,0x00,
+0x03,0x01,0x63,0x00,0x02,0x01,0x02,0x02,0x2D,0x03,0x01,0x02,0x25,0x00,0x01,0x01,
+0x2C,0x03,0x02,0x02,0x03,0x01,0x56,0x00,0x02,0x01,0x02,0x02,0x34,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x34,0x03,0x02,0x02,0x02,0x01,0x4A,0x00,0x02,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x3C,0x03,0x02,0x02,0x02,0x01,0x3D,0x00,
 0x01,0x01,0x02,0x02,0x43,0x03,0x20,0x00,0x01,0x01,0x44,0x03,0x02,0x02,0x02,0x01,
-0x8B,0x00,0x01,0x01,0x02,0x02,0x49,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x4B,0x03,
-0x02,0x02,0x02,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,0x50,0x03,0x1E,0x00,0x01,0x01,
-0x53,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x1E,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x62,0x00,
-0x01,0x01,0x5F,0x03,0x1E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x60,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5F,0x00,0x60,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x22,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x02,0x24,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x02,0x26,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5B,0x00,0x5C,0x03,0x01,0x02,
-0x01,0x01,0x28,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x5B,0x00,0x5A,0x03,0x01,0x02,
-0x01,0x01,0x2C,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x50,0x03,0x02,0x02,0x02,0x01,0x38,0x00,0x02,0x01,0x02,0x02,0x53,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x4A,0x03,0x02,0x02,0x02,0x01,0x44,0x00,0x02,0x01,
-0x02,0x02,0x4D,0x03,0x5D,0x00,0x01,0x02,0x43,0x03,0x02,0x02,0x01,0x01,0x52,0x00,
-0x02,0x01,0x02,0x02,0x45,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x3D,0x03,0x02,0x02,
-0x01,0x01,0x5F,0x00,0x02,0x01,0x02,0x02,0x3D,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,
-0x36,0x03,0x01,0x02,0x02,0x01,0x6C,0x00,0x02,0x01,0x02,0x02,0x35,0x03,0x01,0x02,
-0x61,0x00,0x01,0x01,0x2E,0x03,0x02,0x02,0x02,0x01,0x79,0x00,0x02,0x01,0x02,0x02,
-0x2D,0x03,0x01,0x02,0x63,0x00,0x01,0x01,0x27,0x03,0x02,0x02,0x02,0x01,0x85,0x00,
-0x02,0x01,0x03,0x02,0x25,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,
-0x02,0x01,0x92,0x00,0x03,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x69,0x00,0x01,0x01,
-0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x9F,0x00,0x03,0x01,0x02,0x02,0x12,0x03,
-0x02,0x02,0x6E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x02,0x02,0x02,0x01,0xAD,0x00,
-0x03,0x01,0x02,0x02,0x07,0x03,0x02,0x02,0x02,0x01,0x74,0x00,0x03,0x01,0x02,0x02,
-0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x57,0x00,
+0x30,0x00,0x01,0x01,0x02,0x02,0x49,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x4B,0x03,
+0x02,0x02,0x02,0x01,0x22,0x00,0x02,0x01,0x02,0x02,0x50,0x03,0x1E,0x00,0x01,0x01,
+0x53,0x03,0x02,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x1E,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x5D,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x5F,0x03,0x1E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x05,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x04,0x00,0x60,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x22,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x24,0x00,0x01,0x02,0x5F,0x03,0x02,0x02,0x5D,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x5B,0x03,0x02,0x02,
+0x56,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x02,0x02,
+0x50,0x03,0x02,0x02,0x02,0x01,0x38,0x00,0x02,0x01,0x02,0x02,0x53,0x03,0x02,0x01,
+0x4A,0x03,0x02,0x02,0x02,0x01,0x44,0x00,0x02,0x01,0x02,0x02,0x4D,0x03,0x02,0x00,
+0x01,0x02,0x43,0x03,0x02,0x02,0x01,0x01,0x52,0x00,0x02,0x01,0x02,0x02,0x45,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x3D,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x02,0x01,
+0x02,0x02,0x3D,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x02,0x01,
+0x6C,0x00,0x02,0x01,0x02,0x02,0x35,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x2E,0x03,
+0x02,0x02,0x02,0x01,0x79,0x00,0x02,0x01,0x02,0x02,0x2D,0x03,0x01,0x02,0x08,0x00,
+0x01,0x01,0x27,0x03,0x02,0x02,0x02,0x01,0x85,0x00,0x02,0x01,0x03,0x02,0x25,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,0x92,0x00,0x03,0x01,
+0x02,0x02,0x1C,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,
+0x03,0x01,0x9F,0x00,0x03,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x13,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x02,0x02,0x02,0x01,0xAD,0x00,0x03,0x01,0x02,0x02,0x07,0x03,
+0x02,0x02,0x02,0x01,0x19,0x00,0x03,0x01,0x02,0x02,0x04,0x01,0xCE,0x00,
 };
 static const DiffBlock SAD_FRAME22_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 106,  // Changed box top-left
+    229, 40,  // Changed box dimensions
     SAD_FRAME22_DATA
 };
 
-// Frame 23: Full frame RLE (1072 bytes)
-static const uint8_t SAD_FRAME23_DATA[1072] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x8A,0x00,
-0x07,0x01,0xFF,0x00,0x34,0x00,0x02,0x01,0x02,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x34,0x00,0x01,0x01,0x03,0x02,0x04,0x03,0x03,0x02,0x02,0x01,0xE7,0x00,0x02,0x01,
-0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x02,0x12,0x03,0x02,0x02,
-0x03,0x01,0xD9,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,
-0x1C,0x03,0x02,0x02,0x02,0x01,0xCB,0x00,0x02,0x01,0x02,0x02,0x26,0x03,0x01,0x02,
-0x27,0x00,0x01,0x01,0x25,0x03,0x02,0x02,0x02,0x01,0xBD,0x00,0x02,0x01,0x02,0x02,
-0x2E,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x2D,0x03,0x02,0x02,0x02,0x01,0xB0,0x00,
-0x02,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x36,0x03,0x02,0x02,
-0x02,0x01,0xA1,0x00,0x02,0x01,0x02,0x02,0x3D,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
-0x3E,0x03,0x02,0x02,0x03,0x01,0x92,0x00,0x02,0x01,0x02,0x02,0x45,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x46,0x03,0x03,0x02,0x02,0x01,0x84,0x00,0x02,0x01,0x03,0x02,
-0x4B,0x03,0x01,0x02,0x1F,0x00,0x4F,0x03,0x02,0x02,0x03,0x01,0x76,0x00,0x01,0x01,
-0x03,0x02,0x53,0x03,0x1E,0x00,0x01,0x01,0x56,0x03,0x02,0x02,0x01,0x01,0x6E,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x69,0x00,
-0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x66,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x63,0x00,0x5F,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x61,0x00,
-0x60,0x03,0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5F,0x00,0x60,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
-0x21,0x00,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x22,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x24,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x5B,0x00,0x5D,0x03,0x01,0x02,0x28,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x5B,0x00,0x5B,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x5B,0x00,0x58,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x52,0x03,0x02,0x02,0x02,0x01,0x35,0x00,
-0x01,0x01,0x02,0x02,0x55,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x4B,0x03,0x02,0x02,
-0x02,0x01,0x42,0x00,0x02,0x01,0x02,0x02,0x4E,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,
-0x44,0x03,0x02,0x02,0x01,0x01,0x50,0x00,0x02,0x01,0x02,0x02,0x46,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x3D,0x03,0x02,0x02,0x02,0x01,0x5D,0x00,0x02,0x01,0x03,0x02,
-0x3D,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x35,0x03,0x02,0x02,0x02,0x01,0x6C,0x00,
-0x02,0x01,0x03,0x02,0x34,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x2D,0x03,0x02,0x02,
-0x03,0x01,0x79,0x00,0x03,0x01,0x03,0x02,0x2B,0x03,0x01,0x02,0x63,0x00,0x01,0x01,
-0x25,0x03,0x02,0x02,0x03,0x01,0x88,0x00,0x02,0x01,0x03,0x02,0x23,0x03,0x01,0x01,
-0x66,0x00,0x01,0x02,0x1C,0x03,0x02,0x02,0x03,0x01,0x97,0x00,0x02,0x01,0x02,0x02,
-0x1A,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x14,0x03,0x02,0x02,0x02,0x01,0xA5,0x00,
-0x02,0x01,0x03,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,
-0x09,0x03,0x02,0x02,0x02,0x01,0xB4,0x00,0x02,0x01,0x07,0x02,0x01,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x13,0x00,
-
+// Frame 23: Diff RLE (594 bytes)
+static const uint8_t SAD_FRAME23_DATA[594] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE5,0x00,0x07,0x01,0xD8,0x00,0x02,0x01,0x02,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x03,0x02,0x04,0x03,0x03,0x02,
+0x02,0x01,0x8C,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,
+0x01,0x02,0x12,0x03,0x02,0x02,0x03,0x01,0x7E,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,
+0x01,0x01,0x2A,0x00,0x01,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x70,0x00,0x02,0x01,
+0x02,0x02,0x26,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x25,0x03,0x02,0x02,0x02,0x01,
+0x62,0x00,0x02,0x01,0x02,0x02,0x2E,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x2D,0x03,
+0x02,0x02,0x02,0x01,0x55,0x00,0x02,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x23,0x00,
+0x01,0x02,0x36,0x03,0x02,0x02,0x02,0x01,0x46,0x00,0x02,0x01,0x02,0x02,0x3D,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x3E,0x03,0x02,0x02,0x03,0x01,0x37,0x00,0x02,0x01,
+0x02,0x02,0x45,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x46,0x03,0x03,0x02,0x02,0x01,
+0x29,0x00,0x02,0x01,0x03,0x02,0x4B,0x03,0x01,0x02,0x1F,0x00,0x4F,0x03,0x02,0x02,
+0x03,0x01,0x1B,0x00,0x01,0x01,0x03,0x02,0x53,0x03,0x1E,0x00,0x01,0x01,0x56,0x03,
+0x02,0x02,0x01,0x01,0x13,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x01,0x02,0x5B,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x08,0x00,0x5F,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x5F,0x03,0x01,0x01,0x06,0x00,0x60,0x03,0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
+0x04,0x00,0x60,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x21,0x00,0x61,0x03,0x01,0x01,0x01,0x02,0x5F,0x03,
+0x01,0x01,0x22,0x00,0x01,0x01,0x60,0x03,0x02,0x02,0x5E,0x03,0x01,0x01,0x24,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x5D,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x02,0x5B,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x58,0x03,
+0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x02,0x02,0x52,0x03,
+0x02,0x02,0x02,0x01,0x35,0x00,0x01,0x01,0x02,0x02,0x55,0x03,0x02,0x01,0x4B,0x03,
+0x02,0x02,0x02,0x01,0x42,0x00,0x02,0x01,0x02,0x02,0x4E,0x03,0x01,0x01,0x01,0x00,
+0x01,0x02,0x44,0x03,0x02,0x02,0x01,0x01,0x50,0x00,0x02,0x01,0x02,0x02,0x46,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x3D,0x03,0x02,0x02,0x02,0x01,0x5D,0x00,0x02,0x01,
+0x03,0x02,0x3D,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x35,0x03,0x02,0x02,0x02,0x01,
+0x6C,0x00,0x02,0x01,0x03,0x02,0x34,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x2D,0x03,
+0x02,0x02,0x03,0x01,0x79,0x00,0x03,0x01,0x03,0x02,0x2B,0x03,0x01,0x02,0x08,0x00,
+0x01,0x01,0x25,0x03,0x02,0x02,0x03,0x01,0x88,0x00,0x02,0x01,0x03,0x02,0x23,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x1C,0x03,0x02,0x02,0x03,0x01,0x97,0x00,0x02,0x01,
+0x02,0x02,0x1A,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x14,0x03,0x02,0x02,0x02,0x01,
+0xA5,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,
+0x01,0x02,0x09,0x03,0x02,0x02,0x02,0x01,0xB4,0x00,0x02,0x01,0x07,0x02,0x01,0x01,
+0x0D,0x00,
 };
 static const DiffBlock SAD_FRAME23_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 110,  // Changed box top-left
+    229, 38,  // Changed box dimensions
     SAD_FRAME23_DATA
 };
-
-// Frame 24: Full frame RLE (1068 bytes)
-static const uint8_t SAD_FRAME24_DATA[1068] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4D,0x00,0x02,0x01,0x07,0x02,0x01,0x01,0x39,0x00,
-0x05,0x01,0xF1,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x30,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x02,0x02,0x03,0x01,0xE2,0x00,0x02,0x01,0x02,0x02,
+
+// Frame 24: Diff RLE (606 bytes)
+static const uint8_t SAD_FRAME24_DATA[606] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0x06,0x00,0x02,0x01,0x07,0x02,0x01,0x01,0x39,0x00,
+0x05,0x01,0x98,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x30,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x02,0x02,0x03,0x01,0x89,0x00,0x02,0x01,0x02,0x02,
 0x19,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x02,0x01,
-0xD4,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x20,0x03,
-0x02,0x02,0x02,0x01,0xC4,0x00,0x03,0x01,0x02,0x02,0x2A,0x03,0x01,0x01,0x25,0x00,
-0x01,0x01,0x29,0x03,0x03,0x02,0x02,0x01,0xB5,0x00,0x02,0x01,0x03,0x02,0x32,0x03,
-0x01,0x02,0x23,0x00,0x01,0x02,0x32,0x03,0x03,0x02,0x02,0x01,0xA5,0x00,0x03,0x01,
+0x7B,0x00,0x02,0x01,0x02,0x02,0x22,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x20,0x03,
+0x02,0x02,0x02,0x01,0x6B,0x00,0x03,0x01,0x02,0x02,0x2A,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x29,0x03,0x03,0x02,0x02,0x01,0x5C,0x00,0x02,0x01,0x03,0x02,0x32,0x03,
+0x01,0x02,0x23,0x00,0x01,0x02,0x32,0x03,0x03,0x02,0x02,0x01,0x4C,0x00,0x03,0x01,
 0x03,0x02,0x3A,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x3B,0x03,0x03,0x02,0x03,0x01,
-0x95,0x00,0x03,0x01,0x02,0x02,0x43,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x44,0x03,
-0x03,0x02,0x03,0x01,0x86,0x00,0x02,0x01,0x03,0x02,0x4A,0x03,0x01,0x02,0x1F,0x00,
-0x4D,0x03,0x03,0x02,0x02,0x01,0x78,0x00,0x02,0x01,0x02,0x02,0x53,0x03,0x1E,0x00,
-0x01,0x01,0x55,0x03,0x02,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,0x5B,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x60,0x03,
-0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
-0x21,0x00,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x22,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x5B,0x00,0x5F,0x03,0x01,0x01,0x24,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x28,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,
-0x2A,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x5B,0x00,0x59,0x03,0x01,0x02,0x2F,0x00,
-0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x52,0x03,0x02,0x02,
-0x02,0x01,0x35,0x00,0x01,0x01,0x02,0x02,0x55,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x4A,0x03,0x03,0x02,0x02,0x01,0x42,0x00,0x03,0x01,0x02,0x02,0x4D,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x02,0x42,0x03,0x02,0x02,0x03,0x01,0x51,0x00,0x03,0x01,0x03,0x02,
-0x43,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x3A,0x03,0x03,0x02,0x03,0x01,0x60,0x00,
-0x03,0x01,0x03,0x02,0x3A,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x32,0x03,0x03,0x02,
-0x02,0x01,0x70,0x00,0x03,0x01,0x02,0x02,0x32,0x03,0x01,0x02,0x61,0x00,0x01,0x01,
-0x2A,0x03,0x02,0x02,0x03,0x01,0x7F,0x00,0x03,0x01,0x02,0x02,0x29,0x03,0x01,0x01,
-0x64,0x00,0x01,0x02,0x21,0x03,0x02,0x02,0x02,0x01,0x8F,0x00,0x03,0x01,0x02,0x02,
-0x1F,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,
-0x02,0x01,0x9E,0x00,0x02,0x01,0x03,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
-0x01,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0xAD,0x00,0x02,0x01,0x02,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x71,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0xBC,0x00,0x04,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x92,0x00,
+0x3C,0x00,0x03,0x01,0x02,0x02,0x43,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x44,0x03,
+0x03,0x02,0x03,0x01,0x2D,0x00,0x02,0x01,0x03,0x02,0x4A,0x03,0x01,0x02,0x1F,0x00,
+0x4D,0x03,0x03,0x02,0x02,0x01,0x1F,0x00,0x02,0x01,0x02,0x02,0x53,0x03,0x1E,0x00,
+0x01,0x01,0x55,0x03,0x02,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x60,0x03,
+0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
+0x21,0x00,0x61,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x22,0x00,
+0x01,0x01,0x60,0x03,0x01,0x02,0x02,0x00,0x5F,0x03,0x01,0x01,0x24,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x28,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x02,0x02,0x01,0x5B,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,
+0x5C,0x03,0x01,0x02,0x02,0x00,0x59,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x01,0x02,
+0x59,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x52,0x03,0x02,0x02,0x02,0x01,0x35,0x00,
+0x01,0x01,0x02,0x02,0x55,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x4A,0x03,0x03,0x02,
+0x02,0x01,0x42,0x00,0x03,0x01,0x02,0x02,0x4D,0x03,0x01,0x01,0x03,0x00,0x01,0x02,
+0x42,0x03,0x02,0x02,0x03,0x01,0x51,0x00,0x03,0x01,0x03,0x02,0x43,0x03,0x01,0x01,
+0x04,0x00,0x01,0x01,0x3A,0x03,0x03,0x02,0x03,0x01,0x60,0x00,0x03,0x01,0x03,0x02,
+0x3A,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x32,0x03,0x03,0x02,0x02,0x01,0x70,0x00,
+0x03,0x01,0x02,0x02,0x32,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x2A,0x03,0x02,0x02,
+0x03,0x01,0x7F,0x00,0x03,0x01,0x02,0x02,0x29,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,
+0x21,0x03,0x02,0x02,0x02,0x01,0x8F,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x9E,0x00,
+0x02,0x01,0x03,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x0F,0x03,
+0x02,0x02,0x02,0x01,0xAD,0x00,0x02,0x01,0x02,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x18,0x00,0x02,0x01,0x06,0x02,0x02,0x01,0xBC,0x00,0x04,0x01,0x10,0x00,
 };
 static const DiffBlock SAD_FRAME24_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 114,  // Changed box top-left
+    231, 36,  // Changed box dimensions
     SAD_FRAME24_DATA
 };
 
-// Frame 25: Full frame RLE (1046 bytes)
-static const uint8_t SAD_FRAME25_DATA[1046] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD3,0x00,0x04,0x01,0xFF,0x00,
-0x35,0x00,0x03,0x01,0x02,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,
-0x02,0x02,0x08,0x03,0x02,0x02,0x02,0x01,0xE7,0x00,0x03,0x01,0x02,0x02,0x15,0x03,
-0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x03,0x01,
-0xD6,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,
-0x01,0x02,0x1E,0x03,0x02,0x02,0x03,0x01,0xC6,0x00,0x03,0x01,0x03,0x02,0x28,0x03,
-0x01,0x01,0x25,0x00,0x01,0x02,0x28,0x03,0x03,0x02,0x03,0x01,0xB5,0x00,0x03,0x01,
-0x03,0x02,0x31,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x31,0x03,0x03,0x02,0x03,0x01,
-0xA5,0x00,0x03,0x01,0x02,0x02,0x3B,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x3B,0x03,
-0x03,0x02,0x02,0x01,0x95,0x00,0x03,0x01,0x02,0x02,0x44,0x03,0x01,0x01,0x1F,0x00,
-0x01,0x01,0x44,0x03,0x03,0x02,0x02,0x01,0x86,0x00,0x02,0x01,0x02,0x02,0x4C,0x03,
-0x01,0x02,0x1E,0x00,0x01,0x01,0x4E,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,
-0x02,0x02,0x55,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x02,0x01,
-0x6D,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x69,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x65,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x62,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x60,0x00,0x01,0x02,0x60,0x03,0x1E,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5E,0x00,
-0x01,0x02,0x60,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x61,0x03,0x20,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x5B,0x00,0x60,0x03,
-0x01,0x01,0x23,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x25,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x59,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x5B,0x00,0x57,0x03,
-0x01,0x02,0x02,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x5B,0x00,
+// Frame 25: Diff RLE (574 bytes)
+static const uint8_t SAD_FRAME25_DATA[574] = {
+0xFF,0x00,0xFF,0x00,0x22,0x00,0x04,0x01,0xDB,0x00,0x03,0x01,0x02,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x02,0x02,0x08,0x03,0x02,0x02,0x02,0x01,
+0x8E,0x00,0x03,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x01,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x7D,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,
+0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x03,0x01,
+0x6D,0x00,0x03,0x01,0x03,0x02,0x28,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x28,0x03,
+0x03,0x02,0x03,0x01,0x5C,0x00,0x03,0x01,0x03,0x02,0x31,0x03,0x01,0x02,0x23,0x00,
+0x01,0x02,0x31,0x03,0x03,0x02,0x03,0x01,0x4C,0x00,0x03,0x01,0x02,0x02,0x3B,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x3B,0x03,0x03,0x02,0x02,0x01,0x3C,0x00,0x03,0x01,
+0x02,0x02,0x44,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x44,0x03,0x03,0x02,0x02,0x01,
+0x2D,0x00,0x02,0x01,0x02,0x02,0x4C,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x4E,0x03,
+0x02,0x02,0x02,0x01,0x1E,0x00,0x01,0x01,0x02,0x02,0x55,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x56,0x03,0x01,0x02,0x02,0x01,0x14,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x60,0x03,0x1E,0x00,
+0x01,0x01,0x60,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x1E,0x00,
+0x01,0x01,0x61,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x20,0x00,0x01,0x01,
+0x61,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
+0x60,0x03,0x01,0x01,0x02,0x00,0x60,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x01,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x02,0x01,0x5D,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x5E,0x03,0x02,0x01,
+0x5B,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x02,0x00,0x57,0x03,
+0x01,0x02,0x02,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x02,0x00,
 0x01,0x02,0x4E,0x03,0x02,0x02,0x03,0x01,0x3B,0x00,0x03,0x01,0x03,0x02,0x4F,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x45,0x03,0x03,0x02,0x03,0x01,0x4B,0x00,0x04,0x01,
-0x03,0x02,0x45,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x3D,0x03,0x02,0x02,0x03,0x01,
-0x5C,0x00,0x03,0x01,0x03,0x02,0x3D,0x03,0x5F,0x00,0x01,0x02,0x34,0x03,0x02,0x02,
-0x03,0x01,0x6C,0x00,0x03,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0x60,0x00,0x01,0x02,
+0x01,0x01,0x02,0x00,0x01,0x01,0x45,0x03,0x03,0x02,0x03,0x01,0x4B,0x00,0x04,0x01,
+0x03,0x02,0x45,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x3D,0x03,0x02,0x02,0x03,0x01,
+0x5C,0x00,0x03,0x01,0x03,0x02,0x3D,0x03,0x06,0x00,0x01,0x02,0x34,0x03,0x02,0x02,
+0x03,0x01,0x6C,0x00,0x03,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
 0x2B,0x03,0x02,0x02,0x03,0x01,0x7D,0x00,0x02,0x01,0x03,0x02,0x2B,0x03,0x01,0x01,
-0x62,0x00,0x01,0x01,0x23,0x03,0x02,0x02,0x02,0x01,0x8D,0x00,0x03,0x01,0x02,0x02,
-0x21,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x19,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,
-0x03,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x09,0x00,0x01,0x01,0x23,0x03,0x02,0x02,0x02,0x01,0x8D,0x00,0x03,0x01,0x02,0x02,
+0x21,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x19,0x03,0x02,0x02,0x02,0x01,0x9D,0x00,
+0x03,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
 0x02,0x02,0x02,0x01,0xAD,0x00,0x03,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x70,0x00,0x02,0x01,0x04,0x02,0x03,0x01,0xBC,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x4F,0x00,
+0x17,0x00,0x02,0x01,0x04,0x02,0x03,0x01,0xBC,0x00,0x07,0x01,0x0E,0x00,
 };
 static const DiffBlock SAD_FRAME25_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 117,  // Changed box top-left
+    231, 34,  // Changed box dimensions
     SAD_FRAME25_DATA
 };
 
-// Frame 26: Full frame RLE (764 bytes)
-static const uint8_t SAD_FRAME26_DATA[764] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xDC,0x00,0x02,0x01,0x02,0x02,0x52,0x03,0x02,0x02,0x01,0x01,
-0x29,0x00,0x01,0x01,0x02,0x02,0x52,0x03,0x02,0x02,0x01,0x01,0x64,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,
-0x60,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
-0x5D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x5C,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
-0x5A,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x60,0x00,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x65,0x00,0x01,0x01,0x55,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x56,0x02,
-0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x48,0x00,
+// Frame 26: Diff RLE (274 bytes)
+static const uint8_t SAD_FRAME26_DATA[274] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x6C,0x00,
+0x02,0x01,0x02,0x02,0x52,0x03,0x02,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x02,0x02,
+0x52,0x03,0x02,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x62,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x01,
+0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x00,
+0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x01,
+0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x05,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x07,0x00,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x55,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x56,0x02,0x01,0x01,
+0x07,0x00,
 };
 static const DiffBlock SAD_FRAME26_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 119,  // Changed box top-left
+    231, 32,  // Changed box dimensions
     SAD_FRAME26_DATA
 };
 
-// Frame 27: Full frame RLE (826 bytes)
-static const uint8_t SAD_FRAME27_DATA[826] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xD5,0x00,0x01,0x01,0x02,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x01,0x02,0x4E,0x03,0x01,0x02,0x02,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
-0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x65,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x61,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5C,0x00,0x01,0x02,0x62,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x5A,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5F,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x65,0x00,0x01,0x02,
-0x55,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x55,0x03,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x02,0x02,0x4C,0x03,0x01,0x02,0x02,0x01,0x2F,0x00,0x01,0x01,
-0x02,0x02,0x4C,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0F,0x00,
+// Frame 27: Diff RLE (320 bytes)
+static const uint8_t SAD_FRAME27_DATA[320] = {
+0x09,0x00,0x01,0x01,0x02,0x02,0x4E,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
+0x01,0x02,0x4E,0x03,0x01,0x02,0x02,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x05,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x03,0x00,0x01,0x02,0x62,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
+0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,
+0x01,0x01,0x01,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,
+0x01,0x02,0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,
+0x04,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x06,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x59,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x55,0x03,
+0x01,0x01,0x11,0x00,0x01,0x01,0x02,0x02,0x4C,0x03,0x01,0x02,0x02,0x01,0x2F,0x00,
+0x01,0x01,0x02,0x02,0x4C,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0xFF,0x00,0xC1,0x00,
+
 };
 static const DiffBlock SAD_FRAME27_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 128,  // Changed box top-left
+    231, 23,  // Changed box dimensions
     SAD_FRAME27_DATA
 };
 
-// Frame 28: Full frame RLE (1228 bytes)
-static const uint8_t SAD_FRAME28_DATA[1228] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x70,0x00,0x03,0x01,0x27,0x02,0x03,0x01,0x55,0x00,0x03,0x01,0x26,0x02,0x04,0x01,
-0x8C,0x00,0x02,0x01,0x02,0x02,0x30,0x03,0x02,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
-0x02,0x02,0x30,0x03,0x02,0x02,0x02,0x01,0x84,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+// Frame 28: Diff RLE (802 bytes)
+static const uint8_t SAD_FRAME28_DATA[802] = {
+0x1C,0x00,0x03,0x01,0x27,0x02,0x03,0x01,0x55,0x00,0x03,0x01,0x26,0x02,0x04,0x01,
+0x33,0x00,0x02,0x01,0x02,0x02,0x30,0x03,0x02,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,
+0x02,0x02,0x30,0x03,0x02,0x02,0x02,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
 0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,
-0x7E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x40,0x03,0x01,0x02,0x7A,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
-0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
-0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x4D,0x03,
-0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x6F,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x52,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x65,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x27,0x00,0x01,0x02,0x59,0x03,0x63,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
-0x5E,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
-0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,
-0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x5D,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
-0x60,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x65,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x67,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x01,0x02,0x52,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x01,0x4D,0x03,
-0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x49,0x03,
-0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x75,0x00,
-0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x02,
-0x01,0x01,0x79,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x40,0x03,0x01,0x02,0x7F,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x44,0x00,
-0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x84,0x00,0x01,0x01,0x02,0x02,
-0x32,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
-0x02,0x01,0x8C,0x00,0x02,0x01,0x29,0x02,0x02,0x01,0x54,0x00,0x03,0x01,0x28,0x02,
-0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x35,0x00,
+0x25,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,
+0x40,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
+0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
+0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x4D,0x03,
+0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x52,0x03,
+0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x0C,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x59,0x03,0x0A,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x09,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
+0x05,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,
+0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,
+0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x02,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
+0x01,0x02,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x02,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,
+0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
+0x62,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x60,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
+0x06,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x01,0x07,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x0C,0x00,
+0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x0E,0x00,0x01,0x01,0x55,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x01,0x02,
+0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x13,0x00,0x01,0x02,
+0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x19,0x00,0x01,0x01,
+0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,
+0x1C,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x44,0x03,
+0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x02,0x40,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x44,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x02,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
+0x01,0x02,0x02,0x01,0x33,0x00,0x02,0x01,0x29,0x02,0x02,0x01,0x54,0x00,0x03,0x01,
+0x28,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0x9A,0x00,
 };
 static const DiffBlock SAD_FRAME28_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 83,  // Changed box top-left
+    231, 65,  // Changed box dimensions
     SAD_FRAME28_DATA
 };
 
-// Frame 29: Full frame RLE (1384 bytes)
-static const uint8_t SAD_FRAME29_DATA[1384] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA5,0x00,0x03,0x01,0x17,0x02,
-0x03,0x01,0x65,0x00,0x03,0x01,0x16,0x02,0x03,0x01,0x9C,0x00,0x02,0x01,0x01,0x02,
-0x23,0x03,0x02,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,
-0x02,0x01,0x91,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,0x01,0x02,
-0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0x84,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,
-0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x79,0x00,0x01,0x02,
-0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x02,
-0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x72,0x00,0x4D,0x03,
-0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x4F,0x03,
-0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x6D,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
-0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x68,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
-0x27,0x00,0x5A,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,
-0x5F,0x03,0x5E,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x5C,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,
-0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
-0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
-0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,
-0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,
-0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,
-0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,
-0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x63,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x21,0x00,0x60,0x03,0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x5D,0x03,0x61,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x01,0x62,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x64,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x65,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x68,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x6A,0x00,
-0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,
-0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x01,
-0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x74,0x00,0x01,0x02,
-0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x77,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x7A,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x7E,0x00,
-0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,
-0x01,0x02,0x83,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x88,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x02,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
-0x01,0x01,0x8E,0x00,0x02,0x01,0x01,0x02,0x27,0x03,0x02,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x02,0x01,0x96,0x00,0x02,0x01,0x03,0x02,
-0x19,0x03,0x03,0x02,0x02,0x01,0x5F,0x00,0x02,0x01,0x03,0x02,0x19,0x03,0x02,0x02,
-0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x80,0x00,
+// Frame 29: Diff RLE (966 bytes)
+static const uint8_t SAD_FRAME29_DATA[966] = {
+0x24,0x00,0x03,0x01,0x17,0x02,0x03,0x01,0x65,0x00,0x03,0x01,0x16,0x02,0x03,0x01,
+0x43,0x00,0x02,0x01,0x01,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
+0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
+0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x32,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,
+0x34,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,
+0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
+0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
+0x22,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,
+0x01,0x02,0x20,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x01,0x19,0x00,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
+0x16,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,0x14,0x00,
+0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x11,0x00,
+0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x0D,0x00,
+0x01,0x02,0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x59,0x03,0x01,0x02,0x27,0x00,0x5A,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x09,0x00,0x5D,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x05,0x00,0x01,0x02,0x60,0x03,0x20,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x02,
+0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x65,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,
+0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,
+0x01,0x01,0x03,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
+0x01,0x02,0x04,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x06,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x06,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5D,0x03,0x08,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x57,0x03,
+0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0F,0x00,0x55,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x11,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x02,0x52,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x35,0x00,
+0x01,0x02,0x4A,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,
+0x01,0x01,0x48,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,
+0x01,0x01,0x44,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,
+0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
+0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
+0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,
+0x4D,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x02,0x01,
+0x01,0x02,0x27,0x03,0x02,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x02,0x01,0x3D,0x00,0x02,0x01,0x03,0x02,0x19,0x03,0x03,0x02,0x02,0x01,
+0x5F,0x00,0x02,0x01,0x03,0x02,0x19,0x03,0x02,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xA8,0x00,
 };
 static const DiffBlock SAD_FRAME29_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 68,  // Changed box top-left
+    231, 64,  // Changed box dimensions
     SAD_FRAME29_DATA
 };
 
-// Frame 30: Full frame RLE (1464 bytes)
-static const uint8_t SAD_FRAME30_DATA[1464] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x64,0x00,0x02,0x01,0x03,0x02,0x14,0x03,
-0x02,0x02,0x02,0x01,0x65,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x03,0x02,0x01,0x01,
-0x9E,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,
-0x8E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x01,0x36,0x03,0x01,0x01,0x84,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,
-0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x79,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,
-0x01,0x01,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x73,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x6D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x6C,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,
-0x01,0x02,0x6A,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x68,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x66,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x64,0x00,
-0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x5D,0x03,
-0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x5E,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,
-0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,
-0x01,0x01,0x62,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
-0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
-0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5D,0x00,0x01,0x02,
-0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x23,0x00,0x01,0x02,0x5D,0x03,0x61,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x62,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x63,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,
-0x65,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x67,0x00,0x01,0x01,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x68,0x00,0x01,0x02,
-0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,
-0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x01,0x4D,0x03,
-0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x72,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x74,0x00,0x01,0x01,0x47,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x01,0x77,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x7A,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x40,0x03,0x01,0x02,0x7E,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x81,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,
-0x38,0x03,0x01,0x02,0x87,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x8C,0x00,0x01,0x02,0x2D,0x03,
-0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x01,0x92,0x00,
-0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,
-0x26,0x03,0x01,0x02,0x01,0x01,0x99,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,
-0x02,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0xA3,0x00,
-0x03,0x01,0x0F,0x02,0x04,0x01,0x6B,0x00,0x03,0x01,0x10,0x02,0x03,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x41,0x00,
+// Frame 30: Diff RLE (1048 bytes)
+static const uint8_t SAD_FRAME30_DATA[1048] = {
+0x24,0x00,0x02,0x01,0x03,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x02,0x01,
+0x02,0x02,0x14,0x03,0x03,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x02,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
+0x3C,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
+0x01,0x01,0x4F,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x02,
+0x35,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x36,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,
+0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x45,0x03,0x01,0x02,
+0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x49,0x03,
+0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x4B,0x03,
+0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,
+0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x13,0x00,0x53,0x03,
+0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x11,0x00,0x55,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0F,0x00,0x57,0x03,0x01,0x01,0x29,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,
+0x01,0x01,0x58,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x08,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,
+0x05,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,
+0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
+0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x01,0x00,
+0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x02,
+0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
+0x01,0x02,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x02,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,
+0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x00,0x63,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
+0x01,0x02,0x61,0x03,0x04,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x60,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,
+0x06,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x08,0x00,
+0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x09,0x00,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x0C,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x58,0x03,0x0E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
+0x56,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,
+0x54,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,
+0x01,0x01,0x15,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x19,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x1B,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
+0x47,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,
+0x44,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x02,0x40,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,
+0x43,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,
+0x38,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,
+0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
+0x01,0x01,0x33,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,
+0x01,0x02,0x2D,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
+0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
+0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,
+0x1C,0x03,0x02,0x02,0x01,0x01,0x4A,0x00,0x03,0x01,0x0F,0x02,0x04,0x01,0x6B,0x00,
+0x03,0x01,0x10,0x02,0x03,0x01,0x28,0x00,
 };
 static const DiffBlock SAD_FRAME30_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 67,  // Changed box top-left
+    231, 65,  // Changed box dimensions
     SAD_FRAME30_DATA
 };
 
-// Frame 31: Full frame RLE (1504 bytes)
-static const uint8_t SAD_FRAME31_DATA[1504] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xAD,0x00,0x03,0x01,0x03,0x02,0x0B,0x03,0x04,0x02,0x02,0x01,
-0x6A,0x00,0x03,0x01,0x04,0x02,0x0B,0x03,0x03,0x02,0x03,0x01,0xA2,0x00,0x01,0x01,
-0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x5F,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,
-0x02,0x02,0x01,0x01,0x99,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,
-0x57,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x92,0x00,0x01,0x01,
-0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x8C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x87,0x00,0x01,0x01,0x37,0x03,0x01,0x02,
-0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x83,0x00,0x01,0x02,
-0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x7F,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,
-0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x79,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,
-0x01,0x01,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x73,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,
-0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,
-0x01,0x02,0x6A,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
-0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x66,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x64,0x00,
-0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x62,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x62,0x00,
-0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x5F,0x03,0x01,0x01,
-0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x21,0x00,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,
-0x01,0x01,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5D,0x00,0x01,0x02,0x60,0x03,0x20,0x00,
-0x01,0x01,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,
-0x60,0x03,0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x02,0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5D,0x03,
-0x61,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x62,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x63,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x65,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x67,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x68,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
-0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x6A,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
-0x31,0x00,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,
-0x01,0x02,0x4D,0x03,0x72,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x74,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x48,0x03,
-0x01,0x01,0x76,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x44,0x03,
-0x01,0x02,0x7A,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x42,0x03,
-0x01,0x01,0x7D,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
-0x3E,0x03,0x01,0x01,0x81,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
-0x01,0x01,0x3A,0x03,0x01,0x01,0x85,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,
-0x49,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x30,0x03,0x01,0x02,
-0x01,0x01,0x8E,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x94,0x00,0x02,0x01,0x01,0x02,
-0x22,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,
-0x01,0x01,0x9D,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x02,0x01,0x63,0x00,
-0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0xA7,0x00,0x03,0x01,0x0B,0x02,
-0x03,0x01,0x71,0x00,0x03,0x01,0x0A,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x39,0x00,
+// Frame 31: Diff RLE (1104 bytes)
+static const uint8_t SAD_FRAME31_DATA[1104] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xAE,0x00,0x03,0x01,0x03,0x02,0x0B,0x03,
+0x04,0x02,0x02,0x01,0x6A,0x00,0x03,0x01,0x04,0x02,0x0B,0x03,0x03,0x02,0x03,0x01,
+0x49,0x00,0x01,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0x5F,0x00,0x02,0x01,
+0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x25,0x03,
+0x01,0x02,0x02,0x01,0x57,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,
+0x39,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
+0x01,0x01,0x4D,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,
+0x37,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
+0x2A,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,
+0x01,0x01,0x26,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,
+0x3F,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
+0x42,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x01,0x46,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x48,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x34,0x00,
+0x01,0x01,0x4C,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x11,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,
+0x54,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,
+0x56,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x09,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
+0x07,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x06,0x00,
+0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x05,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x60,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x61,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,
+0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
+0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x65,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
+0x02,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
+0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x04,0x00,0x01,0x02,
+0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x60,0x03,0x06,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,
+0x01,0x01,0x5E,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,
+0x01,0x02,0x5D,0x03,0x08,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,
+0x0C,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x0E,0x00,0x01,0x01,
+0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x11,0x00,0x01,0x02,
+0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x13,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x31,0x00,0x50,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x4D,0x03,
+0x01,0x02,0x33,0x00,0x01,0x02,0x4D,0x03,0x19,0x00,0x4B,0x03,0x01,0x01,0x35,0x00,
+0x01,0x02,0x4A,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x38,0x00,
+0x01,0x01,0x48,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x3B,0x00,
+0x01,0x02,0x44,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x3E,0x00,
+0x01,0x01,0x42,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
+0x41,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x39,0x03,0x01,0x02,
+0x01,0x01,0x45,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,0x35,0x03,
+0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
+0x30,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,
+0x30,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,
+0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
+0x02,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
+0x22,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x01,0x02,
+0x02,0x01,0x63,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0x4E,0x00,
+0x03,0x01,0x0B,0x02,0x03,0x01,0x71,0x00,0x03,0x01,0x0A,0x02,0x04,0x01,0x2A,0x00,
 
 };
 static const DiffBlock SAD_FRAME31_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 67,  // Changed box top-left
+    231, 73,  // Changed box dimensions
     SAD_FRAME31_DATA
 };
 
-// Frame 32: Full frame RLE (1516 bytes)
-static const uint8_t SAD_FRAME32_DATA[1516] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x35,0x00,0x0E,0x01,0x73,0x00,
-0x0E,0x01,0xAA,0x00,0x01,0x01,0x03,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x9E,0x00,0x02,0x01,0x01,0x02,
-0x1F,0x03,0x02,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x97,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,
-0x2E,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,
-0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,
-0x01,0x01,0x86,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x38,0x03,0x01,0x02,0x83,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,
-0x01,0x01,0x3C,0x03,0x01,0x02,0x7F,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x46,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x49,0x03,
-0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x4C,0x03,
-0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
-0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6A,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x02,0x54,0x03,0x01,0x02,0x68,0x00,0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,
-0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x62,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,
-0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x5E,0x03,0x01,0x01,0x5F,0x00,0x5F,0x03,
-0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
-0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5D,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x02,0x21,0x00,0x60,0x03,0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,
-0x01,0x02,0x5D,0x03,0x61,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x62,0x00,0x5B,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x63,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x64,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x66,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x68,0x00,
-0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,
-0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,
-0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x4D,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4B,0x03,
-0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x01,0x02,
-0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x76,0x00,0x01,0x01,
-0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x79,0x00,0x01,0x02,
-0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,
-0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,
-0x01,0x01,0x3B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x01,0x01,0x83,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x02,
-0x36,0x03,0x01,0x02,0x01,0x01,0x87,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x8D,0x00,0x01,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
-0x92,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,
-0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x99,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,
-0x01,0x02,0x02,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,
-0xA1,0x00,0x03,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,0x69,0x00,0x02,0x01,
-0x03,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,0xB1,0x00,0x04,0x01,0x7D,0x00,0x04,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x3B,0x00,
+// Frame 32: Diff RLE (1114 bytes)
+static const uint8_t SAD_FRAME32_DATA[1114] = {
+0xFF,0x00,0xFB,0x00,0x0E,0x01,0x73,0x00,0x0E,0x01,0x51,0x00,0x01,0x01,0x03,0x02,
+0x13,0x03,0x03,0x02,0x02,0x01,0x65,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,
+0x02,0x01,0x45,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0x5D,0x00,
+0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,
+0x27,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
+0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x51,0x00,0x01,0x02,
+0x2E,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
+0x4B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
+0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x02,0x3C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x26,0x00,
+0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,
+0x22,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,
+0x01,0x01,0x19,0x00,0x01,0x02,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
+0x17,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
+0x14,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
+0x12,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
+0x11,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0F,0x00,
+0x57,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,
+0x58,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x5A,0x03,
+0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x09,0x00,0x5D,0x03,0x01,0x01,0x23,0x00,
+0x01,0x02,0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,
+0x5E,0x03,0x01,0x01,0x06,0x00,0x5F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x01,0x01,
+0x04,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x02,0x00,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x02,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,
+0x01,0x02,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x64,0x03,0x02,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
+0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,0x63,0x03,
+0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
+0x62,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
+0x61,0x03,0x04,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
+0x01,0x01,0x04,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x06,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x06,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x08,0x00,0x01,0x02,
+0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x09,0x00,0x5B,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x58,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x01,0x56,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x54,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x50,0x03,0x30,0x00,0x01,0x01,0x50,0x03,
+0x01,0x01,0x15,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4B,0x03,
+0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
+0x46,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x42,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
+0x3E,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x44,0x00,
+0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,
+0x36,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,
+0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x32,0x03,
+0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x25,0x03,
+0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x5F,0x00,0x01,0x01,
+0x02,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x48,0x00,0x03,0x01,0x03,0x02,0x0E,0x03,
+0x03,0x02,0x02,0x01,0x69,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,0x03,0x02,0x02,0x01,
+0x58,0x00,0x04,0x01,0x7D,0x00,0x04,0x01,0x31,0x00,
 };
 static const DiffBlock SAD_FRAME32_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 72,  // Changed box top-left
+    231, 72,  // Changed box dimensions
     SAD_FRAME32_DATA
 };
 
@@ -148,2912 +148,2416 @@ static const DiffBlock STUN_FRAME0_BLOCK = {
     STUN_FRAME0_DATA
 };
 
-// Frame 1: Full frame RLE (2182 bytes)
-static const uint8_t STUN_FRAME1_DATA[2182] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCC,0x00,0x02,0x01,0x04,0x02,0x0D,0x03,
-0x04,0x02,0x02,0x01,0xFF,0x00,0x23,0x00,0x02,0x01,0x03,0x02,0x1A,0x03,0x02,0x02,
-0x02,0x01,0x87,0x00,0x0F,0x01,0x84,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,
-0x01,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0x79,0x00,
-0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x01,0x01,0x02,0x02,
-0x1E,0x03,0x01,0x02,0x02,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
-0x01,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x02,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x02,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
-0x37,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x49,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,
-0x01,0x02,0x4C,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x47,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x5C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x42,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,
-0x01,0x01,0x41,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x3C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x64,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x01,0x02,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x3A,0x00,
-0x01,0x02,0x63,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x61,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x5F,0x03,
-0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x5F,0x03,
-0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,
-0x5C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,
-0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x56,0x03,
-0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,0x01,0x01,
-0x4D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x52,0x03,
-0x01,0x02,0x50,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,
-0x50,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x50,0x00,
-0x01,0x02,0x4E,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,
-0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x48,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
-0x58,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
-0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,
-0x61,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
-0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x69,0x00,
-0x01,0x01,0x02,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,
-0x36,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x02,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x02,0x02,0x30,0x03,0x01,0x02,0x02,0x01,0x73,0x00,
-0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x02,0x01,0x72,0x00,0x01,0x01,0x02,0x02,
-0x2A,0x03,0x02,0x02,0x01,0x01,0x7A,0x00,0x02,0x01,0x04,0x02,0x15,0x03,0x02,0x02,
-0x02,0x01,0x7A,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x84,0x00,
-0x03,0x01,0x08,0x02,0x08,0x01,0x82,0x00,0x02,0x01,0x03,0x02,0x1A,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x24,0x00,0x04,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x04,0x01,
-0xFF,0x00,0x31,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xD8,0x00,
+// Frame 1: Diff RLE (204 bytes)
+static const uint8_t STUN_FRAME1_DATA[204] = {
+0x2C,0x00,0x01,0x01,0x26,0x00,0x02,0x01,0x02,0x02,0x03,0x03,0x22,0x00,0x01,0x01,
+0x02,0x02,0x08,0x03,0x1E,0x00,0x01,0x01,0x02,0x02,0x0C,0x03,0x1B,0x00,0x01,0x01,
+0x02,0x02,0x0F,0x03,0x18,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x16,0x00,0x01,0x01,
+0x01,0x02,0x15,0x03,0x14,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x12,0x00,0x01,0x01,
+0x01,0x02,0x19,0x03,0x11,0x00,0x01,0x02,0x1B,0x03,0x0F,0x00,0x01,0x01,0x01,0x02,
+0x1C,0x03,0x0E,0x00,0x01,0x02,0x1E,0x03,0x0C,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
+0x0B,0x00,0x01,0x01,0x21,0x03,0x0A,0x00,0x01,0x01,0x22,0x03,0x09,0x00,0x01,0x02,
+0x23,0x03,0x08,0x00,0x01,0x02,0x24,0x03,0x07,0x00,0x01,0x01,0x25,0x03,0x06,0x00,
+0x01,0x01,0x26,0x03,0x05,0x00,0x01,0x01,0x27,0x03,0x04,0x00,0x01,0x01,0x28,0x03,
+0x04,0x00,0x01,0x02,0x28,0x03,0x03,0x00,0x01,0x01,0x29,0x03,0x03,0x00,0x01,0x02,
+0x29,0x03,0x02,0x00,0x01,0x01,0x2A,0x03,0x01,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,
+0x01,0x00,0x01,0x01,0x2B,0x03,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x01,0x2C,0x03,
+0x01,0x01,0x2C,0x03,0x01,0x02,0x2C,0x03,0x01,0x02,0x59,0x03,
 };
 static const DiffBlock STUN_FRAME1_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    25, 37,  // Changed box top-left
+    45, 33,  // Changed box dimensions
     STUN_FRAME1_DATA
 };
 
-// Frame 2: Full frame RLE (2188 bytes)
-static const uint8_t STUN_FRAME2_DATA[2188] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCC,0x00,0x02,0x01,0x04,0x02,0x0D,0x03,
-0x04,0x02,0x02,0x01,0xFF,0x00,0x23,0x00,0x02,0x01,0x03,0x02,0x1A,0x03,0x02,0x02,
-0x02,0x01,0x88,0x00,0x0E,0x01,0x84,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,
-0x01,0x01,0x7D,0x00,0x02,0x01,0x03,0x02,0x12,0x03,0x03,0x02,0x02,0x01,0x79,0x00,
-0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x01,0x01,0x02,0x02,
-0x1E,0x03,0x01,0x02,0x02,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
-0x01,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x02,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x02,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
-0x37,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x49,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,
-0x01,0x02,0x4C,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x44,0x00,0x01,0x01,
-0x01,0x02,0x5C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3E,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
-0x01,0x02,0x64,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x64,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x38,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x01,0x02,0x65,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,
-0x01,0x02,0x65,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,
-0x61,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,
-0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x01,0x02,0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,
-0x3F,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0x01,0x01,0x40,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x01,0x02,0x58,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x47,0x00,
-0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
-0x49,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,
-0x54,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
-0x01,0x02,0x47,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,
-0x40,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x42,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x01,0x01,
-0x5F,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,
-0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
-0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,
-0x67,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,
-0x02,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x02,0x02,0x30,0x03,
-0x01,0x02,0x02,0x01,0x73,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x02,0x01,
-0x72,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,0x02,0x02,0x01,0x01,0x7A,0x00,0x02,0x01,
-0x04,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x7A,0x00,0x01,0x01,0x02,0x02,0x24,0x03,
-0x02,0x02,0x01,0x01,0x84,0x00,0x03,0x01,0x08,0x02,0x08,0x01,0x82,0x00,0x02,0x01,
-0x03,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x24,0x00,0x04,0x01,0x03,0x02,
-0x09,0x03,0x04,0x02,0x04,0x01,0xFF,0x00,0x31,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD8,0x00,
+// Frame 2: Diff RLE (1322 bytes)
+static const uint8_t STUN_FRAME2_DATA[1322] = {
+0x03,0x00,0x0E,0x01,0x84,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,
+0x20,0x00,0x01,0x02,0x12,0x03,0x03,0x02,0x02,0x01,0x79,0x00,0x02,0x01,0x01,0x02,
+0x2C,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x19,0x03,0x01,0x02,0x02,0x01,0x73,0x00,
+0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x1D,0x03,0x01,0x02,
+0x01,0x01,0x6D,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x18,0x00,
+0x20,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
+0x01,0x01,0x16,0x00,0x23,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
+0x3F,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x25,0x03,0x01,0x02,0x01,0x01,0x60,0x00,
+0x01,0x02,0x43,0x03,0x01,0x02,0x13,0x00,0x27,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
+0x01,0x01,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x29,0x03,0x01,0x02,
+0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
+0x2B,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x2D,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x02,0x0D,0x00,0x2E,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x30,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x53,0x03,
+0x01,0x02,0x0B,0x00,0x31,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x32,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x33,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x01,0x01,0x07,0x00,0x34,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,
+0x07,0x00,0x35,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,
+0x06,0x00,0x36,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,
+0x01,0x01,0x05,0x00,0x36,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x02,0x05,0x00,0x37,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,
+0x01,0x01,0x04,0x00,0x38,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
+0x04,0x00,0x39,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,
+0x03,0x00,0x39,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x03,0x00,
+0x3A,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x02,0x00,
+0x3A,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x02,0x00,
+0x3A,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x02,0x00,
+0x3B,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x02,0x00,0x3B,0x03,
+0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x01,0x00,
+0x3B,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,
+0x3B,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,
+0x3C,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
+0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
+0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x01,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x01,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x01,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x01,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x01,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x01,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x02,0x01,0x01,0x3C,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,
+0x3C,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x3C,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x3C,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
+0x67,0x03,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x67,0x03,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x67,0x03,0x01,0x01,
+0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x3C,0x03,
+0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x3C,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,
+0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x67,0x03,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
+0x01,0x01,0x3C,0x03,0x01,0x02,0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x00,
+0x3C,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,
+0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x01,0x00,0x3B,0x03,
+0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x02,0x00,0x3B,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x02,0x00,0x3B,0x03,0x01,0x01,
+0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x03,0x00,0x3A,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x39,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x04,0x00,0x39,0x03,
+0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x05,0x00,0x38,0x03,0x01,0x02,
+0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x37,0x03,0x01,0x02,
+0x01,0x01,0x44,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x06,0x00,0x37,0x03,0x01,0x01,
+0x45,0x00,0x01,0x01,0x01,0x02,0x58,0x03,0x01,0x01,0x07,0x00,0x36,0x03,0x01,0x02,
+0x47,0x00,0x01,0x01,0x01,0x02,0x56,0x03,0x01,0x01,0x08,0x00,0x35,0x03,0x01,0x02,
+0x49,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x01,0x09,0x00,0x34,0x03,0x01,0x02,
+0x4C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x0A,0x00,0x33,0x03,0x01,0x02,0x01,0x01,
+0x4D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x0B,0x00,0x32,0x03,0x01,0x02,0x50,0x00,
+0x01,0x01,0x4D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
 };
 static const DiffBlock STUN_FRAME2_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    67, 37,  // Changed box top-left
+    223, 84,  // Changed box dimensions
     STUN_FRAME2_DATA
 };
 
-// Frame 3: Full frame RLE (2184 bytes)
-static const uint8_t STUN_FRAME3_DATA[2184] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCC,0x00,0x02,0x01,0x04,0x02,0x0D,0x03,
-0x04,0x02,0x02,0x01,0xFF,0x00,0x23,0x00,0x02,0x01,0x03,0x02,0x1A,0x03,0x02,0x02,
-0x02,0x01,0x87,0x00,0x0F,0x01,0x84,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,
-0x01,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0x79,0x00,
-0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x76,0x00,0x01,0x01,0x02,0x02,
-0x1E,0x03,0x01,0x02,0x02,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
-0x01,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,
-0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x02,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x01,0x01,0x65,0x00,0x01,0x01,0x02,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x63,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,
-0x37,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x5E,0x00,
-0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,
-0x45,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
-0x52,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x49,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,
-0x01,0x02,0x4C,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x01,0x4F,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x47,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x45,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x5C,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x42,0x00,0x01,0x01,
-0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,
-0x01,0x01,0x41,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x5C,0x03,
-0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x3C,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,
-0x3A,0x00,0x01,0x01,0x01,0x02,0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x64,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
-0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x38,0x00,
-0x01,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x66,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x37,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,
-0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
-0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
-0x39,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x39,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x36,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,
-0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,
-0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,
-0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
-0x66,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x65,0x03,
-0x01,0x02,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x65,0x03,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x64,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x5F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x5F,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,
-0x5E,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x58,0x03,
-0x01,0x01,0x43,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,
-0x56,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x49,0x00,0x01,0x01,
-0x01,0x02,0x54,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x02,0x52,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x54,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,
-0x52,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x50,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x50,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x47,0x03,
-0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x01,0x01,
-0x57,0x00,0x01,0x01,0x01,0x02,0x44,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,
-0x48,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
-0x01,0x01,0x58,0x00,0x01,0x01,0x46,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,
-0x01,0x01,0x61,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,
-0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
-0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,
-0x69,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x02,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x02,0x02,0x30,0x03,0x01,0x02,0x02,0x01,
-0x73,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x02,0x01,0x72,0x00,0x01,0x01,
-0x02,0x02,0x2A,0x03,0x02,0x02,0x01,0x01,0x7A,0x00,0x02,0x01,0x04,0x02,0x15,0x03,
-0x02,0x02,0x02,0x01,0x7A,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,
-0x84,0x00,0x03,0x01,0x08,0x02,0x08,0x01,0x82,0x00,0x02,0x01,0x03,0x02,0x1A,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x24,0x00,0x04,0x01,0x03,0x02,0x09,0x03,0x04,0x02,
-0x04,0x01,0xFF,0x00,0x31,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD8,0x00,
+// Frame 3: Diff RLE (704 bytes)
+static const uint8_t STUN_FRAME3_DATA[704] = {
+0x02,0x00,0x0F,0x01,0x84,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,
+0x20,0x00,0x13,0x03,0x03,0x02,0x02,0x01,0x79,0x00,0x02,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x1D,0x00,0x19,0x03,0x01,0x02,0x02,0x01,0x73,0x00,0x01,0x01,
+0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x1D,0x03,0x01,0x02,0x01,0x01,
+0x6D,0x00,0x01,0x01,0x02,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x20,0x03,
+0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,
+0x16,0x00,0x23,0x03,0x01,0x02,0x01,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,
+0x01,0x02,0x01,0x01,0x14,0x00,0x25,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x02,
+0x43,0x03,0x01,0x02,0x13,0x00,0x27,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x29,0x03,0x01,0x02,0x01,0x01,
+0x58,0x00,0x01,0x01,0x01,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x2B,0x03,
+0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,
+0x0E,0x00,0x2D,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,
+0x0D,0x00,0x2E,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x30,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
+0x0B,0x00,0x31,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x32,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x33,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x08,0x00,
+0x34,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x07,0x00,0x35,0x03,
+0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x5C,0x03,0x01,0x01,0x06,0x00,0x36,0x03,
+0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x5D,0x03,0x01,0x02,0x01,0x01,0x05,0x00,
+0x36,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x05,0x00,
+0x37,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x04,0x00,
+0x38,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x04,0x00,0x39,0x03,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x03,0x00,0x39,0x03,
+0x01,0x02,0x3D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x03,0x00,0x3A,0x03,0x01,0x01,
+0x3C,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x3A,0x03,0x01,0x02,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x01,0x01,0x02,0x00,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x3A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x02,0x00,0x3B,0x03,0x01,0x01,
+0x3A,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x02,0x00,0x3B,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x3B,0x03,0x01,0x02,
+0x39,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,0x3B,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x01,0x38,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
+0x67,0x03,0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,
+0x01,0x01,0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
+0x01,0x00,0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x01,0x00,
+0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,
+0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x01,0x00,
+0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,
+0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,
+0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,
+0x3C,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,
+
 };
 static const DiffBlock STUN_FRAME3_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    67, 37,  // Changed box top-left
+    223, 43,  // Changed box dimensions
     STUN_FRAME3_DATA
 };
 
-// Frame 4: Full frame RLE (1098 bytes)
-static const uint8_t STUN_FRAME4_DATA[1098] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x24,0x00,0x03,0x01,0xFF,0x00,0x3B,0x00,0x06,0x01,0xFF,0x00,0x3A,0x00,0x01,0x01,
-0x03,0x02,0x03,0x01,0xFF,0x00,0x39,0x00,0x01,0x01,0x04,0x02,0x02,0x01,0xFF,0x00,
-0x38,0x00,0x01,0x01,0x02,0x02,0x03,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x37,0x00,
-0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x37,0x00,0x01,0x01,
-0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x01,0x02,
-0x06,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x37,0x00,0x01,0x02,0x07,0x03,0x01,0x02,
-0xFF,0x00,0x37,0x00,0x01,0x02,0x07,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x36,0x00,
-0x01,0x01,0x08,0x03,0x01,0x02,0xFF,0x00,0x37,0x00,0x01,0x02,0x07,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x08,0x03,0x01,0x02,0xFF,0x00,0x37,0x00,
-0x01,0x02,0x08,0x03,0x01,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x08,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x36,0x00,0x01,0x02,0x08,0x03,0x01,0x02,0x0F,0x00,0x04,0x01,
-0xFF,0x00,0x23,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x01,0x0E,0x00,0x05,0x01,
-0xFF,0x00,0x23,0x00,0x01,0x01,0x08,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x02,0x01,
-0x01,0x02,0x04,0x01,0xFF,0x00,0x22,0x00,0x01,0x02,0x08,0x03,0x01,0x02,0x0E,0x00,
-0x01,0x01,0x03,0x02,0x03,0x01,0xFF,0x00,0x22,0x00,0x01,0x02,0x08,0x03,0x01,0x01,
-0x0D,0x00,0x01,0x01,0x05,0x02,0x01,0x01,0xFF,0x00,0x22,0x00,0x01,0x01,0x01,0x02,
-0x08,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x03,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x22,0x00,0x01,0x01,0x01,0x02,0x07,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,
-0x03,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x22,0x00,0x01,0x01,0x01,0x02,0x07,0x03,
-0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x04,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x23,0x00,0x01,0x02,0x07,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x04,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x22,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x01,
-0x0E,0x00,0x01,0x01,0x06,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x24,0x00,0x04,0x01,
-0x10,0x00,0x01,0x01,0x06,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x38,0x00,0x01,0x01,
-0x06,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x38,0x00,0x01,0x01,0x06,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x38,0x00,0x01,0x01,0x07,0x03,0x01,0x01,0xED,0x00,0x1B,0x01,
-0x2F,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,0xB9,0x00,0x13,0x01,
-0x1D,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x02,0x07,0x03,0x01,0x02,
-0x75,0x00,0x1B,0x01,0x1A,0x02,0x5F,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x08,0x03,
-0x01,0x02,0x01,0x01,0x34,0x00,0x1A,0x01,0x1F,0x02,0x9A,0x03,0x01,0x02,0x2D,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x0D,0x01,0x24,0x02,0xD3,0x03,0x02,0x02,0x01,0x01,
-0x08,0x00,0x14,0x01,0x11,0x02,0xFF,0x03,0x0D,0x02,0x04,0x01,0x04,0x00,0xEB,0x03,
-0x19,0x02,0x21,0x01,0x1B,0x00,0xA7,0x03,0x1B,0x02,0x1A,0x01,0x64,0x00,0x6A,0x03,
-0x18,0x02,0x14,0x01,0xAA,0x00,0x2B,0x03,0x04,0x02,0x0D,0x03,0x02,0x02,0x22,0x01,
-0xFF,0x00,0x11,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0xFF,0x00,0x36,0x00,
-0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x01,0x02,
-0x08,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x35,0x00,0x01,0x01,0x01,0x02,0x09,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x35,0x00,0x01,0x01,0x01,0x02,0x07,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x03,0x02,0x02,0x01,
-0xFF,0x00,0x35,0x00,0x02,0x01,0x01,0x02,0x06,0x03,0x02,0x02,0x04,0x01,0xFF,0x00,
-0x35,0x00,0x02,0x01,0x01,0x02,0x04,0x03,0x02,0x02,0x04,0x01,0xFF,0x00,0x37,0x00,
-0x02,0x01,0x05,0x02,0x04,0x01,0xFF,0x00,0x3A,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4C,0x00,
+// Frame 4: Diff RLE (804 bytes)
+static const uint8_t STUN_FRAME4_DATA[804] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x28,0x00,0x03,0x01,0xFF,0x00,0x3A,0x00,
+0x06,0x01,0xFF,0x00,0x39,0x00,0x01,0x01,0x03,0x02,0x03,0x01,0xFF,0x00,0x38,0x00,
+0x01,0x01,0x04,0x02,0x02,0x01,0xFF,0x00,0x37,0x00,0x01,0x01,0x02,0x02,0x03,0x03,
+0x02,0x02,0x01,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x02,
+0x01,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,
+0xFF,0x00,0x35,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
+0x36,0x00,0x01,0x02,0x07,0x03,0x01,0x02,0xFF,0x00,0x36,0x00,0x01,0x02,0x07,0x03,
+0x01,0x02,0x01,0x01,0xFF,0x00,0x35,0x00,0x01,0x01,0x08,0x03,0x01,0x02,0xFF,0x00,
+0x36,0x00,0x01,0x02,0x07,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x35,0x00,0x01,0x01,
+0x08,0x03,0x01,0x02,0xFF,0x00,0x36,0x00,0x01,0x02,0x08,0x03,0x01,0x01,0xFF,0x00,
+0x35,0x00,0x01,0x01,0x08,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x35,0x00,0x01,0x02,
+0x08,0x03,0x01,0x02,0x0F,0x00,0x04,0x01,0xFF,0x00,0x22,0x00,0x01,0x01,0x01,0x02,
+0x08,0x03,0x01,0x01,0x0E,0x00,0x05,0x01,0xFF,0x00,0x22,0x00,0x01,0x01,0x08,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x02,0x01,0x01,0x02,0x04,0x01,0xFF,0x00,0x21,0x00,
+0x01,0x02,0x08,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x03,0x02,0x03,0x01,0xFF,0x00,
+0x21,0x00,0x01,0x02,0x08,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x05,0x02,0x01,0x01,
+0xFF,0x00,0x21,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,
+0x03,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x21,0x00,0x01,0x01,0x01,0x02,0x07,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x03,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
+0x21,0x00,0x01,0x01,0x01,0x02,0x07,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x04,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x22,0x00,0x01,0x02,0x07,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x04,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x21,0x00,
+0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x06,0x03,0x01,0x02,
+0x01,0x01,0xFF,0x00,0x23,0x00,0x04,0x01,0x10,0x00,0x01,0x01,0x06,0x03,0x01,0x02,
+0x01,0x01,0xFF,0x00,0x37,0x00,0x01,0x01,0x06,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
+0x37,0x00,0x01,0x01,0x06,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x37,0x00,0x01,0x01,
+0x07,0x03,0x01,0x01,0xED,0x00,0x1B,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x06,0x03,
+0x01,0x02,0x01,0x01,0xB9,0x00,0x13,0x01,0x1D,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,
+0x2D,0x00,0x01,0x02,0x07,0x03,0x01,0x02,0x75,0x00,0x1B,0x01,0x1A,0x02,0x5F,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x02,0x08,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x1A,0x01,
+0x1F,0x02,0x9A,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0D,0x01,
+0x24,0x02,0xD3,0x03,0x02,0x02,0x01,0x01,0x07,0x00,0x14,0x01,0x11,0x02,0xFF,0x03,
+0x0D,0x02,0x04,0x01,0x03,0x00,0xEB,0x03,0x19,0x02,0x21,0x01,0x1A,0x00,0xA7,0x03,
+0x1B,0x02,0x1A,0x01,0x63,0x00,0x6A,0x03,0x18,0x02,0x14,0x01,0xA9,0x00,0x2B,0x03,
+0x04,0x02,0x0D,0x03,0x02,0x02,0x22,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0xFF,0x00,0x35,0x00,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,
+0xFF,0x00,0x35,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,
+0x34,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x34,0x00,
+0x01,0x01,0x01,0x02,0x07,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x35,0x00,0x01,0x01,
+0x01,0x02,0x06,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,0x34,0x00,0x02,0x01,0x01,0x02,
+0x06,0x03,0x02,0x02,0x04,0x01,0xFF,0x00,0x34,0x00,0x02,0x01,0x01,0x02,0x04,0x03,
+0x02,0x02,0x04,0x01,0xFF,0x00,0x36,0x00,0x02,0x01,0x05,0x02,0x04,0x01,0xFF,0x00,
+0x39,0x00,0x07,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0x3F,0x00,
 };
 static const DiffBlock STUN_FRAME4_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    0, 35,  // Changed box top-left
+    319, 101,  // Changed box dimensions
     STUN_FRAME4_DATA
 };
 
-// Frame 5: Full frame RLE (4114 bytes)
-static const uint8_t STUN_FRAME5_DATA[4114] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x1D,0x00,0x04,0x01,0xFF,0x00,0x3A,0x00,0x01,0x01,0x01,0x02,0x06,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x02,0x01,
-0x85,0x00,0x08,0x01,0xA4,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x78,0x00,
-0x02,0x01,0x04,0x02,0x0F,0x03,0x04,0x02,0x02,0x01,0x9C,0x00,0x01,0x01,0x11,0x03,
-0x01,0x02,0x01,0x01,0x70,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,
-0x97,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x6B,0x00,0x02,0x01,0x02,0x02,
-0x25,0x03,0x02,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,
-0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x93,0x00,
-0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x33,0x03,
-0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x01,
-0x02,0x02,0x11,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x01,0x01,0x93,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x1E,0x03,0x08,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x16,0x03,
-0x03,0x02,0x03,0x01,0x0D,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x01,0x02,0x6F,0x00,
-0x02,0x01,0x0A,0x02,0x03,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x02,0x01,0x19,0x00,
-0x02,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x02,0x01,0x03,0x02,
-0x11,0x03,0x03,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
-0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,
-0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x4B,0x00,
-0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,0x27,0x00,0x01,0x01,0x02,0x02,
-0x10,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x02,0x01,0x01,0x02,0x22,0x03,0x02,0x02,
-0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x49,0x00,0x01,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
-0x01,0x02,0x0E,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
-0x01,0x01,0x31,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x44,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x0C,0x01,0x14,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x42,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x02,0x01,0x03,0x02,
-0x0E,0x03,0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x51,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,
-0x0F,0x00,0x02,0x01,0x01,0x02,0x17,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,
-0x0E,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x03,0x02,0x08,0x01,
-0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x3F,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x0E,0x00,0x02,0x01,0x01,0x02,
-0x1E,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x4C,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x0E,0x00,0x02,0x01,
-0x02,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
-0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,
-0x16,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x1C,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
-0x20,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x24,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
-0x38,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x31,0x03,
-0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,
-0x04,0x01,0x07,0x00,0x03,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,
-0x02,0x01,0x08,0x02,0x02,0x01,0x0F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x36,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x12,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x41,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
-0x02,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x17,0x00,
-0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
-0x40,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x09,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x01,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x07,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x19,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x04,0x02,0x01,0x01,
-0x0C,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x49,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0D,0x00,0x02,0x01,0x07,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
-0x1F,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x12,0x03,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x3B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x47,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,
+// Frame 5: Diff RLE (3748 bytes)
+static const uint8_t STUN_FRAME5_DATA[3748] = {
+0xF4,0x00,0x04,0x01,0xFF,0x00,0x39,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,
+0x01,0x01,0xFF,0x00,0x35,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x02,0x01,0x84,0x00,
+0x08,0x01,0xA4,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x02,0x01,
+0x04,0x02,0x0F,0x03,0x04,0x02,0x02,0x01,0x9C,0x00,0x01,0x01,0x11,0x03,0x01,0x02,
+0x01,0x01,0x6F,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0x97,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x6A,0x00,0x02,0x01,0x02,0x02,0x25,0x03,
+0x02,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,
+0x65,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x01,
+0x01,0x02,0x14,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,
+0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
+0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
+0x93,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,
+0x1E,0x03,0x08,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x02,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,
+0x03,0x01,0x0D,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x01,0x02,0x6F,0x00,0x02,0x01,
+0x0A,0x02,0x03,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x4F,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x02,0x01,0x19,0x00,0x02,0x01,
+0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x02,0x01,0x03,0x02,0x11,0x03,
+0x03,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x4C,0x00,
+0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x02,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,
+0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,
+0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,0x27,0x00,0x01,0x01,0x02,0x02,0x10,0x03,
+0x01,0x02,0x01,0x01,0x5D,0x00,0x02,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x5A,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,
+0x0E,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
+0x31,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x43,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x0C,0x01,0x14,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
+0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
+0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,
+0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x51,0x00,
+0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,0x0F,0x00,
+0x02,0x01,0x01,0x02,0x17,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x03,0x02,0x08,0x01,0x02,0x02,
+0x14,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x3E,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x0E,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,
+0x01,0x02,0x02,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x4C,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x0E,0x00,0x02,0x01,0x02,0x02,
+0x12,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x3C,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x24,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x16,0x00,
+0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x20,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0C,0x00,
+0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x24,0x00,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x31,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x04,0x01,
+0x07,0x00,0x03,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,0x02,0x01,
+0x08,0x02,0x02,0x01,0x0F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x41,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x02,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x40,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x12,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x02,0x09,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x16,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x07,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x3E,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x04,0x02,0x01,0x01,0x0C,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x48,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0D,0x00,0x02,0x01,0x07,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x3D,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x1D,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x3C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x1F,0x03,
+0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x47,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x12,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3B,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x15,0x03,0x01,0x02,
 0x08,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,
-0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x46,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x15,0x03,
-0x01,0x02,0x08,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x09,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x46,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x16,0x03,0x01,0x02,
+0x01,0x01,0x3B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x16,0x03,0x01,0x02,0x08,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x3B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x03,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x02,
 0x08,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
 0x01,0x01,0x3B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x46,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x16,0x03,
-0x01,0x02,0x08,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x46,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x17,0x03,0x01,0x01,
-0x07,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x46,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
-0x16,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x06,0x00,0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
-0x46,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x15,0x03,
-0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
-0x06,0x02,0x02,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x08,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x47,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x03,0x01,
-0x02,0x02,0x02,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x48,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x02,0x01,0x08,0x00,0x01,0x01,0x02,0x02,
-0x0D,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0F,0x03,0x07,0x02,0x11,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x49,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x0F,0x03,0x02,0x02,0x0A,0x01,0x02,0x02,0x10,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x23,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x2B,0x03,0x01,0x02,0x01,0x01,
-0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x41,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x29,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x01,0x0D,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x4F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
-0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0E,0x00,
-0x02,0x01,0x02,0x02,0x0E,0x03,0x01,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
-0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x51,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x03,0x01,
-0x06,0x02,0x03,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x48,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x02,0x02,0x11,0x03,
-0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x53,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x03,0x01,
-0x09,0x02,0x02,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x55,0x00,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
-0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x01,0x57,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x23,0x00,0x02,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x59,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x02,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x11,0x03,0x02,0x02,0x01,0x01,0x19,0x00,0x02,0x01,0x01,0x02,0x11,0x03,
-0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
-0x24,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x13,0x03,
-0x02,0x02,0x02,0x01,0x11,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x01,0x01,
-0x56,0x00,0x01,0x01,0x12,0x03,0x02,0x02,0x01,0x01,0x1D,0x00,0x02,0x01,0x01,0x02,
-0x12,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,
-0x09,0x01,0x03,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x13,0x03,0x02,0x02,0x02,0x01,0x15,0x00,0x03,0x01,0x01,0x02,0x13,0x03,0x01,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x16,0x03,0x02,0x02,0x04,0x01,0x09,0x00,0x04,0x01,0x02,0x02,0x16,0x03,
-0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x01,0x02,0x1F,0x03,0x02,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
-0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,
-0x39,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
-0x01,0x01,0x67,0x00,0x01,0x01,0x02,0x02,0x33,0x03,0x02,0x02,0x01,0x01,0x74,0x00,
-0x01,0x01,0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,
-0x01,0x01,0x72,0x00,0x02,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x02,0x01,0x7F,0x00,
-0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x79,0x00,0x01,0x01,0x02,0x02,
-0x22,0x03,0x01,0x02,0x02,0x01,0x87,0x00,0x03,0x01,0x0B,0x02,0x04,0x01,0x83,0x00,
-0x01,0x01,0x02,0x02,0x19,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,0x25,0x00,0x03,0x01,
-0x11,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x1C,0x00,
+0x0B,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x45,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x17,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x3B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x45,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x16,0x03,
+0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x3B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x01,0x06,0x00,0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x45,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,
+0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x06,0x02,
+0x02,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x46,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x03,0x01,0x02,0x02,
+0x02,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x3D,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x47,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x0D,0x03,0x01,0x02,0x02,0x01,0x08,0x00,0x01,0x01,0x02,0x02,0x0D,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0F,0x03,0x07,0x02,0x11,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x3E,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x0F,0x03,0x02,0x02,0x0A,0x01,0x02,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x23,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x2B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x41,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x29,0x03,
+0x01,0x02,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x4E,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x01,0x45,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0E,0x00,0x02,0x01,
+0x02,0x02,0x0E,0x03,0x01,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
+0x19,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x50,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x03,0x01,0x06,0x02,
+0x03,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x02,0x02,
+0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x52,0x00,
+0x01,0x02,0x0E,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x4A,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x03,0x01,0x09,0x02,
+0x02,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x54,0x00,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x4C,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x23,0x00,
+0x02,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x58,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,
+0x10,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
+0x02,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,
+0x11,0x03,0x02,0x02,0x01,0x01,0x19,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
+0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x24,0x00,
+0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x13,0x03,0x02,0x02,
+0x02,0x01,0x11,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
+0x01,0x01,0x12,0x03,0x02,0x02,0x01,0x01,0x1D,0x00,0x02,0x01,0x01,0x02,0x12,0x03,
+0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x09,0x01,
+0x03,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x13,0x03,
+0x02,0x02,0x02,0x01,0x15,0x00,0x03,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,
+0x63,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x16,0x03,0x02,0x02,0x04,0x01,0x09,0x00,0x04,0x01,0x02,0x02,0x16,0x03,0x01,0x02,
+0x01,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,
+0x01,0x02,0x1F,0x03,0x02,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,
+0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
+0x67,0x00,0x01,0x01,0x02,0x02,0x33,0x03,0x02,0x02,0x01,0x01,0x73,0x00,0x01,0x01,
+0x01,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
+0x01,0x02,0x01,0x01,0x78,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,
+0x72,0x00,0x02,0x01,0x02,0x02,0x28,0x03,0x01,0x02,0x02,0x01,0x7E,0x00,0x02,0x01,
+0x02,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x79,0x00,0x01,0x01,0x02,0x02,0x22,0x03,
+0x01,0x02,0x02,0x01,0x86,0x00,0x03,0x01,0x0B,0x02,0x04,0x01,0x83,0x00,0x01,0x01,
+0x02,0x02,0x19,0x03,0x03,0x02,0x01,0x01,0xFF,0x00,0x24,0x00,0x03,0x01,0x11,0x02,
+0x03,0x01,0x4D,0x00,
 };
 static const DiffBlock STUN_FRAME5_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    0, 32,  // Changed box top-left
+    319, 73,  // Changed box dimensions
     STUN_FRAME5_DATA
 };
 
-// Frame 6: Full frame RLE (4100 bytes)
-static const uint8_t STUN_FRAME6_DATA[4100] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA6,0x00,0x02,0x01,
-0x0C,0x02,0x03,0x01,0xFF,0x00,0x29,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x03,0x02,
-0x02,0x01,0xFF,0x00,0x1E,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x16,0x00,0x02,0x01,0x02,0x02,0x28,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x10,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x0A,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x02,0x01,0xA1,0x00,0x03,0x01,0x01,0x02,
-0x02,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x9D,0x00,
-0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x3F,0x03,0x01,0x02,0x01,0x01,0x9A,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x05,0x02,0x08,0x01,0x02,0x02,0x1A,0x03,
-0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x11,0x00,0x03,0x01,0x02,0x02,0x16,0x03,
-0x01,0x02,0x01,0x01,0x6A,0x00,0x03,0x01,0x0F,0x02,0x02,0x01,0x18,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x02,0x01,
-0x1C,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x02,0x02,
-0x16,0x03,0x03,0x02,0x02,0x01,0x12,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x23,0x00,0x02,0x01,
-0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,
-0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x01,0x11,0x03,0x01,0x02,0x02,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
-0x01,0x02,0x5C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x10,0x03,0x01,0x02,
-0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x02,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x33,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x46,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x02,0x01,0x0B,0x02,
-0x03,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x46,0x00,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x03,0x02,
-0x11,0x03,0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
-0x4F,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x46,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,
-0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x03,0x02,0x0C,0x01,
-0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x04,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,
-0x02,0x01,0x0D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x12,0x03,
-0x02,0x02,0x01,0x01,0x12,0x00,0x03,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x59,0x00,0x01,0x01,0x01,0x02,
-0x25,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x49,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,
-0x11,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x56,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x1E,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x30,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x42,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x04,0x02,0x03,0x01,0x05,0x02,
-0x12,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x42,0x00,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x06,0x01,0x10,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x12,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,0x02,0x01,0x01,0x02,0x11,0x03,
-0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x02,0x02,0x08,0x03,0x02,0x02,0x02,0x01,
-0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x4D,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,
-0x0F,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,
-0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x19,0x00,
+// Frame 6: Diff RLE (3732 bytes)
+static const uint8_t STUN_FRAME6_DATA[3732] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x64,0x00,0x02,0x01,0x0C,0x02,
+0x03,0x01,0xF3,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x03,0x02,0x02,0x01,0xE8,0x00,
+0x02,0x01,0x02,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0xE0,0x00,0x02,0x01,0x02,0x02,
+0x28,0x03,0x02,0x02,0x01,0x01,0xDA,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x02,0x02,
+0x01,0x01,0xD4,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x02,0x01,0xA1,0x00,
+0x03,0x01,0x01,0x02,0x02,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
+0x01,0x01,0x9D,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,0x23,0x00,
+0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x9A,0x00,0x01,0x01,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x05,0x02,0x08,0x01,
+0x02,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x1C,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x11,0x00,0x03,0x01,
+0x02,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x03,0x01,0x0F,0x02,0x02,0x01,
+0x18,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x01,0x02,0x14,0x03,
+0x01,0x02,0x02,0x01,0x1C,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x01,0x01,0x65,0x00,
+0x01,0x01,0x02,0x02,0x16,0x03,0x03,0x02,0x02,0x01,0x12,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,
+0x23,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x02,0x01,
+0x01,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x14,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x02,0x01,0x2A,0x00,0x01,0x01,
+0x01,0x02,0x11,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,
+0x10,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x57,0x00,0x02,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x14,0x00,
+0x02,0x01,0x0B,0x02,0x03,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,
+0x51,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x11,0x00,
+0x01,0x01,0x03,0x02,0x11,0x03,0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x02,0x01,0x01,
+0x0F,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x14,0x03,
+0x03,0x02,0x0C,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x04,0x01,0x10,0x00,0x01,0x01,0x01,0x02,
+0x21,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x4B,0x00,
+0x01,0x01,0x12,0x03,0x02,0x02,0x01,0x01,0x12,0x00,0x03,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x19,0x00,
+0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x01,0x01,0x1E,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,
+0x2C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x44,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x26,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x04,0x02,
+0x03,0x01,0x05,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x42,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x06,0x01,
+0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x19,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,0x02,0x01,
+0x01,0x02,0x11,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x02,0x02,0x08,0x03,
+0x02,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x15,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,
+0x02,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x14,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x12,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x03,0x01,
+0x0F,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x1E,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x02,0x01,0x01,0x0C,0x00,0x02,0x01,0x02,0x02,0x05,0x03,0x02,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x20,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
 0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x3E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x15,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x1D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x49,0x00,
-0x01,0x02,0x0E,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x03,0x01,0x0F,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x01,0x1E,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x0C,0x00,0x02,0x01,0x02,0x02,0x05,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x20,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x46,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x03,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x45,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x14,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x02,0x00,0x01,0x01,0x11,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x16,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x39,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x03,0x00,
-0x01,0x01,0x12,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x02,0x17,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x18,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,0x01,0x02,0x12,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
 0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x05,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x43,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x19,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x43,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x19,0x03,0x01,0x01,
-0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x11,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x03,0x01,0x01,0x02,0x10,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x10,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x14,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,0x11,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0F,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x16,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x03,0x00,0x01,0x01,0x12,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x17,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x03,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x18,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,
+0x01,0x02,0x12,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
 0x38,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x43,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x19,0x03,
-0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,
-0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x39,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x01,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x44,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x04,0x03,0x02,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x03,0x01,0x0C,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x18,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
-0x45,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x45,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x08,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x3C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x01,0x0F,0x03,0x02,0x02,0x03,0x01,0x09,0x00,0x01,0x01,0x02,0x02,0x10,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x47,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
-0x25,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x3D,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x13,0x03,
-0x08,0x02,0x13,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x48,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x01,
-0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x2C,0x03,0x01,0x01,0x0C,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,
-0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x40,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x41,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x25,0x03,0x01,0x02,
-0x01,0x01,0x0D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x0D,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x0E,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0D,0x00,
-0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x0F,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x02,0x02,0x02,0x01,0x10,0x00,0x01,0x02,
-0x0E,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
-0x01,0x01,0x02,0x02,0x16,0x03,0x01,0x02,0x02,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x14,0x00,0x06,0x01,
-0x14,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x02,0x01,0x03,0x02,0x0C,0x03,0x03,0x02,
-0x02,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x52,0x00,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x15,0x00,0x0A,0x01,
-0x15,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,
-0x0F,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x30,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x10,0x03,0x01,0x02,
-0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,
-0x10,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,
-0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x10,0x03,0x01,0x02,
-0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x16,0x00,0x01,0x01,0x02,0x02,
-0x12,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x02,0x01,
-0x22,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,
-0x01,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x0B,0x00,0x03,0x01,0x02,0x02,0x15,0x03,
-0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x1C,0x00,
-0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x18,0x03,
-0x09,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x14,0x03,0x02,0x02,
-0x02,0x01,0x13,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
-0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x17,0x03,
-0x04,0x02,0x08,0x01,0x04,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x02,
-0x33,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x6B,0x00,0x02,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x64,0x00,
-0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x02,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x32,0x03,0x02,0x02,
-0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x6F,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x7B,0x00,0x01,0x01,0x02,0x02,
-0x1A,0x03,0x02,0x02,0x02,0x01,0x74,0x00,0x02,0x01,0x01,0x02,0x27,0x03,0x02,0x02,
-0x01,0x01,0x82,0x00,0x02,0x01,0x04,0x02,0x0B,0x03,0x05,0x02,0x02,0x01,0x7D,0x00,
-0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,0x8C,0x00,0x09,0x01,0x89,0x00,
-0x02,0x01,0x03,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,0x2B,0x00,0x10,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x20,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x19,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x10,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x19,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
+0x01,0x01,0x19,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x02,0x02,0x09,0x03,
+0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x02,0x02,0x03,0x03,0x02,0x02,
+0x02,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,
+0x04,0x03,0x02,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,
+0x03,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x14,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x08,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x11,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x0F,0x03,0x02,0x02,0x03,0x01,0x09,0x00,0x01,0x01,
+0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x13,0x03,0x08,0x02,0x13,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x13,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x23,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x3E,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x2C,0x03,
+0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x15,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x25,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x17,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x19,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
+0x01,0x01,0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x0E,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x0D,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x02,0x02,0x02,0x01,
+0x10,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x46,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x01,0x02,0x02,0x16,0x03,0x01,0x02,0x02,0x01,0x0F,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,
+0x14,0x00,0x06,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x48,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x02,0x01,0x03,0x02,
+0x0C,0x03,0x03,0x02,0x02,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x1D,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x15,0x00,0x0A,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x22,0x00,0x01,0x02,
+0x10,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,
+0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x11,0x03,0x01,0x02,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
+0x10,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x16,0x00,
+0x01,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x11,0x03,
+0x01,0x02,0x02,0x01,0x22,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
+0x28,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x0B,0x00,0x03,0x01,
+0x02,0x02,0x15,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,
+0x02,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,
+0x01,0x02,0x18,0x03,0x09,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,
+0x14,0x03,0x02,0x02,0x02,0x01,0x13,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x17,0x03,0x04,0x02,0x08,0x01,0x04,0x02,0x19,0x03,0x01,0x02,0x01,0x01,
+0x33,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x02,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,
+0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
+0x01,0x01,0x01,0x02,0x28,0x03,0x02,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,
+0x32,0x03,0x02,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x02,0x02,
+0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x46,0x00,
+0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x74,0x00,0x02,0x01,0x01,0x02,
+0x27,0x03,0x02,0x02,0x01,0x01,0x4D,0x00,0x02,0x01,0x04,0x02,0x0B,0x03,0x05,0x02,
+0x02,0x01,0x7D,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,0x57,0x00,
+0x09,0x01,0x89,0x00,0x02,0x01,0x03,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0xF5,0x00,
+0x10,0x01,0x32,0x00,
 };
 static const DiffBlock STUN_FRAME6_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    16, 32,  // Changed box top-left
+    267, 77,  // Changed box dimensions
     STUN_FRAME6_DATA
 };
 
-// Frame 7: Full frame RLE (4126 bytes)
-static const uint8_t STUN_FRAME7_DATA[4126] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xB6,0x00,0x01,0x01,0x05,0x02,0x02,0x01,0xFF,0x00,0x36,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x31,0x00,0x01,0x02,0x10,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x2B,0x00,0x01,0x01,0x15,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x28,0x00,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x25,0x00,0x01,0x01,
-0x1B,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x23,0x00,0x01,0x02,0x1D,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x22,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x22,0x00,0x03,0x01,0x04,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x28,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x02,0x01,
-0x04,0x02,0x09,0x03,0x04,0x02,0x03,0x01,0xAC,0x00,0x01,0x01,0x02,0x02,0x13,0x03,
-0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,
-0xAA,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x02,0x01,
-0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0xAA,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
-0x01,0x02,0x59,0x00,0x02,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0xA9,0x00,
-0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,
-0x51,0x00,0x01,0x01,0x02,0x02,0x30,0x03,0x02,0x02,0x01,0x01,0x82,0x00,0x03,0x01,
-0x04,0x02,0x05,0x03,0x03,0x02,0x03,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x01,0x4F,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x7C,0x00,0x02,0x01,0x02,0x02,
-0x14,0x03,0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x77,0x00,0x01,0x01,
-0x01,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x49,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x0A,0x00,0x03,0x01,
-0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x47,0x00,
-0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0x14,0x00,0x02,0x01,0x02,0x02,0x11,0x03,
-0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
-0x0D,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x68,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x26,0x00,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
-0x64,0x00,0x01,0x02,0x14,0x03,0x03,0x02,0x0A,0x01,0x02,0x02,0x14,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,
-0x61,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x02,0x01,0x10,0x00,0x02,0x01,
-0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x11,0x00,0x01,0x01,
-0x03,0x02,0x07,0x03,0x03,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x18,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x39,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x17,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x5C,0x00,
-0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x5B,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x38,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x12,0x00,0x02,0x01,0x12,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x0B,0x00,0x01,0x01,0x21,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x59,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
-0x04,0x02,0x05,0x03,0x02,0x02,0x02,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x0B,0x00,0x01,0x02,0x23,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x57,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x25,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0F,0x03,0x02,0x02,0x07,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x56,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x17,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x02,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x08,0x00,0x01,0x01,0x04,0x02,0x0D,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x01,0x1C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
-0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,
-0x14,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x04,0x02,0x02,0x01,0x40,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x1E,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
+// Frame 7: Diff RLE (3766 bytes)
+static const uint8_t STUN_FRAME7_DATA[3766] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0x65,0x00,0x01,0x01,0x05,0x02,0x02,0x01,0xFB,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x02,0x02,0x02,0x01,0xF6,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x02,0x01,0xF0,0x00,
+0x01,0x01,0x15,0x03,0x02,0x02,0x01,0x01,0xED,0x00,0x01,0x02,0x19,0x03,0x01,0x02,
+0x01,0x01,0xEA,0x00,0x01,0x01,0x1B,0x03,0x02,0x02,0x01,0x01,0xE8,0x00,0x01,0x02,
+0x1D,0x03,0x01,0x02,0x01,0x01,0xE7,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,
+0x01,0x01,0xE7,0x00,0x03,0x01,0x04,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0xED,0x00,
+0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x02,0x01,0x04,0x02,
+0x09,0x03,0x04,0x02,0x03,0x01,0x72,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x01,0x02,
+0x01,0x01,0x62,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x70,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x02,0x01,0x01,0x02,
+0x20,0x03,0x02,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
+0x59,0x00,0x02,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,
+0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x51,0x00,
+0x01,0x01,0x02,0x02,0x30,0x03,0x02,0x02,0x01,0x01,0x48,0x00,0x03,0x01,0x04,0x02,
+0x05,0x03,0x03,0x02,0x03,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,
+0x4F,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x42,0x00,0x02,0x01,0x02,0x02,0x14,0x03,
+0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x4C,0x00,
+0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
+0x1D,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x49,0x00,
+0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x0A,0x00,0x03,0x01,0x02,0x02,
+0x14,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x47,0x00,0x01,0x02,
+0x13,0x03,0x01,0x02,0x02,0x01,0x14,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x02,
+0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x01,0x01,0x31,0x00,
+0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x22,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x2A,0x00,
+0x01,0x02,0x14,0x03,0x03,0x02,0x0A,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x27,0x00,
+0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x02,0x01,0x10,0x00,0x02,0x01,0x01,0x02,
+0x11,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x03,0x02,
+0x07,0x03,0x03,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x25,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x3B,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x01,0x0D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x22,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x21,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
+0x01,0x01,0x12,0x00,0x02,0x01,0x12,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x36,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x01,0x21,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x04,0x02,
+0x05,0x03,0x02,0x02,0x02,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x23,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x25,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x0F,0x03,0x02,0x02,0x07,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x17,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x33,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x02,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x33,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x01,0x04,0x02,0x0D,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x1C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,
+0x01,0x02,0x12,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x1C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x14,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x04,0x02,0x02,0x01,0x06,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x02,0x1E,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x01,0x02,0x14,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x07,0x03,0x01,0x02,0x05,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x1F,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
 0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x32,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x07,0x00,
-0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x07,0x03,0x01,0x02,0x3F,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x1F,0x03,0x01,0x01,0x08,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x32,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x07,0x00,0x01,0x02,0x15,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0A,0x03,0x01,0x01,0x3E,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x02,0x02,0x11,0x03,
-0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x3C,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x32,0x00,
-0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x08,0x00,0x01,0x01,0x13,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x07,0x00,0x01,0x02,0x15,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0A,0x03,0x01,0x01,0x04,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x02,0x02,0x11,0x03,0x01,0x01,
+0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x01,0x32,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x02,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x32,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
 0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x02,0x00,
-0x01,0x01,0x0E,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x33,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x07,0x00,0x06,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x02,0x02,
-0x04,0x03,0x02,0x02,0x02,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x34,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x14,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x34,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x35,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x1C,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x40,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0E,0x03,0x02,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x02,0x01,0x06,0x00,
-0x02,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x02,0x01,0x13,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,
-0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x12,0x03,0x03,0x02,0x15,0x03,0x01,0x02,
-0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,
-0x0C,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x43,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x39,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x13,0x03,0x03,0x02,0x04,0x01,0x04,0x02,
-0x13,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x43,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,
-0x25,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x3A,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x32,0x00,0x01,0x01,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x13,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,
+0x0E,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x32,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x03,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x04,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x33,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
 0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x45,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x22,0x03,
-0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x46,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
-0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,
-0x02,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x02,0x01,0x25,0x03,0x01,0x02,
-0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x49,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x0E,0x00,0x02,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x02,0x01,
-0x0F,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
-0x0F,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x10,0x00,0x02,0x01,0x02,0x02,0x09,0x03,0x03,0x02,0x02,0x01,
-0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,
-0x0F,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x14,0x00,0x06,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
-0x01,0x01,0x44,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x11,0x00,0x02,0x01,0x02,0x02,
-0x10,0x03,0x02,0x02,0x02,0x01,0x12,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,0x4E,0x00,
-0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x01,0x46,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x07,0x01,
-0x03,0x02,0x04,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x50,0x00,
-0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
-0x01,0x01,0x48,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,
-0x01,0x02,0x10,0x03,0x01,0x01,0x52,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,
-0x25,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,
-0x10,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x02,0x02,0x11,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
-0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x18,0x00,0x02,0x01,0x01,0x02,
-0x13,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x01,0x01,
-0x26,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x01,0x5A,0x00,0x01,0x01,0x16,0x03,
-0x02,0x02,0x03,0x01,0x0D,0x00,0x03,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x53,0x00,
-0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,0x02,0x01,0x01,0x02,
-0x13,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x04,0x02,
-0x1B,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x15,0x03,0x02,0x02,0x02,0x01,
-0x15,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x60,0x00,0x01,0x01,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x17,0x03,
-0x03,0x02,0x07,0x01,0x03,0x00,0x04,0x01,0x03,0x02,0x19,0x03,0x01,0x02,0x64,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,
-0x3F,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x6C,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,
-0x36,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,
-0x01,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0x76,0x00,
-0x02,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0x72,0x00,0x01,0x01,0x02,0x02,
-0x2A,0x03,0x01,0x02,0x02,0x01,0x7E,0x00,0x03,0x01,0x02,0x02,0x10,0x03,0x03,0x02,
-0x03,0x01,0x7B,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x8A,0x00,
-0x0C,0x01,0x85,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,
-0x27,0x00,0x04,0x01,0x0C,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x15,0x00,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x03,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x01,0x07,0x00,0x06,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x02,0x02,0x04,0x03,
+0x02,0x02,0x02,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x34,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x34,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x1E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x35,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x1C,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x06,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0E,0x03,
+0x02,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x0E,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x02,0x01,0x06,0x00,0x02,0x01,
+0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x37,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x02,0x01,0x13,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x12,0x03,0x03,0x02,0x15,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x0C,0x00,
+0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x13,0x03,0x03,0x02,0x04,0x01,0x04,0x02,0x13,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x25,0x03,
+0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x22,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x02,0x01,0x25,0x03,0x01,0x02,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x0E,0x00,0x02,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x02,0x01,0x0F,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x0E,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
+0x01,0x01,0x10,0x00,0x02,0x01,0x02,0x02,0x09,0x03,0x03,0x02,0x02,0x01,0x11,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
+0x01,0x01,0x0F,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x02,0x01,0x0F,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x14,0x00,0x06,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x44,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x11,0x00,0x02,0x01,0x02,0x02,0x10,0x03,
+0x02,0x02,0x02,0x01,0x12,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,
+0x46,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x07,0x01,0x03,0x02,
+0x04,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x16,0x00,0x01,0x01,
+0x10,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,
+0x48,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,
+0x10,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x25,0x00,
+0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x10,0x03,
+0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,
+0x01,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x18,0x00,0x02,0x01,0x01,0x02,0x13,0x03,
+0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x01,0x01,0x26,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x16,0x03,0x02,0x02,
+0x03,0x01,0x0D,0x00,0x03,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x53,0x00,0x01,0x01,
+0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,0x02,0x01,0x01,0x02,0x13,0x03,
+0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x04,0x02,0x1B,0x03,
+0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x15,0x00,
+0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x3A,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x03,0x02,
+0x07,0x01,0x03,0x00,0x04,0x01,0x03,0x02,0x19,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
+0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,
+0x02,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
+0x62,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
+0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,0x01,0x01,
+0x6C,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0x3C,0x00,0x02,0x01,
+0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0x72,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,
+0x01,0x02,0x02,0x01,0x44,0x00,0x03,0x01,0x02,0x02,0x10,0x03,0x03,0x02,0x03,0x01,
+0x7B,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x50,0x00,0x0C,0x01,
+0x85,0x00,0x02,0x01,0x03,0x02,0x17,0x03,0x03,0x02,0x02,0x01,0xEC,0x00,0x04,0x01,
+0x0C,0x02,0x03,0x01,0x32,0x00,
 };
 static const DiffBlock STUN_FRAME7_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    17, 37,  // Changed box top-left
+    262, 84,  // Changed box dimensions
     STUN_FRAME7_DATA
 };
 
-// Frame 8: Full frame RLE (4074 bytes)
-static const uint8_t STUN_FRAME8_DATA[4074] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA1,0x00,0x03,0x01,
-0xFF,0x00,0x3B,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x37,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x0E,0x01,
-0xB9,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x03,0x02,
-0x10,0x03,0x03,0x02,0x01,0x01,0xB4,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x5F,0x00,0x01,0x01,0x03,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xAF,0x00,0x01,0x01,
-0x0F,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,
-0xAD,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,
-0x2A,0x03,0x01,0x02,0x01,0x01,0xAB,0x00,0x01,0x02,0x10,0x03,0x01,0x01,0x53,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x02,0x02,0x8D,0x00,0x02,0x01,0x1B,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x01,
-0x81,0x00,0x03,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x02,0x01,0x14,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x38,0x03,0x01,0x02,
-0x01,0x01,0x79,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0x12,0x00,
-0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x17,0x03,
-0x0C,0x02,0x18,0x03,0x01,0x01,0x75,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,
-0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x46,0x00,
-0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0x0E,0x00,0x02,0x01,0x02,0x02,
-0x14,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
-0x01,0x01,0x0F,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x12,0x03,
-0x02,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x02,0x02,
-0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x24,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x67,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,
-0x0F,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x65,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x01,0x3C,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x0A,0x02,0x15,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x0A,0x01,0x12,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,
-0x03,0x01,0x0D,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
-0x02,0x02,0x0B,0x03,0x03,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x02,0x01,0x16,0x00,0x02,0x01,
-0x01,0x02,0x10,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x37,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x02,0x02,
-0x13,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x37,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x18,0x03,
-0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x10,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x0C,0x00,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,
-0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x33,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
-0x01,0x01,0x0F,0x03,0x01,0x01,0x11,0x00,0x04,0x01,0x12,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x33,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x23,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x02,0x01,0x02,0x02,0x08,0x03,0x01,0x02,0x02,0x01,
-0x0E,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x32,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x55,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x02,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x02,0x11,0x03,0x06,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0E,0x03,0x02,0x02,0x02,0x01,0x07,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x53,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x18,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x30,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x10,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x52,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x1D,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x0B,0x00,0x06,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x52,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x02,0x01,0x01,0x02,0x06,0x03,0x03,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x20,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
-0x16,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x51,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x21,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x2D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x08,0x00,0x01,0x01,0x18,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x51,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x2D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x08,0x00,0x01,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
-0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x2D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x12,0x03,
+// Frame 8: Diff RLE (3726 bytes)
+static const uint8_t STUN_FRAME8_DATA[3726] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0x81,0x00,0x03,0x01,0xFE,0x00,0x01,0x01,0x01,0x02,
+0x05,0x03,0x01,0x02,0x01,0x01,0xFA,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x02,
+0x01,0x01,0x6D,0x00,0x0E,0x01,0x7D,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x66,0x00,0x01,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x01,0x01,0x78,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x03,0x02,0x1A,0x03,0x02,0x02,
+0x02,0x01,0x73,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x5B,0x00,0x01,0x01,0x01,0x02,
+0x24,0x03,0x01,0x02,0x01,0x01,0x71,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x56,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x01,0x02,
+0x10,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x02,0x02,0x51,0x00,
+0x02,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x4F,0x00,0x01,0x01,
+0x01,0x02,0x34,0x03,0x01,0x01,0x45,0x00,0x03,0x01,0x03,0x02,0x09,0x03,0x04,0x02,
+0x02,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
+0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x02,0x01,0x02,0x02,0x16,0x03,
+0x02,0x02,0x02,0x01,0x12,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
+0x01,0x01,0x01,0x02,0x17,0x03,0x0C,0x02,0x18,0x03,0x01,0x01,0x39,0x00,0x02,0x01,
+0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,0x02,0x01,
+0x0E,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x44,0x00,0x01,0x01,0x12,0x03,0x02,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x02,0x02,
+0x11,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
+0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x2B,0x00,
+0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x3E,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x3C,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,
+0x19,0x03,0x0A,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x12,0x00,
+0x0A,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x01,0x02,0x14,0x03,0x01,0x02,0x03,0x01,0x0D,0x00,0x02,0x01,0x02,0x02,0x12,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x02,0x02,0x0B,0x03,0x03,0x02,0x02,0x01,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x12,0x03,0x01,0x02,
+0x02,0x01,0x16,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x02,0x11,0x03,0x01,0x02,
+0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x35,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x24,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x33,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,0x11,0x00,0x04,0x01,
+0x12,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x23,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x1A,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x02,0x01,0x02,0x02,
+0x08,0x03,0x01,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x0C,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x11,0x03,0x06,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x30,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0E,0x03,0x02,0x02,
+0x02,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x01,0x18,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x30,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x17,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x2E,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x1D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x06,0x01,0x01,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x16,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x2E,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x09,0x00,0x02,0x01,0x01,0x02,0x06,0x03,0x03,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x20,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x15,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x21,0x03,
 0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x03,0x00,0x01,0x01,
-0x01,0x02,0x11,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x08,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x16,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x03,0x00,0x01,0x01,
-0x01,0x02,0x11,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x15,0x03,
-0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x10,0x03,
-0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x06,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x09,0x00,
-0x01,0x02,0x0D,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x2E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x01,0x02,0x02,0x05,0x03,0x02,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
-0x02,0x01,0x08,0x02,0x02,0x01,0x0E,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x53,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x0C,0x00,0x03,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x54,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x08,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x56,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x12,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x31,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x02,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x57,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x02,0x01,
-0x0B,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x33,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x58,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x12,0x03,0x03,0x02,
-0x03,0x01,0x03,0x02,0x15,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,
-0x33,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x10,0x03,0x01,0x02,
-0x02,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x0B,0x00,0x01,0x01,0x13,0x03,0x02,0x02,0x0B,0x01,0x02,0x02,0x12,0x03,0x01,0x01,
-0x0D,0x00,0x05,0x01,0x49,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
-0x2C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x35,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x30,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x02,0x01,0x01,
-0x47,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x25,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x39,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x01,
-0x0E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
-0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x0E,0x00,0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
-0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
-0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,
-0x02,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x10,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
-0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0x10,0x00,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x10,0x00,0x02,0x01,
-0x02,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
-0x01,0x01,0x3F,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x11,0x00,0x02,0x01,0x01,0x02,
-0x14,0x03,0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x04,0x01,0x07,0x02,
-0x03,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x41,0x00,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x03,0x01,0x0C,0x02,0x04,0x01,0x13,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
-0x43,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x28,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,
-0x0F,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
-0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x24,0x00,
-0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x02,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x55,0x00,
-0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x1D,0x00,0x02,0x01,0x01,0x02,
-0x16,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
-0x28,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x02,0x02,0x02,0x01,0x15,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x13,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x02,0x01,
-0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x16,0x03,
-0x03,0x02,0x0E,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,
-0x14,0x03,0x02,0x02,0x01,0x01,0x1A,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x53,0x00,
-0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x04,0x01,0x0C,0x00,0x03,0x01,0x02,0x02,
-0x17,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x01,0x01,
-0x56,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x0B,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,
-0x66,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x33,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,
-0x34,0x03,0x02,0x02,0x01,0x01,0x72,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,0x01,0x02,0x02,0x01,0x78,0x00,
-0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x02,0x01,0x6F,0x00,0x01,0x01,0x02,0x02,
-0x27,0x03,0x02,0x02,0x02,0x01,0x7E,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x02,0x02,
-0x02,0x01,0x77,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,0x88,0x00,
-0x03,0x01,0x0E,0x02,0x03,0x01,0x82,0x00,0x03,0x01,0x03,0x02,0x11,0x03,0x04,0x02,
-0x02,0x01,0xFF,0x00,0x2C,0x00,0x0E,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0B,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x18,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x17,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,
+0x11,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x08,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,
+0x01,0x02,0x17,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x14,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x12,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,
+0x01,0x02,0x17,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x14,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x03,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x08,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
+0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x14,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x03,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x02,0x15,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x15,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x08,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x07,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x16,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x07,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x08,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x16,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x02,0x02,0x05,0x03,0x02,0x02,0x01,0x01,
+0x08,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x02,0x01,0x08,0x02,0x02,0x01,0x0E,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x0C,0x00,0x03,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x23,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x30,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x21,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,
+0x10,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x31,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
+0x0E,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x02,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x01,0x1B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0F,0x03,0x01,0x02,0x02,0x01,0x0B,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,
+0x09,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x12,0x03,0x03,0x02,0x03,0x01,0x03,0x02,0x15,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x0E,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x10,0x03,0x01,0x02,0x02,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
+0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x2E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x35,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x13,0x03,0x02,0x02,0x0B,0x01,
+0x02,0x02,0x12,0x03,0x01,0x01,0x0D,0x00,0x05,0x01,0x0D,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x2C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x01,0x02,0x05,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0F,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x08,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x0F,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,
+0x01,0x02,0x2A,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x26,0x03,0x02,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x02,0x01,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,
+0x10,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x10,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x11,0x00,0x02,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x13,0x00,0x04,0x01,0x07,0x02,0x03,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x01,0x41,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x03,0x01,
+0x0C,0x02,0x04,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x12,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
+0x11,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x36,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,
+0x01,0x01,0x45,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,
+0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
+0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
+0x11,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,
+0x1D,0x00,0x02,0x01,0x01,0x02,0x16,0x03,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,
+0x11,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x01,0x01,
+0x1C,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x15,0x00,0x02,0x01,
+0x02,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x01,0x13,0x03,0x01,0x02,
+0x01,0x01,0x22,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,
+0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x0E,0x01,0x02,0x02,0x1B,0x03,0x01,0x01,
+0x50,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0x1A,0x00,0x02,0x01,
+0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
+0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x04,0x01,
+0x0C,0x00,0x03,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,
+0x3D,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x0B,0x02,
+0x1A,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
+0x5A,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x02,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x02,0x02,0x39,0x03,
+0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,
+0x64,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x02,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
+0x02,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x02,0x02,0x2E,0x03,
+0x01,0x02,0x02,0x01,0x3C,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x02,0x01,
+0x6F,0x00,0x01,0x01,0x02,0x02,0x27,0x03,0x02,0x02,0x02,0x01,0x42,0x00,0x02,0x01,
+0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0x77,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,
+0x02,0x02,0x02,0x01,0x4C,0x00,0x03,0x01,0x0E,0x02,0x03,0x01,0x82,0x00,0x03,0x01,
+0x03,0x02,0x11,0x03,0x04,0x02,0x02,0x01,0xEF,0x00,0x0E,0x01,0x30,0x00,
 };
 static const DiffBlock STUN_FRAME8_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    17, 45,  // Changed box top-left
+    260, 84,  // Changed box dimensions
     STUN_FRAME8_DATA
 };
 
-// Frame 9: Full frame RLE (4080 bytes)
-static const uint8_t STUN_FRAME9_DATA[4080] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA3,0x00,0x03,0x01,
-0x04,0x02,0x07,0x03,0x05,0x02,0x03,0x01,0xFF,0x00,0x26,0x00,0x02,0x01,0x02,0x02,
-0x18,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1D,0x00,0x02,0x01,0x01,0x02,0x22,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x11,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x0B,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x80,0x00,
-0x03,0x01,0x03,0x02,0x04,0x03,0x08,0x02,0x02,0x01,0x72,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x03,0x02,
-0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x03,0x02,0x1B,0x03,0x01,0x02,
-0x01,0x01,0x74,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,0x67,0x00,
-0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x0A,0x00,0x02,0x01,0x03,0x02,0x15,0x03,
-0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,
-0x62,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0x16,0x00,0x02,0x01,
-0x02,0x02,0x12,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,
-0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x01,0x02,
-0x2F,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
-0x02,0x01,0x22,0x00,0x02,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
-0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x10,0x03,
-0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x63,0x00,
-0x01,0x02,0x37,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x2C,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x01,0x02,
-0x15,0x03,0x02,0x02,0x06,0x01,0x02,0x00,0x05,0x01,0x02,0x02,0x13,0x03,0x01,0x02,
-0x01,0x01,0x53,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x01,0x5E,0x00,0x01,0x01,0x13,0x03,0x01,0x02,0x02,0x01,
-0x13,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x06,0x02,0x04,0x03,0x02,0x02,0x02,0x01,
-0x11,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,
-0x12,0x00,0x02,0x01,0x02,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x01,0x0F,0x00,0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,
-0x1E,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x01,0x02,
-0x06,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x0E,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x22,0x00,
-0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x09,0x03,0x01,0x02,
-0x34,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x1D,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x56,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x02,0x0C,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x32,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x21,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x53,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,0x03,0x02,
-0x05,0x03,0x03,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x2E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x13,0x03,0x04,0x02,0x12,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x51,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x16,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x0B,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x06,0x00,0x02,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x50,0x00,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,
-0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x2D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x2D,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x1F,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x13,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x16,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x2B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x02,0x01,0x02,0x02,0x01,0x03,0x03,0x02,0x01,0x01,
-0x04,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0F,0x03,
-0x02,0x02,0x04,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x03,0x00,0x01,0x01,0x02,0x02,0x10,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x02,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x03,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x04,0x00,
-0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x1C,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x05,0x00,
-0x01,0x02,0x14,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x15,0x03,
-0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x2A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x14,0x03,0x01,0x02,
+// Frame 9: Diff RLE (3716 bytes)
+static const uint8_t STUN_FRAME9_DATA[3716] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB6,0x00,0x03,0x01,
+0x04,0x02,0x07,0x03,0x05,0x02,0x03,0x01,0xE2,0x00,0x02,0x01,0x02,0x02,0x18,0x03,
+0x02,0x02,0x02,0x01,0xD9,0x00,0x02,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,
+0xD2,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0xCD,0x00,0x01,0x01,
+0x01,0x02,0x2E,0x03,0x02,0x02,0x01,0x01,0xC7,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
+0x01,0x02,0x01,0x01,0x3D,0x00,0x03,0x01,0x03,0x02,0x04,0x03,0x08,0x02,0x02,0x01,
+0x72,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x02,0x01,
+0x02,0x02,0x16,0x03,0x03,0x02,0x01,0x01,0x6B,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,
+0x03,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,
+0x02,0x02,0x01,0x01,0x67,0x00,0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x0A,0x00,
+0x02,0x01,0x03,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
+0x25,0x03,0x02,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,
+0x02,0x01,0x16,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x29,0x00,0x01,0x01,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x12,0x03,
+0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
+0x25,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
+0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x22,0x00,0x02,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
+0x58,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x37,0x03,0x01,0x02,0x56,0x00,0x01,0x01,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x1D,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x02,0x02,0x06,0x01,0x02,0x00,0x05,0x01,
+0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x13,0x03,0x01,0x02,0x02,0x01,0x13,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x01,
+0x51,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x06,0x02,
+0x04,0x03,0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x18,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,
+0x01,0x02,0x10,0x03,0x01,0x01,0x12,0x00,0x02,0x01,0x02,0x02,0x01,0x01,0x38,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x02,0x02,0x12,0x03,
+0x02,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x17,0x00,0x01,0x01,
+0x11,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
+0x0F,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x10,0x03,
+0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0D,0x00,
+0x01,0x01,0x09,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0D,0x00,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x26,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x32,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x21,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x11,0x00,
+0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x0F,0x00,0x02,0x01,0x03,0x02,0x05,0x03,0x03,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x26,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x02,0x01,0x02,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x13,0x03,0x04,0x02,0x12,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x10,0x03,0x01,0x02,
+0x02,0x01,0x06,0x00,0x02,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x19,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x1F,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x16,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x02,0x01,0x02,0x02,
+0x01,0x03,0x03,0x02,0x01,0x01,0x04,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0F,0x03,0x02,0x02,0x04,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
 0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x2A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x13,0x03,0x01,0x02,0x01,0x01,
-0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x1A,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
-0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x12,0x03,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x2B,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x18,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x10,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x2B,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x08,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x02,0x02,0x06,0x03,
-0x02,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x0E,0x00,0x04,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x02,0x01,0x02,0x02,
-0x06,0x03,0x02,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x4F,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,
-0x1C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x04,0x01,0x12,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x08,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x2F,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x52,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x02,0x01,0x12,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x30,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,
-0x1A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x12,0x03,0x04,0x02,0x05,0x01,0x02,0x02,
-0x13,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x32,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x10,0x03,0x01,0x02,
-0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,0x02,0x01,
-0x0A,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x15,0x03,0x08,0x02,0x17,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x36,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x37,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x0D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x61,0x00,
-0x01,0x01,0x0E,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,
-0x01,0x01,0x0E,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x10,0x00,0x02,0x01,0x02,0x02,
-0x12,0x03,0x02,0x02,0x02,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x3C,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x0F,0x00,0x02,0x01,0x01,0x02,
-0x1E,0x03,0x02,0x02,0x01,0x01,0x68,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,
-0x13,0x00,0x02,0x01,0x0C,0x02,0x02,0x01,0x13,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x3E,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x02,0x01,
-0x02,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,
-0x33,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x02,0x01,0x03,0x02,0x0B,0x03,0x02,0x02,
-0x02,0x01,0x72,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x1A,0x00,0x05,0x01,0x7A,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
-0x2B,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
-0x01,0x02,0x02,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x48,0x00,
-0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x97,0x00,0x01,0x01,0x01,0x02,0x12,0x03,
-0x01,0x02,0x02,0x01,0x1E,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x97,0x00,0x01,0x01,
-0x01,0x02,0x13,0x03,0x02,0x02,0x03,0x01,0x15,0x00,0x02,0x01,0x02,0x02,0x15,0x03,
-0x01,0x02,0x4E,0x00,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x01,
-0x17,0x03,0x04,0x02,0x05,0x01,0x05,0x00,0x04,0x01,0x02,0x02,0x19,0x03,0x01,0x01,
-0x50,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x1F,0x00,0x04,0x01,
-0x70,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x02,0x01,0x52,0x00,0x01,0x01,
-0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x14,0x00,0x02,0x01,0x02,0x02,0x05,0x03,
-0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x57,0x00,
-0x01,0x01,0x01,0x02,0x1A,0x03,0x06,0x02,0x07,0x01,0x05,0x02,0x0C,0x03,0x01,0x02,
-0x71,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x37,0x03,0x01,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
-0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x75,0x00,0x02,0x01,
-0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x01,0x78,0x00,0x02,0x01,0x02,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x6A,0x00,
-0x02,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x7C,0x00,0x02,0x01,0x02,0x02,
-0x1C,0x03,0x02,0x02,0x02,0x01,0x71,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x01,0x02,
-0x83,0x00,0x02,0x01,0x05,0x02,0x0D,0x03,0x04,0x02,0x02,0x01,0x79,0x00,0x01,0x01,
-0x02,0x02,0x21,0x03,0x03,0x02,0x01,0x01,0x8F,0x00,0x08,0x01,0x85,0x00,0x03,0x01,
-0x04,0x02,0x13,0x03,0x03,0x02,0x03,0x01,0xFF,0x00,0x2A,0x00,0x10,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x78,0x00,
-
+0x2A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,
+0x02,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,0x02,0x02,0x10,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x02,0x01,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x03,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x1C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x14,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x1C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x05,0x00,0x01,0x01,0x15,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
+0x1B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x05,0x00,
+0x01,0x01,0x14,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x05,0x00,0x01,0x01,
+0x13,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x1A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x06,0x00,
+0x01,0x02,0x12,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x18,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
+0x10,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,
+0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x02,0x02,0x06,0x03,0x02,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x2C,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0E,0x00,0x04,0x01,0x0D,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x2D,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x0C,0x00,0x02,0x01,0x02,0x02,0x06,0x03,0x02,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
+0x01,0x01,0x0D,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x10,0x00,
+0x04,0x01,0x12,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x23,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x17,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x02,0x02,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x01,0x0F,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x12,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x12,0x03,
+0x04,0x02,0x05,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x13,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
+0x2E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x32,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x11,0x03,0x02,0x02,0x02,0x01,0x0A,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,
+0x15,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x2B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x34,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x15,0x03,
+0x08,0x02,0x17,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x36,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x31,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
+0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x01,0x02,0x1A,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x10,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x0F,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,
+0x0F,0x00,0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,0x25,0x00,0x01,0x01,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x02,0x01,0x0C,0x02,0x02,0x01,0x13,0x00,
+0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x10,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x29,0x00,
+0x01,0x01,0x0F,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x40,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x02,0x01,
+0x03,0x02,0x0B,0x03,0x02,0x02,0x02,0x01,0x2F,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x43,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x05,0x01,0x37,0x00,0x01,0x02,
+0x10,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
+0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x25,0x00,0x01,0x01,0x01,0x02,
+0x12,0x03,0x01,0x02,0x48,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0x1E,0x00,0x02,0x01,0x02,0x02,
+0x12,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x03,0x01,0x15,0x00,
+0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x4E,0x00,0x01,0x02,0x12,0x03,0x01,0x02,
+0x01,0x01,0x53,0x00,0x01,0x01,0x17,0x03,0x04,0x02,0x05,0x01,0x05,0x00,0x04,0x01,
+0x02,0x02,0x19,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,
+0x02,0x01,0x1F,0x00,0x04,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
+0x02,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x14,0x00,
+0x02,0x01,0x02,0x02,0x05,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x06,0x02,0x07,0x01,
+0x05,0x02,0x0C,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,
+0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x01,0x30,0x00,0x01,0x01,
+0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
+0x01,0x02,0x32,0x00,0x02,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
+0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,0x35,0x00,0x02,0x01,0x02,0x02,0x24,0x03,
+0x02,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x39,0x00,0x02,0x01,0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x71,0x00,0x01,0x01,
+0x02,0x02,0x29,0x03,0x01,0x02,0x40,0x00,0x02,0x01,0x05,0x02,0x0D,0x03,0x04,0x02,
+0x02,0x01,0x79,0x00,0x01,0x01,0x02,0x02,0x21,0x03,0x03,0x02,0x01,0x01,0x4C,0x00,
+0x08,0x01,0x85,0x00,0x03,0x01,0x04,0x02,0x13,0x03,0x03,0x02,0x03,0x01,0xE6,0x00,
+0x10,0x01,0x20,0x00,
 };
 static const DiffBlock STUN_FRAME9_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    19, 56,  // Changed box top-left
+    253, 79,  // Changed box dimensions
     STUN_FRAME9_DATA
 };
 
-// Frame 10: Full frame RLE (4144 bytes)
-static const uint8_t STUN_FRAME10_DATA[4144] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA8,0x00,0x04,0x01,
-0x07,0x02,0x06,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,0x25,0x00,0x02,0x01,0x01,0x02,
-0x1A,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x1C,0x00,0x01,0x01,0x02,0x02,0x23,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x14,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x0E,0x00,0x01,0x01,0x02,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
-0x88,0x00,0x05,0x01,0x7C,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,
-0x7F,0x00,0x03,0x01,0x03,0x02,0x08,0x03,0x05,0x02,0x02,0x01,0x71,0x00,0x01,0x01,
-0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x78,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
-0x03,0x02,0x02,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x06,0x02,0x1B,0x03,
-0x01,0x02,0x01,0x01,0x73,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,
-0x64,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x0B,0x00,0x03,0x01,
-0x01,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x6E,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
-0x02,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,
-0x16,0x00,0x03,0x01,0x02,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x11,0x03,0x02,0x02,
-0x01,0x01,0x1F,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x67,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
-0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
-0x63,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x02,0x1B,0x03,0x03,0x02,0x1B,0x03,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x14,0x03,
-0x02,0x02,0x04,0x01,0x08,0x00,0x03,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x06,0x01,0x14,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,
-0x11,0x03,0x02,0x02,0x02,0x01,0x14,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x04,0x02,0x08,0x03,
-0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x59,0x00,
-0x01,0x01,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x1B,0x00,0x02,0x01,0x01,0x02,
-0x10,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,
-0x01,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x58,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x25,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
-0x0D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x02,0x0F,0x03,
-0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x46,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x03,0x01,0x05,0x02,0x02,0x03,0x05,0x02,
-0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x02,0x02,
-0x11,0x03,0x02,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x44,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x14,0x03,0x05,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x4F,0x00,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x0C,0x00,0x02,0x01,0x01,0x02,0x17,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x02,0x01,
-0x07,0x00,0x01,0x01,0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,
-0x1C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x42,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x0E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x02,0x20,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x40,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,
-0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x04,0x02,0x01,0x01,
-0x07,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x07,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x08,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x02,0x02,0x06,0x03,
-0x02,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x08,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x02,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0E,0x00,
-0x04,0x01,0x2C,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,
+// Frame 10: Diff RLE (3772 bytes)
+static const uint8_t STUN_FRAME10_DATA[3772] = {
+0xC1,0x00,0x04,0x01,0x07,0x02,0x06,0x03,0x04,0x02,0x03,0x01,0xE2,0x00,0x02,0x01,
+0x01,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xD9,0x00,0x01,0x01,0x02,0x02,0x23,0x03,
+0x02,0x02,0x02,0x01,0xD1,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x02,0x01,
+0xCB,0x00,0x01,0x01,0x02,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x05,0x01,
+0x7C,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x03,0x01,
+0x03,0x02,0x08,0x03,0x05,0x02,0x02,0x01,0x71,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
+0x01,0x02,0x01,0x01,0x36,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x03,0x02,0x02,0x01,
+0x69,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x06,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,
+0x31,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,0x64,0x00,0x01,0x01,
+0x01,0x02,0x16,0x03,0x02,0x02,0x03,0x01,0x0B,0x00,0x03,0x01,0x01,0x02,0x17,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x02,0x02,0x01,0x01,
+0x60,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0x16,0x00,0x03,0x01,
+0x02,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
+0x01,0x02,0x01,0x01,0x5D,0x00,0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
+0x25,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
+0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x1F,0x00,0x01,0x02,0x1B,0x03,0x03,0x02,0x1B,0x03,0x01,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x04,0x01,
+0x08,0x00,0x03,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x06,0x01,0x14,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x02,0x02,
+0x02,0x01,0x14,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
+0x0E,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x04,0x02,0x08,0x03,0x02,0x02,0x02,0x01,
+0x11,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x01,0x01,0x01,0x02,
+0x10,0x03,0x02,0x02,0x01,0x01,0x1B,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x01,
+0x4D,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x02,0x02,
+0x12,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x16,0x00,
+0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x01,0x14,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,
+0x0F,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x28,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x0F,0x00,0x03,0x01,0x05,0x02,0x02,0x03,0x05,0x02,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x02,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x44,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x14,0x03,0x05,0x02,0x11,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x0C,0x00,0x02,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x02,0x01,0x07,0x00,0x01,0x01,
+0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x1C,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x20,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x12,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x40,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x40,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x04,0x02,0x01,0x01,0x07,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x07,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x3E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x02,0x02,0x06,0x03,0x02,0x02,0x01,0x01,
+0x04,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0E,0x00,0x04,0x01,0x2C,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x06,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x02,0x00,
 0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x49,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x08,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x05,0x03,0x01,0x02,
-0x01,0x01,0x2A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x02,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x14,0x03,0x01,0x02,
-0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x08,0x03,
-0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x09,0x03,0x01,0x02,0x28,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x06,0x00,
-0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x08,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x16,0x03,
-0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x27,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x1E,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x06,0x00,
-0x01,0x02,0x15,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x06,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x01,0x28,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x06,0x00,0x01,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x02,0x09,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0F,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x01,0x02,
+0x15,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
 0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x1D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x48,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x06,0x00,0x01,0x02,0x15,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x02,0x1C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x06,0x00,0x01,0x01,0x14,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x28,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x49,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x12,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x29,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x19,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x07,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x29,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x01,0x16,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,
-0x08,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x02,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x0B,0x00,0x03,0x01,0x03,0x02,0x03,0x01,0x0D,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x29,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x0C,0x00,0x02,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,0x01,0x01,0x0D,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0D,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
-0x03,0x01,0x07,0x02,0x02,0x01,0x0F,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x02,
-0x0E,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x02,0x01,0x10,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x0B,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,
-0x01,0x02,0x11,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x2E,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x1D,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,
-0x09,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,
-0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x08,0x02,0x15,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x0C,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x03,0x01,0x10,0x00,0x02,0x01,0x02,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0B,0x00,
-0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,
-0x13,0x03,0x02,0x02,0x0C,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x57,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x32,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x33,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x0C,0x00,
-0x01,0x02,0x28,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x34,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x30,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x0C,0x00,
-0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x36,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
-0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x0D,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x0E,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x18,0x03,
-0x01,0x02,0x02,0x01,0x0F,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,0x02,0x01,0x01,0x02,0x23,0x03,0x01,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x11,0x00,
-0x02,0x01,0x02,0x02,0x0D,0x03,0x02,0x02,0x02,0x01,0x12,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x10,0x00,0x02,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x67,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x17,0x00,0x08,0x01,0x17,0x00,0x01,0x01,
-0x0F,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
-0x13,0x00,0x02,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x6D,0x00,0x01,0x02,
-0x0F,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
-0x3F,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x04,0x01,
-0x0B,0x02,0x03,0x01,0x73,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x99,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x02,0x01,
-0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x10,0x03,0x01,0x02,
-0x01,0x01,0x98,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x22,0x00,
-0x02,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
-0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0x1C,0x00,
-0x02,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,
-0x02,0x01,0x13,0x00,0x03,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x18,0x03,
-0x04,0x02,0x0B,0x01,0x03,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,
-0x15,0x03,0x02,0x02,0x02,0x01,0x91,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x02,0x01,0x8E,0x00,
-0x01,0x01,0x02,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x1E,0x03,0x03,0x02,0x01,0x01,0x88,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x89,0x00,0x01,0x01,
-0x02,0x02,0x30,0x03,0x01,0x02,0x02,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
-0x01,0x02,0x8B,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x01,0x01,0x02,0x02,0x1D,0x03,0x01,0x01,0x8D,0x00,0x02,0x01,0x02,0x02,0x20,0x03,
-0x03,0x02,0x02,0x01,0x6C,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x01,0x01,0x92,0x00,
-0x02,0x01,0x04,0x02,0x13,0x03,0x04,0x02,0x02,0x01,0x74,0x00,0x02,0x01,0x01,0x02,
-0x16,0x03,0x01,0x02,0x01,0x01,0x99,0x00,0x04,0x01,0x09,0x02,0x04,0x01,0x7F,0x00,
-0x02,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x31,0x00,0x03,0x01,
-0x02,0x02,0x01,0x03,0x01,0x02,0x01,0x03,0x02,0x02,0x02,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x37,0x00,
-
+0x10,0x03,0x01,0x02,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x16,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x27,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x1E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x02,0x15,0x03,
+0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x06,0x00,
+0x01,0x02,0x15,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x1C,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x06,0x00,
+0x01,0x01,0x14,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x1A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x07,0x00,0x01,0x02,0x12,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,
+0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x19,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x16,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x02,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x12,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x0B,0x00,0x03,0x01,0x03,0x02,0x03,0x01,0x0D,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0C,0x00,
+0x02,0x01,0x01,0x02,0x0C,0x03,0x02,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x03,0x01,0x07,0x02,
+0x02,0x01,0x0F,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x1C,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x19,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x02,0x01,0x10,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,0x09,0x00,0x02,0x01,
+0x01,0x02,0x13,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x2F,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
+0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x14,0x03,0x08,0x02,0x15,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x10,0x03,0x01,0x02,0x03,0x01,0x10,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x02,
+0x01,0x01,0x13,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x2E,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x31,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x13,0x03,0x02,0x02,
+0x0C,0x01,0x02,0x02,0x14,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,
+0x01,0x01,0x17,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x28,0x03,
+0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x34,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x24,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
+0x36,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x2D,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x0D,0x00,
+0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x38,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,
+0x0F,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x0F,0x00,0x02,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x22,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x02,0x02,
+0x0D,0x03,0x02,0x02,0x02,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,
+0x02,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x02,0x01,0x25,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x17,0x00,0x08,0x01,0x17,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x3C,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x13,0x00,0x02,0x01,
+0x01,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x2B,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x15,0x00,0x04,0x01,0x0B,0x02,0x03,0x01,
+0x31,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
+0x11,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x57,0x00,
+0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x02,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x02,0x01,0x01,0x02,
+0x13,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
+0x56,0x00,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0x1C,0x00,0x02,0x01,0x01,0x02,
+0x14,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,
+0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x02,0x01,0x13,0x00,
+0x03,0x01,0x01,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,
+0x12,0x03,0x02,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x18,0x03,0x04,0x02,0x0B,0x01,
+0x03,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x15,0x03,0x02,0x02,
+0x02,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x02,0x01,0x4C,0x00,0x01,0x01,0x02,0x02,
+0x3A,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x03,0x02,
+0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
+0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x47,0x00,0x01,0x01,0x02,0x02,0x30,0x03,
+0x01,0x02,0x02,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x49,0x00,
+0x01,0x01,0x02,0x02,0x29,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x01,0x01,0x02,0x02,
+0x1D,0x03,0x01,0x01,0x4B,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x03,0x02,0x02,0x01,
+0x6C,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x01,0x01,0x50,0x00,0x02,0x01,0x04,0x02,
+0x13,0x03,0x04,0x02,0x02,0x01,0x74,0x00,0x02,0x01,0x01,0x02,0x16,0x03,0x01,0x02,
+0x01,0x01,0x57,0x00,0x04,0x01,0x09,0x02,0x04,0x01,0x7F,0x00,0x02,0x01,0x02,0x02,
+0x10,0x03,0x01,0x02,0x01,0x01,0xEE,0x00,0x03,0x01,0x02,0x02,0x01,0x03,0x01,0x02,
+0x01,0x03,0x02,0x02,0x02,0x03,0x01,0x02,0x02,0x01,0x27,0x00,
 };
 static const DiffBlock STUN_FRAME10_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    25, 62,  // Changed box top-left
+    254, 74,  // Changed box dimensions
     STUN_FRAME10_DATA
 };
 
-// Frame 11: Full frame RLE (4096 bytes)
-static const uint8_t STUN_FRAME11_DATA[4096] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x33,0x00,
-0x05,0x01,0x07,0x02,0x05,0x01,0xFF,0x00,0x29,0x00,0x02,0x01,0x03,0x02,0x14,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x1F,0x00,0x02,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x17,0x00,0x01,0x01,0x02,0x02,0x27,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x12,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8F,0x00,
-0x02,0x01,0x7B,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x80,0x00,
-0x03,0x01,0x04,0x02,0x08,0x03,0x05,0x02,0x03,0x01,0x6F,0x00,0x02,0x01,0x01,0x02,
-0x37,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,
-0x02,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x74,0x00,
-0x01,0x01,0x02,0x02,0x21,0x03,0x01,0x02,0x02,0x01,0x63,0x00,0x01,0x01,0x01,0x02,
-0x18,0x03,0x03,0x02,0x0A,0x01,0x03,0x02,0x18,0x03,0x01,0x01,0x6F,0x00,0x02,0x01,
-0x01,0x02,0x28,0x03,0x02,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x14,0x03,
-0x02,0x02,0x03,0x01,0x12,0x00,0x02,0x01,0x03,0x02,0x13,0x03,0x01,0x02,0x01,0x01,
-0x6B,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x13,0x03,0x01,0x02,0x02,0x01,0x1C,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,
-0x68,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
-0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
-0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,
-0x10,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x52,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,
-0x0F,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x0A,0x01,
-0x03,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x02,0x02,
-0x15,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
-0x14,0x00,0x05,0x01,0x05,0x02,0x03,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,
-0x19,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x01,0x11,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,
-0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x57,0x00,0x01,0x01,
-0x11,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
-0x01,0x01,0x02,0x02,0x17,0x03,0x01,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x55,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,
-0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x0E,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x28,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
-0x0E,0x00,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x01,0x51,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x08,0x01,
-0x11,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x10,0x00,0x02,0x01,0x02,0x02,0x0A,0x03,0x02,0x02,0x02,0x01,0x0D,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x4E,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x0F,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,
-0x0E,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,
-0x2B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x4C,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,
-0x01,0x01,0x0B,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x12,0x03,0x02,0x02,0x06,0x01,0x02,0x02,
-0x12,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x4B,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,
-0x02,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x3C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x0B,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x47,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x27,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x46,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x02,0x02,0x03,0x01,0x04,0x02,0x11,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x0E,0x00,0x04,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x46,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x06,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x38,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x0B,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x11,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x06,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x45,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x05,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x44,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x02,
+// Frame 11: Diff RLE (3726 bytes)
+static const uint8_t STUN_FRAME11_DATA[3726] = {
+0xCE,0x00,0x05,0x01,0x07,0x02,0x05,0x01,0xEF,0x00,0x02,0x01,0x03,0x02,0x14,0x03,
+0x02,0x02,0x02,0x01,0xE5,0x00,0x02,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x02,0x01,
+0xDD,0x00,0x01,0x01,0x02,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0xD8,0x00,0x01,0x01,
+0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x02,0x01,0x7B,0x00,0x01,0x01,
+0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x03,0x01,0x04,0x02,0x08,0x03,
+0x05,0x02,0x03,0x01,0x6F,0x00,0x02,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
+0x40,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0x69,0x00,0x01,0x01,
+0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x02,0x02,0x21,0x03,
+0x01,0x02,0x02,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x03,0x02,0x0A,0x01,
+0x03,0x02,0x18,0x03,0x01,0x01,0x36,0x00,0x02,0x01,0x01,0x02,0x28,0x03,0x02,0x02,
+0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x12,0x00,
+0x02,0x01,0x03,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,
+0x2E,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x13,0x03,0x01,0x02,0x02,0x01,
+0x1C,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x01,0x02,
+0x32,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
+0x23,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
+0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x28,0x00,
+0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x25,0x00,
+0x01,0x01,0x01,0x02,0x16,0x03,0x03,0x02,0x0A,0x01,0x03,0x02,0x17,0x03,0x01,0x02,
+0x01,0x01,0x4F,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x14,0x03,
+0x02,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x01,0x4C,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x05,0x01,0x05,0x02,
+0x03,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,0x19,0x00,0x02,0x01,0x01,0x02,
+0x13,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,
+0x11,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,
+0x1F,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x02,0x02,0x17,0x03,
+0x01,0x02,0x02,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,
+0x10,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,
+0x01,0x01,0x46,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
+0x1E,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x1A,0x00,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x45,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x22,0x03,
+0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x18,0x00,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x13,0x00,0x08,0x01,0x11,0x00,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x16,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x02,0x01,0x02,0x02,
+0x0A,0x03,0x02,0x02,0x02,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x41,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x15,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,
+0x13,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x40,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x02,0x12,0x03,0x02,0x02,0x06,0x01,0x02,0x02,0x12,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,0x02,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x12,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x23,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x3A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x02,0x02,0x03,0x01,0x04,0x02,
+0x11,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x0E,0x00,0x04,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x02,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x06,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x02,0x02,0x02,0x03,0x02,0x02,0x02,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
 0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
 0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x11,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
-0x18,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,
-0x19,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x12,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x44,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x19,0x03,0x01,0x02,
-0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x19,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x38,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x10,0x03,
-0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x18,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x03,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x45,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x18,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x20,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x45,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x17,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x39,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x45,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
-0x1D,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x46,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x0C,0x00,0x01,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x02,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0C,0x00,0x02,0x01,0x05,0x02,0x02,0x01,
-0x0F,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
-0x0F,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x49,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
-0x01,0x01,0x22,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
-0x01,0x01,0x03,0x02,0x02,0x03,0x05,0x02,0x02,0x01,0x10,0x00,0x01,0x02,0x0D,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x02,0x1F,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x2A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x41,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x17,0x00,0x02,0x01,0x0F,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x23,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x4E,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,
-0x12,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x50,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,
-0x0A,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
-0x01,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x06,0x02,0x15,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,
-0x11,0x03,0x01,0x02,0x02,0x01,0x13,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x02,
-0x53,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x30,0x03,0x01,0x01,
-0x49,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x13,0x03,
-0x02,0x02,0x03,0x01,0x08,0x00,0x04,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0D,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
-0x01,0x01,0x59,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,
-0x24,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x0E,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
-0x02,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x02,0x01,
-0x11,0x00,0x01,0x01,0x02,0x02,0x02,0x03,0x02,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,
-0x01,0x01,0x62,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x11,0x00,0x02,0x01,0x03,0x02,
-0x0E,0x03,0x02,0x02,0x02,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x02,0x02,
-0x1E,0x03,0x02,0x02,0x01,0x01,0x66,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x14,0x00,0x0D,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,
-0x3F,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x14,0x00,0x02,0x01,0x02,0x02,0x16,0x03,
-0x02,0x02,0x01,0x01,0x6B,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x34,0x00,
-0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x40,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x19,0x00,0x03,0x01,0x03,0x02,0x08,0x03,0x02,0x02,0x03,0x01,0x71,0x00,0x01,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x41,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x9E,0x00,0x01,0x01,0x01,0x02,
-0x11,0x03,0x01,0x02,0x02,0x01,0x29,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x01,
-0x43,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x9F,0x00,0x01,0x01,0x01,0x02,
-0x13,0x03,0x02,0x02,0x01,0x01,0x23,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
-0x01,0x01,0x46,0x00,0x01,0x02,0x07,0x03,0x01,0x02,0xA2,0x00,0x01,0x01,0x01,0x02,
-0x14,0x03,0x02,0x02,0x02,0x01,0x1B,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,
-0x01,0x01,0x48,0x00,0x01,0x01,0x04,0x02,0x02,0x01,0xA5,0x00,0x01,0x02,0x18,0x03,
-0x01,0x02,0x02,0x01,0x0F,0x00,0x05,0x01,0x02,0x02,0x16,0x03,0x01,0x02,0x01,0x01,
-0xF7,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x0C,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
-0xFA,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x01,0x01,
-0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x05,0x00,0x01,0x01,0x01,0x02,
-0x36,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x0F,0x00,0x01,0x01,0x02,0x02,0x29,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,0x02,0x02,0x21,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0x1D,0x00,0x02,0x01,0x03,0x02,0x14,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,
-0x28,0x00,0x03,0x01,0x0C,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x83,0x00,
-
+0x09,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x11,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x05,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x12,0x03,0x01,0x01,
+0x04,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x11,0x03,0x01,0x02,
+0x01,0x01,0x03,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x19,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x03,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x03,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x02,0x18,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x20,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x17,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x1E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x08,0x00,
+0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x1D,0x03,0x01,0x02,0x0C,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x17,0x03,
+0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x02,0x02,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x13,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x0F,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x0C,0x00,0x02,0x01,0x05,0x02,0x02,0x01,0x0F,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x01,0x3D,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x22,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x03,0x02,0x02,0x03,
+0x05,0x02,0x02,0x01,0x10,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x11,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x13,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x41,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x27,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x17,0x00,0x02,0x01,
+0x0F,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,
+0x10,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0x0A,0x00,0x02,0x01,0x01,0x02,
+0x12,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,
+0x01,0x02,0x18,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x17,0x03,0x06,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,
+0x13,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x30,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x13,0x03,0x02,0x02,0x03,0x01,0x08,0x00,
+0x04,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x4B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,
+0x28,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,
+0x0E,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,
+0x50,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,
+0x2F,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x2A,0x03,
+0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x02,0x02,0x18,0x03,0x01,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x02,0x02,
+0x02,0x03,0x02,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
+0x10,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,0x29,0x00,0x01,0x02,
+0x0F,0x03,0x01,0x01,0x11,0x00,0x02,0x01,0x03,0x02,0x0E,0x03,0x02,0x02,0x02,0x01,
+0x13,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,
+0x2D,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x0D,0x01,0x17,0x00,
+0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x14,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x32,0x00,
+0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x19,0x00,0x03,0x01,0x03,0x02,
+0x08,0x03,0x02,0x02,0x03,0x01,0x38,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x65,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,
+0x29,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,
+0x09,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x01,0x01,
+0x23,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x02,
+0x07,0x03,0x01,0x02,0x69,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x02,0x01,
+0x1B,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x48,0x00,0x01,0x01,
+0x04,0x02,0x02,0x01,0x6C,0x00,0x01,0x02,0x18,0x03,0x01,0x02,0x02,0x01,0x0F,0x00,
+0x05,0x01,0x02,0x02,0x16,0x03,0x01,0x02,0x01,0x01,0xBE,0x00,0x01,0x01,0x01,0x02,
+0x1B,0x03,0x0C,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0xC1,0x00,0x01,0x01,0x01,0x02,
+0x3F,0x03,0x01,0x02,0x01,0x01,0xC6,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
+0x01,0x01,0xCB,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0xCF,0x00,
+0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0xD5,0x00,0x01,0x01,0x02,0x02,
+0x29,0x03,0x02,0x02,0x01,0x01,0xDC,0x00,0x01,0x01,0x02,0x02,0x21,0x03,0x02,0x02,
+0x02,0x01,0xE3,0x00,0x02,0x01,0x03,0x02,0x14,0x03,0x04,0x02,0x02,0x01,0xEE,0x00,
+0x03,0x01,0x0C,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD5,0x00,
 };
 static const DiffBlock STUN_FRAME11_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    30, 56,  // Changed box top-left
+    263, 80,  // Changed box dimensions
     STUN_FRAME11_DATA
 };
 
-// Frame 12: Full frame RLE (4060 bytes)
-static const uint8_t STUN_FRAME12_DATA[4060] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xF1,0x00,0x0D,0x01,0xFF,0x00,0x2C,0x00,0x03,0x01,0x03,0x02,0x10,0x03,0x03,0x02,
-0x02,0x01,0xFF,0x00,0x21,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x03,0x01,
-0xFF,0x00,0x18,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x12,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0x89,0x00,0x09,0x01,
-0x79,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x80,0x00,0x03,0x01,
-0x03,0x02,0x0C,0x03,0x03,0x02,0x03,0x01,0x6F,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x78,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,
-0x69,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x02,0x01,
-0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,
-0x07,0x02,0x01,0x01,0x05,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x02,0x01,
-0x01,0x02,0x29,0x03,0x01,0x02,0x02,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x15,0x03,
-0x02,0x02,0x03,0x01,0x10,0x00,0x02,0x01,0x03,0x02,0x15,0x03,0x01,0x02,0x01,0x01,
-0x69,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x13,0x03,0x01,0x02,0x02,0x01,0x1B,0x00,0x03,0x01,0x01,0x02,0x13,0x03,0x01,0x01,
-0x66,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,
-0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,0x22,0x00,0x02,0x01,0x01,0x02,0x11,0x03,
-0x01,0x02,0x01,0x01,0x61,0x00,0x02,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
-0x54,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x02,0x01,0x28,0x00,0x01,0x01,0x01,0x02,
-0x10,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x02,0x02,0x0F,0x03,0x01,0x01,0x5C,0x00,0x01,0x02,0x1B,0x03,0x0A,0x02,
-0x1B,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
-0x32,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,
-0x16,0x03,0x02,0x02,0x04,0x01,0x0C,0x00,0x03,0x01,0x01,0x02,0x16,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,0x17,0x00,0x09,0x01,0x15,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x14,0x03,0x02,0x02,0x01,0x01,
-0x18,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x02,0x02,
-0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x55,0x00,0x01,0x02,
-0x12,0x03,0x02,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x10,0x00,0x02,0x01,0x01,0x02,
-0x16,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x52,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x24,0x00,0x01,0x01,
-0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
-0x01,0x01,0x0E,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x43,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x01,
-0x0E,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,
-0x13,0x00,0x09,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
-0x41,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
-0x01,0x02,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x4E,0x00,0x01,0x02,0x0E,0x03,
-0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,0x02,0x02,0x0C,0x03,0x02,0x02,0x01,0x01,
-0x0E,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,0x01,0x02,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x3F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x4B,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,
-0x02,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x14,0x03,0x09,0x02,
-0x12,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x1E,0x03,0x01,0x02,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x10,0x03,0x02,0x02,0x02,0x01,
-0x0A,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
-0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x3B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x0F,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x0B,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x44,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x29,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x44,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x12,0x03,0x03,0x02,
-0x01,0x01,0x04,0x02,0x11,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x37,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x0D,0x00,0x01,0x01,0x06,0x02,0x02,0x01,0x0B,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x43,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x0E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x37,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x43,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x43,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,
-0x07,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x42,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x02,0x02,0x03,0x03,0x02,0x02,0x01,0x01,
-0x03,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x35,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x12,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x42,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x12,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x0A,0x03,0x01,0x02,0x42,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0D,0x03,0x02,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
-0x0E,0x03,0x03,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x35,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x13,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x41,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,
-0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x35,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x12,0x03,0x01,0x02,0x05,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x08,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x36,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,
-0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x01,0x36,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x05,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x1B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,
-0x01,0x02,0x06,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x42,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
-0x18,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x37,0x00,
-0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x20,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x16,0x03,0x01,0x01,
-0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,
-0x1D,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x44,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x1B,0x03,0x01,0x02,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x44,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x18,0x03,0x01,0x02,
-0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x02,0x01,
-0x02,0x02,0x08,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,
-0x04,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x0D,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x10,0x00,0x02,0x01,0x09,0x02,
-0x02,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x48,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x20,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x01,0x02,
-0x0D,0x03,0x01,0x01,0x49,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x0E,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,
-0x02,0x01,0x17,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
-0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
-0x25,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x0B,0x00,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,0x10,0x00,0x02,0x01,0x01,0x02,
-0x11,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0D,0x00,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x01,0x4E,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x13,0x03,
-0x03,0x02,0x0B,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,
-0x01,0x02,0x08,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x0F,0x03,0x02,0x02,0x01,0x01,
-0x1B,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x0D,0x03,
-0x01,0x01,0x0B,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,
-0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
-0x01,0x02,0x02,0x01,0x14,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x03,0x02,0x02,0x01,0x14,0x00,0x01,0x02,
-0x13,0x03,0x02,0x02,0x03,0x01,0x09,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x01,
-0x53,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x2D,0x03,
-0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x29,0x03,0x01,0x02,
-0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x58,0x00,
-0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,
-0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
-0x1E,0x03,0x02,0x02,0x01,0x01,0x72,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
-0x01,0x01,0x5E,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,
-0x01,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0x77,0x00,0x02,0x01,0x01,0x02,0x25,0x03,
-0x01,0x02,0x02,0x01,0x61,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x11,0x00,
-0x02,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,0x02,0x01,0x7D,0x00,0x01,0x01,0x02,0x02,
-0x1E,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,
-0x14,0x00,0x0C,0x01,0x87,0x00,0x01,0x01,0x03,0x02,0x15,0x03,0x02,0x02,0x02,0x01,
-0x6A,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0xA9,0x00,0x03,0x01,0x04,0x02,
-0x06,0x03,0x04,0x02,0x03,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x2E,0x00,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,
-0x2C,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x2A,0x00,
-0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x02,0x01,0x1C,0x00,0x08,0x01,0xFF,0x00,
-0x05,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x06,0x01,0x08,0x00,0x07,0x01,
-0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x05,0x00,0x01,0x01,0x01,0x02,
-0x21,0x03,0x04,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x06,0x00,0x02,0x02,
-0x38,0x03,0x01,0x02,0xFF,0x00,0x08,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0xFF,0x00,0x0A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x01,0xFF,0x00,0x0C,0x00,
-0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0xFF,0x00,0x10,0x00,0x02,0x01,0x01,0x02,
-0x2A,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x15,0x00,0x02,0x01,0x02,0x02,0x21,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x1E,0x00,0x02,0x01,0x04,0x02,0x15,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x29,0x00,0x05,0x01,0x06,0x02,0x07,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x42,0x00,
+// Frame 12: Diff RLE (3682 bytes)
+static const uint8_t STUN_FRAME12_DATA[3682] = {
+0xC8,0x00,0x0D,0x01,0xEC,0x00,0x03,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,
+0xE1,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x03,0x01,0xD8,0x00,0x01,0x01,
+0x02,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0xD2,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
+0x02,0x02,0x01,0x01,0x4A,0x00,0x09,0x01,0x79,0x00,0x01,0x01,0x01,0x02,0x33,0x03,
+0x01,0x02,0x01,0x01,0x41,0x00,0x03,0x01,0x03,0x02,0x0C,0x03,0x03,0x02,0x03,0x01,
+0x6F,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x02,0x01,
+0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,
+0x01,0x02,0x01,0x01,0x33,0x00,0x02,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,
+0x64,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x07,0x02,0x01,0x01,0x05,0x02,0x19,0x03,
+0x01,0x02,0x01,0x01,0x2E,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x02,0x01,
+0x5E,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x02,0x02,0x03,0x01,0x10,0x00,0x02,0x01,
+0x03,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,
+0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x13,0x03,0x01,0x02,0x02,0x01,0x1B,0x00,
+0x03,0x01,0x01,0x02,0x13,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x01,0x02,0x33,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,
+0x22,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x02,0x01,
+0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x10,0x03,0x01,0x02,
+0x02,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,
+0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x1B,0x03,0x0A,0x02,0x1B,0x03,0x01,0x01,0x4E,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x04,0x01,0x0C,0x00,
+0x03,0x01,0x01,0x02,0x16,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x0F,0x03,0x01,0x01,
+0x17,0x00,0x09,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x18,0x00,
+0x01,0x01,0x14,0x03,0x02,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x02,0x02,0x13,0x03,
+0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x12,0x00,
+0x02,0x01,0x02,0x02,0x0D,0x03,0x02,0x02,0x02,0x01,0x11,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x12,0x03,0x02,0x02,0x01,0x01,0x1E,0x00,
+0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x02,0x0E,0x03,
+0x01,0x01,0x10,0x00,0x02,0x01,0x01,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
+0x01,0x02,0x02,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
+0x45,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x02,0x02,
+0x1C,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x12,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0E,0x00,
+0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x11,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x13,0x00,0x09,0x01,0x11,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
+0x0D,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,
+0x02,0x02,0x0C,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,
+0x29,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x02,0x02,0x13,0x03,0x02,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x3F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x14,0x03,0x09,0x02,0x12,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0D,0x00,0x01,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0C,0x00,
+0x01,0x01,0x10,0x03,0x02,0x02,0x02,0x01,0x0A,0x00,0x02,0x01,0x01,0x02,0x10,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x12,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x24,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x39,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x16,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x26,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x39,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x19,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0B,0x00,0x01,0x01,0x29,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x39,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x12,0x03,0x03,0x02,0x01,0x01,0x04,0x02,0x11,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x1F,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x04,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x10,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x06,0x02,
+0x02,0x01,0x0B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,
+0x01,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x36,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x08,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x04,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x02,0x02,0x03,0x03,0x02,0x02,0x01,0x01,0x03,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x12,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0A,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x09,0x03,0x01,0x02,
+0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x12,0x03,0x01,0x01,0x07,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x03,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x0D,0x03,0x02,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,
+0x06,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x02,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x0E,0x03,0x03,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x13,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x12,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x36,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x36,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x08,0x00,0x01,0x01,0x1B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x36,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x06,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x03,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,
+0x19,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x37,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x03,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x18,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x20,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x02,0x16,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x13,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x01,0x18,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x06,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x01,0x0B,0x00,0x02,0x01,0x02,0x02,0x08,0x03,0x01,0x02,0x01,0x01,
+0x0F,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x01,0x02,0x14,0x03,
+0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x04,0x01,0x10,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0D,0x00,0x02,0x01,0x01,0x02,0x0E,0x03,
+0x02,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x23,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x10,0x00,0x02,0x01,0x09,0x02,0x02,0x01,0x10,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x0D,0x03,
+0x01,0x02,0x2B,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x0C,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,
+0x01,0x02,0x0E,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x02,0x01,0x17,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x11,0x03,0x01,0x02,
+0x02,0x01,0x10,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x42,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x21,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x0B,0x00,0x01,0x02,0x13,0x03,0x03,0x02,0x0B,0x01,0x02,0x02,0x13,0x03,
+0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x02,0x0F,0x00,
+0x01,0x01,0x0F,0x03,0x02,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x33,0x03,
+0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,
+0x10,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x02,0x01,0x14,0x00,0x02,0x01,
+0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,
+0x03,0x02,0x02,0x01,0x14,0x00,0x01,0x02,0x13,0x03,0x02,0x02,0x03,0x01,0x09,0x00,
+0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x0C,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x01,0x01,
+0x37,0x03,0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
+0x0D,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x6D,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x01,0x01,0x72,0x00,
+0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x01,0x01,
+0x77,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x22,0x00,0x01,0x01,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,
+0x02,0x01,0x7D,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0x26,0x00,
+0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x0C,0x01,0x87,0x00,0x01,0x01,
+0x03,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x2B,0x00,0x01,0x01,0x11,0x03,0x01,0x02,
+0x01,0x01,0xA9,0x00,0x03,0x01,0x04,0x02,0x06,0x03,0x04,0x02,0x03,0x01,0x31,0x00,
+0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0xEE,0x00,0x01,0x02,0x12,0x03,
+0x01,0x02,0x02,0x01,0xEC,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,
+0xEA,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x02,0x01,0x1C,0x00,0x08,0x01,
+0xC5,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x06,0x01,0x08,0x00,0x07,0x01,
+0x02,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0xC5,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x04,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0xC6,0x00,0x02,0x02,0x38,0x03,0x01,0x02,
+0xC8,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0xCA,0x00,0x01,0x01,0x01,0x02,
+0x34,0x03,0x01,0x01,0xCC,0x00,0x02,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0xD0,0x00,
+0x02,0x01,0x01,0x02,0x2A,0x03,0x02,0x02,0x01,0x01,0xD5,0x00,0x02,0x01,0x02,0x02,
+0x21,0x03,0x01,0x02,0x02,0x01,0xDE,0x00,0x02,0x01,0x04,0x02,0x15,0x03,0x02,0x02,
+0x02,0x01,0xE9,0x00,0x05,0x01,0x06,0x02,0x07,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xC3,0x00,
 };
 static const DiffBlock STUN_FRAME12_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    41, 51,  // Changed box top-left
+    257, 82,  // Changed box dimensions
     STUN_FRAME12_DATA
 };
 
-// Frame 13: Full frame RLE (4110 bytes)
-static const uint8_t STUN_FRAME13_DATA[4110] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x28,0x00,0x06,0x01,0x06,0x02,0x05,0x01,0xFF,0x00,0x29,0x00,0x03,0x01,0x03,0x02,
-0x13,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,0x1E,0x00,0x02,0x01,0x02,0x02,0x20,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x16,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x0F,0x00,0x02,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x09,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x85,0x00,
-0x09,0x01,0x76,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x7C,0x00,
-0x03,0x01,0x03,0x02,0x0C,0x03,0x04,0x02,0x02,0x01,0x6C,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x75,0x00,0x01,0x01,0x03,0x02,0x1A,0x03,0x02,0x02,
-0x02,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x17,0x03,0x05,0x02,0x0B,0x01,0x04,0x02,
-0x17,0x03,0x01,0x02,0x01,0x01,0x6F,0x00,0x02,0x01,0x01,0x02,0x23,0x03,0x02,0x02,
-0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x14,0x00,
-0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x02,0x02,
-0x2A,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,
-0x02,0x01,0x1E,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x65,0x00,
-0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,
-0x11,0x03,0x01,0x02,0x02,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
-0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x02,0x01,0x01,0x02,0x10,0x03,
-0x01,0x02,0x5F,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x52,0x00,
-0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x18,0x03,0x0D,0x02,0x17,0x03,
-0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x34,0x00,0x01,0x01,
-0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x58,0x00,0x01,0x01,0x01,0x02,0x15,0x03,
-0x02,0x02,0x02,0x01,0x0F,0x00,0x03,0x01,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x03,0x01,
-0x07,0x02,0x05,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x56,0x00,
-0x01,0x01,0x13,0x03,0x02,0x02,0x01,0x01,0x19,0x00,0x02,0x01,0x01,0x02,0x12,0x03,
-0x01,0x02,0x49,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,
-0x02,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
-0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x20,0x00,
-0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x0E,0x03,
-0x01,0x01,0x10,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x44,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x4F,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,
-0x01,0x02,0x0F,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x0D,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x40,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x01,
-0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x4C,0x00,0x01,0x02,0x0E,0x03,
-0x01,0x01,0x16,0x00,0x09,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,
-0x4A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x03,0x02,
-0x0B,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,
-0x49,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x02,0x01,0x01,0x02,
-0x13,0x03,0x02,0x02,0x02,0x01,0x0E,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x3B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x13,0x03,
-0x02,0x02,0x08,0x01,0x03,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x01,0x47,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0E,0x00,0x02,0x01,
-0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x10,0x03,
-0x02,0x02,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x0B,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x46,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0D,0x00,
-0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,
-0x01,0x01,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x18,0x00,
-0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x44,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,
-0x26,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x1C,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x42,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x37,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x1E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,
-0x01,0x02,0x12,0x03,0x08,0x02,0x10,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x04,0x01,0x0E,0x00,0x01,0x01,
-0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x41,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x02,0x01,0x09,0x00,0x02,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x02,0x02,0x05,0x03,
-0x02,0x02,0x02,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x34,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x16,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x33,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x18,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x33,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,
-0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x3E,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x0D,0x00,0x02,0x01,0x02,0x02,0x02,0x01,0x07,0x00,0x01,0x02,0x0B,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x14,0x03,
-0x01,0x02,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x07,0x03,0x01,0x02,
-0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x15,0x03,0x01,0x02,0x08,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x33,0x00,
-0x01,0x01,0x01,0x02,0x08,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x15,0x03,0x01,0x02,0x07,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x34,0x00,
-0x01,0x01,0x01,0x02,0x06,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x07,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x02,0x02,
-0x02,0x01,0x0E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x14,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x10,0x03,
-0x01,0x01,0x02,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x49,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x3E,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x10,0x03,0x01,0x02,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
-0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,0x03,0x02,0x03,0x01,0x08,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3E,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x1E,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,
-0x01,0x01,0x09,0x00,0x02,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x1D,0x03,0x01,0x02,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x0B,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x07,0x01,0x01,0x02,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,
-0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
-0x01,0x02,0x1C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x24,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x0A,0x03,
-0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
-0x1B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,
-0x4B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x22,0x03,
-0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x40,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
-0x18,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x4C,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x20,0x03,0x01,0x02,0x0C,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
-0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x16,0x03,
-0x01,0x02,0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,
-0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,
-0x01,0x01,0x0C,0x03,0x01,0x01,0x41,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x12,0x03,
-0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,
-0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x19,0x03,
-0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0C,0x00,
-0x01,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,0x02,0x01,0x0D,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0D,0x00,
-0x01,0x01,0x01,0x02,0x15,0x03,0x02,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x0E,0x00,0x02,0x01,0x07,0x02,0x02,0x01,0x10,0x00,0x01,0x01,
-0x0D,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,
-0x02,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x0F,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
-0x44,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
-0x01,0x01,0x27,0x00,0x01,0x02,0x0D,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,
-0x0C,0x03,0x01,0x02,0x11,0x00,0x02,0x01,0x09,0x02,0x03,0x01,0x11,0x00,0x01,0x02,
-0x0D,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,
-0x01,0x01,0x0D,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,
-0x53,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,
-0x01,0x02,0x0D,0x03,0x01,0x02,0x47,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
-0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,
-0x0E,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
-0x2A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x0C,0x03,
-0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,
-0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x4A,0x00,0x01,0x02,
-0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x18,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x0F,0x03,
-0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0x4A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x10,0x03,
-0x02,0x02,0x01,0x01,0x11,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,0x1B,0x00,0x02,0x01,
-0x01,0x02,0x11,0x03,0x01,0x02,0x4D,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,
-0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,0x04,0x01,0x02,0x00,0x04,0x01,0x03,0x02,
-0x13,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,
-0x15,0x00,0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x02,
-0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x61,0x00,
-0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x04,0x01,0x08,0x00,0x03,0x01,0x02,0x02,
-0x15,0x03,0x01,0x02,0x51,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x19,0x03,
-0x06,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x53,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,
-0x0D,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,
-0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,
-0x0E,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x02,0x02,0x01,0x01,0x6B,0x00,0x02,0x02,
-0x30,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x0F,0x00,
-0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
-0x10,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0x74,0x00,0x01,0x01,
-0x02,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x12,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x02,0x01,0x7B,0x00,0x02,0x01,
-0x01,0x02,0x20,0x03,0x01,0x02,0x02,0x01,0x63,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,
-0x01,0x01,0x14,0x00,0x0A,0x01,0x02,0x02,0x06,0x01,0x84,0x00,0x02,0x01,0x02,0x02,
-0x16,0x03,0x02,0x02,0x02,0x01,0x68,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
-0xAD,0x00,0x03,0x01,0x03,0x02,0x06,0x03,0x05,0x02,0x03,0x01,0x6E,0x00,0x01,0x02,
-0x10,0x03,0x01,0x02,0x01,0x01,0xB3,0x00,0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,
-0x10,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x2F,0x00,0x01,0x01,0x11,0x03,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x2D,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x2B,0x00,0x01,0x01,0x15,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x28,0x00,
-0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x03,0x01,0xFF,0x00,0x24,0x00,0x01,0x01,
-0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x22,0x00,0x02,0x01,0x01,0x02,
-0x1C,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x23,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x24,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x01,0x01,
-0xFF,0x00,0x27,0x00,0x02,0x01,0x01,0x02,0x15,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x2A,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0xFF,0x00,0x30,0x00,0x02,0x01,
-0x03,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x37,0x00,0x03,0x01,0x04,0x02,
-0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x94,0x00,
+// Frame 13: Diff RLE (3726 bytes)
+static const uint8_t STUN_FRAME13_DATA[3726] = {
+0xC5,0x00,0x06,0x01,0x06,0x02,0x05,0x01,0xEB,0x00,0x03,0x01,0x03,0x02,0x13,0x03,
+0x04,0x02,0x02,0x01,0xE0,0x00,0x02,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,
+0xD8,0x00,0x02,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x02,0x01,0xD1,0x00,0x02,0x01,
+0x01,0x02,0x2F,0x03,0x01,0x02,0x02,0x01,0xCB,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
+0x01,0x02,0x01,0x01,0x48,0x00,0x09,0x01,0x76,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,
+0x01,0x02,0x01,0x01,0x3F,0x00,0x03,0x01,0x03,0x02,0x0C,0x03,0x04,0x02,0x02,0x01,
+0x6C,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
+0x03,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x65,0x00,0x01,0x01,0x01,0x02,0x17,0x03,
+0x05,0x02,0x0B,0x01,0x04,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x02,0x01,
+0x01,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x14,0x03,
+0x02,0x02,0x03,0x01,0x14,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x02,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,
+0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0x1E,0x00,0x02,0x01,0x01,0x02,0x13,0x03,
+0x01,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0x58,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x02,0x01,0x25,0x00,0x01,0x01,
+0x01,0x02,0x11,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
+0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x11,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,
+0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
+0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x30,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x01,0x02,
+0x18,0x03,0x0D,0x02,0x17,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x02,0x0F,0x03,
+0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x01,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x0F,0x00,0x03,0x01,0x01,0x02,
+0x14,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x14,0x00,0x03,0x01,0x07,0x02,0x05,0x01,0x14,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x13,0x03,0x02,0x02,0x01,0x01,0x19,0x00,
+0x02,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x49,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x12,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x11,0x00,
+0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x20,0x00,0x02,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,
+0x46,0x00,0x01,0x01,0x0E,0x03,0x01,0x01,0x10,0x00,0x02,0x01,0x01,0x02,0x19,0x03,
+0x02,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x14,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x0F,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x0E,0x00,0x01,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,
+0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,0x42,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
+0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x10,0x00,
+0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,
+0x01,0x02,0x40,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x01,0x02,0x29,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x0F,0x00,0x01,0x02,0x0E,0x03,0x01,0x01,0x16,0x00,0x09,0x01,0x13,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,
+0x01,0x01,0x0C,0x00,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x11,0x00,0x02,0x01,0x03,0x02,0x0B,0x03,0x02,0x02,0x01,0x01,0x10,0x00,0x01,0x01,
+0x01,0x02,0x0D,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x0F,0x00,0x02,0x01,0x01,0x02,0x13,0x03,0x02,0x02,0x02,0x01,0x0E,0x00,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x13,0x03,0x02,0x02,0x08,0x01,0x03,0x02,0x11,0x03,0x01,0x02,
+0x01,0x01,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x0E,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x0E,0x00,0x02,0x01,0x01,0x02,
+0x10,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,
+0x0C,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x38,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x0E,0x03,
+0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x0C,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x37,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x37,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x08,0x02,0x10,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x0E,0x00,
+0x04,0x01,0x0E,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x02,0x01,0x09,0x00,0x02,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x35,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x0D,0x00,
+0x01,0x01,0x02,0x02,0x05,0x03,0x02,0x02,0x02,0x01,0x0A,0x00,0x01,0x01,0x0C,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x12,0x00,
+0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x33,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,
+0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,
+0x08,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x16,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x0B,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
+0x01,0x01,0x07,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x13,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x0D,0x00,0x02,0x01,0x02,0x02,0x02,0x01,
+0x07,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x33,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x14,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x02,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,0x07,0x03,
+0x01,0x02,0x01,0x01,0x05,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x0A,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x15,0x03,0x01,0x02,
+0x08,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x02,0x01,
+0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,
+0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x33,0x00,0x01,0x01,
+0x01,0x02,0x08,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x09,0x00,0x01,0x02,0x15,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x02,0x01,0x0B,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x06,0x03,
+0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,
+0x01,0x02,0x14,0x03,0x01,0x02,0x01,0x01,0x07,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x0F,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x36,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x0E,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x14,0x03,0x01,0x01,0x07,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x08,0x00,0x01,0x01,0x10,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x49,0x00,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,
+0x07,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x10,0x03,0x01,0x02,0x01,0x01,0x01,0x02,
+0x0B,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,0x01,0x01,
+0x49,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,0x0C,0x03,
+0x03,0x02,0x03,0x01,0x08,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x1E,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0A,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x01,0x01,0x0A,0x03,0x01,0x02,0x01,0x01,
+0x09,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x02,0x01,0x01,0x02,
+0x0D,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,0x01,0x00,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x1D,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0A,0x03,
+0x01,0x02,0x4A,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x07,0x01,0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x01,0x4B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x24,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x01,0x01,0x02,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x1B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x01,0x02,0x0A,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x02,0x0A,0x03,0x01,0x02,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x18,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x20,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x03,0x00,0x01,0x01,0x0B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x01,0x16,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,0x0C,0x03,
+0x01,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,
+0x1D,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x02,0x02,0x0C,0x03,0x01,0x02,
+0x02,0x01,0x0D,0x00,0x01,0x01,0x0C,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x01,0x02,0x15,0x03,0x02,0x02,
+0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x06,0x00,0x01,0x02,
+0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x0C,0x03,0x01,0x02,0x0E,0x00,0x02,0x01,
+0x07,0x02,0x02,0x01,0x10,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
+0x0C,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x02,0x02,0x0F,0x03,0x02,0x02,0x01,0x01,
+0x0F,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x07,0x00,0x01,0x01,0x0B,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x0D,0x03,
+0x01,0x01,0x51,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,0x01,0x02,0x11,0x00,0x02,0x01,
+0x09,0x02,0x03,0x01,0x11,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
+0x01,0x02,0x0B,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x01,0x02,0x0C,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x02,0x0D,0x03,0x01,0x02,
+0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x0E,0x03,0x01,0x02,0x55,0x00,0x01,0x01,
+0x01,0x02,0x0C,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,0x01,0x02,0x0D,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x0C,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,0x01,0x01,
+0x57,0x00,0x01,0x01,0x0E,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x01,0x02,
+0x0E,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x0B,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x10,0x03,
+0x01,0x01,0x59,0x00,0x01,0x01,0x0F,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,
+0x02,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x0B,0x03,
+0x01,0x02,0x0C,0x00,0x01,0x02,0x10,0x03,0x02,0x02,0x01,0x01,0x11,0x00,0x02,0x01,
+0x02,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x0F,0x03,
+0x02,0x02,0x01,0x01,0x1B,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,0x10,0x00,
+0x01,0x01,0x0C,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x03,0x02,
+0x04,0x01,0x02,0x00,0x04,0x01,0x03,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,
+0x01,0x02,0x11,0x03,0x02,0x02,0x01,0x01,0x15,0x00,0x02,0x01,0x01,0x02,0x12,0x03,
+0x01,0x02,0x01,0x01,0x12,0x00,0x01,0x02,0x0C,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,
+0x33,0x03,0x01,0x02,0x01,0x01,0x61,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x02,0x02,
+0x04,0x01,0x08,0x00,0x03,0x01,0x02,0x02,0x15,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
+0x0D,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
+0x64,0x00,0x01,0x01,0x01,0x02,0x19,0x03,0x06,0x02,0x19,0x03,0x01,0x02,0x01,0x01,
+0x16,0x00,0x01,0x01,0x0D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0x67,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
+0x19,0x00,0x01,0x01,0x0D,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x01,0x02,0x27,0x03,
+0x02,0x02,0x01,0x01,0x6B,0x00,0x02,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,
+0x01,0x01,0x70,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,
+0x01,0x02,0x0D,0x03,0x01,0x02,0x01,0x01,0x10,0x00,0x01,0x01,0x02,0x02,0x1C,0x03,
+0x01,0x02,0x02,0x01,0x74,0x00,0x01,0x01,0x02,0x02,0x26,0x03,0x02,0x02,0x01,0x01,
+0x22,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x12,0x00,0x02,0x01,0x02,0x02,0x13,0x03,
+0x02,0x02,0x02,0x01,0x7B,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x01,0x02,0x02,0x01,
+0x26,0x00,0x01,0x02,0x0E,0x03,0x01,0x02,0x01,0x01,0x14,0x00,0x0A,0x01,0x02,0x02,
+0x06,0x01,0x84,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0x2B,0x00,
+0x01,0x02,0x0F,0x03,0x01,0x02,0x01,0x01,0xAD,0x00,0x03,0x01,0x03,0x02,0x06,0x03,
+0x05,0x02,0x03,0x01,0x31,0x00,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0xB3,0x00,
+0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x10,0x03,0x01,0x02,0x01,0x01,0xF1,0x00,
+0x01,0x01,0x11,0x03,0x02,0x02,0x01,0x01,0xEF,0x00,0x01,0x01,0x01,0x02,0x13,0x03,
+0x01,0x02,0x02,0x01,0xED,0x00,0x01,0x01,0x15,0x03,0x02,0x02,0x02,0x01,0xEA,0x00,
+0x01,0x01,0x01,0x02,0x18,0x03,0x02,0x02,0x03,0x01,0xE6,0x00,0x01,0x01,0x01,0x02,
+0x1C,0x03,0x02,0x02,0x01,0x01,0xE4,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,
+0x01,0x01,0xE5,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0xE6,0x00,
+0x01,0x01,0x02,0x02,0x19,0x03,0x01,0x01,0xE9,0x00,0x02,0x01,0x01,0x02,0x15,0x03,
+0x01,0x02,0x01,0x01,0xEC,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0xF2,0x00,
+0x02,0x01,0x03,0x02,0x09,0x03,0x01,0x02,0x01,0x01,0xF9,0x00,0x03,0x01,0x04,0x02,
+0x01,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE1,0x00,
 };
 static const DiffBlock STUN_FRAME13_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    43, 44,  // Changed box top-left
+    259, 86,  // Changed box dimensions
     STUN_FRAME13_DATA
 };
 
@@ -106,2814 +106,1974 @@ static const DiffBlock THINKING_FRAME0_BLOCK = {
     THINKING_FRAME0_DATA
 };
 
-// Frame 1: Full frame RLE (1552 bytes)
-static const uint8_t THINKING_FRAME1_DATA[1552] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA9,0x00,0x02,0x01,0x03,0x02,
-0x0B,0x03,0x03,0x02,0x02,0x01,0x6E,0x00,0x04,0x01,0x0B,0x02,0x03,0x01,0xA5,0x00,
-0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x02,0x02,
-0x18,0x03,0x02,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
-0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x93,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,
-0x2A,0x03,0x01,0x02,0x01,0x01,0x8D,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x01,
-0x4D,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x87,0x00,0x01,0x01,
-0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0x82,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,
-0x43,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x7E,0x00,0x01,0x01,
-0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,
-0x7B,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x01,0x01,0x77,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x46,0x03,
-0x01,0x02,0x75,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x4A,0x03,
-0x01,0x01,0x71,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x6F,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x31,0x00,0x01,0x02,0x4F,0x03,
-0x6D,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6A,0x00,
-0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x68,0x00,
-0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x66,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x28,0x00,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x02,
-0x5A,0x03,0x27,0x00,0x5A,0x03,0x01,0x01,0x62,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,
-0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x21,0x00,0x60,0x03,0x5D,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x59,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x58,0x00,
-0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x65,0x03,0x58,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x57,0x00,0x01,0x02,
-0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x57,0x00,0x67,0x03,
-0x01,0x01,0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x57,0x00,0x67,0x03,0x01,0x01,
-0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x56,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x57,0x00,0x67,0x03,0x01,0x01,0x19,0x00,
-0x01,0x02,0x66,0x03,0x01,0x02,0x57,0x00,0x67,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x57,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,0x19,0x00,
-0x01,0x01,0x66,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1A,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x57,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x1B,0x00,
-0x01,0x02,0x65,0x03,0x59,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x64,0x03,
-0x01,0x02,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,
-0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
-0x01,0x02,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5F,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x60,0x00,0x5D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x57,0x03,
-0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x55,0x03,
-0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x53,0x03,
-0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x4F,0x03,
-0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6F,0x00,0x4D,0x03,0x01,0x01,
-0x33,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x71,0x00,0x01,0x02,0x49,0x03,0x01,0x02,
-0x36,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x74,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x77,0x00,0x01,0x02,0x43,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x7A,0x00,0x01,0x01,0x01,0x02,0x40,0x03,
-0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x7D,0x00,0x01,0x01,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x81,0x00,
-0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x01,0x02,
-0x39,0x03,0x01,0x01,0x86,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x8A,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,
-0x01,0x01,0x90,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x02,0x01,0x96,0x00,0x01,0x01,0x01,0x02,
-0x1F,0x03,0x01,0x02,0x02,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x02,0x02,
-0x01,0x01,0x9E,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x02,0x01,0x65,0x00,
-0x02,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0xAB,0x00,0x09,0x01,0x75,0x00,
-0x04,0x01,0x08,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xBC,0x00,
-
+// Frame 1: Diff RLE (1188 bytes)
+static const uint8_t THINKING_FRAME1_DATA[1188] = {
+0x2A,0x00,0x02,0x01,0x03,0x02,0x0B,0x03,0x03,0x02,0x02,0x01,0x6E,0x00,0x04,0x01,
+0x0B,0x02,0x03,0x01,0x4F,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,
+0x62,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0x45,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
+0x02,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x52,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x37,0x00,0x01,0x01,
+0x01,0x02,0x32,0x03,0x01,0x01,0x4D,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,
+0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,
+0x3B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x3F,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x3C,0x00,
+0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
+0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,
+0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
+0x33,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
+0x31,0x00,0x01,0x02,0x4F,0x03,0x17,0x00,0x01,0x02,0x52,0x03,0x2E,0x00,0x01,0x01,
+0x52,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x54,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,
+0x56,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x28,0x00,0x58,0x03,
+0x01,0x01,0x0E,0x00,0x01,0x02,0x5A,0x03,0x27,0x00,0x5A,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x02,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x5D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x08,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x07,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x62,0x03,
+0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x05,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x62,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1D,0x00,
+0x01,0x02,0x63,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x64,0x03,0x01,0x02,0x03,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
+0x65,0x03,0x02,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,
+0x01,0x01,0x01,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x66,0x03,
+0x01,0x02,0x01,0x00,0x67,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,
+0x01,0x00,0x67,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,
+0x67,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x01,0x67,0x03,
+0x01,0x01,0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x67,0x03,0x01,0x01,
+0x19,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x67,0x03,0x01,0x01,0x19,0x00,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x19,0x00,
+0x01,0x02,0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
+0x19,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x02,0x65,0x03,0x03,0x00,0x65,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
+0x64,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x01,0x01,0x04,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,
+0x01,0x01,0x06,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x07,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x09,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x0A,0x00,0x5D,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,
+0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
+0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x12,0x00,0x01,0x02,
+0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
+0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x16,0x00,0x01,0x01,
+0x4F,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x19,0x00,0x4D,0x03,
+0x01,0x01,0x33,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x49,0x03,
+0x01,0x02,0x36,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x47,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x43,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x01,0x02,
+0x40,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x27,0x00,
+0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x01,0x01,0x30,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
+0x4A,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,
+0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,
+0x56,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x02,0x01,0x40,0x00,0x01,0x01,
+0x01,0x02,0x1F,0x03,0x01,0x02,0x02,0x01,0x5C,0x00,0x01,0x01,0x02,0x02,0x20,0x03,
+0x02,0x02,0x01,0x01,0x48,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x02,0x02,0x02,0x01,
+0x65,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x02,0x01,0x55,0x00,0x09,0x01,
+0x75,0x00,0x04,0x01,0x08,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xAD,0x00,
 };
 static const DiffBlock THINKING_FRAME1_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    42, 68,  // Changed box top-left
+    234, 76,  // Changed box dimensions
     THINKING_FRAME1_DATA
 };
 
-// Frame 2: Full frame RLE (1452 bytes)
-static const uint8_t THINKING_FRAME2_DATA[1452] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA2,0x00,0x07,0x01,0x06,0x02,0x07,0x01,0xFF,0x00,
-0x22,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,0x02,0x02,0x03,0x01,0x62,0x00,0x05,0x01,
-0x11,0x02,0x04,0x01,0x95,0x00,0x02,0x01,0x02,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,
-0x54,0x00,0x02,0x01,0x03,0x02,0x22,0x03,0x02,0x02,0x02,0x01,0x88,0x00,0x02,0x01,
-0x01,0x02,0x38,0x03,0x01,0x02,0x02,0x01,0x49,0x00,0x02,0x01,0x02,0x02,0x2F,0x03,
-0x02,0x02,0x01,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,
-0x41,0x00,0x02,0x01,0x01,0x02,0x39,0x03,0x02,0x02,0x01,0x01,0x79,0x00,0x01,0x01,
-0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x41,0x03,
-0x01,0x02,0x01,0x01,0x73,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,
-0x36,0x00,0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x4C,0x03,0x01,0x02,0x6B,0x00,
-0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x28,0x00,0x01,0x02,
-0x57,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x24,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x5F,0x00,0x60,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x5D,0x03,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
-0x01,0x01,0x5B,0x00,0x64,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x59,0x00,0x65,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x58,0x00,0x01,0x02,
-0x66,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x56,0x00,0x01,0x01,
-0x68,0x03,0x01,0x01,0x19,0x00,0x67,0x03,0x01,0x01,0x55,0x00,0x01,0x02,0x68,0x03,
-0x01,0x02,0x18,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x54,0x00,0x01,0x01,0x6A,0x03,
-0x17,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x53,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,
-0x16,0x00,0x01,0x02,0x69,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,
-0x15,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,0x52,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,
-0x15,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x6C,0x03,0x15,0x00,
-0x01,0x02,0x6B,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x13,0x00,
-0x01,0x01,0x6C,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x13,0x00,
-0x01,0x01,0x6C,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x13,0x00,
-0x01,0x01,0x6C,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x6C,0x03,0x14,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x01,0x52,0x00,0x6B,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x6A,0x03,
-0x01,0x02,0x53,0x00,0x01,0x02,0x6A,0x03,0x16,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,
-0x53,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,
-0x53,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x17,0x00,0x69,0x03,0x01,0x02,0x55,0x00,
-0x01,0x02,0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x55,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x19,0x00,0x68,0x03,0x57,0x00,0x01,0x02,0x65,0x03,
-0x01,0x02,0x1A,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x58,0x00,0x65,0x03,0x01,0x01,
-0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x58,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x62,0x03,0x1D,0x00,
-0x01,0x01,0x63,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x61,0x03,0x01,0x01,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,
-0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5E,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,
-0x22,0x00,0x60,0x03,0x60,0x00,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x01,0x61,0x00,0x5B,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x62,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x64,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x67,0x00,0x55,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x69,0x00,
-0x01,0x02,0x52,0x03,0x2D,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,
-0x4F,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x4D,0x03,0x01,0x01,0x32,0x00,0x50,0x03,0x70,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,
-0x01,0x01,0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x73,0x00,0x01,0x02,0x47,0x03,
-0x01,0x02,0x37,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x75,0x00,0x01,0x01,0x01,0x02,
-0x43,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x79,0x00,0x01,0x01,
-0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0x7C,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x40,0x03,0x01,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,
-0x01,0x01,0x45,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x85,0x00,0x01,0x02,0x33,0x03,
-0x01,0x01,0x4A,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x32,0x03,0x01,0x01,0x8F,0x00,
-0x01,0x01,0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x96,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x9F,0x00,0x02,0x01,
-0x04,0x02,0x0A,0x03,0x04,0x02,0x03,0x01,0x65,0x00,0x02,0x01,0x02,0x02,0x19,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x26,0x00,0x03,0x01,0x0E,0x02,0x04,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4C,0x00,
+// Frame 2: Diff RLE (1062 bytes)
+static const uint8_t THINKING_FRAME2_DATA[1062] = {
+0x2F,0x00,0x07,0x01,0x06,0x02,0x07,0x01,0xD0,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,
+0x02,0x02,0x03,0x01,0x62,0x00,0x05,0x01,0x11,0x02,0x04,0x01,0x44,0x00,0x02,0x01,
+0x02,0x02,0x2D,0x03,0x02,0x02,0x01,0x01,0x54,0x00,0x02,0x01,0x03,0x02,0x22,0x03,
+0x02,0x02,0x02,0x01,0x37,0x00,0x02,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x02,0x01,
+0x49,0x00,0x02,0x01,0x02,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
+0x01,0x02,0x40,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x02,0x01,0x01,0x02,0x39,0x03,
+0x02,0x02,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x46,0x03,0x01,0x02,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,
+0x01,0x02,0x4B,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x47,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
+0x01,0x02,0x4C,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x02,
+0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,0x17,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x13,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x11,0x00,0x01,0x02,
+0x5D,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0E,0x00,0x60,0x03,
+0x01,0x01,0x22,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x0A,0x00,0x64,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x08,0x00,0x65,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x64,0x03,0x07,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,
+0x65,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x19,0x00,0x67,0x03,
+0x01,0x01,0x04,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x67,0x03,
+0x01,0x02,0x03,0x00,0x01,0x01,0x6A,0x03,0x17,0x00,0x01,0x01,0x69,0x03,0x01,0x01,
+0x02,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x69,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,
+0x01,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,
+0x01,0x02,0x6C,0x03,0x15,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x01,0x02,0x6C,0x03,
+0x01,0x01,0x13,0x00,0x01,0x01,0x6C,0x03,0x02,0x02,0x6C,0x03,0x01,0x01,0x13,0x00,
+0x01,0x01,0x6C,0x03,0x02,0x02,0x6C,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x6C,0x03,
+0x02,0x02,0x6C,0x03,0x14,0x00,0x01,0x01,0x6C,0x03,0x02,0x02,0x6B,0x03,0x01,0x02,
+0x14,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,
+0x01,0x01,0x6C,0x03,0x02,0x01,0x6B,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x6C,0x03,
+0x01,0x01,0x01,0x00,0x6B,0x03,0x01,0x01,0x15,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,
+0x02,0x00,0x01,0x02,0x6A,0x03,0x16,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x69,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x69,0x03,0x01,0x01,0x17,0x00,0x69,0x03,0x01,0x02,0x04,0x00,0x01,0x02,
+0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x04,0x00,0x01,0x01,
+0x67,0x03,0x01,0x01,0x19,0x00,0x68,0x03,0x06,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x07,0x00,0x65,0x03,0x01,0x01,0x1A,0x00,
+0x01,0x01,0x66,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x02,0x64,0x03,0x01,0x02,0x09,0x00,0x01,0x02,0x62,0x03,0x1D,0x00,0x01,0x01,
+0x63,0x03,0x01,0x02,0x01,0x01,0x09,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1E,0x00,
+0x01,0x01,0x62,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x20,0x00,
+0x01,0x02,0x60,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,
+0x60,0x03,0x0F,0x00,0x5D,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x10,0x00,0x5B,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x11,0x00,
+0x01,0x01,0x59,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x13,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x16,0x00,
+0x55,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x18,0x00,0x01,0x02,
+0x52,0x03,0x2D,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x4F,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x4D,0x03,
+0x01,0x01,0x32,0x00,0x50,0x03,0x1F,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x01,
+0x34,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
+0x37,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
+0x01,0x02,0x3B,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x01,0x02,
+0x3F,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
+0x40,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,
+0x45,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x34,0x00,0x01,0x02,0x33,0x03,0x01,0x01,
+0x4A,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
+0x2D,0x03,0x01,0x02,0x50,0x00,0x01,0x02,0x32,0x03,0x01,0x01,0x3E,0x00,0x01,0x01,
+0x02,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x45,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,0x5C,0x00,
+0x01,0x01,0x02,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x02,0x01,0x04,0x02,
+0x0A,0x03,0x04,0x02,0x03,0x01,0x65,0x00,0x02,0x01,0x02,0x02,0x19,0x03,0x02,0x02,
+0x02,0x01,0xD4,0x00,0x03,0x01,0x0E,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0x4C,0x00,
 };
 static const DiffBlock THINKING_FRAME2_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    40, 60,  // Changed box top-left
+    239, 78,  // Changed box dimensions
     THINKING_FRAME2_DATA
 };
 
-// Frame 3: Full frame RLE (1318 bytes)
-static const uint8_t THINKING_FRAME3_DATA[1318] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x2C,0x00,0x08,0x01,0x13,0x02,0x05,0x01,0x76,0x00,
-0x09,0x01,0x93,0x00,0x03,0x01,0x04,0x02,0x2C,0x03,0x03,0x02,0x02,0x01,0x59,0x00,
-0x04,0x01,0x05,0x02,0x1B,0x03,0x03,0x02,0x02,0x01,0x7E,0x00,0x02,0x01,0x02,0x02,
-0x3E,0x03,0x01,0x02,0x02,0x01,0x49,0x00,0x03,0x01,0x03,0x02,0x31,0x03,0x01,0x02,
-0x01,0x01,0x73,0x00,0x01,0x01,0x02,0x02,0x49,0x03,0x01,0x02,0x01,0x01,0x3E,0x00,
-0x02,0x01,0x02,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,
-0x52,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x02,0x01,0x01,0x02,0x49,0x03,0x01,0x01,
-0x64,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x02,0x02,
-0x50,0x03,0x01,0x01,0x5F,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,0x01,0x01,0x28,0x00,
-0x01,0x01,0x01,0x02,0x57,0x03,0x5C,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x23,0x00,
-0x01,0x01,0x02,0x02,0x5B,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x65,0x03,0x01,0x02,
-0x1F,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x67,0x03,
-0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x54,0x00,0x01,0x01,
-0x69,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x52,0x00,0x01,0x01,
-0x6B,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x52,0x00,0x6C,0x03,
-0x01,0x01,0x16,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x6C,0x03,
-0x01,0x02,0x15,0x00,0x01,0x01,0x6B,0x03,0x51,0x00,0x6D,0x03,0x01,0x02,0x14,0x00,
-0x01,0x01,0x6C,0x03,0x50,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x14,0x00,0x01,0x02,
-0x6C,0x03,0x50,0x00,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x6D,0x03,
-0x50,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,
-0x50,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,
-0x50,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,
-0x51,0x00,0x6D,0x03,0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x51,0x00,0x01,0x02,
-0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x51,0x00,0x01,0x01,
-0x6B,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x53,0x00,0x6B,0x03,
-0x15,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x69,0x03,0x01,0x02,
-0x16,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x69,0x03,0x01,0x01,
-0x16,0x00,0x01,0x01,0x6A,0x03,0x55,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x18,0x00,
-0x01,0x02,0x68,0x03,0x01,0x01,0x55,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x18,0x00,
-0x01,0x01,0x68,0x03,0x57,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x67,0x03,
-0x01,0x02,0x58,0x00,0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x58,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x02,0x62,0x03,0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x01,0x01,
-0x5A,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x5C,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x5E,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x60,0x03,0x60,0x00,0x5C,0x03,
-0x01,0x02,0x23,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x61,0x00,0x5B,0x03,0x25,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x62,0x00,0x01,0x01,0x59,0x03,0x27,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x28,0x00,0x01,0x01,
-0x58,0x03,0x01,0x02,0x67,0x00,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x56,0x03,
-0x01,0x02,0x69,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x54,0x03,
-0x01,0x02,0x6B,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x6D,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x32,0x00,0x50,0x03,0x01,0x01,
-0x70,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x35,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
-0x73,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
-0x76,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
-0x79,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x43,0x03,
-0x01,0x02,0x01,0x01,0x7C,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x42,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x01,0x01,0x80,0x00,0x01,0x01,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x01,0x01,0x85,0x00,
-0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,
-0x36,0x03,0x01,0x01,0x8B,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x91,0x00,0x01,0x01,0x01,0x02,
-0x22,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,
-0x01,0x01,0x99,0x00,0x02,0x01,0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x60,0x00,
-0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0xA5,0x00,0x0C,0x01,0x6D,0x00,
-0x02,0x01,0x02,0x02,0x16,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x2C,0x00,0x0D,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x15,0x00,
+// Frame 3: Diff RLE (912 bytes)
+static const uint8_t THINKING_FRAME3_DATA[912] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xD7,0x00,0x08,0x01,0x13,0x02,
+0x05,0x01,0x76,0x00,0x09,0x01,0x43,0x00,0x03,0x01,0x04,0x02,0x2C,0x03,0x03,0x02,
+0x02,0x01,0x59,0x00,0x04,0x01,0x05,0x02,0x1B,0x03,0x03,0x02,0x02,0x01,0x2E,0x00,
+0x02,0x01,0x02,0x02,0x3E,0x03,0x01,0x02,0x02,0x01,0x49,0x00,0x03,0x01,0x03,0x02,
+0x31,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x02,0x02,0x49,0x03,0x01,0x02,
+0x01,0x01,0x3E,0x00,0x02,0x01,0x02,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x1A,0x00,
+0x01,0x01,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x02,0x01,0x01,0x02,
+0x49,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x59,0x03,0x01,0x01,0x2E,0x00,
+0x01,0x01,0x02,0x02,0x50,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x0C,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x23,0x00,0x01,0x01,0x02,0x02,0x5B,0x03,0x01,0x01,0x08,0x00,0x01,0x01,
+0x65,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x01,0x02,0x60,0x03,0x01,0x01,0x06,0x00,
+0x01,0x02,0x67,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,
+0x04,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x67,0x03,0x01,0x02,
+0x02,0x00,0x6C,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x6B,0x03,0x01,0x00,0x6D,0x03,
+0x01,0x02,0x14,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x6D,0x03,0x01,0x02,0x14,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x01,0x6D,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x6D,0x03,
+0x01,0x01,0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x01,
+0x6D,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x01,0x6D,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x00,0x6D,0x03,0x14,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x01,0x01,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x14,0x00,
+0x01,0x01,0x6B,0x03,0x01,0x02,0x03,0x00,0x6B,0x03,0x15,0x00,0x01,0x01,0x6B,0x03,
+0x01,0x02,0x03,0x00,0x01,0x02,0x69,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x6A,0x03,
+0x01,0x01,0x03,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x6A,0x03,
+0x05,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x68,0x03,0x01,0x01,
+0x05,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x68,0x03,0x07,0x00,
+0x01,0x02,0x65,0x03,0x01,0x02,0x1A,0x00,0x67,0x03,0x01,0x02,0x08,0x00,0x65,0x03,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x63,0x03,
+0x01,0x01,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x62,0x03,
+0x1D,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x01,0x01,0x0A,0x00,0x01,0x01,0x61,0x03,
+0x01,0x01,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x20,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x0E,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x02,0x22,0x00,0x60,0x03,0x10,0x00,0x5C,0x03,0x01,0x02,0x23,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x01,0x11,0x00,0x5B,0x03,0x25,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x12,0x00,0x01,0x01,0x59,0x03,0x27,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x14,0x00,
+0x01,0x01,0x57,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x17,0x00,
+0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x19,0x00,0x01,0x02,
+0x51,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,
+0x4F,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x4D,0x03,0x01,0x01,0x32,0x00,0x50,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x49,0x03,
+0x01,0x02,0x35,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x47,0x03,
+0x01,0x01,0x37,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x43,0x03,
+0x01,0x02,0x3B,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x01,0x02,
+0x3F,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,
+0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
+0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x46,0x00,
+0x01,0x01,0x3B,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
+0x01,0x02,0x01,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x01,0x3B,0x00,
+0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x02,0x31,0x03,
+0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
+0x57,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x02,0x01,
+0x02,0x02,0x15,0x03,0x02,0x02,0x02,0x01,0x60,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
+0x01,0x02,0x01,0x01,0x55,0x00,0x0C,0x01,0x6D,0x00,0x02,0x01,0x02,0x02,0x16,0x03,
+0x02,0x02,0x01,0x01,0xDB,0x00,0x0D,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x05,0x00,
+
 };
 static const DiffBlock THINKING_FRAME3_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    39, 60,  // Changed box top-left
+    240, 64,  // Changed box dimensions
     THINKING_FRAME3_DATA
 };
 
-// Frame 4: Full frame RLE (1274 bytes)
-static const uint8_t THINKING_FRAME4_DATA[1274] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x3F,0x00,0x0D,0x01,0x08,0x02,0x09,0x01,0x6C,0x00,0x05,0x01,0x06,0x02,0x0D,0x03,
-0x04,0x02,0x02,0x01,0x84,0x00,0x05,0x01,0x06,0x02,0x2C,0x03,0x02,0x02,0x02,0x01,
-0x56,0x00,0x04,0x01,0x03,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x72,0x00,0x04,0x01,
-0x04,0x02,0x42,0x03,0x02,0x02,0x01,0x01,0x47,0x00,0x03,0x01,0x04,0x02,0x34,0x03,
-0x01,0x02,0x66,0x00,0x03,0x01,0x04,0x02,0x50,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,
-0x04,0x01,0x03,0x02,0x3F,0x03,0x01,0x02,0x5F,0x00,0x02,0x01,0x02,0x02,0x5B,0x03,
-0x01,0x02,0x32,0x00,0x03,0x01,0x03,0x02,0x49,0x03,0x01,0x02,0x59,0x00,0x01,0x01,
-0x02,0x02,0x62,0x03,0x01,0x01,0x2A,0x00,0x02,0x01,0x03,0x02,0x52,0x03,0x56,0x00,
-0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x02,0x02,0x59,0x03,
-0x01,0x01,0x52,0x00,0x01,0x01,0x01,0x02,0x6A,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x02,0x02,0x5E,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x1B,0x00,
-0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x50,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,
-0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x6D,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,
-0x6D,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x4F,0x00,0x01,0x02,
-0x6D,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x6C,0x03,0x50,0x00,0x01,0x01,0x6D,0x03,
-0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x50,0x00,0x01,0x01,0x6D,0x03,
-0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x51,0x00,0x6C,0x03,0x01,0x02,
-0x14,0x00,0x6D,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,
-0x01,0x02,0x6C,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x14,0x00,
-0x01,0x02,0x6B,0x03,0x01,0x02,0x53,0x00,0x6B,0x03,0x15,0x00,0x01,0x01,0x6B,0x03,
-0x01,0x02,0x53,0x00,0x01,0x02,0x69,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x6A,0x03,
-0x01,0x01,0x53,0x00,0x01,0x01,0x69,0x03,0x17,0x00,0x01,0x01,0x6A,0x03,0x55,0x00,
-0x01,0x02,0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x55,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x68,0x03,0x57,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x58,0x00,0x65,0x03,
-0x01,0x01,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x58,0x00,0x01,0x01,0x63,0x03,
-0x01,0x01,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x5A,0x00,0x01,0x02,0x61,0x03,
-0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x61,0x03,0x1F,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,0x5F,0x03,
-0x01,0x01,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x01,0x22,0x00,0x01,0x02,0x5F,0x03,0x60,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
-0x24,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
-0x25,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
-0x27,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
-0x29,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x67,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
-0x2B,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x69,0x00,0x01,0x02,0x51,0x03,0x01,0x01,
-0x2D,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
-0x01,0x01,0x30,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x6E,0x00,0x4C,0x03,0x01,0x02,
-0x33,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x71,0x00,0x01,0x02,0x49,0x03,0x01,0x01,
-0x35,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
-0x39,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x77,0x00,0x01,0x01,0x42,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x7A,0x00,0x01,0x01,0x3E,0x03,
-0x01,0x01,0x40,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x7E,0x00,0x01,0x01,
+// Frame 4: Diff RLE (852 bytes)
+static const uint8_t THINKING_FRAME4_DATA[852] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x08,0x00,0x0D,0x01,0x08,0x02,0x09,0x01,
+0x6C,0x00,0x05,0x01,0x06,0x02,0x0D,0x03,0x04,0x02,0x02,0x01,0x35,0x00,0x05,0x01,
+0x06,0x02,0x2C,0x03,0x02,0x02,0x02,0x01,0x56,0x00,0x04,0x01,0x03,0x02,0x26,0x03,
+0x01,0x02,0x01,0x01,0x23,0x00,0x04,0x01,0x04,0x02,0x42,0x03,0x02,0x02,0x01,0x01,
+0x47,0x00,0x03,0x01,0x04,0x02,0x34,0x03,0x01,0x02,0x17,0x00,0x03,0x01,0x04,0x02,
+0x50,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x04,0x01,0x03,0x02,0x3F,0x03,0x01,0x02,
+0x10,0x00,0x02,0x01,0x02,0x02,0x5B,0x03,0x01,0x02,0x32,0x00,0x03,0x01,0x03,0x02,
+0x49,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x02,0x02,0x62,0x03,0x01,0x01,0x2A,0x00,
+0x02,0x01,0x03,0x02,0x52,0x03,0x07,0x00,0x01,0x01,0x01,0x02,0x66,0x03,0x01,0x02,
+0x25,0x00,0x01,0x01,0x02,0x02,0x59,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x01,0x02,
+0x6A,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x02,0x02,0x5E,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
+0x01,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x01,0x01,0x02,
+0x66,0x03,0x02,0x01,0x6D,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x69,0x03,0x01,0x01,
+0x01,0x02,0x6D,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x01,0x02,
+0x6D,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x00,0x01,0x01,0x6D,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x01,0x00,0x01,0x01,0x6D,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x02,0x00,0x6C,0x03,0x01,0x02,
+0x14,0x00,0x6D,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,
+0x01,0x02,0x6C,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x14,0x00,
+0x01,0x02,0x6B,0x03,0x01,0x02,0x04,0x00,0x6B,0x03,0x15,0x00,0x01,0x01,0x6B,0x03,
+0x01,0x02,0x04,0x00,0x01,0x02,0x69,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x6A,0x03,
+0x01,0x01,0x04,0x00,0x01,0x01,0x69,0x03,0x17,0x00,0x01,0x01,0x6A,0x03,0x06,0x00,
+0x01,0x02,0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x06,0x00,
+0x01,0x01,0x67,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x68,0x03,0x08,0x00,0x01,0x02,
+0x65,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x66,0x03,0x01,0x02,0x09,0x00,0x65,0x03,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x63,0x03,
+0x01,0x01,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x61,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x0B,0x00,0x01,0x01,
+0x61,0x03,0x1F,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x01,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x01,0x22,0x00,0x01,0x02,0x5F,0x03,0x11,0x00,0x01,0x02,0x5B,0x03,0x01,0x02,
+0x24,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x25,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x57,0x03,0x01,0x02,
+0x27,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x16,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x29,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x53,0x03,0x01,0x02,
+0x2B,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x51,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
+0x01,0x01,0x30,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x1F,0x00,0x4C,0x03,0x01,0x02,
+0x33,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x49,0x03,0x01,0x01,
+0x35,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x45,0x03,0x01,0x01,
+0x39,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x42,0x03,0x01,0x02,
+0x3C,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x3E,0x03,
+0x01,0x01,0x40,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,
 0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,
-0x01,0x01,0x82,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
-0x01,0x02,0x39,0x03,0x01,0x02,0x88,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,
-0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,
+0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x49,0x00,
+0x01,0x02,0x39,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,
+0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,
 0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x02,0x01,0x95,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,
-0x02,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,
+0x2C,0x03,0x01,0x02,0x02,0x01,0x46,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,
+0x02,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x51,0x00,
 0x04,0x01,0x0A,0x02,0x04,0x01,0x68,0x00,0x01,0x01,0x02,0x02,0x1B,0x03,0x01,0x02,
-0x02,0x01,0xFF,0x00,0x26,0x00,0x02,0x01,0x05,0x02,0x05,0x03,0x05,0x02,0x03,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x94,0x00,
+0x02,0x01,0xD6,0x00,0x02,0x01,0x05,0x02,0x05,0x03,0x05,0x02,0x03,0x01,0xFF,0x00,
+0xFF,0x00,0x14,0x00,
 };
 static const DiffBlock THINKING_FRAME4_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    39, 66,  // Changed box top-left
+    241, 55,  // Changed box dimensions
     THINKING_FRAME4_DATA
 };
 
-// Frame 5: Full frame RLE (1224 bytes)
-static const uint8_t THINKING_FRAME5_DATA[1224] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x5C,0x00,0x07,0x01,0x09,0x02,0x03,0x01,0xA0,0x00,
-0x1A,0x01,0x65,0x00,0x05,0x01,0x04,0x02,0x19,0x03,0x01,0x02,0x88,0x00,0x07,0x01,
-0x08,0x02,0x24,0x03,0x02,0x02,0x01,0x01,0x55,0x00,0x03,0x01,0x04,0x02,0x26,0x03,
-0x01,0x02,0x76,0x00,0x05,0x01,0x07,0x02,0x3C,0x03,0x01,0x01,0x49,0x00,0x03,0x01,
-0x04,0x02,0x31,0x03,0x01,0x01,0x68,0x00,0x04,0x01,0x04,0x02,0x4E,0x03,0x01,0x01,
-0x3F,0x00,0x03,0x01,0x03,0x02,0x3B,0x03,0x01,0x01,0x5E,0x00,0x03,0x01,0x03,0x02,
-0x5A,0x03,0x01,0x01,0x37,0x00,0x02,0x01,0x03,0x02,0x44,0x03,0x01,0x01,0x58,0x00,
-0x01,0x01,0x02,0x02,0x63,0x03,0x01,0x01,0x2F,0x00,0x02,0x01,0x02,0x02,0x4D,0x03,
-0x01,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x01,0x28,0x00,0x02,0x01,
-0x02,0x02,0x54,0x03,0x01,0x01,0x51,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x01,0x01,
-0x21,0x00,0x02,0x01,0x02,0x02,0x5B,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,0x6D,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x01,0x02,0x02,0x61,0x03,0x01,0x01,0x4F,0x00,0x01,0x01,
-0x6D,0x03,0x01,0x02,0x18,0x00,0x02,0x01,0x01,0x02,0x66,0x03,0x50,0x00,0x01,0x01,
-0x6D,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x02,0x51,0x00,
-0x6D,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x51,0x00,0x6D,0x03,
-0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x51,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,
-0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x51,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,
-0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x52,0x00,0x01,0x02,0x6A,0x03,0x15,0x00,
-0x01,0x01,0x6B,0x03,0x01,0x02,0x53,0x00,0x01,0x02,0x69,0x03,0x01,0x02,0x16,0x00,
-0x01,0x02,0x6A,0x03,0x01,0x01,0x53,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x16,0x00,
-0x01,0x01,0x6A,0x03,0x01,0x01,0x54,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x18,0x00,
-0x01,0x02,0x68,0x03,0x01,0x02,0x55,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x18,0x00,
-0x01,0x01,0x68,0x03,0x01,0x01,0x56,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x1A,0x00,
-0x68,0x03,0x58,0x00,0x65,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
-0x58,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x64,0x03,0x01,0x02,
-0x5A,0x00,0x01,0x02,0x62,0x03,0x1D,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x5A,0x00,
-0x01,0x01,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5C,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x61,0x03,0x5E,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x02,0x22,0x00,0x60,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5C,0x03,
-0x24,0x00,0x5E,0x03,0x01,0x02,0x61,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x24,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x28,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x67,0x00,0x01,0x02,0x54,0x03,0x2B,0x00,0x01,0x01,
-0x56,0x03,0x01,0x02,0x69,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,
-0x54,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x01,0x01,0x32,0x00,
-0x01,0x02,0x4F,0x03,0x71,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x35,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x38,0x00,0x01,0x01,
-0x49,0x03,0x01,0x02,0x77,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,
-0x46,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,
-0x01,0x02,0x42,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x01,0x01,
-0x43,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x82,0x00,0x01,0x01,
-0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x02,0x01,0x01,0x87,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x02,0x01,
-0x4C,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x8D,0x00,0x02,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x53,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,
-0x01,0x02,0x02,0x01,0x95,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,
-0x5B,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0xA0,0x00,0x03,0x01,
-0x0B,0x02,0x04,0x01,0x67,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0x25,0x00,0x03,0x01,0x04,0x02,0x07,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x94,0x00,
+// Frame 5: Diff RLE (788 bytes)
+static const uint8_t THINKING_FRAME5_DATA[788] = {
+0xFF,0x00,0xFF,0x00,0xBE,0x00,0x07,0x01,0x09,0x02,0x03,0x01,0x51,0x00,0x1A,0x01,
+0x65,0x00,0x05,0x01,0x04,0x02,0x19,0x03,0x01,0x02,0x39,0x00,0x07,0x01,0x08,0x02,
+0x24,0x03,0x02,0x02,0x01,0x01,0x55,0x00,0x03,0x01,0x04,0x02,0x26,0x03,0x01,0x02,
+0x27,0x00,0x05,0x01,0x07,0x02,0x3C,0x03,0x01,0x01,0x49,0x00,0x03,0x01,0x04,0x02,
+0x31,0x03,0x01,0x01,0x19,0x00,0x04,0x01,0x04,0x02,0x4E,0x03,0x01,0x01,0x3F,0x00,
+0x03,0x01,0x03,0x02,0x3B,0x03,0x01,0x01,0x0F,0x00,0x03,0x01,0x03,0x02,0x5A,0x03,
+0x01,0x01,0x37,0x00,0x02,0x01,0x03,0x02,0x44,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x02,0x02,0x63,0x03,0x01,0x01,0x2F,0x00,0x02,0x01,0x02,0x02,0x4D,0x03,0x01,0x01,
+0x04,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x01,0x28,0x00,0x02,0x01,0x02,0x02,
+0x54,0x03,0x01,0x01,0x02,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x01,0x01,0x21,0x00,
+0x02,0x01,0x02,0x02,0x5B,0x03,0x02,0x01,0x6D,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,
+0x02,0x02,0x61,0x03,0x02,0x01,0x6D,0x03,0x01,0x02,0x18,0x00,0x02,0x01,0x01,0x02,
+0x66,0x03,0x01,0x00,0x01,0x01,0x6D,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x01,0x02,
+0x69,0x03,0x01,0x02,0x02,0x00,0x6D,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x6B,0x03,
+0x01,0x02,0x02,0x00,0x6D,0x03,0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x02,0x02,0x00,
+0x01,0x02,0x6B,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x02,0x00,
+0x01,0x01,0x6B,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x6C,0x03,0x01,0x01,0x03,0x00,
+0x01,0x02,0x6A,0x03,0x15,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x04,0x00,0x01,0x02,
+0x69,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x04,0x00,0x01,0x01,
+0x69,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x05,0x00,0x01,0x01,
+0x67,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x68,0x03,0x01,0x02,0x06,0x00,0x01,0x01,
+0x67,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x07,0x00,0x01,0x01,
+0x65,0x03,0x01,0x02,0x1A,0x00,0x68,0x03,0x09,0x00,0x65,0x03,0x01,0x01,0x1A,0x00,
+0x01,0x01,0x66,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x02,0x64,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x62,0x03,0x1D,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,
+0x62,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x20,0x00,0x01,0x02,
+0x61,0x03,0x0F,0x00,0x01,0x02,0x5D,0x03,0x01,0x02,0x22,0x00,0x60,0x03,0x01,0x01,
+0x10,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x5E,0x03,0x01,0x02,0x12,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x01,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x14,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x16,0x00,0x01,0x02,
+0x56,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x18,0x00,0x01,0x02,
+0x54,0x03,0x2B,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x2D,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x4C,0x03,
+0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x02,0x4F,0x03,0x22,0x00,0x01,0x02,0x49,0x03,
+0x01,0x01,0x35,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x38,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x42,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x3E,0x03,
+0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
+0x39,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,
+0x01,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
+0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
+0x2D,0x03,0x01,0x02,0x02,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,
+0x01,0x01,0x3E,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x53,0x00,
+0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x02,0x01,0x46,0x00,0x01,0x01,0x02,0x02,
+0x1A,0x03,0x02,0x02,0x02,0x01,0x5B,0x00,0x02,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
+0x02,0x01,0x51,0x00,0x03,0x01,0x0B,0x02,0x04,0x01,0x67,0x00,0x02,0x01,0x01,0x02,
+0x1B,0x03,0x02,0x02,0x02,0x01,0xD5,0x00,0x03,0x01,0x04,0x02,0x07,0x03,0x04,0x02,
+0x03,0x01,0x30,0x00,
 };
 static const DiffBlock THINKING_FRAME5_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    39, 70,  // Changed box top-left
+    241, 49,  // Changed box dimensions
     THINKING_FRAME5_DATA
 };
 
-// Frame 6: Full frame RLE (1172 bytes)
-static const uint8_t THINKING_FRAME6_DATA[1172] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xF7,0x00,0x04,0x01,0x04,0x02,0x0A,0x03,0x01,0x02,0xFF,0x00,0x23,0x00,
-0x03,0x01,0x03,0x02,0x18,0x03,0x01,0x02,0xFF,0x00,0x17,0x00,0x04,0x01,0x03,0x02,
-0x22,0x03,0x01,0x02,0xFF,0x00,0x0E,0x00,0x03,0x01,0x03,0x02,0x2C,0x03,0x01,0x02,
-0xFF,0x00,0x05,0x00,0x03,0x01,0x03,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xFA,0x00,
-0x03,0x01,0x03,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0xA9,0x00,0x13,0x01,0x36,0x00,
-0x02,0x01,0x03,0x02,0x47,0x03,0x01,0x02,0x95,0x00,0x05,0x01,0x06,0x02,0x1F,0x03,
-0x01,0x02,0x2B,0x00,0x03,0x01,0x02,0x02,0x4F,0x03,0x01,0x02,0x83,0x00,0x05,0x01,
-0x05,0x02,0x33,0x03,0x01,0x02,0x23,0x00,0x02,0x01,0x02,0x02,0x57,0x03,0x01,0x02,
-0x74,0x00,0x04,0x01,0x04,0x02,0x44,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x02,0x02,
-0x5E,0x03,0x01,0x02,0x68,0x00,0x03,0x01,0x04,0x02,0x51,0x03,0x01,0x01,0x17,0x00,
-0x02,0x01,0x01,0x02,0x64,0x03,0x01,0x02,0x5F,0x00,0x03,0x01,0x02,0x02,0x5C,0x03,
-0x01,0x01,0x13,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,
-0x01,0x02,0x63,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x59,0x00,
-0x01,0x01,0x66,0x03,0x01,0x01,0x11,0x00,0x6D,0x03,0x5A,0x00,0x01,0x01,0x65,0x03,
-0x01,0x02,0x12,0x00,0x01,0x02,0x6B,0x03,0x01,0x02,0x5B,0x00,0x65,0x03,0x01,0x02,
-0x12,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x5B,0x00,0x65,0x03,0x01,0x01,0x13,0x00,
-0x01,0x02,0x6A,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x13,0x00,
-0x01,0x02,0x6A,0x03,0x5C,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
-0x69,0x03,0x01,0x02,0x5D,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x15,0x00,0x01,0x01,
-0x68,0x03,0x5E,0x00,0x01,0x02,0x62,0x03,0x17,0x00,0x67,0x03,0x01,0x02,0x5E,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x18,0x00,0x65,0x03,0x01,0x01,0x60,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x64,0x03,0x62,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x01,0x1A,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x63,0x00,0x5D,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x1D,0x00,0x5F,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x1E,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x01,0x67,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x20,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x22,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x23,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x25,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x52,0x03,0x28,0x00,0x01,0x01,
-0x54,0x03,0x71,0x00,0x01,0x01,0x50,0x03,0x2A,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x73,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
-0x75,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
-0x78,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x7B,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x45,0x03,
-0x01,0x01,0x7E,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x41,0x03,
-0x01,0x01,0x82,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x3C,0x03,
-0x01,0x02,0x01,0x01,0x86,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x40,0x00,
-0x01,0x02,0x38,0x03,0x01,0x02,0x8B,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,
-0x44,0x00,0x01,0x01,0x33,0x03,0x01,0x02,0x01,0x01,0x8F,0x00,0x01,0x01,0x01,0x02,
-0x30,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,
-0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x50,0x00,
-0x01,0x01,0x02,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0x9D,0x00,0x02,0x01,0x01,0x02,
-0x21,0x03,0x02,0x02,0x01,0x01,0x58,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x03,0x02,
-0x02,0x01,0xA7,0x00,0x02,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x64,0x00,
-0x10,0x01,0xB8,0x00,0x0A,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x7C,0x00,
+// Frame 6: Diff RLE (770 bytes)
+static const uint8_t THINKING_FRAME6_DATA[770] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0x19,0x00,0x04,0x01,0x04,0x02,0x0A,0x03,0x01,0x02,0xD6,0x00,
+0x03,0x01,0x03,0x02,0x18,0x03,0x01,0x02,0xCA,0x00,0x04,0x01,0x03,0x02,0x22,0x03,
+0x01,0x02,0xC1,0x00,0x03,0x01,0x03,0x02,0x2C,0x03,0x01,0x02,0xB8,0x00,0x03,0x01,
+0x03,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0xAE,0x00,0x03,0x01,0x03,0x02,0x3E,0x03,
+0x01,0x02,0x01,0x01,0x5D,0x00,0x13,0x01,0x36,0x00,0x02,0x01,0x03,0x02,0x47,0x03,
+0x01,0x02,0x49,0x00,0x05,0x01,0x06,0x02,0x1F,0x03,0x01,0x02,0x2B,0x00,0x03,0x01,
+0x02,0x02,0x4F,0x03,0x01,0x02,0x37,0x00,0x05,0x01,0x05,0x02,0x33,0x03,0x01,0x02,
+0x23,0x00,0x02,0x01,0x02,0x02,0x57,0x03,0x01,0x02,0x28,0x00,0x04,0x01,0x04,0x02,
+0x44,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x02,0x02,0x5E,0x03,0x01,0x02,0x1C,0x00,
+0x03,0x01,0x04,0x02,0x51,0x03,0x01,0x01,0x17,0x00,0x02,0x01,0x01,0x02,0x64,0x03,
+0x01,0x02,0x13,0x00,0x03,0x01,0x02,0x02,0x5C,0x03,0x01,0x01,0x13,0x00,0x01,0x01,
+0x01,0x02,0x69,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,
+0x11,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,0x66,0x03,0x01,0x01,
+0x11,0x00,0x6D,0x03,0x0E,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x12,0x00,0x01,0x02,
+0x6B,0x03,0x01,0x02,0x0F,0x00,0x65,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x6B,0x03,
+0x01,0x01,0x0F,0x00,0x65,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x6A,0x03,0x10,0x00,
+0x01,0x01,0x63,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x11,0x00,
+0x01,0x02,0x62,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x68,0x03,0x12,0x00,0x01,0x02,
+0x62,0x03,0x17,0x00,0x67,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x17,0x00,0x01,0x01,0x66,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x60,0x03,0x01,0x01,
+0x18,0x00,0x65,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x19,0x00,
+0x01,0x01,0x64,0x03,0x16,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,
+0x62,0x03,0x01,0x01,0x17,0x00,0x5D,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x18,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x1D,0x00,0x5F,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
+0x1C,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
+0x1E,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
+0x20,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
+0x22,0x00,0x01,0x02,0x52,0x03,0x28,0x00,0x01,0x01,0x54,0x03,0x25,0x00,0x01,0x01,
+0x50,0x03,0x2A,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x4D,0x03,
+0x01,0x02,0x2D,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x4B,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x01,0x02,
+0x48,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,
+0x45,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x32,0x00,0x01,0x01,
+0x43,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x36,0x00,0x01,0x01,
+0x3F,0x03,0x01,0x01,0x3C,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,
+0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x40,0x00,0x01,0x02,0x38,0x03,0x01,0x02,
+0x3F,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x33,0x03,
+0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0x4A,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,
+0x01,0x02,0x29,0x03,0x02,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x02,0x02,0x22,0x03,
+0x02,0x02,0x01,0x01,0x51,0x00,0x02,0x01,0x01,0x02,0x21,0x03,0x02,0x02,0x01,0x01,
+0x58,0x00,0x02,0x01,0x02,0x02,0x16,0x03,0x03,0x02,0x02,0x01,0x5B,0x00,0x02,0x01,
+0x02,0x02,0x14,0x03,0x02,0x02,0x03,0x01,0x64,0x00,0x10,0x01,0x6C,0x00,0x0A,0x01,
+0xB1,0x00,
 };
 static const DiffBlock THINKING_FRAME6_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    39, 72,  // Changed box top-left
+    244, 65,  // Changed box dimensions
     THINKING_FRAME6_DATA
 };
 
-// Frame 7: Full frame RLE (1126 bytes)
-static const uint8_t THINKING_FRAME7_DATA[1126] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xD9,0x00,0x03,0x01,0x04,0x02,0x05,0x03,0x01,0x01,0xFF,0x00,0x2A,0x00,
-0x03,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0xFF,0x00,0x20,0x00,0x03,0x01,0x03,0x02,
-0x1A,0x03,0x01,0x02,0xFF,0x00,0x17,0x00,0x03,0x01,0x03,0x02,0x24,0x03,0xFF,0x00,
-0x0E,0x00,0x03,0x01,0x03,0x02,0x2D,0x03,0xFF,0x00,0x05,0x00,0x03,0x01,0x04,0x02,
-0x35,0x03,0xFC,0x00,0x03,0x01,0x03,0x02,0x3E,0x03,0xF4,0x00,0x02,0x01,0x03,0x02,
-0x47,0x03,0xEC,0x00,0x02,0x01,0x03,0x02,0x4E,0x03,0x01,0x02,0xE5,0x00,0x02,0x01,
-0x02,0x02,0x56,0x03,0x01,0x02,0xDE,0x00,0x01,0x01,0x02,0x02,0x5E,0x03,0x01,0x02,
-0xD7,0x00,0x02,0x01,0x02,0x02,0x64,0x03,0x01,0x01,0xB3,0x00,0x0F,0x01,0x11,0x00,
-0x01,0x01,0x01,0x02,0x6A,0x03,0x01,0x01,0x9E,0x00,0x07,0x01,0x06,0x02,0x17,0x03,
-0x01,0x01,0x0F,0x00,0x01,0x02,0x6C,0x03,0x8D,0x00,0x06,0x01,0x07,0x02,0x29,0x03,
-0x01,0x01,0x0F,0x00,0x01,0x01,0x6B,0x03,0x01,0x02,0x7D,0x00,0x06,0x01,0x06,0x02,
-0x3A,0x03,0x01,0x01,0x10,0x00,0x6B,0x03,0x01,0x02,0x70,0x00,0x04,0x01,0x04,0x02,
-0x4B,0x03,0x11,0x00,0x01,0x02,0x6A,0x03,0x01,0x01,0x67,0x00,0x02,0x01,0x03,0x02,
-0x57,0x03,0x11,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x12,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x66,0x00,0x5D,0x03,0x01,0x02,
-0x12,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x67,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x13,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x67,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,
-0x13,0x00,0x01,0x01,0x66,0x03,0x68,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x15,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x69,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x16,0x00,
-0x63,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x16,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x6B,0x00,0x59,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x60,0x03,
-0x01,0x01,0x6C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x02,0x6E,0x00,0x57,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,
-0x6F,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x1C,0x00,0x5C,0x03,0x71,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x1E,0x00,0x59,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x53,0x03,
-0x01,0x02,0x1F,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x74,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x21,0x00,0x55,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x23,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x78,0x00,0x4F,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x50,0x03,0x01,0x01,0x7A,0x00,0x4D,0x03,0x01,0x02,0x27,0x00,0x01,0x01,
-0x4D,0x03,0x01,0x02,0x7C,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x29,0x00,0x01,0x01,
-0x01,0x02,0x4A,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x2C,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x82,0x00,0x47,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x85,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x31,0x00,0x01,0x01,
-0x01,0x02,0x3F,0x03,0x01,0x01,0x88,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x35,0x00,
-0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x8C,0x00,0x3F,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x01,
-0x3B,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x95,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x47,0x00,
-0x02,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0xA1,0x00,0x01,0x01,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x03,0x01,0x04,0x02,0x0C,0x03,0x04,0x02,
-0x03,0x01,0xAA,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x1A,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x23,0x00,
-0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x52,0x00,
+// Frame 7: Diff RLE (720 bytes)
+static const uint8_t THINKING_FRAME7_DATA[720] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0x4D,0x00,0x03,0x01,0x04,0x02,0x05,0x03,0x01,0x01,0xD3,0x00,
+0x03,0x01,0x02,0x02,0x11,0x03,0x01,0x02,0xC9,0x00,0x03,0x01,0x03,0x02,0x1A,0x03,
+0x01,0x02,0xC0,0x00,0x03,0x01,0x03,0x02,0x24,0x03,0xB7,0x00,0x03,0x01,0x03,0x02,
+0x2D,0x03,0xAE,0x00,0x03,0x01,0x04,0x02,0x35,0x03,0xA6,0x00,0x03,0x01,0x03,0x02,
+0x3E,0x03,0x9E,0x00,0x02,0x01,0x03,0x02,0x47,0x03,0x96,0x00,0x02,0x01,0x03,0x02,
+0x4E,0x03,0x01,0x02,0x8F,0x00,0x02,0x01,0x02,0x02,0x56,0x03,0x01,0x02,0x88,0x00,
+0x01,0x01,0x02,0x02,0x5E,0x03,0x01,0x02,0x81,0x00,0x02,0x01,0x02,0x02,0x64,0x03,
+0x01,0x01,0x5D,0x00,0x0F,0x01,0x11,0x00,0x01,0x01,0x01,0x02,0x6A,0x03,0x01,0x01,
+0x48,0x00,0x07,0x01,0x06,0x02,0x17,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6C,0x03,
+0x37,0x00,0x06,0x01,0x07,0x02,0x29,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6B,0x03,
+0x01,0x02,0x27,0x00,0x06,0x01,0x06,0x02,0x3A,0x03,0x01,0x01,0x10,0x00,0x6B,0x03,
+0x01,0x02,0x1A,0x00,0x04,0x01,0x04,0x02,0x4B,0x03,0x11,0x00,0x01,0x02,0x6A,0x03,
+0x01,0x01,0x11,0x00,0x02,0x01,0x03,0x02,0x57,0x03,0x11,0x00,0x01,0x01,0x69,0x03,
+0x01,0x02,0x10,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x12,0x00,0x01,0x02,0x68,0x03,
+0x01,0x01,0x10,0x00,0x5D,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x67,0x03,0x01,0x02,
+0x11,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
+0x11,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x66,0x03,0x12,0x00,
+0x01,0x01,0x5B,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x13,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x16,0x00,0x63,0x03,0x01,0x02,0x14,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x15,0x00,0x59,0x03,
+0x01,0x02,0x18,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x19,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x18,0x00,0x57,0x03,0x01,0x02,
+0x1B,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
+0x1C,0x00,0x5C,0x03,0x1B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1E,0x00,0x59,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x21,0x00,0x55,0x03,0x01,0x02,
+0x20,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
+0x22,0x00,0x4F,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x24,0x00,
+0x4D,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x01,0x28,0x00,
+0x01,0x01,0x49,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x2C,0x00,
+0x47,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x2F,0x00,0x01,0x02,
+0x44,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0x32,0x00,
+0x01,0x01,0x41,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x36,0x00,0x3F,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
+0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x3B,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x37,0x03,0x01,0x01,
+0x42,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x02,
+0x32,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,
+0x02,0x01,0x4B,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,
+0x03,0x01,0x04,0x02,0x0C,0x03,0x04,0x02,0x03,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
+0x26,0x03,0x01,0x02,0x01,0x01,0xC3,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,
+0x01,0x01,0xCC,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x03,0x01,0xA2,0x00,
+
 };
 static const DiffBlock THINKING_FRAME7_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    51, 90,  // Changed box top-left
+    234, 67,  // Changed box dimensions
     THINKING_FRAME7_DATA
 };
 
-// Frame 8: Full frame RLE (1136 bytes)
-static const uint8_t THINKING_FRAME8_DATA[1136] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x65,0x00,0x03,0x01,0x04,0x02,0x02,0x03,0x01,0x01,0xFF,0x00,0x2E,0x00,
-0x02,0x01,0x03,0x02,0x0D,0x03,0x01,0x02,0xFF,0x00,0x25,0x00,0x02,0x01,0x03,0x02,
-0x16,0x03,0x01,0x02,0xFF,0x00,0x1C,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,
-0xFF,0x00,0x14,0x00,0x03,0x01,0x02,0x02,0x27,0x03,0x01,0x02,0xFF,0x00,0x0C,0x00,
-0x02,0x01,0x03,0x02,0x2F,0x03,0x01,0x02,0xFF,0x00,0x03,0x00,0x03,0x01,0x02,0x02,
-0x38,0x03,0x01,0x02,0xFA,0x00,0x03,0x01,0x02,0x02,0x40,0x03,0x01,0x02,0xF1,0x00,
-0x03,0x01,0x03,0x02,0x48,0x03,0x01,0x02,0xE9,0x00,0x03,0x01,0x03,0x02,0x50,0x03,
-0x01,0x02,0xE1,0x00,0x03,0x01,0x02,0x02,0x59,0x03,0x01,0x01,0xDA,0x00,0x02,0x01,
-0x02,0x02,0x61,0x03,0x01,0x01,0xD4,0x00,0x01,0x01,0x02,0x02,0x68,0x03,0x01,0x01,
-0xD2,0x00,0x01,0x02,0x6C,0x03,0xB7,0x00,0x06,0x01,0x06,0x02,0x01,0x01,0x0F,0x00,
-0x01,0x02,0x6B,0x03,0x01,0x02,0xA4,0x00,0x06,0x01,0x04,0x02,0x15,0x03,0x01,0x02,
-0x0F,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x93,0x00,0x05,0x01,0x05,0x02,0x26,0x03,
-0x01,0x02,0x10,0x00,0x01,0x02,0x6A,0x03,0x83,0x00,0x06,0x01,0x05,0x02,0x36,0x03,
-0x01,0x02,0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x73,0x00,0x06,0x01,0x06,0x02,
-0x45,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x69,0x00,0x02,0x01,
-0x05,0x02,0x54,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x6A,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x6A,0x00,
-0x01,0x02,0x5A,0x03,0x14,0x00,0x65,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x15,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x6D,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x15,0x00,0x01,0x01,0x62,0x03,0x6E,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
-0x17,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x6F,0x00,0x57,0x03,0x01,0x01,0x18,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x02,0x70,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x1A,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x72,0x00,0x55,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x75,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x1E,0x00,0x57,0x03,
-0x01,0x02,0x76,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x20,0x00,0x55,0x03,0x01,0x01,
-0x78,0x00,0x01,0x01,0x50,0x03,0x22,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x7A,0x00,
-0x01,0x02,0x4E,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x7D,0x00,
-0x4D,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x7F,0x00,0x4B,0x03,
-0x01,0x01,0x28,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x49,0x03,
-0x01,0x01,0x2A,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x83,0x00,0x01,0x01,
-0x47,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x87,0x00,
-0x45,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x8A,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x37,0x00,0x01,0x01,
-0x34,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x3B,0x00,
-0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x97,0x00,0x01,0x01,0x38,0x03,
-0x01,0x02,0x41,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x9D,0x00,
-0x01,0x01,0x34,0x03,0x01,0x02,0x46,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x02,0x02,
-0x01,0x01,0xA4,0x00,0x01,0x01,0x30,0x03,0x01,0x01,0x4E,0x00,0x02,0x01,0x04,0x02,
-0x09,0x03,0x04,0x02,0x03,0x01,0xAC,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x01,
-0xFF,0x00,0x17,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,
-0x1E,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x28,0x00,
-0x04,0x01,0x0A,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x8A,0x00,
+// Frame 8: Diff RLE (704 bytes)
+static const uint8_t THINKING_FRAME8_DATA[704] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x07,0x00,0x03,0x01,
+0x04,0x02,0x02,0x03,0x01,0x01,0xCA,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x01,0x02,
+0xC1,0x00,0x02,0x01,0x03,0x02,0x16,0x03,0x01,0x02,0xB8,0x00,0x03,0x01,0x02,0x02,
+0x1F,0x03,0x01,0x02,0xB0,0x00,0x03,0x01,0x02,0x02,0x27,0x03,0x01,0x02,0xA8,0x00,
+0x02,0x01,0x03,0x02,0x2F,0x03,0x01,0x02,0x9F,0x00,0x03,0x01,0x02,0x02,0x38,0x03,
+0x01,0x02,0x97,0x00,0x03,0x01,0x02,0x02,0x40,0x03,0x01,0x02,0x8E,0x00,0x03,0x01,
+0x03,0x02,0x48,0x03,0x01,0x02,0x86,0x00,0x03,0x01,0x03,0x02,0x50,0x03,0x01,0x02,
+0x7E,0x00,0x03,0x01,0x02,0x02,0x59,0x03,0x01,0x01,0x77,0x00,0x02,0x01,0x02,0x02,
+0x61,0x03,0x01,0x01,0x71,0x00,0x01,0x01,0x02,0x02,0x68,0x03,0x01,0x01,0x6F,0x00,
+0x01,0x02,0x6C,0x03,0x54,0x00,0x06,0x01,0x06,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x6B,0x03,0x01,0x02,0x41,0x00,0x06,0x01,0x04,0x02,0x15,0x03,0x01,0x02,0x0F,0x00,
+0x01,0x01,0x6B,0x03,0x01,0x01,0x30,0x00,0x05,0x01,0x05,0x02,0x26,0x03,0x01,0x02,
+0x10,0x00,0x01,0x02,0x6A,0x03,0x20,0x00,0x06,0x01,0x05,0x02,0x36,0x03,0x01,0x02,
+0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x10,0x00,0x06,0x01,0x06,0x02,0x45,0x03,
+0x01,0x01,0x11,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x06,0x00,0x02,0x01,0x05,0x02,
+0x54,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x07,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x07,0x00,0x01,0x02,
+0x5A,0x03,0x14,0x00,0x65,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x15,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x15,0x00,0x01,0x01,0x62,0x03,0x0B,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x17,0x00,
+0x01,0x01,0x60,0x03,0x01,0x01,0x0C,0x00,0x57,0x03,0x01,0x01,0x18,0x00,0x01,0x02,
+0x5E,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x0F,0x00,0x55,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x10,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x12,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x1E,0x00,0x57,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x20,0x00,0x55,0x03,0x01,0x01,0x15,0x00,
+0x01,0x01,0x50,0x03,0x22,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x17,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,0x1A,0x00,0x4D,0x03,
+0x01,0x01,0x25,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x1C,0x00,0x4B,0x03,0x01,0x01,
+0x28,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x1E,0x00,0x01,0x01,0x49,0x03,0x01,0x01,
+0x2A,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x47,0x03,
+0x01,0x01,0x2D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x45,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x27,0x00,
+0x01,0x02,0x41,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x37,0x00,0x01,0x01,0x34,0x03,
+0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,
+0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x38,0x03,0x01,0x02,
+0x41,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,
+0x34,0x03,0x01,0x02,0x46,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x02,0x02,0x01,0x01,
+0x41,0x00,0x01,0x01,0x30,0x03,0x01,0x01,0x4E,0x00,0x02,0x01,0x04,0x02,0x09,0x03,
+0x04,0x02,0x03,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x01,0xB3,0x00,
+0x01,0x01,0x01,0x02,0x22,0x03,0x02,0x02,0x01,0x01,0xBA,0x00,0x02,0x01,0x02,0x02,
+0x17,0x03,0x02,0x02,0x02,0x01,0xC4,0x00,0x04,0x01,0x0A,0x02,0x04,0x01,0xA4,0x00,
 
 };
 static const DiffBlock THINKING_FRAME8_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    65, 109,  // Changed box top-left
+    221, 55,  // Changed box dimensions
     THINKING_FRAME8_DATA
 };
 
-// Frame 9: Full frame RLE (1134 bytes)
-static const uint8_t THINKING_FRAME9_DATA[1134] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE8,0x00,0x03,0x01,0x03,0x02,0x02,0x03,0x01,0x02,
-0xFF,0x00,0x2F,0x00,0x03,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,0xFF,0x00,0x26,0x00,
-0x02,0x01,0x02,0x02,0x16,0x03,0x01,0x01,0xFF,0x00,0x1D,0x00,0x03,0x01,0x02,0x02,
-0x1E,0x03,0x01,0x01,0xFF,0x00,0x15,0x00,0x02,0x01,0x03,0x02,0x26,0x03,0x01,0x01,
-0xFF,0x00,0x0C,0x00,0x03,0x01,0x03,0x02,0x2E,0x03,0x01,0x01,0xFF,0x00,0x03,0x00,
-0x04,0x01,0x03,0x02,0x36,0x03,0x01,0x01,0xFA,0x00,0x03,0x01,0x03,0x02,0x3F,0x03,
-0x01,0x01,0xF2,0x00,0x03,0x01,0x03,0x02,0x47,0x03,0x01,0x01,0xEA,0x00,0x03,0x01,
-0x02,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0xE3,0x00,0x02,0x01,0x02,0x02,0x57,0x03,
-0x01,0x02,0xDC,0x00,0x02,0x01,0x02,0x02,0x5F,0x03,0x01,0x02,0xD4,0x00,0x02,0x01,
-0x02,0x02,0x67,0x03,0x01,0x01,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0xD2,0x00,
-0x01,0x01,0x6C,0x03,0xAF,0x00,0x06,0x01,0x07,0x02,0x08,0x03,0x01,0x01,0x0F,0x00,
-0x01,0x02,0x6A,0x03,0x01,0x02,0x9D,0x00,0x06,0x01,0x07,0x02,0x1A,0x03,0x01,0x01,
-0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x8D,0x00,0x06,0x01,0x06,0x02,0x2B,0x03,
-0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x7E,0x00,0x05,0x01,0x05,0x02,0x3D,0x03,
-0x11,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x6F,0x00,0x05,0x01,0x04,0x02,0x4C,0x03,
-0x01,0x02,0x12,0x00,0x68,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x6D,0x00,0x01,0x02,0x58,0x03,0x15,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x6E,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x16,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x6F,0x00,0x57,0x03,0x01,0x01,0x17,0x00,0x60,0x03,
-0x01,0x02,0x70,0x00,0x01,0x02,0x56,0x03,0x18,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,
-0x71,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
-0x73,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
-0x74,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x1C,0x00,0x01,0x02,0x59,0x03,0x76,0x00,
-0x01,0x02,0x52,0x03,0x1E,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x77,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x79,0x00,0x01,0x01,
-0x4F,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,
-0x4D,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x80,0x00,
-0x4B,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x82,0x00,0x01,0x01,
-0x49,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x85,0x00,
-0x47,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,
-0x88,0x00,0x44,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x01,0x01,
-0x8B,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x01,0x01,0x8F,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x37,0x00,0x01,0x02,
-0x33,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x01,
-0x38,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,0x01,0x01,
-0x9E,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x46,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,
-0x02,0x02,0x02,0x01,0xA5,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
-0x03,0x01,0x0E,0x02,0x03,0x01,0xAE,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x17,0x00,0x01,0x01,0x02,0x02,0x21,0x03,0x02,0x02,0x01,0x01,
-0xFF,0x00,0x1E,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x28,0x00,0x03,0x01,0x0B,0x02,0x04,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x07,0x00,
+// Frame 9: Diff RLE (694 bytes)
+static const uint8_t THINKING_FRAME9_DATA[694] = {
+0xFF,0x00,0xFF,0x00,0x86,0x00,0x03,0x01,0x03,0x02,0x02,0x03,0x01,0x02,0xC8,0x00,
+0x03,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,0xBF,0x00,0x02,0x01,0x02,0x02,0x16,0x03,
+0x01,0x01,0xB6,0x00,0x03,0x01,0x02,0x02,0x1E,0x03,0x01,0x01,0xAE,0x00,0x02,0x01,
+0x03,0x02,0x26,0x03,0x01,0x01,0xA5,0x00,0x03,0x01,0x03,0x02,0x2E,0x03,0x01,0x01,
+0x9C,0x00,0x04,0x01,0x03,0x02,0x36,0x03,0x01,0x01,0x94,0x00,0x03,0x01,0x03,0x02,
+0x3F,0x03,0x01,0x01,0x8C,0x00,0x03,0x01,0x03,0x02,0x47,0x03,0x01,0x01,0x84,0x00,
+0x03,0x01,0x02,0x02,0x4F,0x03,0x01,0x02,0x01,0x01,0x7D,0x00,0x02,0x01,0x02,0x02,
+0x57,0x03,0x01,0x02,0x76,0x00,0x02,0x01,0x02,0x02,0x5F,0x03,0x01,0x02,0x6E,0x00,
+0x02,0x01,0x02,0x02,0x67,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,
+0x6C,0x00,0x01,0x01,0x6C,0x03,0x49,0x00,0x06,0x01,0x07,0x02,0x08,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x37,0x00,0x06,0x01,0x07,0x02,0x1A,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x27,0x00,0x06,0x01,0x06,0x02,
+0x2B,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x18,0x00,0x05,0x01,0x05,0x02,
+0x3D,0x03,0x11,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x09,0x00,0x05,0x01,0x04,0x02,
+0x4C,0x03,0x01,0x02,0x12,0x00,0x68,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x58,0x03,
+0x15,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x16,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x09,0x00,0x57,0x03,0x01,0x01,0x17,0x00,
+0x60,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x56,0x03,0x18,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x0E,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x1C,0x00,0x01,0x02,0x59,0x03,
+0x10,0x00,0x01,0x02,0x52,0x03,0x1E,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x11,0x00,
+0x01,0x01,0x51,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x13,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x21,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x15,0x00,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x23,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x01,0x01,
+0x17,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,
+0x1A,0x00,0x4B,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x49,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,
+0x1F,0x00,0x47,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,
+0x01,0x01,0x22,0x00,0x44,0x03,0x01,0x02,0x30,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,
+0x01,0x01,0x25,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,
+0x38,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x37,0x00,
+0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,
+0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x32,0x00,
+0x01,0x01,0x38,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x02,0x02,
+0x01,0x01,0x38,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x46,0x00,0x02,0x01,0x01,0x02,
+0x1A,0x03,0x02,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x01,0x01,
+0x4E,0x00,0x03,0x01,0x0E,0x02,0x03,0x01,0x48,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
+0x01,0x02,0x01,0x01,0xB0,0x00,0x01,0x01,0x02,0x02,0x21,0x03,0x02,0x02,0x01,0x01,
+0xB7,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x02,0x01,0xC1,0x00,0x03,0x01,
+0x0B,0x02,0x04,0x01,0xA4,0x00,
 };
 static const DiffBlock THINKING_FRAME9_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    69, 115,  // Changed box top-left
+    218, 51,  // Changed box dimensions
     THINKING_FRAME9_DATA
 };
 
-// Frame 10: Full frame RLE (1142 bytes)
-static const uint8_t THINKING_FRAME10_DATA[1142] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xED,0x00,0x04,0x01,0xFF,0x00,0x34,0x00,0x03,0x01,
-0x02,0x02,0x08,0x03,0x01,0x01,0xFF,0x00,0x2B,0x00,0x02,0x01,0x02,0x02,0x11,0x03,
-0x01,0x01,0xFF,0x00,0x22,0x00,0x03,0x01,0x02,0x02,0x19,0x03,0x01,0x01,0xFF,0x00,
-0x1A,0x00,0x03,0x01,0x02,0x02,0x21,0x03,0x01,0x01,0xFF,0x00,0x11,0x00,0x03,0x01,
-0x03,0x02,0x29,0x03,0x01,0x01,0xFF,0x00,0x09,0x00,0x03,0x01,0x03,0x02,0x31,0x03,
-0x01,0x01,0xFF,0x00,0x03,0x01,0x03,0x02,0x3A,0x03,0x01,0x01,0xF7,0x00,0x03,0x01,
-0x03,0x02,0x42,0x03,0x01,0x01,0xEF,0x00,0x03,0x01,0x02,0x02,0x4B,0x03,0x01,0x01,
-0xE8,0x00,0x02,0x01,0x02,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0xE0,0x00,0x02,0x01,
-0x02,0x02,0x5A,0x03,0x01,0x02,0xD9,0x00,0x02,0x01,0x02,0x02,0x62,0x03,0x01,0x02,
-0xD3,0x00,0x01,0x01,0x02,0x02,0x69,0x03,0x01,0x01,0xD2,0x00,0x01,0x01,0x6C,0x03,
-0x01,0x01,0xBB,0x00,0x08,0x01,0x10,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0xA9,0x00,
-0x07,0x01,0x07,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,
-0x99,0x00,0x06,0x01,0x06,0x02,0x1F,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,
-0x01,0x01,0x89,0x00,0x05,0x01,0x05,0x02,0x31,0x03,0x01,0x01,0x10,0x00,0x01,0x02,
-0x69,0x03,0x7A,0x00,0x05,0x01,0x05,0x02,0x41,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
-0x68,0x03,0x01,0x01,0x6C,0x00,0x04,0x01,0x04,0x02,0x51,0x03,0x12,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x66,0x03,
-0x01,0x02,0x6C,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x6D,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x58,0x03,0x15,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x6F,0x00,
-0x57,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x61,0x03,0x70,0x00,0x01,0x02,0x56,0x03,
-0x01,0x01,0x17,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x55,0x03,
-0x01,0x02,0x19,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x73,0x00,0x01,0x01,0x54,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x75,0x00,0x01,0x02,0x52,0x03,
-0x01,0x01,0x1D,0x00,0x58,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
-0x1F,0x00,0x56,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x20,0x00,
-0x01,0x02,0x53,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x22,0x00,
-0x01,0x02,0x50,0x03,0x01,0x02,0x7D,0x00,0x4D,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
-0x4E,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x4A,0x03,0x29,0x00,0x01,0x01,
-0x47,0x03,0x01,0x02,0x01,0x01,0x83,0x00,0x01,0x01,0x48,0x03,0x2C,0x00,0x01,0x02,
-0x43,0x03,0x01,0x02,0x01,0x01,0x86,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x2E,0x00,
-0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,0x43,0x03,
-0x01,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x8E,0x00,0x01,0x02,
-0x40,0x03,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
-0x91,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x31,0x03,0x01,0x02,
-0x01,0x01,0x95,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x36,0x03,
-0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,
-0xA1,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x02,0x01,0x02,0x02,
-0x12,0x03,0x03,0x02,0x02,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x0A,0x01,0xB5,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x1A,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0x21,0x00,0x02,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,
-0x31,0x00,0x06,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xCB,0x00,
+// Frame 10: Diff RLE (702 bytes)
+static const uint8_t THINKING_FRAME10_DATA[702] = {
+0xD4,0x00,0x04,0x01,0xCC,0x00,0x03,0x01,0x02,0x02,0x08,0x03,0x01,0x01,0xC3,0x00,
+0x02,0x01,0x02,0x02,0x11,0x03,0x01,0x01,0xBA,0x00,0x03,0x01,0x02,0x02,0x19,0x03,
+0x01,0x01,0xB2,0x00,0x03,0x01,0x02,0x02,0x21,0x03,0x01,0x01,0xA9,0x00,0x03,0x01,
+0x03,0x02,0x29,0x03,0x01,0x01,0xA1,0x00,0x03,0x01,0x03,0x02,0x31,0x03,0x01,0x01,
+0x98,0x00,0x03,0x01,0x03,0x02,0x3A,0x03,0x01,0x01,0x90,0x00,0x03,0x01,0x03,0x02,
+0x42,0x03,0x01,0x01,0x88,0x00,0x03,0x01,0x02,0x02,0x4B,0x03,0x01,0x01,0x81,0x00,
+0x02,0x01,0x02,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x02,0x01,0x02,0x02,
+0x5A,0x03,0x01,0x02,0x72,0x00,0x02,0x01,0x02,0x02,0x62,0x03,0x01,0x02,0x6C,0x00,
+0x01,0x01,0x02,0x02,0x69,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,
+0x54,0x00,0x08,0x01,0x10,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x42,0x00,0x07,0x01,
+0x07,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x32,0x00,
+0x06,0x01,0x06,0x02,0x1F,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,
+0x22,0x00,0x05,0x01,0x05,0x02,0x31,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,
+0x13,0x00,0x05,0x01,0x05,0x02,0x41,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,
+0x01,0x01,0x05,0x00,0x04,0x01,0x04,0x02,0x51,0x03,0x12,0x00,0x01,0x01,0x66,0x03,
+0x01,0x02,0x04,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x66,0x03,0x01,0x02,
+0x05,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x06,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x06,0x00,
+0x01,0x01,0x58,0x03,0x15,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x08,0x00,0x57,0x03,
+0x01,0x02,0x16,0x00,0x01,0x01,0x61,0x03,0x09,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
+0x17,0x00,0x01,0x02,0x5F,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
+0x19,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
+0x1B,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
+0x1D,0x00,0x58,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x1F,0x00,
+0x56,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x20,0x00,0x01,0x02,
+0x53,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,
+0x50,0x03,0x01,0x02,0x16,0x00,0x4D,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,
+0x4A,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x4A,0x03,0x29,0x00,0x01,0x01,0x47,0x03,
+0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x48,0x03,0x2C,0x00,0x01,0x02,0x43,0x03,
+0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,
+0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x22,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
+0x31,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x40,0x03,
+0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,
+0x01,0x02,0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x01,0x01,
+0x2E,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x36,0x03,0x01,0x02,
+0x01,0x01,0x42,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,0x3A,0x00,
+0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x02,0x01,0x02,0x02,0x12,0x03,
+0x03,0x02,0x02,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,
+0x54,0x00,0x0A,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
+0xB2,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0xB9,0x00,0x02,0x01,
+0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,0xC9,0x00,0x06,0x01,0xAA,0x00,
 };
 static const DiffBlock THINKING_FRAME10_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    70, 117,  // Changed box top-left
+    217, 50,  // Changed box dimensions
     THINKING_FRAME10_DATA
 };
 
-// Frame 11: Full frame RLE (1130 bytes)
-static const uint8_t THINKING_FRAME11_DATA[1130] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE8,0x00,0x03,0x01,0x03,0x02,0x02,0x03,0x01,0x02,
-0xFF,0x00,0x30,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x01,0x01,0xFF,0x00,0x26,0x00,
-0x03,0x01,0x02,0x02,0x15,0x03,0x01,0x01,0xFF,0x00,0x1E,0x00,0x02,0x01,0x03,0x02,
-0x1D,0x03,0x01,0x01,0xFF,0x00,0x15,0x00,0x03,0x01,0x02,0x02,0x26,0x03,0x01,0x01,
-0xFF,0x00,0x0D,0x00,0x03,0x01,0x02,0x02,0x2E,0x03,0x01,0x01,0xFF,0x00,0x04,0x00,
-0x03,0x01,0x03,0x02,0x36,0x03,0x01,0x01,0xFB,0x00,0x03,0x01,0x03,0x02,0x3E,0x03,
-0x01,0x01,0xF3,0x00,0x03,0x01,0x02,0x02,0x47,0x03,0x01,0x01,0xEB,0x00,0x02,0x01,
-0x03,0x02,0x4F,0x03,0x01,0x01,0xE3,0x00,0x02,0x01,0x03,0x02,0x56,0x03,0x01,0x02,
-0xDC,0x00,0x03,0x01,0x02,0x02,0x5E,0x03,0x01,0x02,0xD5,0x00,0x02,0x01,0x02,0x02,
-0x66,0x03,0x01,0x01,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0xD2,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x01,0xB1,0x00,0x07,0x01,0x06,0x02,0x05,0x03,0x01,0x01,0x0F,0x00,
-0x01,0x02,0x6A,0x03,0x01,0x02,0xA0,0x00,0x07,0x01,0x06,0x02,0x17,0x03,0x01,0x01,
-0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x90,0x00,0x06,0x01,0x06,0x02,0x28,0x03,
-0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x81,0x00,0x05,0x01,0x06,0x02,0x39,0x03,
-0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x72,0x00,0x04,0x01,0x05,0x02,
-0x4A,0x03,0x12,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x14,0x00,0x64,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x14,0x00,0x01,0x01,0x63,0x03,0x6E,0x00,0x01,0x01,0x58,0x03,0x16,0x00,0x01,0x02,
-0x61,0x03,0x01,0x01,0x6F,0x00,0x57,0x03,0x01,0x02,0x17,0x00,0x60,0x03,0x01,0x02,
-0x70,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,0x5E,0x03,0x01,0x02,0x72,0x00,
-0x55,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x72,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x74,0x00,0x01,0x02,
-0x52,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x59,0x03,0x76,0x00,0x01,0x01,0x52,0x03,
-0x01,0x01,0x1D,0x00,0x01,0x01,0x57,0x03,0x78,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x1F,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x7A,0x00,0x50,0x03,0x21,0x00,0x01,0x01,
-0x52,0x03,0x01,0x02,0x7B,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x22,0x00,0x01,0x01,
-0x50,0x03,0x01,0x01,0x7D,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x02,0x80,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
-0x4A,0x03,0x01,0x01,0x82,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,
-0x46,0x03,0x01,0x01,0x85,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,
-0x43,0x03,0x01,0x01,0x88,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x32,0x00,
-0x01,0x01,0x3A,0x03,0x01,0x02,0x8F,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x36,0x00,
-0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x02,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,
-0x98,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
-0x01,0x02,0x02,0x01,0x9D,0x00,0x01,0x02,0x35,0x03,0x01,0x01,0x45,0x00,0x01,0x01,
-0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0xA4,0x00,0x01,0x02,0x30,0x03,0x01,0x02,
-0x01,0x01,0x4C,0x00,0x03,0x01,0x04,0x02,0x08,0x03,0x05,0x02,0x02,0x01,0xAD,0x00,
-0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,
-0x01,0x02,0x23,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x1C,0x00,0x02,0x01,0x01,0x02,
-0x1A,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x26,0x00,0x02,0x01,0x04,0x02,0x08,0x03,
-0x04,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x05,0x00,
+// Frame 11: Diff RLE (686 bytes)
+static const uint8_t THINKING_FRAME11_DATA[686] = {
+0xCE,0x00,0x03,0x01,0x03,0x02,0x02,0x03,0x01,0x02,0xC7,0x00,0x02,0x01,0x02,0x02,
+0x0D,0x03,0x01,0x01,0xBD,0x00,0x03,0x01,0x02,0x02,0x15,0x03,0x01,0x01,0xB5,0x00,
+0x02,0x01,0x03,0x02,0x1D,0x03,0x01,0x01,0xAC,0x00,0x03,0x01,0x02,0x02,0x26,0x03,
+0x01,0x01,0xA4,0x00,0x03,0x01,0x02,0x02,0x2E,0x03,0x01,0x01,0x9B,0x00,0x03,0x01,
+0x03,0x02,0x36,0x03,0x01,0x01,0x93,0x00,0x03,0x01,0x03,0x02,0x3E,0x03,0x01,0x01,
+0x8B,0x00,0x03,0x01,0x02,0x02,0x47,0x03,0x01,0x01,0x83,0x00,0x02,0x01,0x03,0x02,
+0x4F,0x03,0x01,0x01,0x7B,0x00,0x02,0x01,0x03,0x02,0x56,0x03,0x01,0x02,0x74,0x00,
+0x03,0x01,0x02,0x02,0x5E,0x03,0x01,0x02,0x6D,0x00,0x02,0x01,0x02,0x02,0x66,0x03,
+0x01,0x01,0x6A,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x6C,0x03,
+0x01,0x01,0x49,0x00,0x07,0x01,0x06,0x02,0x05,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x6A,0x03,0x01,0x02,0x38,0x00,0x07,0x01,0x06,0x02,0x17,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x6A,0x03,0x01,0x01,0x28,0x00,0x06,0x01,0x06,0x02,0x28,0x03,0x01,0x01,
+0x10,0x00,0x01,0x02,0x69,0x03,0x19,0x00,0x05,0x01,0x06,0x02,0x39,0x03,0x01,0x01,
+0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x0A,0x00,0x04,0x01,0x05,0x02,0x4A,0x03,
+0x12,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x03,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x04,0x00,0x59,0x03,0x01,0x02,0x13,0x00,
+0x01,0x02,0x65,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,
+0x64,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
+0x63,0x03,0x06,0x00,0x01,0x01,0x58,0x03,0x16,0x00,0x01,0x02,0x61,0x03,0x01,0x01,
+0x07,0x00,0x57,0x03,0x01,0x02,0x17,0x00,0x60,0x03,0x01,0x02,0x08,0x00,0x01,0x01,
+0x56,0x03,0x01,0x01,0x18,0x00,0x5E,0x03,0x01,0x02,0x0A,0x00,0x55,0x03,0x01,0x02,
+0x19,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
+0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x01,0x59,0x03,0x0E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,
+0x01,0x01,0x57,0x03,0x10,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,
+0x54,0x03,0x01,0x02,0x12,0x00,0x50,0x03,0x21,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
+0x15,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
+0x18,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
+0x1A,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,0x46,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x43,0x03,0x01,0x01,
+0x20,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,
+0x01,0x01,0x23,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x3A,0x03,
+0x01,0x02,0x27,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,
+0x34,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,
+0x39,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x02,0x01,
+0x35,0x00,0x01,0x02,0x35,0x03,0x01,0x01,0x45,0x00,0x01,0x01,0x02,0x02,0x1B,0x03,
+0x02,0x02,0x02,0x01,0x3C,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x4C,0x00,
+0x03,0x01,0x04,0x02,0x08,0x03,0x05,0x02,0x02,0x01,0x45,0x00,0x01,0x01,0x01,0x02,
+0x2A,0x03,0x01,0x02,0x01,0x01,0xAD,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x02,0x02,
+0x01,0x01,0xB3,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xBD,0x00,
+0x02,0x01,0x04,0x02,0x08,0x03,0x04,0x02,0x03,0x01,0xFF,0x00,0x7B,0x00,
 };
 static const DiffBlock THINKING_FRAME11_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    71, 117,  // Changed box top-left
+    216, 50,  // Changed box dimensions
     THINKING_FRAME11_DATA
 };
 
-// Frame 12: Full frame RLE (1150 bytes)
-static const uint8_t THINKING_FRAME12_DATA[1150] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE2,0x00,0x03,0x01,
-0x04,0x02,0x02,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x2D,0x00,0x03,0x01,0x03,0x02,
-0x0D,0x03,0x01,0x01,0xFF,0x00,0x24,0x00,0x03,0x01,0x03,0x02,0x16,0x03,0x01,0x01,
-0xFF,0x00,0x1C,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,0x01,0x01,0xFF,0x00,0x14,0x00,
-0x02,0x01,0x03,0x02,0x27,0x03,0x01,0x01,0xFF,0x00,0x0C,0x00,0x02,0x01,0x03,0x02,
-0x2F,0x03,0x01,0x01,0xFF,0x00,0x04,0x00,0x02,0x01,0x02,0x02,0x38,0x03,0x01,0x01,
-0xFB,0x00,0x02,0x01,0x03,0x02,0x3F,0x03,0x01,0x01,0xF3,0x00,0x02,0x01,0x03,0x02,
-0x47,0x03,0x01,0x01,0xEA,0x00,0x03,0x01,0x03,0x02,0x4F,0x03,0x01,0x01,0xE2,0x00,
-0x03,0x01,0x03,0x02,0x57,0x03,0x01,0x01,0xDA,0x00,0x03,0x01,0x03,0x02,0x5E,0x03,
-0x01,0x02,0xD3,0x00,0x03,0x01,0x02,0x02,0x67,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x01,0xD3,0x00,0x6C,0x03,0x01,0x01,0xB0,0x00,0x05,0x01,0x05,0x02,
-0x09,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x9F,0x00,0x05,0x01,
-0x04,0x02,0x1B,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,0x90,0x00,
-0x05,0x01,0x04,0x02,0x2B,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x01,0x01,
-0x7F,0x00,0x06,0x01,0x04,0x02,0x3B,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x69,0x03,
-0x70,0x00,0x06,0x01,0x05,0x02,0x4A,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x67,0x03,
-0x01,0x02,0x6B,0x00,0x01,0x02,0x59,0x03,0x12,0x00,0x01,0x01,0x67,0x03,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
-0x6C,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x65,0x03,0x01,0x01,
-0x6C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x02,
-0x6D,0x00,0x01,0x01,0x58,0x03,0x16,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x6E,0x00,
-0x57,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x61,0x03,0x01,0x01,0x6F,0x00,0x01,0x02,
-0x56,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x71,0x00,0x56,0x03,
-0x19,0x00,0x01,0x02,0x5E,0x03,0x72,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x01,0x72,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1B,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x01,0x74,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x58,0x03,0x01,0x01,0x76,0x00,0x52,0x03,0x01,0x01,0x1E,0x00,0x57,0x03,
-0x01,0x01,0x77,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x54,0x03,
-0x01,0x01,0x79,0x00,0x01,0x02,0x4F,0x03,0x22,0x00,0x01,0x02,0x51,0x03,0x01,0x02,
-0x7C,0x00,0x4E,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x7D,0x00,
-0x01,0x01,0x4C,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x7F,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x82,0x00,
-0x01,0x01,0x48,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,
-0x84,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x01,0x01,0x87,0x00,0x01,0x01,0x44,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,
-0x3E,0x03,0x01,0x02,0x01,0x01,0x8A,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x32,0x00,
-0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,0x3F,0x03,0x01,0x02,
-0x36,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x96,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x9C,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x45,0x00,0x01,0x01,
-0x01,0x02,0x1F,0x03,0x01,0x02,0x02,0x01,0xA2,0x00,0x01,0x01,0x31,0x03,0x01,0x02,
-0x4B,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0xAA,0x00,0x01,0x01,
-0x2C,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x15,0x00,0x01,0x02,0x26,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x1B,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x22,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,
-0x2E,0x00,0x0A,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x8D,0x00,
+// Frame 12: Diff RLE (714 bytes)
+static const uint8_t THINKING_FRAME12_DATA[714] = {
+0xCE,0x00,0x03,0x01,0x04,0x02,0x02,0x03,0x01,0x02,0x01,0x01,0xC5,0x00,0x03,0x01,
+0x03,0x02,0x0D,0x03,0x01,0x01,0xBC,0x00,0x03,0x01,0x03,0x02,0x16,0x03,0x01,0x01,
+0xB4,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,0x01,0x01,0xAC,0x00,0x02,0x01,0x03,0x02,
+0x27,0x03,0x01,0x01,0xA4,0x00,0x02,0x01,0x03,0x02,0x2F,0x03,0x01,0x01,0x9C,0x00,
+0x02,0x01,0x02,0x02,0x38,0x03,0x01,0x01,0x94,0x00,0x02,0x01,0x03,0x02,0x3F,0x03,
+0x01,0x01,0x8C,0x00,0x02,0x01,0x03,0x02,0x47,0x03,0x01,0x01,0x83,0x00,0x03,0x01,
+0x03,0x02,0x4F,0x03,0x01,0x01,0x7B,0x00,0x03,0x01,0x03,0x02,0x57,0x03,0x01,0x01,
+0x73,0x00,0x03,0x01,0x03,0x02,0x5E,0x03,0x01,0x02,0x6C,0x00,0x03,0x01,0x02,0x02,
+0x67,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x6C,0x00,0x6C,0x03,
+0x01,0x01,0x49,0x00,0x05,0x01,0x05,0x02,0x09,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x6B,0x03,0x01,0x01,0x38,0x00,0x05,0x01,0x04,0x02,0x1B,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x6A,0x03,0x01,0x02,0x29,0x00,0x05,0x01,0x04,0x02,0x2B,0x03,0x01,0x01,
+0x10,0x00,0x01,0x02,0x69,0x03,0x01,0x01,0x18,0x00,0x06,0x01,0x04,0x02,0x3B,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x69,0x03,0x09,0x00,0x06,0x01,0x05,0x02,0x4A,0x03,
+0x01,0x01,0x11,0x00,0x01,0x02,0x67,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x59,0x03,
+0x12,0x00,0x01,0x01,0x67,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
+0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x58,0x03,0x16,0x00,
+0x01,0x02,0x62,0x03,0x01,0x01,0x07,0x00,0x57,0x03,0x01,0x02,0x16,0x00,0x01,0x01,
+0x61,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x17,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x0A,0x00,0x56,0x03,0x19,0x00,0x01,0x02,0x5E,0x03,0x0B,0x00,
+0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x54,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x0D,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x0F,0x00,
+0x52,0x03,0x01,0x01,0x1E,0x00,0x57,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x50,0x03,
+0x01,0x01,0x20,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x12,0x00,0x01,0x02,0x4F,0x03,
+0x22,0x00,0x01,0x02,0x51,0x03,0x01,0x02,0x15,0x00,0x4E,0x03,0x01,0x01,0x23,0x00,
+0x01,0x01,0x4F,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x25,0x00,
+0x01,0x01,0x4D,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x28,0x00,
+0x01,0x02,0x49,0x03,0x01,0x02,0x1B,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x01,0x46,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
+0x2D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x44,0x03,
+0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x01,0x01,0x23,0x00,
+0x01,0x01,0x42,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,
+0x01,0x01,0x27,0x00,0x3F,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
+0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x02,0x3C,0x03,0x01,0x01,0x3A,0x00,0x01,0x01,
+0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x01,0x39,0x03,0x01,0x02,
+0x3F,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x01,
+0x35,0x03,0x01,0x02,0x45,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x02,0x01,
+0x3B,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x4B,0x00,0x02,0x01,0x02,0x02,0x11,0x03,
+0x03,0x02,0x02,0x01,0x43,0x00,0x01,0x01,0x2C,0x03,0x01,0x02,0x01,0x01,0xAD,0x00,
+0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0xB3,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,
+0x01,0x02,0x02,0x01,0xBA,0x00,0x02,0x01,0x02,0x02,0x11,0x03,0x03,0x02,0x02,0x01,
+0xC6,0x00,0x0A,0x01,0xFF,0x00,0xFF,0x00,0x5C,0x00,
 };
 static const DiffBlock THINKING_FRAME12_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    70, 113,  // Changed box top-left
+    217, 53,  // Changed box dimensions
     THINKING_FRAME12_DATA
 };
 
-// Frame 13: Full frame RLE (1162 bytes)
-static const uint8_t THINKING_FRAME13_DATA[1162] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x26,0x00,0x03,0x01,0xFF,0x00,0x35,0x00,0x03,0x01,
-0x03,0x02,0x06,0x03,0x01,0x01,0xFF,0x00,0x2B,0x00,0x03,0x01,0x03,0x02,0x0F,0x03,
-0x01,0x01,0xFF,0x00,0x22,0x00,0x03,0x01,0x03,0x02,0x18,0x03,0x01,0x01,0xFF,0x00,
-0x1A,0x00,0x03,0x01,0x03,0x02,0x20,0x03,0x01,0x01,0xFF,0x00,0x11,0x00,0x03,0x01,
-0x03,0x02,0x29,0x03,0x01,0x01,0xFF,0x00,0x09,0x00,0x03,0x01,0x02,0x02,0x32,0x03,
-0x01,0x01,0xFF,0x00,0x01,0x00,0x03,0x01,0x02,0x02,0x3A,0x03,0x01,0x01,0xF9,0x00,
-0x02,0x01,0x02,0x02,0x42,0x03,0x01,0x01,0xF1,0x00,0x02,0x01,0x02,0x02,0x4A,0x03,
-0x01,0x01,0xE8,0x00,0x03,0x01,0x02,0x02,0x52,0x03,0x01,0x01,0xE0,0x00,0x03,0x01,
-0x02,0x02,0x5A,0x03,0x01,0x01,0xD8,0x00,0x03,0x01,0x02,0x02,0x61,0x03,0x01,0x02,
-0x01,0x01,0xD2,0x00,0x01,0x01,0x03,0x02,0x68,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x02,0xBC,0x00,0x07,0x01,0x10,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,
-0xAA,0x00,0x05,0x01,0x06,0x02,0x0E,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,
-0x01,0x01,0x9A,0x00,0x04,0x01,0x05,0x02,0x20,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
-0x6A,0x03,0x01,0x02,0x8B,0x00,0x04,0x01,0x05,0x02,0x30,0x03,0x01,0x01,0x10,0x00,
-0x01,0x02,0x69,0x03,0x01,0x01,0x7B,0x00,0x05,0x01,0x04,0x02,0x40,0x03,0x01,0x01,
-0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x6C,0x00,0x05,0x01,0x04,0x02,0x4F,0x03,
-0x01,0x01,0x11,0x00,0x01,0x02,0x68,0x03,0x6A,0x00,0x01,0x01,0x5A,0x03,0x12,0x00,
-0x01,0x01,0x67,0x03,0x01,0x01,0x6B,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,
-0x65,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x14,0x00,0x65,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x6E,0x00,0x58,0x03,0x16,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x6E,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x61,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,
-0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x60,0x03,0x71,0x00,0x56,0x03,0x19,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x71,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1B,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x74,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x76,0x00,0x52,0x03,0x01,0x01,0x1E,0x00,0x57,0x03,
-0x01,0x02,0x77,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x79,0x00,0x01,0x02,0x4F,0x03,0x22,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
-0x7B,0x00,0x4E,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x01,0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x7E,0x00,
-0x01,0x01,0x4A,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x81,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,0x47,0x03,0x01,0x02,
-0x84,0x00,0x01,0x02,0x47,0x03,0x2C,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x86,0x00,
-0x01,0x02,0x44,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x89,0x00,
-0x01,0x01,0x42,0x03,0x01,0x02,0x32,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,
-0x8C,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x38,0x03,0x01,0x02,
-0x90,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x02,0x02,0x01,0x01,0x94,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x02,0x01,0x99,0x00,0x01,0x02,
-0x36,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,
-0x9E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x48,0x00,0x02,0x01,0x01,0x02,
-0x19,0x03,0x02,0x02,0x01,0x01,0xA6,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,
-0x50,0x00,0x04,0x01,0x0B,0x02,0x03,0x01,0xB0,0x00,0x01,0x02,0x29,0x03,0x01,0x02,
-0xFF,0x00,0x18,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x1F,0x00,0x01,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x28,0x00,
-0x02,0x01,0x06,0x02,0x03,0x03,0x06,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x0A,0x00,
+// Frame 13: Diff RLE (726 bytes)
+static const uint8_t THINKING_FRAME13_DATA[726] = {
+0xD5,0x00,0x03,0x01,0xCD,0x00,0x03,0x01,0x03,0x02,0x06,0x03,0x01,0x01,0xC3,0x00,
+0x03,0x01,0x03,0x02,0x0F,0x03,0x01,0x01,0xBA,0x00,0x03,0x01,0x03,0x02,0x18,0x03,
+0x01,0x01,0xB2,0x00,0x03,0x01,0x03,0x02,0x20,0x03,0x01,0x01,0xA9,0x00,0x03,0x01,
+0x03,0x02,0x29,0x03,0x01,0x01,0xA1,0x00,0x03,0x01,0x02,0x02,0x32,0x03,0x01,0x01,
+0x99,0x00,0x03,0x01,0x02,0x02,0x3A,0x03,0x01,0x01,0x92,0x00,0x02,0x01,0x02,0x02,
+0x42,0x03,0x01,0x01,0x8A,0x00,0x02,0x01,0x02,0x02,0x4A,0x03,0x01,0x01,0x81,0x00,
+0x03,0x01,0x02,0x02,0x52,0x03,0x01,0x01,0x79,0x00,0x03,0x01,0x02,0x02,0x5A,0x03,
+0x01,0x01,0x71,0x00,0x03,0x01,0x02,0x02,0x61,0x03,0x01,0x02,0x01,0x01,0x6B,0x00,
+0x01,0x01,0x03,0x02,0x68,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,
+0x55,0x00,0x07,0x01,0x10,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x43,0x00,0x05,0x01,
+0x06,0x02,0x0E,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x33,0x00,
+0x04,0x01,0x05,0x02,0x20,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x02,
+0x24,0x00,0x04,0x01,0x05,0x02,0x30,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,
+0x01,0x01,0x14,0x00,0x05,0x01,0x04,0x02,0x40,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
+0x69,0x03,0x01,0x01,0x05,0x00,0x05,0x01,0x04,0x02,0x4F,0x03,0x01,0x01,0x11,0x00,
+0x01,0x02,0x68,0x03,0x03,0x00,0x01,0x01,0x5A,0x03,0x12,0x00,0x01,0x01,0x67,0x03,
+0x01,0x01,0x04,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x02,
+0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x14,0x00,0x65,0x03,0x01,0x02,0x05,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x07,0x00,
+0x58,0x03,0x16,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x17,0x00,0x61,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x17,0x00,0x01,0x01,0x60,0x03,0x0A,0x00,0x56,0x03,0x19,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x0D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x58,0x03,
+0x01,0x02,0x0F,0x00,0x52,0x03,0x01,0x01,0x1E,0x00,0x57,0x03,0x01,0x02,0x10,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x12,0x00,
+0x01,0x02,0x4F,0x03,0x22,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x14,0x00,0x4E,0x03,
+0x01,0x01,0x23,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x4C,0x03,
+0x01,0x02,0x25,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x27,0x00,0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x47,0x03,0x2C,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x44,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x42,0x03,
+0x01,0x02,0x32,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x25,0x00,0x01,0x01,
+0x40,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x29,0x00,0x01,0x01,
+0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x02,0x02,0x01,0x01,0x2D,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x02,0x01,0x32,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
+0x42,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,0x37,0x00,0x01,0x01,
+0x01,0x02,0x32,0x03,0x01,0x02,0x48,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x02,0x02,
+0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x50,0x00,0x04,0x01,
+0x0B,0x02,0x03,0x01,0x49,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0xB0,0x00,0x01,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0xB7,0x00,0x01,0x01,0x02,0x02,0x18,0x03,
+0x02,0x02,0x01,0x01,0xC0,0x00,0x02,0x01,0x06,0x02,0x03,0x03,0x06,0x02,0x03,0x01,
+0xFF,0x00,0xFF,0x00,0x56,0x00,
 };
 static const DiffBlock THINKING_FRAME13_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    70, 110,  // Changed box top-left
+    217, 54,  // Changed box dimensions
     THINKING_FRAME13_DATA
 };
 
-// Frame 14: Full frame RLE (1172 bytes)
-static const uint8_t THINKING_FRAME14_DATA[1172] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xE1,0x00,0x02,0x01,0x04,0x02,0xFF,0x00,0x32,0x00,0x02,0x01,0x03,0x02,
-0x0A,0x03,0x01,0x01,0xFF,0x00,0x28,0x00,0x03,0x01,0x02,0x02,0x13,0x03,0x01,0x01,
-0xFF,0x00,0x1F,0x00,0x03,0x01,0x03,0x02,0x1B,0x03,0x01,0x01,0xFF,0x00,0x16,0x00,
-0x03,0x01,0x03,0x02,0x24,0x03,0x01,0x01,0xFF,0x00,0x0E,0x00,0x03,0x01,0x03,0x02,
-0x2C,0x03,0x01,0x01,0xFF,0x00,0x06,0x00,0x03,0x01,0x02,0x02,0x35,0x03,0x01,0x01,
-0xFD,0x00,0x02,0x01,0x03,0x02,0x3D,0x03,0x01,0x01,0xF5,0x00,0x02,0x01,0x03,0x02,
-0x45,0x03,0x01,0x01,0xED,0x00,0x02,0x01,0x03,0x02,0x4D,0x03,0x01,0x01,0xE5,0x00,
-0x02,0x01,0x03,0x02,0x55,0x03,0x01,0x01,0xDD,0x00,0x03,0x01,0x02,0x02,0x5D,0x03,
-0x01,0x01,0xD5,0x00,0x03,0x01,0x02,0x02,0x64,0x03,0x01,0x02,0x01,0x01,0xD1,0x00,
-0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,
-0xB4,0x00,0x07,0x01,0x08,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,
-0xA3,0x00,0x06,0x01,0x05,0x02,0x15,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6B,0x03,
-0x01,0x01,0x93,0x00,0x05,0x01,0x05,0x02,0x26,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
-0x01,0x02,0x69,0x03,0x01,0x02,0x85,0x00,0x04,0x01,0x05,0x02,0x36,0x03,0x01,0x01,
-0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x75,0x00,0x04,0x01,0x04,0x02,0x47,0x03,
-0x01,0x01,0x11,0x00,0x69,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x04,0x02,0x55,0x03,
-0x12,0x00,0x01,0x01,0x68,0x03,0x6A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,
-0x67,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x13,0x00,0x01,0x01,
-0x65,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,
-0x64,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
-0x63,0x03,0x01,0x02,0x6E,0x00,0x58,0x03,0x16,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x6E,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x6F,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,0x60,0x03,0x71,0x00,0x01,0x02,
-0x55,0x03,0x19,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x71,0x00,0x01,0x01,0x54,0x03,
-0x01,0x02,0x1A,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x73,0x00,0x01,0x02,0x53,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x74,0x00,0x01,0x01,0x52,0x03,
-0x01,0x02,0x1D,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x51,0x03,
-0x01,0x01,0x1E,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x77,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x20,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x79,0x00,0x01,0x02,0x4F,0x03,
-0x22,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x7B,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,
-0x23,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x7C,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
-0x25,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,
-0x28,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
-0x2A,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x83,0x00,0x01,0x02,0x47,0x03,0x2D,0x00,
-0x01,0x02,0x44,0x03,0x01,0x01,0x86,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x2F,0x00,
-0x01,0x01,0x41,0x03,0x01,0x01,0x89,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x32,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x01,0x8C,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x35,0x00,
-0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x02,0x3D,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x94,0x00,0x01,0x01,
-0x3A,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,0x01,0x01,
-0x99,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x24,0x03,
-0x02,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,
-0x47,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0xA5,0x00,0x01,0x01,
-0x01,0x02,0x2E,0x03,0x01,0x02,0x50,0x00,0x03,0x01,0x0D,0x02,0x03,0x01,0xAF,0x00,
-0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,0x01,0x01,0x01,0x02,
-0x23,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x1E,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x27,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x04,0x02,
-0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x4B,0x00,
+// Frame 14: Diff RLE (738 bytes)
+static const uint8_t THINKING_FRAME14_DATA[738] = {
+0xD2,0x00,0x02,0x01,0x04,0x02,0xCA,0x00,0x02,0x01,0x03,0x02,0x0A,0x03,0x01,0x01,
+0xC0,0x00,0x03,0x01,0x02,0x02,0x13,0x03,0x01,0x01,0xB7,0x00,0x03,0x01,0x03,0x02,
+0x1B,0x03,0x01,0x01,0xAE,0x00,0x03,0x01,0x03,0x02,0x24,0x03,0x01,0x01,0xA6,0x00,
+0x03,0x01,0x03,0x02,0x2C,0x03,0x01,0x01,0x9E,0x00,0x03,0x01,0x02,0x02,0x35,0x03,
+0x01,0x01,0x96,0x00,0x02,0x01,0x03,0x02,0x3D,0x03,0x01,0x01,0x8E,0x00,0x02,0x01,
+0x03,0x02,0x45,0x03,0x01,0x01,0x86,0x00,0x02,0x01,0x03,0x02,0x4D,0x03,0x01,0x01,
+0x7E,0x00,0x02,0x01,0x03,0x02,0x55,0x03,0x01,0x01,0x76,0x00,0x03,0x01,0x02,0x02,
+0x5D,0x03,0x01,0x01,0x6E,0x00,0x03,0x01,0x02,0x02,0x64,0x03,0x01,0x02,0x01,0x01,
+0x6A,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x6C,0x03,
+0x01,0x02,0x4D,0x00,0x07,0x01,0x08,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,
+0x01,0x01,0x3C,0x00,0x06,0x01,0x05,0x02,0x15,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x6B,0x03,0x01,0x01,0x2C,0x00,0x05,0x01,0x05,0x02,0x26,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x02,0x1E,0x00,0x04,0x01,0x05,0x02,0x36,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x0E,0x00,0x04,0x01,0x04,0x02,
+0x47,0x03,0x01,0x01,0x11,0x00,0x69,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x04,0x02,
+0x55,0x03,0x12,0x00,0x01,0x01,0x68,0x03,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
+0x13,0x00,0x67,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x13,0x00,
+0x01,0x01,0x65,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,
+0x01,0x02,0x64,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,
+0x01,0x01,0x63,0x03,0x01,0x02,0x07,0x00,0x58,0x03,0x16,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x07,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x08,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,0x60,0x03,0x0A,0x00,
+0x01,0x02,0x55,0x03,0x19,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x53,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,
+0x52,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,
+0x51,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x10,0x00,0x01,0x01,
+0x50,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x12,0x00,0x01,0x02,
+0x4F,0x03,0x22,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x4D,0x03,
+0x01,0x01,0x23,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x15,0x00,0x01,0x01,0x4C,0x03,
+0x01,0x02,0x25,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x02,0x28,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x48,0x03,
+0x01,0x02,0x2A,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x1C,0x00,0x01,0x02,0x47,0x03,
+0x2D,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
+0x2F,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x42,0x03,0x01,0x02,
+0x32,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x40,0x03,0x01,0x01,
+0x35,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x01,0x01,0x29,0x00,0x01,0x02,0x3D,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x3A,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x02,0x02,
+0x01,0x01,0x32,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,
+0x24,0x03,0x02,0x02,0x01,0x01,0x37,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
+0x01,0x01,0x47,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0x3E,0x00,
+0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x50,0x00,0x03,0x01,0x0D,0x02,0x03,0x01,
+0x48,0x00,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0xAF,0x00,0x01,0x01,0x01,0x02,
+0x23,0x03,0x01,0x02,0x01,0x01,0xB6,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,
+0x02,0x01,0xBF,0x00,0x02,0x01,0x03,0x02,0x09,0x03,0x04,0x02,0x02,0x01,0xFF,0x00,
+0x7C,0x00,
 };
 static const DiffBlock THINKING_FRAME14_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    70, 109,  // Changed box top-left
+    217, 53,  // Changed box dimensions
     THINKING_FRAME14_DATA
 };
 
-// Frame 15: Full frame RLE (1170 bytes)
-static const uint8_t THINKING_FRAME15_DATA[1170] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xA2,0x00,0x02,0x01,0x01,0x02,0x01,0x01,0xFF,0x00,0x34,0x00,0x02,0x01,0x03,0x02,
-0x08,0x03,0x01,0x01,0xFF,0x00,0x2A,0x00,0x03,0x01,0x02,0x02,0x11,0x03,0x01,0x01,
-0xFF,0x00,0x22,0x00,0x02,0x01,0x03,0x02,0x19,0x03,0x01,0x01,0xFF,0x00,0x19,0x00,
-0x03,0x01,0x02,0x02,0x22,0x03,0x01,0x01,0xFF,0x00,0x10,0x00,0x03,0x01,0x03,0x02,
-0x2A,0x03,0x01,0x01,0xFF,0x00,0x08,0x00,0x03,0x01,0x03,0x02,0x32,0x03,0x01,0x02,
-0xFF,0x00,0x02,0x01,0x03,0x02,0x3B,0x03,0x01,0x02,0xF7,0x00,0x02,0x01,0x03,0x02,
-0x43,0x03,0x01,0x01,0xEF,0x00,0x02,0x01,0x03,0x02,0x4B,0x03,0x01,0x01,0xE7,0x00,
-0x02,0x01,0x02,0x02,0x54,0x03,0x01,0x01,0xDF,0x00,0x02,0x01,0x03,0x02,0x5B,0x03,
-0x01,0x01,0xD7,0x00,0x03,0x01,0x02,0x02,0x63,0x03,0x01,0x01,0xD2,0x00,0x01,0x01,
-0x01,0x02,0x6A,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0xB9,0x00,
-0x08,0x01,0x02,0x02,0x10,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0xA7,0x00,0x06,0x01,
-0x07,0x02,0x0F,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x97,0x00,
-0x05,0x01,0x06,0x02,0x21,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6B,0x03,0x88,0x00,
-0x05,0x01,0x05,0x02,0x32,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x01,0x02,
-0x79,0x00,0x04,0x01,0x05,0x02,0x42,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x69,0x03,
-0x01,0x01,0x6B,0x00,0x03,0x01,0x04,0x02,0x52,0x03,0x01,0x01,0x11,0x00,0x01,0x02,
-0x68,0x03,0x6A,0x00,0x01,0x01,0x5A,0x03,0x13,0x00,0x67,0x03,0x01,0x02,0x6B,0x00,
-0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,
-0x58,0x03,0x01,0x02,0x14,0x00,0x65,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x14,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x6D,0x00,0x58,0x03,0x16,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x57,0x03,0x16,0x00,0x01,0x01,
-0x62,0x03,0x01,0x01,0x6E,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x01,
-0x60,0x03,0x01,0x01,0x70,0x00,0x56,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x02,0x71,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x5D,0x03,
-0x72,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x73,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,0x5A,0x03,0x01,0x01,0x75,0x00,
-0x52,0x03,0x01,0x01,0x1E,0x00,0x58,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x1F,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x01,0x20,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x7A,0x00,0x4E,0x03,0x01,0x02,
-0x23,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x7B,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,
-0x25,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x7E,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,
-0x26,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x80,0x00,0x01,0x02,0x49,0x03,0x01,0x01,
-0x28,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x83,0x00,0x01,0x02,0x47,0x03,
-0x01,0x01,0x2B,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x85,0x00,0x01,0x02,0x45,0x03,
-0x01,0x01,0x2E,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x88,0x00,0x01,0x02,0x43,0x03,
-0x01,0x01,0x30,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x8B,0x00,0x01,0x02,0x41,0x03,
-0x01,0x01,0x33,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x01,
-0x3E,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x92,0x00,
-0x01,0x01,0x3C,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x2F,0x03,0x02,0x02,0x01,0x01,
-0x96,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,0x02,0x02,0x27,0x03,
-0x02,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,
-0x44,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0xA1,0x00,0x01,0x01,
-0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x03,0x01,0x02,0x02,0x11,0x03,
-0x03,0x02,0x02,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,
-0x57,0x00,0x07,0x01,0xB6,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x01,0xFF,0x00,
-0x1B,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x22,0x00,
-0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x2E,0x00,0x0C,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x4F,0x00,
+// Frame 15: Diff RLE (736 bytes)
+static const uint8_t THINKING_FRAME15_DATA[736] = {
+0xD4,0x00,0x02,0x01,0x01,0x02,0x01,0x01,0xCC,0x00,0x02,0x01,0x03,0x02,0x08,0x03,
+0x01,0x01,0xC2,0x00,0x03,0x01,0x02,0x02,0x11,0x03,0x01,0x01,0xBA,0x00,0x02,0x01,
+0x03,0x02,0x19,0x03,0x01,0x01,0xB1,0x00,0x03,0x01,0x02,0x02,0x22,0x03,0x01,0x01,
+0xA8,0x00,0x03,0x01,0x03,0x02,0x2A,0x03,0x01,0x01,0xA0,0x00,0x03,0x01,0x03,0x02,
+0x32,0x03,0x01,0x02,0x98,0x00,0x02,0x01,0x03,0x02,0x3B,0x03,0x01,0x02,0x90,0x00,
+0x02,0x01,0x03,0x02,0x43,0x03,0x01,0x01,0x88,0x00,0x02,0x01,0x03,0x02,0x4B,0x03,
+0x01,0x01,0x80,0x00,0x02,0x01,0x02,0x02,0x54,0x03,0x01,0x01,0x78,0x00,0x02,0x01,
+0x03,0x02,0x5B,0x03,0x01,0x01,0x70,0x00,0x03,0x01,0x02,0x02,0x63,0x03,0x01,0x01,
+0x6B,0x00,0x01,0x01,0x01,0x02,0x6A,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x6C,0x03,
+0x01,0x02,0x52,0x00,0x08,0x01,0x02,0x02,0x10,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,
+0x40,0x00,0x06,0x01,0x07,0x02,0x0F,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,
+0x01,0x01,0x30,0x00,0x05,0x01,0x06,0x02,0x21,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x6B,0x03,0x21,0x00,0x05,0x01,0x05,0x02,0x32,0x03,0x01,0x01,0x10,0x00,0x01,0x02,
+0x69,0x03,0x01,0x02,0x12,0x00,0x04,0x01,0x05,0x02,0x42,0x03,0x01,0x01,0x10,0x00,
+0x01,0x01,0x69,0x03,0x01,0x01,0x04,0x00,0x03,0x01,0x04,0x02,0x52,0x03,0x01,0x01,
+0x11,0x00,0x01,0x02,0x68,0x03,0x03,0x00,0x01,0x01,0x5A,0x03,0x13,0x00,0x67,0x03,
+0x01,0x02,0x04,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x66,0x03,0x01,0x01,
+0x04,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x14,0x00,0x65,0x03,0x01,0x02,0x05,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x06,0x00,
+0x58,0x03,0x16,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x07,0x00,0x01,0x02,0x57,0x03,
+0x16,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x17,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x09,0x00,0x56,0x03,0x01,0x01,0x18,0x00,
+0x01,0x02,0x5E,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,
+0x01,0x02,0x5D,0x03,0x0B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
+0x5B,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,0x5A,0x03,
+0x01,0x01,0x0E,0x00,0x52,0x03,0x01,0x01,0x1E,0x00,0x58,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x11,0x00,
+0x01,0x02,0x4F,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x13,0x00,
+0x4E,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x17,0x00,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x19,0x00,0x01,0x02,
+0x49,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x01,0x02,0x48,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x02,0x47,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x1E,0x00,
+0x01,0x02,0x45,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x21,0x00,
+0x01,0x02,0x43,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x24,0x00,
+0x01,0x02,0x41,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x01,0x01,
+0x27,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x37,0x00,0x01,0x01,0x01,0x02,0x35,0x03,
+0x01,0x02,0x2B,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x3B,0x00,0x01,0x02,0x2F,0x03,
+0x02,0x02,0x01,0x01,0x2F,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x3F,0x00,0x01,0x01,
+0x02,0x02,0x27,0x03,0x02,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x34,0x03,
+0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,
+0x3A,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x03,0x01,
+0x02,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x07,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
+0x01,0x01,0xB3,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0xBA,0x00,
+0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x01,0x01,0xC6,0x00,0x0C,0x01,0xA6,0x00,
+
 };
 static const DiffBlock THINKING_FRAME15_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    70, 108,  // Changed box top-left
+    217, 53,  // Changed box dimensions
     THINKING_FRAME15_DATA
 };
 
-// Frame 16: Full frame RLE (1176 bytes)
-static const uint8_t THINKING_FRAME16_DATA[1176] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x9F,0x00,0x02,0x01,0x03,0x02,0x01,0x03,0x01,0x02,0xFF,0x00,0x31,0x00,0x02,0x01,
-0x03,0x02,0x0B,0x03,0x01,0x01,0xFF,0x00,0x27,0x00,0x03,0x01,0x02,0x02,0x14,0x03,
-0x01,0x01,0xFF,0x00,0x1F,0x00,0x02,0x01,0x03,0x02,0x1C,0x03,0x01,0x01,0xFF,0x00,
-0x16,0x00,0x03,0x01,0x03,0x02,0x24,0x03,0x01,0x01,0xFF,0x00,0x0D,0x00,0x03,0x01,
-0x03,0x02,0x2D,0x03,0x01,0x02,0xFF,0x00,0x05,0x00,0x03,0x01,0x03,0x02,0x35,0x03,
-0x01,0x02,0xFC,0x00,0x03,0x01,0x02,0x02,0x3E,0x03,0x01,0x02,0xF4,0x00,0x02,0x01,
-0x03,0x02,0x46,0x03,0x01,0x01,0xEC,0x00,0x02,0x01,0x03,0x02,0x4E,0x03,0x01,0x01,
-0xE4,0x00,0x03,0x01,0x02,0x02,0x56,0x03,0x01,0x01,0xDD,0x00,0x02,0x01,0x02,0x02,
-0x5E,0x03,0x01,0x01,0xD5,0x00,0x02,0x01,0x02,0x02,0x65,0x03,0x01,0x02,0x01,0x01,
-0xD1,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,
-0xB3,0x00,0x07,0x01,0x07,0x02,0x02,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,
-0x01,0x01,0xA1,0x00,0x06,0x01,0x07,0x02,0x15,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
-0x6B,0x03,0x01,0x01,0x91,0x00,0x05,0x01,0x06,0x02,0x27,0x03,0x01,0x01,0x10,0x00,
-0x01,0x02,0x6A,0x03,0x83,0x00,0x04,0x01,0x05,0x02,0x38,0x03,0x01,0x01,0x10,0x00,
-0x01,0x01,0x69,0x03,0x01,0x02,0x74,0x00,0x04,0x01,0x04,0x02,0x48,0x03,0x01,0x01,
-0x11,0x00,0x69,0x03,0x01,0x01,0x6A,0x00,0x03,0x02,0x57,0x03,0x12,0x00,0x01,0x01,
-0x68,0x03,0x6A,0x00,0x01,0x01,0x5A,0x03,0x13,0x00,0x67,0x03,0x01,0x02,0x6B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x66,0x03,0x6C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x6D,0x00,0x58,0x03,
-0x16,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x6E,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x17,0x00,0x01,0x02,0x61,0x03,0x6F,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x18,0x00,
-0x60,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x55,0x03,0x19,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x02,0x71,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x5C,0x03,
-0x01,0x02,0x73,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x74,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x75,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x57,0x03,
-0x01,0x01,0x76,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x55,0x03,
-0x01,0x01,0x78,0x00,0x01,0x02,0x4F,0x03,0x22,0x00,0x01,0x02,0x53,0x03,0x01,0x01,
-0x7A,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x7C,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
-0x7E,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x01,0x02,0x4B,0x03,
-0x01,0x01,0x80,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x48,0x03,
-0x01,0x02,0x83,0x00,0x01,0x02,0x47,0x03,0x2C,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x86,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x41,0x03,0x01,0x02,
-0x01,0x01,0x88,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x02,
-0x3D,0x03,0x01,0x02,0x01,0x01,0x8B,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x35,0x00,
-0x01,0x02,0x39,0x03,0x01,0x02,0x8F,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x38,0x00,
-0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,0x93,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x97,0x00,
-0x01,0x01,0x38,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x02,0x02,0x25,0x03,0x02,0x02,
-0x02,0x01,0x9C,0x00,0x01,0x01,0x34,0x03,0x01,0x01,0x46,0x00,0x01,0x01,0x02,0x02,
-0x1C,0x03,0x02,0x02,0x02,0x01,0xA3,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x4D,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x03,0x02,0x03,0x01,0xAB,0x00,0x01,0x01,
-0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x16,0x00,0x01,0x01,0x25,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x1C,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x24,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x02,0x01,
-0xFF,0x00,0x33,0x00,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x54,0x00,
+// Frame 16: Diff RLE (738 bytes)
+static const uint8_t THINKING_FRAME16_DATA[738] = {
+0xD0,0x00,0x02,0x01,0x03,0x02,0x01,0x03,0x01,0x02,0xC8,0x00,0x02,0x01,0x03,0x02,
+0x0B,0x03,0x01,0x01,0xBE,0x00,0x03,0x01,0x02,0x02,0x14,0x03,0x01,0x01,0xB6,0x00,
+0x02,0x01,0x03,0x02,0x1C,0x03,0x01,0x01,0xAD,0x00,0x03,0x01,0x03,0x02,0x24,0x03,
+0x01,0x01,0xA4,0x00,0x03,0x01,0x03,0x02,0x2D,0x03,0x01,0x02,0x9C,0x00,0x03,0x01,
+0x03,0x02,0x35,0x03,0x01,0x02,0x94,0x00,0x03,0x01,0x02,0x02,0x3E,0x03,0x01,0x02,
+0x8C,0x00,0x02,0x01,0x03,0x02,0x46,0x03,0x01,0x01,0x84,0x00,0x02,0x01,0x03,0x02,
+0x4E,0x03,0x01,0x01,0x7C,0x00,0x03,0x01,0x02,0x02,0x56,0x03,0x01,0x01,0x75,0x00,
+0x02,0x01,0x02,0x02,0x5E,0x03,0x01,0x01,0x6D,0x00,0x02,0x01,0x02,0x02,0x65,0x03,
+0x01,0x02,0x01,0x01,0x69,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,
+0x6C,0x03,0x01,0x02,0x4B,0x00,0x07,0x01,0x07,0x02,0x02,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x02,0x6B,0x03,0x01,0x01,0x39,0x00,0x06,0x01,0x07,0x02,0x15,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x29,0x00,0x05,0x01,0x06,0x02,0x27,0x03,
+0x01,0x01,0x10,0x00,0x01,0x02,0x6A,0x03,0x1B,0x00,0x04,0x01,0x05,0x02,0x38,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x0C,0x00,0x04,0x01,0x04,0x02,
+0x48,0x03,0x01,0x01,0x11,0x00,0x69,0x03,0x01,0x01,0x02,0x00,0x03,0x02,0x57,0x03,
+0x12,0x00,0x01,0x01,0x68,0x03,0x03,0x00,0x5A,0x03,0x13,0x00,0x67,0x03,0x01,0x02,
+0x03,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x66,0x03,0x04,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x04,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x05,0x00,
+0x58,0x03,0x16,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x06,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x17,0x00,0x01,0x02,0x61,0x03,0x07,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x18,0x00,0x60,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x55,0x03,0x19,0x00,0x01,0x01,
+0x5E,0x03,0x01,0x02,0x09,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,
+0x5C,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x59,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,
+0x57,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x20,0x00,0x01,0x02,
+0x55,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x4F,0x03,0x22,0x00,0x01,0x02,0x53,0x03,
+0x01,0x01,0x12,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x50,0x03,
+0x01,0x02,0x14,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x02,0x16,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x01,0x02,
+0x4B,0x03,0x01,0x01,0x18,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x29,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x47,0x03,0x2C,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x1E,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x2E,0x00,0x01,0x01,0x41,0x03,
+0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x01,0x01,0x31,0x00,
+0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,0x40,0x03,0x01,0x02,
+0x35,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,
+0x38,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x02,0x3A,0x03,
+0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x38,0x03,0x01,0x01,0x40,0x00,0x01,0x01,0x02,0x02,0x25,0x03,
+0x02,0x02,0x02,0x01,0x34,0x00,0x01,0x01,0x34,0x03,0x01,0x01,0x46,0x00,0x01,0x01,
+0x02,0x02,0x1C,0x03,0x02,0x02,0x02,0x01,0x3B,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,
+0x01,0x01,0x4D,0x00,0x02,0x01,0x03,0x02,0x0D,0x03,0x03,0x02,0x03,0x01,0x43,0x00,
+0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0xAD,0x00,0x01,0x01,0x25,0x03,
+0x01,0x02,0x01,0x01,0xB3,0x00,0x01,0x01,0x01,0x02,0x1D,0x03,0x01,0x02,0x01,0x01,
+0xBB,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x02,0x02,0x02,0x01,0xCA,0x00,0x03,0x01,
+0xAB,0x00,
 };
 static const DiffBlock THINKING_FRAME16_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    71, 108,  // Changed box top-left
+    216, 53,  // Changed box dimensions
     THINKING_FRAME16_DATA
 };
 
-// Frame 17: Full frame RLE (1172 bytes)
-static const uint8_t THINKING_FRAME17_DATA[1172] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x9D,0x00,0x02,0x01,0x03,0x02,0x03,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x2E,0x00,
-0x02,0x01,0x03,0x02,0x0D,0x03,0x01,0x01,0xFF,0x00,0x25,0x00,0x03,0x01,0x02,0x02,
-0x16,0x03,0x01,0x01,0xFF,0x00,0x1D,0x00,0x02,0x01,0x03,0x02,0x1E,0x03,0x01,0x01,
-0xFF,0x00,0x14,0x00,0x03,0x01,0x03,0x02,0x26,0x03,0x01,0x01,0xFF,0x00,0x0B,0x00,
-0x04,0x01,0x03,0x02,0x2E,0x03,0x01,0x02,0xFF,0x00,0x03,0x00,0x03,0x01,0x03,0x02,
-0x37,0x03,0x01,0x02,0xFA,0x00,0x03,0x01,0x03,0x02,0x3F,0x03,0x01,0x02,0xF2,0x00,
-0x03,0x01,0x02,0x02,0x48,0x03,0x01,0x01,0xEA,0x00,0x03,0x01,0x02,0x02,0x50,0x03,
-0x01,0x01,0xE3,0x00,0x02,0x01,0x02,0x02,0x58,0x03,0x01,0x01,0xDB,0x00,0x02,0x01,
-0x02,0x02,0x60,0x03,0x01,0x01,0xD3,0x00,0x02,0x01,0x02,0x02,0x67,0x03,0x01,0x02,
-0x01,0x01,0xD1,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0xD3,0x00,0x6C,0x03,0x01,0x02,
-0xAF,0x00,0x06,0x01,0x07,0x02,0x07,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,
-0x01,0x01,0x9E,0x00,0x06,0x01,0x06,0x02,0x19,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
-0x6B,0x03,0x01,0x01,0x8E,0x00,0x05,0x01,0x05,0x02,0x2B,0x03,0x01,0x01,0x10,0x00,
-0x01,0x02,0x69,0x03,0x01,0x02,0x7F,0x00,0x05,0x01,0x05,0x02,0x3B,0x03,0x01,0x01,
-0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x70,0x00,0x04,0x01,0x05,0x02,0x4B,0x03,
-0x01,0x01,0x11,0x00,0x69,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x12,0x00,0x01,0x01,0x68,0x03,0x6A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,
-0x67,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x13,0x00,0x01,0x01,
-0x66,0x03,0x6C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x64,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x63,0x03,
-0x01,0x02,0x6E,0x00,0x58,0x03,0x16,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x6E,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x6F,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,0x60,0x03,0x71,0x00,0x01,0x02,0x55,0x03,
-0x19,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x71,0x00,0x01,0x01,0x54,0x03,0x01,0x02,
-0x1A,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x73,0x00,0x01,0x02,0x53,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x74,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x01,0x59,0x03,0x76,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x1E,0x00,
-0x01,0x02,0x57,0x03,0x78,0x00,0x50,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x79,0x00,0x01,0x01,0x4F,0x03,0x22,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x7B,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
-0x7D,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,
-0x7E,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x81,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x48,0x03,0x01,0x01,
-0x83,0x00,0x01,0x01,0x47,0x03,0x2D,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x86,0x00,
-0x01,0x01,0x44,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x89,0x00,
-0x01,0x01,0x42,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x8C,0x00,
-0x01,0x01,0x40,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x90,0x00,
-0x01,0x02,0x3D,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x33,0x03,0x01,0x02,
-0x94,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x02,0x01,0x98,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x9D,0x00,0x01,0x01,0x01,0x02,
-0x32,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,
-0x02,0x01,0xA4,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,
-0x03,0x01,0x04,0x02,0x07,0x03,0x05,0x02,0x03,0x01,0xAC,0x00,0x01,0x01,0x01,0x02,
-0x29,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,0x01,0x01,0x01,0x02,0x23,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x1D,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x26,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x03,0x02,0x02,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x8B,0x00,
+// Frame 17: Diff RLE (738 bytes)
+static const uint8_t THINKING_FRAME17_DATA[738] = {
+0xCF,0x00,0x02,0x01,0x03,0x02,0x03,0x03,0x01,0x02,0x01,0x01,0xC6,0x00,0x02,0x01,
+0x03,0x02,0x0D,0x03,0x01,0x01,0xBD,0x00,0x03,0x01,0x02,0x02,0x16,0x03,0x01,0x01,
+0xB5,0x00,0x02,0x01,0x03,0x02,0x1E,0x03,0x01,0x01,0xAC,0x00,0x03,0x01,0x03,0x02,
+0x26,0x03,0x01,0x01,0xA3,0x00,0x04,0x01,0x03,0x02,0x2E,0x03,0x01,0x02,0x9B,0x00,
+0x03,0x01,0x03,0x02,0x37,0x03,0x01,0x02,0x93,0x00,0x03,0x01,0x03,0x02,0x3F,0x03,
+0x01,0x02,0x8B,0x00,0x03,0x01,0x02,0x02,0x48,0x03,0x01,0x01,0x83,0x00,0x03,0x01,
+0x02,0x02,0x50,0x03,0x01,0x01,0x7C,0x00,0x02,0x01,0x02,0x02,0x58,0x03,0x01,0x01,
+0x74,0x00,0x02,0x01,0x02,0x02,0x60,0x03,0x01,0x01,0x6C,0x00,0x02,0x01,0x02,0x02,
+0x67,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0x6C,0x00,
+0x6C,0x03,0x01,0x02,0x48,0x00,0x06,0x01,0x07,0x02,0x07,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x02,0x6B,0x03,0x01,0x01,0x37,0x00,0x06,0x01,0x06,0x02,0x19,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x01,0x6B,0x03,0x01,0x01,0x27,0x00,0x05,0x01,0x05,0x02,0x2B,0x03,
+0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x01,0x02,0x18,0x00,0x05,0x01,0x05,0x02,
+0x3B,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x02,0x09,0x00,0x04,0x01,
+0x05,0x02,0x4B,0x03,0x01,0x01,0x11,0x00,0x69,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
+0x01,0x02,0x59,0x03,0x12,0x00,0x01,0x01,0x68,0x03,0x03,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x13,0x00,0x67,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x66,0x03,0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,
+0x01,0x02,0x64,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,
+0x01,0x01,0x63,0x03,0x01,0x02,0x07,0x00,0x58,0x03,0x16,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x07,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x08,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,0x60,0x03,0x0A,0x00,
+0x01,0x02,0x55,0x03,0x19,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x0A,0x00,0x01,0x01,
+0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0C,0x00,0x01,0x02,
+0x53,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,
+0x52,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x59,0x03,0x0F,0x00,0x01,0x02,0x51,0x03,
+0x01,0x01,0x1E,0x00,0x01,0x02,0x57,0x03,0x11,0x00,0x50,0x03,0x01,0x02,0x20,0x00,
+0x01,0x02,0x54,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x4F,0x03,0x22,0x00,0x01,0x01,
+0x52,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x23,0x00,0x01,0x01,
+0x50,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x25,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x28,0x00,0x01,0x02,
+0x4A,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
+0x48,0x03,0x01,0x01,0x1C,0x00,0x01,0x01,0x47,0x03,0x2D,0x00,0x01,0x02,0x44,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x41,0x03,
+0x01,0x02,0x22,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x3D,0x03,
+0x01,0x02,0x25,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x35,0x00,0x01,0x01,0x39,0x03,
+0x01,0x01,0x29,0x00,0x01,0x02,0x3D,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,
+0x33,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,
+0x01,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x31,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
+0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x36,0x00,
+0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x02,0x01,0x02,0x02,
+0x1A,0x03,0x02,0x02,0x02,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,
+0x01,0x01,0x4E,0x00,0x03,0x01,0x04,0x02,0x07,0x03,0x05,0x02,0x03,0x01,0x45,0x00,
+0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0xAF,0x00,0x01,0x01,0x01,0x02,
+0x23,0x03,0x01,0x02,0x01,0x01,0xB5,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,
+0x01,0x01,0xBE,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,
+0x7B,0x00,
 };
 static const DiffBlock THINKING_FRAME17_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    70, 108,  // Changed box top-left
+    217, 53,  // Changed box dimensions
     THINKING_FRAME17_DATA
 };
 
-// Frame 18: Full frame RLE (1178 bytes)
-static const uint8_t THINKING_FRAME18_DATA[1178] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x9C,0x00,0x02,0x01,0x03,0x02,0x04,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x2D,0x00,
-0x03,0x01,0x02,0x02,0x0E,0x03,0x01,0x01,0xFF,0x00,0x25,0x00,0x02,0x01,0x03,0x02,
-0x16,0x03,0x01,0x01,0xFF,0x00,0x1C,0x00,0x03,0x01,0x02,0x02,0x1F,0x03,0x01,0x01,
-0xFF,0x00,0x14,0x00,0x02,0x01,0x03,0x02,0x27,0x03,0x01,0x01,0xFF,0x00,0x0B,0x00,
-0x03,0x01,0x03,0x02,0x2F,0x03,0x01,0x02,0xFF,0x00,0x03,0x00,0x03,0x01,0x03,0x02,
-0x37,0x03,0x01,0x02,0xFA,0x00,0x02,0x01,0x03,0x02,0x40,0x03,0x01,0x02,0xF2,0x00,
-0x02,0x01,0x03,0x02,0x48,0x03,0x01,0x01,0xEA,0x00,0x02,0x01,0x02,0x02,0x51,0x03,
-0x01,0x01,0xE2,0x00,0x02,0x01,0x02,0x02,0x59,0x03,0x01,0x01,0xDA,0x00,0x02,0x01,
-0x02,0x02,0x61,0x03,0x01,0x01,0xD3,0x00,0x02,0x01,0x02,0x02,0x67,0x03,0x01,0x02,
-0x01,0x01,0xD1,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,0xD3,0x00,0x6C,0x03,0x01,0x02,
-0xAD,0x00,0x07,0x01,0x07,0x02,0x08,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,
-0x01,0x01,0x9D,0x00,0x06,0x01,0x06,0x02,0x1A,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
-0x6B,0x03,0x01,0x01,0x8D,0x00,0x05,0x01,0x05,0x02,0x2C,0x03,0x01,0x01,0x10,0x00,
-0x01,0x02,0x69,0x03,0x01,0x02,0x7E,0x00,0x05,0x01,0x05,0x02,0x3C,0x03,0x01,0x01,
-0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x6F,0x00,0x04,0x01,0x05,0x02,0x4C,0x03,
-0x01,0x01,0x11,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x5A,0x03,
-0x12,0x00,0x01,0x01,0x68,0x03,0x6A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,
-0x67,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x13,0x00,0x01,0x01,
-0x66,0x03,0x6C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x64,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,
-0x62,0x03,0x01,0x02,0x6E,0x00,0x58,0x03,0x16,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x6E,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x60,0x03,0x01,0x02,
-0x6F,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,0x60,0x03,0x71,0x00,0x01,0x02,
-0x55,0x03,0x1A,0x00,0x5E,0x03,0x01,0x01,0x71,0x00,0x01,0x01,0x54,0x03,0x01,0x02,
-0x1A,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x73,0x00,0x01,0x02,0x53,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x74,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x76,0x00,0x01,0x02,0x51,0x03,0x01,0x01,
-0x1E,0x00,0x01,0x02,0x57,0x03,0x78,0x00,0x50,0x03,0x01,0x01,0x20,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x79,0x00,0x01,0x01,0x4F,0x03,0x22,0x00,0x01,0x01,0x52,0x03,
-0x01,0x02,0x7B,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x7D,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x26,0x00,0x4E,0x03,0x01,0x01,
-0x7E,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x81,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x48,0x03,0x01,0x01,
-0x83,0x00,0x01,0x01,0x47,0x03,0x2D,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x86,0x00,
-0x01,0x01,0x44,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,
-0x89,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x32,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,
-0x8C,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x01,0x02,0x37,0x03,
-0x01,0x02,0x01,0x01,0x90,0x00,0x01,0x02,0x3D,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x01,0x02,0x32,0x03,0x02,0x02,0x94,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x3D,0x00,
-0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x99,0x00,0x01,0x02,0x36,0x03,
-0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,
-0x9D,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,
-0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0xA4,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,
-0x01,0x02,0x01,0x01,0x4E,0x00,0x03,0x01,0x05,0x02,0x05,0x03,0x05,0x02,0x03,0x01,
-0xAD,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x17,0x00,
-0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x1E,0x00,0x01,0x01,
-0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x26,0x00,0x02,0x01,0x03,0x02,
-0x0C,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x8B,0x00,
+// Frame 18: Diff RLE (698 bytes)
+static const uint8_t THINKING_FRAME18_DATA[698] = {
+0xCD,0x00,0x02,0x01,0x03,0x02,0x04,0x03,0xC4,0x00,0x03,0x01,0x02,0x02,0x0D,0x03,
+0xBC,0x00,0x02,0x01,0x03,0x02,0x15,0x03,0xB3,0x00,0x03,0x01,0x02,0x02,0x1E,0x03,
+0xAB,0x00,0x02,0x01,0x03,0x02,0x26,0x03,0xA2,0x00,0x03,0x01,0x03,0x02,0x2E,0x03,
+0x9A,0x00,0x03,0x01,0x03,0x02,0x36,0x03,0x92,0x00,0x02,0x01,0x03,0x02,0x3F,0x03,
+0x8A,0x00,0x02,0x01,0x03,0x02,0x47,0x03,0x82,0x00,0x02,0x01,0x02,0x02,0x50,0x03,
+0x7A,0x00,0x02,0x01,0x02,0x02,0x58,0x03,0x72,0x00,0x02,0x01,0x02,0x02,0x60,0x03,
+0x6B,0x00,0x02,0x01,0x02,0x02,0x67,0x03,0x69,0x00,0x01,0x01,0x6C,0x03,0x6A,0x00,
+0x6C,0x03,0x44,0x00,0x07,0x01,0x07,0x02,0x08,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x6B,0x03,0x34,0x00,0x06,0x01,0x06,0x02,0x1A,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,
+0x6B,0x03,0x24,0x00,0x05,0x01,0x05,0x02,0x2C,0x03,0x01,0x01,0x10,0x00,0x01,0x02,
+0x69,0x03,0x01,0x02,0x14,0x00,0x05,0x01,0x05,0x02,0x3C,0x03,0x01,0x01,0x10,0x00,
+0x01,0x01,0x69,0x03,0x01,0x01,0x05,0x00,0x04,0x01,0x05,0x02,0x4C,0x03,0x01,0x01,
+0x11,0x00,0x01,0x02,0x68,0x03,0x01,0x01,0x5A,0x03,0x12,0x00,0x01,0x01,0x68,0x03,
+0x01,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x67,0x03,0x01,0x01,0x01,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x66,0x03,0x02,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x58,0x03,
+0x01,0x01,0x14,0x00,0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x02,0x04,0x00,0x58,0x03,
+0x16,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x17,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
+0x18,0x00,0x60,0x03,0x07,0x00,0x01,0x02,0x55,0x03,0x1A,0x00,0x5E,0x03,0x01,0x01,
+0x07,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,
+0x09,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,
+0x0A,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x02,0x51,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x57,0x03,0x0E,0x00,
+0x50,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,
+0x4F,0x03,0x22,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x4D,0x03,
+0x01,0x01,0x23,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x4B,0x03,
+0x01,0x02,0x26,0x00,0x4E,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,
+0x28,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x48,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x48,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x47,0x03,0x2D,0x00,
+0x01,0x02,0x44,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x42,0x03,0x01,0x02,
+0x32,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x40,0x03,0x01,0x01,
+0x35,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x02,
+0x3D,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x02,0x02,0x2A,0x00,
+0x01,0x01,0x3A,0x03,0x01,0x02,0x3D,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
+0x01,0x01,0x2F,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,
+0x01,0x02,0x25,0x03,0x01,0x02,0x02,0x01,0x33,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
+0x01,0x02,0x01,0x01,0x47,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,
+0x3A,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x03,0x01,
+0x05,0x02,0x05,0x03,0x05,0x02,0x03,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
+0x01,0x02,0x01,0x01,0xAC,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,
+0xB3,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0xBB,0x00,0x02,0x01,
+0x03,0x02,0x0C,0x03,0x03,0x02,0x02,0x01,0x9F,0x00,
 };
 static const DiffBlock THINKING_FRAME18_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    71, 108,  // Changed box top-left
+    214, 52,  // Changed box dimensions
     THINKING_FRAME18_DATA
 };
-
-// Frame 19: Full frame RLE (1174 bytes)
-static const uint8_t THINKING_FRAME19_DATA[1174] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xA1,0x00,0x02,0x01,0x02,0x02,0x01,0x01,0xFF,0x00,0x33,0x00,0x02,0x01,0x02,0x02,
-0x0A,0x03,0x01,0x01,0xFF,0x00,0x29,0x00,0x03,0x01,0x02,0x02,0x12,0x03,0x01,0x01,
-0xFF,0x00,0x21,0x00,0x02,0x01,0x03,0x02,0x1A,0x03,0x01,0x01,0xFF,0x00,0x18,0x00,
-0x03,0x01,0x02,0x02,0x23,0x03,0x01,0x01,0xFF,0x00,0x0F,0x00,0x03,0x01,0x03,0x02,
-0x2B,0x03,0x01,0x01,0xFF,0x00,0x07,0x00,0x03,0x01,0x03,0x02,0x33,0x03,0x01,0x02,
-0xFE,0x00,0x02,0x01,0x03,0x02,0x3C,0x03,0x01,0x02,0xF6,0x00,0x02,0x01,0x03,0x02,
-0x44,0x03,0x01,0x01,0xEE,0x00,0x02,0x01,0x03,0x02,0x4C,0x03,0x01,0x01,0xE6,0x00,
-0x02,0x01,0x02,0x02,0x55,0x03,0x01,0x01,0xDE,0x00,0x02,0x01,0x03,0x02,0x5C,0x03,
-0x01,0x01,0xD6,0x00,0x03,0x01,0x02,0x02,0x63,0x03,0x01,0x02,0x01,0x01,0xD1,0x00,
-0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x02,
-0xB7,0x00,0x07,0x01,0x05,0x02,0x10,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0xA5,0x00,
-0x06,0x01,0x07,0x02,0x11,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,
-0x95,0x00,0x05,0x01,0x06,0x02,0x23,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6B,0x03,
-0x86,0x00,0x05,0x01,0x05,0x02,0x34,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,
-0x01,0x02,0x77,0x00,0x04,0x01,0x04,0x02,0x45,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
-0x69,0x03,0x01,0x01,0x6A,0x00,0x02,0x01,0x04,0x02,0x54,0x03,0x01,0x01,0x11,0x00,
-0x01,0x02,0x68,0x03,0x6A,0x00,0x01,0x01,0x5A,0x03,0x13,0x00,0x67,0x03,0x01,0x02,
-0x6B,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x66,0x03,0x01,0x01,0x6B,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x02,0x6C,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x6D,0x00,
-0x58,0x03,0x16,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x17,0x00,0x62,0x03,0x6F,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x17,0x00,
-0x01,0x01,0x60,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x18,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x02,0x71,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x01,0x02,0x53,0x03,0x01,0x01,
-0x1B,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x73,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x75,0x00,0x52,0x03,0x01,0x01,0x1E,0x00,
-0x58,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x20,0x00,0x01,0x02,
-0x55,0x03,0x01,0x01,0x78,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x21,0x00,0x01,0x02,
-0x53,0x03,0x01,0x01,0x7A,0x00,0x4E,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x51,0x03,
-0x7C,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x7E,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x80,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x48,0x03,0x01,0x02,
-0x83,0x00,0x01,0x02,0x47,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x46,0x03,0x01,0x01,
-0x85,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,0x42,0x03,0x01,0x01,
-0x88,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,
-0x01,0x01,0x8B,0x00,0x01,0x02,0x41,0x03,0x34,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x37,0x00,0x01,0x01,
-0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,
-0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x97,0x00,
-0x01,0x01,0x38,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x02,0x02,
-0x01,0x01,0x9C,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x45,0x00,0x02,0x01,0x01,0x02,
-0x1E,0x03,0x02,0x02,0x02,0x01,0xA2,0x00,0x01,0x02,0x30,0x03,0x01,0x02,0x4C,0x00,
-0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0xAA,0x00,0x01,0x02,0x2B,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x15,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x1B,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,
-0xFF,0x00,0x22,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,
-0x2F,0x00,0x09,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x51,0x00,
-};
-static const DiffBlock THINKING_FRAME19_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    THINKING_FRAME19_DATA
-};
-
-// Frame 20: Full frame RLE (1160 bytes)
-static const uint8_t THINKING_FRAME20_DATA[1160] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xA5,0x00,0x03,0x01,0x02,0x02,
-0x01,0x01,0xFF,0x00,0x31,0x00,0x04,0x01,0x03,0x02,0x09,0x03,0x01,0x01,0xFF,0x00,
-0x28,0x00,0x03,0x01,0x03,0x02,0x12,0x03,0x01,0x01,0xFF,0x00,0x1F,0x00,0x03,0x01,
-0x03,0x02,0x1B,0x03,0x01,0x01,0xFF,0x00,0x17,0x00,0x03,0x01,0x02,0x02,0x24,0x03,
-0x01,0x01,0xFF,0x00,0x0F,0x00,0x02,0x01,0x03,0x02,0x2C,0x03,0x01,0x01,0xFF,0x00,
-0x07,0x00,0x02,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0xFE,0x00,0x02,0x01,0x03,0x02,
-0x3C,0x03,0x01,0x01,0xF6,0x00,0x02,0x01,0x03,0x02,0x44,0x03,0x01,0x01,0xEE,0x00,
-0x02,0x01,0x03,0x02,0x4C,0x03,0x01,0x01,0xE5,0x00,0x03,0x01,0x03,0x02,0x54,0x03,
-0x01,0x01,0xDD,0x00,0x03,0x01,0x03,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,0xD5,0x00,
-0x03,0x01,0x03,0x02,0x63,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,
-0x01,0x02,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0xB7,0x00,0x05,0x01,0x07,0x02,
-0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0xA5,0x00,0x05,0x01,0x05,0x02,
-0x14,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6B,0x03,0x96,0x00,0x05,0x01,0x04,0x02,
-0x25,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x02,0x86,0x00,
-0x05,0x01,0x04,0x02,0x35,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x01,
-0x76,0x00,0x05,0x01,0x05,0x02,0x44,0x03,0x01,0x01,0x11,0x00,0x69,0x03,0x6B,0x00,
-0x02,0x01,0x05,0x02,0x53,0x03,0x12,0x00,0x01,0x01,0x67,0x03,0x01,0x02,0x6A,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x67,0x03,0x6C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x02,0x13,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x6C,0x00,0x01,0x01,0x58,0x03,
-0x01,0x01,0x14,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x6E,0x00,0x58,0x03,0x16,0x00,
-0x01,0x01,0x61,0x03,0x01,0x02,0x6F,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,
-0x01,0x02,0x60,0x03,0x70,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,0x5F,0x03,
-0x01,0x01,0x71,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x02,0x72,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x5B,0x03,
-0x01,0x02,0x74,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x59,0x03,
-0x01,0x02,0x75,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x58,0x03,
-0x77,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x79,0x00,0x50,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x7A,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x7C,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x7E,0x00,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,0x81,0x00,
-0x4A,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x83,0x00,0x48,0x03,
-0x2C,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x86,0x00,0x46,0x03,0x01,0x01,0x2D,0x00,
-0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x89,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x31,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x8C,0x00,0x01,0x02,
-0x40,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,
-0x8F,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x33,0x03,0x01,0x02,
-0x01,0x01,0x93,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,
-0x01,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x98,0x00,0x01,0x01,0x37,0x03,0x01,0x02,
-0x41,0x00,0x02,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,0x9E,0x00,0x01,0x02,
-0x33,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,0x02,0x02,
-0x02,0x01,0xA5,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x4F,0x00,0x03,0x01,0x04,0x02,
-0x05,0x03,0x05,0x02,0x03,0x01,0xAE,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x17,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,
-0xFF,0x00,0x1D,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,
-0x26,0x00,0x03,0x01,0x05,0x02,0x04,0x03,0x06,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xC8,0x00,
-};
-static const DiffBlock THINKING_FRAME20_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    THINKING_FRAME20_DATA
-};
-
-// Frame 21: Full frame RLE (1152 bytes)
-static const uint8_t THINKING_FRAME21_DATA[1152] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x2A,0x00,0x04,0x01,0xFF,0x00,0x34,0x00,0x03,0x01,0x03,0x02,0x07,0x03,0x01,0x01,
-0xFF,0x00,0x2B,0x00,0x03,0x01,0x02,0x02,0x10,0x03,0x01,0x01,0xFF,0x00,0x23,0x00,
-0x02,0x01,0x02,0x02,0x19,0x03,0x01,0x01,0xFF,0x00,0x1B,0x00,0x02,0x01,0x02,0x02,
-0x21,0x03,0x01,0x01,0xFF,0x00,0x12,0x00,0x03,0x01,0x02,0x02,0x29,0x03,0x01,0x01,
-0xFF,0x00,0x0A,0x00,0x03,0x01,0x02,0x02,0x31,0x03,0x01,0x01,0xFF,0x00,0x02,0x00,
-0x02,0x01,0x03,0x02,0x39,0x03,0x01,0x01,0xF8,0x00,0x03,0x01,0x03,0x02,0x41,0x03,
-0x01,0x01,0xF0,0x00,0x03,0x01,0x03,0x02,0x49,0x03,0x01,0x01,0xE7,0x00,0x03,0x01,
-0x04,0x02,0x51,0x03,0x01,0x01,0xE0,0x00,0x02,0x01,0x03,0x02,0x59,0x03,0x01,0x02,
-0xD9,0x00,0x02,0x01,0x03,0x02,0x61,0x03,0x01,0x02,0xD3,0x00,0x01,0x01,0x02,0x02,
-0x69,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0xBE,0x00,0x05,0x01,
-0x10,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0xAC,0x00,0x05,0x01,0x05,0x02,0x0D,0x03,
-0x01,0x01,0x0F,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x9C,0x00,0x05,0x01,0x05,0x02,
-0x1E,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x8B,0x00,0x05,0x01,
-0x06,0x02,0x2E,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x7B,0x00,0x06,0x01,
-0x06,0x02,0x3E,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x6C,0x00,
-0x05,0x01,0x06,0x02,0x4E,0x03,0x12,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x6A,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x6E,0x00,0x58,0x03,
-0x16,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x6F,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x17,0x00,0x01,0x02,0x60,0x03,0x70,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,
-0x5F,0x03,0x01,0x01,0x71,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x19,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
-0x5B,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
-0x59,0x03,0x01,0x01,0x75,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x77,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,
-0x55,0x03,0x01,0x01,0x79,0x00,0x50,0x03,0x21,0x00,0x01,0x01,0x53,0x03,0x01,0x01,
-0x7A,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
-0x7D,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,
-0x7F,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,
-0x82,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x01,0x02,0x47,0x03,
-0x01,0x01,0x84,0x00,0x47,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x44,0x03,0x01,0x01,
-0x87,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x01,0x01,0x8A,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x32,0x00,0x01,0x02,0x3B,0x03,
-0x01,0x02,0x01,0x01,0x8D,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x35,0x00,0x01,0x01,
-0x36,0x03,0x01,0x02,0x01,0x01,0x91,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x39,0x00,
-0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x02,0x39,0x03,
-0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x02,0x01,
-0x9B,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x43,0x00,0x01,0x01,0x01,0x02,0x20,0x03,
-0x02,0x02,0x01,0x01,0xA1,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
-0x49,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x03,0x02,0x02,0x01,0xA8,0x00,0x01,0x01,
-0x01,0x02,0x2D,0x03,0x01,0x02,0x54,0x00,0x0A,0x01,0xB5,0x00,0x01,0x01,0x01,0x02,
-0x26,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x19,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
-0x02,0x02,0x01,0x01,0xFF,0x00,0x21,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x03,0x02,
-0x03,0x01,0xFF,0x00,0x2C,0x00,0x0C,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x4B,0x00,
-
-};
-static const DiffBlock THINKING_FRAME21_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    THINKING_FRAME21_DATA
-};
-
-// Frame 22: Full frame RLE (1158 bytes)
-static const uint8_t THINKING_FRAME22_DATA[1158] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xA8,0x00,0x02,0x01,0x03,0x02,0x02,0x03,0x01,0x02,0xFF,0x00,
-0x30,0x00,0x02,0x01,0x03,0x02,0x0C,0x03,0x01,0x01,0xFF,0x00,0x27,0x00,0x02,0x01,
-0x02,0x02,0x15,0x03,0x01,0x01,0xFF,0x00,0x1E,0x00,0x03,0x01,0x02,0x02,0x1D,0x03,
-0x01,0x01,0xFF,0x00,0x16,0x00,0x02,0x01,0x03,0x02,0x25,0x03,0x01,0x01,0xFF,0x00,
-0x0E,0x00,0x02,0x01,0x03,0x02,0x2D,0x03,0x01,0x01,0xFF,0x00,0x05,0x00,0x03,0x01,
-0x03,0x02,0x35,0x03,0x01,0x01,0xFB,0x00,0x03,0x01,0x03,0x02,0x3E,0x03,0x01,0x01,
-0xF3,0x00,0x03,0x01,0x03,0x02,0x46,0x03,0x01,0x01,0xEB,0x00,0x03,0x01,0x03,0x02,
-0x4E,0x03,0x01,0x01,0xE3,0x00,0x03,0x01,0x02,0x02,0x56,0x03,0x01,0x02,0x01,0x01,
-0xDC,0x00,0x02,0x01,0x02,0x02,0x5E,0x03,0x01,0x02,0xD5,0x00,0x02,0x01,0x02,0x02,
-0x66,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0xD2,0x00,0x01,0x01,
-0x6C,0x03,0x01,0x01,0xB3,0x00,0x06,0x01,0x06,0x02,0x04,0x03,0x01,0x01,0x0F,0x00,
-0x01,0x02,0x6A,0x03,0x01,0x02,0xA2,0x00,0x06,0x01,0x06,0x02,0x16,0x03,0x01,0x01,
-0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x91,0x00,0x06,0x01,0x06,0x02,0x27,0x03,
-0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x01,0x01,0x81,0x00,0x06,0x01,0x06,0x02,
-0x37,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x73,0x00,0x05,0x01,
-0x05,0x02,0x48,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x6B,0x00,
-0x02,0x02,0x58,0x03,0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
-0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x6D,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x58,0x03,0x16,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x6F,0x00,0x57,0x03,0x01,0x02,
-0x16,0x00,0x01,0x01,0x61,0x03,0x70,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x17,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x01,0x71,0x00,0x55,0x03,0x01,0x02,0x19,0x00,0x01,0x01,
-0x5D,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x73,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x75,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x57,0x03,0x01,0x01,0x77,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
-0x55,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x50,0x03,0x21,0x00,0x01,0x02,0x53,0x03,
-0x01,0x01,0x7A,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x50,0x03,
-0x01,0x02,0x7D,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x01,0x7F,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x81,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x47,0x03,
-0x01,0x02,0x01,0x01,0x84,0x00,0x47,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x43,0x03,
-0x01,0x02,0x01,0x01,0x86,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
-0x3F,0x03,0x01,0x02,0x01,0x01,0x8A,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x31,0x00,
-0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x8D,0x00,0x01,0x02,0x40,0x03,
-0x01,0x01,0x35,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,0x91,0x00,0x01,0x01,
-0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
-0x96,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
-0x29,0x03,0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,
-0x42,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0xA1,0x00,0x01,0x01,
-0x32,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x02,0x02,
-0x02,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x55,0x00,
-0x08,0x01,0xB6,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x1A,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x21,0x00,
-0x02,0x01,0x03,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,0x2F,0x00,0x08,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x0C,0x00,
-};
-static const DiffBlock THINKING_FRAME22_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
-    THINKING_FRAME22_DATA
-};
-
-// Frame 23: Full frame RLE (1130 bytes)
-static const uint8_t THINKING_FRAME23_DATA[1130] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xE7,0x00,0x02,0x01,0x03,0x02,0x04,0x03,0x01,0x02,
-0x01,0x01,0xFF,0x00,0x2D,0x00,0x03,0x01,0x02,0x02,0x0E,0x03,0x01,0x01,0xFF,0x00,
-0x25,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0x01,0x01,0xFF,0x00,0x1C,0x00,0x03,0x01,
-0x02,0x02,0x1F,0x03,0x01,0x01,0xFF,0x00,0x14,0x00,0x03,0x01,0x02,0x02,0x27,0x03,
-0x01,0x01,0xFF,0x00,0x0B,0x00,0x03,0x01,0x03,0x02,0x2F,0x03,0x01,0x01,0xFF,0x00,
-0x03,0x00,0x03,0x01,0x03,0x02,0x37,0x03,0x01,0x01,0xF9,0x00,0x04,0x01,0x03,0x02,
-0x3F,0x03,0x01,0x01,0xF2,0x00,0x02,0x01,0x03,0x02,0x48,0x03,0x01,0x01,0xEA,0x00,
-0x02,0x01,0x03,0x02,0x50,0x03,0x01,0x01,0xE2,0x00,0x02,0x01,0x02,0x02,0x58,0x03,
-0x01,0x02,0xDB,0x00,0x02,0x01,0x02,0x02,0x60,0x03,0x01,0x02,0xD4,0x00,0x02,0x01,
-0x02,0x02,0x67,0x03,0x01,0x01,0xD2,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0xD3,0x00,
-0x6C,0x03,0xAF,0x00,0x07,0x01,0x06,0x02,0x08,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,
-0x6A,0x03,0x01,0x02,0x9E,0x00,0x06,0x01,0x06,0x02,0x1A,0x03,0x01,0x01,0x0F,0x00,
-0x01,0x01,0x6A,0x03,0x01,0x01,0x8D,0x00,0x06,0x01,0x06,0x02,0x2B,0x03,0x01,0x01,
-0x10,0x00,0x01,0x02,0x69,0x03,0x7F,0x00,0x05,0x01,0x05,0x02,0x3C,0x03,0x01,0x01,
-0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x70,0x00,0x04,0x01,0x05,0x02,0x4C,0x03,
-0x12,0x00,0x01,0x02,0x67,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x13,0x00,0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,
-0x01,0x02,0x65,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,
-0x01,0x02,0x63,0x03,0x01,0x02,0x6D,0x00,0x01,0x01,0x58,0x03,0x15,0x00,0x01,0x01,
-0x63,0x03,0x6F,0x00,0x58,0x03,0x16,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x6F,0x00,
-0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x70,0x00,
-0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,0x5E,0x03,0x01,0x02,0x72,0x00,0x01,0x02,
-0x54,0x03,0x01,0x02,0x19,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x73,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x5B,0x03,0x75,0x00,0x01,0x02,0x52,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x59,0x03,0x76,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
-0x1D,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x78,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x1F,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x7A,0x00,0x50,0x03,0x21,0x00,0x01,0x01,
-0x52,0x03,0x01,0x01,0x7B,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x23,0x00,0x01,0x02,
-0x4F,0x03,0x01,0x01,0x7D,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x02,0x80,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x27,0x00,0x01,0x01,
-0x49,0x03,0x01,0x02,0x01,0x01,0x82,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x2A,0x00,
-0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x85,0x00,0x01,0x02,0x46,0x03,0x01,0x01,
-0x2C,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x88,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,
-0x8B,0x00,0x01,0x01,0x41,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x39,0x03,
-0x01,0x01,0x8F,0x00,0x01,0x01,0x3F,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x34,0x03,
-0x01,0x01,0x94,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,
-0x2D,0x03,0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x9E,0x00,0x01,0x01,0x34,0x03,
-0x01,0x02,0x01,0x01,0x45,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,
-0xA5,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x03,0x01,0x0E,0x02,
-0x04,0x01,0xAD,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x16,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x1D,0x00,
-0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x26,0x00,0x03,0x01,
-0x0E,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x06,0x00,
+
+// Frame 19: Diff RLE (738 bytes)
+static const uint8_t THINKING_FRAME19_DATA[738] = {
+0xD3,0x00,0x02,0x01,0x02,0x02,0x01,0x01,0xCB,0x00,0x02,0x01,0x02,0x02,0x0A,0x03,
+0x01,0x01,0xC1,0x00,0x03,0x01,0x02,0x02,0x12,0x03,0x01,0x01,0xB9,0x00,0x02,0x01,
+0x03,0x02,0x1A,0x03,0x01,0x01,0xB0,0x00,0x03,0x01,0x02,0x02,0x23,0x03,0x01,0x01,
+0xA7,0x00,0x03,0x01,0x03,0x02,0x2B,0x03,0x01,0x01,0x9F,0x00,0x03,0x01,0x03,0x02,
+0x33,0x03,0x01,0x02,0x97,0x00,0x02,0x01,0x03,0x02,0x3C,0x03,0x01,0x02,0x8F,0x00,
+0x02,0x01,0x03,0x02,0x44,0x03,0x01,0x01,0x87,0x00,0x02,0x01,0x03,0x02,0x4C,0x03,
+0x01,0x01,0x7F,0x00,0x02,0x01,0x02,0x02,0x55,0x03,0x01,0x01,0x77,0x00,0x02,0x01,
+0x03,0x02,0x5C,0x03,0x01,0x01,0x6F,0x00,0x03,0x01,0x02,0x02,0x63,0x03,0x01,0x02,
+0x01,0x01,0x6A,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,
+0x6C,0x03,0x01,0x02,0x50,0x00,0x07,0x01,0x05,0x02,0x10,0x00,0x01,0x02,0x6B,0x03,
+0x01,0x01,0x3E,0x00,0x06,0x01,0x07,0x02,0x11,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x6B,0x03,0x01,0x01,0x2E,0x00,0x05,0x01,0x06,0x02,0x23,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x6B,0x03,0x1F,0x00,0x05,0x01,0x05,0x02,0x34,0x03,0x01,0x01,0x10,0x00,
+0x01,0x02,0x69,0x03,0x01,0x02,0x10,0x00,0x04,0x01,0x04,0x02,0x45,0x03,0x01,0x01,
+0x10,0x00,0x01,0x01,0x69,0x03,0x01,0x01,0x03,0x00,0x02,0x01,0x04,0x02,0x54,0x03,
+0x01,0x01,0x11,0x00,0x01,0x02,0x68,0x03,0x03,0x00,0x01,0x01,0x5A,0x03,0x13,0x00,
+0x67,0x03,0x01,0x02,0x04,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x66,0x03,
+0x01,0x01,0x04,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x64,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x64,0x03,
+0x01,0x01,0x06,0x00,0x58,0x03,0x16,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x07,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x62,0x03,0x08,0x00,0x01,0x01,0x56,0x03,
+0x01,0x02,0x17,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x55,0x03,
+0x01,0x01,0x18,0x00,0x01,0x02,0x5E,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,
+0x01,0x02,0x1A,0x00,0x01,0x02,0x5C,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x01,0x02,
+0x53,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,
+0x52,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0E,0x00,0x52,0x03,
+0x01,0x01,0x1E,0x00,0x58,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
+0x20,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,
+0x21,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x13,0x00,0x4E,0x03,0x01,0x02,0x23,0x00,
+0x01,0x02,0x51,0x03,0x15,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x4B,0x03,0x01,0x01,0x26,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x29,0x00,0x01,0x02,
+0x48,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x47,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x46,0x03,0x01,0x01,0x1E,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,
+0x42,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x43,0x03,0x01,0x01,0x30,0x00,0x01,0x01,
+0x01,0x02,0x3E,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x41,0x03,0x34,0x00,0x01,0x01,
+0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,
+0x37,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x01,0x02,0x3B,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,
+0x01,0x01,0x30,0x00,0x01,0x01,0x38,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,
+0x27,0x03,0x02,0x02,0x01,0x01,0x35,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x45,0x00,
+0x02,0x01,0x01,0x02,0x1E,0x03,0x02,0x02,0x02,0x01,0x3B,0x00,0x01,0x02,0x30,0x03,
+0x01,0x02,0x4C,0x00,0x02,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x03,0x01,0x43,0x00,
+0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0xAD,0x00,0x01,0x01,0x01,0x02,0x25,0x03,
+0x01,0x02,0x01,0x01,0xB3,0x00,0x01,0x01,0x01,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,
+0xBA,0x00,0x02,0x01,0x02,0x02,0x12,0x03,0x02,0x02,0x02,0x01,0xC7,0x00,0x09,0x01,
+0xA8,0x00,
+};
+static const DiffBlock THINKING_FRAME19_BLOCK = {
+    70, 108,  // Changed box top-left
+    217, 53,  // Changed box dimensions
+    THINKING_FRAME19_DATA
+};
+
+// Frame 20: Diff RLE (730 bytes)
+static const uint8_t THINKING_FRAME20_DATA[730] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x3A,0x00,0x03,0x01,0x02,0x02,0x01,0x01,
+0xC9,0x00,0x04,0x01,0x03,0x02,0x09,0x03,0x01,0x01,0xC0,0x00,0x03,0x01,0x03,0x02,
+0x12,0x03,0x01,0x01,0xB7,0x00,0x03,0x01,0x03,0x02,0x1B,0x03,0x01,0x01,0xAF,0x00,
+0x03,0x01,0x02,0x02,0x24,0x03,0x01,0x01,0xA7,0x00,0x02,0x01,0x03,0x02,0x2C,0x03,
+0x01,0x01,0x9F,0x00,0x02,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0x97,0x00,0x02,0x01,
+0x03,0x02,0x3C,0x03,0x01,0x01,0x8F,0x00,0x02,0x01,0x03,0x02,0x44,0x03,0x01,0x01,
+0x87,0x00,0x02,0x01,0x03,0x02,0x4C,0x03,0x01,0x01,0x7E,0x00,0x03,0x01,0x03,0x02,
+0x54,0x03,0x01,0x01,0x76,0x00,0x03,0x01,0x03,0x02,0x5B,0x03,0x01,0x02,0x01,0x01,
+0x6E,0x00,0x03,0x01,0x03,0x02,0x63,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x01,0x02,
+0x6B,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x50,0x00,0x05,0x01,
+0x07,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x3E,0x00,0x05,0x01,
+0x05,0x02,0x14,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6B,0x03,0x2F,0x00,0x05,0x01,
+0x04,0x02,0x25,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x02,
+0x1F,0x00,0x05,0x01,0x04,0x02,0x35,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x69,0x03,
+0x01,0x01,0x0F,0x00,0x05,0x01,0x05,0x02,0x44,0x03,0x01,0x01,0x11,0x00,0x69,0x03,
+0x04,0x00,0x02,0x01,0x05,0x02,0x53,0x03,0x12,0x00,0x01,0x01,0x67,0x03,0x01,0x02,
+0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x67,0x03,0x05,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x65,0x03,0x01,0x02,0x05,0x00,0x01,0x02,
+0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x64,0x03,0x01,0x01,0x05,0x00,0x01,0x01,
+0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x63,0x03,0x01,0x01,0x07,0x00,0x58,0x03,
+0x16,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x08,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x17,0x00,0x01,0x02,0x60,0x03,0x09,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x18,0x00,
+0x5F,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x19,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,
+0x5B,0x03,0x01,0x02,0x0D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,
+0x59,0x03,0x01,0x02,0x0E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x58,0x03,0x10,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x1F,0x00,0x01,0x01,0x55,0x03,
+0x01,0x02,0x12,0x00,0x50,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x13,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x51,0x03,0x01,0x01,
+0x15,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
+0x17,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x4B,0x03,0x01,0x02,
+0x1A,0x00,0x4A,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x1C,0x00,
+0x48,0x03,0x2C,0x00,0x01,0x02,0x45,0x03,0x01,0x01,0x1F,0x00,0x46,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x22,0x00,0x01,0x02,0x42,0x03,
+0x01,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,0x01,0x01,0x25,0x00,
+0x01,0x02,0x40,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,
+0x01,0x01,0x28,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x38,0x00,0x01,0x02,0x33,0x03,
+0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x02,0x3C,0x00,
+0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x02,0x01,0x31,0x00,0x01,0x01,0x37,0x03,
+0x01,0x02,0x41,0x00,0x02,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x02,0x01,0x37,0x00,
+0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,0x46,0x00,0x02,0x01,0x01,0x02,0x1A,0x03,
+0x02,0x02,0x02,0x01,0x3E,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x4F,0x00,0x03,0x01,
+0x04,0x02,0x05,0x03,0x05,0x02,0x03,0x01,0x47,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
+0x01,0x02,0x01,0x01,0xAF,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,
+0xB5,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0xBE,0x00,0x03,0x01,
+0x05,0x02,0x04,0x03,0x06,0x02,0x03,0x01,0xA2,0x00,
+};
+static const DiffBlock THINKING_FRAME20_BLOCK = {
+    70, 108,  // Changed box top-left
+    217, 55,  // Changed box dimensions
+    THINKING_FRAME20_DATA
+};
+
+// Frame 21: Diff RLE (714 bytes)
+static const uint8_t THINKING_FRAME21_DATA[714] = {
+0xFF,0x00,0xFF,0x00,0x88,0x00,0x04,0x01,0xCC,0x00,0x03,0x01,0x03,0x02,0x07,0x03,
+0x01,0x01,0xC3,0x00,0x03,0x01,0x02,0x02,0x10,0x03,0x01,0x01,0xBB,0x00,0x02,0x01,
+0x02,0x02,0x19,0x03,0x01,0x01,0xB3,0x00,0x02,0x01,0x02,0x02,0x21,0x03,0x01,0x01,
+0xAA,0x00,0x03,0x01,0x02,0x02,0x29,0x03,0x01,0x01,0xA2,0x00,0x03,0x01,0x02,0x02,
+0x31,0x03,0x01,0x01,0x9A,0x00,0x02,0x01,0x03,0x02,0x39,0x03,0x01,0x01,0x91,0x00,
+0x03,0x01,0x03,0x02,0x41,0x03,0x01,0x01,0x89,0x00,0x03,0x01,0x03,0x02,0x49,0x03,
+0x01,0x01,0x80,0x00,0x03,0x01,0x04,0x02,0x51,0x03,0x01,0x01,0x79,0x00,0x02,0x01,
+0x03,0x02,0x59,0x03,0x01,0x02,0x72,0x00,0x02,0x01,0x03,0x02,0x61,0x03,0x01,0x02,
+0x6C,0x00,0x01,0x01,0x02,0x02,0x69,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x6C,0x03,
+0x01,0x01,0x57,0x00,0x05,0x01,0x10,0x00,0x01,0x02,0x6B,0x03,0x01,0x01,0x45,0x00,
+0x05,0x01,0x05,0x02,0x0D,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,
+0x35,0x00,0x05,0x01,0x05,0x02,0x1E,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,
+0x01,0x01,0x24,0x00,0x05,0x01,0x06,0x02,0x2E,0x03,0x01,0x01,0x10,0x00,0x01,0x02,
+0x69,0x03,0x14,0x00,0x06,0x01,0x06,0x02,0x3E,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
+0x68,0x03,0x01,0x02,0x05,0x00,0x05,0x01,0x06,0x02,0x4E,0x03,0x12,0x00,0x01,0x02,
+0x67,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x66,0x03,
+0x01,0x02,0x04,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x65,0x03,
+0x01,0x01,0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,
+0x01,0x02,0x06,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x63,0x03,
+0x01,0x01,0x07,0x00,0x58,0x03,0x16,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x08,0x00,
+0x01,0x02,0x56,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x60,0x03,0x09,0x00,0x01,0x01,
+0x56,0x03,0x01,0x01,0x18,0x00,0x5F,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x54,0x03,
+0x01,0x02,0x19,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x54,0x03,
+0x01,0x01,0x1A,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x52,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x52,0x03,
+0x01,0x01,0x1D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x50,0x03,
+0x01,0x02,0x1F,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x12,0x00,0x50,0x03,0x21,0x00,
+0x01,0x01,0x53,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x22,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x25,0x00,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x27,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x29,0x00,
+0x01,0x01,0x01,0x02,0x47,0x03,0x01,0x01,0x1D,0x00,0x47,0x03,0x01,0x02,0x2C,0x00,
+0x01,0x01,0x44,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x2F,0x00,
+0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x02,0x42,0x03,0x01,0x01,
+0x32,0x00,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x26,0x00,0x01,0x01,0x40,0x03,
+0x01,0x01,0x35,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,0x2A,0x00,0x01,0x01,
+0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0x2F,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,
+0x29,0x03,0x01,0x02,0x02,0x01,0x34,0x00,0x01,0x02,0x36,0x03,0x01,0x01,0x43,0x00,
+0x01,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,
+0x31,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x02,0x01,0x02,0x02,0x13,0x03,0x03,0x02,
+0x02,0x01,0x41,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x54,0x00,0x0A,0x01,
+0x4E,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x02,0x02,0x01,0x01,0xB1,0x00,0x01,0x01,
+0x01,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0xB9,0x00,0x02,0x01,0x02,0x02,0x12,0x03,
+0x03,0x02,0x03,0x01,0xC4,0x00,0x0C,0x01,0xA7,0x00,
+};
+static const DiffBlock THINKING_FRAME21_BLOCK = {
+    70, 112,  // Changed box top-left
+    217, 53,  // Changed box dimensions
+    THINKING_FRAME21_DATA
+};
+
+// Frame 22: Diff RLE (720 bytes)
+static const uint8_t THINKING_FRAME22_DATA[720] = {
+0xFF,0x00,0xFF,0x00,0x84,0x00,0x02,0x01,0x03,0x02,0x02,0x03,0x01,0x02,0xC8,0x00,
+0x02,0x01,0x03,0x02,0x0C,0x03,0x01,0x01,0xBF,0x00,0x02,0x01,0x02,0x02,0x15,0x03,
+0x01,0x01,0xB6,0x00,0x03,0x01,0x02,0x02,0x1D,0x03,0x01,0x01,0xAE,0x00,0x02,0x01,
+0x03,0x02,0x25,0x03,0x01,0x01,0xA6,0x00,0x02,0x01,0x03,0x02,0x2D,0x03,0x01,0x01,
+0x9D,0x00,0x03,0x01,0x03,0x02,0x35,0x03,0x01,0x01,0x94,0x00,0x03,0x01,0x03,0x02,
+0x3E,0x03,0x01,0x01,0x8C,0x00,0x03,0x01,0x03,0x02,0x46,0x03,0x01,0x01,0x84,0x00,
+0x03,0x01,0x03,0x02,0x4E,0x03,0x01,0x01,0x7C,0x00,0x03,0x01,0x02,0x02,0x56,0x03,
+0x01,0x02,0x01,0x01,0x75,0x00,0x02,0x01,0x02,0x02,0x5E,0x03,0x01,0x02,0x6E,0x00,
+0x02,0x01,0x02,0x02,0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,
+0x6B,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x4C,0x00,0x06,0x01,0x06,0x02,0x04,0x03,
+0x01,0x01,0x0F,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x3B,0x00,0x06,0x01,0x06,0x02,
+0x16,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x2A,0x00,0x06,0x01,
+0x06,0x02,0x27,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x01,0x01,0x1A,0x00,
+0x06,0x01,0x06,0x02,0x37,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,
+0x0C,0x00,0x05,0x01,0x05,0x02,0x48,0x03,0x01,0x01,0x11,0x00,0x01,0x02,0x67,0x03,
+0x01,0x01,0x04,0x00,0x02,0x02,0x58,0x03,0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x04,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x01,
+0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
+0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
+0x06,0x00,0x01,0x01,0x58,0x03,0x16,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x08,0x00,
+0x57,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x61,0x03,0x09,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x17,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x0A,0x00,0x55,0x03,0x01,0x02,
+0x19,0x00,0x01,0x01,0x5D,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x1C,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
+0x1F,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x11,0x00,0x01,0x01,0x50,0x03,0x21,0x00,
+0x01,0x02,0x53,0x03,0x01,0x01,0x13,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x22,0x00,
+0x01,0x01,0x50,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x24,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,0x27,0x00,
+0x01,0x02,0x4A,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x29,0x00,
+0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x1D,0x00,0x47,0x03,0x01,0x02,0x2C,0x00,
+0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
+0x2F,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x02,0x42,0x03,
+0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x02,0x01,0x01,0x26,0x00,
+0x01,0x02,0x40,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
+0x2A,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
+0x01,0x02,0x01,0x01,0x2F,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
+0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x36,0x03,
+0x01,0x02,0x01,0x01,0x42,0x00,0x02,0x01,0x01,0x02,0x20,0x03,0x02,0x02,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x02,0x01,0x02,0x02,
+0x13,0x03,0x02,0x02,0x02,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
+0x01,0x01,0x55,0x00,0x08,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
+0x01,0x01,0xB2,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,0x02,0x01,0xB9,0x00,
+0x02,0x01,0x03,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0xC7,0x00,0x08,0x01,0xA9,0x00,
+
+};
+static const DiffBlock THINKING_FRAME22_BLOCK = {
+    70, 114,  // Changed box top-left
+    217, 52,  // Changed box dimensions
+    THINKING_FRAME22_DATA
+};
+
+// Frame 23: Diff RLE (668 bytes)
+static const uint8_t THINKING_FRAME23_DATA[668] = {
+0xFF,0x00,0xA7,0x00,0x02,0x01,0x03,0x02,0x04,0x03,0x01,0x02,0xC5,0x00,0x03,0x01,
+0x02,0x02,0x0E,0x03,0xBD,0x00,0x02,0x01,0x02,0x02,0x17,0x03,0xB4,0x00,0x03,0x01,
+0x02,0x02,0x1F,0x03,0xAC,0x00,0x03,0x01,0x02,0x02,0x27,0x03,0xA3,0x00,0x03,0x01,
+0x03,0x02,0x2F,0x03,0x9B,0x00,0x03,0x01,0x03,0x02,0x37,0x03,0x92,0x00,0x04,0x01,
+0x03,0x02,0x3F,0x03,0x8B,0x00,0x02,0x01,0x03,0x02,0x48,0x03,0x83,0x00,0x02,0x01,
+0x03,0x02,0x50,0x03,0x7B,0x00,0x02,0x01,0x02,0x02,0x58,0x03,0x01,0x02,0x73,0x00,
+0x02,0x01,0x02,0x02,0x60,0x03,0x01,0x02,0x6C,0x00,0x02,0x01,0x02,0x02,0x67,0x03,
+0x01,0x01,0x6A,0x00,0x01,0x01,0x6C,0x03,0x01,0x01,0x6B,0x00,0x6C,0x03,0x47,0x00,
+0x07,0x01,0x06,0x02,0x08,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,
+0x36,0x00,0x06,0x01,0x06,0x02,0x1A,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,
+0x01,0x01,0x25,0x00,0x06,0x01,0x06,0x02,0x2B,0x03,0x01,0x01,0x10,0x00,0x01,0x02,
+0x69,0x03,0x17,0x00,0x05,0x01,0x05,0x02,0x3C,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
+0x68,0x03,0x01,0x02,0x08,0x00,0x04,0x01,0x05,0x02,0x4C,0x03,0x12,0x00,0x01,0x02,
+0x67,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x66,0x03,
+0x01,0x02,0x03,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x65,0x03,
+0x01,0x01,0x04,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x58,0x03,0x15,0x00,0x01,0x01,0x63,0x03,0x07,0x00,
+0x58,0x03,0x16,0x00,0x01,0x02,0x61,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x56,0x03,
+0x01,0x02,0x17,0x00,0x01,0x02,0x5F,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x56,0x03,
+0x01,0x01,0x18,0x00,0x5E,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
+0x19,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x0B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
+0x1A,0x00,0x01,0x01,0x5B,0x03,0x0D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x59,0x03,0x0E,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x56,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
+0x54,0x03,0x01,0x02,0x12,0x00,0x50,0x03,0x21,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
+0x13,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,
+0x15,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,
+0x18,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x27,0x00,0x01,0x01,0x49,0x03,0x01,0x02,
+0x01,0x01,0x1A,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x45,0x03,
+0x01,0x02,0x01,0x01,0x1D,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,
+0x01,0x02,0x41,0x03,0x01,0x02,0x01,0x01,0x20,0x00,0x01,0x02,0x44,0x03,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x02,0x01,0x01,0x23,0x00,0x01,0x01,
+0x41,0x03,0x01,0x02,0x33,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x01,0x27,0x00,
+0x01,0x01,0x3F,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x34,0x03,0x01,0x01,0x2C,0x00,
+0x01,0x02,0x3B,0x03,0x01,0x02,0x3B,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,
+0x01,0x01,0x30,0x00,0x01,0x01,0x39,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,
+0x26,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x01,0x01,
+0x45,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0x3D,0x00,0x01,0x01,
+0x30,0x03,0x01,0x02,0x01,0x01,0x4D,0x00,0x03,0x01,0x0E,0x02,0x04,0x01,0x45,0x00,
+0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0xAD,0x00,0x01,0x01,0x02,0x02,
+0x22,0x03,0x01,0x02,0x02,0x01,0xB4,0x00,0x01,0x01,0x02,0x02,0x19,0x03,0x02,0x02,
+0x02,0x01,0xBD,0x00,0x03,0x01,0x0E,0x02,0x03,0x01,0xA2,0x00,
 };
 static const DiffBlock THINKING_FRAME23_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    70, 116,  // Changed box top-left
+    216, 50,  // Changed box dimensions
     THINKING_FRAME23_DATA
 };
 
-// Frame 24: Full frame RLE (1126 bytes)
-static const uint8_t THINKING_FRAME24_DATA[1126] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xEA,0x00,0x03,0x01,0x02,0x02,0x01,0x03,0x01,0x02,
-0xFF,0x00,0x31,0x00,0x03,0x01,0x02,0x02,0x0B,0x03,0x01,0x01,0xFF,0x00,0x28,0x00,
-0x02,0x01,0x03,0x02,0x13,0x03,0x01,0x01,0xFF,0x00,0x1F,0x00,0x03,0x01,0x02,0x02,
-0x1C,0x03,0x01,0x01,0xFF,0x00,0x17,0x00,0x03,0x01,0x02,0x02,0x24,0x03,0x01,0x01,
-0xFF,0x00,0x0E,0x00,0x03,0x01,0x03,0x02,0x2C,0x03,0x01,0x01,0xFF,0x00,0x06,0x00,
-0x03,0x01,0x03,0x02,0x34,0x03,0x01,0x01,0xFD,0x00,0x03,0x01,0x03,0x02,0x3C,0x03,
-0x01,0x01,0xF5,0x00,0x02,0x01,0x03,0x02,0x45,0x03,0x01,0x01,0xED,0x00,0x02,0x01,
-0x02,0x02,0x4E,0x03,0x01,0x01,0xE5,0x00,0x02,0x01,0x02,0x02,0x55,0x03,0x01,0x02,
-0xDE,0x00,0x02,0x01,0x02,0x02,0x5D,0x03,0x01,0x02,0xD6,0x00,0x02,0x01,0x02,0x02,
-0x65,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x01,0xD2,0x00,
-0x01,0x01,0x6C,0x03,0x01,0x01,0xB5,0x00,0x06,0x01,0x08,0x02,0x01,0x01,0x0F,0x00,
-0x01,0x02,0x6A,0x03,0x01,0x02,0xA4,0x00,0x06,0x01,0x06,0x02,0x14,0x03,0x01,0x01,
-0x0F,0x00,0x01,0x01,0x6A,0x03,0x01,0x01,0x93,0x00,0x06,0x01,0x06,0x02,0x25,0x03,
-0x01,0x01,0x10,0x00,0x01,0x02,0x69,0x03,0x84,0x00,0x05,0x01,0x06,0x02,0x36,0x03,
-0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x75,0x00,0x04,0x01,0x05,0x02,
-0x47,0x03,0x01,0x01,0x11,0x00,0x68,0x03,0x01,0x01,0x6B,0x00,0x04,0x02,0x56,0x03,
-0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x13,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x6C,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x6D,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
-0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x58,0x03,0x16,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x6F,0x00,0x57,0x03,0x01,0x02,0x16,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x70,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x17,0x00,0x01,0x01,
-0x5F,0x03,0x72,0x00,0x55,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
-0x72,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
-0x73,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x75,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x77,0x00,0x51,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x78,0x00,
-0x01,0x01,0x50,0x03,0x21,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x7B,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x7D,0x00,0x01,0x02,
-0x4C,0x03,0x01,0x02,0x25,0x00,0x4D,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,0x01,0x02,
-0x4A,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x82,0x00,0x49,0x03,
-0x01,0x02,0x29,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x85,0x00,0x47,0x03,0x01,0x02,
-0x2C,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x88,0x00,0x45,0x03,0x01,0x02,0x2F,0x00,
-0x01,0x02,0x3F,0x03,0x01,0x01,0x8B,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x32,0x00,
-0x01,0x02,0x3A,0x03,0x01,0x02,0x01,0x01,0x8E,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,
-0x36,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,0x92,0x00,0x01,0x01,0x3D,0x03,
-0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x97,0x00,
-0x01,0x02,0x39,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,
-0x01,0x01,0x9D,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x02,0x02,
-0x1D,0x03,0x02,0x02,0x02,0x01,0xA2,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x01,
-0x4B,0x00,0x02,0x01,0x04,0x02,0x0C,0x03,0x04,0x02,0x03,0x01,0xAB,0x00,0x01,0x02,
-0x2C,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x14,0x00,0x01,0x01,0x02,0x02,0x24,0x03,
-0x01,0x02,0x02,0x01,0xFF,0x00,0x1B,0x00,0x01,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x24,0x00,0x02,0x01,0x03,0x02,0x0C,0x03,0x03,0x02,0x03,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0x04,0x00,
+// Frame 24: Diff RLE (682 bytes)
+static const uint8_t THINKING_FRAME24_DATA[682] = {
+0xD1,0x00,0x03,0x01,0x02,0x02,0x01,0x03,0x01,0x02,0xC9,0x00,0x03,0x01,0x02,0x02,
+0x0B,0x03,0x01,0x01,0xC0,0x00,0x02,0x01,0x03,0x02,0x13,0x03,0x01,0x01,0xB7,0x00,
+0x03,0x01,0x02,0x02,0x1C,0x03,0x01,0x01,0xAF,0x00,0x03,0x01,0x02,0x02,0x24,0x03,
+0x01,0x01,0xA6,0x00,0x03,0x01,0x03,0x02,0x2C,0x03,0x01,0x01,0x9E,0x00,0x03,0x01,
+0x03,0x02,0x34,0x03,0x01,0x01,0x96,0x00,0x03,0x01,0x03,0x02,0x3C,0x03,0x01,0x01,
+0x8E,0x00,0x02,0x01,0x03,0x02,0x45,0x03,0x01,0x01,0x86,0x00,0x02,0x01,0x02,0x02,
+0x4E,0x03,0x01,0x01,0x7E,0x00,0x02,0x01,0x02,0x02,0x55,0x03,0x01,0x02,0x77,0x00,
+0x02,0x01,0x02,0x02,0x5D,0x03,0x01,0x02,0x6F,0x00,0x02,0x01,0x02,0x02,0x65,0x03,
+0x01,0x02,0x6B,0x00,0x01,0x01,0x01,0x02,0x6B,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,
+0x6C,0x03,0x01,0x01,0x4E,0x00,0x06,0x01,0x08,0x02,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x6A,0x03,0x01,0x02,0x3D,0x00,0x06,0x01,0x06,0x02,0x14,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x6A,0x03,0x01,0x01,0x2C,0x00,0x06,0x01,0x06,0x02,0x25,0x03,0x01,0x01,
+0x10,0x00,0x01,0x02,0x69,0x03,0x1D,0x00,0x05,0x01,0x06,0x02,0x36,0x03,0x01,0x01,
+0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x0E,0x00,0x04,0x01,0x05,0x02,0x47,0x03,
+0x01,0x01,0x11,0x00,0x68,0x03,0x01,0x01,0x04,0x00,0x04,0x02,0x56,0x03,0x12,0x00,
+0x01,0x01,0x66,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,
+0x01,0x02,0x65,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x13,0x00,
+0x01,0x01,0x64,0x03,0x01,0x02,0x06,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,
+0x01,0x02,0x63,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x58,0x03,0x16,0x00,0x01,0x02,
+0x61,0x03,0x01,0x01,0x08,0x00,0x57,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x60,0x03,
+0x01,0x02,0x09,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x5F,0x03,
+0x0B,0x00,0x55,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x0C,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0E,0x00,
+0x01,0x01,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x10,0x00,
+0x51,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x55,0x03,0x01,0x01,0x11,0x00,0x01,0x01,
+0x50,0x03,0x21,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x14,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x01,0x22,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x02,0x25,0x00,0x4D,0x03,0x01,0x02,0x01,0x01,0x18,0x00,0x01,0x02,0x4A,0x03,
+0x01,0x02,0x27,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x1B,0x00,0x49,0x03,0x01,0x02,
+0x29,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x1E,0x00,0x47,0x03,0x01,0x02,0x2C,0x00,
+0x01,0x01,0x43,0x03,0x01,0x02,0x21,0x00,0x45,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,
+0x3F,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x32,0x00,0x01,0x02,
+0x3A,0x03,0x01,0x02,0x01,0x01,0x27,0x00,0x01,0x02,0x3F,0x03,0x01,0x02,0x36,0x00,
+0x01,0x01,0x35,0x03,0x01,0x02,0x01,0x01,0x2B,0x00,0x01,0x01,0x3D,0x03,0x01,0x01,
+0x39,0x00,0x01,0x01,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x02,
+0x39,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x01,0x01,
+0x36,0x00,0x01,0x02,0x35,0x03,0x01,0x02,0x44,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,
+0x02,0x02,0x02,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x31,0x03,0x01,0x01,0x4B,0x00,
+0x02,0x01,0x04,0x02,0x0C,0x03,0x04,0x02,0x03,0x01,0x44,0x00,0x01,0x02,0x2C,0x03,
+0x01,0x02,0x01,0x01,0xAC,0x00,0x01,0x01,0x02,0x02,0x24,0x03,0x01,0x02,0x02,0x01,
+0xB3,0x00,0x01,0x01,0x02,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0xBC,0x00,0x02,0x01,
+0x03,0x02,0x0C,0x03,0x03,0x02,0x03,0x01,0xA1,0x00,
 };
 static const DiffBlock THINKING_FRAME24_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    70, 117,  // Changed box top-left
+    217, 49,  // Changed box dimensions
     THINKING_FRAME24_DATA
 };
 
-// Frame 25: Full frame RLE (1152 bytes)
-static const uint8_t THINKING_FRAME25_DATA[1152] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xEC,0x00,0x03,0x01,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x34,0x00,0x02,0x01,0x02,0x02,0x09,0x03,0x01,0x01,0xFF,0x00,0x2A,0x00,0x02,0x01,
-0x03,0x02,0x11,0x03,0x01,0x01,0xFF,0x00,0x22,0x00,0x02,0x01,0x02,0x02,0x1A,0x03,
-0x01,0x01,0xFF,0x00,0x19,0x00,0x03,0x01,0x02,0x02,0x22,0x03,0x01,0x01,0xFF,0x00,
-0x10,0x00,0x03,0x01,0x03,0x02,0x2A,0x03,0x01,0x01,0xFF,0x00,0x08,0x00,0x03,0x01,
-0x03,0x02,0x32,0x03,0x01,0x01,0xFF,0x00,0x03,0x01,0x03,0x02,0x3A,0x03,0x01,0x01,
-0xF7,0x00,0x02,0x01,0x03,0x02,0x43,0x03,0x01,0x01,0xEF,0x00,0x02,0x01,0x02,0x02,
-0x4C,0x03,0x01,0x01,0xE7,0x00,0x02,0x01,0x02,0x02,0x53,0x03,0x01,0x02,0x01,0x01,
-0xDF,0x00,0x02,0x01,0x02,0x02,0x5B,0x03,0x01,0x02,0xD8,0x00,0x02,0x01,0x02,0x02,
-0x63,0x03,0x01,0x02,0xD2,0x00,0x01,0x01,0x02,0x02,0x6A,0x03,0x01,0x01,0xD2,0x00,
-0x01,0x01,0x6C,0x03,0x01,0x01,0xB9,0x00,0x08,0x01,0x02,0x02,0x10,0x00,0x01,0x02,
-0x6A,0x03,0x01,0x02,0xA8,0x00,0x07,0x01,0x06,0x02,0x0F,0x03,0x01,0x01,0x0F,0x00,
-0x01,0x02,0x6A,0x03,0x01,0x01,0x97,0x00,0x06,0x01,0x06,0x02,0x21,0x03,0x01,0x01,
-0x0F,0x00,0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x01,0x87,0x00,0x05,0x01,0x06,0x02,
-0x32,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x79,0x00,0x04,0x01,
-0x05,0x02,0x43,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x6B,0x00,
-0x03,0x01,0x05,0x02,0x52,0x03,0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x6B,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x66,0x03,0x01,0x01,0x6C,0x00,0x59,0x03,
-0x01,0x02,0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x6D,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x58,0x03,
-0x16,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x6F,0x00,0x57,0x03,0x01,0x02,0x16,0x00,
-0x01,0x01,0x61,0x03,0x70,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x17,0x00,0x01,0x01,
-0x5F,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x19,0x00,0x01,0x02,
-0x5D,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,
-0x5B,0x03,0x01,0x01,0x73,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x75,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x57,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x1F,0x00,
-0x01,0x02,0x55,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x20,0x00,
-0x01,0x02,0x53,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x22,0x00,
-0x01,0x02,0x50,0x03,0x01,0x02,0x7D,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x4A,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x29,0x00,
-0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x83,0x00,0x01,0x01,0x47,0x03,0x01,0x02,
-0x2C,0x00,0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x86,0x00,0x01,0x01,0x45,0x03,
-0x01,0x02,0x2E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x89,0x00,
-0x01,0x01,0x43,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,
-0x8E,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x36,0x03,0x01,0x02,
-0x92,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
-0x01,0x01,0x97,0x00,0x01,0x02,0x39,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,
-0x29,0x03,0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,
-0x42,0x00,0x02,0x01,0x01,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0xA2,0x00,0x01,0x01,
-0x01,0x02,0x31,0x03,0x01,0x02,0x4A,0x00,0x02,0x01,0x03,0x02,0x10,0x03,0x03,0x02,
-0x03,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,
-0x05,0x01,0xB8,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x1A,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x23,0x00,
-0x02,0x01,0x02,0x02,0x10,0x03,0x03,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x03,0x00,
-
+// Frame 25: Diff RLE (708 bytes)
+static const uint8_t THINKING_FRAME25_DATA[708] = {
+0xD2,0x00,0x03,0x01,0x01,0x02,0x01,0x01,0xCB,0x00,0x02,0x01,0x02,0x02,0x09,0x03,
+0x01,0x01,0xC1,0x00,0x02,0x01,0x03,0x02,0x11,0x03,0x01,0x01,0xB9,0x00,0x02,0x01,
+0x02,0x02,0x1A,0x03,0x01,0x01,0xB0,0x00,0x03,0x01,0x02,0x02,0x22,0x03,0x01,0x01,
+0xA7,0x00,0x03,0x01,0x03,0x02,0x2A,0x03,0x01,0x01,0x9F,0x00,0x03,0x01,0x03,0x02,
+0x32,0x03,0x01,0x01,0x97,0x00,0x03,0x01,0x03,0x02,0x3A,0x03,0x01,0x01,0x8F,0x00,
+0x02,0x01,0x03,0x02,0x43,0x03,0x01,0x01,0x87,0x00,0x02,0x01,0x02,0x02,0x4C,0x03,
+0x01,0x01,0x7F,0x00,0x02,0x01,0x02,0x02,0x53,0x03,0x01,0x02,0x01,0x01,0x77,0x00,
+0x02,0x01,0x02,0x02,0x5B,0x03,0x01,0x02,0x70,0x00,0x02,0x01,0x02,0x02,0x63,0x03,
+0x01,0x02,0x6A,0x00,0x01,0x01,0x02,0x02,0x6A,0x03,0x01,0x01,0x6A,0x00,0x01,0x01,
+0x6C,0x03,0x01,0x01,0x51,0x00,0x08,0x01,0x02,0x02,0x10,0x00,0x01,0x02,0x6A,0x03,
+0x01,0x02,0x40,0x00,0x07,0x01,0x06,0x02,0x0F,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,
+0x6A,0x03,0x01,0x01,0x2F,0x00,0x06,0x01,0x06,0x02,0x21,0x03,0x01,0x01,0x0F,0x00,
+0x01,0x01,0x01,0x02,0x69,0x03,0x01,0x01,0x1F,0x00,0x05,0x01,0x06,0x02,0x32,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x02,0x11,0x00,0x04,0x01,0x05,0x02,
+0x43,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x68,0x03,0x01,0x01,0x03,0x00,0x03,0x01,
+0x05,0x02,0x52,0x03,0x12,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x04,0x00,0x59,0x03,
+0x01,0x02,0x13,0x00,0x66,0x03,0x01,0x01,0x04,0x00,0x59,0x03,0x01,0x02,0x13,0x00,
+0x01,0x01,0x64,0x03,0x01,0x02,0x05,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,
+0x01,0x02,0x63,0x03,0x01,0x01,0x05,0x00,0x01,0x01,0x58,0x03,0x16,0x00,0x01,0x02,
+0x61,0x03,0x01,0x02,0x07,0x00,0x57,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x61,0x03,
+0x08,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,
+0x08,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
+0x0A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x0D,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x57,0x03,
+0x01,0x01,0x0E,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x55,0x03,
+0x01,0x01,0x10,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x53,0x03,
+0x01,0x01,0x12,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x50,0x03,
+0x01,0x02,0x15,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x4E,0x03,
+0x01,0x01,0x16,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x4A,0x03,
+0x01,0x02,0x19,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x47,0x03,
+0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x2E,0x00,
+0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x21,0x00,0x01,0x01,0x43,0x03,
+0x01,0x01,0x31,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x26,0x00,0x01,0x02,
+0x40,0x03,0x01,0x01,0x35,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,
+0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x01,0x2F,0x00,
+0x01,0x02,0x39,0x03,0x01,0x02,0x3E,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,
+0x01,0x01,0x33,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x02,0x01,
+0x01,0x02,0x1F,0x03,0x02,0x02,0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x31,0x03,
+0x01,0x02,0x4A,0x00,0x02,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x03,0x01,0x41,0x00,
+0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x05,0x01,0x50,0x00,
+0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0xB1,0x00,0x01,0x01,0x02,0x02,
+0x1D,0x03,0x02,0x02,0x01,0x01,0xBA,0x00,0x02,0x01,0x02,0x02,0x10,0x03,0x03,0x02,
+0x02,0x01,0xA0,0x00,
 };
 static const DiffBlock THINKING_FRAME25_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    71, 117,  // Changed box top-left
+    216, 49,  // Changed box dimensions
     THINKING_FRAME25_DATA
 };
 
-// Frame 26: Full frame RLE (1144 bytes)
-static const uint8_t THINKING_FRAME26_DATA[1144] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xED,0x00,0x04,0x01,0xFF,0x00,0x34,0x00,0x03,0x01,
-0x02,0x02,0x08,0x03,0x01,0x01,0xFF,0x00,0x2B,0x00,0x02,0x01,0x02,0x02,0x11,0x03,
-0x01,0x01,0xFF,0x00,0x22,0x00,0x03,0x01,0x02,0x02,0x19,0x03,0x01,0x01,0xFF,0x00,
-0x1A,0x00,0x02,0x01,0x03,0x02,0x21,0x03,0x01,0x01,0xFF,0x00,0x11,0x00,0x03,0x01,
-0x03,0x02,0x29,0x03,0x01,0x01,0xFF,0x00,0x08,0x00,0x04,0x01,0x03,0x02,0x31,0x03,
-0x01,0x01,0xFF,0x00,0x03,0x01,0x03,0x02,0x3A,0x03,0x01,0x01,0xF7,0x00,0x03,0x01,
-0x03,0x02,0x42,0x03,0x01,0x01,0xEF,0x00,0x03,0x01,0x02,0x02,0x4B,0x03,0x01,0x01,
-0xE7,0x00,0x03,0x01,0x02,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0xE0,0x00,0x02,0x01,
-0x02,0x02,0x5A,0x03,0x01,0x02,0xD9,0x00,0x02,0x01,0x02,0x02,0x62,0x03,0x01,0x02,
-0xD3,0x00,0x01,0x01,0x02,0x02,0x69,0x03,0x01,0x01,0xD2,0x00,0x01,0x01,0x6C,0x03,
-0x01,0x01,0xBB,0x00,0x08,0x01,0x10,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0xA9,0x00,
+// Frame 26: Diff RLE (672 bytes)
+static const uint8_t THINKING_FRAME26_DATA[672] = {
+0xD3,0x00,0x03,0x01,0xCA,0x00,0x03,0x01,0x02,0x02,0x07,0x03,0xC2,0x00,0x02,0x01,
+0x02,0x02,0x10,0x03,0xB9,0x00,0x03,0x01,0x02,0x02,0x18,0x03,0xB1,0x00,0x02,0x01,
+0x03,0x02,0x20,0x03,0xA8,0x00,0x03,0x01,0x03,0x02,0x28,0x03,0x9F,0x00,0x04,0x01,
+0x03,0x02,0x30,0x03,0x97,0x00,0x03,0x01,0x03,0x02,0x39,0x03,0x8F,0x00,0x03,0x01,
+0x03,0x02,0x41,0x03,0x87,0x00,0x03,0x01,0x02,0x02,0x4A,0x03,0x7F,0x00,0x03,0x01,
+0x02,0x02,0x52,0x03,0x78,0x00,0x02,0x01,0x02,0x02,0x5A,0x03,0x70,0x00,0x02,0x01,
+0x02,0x02,0x62,0x03,0x6A,0x00,0x01,0x01,0x02,0x02,0x69,0x03,0x69,0x00,0x01,0x01,
+0x6C,0x03,0x52,0x00,0x08,0x01,0x10,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,0x3F,0x00,
 0x07,0x01,0x06,0x02,0x0E,0x03,0x01,0x01,0x0F,0x00,0x01,0x02,0x6A,0x03,0x01,0x02,
-0x99,0x00,0x06,0x01,0x06,0x02,0x1F,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,
-0x01,0x01,0x89,0x00,0x05,0x01,0x05,0x02,0x31,0x03,0x01,0x01,0x10,0x00,0x01,0x02,
-0x69,0x03,0x7A,0x00,0x05,0x01,0x05,0x02,0x41,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
-0x68,0x03,0x01,0x01,0x6C,0x00,0x04,0x01,0x04,0x02,0x51,0x03,0x12,0x00,0x01,0x01,
-0x66,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x13,0x00,0x66,0x03,
-0x01,0x02,0x6C,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x02,
-0x6D,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x01,
-0x6D,0x00,0x01,0x01,0x58,0x03,0x15,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x6F,0x00,
-0x57,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x61,0x03,0x70,0x00,0x01,0x02,0x56,0x03,
-0x01,0x01,0x17,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x55,0x03,
-0x01,0x02,0x19,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x72,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x73,0x00,0x01,0x01,0x53,0x03,
-0x01,0x02,0x01,0x01,0x1B,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x75,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x1D,0x00,0x58,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x1F,0x00,0x56,0x03,0x01,0x01,0x78,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
-0x20,0x00,0x01,0x02,0x53,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x22,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x7D,0x00,0x4D,0x03,0x01,0x02,0x24,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x01,0x7E,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x01,0x02,0x4A,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x4A,0x03,0x29,0x00,
-0x01,0x01,0x47,0x03,0x01,0x02,0x01,0x01,0x83,0x00,0x01,0x01,0x48,0x03,0x2C,0x00,
-0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x86,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x2E,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,
-0x43,0x03,0x01,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x8E,0x00,
-0x01,0x02,0x40,0x03,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,
-0x01,0x01,0x91,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x31,0x03,
-0x01,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,
-0x3D,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,
-0x36,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,
-0x02,0x01,0xA1,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x02,0x01,
-0x02,0x02,0x12,0x03,0x03,0x02,0x02,0x01,0xA9,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,
-0x01,0x02,0x01,0x01,0x55,0x00,0x08,0x01,0xB6,0x00,0x01,0x01,0x01,0x02,0x26,0x03,
-0x01,0x02,0x01,0x01,0xFF,0x00,0x1A,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,
-0x02,0x01,0xFF,0x00,0x21,0x00,0x02,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,
-0xFF,0x00,0x31,0x00,0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xCC,0x00,
+0x2F,0x00,0x06,0x01,0x06,0x02,0x1F,0x03,0x01,0x01,0x0F,0x00,0x01,0x01,0x6A,0x03,
+0x01,0x01,0x1F,0x00,0x05,0x01,0x05,0x02,0x31,0x03,0x01,0x01,0x10,0x00,0x01,0x02,
+0x69,0x03,0x10,0x00,0x05,0x01,0x05,0x02,0x41,0x03,0x01,0x01,0x10,0x00,0x01,0x01,
+0x68,0x03,0x01,0x01,0x02,0x00,0x04,0x01,0x04,0x02,0x51,0x03,0x12,0x00,0x01,0x01,
+0x66,0x03,0x01,0x02,0x02,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x66,0x03,0x01,0x02,
+0x02,0x00,0x59,0x03,0x01,0x02,0x13,0x00,0x01,0x01,0x64,0x03,0x01,0x02,0x03,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x63,0x03,0x01,0x01,0x03,0x00,
+0x01,0x01,0x58,0x03,0x15,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x05,0x00,0x57,0x03,
+0x01,0x02,0x16,0x00,0x01,0x01,0x61,0x03,0x06,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
+0x17,0x00,0x01,0x01,0x5F,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
+0x19,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x08,0x00,0x01,0x02,0x54,0x03,0x01,0x02,
+0x1A,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x01,0x01,0x1B,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x52,0x03,
+0x01,0x01,0x1D,0x00,0x58,0x03,0x01,0x01,0x0C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x1F,0x00,0x56,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x20,0x00,
+0x01,0x02,0x53,0x03,0x01,0x01,0x10,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x22,0x00,
+0x01,0x02,0x50,0x03,0x01,0x02,0x13,0x00,0x4D,0x03,0x01,0x02,0x24,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x01,0x14,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
+0x01,0x02,0x4A,0x03,0x01,0x02,0x17,0x00,0x01,0x01,0x4A,0x03,0x29,0x00,0x01,0x01,
+0x47,0x03,0x01,0x02,0x01,0x01,0x19,0x00,0x01,0x01,0x48,0x03,0x2C,0x00,0x01,0x02,
+0x43,0x03,0x01,0x02,0x01,0x01,0x1C,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x2E,0x00,
+0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x01,0x43,0x03,
+0x01,0x02,0x31,0x00,0x01,0x01,0x01,0x02,0x3B,0x03,0x01,0x01,0x24,0x00,0x01,0x02,
+0x40,0x03,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x01,0x01,
+0x27,0x00,0x01,0x02,0x3D,0x03,0x01,0x02,0x39,0x00,0x01,0x01,0x31,0x03,0x01,0x02,
+0x01,0x01,0x2B,0x00,0x01,0x01,0x01,0x02,0x39,0x03,0x01,0x02,0x01,0x01,0x3D,0x00,
+0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x36,0x03,
+0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x02,0x02,0x20,0x03,0x01,0x02,0x02,0x01,
+0x37,0x00,0x01,0x01,0x32,0x03,0x01,0x02,0x01,0x01,0x49,0x00,0x02,0x01,0x02,0x02,
+0x12,0x03,0x03,0x02,0x02,0x01,0x3F,0x00,0x01,0x01,0x01,0x02,0x2C,0x03,0x01,0x02,
+0x01,0x01,0x55,0x00,0x08,0x01,0x4C,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,
+0x01,0x01,0xAF,0x00,0x01,0x01,0x02,0x02,0x1D,0x03,0x02,0x02,0x02,0x01,0xB6,0x00,
+0x02,0x01,0x03,0x02,0x10,0x03,0x03,0x02,0x02,0x01,0xC6,0x00,0x05,0x01,0xA9,0x00,
+
 };
 static const DiffBlock THINKING_FRAME26_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    71, 117,  // Changed box top-left
+    214, 50,  // Changed box dimensions
     THINKING_FRAME26_DATA
 };
 
-// Frame 27: Full frame RLE (1178 bytes)
-static const uint8_t THINKING_FRAME27_DATA[1178] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x52,0x00,
-0x04,0x01,0x05,0x02,0x03,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,0x29,0x00,0x03,0x01,
-0x02,0x02,0x13,0x03,0xFF,0x00,0x20,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x01,
-0xFF,0x00,0x15,0x00,0x03,0x01,0x03,0x02,0x25,0x03,0x01,0x01,0xFF,0x00,0x0D,0x00,
-0x02,0x01,0x03,0x02,0x2E,0x03,0x01,0x01,0xFF,0x00,0x04,0x00,0x03,0x01,0x03,0x02,
-0x36,0x03,0x01,0x01,0xFA,0x00,0x03,0x01,0x03,0x02,0x3F,0x03,0x01,0x01,0xF2,0x00,
-0x03,0x01,0x03,0x02,0x47,0x03,0x01,0x01,0xEA,0x00,0x03,0x01,0x03,0x02,0x4F,0x03,
-0x01,0x01,0xE4,0x00,0x02,0x01,0x02,0x02,0x57,0x03,0x01,0x01,0xDE,0x00,0x01,0x01,
-0x02,0x02,0x5E,0x03,0x01,0x01,0xAE,0x00,0x07,0x01,0x0A,0x02,0x02,0x01,0x18,0x00,
-0x01,0x01,0x01,0x02,0x64,0x03,0x9B,0x00,0x05,0x01,0x05,0x02,0x1D,0x03,0x01,0x02,
-0x15,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x8B,0x00,0x04,0x01,0x05,0x02,0x2E,0x03,
-0x01,0x02,0x15,0x00,0x01,0x01,0x66,0x03,0x01,0x02,0x7B,0x00,0x05,0x01,0x04,0x02,
-0x3E,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x65,0x03,0x01,0x01,0x6F,0x00,0x04,0x01,
-0x04,0x02,0x4B,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x65,0x03,0x01,0x01,0x69,0x00,
-0x01,0x01,0x02,0x02,0x56,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x65,0x03,0x69,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x17,0x00,0x01,0x02,0x64,0x03,0x69,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x18,0x00,0x63,0x03,0x01,0x02,0x69,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x18,0x00,0x01,0x02,0x62,0x03,0x01,0x01,0x69,0x00,0x01,0x01,0x59,0x03,
-0x19,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x01,0x02,0x57,0x03,
-0x01,0x02,0x1A,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x6B,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x1A,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x57,0x03,
-0x01,0x01,0x1B,0x00,0x01,0x01,0x5E,0x03,0x01,0x01,0x6D,0x00,0x56,0x03,0x01,0x02,
-0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x55,0x03,0x01,0x01,
-0x1E,0x00,0x5C,0x03,0x01,0x01,0x6F,0x00,0x55,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,
-0x5B,0x03,0x70,0x00,0x01,0x02,0x53,0x03,0x01,0x02,0x20,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x70,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x21,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x72,0x00,0x01,0x02,0x52,0x03,0x22,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x73,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x55,0x03,
-0x01,0x01,0x74,0x00,0x01,0x01,0x4F,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x53,0x03,
-0x01,0x01,0x76,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x51,0x03,
-0x01,0x01,0x78,0x00,0x4D,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,
-0x79,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,
-0x7B,0x00,0x01,0x02,0x4A,0x03,0x2D,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x7E,0x00,
-0x01,0x02,0x48,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,0x47,0x03,0x01,0x02,0x80,0x00,
-0x01,0x02,0x46,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x82,0x00,
-0x01,0x02,0x44,0x03,0x01,0x01,0x33,0x00,0x01,0x02,0x41,0x03,0x01,0x02,0x85,0x00,
-0x01,0x02,0x42,0x03,0x01,0x01,0x35,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x88,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x39,0x00,0x01,0x02,0x3A,0x03,0x01,0x02,0x8B,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x3C,0x00,0x01,0x02,0x36,0x03,0x01,0x02,0x8F,0x00,
-0x01,0x02,0x3A,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,
-0x92,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x43,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,
-0x01,0x02,0x01,0x01,0x97,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x48,0x00,0x01,0x01,
-0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,0x9C,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,
-0x4D,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,0x02,0x01,0xA2,0x00,0x01,0x02,
-0x2A,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x03,0x01,0x03,0x02,0x0A,0x03,0x05,0x02,
-0x02,0x01,0xAA,0x00,0x01,0x01,0x01,0x02,0x24,0x03,0x01,0x02,0x01,0x01,0xFF,0x00,
-0x1C,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x24,0x00,
-0x01,0x01,0x02,0x02,0x11,0x03,0x02,0x02,0x02,0x01,0xFF,0x00,0x32,0x00,0x05,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x1C,0x00,
+// Frame 27: Diff RLE (756 bytes)
+static const uint8_t THINKING_FRAME27_DATA[756] = {
+0xCA,0x00,0x04,0x01,0x05,0x02,0x03,0x03,0x01,0x02,0x01,0x01,0xC6,0x00,0x03,0x01,
+0x02,0x02,0x13,0x03,0xBD,0x00,0x02,0x01,0x02,0x02,0x1D,0x03,0x01,0x01,0xB2,0x00,
+0x03,0x01,0x03,0x02,0x25,0x03,0x01,0x01,0xAA,0x00,0x02,0x01,0x03,0x02,0x2E,0x03,
+0x01,0x01,0xA1,0x00,0x03,0x01,0x03,0x02,0x36,0x03,0x01,0x01,0x98,0x00,0x03,0x01,
+0x03,0x02,0x3F,0x03,0x01,0x01,0x90,0x00,0x03,0x01,0x03,0x02,0x47,0x03,0x01,0x01,
+0x88,0x00,0x03,0x01,0x03,0x02,0x4F,0x03,0x01,0x01,0x82,0x00,0x02,0x01,0x02,0x02,
+0x57,0x03,0x01,0x01,0x7C,0x00,0x01,0x01,0x02,0x02,0x5E,0x03,0x01,0x01,0x4C,0x00,
+0x07,0x01,0x0A,0x02,0x02,0x01,0x18,0x00,0x01,0x01,0x01,0x02,0x64,0x03,0x39,0x00,
+0x05,0x01,0x05,0x02,0x1D,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x66,0x03,0x01,0x02,
+0x29,0x00,0x04,0x01,0x05,0x02,0x2E,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x66,0x03,
+0x01,0x02,0x19,0x00,0x05,0x01,0x04,0x02,0x3E,0x03,0x01,0x02,0x16,0x00,0x01,0x02,
+0x65,0x03,0x01,0x01,0x0D,0x00,0x04,0x01,0x04,0x02,0x4B,0x03,0x01,0x02,0x16,0x00,
+0x01,0x01,0x65,0x03,0x01,0x01,0x07,0x00,0x01,0x01,0x02,0x02,0x56,0x03,0x01,0x02,
+0x16,0x00,0x01,0x01,0x65,0x03,0x07,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x64,0x03,0x07,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x18,0x00,0x63,0x03,
+0x01,0x02,0x07,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x18,0x00,0x01,0x02,0x62,0x03,
+0x01,0x01,0x07,0x00,0x01,0x01,0x59,0x03,0x19,0x00,0x01,0x01,0x61,0x03,0x01,0x02,
+0x08,0x00,0x01,0x01,0x01,0x02,0x57,0x03,0x01,0x02,0x1A,0x00,0x01,0x02,0x60,0x03,
+0x01,0x02,0x09,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x60,0x03,
+0x01,0x01,0x09,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x01,0x0B,0x00,0x56,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,
+0x0B,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x1E,0x00,0x5C,0x03,0x01,0x01,0x0D,0x00,
+0x55,0x03,0x01,0x01,0x1E,0x00,0x01,0x01,0x5B,0x03,0x0E,0x00,0x01,0x02,0x53,0x03,
+0x01,0x02,0x20,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x53,0x03,
+0x01,0x01,0x21,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x10,0x00,0x01,0x02,0x52,0x03,
+0x22,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x11,0x00,0x01,0x01,0x01,0x02,0x50,0x03,
+0x01,0x01,0x23,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x4F,0x03,
+0x01,0x02,0x25,0x00,0x01,0x01,0x53,0x03,0x01,0x01,0x14,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x01,0x26,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x16,0x00,0x4D,0x03,0x01,0x01,
+0x28,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x4D,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x4A,0x03,0x2D,0x00,
+0x01,0x02,0x49,0x03,0x01,0x02,0x1C,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x2E,0x00,
+0x01,0x02,0x47,0x03,0x01,0x02,0x1E,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x30,0x00,
+0x01,0x01,0x45,0x03,0x01,0x01,0x20,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x33,0x00,
+0x01,0x02,0x41,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x35,0x00,
+0x01,0x01,0x3E,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x3A,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x3C,0x00,
+0x01,0x02,0x36,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x02,0x31,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,0x37,0x03,0x01,0x02,
+0x43,0x00,0x01,0x01,0x01,0x02,0x2B,0x03,0x01,0x02,0x01,0x01,0x35,0x00,0x01,0x02,
+0x33,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x01,0x01,
+0x3A,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x4D,0x00,0x02,0x01,0x01,0x02,0x1B,0x03,
+0x02,0x02,0x02,0x01,0x40,0x00,0x01,0x02,0x2A,0x03,0x01,0x02,0x01,0x01,0x54,0x00,
+0x03,0x01,0x03,0x02,0x0A,0x03,0x05,0x02,0x02,0x01,0x48,0x00,0x01,0x01,0x01,0x02,
+0x24,0x03,0x01,0x02,0x01,0x01,0xB9,0x00,0x02,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,
+0x02,0x01,0xC1,0x00,0x01,0x01,0x02,0x02,0x11,0x03,0x02,0x02,0x02,0x01,0xCF,0x00,
+0x05,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0x85,0x00,
 };
 static const DiffBlock THINKING_FRAME27_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    65, 107,  // Changed box top-left
+    222, 60,  // Changed box dimensions
     THINKING_FRAME27_DATA
 };
 
-// Frame 28: Full frame RLE (1460 bytes)
-static const uint8_t THINKING_FRAME28_DATA[1460] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xB7,0x00,0x04,0x01,0x09,0x02,
-0x06,0x03,0x07,0x02,0x03,0x01,0xFF,0x00,0x1B,0x00,0x03,0x01,0x03,0x02,0x22,0x03,
-0x02,0x02,0x02,0x01,0xFF,0x00,0x10,0x00,0x01,0x01,0x02,0x02,0x2F,0x03,0x02,0x02,
-0x01,0x01,0x99,0x00,0x05,0x01,0x11,0x02,0x04,0x01,0x54,0x00,0x01,0x01,0x01,0x02,
-0x38,0x03,0x01,0x02,0x8E,0x00,0x02,0x01,0x03,0x02,0x22,0x03,0x01,0x02,0x02,0x01,
-0x49,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x87,0x00,0x01,0x01,0x02,0x02,
-0x2E,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x02,
-0x81,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,
-0x48,0x03,0x01,0x01,0x7C,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x38,0x00,0x01,0x01,
-0x4B,0x03,0x01,0x02,0x78,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,0x34,0x00,
-0x01,0x01,0x4E,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x31,0x00,
-0x01,0x02,0x51,0x03,0x72,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x2E,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x6F,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x55,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x29,0x00,
-0x01,0x01,0x57,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x27,0x00,
-0x01,0x01,0x58,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x69,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x25,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x68,0x00,0x57,0x03,0x01,0x01,0x24,0x00,0x01,0x02,0x5A,0x03,
-0x01,0x02,0x67,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x24,0x00,0x5C,0x03,0x67,0x00,
-0x59,0x03,0x23,0x00,0x01,0x01,0x5C,0x03,0x66,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
-0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
-0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
-0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,0x59,0x03,
-0x01,0x02,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x02,0x22,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x01,0x02,
-0x59,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5C,0x03,0x66,0x00,0x01,0x02,0x59,0x03,
-0x01,0x02,0x23,0x00,0x5C,0x03,0x66,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x23,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x23,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x59,0x03,0x01,0x01,0x23,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x01,0x66,0x00,0x01,0x01,0x59,0x03,0x25,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x67,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x25,0x00,0x01,0x02,
-0x59,0x03,0x68,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x58,0x03,
-0x01,0x02,0x68,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x26,0x00,0x01,0x02,0x57,0x03,
-0x01,0x02,0x69,0x00,0x57,0x03,0x27,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x69,0x00,
-0x01,0x02,0x55,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x6B,0x00,
-0x55,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x6B,0x00,0x01,0x01,
-0x53,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x6D,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x52,0x03,0x6F,0x00,0x01,0x02,0x50,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x6F,0x00,0x01,0x01,0x50,0x03,
-0x2F,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x71,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,
-0x2F,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x71,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
-0x31,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x73,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,
-0x32,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x74,0x00,0x01,0x02,0x4A,0x03,0x01,0x02,
-0x34,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x75,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,
-0x34,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x77,0x00,0x01,0x01,0x48,0x03,0x01,0x01,
-0x36,0x00,0x01,0x01,0x47,0x03,0x79,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x38,0x00,
-0x01,0x01,0x45,0x03,0x01,0x01,0x7A,0x00,0x01,0x02,0x45,0x03,0x3A,0x00,0x01,0x02,
-0x43,0x03,0x01,0x01,0x7B,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,0x3B,0x00,
-0x01,0x01,0x41,0x03,0x01,0x01,0x7D,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x3D,0x00,
-0x01,0x01,0x3F,0x03,0x01,0x02,0x7F,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x3F,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x41,0x00,
-0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x01,0x83,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,
-0x44,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x86,0x00,0x01,0x02,0x39,0x03,0x01,0x01,
-0x46,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x89,0x00,0x01,0x02,0x37,0x03,0x01,0x01,
-0x49,0x00,0x01,0x02,0x32,0x03,0x01,0x01,0x8B,0x00,0x01,0x01,0x34,0x03,0x01,0x02,
-0x4C,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x8F,0x00,0x01,0x02,0x31,0x03,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x2B,0x03,0x01,0x02,0x01,0x01,0x91,0x00,0x01,0x01,0x2E,0x03,
-0x01,0x02,0x53,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x95,0x00,
-0x01,0x01,0x2A,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,
-0x01,0x01,0x9A,0x00,0x01,0x01,0x26,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,0x01,0x02,
-0x1B,0x03,0x01,0x02,0x01,0x01,0x9F,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x01,
-0x62,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0xA5,0x00,0x01,0x01,
-0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x04,0x01,0x05,0x02,0x03,0x01,
-0xB0,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0xFF,0x00,0x2F,0x00,
+// Frame 28: Diff RLE (1106 bytes)
+static const uint8_t THINKING_FRAME28_DATA[1106] = {
+0xA5,0x00,0x04,0x01,0x09,0x02,0x06,0x03,0x07,0x02,0x03,0x01,0xBF,0x00,0x03,0x01,
+0x03,0x02,0x22,0x03,0x02,0x02,0x02,0x01,0xB4,0x00,0x01,0x01,0x02,0x02,0x2F,0x03,
+0x02,0x02,0x01,0x01,0x3E,0x00,0x05,0x01,0x11,0x02,0x04,0x01,0x54,0x00,0x01,0x01,
+0x01,0x02,0x38,0x03,0x01,0x02,0x33,0x00,0x02,0x01,0x03,0x02,0x22,0x03,0x01,0x02,
+0x02,0x01,0x49,0x00,0x01,0x01,0x01,0x02,0x3E,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,
+0x02,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x42,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
+0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,0x37,0x03,0x01,0x02,0x01,0x01,0x3C,0x00,
+0x01,0x01,0x48,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x38,0x00,
+0x01,0x01,0x4B,0x03,0x01,0x02,0x1D,0x00,0x01,0x01,0x01,0x02,0x42,0x03,0x01,0x02,
+0x34,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x1A,0x00,0x01,0x01,0x47,0x03,0x01,0x01,
+0x31,0x00,0x01,0x02,0x51,0x03,0x17,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x2E,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x01,0x02,0x4D,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x12,0x00,0x01,0x01,0x50,0x03,0x01,0x01,
+0x29,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x10,0x00,0x01,0x01,0x52,0x03,0x01,0x01,
+0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x0F,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x27,0x00,0x01,0x02,0x59,0x03,0x0E,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x25,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x01,0x0D,0x00,0x57,0x03,0x01,0x01,0x24,0x00,0x01,0x02,
+0x5A,0x03,0x01,0x02,0x0C,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x24,0x00,0x5C,0x03,
+0x0C,0x00,0x59,0x03,0x23,0x00,0x01,0x01,0x5C,0x03,0x0B,0x00,0x01,0x01,0x59,0x03,
+0x01,0x01,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x59,0x03,
+0x01,0x02,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,0x01,0x02,
+0x59,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x22,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5C,0x03,0x01,0x01,0x09,0x00,0x01,0x01,
+0x01,0x02,0x59,0x03,0x01,0x02,0x22,0x00,0x01,0x01,0x5C,0x03,0x0B,0x00,0x01,0x02,
+0x59,0x03,0x01,0x02,0x23,0x00,0x5C,0x03,0x0B,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x23,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x59,0x03,0x01,0x01,
+0x23,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x59,0x03,0x25,0x00,
+0x01,0x02,0x59,0x03,0x01,0x01,0x0C,0x00,0x01,0x02,0x57,0x03,0x01,0x02,0x25,0x00,
+0x01,0x02,0x59,0x03,0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x25,0x00,0x01,0x01,
+0x58,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x01,0x26,0x00,0x01,0x02,
+0x57,0x03,0x01,0x02,0x0E,0x00,0x57,0x03,0x27,0x00,0x01,0x01,0x57,0x03,0x01,0x01,
+0x0E,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x28,0x00,0x01,0x02,0x55,0x03,0x01,0x02,
+0x10,0x00,0x55,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x10,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x10,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x12,0x00,
+0x01,0x02,0x52,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x12,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x52,0x03,0x14,0x00,0x01,0x02,
+0x50,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x50,0x03,0x01,0x01,0x14,0x00,0x01,0x01,
+0x50,0x03,0x2F,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x16,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x02,0x2F,0x00,0x01,0x01,0x4E,0x03,0x01,0x01,0x16,0x00,0x01,0x01,0x4D,0x03,
+0x01,0x02,0x31,0x00,0x01,0x02,0x4C,0x03,0x01,0x02,0x18,0x00,0x01,0x02,0x4C,0x03,
+0x01,0x01,0x32,0x00,0x01,0x02,0x4B,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x4A,0x03,
+0x01,0x02,0x34,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x1A,0x00,0x01,0x01,0x4A,0x03,
+0x01,0x01,0x34,0x00,0x01,0x01,0x48,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x48,0x03,
+0x01,0x01,0x36,0x00,0x01,0x01,0x47,0x03,0x1E,0x00,0x01,0x02,0x46,0x03,0x01,0x02,
+0x38,0x00,0x01,0x01,0x45,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x45,0x03,0x3A,0x00,
+0x01,0x02,0x43,0x03,0x01,0x01,0x20,0x00,0x01,0x01,0x01,0x02,0x43,0x03,0x01,0x01,
+0x3B,0x00,0x01,0x01,0x41,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x42,0x03,0x01,0x01,
+0x3D,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x24,0x00,0x01,0x01,0x40,0x03,0x01,0x01,
+0x3F,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,
+0x41,0x00,0x01,0x01,0x01,0x02,0x3A,0x03,0x01,0x01,0x28,0x00,0x01,0x01,0x3C,0x03,
+0x01,0x01,0x44,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x39,0x03,
+0x01,0x01,0x46,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x37,0x03,
+0x01,0x01,0x49,0x00,0x01,0x02,0x32,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x34,0x03,
+0x01,0x02,0x4C,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x31,0x03,
+0x01,0x01,0x4F,0x00,0x01,0x01,0x2B,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
+0x2E,0x03,0x01,0x02,0x53,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,
+0x3A,0x00,0x01,0x01,0x2A,0x03,0x01,0x02,0x57,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,0x26,0x03,0x01,0x02,0x5C,0x00,0x01,0x01,
+0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x44,0x00,0x01,0x01,0x01,0x02,0x21,0x03,
+0x01,0x01,0x62,0x00,0x01,0x01,0x01,0x02,0x13,0x03,0x01,0x02,0x02,0x01,0x4A,0x00,
+0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x04,0x01,0x05,0x02,
+0x03,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x12,0x03,0x01,0x02,0x02,0x01,0xD3,0x00,
 0x0C,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0x36,0x00,
+0x0F,0x00,
 };
 static const DiffBlock THINKING_FRAME28_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    53, 74,  // Changed box top-left
+    229, 84,  // Changed box dimensions
     THINKING_FRAME28_DATA
 };
 
-// Frame 29: Full frame RLE (1656 bytes)
-static const uint8_t THINKING_FRAME29_DATA[1656] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0x60,0x00,0x02,0x01,0x0E,0x02,0x03,0x01,0xFF,0x00,0x28,0x00,0x01,0x01,0x02,0x02,
-0x18,0x03,0x02,0x02,0x01,0x01,0xA6,0x00,0x02,0x01,0x03,0x02,0x0C,0x03,0x02,0x02,
-0x02,0x01,0x63,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x9D,0x00,
-0x01,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,
-0x28,0x03,0x01,0x02,0x01,0x01,0x96,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x91,0x00,0x01,0x01,
-0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x8D,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,
-0x01,0x01,0x01,0x02,0x36,0x03,0x01,0x02,0x89,0x00,0x01,0x02,0x33,0x03,0x01,0x02,
-0x01,0x01,0x47,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x85,0x00,0x01,0x01,0x37,0x03,
-0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x82,0x00,0x01,0x01,
-0x3B,0x03,0x01,0x02,0x41,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7F,0x00,0x01,0x02,
-0x3E,0x03,0x01,0x01,0x3E,0x00,0x43,0x03,0x01,0x02,0x7D,0x00,0x41,0x03,0x01,0x01,
-0x3B,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x7A,0x00,0x01,0x01,0x43,0x03,0x01,0x02,
-0x39,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x78,0x00,0x01,0x01,0x46,0x03,0x37,0x00,
-0x01,0x01,0x49,0x03,0x01,0x02,0x76,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x35,0x00,
-0x01,0x01,0x4B,0x03,0x01,0x02,0x74,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x34,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x02,0x72,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x32,0x00,
-0x01,0x02,0x4E,0x03,0x01,0x01,0x70,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x30,0x00,
-0x01,0x01,0x50,0x03,0x70,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x2F,0x00,0x51,0x03,
-0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
-0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
-0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x6A,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
-0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
-0x68,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
-0x68,0x00,0x01,0x02,0x56,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x68,0x00,0x01,0x02,
-0x56,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,
-0x58,0x03,0x01,0x01,0x26,0x00,0x59,0x03,0x01,0x02,0x66,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x26,0x00,0x59,0x03,0x01,0x02,0x01,0x01,0x65,0x00,0x59,0x03,0x01,0x02,
-0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,
-0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x24,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x24,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x24,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x24,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x64,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,
-0x24,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x24,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,
-0x25,0x00,0x5A,0x03,0x01,0x02,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,
-0x5A,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x59,0x03,0x01,0x01,0x65,0x00,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x59,0x03,
-0x01,0x01,0x65,0x00,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x58,0x03,0x01,0x02,
-0x66,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x66,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x57,0x03,0x01,0x01,
-0x67,0x00,0x58,0x03,0x28,0x00,0x01,0x01,0x57,0x03,0x68,0x00,0x01,0x02,0x56,0x03,
-0x01,0x02,0x29,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x68,0x00,0x01,0x01,0x56,0x03,
-0x01,0x01,0x29,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x68,0x00,0x01,0x01,0x56,0x03,
-0x2A,0x00,0x01,0x01,0x55,0x03,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,
-0x01,0x02,0x53,0x03,0x01,0x02,0x6A,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x2B,0x00,
-0x01,0x01,0x53,0x03,0x01,0x01,0x6B,0x00,0x01,0x02,0x53,0x03,0x2D,0x00,0x01,0x02,
-0x51,0x03,0x01,0x02,0x6C,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,
-0x51,0x03,0x01,0x01,0x6D,0x00,0x52,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,0x4F,0x03,
-0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x4F,0x03,
-0x01,0x01,0x6F,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x4D,0x03,
-0x01,0x02,0x70,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x32,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x01,0x71,0x00,0x01,0x02,0x4D,0x03,0x33,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,
-0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x49,0x03,0x01,0x02,
-0x74,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x36,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x75,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x46,0x03,0x01,0x01,
-0x77,0x00,0x48,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x78,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x44,0x03,0x7A,0x00,0x01,0x01,
-0x45,0x03,0x3C,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,0x43,0x03,
-0x3E,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x7D,0x00,0x01,0x02,0x41,0x03,0x01,0x01,
-0x3F,0x00,0x01,0x01,0x3E,0x03,0x01,0x01,0x7F,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,
-0x41,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x81,0x00,0x01,0x02,0x3D,0x03,0x01,0x01,
-0x43,0x00,0x01,0x01,0x3A,0x03,0x84,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x46,0x00,
-0x01,0x02,0x36,0x03,0x01,0x02,0x86,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,
-0x48,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x88,0x00,0x01,0x01,0x36,0x03,0x01,0x02,
-0x4B,0x00,0x01,0x01,0x32,0x03,0x01,0x01,0x8B,0x00,0x01,0x02,0x33,0x03,0x01,0x01,
-0x4E,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,0x8E,0x00,0x01,0x01,0x30,0x03,0x01,0x02,
-0x01,0x01,0x51,0x00,0x01,0x02,0x2A,0x03,0x01,0x02,0x92,0x00,0x01,0x02,0x2D,0x03,
-0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x94,0x00,
-0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x22,0x03,
-0x01,0x02,0x01,0x01,0x98,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x5D,0x00,
-0x01,0x01,0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x9D,0x00,0x01,0x01,0x01,0x02,
-0x20,0x03,0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,
-0x01,0x01,0xA3,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,
-0x02,0x01,0x02,0x02,0x08,0x03,0x02,0x02,0x02,0x01,0xAC,0x00,0x01,0x01,0x01,0x02,
-0x12,0x03,0x02,0x02,0x01,0x01,0xFF,0x00,0x2F,0x00,0x02,0x01,0x08,0x02,0x03,0x01,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFB,0x00,
+// Frame 29: Diff RLE (1316 bytes)
+static const uint8_t THINKING_FRAME29_DATA[1316] = {
+0xA5,0x00,0x02,0x01,0x0E,0x02,0x03,0x01,0xC5,0x00,0x01,0x01,0x02,0x02,0x18,0x03,
+0x02,0x02,0x01,0x01,0x44,0x00,0x02,0x01,0x03,0x02,0x0C,0x03,0x02,0x02,0x02,0x01,
+0x63,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,
+0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x5A,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x01,0x01,0x34,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,
+0x54,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x01,0x02,
+0x29,0x03,0x01,0x02,0x01,0x01,0x4F,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,
+0x2B,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x4A,0x00,0x01,0x01,
+0x01,0x02,0x36,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x33,0x03,0x01,0x02,0x01,0x01,
+0x47,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x37,0x03,0x01,0x02,
+0x01,0x01,0x43,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x20,0x00,0x01,0x01,0x3B,0x03,
+0x01,0x02,0x41,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x3E,0x03,
+0x01,0x01,0x3E,0x00,0x43,0x03,0x01,0x02,0x1B,0x00,0x41,0x03,0x01,0x01,0x3B,0x00,
+0x01,0x01,0x45,0x03,0x01,0x02,0x18,0x00,0x01,0x01,0x43,0x03,0x01,0x02,0x39,0x00,
+0x01,0x01,0x47,0x03,0x01,0x02,0x16,0x00,0x01,0x01,0x46,0x03,0x37,0x00,0x01,0x01,
+0x49,0x03,0x01,0x02,0x14,0x00,0x01,0x01,0x47,0x03,0x01,0x02,0x35,0x00,0x01,0x01,
+0x4B,0x03,0x01,0x02,0x12,0x00,0x01,0x01,0x49,0x03,0x01,0x02,0x34,0x00,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x32,0x00,0x01,0x02,
+0x4E,0x03,0x01,0x01,0x0E,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x30,0x00,0x01,0x01,
+0x50,0x03,0x0E,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,0x2F,0x00,0x51,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x02,0x50,0x03,0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x01,0x51,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x0A,0x00,
+0x01,0x02,0x52,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x08,0x00,
+0x01,0x01,0x53,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x08,0x00,
+0x01,0x02,0x54,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x06,0x00,
+0x01,0x01,0x55,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x06,0x00,
+0x01,0x02,0x56,0x03,0x28,0x00,0x01,0x01,0x58,0x03,0x06,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x04,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x04,0x00,0x01,0x02,0x58,0x03,
+0x01,0x01,0x26,0x00,0x59,0x03,0x01,0x02,0x04,0x00,0x01,0x02,0x58,0x03,0x01,0x01,
+0x26,0x00,0x59,0x03,0x01,0x02,0x01,0x01,0x03,0x00,0x59,0x03,0x01,0x02,0x25,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x25,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x25,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x01,0x02,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x24,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x24,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x24,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x24,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x24,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x24,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,
+0x5A,0x03,0x01,0x02,0x02,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,0x5A,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x02,0x59,0x03,
+0x01,0x01,0x03,0x00,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x02,0x59,0x03,0x01,0x01,
+0x03,0x00,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x04,0x00,
+0x01,0x02,0x58,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x04,0x00,
+0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x27,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x05,0x00,
+0x58,0x03,0x28,0x00,0x01,0x01,0x57,0x03,0x06,0x00,0x01,0x02,0x56,0x03,0x01,0x02,
+0x29,0x00,0x01,0x02,0x55,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
+0x29,0x00,0x01,0x01,0x55,0x03,0x01,0x01,0x06,0x00,0x01,0x01,0x56,0x03,0x2A,0x00,
+0x01,0x01,0x55,0x03,0x08,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,
+0x53,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,
+0x53,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x53,0x03,0x2D,0x00,0x01,0x02,0x51,0x03,
+0x01,0x02,0x0A,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x51,0x03,
+0x01,0x01,0x0B,0x00,0x52,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,0x4F,0x03,0x01,0x02,
+0x0C,0x00,0x01,0x02,0x50,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x4F,0x03,0x01,0x01,
+0x0D,0x00,0x01,0x02,0x4F,0x03,0x01,0x01,0x30,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,
+0x0E,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x32,0x00,0x01,0x02,0x4C,0x03,0x01,0x01,
+0x0F,0x00,0x01,0x02,0x4D,0x03,0x33,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x10,0x00,
+0x01,0x01,0x4C,0x03,0x01,0x02,0x34,0x00,0x01,0x02,0x49,0x03,0x01,0x02,0x12,0x00,
+0x01,0x01,0x4A,0x03,0x01,0x02,0x36,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x13,0x00,
+0x01,0x02,0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x15,0x00,
+0x48,0x03,0x01,0x01,0x38,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x16,0x00,0x01,0x01,
+0x46,0x03,0x01,0x02,0x3A,0x00,0x01,0x01,0x44,0x03,0x18,0x00,0x01,0x01,0x45,0x03,
+0x3C,0x00,0x01,0x01,0x42,0x03,0x01,0x01,0x19,0x00,0x01,0x02,0x43,0x03,0x3E,0x00,
+0x01,0x01,0x40,0x03,0x01,0x01,0x1B,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x3F,0x00,
+0x01,0x01,0x3E,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x3F,0x03,0x01,0x01,0x41,0x00,
+0x01,0x01,0x3C,0x03,0x01,0x01,0x1F,0x00,0x01,0x02,0x3D,0x03,0x01,0x01,0x43,0x00,
+0x01,0x01,0x3A,0x03,0x22,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x46,0x00,0x01,0x02,
+0x36,0x03,0x01,0x02,0x24,0x00,0x01,0x02,0x38,0x03,0x01,0x02,0x01,0x01,0x48,0x00,
+0x01,0x02,0x34,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x36,0x03,0x01,0x02,0x4B,0x00,
+0x01,0x01,0x32,0x03,0x01,0x01,0x29,0x00,0x01,0x02,0x33,0x03,0x01,0x01,0x4E,0x00,
+0x01,0x02,0x2E,0x03,0x01,0x02,0x2C,0x00,0x01,0x01,0x30,0x03,0x01,0x02,0x01,0x01,
+0x51,0x00,0x01,0x02,0x2A,0x03,0x01,0x02,0x30,0x00,0x01,0x02,0x2D,0x03,0x01,0x01,
+0x54,0x00,0x01,0x01,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x32,0x00,0x01,0x01,
+0x01,0x02,0x29,0x03,0x01,0x02,0x58,0x00,0x01,0x01,0x01,0x02,0x22,0x03,0x01,0x02,
+0x01,0x01,0x36,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,
+0x01,0x02,0x1C,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x20,0x03,
+0x01,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x02,0x02,0x14,0x03,0x02,0x02,0x01,0x01,
+0x41,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x6A,0x00,0x02,0x01,
+0x02,0x02,0x08,0x03,0x02,0x02,0x02,0x01,0x4A,0x00,0x01,0x01,0x01,0x02,0x12,0x03,
+0x02,0x02,0x01,0x01,0xCC,0x00,0x02,0x01,0x08,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0x46,0x00,
 };
 static const DiffBlock THINKING_FRAME29_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    51, 57,  // Changed box top-left
+    222, 85,  // Changed box dimensions
     THINKING_FRAME29_DATA
 };
 
-// Frame 30: Full frame RLE (1666 bytes)
-static const uint8_t THINKING_FRAME30_DATA[1666] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x9F,0x00,0x0B,0x01,0xFF,0x00,0x30,0x00,
-0x01,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,0xA8,0x00,0x02,0x01,0x02,0x02,
-0x0D,0x03,0x03,0x02,0x02,0x01,0x66,0x00,0x01,0x01,0x01,0x02,0x1B,0x03,0x02,0x02,
-0x01,0x01,0xA0,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,0x01,0x02,0x01,0x01,0x5F,0x00,
-0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x9A,0x00,0x01,0x02,0x21,0x03,0x01,0x02,
-0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x28,0x03,0x01,0x02,0x95,0x00,0x01,0x01,
-0x27,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x2D,0x03,0x01,0x02,0x91,0x00,
-0x01,0x02,0x2C,0x03,0x01,0x01,0x50,0x00,0x01,0x01,0x31,0x03,0x01,0x02,0x8D,0x00,
-0x01,0x02,0x30,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,0x35,0x03,0x01,0x02,0x89,0x00,
-0x01,0x02,0x34,0x03,0x01,0x01,0x49,0x00,0x01,0x02,0x38,0x03,0x01,0x01,0x85,0x00,
-0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,0x45,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,
-0x83,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x43,0x00,0x01,0x02,0x3E,0x03,0x80,0x00,
-0x01,0x01,0x3D,0x03,0x01,0x02,0x41,0x00,0x01,0x02,0x40,0x03,0x01,0x01,0x7D,0x00,
-0x01,0x01,0x40,0x03,0x01,0x01,0x3E,0x00,0x43,0x03,0x01,0x01,0x7B,0x00,0x01,0x02,
-0x42,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x79,0x00,0x01,0x02,
-0x44,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x47,0x03,0x01,0x01,0x77,0x00,0x01,0x02,
-0x46,0x03,0x01,0x01,0x38,0x00,0x49,0x03,0x01,0x01,0x75,0x00,0x01,0x02,0x48,0x03,
-0x01,0x01,0x36,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x73,0x00,0x01,0x01,0x4A,0x03,
-0x01,0x01,0x34,0x00,0x01,0x02,0x4C,0x03,0x72,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,
-0x32,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x71,0x00,0x4D,0x03,0x01,0x02,0x32,0x00,
-0x4F,0x03,0x01,0x01,0x6F,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x30,0x00,0x01,0x02,
-0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,0x50,0x03,0x2F,0x00,0x01,0x01,0x51,0x03,
-0x01,0x02,0x6C,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x2E,0x00,0x01,0x02,0x52,0x03,
-0x01,0x01,0x6B,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2C,0x00,0x01,0x01,0x53,0x03,
-0x01,0x02,0x6A,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x54,0x03,
-0x01,0x01,0x69,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x55,0x03,
-0x01,0x02,0x69,0x00,0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
-0x67,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x57,0x03,0x01,0x02,0x67,0x00,
-0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,0x66,0x00,0x01,0x01,0x58,0x03,
-0x28,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
-0x27,0x00,0x59,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x26,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x65,0x00,0x59,0x03,0x01,0x02,0x26,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,
-0x01,0x02,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,0x01,0x02,
-0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,0x01,0x02,0x62,0x00,0x01,0x01,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,0x01,0x02,0x62,0x00,0x01,0x01,
-0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,0x01,0x02,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,
-0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,
-0x5A,0x03,0x01,0x01,0x26,0x00,0x5A,0x03,0x01,0x01,0x63,0x00,0x01,0x01,0x5A,0x03,
-0x01,0x01,0x26,0x00,0x59,0x03,0x01,0x02,0x01,0x01,0x64,0x00,0x5A,0x03,0x27,0x00,
-0x01,0x02,0x58,0x03,0x01,0x02,0x65,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x27,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x27,0x00,
-0x01,0x01,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x28,0x00,
-0x01,0x02,0x57,0x03,0x67,0x00,0x58,0x03,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
-0x67,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x01,
-0x67,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,0x69,0x00,
-0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,0x69,0x00,
-0x01,0x01,0x54,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x6B,0x00,
-0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
-0x6B,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,0x50,0x03,0x01,0x02,
-0x6D,0x00,0x01,0x02,0x51,0x03,0x30,0x00,0x50,0x03,0x01,0x01,0x6D,0x00,0x01,0x01,
-0x50,0x03,0x01,0x01,0x30,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x6F,0x00,0x01,0x02,
-0x4F,0x03,0x32,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x6F,0x00,0x01,0x01,0x4E,0x03,
-0x01,0x01,0x32,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x71,0x00,0x01,0x02,0x4C,0x03,
-0x01,0x02,0x34,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x73,0x00,0x01,0x02,0x4A,0x03,
-0x01,0x02,0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x74,0x00,0x4A,0x03,0x01,0x01,
-0x37,0x00,0x01,0x02,0x47,0x03,0x01,0x01,0x75,0x00,0x01,0x01,0x48,0x03,0x01,0x01,
-0x38,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x77,0x00,0x01,0x01,0x46,0x03,0x01,0x02,
-0x3A,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x79,0x00,0x01,0x02,0x44,0x03,0x01,0x02,
-0x3C,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x7B,0x00,0x01,0x02,0x42,0x03,0x01,0x02,
-0x3E,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x7D,0x00,0x01,0x02,0x40,0x03,0x01,0x02,
-0x40,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x7F,0x00,0x01,0x02,0x3E,0x03,0x01,0x02,
-0x42,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x81,0x00,0x01,0x02,0x3C,0x03,0x01,0x02,
-0x45,0x00,0x01,0x02,0x39,0x03,0x01,0x01,0x83,0x00,0x01,0x01,0x3A,0x03,0x01,0x01,
-0x47,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x86,0x00,0x38,0x03,0x01,0x01,0x49,0x00,
-0x01,0x01,0x34,0x03,0x01,0x02,0x89,0x00,0x01,0x02,0x34,0x03,0x01,0x02,0x4D,0x00,
-0x01,0x02,0x31,0x03,0x01,0x01,0x8B,0x00,0x01,0x01,0x32,0x03,0x01,0x01,0x4F,0x00,
-0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x8F,0x00,0x01,0x02,0x2E,0x03,0x01,0x02,
-0x53,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x93,0x00,0x01,0x02,0x2A,0x03,
-0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,0x97,0x00,
-0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,0x1F,0x03,
-0x01,0x02,0x01,0x01,0x9B,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x01,0x60,0x00,
-0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0xA1,0x00,0x01,0x01,0x01,0x02,
-0x1B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x02,0x01,0x01,0x02,0x11,0x03,0x01,0x02,
-0x01,0x01,0xA8,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,0x70,0x00,
-0x0A,0x01,0xB3,0x00,0x02,0x01,0x0A,0x02,0x02,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFC,0x00,
+// Frame 30: Diff RLE (1326 bytes)
+static const uint8_t THINKING_FRAME30_DATA[1326] = {
+0xAA,0x00,0x0B,0x01,0xCD,0x00,0x01,0x01,0x03,0x02,0x0F,0x03,0x03,0x02,0x02,0x01,
+0x46,0x00,0x02,0x01,0x02,0x02,0x0D,0x03,0x03,0x02,0x02,0x01,0x66,0x00,0x01,0x01,
+0x01,0x02,0x1B,0x03,0x02,0x02,0x01,0x01,0x3E,0x00,0x01,0x01,0x01,0x02,0x1A,0x03,
+0x01,0x02,0x01,0x01,0x5F,0x00,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x38,0x00,
+0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
+0x01,0x02,0x33,0x00,0x01,0x01,0x27,0x03,0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,
+0x2D,0x03,0x01,0x02,0x2F,0x00,0x01,0x02,0x2C,0x03,0x01,0x01,0x50,0x00,0x01,0x01,
+0x31,0x03,0x01,0x02,0x2B,0x00,0x01,0x02,0x30,0x03,0x01,0x01,0x4C,0x00,0x01,0x01,
+0x35,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x34,0x03,0x01,0x01,0x49,0x00,0x01,0x02,
+0x38,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x01,0x01,0x45,0x00,
+0x01,0x01,0x3B,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x3A,0x03,0x01,0x01,0x43,0x00,
+0x01,0x02,0x3E,0x03,0x1E,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x41,0x00,0x01,0x02,
+0x40,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x40,0x03,0x01,0x01,0x3E,0x00,0x43,0x03,
+0x01,0x01,0x19,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x3B,0x00,0x01,0x01,0x45,0x03,
+0x01,0x02,0x17,0x00,0x01,0x02,0x44,0x03,0x01,0x01,0x39,0x00,0x01,0x01,0x47,0x03,
+0x01,0x01,0x15,0x00,0x01,0x02,0x46,0x03,0x01,0x01,0x38,0x00,0x49,0x03,0x01,0x01,
+0x13,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x36,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,
+0x11,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x34,0x00,0x01,0x02,0x4C,0x03,0x10,0x00,
+0x01,0x01,0x4C,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x4D,0x03,0x01,0x02,0x0F,0x00,
+0x4D,0x03,0x01,0x02,0x32,0x00,0x4F,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x4E,0x03,
+0x01,0x02,0x30,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x0B,0x00,0x01,0x01,0x50,0x03,
+0x2F,0x00,0x01,0x01,0x51,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x51,0x03,0x01,0x02,
+0x2E,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x09,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
+0x2C,0x00,0x01,0x01,0x53,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x53,0x03,0x01,0x02,
+0x2C,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
+0x2A,0x00,0x01,0x01,0x55,0x03,0x01,0x02,0x07,0x00,0x55,0x03,0x01,0x02,0x2A,0x00,
+0x01,0x02,0x56,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,
+0x57,0x03,0x01,0x02,0x05,0x00,0x57,0x03,0x01,0x02,0x28,0x00,0x01,0x01,0x58,0x03,
+0x04,0x00,0x01,0x01,0x58,0x03,0x28,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x03,0x00,
+0x01,0x01,0x58,0x03,0x01,0x01,0x27,0x00,0x59,0x03,0x01,0x02,0x03,0x00,0x01,0x02,
+0x58,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x03,0x00,0x59,0x03,
+0x01,0x02,0x26,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x01,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x01,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x02,0x25,0x00,0x5B,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,
+0x25,0x00,0x5B,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,
+0x5B,0x03,0x01,0x02,0x01,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,
+0x01,0x02,0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,0x01,0x02,
+0x01,0x01,0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x5B,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x01,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x01,0x00,
+0x01,0x01,0x5A,0x03,0x01,0x01,0x26,0x00,0x5A,0x03,0x01,0x01,0x01,0x00,0x01,0x01,
+0x5A,0x03,0x01,0x01,0x26,0x00,0x59,0x03,0x01,0x02,0x01,0x01,0x02,0x00,0x5A,0x03,
+0x27,0x00,0x01,0x02,0x58,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x58,0x03,0x01,0x02,
+0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
+0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x58,0x03,0x01,0x01,
+0x28,0x00,0x01,0x02,0x57,0x03,0x05,0x00,0x58,0x03,0x29,0x00,0x01,0x01,0x56,0x03,
+0x01,0x02,0x05,0x00,0x01,0x02,0x56,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x56,0x03,
+0x01,0x01,0x05,0x00,0x01,0x01,0x56,0x03,0x01,0x01,0x2A,0x00,0x01,0x02,0x55,0x03,
+0x07,0x00,0x01,0x02,0x54,0x03,0x01,0x02,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x01,
+0x07,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x2C,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
+0x09,0x00,0x01,0x02,0x52,0x03,0x01,0x02,0x01,0x01,0x2C,0x00,0x01,0x01,0x52,0x03,
+0x01,0x02,0x09,0x00,0x01,0x01,0x52,0x03,0x01,0x01,0x2E,0x00,0x01,0x02,0x50,0x03,
+0x01,0x02,0x0B,0x00,0x01,0x02,0x51,0x03,0x30,0x00,0x50,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x50,0x03,0x01,0x01,0x30,0x00,0x01,0x02,0x4E,0x03,0x01,0x02,0x0D,0x00,
+0x01,0x02,0x4F,0x03,0x32,0x00,0x01,0x02,0x4D,0x03,0x01,0x01,0x0D,0x00,0x01,0x01,
+0x4E,0x03,0x01,0x01,0x32,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,
+0x4C,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x11,0x00,0x01,0x02,
+0x4A,0x03,0x01,0x02,0x36,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x12,0x00,0x4A,0x03,
+0x01,0x01,0x37,0x00,0x01,0x02,0x47,0x03,0x01,0x01,0x13,0x00,0x01,0x01,0x48,0x03,
+0x01,0x01,0x38,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x15,0x00,0x01,0x01,0x46,0x03,
+0x01,0x02,0x3A,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x44,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x01,0x42,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x42,0x03,
+0x01,0x02,0x3E,0x00,0x01,0x01,0x40,0x03,0x01,0x02,0x1B,0x00,0x01,0x02,0x40,0x03,
+0x01,0x02,0x40,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x3E,0x03,
+0x01,0x02,0x42,0x00,0x01,0x01,0x3C,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x3C,0x03,
+0x01,0x02,0x45,0x00,0x01,0x02,0x39,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x3A,0x03,
+0x01,0x01,0x47,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x24,0x00,0x38,0x03,0x01,0x01,
+0x49,0x00,0x01,0x01,0x34,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x34,0x03,0x01,0x02,
+0x4D,0x00,0x01,0x02,0x31,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x32,0x03,0x01,0x01,
+0x4F,0x00,0x01,0x01,0x01,0x02,0x2D,0x03,0x01,0x02,0x2D,0x00,0x01,0x02,0x2E,0x03,
+0x01,0x02,0x53,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x31,0x00,0x01,0x02,
+0x2A,0x03,0x01,0x02,0x01,0x01,0x56,0x00,0x01,0x01,0x01,0x02,0x25,0x03,0x01,0x02,
+0x35,0x00,0x01,0x02,0x26,0x03,0x01,0x02,0x01,0x01,0x5B,0x00,0x01,0x01,0x01,0x02,
+0x1F,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x01,
+0x60,0x00,0x02,0x01,0x01,0x02,0x19,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x01,0x02,0x1B,0x03,0x01,0x02,0x01,0x01,0x66,0x00,0x02,0x01,0x01,0x02,0x11,0x03,
+0x01,0x02,0x01,0x01,0x46,0x00,0x01,0x01,0x02,0x02,0x13,0x03,0x01,0x02,0x01,0x01,
+0x70,0x00,0x0A,0x01,0x51,0x00,0x02,0x01,0x0A,0x02,0x02,0x01,0xA8,0x00,
 };
 static const DiffBlock THINKING_FRAME30_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    49, 54,  // Changed box top-left
+    222, 85,  // Changed box dimensions
     THINKING_FRAME30_DATA
 };
 
-// Frame 31: Full frame RLE (1544 bytes)
-static const uint8_t THINKING_FRAME31_DATA[1544] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xAF,0x00,0x03,0x01,0x0D,0x02,0x03,0x01,0x6D,0x00,0x02,0x01,
-0x04,0x02,0x0B,0x03,0x03,0x02,0x02,0x01,0xA4,0x00,0x02,0x01,0x02,0x02,0x18,0x03,
-0x02,0x02,0x01,0x01,0x62,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,
-0x9A,0x00,0x02,0x01,0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,
-0x02,0x02,0x23,0x03,0x01,0x02,0x02,0x01,0x93,0x00,0x01,0x01,0x01,0x02,0x29,0x03,
-0x01,0x02,0x01,0x01,0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x02,0x02,0x8F,0x00,
-0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,
-0x01,0x02,0x01,0x01,0x89,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x4A,0x00,
-0x01,0x01,0x01,0x02,0x35,0x03,0x01,0x02,0x85,0x00,0x01,0x01,0x01,0x02,0x38,0x03,
-0x01,0x02,0x46,0x00,0x01,0x01,0x3A,0x03,0x01,0x02,0x81,0x00,0x01,0x01,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x42,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x7E,0x00,
-0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x7A,0x00,
-0x01,0x01,0x43,0x03,0x01,0x02,0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x78,0x00,
-0x01,0x02,0x46,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x47,0x03,0x01,0x01,0x74,0x00,
-0x01,0x01,0x49,0x03,0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x72,0x00,
-0x01,0x01,0x4C,0x03,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x70,0x00,0x01,0x02,
-0x4E,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,
-0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,
-0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x01,
-0x55,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x01,
-0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x65,0x00,0x01,0x02,0x58,0x03,
-0x01,0x01,0x27,0x00,0x01,0x02,0x59,0x03,0x64,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,
-0x01,0x02,0x5B,0x03,0x01,0x01,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,
-0x01,0x01,0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,
-0x01,0x02,0x5D,0x03,0x01,0x01,0x5F,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,
-0x01,0x01,0x5E,0x03,0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,
-0x01,0x02,0x5F,0x03,0x01,0x01,0x5D,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x60,0x03,
-0x01,0x01,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,
-0x01,0x02,0x5C,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x01,0x62,0x03,0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,
-0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,
-0x62,0x03,0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x62,0x03,0x1F,0x00,
-0x01,0x02,0x61,0x03,0x01,0x01,0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,
-0x01,0x02,0x61,0x03,0x5D,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,
-0x60,0x03,0x01,0x02,0x5D,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x60,0x03,0x01,0x01,
-0x5D,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x5F,0x00,
-0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,
-0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x60,0x00,
-0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x61,0x00,
-0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x62,0x00,
-0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x63,0x00,
-0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x65,0x00,
-0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x66,0x00,
-0x01,0x02,0x56,0x03,0x01,0x01,0x2A,0x00,0x56,0x03,0x01,0x01,0x68,0x00,0x01,0x02,
-0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x6A,0x00,0x53,0x03,
-0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x6B,0x00,0x01,0x01,0x01,0x02,
-0x50,0x03,0x01,0x02,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6E,0x00,0x4F,0x03,
-0x01,0x02,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x70,0x00,0x4D,0x03,0x01,0x02,
-0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x72,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,
-0x35,0x00,0x01,0x01,0x4A,0x03,0x01,0x02,0x74,0x00,0x01,0x02,0x48,0x03,0x01,0x01,
-0x38,0x00,0x01,0x02,0x47,0x03,0x01,0x01,0x76,0x00,0x01,0x01,0x45,0x03,0x01,0x02,
-0x3B,0x00,0x01,0x02,0x44,0x03,0x01,0x02,0x01,0x01,0x79,0x00,0x01,0x02,0x42,0x03,
-0x01,0x01,0x3D,0x00,0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x7C,0x00,0x01,0x01,
-0x3F,0x03,0x01,0x02,0x41,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x01,0x01,0x7F,0x00,
-0x01,0x02,0x3C,0x03,0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x83,0x00,
-0x01,0x02,0x38,0x03,0x01,0x01,0x48,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x87,0x00,
-0x01,0x02,0x34,0x03,0x01,0x01,0x4C,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,
-0x8B,0x00,0x01,0x01,0x2F,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x2E,0x03,
-0x01,0x02,0x90,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x01,0x56,0x00,0x01,0x02,
-0x28,0x03,0x01,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,
-0x01,0x01,0x5C,0x00,0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x9C,0x00,
-0x01,0x01,0x02,0x02,0x1A,0x03,0x01,0x02,0x02,0x01,0x62,0x00,0x02,0x01,0x01,0x02,
-0x18,0x03,0x02,0x02,0x01,0x01,0xA5,0x00,0x02,0x01,0x03,0x02,0x0B,0x03,0x04,0x02,
-0x02,0x01,0x6D,0x00,0x02,0x01,0x0E,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0x74,0x00,
+// Frame 31: Diff RLE (1160 bytes)
+static const uint8_t THINKING_FRAME31_DATA[1160] = {
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
+0x52,0x00,0x03,0x01,0x0D,0x02,0x03,0x01,0x6D,0x00,0x02,0x01,0x04,0x02,0x0B,0x03,
+0x03,0x02,0x02,0x01,0x49,0x00,0x02,0x01,0x02,0x02,0x18,0x03,0x02,0x02,0x01,0x01,
+0x62,0x00,0x01,0x01,0x02,0x02,0x1A,0x03,0x02,0x02,0x02,0x01,0x3F,0x00,0x02,0x01,
+0x01,0x02,0x22,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x01,0x01,0x02,0x02,0x23,0x03,
+0x01,0x02,0x02,0x01,0x38,0x00,0x01,0x01,0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,
+0x54,0x00,0x01,0x01,0x01,0x02,0x2A,0x03,0x02,0x02,0x34,0x00,0x01,0x02,0x2F,0x03,
+0x01,0x02,0x01,0x01,0x4E,0x00,0x01,0x01,0x01,0x02,0x30,0x03,0x01,0x02,0x01,0x01,
+0x2E,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x02,0x4A,0x00,0x01,0x01,0x01,0x02,
+0x35,0x03,0x01,0x02,0x2A,0x00,0x01,0x01,0x01,0x02,0x38,0x03,0x01,0x02,0x46,0x00,
+0x01,0x01,0x3A,0x03,0x01,0x02,0x26,0x00,0x01,0x01,0x01,0x02,0x3C,0x03,0x01,0x02,
+0x42,0x00,0x01,0x01,0x01,0x02,0x3D,0x03,0x01,0x01,0x23,0x00,0x01,0x02,0x40,0x03,
+0x01,0x01,0x3F,0x00,0x01,0x02,0x41,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x43,0x03,
+0x01,0x02,0x3C,0x00,0x01,0x01,0x44,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x46,0x03,
+0x01,0x01,0x39,0x00,0x01,0x02,0x47,0x03,0x01,0x01,0x19,0x00,0x01,0x01,0x49,0x03,
+0x01,0x02,0x36,0x00,0x01,0x01,0x4A,0x03,0x01,0x01,0x17,0x00,0x01,0x01,0x4C,0x03,
+0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x02,0x15,0x00,0x01,0x02,0x4E,0x03,0x01,0x01,
+0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x13,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
+0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x11,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
+0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x0F,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x0D,0x00,0x01,0x01,0x55,0x03,0x01,0x02,
+0x2A,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x0B,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
+0x29,0x00,0x58,0x03,0x01,0x01,0x0A,0x00,0x01,0x02,0x58,0x03,0x01,0x01,0x27,0x00,
+0x01,0x02,0x59,0x03,0x09,0x00,0x01,0x02,0x5A,0x03,0x26,0x00,0x01,0x01,0x5A,0x03,
+0x01,0x02,0x07,0x00,0x01,0x01,0x5B,0x03,0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,
+0x01,0x01,0x06,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,
+0x01,0x02,0x05,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,
+0x01,0x01,0x04,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,
+0x01,0x02,0x03,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,
+0x01,0x01,0x02,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x60,0x03,0x01,0x01,0x02,0x00,
+0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x02,0x01,0x62,0x03,
+0x1F,0x00,0x62,0x03,0x01,0x01,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x01,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x02,0x02,
+0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x02,0x02,0x62,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x62,0x03,0x02,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x62,0x03,0x02,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x02,0x02,
+0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,0x62,0x03,0x02,0x02,0x62,0x03,0x01,0x01,
+0x1D,0x00,0x01,0x01,0x62,0x03,0x02,0x02,0x62,0x03,0x01,0x01,0x1D,0x00,0x01,0x01,
+0x62,0x03,0x02,0x02,0x62,0x03,0x1F,0x00,0x62,0x03,0x02,0x01,0x62,0x03,0x1F,0x00,
+0x01,0x02,0x61,0x03,0x02,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,
+0x02,0x00,0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x02,
+0x02,0x00,0x01,0x01,0x60,0x03,0x21,0x00,0x60,0x03,0x01,0x01,0x02,0x00,0x01,0x01,
+0x5F,0x03,0x01,0x02,0x21,0x00,0x01,0x02,0x5F,0x03,0x04,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x04,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x01,0x01,0x05,0x00,0x01,0x02,0x5C,0x03,
+0x01,0x01,0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x5B,0x03,
+0x01,0x02,0x25,0x00,0x01,0x02,0x5B,0x03,0x01,0x01,0x07,0x00,0x01,0x02,0x5A,0x03,
+0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x01,0x08,0x00,0x01,0x01,0x59,0x03,
+0x01,0x02,0x27,0x00,0x01,0x01,0x58,0x03,0x01,0x02,0x0A,0x00,0x01,0x01,0x57,0x03,
+0x01,0x02,0x29,0x00,0x01,0x02,0x57,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x56,0x03,
+0x01,0x01,0x2A,0x00,0x56,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
+0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x0F,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,
+0x01,0x01,0x52,0x03,0x01,0x02,0x10,0x00,0x01,0x01,0x01,0x02,0x50,0x03,0x01,0x02,
+0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x13,0x00,0x4F,0x03,0x01,0x02,0x31,0x00,
+0x01,0x01,0x4E,0x03,0x01,0x02,0x15,0x00,0x4D,0x03,0x01,0x02,0x33,0x00,0x01,0x01,
+0x4C,0x03,0x01,0x02,0x17,0x00,0x01,0x02,0x4A,0x03,0x01,0x01,0x35,0x00,0x01,0x01,
+0x4A,0x03,0x01,0x02,0x19,0x00,0x01,0x02,0x48,0x03,0x01,0x01,0x38,0x00,0x01,0x02,
+0x47,0x03,0x01,0x01,0x1B,0x00,0x01,0x01,0x45,0x03,0x01,0x02,0x3B,0x00,0x01,0x02,
+0x44,0x03,0x01,0x02,0x01,0x01,0x1E,0x00,0x01,0x02,0x42,0x03,0x01,0x01,0x3D,0x00,
+0x01,0x01,0x01,0x02,0x41,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
+0x41,0x00,0x01,0x01,0x3E,0x03,0x01,0x02,0x01,0x01,0x24,0x00,0x01,0x02,0x3C,0x03,
+0x01,0x01,0x44,0x00,0x01,0x02,0x3B,0x03,0x01,0x01,0x28,0x00,0x01,0x02,0x38,0x03,
+0x01,0x01,0x48,0x00,0x01,0x02,0x37,0x03,0x01,0x01,0x2C,0x00,0x01,0x02,0x34,0x03,
+0x01,0x01,0x4C,0x00,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x30,0x00,0x01,0x01,
+0x2F,0x03,0x01,0x02,0x01,0x01,0x50,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,0x35,0x00,
+0x01,0x01,0x01,0x02,0x2A,0x03,0x01,0x01,0x56,0x00,0x01,0x02,0x28,0x03,0x01,0x02,
+0x01,0x01,0x3A,0x00,0x01,0x01,0x01,0x02,0x23,0x03,0x01,0x02,0x01,0x01,0x5C,0x00,
+0x01,0x01,0x01,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x41,0x00,0x01,0x01,0x02,0x02,
+0x1A,0x03,0x01,0x02,0x02,0x01,0x62,0x00,0x02,0x01,0x01,0x02,0x18,0x03,0x02,0x02,
+0x01,0x01,0x4A,0x00,0x02,0x01,0x03,0x02,0x0B,0x03,0x04,0x02,0x02,0x01,0x6D,0x00,
+0x02,0x01,0x0E,0x02,0x03,0x01,0x28,0x00,
 };
 static const DiffBlock THINKING_FRAME31_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    45, 54,  // Changed box top-left
+    229, 89,  // Changed box dimensions
     THINKING_FRAME31_DATA
 };
 
-// Frame 32: Full frame RLE (1520 bytes)
-static const uint8_t THINKING_FRAME32_DATA[1520] = {
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x36,0x00,0x0B,0x01,0x75,0x00,
-0x0E,0x01,0xAA,0x00,0x02,0x01,0x03,0x02,0x11,0x03,0x03,0x02,0x02,0x01,0x66,0x00,
-0x02,0x01,0x03,0x02,0x12,0x03,0x03,0x02,0x02,0x01,0x9F,0x00,0x01,0x01,0x02,0x02,
-0x1E,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,
-0x01,0x01,0x98,0x00,0x01,0x02,0x27,0x03,0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,
-0x01,0x02,0x27,0x03,0x01,0x02,0x92,0x00,0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,
-0x51,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,0x8C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,
-0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x01,0x01,0x87,0x00,
-0x01,0x01,0x37,0x03,0x01,0x02,0x48,0x00,0x01,0x01,0x38,0x03,0x01,0x01,0x83,0x00,
-0x01,0x01,0x3B,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,
-0x7F,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,0x40,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,
-0x01,0x01,0x7B,0x00,0x01,0x01,0x43,0x03,0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,
-0x01,0x02,0x01,0x01,0x78,0x00,0x01,0x02,0x45,0x03,0x01,0x02,0x01,0x01,0x39,0x00,
-0x01,0x01,0x46,0x03,0x01,0x02,0x75,0x00,0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,
-0x01,0x02,0x48,0x03,0x01,0x02,0x73,0x00,0x01,0x01,0x4B,0x03,0x01,0x02,0x34,0x00,
-0x01,0x01,0x4C,0x03,0x01,0x01,0x70,0x00,0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,
-0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x6E,0x00,0x01,0x02,0x50,0x03,0x01,0x01,
-0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,0x6C,0x00,0x01,0x02,0x52,0x03,0x01,0x01,
-0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,0x6A,0x00,0x01,0x02,0x54,0x03,0x01,0x01,
-0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,0x68,0x00,0x01,0x02,0x56,0x03,0x01,0x01,
-0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,0x66,0x00,0x01,0x01,0x57,0x03,0x01,0x02,
-0x29,0x00,0x58,0x03,0x01,0x01,0x64,0x00,0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,
-0x01,0x02,0x59,0x03,0x01,0x01,0x63,0x00,0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,
-0x01,0x01,0x5A,0x03,0x01,0x02,0x62,0x00,0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,
-0x5C,0x03,0x01,0x02,0x60,0x00,0x01,0x01,0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,
-0x5D,0x03,0x60,0x00,0x01,0x02,0x5E,0x03,0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,
-0x01,0x02,0x5E,0x00,0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5E,0x00,
-0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5C,0x00,0x01,0x01,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x60,0x03,0x01,0x02,0x5C,0x00,0x01,0x02,
-0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,
-0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,0x5B,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x5A,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,
-0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,
-0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,
-0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,
-0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,
-0x01,0x01,0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
-0x64,0x03,0x01,0x01,0x59,0x00,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x02,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,
-0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,
-0x63,0x03,0x01,0x01,0x59,0x00,0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x01,0x01,0x5A,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
-0x62,0x03,0x01,0x02,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
-0x01,0x01,0x5B,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x5D,0x00,
-0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x5D,0x00,
-0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x5F,0x00,0x01,0x02,0x5E,0x03,
-0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x5F,0x00,0x01,0x01,0x5D,0x03,
-0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x61,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
-0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x61,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
-0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x63,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
-0x27,0x00,0x5A,0x03,0x01,0x01,0x64,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,
-0x58,0x03,0x01,0x01,0x66,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,
-0x56,0x03,0x01,0x02,0x68,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,
-0x01,0x02,0x6A,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
-0x6B,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
-0x6E,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x70,0x00,
-0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x72,0x00,
-0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x74,0x00,
-0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x78,0x00,
+// Frame 32: Diff RLE (1126 bytes)
+static const uint8_t THINKING_FRAME32_DATA[1126] = {
+0xFF,0x00,0xFC,0x00,0x0B,0x01,0x75,0x00,0x0E,0x01,0x51,0x00,0x02,0x01,0x03,0x02,
+0x11,0x03,0x03,0x02,0x02,0x01,0x66,0x00,0x02,0x01,0x03,0x02,0x12,0x03,0x03,0x02,
+0x02,0x01,0x46,0x00,0x01,0x01,0x02,0x02,0x1E,0x03,0x01,0x02,0x01,0x01,0x5E,0x00,
+0x01,0x01,0x02,0x02,0x1F,0x03,0x01,0x02,0x01,0x01,0x3F,0x00,0x01,0x02,0x27,0x03,
+0x01,0x02,0x01,0x01,0x57,0x00,0x01,0x01,0x01,0x02,0x27,0x03,0x01,0x02,0x39,0x00,
+0x01,0x02,0x2D,0x03,0x01,0x02,0x01,0x01,0x51,0x00,0x01,0x01,0x2E,0x03,0x01,0x02,
+0x33,0x00,0x01,0x01,0x01,0x02,0x32,0x03,0x01,0x02,0x4C,0x00,0x01,0x01,0x01,0x02,
+0x32,0x03,0x01,0x02,0x01,0x01,0x2E,0x00,0x01,0x01,0x37,0x03,0x01,0x02,0x48,0x00,
+0x01,0x01,0x38,0x03,0x01,0x01,0x2A,0x00,0x01,0x01,0x3B,0x03,0x01,0x02,0x01,0x01,
+0x43,0x00,0x01,0x01,0x3C,0x03,0x01,0x01,0x26,0x00,0x01,0x01,0x3F,0x03,0x01,0x02,
+0x40,0x00,0x01,0x01,0x01,0x02,0x3F,0x03,0x01,0x01,0x22,0x00,0x01,0x01,0x43,0x03,
+0x01,0x01,0x3D,0x00,0x01,0x02,0x42,0x03,0x01,0x02,0x01,0x01,0x1F,0x00,0x01,0x02,
+0x45,0x03,0x01,0x02,0x01,0x01,0x39,0x00,0x01,0x01,0x46,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x49,0x03,0x01,0x01,0x37,0x00,0x01,0x02,0x48,0x03,0x01,0x02,0x1A,0x00,
+0x01,0x01,0x4B,0x03,0x01,0x02,0x34,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x17,0x00,
+0x01,0x02,0x4D,0x03,0x01,0x02,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,
+0x15,0x00,0x01,0x02,0x50,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
+0x13,0x00,0x01,0x02,0x52,0x03,0x01,0x01,0x2D,0x00,0x01,0x01,0x52,0x03,0x01,0x02,
+0x11,0x00,0x01,0x02,0x54,0x03,0x01,0x01,0x2B,0x00,0x01,0x01,0x54,0x03,0x01,0x02,
+0x0F,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,0x56,0x03,0x01,0x02,
+0x0D,0x00,0x01,0x01,0x57,0x03,0x01,0x02,0x29,0x00,0x58,0x03,0x01,0x01,0x0B,0x00,
+0x01,0x01,0x59,0x03,0x01,0x02,0x27,0x00,0x01,0x02,0x59,0x03,0x01,0x01,0x0A,0x00,
+0x01,0x02,0x5A,0x03,0x01,0x01,0x25,0x00,0x01,0x01,0x5A,0x03,0x01,0x02,0x09,0x00,
+0x01,0x02,0x5C,0x03,0x24,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x07,0x00,0x01,0x01,
+0x5D,0x03,0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x07,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x05,0x00,0x01,0x01,0x5F,0x03,
+0x01,0x02,0x21,0x00,0x60,0x03,0x05,0x00,0x01,0x02,0x60,0x03,0x20,0x00,0x01,0x01,
+0x60,0x03,0x01,0x01,0x03,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,
+0x60,0x03,0x01,0x02,0x03,0x00,0x01,0x02,0x61,0x03,0x01,0x02,0x1F,0x00,0x62,0x03,
+0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x02,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x01,0x00,
+0x01,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,0x62,0x03,0x01,0x02,0x02,0x01,
+0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x01,0x02,0x63,0x03,0x01,0x01,0x01,0x02,
+0x63,0x03,0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,
+0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,
+0x64,0x03,0x01,0x01,0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,
+0x01,0x02,0x64,0x03,0x1C,0x00,0x01,0x01,0x64,0x03,0x01,0x01,0x01,0x02,0x63,0x03,
+0x01,0x02,0x1C,0x00,0x01,0x01,0x64,0x03,0x02,0x01,0x63,0x03,0x01,0x02,0x1C,0x00,
+0x01,0x01,0x01,0x02,0x63,0x03,0x02,0x01,0x63,0x03,0x01,0x02,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x01,0x01,0x01,0x00,0x63,0x03,0x01,0x01,0x1D,0x00,0x01,0x02,
+0x62,0x03,0x01,0x02,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,
+0x01,0x01,0x02,0x00,0x01,0x02,0x62,0x03,0x1E,0x00,0x01,0x01,0x62,0x03,0x01,0x01,
+0x02,0x00,0x01,0x01,0x61,0x03,0x01,0x02,0x1F,0x00,0x01,0x02,0x61,0x03,0x04,0x00,
+0x01,0x02,0x60,0x03,0x01,0x01,0x1F,0x00,0x01,0x01,0x60,0x03,0x01,0x01,0x04,0x00,
+0x01,0x01,0x5F,0x03,0x01,0x02,0x21,0x00,0x60,0x03,0x06,0x00,0x01,0x02,0x5E,0x03,
+0x01,0x01,0x21,0x00,0x01,0x01,0x5E,0x03,0x01,0x02,0x06,0x00,0x01,0x01,0x5D,0x03,
+0x01,0x02,0x23,0x00,0x01,0x02,0x5D,0x03,0x08,0x00,0x01,0x02,0x5C,0x03,0x01,0x01,
+0x23,0x00,0x01,0x01,0x5C,0x03,0x01,0x02,0x08,0x00,0x01,0x01,0x5B,0x03,0x01,0x01,
+0x25,0x00,0x01,0x02,0x5A,0x03,0x01,0x02,0x0A,0x00,0x01,0x02,0x59,0x03,0x01,0x02,
+0x27,0x00,0x5A,0x03,0x01,0x01,0x0B,0x00,0x01,0x02,0x58,0x03,0x28,0x00,0x01,0x01,
+0x58,0x03,0x01,0x01,0x0D,0x00,0x01,0x02,0x56,0x03,0x01,0x01,0x29,0x00,0x01,0x01,
+0x56,0x03,0x01,0x02,0x0F,0x00,0x55,0x03,0x01,0x01,0x2B,0x00,0x01,0x02,0x54,0x03,
+0x01,0x02,0x11,0x00,0x53,0x03,0x01,0x01,0x2D,0x00,0x01,0x02,0x52,0x03,0x01,0x02,
+0x12,0x00,0x01,0x01,0x51,0x03,0x01,0x01,0x2F,0x00,0x01,0x01,0x50,0x03,0x01,0x02,
+0x15,0x00,0x4F,0x03,0x01,0x01,0x31,0x00,0x01,0x01,0x4E,0x03,0x01,0x02,0x17,0x00,
+0x01,0x02,0x4C,0x03,0x01,0x01,0x33,0x00,0x01,0x01,0x4C,0x03,0x01,0x01,0x19,0x00,
+0x01,0x01,0x49,0x03,0x01,0x02,0x37,0x00,0x01,0x02,0x49,0x03,0x01,0x01,0x1B,0x00,
+0x01,0x01,0x47,0x03,0x01,0x01,0x39,0x00,0x01,0x02,0x46,0x03,0x01,0x02,0x1F,0x00,
 0x01,0x02,0x43,0x03,0x01,0x02,0x01,0x01,0x3B,0x00,0x01,0x01,0x01,0x02,0x43,0x03,
-0x01,0x01,0x7A,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
-0x40,0x03,0x01,0x02,0x7E,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x02,
-0x3C,0x03,0x01,0x02,0x82,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x02,
-0x38,0x03,0x01,0x02,0x86,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,
-0x01,0x01,0x34,0x03,0x01,0x02,0x8B,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
-0x4F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x8F,0x00,0x01,0x01,
+0x01,0x01,0x21,0x00,0x01,0x01,0x01,0x02,0x40,0x03,0x01,0x01,0x3F,0x00,0x01,0x01,
+0x40,0x03,0x01,0x02,0x25,0x00,0x01,0x01,0x3D,0x03,0x01,0x02,0x43,0x00,0x01,0x02,
+0x3C,0x03,0x01,0x02,0x29,0x00,0x01,0x01,0x39,0x03,0x01,0x02,0x47,0x00,0x01,0x02,
+0x38,0x03,0x01,0x02,0x2D,0x00,0x01,0x01,0x01,0x02,0x34,0x03,0x01,0x01,0x4B,0x00,
+0x01,0x01,0x34,0x03,0x01,0x02,0x32,0x00,0x01,0x02,0x2F,0x03,0x01,0x02,0x01,0x01,
+0x4F,0x00,0x01,0x01,0x01,0x02,0x2E,0x03,0x01,0x02,0x01,0x01,0x36,0x00,0x01,0x01,
 0x01,0x02,0x29,0x03,0x01,0x02,0x01,0x01,0x55,0x00,0x01,0x01,0x01,0x02,0x28,0x03,
-0x01,0x02,0x01,0x01,0x95,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
-0x5B,0x00,0x01,0x01,0x02,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x9C,0x00,0x02,0x01,
+0x01,0x02,0x01,0x01,0x3C,0x00,0x01,0x01,0x02,0x02,0x22,0x03,0x01,0x02,0x01,0x01,
+0x5B,0x00,0x01,0x01,0x02,0x02,0x21,0x03,0x01,0x02,0x01,0x01,0x43,0x00,0x02,0x01,
 0x02,0x02,0x17,0x03,0x02,0x02,0x02,0x01,0x63,0x00,0x02,0x01,0x02,0x02,0x17,0x03,
-0x02,0x02,0x01,0x01,0xA6,0x00,0x03,0x01,0x0D,0x02,0x04,0x01,0x6E,0x00,0x03,0x01,
-0x0C,0x02,0x03,0x01,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,
-0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0x34,0x00,
-
+0x02,0x02,0x01,0x01,0x4D,0x00,0x03,0x01,0x0D,0x02,0x04,0x01,0x6E,0x00,0x03,0x01,
+0x0C,0x02,0x03,0x01,0x2A,0x00,
 };
 static const DiffBlock THINKING_FRAME32_BLOCK = {
-    0, 0,  // Full frame starts at (0,0)
-    320, 218,  // Full frame dimensions
+    44, 72,  // Changed box top-left
+    231, 72,  // Changed box dimensions
     THINKING_FRAME32_DATA
 };
 
@@ -3,8 +3,8 @@
 
 namespace asset::icon {
 
-#ifndef ICON
-#define ICON
+#ifndef PTALK_ASSET_ICON_TYPE
+#define PTALK_ASSET_ICON_TYPE
 struct Icon {
     int w;
     int h;
@@ -8,10 +8,18 @@
 #include "system/NetworkManager.hpp"
 #include "system/PowerManager.hpp"
 #include "system/OTAUpdater.hpp"
+#include "system/MemArena.hpp"
+#include "system/ResumeState.hpp"
+#include "system/ConfigStore.hpp"
+#include "system/InitGraph.hpp"
+#include "system/TaskPlan.hpp"
+#include "system/AnimPackCache.hpp"
+#include "system/MediaPlayer.hpp"
 // State control for audio speak/listen transitions
 #include "system/StateManager.hpp"
 #include "system/StateTypes.hpp"
 #include "system/BluetoothService.hpp"
+#include "WebSocketClient.hpp"
 // Ring buffer API to feed downlink audio into AudioManager
 // #include "freertos/ringbuf.h"
 
@@ -24,9 +32,11 @@
 
 // ===== Codec =====
 #include "AdpcmCodec.hpp"
+#include "OpusCodec.hpp"
+#include "DsCnnKeywordModel.hpp"
 
 #include "nvs_flash.h"
-#include "nvs.h"
+#include <charconv>
 
 // ===== Assets =====
 // Uncomment sau khi convert assets bằng scripts/convert_assets.py
@@ -37,129 +47,47 @@
 // #include "assets/icons/wifi_fail.hpp"
 // #include "assets/icons/battery.hpp"
 // #include "assets/icons/battery_low.hpp"
-#include "../assets/icons/battery_charge.hpp"
-#include "../assets/icons/battery_full.hpp"
-#include "../assets/icons/critical_power.hpp"
-//
-#include "../assets/emotions/neutral.hpp"
-#include "../assets/emotions/idle.hpp"
-#include "../assets/emotions/listening.hpp"
-#include "../assets/emotions/happy.hpp"
-#include "../assets/emotions/sad.hpp"
-#include "../assets/emotions/thinking.hpp"
-#include "../assets/emotions/stun.hpp"
-// #include "assets/emotions/speaking.hpp"
-// #include "assets/emotions/error.hpp"
-// #include "assets/emotions/boot.hpp"
+#include "AssetBundle.hpp"
+// Icons and built-in emotions (PTALK_BUILTIN_EMOTIONS): compile-time tables
+// in assets/asset_registry.hpp (scripts/convert_assets.py registry), pulled
+// in by DisplayManager.hpp. Build with -DPTALK_BUILTIN_EMOTIONS=0 once the
+// "assets" partition is flashed (scripts/convert_assets.py bundle): the
+// arrays are then dropped by the linker and the image shrinks by MBs.
 // #include "assets/emotions/lowbat.hpp"
 
 #include "esp_log.h"
+#include "esp_sleep.h"
 #include <esp_attr.h>
 
 static const char *TAG = "DeviceProfile";
 
-// Helper function to register emotions (extracted to reduce code size in setup())
-static void registerEmotions(DisplayManager *display)
-{
-    // Register neutral emotion
-    {
-        Animation1Bit anim1bit;
-        anim1bit.width = asset::emotion::NEUTRAL.width;
-        anim1bit.height = asset::emotion::NEUTRAL.height;
-        anim1bit.frame_count = asset::emotion::NEUTRAL.frame_count;
-        anim1bit.fps = asset::emotion::NEUTRAL.fps;
-        anim1bit.loop = asset::emotion::NEUTRAL.loop;
-        anim1bit.max_packed_size = asset::emotion::NEUTRAL.max_packed_size;
-        // Frame 0 is diff from black → no base_frame
-        anim1bit.base_frame = nullptr;
-        anim1bit.frames = asset::emotion::NEUTRAL.frames();
-        display->registerEmotion("neutral", anim1bit);
-    }
-
-    // Register idle emotion
-    {
-        Animation1Bit anim1bit;
-        anim1bit.width = asset::emotion::IDLE.width;
-        anim1bit.height = asset::emotion::IDLE.height;
-        anim1bit.frame_count = asset::emotion::IDLE.frame_count;
-        anim1bit.fps = asset::emotion::IDLE.fps;
-        anim1bit.loop = asset::emotion::IDLE.loop;
-        anim1bit.max_packed_size = asset::emotion::IDLE.max_packed_size;
-        // Frame 0 is diff from black → no base_frame
-        anim1bit.base_frame = nullptr;
-        anim1bit.frames = asset::emotion::IDLE.frames();
-        display->registerEmotion("idle", anim1bit);
-    }
-    // Register listening emotion
-    {
-        Animation1Bit anim1bit;
-        anim1bit.width = asset::emotion::LISTENING.width;
-        anim1bit.height = asset::emotion::LISTENING.height;
-        anim1bit.frame_count = asset::emotion::LISTENING.frame_count;
-        anim1bit.fps = asset::emotion::LISTENING.fps;
-        anim1bit.loop = asset::emotion::LISTENING.loop;
-        anim1bit.max_packed_size = asset::emotion::LISTENING.max_packed_size;
-        // Frame 0 is diff from black → no base_frame
-        anim1bit.base_frame = nullptr;
-        anim1bit.frames = asset::emotion::LISTENING.frames();
-        display->registerEmotion("listening", anim1bit);
-    }
-    // Register happy emotion
-    {
-        Animation1Bit anim1bit;
-        anim1bit.width = asset::emotion::HAPPY.width;
-        anim1bit.height = asset::emotion::HAPPY.height;
-        anim1bit.frame_count = asset::emotion::HAPPY.frame_count;
-        anim1bit.fps = asset::emotion::HAPPY.fps;
-        anim1bit.loop = asset::emotion::HAPPY.loop;
-        anim1bit.max_packed_size = asset::emotion::HAPPY.max_packed_size;
-        // Frame 0 is diff from black → no base_frame
-        anim1bit.base_frame = nullptr;
-        anim1bit.frames = asset::emotion::HAPPY.frames();
-        display->registerEmotion("happy", anim1bit);
-    }
+#if PTALK_I2S_STD
+// Shared I2S controller of mic + speaker (PTALK_I2S_STD=1); outlives both drivers.
+static I2SDuplexBus s_i2s_bus;
+#endif
 
-    // Register sad emotion
-    {
-        Animation1Bit anim1bit;
-        anim1bit.width = asset::emotion::SAD.width;
-        anim1bit.height = asset::emotion::SAD.height;
-        anim1bit.frame_count = asset::emotion::SAD.frame_count;
-        anim1bit.fps = asset::emotion::SAD.fps;
-        anim1bit.loop = asset::emotion::SAD.loop;
-        anim1bit.max_packed_size = asset::emotion::SAD.max_packed_size;
-        anim1bit.base_frame = nullptr;
-        anim1bit.frames = asset::emotion::SAD.frames();
-        display->registerEmotion("sad", anim1bit);
-    }
+// Animations from the mapped "assets" partition; a name matching a registry
+// slot replaces the built-in one. Lives for the whole runtime (DisplayManager
+// keeps pointers into it, the player reads frames in place).
+static AssetBundle s_asset_bundle;
 
-    // Register thinking emotion
-    {
-        Animation1Bit anim1bit;
-        anim1bit.width = asset::emotion::THINKING.width;
-        anim1bit.height = asset::emotion::THINKING.height;
-        anim1bit.frame_count = asset::emotion::THINKING.frame_count;
-        anim1bit.fps = asset::emotion::THINKING.fps;
-        anim1bit.loop = asset::emotion::THINKING.loop;
-        anim1bit.max_packed_size = asset::emotion::THINKING.max_packed_size;
-        anim1bit.base_frame = nullptr;
-        anim1bit.frames = asset::emotion::THINKING.frames();
-        display->registerEmotion("thinking", anim1bit);
-    }
+static void registerBundleEmotions(DisplayManager *display)
+{
+    if (!s_asset_bundle.open())
+        return;
+    for (size_t i = 0; i < s_asset_bundle.count(); i++)
+        display->registerEmotion(std::string_view(s_asset_bundle.name(i)), s_asset_bundle.animation(i));
+}
 
-    // Register stun emotion
-    {
-        Animation1Bit anim1bit;
-        anim1bit.width = asset::emotion::STUN.width;
-        anim1bit.height = asset::emotion::STUN.height;
-        anim1bit.frame_count = asset::emotion::STUN.frame_count;
-        anim1bit.fps = asset::emotion::STUN.fps;
-        anim1bit.loop = asset::emotion::STUN.loop;
-        anim1bit.max_packed_size = asset::emotion::STUN.max_packed_size;
-        anim1bit.base_frame = nullptr;
-        anim1bit.frames = asset::emotion::STUN.frames();
-        display->registerEmotion("stun", anim1bit);
-    }
+// Server-pushed packs in the slots after the bundle, ahead of it and of
+// the built-ins; fetched / preloaded by their own task while idle.
+static void attachAnimPacks(DisplayManager *display)
+{
+    AnimPackCache &packs = AnimPackCache::instance();
+    if (!packs.init(s_asset_bundle.bytes()))
+        return;
+    display->setEmotionSource([&packs](asset::AnimId id) { return packs.resolve(id); });
+    packs.start();
 }
 
 // Centralized hardware/config values for easy tweaking
@@ -189,10 +117,83 @@ namespace device_cfg
     };
 
     constexpr DisplayPins display{};
+
+    constexpr TouchInput::Config touch{
+        .pin = GPIO_NUM_16,
+        .active_low = true,
+        .long_press_ms = 1200};
+
+    struct SleepPolicy
+    {
+        float critical_percent = 5.0f;      // PowerManager CRITICAL → deep sleep
+        float resume_margin_percent = 3.0f; // timer wake boots only above critical + margin
+        uint32_t wakeup_sec = 60;           // battery re-check interval while asleep
+    };
+
+    constexpr SleepPolicy sleep{};
+
+    // I2S DMA presets per interaction state. TTS gets the 48 ms queue (rides
+    // out a late speaker task for twice as long as the old 6 x 64 queue);
+    // barge-in listening the 16 ms one so the AEC / VAD see speech early.
+    // ROBUST (96 ms) trades first-audio latency for more robustness.
+    constexpr AudioManager::DmaPresets dma{
+        .speaking = DmaPreset::BALANCED,
+        .listening = DmaPreset::BALANCED,
+        .barge_in = DmaPreset::LOW_LATENCY};
+
+#if PTALK_I2S_STD
+    // Full-duplex I2S (build with -DPTALK_I2S_STD=1): mic and amp on I2S0
+    // with one clock, so the AEC sees a fixed speaker → mic delay. Wiring:
+    // INMP441 SCK / WS move onto the amp's BCLK 26 / LRC 25 (GPIO 14 / 15
+    // are then free). One DMA shape for both directions: the TTS one, so
+    // the presets above do not apply (barge-in listens on 48 ms buffers).
+    constexpr I2SDuplexBus::Config i2s_bus{
+        .port = I2S_NUM_0,
+        .pin_bck = GPIO_NUM_26,
+        .pin_ws = GPIO_NUM_25,
+        .pin_dout = GPIO_NUM_22,
+        .pin_din = GPIO_NUM_32,
+        .sample_rate = 16000,
+        .use_apll = false,
+        .mic_left = true,
+        .dma = dmaGeometry(dma.speaking)};
+#endif
+
+    // Task placement (core, priority, stack bytes), indexed by TaskPlan::Id.
+    //
+    // Core 0 (PRO) runs the Wi-Fi driver (prio 23) and lwIP (18): everything
+    // that talks to sockets, BLE or flash stays beside them, below their
+    // priorities. Core 1 (APP) is kept for the real-time audio chain, which
+    // outranks the display there: a redraw (SPI flush of a full frame) is
+    // preempted at every DMA wait, so the speaker task always refills the
+    // short TX DMA queue (24 ms) in time. Speaker > mic (96 ms RX DMA) >
+    // decoder = encoder (rings absorb their bursts) > controller > display.
+    // Encoder and decoder block only on their own input ring; either can
+    // move to core 0 (below lwIP) if a full-duplex turn saturates core 1.
+    // KWS inference is long and low priority: it soaks up core 0 idle time.
+    constexpr TaskPlan::Table tasks{{
+        {"AppControllerTask", 4096, 4, 1},  // CONTROLLER
+        {"DisplayLoop", 4096, 3, 1},        // DISPLAY
+        {"AudioMicTask", 3072, 7, 1},       // AUDIO_MIC
+        {"AudioEncTask", 4096, 6, 1},       // AUDIO_ENC (≥ codec hint)
+        {"AudioDecTask", 4096, 6, 1},       // AUDIO_DEC (≥ codec hint)
+        {"AudioSpkTask", 4096, 8, 1},       // AUDIO_SPK
+        {"AudioKwsTask", 4096, 2, 0},       // AUDIO_KWS
+        {"NetworkLoop", 8192, 5, 0},        // NET_LOOP
+        {"WsUplink", 4096, 5, 0},           // NET_UPLINK
+        {"wifi_retry", 4096, 5, 0},         // WIFI_RETRY
+        {"BLEConfig", 6144, 5, 0},          // BLE_CONFIG
+        {"OtaWriter", 4096, 4, 0},          // OTA_WRITER
+        {"SerialConsole", 3072, 1, 0},      // CONSOLE
+        {"AnimPackFetch", 6144, 1, 0},      // ASSET_FETCH (HTTP(S) client)
+        {"OtaFetch", 6144, 4, 0},           // OTA_FETCH (HTTP(S) client, feeds OTA_WRITER)
+        {"MediaFetch", 6144, 3, 0},         // MEDIA_FETCH (HTTP(S) client, prebuffer / spill writes)
+        {"MediaDec", 4096, 5, 1},           // MEDIA_DEC (≥ codec hint; below the turn decoder)
+    }};
 }
 
 // =================================================================================
-// User-configurable settings (loaded from NVS namespace "usercfg")
+// User-configurable settings (NVS namespace "storage", cached by ConfigStore)
 // =================================================================================
 namespace user_cfg
 {
@@ -205,81 +206,53 @@ namespace user_cfg
         std::string wifi_pass;
         std::string ws_url; // Stored WS URL (may be full URL or host:port)
         std::string mqtt_url; // Stored MQTT URL (may be full URL or host:port)
+        std::string audio_codec = "adpcm"; // "adpcm" | "opus" (needs Opus built in)
+        bool ns = true;  // uplink noise suppression
+        bool agc = true; // uplink automatic gain control
     };
 
-    static std::string get_string(nvs_handle_t h, const char *key)
-    {
-        size_t required = 0;
-        if (nvs_get_str(h, key, nullptr, &required) != ESP_OK || required == 0)
-            return {};
-        std::string tmp;
-        tmp.resize(required);
-        if (nvs_get_str(h, key, tmp.data(), &required) != ESP_OK)
-            return {};
-        if (!tmp.empty() && tmp.back() == '\0')
-            tmp.pop_back();
-        return tmp;
-    }
-
-    static uint8_t get_u8(nvs_handle_t h, const char *key, uint8_t def_val)
-    {
-        uint8_t v = def_val;
-        nvs_get_u8(h, key, &v);
-        return v;
-    }
-
+    // Straight from the ConfigStore RAM copy (loaded once, right after NVS init)
     static UserSettings load()
     {
-        UserSettings cfg;
-        nvs_handle_t h;
-        esp_err_t err = nvs_open("storage", NVS_READONLY, &h);
-        if (err != ESP_OK)
-        {
-            ESP_LOGI(TAG, "storage not found, using defaults");
-            return cfg;
-        }
-
-        cfg.device_name = get_string(h, "device_name");
-        if (cfg.device_name.empty())
-            cfg.device_name = "PTalk";
-
-        // Đọc WiFi credentials với key giống bên ghi
-        cfg.wifi_ssid = get_string(h, "ssid");
-        cfg.wifi_pass = get_string(h, "pass");
+        using Key = ConfigStore::Key;
+        const ConfigStore &store = ConfigStore::instance();
 
-        // Optional WS URL override
-        cfg.ws_url = get_string(h, "ws_url");
-        // Optional MQTT URL override
-        cfg.mqtt_url = get_string(h, "mqtt_url");
-        cfg.volume = get_u8(h, "volume", cfg.volume);
-        cfg.brightness = get_u8(h, "brightness", cfg.brightness);
-
-        nvs_close(h);
+        UserSettings cfg;
+        cfg.device_name = store.getString(Key::DEVICE_NAME);
+        cfg.wifi_ssid = store.getString(Key::SSID);
+        cfg.wifi_pass = store.getString(Key::PASS);
+        // Optional WS / MQTT URL overrides
+        cfg.ws_url = store.getString(Key::WS_URL);
+        cfg.mqtt_url = store.getString(Key::MQTT_URL);
+        cfg.audio_codec = store.getString(Key::AUDIO_CODEC);
+        cfg.volume = store.getU8(Key::VOLUME);
+        cfg.brightness = store.getU8(Key::BRIGHTNESS);
+        cfg.ns = store.getBool(Key::NS);
+        cfg.agc = store.getBool(Key::AGC);
         return cfg;
     }
 
     static void save_all_settings(const BluetoothService::ConfigData &data)
     {
-        nvs_handle_t h;
-        if (nvs_open("storage", NVS_READWRITE, &h) == ESP_OK)
-        {
-            if (!data.device_name.empty())
-                nvs_set_str(h, "device_name", data.device_name.c_str());
-            if (!data.ssid.empty())
-                nvs_set_str(h, "ssid", data.ssid.c_str());
-            if (!data.pass.empty())
-                nvs_set_str(h, "pass", data.pass.c_str());
-            if (!data.ws_url.empty())
-                nvs_set_str(h, "ws_url", data.ws_url.c_str());
-            if (!data.mqtt_url.empty())
-                nvs_set_str(h, "mqtt_url", data.mqtt_url.c_str());
-            nvs_set_u8(h, "volume", data.volume);
-            nvs_set_u8(h, "brightness", data.brightness);
-
-            nvs_commit(h);
-            nvs_close(h);
+        using Key = ConfigStore::Key;
+        ConfigStore &store = ConfigStore::instance();
+
+        if (!data.device_name.empty())
+            store.setStr(Key::DEVICE_NAME, data.device_name.c_str());
+        if (!data.ssid.empty())
+            store.setStr(Key::SSID, data.ssid.c_str());
+        if (!data.pass.empty())
+            store.setStr(Key::PASS, data.pass.c_str());
+        if (!data.ws_url.empty())
+            store.setStr(Key::WS_URL, data.ws_url.c_str());
+        if (!data.mqtt_url.empty())
+            store.setStr(Key::MQTT_URL, data.mqtt_url.c_str());
+        store.setU8(Key::VOLUME, data.volume);
+        store.setU8(Key::BRIGHTNESS, data.brightness);
+
+        // A restart follows: commit now (one nvs_commit for the whole batch)
+        if (store.flush())
             ESP_LOGI("user_cfg", "All settings saved to NVS via BLE");
-        }
     }
 }
 
@@ -287,6 +260,14 @@ bool DeviceProfile::setup(AppController &app)
 {
     ESP_LOGI(TAG, "DeviceProfile setup begin");
 
+    // Long-lived buffers (audio rings, LCD DMA, uplink, OTA) are reserved
+    // before anything else touches the heap
+    MemArena::instance().init();
+
+    // Every long-lived task is created from this table
+    if (!TaskPlan::instance().install(device_cfg::tasks))
+        return false;
+
     // Ensure NVS is initialized before loading user settings
     esp_err_t nvs_err = nvs_flash_init();
     if (nvs_err == ESP_ERR_NVS_NO_FREE_PAGES || nvs_err == ESP_ERR_NVS_NEW_VERSION_FOUND)
@@ -296,224 +277,431 @@ bool DeviceProfile::setup(AppController &app)
     }
     ESP_ERROR_CHECK(nvs_err);
 
+    // One NVS pass for every user setting; later reads hit the RAM copy
+    ConfigStore::instance().load();
+
     // Load user-overridable settings (from NVS) and merge with factory defaults
     user_cfg::UserSettings user = user_cfg::load();
 
-    // =========================================================
-    // 1️⃣ DISPLAY
-    // =========================================================
-    auto display_mgr = std::make_unique<DisplayManager>();
-
-    // --- Display driver config (ST7789 240x320) ---
-    DisplayDriver::Config lcd_cfg{
-        .spi_host = device_cfg::display.spi_host,
-        .pin_cs = device_cfg::display.pin_cs,
-        .pin_dc = device_cfg::display.pin_dc,
-        .pin_rst = device_cfg::display.pin_rst,
-        .pin_bl = device_cfg::display.pin_bl,
-        .pin_mosi = device_cfg::display.pin_mosi,
-        .pin_sclk = device_cfg::display.pin_sclk,
-
-        .width = 240,
-        .height = 320,
-
-        // 240x320 full screen (no offset needed)
-        .x_offset = 0,
-        .y_offset = 0,
-        .spi_speed_hz = device_cfg::display.spi_speed_hz};
-
-    auto lcd_driver = std::make_unique<DisplayDriver>();
-
-    if (!lcd_driver->init(lcd_cfg))
+    // Woken from deep sleep: the levels in use when it went to sleep win
+    const ResumeState &resume = ResumeState::instance();
+    if (resume.valid())
     {
-        ESP_LOGE(TAG, "DisplayDriver init failed");
-        return false;
+        user.volume = resume.snapshot().volume;
+        user.brightness = resume.snapshot().brightness;
     }
 
-    if (!display_mgr->init(std::move(lcd_driver), 240, 320))
-    {
-        ESP_LOGE(TAG, "DisplayManager init failed");
-        return false;
-    }
-
-    // Auto-bind UI to state changes so animations/icons update reactively
-    display_mgr->enableStateBinding(true);
-
-    // Apply user brightness preference (0-100%)
-    display_mgr->setBrightness(user.brightness);
-
-    // --- Register UI assets ---
-    // Emotions (animations)
-    registerEmotions(display_mgr.get());
-
-    // Icons (static images)
-    // display->registerIcon("wifi_ok",         asset::icon::WIFI_OK);
-    // display->registerIcon("wifi_fail",       asset::icon::WIFI_FAIL);
-    // display->registerIcon("battery",         asset::icon::BATTERY);
-    // display->registerIcon("battery_low",     asset::icon::BATTERY_LOW);
-    display_mgr->registerIcon(
-        "battery_charge",
-        DisplayManager::Icon{
-            asset::icon::BATTERY_CHARGE.w,
-            asset::icon::BATTERY_CHARGE.h,
-            asset::icon::BATTERY_CHARGE.rle_data});
-    display_mgr->registerIcon(
-        "battery_full",
-        DisplayManager::Icon{
-            asset::icon::BATTERY_FULL.h,
-            asset::icon::BATTERY_FULL.w,
-            asset::icon::BATTERY_FULL.rle_data});
-    display_mgr->registerIcon(
-        "battery_critical",
-        DisplayManager::Icon{
-            asset::icon::CRITICAL_POWER.w,
-            asset::icon::CRITICAL_POWER.h,
-            asset::icon::CRITICAL_POWER.rle_data});
+    // Each subsystem initializes as one stage of the init graph. Stages
+    // only share `user` (read-only), so they run concurrently on both
+    // cores; interrupts land on the core that installs the driver (I2S,
+    // GPIO as before on core 0, LCD SPI beside the display task on core 1).
+    // Cross-module wiring happens after run(), back on this task.
+    std::unique_ptr<DisplayManager> display_mgr;
+    std::unique_ptr<AudioManager> audio_mgr;
+    std::unique_ptr<NetworkManager> network_mgr;
+    std::unique_ptr<TouchInput> touch_input;
+    std::unique_ptr<PowerManager> power_mgr;
+    InitGraph graph("setup");
 
     // =========================================================
-    // 2️⃣ AUDIO
+    // 1️⃣ DISPLAY
     // =========================================================
-    auto audio_mgr = std::make_unique<AudioManager>();
-
-    // --- Mic: INMP441 ---
-    I2SAudioInput_INMP441::Config mic_cfg{
-        .i2s_port = I2S_NUM_0,
-        .pin_bck = GPIO_NUM_14, // I2S_MIC_SERIAL_CLOCK
-        .pin_ws = GPIO_NUM_15,  // I2S_MIC_WORD_SELECT
-        .pin_din = GPIO_NUM_32, // I2S_MIC_SERIAL_DATA
-        .sample_rate = 16000};
+    graph.add("display", {}, 1, [&]() -> bool {
+        display_mgr = std::make_unique<DisplayManager>();
+
+        // --- Display driver config (ST7789 240x320) ---
+        DisplayDriver::Config lcd_cfg{
+            .spi_host = device_cfg::display.spi_host,
+            .pin_cs = device_cfg::display.pin_cs,
+            .pin_dc = device_cfg::display.pin_dc,
+            .pin_rst = device_cfg::display.pin_rst,
+            .pin_bl = device_cfg::display.pin_bl,
+            .pin_mosi = device_cfg::display.pin_mosi,
+            .pin_sclk = device_cfg::display.pin_sclk,
+
+            .width = 240,
+            .height = 320,
+
+            // 240x320 full screen (no offset needed)
+            .x_offset = 0,
+            .y_offset = 0,
+            .spi_speed_hz = device_cfg::display.spi_speed_hz};
+        lcd_cfg.buffer_pool_bytes = DisplayDriver::bufferPoolBytes(lcd_cfg);
+        lcd_cfg.buffer_pool = static_cast<uint8_t *>(
+            MemArena::instance().claim(MemArena::DISPLAY, "lcd", lcd_cfg.buffer_pool_bytes));
+
+        auto lcd_driver = std::make_unique<DisplayDriver>();
+
+        if (!lcd_driver->init(lcd_cfg))
+        {
+            ESP_LOGE(TAG, "DisplayDriver init failed");
+            return false;
+        }
 
-    auto mic = std::make_unique<I2SAudioInput_INMP441>(mic_cfg);
+        if (!display_mgr->init(std::move(lcd_driver), 240, 320))
+        {
+            ESP_LOGE(TAG, "DisplayManager init failed");
+            return false;
+        }
 
-    // --- Speaker: MAX98357 ---
-    I2SAudioOutput_MAX98357::Config spk_cfg{
-        .i2s_port = I2S_NUM_1,
-        .pin_bck = GPIO_NUM_26,  // I2S_SPEAKER_SERIAL_CLOCK
-        .pin_ws = GPIO_NUM_25,   // I2S_SPEAKER_WORD_SELECT
-        .pin_dout = GPIO_NUM_22, // I2S_SPEAKER_SERIAL_DATA
-        .sample_rate = 16000};
+        // Auto-bind UI to state changes so animations/icons update reactively
+        display_mgr->enableStateBinding(true);
 
-    auto speaker = std::make_unique<I2SAudioOutput_MAX98357>(spk_cfg);
+        // Apply user brightness preference (0-100%)
+        display_mgr->setBrightness(user.brightness);
 
-    // Apply user volume preference (0-100%)
-    speaker->setVolume(user.volume);
+        // Keep decoded emotion frames as 2 bpp tiles: loops skip RLE decode
+        // (a 320x218 full frame costs ~17 KB, diff boxes much less)
+        display_mgr->setEmotionCacheBudget(24 * 1024);
 
-    // --- Codec ---
-    auto codec = std::make_unique<AdpcmCodec>();
+        // --- Register UI assets ---
+        // Built-in emotions and icons are compile-time tables
+        // (asset_registry.hpp); the bundle only overrides slots by name.
+        registerBundleEmotions(display_mgr.get());
+        attachAnimPacks(display_mgr.get());
+        return true;
+    });
 
-    // Wire dependencies into AudioManager before init/start
-    audio_mgr->setInput(std::move(mic));
-    audio_mgr->setOutput(std::move(speaker));
-    audio_mgr->setCodec(std::move(codec));
+    // =========================================================
+    // 2️⃣ AUDIO (I2S install, codec, rings)
+    // =========================================================
+    graph.add("audio", {}, 0, [&]() -> bool {
+        audio_mgr = std::make_unique<AudioManager>();
 
-    if (!audio_mgr->init())
-    {
-        ESP_LOGE(TAG, "AudioManager init failed");
-        return false;
-    }
+#if PTALK_I2S_STD
+        if (!s_i2s_bus.init(device_cfg::i2s_bus))
+        {
+            ESP_LOGE(TAG, "I2S duplex bus init failed");
+            return false;
+        }
+#endif
+
+        // --- Mic: INMP441 ---
+        I2SAudioInput_INMP441::Config mic_cfg{
+            .i2s_port = I2S_NUM_0,
+            .pin_bck = GPIO_NUM_14, // I2S_MIC_SERIAL_CLOCK
+            .pin_ws = GPIO_NUM_15,  // I2S_MIC_WORD_SELECT
+            .pin_din = GPIO_NUM_32, // I2S_MIC_SERIAL_DATA
+            .sample_rate = 16000};
+
+        mic_cfg.dma = dmaGeometry(device_cfg::dma.listening);
+#if PTALK_I2S_STD
+        mic_cfg.bus = &s_i2s_bus;
+#endif
+
+        auto mic = std::make_unique<I2SAudioInput_INMP441>(mic_cfg);
+
+        // --- Speaker: MAX98357 ---
+        I2SAudioOutput_MAX98357::Config spk_cfg{
+            .i2s_port = I2S_NUM_1,
+            .pin_bck = GPIO_NUM_26,  // I2S_SPEAKER_SERIAL_CLOCK
+            .pin_ws = GPIO_NUM_25,   // I2S_SPEAKER_WORD_SELECT
+            .pin_dout = GPIO_NUM_22, // I2S_SPEAKER_SERIAL_DATA
+            .sample_rate = 16000};
+        // Installed with the TTS shape so the first playback does not reinstall
+        spk_cfg.dma = dmaGeometry(device_cfg::dma.speaking);
+#if PTALK_I2S_STD
+        spk_cfg.bus = &s_i2s_bus;
+#endif
+
+        auto speaker = std::make_unique<I2SAudioOutput_MAX98357>(spk_cfg);
+
+        // --- Codec ---
+        std::unique_ptr<AudioCodec> codec;
+#if PTALK_HAS_OPUS
+        if (user.audio_codec == "opus")
+        {
+            auto opus = std::make_unique<OpusCodec>(16000, 16000);
+            if (opus->valid())
+                codec = std::move(opus);
+            else
+                ESP_LOGW(TAG, "Opus init failed, falling back to ADPCM");
+        }
+#else
+        if (user.audio_codec == "opus")
+            ESP_LOGW(TAG, "Opus not built in, using ADPCM");
+#endif
+        if (!codec)
+            codec = std::make_unique<AdpcmCodec>();
+
+        // Media playback decodes with its own instance of the same codec
+        // (TTS and a ducked media bed decode at the same time)
+        std::unique_ptr<AudioCodec> media_codec;
+#if PTALK_HAS_OPUS
+        if (codec->variableFrameSize())
+        {
+            auto opus = std::make_unique<OpusCodec>(16000, 16000);
+            if (opus->valid())
+                media_codec = std::move(opus);
+        }
+        else
+#endif
+            media_codec = std::make_unique<AdpcmCodec>();
+
+        // Wire dependencies into AudioManager before init/start
+        audio_mgr->setInput(std::move(mic));
+        audio_mgr->setOutput(std::move(speaker));
+        audio_mgr->setCodec(std::move(codec));
+
+        // Apply user volume preference (0-100%)
+        audio_mgr->setVolume(user.volume);
+
+        // Uplink NS / AGC switches (MQTT set_audio_frontend)
+        audio_mgr->setNoiseSuppression(user.ns);
+        audio_mgr->setAutoGain(user.agc);
+
+        // AEC keeps the mic open during playback so the user can interrupt
+        audio_mgr->setFullDuplex(true);
+
+        // Play TTS as soon as the first frame decodes (pairs with the short DMA queue)
+        audio_mgr->setLowLatencyPlayout(true);
+
+        // I2S DMA shape per state (latency vs. underrun robustness)
+        audio_mgr->setDmaPresets(device_cfg::dma);
+
+#if PTALK_HAS_KWS_MODEL
+        // Always-on wake word (only when a trained model is built in)
+        auto kws_model = std::make_unique<DsCnnKeywordModel>();
+        if (kws_model->valid())
+            audio_mgr->setWakeWordModel(std::move(kws_model));
+#endif
+#if PTALK_HAS_CMD_MODEL
+        // Volume / cancel / sleep handled on the device, no server round trip
+        auto cmd_model = std::make_unique<DsCnnCommandModel>();
+        if (cmd_model->valid())
+            audio_mgr->setCommandModel(std::move(cmd_model));
+#endif
+
+        if (!audio_mgr->init())
+        {
+            ESP_LOGE(TAG, "AudioManager init failed");
+            return false;
+        }
 
-    // audio_mgr->start();
+        // Earcons recorded into the assets bundle (--sound) replace the tones
+        audio_mgr->loadEarconBundle();
+
+        // Music / podcast streams (MQTT "media"); buffer and tasks on first play
+        if (media_codec)
+            MediaPlayer::instance().init(audio_mgr.get(), std::move(media_codec), MediaPlayer::Config{});
+        else
+            ESP_LOGW(TAG, "No codec for media playback");
+
+        // VAD endpoint → PROCESSING without waiting for the button release
+        audio_mgr->onEndOfSpeech([&app]()
+                                 { app.postEvent(event::AppEvent::END_OF_SPEECH); });
+        audio_mgr->onWakeWord([&app]()
+                              { app.postEvent(event::AppEvent::WAKEWORD_DETECTED); });
+        audio_mgr->onBargeIn([&app]()
+                             { app.postEvent(event::AppEvent::BARGE_IN); });
+        audio_mgr->onVoiceCommand([&app](VoiceCommand cmd)
+                                  {
+            switch (cmd)
+            {
+            case VoiceCommand::VOLUME_UP:
+                app.postEvent(event::AppEvent::VOICE_VOLUME_UP);
+                break;
+            case VoiceCommand::VOLUME_DOWN:
+                app.postEvent(event::AppEvent::VOICE_VOLUME_DOWN);
+                break;
+            case VoiceCommand::CANCEL:
+                app.postEvent(event::AppEvent::VOICE_CANCEL);
+                break;
+            case VoiceCommand::SLEEP:
+                app.postEvent(event::AppEvent::VOICE_SLEEP);
+                break;
+            default:
+                break;
+            } });
+        return true;
+    });
 
     // =========================================================
-    // 3️⃣ NETWORK
+    // 3️⃣ NETWORK (Wi-Fi / WS / MQTT; deferred on fast resume)
     // =========================================================
-    auto network_mgr = std::make_unique<NetworkManager>();
-
-    // Configure captive portal and WebSocket server endpoint here
-    NetworkManager::Config net_cfg{};
-    net_cfg.ap_ssid = "PTalk-Portal"; // SSID hiển thị khi mở portal
-    net_cfg.ap_max_clients = 4;       // Số thiết bị tối đa kết nối vào portal
-
-    // Xác định WS URL: ưu tiên lấy từ NVS; nếu trống dùng mặc định "171.226.10.121:8000"
-    auto normalize_ws_url = [](std::string val) -> std::string {
-        // Trim spaces
-        auto trim = [](std::string &s){
-            while (!s.empty() && (s.front()==' '||s.front()=='\t'||s.front()=='\n'||s.front()=='\r')) s.erase(s.begin());
-            while (!s.empty() && (s.back()==' '||s.back()=='\t'||s.back()=='\n'||s.back()=='\r')) s.pop_back();
+    graph.add("network", {}, 0, [&]() -> bool {
+        network_mgr = std::make_unique<NetworkManager>();
+
+        // Configure captive portal and WebSocket server endpoint here
+        NetworkManager::Config net_cfg{};
+        net_cfg.ap_ssid = "PTalk-Portal"; // SSID hiển thị khi mở portal
+        net_cfg.ap_max_clients = 4;       // Số thiết bị tối đa kết nối vào portal
+        net_cfg.uplink_packet_ms = 40;    // Mic audio per WS message (20/40/80 ms)
+        net_cfg.uplink_send_timeout_ms = 1000;
+        net_cfg.uplink_adaptive = true;   // Step the codec down on a congested link
+
+        // Xác định WS URL: ưu tiên lấy từ NVS; nếu trống dùng mặc định "171.226.10.121:8000"
+        auto normalize_ws_url = [](std::string val) -> std::string {
+            // Trim spaces
+            auto trim = [](std::string &s){
+                while (!s.empty() && (s.front()==' '||s.front()=='\t'||s.front()=='\n'||s.front()=='\r')) s.erase(s.begin());
+                while (!s.empty() && (s.back()==' '||s.back()=='\t'||s.back()=='\n'||s.back()=='\r')) s.pop_back();
+            };
+            trim(val);
+            if (val.empty()) return std::string();
+            // Already a ws(s):// URL
+            if (val.rfind("ws://", 0) == 0 || val.rfind("wss://", 0) == 0) {
+                // Ensure it has a path; if missing, append /ws
+                auto pos_slash = val.find('/', val.find("://") + 3);
+                if (pos_slash == std::string::npos) val += "/ws";
+                return val;
+            }
+            // Convert http(s):// to ws(s)://
+            if (val.rfind("http://", 0) == 0) {
+                val.replace(0, 7, "ws://");
+                auto pos_slash = val.find('/', val.find("://") + 3);
+                if (pos_slash == std::string::npos) val += "/ws";
+                return val;
+            }
+            if (val.rfind("https://", 0) == 0) {
+                val.replace(0, 8, "wss://");
+                auto pos_slash = val.find('/', val.find("://") + 3);
+                if (pos_slash == std::string::npos) val += "/ws";
+                return val;
+            }
+            // Assume host:port → prepend ws:// and append /ws
+            return std::string("ws://") + val + "/ws";
         };
-        trim(val);
-        if (val.empty()) return std::string();
-        // Already a ws(s):// URL
-        if (val.rfind("ws://", 0) == 0 || val.rfind("wss://", 0) == 0) {
-            // Ensure it has a path; if missing, append /ws
-            auto pos_slash = val.find('/', val.find("://") + 3);
-            if (pos_slash == std::string::npos) val += "/ws";
-            return val;
-        }
-        // Convert http(s):// to ws(s)://
-        if (val.rfind("http://", 0) == 0) {
-            val.replace(0, 7, "ws://");
-            auto pos_slash = val.find('/', val.find("://") + 3);
-            if (pos_slash == std::string::npos) val += "/ws";
-            return val;
-        }
-        if (val.rfind("https://", 0) == 0) {
-            val.replace(0, 8, "wss://");
-            auto pos_slash = val.find('/', val.find("://") + 3);
-            if (pos_slash == std::string::npos) val += "/ws";
-            return val;
-        }
-        // Assume host:port → prepend ws:// and append /ws
-        return std::string("ws://") + val + "/ws";
-    };
 
-    auto normalize_mqtt_url = [](std::string val) -> std::string {
-        // Trim spaces
-        auto trim = [](std::string &s){
-            while (!s.empty() && (s.front()==' '||s.front()=='\t'||s.front()=='\n'||s.front()=='\r')) s.erase(s.begin());
-            while (!s.empty() && (s.back()==' '||s.back()=='\t'||s.back()=='\n'||s.back()=='\r')) s.pop_back();
+        auto normalize_mqtt_url = [](std::string val) -> std::string {
+            // Trim spaces
+            auto trim = [](std::string &s){
+                while (!s.empty() && (s.front()==' '||s.front()=='\t'||s.front()=='\n'||s.front()=='\r')) s.erase(s.begin());
+                while (!s.empty() && (s.back()==' '||s.back()=='\t'||s.back()=='\n'||s.back()=='\r')) s.pop_back();
+            };
+            trim(val);
+            if (val.empty()) return std::string();
+            // Already a mqtt(s):// URL
+            if (val.rfind("mqtt://", 0) == 0 || val.rfind("mqtts://", 0) == 0) {
+                return val;
+            }
+            // Convert tcp(s):// to mqtt(s)://
+            if (val.rfind("tcp://", 0) == 0) {
+                val.replace(0, 6, "mqtt://");
+                return val;
+            }
+            if (val.rfind("tcps://", 0) == 0) {
+                val.replace(0, 7, "mqtts://");
+                return val;
+            }
+            // Assume host:port → prepend mqtt://
+            return std::string("mqtt://") + val;
         };
-        trim(val);
-        if (val.empty()) return std::string();
-        // Already a mqtt(s):// URL
-        if (val.rfind("mqtt://", 0) == 0 || val.rfind("mqtts://", 0) == 0) {
-            return val;
+
+        const std::string default_hostport = "171.226.10.121:8000";
+        std::string chosen_ws = user.ws_url.empty() ? default_hostport : user.ws_url;
+        net_cfg.ws_url = normalize_ws_url(chosen_ws);
+    
+        const std::string default_mqtt = "171.226.10.121:1883";
+        std::string chosen_mqtt = user.mqtt_url.empty() ? default_mqtt : user.mqtt_url;
+        net_cfg.mqtt_url = normalize_mqtt_url(chosen_mqtt);
+
+        if (resume.fastResume())
+        {
+            // Was online before deep sleep: Wi-Fi / WS / MQTT init runs from
+            // AppController's deferred start, after display and audio are up
+            net_cfg.sta_ssid = user.wifi_ssid;
+            net_cfg.sta_pass = user.wifi_pass;
+            network_mgr->deferInit(net_cfg);
         }
-        // Convert tcp(s):// to mqtt(s)://
-        if (val.rfind("tcp://", 0) == 0) {
-            val.replace(0, 6, "mqtt://");
-            return val;
+        else
+        {
+            if (!network_mgr->init(net_cfg))
+            {
+                ESP_LOGE(TAG, "NetworkManager init failed");
+                return false;
+            }
+
+            // If user provided Wi-Fi credentials in user settings, try them first
+            if (!user.wifi_ssid.empty())
+            {
+                network_mgr->setCredentials(user.wifi_ssid, user.wifi_pass);
+            }
         }
-        if (val.rfind("tcps://", 0) == 0) {
-            val.replace(0, 7, "mqtts://");
-            return val;
+        return true;
+    });
+
+    // =========================================================
+    // 4️⃣ TOUCH INPUT
+    // =========================================================
+    graph.add("touch", {}, 0, [&]() -> bool {
+        touch_input = std::make_unique<TouchInput>();
+
+        if (!touch_input->init(device_cfg::touch))
+        {
+            ESP_LOGE(TAG, "TouchInput init failed");
+            return false;
         }
-        // Assume host:port → prepend mqtt://
-        return std::string("mqtt://") + val;
-    };
 
-    const std::string default_hostport = "171.226.10.121:8000";
-    std::string chosen_ws = user.ws_url.empty() ? default_hostport : user.ws_url;
-    net_cfg.ws_url = normalize_ws_url(chosen_ws);
-    
-    const std::string default_mqtt = "171.226.10.121:1883";
-    std::string chosen_mqtt = user.mqtt_url.empty() ? default_mqtt : user.mqtt_url;
-    net_cfg.mqtt_url = normalize_mqtt_url(chosen_mqtt);
+        // Runs in the esp_timer task right after the edge; PRESS / RELEASE
+        // land in AppController's high-priority lane
+        touch_input->onEvent([&app](TouchInput::Event e)
+                             {
+            if (e == TouchInput::Event::PRESS) {
+                app.postEvent(event::AppEvent::USER_BUTTON);
+            }
+            if (e == TouchInput::Event::RELEASE) {
+                // Currently no action on release
+                app.postEvent(event::AppEvent::RELEASE_BUTTON);
+            }
+            if (e == TouchInput::Event::LONG_PRESS) {
+                app.postEvent(event::AppEvent::SLEEP_REQUEST);
+            } });
+        return true;
+    });
 
-    if (!network_mgr->init(net_cfg))
+    // =========================================================
+    // 5️⃣ POWER
+    // =========================================================
+    graph.add("power", {}, 1, [&]() -> bool {
+        // Centralize power/deep-sleep thresholds here for easy tuning
+        PowerManager::Config power_cfg{};
+        power_cfg.evaluate_interval_ms = 2000; // sample every 2s
+        // power_cfg.low_battery_percent = 15.0f; // low battery warning at 15%
+        power_cfg.critical_percent = device_cfg::sleep.critical_percent; // critical battery (auto sleep) at 5%
+        power_cfg.enable_smoothing = true; // Kalman state-of-charge estimator
+        power_cfg.steady_interval_ms = 30000; // slow down once the estimate settled
+
+        // Battery sensing hardware (divider + optional charge/full pins)
+        auto power_driver = std::make_unique<Power>(
+            device_cfg::power.adc_channel,
+            device_cfg::power.pin_chg,  // set to GPIO pin if hardware provides charge indicator
+            device_cfg::power.pin_full, // set to GPIO pin if hardware provides full indicator
+            device_cfg::power.r1_ohm,
+            device_cfg::power.r2_ohm);
+
+        power_mgr = std::make_unique<PowerManager>(std::move(power_driver), power_cfg);
+        return true;
+    });
+
+    const bool init_ok = graph.run();
+    graph.print();
+    if (!init_ok)
     {
-        ESP_LOGE(TAG, "NetworkManager init failed");
+        ESP_LOGE(TAG, "Subsystem init failed");
         return false;
     }
 
-    // If user provided Wi-Fi credentials in user settings, try them first
-    if (!user.wifi_ssid.empty())
-    {
-        network_mgr->setCredentials(user.wifi_ssid, user.wifi_pass);
-    }
-
+    // =========================================================
+    // WIRING (needs the stages above)
+    // =========================================================
     // --- Network → Audio wiring ---
-    // Push incoming binary (ADPCM) from WS into speaker ringbuffer
+    // Push incoming binary (codec stream) from WS into speaker ringbuffer
     // and drive InteractionState to SPEAKING while audio is arriving.
-    StreamBufferHandle_t spk_sb = audio_mgr->getSpeakerEncodedBuffer();
-    network_mgr->setMicBuffer(audio_mgr->getMicEncodedBuffer()); // Uplink mic buffer
+    SpscRing *spk_rb = audio_mgr->getSpeakerEncodedBuffer();
+    network_mgr->setMicBuffer(audio_mgr->getMicEncodedBuffer(),  // Uplink mic buffer
+                              audio_mgr->encodedStreamFramed(),
+                              audio_mgr->encodedFrameBytes(),
+                              audio_mgr->frameMs());
     // Expose managers to NetworkManager for real-time config (volume/brightness)
     network_mgr->setManagers(audio_mgr.get(), display_mgr.get());
     AudioManager *audio_ptr = audio_mgr.get();                   // Capture pointer for disconnect handler
     NetworkManager *network_ptr = network_mgr.get();             // For session flag access
 
-    network_mgr->onServerBinary([spk_sb, network_ptr](const uint8_t *data, size_t len)
+    network_mgr->onServerBinary([audio_ptr, network_ptr](const WsBinaryView &frag)
                                 {
+        const uint8_t *data = frag.data;
+        const size_t len = frag.len;
         if (!data || len == 0) return;
         auto interaction = StateManager::instance().getInteractionState();
         // Only accept downlink audio when a speaking session is active
@@ -525,26 +713,31 @@ bool DeviceProfile::setup(AppController &app)
             }
             return;
         }
-        // Feed encoded data to AudioManager's downlink buffer
-        size_t written = xStreamBufferSend(spk_sb, data, len, pdMS_TO_TICKS(100));
+        // Feed encoded data to AudioManager's jitter-buffered downlink ring
+        // (WS payload buffer is reused by the client, so this is the one copy on the downlink)
+        size_t written = audio_ptr->pushDownlink(data, len, frag.last);
         if (written != len) {
             static uint32_t drop_count = 0;
             if (++drop_count % 10 == 0) {
-                ESP_LOGW("Network", "ADPCM buffer full! Dropped %zu bytes (wanted %zu)", len - written, len);
+                ESP_LOGW("Network", "ADPCM ring full! Dropped %zu bytes", len);
             }
         }
         });
 
+    // Framed downlink: session / seq / codec / end-of-stream per packet
+    network_mgr->onServerAudioPacket([audio_ptr](const audio_packet::Header &hdr)
+                                     { return audio_ptr->beginDownlinkPacket(hdr); });
+
     // Handle WS disconnect - must cleanup to unblock speaker task
-    network_mgr->onDisconnect([spk_sb, audio_ptr]()
+    network_mgr->onDisconnect([spk_rb, audio_ptr]()
                               {
         auto& sm = StateManager::instance();
         auto current_state = sm.getInteractionState();
         
         ESP_LOGW("DeviceProfile", "WS disconnected - cleanup audio state");
         
-        // Flush buffer to wake speaker task from blocking read
-        xStreamBufferReset(spk_sb);
+        // Drop pending downlink audio (decoder task services the reset)
+        spk_rb->reset();
         
         // Stop speaking to set speaking=false and unblock task
         if (current_state == state::InteractionState::SPEAKING) {
@@ -553,10 +746,15 @@ bool DeviceProfile::setup(AppController &app)
         } });
 
     // Optionally react to simple text control messages from server
-    network_mgr->onServerText([network_ptr](const std::string &msg)
+    network_mgr->onServerText([network_ptr, audio_ptr](std::string_view msg)
                               {
         auto& sm = StateManager::instance();
-        if (msg == "PROCESSING_START" || msg == "PROCESSING") {
+        if (msg.rfind("AUDIO_RATE:", 0) == 0) {
+            // Native rate of the following TTS audio (0 = codec rate)
+            uint32_t hz = 0;
+            std::from_chars(msg.data() + 11, msg.data() + msg.size(), hz);
+            audio_ptr->setDownlinkSampleRate(hz);
+        } else if (msg == "PROCESSING_START" || msg == "PROCESSING") {
             sm.setInteractionState(state::InteractionState::PROCESSING,
                                    state::InputSource::SERVER_COMMAND);
         } else if (msg == "AUDIO_START"||msg == "SPEAKING" || msg == "SPEAK_START") {
@@ -621,55 +819,6 @@ bool DeviceProfile::setup(AppController &app)
     app.postEvent(event::AppEvent::CONFIG_DONE_RESTART); });
 
     network_mgr->setBluetoothService(ble_service);
-    // =========================================================
-    // 4️⃣ TOUCH INPUT
-    // =========================================================
-    auto touch_input = std::make_unique<TouchInput>();
-
-    TouchInput::Config touch_cfg{
-        .pin = GPIO_NUM_16,
-        .active_low = true,
-        .long_press_ms = 1200};
-
-    if (!touch_input->init(touch_cfg))
-    {
-        ESP_LOGE(TAG, "TouchInput init failed");
-        return false;
-    }
-
-    touch_input->onEvent([&app](TouchInput::Event e)
-                         {
-        if (e == TouchInput::Event::PRESS) {
-            app.postEvent(event::AppEvent::USER_BUTTON);
-        }
-        if (e == TouchInput::Event::RELEASE) {
-            // Currently no action on release
-            app.postEvent(event::AppEvent::RELEASE_BUTTON);
-        }
-        if (e == TouchInput::Event::LONG_PRESS) {
-            app.postEvent(event::AppEvent::SLEEP_REQUEST);
-        } });
-
-    // =========================================================
-    // 5️⃣ POWER
-    // =========================================================
-    // Centralize power/deep-sleep thresholds here for easy tuning
-    PowerManager::Config power_cfg{};
-    power_cfg.evaluate_interval_ms = 2000; // sample every 2s
-    // power_cfg.low_battery_percent = 15.0f; // low battery warning at 15%
-    power_cfg.critical_percent = 5.0f; // critical battery (auto sleep) at 5%
-    power_cfg.enable_smoothing = true; // enable smoothing filter
-    power_cfg.smoothing_alpha = 0.15f; // smoothing factor alpha
-
-    // Battery sensing hardware (divider + optional charge/full pins)
-    auto power_driver = std::make_unique<Power>(
-        device_cfg::power.adc_channel,
-        device_cfg::power.pin_chg,  // set to GPIO pin if hardware provides charge indicator
-        device_cfg::power.pin_full, // set to GPIO pin if hardware provides full indicator
-        device_cfg::power.r1_ohm,
-        device_cfg::power.r2_ohm);
-
-    auto power_mgr = std::make_unique<PowerManager>(std::move(power_driver), power_cfg);
 
     // Link PowerManager → DisplayManager for battery % updates
     power_mgr->setDisplayManager(display_mgr.get());
@@ -679,7 +828,8 @@ bool DeviceProfile::setup(AppController &app)
 
     // App-level power behavior (deep sleep re-check interval)
     AppController::Config app_cfg{};
-    app_cfg.deep_sleep_wakeup_sec = 60; // wake every 60s to re-check battery
+    app_cfg.deep_sleep_wakeup_sec = device_cfg::sleep.wakeup_sec; // wake every 60s to re-check battery
+    app_cfg.defer_network = resume.fastResume();
 
     // =========================================================
     // 6️⃣ CREATE OTA UPDATER
@@ -703,3 +853,41 @@ bool DeviceProfile::setup(AppController &app)
     ESP_LOGI(TAG, "DeviceProfile setup OK");
     return true;
 }
+
+void DeviceProfile::checkBatteryOnTimerWake()
+{
+    auto &resume = ResumeState::instance();
+    if (resume.wake() != ResumeState::Wake::TIMER)
+        return;
+
+    // Only the ADC and the charge pins: no display, audio, NVS or Wi-Fi
+    Power power(device_cfg::power.adc_channel,
+                device_cfg::power.pin_chg,
+                device_cfg::power.pin_full,
+                device_cfg::power.r1_ohm,
+                device_cfg::power.r2_ohm);
+
+    // No load after deep sleep: the reading is the resting voltage
+    const float volts = power.readVoltage();
+    const float percent = Power::ocvToPercent(volts);
+    const bool charging = power.isCharging() == 1 || power.isFull() == 1;
+    const float resume_percent = device_cfg::sleep.critical_percent + device_cfg::sleep.resume_margin_percent;
+
+    if (charging || percent >= resume_percent)
+    {
+        ESP_LOGI(TAG, "Timer wake: battery %.1f%% (%.2f V, charging=%d) -> full boot",
+                 percent, volts, charging);
+        return;
+    }
+
+    resume.noteTimerWake();
+    ESP_LOGI(TAG, "Timer wake #%u: battery %.1f%% (%.2f V) still low -> back to sleep",
+             (unsigned)resume.timerWakes(), percent, volts);
+
+    // Same wake sources as AppController::enterSleep()
+    TouchInput touch;
+    if (touch.init(device_cfg::touch))
+        touch.enableDeepSleepWake();
+    esp_sleep_enable_timer_wakeup(static_cast<uint64_t>(device_cfg::sleep.wakeup_sec) * 1000000ULL);
+    esp_deep_sleep_start(); // DOES NOT RETURN
+}
@@ -24,4 +24,11 @@ public:
      * @return true nếu setup OK
      */
     static bool setup(AppController &app);
+
+    /**
+     * Thức dậy bằng timer (kiểm tra pin định kỳ khi deep sleep): chỉ đọc ADC,
+     * không bật display / audio / Wi-Fi. Pin vẫn yếu → ngủ lại ngay (không
+     * return); đang sạc hoặc đủ pin → return để boot đầy đủ.
+     */
+    static void checkBatteryOnTimerWake();
 };
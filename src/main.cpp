@@ -3,6 +3,8 @@
 #include "esp_log.h"
 #include "AppController.hpp"
 #include "config/DeviceProfile.hpp"
+#include "system/ResumeState.hpp"
+#include "system/EventLog.hpp"
 
 static const char *TAG = "MAIN_TEST";
 
@@ -12,6 +14,13 @@ extern "C" void app_main(void)
 {
     ESP_LOGI(TAG, "App Main started");
 
+    // Wake cause + RTC-retained state; a timer wake with a low battery goes
+    // back to deep sleep from here without touching display or Wi-Fi
+    ResumeState::instance().capture();
+    DeviceProfile::checkBatteryOnTimerWake();
+    // Reset reason / crash summary into the event log (RAM; the network loop flashes it)
+    EventLog::instance().captureBoot();
+
     // Khởi tạo AppController
     auto& app = AppController::instance();
 
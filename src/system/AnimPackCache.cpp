@@ -0,0 +1,790 @@
+#include "AnimPackCache.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "system/MemTelemetry.hpp"
+#include "system/StateManager.hpp"
+#include "system/TaskPlan.hpp"
+
+#include "esp_http_client.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "mbedtls/sha256.h"
+#include "mbedtls/version.h"
+#include "nvs.h"
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+#include "esp_crt_bundle.h"
+#endif
+
+// mbedtls 3.x (IDF 5) dropped the *_ret names
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+#define PACK_SHA256_STARTS mbedtls_sha256_starts
+#define PACK_SHA256_UPDATE mbedtls_sha256_update
+#define PACK_SHA256_FINISH mbedtls_sha256_finish
+#else
+#define PACK_SHA256_STARTS mbedtls_sha256_starts_ret
+#define PACK_SHA256_UPDATE mbedtls_sha256_update_ret
+#define PACK_SHA256_FINISH mbedtls_sha256_finish_ret
+#endif
+
+static const char *TAG = "AnimPackCache";
+
+namespace
+{
+    // Slot header (little-endian), pack bytes follow at SLOT_HDR:
+    //   u32 magic "PTPK", u32 pack bytes, u32 seq, u32 reserved,
+    //   char name[16], u8 sha256[32]
+    constexpr uint32_t SLOT_MAGIC = 0x4B505450; // "PTPK"
+    constexpr size_t SLOT_HDR = 64;
+    constexpr size_t PACK_HDR = 16;   // AssetBundle header
+    constexpr size_t PACK_ANIM = 32;  // AssetBundle animation entry
+    constexpr size_t MAX_PACK_ANIMS = 32;
+    constexpr size_t SECTOR = 4096;
+
+    constexpr uint32_t POLL_MS = 5000;                  // idle check period
+    constexpr uint32_t STATS_SAVE_MS = 10 * 60 * 1000;  // NVS writes at most this often
+    constexpr uint32_t HTTP_TIMEOUT_MS = 10000;
+    constexpr size_t CHUNK = 1024;
+
+    static_assert(asset::ANIM_COUNT <= 32, "anim mask is 32 bits");
+
+    // Use counts and recency per slot (NVS "animpack"/"lru"), matched by seq
+    struct PersistEntry
+    {
+        uint32_t seq;
+        uint16_t uses;
+        uint16_t reserved;
+        uint32_t last_use;
+    };
+    struct Persist
+    {
+        uint32_t use_clock;
+        PersistEntry slots[AnimPackCache::MAX_SLOTS];
+    };
+
+    inline uint32_t rd32(const uint8_t *p)
+    {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+    inline void wr32(uint8_t *p, uint32_t v)
+    {
+        p[0] = (uint8_t)v;
+        p[1] = (uint8_t)(v >> 8);
+        p[2] = (uint8_t)(v >> 16);
+        p[3] = (uint8_t)(v >> 24);
+    }
+
+    int hexNibble(char c)
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+        return -1;
+    }
+
+    bool parseSha(const char *hex, uint8_t out[32])
+    {
+        if (!hex || strlen(hex) != 64)
+            return false;
+        for (int i = 0; i < 32; i++)
+        {
+            const int hi = hexNibble(hex[2 * i]);
+            const int lo = hexNibble(hex[2 * i + 1]);
+            if (hi < 0 || lo < 0)
+                return false;
+            out[i] = (uint8_t)((hi << 4) | lo);
+        }
+        return true;
+    }
+
+    const esp_partition_t *findPartition(const char *label)
+    {
+        return esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                        static_cast<esp_partition_subtype_t>(AssetBundle::PARTITION_SUBTYPE), label);
+    }
+
+    // RAII lock on the cache mutex
+    struct Guard
+    {
+        explicit Guard(SemaphoreHandle_t m) : m_(m) { xSemaphoreTake(m_, portMAX_DELAY); }
+        ~Guard() { xSemaphoreGive(m_); }
+        SemaphoreHandle_t m_;
+    };
+} // namespace
+
+AnimPackCache &AnimPackCache::instance()
+{
+    static AnimPackCache inst;
+    return inst;
+}
+
+// ============================================================================
+// Init: slot geometry + manifest scan
+// ============================================================================
+bool AnimPackCache::init(size_t bundle_bytes, const char *label)
+{
+    if (!lock_)
+        lock_ = xSemaphoreCreateMutex();
+    if (!lock_)
+        return false;
+
+    const esp_partition_t *part = findPartition(label);
+    if (!part)
+    {
+        ESP_LOGI(TAG, "No '%s' partition, packs disabled", label);
+        return false;
+    }
+
+    label_ = label;
+    region_ = (bundle_bytes + SLOT_BYTES - 1) / SLOT_BYTES * SLOT_BYTES;
+    slot_count_ = region_ < part->size ? std::min<size_t>((part->size - region_) / SLOT_BYTES, MAX_SLOTS) : 0;
+    if (slot_count_ == 0)
+    {
+        ESP_LOGW(TAG, "No room for packs after the %u B bundle", (unsigned)bundle_bytes);
+        return false;
+    }
+
+    Guard g(lock_);
+    size_t valid = 0;
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        if (readSlot(i))
+        {
+            valid++;
+            next_seq_ = std::max(next_seq_, slots_[i].seq + 1);
+        }
+    }
+    for (auto &m : mapped_)
+        std::fill(std::begin(m.anim_index), std::end(m.anim_index), (int8_t)-1);
+    loadStats();
+
+    ESP_LOGI(TAG, "%u slots x %u KB at '%s'+0x%x, %u packs cached", (unsigned)slot_count_,
+             (unsigned)(SLOT_BYTES / 1024), label_, (unsigned)region_, (unsigned)valid);
+    return true;
+}
+
+bool AnimPackCache::start()
+{
+    if (task_ || slot_count_ == 0)
+        return task_ != nullptr;
+    return TaskPlan::instance().spawn(TaskPlan::ASSET_FETCH, &AnimPackCache::taskEntry, this, &task_);
+}
+
+// Slot header + the pack's animation names (-> slot mask), without mapping
+bool AnimPackCache::readSlot(size_t i)
+{
+    Slot &s = slots_[i];
+    s = Slot{};
+
+    const esp_partition_t *part = findPartition(label_);
+    const size_t off = region_ + i * SLOT_BYTES;
+    uint8_t hdr[SLOT_HDR];
+    if (!part || esp_partition_read(part, off, hdr, sizeof(hdr)) != ESP_OK || rd32(hdr) != SLOT_MAGIC)
+        return false;
+
+    const uint32_t bytes = rd32(hdr + 4);
+    if (bytes < PACK_HDR || bytes > SLOT_BYTES - SLOT_HDR)
+        return false;
+
+    uint8_t pack[PACK_HDR];
+    if (esp_partition_read(part, off + SLOT_HDR, pack, sizeof(pack)) != ESP_OK || rd32(pack) != AssetBundle::MAGIC)
+        return false;
+    const size_t n = std::min<size_t>(pack[6] | (pack[7] << 8), MAX_PACK_ANIMS);
+
+    uint32_t anims = 0;
+    for (size_t k = 0; k < n; k++)
+    {
+        char name[PACK_NAME_MAX] = {};
+        if (esp_partition_read(part, off + SLOT_HDR + PACK_HDR + k * PACK_ANIM, name, sizeof(name)) != ESP_OK)
+            return false;
+        const asset::AnimId id = asset::animIdFromName(std::string_view(name, strnlen(name, sizeof(name))));
+        if (id != asset::AnimId::NONE)
+            anims |= 1u << (unsigned)id;
+    }
+
+    s.valid = true;
+    s.bytes = bytes;
+    s.seq = rd32(hdr + 8);
+    s.anims = anims;
+    memcpy(s.name, hdr + 16, PACK_NAME_MAX);
+    s.name[PACK_NAME_MAX] = '\0';
+    memcpy(s.sha, hdr + 32, sizeof(s.sha));
+    return true;
+}
+
+// ============================================================================
+// Lookup / mapping (lock held)
+// ============================================================================
+int AnimPackCache::findSha(const uint8_t sha[32]) const
+{
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        if (slots_[i].valid && memcmp(slots_[i].sha, sha, 32) == 0)
+            return (int)i;
+    }
+    return -1;
+}
+
+int AnimPackCache::packFor(asset::AnimId id) const
+{
+    const uint32_t bit = 1u << (unsigned)id;
+    int best = -1;
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        const Slot &s = slots_[i];
+        if (s.valid && !s.busy && (s.anims & bit) && (best < 0 || s.seq > slots_[best].seq))
+            best = (int)i;
+    }
+    return best;
+}
+
+int AnimPackCache::mapSlot(size_t i)
+{
+    // Free entry, else the least recently used one not on screen
+    int m = -1;
+    for (size_t k = 0; k < MAX_MAPPED; k++)
+    {
+        const int owner = mapped_[k].slot;
+        if (owner < 0)
+        {
+            m = (int)k;
+            break;
+        }
+        if (owner != pinned_ && (m < 0 || slots_[owner].last_use < slots_[mapped_[m].slot].last_use))
+            m = (int)k;
+    }
+    if (m < 0)
+        return -1;
+    if (mapped_[m].slot >= 0)
+    {
+        unmapSlot(mapped_[m].slot);
+        stats_.map_evictions++;
+    }
+
+    Mapped &e = mapped_[m];
+    if (!e.bundle.openAt(label_, region_ + i * SLOT_BYTES + SLOT_HDR, slots_[i].bytes))
+    {
+        ESP_LOGW(TAG, "Pack '%s' does not parse, dropped", slots_[i].name);
+        slots_[i].valid = false;
+        return -1;
+    }
+    std::fill(std::begin(e.anim_index), std::end(e.anim_index), (int8_t)-1);
+    for (size_t k = 0; k < e.bundle.count(); k++)
+    {
+        const asset::AnimId id = asset::animIdFromName(e.bundle.name(k));
+        if (id != asset::AnimId::NONE)
+            e.anim_index[(size_t)id] = (int8_t)k;
+    }
+    e.slot = (int8_t)i;
+    slots_[i].mapped = (int8_t)m;
+    return m;
+}
+
+void AnimPackCache::unmapSlot(size_t i)
+{
+    const int m = slots_[i].mapped;
+    if (m < 0)
+        return;
+    mapped_[m].bundle.close();
+    mapped_[m].slot = -1;
+    slots_[i].mapped = -1;
+}
+
+void AnimPackCache::touch(Slot &s)
+{
+    if (s.uses < UINT16_MAX)
+        s.uses++;
+    s.last_use = ++use_clock_;
+    stats_dirty_ = true;
+}
+
+const Animation1Bit *AnimPackCache::resolve(asset::AnimId id)
+{
+    if (!lock_ || (size_t)id >= asset::ANIM_COUNT)
+        return nullptr;
+    Guard g(lock_);
+
+    const int i = packFor(id);
+    if (i < 0)
+    {
+        pinned_ = -1;
+        return nullptr;
+    }
+
+    int m = slots_[i].mapped;
+    if (m >= 0)
+        stats_.warm_hits++;
+    else
+    {
+        // Not preloaded: flash mmap + table parse, no network
+        pinned_ = -1;
+        m = mapSlot(i);
+        stats_.cold_maps++;
+        if (m < 0)
+            return nullptr;
+    }
+
+    const int k = mapped_[m].anim_index[(size_t)id];
+    if (k < 0)
+    {
+        pinned_ = -1;
+        return nullptr;
+    }
+    touch(slots_[i]);
+    pinned_ = i;
+    return &mapped_[m].bundle.animation(k);
+}
+
+// ============================================================================
+// Offers (any task)
+// ============================================================================
+bool AnimPackCache::offer(const char *name, const char *url, const char *sha256_hex, uint32_t size)
+{
+    if (!lock_ || slot_count_ == 0)
+        return false;
+
+    Offer o;
+    o.used = true;
+    if (!name || !*name || strlen(name) > PACK_NAME_MAX || !url || strlen(url) >= URL_MAX ||
+        (strncmp(url, "http://", 7) != 0 && strncmp(url, "https://", 8) != 0) || !parseSha(sha256_hex, o.sha) ||
+        size < PACK_HDR || size > SLOT_BYTES - SLOT_HDR)
+    {
+        ESP_LOGW(TAG, "Rejected pack offer '%s' (%u B)", name ? name : "", (unsigned)size);
+        return false;
+    }
+    strcpy(o.name, name);
+    strcpy(o.url, url);
+    o.size = size;
+
+    {
+        Guard g(lock_);
+        const int have = findSha(o.sha);
+        if (have >= 0)
+        {
+            stats_.dedup_hits++;
+            ESP_LOGI(TAG, "Pack '%s' already cached (slot %d '%s')", name, have, slots_[have].name);
+            return true;
+        }
+        Offer *free_entry = nullptr;
+        for (auto &q : offers_)
+        {
+            if (q.used && memcmp(q.sha, o.sha, 32) == 0)
+                return true; // already queued
+            if (!q.used && !free_entry)
+                free_entry = &q;
+        }
+        if (!free_entry)
+        {
+            ESP_LOGW(TAG, "Pack queue full, '%s' dropped", name);
+            return false;
+        }
+        *free_entry = o;
+    }
+
+    ESP_LOGI(TAG, "Pack '%s' queued (%u B)", name, (unsigned)size);
+    if (task_)
+        xTaskNotifyGive(task_);
+    return true;
+}
+
+bool AnimPackCache::takeOffer(Offer &out)
+{
+    Guard g(lock_);
+    for (auto &q : offers_)
+    {
+        if (q.used)
+        {
+            out = q;
+            q.used = false;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// Fetch task
+// ============================================================================
+void AnimPackCache::taskEntry(void *arg)
+{
+    static_cast<AnimPackCache *>(arg)->taskLoop();
+}
+
+// Nothing on screen or speaker depends on the flash cache being free
+bool AnimPackCache::idle()
+{
+    auto &sm = StateManager::instance();
+    return sm.getInteractionState() == state::InteractionState::IDLE &&
+           sm.getSystemState() == state::SystemState::RUNNING;
+}
+
+void AnimPackCache::taskLoop()
+{
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::ASSET_FETCH));
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(POLL_MS));
+        if (!idle())
+            continue;
+
+        // Downloads first (one per pass, re-checking idle in between)
+        Offer o;
+        if (StateManager::instance().getConnectivityState() == state::ConnectivityState::ONLINE && takeOffer(o))
+        {
+            fetch(o);
+            xTaskNotifyGive(task_); // next offer without waiting a poll period
+            continue;
+        }
+
+        preload();
+
+        if (stats_dirty_ && xTaskGetTickCount() - stats_saved_ >= pdMS_TO_TICKS(STATS_SAVE_MS))
+            saveStats();
+    }
+}
+
+// Least recently used slot not on screen (empty ones first); lock held
+int AnimPackCache::pickVictim() const
+{
+    int best = -1;
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        const Slot &s = slots_[i];
+        if (s.busy || (int)i == pinned_)
+            continue;
+        if (!s.valid)
+            return (int)i;
+        if (best < 0 || s.last_use < slots_[best].last_use ||
+            (s.last_use == slots_[best].last_use && s.uses < slots_[best].uses))
+            best = (int)i;
+    }
+    return best;
+}
+
+bool AnimPackCache::fetch(const Offer &o)
+{
+    int victim;
+    {
+        Guard g(lock_);
+        if (findSha(o.sha) >= 0)
+        {
+            stats_.dedup_hits++;
+            return true;
+        }
+        victim = pickVictim();
+        if (victim < 0)
+        {
+            ESP_LOGW(TAG, "No free slot for '%s'", o.name);
+            return false;
+        }
+        Slot &s = slots_[victim];
+        if (s.valid)
+        {
+            ESP_LOGI(TAG, "Evicting '%s' (slot %d, %u uses)", s.name, victim, (unsigned)s.uses);
+            stats_.flash_evictions++;
+        }
+        unmapSlot(victim);
+        s = Slot{};
+        s.busy = true;
+    }
+
+    bool interrupted = false;
+    const bool ok = download(o, victim, interrupted);
+
+    Guard g(lock_);
+    slots_[victim].busy = false;
+    if (!ok)
+    {
+        stats_.download_fails++;
+        if (interrupted)
+        {
+            // Device got busy mid-download: retry at the next idle period
+            for (auto &q : offers_)
+            {
+                if (!q.used)
+                {
+                    q = o;
+                    break;
+                }
+            }
+        }
+        return false;
+    }
+
+    readSlot(victim);
+    stats_.downloads++;
+    stats_dirty_ = true;
+
+    // Same name, older content: retire it (magic zeroed, no erase)
+    const esp_partition_t *part = findPartition(label_);
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        Slot &s = slots_[i];
+        if ((int)i == victim || !s.valid || strcmp(s.name, o.name) != 0)
+            continue;
+        const uint8_t zero[4] = {};
+        if (part)
+            esp_partition_write(part, region_ + i * SLOT_BYTES, zero, sizeof(zero));
+        s.valid = false;
+        if ((int)i != pinned_)
+            unmapSlot(i);
+        ESP_LOGI(TAG, "Pack '%s' replaced (slot %u -> %d)", o.name, (unsigned)i, victim);
+    }
+    ESP_LOGI(TAG, "Pack '%s' cached in slot %d (%u B)", o.name, victim, (unsigned)o.size);
+    return true;
+}
+
+bool AnimPackCache::download(const Offer &o, size_t i, bool &interrupted)
+{
+    interrupted = false;
+    const esp_partition_t *part = findPartition(label_);
+    if (!part)
+        return false;
+    const size_t off = region_ + i * SLOT_BYTES;
+    const size_t erase = (SLOT_HDR + o.size + SECTOR - 1) / SECTOR * SECTOR;
+    if (esp_partition_erase_range(part, off, erase) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Erase slot %u failed", (unsigned)i);
+        return false;
+    }
+
+    esp_http_client_config_t cfg = {};
+    cfg.url = o.url;
+    cfg.timeout_ms = HTTP_TIMEOUT_MS;
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+    cfg.crt_bundle_attach = esp_crt_bundle_attach;
+#endif
+    esp_http_client_handle_t http = esp_http_client_init(&cfg);
+    if (!http)
+        return false;
+
+    bool ok = false;
+    uint32_t got = 0;
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    PACK_SHA256_STARTS(&sha, 0);
+
+    do
+    {
+        if (esp_http_client_open(http, 0) != ESP_OK)
+        {
+            ESP_LOGW(TAG, "GET %s failed", o.url);
+            break;
+        }
+        const int64_t len = esp_http_client_fetch_headers(http);
+        const int status = esp_http_client_get_status_code(http);
+        if (status != 200 || (len > 0 && len != (int64_t)o.size))
+        {
+            ESP_LOGW(TAG, "Pack '%s': HTTP %d, %lld B (want %u)", o.name, status, (long long)len, (unsigned)o.size);
+            break;
+        }
+
+        uint8_t buf[CHUNK];
+        while (got < o.size)
+        {
+            // Flash writes stall the cache: stop as soon as a turn starts
+            if (!idle())
+            {
+                interrupted = true;
+                break;
+            }
+            const int n = esp_http_client_read(http, reinterpret_cast<char *>(buf),
+                                               std::min<size_t>(sizeof(buf), o.size - got));
+            if (n <= 0)
+                break;
+            if (esp_partition_write(part, off + SLOT_HDR + got, buf, n) != ESP_OK)
+                break;
+            PACK_SHA256_UPDATE(&sha, buf, n);
+            got += n;
+        }
+        if (got != o.size)
+        {
+            if (!interrupted)
+                ESP_LOGW(TAG, "Pack '%s' truncated at %u/%u B", o.name, (unsigned)got, (unsigned)o.size);
+            break;
+        }
+
+        uint8_t digest[32];
+        PACK_SHA256_FINISH(&sha, digest);
+        if (memcmp(digest, o.sha, sizeof(digest)) != 0)
+        {
+            ESP_LOGW(TAG, "Pack '%s' sha256 mismatch", o.name);
+            break;
+        }
+        ok = true;
+    } while (false);
+
+    mbedtls_sha256_free(&sha);
+    esp_http_client_close(http);
+    esp_http_client_cleanup(http);
+    if (!ok)
+        return false;
+
+    // Must parse before it becomes visible
+    {
+        AssetBundle probe;
+        if (!probe.openAt(label_, off + SLOT_HDR, o.size))
+        {
+            ESP_LOGW(TAG, "Pack '%s' is not a valid bundle", o.name);
+            return false;
+        }
+    }
+
+    uint8_t hdr[SLOT_HDR];
+    memset(hdr, 0xFF, sizeof(hdr));
+    wr32(hdr, SLOT_MAGIC);
+    wr32(hdr + 4, o.size);
+    {
+        Guard g(lock_);
+        wr32(hdr + 8, next_seq_++);
+    }
+    memset(hdr + 16, 0, PACK_NAME_MAX);
+    memcpy(hdr + 16, o.name, strnlen(o.name, PACK_NAME_MAX));
+    memcpy(hdr + 32, o.sha, 32);
+    return esp_partition_write(part, off, hdr, sizeof(hdr)) == ESP_OK;
+}
+
+// Most used packs mapped ahead of time; others unmapped to make room
+void AnimPackCache::preload()
+{
+    Guard g(lock_);
+
+    int want[MAX_MAPPED];
+    size_t n = 0;
+    bool taken[MAX_SLOTS] = {};
+    for (; n < MAX_MAPPED; n++)
+    {
+        int best = -1;
+        for (size_t i = 0; i < slot_count_; i++)
+        {
+            const Slot &s = slots_[i];
+            if (!s.valid || s.busy || taken[i])
+                continue;
+            if (best < 0 || s.uses > slots_[best].uses ||
+                (s.uses == slots_[best].uses && s.last_use > slots_[best].last_use))
+                best = (int)i;
+        }
+        if (best < 0)
+            break;
+        taken[best] = true;
+        want[n] = best;
+    }
+
+    for (size_t k = 0; k < MAX_MAPPED; k++)
+    {
+        const int owner = mapped_[k].slot;
+        if (owner >= 0 && owner != pinned_ && (!slots_[owner].valid || !taken[owner]))
+            unmapSlot(owner);
+    }
+    for (size_t j = 0; j < n; j++)
+    {
+        if (slots_[want[j]].mapped >= 0)
+            continue;
+        bool free_entry = false;
+        for (const auto &m : mapped_)
+            free_entry |= m.slot < 0;
+        if (!free_entry || mapSlot(want[j]) < 0)
+            break;
+        ESP_LOGI(TAG, "Preloaded '%s' (%u uses)", slots_[want[j]].name, (unsigned)slots_[want[j]].uses);
+    }
+}
+
+// ============================================================================
+// Use stats (NVS)
+// ============================================================================
+void AnimPackCache::loadStats()
+{
+    Persist p{};
+    size_t len = sizeof(p);
+    nvs_handle_t h;
+    if (nvs_open("animpack", NVS_READONLY, &h) != ESP_OK)
+        return;
+    const bool ok = nvs_get_blob(h, "lru", &p, &len) == ESP_OK && len == sizeof(p);
+    nvs_close(h);
+    if (!ok)
+        return;
+
+    use_clock_ = p.use_clock;
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        Slot &s = slots_[i];
+        if (s.valid && p.slots[i].seq == s.seq)
+        {
+            s.uses = p.slots[i].uses;
+            s.last_use = p.slots[i].last_use;
+        }
+    }
+}
+
+void AnimPackCache::saveStats()
+{
+    Persist p{};
+    {
+        Guard g(lock_);
+        // Halve on overflow risk: recent habits outweigh old ones
+        bool halve = false;
+        for (size_t i = 0; i < slot_count_; i++)
+            halve |= slots_[i].uses > UINT16_MAX / 2;
+        p.use_clock = use_clock_;
+        for (size_t i = 0; i < slot_count_; i++)
+        {
+            Slot &s = slots_[i];
+            if (halve)
+                s.uses /= 2;
+            if (!s.valid)
+                continue;
+            p.slots[i].seq = s.seq;
+            p.slots[i].uses = s.uses;
+            p.slots[i].last_use = s.last_use;
+        }
+        stats_dirty_ = false;
+        stats_saved_ = xTaskGetTickCount();
+    }
+
+    nvs_handle_t h;
+    if (nvs_open("animpack", NVS_READWRITE, &h) != ESP_OK)
+        return;
+    if (nvs_set_blob(h, "lru", &p, sizeof(p)) == ESP_OK)
+        nvs_commit(h);
+    nvs_close(h);
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+AnimPackCache::Stats AnimPackCache::stats() const
+{
+    if (!lock_)
+        return stats_;
+    Guard g(lock_);
+    return stats_;
+}
+
+void AnimPackCache::print() const
+{
+    if (!lock_ || slot_count_ == 0)
+    {
+        ESP_LOGI(TAG, "Packs disabled");
+        return;
+    }
+    Guard g(lock_);
+    ESP_LOGI(TAG, "%-4s %-16s %7s %5s %6s %s", "slot", "pack", "bytes", "uses", "mapped", "sha256");
+    for (size_t i = 0; i < slot_count_; i++)
+    {
+        const Slot &s = slots_[i];
+        if (!s.valid)
+            continue;
+        ESP_LOGI(TAG, "%-4u %-16s %7u %5u %6s %02x%02x%02x%02x...", (unsigned)i, s.name, (unsigned)s.bytes,
+                 (unsigned)s.uses, s.mapped >= 0 ? ((int)i == pinned_ ? "shown" : "yes") : "no", s.sha[0], s.sha[1],
+                 s.sha[2], s.sha[3]);
+    }
+    ESP_LOGI(TAG, "downloads %u (fail %u), dedup %u, flash evictions %u, unmaps %u, warm %u, cold %u",
+             (unsigned)stats_.downloads, (unsigned)stats_.download_fails, (unsigned)stats_.dedup_hits,
+             (unsigned)stats_.flash_evictions, (unsigned)stats_.map_evictions, (unsigned)stats_.warm_hits,
+             (unsigned)stats_.cold_maps);
+}
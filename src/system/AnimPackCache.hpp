@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "AssetBundle.hpp"
+#include "assets/asset_registry.hpp"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+/**
+ * AnimPackCache
+ * ============================================================================
+ * Animation pack do server đẩy (mặt mới cho ANGRY / EXCITED / CONFUSED /
+ * CALM... không cần build lại firmware). Pack = một bundle PTAB nhỏ
+ * (`scripts/convert_assets.py bundle`), tên animation trùng tên slot
+ * (asset_registry.hpp).
+ *
+ * - Server báo pack qua MQTT `<base>/cmd`:
+ *     {"cmd":"anim_pack","pack":"angry","url":"http://...","sha256":"..","size":N}
+ *   thân pack tải bằng HTTP(S) ở task nền, chỉ khi máy rảnh (IDLE).
+ * - Lưu trong phần trống sau bundle của partition "assets" (không phải
+ *   SPIFFS: SPIFFS không mmap được, còn player đọc frame thẳng từ flash).
+ *   Chia slot cố định SLOT_BYTES; mỗi slot: header 64 B (magic, size, seq,
+ *   tên, sha256) + pack. Header ghi sau cùng → slot dở dang không bao giờ
+ *   hợp lệ. Manifest = header các slot, quét lúc init().
+ * - Dedup theo sha256: pack đã có (dù tên khác) thì không tải lại; cùng tên
+ *   khác hash → bản mới, slot cũ bị vô hiệu sau khi bản mới ghi xong.
+ * - LRU hai tầng: slot flash ít dùng gần nhất bị ghi đè khi hết chỗ; tối đa
+ *   MAX_MAPPED pack được mmap + parse (AssetBundle::openAt). Số lần dùng / lần
+ *   dùng cuối nằm trong RAM, thỉnh thoảng lưu NVS lúc rảnh.
+ * - Preload: lúc rảnh, các pack dùng nhiều nhất được map sẵn, nên đổi
+ *   emotion không chờ mạng (cũng không chờ parse).
+ *
+ * DisplayManager hỏi resolve() (setEmotionSource) trên display task mỗi lần
+ * bắt đầu một emotion; pack đang phát được "pin", không bị unmap / ghi đè.
+ */
+class AnimPackCache
+{
+public:
+    static constexpr size_t SLOT_BYTES = 128 * 1024; // header + pack, 2 MMU pages
+    static constexpr size_t MAX_SLOTS = 16;
+    static constexpr size_t MAX_MAPPED = 3;
+    static constexpr size_t MAX_PENDING = 4;
+    static constexpr size_t PACK_NAME_MAX = 16;
+    static constexpr size_t URL_MAX = 160;
+
+    struct Stats
+    {
+        uint32_t downloads = 0;
+        uint32_t download_fails = 0;
+        uint32_t dedup_hits = 0;      // offers already cached
+        uint32_t flash_evictions = 0; // slots overwritten
+        uint32_t map_evictions = 0;   // packs unmapped for another
+        uint32_t warm_hits = 0;       // resolve() on a mapped pack
+        uint32_t cold_maps = 0;       // resolve() had to map first
+    };
+
+    static AnimPackCache &instance();
+
+    // Slots start after the bundle (bytes() of the opened main bundle, 0 if
+    // none) in partition `label`. Scans the slot headers, loads use stats.
+    bool init(size_t bundle_bytes, const char *label = "assets");
+    // Background fetch / preload task (TaskPlan::ASSET_FETCH).
+    bool start();
+
+    // Server announcement (MQTT); sha256 = 64 hex chars. Queued, fetched at
+    // idle. False if malformed or the queue is full.
+    bool offer(const char *name, const char *url, const char *sha256_hex, uint32_t size);
+
+    // Display task: animation of `id` from the newest pack that has it,
+    // mapped now if it was not preloaded; nullptr if no pack has it.
+    const Animation1Bit *resolve(asset::AnimId id);
+
+    size_t slotCount() const { return slot_count_; }
+    Stats stats() const;
+    // Manifest on the log (serial "packs" command).
+    void print() const;
+
+private:
+    AnimPackCache() = default;
+
+    struct Slot
+    {
+        bool valid = false;
+        bool busy = false; // being rewritten by the fetch task
+        char name[PACK_NAME_MAX + 1] = {};
+        uint8_t sha[32] = {};
+        uint32_t bytes = 0; // pack size
+        uint32_t seq = 0;   // write order (newest pack wins a slot)
+        uint32_t anims = 0; // bit per asset::AnimId the pack provides
+        uint16_t uses = 0;
+        uint32_t last_use = 0; // use clock value
+        int8_t mapped = -1;    // index in mapped_, -1 = not mapped
+    };
+
+    struct Mapped
+    {
+        AssetBundle bundle;
+        int8_t slot = -1;
+        int8_t anim_index[asset::ANIM_COUNT]; // AnimId -> bundle animation, -1 = none
+    };
+
+    struct Offer
+    {
+        bool used = false;
+        char name[PACK_NAME_MAX + 1] = {};
+        char url[URL_MAX] = {};
+        uint8_t sha[32] = {};
+        uint32_t size = 0;
+    };
+
+    static void taskEntry(void *arg);
+    void taskLoop();
+    static bool idle();
+
+    // Lock held by the callers below
+    bool readSlot(size_t i);
+    int findSha(const uint8_t sha[32]) const;
+    int packFor(asset::AnimId id) const;
+    int mapSlot(size_t i); // -> mapped_ index, -1 on failure
+    void unmapSlot(size_t i);
+    int pickVictim() const;
+    void touch(Slot &s);
+
+    bool takeOffer(Offer &out);
+    bool fetch(const Offer &o);
+    // Download into slot `i` (erased here); header written last.
+    // interrupted: the device left idle, the offer should be retried.
+    bool download(const Offer &o, size_t i, bool &interrupted);
+    void preload();
+    void loadStats();
+    void saveStats();
+
+    const char *label_ = "assets";
+    size_t region_ = 0; // partition offset of slot 0
+    size_t slot_count_ = 0;
+    Slot slots_[MAX_SLOTS];
+    Mapped mapped_[MAX_MAPPED];
+    Offer offers_[MAX_PENDING];
+    int pinned_ = -1; // slot the display task is playing from
+    uint32_t next_seq_ = 1;
+    uint32_t use_clock_ = 0;
+    bool stats_dirty_ = false;
+    TickType_t stats_saved_ = 0;
+    Stats stats_{};
+
+    SemaphoreHandle_t lock_ = nullptr;
+    TaskHandle_t task_ = nullptr;
+};
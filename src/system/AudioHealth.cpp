@@ -0,0 +1,295 @@
+#include "AudioHealth.hpp"
+
+#include <algorithm>
+
+#include "SpscRing.hpp"
+#include "esp_log.h"
+#include "esp_task_wdt.h"
+#include "esp_timer.h"
+
+static const char *TAG = "AudioHealth";
+
+namespace
+{
+    template <typename T>
+    void storeMax(std::atomic<T> &a, T v)
+    {
+        T cur = a.load(std::memory_order_relaxed);
+        while (v > cur && !a.compare_exchange_weak(cur, v, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint8_t pct(size_t used, size_t cap)
+    {
+        return cap ? static_cast<uint8_t>(std::min<size_t>(used * 100 / cap, 100)) : 0;
+    }
+} // namespace
+
+#if CONFIG_ESP_TASK_WDT
+// Task watchdog ISR (weak in ESP-IDF): count it, the TWDT prints the culprit
+extern "C" void esp_task_wdt_isr_user_handler(void)
+{
+    AudioHealth::instance().wdtHit();
+}
+#endif
+
+AudioHealth &AudioHealth::instance()
+{
+    static AudioHealth inst;
+    return inst;
+}
+
+void AudioHealth::configure(const Config &cfg, uint32_t frame_us)
+{
+    cfg_ = cfg;
+    budget_us_ = frame_us * cfg.budget_pct / 100;
+}
+
+// ============================================================================
+// Stage tasks
+// ============================================================================
+void AudioHealth::beat(Stage s)
+{
+    StageState &st = stages_[s];
+    const int64_t now = esp_timer_get_time();
+    if (st.last_beat_us)
+    {
+        const uint32_t gap_ms = static_cast<uint32_t>((now - st.last_beat_us) / 1000);
+        storeMax(st.max_gap_ms, gap_ms);
+        if (gap_ms >= cfg_.stall_ms)
+        {
+            st.stalls.fetch_add(1, std::memory_order_relaxed);
+            ESP_LOGW(TAG, "%s stalled %u ms", stageName(s), (unsigned)gap_ms);
+        }
+    }
+    else if (cfg_.task_wdt)
+    {
+        esp_task_wdt_add(nullptr); // first beat after a park
+    }
+    st.last_beat_us = now;
+    if (cfg_.task_wdt)
+        esp_task_wdt_reset();
+}
+
+void AudioHealth::park(Stage s)
+{
+    StageState &st = stages_[s];
+    if (!st.last_beat_us)
+        return;
+    st.last_beat_us = 0;
+    if (cfg_.task_wdt)
+        esp_task_wdt_delete(nullptr);
+}
+
+void AudioHealth::frameTime(Stage s, uint32_t us)
+{
+    StageState &st = stages_[s];
+    st.frames.fetch_add(1, std::memory_order_relaxed);
+    if (us > budget_us_)
+        st.over_budget.fetch_add(1, std::memory_order_relaxed);
+    storeMax(st.max_us, us);
+}
+
+void AudioHealth::underrun(Stage s, uint32_t n)
+{
+    StageState &st = stages_[s];
+    const uint16_t prev = st.consec.load(std::memory_order_relaxed);
+    if (prev == 0)
+        st.underruns.fetch_add(1, std::memory_order_relaxed);
+    const uint16_t run = static_cast<uint16_t>(std::min<uint32_t>(prev + n, UINT16_MAX));
+    st.consec.store(run, std::memory_order_relaxed);
+    st.underrun_frames.fetch_add(n, std::memory_order_relaxed);
+    storeMax(st.consec_max, run);
+}
+
+// ============================================================================
+// Monitor
+// ============================================================================
+AudioHealth::Snapshot AudioHealth::take(int64_t now_us) const
+{
+    Snapshot sn;
+    sn.t_us = now_us;
+    sn.spk_underruns = stages_[SPK].underruns.load(std::memory_order_relaxed);
+    sn.mic_drops = stages_[MIC].drops.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < STAGE_COUNT; i++)
+    {
+        sn.frames[i] = stages_[i].frames.load(std::memory_order_relaxed);
+        sn.over[i] = stages_[i].over_budget.load(std::memory_order_relaxed);
+        sn.stalls[i] = stages_[i].stalls.load(std::memory_order_relaxed);
+    }
+    sn.wdt = wdt_hits_.load(std::memory_order_relaxed);
+    return sn;
+}
+
+size_t AudioHealth::evaluate(Transition *out, size_t cap)
+{
+    if (restart_window_.exchange(false))
+        snap_n_ = 0;
+    const Snapshot now = take(esp_timer_get_time());
+
+    // Window base: newest snapshot at least WINDOW_MS old, else the oldest
+    const Snapshot *base = nullptr;
+    for (size_t k = 0; k < snap_n_; k++)
+    {
+        const Snapshot &sn = snaps_[(snap_head_ + SNAPSHOTS - 1 - k) % SNAPSHOTS];
+        base = &sn;
+        if (now.t_us - sn.t_us >= static_cast<int64_t>(WINDOW_MS) * 1000)
+            break;
+    }
+    Snapshot zero;
+    if (!base)
+        base = &zero; // first call: counts since boot
+
+    uint32_t value[SLO_COUNT] = {};
+    Stage stage[SLO_COUNT] = {SPK, MIC, ENC, MIC, MIC};
+    value[SLO_SPK_UNDERRUN] = now.spk_underruns - base->spk_underruns;
+    value[SLO_MIC_DROP] = now.mic_drops - base->mic_drops;
+    value[SLO_WDT] = now.wdt - base->wdt;
+    for (Stage s : {ENC, DEC})
+    {
+        static constexpr uint32_t MIN_FRAMES = 50; // a few frames are not a rate
+        const uint32_t frames = now.frames[s] - base->frames[s];
+        const uint32_t over = now.over[s] - base->over[s];
+        const uint32_t p = frames >= MIN_FRAMES ? over * 100 / frames : 0;
+        if (p > value[SLO_OVER_BUDGET])
+        {
+            value[SLO_OVER_BUDGET] = p;
+            stage[SLO_OVER_BUDGET] = s;
+        }
+    }
+    for (size_t i = 0; i < STAGE_COUNT; i++)
+    {
+        const uint32_t n = now.stalls[i] - base->stalls[i];
+        if (n > value[SLO_STALL])
+        {
+            value[SLO_STALL] = n;
+            stage[SLO_STALL] = static_cast<Stage>(i);
+        }
+    }
+
+    const uint32_t limit[SLO_COUNT] = {cfg_.spk_underrun_per_min, cfg_.mic_drop_per_min, cfg_.over_budget_pct, 0, 0};
+    const uint32_t prev = breach_mask_.load(std::memory_order_relaxed);
+    uint32_t mask = 0;
+    size_t n = 0;
+    for (size_t i = 0; i < SLO_COUNT; i++)
+    {
+        const bool breached = value[i] > limit[i];
+        if (breached)
+            mask |= 1u << i;
+        if (breached == ((prev >> i) & 1u))
+            continue;
+        const Slo slo = static_cast<Slo>(i);
+        if (breached)
+            ESP_LOGW(TAG, "SLO breach: %s = %u (limit %u, %s)", sloName(slo), (unsigned)value[i],
+                     (unsigned)limit[i], stageName(stage[i]));
+        else
+            ESP_LOGI(TAG, "SLO ok again: %s = %u", sloName(slo), (unsigned)value[i]);
+        if (n < cap)
+            out[n++] = Transition{slo, breached, value[i], stage[i]};
+    }
+    breach_mask_.store(mask, std::memory_order_relaxed);
+
+    snaps_[snap_head_] = now;
+    snap_head_ = (snap_head_ + 1) % SNAPSHOTS;
+    snap_n_ = std::min(snap_n_ + 1, SNAPSHOTS);
+    return n;
+}
+
+void AudioHealth::stats(StageStats out[STAGE_COUNT]) const
+{
+    for (size_t i = 0; i < STAGE_COUNT; i++)
+    {
+        const StageState &st = stages_[i];
+        StageStats &o = out[i];
+        o.frames = st.frames.load(std::memory_order_relaxed);
+        o.over_budget = st.over_budget.load(std::memory_order_relaxed);
+        o.max_us = st.max_us.load(std::memory_order_relaxed);
+        o.underruns = st.underruns.load(std::memory_order_relaxed);
+        o.underrun_frames = st.underrun_frames.load(std::memory_order_relaxed);
+        o.consec_max = st.consec_max.load(std::memory_order_relaxed);
+        o.drops = st.drops.load(std::memory_order_relaxed);
+        o.stalls = st.stalls.load(std::memory_order_relaxed);
+        o.max_gap_ms = st.max_gap_ms.load(std::memory_order_relaxed);
+        const SpscRing *rb = rings_[i];
+        o.fill_pct = rb ? pct(rb->available(), rb->capacity()) : 0;
+        o.fill_peak_pct = rb ? pct(rb->peakFill(), rb->capacity()) : 0;
+    }
+}
+
+void AudioHealth::reset()
+{
+    for (StageState &st : stages_)
+    {
+        st.frames = 0;
+        st.over_budget = 0;
+        st.max_us = 0;
+        st.underruns = 0;
+        st.underrun_frames = 0;
+        st.consec_max = 0;
+        st.drops = 0;
+        st.stalls = 0;
+        st.max_gap_ms = 0;
+    }
+    // Counters went back: the window restarts too (next evaluate())
+    restart_window_ = true;
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+const char *AudioHealth::stageName(Stage s)
+{
+    static constexpr const char *NAMES[STAGE_COUNT] = {"mic", "enc", "dec", "spk"};
+    return s < STAGE_COUNT ? NAMES[s] : "?";
+}
+
+const char *AudioHealth::sloName(Slo s)
+{
+    static constexpr const char *NAMES[SLO_COUNT] = {"spk_underrun", "mic_drop", "over_budget", "stall", "wdt"};
+    return s < SLO_COUNT ? NAMES[s] : "?";
+}
+
+void AudioHealth::writeReport(jsonlite::Writer &w) const
+{
+    StageStats st[STAGE_COUNT];
+    stats(st);
+    w.beginObject("health").field("mask", breachMask()).field("wdt", wdtHits()).field("budget_us", budget_us_);
+    for (size_t i = 0; i < STAGE_COUNT; i++)
+    {
+        const StageStats &s = st[i];
+        w.beginObject(stageName(static_cast<Stage>(i)));
+        if (s.frames)
+            w.field("frames", s.frames).field("over", s.over_budget).field("max_us", s.max_us);
+        if (s.underruns)
+            w.field("ur", s.underruns).field("ur_frames", s.underrun_frames).field("ur_run", static_cast<uint32_t>(s.consec_max));
+        if (s.drops)
+            w.field("drop", s.drops);
+        w.field("stall", s.stalls).field("gap_ms", s.max_gap_ms);
+        if (rings_[i])
+            w.field("fill", static_cast<uint32_t>(s.fill_pct)).field("fill_peak", static_cast<uint32_t>(s.fill_peak_pct));
+        w.endObject();
+    }
+    w.endObject();
+}
+
+void AudioHealth::print() const
+{
+    StageStats st[STAGE_COUNT];
+    stats(st);
+    ESP_LOGI(TAG, "%-4s %7s %6s %7s %5s %6s %4s %5s %6s %5s", "", "frames", "over", "max us", "ur", "ur run", "drop",
+             "stall", "gap ms", "fill");
+    for (size_t i = 0; i < STAGE_COUNT; i++)
+    {
+        const StageStats &s = st[i];
+        ESP_LOGI(TAG, "%-4s %7u %6u %7u %5u %6u %4u %5u %6u %2u/%2u%%", stageName(static_cast<Stage>(i)),
+                 (unsigned)s.frames, (unsigned)s.over_budget, (unsigned)s.max_us, (unsigned)s.underruns,
+                 (unsigned)s.consec_max, (unsigned)s.drops, (unsigned)s.stalls, (unsigned)s.max_gap_ms,
+                 (unsigned)s.fill_pct, (unsigned)s.fill_peak_pct);
+    }
+    const uint32_t mask = breachMask();
+    ESP_LOGI(TAG, "budget %u us/frame, task WDT %s (%u hit(s))", (unsigned)budget_us_, cfg_.task_wdt ? "on" : "off",
+             (unsigned)wdtHits());
+    for (size_t i = 0; i < SLO_COUNT; i++)
+        ESP_LOGI(TAG, "SLO %-12s %s", sloName(static_cast<Slo>(i)), (mask >> i) & 1u ? "BREACHED" : "ok");
+}
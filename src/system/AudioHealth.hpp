@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "JsonLite.hpp"
+
+class SpscRing;
+
+/**
+ * AudioHealth
+ * ============================================================================
+ * Theo dõi sức khỏe từng stage của pipeline audio (mic → encoder, decoder →
+ * speaker) thay cho các log debug rời rạc ("Ring full! Dropped", timeout_count
+ * của speaker):
+ *  - beat(): mỗi vòng lặp của stage đang chạy. Khoảng cách giữa hai beat vượt
+ *    stall_ms = stall (task bị chặn / đói CPU); đồng thời feed task watchdog
+ *    (task chỉ đăng ký TWDT khi đang chạy, park() gỡ ra trước khi ngủ chờ
+ *    state, nên task rảnh không bị báo oan).
+ *  - frameTime(): thời gian xử lý một frame so với budget (budget_pct % của
+ *    thời lượng frame) — encoder (AEC + NS/AGC + VAD + encode), decoder.
+ *  - underrun() / flowing(): stage tiêu thụ thấy input rỗng (đếm episode và
+ *    chuỗi frame liên tiếp dài nhất); drop(): stage sản xuất thấy output đầy.
+ *  - watchRing(): ring input của stage; mức đầy hiện tại / đỉnh đọc thẳng từ
+ *    SpscRing lúc báo cáo (cùng nguồn với MemTelemetry).
+ * Ghi: chỉ task sở hữu stage ghi stage đó (atomic relaxed, không khóa).
+ *
+ * evaluate() (network loop, ~10 s) so các bộ đếm trong cửa sổ 60 s với SLO
+ * (vd speaker underrun > 3 / phút) và trả về các lần chuyển breach / hồi phục
+ * (edge-triggered): NetworkManager ghi chúng vào EventLog và đưa breachMask()
+ * vào telemetry ("slo").
+ */
+class AudioHealth
+{
+public:
+    enum Stage : uint8_t
+    {
+        MIC, // I2S read → rb_mic_pcm
+        ENC, // rb_mic_pcm → AEC / NS / VAD / encode
+        DEC, // rb_spk_encoded → decode / PLC / resample → rb_spk_pcm
+        SPK, // rb_spk_pcm → I2S write
+        STAGE_COUNT
+    };
+
+    enum Slo : uint8_t
+    {
+        SLO_SPK_UNDERRUN, // speaker underrun episodes per minute
+        SLO_MIC_DROP,     // mic frames dropped (ring full / I2S overrun) per minute
+        SLO_OVER_BUDGET,  // % of encoder / decoder frames over budget
+        SLO_STALL,        // any active stage silent for stall_ms
+        SLO_WDT,          // task watchdog fired (any subscribed task)
+        SLO_COUNT
+    };
+
+    struct Config
+    {
+        uint16_t spk_underrun_per_min = 3;
+        uint16_t mic_drop_per_min = 3;
+        uint8_t budget_pct = 80;      // frame budget = this % of the frame duration
+        uint8_t over_budget_pct = 5;  // SLO: more frames than this % over budget
+        uint32_t stall_ms = 1000;     // longest designed wait is ~100-400 ms
+        bool task_wdt = true;         // subscribe active stages to the task watchdog
+    };
+
+    struct StageStats
+    {
+        uint32_t frames = 0;      // frameTime() samples
+        uint32_t over_budget = 0;
+        uint32_t max_us = 0;
+        uint32_t underruns = 0;   // episodes (input found empty)
+        uint32_t underrun_frames = 0;
+        uint16_t consec_max = 0;  // longest run of underrun frames
+        uint32_t drops = 0;       // output found full
+        uint32_t stalls = 0;
+        uint32_t max_gap_ms = 0;  // longest gap between beats while active
+        uint8_t fill_pct = 0;     // input ring now / peak (watchRing())
+        uint8_t fill_peak_pct = 0;
+    };
+
+    // One breach / recovery since the previous evaluate()
+    struct Transition
+    {
+        Slo slo;
+        bool breached;  // false: back within the SLO
+        uint32_t value; // measured over the window (count, or % for OVER_BUDGET)
+        Stage stage;    // worst stage (OVER_BUDGET / STALL), else the SLO's own
+    };
+
+    static constexpr uint32_t WINDOW_MS = 60000;
+
+    static AudioHealth &instance();
+
+    // frame_us: duration of one PCM frame (budget base)
+    void configure(const Config &cfg, uint32_t frame_us);
+    const Config &config() const { return cfg_; }
+    // Input ring of a stage (fill levels in stats / reports); must outlive us
+    void watchRing(Stage s, const SpscRing *rb) { rings_[s] = rb; }
+
+    // ---- stage tasks (hot path) ----
+    void beat(Stage s);
+    void park(Stage s);
+    void frameTime(Stage s, uint32_t us);
+    void underrun(Stage s, uint32_t n = 1);
+    void flowing(Stage s) { stages_[s].consec.store(0, std::memory_order_relaxed); }
+    void drop(Stage s, uint32_t n = 1) { stages_[s].drops.fetch_add(n, std::memory_order_relaxed); }
+    // Task watchdog ISR hook
+    void wdtHit() { wdt_hits_.fetch_add(1, std::memory_order_relaxed); }
+
+    // ---- monitor (network loop) ----
+    // Breach / recovery transitions; returns how many were written to out
+    size_t evaluate(Transition *out, size_t cap);
+    // Bit n set: Slo n currently breached
+    uint32_t breachMask() const { return breach_mask_.load(std::memory_order_relaxed); }
+
+    void stats(StageStats out[STAGE_COUNT]) const;
+    uint32_t wdtHits() const { return wdt_hits_.load(std::memory_order_relaxed); }
+    // "health":{"mask":..,"wdt":..,"<stage>":{...}} (request_cpu)
+    void writeReport(jsonlite::Writer &w) const;
+    // Per-stage table + SLO state (serial "slo")
+    void print() const;
+    void reset();
+
+    static const char *stageName(Stage s);
+    static const char *sloName(Slo s);
+
+private:
+    AudioHealth() = default;
+
+    struct StageState
+    {
+        std::atomic<uint32_t> frames{0};
+        std::atomic<uint32_t> over_budget{0};
+        std::atomic<uint32_t> max_us{0};
+        std::atomic<uint32_t> underruns{0};
+        std::atomic<uint32_t> underrun_frames{0};
+        std::atomic<uint16_t> consec{0};
+        std::atomic<uint16_t> consec_max{0};
+        std::atomic<uint32_t> drops{0};
+        std::atomic<uint32_t> stalls{0};
+        std::atomic<uint32_t> max_gap_ms{0};
+        // Owner task only
+        int64_t last_beat_us = 0; // 0 = parked
+    };
+
+    // Counter totals at one evaluate() (window base)
+    struct Snapshot
+    {
+        int64_t t_us = 0;
+        uint32_t spk_underruns = 0;
+        uint32_t mic_drops = 0;
+        uint32_t frames[STAGE_COUNT] = {};
+        uint32_t over[STAGE_COUNT] = {};
+        uint32_t stalls[STAGE_COUNT] = {};
+        uint32_t wdt = 0;
+    };
+    static constexpr size_t SNAPSHOTS = 8; // >= WINDOW_MS / evaluate period + 1
+
+    Snapshot take(int64_t now_us) const;
+
+    Config cfg_{};
+    uint32_t budget_us_ = 16000 * 80 / 100;
+    StageState stages_[STAGE_COUNT];
+    const SpscRing *rings_[STAGE_COUNT] = {};
+    std::atomic<uint32_t> wdt_hits_{0};
+    std::atomic<uint32_t> breach_mask_{0};
+    std::atomic<bool> restart_window_{false}; // reset() from the console task
+
+    // Monitor side (evaluate() caller only)
+    Snapshot snaps_[SNAPSHOTS];
+    size_t snap_head_ = 0;
+    size_t snap_n_ = 0;
+};
@@ -3,13 +3,56 @@
 #include "AudioInput.hpp"
 #include "AudioOutput.hpp"
 #include "AudioCodec.hpp"
+#include "system/AudioHealth.hpp"
+#include "system/LatencyTrace.hpp"
+#include "system/MemArena.hpp"
+#include "system/MemTelemetry.hpp"
+#include "system/Profiler.hpp"
+#include "system/TaskPlan.hpp"
 #include "esp_wifi.h"
 
 #include "esp_log.h"
+#include "esp_timer.h"
 #include <cstring>
+#include <algorithm>
+#include <new>
 
 static const char *TAG = "AudioManager";
 
+// Ring sizes and the largest single acquire on each ring.
+// PCM rings only ever move whole int16 samples, so views stay 2-byte aligned.
+static constexpr size_t MIC_PCM_RING_BYTES = 4 * 1024;
+static constexpr size_t MIC_ENC_RING_BYTES = 32 * 1024;
+static constexpr size_t SPK_PCM_RING_BYTES = 8 * 1024;
+static constexpr size_t SPK_ENC_RING_BYTES = 16 * 1024; // Larger for jitter tolerance
+static constexpr size_t MEDIA_PCM_RING_BYTES = 8 * 1024; // media decode → speaker (compressed prebuffer is in MediaPlayer)
+
+// Frame sizes come from the codec hints (see applyCodecLayout()).
+static constexpr size_t MAX_FRAME_SAMPLES = 480;  // 30 ms @16kHz upper bound
+static constexpr size_t UPLINK_CHUNK = 1024;      // Uplink packet payload ≤ this in one view (80 ms ADPCM)
+static constexpr size_t FRAME_HDR = 2;            // [u16 LE len] for variable-size packets
+static constexpr int MAX_CONCEAL_FRAMES = 4;      // fade-out repeats on underrun
+static constexpr uint32_t PREROLL_MS = 240;       // kept ahead of VAD onset / after a wake word
+static constexpr size_t KWS_RING_BYTES = 4 * 1024; // ~250 ms of 8 kHz PCM for the KWS task
+static constexpr size_t AEC_REF_RING_BYTES = 4 * 1024; // speaker reference skew between tasks
+static constexpr uint32_t MAX_RESAMPLE_UP = 2;    // speaker rate / downlink rate bound
+static constexpr size_t MIN_PLAYOUT_BYTES = 64;   // incremental playout: smallest I2S write (32 samples)
+static constexpr uint32_t PREWARM_MAX_MS = 5000;  // pre-warmed I2S idles at most this long
+static constexpr uint16_t DL_CONCEAL_MAX_FRAMES = 6; // longer downlink gaps are skipped, not filled
+static constexpr uint32_t DL_TS_SANE_MS = 5000;   // larger timestamp steps are not trusted for gap size
+static constexpr int32_t MEDIA_RAMP_Q8 = 32;       // media duck / unduck: gain step per frame (~130 ms fade)
+
+static uint32_t nowMs() { return static_cast<uint32_t>(esp_timer_get_time() / 1000); }
+
+// Ring storage from the boot arena (a re-layout gets the same block back);
+// the heap only when the audio budget is exhausted
+static bool allocRing(SpscRing &rb, const char *tag, size_t capacity, size_t max_chunk)
+{
+    void *mem = MemArena::instance().claim(MemArena::AUDIO, tag, SpscRing::storageBytes(capacity, max_chunk));
+    return mem ? rb.allocate(capacity, max_chunk, static_cast<uint8_t *>(mem))
+               : rb.allocate(capacity, max_chunk);
+}
+
 // ============================================================================
 // Constructor / Destructor
 // ============================================================================
@@ -18,7 +61,9 @@ AudioManager::AudioManager() = default;
 AudioManager::~AudioManager()
 {
     stop();
-    // Stream buffers cleanup via xStreamBufferDelete if created
+    if (wake_evt_)
+        vEventGroupDelete(wake_evt_);
+    // Ring storage is released by SpscRing destructors
 }
 
 // ============================================================================
@@ -39,9 +84,20 @@ void AudioManager::setCodec(std::unique_ptr<AudioCodec> cdc)
     codec = std::move(cdc);
 }
 
+void AudioManager::setWakeWordModel(std::unique_ptr<KeywordModel> model)
+{
+    kws_model_ = std::move(model);
+}
+
+void AudioManager::setCommandModel(std::unique_ptr<CommandModel> model)
+{
+    cmd_model_ = std::move(model);
+}
+
 void AudioManager::setVolume(uint8_t percent)
 {
     if (percent > 100) percent = 100;
+    volume_percent_ = percent;
     if (output)
     {
         output->setVolume(percent);
@@ -49,6 +105,111 @@ void AudioManager::setVolume(uint8_t percent)
     }
 }
 
+size_t AudioManager::pushDownlink(const uint8_t *data, size_t len, bool packet_end)
+{
+    if (!data || len == 0)
+        return 0;
+    size_t written = rb_spk_encoded.write(data, len, pdMS_TO_TICKS(100));
+    dl_packet_bytes_ += written;
+    if (written > 0 && dl_first_rx_ms_ == 0)
+        dl_first_rx_ms_ = nowMs();
+    if (packet_end && dl_packet_bytes_ > 0)
+    {
+        jitter_.onArrival(dl_packet_bytes_);
+        dl_packet_bytes_ = 0;
+    }
+    return written;
+}
+
+bool AudioManager::beginDownlinkPacket(const audio_packet::Header &h)
+{
+    if (!codec || h.codec != audio_packet::codecId(codec->name()))
+    {
+        ESP_LOGW(TAG, "Downlink: codec id %u not supported (using %s), packet dropped",
+                 (unsigned)h.codec, codecName());
+        return false;
+    }
+
+    if (!dl_have_session_ || h.session != dl_session_)
+    {
+        ESP_LOGI(TAG, "Downlink: session %u", (unsigned)h.session);
+        dl_have_session_ = true;
+        dl_session_ = h.session;
+        dl_next_seq_ = h.seq;
+        dl_have_ts_ = false;
+    }
+
+    const uint16_t ahead = static_cast<uint16_t>(h.seq - dl_next_seq_);
+    if (ahead >= 0x8000)
+    {
+        // Behind the expected seq: duplicate or stale
+        ESP_LOGW(TAG, "Downlink: late packet seq %u (expected %u), dropped",
+                 (unsigned)h.seq, (unsigned)dl_next_seq_);
+        return false;
+    }
+    uint16_t lost_frames = 0;
+    if (ahead > 0)
+    {
+        dl_lost_packets_ += ahead;
+
+        // Missing audio from the timestamps, packets assumed equally long:
+        // the step since the last packet covers it plus `ahead` lost ones.
+        // One frame per packet without usable timestamps.
+        uint32_t frames = ahead;
+        const uint32_t step_ms = h.timestamp_ms - dl_last_ts_;
+        const uint32_t rate = downlinkSampleRate();
+        if (dl_have_ts_ && step_ms > 0 && step_ms < DL_TS_SANE_MS && rate > 0)
+        {
+            const uint32_t gap_ms = step_ms * ahead / (ahead + 1u);
+            const uint32_t frame_units = static_cast<uint32_t>(pcm_frame_samples_) * 1000;
+            frames = (gap_ms * rate + frame_units / 2) / frame_units;
+        }
+        lost_frames = static_cast<uint16_t>(std::min<uint32_t>(frames, DL_CONCEAL_MAX_FRAMES));
+        ESP_LOGW(TAG, "Downlink: %u packet(s) lost before seq %u, concealing %u frame(s)",
+                 (unsigned)ahead, (unsigned)h.seq, (unsigned)lost_frames);
+    }
+
+    const bool sync = (h.flags & audio_packet::FLAG_SYNC) != 0;
+    if (lost_frames > 0 || sync)
+    {
+        // Payload starts at the current write position
+        const uint32_t head = dl_mark_head_.load(std::memory_order_relaxed);
+        if (head - dl_mark_tail_.load(std::memory_order_acquire) < DL_MARKS)
+        {
+            dl_marks_[head % DL_MARKS] = DlMark{rb_spk_encoded.writePosition(), lost_frames, sync,
+                                                h.sync_index, h.sync_predictor};
+            dl_mark_head_.store(head + 1, std::memory_order_release);
+        }
+        else if (lost_frames > 0)
+        {
+            // Sync-only marks are just skipped: the decoder keeps its own state
+            ESP_LOGW(TAG, "Downlink: mark queue full, gap not concealed");
+        }
+    }
+
+    dl_last_ts_ = h.timestamp_ms;
+    dl_have_ts_ = true;
+    dl_next_seq_ = static_cast<uint16_t>(h.seq + 1);
+    dl_eou_ = (h.flags & audio_packet::FLAG_EOU) != 0;
+    return true;
+}
+
+const char *AudioManager::codecName() const
+{
+    return codec ? codec->name() : "none";
+}
+
+uint32_t AudioManager::downlinkSampleRate() const
+{
+    uint32_t hz = downlink_rate_;
+    return hz ? hz : (codec ? codec->sampleRate() : 0);
+}
+
+uint32_t AudioManager::outputSampleRate() const
+{
+    return output ? output->sampleRate() : 0;
+}
+
 // ============================================================================
 // Init / Start / Stop
 // ============================================================================
@@ -62,35 +223,130 @@ bool AudioManager::init()
         return false;
     }
 
+    if (!wake_evt_)
+        wake_evt_ = xEventGroupCreate();
+    if (!wake_evt_)
+    {
+        ESP_LOGE(TAG, "Failed to create wake event group");
+        return false;
+    }
+
     if (!input->init())
     {
         ESP_LOGE(TAG, "Failed to init Audio Input hardware");
         return false;
     }
 
+    if (!applyCodecLayout())
+        return false;
+
     // -------------------------------
-    // Stream buffers (FreeRTOS - thread-safe, no race conditions)
+    // SPSC rings (lock-free, task-notification wake-ups)
     // -------------------------------
-    sb_mic_pcm = xStreamBufferCreate(
-        4 * 1024, // Buffer size
-        1         // Trigger level (1 byte to unblock reader)
-    );
-    sb_mic_encoded = xStreamBufferCreate(
-        32 * 1024,
-        1);
-    sb_spk_pcm = xStreamBufferCreate(
-        8 * 1024,
-        1);
-    sb_spk_encoded = xStreamBufferCreate(
-        16 * 1024, // Increased for better jitter tolerance
-        1);
-
-    if (!sb_mic_pcm || !sb_mic_encoded || !sb_spk_pcm || !sb_spk_encoded)
-    {
-        ESP_LOGE(TAG, "Failed to create stream buffers");
+    if (!allocateResources())
+    {
+        ESP_LOGE(TAG, "Failed to create audio rings");
         return false;
     }
 
+    // -------------------------------
+    // Downlink jitter buffer, sized in the codec's encoded byte rate
+    // -------------------------------
+    JitterBuffer::Config jb_cfg;
+    jb_cfg.bytes_per_ms = std::max<uint32_t>(1,
+        codec->sampleRate() * enc_frame_bytes_ / (pcm_frame_samples_ * 1000));
+    if (low_latency_)
+    {
+        // Start on the first decodable frame; underruns still grow the delay
+        jb_cfg.start_delay_ms = frame_ms_;
+        jb_cfg.min_delay_ms = frame_ms_;
+    }
+    jitter_.configure(jb_cfg);
+
+    // -------------------------------
+    // Uplink VAD, in codec frames
+    // -------------------------------
+    VoiceActivityDetector::Config vad_cfg;
+    vad_cfg.frame_ms = frame_ms_;
+    vad_.configure(vad_cfg);
+
+    // -------------------------------
+    // Echo canceller (full duplex only)
+    // -------------------------------
+    if (full_duplex_ && output->sampleRate() != input->sampleRate())
+    {
+        // The speaker feed is the AEC reference; it must share the mic clock
+        ESP_LOGW(TAG, "Speaker %u Hz != mic %u Hz, staying half duplex",
+                 (unsigned)output->sampleRate(), (unsigned)input->sampleRate());
+        full_duplex_ = false;
+        rb_aec_ref.deallocate();
+    }
+    if (full_duplex_)
+    {
+        EchoCanceller::Config aec_cfg;
+        aec_cfg.sample_rate = codec->sampleRate();
+        aec_cfg.max_block = static_cast<uint16_t>(pcm_frame_samples_);
+        if (output->queueDelayMs() > 0)
+            aec_cfg.bulk_delay_ms = static_cast<uint16_t>(output->queueDelayMs() + 8); // + one mic DMA block
+        // Room for the speaking preset's queue (applied when playback starts)
+        aec_cfg.max_bulk_delay_ms = static_cast<uint16_t>(
+            dmaGeometry(dma_presets_.speaking).delayMs(output->sampleRate()) + 8);
+        aec_queue_ms_ = output->queueDelayMs();
+        spk_queue_ms_ = aec_queue_ms_;
+        if (!rb_aec_ref.valid() || !aec_.init(aec_cfg))
+        {
+            ESP_LOGW(TAG, "AEC unavailable, staying half duplex");
+            full_duplex_ = false;
+            rb_aec_ref.deallocate();
+        }
+    }
+
+    // -------------------------------
+    // Uplink NS + AGC (stays off if it can't allocate)
+    // -------------------------------
+    VoiceFrontEnd::Config fe_cfg;
+    fe_cfg.sample_rate = input->sampleRate();
+    fe_cfg.max_block = static_cast<uint16_t>(pcm_frame_samples_);
+    if (!front_end_.init(fe_cfg))
+        ESP_LOGW(TAG, "Uplink NS / AGC unavailable, sending raw mic audio");
+
+    // -------------------------------
+    // Uplink rate levels (NetworkManager steps down on a congested link)
+    // -------------------------------
+    buildUplinkLevels();
+
+    // -------------------------------
+    // Earcons: built-in tones at the speaker rate (bundle sounds via
+    // loadEarconBundle())
+    // -------------------------------
+    earcons_.init(output->sampleRate());
+
+    // -------------------------------
+    // Wake word / voice commands (optional): decimated mic copy, one 8 kHz
+    // MFCC front-end for both models
+    // -------------------------------
+    if (kws_model_ || cmd_model_)
+    {
+        kws_decim_ = input->sampleRate() >= 16000 ? 2 : 1;
+        KeywordSpotter::Config kws_cfg;
+        kws_cfg.sample_rate = input->sampleRate() / kws_decim_;
+        KeywordModel *front_model = kws_model_ ? kws_model_.get() : cmd_model_.get();
+        if (!rb_kws_pcm.valid() || !kws_.init(kws_cfg, front_model))
+        {
+            ESP_LOGW(TAG, "Wake word / voice commands disabled (KWS init failed)");
+            kws_model_.reset();
+            cmd_model_.reset();
+            rb_kws_pcm.deallocate();
+        }
+        else if (cmd_model_ && !cmd_.init(CommandRecognizer::Config{}, cmd_model_.get(), kws_))
+        {
+            ESP_LOGW(TAG, "Voice commands disabled (model / front-end mismatch)");
+            cmd_model_.reset();
+        }
+    }
+
+    busy_pm_.create(ESP_PM_CPU_FREQ_MAX, "audio_busy");
+
     // -------------------------------
     // Subscribe InteractionState
     // -------------------------------
@@ -100,6 +356,39 @@ bool AudioManager::init()
             {
                 this->handleInteractionState(s, src);
             });
+    // Cues for states owned by other managers
+    sub_system_id =
+        StateManager::instance().subscribeSystem(
+            [this](state::SystemState s)
+            {
+                if (s == state::SystemState::ERROR)
+                    playEarcon(Earcon::ERROR);
+            });
+    sub_power_id =
+        StateManager::instance().subscribePower(
+            [this](state::PowerState s)
+            {
+                if (s == state::PowerState::CRITICAL)
+                    playEarcon(Earcon::LOW_BATTERY);
+            });
+
+    // Ring fill telemetry; rings are members, so the pointers stay valid
+    // across re-allocation (an unallocated ring reports capacity 0)
+    auto &mem = MemTelemetry::instance();
+    mem.registerRing("mic_pcm", &rb_mic_pcm);
+    mem.registerRing("mic_enc", &rb_mic_encoded);
+    mem.registerRing("spk_pcm", &rb_spk_pcm);
+    mem.registerRing("spk_enc", &rb_spk_encoded);
+    mem.registerRing("kws_pcm", &rb_kws_pcm);
+    mem.registerRing("aec_ref", &rb_aec_ref);
+    mem.registerRing("media_pcm", &rb_media_pcm);
+
+    // Stage health: frame budget from the codec frame, input ring per stage
+    auto &health = AudioHealth::instance();
+    health.configure(health.config(), static_cast<uint32_t>(uint64_t(pcm_frame_samples_) * 1000000 / codec->sampleRate()));
+    health.watchRing(AudioHealth::ENC, &rb_mic_pcm);
+    health.watchRing(AudioHealth::DEC, &rb_spk_encoded);
+    health.watchRing(AudioHealth::SPK, &rb_spk_pcm);
 
     ESP_LOGI(TAG, "AudioManager init OK");
     return true;
@@ -113,44 +402,27 @@ void AudioManager::start()
 
     ESP_LOGI(TAG, "start()");
 
-    // -------------------------------
-    // Create MIC task
-    // -------------------------------
-    xTaskCreatePinnedToCore(
-        &AudioManager::micTaskEntry,
-        "AudioMicTask",
-        4096,
-        this,
-        6,
-        &mic_task,
-        1 // Core 0
-    );
-
-    // -------------------------------
-    // Create CODEC task (decodes ADPCM to PCM)
-    // -------------------------------
-    xTaskCreatePinnedToCore(
-        &AudioManager::codecTaskEntry,
-        "AudioCodecTask",
-        8192, // Stack for codec operations
-        this,
-        5, // Priority 5 - between mic and speaker
-        &codec_task,
-        1 // Core 0 with mic task
-    );
+    // Core / priority / stack from the task plan (DeviceProfile): the three
+    // real-time tasks share core 1 away from Wi-Fi, speaker first
+    auto &plan = TaskPlan::instance();
+    plan.spawn(TaskPlan::AUDIO_MIC, &AudioManager::micTaskEntry, this, &mic_task);
+    // Uplink encode and downlink decode run independently; the codec sets
+    // each stack floor
+    plan.spawn(TaskPlan::AUDIO_ENC, &AudioManager::encTaskEntry, this, &enc_task,
+               codec->encoderStackBytes());
+    plan.spawn(TaskPlan::AUDIO_DEC, &AudioManager::decTaskEntry, this, &dec_task,
+               codec->decoderStackBytes());
+    plan.spawn(TaskPlan::AUDIO_SPK, &AudioManager::spkTaskEntry, this, &spk_task);
+
+    // KWS task only with a wake-word / command model. KeywordSpotter bounds
+    // its CPU share.
+    if (kws_.ready())
+    {
+        plan.spawn(TaskPlan::AUDIO_KWS, &AudioManager::kwsTaskEntry, this, &kws_task);
 
-    // -------------------------------
-    // Create SPEAKER task (lower priority to not starve WiFi)
-    // -------------------------------
-    xTaskCreatePinnedToCore(
-        &AudioManager::spkTaskEntry,
-        "AudioSpkTask",
-        4096, // Reduced stack - no longer doing decode
-        this,
-        6, // Priority 6 - below WiFi task (prio 23) to prevent beacon timeout
-        &spk_task,
-        1 // Core 1 for smooth playback
-    );
+        if (StateManager::instance().getInteractionState() == state::InteractionState::IDLE)
+            armWakeWord(true);
+    }
 }
 
 void AudioManager::stop()
@@ -161,7 +433,10 @@ void AudioManager::stop()
 
     ESP_LOGW(TAG, "stop()");
 
+    armWakeWord(false);
+    armCommands(false);
     stopAll();
+    wakeTasks(); // parked tasks see started == false and exit
 
     // ✅ Allow tasks to exit themselves (they check `started` and self-delete)
     // Wait up to 1s for both tasks to terminate; then force delete as fallback.
@@ -180,29 +455,81 @@ void AudioManager::stop()
         if (eTaskGetState(th) != eDeleted)
         {
             ESP_LOGW(TAG, "Audio task did not exit; force deleting");
+            MemTelemetry::instance().unregisterTask(th);
             vTaskDelete(th);
         }
         th = nullptr;
     };
 
     waitForExit(mic_task);
-    waitForExit(codec_task);
+    waitForExit(enc_task);
+    waitForExit(dec_task);
     waitForExit(spk_task);
+    waitForExit(kws_task);
+}
+
+bool AudioManager::applyCodecLayout()
+{
+    if (!codec)
+        return false;
+
+    pcm_frame_samples_ = codec->pcmFrameSamples();
+    framed_ = codec->variableFrameSize();
+    enc_frame_bytes_ = codec->encodedFrameBytes();
+    enc_frame_max_ = codec->maxEncodedFrameBytes();
+
+    if (pcm_frame_samples_ == 0 || pcm_frame_samples_ > MAX_FRAME_SAMPLES ||
+        enc_frame_bytes_ == 0 || enc_frame_max_ + FRAME_HDR > UPLINK_CHUNK)
+    {
+        ESP_LOGE(TAG, "Unsupported codec frame layout (%u samples, %u/%u bytes)",
+                 (unsigned)pcm_frame_samples_, (unsigned)enc_frame_bytes_, (unsigned)enc_frame_max_);
+        return false;
+    }
+
+    frame_ms_ = static_cast<uint32_t>(pcm_frame_samples_ * 1000 / codec->sampleRate());
+    ESP_LOGI(TAG, "Codec %s: %u samples (%u ms)/frame, %s packets",
+             codec->name(), (unsigned)pcm_frame_samples_, (unsigned)frame_ms_,
+             framed_ ? "length-prefixed" : "fixed");
+    return true;
 }
 
 bool AudioManager::allocateResources()
 {
-    if (sb_mic_pcm != nullptr)
+    if (!preroll_)
+    {
+        preroll_frames_ = std::max<size_t>(1, PREROLL_MS / std::max<uint32_t>(frame_ms_, 1));
+        preroll_.reset(new (std::nothrow) int16_t[preroll_frames_ * pcm_frame_samples_]);
+        preroll_head_ = 0;
+        preroll_count_ = 0;
+        if (!preroll_)
+            ESP_LOGW(TAG, "No RAM for VAD pre-roll, onset may clip");
+    }
+
+    if ((kws_model_ || cmd_model_) && !rb_kws_pcm.valid() &&
+        !allocRing(rb_kws_pcm, "kws_pcm", KWS_RING_BYTES, pcm_frame_samples_ * sizeof(int16_t)))
+        ESP_LOGW(TAG, "No RAM for KWS ring, wake word off");
+
+    if (full_duplex_ && !rb_aec_ref.valid() &&
+        !allocRing(rb_aec_ref, "aec_ref", AEC_REF_RING_BYTES, pcm_frame_samples_ * sizeof(int16_t)))
+        ESP_LOGW(TAG, "No RAM for AEC reference ring");
+
+    if (rb_mic_pcm.valid() && rb_mic_encoded.valid() &&
+        rb_spk_pcm.valid() && rb_spk_encoded.valid())
         return true; // Already allocated
 
-    ESP_LOGW(TAG, "Allocating Audio Stream Buffers...");
+    ESP_LOGW(TAG, "Allocating Audio Rings...");
 
-    sb_mic_pcm = xStreamBufferCreate(4 * 1024, 1);
-    sb_mic_encoded = xStreamBufferCreate(32 * 1024, 1);
-    sb_spk_pcm = xStreamBufferCreate(8 * 1024, 1);
-    sb_spk_encoded = xStreamBufferCreate(16 * 1024, 1);
+    const size_t pcm_frame_bytes = pcm_frame_samples_ * sizeof(int16_t);
+    const size_t enc_view = framed_ ? enc_frame_max_ + FRAME_HDR : enc_frame_bytes_;
+    // One resampled frame at up to MAX_RESAMPLE_UP x, plus filter look-ahead
+    const size_t spk_view = (MAX_RESAMPLE_UP * (pcm_frame_samples_ + PolyphaseResampler::TAPS) + 2) * sizeof(int16_t);
 
-    if (!sb_mic_pcm || !sb_mic_encoded || !sb_spk_pcm || !sb_spk_encoded)
+    bool ok = allocRing(rb_mic_pcm, "mic_pcm", MIC_PCM_RING_BYTES, pcm_frame_bytes);
+    ok = allocRing(rb_mic_encoded, "mic_enc", MIC_ENC_RING_BYTES, UPLINK_CHUNK) && ok;
+    ok = allocRing(rb_spk_pcm, "spk_pcm", SPK_PCM_RING_BYTES, spk_view) && ok;
+    ok = allocRing(rb_spk_encoded, "spk_enc", SPK_ENC_RING_BYTES, enc_view) && ok;
+
+    if (!ok)
     {
         ESP_LOGE(TAG, "Failed to allocate audio buffers - OUT OF RAM!");
         return false;
@@ -213,26 +540,22 @@ bool AudioManager::allocateResources()
 void AudioManager::freeResources()
 {
     stop();
-    if (sb_mic_pcm)
-    {
-        vStreamBufferDelete(sb_mic_pcm);
-        sb_mic_pcm = nullptr;
-    }
-    if (sb_mic_encoded)
-    {
-        vStreamBufferDelete(sb_mic_encoded);
-        sb_mic_encoded = nullptr;
-    }
-    if (sb_spk_pcm)
-    {
-        vStreamBufferDelete(sb_spk_pcm);
-        sb_spk_pcm = nullptr;
-    }
-    if (sb_spk_encoded)
-    {
-        vStreamBufferDelete(sb_spk_encoded);
-        sb_spk_encoded = nullptr;
-    }
+    rb_mic_pcm.deallocate();
+    rb_mic_encoded.deallocate();
+    rb_spk_pcm.deallocate();
+    rb_spk_encoded.deallocate();
+    rb_kws_pcm.deallocate();
+    rb_aec_ref.deallocate();
+    media_active_ = false;
+    rb_media_pcm.deallocate(); // MediaPlayer is stopped first
+    resampler_.deinit();
+    dl_pcm_.reset();
+    dl_rate_active_ = 0;
+    ul_decim_.deinit();
+    ul_half_pcm_.reset();
+    ul_level_count_ = 1;
+    preroll_.reset();
+    preroll_count_ = 0;
     ESP_LOGI(TAG, "AudioManager resources freed");
 }
 
@@ -242,26 +565,51 @@ void AudioManager::freeResources()
 void AudioManager::handleInteractionState(state::InteractionState s,
                                           state::InputSource src)
 {
+    if (s != state::InteractionState::LISTENING)
+        armCommands(false);
+    // Media keeps playing under a turn, quieter
+    media_ducked_ = s == state::InteractionState::LISTENING || s == state::InteractionState::PROCESSING ||
+                    s == state::InteractionState::SPEAKING;
+
     switch (s)
     {
     case state::InteractionState::LISTENING:
+        // Server-opened turns (auto-listen after TTS) start silently
+        if (!listening && src != state::InputSource::SERVER_COMMAND)
+            playEarcon(Earcon::LISTEN_START);
         startListening(src);
+        armCommands(true); // before disarming: the front-end history carries over
+        armWakeWord(false);
         break;
 
     case state::InteractionState::PROCESSING:
+        if (listening)
+            playEarcon(Earcon::LISTEN_END);
         pauseListening();
+        prewarmPlayback(true); // TTS is next
         break;
 
     case state::InteractionState::SPEAKING:
+        armWakeWord(false);
         startSpeaking();
         break;
 
     case state::InteractionState::CANCELLING:
     case state::InteractionState::IDLE:
+    {
+        const bool was_listening = listening;
+        prewarmPlayback(false);
         stopAll();
+        // Local voice command handled: close the turn audibly
+        if (was_listening && src == state::InputSource::LOCAL_COMMAND)
+            playEarcon(Earcon::LISTEN_END);
+        armWakeWord(true);
         break;
+    }
 
     case state::InteractionState::SLEEPING:
+        prewarmPlayback(false);
+        armWakeWord(false);
         stopAll();
         setPowerSaving(true);
         break;
@@ -280,6 +628,12 @@ void AudioManager::startListening(state::InputSource src)
         return;
 
     ESP_LOGI(TAG, "Start listening (Interruption handled)");
+    LatencyTrace::instance().beginTurn();
+
+    // Barge-in: the mic is already open and echo-cancelled, keep it running
+    // and keep what was captured over the playback
+    const bool barge_in = duplex_;
+    endDuplex(true);
 
     // Stop speaker immediately if mid-speech
     if (speaking)
@@ -288,21 +642,22 @@ void AudioManager::startListening(state::InputSource src)
     }
 
     // Clear speaker buffers to avoid playing stale audio
-    xStreamBufferReset(sb_spk_encoded); // Drop pending encoded frames
-    xStreamBufferReset(sb_spk_pcm);     // Drop pending PCM frames
-
-    // Reset codec to clear ADPCM predictor state for a clean session
-    if (codec)
-    {
-        codec->reset();
-    }
+    rb_spk_encoded.reset(); // Drop pending encoded frames
+    rb_spk_pcm.reset();     // Drop pending PCM frames
 
     current_source = src;
+    preroll_keep_ = (src == state::InputSource::WAKEWORD) || barge_in;
+    // Encoder task restarts the encoder (ADPCM predictor) and VAD / pre-roll;
+    // the decoder resets itself at its next session
+    enc_reset_pending_ = true;
+    vad_reset_pending_ = true;
     listening = true;
     speaking = false;
 
     // Begin capture
     input->startCapture();
+    updateBusyLock();
+    wakeTasks();
 }
 
 void AudioManager::pauseListening()
@@ -323,14 +678,13 @@ void AudioManager::stopListening()
     input->stopCapture();
 
     // Clear pending mic data immediately to avoid residual uplink
-    if (sb_mic_pcm)
-        xStreamBufferReset(sb_mic_pcm);
-    if (sb_mic_encoded)
-        xStreamBufferReset(sb_mic_encoded);
+    rb_mic_pcm.reset();
+    rb_mic_encoded.reset();
 
-    // Reset codec so next session starts clean
-    if (codec)
-        codec->reset();
+    // Next session's encoder starts clean
+    enc_reset_pending_ = true;
+    updateBusyLock();
+    wakeTasks();
 }
 
 void AudioManager::startSpeaking()
@@ -338,14 +692,23 @@ void AudioManager::startSpeaking()
     if (speaking)
         return;
     ESP_LOGI(TAG, "Start speaking");
-    speaking = true;
+    speak_start_ms_ = nowMs();
+    prewarm_ = false; // speaker task keeps the warm I2S running
 
-    // Wake speaker task immediately (don't wait for 100ms idle timeout)
-    if (spk_task)
+    // Full duplex: keep the mic open over playback (AEC + VAD watch for barge-in)
+    if (fullDuplex())
     {
-        xTaskNotifyGive(spk_task);
-        ESP_LOGD(TAG, "Speaker task notified to wake up");
+        rb_aec_ref.reset();
+        preroll_keep_ = false;
+        vad_reset_pending_ = true;
+        duplex_ = true;
+        input->startCapture();
     }
+    speaking = true;
+    updateBusyLock();
+
+    // Parked speaker / decoder tasks start the session right away
+    wakeTasks();
 
     // DO NOT reset codec here - it breaks ADPCM predictor continuity
     // Only reset when switching to a completely new audio stream/session
@@ -356,20 +719,80 @@ void AudioManager::stopSpeaking()
     if (!speaking)
         return;
     ESP_LOGI(TAG, "Stop speaking");
+    endDuplex(false);
     speaking = false;
     // Stop I2S playback unconditionally; underlying driver tracks running state
     if (output)
         output->stopPlayback();
 
     // Clear speaker buffers to drop any stale frames
-    if (sb_spk_encoded)
-        xStreamBufferReset(sb_spk_encoded);
-    if (sb_spk_pcm)
-        xStreamBufferReset(sb_spk_pcm);
+    rb_spk_encoded.reset();
+    rb_spk_pcm.reset();
+    dl_first_rx_ms_ = 0;
+
+    // Decoder task sees !speaking, drops the rings and resets its codec
+    // state before the next session
+    updateBusyLock();
+    wakeTasks();
+}
 
-    // Reset codec decode state for a fresh next session
-    if (codec)
-        codec->reset();
+void AudioManager::playEarcon(Earcon cue)
+{
+    if (power_saving || !earcons_.enabled())
+        return;
+    earcons_.play(cue);
+    wakeTasks(WAKE_SPK);
+}
+
+SpscRing *AudioManager::openMediaRing()
+{
+    if (!rb_media_pcm.valid())
+    {
+        // Same largest write as the downlink: one resampled codec frame
+        const size_t view = (MAX_RESAMPLE_UP * (pcm_frame_samples_ + PolyphaseResampler::TAPS) + 2) * sizeof(int16_t);
+        if (!allocRing(rb_media_pcm, "media_pcm", MEDIA_PCM_RING_BYTES, view))
+        {
+            ESP_LOGE(TAG, "No RAM for the media ring");
+            return nullptr;
+        }
+    }
+    return &rb_media_pcm;
+}
+
+void AudioManager::setMediaActive(bool active)
+{
+    if (active && !rb_media_pcm.valid())
+        return;
+    if (media_active_.exchange(active) == active)
+        return;
+    ESP_LOGI(TAG, "Media %s", active ? "on" : "off");
+    updateBusyLock();
+    wakeTasks(WAKE_SPK);
+}
+
+void AudioManager::prewarmPlayback(bool enable)
+{
+    if (prewarm_ == enable)
+        return;
+    if (enable)
+    {
+        if (speaking || power_saving)
+            return;
+        prewarm_since_ms_ = nowMs();
+        dl_first_rx_ms_ = 0;
+    }
+    prewarm_ = enable;
+    wakeTasks(WAKE_SPK);
+}
+
+void AudioManager::endDuplex(bool keep_capture)
+{
+    if (!duplex_)
+        return;
+    duplex_ = false;
+    if (!keep_capture && !kws_armed_)
+        input->stopCapture();
+    wakeTasks();
 }
 
 void AudioManager::stopAll()
@@ -382,7 +805,101 @@ void AudioManager::setPowerSaving(bool enable)
 {
     power_saving = enable;
     if (enable)
+    {
+        armWakeWord(false);
         stopAll();
+    }
+    wakeTasks();
+}
+
+void AudioManager::setWakeWordEnabled(bool enable)
+{
+    kws_enabled_ = enable;
+    if (!enable)
+        armWakeWord(false);
+    else if (StateManager::instance().getInteractionState() == state::InteractionState::IDLE)
+        armWakeWord(true);
+}
+
+void AudioManager::setVoiceCommandsEnabled(bool enable)
+{
+    cmd_enabled_ = enable;
+    if (!enable)
+        armCommands(false);
+}
+
+void AudioManager::armCommands(bool arm)
+{
+    arm = arm && started && cmd_.ready() && cmd_enabled_ && !power_saving;
+    if (!arm)
+    {
+        cmd_armed_ = false;
+        return;
+    }
+
+    // Wake-word turn: the MFCC window already holds the audio since the
+    // keyword. Otherwise the front-end restarts on fresh audio.
+    if (!kws_armed_)
+    {
+        rb_kws_pcm.reset();
+        kws_reset_pending_ = true;
+    }
+    cmd_reset_pending_ = true;
+    cmd_armed_ = true;
+    wakeTasks(WAKE_KWS);
+}
+
+void AudioManager::armWakeWord(bool arm)
+{
+    arm = arm && started && kws_.ready() && kws_model_ && kws_enabled_ && !power_saving;
+    if (kws_armed_ == arm)
+        return;
+
+    if (arm)
+    {
+        rb_kws_pcm.reset();
+        kws_reset_pending_ = true;
+        kws_armed_ = true;
+        input->startCapture(); // always-on capture while IDLE
+        ESP_LOGI(TAG, "Wake word armed");
+    }
+    else
+    {
+        kws_armed_ = false;
+        if (!listening)
+            input->stopCapture();
+        ESP_LOGI(TAG, "Wake word disarmed");
+    }
+    wakeTasks();
+}
+
+void AudioManager::wakeTasks(EventBits_t bits)
+{
+    if (wake_evt_)
+        xEventGroupSetBits(wake_evt_, bits);
+    // Encoder / decoder block on their input ring rather than on the bits
+    if (bits & WAKE_ENC)
+        rb_mic_pcm.interruptReader();
+    if (bits & WAKE_DEC)
+        rb_spk_encoded.interruptReader();
+}
+
+void AudioManager::parkUntilWoken(EventBits_t bit, TickType_t wait)
+{
+    // Waiting for a state change is not a stall: stall clock and TWDT off
+    if (bit == WAKE_MIC)
+        AudioHealth::instance().park(AudioHealth::MIC);
+    else if (bit == WAKE_ENC)
+        AudioHealth::instance().park(AudioHealth::ENC);
+    else if (bit == WAKE_DEC)
+        AudioHealth::instance().park(AudioHealth::DEC);
+    else if (bit == WAKE_SPK)
+        AudioHealth::instance().park(AudioHealth::SPK);
+
+    if (wake_evt_)
+        xEventGroupWaitBits(wake_evt_, bit, pdTRUE, pdFALSE, wait);
+    else
+        vTaskDelay(std::min<TickType_t>(wait, pdMS_TO_TICKS(100)));
 }
 
 // ============================================================================
@@ -393,9 +910,14 @@ void AudioManager::micTaskEntry(void *arg)
     static_cast<AudioManager *>(arg)->micTaskLoop();
 }
 
-void AudioManager::codecTaskEntry(void *arg)
+void AudioManager::encTaskEntry(void *arg)
+{
+    static_cast<AudioManager *>(arg)->encTaskLoop();
+}
+
+void AudioManager::decTaskEntry(void *arg)
 {
-    static_cast<AudioManager *>(arg)->codecTaskLoop();
+    static_cast<AudioManager *>(arg)->decTaskLoop();
 }
 
 void AudioManager::spkTaskEntry(void *arg)
@@ -403,208 +925,930 @@ void AudioManager::spkTaskEntry(void *arg)
     static_cast<AudioManager *>(arg)->spkTaskLoop();
 }
 
+void AudioManager::kwsTaskEntry(void *arg)
+{
+    static_cast<AudioManager *>(arg)->kwsTaskLoop();
+}
+
 // ============================================================================
-// MIC task: PCM → ENCODE → rb_mic_encoded
+// MIC task: I2S → rb_mic_pcm (read straight into ring memory)
 // ============================================================================
 void AudioManager::micTaskLoop()
 {
     ESP_LOGI(TAG, "MIC task started");
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::AUDIO_MIC));
 
-    constexpr size_t PCM_FRAME = 256;
-    int16_t pcm_buf[PCM_FRAME];
+    const size_t FRAME_BYTES = pcm_frame_samples_ * sizeof(int16_t);
+    AudioHealth &health = AudioHealth::instance();
+    uint32_t dropped_frames = 0;
+    uint32_t overrun_base = 0; // input->overruns() at the previous read
+    bool reading = false;      // back-to-back reads: DMA overruns are glitches
+    bool capturing = false;    // since the last park
+    bool shaped = false;       // mic DMA preset applied at least once
 
     while (started)
     {
-        if (!listening || power_saving)
+        const bool armed = kws_armed_;
+        if ((!listening && !armed && !duplex_) || power_saving)
         {
-            // ESP_LOGI(TAG, "MIC loop: %s, power_saving=%d",
-            //          listening ? "listening" : "not listening",
-            //          power_saving.load());
-            vTaskDelay(pdMS_TO_TICKS(100));
+            reading = false;
+            capturing = false;
+            parkUntilWoken(WAKE_MIC);
             continue;
         }
 
-        size_t samples = input->readPcm(pcm_buf, PCM_FRAME);
-        // if (samples > 0)
-        // {
-        //     ESP_LOGI(TAG, "MIC got %zu samples", samples);
-        // }
+        // DMA shape for this capture: shallow while the mic listens over
+        // playback. Reshaping drops a few ms, so not inside a LISTENING turn.
+        const DmaPreset want = duplex_ ? dma_presets_.barge_in : dma_presets_.listening;
+        if ((!shaped || want != mic_dma_.load(std::memory_order_relaxed)) && !(listening && capturing))
+        {
+            if (input->setDmaPreset(want))
+                mic_dma_ = want;
+            shaped = true;
+            reading = false; // fresh event queue
+        }
+        capturing = true;
+        health.beat(AudioHealth::MIC);
+
+        int16_t *dst = reinterpret_cast<int16_t *>(
+            rb_mic_pcm.acquireWrite(FRAME_BYTES, pdMS_TO_TICKS(10)));
+        if (!dst)
+        {
+            // Codec is behind: leave the frame in I2S DMA (it drops oldest data itself)
+            health.drop(AudioHealth::MIC);
+            if (++dropped_frames % 50 == 1)
+            {
+                ESP_LOGW("MIC", "Ring full! Dropped %u frames so far", (unsigned)dropped_frames);
+            }
+            continue;
+        }
+
+        size_t samples = input->readPcm(dst, pcm_frame_samples_);
         if (samples == 0)
         {
+            reading = false;
+            rb_mic_pcm.commitWrite(0);
             vTaskDelay(pdMS_TO_TICKS(5));
             continue;
         }
-        size_t bytes = samples * sizeof(int16_t);
-
-        size_t sent = xStreamBufferSend(
-            sb_mic_pcm,
-            reinterpret_cast<uint8_t *>(pcm_buf),
-            bytes,
-            pdMS_TO_TICKS(10));
-        if (sent < bytes)
+        const uint32_t overruns = input->overruns();
+        if (reading && overruns != overrun_base)
+        {
+            const uint32_t total = mic_glitches_.fetch_add(overruns - overrun_base) + (overruns - overrun_base);
+            health.drop(AudioHealth::MIC, overruns - overrun_base);
+            if (total % 20 == 1)
+                ESP_LOGW("MIC", "I2S RX overrun (%u so far)", (unsigned)total);
+        }
+        overrun_base = overruns;
+        reading = true;
+        if (armed || cmd_armed_)
         {
-            ESP_LOGW("MIC", "Buffer Full! Dropped %zu bytes", bytes - sent);
+            PTALK_PROF_SCOPE(KWS_FEED);
+            feedWakeWord(dst, samples);
         }
+        if (listening)
+            LatencyTrace::instance().mark(LatencyTrace::MIC_READ);
+        rb_mic_pcm.commitWrite(samples * sizeof(int16_t));
     }
 
+    health.park(AudioHealth::MIC);
     ESP_LOGW(TAG, "MIC task stopped");
+    MemTelemetry::instance().unregisterTask();
     vTaskDelete(nullptr);
 }
 
 // ============================================================================
-// CODEC task: ADPCM buffer → decode → PCM buffer
-// Separates decode logic from I2S timing - flexible for different codecs
+// ENCODER task: rb_mic_pcm → AEC → NS / AGC → VAD → encode → rb_mic_encoded
+// Blocks only on mic PCM; runs beside the decoder (full duplex) and resets
+// only the encoder side of the codec. Reads ring memory in place.
 // ============================================================================
-void AudioManager::codecTaskLoop()
+void AudioManager::encTaskLoop()
 {
-    ESP_LOGI(TAG, "Codec task started");
+    ESP_LOGI(TAG, "Encoder task started");
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::AUDIO_ENC));
+
+    const size_t PCM_FRAME_BYTES = pcm_frame_samples_ * sizeof(int16_t);
+    AudioHealth &health = AudioHealth::instance();
+
+    while (started)
+    {
+        // Mic PCM flows while listening, with the wake word armed (pre-roll)
+        // and over playback in full duplex; otherwise wait for a state change
+        const bool duplex = duplex_;
+        if (power_saving || (!listening && !kws_armed_ && !duplex) || (speaking && !duplex))
+        {
+            parkUntilWoken(WAKE_ENC);
+            continue;
+        }
+
+        health.beat(AudioHealth::ENC);
+        if (enc_reset_pending_.exchange(false))
+            codec->resetEncoder();
+
+        // State changes interrupt the wait (wakeTasks); the timeout is a backstop
+        const int16_t *pcm_in = reinterpret_cast<const int16_t *>(
+            rb_mic_pcm.acquireRead(PCM_FRAME_BYTES, pdMS_TO_TICKS(100)));
+        if (!pcm_in)
+            continue;
+
+        const int64_t t0 = esp_timer_get_time();
+        const int16_t *clean = pcm_in;
+        if (aec_.ready())
+        {
+            PTALK_PROF_SCOPE(AEC);
+            clean = echoCancel(pcm_in);
+        }
+        if (front_end_.ready() && front_end_.active())
+        {
+            PTALK_PROF_SCOPE(NS_AGC);
+            clean = front_end_.process(clean, pcm_frame_samples_);
+        }
+        {
+            PTALK_PROF_SCOPE(MIC_PROCESS);
+            processMicFrame(clean, listening && !speaking);
+        }
+        health.frameTime(AudioHealth::ENC, static_cast<uint32_t>(esp_timer_get_time() - t0));
+        rb_mic_pcm.release(PCM_FRAME_BYTES);
+    }
 
-    constexpr size_t PCM_FRAME = 256;   // 16 ms @16kHz
-    constexpr size_t ADPCM_FRAME = 512; // Server-side expects 512-byte chunks
+    health.park(AudioHealth::ENC);
+    ESP_LOGW(TAG, "Encoder task ended");
+    MemTelemetry::instance().unregisterTask();
+    vTaskDelete(nullptr);
+}
 
-    int16_t pcm_in[PCM_FRAME];
-    uint8_t encoded[ADPCM_FRAME];
+// ============================================================================
+// DECODER task: rb_spk_encoded → decode (+ PLC / FEC) → resample → rb_spk_pcm
+// Blocks only on downlink bytes; owns the decoder side of the codec.
+// Separates decode logic from I2S timing - flexible for different codecs.
+// ============================================================================
+void AudioManager::decTaskLoop()
+{
+    ESP_LOGI(TAG, "Decoder task started");
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::AUDIO_DEC));
 
-    int16_t pcm_out[1024]; // 64 ms PCM output
     bool new_decode_session = true;
+    bool buffering = true; // waiting for the jitter buffer target depth
+    AudioHealth &health = AudioHealth::instance();
 
     while (started)
     {
-        // =====================
-        // ENCODE (MIC → SERVER)
-        // =====================
-        if (!speaking)
+        if (!speaking || power_saving)
         {
-            size_t pcm_bytes = xStreamBufferReceive(
-                sb_mic_pcm,
-                reinterpret_cast<uint8_t *>(pcm_in),
-                sizeof(pcm_in),
-                pdMS_TO_TICKS(10)
+            rb_spk_encoded.reset();
+            rb_spk_pcm.reset();
+            // Marks point into the discarded bytes
+            dl_mark_tail_.store(dl_mark_head_.load(std::memory_order_acquire), std::memory_order_release);
+            if (!new_decode_session)
+                jitter_.reset();
+            new_decode_session = true;
+            dl_eou_ = false;
+            buffering = true;
+            parkUntilWoken(WAKE_DEC);
+            continue;
+        }
+
+        health.beat(AudioHealth::DEC);
+        const uint32_t stream_rate = downlinkSampleRate();
+        if (stream_rate != dl_rate_active_)
+            configureDownlinkRate(stream_rate);
+        if (new_decode_session)
+        {
+            codec->resetDecoder();
+            resampler_.reset();
+            plc_.reset();
+            new_decode_session = false;
+            ESP_LOGI(TAG, "Codec: New decode session started (%u Hz -> %u Hz)",
+                     (unsigned)stream_rate, (unsigned)output->sampleRate());
+        }
 
-            );
+        if (jitter_.takeUnderrun())
+        {
+            buffering = true;
+            ESP_LOGW(TAG, "Jitter: underrun #%u, rebuffering to %u ms",
+                     (unsigned)jitter_.underrunCount(), (unsigned)jitter_.targetMs());
+        }
 
-            if (pcm_bytes == sizeof(pcm_in))
+        // Sender marked the end or went quiet (stall): play what is buffered
+        size_t depth = rb_spk_encoded.available();
+        bool stalled = depth > 0 && (dl_eou_ || jitter_.msSinceArrival() >= jitter_.targetMs());
+
+        if (buffering)
+        {
+            // Jitter target is in codec-rate bytes; a faster stream needs more per ms
+            size_t target = jitter_.targetBytes() * stream_rate / codec->sampleRate();
+            if (depth < target && !stalled)
             {
-                size_t samples = pcm_bytes / sizeof(int16_t);
-
-                size_t enc_len = codec->encode(
-                    pcm_in,
-                    samples,
-                    encoded,
-                    sizeof(encoded));
-                // ESP_LOGD(TAG, "Encoded %zu PCM samples to %zu bytes", samples, enc_len);
-                if (enc_len > 0)
-                {
-                    xStreamBufferSend(
-                        sb_mic_encoded,
-                        encoded,
-                        enc_len,
-                        pdMS_TO_TICKS(10));
-                }
+                // Sleep until more bytes arrive or the stall deadline (sender
+                // quiet for the jitter target) passes, whichever is first
+                const uint32_t quiet = jitter_.msSinceArrival();
+                const uint32_t until_stall = depth > 0 && quiet < jitter_.targetMs()
+                    ? jitter_.targetMs() - quiet
+                    : 100;
+                if (depth < rb_spk_encoded.maxChunk())
+                    rb_spk_encoded.acquireRead(depth + 1, std::max<TickType_t>(pdMS_TO_TICKS(until_stall), 1));
+                else
+                    vTaskDelay(std::max<TickType_t>(pdMS_TO_TICKS(std::min(until_stall, frame_ms_)), 1));
+                continue;
             }
+            buffering = false;
+            ESP_LOGI(TAG, "Jitter: playout start depth=%u B target=%u ms jitter=%u ms",
+                     (unsigned)depth, (unsigned)jitter_.targetMs(), (unsigned)jitter_.jitterMs());
         }
-        // =====================
-        // DECODE (SERVER → SPK)
-        // =====================
-        if (!speaking || power_saving)
-        {
-            xStreamBufferReset(sb_spk_encoded);
-            xStreamBufferReset(sb_spk_pcm);
-            // codec->reset();
-            new_decode_session = true;
 
-            vTaskDelay(pdMS_TO_TICKS(5));
+        // Wait for data first: this also applies a pending ring reset, so
+        // the read position below is current
+        if (!rb_spk_encoded.acquireRead(framed_ ? FRAME_HDR : 1, pdMS_TO_TICKS(20)))
             continue;
-        }
 
-        size_t got = xStreamBufferReceive(
-            sb_spk_encoded,
-            encoded,
-            sizeof(encoded),
-            pdMS_TO_TICKS(20));
+        // A packet after a gap / with decoder state starts here
+        const uint32_t to_mark = dlBytesToMark();
+        if (to_mark == 0)
+        {
+            applyDlMark();
+            continue;
+        }
 
-        if (got == sizeof(encoded))
+        // One decode step: a whole [len][packet] for framed codecs,
+        // enc_frame_bytes_ of the byte stream otherwise (never past a mark)
+        const uint8_t *encoded = nullptr;
+        size_t n = 0;       // bytes consumed from the ring
+        size_t payload = 0; // bytes handed to the decoder
+        if (framed_)
         {
-            if (new_decode_session)
+            const uint8_t *h = rb_spk_encoded.acquireRead(FRAME_HDR, pdMS_TO_TICKS(20));
+            if (!h)
+                continue;
+            payload = static_cast<size_t>(h[0]) | (static_cast<size_t>(h[1]) << 8);
+            if (payload == 0 || payload > enc_frame_max_)
             {
-                codec->reset();
-                new_decode_session = false;
-                ESP_LOGI(TAG, "Codec: New decode session started");
+                // Lost framing: drop up to the next packet and resync there
+                ESP_LOGW(TAG, "Codec: bad packet length %u, resyncing", (unsigned)payload);
+                rb_spk_encoded.release(std::min<size_t>(rb_spk_encoded.available(), to_mark));
+                continue;
+            }
+            n = FRAME_HDR + payload;
+            if (n > to_mark)
+            {
+                // Record cut short by a dropped fragment: skip it, fill its time
+                ESP_LOGW(TAG, "Codec: truncated packet (%u of %u B), concealed",
+                         (unsigned)to_mark, (unsigned)n);
+                rb_spk_encoded.release(to_mark);
+                emitDownlinkFrame(nullptr, 0, DlFrame::CONCEAL);
+                continue;
             }
+            encoded = rb_spk_encoded.acquireRead(n, pdMS_TO_TICKS(20));
+            if (!encoded)
+                continue;
+            encoded += FRAME_HDR;
+        }
+        else
+        {
+            n = enc_frame_bytes_;
+            if (depth < n && stalled)
+                n = depth; // Drain the tail
+            n = std::min<size_t>(n, to_mark);
+            encoded = rb_spk_encoded.acquireRead(n, pdMS_TO_TICKS(20));
+            if (!encoded)
+                continue;
+            payload = n;
+        }
 
-            size_t out_samples = codec->decode(
-                encoded,
-                got,
-                pcm_out,
-                1024);
+        if (!emitDownlinkFrame(encoded, payload, DlFrame::DECODE))
+        {
+            health.drop(AudioHealth::DEC);
+            ESP_LOGW(TAG, "Codec: SPK ring full, dropped %u encoded bytes", (unsigned)n);
+        }
+        rb_spk_encoded.release(n);
+    }
+
+    health.park(AudioHealth::DEC);
+    ESP_LOGW(TAG, "Decoder task ended");
+    MemTelemetry::instance().unregisterTask();
+    vTaskDelete(nullptr);
+}
+
+// ----------------------------------------------------------------------------
+// Downlink rate conversion (decoder task)
+// ----------------------------------------------------------------------------
+void AudioManager::configureDownlinkRate(uint32_t stream_rate)
+{
+    const uint32_t out_rate = output->sampleRate();
+    dl_rate_active_ = stream_rate;
+
+    // Concealment runs at the decoded rate, before the resampler
+    if (!plc_.init(stream_rate))
+        ESP_LOGW(TAG, "Downlink PLC unavailable at %u Hz, gaps play as silence", (unsigned)stream_rate);
+
+    if (stream_rate == out_rate)
+    {
+        if (resampler_.ready())
+            ESP_LOGI(TAG, "Downlink %u Hz matches speaker, resampler off", (unsigned)stream_rate);
+        resampler_.deinit();
+        dl_pcm_.reset();
+        return;
+    }
+    if (stream_rate == 0 || out_rate > stream_rate * MAX_RESAMPLE_UP)
+    {
+        ESP_LOGE(TAG, "Downlink %u Hz unsupported for %u Hz speaker, playing as-is",
+                 (unsigned)stream_rate, (unsigned)out_rate);
+        resampler_.deinit();
+        dl_pcm_.reset();
+        return;
+    }
 
+    if (!dl_pcm_)
+        dl_pcm_.reset(new (std::nothrow) int16_t[pcm_frame_samples_]);
+    if (!dl_pcm_ || !resampler_.init(stream_rate, out_rate, pcm_frame_samples_))
+    {
+        ESP_LOGE(TAG, "No RAM for downlink resampler, playing as-is");
+        resampler_.deinit();
+        dl_pcm_.reset();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Downlink frames and loss handling (decoder task)
+// ----------------------------------------------------------------------------
+bool AudioManager::emitDownlinkFrame(const uint8_t *encoded, size_t len, DlFrame kind)
+{
+    // Same rate: decode straight into the ring. Otherwise decode one
+    // frame aside and let the resampler write the ring.
+    const bool resample = resampler_.ready();
+    const size_t out_bytes = resample
+        ? resampler_.maxOutput(pcm_frame_samples_) * sizeof(int16_t)
+        : pcm_frame_samples_ * sizeof(int16_t);
+    int16_t *pcm_out = reinterpret_cast<int16_t *>(
+        rb_spk_pcm.acquireWrite(out_bytes, pdMS_TO_TICKS(1000)));
+    if (!pcm_out)
+        return false;
+
+    // Budget covers decode + PLC + resample, not the wait for ring space
+    const int64_t t0 = esp_timer_get_time();
+    int16_t *pcm = resample ? dl_pcm_.get() : pcm_out;
+    size_t out_samples = 0;
+    {
+        PTALK_PROF_SCOPE(DECODE);
+        bool repeated = false; // plc_ output, already in its history
+        if (kind == DlFrame::DECODE)
+        {
+            out_samples = codec->decode(encoded, len, pcm, pcm_frame_samples_);
+        }
+        else
+        {
+            if (kind == DlFrame::FEC)
+                out_samples = codec->decodeFec(encoded, len, pcm, pcm_frame_samples_);
             if (out_samples > 0)
             {
-                size_t written = xStreamBufferSend(
-                    sb_spk_pcm,
-                    reinterpret_cast<uint8_t *>(pcm_out),
-                    out_samples * sizeof(int16_t),
-                    pdMS_TO_TICKS(1000));
-                if (written != out_samples * sizeof(int16_t))
+                dl_fec_frames_++;
+            }
+            else
+            {
+                // Codec PLC (Opus) first, pitch repetition otherwise
+                dl_concealed_frames_++;
+                out_samples = codec->conceal(pcm, pcm_frame_samples_);
+                if (out_samples == 0)
+                {
+                    out_samples = plc_.conceal(pcm, pcm_frame_samples_);
+                    repeated = out_samples > 0;
+                }
+                if (out_samples == 0)
+                {
+                    memset(pcm, 0, pcm_frame_samples_ * sizeof(int16_t));
+                    out_samples = pcm_frame_samples_;
+                }
+            }
+        }
+        if (!repeated)
+            plc_.onDecoded(pcm, out_samples);
+        if (resample)
+            out_samples = resampler_.process(dl_pcm_.get(), out_samples, pcm_out);
+    }
+    AudioHealth::instance().frameTime(AudioHealth::DEC, static_cast<uint32_t>(esp_timer_get_time() - t0));
+    rb_spk_pcm.commitWrite(out_samples * sizeof(int16_t));
+    if (kind == DlFrame::DECODE)
+        LatencyTrace::instance().mark(LatencyTrace::DECODE);
+    return true;
+}
+
+uint32_t AudioManager::dlBytesToMark()
+{
+    const uint32_t rd = rb_spk_encoded.readPosition();
+    uint32_t tail = dl_mark_tail_.load(std::memory_order_relaxed);
+    while (tail != dl_mark_head_.load(std::memory_order_acquire))
+    {
+        const int32_t ahead = static_cast<int32_t>(dl_marks_[tail % DL_MARKS].pos - rd);
+        if (ahead >= 0)
+            return static_cast<uint32_t>(ahead);
+        // Its packet was discarded (reset / resync)
+        dl_mark_tail_.store(++tail, std::memory_order_release);
+    }
+    return UINT32_MAX;
+}
+
+void AudioManager::applyDlMark()
+{
+    const uint32_t tail = dl_mark_tail_.load(std::memory_order_relaxed);
+    const DlMark m = dl_marks_[tail % DL_MARKS];
+    dl_mark_tail_.store(tail + 1, std::memory_order_release);
+
+    for (uint16_t i = 0; i < m.lost_frames; i++)
+    {
+        // The frame right before this packet may be in its FEC: peek the
+        // record without consuming it (it is decoded normally next)
+        const uint8_t *next = nullptr;
+        size_t next_len = 0;
+        if (framed_ && i + 1 == m.lost_frames)
+        {
+            const uint8_t *h = rb_spk_encoded.acquireRead(FRAME_HDR, 0);
+            const size_t len = h ? (static_cast<size_t>(h[0]) | (static_cast<size_t>(h[1]) << 8)) : 0;
+            if (len > 0 && len <= enc_frame_max_)
+            {
+                next = rb_spk_encoded.acquireRead(FRAME_HDR + len, 0);
+                if (next)
                 {
-                    ESP_LOGW(TAG, "Codec: SPK buffer full, dropped %zu bytes", 
-                             out_samples * sizeof(int16_t) - written);
+                    next += FRAME_HDR;
+                    next_len = len;
                 }
             }
         }
-        else if (got > 0)
+        if (!emitDownlinkFrame(next, next_len, next ? DlFrame::FEC : DlFrame::CONCEAL))
+            break;
+    }
+
+    // ADPCM: the encoder state at this packet's first sample
+    if (m.sync)
+        codec->resyncDecoder(m.sync_predictor, m.sync_index);
+}
+
+// ----------------------------------------------------------------------------
+// Uplink helpers (encoder task)
+// ----------------------------------------------------------------------------
+bool AudioManager::encodeFrame(const int16_t *pcm)
+{
+    const uint8_t want = ul_level_req_.load(std::memory_order_acquire);
+    if (want != ul_level_ && want < ul_level_count_)
+        applyUplinkLevel(want);
+
+    const size_t hdr = framed_ ? FRAME_HDR : 0;
+    // Never wait: a full ring means the uplink is congested. Skipping the
+    // whole frame keeps the ADPCM predictor in step with the server's decoder.
+    uint8_t *encoded = rb_mic_encoded.acquireWrite(hdr + enc_frame_max_, 0);
+    if (!encoded)
+    {
+        mic_dropped_frames_++;
+        return false;
+    }
+
+    const int16_t *src = pcm;
+    size_t samples = pcm_frame_samples_;
+    if (ul_levels_[ul_level_].half_rate)
+    {
+        samples = ul_decim_.process(pcm, pcm_frame_samples_, ul_half_pcm_.get());
+        src = ul_half_pcm_.get();
+    }
+    size_t enc_len = codec->encode(src, samples, encoded + hdr, enc_frame_max_);
+    if (framed_ && enc_len > 0)
+    {
+        encoded[0] = static_cast<uint8_t>(enc_len & 0xFF);
+        encoded[1] = static_cast<uint8_t>(enc_len >> 8);
+    }
+    rb_mic_encoded.commitWrite(enc_len > 0 ? hdr + enc_len : 0);
+    if (enc_len > 0)
+        LatencyTrace::instance().mark(LatencyTrace::ENCODE);
+    return true;
+}
+
+void AudioManager::buildUplinkLevels()
+{
+    const uint32_t nominal = codec->bitrate();
+    ul_levels_[0] = UplinkLevel{static_cast<uint16_t>(nominal / 1000), false};
+    ul_level_count_ = 1;
+    ul_level_ = 0;
+    ul_level_req_ = 0;
+
+    if (codec->setBitrate(nominal))
+    {
+        // Bitrate-agile codec (Opus): 3/4, 1/2 and 3/8 of nominal, >= 6 kbps
+        static constexpr uint32_t STEPS[] = {6, 4, 3}; // eighths
+        for (uint32_t eighths : STEPS)
         {
-            ESP_LOGW(TAG, "Codec: Got partial ADPCM %zu/%zu bytes", got, sizeof(encoded));
+            const uint32_t kbps = std::max<uint32_t>(nominal * eighths / 8000, 6);
+            if (kbps < ul_levels_[ul_level_count_ - 1].kbps && ul_level_count_ < UL_LEVELS_MAX)
+                ul_levels_[ul_level_count_++] = UplinkLevel{static_cast<uint16_t>(kbps), false};
         }
     }
+    else if (!framed_ && codec->sampleRate() >= 16000 && (pcm_frame_samples_ & 3) == 0)
+    {
+        // Sample codec (ADPCM): same encoder on PCM decimated to half the rate
+        ul_half_pcm_.reset(new (std::nothrow) int16_t[pcm_frame_samples_ / 2 + PolyphaseResampler::TAPS]);
+        if (ul_half_pcm_ && ul_decim_.init(codec->sampleRate(), codec->sampleRate() / 2, pcm_frame_samples_))
+            ul_levels_[ul_level_count_++] = UplinkLevel{static_cast<uint16_t>(nominal / 2000), true};
+        else
+            ul_half_pcm_.reset();
+    }
+
+    ESP_LOGI(TAG, "Uplink levels: %u (%u .. %u kbps)", (unsigned)ul_level_count_,
+             (unsigned)ul_levels_[0].kbps, (unsigned)ul_levels_[ul_level_count_ - 1].kbps);
+}
+
+void AudioManager::applyUplinkLevel(uint8_t level)
+{
+    const UplinkLevel &to = ul_levels_[level];
+    if (!to.half_rate)
+        codec->setBitrate(static_cast<uint32_t>(to.kbps) * 1000); // no-op on fixed-rate codecs
+    if (to.half_rate && !ul_levels_[ul_level_].half_rate)
+        ul_decim_.reset();
+    ul_level_ = level;
+
+    // Bytes from here on are at the new level
+    ul_switch_pos_.store(rb_mic_encoded.writePosition(), std::memory_order_relaxed);
+    ul_switch_level_.store(level, std::memory_order_relaxed);
+    ul_switch_seq_.fetch_add(1, std::memory_order_release);
+    ESP_LOGI(TAG, "Uplink level %u: %u kbps%s", (unsigned)level, (unsigned)to.kbps,
+             to.half_rate ? " (half rate)" : "");
+}
+
+void AudioManager::holdPreroll(const int16_t *pcm)
+{
+    if (!preroll_)
+        return;
+    memcpy(&preroll_[preroll_head_ * pcm_frame_samples_], pcm, pcm_frame_samples_ * sizeof(int16_t));
+    preroll_head_ = (preroll_head_ + 1) % preroll_frames_;
+    preroll_count_ = std::min(preroll_count_ + 1, preroll_frames_);
+}
+
+void AudioManager::flushPreroll()
+{
+    // Oldest frame first
+    size_t idx = (preroll_head_ + preroll_frames_ - preroll_count_) % preroll_frames_;
+    for (size_t i = 0; i < preroll_count_; i++)
+    {
+        encodeFrame(&preroll_[idx * pcm_frame_samples_]);
+        idx = (idx + 1) % preroll_frames_;
+    }
+    preroll_count_ = 0;
+}
 
-    ESP_LOGW(TAG, "Codec task ended");
+void AudioManager::processMicFrame(const int16_t *pcm, bool live)
+{
+    if (vad_reset_pending_.exchange(false))
+    {
+        vad_.reset();
+        eos_sent_ = false;
+        barge_sent_ = false;
+        if (!preroll_keep_)
+        {
+            preroll_head_ = 0;
+            preroll_count_ = 0;
+        }
+        else if (!vad_enabled_)
+        {
+            flushPreroll(); // wake-word turn: audio since the keyword goes out first
+        }
+    }
+
+    if (!live)
+    {
+        // Wake word armed in IDLE / duplex SPEAKING: keep the recent past for the next turn
+        holdPreroll(pcm);
+
+        if (duplex_ && vad_enabled_ && !barge_sent_ &&
+            vad_.process(pcm, pcm_frame_samples_) != VoiceActivityDetector::Result::SILENCE)
+        {
+            barge_sent_ = true;
+            ESP_LOGI(TAG, "VAD: barge-in over playback (amp=%u floor=%u)",
+                     (unsigned)vad_.lastAmplitude(), (unsigned)vad_.noiseFloor());
+            if (on_barge_in_cb)
+                on_barge_in_cb();
+        }
+        return;
+    }
+
+    if (!vad_enabled_)
+    {
+        encodeFrame(pcm);
+        return;
+    }
+
+    VoiceActivityDetector::Result r = vad_.process(pcm, pcm_frame_samples_);
+
+    if (r == VoiceActivityDetector::Result::SILENCE)
+    {
+        // Not sent: encoder and server decoder both skip it, so codec state stays in step
+        holdPreroll(pcm);
+        return;
+    }
+
+    // Onset: send the held lead-in first
+    if (preroll_count_ > 0)
+    {
+        ESP_LOGD(TAG, "VAD: onset (amp=%u floor=%u), %u pre-roll frames",
+                 (unsigned)vad_.lastAmplitude(), (unsigned)vad_.noiseFloor(), (unsigned)preroll_count_);
+        flushPreroll();
+    }
+
+    encodeFrame(pcm);
+
+    if (r == VoiceActivityDetector::Result::END_OF_SPEECH && !eos_sent_)
+    {
+        eos_sent_ = true;
+        ESP_LOGI(TAG, "VAD: end of speech (floor=%u)", (unsigned)vad_.noiseFloor());
+        if (on_end_of_speech_cb)
+            on_end_of_speech_cb();
+    }
+}
+
+// ----------------------------------------------------------------------------
+// AEC: reference from the speaker task, aligned per frame
+// ----------------------------------------------------------------------------
+const int16_t *AudioManager::echoCancel(const int16_t *pcm)
+{
+    const size_t FRAME_BYTES = pcm_frame_samples_ * sizeof(int16_t);
+
+    // Speaker DMA was reshaped: the echo now arrives later / earlier
+    const uint32_t queue_ms = spk_queue_ms_.load(std::memory_order_relaxed);
+    if (queue_ms && queue_ms != aec_queue_ms_)
+    {
+        aec_.setBulkDelayMs(static_cast<uint16_t>(queue_ms + 8));
+        aec_queue_ms_ = queue_ms;
+    }
+
+    // Both streams run at the I2S clock; a backlog means the encoder task fell
+    // behind, so drop the oldest reference to stay aligned
+    size_t avail = rb_aec_ref.available();
+    if (avail > 3 * FRAME_BYTES)
+        rb_aec_ref.release(avail - FRAME_BYTES);
+
+    const int16_t *far = avail >= FRAME_BYTES
+                             ? reinterpret_cast<const int16_t *>(rb_aec_ref.acquireRead(FRAME_BYTES, 0))
+                             : nullptr;
+    const int16_t *out = aec_.process(pcm, far, pcm_frame_samples_);
+    if (far)
+        rb_aec_ref.release(FRAME_BYTES);
+    return out;
+}
+
+// ============================================================================
+// KWS: mic task → rb_kws_pcm (decimated) → KWS task
+// ============================================================================
+void AudioManager::feedWakeWord(const int16_t *pcm, size_t samples)
+{
+    const size_t out_n = samples / kws_decim_;
+    int16_t *dst = reinterpret_cast<int16_t *>(rb_kws_pcm.acquireWrite(out_n * sizeof(int16_t), 0));
+    if (!dst)
+        return; // KWS behind: drop, it resyncs on the next hop
+
+    if (kws_decim_ == 2)
+    {
+        // [1 2 1]/4 half-band-ish low-pass, then keep every other sample
+        int32_t prev = kws_prev_;
+        for (size_t i = 0; i < out_n; i++)
+        {
+            int32_t a = pcm[2 * i], b = pcm[2 * i + 1];
+            dst[i] = static_cast<int16_t>((prev + 2 * a + b) >> 2);
+            prev = b;
+        }
+        kws_prev_ = static_cast<int16_t>(prev);
+    }
+    else
+    {
+        memcpy(dst, pcm, out_n * sizeof(int16_t));
+    }
+    rb_kws_pcm.commitWrite(out_n * sizeof(int16_t));
+}
+
+void AudioManager::kwsTaskLoop()
+{
+    ESP_LOGI(TAG, "KWS task started");
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::AUDIO_KWS));
+
+    const size_t CHUNK_BYTES = (pcm_frame_samples_ / kws_decim_) * sizeof(int16_t);
+
+    while (started)
+    {
+        const bool wake = kws_armed_;
+        const bool commands = cmd_armed_;
+        if (!wake && !commands)
+        {
+            parkUntilWoken(WAKE_KWS);
+            continue;
+        }
+
+        if (kws_reset_pending_.exchange(false))
+            kws_.reset();
+        if (cmd_reset_pending_.exchange(false))
+            cmd_.reset();
+        kws_.setDetect(wake); // commands only: front-end rows, no wake-word inference
+
+        const int16_t *pcm = reinterpret_cast<const int16_t *>(
+            rb_kws_pcm.acquireRead(CHUNK_BYTES, pdMS_TO_TICKS(100)));
+        if (!pcm)
+            continue;
+
+        bool hit = kws_.feed(pcm, CHUNK_BYTES / sizeof(int16_t));
+        rb_kws_pcm.release(CHUNK_BYTES);
+
+        if (hit && kws_armed_ && on_wake_word_cb)
+            on_wake_word_cb();
+
+        if (commands)
+        {
+            const VoiceCommand cmd = cmd_.poll(kws_);
+            if (cmd != VoiceCommand::NONE && cmd_armed_.exchange(false) && on_voice_command_cb)
+                on_voice_command_cb(cmd);
+            else if (cmd_.expired() && !cmd_reset_pending_)
+                cmd_armed_ = false; // past the command window: a request for the server
+        }
+    }
+
+    ESP_LOGW(TAG, "KWS task ended");
+    MemTelemetry::instance().unregisterTask();
     vTaskDelete(nullptr);
 }
 
+AudioManager::GlitchStats AudioManager::glitchStats() const
+{
+    GlitchStats g;
+    g.spk_underruns = spk_glitches_.load(std::memory_order_relaxed);
+    g.mic_overruns = mic_glitches_.load(std::memory_order_relaxed);
+    g.spk_dma_underflows = output ? output->underruns() : 0;
+    g.mic_dma_overflows = input ? input->overruns() : 0;
+    g.spk_dma = spk_dma_.load(std::memory_order_relaxed);
+    g.mic_dma = mic_dma_.load(std::memory_order_relaxed);
+    return g;
+}
+
+void AudioManager::shapeSpeakerDma()
+{
+    const DmaPreset want = dma_presets_.speaking;
+    if (output->setDmaPreset(want))
+        spk_dma_ = want;
+    // Encoder task moves the AEC bulk delay to match
+    spk_queue_ms_ = output->queueDelayMs();
+}
+
+size_t AudioManager::mixMedia(int16_t *dst, size_t samples)
+{
+    const size_t n = std::min(samples, rb_media_pcm.available() / sizeof(int16_t));
+    const int16_t *src = n ? reinterpret_cast<const int16_t *>(rb_media_pcm.acquireRead(n * sizeof(int16_t), 0))
+                           : nullptr;
+    if (!src)
+    {
+        media_underruns_++;
+        return 0;
+    }
+
+    // Duck / unduck as a ramp across frames, linear inside one (no zipper)
+    const int32_t target = media_ducked_ ? media_duck_pct_ * 256 / 100 : 256;
+    const int32_t g0 = media_gain_q8_;
+    const int32_t step = std::max(-MEDIA_RAMP_Q8, std::min(MEDIA_RAMP_Q8, target - g0));
+    for (size_t i = 0; i < n; i++)
+    {
+        const int32_t g = g0 + step * static_cast<int32_t>(i) / static_cast<int32_t>(n);
+        const int32_t v = dst[i] + ((src[i] * g) >> 8);
+        dst[i] = static_cast<int16_t>(std::max<int32_t>(-32768, std::min<int32_t>(32767, v)));
+    }
+    media_gain_q8_ = g0 + step;
+    rb_media_pcm.release(n * sizeof(int16_t));
+    if (n < samples)
+        media_underruns_++;
+    return n;
+}
+
 // ============================================================================
-// SPEAKER task: PCM buffer → I2S output
+// SPEAKER task: rb_spk_pcm → I2S output
 // Simplified - only handles I2S timing, no decode logic
 // I2S clock controls timing naturally
 // ============================================================================
 void AudioManager::spkTaskLoop()
 {
     ESP_LOGI(TAG, "Speaker task started");
-    
-    constexpr size_t PCM_CHUNK_SAMPLES = 1024;
-    constexpr size_t PCM_CHUNK_BYTES =
-        PCM_CHUNK_SAMPLES * sizeof(int16_t);
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::AUDIO_SPK));
+
+    const size_t FRAME_BYTES = pcm_frame_samples_ * sizeof(int16_t);
 
-    int16_t pcm_chunk[PCM_CHUNK_SAMPLES];
+    // Last frame played, kept for underrun concealment
+    int16_t last_frame[MAX_FRAME_SAMPLES] = {0};
+    size_t last_samples = 0;
+    int concealed = 0;         // consecutive concealment frames
+    bool playing = false;      // real audio written this session
+    bool first_frame = true;   // for time-to-first-audio log
+
+    AudioHealth &health = AudioHealth::instance();
     bool i2s_started = false;
     uint32_t timeout_count = 0;
+    uint32_t underrun_base = 0; // output->underruns() after the previous write
+    uint32_t cue_tail_ms = 0;   // silence still owed after an idle earcon (DMA drain)
+
+    // After a write: DMA underruns since the previous one are glitches only
+    // while audio is flowing (not the idle / pre-warm gap before a stream,
+    // not a network gap that outlasted concealment)
+    auto checkUnderruns = [&](bool flowing)
+    {
+        const uint32_t underruns = output->underruns();
+        if (flowing && underruns != underrun_base)
+        {
+            health.underrun(AudioHealth::SPK, underruns - underrun_base);
+            const uint32_t total = spk_glitches_.fetch_add(underruns - underrun_base) + (underruns - underrun_base);
+            if (total % 20 == 1)
+                ESP_LOGW(TAG, "Speaker: I2S TX underrun (%u so far)", (unsigned)total);
+        }
+        underrun_base = underruns;
+    };
 
     while (started)
     {
         // When not speaking, idle but stay alive for next session
         if (!speaking || power_saving)
         {
-            if (i2s_started)
+            // Earcon / media with no stream: own the I2S until the sound and
+            // one DMA queue of silence behind it are out (stopping earlier cuts it)
+            const bool media = media_active_;
+            if (!power_saving && (earcons_.busy() || cue_tail_ms > 0 || media))
+            {
+                if (!i2s_started)
+                {
+                    shapeSpeakerDma();
+                    if (!output->startPlayback())
+                    {
+                        ESP_LOGW(TAG, "Speaker: startPlayback() for earcon / media failed");
+                        earcons_.stop();
+                        cue_tail_ms = 0;
+                        vTaskDelay(pdMS_TO_TICKS(10));
+                        continue;
+                    }
+                    i2s_started = true;
+                    timeout_count = 0;
+                }
+                if (media)
+                    health.beat(AudioHealth::SPK); // minutes of music: keep the TWDT on
+                memset(last_frame, 0, FRAME_BYTES);
+                const size_t media_samples = media ? mixMedia(last_frame, pcm_frame_samples_) : 0;
+                if (earcons_.mix(last_frame, pcm_frame_samples_) > 0 || media_samples > 0)
+                    cue_tail_ms = spk_queue_ms_ + frame_ms_;
+                else
+                    cue_tail_ms = cue_tail_ms > frame_ms_ ? cue_tail_ms - frame_ms_ : 0;
+                output->writePcm(last_frame, pcm_frame_samples_);
+                underrun_base = output->underruns(); // idle I2S gaps are not glitches
+                continue;
+            }
+            if (power_saving)
+            {
+                earcons_.stop();
+                cue_tail_ms = 0;
+            }
+
+            // Pre-warm: clock already running (DMA auto-clears to silence)
+            // so SPEAKING does not pay for i2s_start + DMA fill
+            if (prewarm_ && nowMs() - prewarm_since_ms_ > PREWARM_MAX_MS)
+            {
+                ESP_LOGI(TAG, "Speaker: pre-warm expired");
+                prewarm_ = false;
+            }
+            const bool warm = prewarm_ && !power_saving;
+
+            if (i2s_started && !warm)
             {
-                ESP_LOGI(TAG, "Speaker: Stopping I2S (speaking=%d, power_saving=%d)", 
+                ESP_LOGI(TAG, "Speaker: Stopping I2S (speaking=%d, power_saving=%d)",
                          speaking.load(), power_saving.load());
                 output->stopPlayback();
                 i2s_started = false;
                 timeout_count = 0;
             }
-            // Idle: wait for notification or timeout (100ms max) - allows quick wake-up when speaking starts
-            uint32_t notified = ulTaskNotifyTake(pdFALSE, pdMS_TO_TICKS(100));
-            if (notified)
+            else if (warm && !i2s_started)
+            {
+                shapeSpeakerDma();
+                if (output->startPlayback())
+                {
+                    i2s_started = true;
+                    timeout_count = 0;
+                    ESP_LOGI(TAG, "Speaker: I2S pre-warmed for TTS");
+                }
+            }
+            playing = false;
+            first_frame = true;
+            concealed = 0;
+            last_samples = 0;
+            // Idle: park until the next state change; a warm clock only
+            // needs a wakeup when the pre-warm window runs out
+            TickType_t wait = portMAX_DELAY;
+            if (warm)
             {
-                ESP_LOGD(TAG, "Speaker: Woken by notification");
+                const uint32_t held = nowMs() - prewarm_since_ms_;
+                wait = pdMS_TO_TICKS(PREWARM_MAX_MS - std::min<uint32_t>(held, PREWARM_MAX_MS)) + 1;
             }
+            parkUntilWoken(WAKE_SPK, wait);
             continue;
         }
 
+        health.beat(AudioHealth::SPK);
+
         // Now speaking=true, try to start I2S if not already
         if (!i2s_started)
         {
             ESP_LOGI(TAG, "Speaker: Attempting startPlayback()...");
+            shapeSpeakerDma();
             if (!output->startPlayback())
             {
                 ESP_LOGW(TAG, "Speaker: startPlayback() failed, retrying...");
@@ -616,28 +1860,120 @@ void AudioManager::spkTaskLoop()
             ESP_LOGI(TAG, "Speaker: I2S playback started");
         }
 
-        // Read PCM from buffer and play
-        size_t got = xStreamBufferReceive(
-            sb_spk_pcm,
-            reinterpret_cast<uint8_t *>(pcm_chunk),
-            PCM_CHUNK_BYTES,
-            pdMS_TO_TICKS(100));
+        // Play PCM straight out of the ring; once playing, wait at most one
+        // frame so an underrun is concealed before the I2S DMA runs dry.
+        // (media under the turn keeps flowing while TTS is still buffering)
+        const TickType_t wait = pdMS_TO_TICKS(playing || media_active_ ? frame_ms_ : 100);
+        size_t got_bytes = FRAME_BYTES;
+        const int16_t *pcm = nullptr;
+        if (low_latency_)
+        {
+            // Incremental: write whatever is decoded (≤ one frame) as soon
+            // as MIN_PLAYOUT_BYTES exist, DMA paces the rest
+            if (rb_spk_pcm.acquireRead(MIN_PLAYOUT_BYTES, wait))
+            {
+                got_bytes = std::min(rb_spk_pcm.available() & ~static_cast<size_t>(1), FRAME_BYTES);
+                pcm = reinterpret_cast<const int16_t *>(rb_spk_pcm.acquireRead(got_bytes, 0));
+            }
+        }
+        else
+        {
+            pcm = reinterpret_cast<const int16_t *>(rb_spk_pcm.acquireRead(FRAME_BYTES, wait));
+        }
+        if (!pcm)
+        {
+            // Tail of an utterance can be shorter than a frame
+            got_bytes = rb_spk_pcm.available() & ~static_cast<size_t>(1);
+            if (got_bytes > 0)
+                pcm = reinterpret_cast<const int16_t *>(rb_spk_pcm.acquireRead(got_bytes, 0));
+        }
 
-        if (got == PCM_CHUNK_BYTES)
+        if (pcm)
         {
+            size_t samples = got_bytes / sizeof(int16_t);
+            const bool flowing = playing && concealed < MAX_CONCEAL_FRAMES;
+            if (first_frame)
+            {
+                first_frame = false;
+                const uint32_t now = nowMs();
+                const uint32_t rx = dl_first_rx_ms_;
+                ESP_LOGI(TAG, "Speaker: first audio %u ms after SPEAKING, %u ms after first downlink byte",
+                         (unsigned)(now - speak_start_ms_), (unsigned)(rx ? now - rx : 0));
+            }
+
+            if (concealed > 0)
+            {
+                // Ramp back in after concealment to avoid a click
+                for (size_t i = 0; i < samples; i++)
+                    last_frame[i] = static_cast<int16_t>((pcm[i] * static_cast<int32_t>(i)) / static_cast<int32_t>(samples));
+                output->writePcm(last_frame, samples);
+                if (duplex_)
+                    rb_aec_ref.write(reinterpret_cast<const uint8_t *>(last_frame), got_bytes, 0);
+            }
+            else
+            {
+                PTALK_PROF_SCOPE(SPK_WRITE);
+                const int16_t *out = pcm;
+                if (earcons_.busy() || media_active_)
+                {
+                    // Cue / ducked media under the TTS: mix into the copy
+                    // kept for concealment
+                    memcpy(last_frame, pcm, got_bytes);
+                    if (media_active_)
+                        mixMedia(last_frame, samples);
+                    earcons_.mix(last_frame, samples);
+                    out = last_frame;
+                }
+                output->writePcm(out, samples);
+                if (duplex_)
+                    rb_aec_ref.write(reinterpret_cast<const uint8_t *>(out), got_bytes, 0);
+                if (out == pcm)
+                    memcpy(last_frame, pcm, got_bytes);
+            }
+            rb_spk_pcm.release(got_bytes);
+            health.flowing(AudioHealth::SPK);
+            checkUnderruns(flowing);
+            LatencyTrace::instance().mark(LatencyTrace::SPK_WRITE);
+
+            last_samples = samples;
+            concealed = 0;
+            playing = true;
             timeout_count = 0;
-            output->writePcm(pcm_chunk, PCM_CHUNK_SAMPLES);
         }
-        else if (got > 0)
+        else if (playing && last_samples > 0 && concealed < MAX_CONCEAL_FRAMES)
         {
-            // Partial data
-            ESP_LOGW(TAG, "Speaker: Got partial PCM data %zu/%zu bytes", got, PCM_CHUNK_BYTES);
-            timeout_count = 0;
+            // Underrun: repeat the last frame at -6 dB per step instead of a hard gap
+            if (concealed == 0)
+                jitter_.noteUnderrun();
+            if (streamLive())
+                health.underrun(AudioHealth::SPK); // starved mid-stream, not the end of the reply
+            for (size_t i = 0; i < last_samples; i++)
+                last_frame[i] = static_cast<int16_t>(last_frame[i] / 2);
+            output->writePcm(last_frame, last_samples);
+            if (duplex_)
+                rb_aec_ref.write(reinterpret_cast<const uint8_t *>(last_frame), last_samples * sizeof(int16_t), 0);
+            checkUnderruns(true);
+            concealed++;
+        }
+        else if (earcons_.busy() || media_active_)
+        {
+            // Stream stalled: the cue / media still plays now, over silence
+            memset(last_frame, 0, FRAME_BYTES);
+            if (media_active_)
+                mixMedia(last_frame, pcm_frame_samples_);
+            earcons_.mix(last_frame, pcm_frame_samples_);
+            output->writePcm(last_frame, pcm_frame_samples_);
+            if (duplex_)
+                rb_aec_ref.write(reinterpret_cast<const uint8_t *>(last_frame), FRAME_BYTES, 0);
+            last_samples = 0; // nothing of the stream left to conceal
+            checkUnderruns(false);
         }
         else
         {
-            // No data (timeout)
+            // No data (timeout); still starving if the stream has not ended
             timeout_count++;
+            if (playing && streamLive())
+                health.underrun(AudioHealth::SPK);
             if (timeout_count % 5 == 0)
             {
                 ESP_LOGD(TAG, "Speaker: Waiting for PCM data (timeout_count=%u)", timeout_count);
@@ -652,6 +1988,8 @@ void AudioManager::spkTaskLoop()
         output->stopPlayback();
     }
 
+    health.park(AudioHealth::SPK);
     ESP_LOGW(TAG, "Speaker task ended");
+    MemTelemetry::instance().unregisterTask();
     vTaskDelete(nullptr);
 }
@@ -2,13 +2,28 @@
 
 #include <memory>
 #include <atomic>
+#include <functional>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/stream_buffer.h"
+#include "freertos/event_groups.h"
+
+#include "SpscRing.hpp"
+#include "JitterBuffer.hpp"
+#include "VoiceActivityDetector.hpp"
+#include "KeywordSpotter.hpp"
+#include "CommandRecognizer.hpp"
+#include "EchoCanceller.hpp"
+#include "VoiceFrontEnd.hpp"
+#include "PolyphaseResampler.hpp"
+#include "PacketLossConcealer.hpp"
+#include "EarconPlayer.hpp"
+#include "AudioPacket.hpp"
+#include "DmaPreset.hpp"
 
 #include "system/StateTypes.hpp"
 #include "system/StateManager.hpp"
+#include "system/PmLock.hpp"
 
 // Forward declarations
 class AudioInput;
@@ -16,7 +31,8 @@ class AudioOutput;
 class AudioCodec;
 
 // Coordinates mic/capture, codec, and speaker playback based on interaction state;
-// exposes stream buffers to other modules (e.g., NetworkManager) and no networking logic.
+// exposes SPSC rings to other modules (e.g., NetworkManager) and no networking logic.
+// Pipeline stages work in place on ring memory (acquire/commit), no staging copies.
 class AudioManager
 {
 public:
@@ -26,7 +42,7 @@ public:
     // ------------------------------------------------------------------------
     // Lifecycle
     // ------------------------------------------------------------------------
-    // Initialize input/output/codec and create stream buffers; returns false on missing deps or buffer failure.
+    // Initialize input/output/codec and allocate rings; returns false on missing deps or buffer failure.
     bool init();
 
     // Start audio tasks (mic, codec, speaker); no-op if already started.
@@ -38,7 +54,7 @@ public:
     // Lazily allocate buffers if init was skipped earlier; returns false on OOM.
     bool allocateResources();
 
-    // Free stream buffers and stop any running tasks.
+    // Free ring storage and stop any running tasks (ring objects stay valid).
     void freeResources();
     // ------------------------------------------------------------------------
     // Dependency injection
@@ -52,14 +68,87 @@ public:
     // Provide ownership of the codec used for encode/decode.
     void setCodec(std::unique_ptr<AudioCodec> cdc);
 
+    // Provide a wake-word model (optional). Without one the KWS task is not
+    // created and listening only starts from the button / server.
+    void setWakeWordModel(std::unique_ptr<KeywordModel> model);
+
+    // Provide an on-device command model (optional), sharing the wake-word
+    // MFCC front-end. Without one every command goes through the server.
+    void setCommandModel(std::unique_ptr<CommandModel> model);
+
+    // ------------------------------------------------------------------------
+    // Ring access (NetworkManager dùng)
+    // ------------------------------------------------------------------------
+    // Encoded uplink ring for microphone data (consumer: uplink task).
+    SpscRing *getMicEncodedBuffer() { return &rb_mic_encoded; }
+
+    // Encoded downlink ring for speaker data (producer: WS receive callback).
+    SpscRing *getSpeakerEncodedBuffer() { return &rb_spk_encoded; }
+
+    // Feed downlink bytes (WS task): copies into the ring and updates the
+    // jitter estimate once per packet. A packet may arrive in fragments;
+    // pass packet_end on the last one. Returns bytes accepted.
+    size_t pushDownlink(const uint8_t *data, size_t len, bool packet_end = true);
+
+    // Header of a framed downlink packet (WS task, before its payload).
+    // Tracks session / seq loss and end-of-stream; false = drop the payload
+    // (other codec, duplicate).
+    bool beginDownlinkPacket(const audio_packet::Header &h);
+
+    // Downlink packets missing from the seq stream so far.
+    uint32_t downlinkLostPackets() const { return dl_lost_packets_; }
+
+    // Smoothed downlink inter-arrival jitter (ms).
+    uint32_t downlinkJitterMs() const { return jitter_.jitterMs(); }
+
+    // Downlink frames played in place of lost audio: concealed (codec PLC or
+    // pitch repetition) / rebuilt from in-band FEC. Monotonic.
+    uint32_t downlinkConcealedFrames() const { return dl_concealed_frames_; }
+    uint32_t downlinkFecFrames() const { return dl_fec_frames_; }
+
+    // Encoded stream description (for uplink framing and the server handshake).
+    // Framed streams carry [u16 LE len][packet] per codec frame.
+    bool encodedStreamFramed() const { return framed_; }
+    const char *codecName() const;
+    uint32_t frameMs() const { return frame_ms_; }
+    size_t encodedFrameBytes() const { return enc_frame_bytes_; }
+
+    // Frames the encoder skipped because the uplink ring was full (uplink
+    // backpressure). Monotonic; the uplink task flags gaps from its delta.
+    uint32_t micDroppedFrames() const { return mic_dropped_frames_; }
+
     // ------------------------------------------------------------------------
-    // Stream buffer access (NetworkManager dùng)
+    // Uplink rate levels (congestion control in the uplink task)
     // ------------------------------------------------------------------------
-    // Encoded uplink buffer for microphone data.
-    StreamBufferHandle_t getMicEncodedBuffer() const { return sb_mic_encoded; }
+    // Level 0 = the codec's nominal rate; each higher level sends fewer
+    // bytes: Opus at a lower bitrate, ADPCM at half the mic rate (8 kHz).
+    struct UplinkLevel
+    {
+        uint16_t kbps = 0;      // payload bitrate (AudioPacket.hpp header)
+        bool half_rate = false; // PCM decimated 2:1 before the encoder
+    };
+    size_t uplinkLevels() const { return ul_level_count_; }
+    UplinkLevel uplinkLevel(size_t i) const { return ul_levels_[i < ul_level_count_ ? i : 0]; }
+    // Any task; the encoder task switches between two frames.
+    void requestUplinkLevel(uint8_t level) { ul_level_req_.store(level, std::memory_order_release); }
+    // Last switch done by the encoder: rb_mic_encoded write position of the
+    // first byte at `level`. Returns a counter bumped on every switch, so
+    // the uplink task can cut its packets there.
+    uint32_t uplinkSwitch(uint32_t &pos, uint8_t &level) const
+    {
+        const uint32_t seq = ul_switch_seq_.load(std::memory_order_acquire);
+        pos = ul_switch_pos_.load(std::memory_order_relaxed);
+        level = ul_switch_level_.load(std::memory_order_relaxed);
+        return seq;
+    }
 
-    // Encoded downlink buffer for speaker data.
-    StreamBufferHandle_t getSpeakerEncodedBuffer() const { return sb_spk_encoded; }
+    // Rate of the decoded downlink PCM (the server's native TTS rate);
+    // 0 = codec rate. The decoder task resamples it to the speaker rate and
+    // picks up a change at the next decode step.
+    void setDownlinkSampleRate(uint32_t hz) { downlink_rate_ = hz; }
+    uint32_t downlinkSampleRate() const;
+    // I2S speaker rate (advertised in the handshake)
+    uint32_t outputSampleRate() const;
 
     // ------------------------------------------------------------------------
     // Power / control
@@ -69,6 +158,100 @@ public:
 
     // Set speaker output volume (0-100%). Applies immediately if output present.
     void setVolume(uint8_t percent);
+    uint8_t getVolume() const { return volume_percent_; }
+
+    // Incremental playout: the speaker takes whatever PCM is decoded instead
+    // of whole frames, and the jitter buffer starts after one frame. Pair it
+    // with short I2S DMA buffers. Call before init().
+    void setLowLatencyPlayout(bool enable) { low_latency_ = enable; }
+    bool lowLatencyPlayout() const { return low_latency_; }
+
+    // I2S DMA shape per interaction state (DmaPreset.hpp). The speaker takes
+    // its preset when playback starts; the mic when capture resumes from
+    // idle, never in the middle of a LISTENING turn. Call before init().
+    struct DmaPresets
+    {
+        DmaPreset speaking = DmaPreset::BALANCED;     // speaker, streaming TTS
+        DmaPreset listening = DmaPreset::BALANCED;    // mic: push-to-talk / wake word
+        DmaPreset barge_in = DmaPreset::LOW_LATENCY;  // mic open over playback (duplex)
+    };
+    void setDmaPresets(const DmaPresets &p) { dma_presets_ = p; }
+
+    // ------------------------------------------------------------------------
+    // VAD / endpointing
+    // ------------------------------------------------------------------------
+    // Gate the uplink on voice activity (silence frames are not encoded).
+    void setVadEnabled(bool enable) { vad_enabled_ = enable; }
+    bool vadEnabled() const { return vad_enabled_; }
+
+    // Called from the encoder task once per utterance when trailing silence
+    // exceeds the hangover. Keep it short (post an event).
+    void onEndOfSpeech(std::function<void()> cb) { on_end_of_speech_cb = std::move(cb); }
+
+    // ------------------------------------------------------------------------
+    // Uplink front-end (noise suppression + AGC, after the AEC)
+    // ------------------------------------------------------------------------
+    // Any task; the encoder task picks the change up at its next frame.
+    void setNoiseSuppression(bool enable) { front_end_.setNsEnabled(enable); }
+    bool noiseSuppression() const { return front_end_.nsEnabled(); }
+    void setAutoGain(bool enable) { front_end_.setAgcEnabled(enable); }
+    bool autoGain() const { return front_end_.agcEnabled(); }
+    // Current AGC gain (dB); 0 while AGC is off.
+    float uplinkGainDb() const { return front_end_.agcEnabled() ? front_end_.gainDb() : 0.f; }
+
+    // ------------------------------------------------------------------------
+    // Wake word
+    // ------------------------------------------------------------------------
+    // Called from the KWS task on detection.
+    void onWakeWord(std::function<void()> cb) { on_wake_word_cb = std::move(cb); }
+    void setWakeWordEnabled(bool enable);
+    bool wakeWordAvailable() const { return kws_model_ != nullptr; }
+
+    // ------------------------------------------------------------------------
+    // Voice commands (CommandRecognizer, first seconds of a LISTENING turn)
+    // ------------------------------------------------------------------------
+    // Called from the KWS task, at most once per turn.
+    void onVoiceCommand(std::function<void(VoiceCommand)> cb) { on_voice_command_cb = std::move(cb); }
+    void setVoiceCommandsEnabled(bool enable);
+    bool voiceCommandsAvailable() const { return cmd_.ready(); }
+
+    // ------------------------------------------------------------------------
+    // Full duplex (AEC + barge-in)
+    // ------------------------------------------------------------------------
+    // Request echo cancellation so the mic stays open while SPEAKING; call
+    // before init(). Falls back to half duplex if the AEC can't allocate.
+    void setFullDuplex(bool enable) { full_duplex_ = enable; }
+    bool fullDuplex() const { return full_duplex_ && aec_.ready(); }
+
+    // Called from the encoder task when the user starts talking over playback.
+    void onBargeIn(std::function<void()> cb) { on_barge_in_cb = std::move(cb); }
+
+    // ------------------------------------------------------------------------
+    // Earcons (local cues, no network)
+    // ------------------------------------------------------------------------
+    // Mixed into the speaker output by the speaker task, which brings up I2S
+    // on its own when nothing streams. State changes trigger them (listen
+    // start / end, system error, battery critical); any task may call.
+    void playEarcon(Earcon cue);
+    void setEarconsEnabled(bool enable) { earcons_.setEnabled(enable); }
+    bool earconsEnabled() const { return earcons_.enabled(); }
+    // Sounds from the "assets" bundle replace the built-in tones (after init()).
+    size_t loadEarconBundle(const char *label = "assets") { return earcons_.loadBundle(label); }
+
+    // ------------------------------------------------------------------------
+    // Media bed (MediaPlayer: music / podcast, decoded by its own codec)
+    // ------------------------------------------------------------------------
+    // PCM ring at the speaker rate (producer: MediaPlayer decode task),
+    // allocated on first use; nullptr on OOM. Turn flushes never touch it.
+    SpscRing *openMediaRing();
+    // While active the speaker task keeps I2S up for the media when no turn
+    // is speaking and mixes it under TTS / earcons. A voice turn (LISTENING
+    // .. SPEAKING) ducks it to setMediaDuck() percent instead of stopping it.
+    void setMediaActive(bool active);
+    bool mediaActive() const { return media_active_; }
+    void setMediaDuck(uint8_t percent) { media_duck_pct_ = percent > 100 ? 100 : percent; }
+    // Speaker frames that found the media ring short while active. Monotonic.
+    uint32_t mediaUnderruns() const { return media_underruns_; }
     // ------------------------------------------------------------------------
     // Audio actions
     // ------------------------------------------------------------------------
@@ -89,7 +272,34 @@ public:
     // Stop speaking path and halt speaker playback if active.
     void stopSpeaking();
 
+    // Start the I2S clock ahead of TTS (PROCESSING) so the first frame goes
+    // straight into running DMA. Dropped after PREWARM_MAX_MS without audio.
+    void prewarmPlayback(bool enable);
+
+    // ------------------------------------------------------------------------
+    // Glitch detector
+    // ------------------------------------------------------------------------
+    // I2S DMA underruns while a stream was playing (speaker task late) and
+    // overruns while the mic was being read (mic / encoder task late). Idle
+    // DMA gaps and network starvation (concealment) are not counted.
+    struct GlitchStats
+    {
+        uint32_t spk_underruns = 0;
+        uint32_t mic_overruns = 0;
+        // Raw driver counts, idle gaps included (tx_desc_auto_clear silence)
+        uint32_t spk_dma_underflows = 0;
+        uint32_t mic_dma_overflows = 0;
+        DmaPreset spk_dma = DmaPreset::BALANCED; // shape in use
+        DmaPreset mic_dma = DmaPreset::BALANCED;
+    };
+    GlitchStats glitchStats() const;
+
 private:
+    // Read frame hints from the codec; false if the layout is unsupported.
+    bool applyCodecLayout();
+    // Fill ul_levels_ from what the codec can do (init).
+    void buildUplinkLevels();
+
     // ------------------------------------------------------------------------
     // State callback
     // ------------------------------------------------------------------------
@@ -97,19 +307,79 @@ private:
     void handleInteractionState(state::InteractionState s,
                                 state::InputSource src);
 
+    // ------------------------------------------------------------------------
+    // Uplink helpers (encoder task only)
+    // ------------------------------------------------------------------------
+    // Encode one PCM frame into rb_mic_encoded; false if the ring is full.
+    bool encodeFrame(const int16_t *pcm);
+    // Switch to uplink level `level` before the next encoded frame.
+    void applyUplinkLevel(uint8_t level);
+
+    // Run VAD on one frame and encode / hold it in the pre-roll accordingly.
+    // While not listening (wake word armed) frames only fill the pre-roll.
+    void processMicFrame(const int16_t *pcm, bool live);
+    void holdPreroll(const int16_t *pcm);
+    void flushPreroll();
+
+    // Always-on capture for the wake word while IDLE.
+    void armWakeWord(bool arm);
+    // Command window at the start of a LISTENING turn.
+    void armCommands(bool arm);
+    // Decimated copy of a mic frame into rb_kws_pcm (mic task).
+    void feedWakeWord(const int16_t *pcm, size_t samples);
+
+    // Run the AEC on one mic frame against the matching speaker reference.
+    const int16_t *echoCancel(const int16_t *pcm);
+    // Leave the SPEAKING capture; keep_capture when LISTENING takes over.
+    void endDuplex(bool keep_capture);
+
+    // Rebuild the downlink resampler for `stream_rate` (decoder task).
+    void configureDownlinkRate(uint32_t stream_rate);
+
+    // One downlink frame into rb_spk_pcm (decoder task): decoded from
+    // `encoded`, rebuilt from the FEC in `encoded` (the next packet), or
+    // concealed. FEC / conceal fall back to concealment; false = ring full.
+    enum class DlFrame : uint8_t
+    {
+        DECODE,
+        FEC,
+        CONCEAL
+    };
+    bool emitDownlinkFrame(const uint8_t *encoded, size_t len, DlFrame kind);
+    // Bytes before the next loss / sync mark (UINT32_MAX if none); stale
+    // marks (behind the read position after a reset) are dropped.
+    uint32_t dlBytesToMark();
+    // The read position reached the next mark: conceal the lost frames,
+    // then resync the decoder.
+    void applyDlMark();
+
+    // Speaker DMA preset for a playback about to start (speaker task, I2S stopped).
+    void shapeSpeakerDma();
+    // Downlink still arriving (no EOU, packet within the last second): an
+    // empty speaker ring now is starvation, not the end of the reply.
+    bool streamLive() const { return !dl_eou_ && jitter_.msSinceArrival() < 1000; }
+    // Add up to `samples` media samples into dst at the duck gain (speaker
+    // task); returns samples taken.
+    size_t mixMedia(int16_t *dst, size_t samples);
+
 private:
     // ------------------------------------------------------------------------
     // Tasks
     // ------------------------------------------------------------------------
     // FreeRTOS task trampolines.
     static void micTaskEntry(void *arg);
-    static void codecTaskEntry(void *arg);
+    static void encTaskEntry(void *arg);
+    static void decTaskEntry(void *arg);
     static void spkTaskEntry(void *arg);
+    static void kwsTaskEntry(void *arg);
 
-    // Task loops for mic capture/encode, codec decode/encode, and speaker playback.
+    // Task loops: mic capture, uplink encode, downlink decode, speaker
+    // playback. Encoder and decoder block only on their own input ring.
     void micTaskLoop();
-    void codecTaskLoop();
+    void encTaskLoop();
+    void decTaskLoop();
     void spkTaskLoop();
+    void kwsTaskLoop();
 
 private:
     // ------------------------------------------------------------------------
@@ -120,34 +390,197 @@ private:
     std::atomic<bool> speaking{false};
     std::atomic<bool> power_saving{false};
 
+    // CPU at max while capturing or playing a turn (codec headroom); I2S
+    // itself keeps the APB clock up while it runs
+    PmLock busy_pm_;
+    void updateBusyLock() { busy_pm_.hold(listening || speaking || media_active_); }
+
+    // Idle tasks park on their bit in wake_evt_ (no timeout, no polling);
+    // every state change sets the bits so they re-evaluate right away.
+    // An event group rather than task notifications: those belong to the
+    // SpscRing waits, and bits stay safe to set while a task is exiting.
+    // Encoder / decoder blocked on their input ring are interrupted too.
+    static constexpr EventBits_t WAKE_MIC = 1u << 0;
+    static constexpr EventBits_t WAKE_ENC = 1u << 1;
+    static constexpr EventBits_t WAKE_SPK = 1u << 2;
+    static constexpr EventBits_t WAKE_KWS = 1u << 3;
+    static constexpr EventBits_t WAKE_DEC = 1u << 4;
+    static constexpr EventBits_t WAKE_ALL = WAKE_MIC | WAKE_ENC | WAKE_SPK | WAKE_KWS | WAKE_DEC;
+    EventGroupHandle_t wake_evt_ = nullptr;
+    void wakeTasks(EventBits_t bits = WAKE_ALL);
+    // Block until `bit` is set (consumes it) or `wait` elapses.
+    void parkUntilWoken(EventBits_t bit, TickType_t wait = portMAX_DELAY);
+
     state::InputSource current_source = state::InputSource::UNKNOWN;
 
+    // Frame layout from codec hints (applyCodecLayout())
+    size_t pcm_frame_samples_ = 256; // PCM samples per codec frame (mic, decode, I2S)
+    size_t enc_frame_bytes_ = 128;   // nominal encoded bytes per frame
+    size_t enc_frame_max_ = 128;     // largest encoded packet
+    bool framed_ = false;            // length-prefixed variable-size packets
+    uint32_t frame_ms_ = 16;
+
+    std::atomic<uint32_t> mic_dropped_frames_{0};
+    std::atomic<uint32_t> spk_glitches_{0};
+    std::atomic<uint32_t> mic_glitches_{0};
+
+    // DMA presets (see setDmaPresets()); spk_queue_ms_ is the speaker queue
+    // depth now, aec_queue_ms_ the one the AEC bulk delay matches (encoder task)
+    DmaPresets dma_presets_;
+    std::atomic<DmaPreset> spk_dma_{DmaPreset::BALANCED};
+    std::atomic<DmaPreset> mic_dma_{DmaPreset::BALANCED};
+    std::atomic<uint32_t> spk_queue_ms_{0};
+    uint32_t aec_queue_ms_ = 0;
+
     // ------------------------------------------------------------------------
     // Components
     // ------------------------------------------------------------------------
     std::unique_ptr<AudioInput> input;
     std::unique_ptr<AudioOutput> output;
+    uint8_t volume_percent_ = 60; // last setVolume() (retained over deep sleep)
+    // Encoder side used by the encoder task only, decoder side by the
+    // decoder task only; other tasks request resets through the flag
     std::unique_ptr<AudioCodec> codec;
+    std::atomic<bool> enc_reset_pending_{false};
 
     // ------------------------------------------------------------------------
-    // Stream buffers (FreeRTOS - thread-safe, no race conditions)
+    // SPSC rings (one producer task + one consumer task each)
+    // Objects live as long as the manager; only storage is freed/reallocated,
+    // so pointers handed out via getters stay valid.
     // ------------------------------------------------------------------------
-    StreamBufferHandle_t sb_mic_pcm;     // PCM from mic
-    StreamBufferHandle_t sb_mic_encoded; // Encoded uplink
-    StreamBufferHandle_t sb_spk_pcm;     // PCM to speaker
-    StreamBufferHandle_t sb_spk_encoded; // Encoded downlink
+    SpscRing rb_mic_pcm;     // PCM from mic      (mic task     → encoder task)
+    SpscRing rb_mic_encoded; // Encoded uplink    (encoder task → WS uplink task)
+    SpscRing rb_spk_pcm;     // PCM to speaker    (decoder task → speaker task)
+    SpscRing rb_spk_encoded; // Encoded downlink  (WS callback  → decoder task)
+
+    // Playout-delay control for the downlink (decode starts at its target depth)
+    JitterBuffer jitter_;
+    // SPEAKING entry / first downlink byte times, for the time-to-first-audio log
+    std::atomic<uint32_t> speak_start_ms_{0};
+    std::atomic<uint32_t> dl_first_rx_ms_{0};
+    size_t dl_packet_bytes_ = 0; // fragments of the current downlink packet (WS task)
+    // Framed downlink bookkeeping (WS task; dl_eou_ read by decoder task)
+    bool dl_have_session_ = false;
+    uint16_t dl_session_ = 0;
+    uint16_t dl_next_seq_ = 0;
+    std::atomic<uint32_t> dl_lost_packets_{0};
+    std::atomic<bool> dl_eou_{false}; // sender marked end of stream: drain, no jitter wait
+    uint32_t dl_last_ts_ = 0; // timestamp_ms of the last packet (WS task)
+    bool dl_have_ts_ = false;
+
+    // Loss / sync marks at rb_spk_encoded stream positions: WS task pushes
+    // one before a packet that follows a gap or carries decoder state, the
+    // decoder task applies it when its read position gets there
+    struct DlMark
+    {
+        uint32_t pos;          // rb_spk_encoded write position of the packet
+        uint16_t lost_frames;  // frames to conceal before it
+        bool sync;             // ADPCM state below is valid
+        uint8_t sync_index;
+        int16_t sync_predictor;
+    };
+    static constexpr uint32_t DL_MARKS = 32;
+    DlMark dl_marks_[DL_MARKS] = {};
+    std::atomic<uint32_t> dl_mark_head_{0}; // WS task
+    std::atomic<uint32_t> dl_mark_tail_{0}; // decoder task
+    PacketLossConcealer plc_;               // decoder task
+    std::atomic<uint32_t> dl_concealed_frames_{0};
+    std::atomic<uint32_t> dl_fec_frames_{0};
+
+    // Playout latency (see setLowLatencyPlayout() / prewarmPlayback())
+    std::atomic<bool> low_latency_{false};
+    std::atomic<bool> prewarm_{false};
+    std::atomic<uint32_t> prewarm_since_ms_{0};
+
+    // Uplink VAD. Detector and pre-roll are owned by the encoder task;
+    // startListening() only raises vad_reset_pending_.
+    VoiceActivityDetector vad_;
+    std::atomic<bool> vad_enabled_{true};
+    std::atomic<bool> vad_reset_pending_{false};
+    bool eos_sent_ = false; // END_OF_SPEECH already reported this turn
+    std::function<void()> on_end_of_speech_cb = nullptr;
+
+    // Last preroll_frames_ unsent frames, sent ahead of the VAD onset (or
+    // right after a wake word) so the first syllable is not clipped.
+    std::unique_ptr<int16_t[]> preroll_;
+    size_t preroll_frames_ = 0; // capacity (whole frames)
+    size_t preroll_head_ = 0;   // next slot to overwrite
+    size_t preroll_count_ = 0;  // frames held
+    std::atomic<bool> preroll_keep_{false}; // wake-word turn: keep audio captured before LISTENING
+
+    // Wake word: mic task → rb_kws_pcm (decimated) → KWS task (core 0)
+    std::unique_ptr<KeywordModel> kws_model_;
+    KeywordSpotter kws_;
+    SpscRing rb_kws_pcm;
+    std::atomic<bool> kws_enabled_{true};
+    std::atomic<bool> kws_armed_{false};
+    std::atomic<bool> kws_reset_pending_{false};
+    uint32_t kws_decim_ = 2;   // mic rate / KWS rate
+    int16_t kws_prev_ = 0;     // decimator history (mic task)
+    std::function<void()> on_wake_word_cb = nullptr;
+
+    // Voice commands: same ring and front-end (kws_), own classifier
+    std::unique_ptr<CommandModel> cmd_model_;
+    CommandRecognizer cmd_;
+    std::atomic<bool> cmd_enabled_{true};
+    std::atomic<bool> cmd_armed_{false};
+    std::atomic<bool> cmd_reset_pending_{false};
+    std::function<void(VoiceCommand)> on_voice_command_cb = nullptr;
+
+    // Downlink rate conversion (decoder task): decode → dl_pcm_ → resampler_ → rb_spk_pcm
+    std::atomic<uint32_t> downlink_rate_{0}; // requested, 0 = codec rate
+    uint32_t dl_rate_active_ = 0;            // rate resampler_ was built for
+    PolyphaseResampler resampler_;
+    std::unique_ptr<int16_t[]> dl_pcm_;      // one decoded frame at the stream rate
+
+    // NS + AGC between the AEC and VAD / encoder (encoder task)
+    VoiceFrontEnd front_end_;
+
+    // Uplink rate levels: requested by the uplink task, applied by the
+    // encoder task, which publishes where in rb_mic_encoded it switched
+    static constexpr size_t UL_LEVELS_MAX = 4;
+    UplinkLevel ul_levels_[UL_LEVELS_MAX];
+    size_t ul_level_count_ = 1;
+    std::atomic<uint8_t> ul_level_req_{0};
+    uint8_t ul_level_ = 0; // encoder task
+    std::atomic<uint32_t> ul_switch_pos_{0};
+    std::atomic<uint8_t> ul_switch_level_{0};
+    std::atomic<uint32_t> ul_switch_seq_{0};
+    PolyphaseResampler ul_decim_;          // half-rate levels (encoder task)
+    std::unique_ptr<int16_t[]> ul_half_pcm_;
+
+    // Full duplex: speaker task → rb_aec_ref (reference) → encoder task AEC
+    EchoCanceller aec_;
+    SpscRing rb_aec_ref;
+    std::atomic<bool> full_duplex_{false}; // requested
+    std::atomic<bool> duplex_{false};      // mic open during the current SPEAKING
+    bool barge_sent_ = false;              // barge-in reported this SPEAKING (encoder task)
+
+    // Local cues: triggered from state callbacks, mixed by the speaker task
+    EarconPlayer earcons_;
 
-    // PCM decode buffer removed; speaker task manages its own chunk buffer
+    // Media bed: MediaPlayer decode task → rb_media_pcm → speaker task
+    SpscRing rb_media_pcm;
+    std::atomic<bool> media_active_{false};
+    std::atomic<bool> media_ducked_{false}; // voice turn running
+    std::atomic<uint8_t> media_duck_pct_{20};
+    std::atomic<uint32_t> media_underruns_{0};
+    int32_t media_gain_q8_ = 256; // speaker task: gain now, ramps to the target
+    std::function<void()> on_barge_in_cb = nullptr;
 
     // ------------------------------------------------------------------------
     // Tasks
     // ------------------------------------------------------------------------
     TaskHandle_t mic_task = nullptr;
-    TaskHandle_t codec_task = nullptr;
+    TaskHandle_t enc_task = nullptr;
+    TaskHandle_t dec_task = nullptr;
     TaskHandle_t spk_task = nullptr;
+    TaskHandle_t kws_task = nullptr;
 
     // ------------------------------------------------------------------------
     // StateManager subscription
     // ------------------------------------------------------------------------
     int sub_interaction_id = -1;
+    int sub_system_id = -1;
+    int sub_power_id = -1;
 };
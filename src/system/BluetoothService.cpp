@@ -21,8 +21,7 @@ BluetoothService::~BluetoothService()
 
 bool BluetoothService::init(const std::string &adv_name, const std::vector<WifiInfo> &cached_networks, const ConfigData *current_config)
 {
-    static bool s_bt_initialized = false;
-    if (s_bt_initialized)
+    if (bt_up_)
         return true;
 
     adv_name_ = adv_name;
@@ -46,6 +45,9 @@ bool BluetoothService::init(const std::string &adv_name, const std::vector<WifiI
     esp_ble_gatts_register_callback(BluetoothService::gattsEventHandler);
     esp_ble_gap_register_callback(BluetoothService::gapEventHandler);
     esp_ble_gatts_app_register(0);
+    // Answer the client's MTU request with up to 517: the scan fits one notification
+    if (esp_ble_gatt_set_local_mtu(LOCAL_MTU) != ESP_OK)
+        ESP_LOGW(TAG, "Local MTU %u rejected, keeping default", (unsigned)LOCAL_MTU);
 
     device_id_str_ = getDeviceEfuseID();
 
@@ -71,7 +73,7 @@ bool BluetoothService::init(const std::string &adv_name, const std::vector<WifiI
         
         ESP_LOGI(TAG, "WiFi list prepared: %d networks", wifi_networks_.size());
     }
-    s_bt_initialized = true;
+    bt_up_ = true;
     return true;
 }
 
@@ -129,6 +131,23 @@ void BluetoothService::stop()
     started_ = false;
 }
 
+void BluetoothService::shutdown()
+{
+    stop();
+    if (!bt_up_)
+        return;
+    // Disabling bluedroid drops the link; the controller then stops its radio
+    // and sleep-clock activity (memory kept: init() can bring it back)
+    esp_bluedroid_disable();
+    esp_bluedroid_deinit();
+    esp_bt_controller_disable();
+    esp_bt_controller_deinit();
+    bt_up_ = false;
+    conn_id_ = 0xFFFF;
+    mtu_size_ = 23;
+    ESP_LOGI(TAG, "BLE controller powered down");
+}
+
 void BluetoothService::gattsEventHandler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param)
 {
     if (!s_instance)
@@ -143,7 +162,8 @@ void BluetoothService::gattsEventHandler(esp_gatts_cb_event_t event, esp_gatt_if
         service_id.id.inst_id = 0x00;
         service_id.id.uuid.len = ESP_UUID_LEN_16;
         service_id.id.uuid.uuid.uuid16 = SVC_UUID_CONFIG;
-        esp_ble_gatts_create_service(gatts_if, &service_id, 25);
+        // 13 characteristics x 2 handles + WIFI_LIST CCCD + service
+        esp_ble_gatts_create_service(gatts_if, &service_id, 32);
         break;
     }
 
@@ -171,22 +191,36 @@ void BluetoothService::gattsEventHandler(esp_gatts_cb_event_t event, esp_gatt_if
         add_c(CHR_UUID_BUILD_INFO, ESP_GATT_CHAR_PROP_BIT_READ);
         add_c(CHR_UUID_SAVE_CMD, ESP_GATT_CHAR_PROP_BIT_WRITE);
         add_c(CHR_UUID_DEVICE_ID, ESP_GATT_CHAR_PROP_BIT_READ);
-        add_c(CHR_UUID_WIFI_LIST, ESP_GATT_CHAR_PROP_BIT_READ);
+        add_c(CHR_UUID_WIFI_LIST, ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_NOTIFY);
+        {
+            // CCCD right behind WIFI_LIST (requests run in order): enables the packed stream
+            esp_bt_uuid_t cccd_uuid;
+            cccd_uuid.len = ESP_UUID_LEN_16;
+            cccd_uuid.uuid.uuid16 = ESP_GATT_UUID_CHAR_CLIENT_CONFIG;
+            esp_ble_gatts_add_char_descr(s_instance->service_handle_, &cccd_uuid,
+                                         ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE, NULL, NULL);
+        }
         // New: WebSocket URL characteristic (read/write)
         add_c(CHR_UUID_WS_URL, ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_WRITE);
         // New: MQTT URL characteristic (read/write)
         add_c(CHR_UUID_MQTT_URL, ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_WRITE);
+        // All settings + commit in one write (TLV)
+        add_c(CHR_UUID_CONFIG_BATCH, ESP_GATT_CHAR_PROP_BIT_WRITE);
         break;
     }
 
     case ESP_GATTS_ADD_CHAR_EVT:
     {
         static int char_idx = 0;
-        if (char_idx < 12)
+        if (char_idx < 13)
             s_instance->char_handles[char_idx++] = param->add_char.attr_handle;
         break;
     }
 
+    case ESP_GATTS_ADD_CHAR_DESCR_EVT:
+        s_instance->wifi_cccd_handle_ = param->add_char_descr.attr_handle;
+        break;
+
     case ESP_GATTS_MTU_EVT:
     {
         s_instance->mtu_size_ = param->mtu.mtu;
@@ -196,11 +230,23 @@ void BluetoothService::gattsEventHandler(esp_gatts_cb_event_t event, esp_gatt_if
     }
 
     case ESP_GATTS_CONNECT_EVT:
+    {
         s_instance->conn_id_ = param->connect.conn_id;
         // Reset WS URL auth on new connection
         s_instance->url_unlocked_ = false;
+        s_instance->mtu_size_ = 23;
         ESP_LOGI(TAG, "BLE Connected: conn_id=%d (ws_url_auth=OFF)", param->connect.conn_id);
+
+        // Short connection interval for the provisioning burst (7.5-15 ms)
+        esp_ble_conn_update_params_t conn = {};
+        memcpy(conn.bda, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+        conn.min_int = 0x06;
+        conn.max_int = 0x0C;
+        conn.latency = 0;
+        conn.timeout = 400; // 4 s
+        esp_ble_gap_update_conn_params(&conn);
         break;
+    }
 
     case ESP_GATTS_DISCONNECT_EVT:
         // Reset ws_url auth on disconnect
@@ -288,16 +334,141 @@ void BluetoothService::handleWrite(esp_ble_gatts_cb_param_t *param)
             ESP_LOGI(TAG, "MQTT URL set (%d bytes): %.*s", (int)l, (int)l, reinterpret_cast<char *>(v));
         }
     }
-    else if (h == char_handles[7])
+    bool save = false;
+    bool stream = false;
+    esp_gatt_status_t status = ESP_GATT_OK;
+    if (h == char_handles[7])
+        save = l > 0 && v[0] == 0x01;
+    else if (h == char_handles[12])
     {
-        if (l > 0 && v[0] == 0x01 && config_cb_)
-            config_cb_(temp_cfg_);
+        save = applyBatch(v, l);
+        if (!save)
+            status = ESP_GATT_INVALID_ATTR_LEN;
     }
+    else if (h == wifi_cccd_handle_ && wifi_cccd_handle_ != 0)
+        stream = l >= 2 && (v[0] & 0x01);
 
+    // Acknowledge first: the save callback may restart the device
     if (param->write.need_rsp)
     {
-        esp_ble_gatts_send_response(gatts_if_, param->write.conn_id, param->write.trans_id, ESP_GATT_OK, NULL);
+        esp_ble_gatts_send_response(gatts_if_, param->write.conn_id, param->write.trans_id, status, NULL);
     }
+
+    if (stream)
+        notifyScanResults();
+    if (save && config_cb_)
+        config_cb_(temp_cfg_);
+}
+
+bool BluetoothService::applyBatch(const uint8_t *v, uint16_t len)
+{
+    // Staged on a copy: a malformed batch changes nothing
+    ConfigData cfg = temp_cfg_;
+    bool unlocked = url_unlocked_;
+    size_t pos = 0;
+    while (pos + 2 <= len)
+    {
+        const uint8_t type = v[pos];
+        const uint8_t n = v[pos + 1];
+        const char *val = reinterpret_cast<const char *>(v + pos + 2);
+        if (pos + 2 + n > len)
+            break;
+        pos += 2 + n;
+
+        switch (type)
+        {
+        case BATCH_DEVICE_NAME:
+            cfg.device_name.assign(val, n);
+            break;
+        case BATCH_VOLUME:
+            if (n >= 1)
+                cfg.volume = std::min<uint8_t>(static_cast<uint8_t>(val[0]), 100);
+            break;
+        case BATCH_BRIGHTNESS:
+            if (n >= 1)
+                cfg.brightness = std::min<uint8_t>(static_cast<uint8_t>(val[0]), 100);
+            break;
+        case BATCH_SSID:
+            cfg.ssid.assign(val, n);
+            break;
+        case BATCH_PASS:
+            cfg.pass.assign(val, n);
+            break;
+        case BATCH_AUTH:
+            unlocked = std::string(val, n) == WS_URL_AUTH_TOKEN;
+            if (!unlocked)
+                ESP_LOGW(TAG, "Batch: invalid URL auth token");
+            break;
+        case BATCH_WS_URL:
+        case BATCH_MQTT_URL:
+            if (!unlocked)
+            {
+                ESP_LOGW(TAG, "Batch: URL write blocked (auth required)");
+                return false;
+            }
+            (type == BATCH_WS_URL ? cfg.ws_url : cfg.mqtt_url).assign(val, n);
+            break;
+        case BATCH_COMMIT:
+            if (pos != len)
+                break; // commit must be the last record
+            temp_cfg_ = cfg;
+            url_unlocked_ = unlocked;
+            ESP_LOGI(TAG, "Config batch: %u B committed (ssid '%s')", (unsigned)len, cfg.ssid.c_str());
+            return true;
+        default:
+            ESP_LOGW(TAG, "Batch: unknown field 0x%02x skipped", type);
+            break;
+        }
+    }
+    ESP_LOGW(TAG, "Config batch malformed or without commit (%u B)", (unsigned)len);
+    return false;
+}
+
+size_t BluetoothService::packScanFrame(const std::vector<WifiInfo> &nets, size_t start, uint8_t seq,
+                                       uint8_t *out, size_t cap, size_t *next)
+{
+    size_t len = 3;
+    uint8_t count = 0;
+    size_t i = start;
+    for (; i < nets.size() && count < 255; i++)
+    {
+        // SSIDs are ≤ 32 bytes; a frame always takes at least one network
+        const size_t ssid_len = std::min<size_t>(nets[i].ssid.size(), 32);
+        const size_t rec = 2 + std::min(ssid_len, cap - 5);
+        if (len + rec > cap)
+            break;
+        out[len] = static_cast<uint8_t>(static_cast<int8_t>(std::clamp(nets[i].rssi, -128, 127)));
+        out[len + 1] = static_cast<uint8_t>(rec - 2);
+        memcpy(out + len + 2, nets[i].ssid.data(), rec - 2);
+        len += rec;
+        count++;
+    }
+    out[0] = seq;
+    out[1] = i >= nets.size() ? 0x01 : 0x00;
+    out[2] = count;
+    *next = i;
+    return len;
+}
+
+void BluetoothService::notifyScanResults()
+{
+    // ATT notification header is 3 bytes
+    const size_t cap = std::min<size_t>(mtu_size_ > 3 ? mtu_size_ - 3 : 20, LOCAL_MTU - 3);
+    uint8_t frame[LOCAL_MTU - 3];
+    size_t next = 0;
+    uint8_t seq = 0;
+    do
+    {
+        const size_t len = packScanFrame(wifi_networks_, next, seq, frame, cap, &next);
+        if (esp_ble_gatts_send_indicate(gatts_if_, conn_id_, char_handles[9], len, frame, false) != ESP_OK)
+        {
+            ESP_LOGW(TAG, "Scan notify %u failed", (unsigned)seq);
+            return;
+        }
+        seq++;
+    } while (next < wifi_networks_.size());
+    ESP_LOGI(TAG, "Scan sent: %u networks in %u frames (MTU %u)", (unsigned)wifi_networks_.size(), (unsigned)seq,
+             (unsigned)mtu_size_);
 }
 
 void BluetoothService::handleRead(esp_ble_gatts_cb_param_t *param, esp_gatt_if_t gatts_if)
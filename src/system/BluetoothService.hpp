@@ -15,6 +15,18 @@
 struct WifiInfo;
 
 // BLE GATT service used to provision basic device settings and Wi‑Fi credentials.
+//
+// Fast path (one connection, ~1 s): the client asks for MTU 517, enables
+// notifications on WIFI_LIST and gets the whole scan as packed frames, then
+// writes every setting in one CONFIG_BATCH TLV ending with a commit.
+// The old per-read "ssid:rssi" / "END" list and per-field writes + SAVE_CMD
+// still work for older apps.
+//
+// WIFI_LIST notification frame (≤ MTU - 3 bytes):
+//   u8 seq, u8 flags (bit0 = last frame), u8 count, then count records of
+//   i8 rssi, u8 ssid_len, ssid bytes. An empty scan = one frame, count 0.
+// CONFIG_BATCH write: TLV records u8 type, u8 len, value (BatchField);
+//   URLs need AUTH first (same token as the WS_URL gate); COMMIT saves.
 class BluetoothService
 {
 public:
@@ -45,6 +57,10 @@ public:
     // Stop advertising and keep configuration state intact.
     void stop();
 
+    // Provisioning done: drop the link and power the BLE controller down
+    // (bluedroid + controller disabled). Not from a GATT/GAP callback.
+    void shutdown();
+
     // Register callback triggered when the client sends the save command.
     void onConfigComplete(OnConfigComplete cb) { config_cb_ = cb; }
 
@@ -61,6 +77,27 @@ public:
     static constexpr uint16_t CHR_UUID_WIFI_LIST = 0xFF0B;
     static constexpr uint16_t CHR_UUID_WS_URL = 0xFF0C;
     static constexpr uint16_t CHR_UUID_MQTT_URL = 0xFF0D;
+    static constexpr uint16_t CHR_UUID_CONFIG_BATCH = 0xFF0E;
+
+    static constexpr uint16_t LOCAL_MTU = 517; // ATT max: one frame carries a whole scan
+
+    enum BatchField : uint8_t
+    {
+        BATCH_DEVICE_NAME = 0x01,
+        BATCH_VOLUME = 0x02,
+        BATCH_BRIGHTNESS = 0x03,
+        BATCH_SSID = 0x04,
+        BATCH_PASS = 0x05,
+        BATCH_WS_URL = 0x06,
+        BATCH_MQTT_URL = 0x07,
+        BATCH_AUTH = 0x08,   // URL gate token
+        BATCH_COMMIT = 0xFF, // save (len 0), last record
+    };
+
+    // Pack networks [start, ...) into one notification frame of at most `cap`
+    // bytes; returns the frame length, *next = first network not packed.
+    static size_t packScanFrame(const std::vector<WifiInfo> &nets, size_t start, uint8_t seq,
+                                uint8_t *out, size_t cap, size_t *next);
 
 private:
     static BluetoothService *s_instance;
@@ -77,13 +114,20 @@ private:
     // Serve characteristic reads with the latest config, version, and Wi‑Fi list.
     void handleRead(esp_ble_gatts_cb_param_t *param, esp_gatt_if_t gatts_if);
 
+    // CONFIG_BATCH payload; true when it ended with a valid COMMIT.
+    bool applyBatch(const uint8_t *v, uint16_t len);
+
+    // Whole scan as notifications on WIFI_LIST (client enabled its CCCD).
+    void notifyScanResults();
+
 private:
     std::string adv_name_;
     bool started_ = false;
     esp_gatt_if_t gatts_if_ = 0; // Stores GATT interface assigned at service creation
     uint16_t conn_id_ = 0xFFFF;
     uint16_t service_handle_ = 0;
-    uint16_t char_handles[12] = {0}; // Handles for the 12 characteristics (added WS_URL and MQTT_URL)
+    uint16_t char_handles[13] = {0}; // Handles for the 13 characteristics (added WS_URL, MQTT_URL, CONFIG_BATCH)
+    uint16_t wifi_cccd_handle_ = 0;  // WIFI_LIST notification switch (0x2902)
 
     ConfigData temp_cfg_;
     OnConfigComplete config_cb_ = nullptr;
@@ -96,6 +140,7 @@ private:
     std::string device_id_str_;
     std::vector<WifiInfo> wifi_networks_;  // Cached networks announced over BLE
     size_t wifi_read_index_ = 0;           // Streaming cursor for Wi‑Fi list reads
-    uint16_t mtu_size_ = 23;               // Current BLE MTU (default 23, up to ~512)
+    uint16_t mtu_size_ = 23;               // Current BLE MTU (default 23, up to LOCAL_MTU)
+    bool bt_up_ = false;                   // controller + bluedroid enabled
     esp_ble_adv_params_t adv_params_;      // Saved advertising params for restart
 };
\ No newline at end of file
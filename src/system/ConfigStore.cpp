@@ -0,0 +1,363 @@
+#include "ConfigStore.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "nvs.h"
+
+static const char *TAG = "ConfigStore";
+
+namespace
+{
+    constexpr const char *NVS_NAMESPACE = "storage";
+
+    struct KeyDef
+    {
+        const char *nvs;
+        uint16_t cap; // string slot bytes incl. NUL; 0 = u8 key
+        uint8_t def_u8;
+        const char *def_str; // returned while the slot is empty
+    };
+
+    // Same order as ConfigStore::Key
+    constexpr KeyDef KEYS[] = {
+        {"device_name", 33, 0, "PTalk"},
+        {"ssid", 33, 0, ""},
+        {"pass", 65, 0, ""},
+        {"ws_url", 192, 0, ""},
+        {"mqtt_url", 192, 0, ""},
+        {"audio_codec", 9, 0, "adpcm"},
+        {"volume", 0, 60, nullptr},
+        {"brightness", 0, 100, nullptr},
+        {"ns", 0, 1, nullptr},
+        {"agc", 0, 1, nullptr},
+    };
+    constexpr size_t KEY_COUNT = static_cast<size_t>(ConfigStore::Key::COUNT);
+    static_assert(sizeof(KEYS) / sizeof(KEYS[0]) == KEY_COUNT, "KEYS out of sync with ConfigStore::Key");
+    static_assert(KEY_COUNT <= 32, "dirty mask is 32 bits");
+
+    constexpr size_t offsetOf(size_t i)
+    {
+        size_t off = 0;
+        for (size_t j = 0; j < i; j++)
+            off += KEYS[j].cap;
+        return off;
+    }
+    static_assert(offsetOf(KEY_COUNT) <= ConfigStore::STR_POOL, "STR_POOL too small");
+
+    constexpr size_t MAX_STR = 192; // largest cap: flush() copies one string at a time
+
+    size_t index(ConfigStore::Key k)
+    {
+        return static_cast<size_t>(k);
+    }
+} // namespace
+
+ConfigStore &ConfigStore::instance()
+{
+    static ConfigStore inst;
+    return inst;
+}
+
+ConfigStore::ConfigStore()
+{
+    for (size_t i = 0; i < KEY_COUNT; i++)
+        u8_[i] = KEYS[i].def_u8;
+}
+
+// ============================================================================
+// Load (boot, before any other task uses the store)
+// ============================================================================
+bool ConfigStore::load()
+{
+    if (loaded_)
+        return true;
+
+    nvs_handle_t h;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &h) == ESP_OK)
+    {
+        for (size_t i = 0; i < KEY_COUNT; i++)
+        {
+            if (!KEYS[i].cap)
+            {
+                nvs_get_u8(h, KEYS[i].nvs, &u8_[i]); // unset: default stays
+                continue;
+            }
+            char *slot = str_ + offsetOf(i);
+            size_t len = KEYS[i].cap;
+            const esp_err_t e = nvs_get_str(h, KEYS[i].nvs, slot, &len);
+            if (e != ESP_OK)
+                slot[0] = '\0';
+            if (e == ESP_ERR_NVS_INVALID_LENGTH)
+                ESP_LOGW(TAG, "'%s' longer than %u bytes, ignored", KEYS[i].nvs, (unsigned)KEYS[i].cap - 1);
+        }
+        nvs_close(h);
+    }
+    else
+    {
+        ESP_LOGI(TAG, "storage not found, using defaults");
+    }
+
+    loaded_ = true;
+    // Every esp_restart() path (reboot command, OTA, provisioning) flushes
+    if (esp_register_shutdown_handler(&ConfigStore::onShutdown) != ESP_OK)
+        ESP_LOGW(TAG, "No shutdown hook: changes since the last flush are lost on restart");
+    return true;
+}
+
+void ConfigStore::onShutdown()
+{
+    instance().flush();
+}
+
+// ============================================================================
+// Get / set (RAM only)
+// ============================================================================
+uint8_t ConfigStore::getU8(Key k) const
+{
+    const size_t i = index(k);
+    if (i >= KEY_COUNT)
+        return 0;
+    portENTER_CRITICAL(&lock_);
+    const uint8_t v = u8_[i];
+    portEXIT_CRITICAL(&lock_);
+    return v;
+}
+
+size_t ConfigStore::getStr(Key k, char *out, size_t cap) const
+{
+    if (!out || !cap)
+        return 0;
+    out[0] = '\0';
+    const size_t i = index(k);
+    if (i >= KEY_COUNT || !KEYS[i].cap)
+        return 0;
+
+    portENTER_CRITICAL(&lock_);
+    const char *slot = str_ + offsetOf(i);
+    const char *src = slot[0] ? slot : KEYS[i].def_str;
+    const size_t n = std::min(strlen(src), cap - 1);
+    memcpy(out, src, n);
+    out[n] = '\0';
+    portEXIT_CRITICAL(&lock_);
+    return n;
+}
+
+std::string ConfigStore::getString(Key k) const
+{
+    char buf[MAX_STR];
+    const size_t n = getStr(k, buf, sizeof(buf));
+    return std::string(buf, n);
+}
+
+void ConfigStore::markDirty(size_t i)
+{
+    const int64_t now = esp_timer_get_time();
+    if (!dirty_mask_)
+        first_dirty_us_ = now;
+    last_set_us_ = now;
+    dirty_mask_ |= 1u << i;
+    stats_.sets++;
+}
+
+bool ConfigStore::setU8(Key k, uint8_t v)
+{
+    const size_t i = index(k);
+    if (i >= KEY_COUNT || KEYS[i].cap)
+        return false;
+
+    portENTER_CRITICAL(&lock_);
+    const bool changed = u8_[i] != v;
+    if (changed)
+    {
+        u8_[i] = v;
+        markDirty(i);
+    }
+    portEXIT_CRITICAL(&lock_);
+
+    if (changed && dirty_hook_)
+        dirty_hook_();
+    return changed;
+}
+
+bool ConfigStore::setStr(Key k, const char *v)
+{
+    const size_t i = index(k);
+    if (i >= KEY_COUNT || !KEYS[i].cap)
+        return false;
+    if (!v)
+        v = "";
+    const size_t len = strlen(v);
+    if (len >= KEYS[i].cap)
+    {
+        ESP_LOGW(TAG, "'%s' too long (%u > %u bytes), not saved", KEYS[i].nvs, (unsigned)len,
+                 (unsigned)KEYS[i].cap - 1);
+        return false;
+    }
+
+    portENTER_CRITICAL(&lock_);
+    char *slot = str_ + offsetOf(i);
+    const bool changed = strcmp(slot, v) != 0;
+    if (changed)
+    {
+        memcpy(slot, v, len + 1);
+        markDirty(i);
+    }
+    portEXIT_CRITICAL(&lock_);
+
+    if (changed && dirty_hook_)
+        dirty_hook_();
+    return changed;
+}
+
+// ============================================================================
+// Write-behind
+// ============================================================================
+bool ConfigStore::dirty() const
+{
+    portENTER_CRITICAL(&lock_);
+    const bool d = dirty_mask_ != 0;
+    portEXIT_CRITICAL(&lock_);
+    return d;
+}
+
+uint32_t ConfigStore::msUntilFlush() const
+{
+    portENTER_CRITICAL(&lock_);
+    const uint32_t mask = dirty_mask_;
+    const int64_t due = std::min(last_set_us_ + static_cast<int64_t>(QUIET_MS) * 1000,
+                                 first_dirty_us_ + static_cast<int64_t>(MAX_DEFER_MS) * 1000);
+    portEXIT_CRITICAL(&lock_);
+    if (!mask)
+        return UINT32_MAX;
+    const int64_t left_us = due - esp_timer_get_time();
+    return left_us > 0 ? static_cast<uint32_t>((left_us + 999) / 1000) : 0;
+}
+
+bool ConfigStore::flushIfQuiet()
+{
+    return msUntilFlush() != 0 || flush();
+}
+
+bool ConfigStore::flush()
+{
+    portENTER_CRITICAL(&lock_);
+    const uint32_t mask = dirty_mask_;
+    dirty_mask_ = 0;
+    portEXIT_CRITICAL(&lock_);
+    if (!mask)
+        return true;
+
+    uint32_t failed = 0;
+    uint32_t written = 0;
+    nvs_handle_t h;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &h);
+    if (err == ESP_OK)
+    {
+        for (size_t i = 0; i < KEY_COUNT; i++)
+        {
+            if (!(mask & (1u << i)))
+                continue;
+            esp_err_t e;
+            if (KEYS[i].cap)
+            {
+                // Copy under the lock: a set* from another task must not tear it
+                char val[MAX_STR];
+                portENTER_CRITICAL(&lock_);
+                memcpy(val, str_ + offsetOf(i), KEYS[i].cap);
+                portEXIT_CRITICAL(&lock_);
+                e = nvs_set_str(h, KEYS[i].nvs, val);
+            }
+            else
+            {
+                e = nvs_set_u8(h, KEYS[i].nvs, getU8(static_cast<Key>(i)));
+            }
+            if (e == ESP_OK)
+                written++;
+            else
+            {
+                ESP_LOGE(TAG, "nvs_set '%s': %s", KEYS[i].nvs, esp_err_to_name(e));
+                failed |= 1u << i;
+            }
+        }
+        err = nvs_commit(h);
+        nvs_close(h);
+        if (err != ESP_OK)
+        {
+            failed = mask;
+            written = 0;
+        }
+    }
+    else
+    {
+        failed = mask;
+    }
+    if (err != ESP_OK)
+        ESP_LOGE(TAG, "flush: %s", esp_err_to_name(err));
+
+    portENTER_CRITICAL(&lock_);
+    if (failed)
+    {
+        // Retry after another quiet period
+        if (!dirty_mask_)
+            first_dirty_us_ = last_set_us_ = esp_timer_get_time();
+        dirty_mask_ |= failed;
+        stats_.errors++;
+    }
+    stats_.flushes++;
+    stats_.writes += written;
+    portEXIT_CRITICAL(&lock_);
+
+    ESP_LOGD(TAG, "Flushed %u key(s)", (unsigned)written);
+    return failed == 0;
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+const char *ConfigStore::keyName(Key k)
+{
+    const size_t i = index(k);
+    return i < KEY_COUNT ? KEYS[i].nvs : "?";
+}
+
+ConfigStore::Stats ConfigStore::stats() const
+{
+    portENTER_CRITICAL(&lock_);
+    const Stats s = stats_;
+    portEXIT_CRITICAL(&lock_);
+    return s;
+}
+
+void ConfigStore::print() const
+{
+    portENTER_CRITICAL(&lock_);
+    const uint32_t mask = dirty_mask_;
+    portEXIT_CRITICAL(&lock_);
+
+    for (size_t i = 0; i < KEY_COUNT; i++)
+    {
+        const Key k = static_cast<Key>(i);
+        const char mark = (mask & (1u << i)) ? '*' : ' ';
+        if (!KEYS[i].cap)
+        {
+            ESP_LOGI(TAG, "%c %-12s %u", mark, KEYS[i].nvs, (unsigned)getU8(k));
+            continue;
+        }
+        char val[MAX_STR];
+        getStr(k, val, sizeof(val));
+        if (k == Key::PASS && val[0])
+            snprintf(val, sizeof(val), "<set>");
+        ESP_LOGI(TAG, "%c %-12s %s", mark, KEYS[i].nvs, val);
+    }
+    const Stats s = stats();
+    const uint32_t left = msUntilFlush();
+    ESP_LOGI(TAG, "%u change(s) -> %u key write(s) in %u commit(s), %u error(s); %s", (unsigned)s.sets,
+             (unsigned)s.writes, (unsigned)s.flushes, (unsigned)s.errors, mask ? "flush pending (*)" : "clean");
+    if (mask)
+        ESP_LOGI(TAG, "Next flush in %u ms", (unsigned)left);
+}
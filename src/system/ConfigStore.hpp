@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+
+/**
+ * ConfigStore
+ * ============================================================================
+ * Bản sao trong RAM của cấu hình người dùng (NVS namespace "storage"), đọc một
+ * lần lúc boot bằng một nvs_open duy nhất. Mọi get* đọc từ RAM (không đụng
+ * flash, kể cả status MQTT mỗi chu kỳ); set* chỉ sửa RAM và đánh dấu key bẩn.
+ *
+ * Write-behind: các thay đổi được gom lại và ghi sau QUIET_MS không có thay đổi
+ * mới (kéo volume 10 nấc = một lần ghi, không phải 10 lần open/commit/close),
+ * hoặc muộn nhất MAX_DEFER_MS sau thay đổi đầu tiên. Chỉ key bẩn được ghi, tất
+ * cả trong một nvs_commit. Network loop gọi flushIfQuiet() (msUntilFlush() nằm
+ * trong deadline của nó); esp_restart() flush qua shutdown handler, deep sleep
+ * gọi flush() trực tiếp. Giá trị cần bền ngay (Wi-Fi credentials, cấu hình
+ * BLE) thì gọi flush() sau khi set.
+ *
+ * ws_ca (PEM, vài KB, chỉ đọc một lần) không nằm trong cache.
+ */
+class ConfigStore
+{
+public:
+    enum class Key : uint8_t
+    {
+        DEVICE_NAME,
+        SSID,
+        PASS,
+        WS_URL,
+        MQTT_URL,
+        AUDIO_CODEC,
+        VOLUME,
+        BRIGHTNESS,
+        NS,
+        AGC,
+        COUNT
+    };
+
+    static constexpr uint32_t QUIET_MS = 2000;      // flush after this long without a change
+    static constexpr uint32_t MAX_DEFER_MS = 30000; // ... but no later than this after the first
+    static constexpr size_t STR_POOL = 528;         // every string slot, NUL included
+
+    struct Stats
+    {
+        uint32_t sets = 0;    // set* calls that changed a value
+        uint32_t flushes = 0; // nvs_commit calls
+        uint32_t writes = 0;  // keys written (sets - writes = coalesced)
+        uint32_t errors = 0;
+    };
+
+    static ConfigStore &instance();
+
+    // Read every key once; NVS must be initialized. Also hooks esp_restart().
+    bool load();
+    bool loaded() const { return loaded_; }
+
+    uint8_t getU8(Key k) const;
+    bool getBool(Key k) const { return getU8(k) != 0; }
+    // Copies the value (or the key default when unset); returns its length
+    size_t getStr(Key k, char *out, size_t cap) const;
+    std::string getString(Key k) const;
+
+    // False: unchanged, wrong type or too long (nothing to flush)
+    bool setU8(Key k, uint8_t v);
+    bool setBool(Key k, bool v) { return setU8(k, v ? 1 : 0); }
+    bool setStr(Key k, const char *v);
+
+    // Write every dirty key now (one commit); false on an NVS error
+    bool flush();
+    // Flush when the quiet period (or the defer cap) has run out
+    bool flushIfQuiet();
+    // Time until flushIfQuiet() has work; UINT32_MAX when clean
+    uint32_t msUntilFlush() const;
+    bool dirty() const;
+
+    // Called after a set* that made the store dirty (network loop wake-up)
+    void setDirtyHook(std::function<void()> hook) { dirty_hook_ = std::move(hook); }
+
+    static const char *keyName(Key k);
+
+    Stats stats() const;
+    // Values (password masked), dirty keys and counters (serial "cfg")
+    void print() const;
+
+private:
+    ConfigStore(); // key defaults until load()
+
+    static void onShutdown();
+    // Lock held: flag key i for the next flush
+    void markDirty(size_t i);
+
+    mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+    char str_[STR_POOL] = {};
+    uint8_t u8_[static_cast<size_t>(Key::COUNT)] = {};
+    uint32_t dirty_mask_ = 0;
+    int64_t first_dirty_us_ = 0;
+    int64_t last_set_us_ = 0;
+    Stats stats_{};
+    bool loaded_ = false;
+    std::function<void()> dirty_hook_;
+};
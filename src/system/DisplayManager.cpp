@@ -3,6 +3,8 @@
 // Framebuffer.hpp removed - using direct rendering
 #include "AnimationPlayer.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 #include <atomic>
 
@@ -11,9 +13,19 @@
 
 #include "esp_log.h"
 
+#include "system/MemTelemetry.hpp"
+#include "system/Profiler.hpp"
+#include "system/TaskPlan.hpp"
+
 static const char *TAG = "DisplayManager";
 
-DisplayManager::DisplayManager() = default;
+static constexpr uint32_t BATTERY_MIN_FRAME_MS = 50;
+
+DisplayManager::DisplayManager()
+{
+    for (size_t i = 0; i < CMD_SLOTS; i++)
+        cmd_ring_[i].seq.store(i, std::memory_order_relaxed);
+}
 DisplayManager::~DisplayManager()
 {
     // Ensure task is stopped before destruction
@@ -57,6 +69,7 @@ bool DisplayManager::init(std::unique_ptr<DisplayDriver> driver, int width, int
 
     // AnimationPlayer renders directly to display - no framebuffer needed!
     anim_player = std::make_unique<AnimationPlayer>(drv.get());
+    anim_player->setOverlay(&overlay_);
 
     ESP_LOGI(TAG, "DisplayManager init OK (%dx%d) - Framebuffer-less architecture", width, height);
     return true;
@@ -65,10 +78,7 @@ bool DisplayManager::init(std::unique_ptr<DisplayDriver> driver, int width, int
 // ----------------------------------------------------------------------------
 // Task loop management
 // ----------------------------------------------------------------------------
-bool DisplayManager::startLoop(uint32_t interval_ms,
-                               UBaseType_t priority,
-                               uint32_t stackSize,
-                               BaseType_t core)
+bool DisplayManager::startLoop(uint32_t interval_ms)
 {
     if (task_handle_ != nullptr)
     {
@@ -83,32 +93,12 @@ bool DisplayManager::startLoop(uint32_t interval_ms,
     }
 
     update_interval_ms_ = interval_ms;
+    render_pm_.create(ESP_PM_CPU_FREQ_MAX, "display_render");
 
-#if defined(ESP_PLATFORM)
-    BaseType_t rc = xTaskCreatePinnedToCore(
-        &DisplayManager::taskEntry,
-        "DisplayLoop",
-        stackSize,
-        this,
-        priority,
-        &task_handle_,
-        core);
-#else
-    BaseType_t rc = xTaskCreate(
-        &DisplayManager::taskEntry,
-        "DisplayLoop",
-        stackSize,
-        this,
-        priority,
-        &task_handle_);
-#endif
-
-    if (rc != pdPASS)
-    {
-        ESP_LOGE(TAG, "startLoop: xTaskCreate failed (%d)", (int)rc);
-        task_handle_ = nullptr;
+    // Below every audio task on core 1 (task plan): a redraw never delays
+    // the speaker refill
+    if (!TaskPlan::instance().spawn(TaskPlan::DISPLAY, &DisplayManager::taskEntry, this, &task_handle_))
         return false;
-    }
     ESP_LOGI(TAG, "Display loop started (interval=%ums)", (unsigned)update_interval_ms_);
     return true;
 }
@@ -120,6 +110,7 @@ void DisplayManager::stopLoop()
 
     // ✅ Signal graceful shutdown instead of force-deleting
     task_running_.store(false);
+    wake(); // may be blocked until the next notification
 
     // Wait for task to exit (max 1 second)
     uint32_t wait_ms = 0;
@@ -133,6 +124,7 @@ void DisplayManager::stopLoop()
     if (task_handle_ != nullptr)
     {
         ESP_LOGW(TAG, "Display task did not exit; force deleting");
+        MemTelemetry::instance().unregisterTask(task_handle_);
         vTaskDelete(task_handle_);
         task_handle_ = nullptr;
     }
@@ -174,7 +166,21 @@ void DisplayManager::enableStateBinding(bool enable)
 
 void DisplayManager::setBatteryPercent(uint8_t p)
 {
+    if (battery_percent == p)
+        return;
     battery_percent = p;
+    wake();
+}
+
+void DisplayManager::invalidate()
+{
+    if (anim_player)
+    {
+        anim_player->invalidate();
+    }
+    overlay_.invalidate();      // force overlay redraw
+    text_mode_cleared_ = false; // force text redraw
+    wake();
 }
 
 // (toast feature removed)
@@ -183,17 +189,159 @@ void DisplayManager::setBatteryPercent(uint8_t p)
 // Power saving mode
 // ----------------------------------------------------------------------------
 void DisplayManager::setPowerSaveMode(bool enable)
+{
+    Command c = makeCommand(Cmd::POWER_SAVE);
+    c.arg = enable ? 1 : 0;
+    post(c);
+}
+
+void DisplayManager::doSetPowerSaveMode(bool enable)
 {
     if (enable)
     {
         anim_player->pause();
+        requestLowPower(true, face_band_start_, face_band_len_);
     }
     else
     {
+        requestLowPower(false);
         anim_player->resume();
     }
 }
 
+// Idle face around the critical-battery icon only: freeze the animation so
+// it doesn't overdraw, then drive just the icon band.
+void DisplayManager::doCritical(bool enter)
+{
+    if (!enter)
+    {
+        if (lp_critical_)
+        {
+            lp_critical_ = false;
+            doSetPowerSaveMode(false);
+        }
+        return;
+    }
+
+    anim_player->pause();
+    lp_critical_ = true;
+    const asset::icon::Icon &ico = *asset::ICONS[(size_t)asset::IconId::BATTERY_CRITICAL];
+    bool axis_x = drv && drv->scrollAxisIsX();
+    requestLowPower(true, axis_x ? 51 : 22, axis_x ? ico.w : ico.h);
+}
+
+void DisplayManager::requestLowPower(bool enable, int band_start, int band_len)
+{
+    if (enable)
+    {
+        lp_band_start_ = band_start;
+        lp_band_len_ = band_len;
+    }
+    low_power_req_.store(enable, std::memory_order_release);
+}
+
+// Idle face: the panel only drives the face band (partial mode blanks the
+// rest without touching GRAM) and drops to 8 colours. The paused animation
+// sends nothing, so SPI traffic stops too. Leaving restores normal + full
+// colour; GRAM still holds the last frame, no redraw needed.
+void DisplayManager::applyLowPower()
+{
+    bool want = low_power_req_.load(std::memory_order_acquire);
+    if (want == low_power_on_)
+        return;
+
+    if (want)
+    {
+        if (marquee_active_)
+        {
+            stopMarquee();
+            text_mode_cleared_ = false; // redraw the text statically
+        }
+        const int axis = drv->scrollAxisLength();
+        int start = std::max(lp_band_start_, 0);
+        int len = std::min(lp_band_len_, axis - start);
+        if (len > 0 && len < axis)
+        {
+            drv->setPartialArea(start, len);
+            drv->setPartialMode(true);
+        }
+        drv->setIdleMode(true);
+        ESP_LOGI(TAG, "Idle face ON (band %d+%d)", start, len);
+    }
+    else
+    {
+        drv->setIdleMode(false);
+        drv->setPartialMode(false);
+        ESP_LOGI(TAG, "Idle face OFF");
+    }
+    low_power_on_ = want;
+}
+
+// ----------------------------------------------------------------------------
+// Text marquee (hardware scroll)
+// ----------------------------------------------------------------------------
+// The scroll band covers the whole screen along X, so the text row and the
+// top bar scroll together; the screen is cleared on entry and the battery
+// overlay redrawn on exit. Virtual column v (text at [0, text_w), then one
+// screen of blank) lives in GRAM column (v - pos + offset) mod width.
+
+void DisplayManager::startMarquee()
+{
+    drv->fillScreen(0x0000);
+    drv->setScrollRegion(0, width_);
+
+    marquee_text_w_ = (int)text_msg_.size() * 8 * text_scale_;
+    marquee_y_ = text_y_ >= 0 ? text_y_ : height_ / 2 - 4 * text_scale_;
+    marquee_pos_ = -width_; // text enters from the right edge
+    marquee_offset_ = 0;
+    marquee_accum_ = 0;
+    marquee_active_ = true;
+    ESP_LOGI(TAG, "Marquee start: text_w=%d speed=%u px/s", marquee_text_w_, marquee_speed_);
+}
+
+void DisplayManager::stepMarquee(uint32_t dt_ms)
+{
+    marquee_accum_ += dt_ms * marquee_speed_;
+    int step = std::min<int>(marquee_accum_ / 1000, width_);
+    marquee_accum_ %= 1000;
+    if (step <= 0)
+        return;
+
+    const int cycle = marquee_text_w_ + width_;
+    const int glyph_h = 8 * text_scale_;
+
+    // Columns scrolling off the left edge are reused for the ones entering right
+    for (int k = 0; k < step; k++)
+    {
+        int v = marquee_pos_ + width_ + k;
+        int tx = ((v % cycle) + cycle) % cycle;
+        int g = (marquee_offset_ + k) % width_;
+        if (tx < marquee_text_w_)
+        {
+            drv->drawTextClipped(text_msg_.c_str(), text_color_, 0x0000, g - tx, marquee_y_, text_scale_, g, g + 1);
+        }
+        else
+        {
+            drv->fillRect(g, marquee_y_, 1, glyph_h, 0x0000);
+        }
+    }
+
+    marquee_pos_ = (marquee_pos_ + step) % cycle;
+    marquee_offset_ = (uint16_t)((marquee_offset_ + step) % width_);
+    drv->setScrollOffset(marquee_offset_);
+}
+
+void DisplayManager::stopMarquee()
+{
+    if (!marquee_active_)
+        return;
+    marquee_active_ = false;
+    drv->resetScroll();
+    drv->fillScreen(0x0000); // GRAM holds rotated text columns
+    overlay_.invalidate();
+    anim_player->invalidate();
+}
+
 void DisplayManager::setBacklight(bool on)
 {
     if (drv)
@@ -204,23 +352,61 @@ void DisplayManager::setBacklight(bool on)
 
 void DisplayManager::setBrightness(uint8_t percent)
 {
+    brightness_percent_ = percent > 100 ? 100 : percent;
     if (drv)
     {
         drv->setBacklightLevel(percent);
     }
 }
 
+void DisplayManager::setEmotionCacheBudget(size_t bytes)
+{
+    if (anim_player)
+        anim_player->setFrameCacheBudget(bytes);
+}
+
+void DisplayManager::setEmotionPalette(const uint16_t colors[4])
+{
+    // Only indices are cached, so a theme change needs no re-decode
+    if (anim_player)
+        anim_player->setPalette(colors);
+}
+
 // ----------------------------------------------------------------------------
 // Asset registration
 // ----------------------------------------------------------------------------
-void DisplayManager::registerEmotion(const std::string &name, const Animation1Bit &anim)
+void DisplayManager::registerEmotion(asset::AnimId id, const Animation1Bit &anim)
 {
-    emotions[name] = anim;
+    if ((size_t)id < asset::ANIM_COUNT)
+        emotion_override_[(size_t)id] = &anim;
+}
+
+bool DisplayManager::registerEmotion(std::string_view name, const Animation1Bit &anim)
+{
+    asset::AnimId id = asset::animIdFromName(name);
+    if (id == asset::AnimId::NONE)
+    {
+        ESP_LOGW(TAG, "No emotion slot '%.*s'", (int)name.size(), name.data());
+        return false;
+    }
+    registerEmotion(id, anim);
+    return true;
 }
 
-void DisplayManager::registerIcon(const std::string &name, const Icon &icon)
+// Built-in table entry -> player descriptor (frame 0 is a diff from black,
+// no base_frame)
+static Animation1Bit fromAsset(const asset::emotion::Animation &a)
 {
-    icons[name] = icon;
+    Animation1Bit anim;
+    anim.width = a.width;
+    anim.height = a.height;
+    anim.frame_count = a.frame_count;
+    anim.fps = (uint16_t)a.fps;
+    anim.loop = a.loop;
+    anim.max_packed_size = a.max_packed_size;
+    anim.base_frame = nullptr;
+    anim.frames = a.frames();
+    return anim;
 }
 
 // ----------------------------------------------------------------------------
@@ -242,58 +428,114 @@ void DisplayManager::update(uint32_t dt_ms)
         first_update = false;
     }
 
+    drainCommands();
+    applyLowPower();
+
+    // OTA screen is static; progress/status are drawn by drainCommands()
+    if (otaScreenActive())
+        return;
+
+    // Layers change before the render so this frame's batches carry them
+    syncBatteryOverlay();
+
     // 0) If text mode active, render text only (no animation)
     if (text_active_)
     {
-        // Only clear once when entering text mode
+        // Clear and draw once when entering text mode; static text costs nothing afterwards
         if (!text_mode_cleared_)
         {
-            drv->fillScreen(0x0000, 0, 22, width_, height_ - 22); // Clear below top bar
+            stopMarquee();
+            int text_w = (int)text_msg_.size() * 8 * text_scale_;
+            if (text_w > width_ && drv->scrollAxisIsX() && !low_power_on_)
+            {
+                // Too wide to fit: scroll it with the panel instead of clipping
+                startMarquee();
+            }
+            else
+            {
+                drv->fillScreen(0x0000, 0, 22, width_, height_ - 22); // Clear below top bar
+                if (!text_msg_.empty())
+                {
+                    drv->drawTextCenter(text_msg_.c_str(), text_color_, width_ / 2, height_ / 2, text_scale_, 0x0000); // Center of screen
+                }
+            }
             text_mode_cleared_ = true;
         }
-        if (!text_msg_.empty())
+        else if (marquee_active_)
         {
-            drv->drawTextCenter(text_msg_.c_str(), text_color_, width_ / 2, height_ / 2, text_scale_); // Center of screen
+            stepMarquee(dt_ms);
         }
+        flushOverlay();
         return;
     }
     else
     {
         // Reset flag when not in text mode
         text_mode_cleared_ = false;
+        stopMarquee();
     }
 
     // 1) update animation frame
     anim_player->update(dt_ms);
 
     // 2) Render animation frame directly to display (no framebuffer!)
-    anim_player->render();
-
-    // 3) Overlay battery percentage (top-right corner)
-    // Note: Drawn over animation, cleared by next animation frame
-    if (battery_percent < 255)
+    // No-op unless the frame advanced or the player was invalidated. Under
+    // the voice / glitch caps a due frame waits for the floor (the wakeup
+    // may come from a command); a new animation shows at once.
+    pollAudioGlitches();
+    if (anim_player->isDirty())
     {
-        // Only redraw if battery percent changed
-        if (battery_percent != prev_battery_percent)
+        const TickType_t now = xTaskGetTickCount();
+        const uint32_t since_ms = (now - last_render_tick_) * portTICK_PERIOD_MS;
+        if (!render_now_ && since_ms < frameFloorMs())
+        {
+            frames_deferred_++;
+        }
+        else
         {
-            // Clear old text area (assume max width of "100%" = 4 chars * 8 pixels = 32px)
-            int text_x = width_ - 160;               // 40px from right edge
-            drv->fillRect(text_x, 5, 40, 8, 0x0000); // Clear 40x8 black rectangle
+            PTALK_PROF_SCOPE(RENDER);
+            anim_player->render(budget_.frame_budget_us);
+            last_render_tick_ = now;
+            render_now_ = false;
+            frames_rendered_++;
+        }
+    }
 
-            char buf[8];
-            snprintf(buf, sizeof(buf), "%d%%", battery_percent);
-            drv->drawText(buf, 0xFFFF, text_x, 5, 1); // White text, top-right
+    // 3) Overlay rows the frame didn't cover (top bar, static face)
+    flushOverlay();
+}
 
-            prev_battery_percent = battery_percent;
-        }
+void DisplayManager::syncBatteryOverlay()
+{
+    if (battery_percent == prev_battery_percent)
+        return;
+    prev_battery_percent = battery_percent;
+    if (battery_percent >= 255)
+    {
+        overlay_.hide(OVL_BATTERY);
+        return;
     }
+    // Fixed 4-char field ("  5%".."100%"), white on black, top-right
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%3d%%", battery_percent);
+    overlay_.setText(OVL_BATTERY, width_ - 160, 5, buf, 0xFFFF, 0x0000);
+}
+
+void DisplayManager::flushOverlay()
+{
+    // The marquee scrolls the whole panel, top bar included
+    if (marquee_active_ || !overlay_.hasPending())
+        return;
+    overlay_.flushPending(*drv);
 }
 
 void DisplayManager::taskEntry(void *arg)
 {
     auto *self = static_cast<DisplayManager *>(arg);
     self->task_running_.store(true); // ✅ Signal task is running
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::DISPLAY));
     TickType_t prev = xTaskGetTickCount();
+    TickType_t stats_since = prev;
 
     while (self->task_running_.load())
     { // ✅ Check graceful shutdown flag
@@ -301,32 +543,139 @@ void DisplayManager::taskEntry(void *arg)
         uint32_t dt_ms = (now - prev) * portTICK_PERIOD_MS;
         prev = now;
         ESP_LOGD(TAG, "DisplayManager update dt_ms=%u", dt_ms);
+        // Busy period: render + SPI flush at full clock, idle profile between frames
+        self->render_pm_.hold(true);
         self->update(dt_ms);
-        vTaskDelay(pdMS_TO_TICKS(self->update_interval_ms_));
+        self->render_pm_.hold(false);
+        self->wakeups_++;
+
+        if (now - stats_since >= pdMS_TO_TICKS(60000))
+        {
+            const RenderStats st = self->renderStats();
+            ESP_LOGI(TAG, "Display loop: %u wakeups/min; frames %u rendered, %u dropped, %u deferred, "
+                          "%u budget cuts, %u glitch backoffs",
+                     (unsigned)self->wakeups_, (unsigned)st.frames_rendered, (unsigned)st.frames_dropped,
+                     (unsigned)st.deferred, (unsigned)st.budget_cuts, (unsigned)st.glitch_backoffs);
+            self->wakeups_ = 0;
+            stats_since = now;
+        }
+
+        // Sleep until the next frame deadline or a notification (post(),
+        // battery overlay, invalidate, stop). An indefinite block lets the
+        // idle task enter light sleep when automatic PM is enabled.
+        uint32_t wait_ms = self->nextWakeMs();
+        TickType_t ticks = portMAX_DELAY;
+        if (wait_ms != UINT32_MAX)
+        {
+            // Round up so the frame is due when we wake (no early no-op pass)
+            ticks = std::max<TickType_t>(1, (wait_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS);
+        }
+        ulTaskNotifyTake(pdTRUE, ticks);
     }
 
     // ✅ Graceful exit: cleanup and notify stopper
+    MemTelemetry::instance().unregisterTask();
     self->task_handle_ = nullptr;
     vTaskDelete(nullptr);
 }
 
+void DisplayManager::wake()
+{
+    TaskHandle_t t = task_handle_;
+    if (t)
+        xTaskNotifyGive(t);
+}
+
+uint32_t DisplayManager::frameFloorMs() const
+{
+    uint32_t floor_ms = std::max(update_interval_ms_, min_frame_ms_.load(std::memory_order_relaxed));
+    if (voice_mode_.load(std::memory_order_relaxed))
+        floor_ms = std::max<uint32_t>(floor_ms, budget_.voice_frame_ms);
+    if (glitch_slow_)
+        floor_ms = std::max<uint32_t>(floor_ms, budget_.glitch_frame_ms);
+    return floor_ms;
+}
+
+void DisplayManager::pollAudioGlitches()
+{
+    const TickType_t now = xTaskGetTickCount();
+    if (glitch_probe_)
+    {
+        const uint32_t n = glitch_probe_();
+        if (!glitch_synced_)
+        {
+            glitch_synced_ = true; // glitches before the display loop don't count
+            glitch_seen_ = n;
+        }
+        else if (n != glitch_seen_)
+        {
+            glitch_seen_ = n;
+            if (!glitch_slow_)
+            {
+                glitch_backoffs_++;
+                ESP_LOGW(TAG, "Audio glitch: display capped at %u ms/frame for %u ms",
+                         (unsigned)budget_.glitch_frame_ms, (unsigned)budget_.glitch_hold_ms);
+            }
+            glitch_slow_ = true;
+            glitch_until_ = now + pdMS_TO_TICKS(budget_.glitch_hold_ms);
+        }
+    }
+    if (glitch_slow_ && (int32_t)(now - glitch_until_) >= 0)
+        glitch_slow_ = false;
+}
+
+DisplayManager::RenderStats DisplayManager::renderStats() const
+{
+    RenderStats st;
+    st.frames_rendered = frames_rendered_;
+    st.frames_dropped = anim_player ? anim_player->droppedFrames() : 0;
+    st.budget_cuts = anim_player ? anim_player->budgetCuts() : 0;
+    st.deferred = frames_deferred_;
+    st.glitch_backoffs = glitch_backoffs_;
+    return st;
+}
+
+uint32_t DisplayManager::nextWakeMs() const
+{
+    const uint32_t floor_ms = frameFloorMs();
+
+    // Marquee steps on the frame clock; OTA / text / paused faces are static
+    if (marquee_active_)
+        return floor_ms;
+    if (otaScreenActive() || text_active_ || low_power_on_)
+        return UINT32_MAX;
+
+    // A frame held back by the cap is due once the floor since the last
+    // render has passed
+    uint32_t wait = anim_player->isDirty() ? 0 : anim_player->msUntilNextFrame();
+    if (wait == UINT32_MAX)
+        return UINT32_MAX;
+    const uint32_t since_ms = (xTaskGetTickCount() - last_render_tick_) * portTICK_PERIOD_MS;
+    return std::max(wait, floor_ms > since_ms ? floor_ms - since_ms : 0);
+}
+
 // ----------------------------------------------------------------------------
 // MAPPING STATE → UI BEHAVIOR
 // ----------------------------------------------------------------------------
 
 void DisplayManager::handleInteraction(state::InteractionState s, state::InputSource src)
 {
+    // Mic / speaker streaming: animation drops to voice_frame_ms
+    const bool voice = s == state::InteractionState::TRIGGERED || s == state::InteractionState::LISTENING ||
+                       s == state::InteractionState::SPEAKING;
+    voice_mode_.store(voice, std::memory_order_relaxed);
+
     switch (s)
     {
     case state::InteractionState::TRIGGERED:
     case state::InteractionState::LISTENING:
-        playEmotion("listening");
+        playEmotion(asset::AnimId::LISTENING);
         break;
     case state::InteractionState::PROCESSING:
-        playEmotion("thinking");
+        playEmotion(asset::AnimId::THINKING);
         break;
     case state::InteractionState::SPEAKING:
-        // playEmotion("speaking");
+        // playEmotion(asset::AnimId::SPEAKING);
         break;
     case state::InteractionState::CANCELLING:
         break;
@@ -337,7 +686,7 @@ void DisplayManager::handleInteraction(state::InteractionState s, state::InputSo
         break;
     case state::InteractionState::IDLE:
     default:
-        playEmotion("idle");
+        playEmotion(asset::AnimId::IDLE);
         break;
     }
 }
@@ -359,20 +708,20 @@ void DisplayManager::handleConnectivity(state::ConnectivityState s)
     case state::ConnectivityState::WIFI_PORTAL:
         // Show text "WiFi Portal Mode"
         playText("WiFi Portal Mode", -1, -1, 0xFFFF, 1.8); // centered, white text
-        // playEmotion("sad");
+        // playEmotion(asset::AnimId::SAD);
         break;
     case state::ConnectivityState::CONFIG_BLE:
         // Show text "BLE Config Mode"
         playText("BLE Config Mode", -1, -1, 0xFFFF, 1.8); // centered, white text
-        // playEmotion("sad");
+        // playEmotion(asset::AnimId::SAD);
         break;
 
     case state::ConnectivityState::CONNECTING_WS:
-        playEmotion("stun");
+        playEmotion(asset::AnimId::STUN);
         break;
 
     case state::ConnectivityState::ONLINE:
-        playEmotion("idle");
+        playEmotion(asset::AnimId::IDLE);
         break;
     }
 }
@@ -388,15 +737,15 @@ void DisplayManager::handleSystem(state::SystemState s)
 
     case state::SystemState::RUNNING:
         // ESP_LOGI(TAG, "Displaying Running message");
-        playEmotion("idle");
+        playEmotion(asset::AnimId::IDLE);
         break;
 
     case state::SystemState::ERROR:
-        playEmotion("error");
+        playEmotion(asset::AnimId::ERROR);
         break;
 
     case state::SystemState::MAINTENANCE:
-        playEmotion("maintenance");
+        playEmotion(asset::AnimId::MAINTENANCE);
         break;
 
     case state::SystemState::UPDATING_FIRMWARE:
@@ -404,29 +753,42 @@ void DisplayManager::handleSystem(state::SystemState s)
         break;
 
     case state::SystemState::FACTORY_RESETTING:
-        playEmotion("reset");
+        playEmotion(asset::AnimId::RESET);
         break;
     }
 }
 
 void DisplayManager::handlePower(state::PowerState s)
 {
+    // Any state but CRITICAL leaves the idle face entered for it
+    if (s != state::PowerState::CRITICAL)
+    {
+        Command c = makeCommand(Cmd::CRITICAL);
+        c.arg = 0;
+        post(c);
+    }
+
     switch (s)
     {
     case state::PowerState::NORMAL:
-        playIcon("battery");
+        // No plain battery icon in the registry: the percentage overlay shows it
+        setStatusIcon(asset::IconId::NONE);
+        // On battery: cap at 20 fps (assets are 10-20 fps natively)
+        setMinFramePeriodMs(BATTERY_MIN_FRAME_MS);
         break;
 
         // case state::PowerState::LOW_BATTERY:
-        //     playIcon("battery_low");
+        //     playIcon(asset::IconId::BATTERY_LOW);
         //     break;
 
     case state::PowerState::CHARGING:
-        playIcon("battery_charge", IconPlacement::Custom, width_ - 185, 0);
+        setMinFramePeriodMs(0);
+        setStatusIcon(asset::IconId::BATTERY_CHARGE);
         break;
 
     case state::PowerState::FULL_BATTERY:
-        playIcon("battery_full", IconPlacement::Custom, width_ - 185, 0);
+        setMinFramePeriodMs(0);
+        setStatusIcon(asset::IconId::BATTERY_FULL);
         break;
 
         // case state::PowerState::POWER_SAVING:
@@ -435,63 +797,97 @@ void DisplayManager::handlePower(state::PowerState s)
 
     case state::PowerState::CRITICAL:
         ESP_LOGI(TAG, "CRITICAL: show critical battery icon");
+        setStatusIcon(asset::IconId::NONE);
         // Show registered critical battery icon fullscreen
-        playIcon("battery_critical", IconPlacement::Custom, 51, 22);
+        playIcon(asset::IconId::BATTERY_CRITICAL, IconPlacement::Custom, 51, 22);
         // ✅ Removed blocking delay - icon stays visible via display loop
+        {
+            Command c = makeCommand(Cmd::CRITICAL);
+            c.arg = 1;
+            post(c);
+        }
         break;
 
     case state::PowerState::ERROR:
-        playEmotion("error");
+        setStatusIcon(asset::IconId::NONE);
+        playEmotion(asset::AnimId::ERROR);
         break;
     }
 }
 
 void DisplayManager::handleEmotion(state::EmotionState s)
 {
-    // Map emotion state to an available emotion asset
-    switch (s)
-    {
-    case state::EmotionState::HAPPY:
-        playEmotion("happy");
-        break;
-    case state::EmotionState::SAD:
-        playEmotion("sad");
-        break;
-    case state::EmotionState::THINKING:
-        playEmotion("thinking");
-        break;
-    case state::EmotionState::CONFUSED:
-        playEmotion("stun");
-        break;
-    case state::EmotionState::NEUTRAL:
-        playEmotion("neutral");
-        break;
-    case state::EmotionState::CALM:
-    case state::EmotionState::EXCITED:
-    case state::EmotionState::ANGRY:
-    default:
-        playEmotion("idle");
-        break;
-    }
+    // Compile-time EmotionState -> slot table (unmapped states fall back to idle)
+    playEmotion(asset::emotionAnim(s));
 }
 
 // ----------------------------------------------------------------------------
 // Internal asset playback
-void DisplayManager::playEmotion(const std::string &name, int x, int y)
+void DisplayManager::playEmotion(asset::AnimId id, int x, int y)
 {
-    auto it = emotions.find(name);
-    if (it == emotions.end())
-    {
-        ESP_LOGW(TAG, "Emotion '%s' not found", name.c_str());
+    if ((size_t)id >= asset::ANIM_COUNT)
         return;
+    Command c = makeCommand(Cmd::EMOTION);
+    c.arg = (uint8_t)id;
+    c.x = (int16_t)x;
+    c.y = (int16_t)y;
+    post(c);
+}
+
+bool DisplayManager::lookupEmotion(asset::AnimId id, Animation1Bit &out)
+{
+    const size_t slot = (size_t)id;
+    const Animation1Bit *pack = emotion_source_ ? emotion_source_(id) : nullptr;
+    if (pack)
+    {
+        // Pack tables can land where an unmapped pack's were
+        out = *pack;
+        anim_player->forgetFrameCache();
     }
+    else if (emotion_override_[slot])
+        out = *emotion_override_[slot];
+    else if (asset::BUILTIN_ANIMS[slot])
+        out = fromAsset(*asset::BUILTIN_ANIMS[slot]);
+    else
+        return false;
+    return true;
+}
 
-    const Animation1Bit &anim = it->second;
+void DisplayManager::doPlayEmotion(asset::AnimId id, int x, int y)
+{
+    // Already on screen and running: restarting it would only redraw
+    auto showing = [this](asset::AnimId a)
+    {
+        return a == emotion_playing_ && !text_active_ && !anim_player->isPaused() &&
+               !low_power_req_.load(std::memory_order_relaxed);
+    };
+    if (showing(id))
+        return;
 
-    ESP_LOGI(TAG, "playEmotion '%s' starting animation", name.c_str());
+    Animation1Bit anim;
+    if (!lookupEmotion(id, anim))
+    {
+        // Slot without a face yet (pack not cached): its stand-in
+        const asset::AnimId fb = asset::ANIM_FALLBACK[(size_t)id];
+        const std::string_view want = asset::ANIM_NAMES[(size_t)id];
+        if (fb == asset::AnimId::NONE || !lookupEmotion(fb, anim))
+        {
+            ESP_LOGW(TAG, "Emotion '%.*s' has no animation", (int)want.size(), want.data());
+            return;
+        }
+        id = fb;
+        if (showing(id))
+            return;
+    }
+    const std::string_view name = asset::ANIM_NAMES[(size_t)id];
 
-    // Disable text mode when playing animation
+    ESP_LOGI(TAG, "playEmotion '%.*s' starting animation", (int)name.size(), name.data());
+
+    // Disable text mode (and any OTA screen) when playing animation
     text_active_ = false;
+    ota_updating = ota_completed = ota_error = false;
+    // New content: back to the full panel
+    requestLowPower(false);
 
     // Default y=22 to reserve space for battery display (top 22px)
     if (y == 0)
@@ -499,15 +895,36 @@ void DisplayManager::playEmotion(const std::string &name, int x, int y)
         y = 22;
     }
 
-    // Start animation centered or at (x,y)
+    bool axis_x = drv && drv->scrollAxisIsX();
+    face_band_start_ = axis_x ? x : y;
+    face_band_len_ = axis_x ? anim.width : anim.height;
+
+    // Start animation centered or at (x,y); its first frame skips the fps cap
     anim_player->setAnimation(anim, x, y);
+    render_now_ = true;
+    emotion_playing_ = id;
 }
 
 void DisplayManager::playText(const std::string &text, int x, int y, uint16_t color, int scale)
 {
-    ESP_LOGI(TAG, "playText '%s' at (%d,%d) color=0x%04X scale=%d", text.c_str(), x, y, color, scale);
+    Command c = makeCommand(Cmd::TEXT, text);
+    c.x = (int16_t)x;
+    c.y = (int16_t)y;
+    c.color = color;
+    c.scale = (uint8_t)std::clamp(scale, 1, 255);
+    post(c);
+}
+
+void DisplayManager::doPlayText(const std::string &text, int x, int y, uint16_t color, int scale)
+{
     if (scale < 1)
-        scale = 1; // keep visible text size
+        scale = 1;
+    // Same message already shown
+    if (text_active_ && text == text_msg_ && color == text_color_ && scale == text_scale_ &&
+        x == text_x_ && y == text_y_)
+        return;
+
+    ESP_LOGI(TAG, "playText '%s' at (%d,%d) color=0x%04X scale=%d", text.c_str(), x, y, color, scale);
     text_msg_ = text;
     text_x_ = x;
     text_y_ = y;
@@ -515,31 +932,48 @@ void DisplayManager::playText(const std::string &text, int x, int y, uint16_t co
     text_scale_ = scale;
     text_active_ = true;
     text_mode_cleared_ = false;
+    ota_updating = ota_completed = ota_error = false;
+    requestLowPower(false);
     // Stop animation to avoid overwriting text
     anim_player->stop();
+    emotion_playing_ = asset::AnimId::NONE;
 }
 
 void DisplayManager::clearText()
 {
+    post(makeCommand(Cmd::CLEAR_TEXT));
+}
+
+void DisplayManager::doClearText()
+{
+    emotion_playing_ = asset::AnimId::NONE;
     text_active_ = false;
     text_mode_cleared_ = false; // Reset clear flag
     text_msg_.clear();
 }
 
-void DisplayManager::playIcon(const std::string &name,
+void DisplayManager::playIcon(asset::IconId id,
                               IconPlacement placement,
                               int x,
                               int y)
 {
+    if ((size_t)id >= asset::ICON_COUNT)
+        return;
+    Command c = makeCommand(Cmd::ICON);
+    c.id = (uint8_t)id;
+    c.arg = (uint8_t)placement;
+    c.x = (int16_t)x;
+    c.y = (int16_t)y;
+    post(c);
+}
 
+void DisplayManager::doPlayIcon(asset::IconId id,
+                                IconPlacement placement,
+                                int x,
+                                int y)
+{
     // Small icons (height ~22) typically shown near the battery percentage row
-    auto it = icons.find(name);
-    if (it == icons.end())
-    {
-        ESP_LOGW(TAG, "Icon '%s' not found", name.c_str());
-        return;
-    }
-    const Icon &ico = it->second;
+    const asset::icon::Icon &ico = *asset::ICONS[(size_t)id];
     int draw_x = 0;
     int draw_y = 0;
 
@@ -568,107 +1002,347 @@ void DisplayManager::playIcon(const std::string &name,
     if (drv)
     {
         drv->drawRLE2bitIcon(draw_x, draw_y, ico.w, ico.h, ico.rle_data);
+        overlay_.invalidate(); // keep status layers on top
+    }
+}
+
+void DisplayManager::setStatusIcon(asset::IconId id)
+{
+    Command c = makeCommand(Cmd::STATUS_ICON);
+    c.id = (uint8_t)id;
+    post(c);
+}
+
+void DisplayManager::doStatusIcon(asset::IconId id)
+{
+    if ((size_t)id >= asset::ICON_COUNT)
+    {
+        overlay_.hide(OVL_STATUS_ICON);
+        return;
     }
+    // Left of the battery percentage; gray ramp, black = transparent
+    const asset::icon::Icon &ico = *asset::ICONS[(size_t)id];
+    if (!overlay_.setIcon(OVL_STATUS_ICON, width_ - 185, 0, ico.w, ico.h, ico.rle_data, RleBlitter::GRAY_PALETTE))
+        ESP_LOGW(TAG, "Status icon %u too large for an overlay (%dx%d)", (unsigned)id, ico.w, ico.h);
 }
 
 // ============================================================================
 // OTA Update UI Functions
 // ============================================================================
+// Public calls come from the network / OTA tasks: they only post. Progress
+// goes through its own latest-value slot so a burst of chunk ACKs costs one
+// bar update per display tick.
 
 void DisplayManager::showOTAUpdating()
 {
-    ESP_LOGI(TAG, "Showing OTA updating screen");
-    ota_updating = true;
-    ota_completed = false;
-    ota_error = false;
-    ota_progress_percent = 0;
-    ota_status_text = "Starting update...";
-
-    if (!drv)
-        return;
-
-    drv->fillScreen(0x0000); // OTA screen: full clear needed
-    // TODO: Draw "Updating Firmware" title and progress bar outline
-    // TODO: Display initial message
+    Command c = makeCommand(Cmd::OTA_SCREEN);
+    c.arg = OTA_UPDATING;
+    post(c);
 }
 
 void DisplayManager::setOTAProgress(uint8_t current_percent)
 {
     if (current_percent > 100)
         current_percent = 100;
+    if (ota_progress_req_.exchange(current_percent, std::memory_order_acq_rel) != current_percent)
+        wake();
+}
 
-    ota_progress_percent = current_percent;
+void DisplayManager::setOTAStatus(const std::string &status)
+{
+    post(makeCommand(Cmd::OTA_STATUS, status));
+}
+
+void DisplayManager::showOTACompleted()
+{
+    Command c = makeCommand(Cmd::OTA_SCREEN);
+    c.arg = OTA_COMPLETED;
+    post(c);
+}
+
+void DisplayManager::showOTAError(const std::string &error_msg)
+{
+    Command c = makeCommand(Cmd::OTA_SCREEN, error_msg);
+    c.arg = OTA_ERROR;
+    post(c);
+}
+
+void DisplayManager::showRebooting()
+{
+    Command c = makeCommand(Cmd::OTA_SCREEN);
+    c.arg = OTA_REBOOTING;
+    post(c);
+}
+
+// Layout (display task): title at 1/3, progress bar at 1/2, status and
+// percentage below it. Each line is drawn opaque, so no separate clears.
+namespace
+{
+    constexpr int OTA_BAR_MARGIN = 20;
+    constexpr int OTA_BAR_H = 14;
+} // namespace
+
+void DisplayManager::doOtaScreen(OtaScreen screen, const std::string &msg)
+{
+    const char *title = "Updating Firmware";
+    switch (screen)
+    {
+    case OTA_UPDATING:
+        ESP_LOGI(TAG, "Showing OTA updating screen");
+        ota_updating = true;
+        ota_completed = false;
+        ota_error = false;
+        ota_progress_percent = 0;
+        ota_status_text = "Starting update...";
+        break;
+    case OTA_COMPLETED:
+        ESP_LOGI(TAG, "Showing OTA completed screen");
+        ota_updating = false;
+        ota_completed = true;
+        ota_error = false;
+        ota_progress_percent = 100;
+        ota_status_text = "Update completed!";
+        title = "Update Successful";
+        break;
+    case OTA_ERROR:
+        ESP_LOGE(TAG, "Showing OTA error: %s", msg.c_str());
+        ota_updating = false;
+        ota_completed = false;
+        ota_error = true;
+        ota_error_msg = msg;
+        ota_status_text = "Update failed!";
+        title = "Update Failed";
+        break;
+    case OTA_REBOOTING:
+        ESP_LOGI(TAG, "Showing rebooting screen");
+        ota_updating = false;
+        ota_completed = true;
+        ota_error = false;
+        ota_status_text = "Rebooting...";
+        title = "Device restarting...";
+        break;
+    }
 
     if (!drv)
         return;
 
-    // Update progress bar on display (0-100%)
-    // TODO: Draw progress bar visual
-    // Example: draw bar from left to right
-    // int bar_width = (width_ * current_percent) / 100;
-    // drv->drawBitmap(...);  // Draw progress bar scanline
+    // The OTA screen owns the panel until the next emotion/text
+    stopMarquee();
+    anim_player->stop();
+    emotion_playing_ = asset::AnimId::NONE;
+    text_active_ = false;
+
+    drv->fillScreen(0x0000); // OTA screen: full clear needed
+    overlay_.invalidate();   // top bar comes back after the OTA screen
+    drv->drawTextCenter(title, screen == OTA_ERROR ? 0xF800 : 0xFFFF, width_ / 2, height_ / 3, 2, 0x0000);
 
-    ESP_LOGD(TAG, "OTA progress: %u%%", current_percent);
+    if (screen == OTA_UPDATING)
+    {
+        // Bar outline; the fill is drawn incrementally by doOtaProgress()
+        const int bx = OTA_BAR_MARGIN;
+        const int by = height_ / 2;
+        const int bw = width_ - 2 * OTA_BAR_MARGIN;
+        drv->fillRect(bx, by, bw, 1, 0xFFFF);
+        drv->fillRect(bx, by + OTA_BAR_H - 1, bw, 1, 0xFFFF);
+        drv->fillRect(bx, by, 1, OTA_BAR_H, 0xFFFF);
+        drv->fillRect(bx + bw - 1, by, 1, OTA_BAR_H, 0xFFFF);
+        ota_bar_px_ = 0;
+    }
+    doOtaStatus(screen == OTA_ERROR && !msg.empty() ? msg : ota_status_text);
 }
 
-void DisplayManager::setOTAStatus(const std::string &status)
+void DisplayManager::doOtaStatus(const std::string &status)
 {
     ota_status_text = status;
     ESP_LOGI(TAG, "OTA status: %s", status.c_str());
 
-    if (!drv)
+    if (!drv || !otaScreenActive())
         return;
 
-    // TODO: Display status text on screen
-    // Example: show at bottom of screen
+    const int y = height_ / 2 + OTA_BAR_H + 12;
+    drv->fillRect(0, y, width_, 8, 0x0000);
+    drv->drawTextCenter(status.c_str(), 0xFFFF, width_ / 2, y + 4, 1, 0x0000);
 }
 
-void DisplayManager::showOTACompleted()
+void DisplayManager::doOtaProgress(uint8_t percent)
 {
-    ESP_LOGI(TAG, "Showing OTA completed screen");
-    ota_updating = false;
-    ota_completed = true;
-    ota_error = false;
-    ota_progress_percent = 100;
-    ota_status_text = "Update completed!";
-
-    if (!drv)
+    ESP_LOGD(TAG, "OTA progress: %u%%", percent);
+    if (!drv || !ota_updating)
         return;
 
-    drv->fillScreen(0x0000);
-    // TODO: Draw checkmark or success animation
-    // TODO: Display "Update Successful" message
+    // Extend the fill only by what changed since the last drawn value
+    const int bx = OTA_BAR_MARGIN + 2;
+    const int by = height_ / 2 + 2;
+    const int inner = width_ - 2 * OTA_BAR_MARGIN - 4;
+    const int px = inner * percent / 100;
+    if (px > ota_bar_px_)
+    {
+        drv->fillRect(bx + ota_bar_px_, by, px - ota_bar_px_, OTA_BAR_H - 4, 0x07E0);
+    }
+    else if (px < ota_bar_px_)
+    {
+        drv->fillRect(bx + px, by, ota_bar_px_ - px, OTA_BAR_H - 4, 0x0000);
+    }
+    ota_bar_px_ = px;
+
+    char buf[8];
+    snprintf(buf, sizeof(buf), "%3u%%", (unsigned)percent);
+    drv->drawTextCenter(buf, 0xFFFF, width_ / 2, height_ / 2 + OTA_BAR_H + 32, 1, 0x0000);
+    ota_progress_percent = percent;
 }
 
-void DisplayManager::showOTAError(const std::string &error_msg)
+// ============================================================================
+// Render command queue
+// ============================================================================
+
+DisplayManager::Command DisplayManager::makeCommand(Cmd kind, const std::string &text)
 {
-    ESP_LOGE(TAG, "Showing OTA error: %s", error_msg.c_str());
-    ota_updating = false;
-    ota_completed = false;
-    ota_error = true;
-    ota_error_msg = error_msg;
-    ota_status_text = "Update failed!";
+    Command c;
+    c.kind = kind;
+    size_t n = std::min(text.size(), CMD_TEXT_MAX - 1);
+    memcpy(c.text, text.data(), n);
+    c.text[n] = '\0';
+    return c;
+}
 
-    if (!drv)
-        return;
+// Producer side (any task). Never blocks: a full ring drops the command,
+// which only happens while the display loop is stopped.
+void DisplayManager::post(const Command &c)
+{
+    uint32_t pos = cmd_head_.load(std::memory_order_relaxed);
+    CmdSlot *slot = nullptr;
+    for (;;)
+    {
+        slot = &cmd_ring_[pos & (CMD_SLOTS - 1)];
+        uint32_t seq = slot->seq.load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0)
+        {
+            if (cmd_head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            cmd_dropped_.fetch_add(1, std::memory_order_relaxed);
+            ESP_LOGD(TAG, "Render queue full, command %u dropped", (unsigned)c.kind);
+            return;
+        }
+        else
+        {
+            pos = cmd_head_.load(std::memory_order_relaxed);
+        }
+    }
+    slot->cmd = c;
+    slot->seq.store(pos + 1, std::memory_order_release);
+    wake();
+}
 
-    drv->fillScreen(0x0000);
-    // TODO: Draw error icon (X mark)
-    // TODO: Display error message
+bool DisplayManager::popCommand(Command &out)
+{
+    CmdSlot &slot = cmd_ring_[cmd_tail_ & (CMD_SLOTS - 1)];
+    if (slot.seq.load(std::memory_order_acquire) != cmd_tail_ + 1)
+        return false;
+    out = slot.cmd;
+    slot.seq.store(cmd_tail_ + CMD_SLOTS, std::memory_order_release);
+    cmd_tail_++;
+    return true;
 }
 
-void DisplayManager::showRebooting()
+// Coalesce everything posted since the last tick into the newest command per
+// group, then apply the survivors in their original order (so e.g. a sleep
+// request followed by "idle" still ends awake).
+void DisplayManager::drainCommands()
 {
-    ESP_LOGI(TAG, "Showing rebooting screen");
-    ota_updating = false;
-    ota_completed = true;
-    ota_error = false;
-    ota_status_text = "Rebooting...";
+    enum Group : uint8_t { G_CONTENT, G_ICON, G_POWER, G_CRITICAL, G_OTA_SCREEN, G_OTA_STATUS, G_STATUS_ICON, G_COUNT };
+    Command latest[G_COUNT];
+    uint32_t order[G_COUNT];
+    bool have[G_COUNT] = {};
+
+    Command c;
+    uint32_t n = 0;
+    while (popCommand(c))
+    {
+        Group g = G_CONTENT;
+        switch (c.kind)
+        {
+        case Cmd::EMOTION:
+        case Cmd::TEXT:
+        case Cmd::CLEAR_TEXT:
+            g = G_CONTENT;
+            break;
+        case Cmd::ICON:
+            g = G_ICON;
+            break;
+        case Cmd::POWER_SAVE:
+            g = G_POWER;
+            break;
+        case Cmd::CRITICAL:
+            g = G_CRITICAL;
+            break;
+        case Cmd::OTA_SCREEN:
+            g = G_OTA_SCREEN;
+            break;
+        case Cmd::OTA_STATUS:
+            g = G_OTA_STATUS;
+            break;
+        case Cmd::STATUS_ICON:
+            g = G_STATUS_ICON;
+            break;
+        }
+        latest[g] = c;
+        order[g] = n++;
+        have[g] = true;
+    }
 
-    if (!drv)
-        return;
+    for (;;)
+    {
+        int next = -1;
+        for (int g = 0; g < G_COUNT; g++)
+        {
+            if (have[g] && (next < 0 || order[g] < order[next]))
+                next = g;
+        }
+        if (next < 0)
+            break;
+        have[next] = false;
+        applyCommand(latest[next]);
+    }
 
-    drv->fillScreen(0x0000);
-    // TODO: Draw rebooting animation or countdown
-    // TODO: Display "Device restarting..." message
+    int p = ota_progress_req_.exchange(-1, std::memory_order_acq_rel);
+    if (p >= 0 && (p != ota_progress_percent || ota_bar_px_ == 0))
+        doOtaProgress((uint8_t)p);
+}
+
+void DisplayManager::applyCommand(const Command &c)
+{
+    switch (c.kind)
+    {
+    case Cmd::EMOTION:
+        doPlayEmotion((asset::AnimId)c.arg, c.x, c.y);
+        break;
+    case Cmd::TEXT:
+        doPlayText(c.text, c.x, c.y, c.color, c.scale);
+        break;
+    case Cmd::CLEAR_TEXT:
+        doClearText();
+        break;
+    case Cmd::ICON:
+        doPlayIcon((asset::IconId)c.id, (IconPlacement)c.arg, c.x, c.y);
+        break;
+    case Cmd::POWER_SAVE:
+        doSetPowerSaveMode(c.arg != 0);
+        break;
+    case Cmd::CRITICAL:
+        doCritical(c.arg != 0);
+        break;
+    case Cmd::OTA_SCREEN:
+        doOtaScreen((OtaScreen)c.arg, c.text);
+        break;
+    case Cmd::OTA_STATUS:
+        doOtaStatus(c.text);
+        break;
+    case Cmd::STATUS_ICON:
+        doStatusIcon((asset::IconId)c.id);
+        break;
+    }
 }
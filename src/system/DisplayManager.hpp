@@ -2,14 +2,18 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <unordered_map>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 #include "StateTypes.hpp"
 #include "StateManager.hpp"
 #include "AnimationPlayer.hpp"
+#include "OverlayCompositor.hpp"
+#include "PmLock.hpp"
+#include "assets/asset_registry.hpp"
 
 // FreeRTOS (ESP32 task loop support)
 #include "freertos/FreeRTOS.h"
@@ -35,17 +39,17 @@ class AnimationPlayer;     // Multi-frame animation engine
 // - Handles emotion animation, icons, power-save mode
 // - Uses DisplayDriver for actual drawing
 //
+// Threading: the playback/OTA API may be called from any task. Calls only
+// post a command into a lock-free ring; the display task drains it at the
+// start of update() and is the only task that touches DisplayDriver/SPI.
+// Draining coalesces: the newest command of each kind wins, OTA progress is
+// a single latest-value slot, and requests matching what is already on
+// screen are dropped.
+//
 class DisplayManager {
 public:
    
 
-    // Icon asset descriptor
-    struct Icon {
-        int w = 0;
-        int h = 0;
-        const uint8_t* rle_data = nullptr;
-    };
-
     enum class IconPlacement {
         Custom,     // Use provided x,y
         Center,     // Centered on screen
@@ -64,18 +68,44 @@ public:
     void update(uint32_t dt_ms);
 
     // Lifecycle (consistent with other managers)
-    bool startLoop(uint32_t interval_ms = 33,
-                   UBaseType_t priority = 5,
-                   uint32_t stackSize = 4096,
-                   BaseType_t core = tskNO_AFFINITY);
+    // Core / priority / stack: TaskPlan::DISPLAY
+    bool startLoop(uint32_t interval_ms = 33);
     void stopLoop();
     bool isLoopRunning() const { return task_handle_ != nullptr; }
+    // Shortest frame period (fps ceiling). The loop does not poll at this rate:
+    // it sleeps until the next animation frame is due or a command arrives,
+    // and blocks indefinitely on a static screen.
     void setUpdateIntervalMs(uint32_t interval_ms) { update_interval_ms_ = interval_ms; }
+    // Extra floor on the frame period set from the power state (0 = none);
+    // slower playback drops frames, animation time stays real-time.
+    void setMinFramePeriodMs(uint32_t ms) { min_frame_ms_.store(ms, std::memory_order_relaxed); }
+
+    // --- Render pacing vs audio ----------------------------------------------
+    // The display shares core 1 (and the SPI/DMA interrupts) with the I2S
+    // tasks; audio wins. Frames are delayed (animation time stays real, so
+    // late frames are dropped), never the speaker / mic.
+    struct RenderBudget {
+        uint32_t frame_budget_us = 16000; // per render pass; later dirty rects wait
+        uint16_t voice_frame_ms = 100;    // fps cap while LISTENING / SPEAKING
+        uint16_t glitch_frame_ms = 200;   // fps cap after an audio glitch...
+        uint16_t glitch_hold_ms = 3000;   // ...for this long after the last one
+    };
+    void setRenderBudget(const RenderBudget& b) { budget_ = b; }
+    // Monotonic audio glitch count (I2S underruns + overruns), polled by the
+    // display task each pass; nullptr = none.
+    void setAudioGlitchProbe(std::function<uint32_t()> probe) { glitch_probe_ = std::move(probe); }
+
+    struct RenderStats {
+        uint32_t frames_rendered = 0;
+        uint32_t frames_dropped = 0; // animation frames never shown
+        uint32_t budget_cuts = 0;    // passes stopped by frame_budget_us
+        uint32_t deferred = 0;       // due frames held back by the fps cap
+        uint32_t glitch_backoffs = 0;
+    };
+    RenderStats renderStats() const;
     
     // Aliases for consistency with other managers
-    bool start(uint32_t interval_ms = 33, UBaseType_t priority = 5, uint32_t stackSize = 4096, BaseType_t core = tskNO_AFFINITY) {
-        return startLoop(interval_ms, priority, stackSize, core);
-    }
+    bool start(uint32_t interval_ms = 33) { return startLoop(interval_ms); }
     void stop() { stopLoop(); }
 
     // Enable or disable automatic UI updates via StateManager subscriptions.
@@ -84,6 +114,14 @@ public:
     // Exposed controls
     // Update battery percentage overlay (255 hides it).
     void setBatteryPercent(uint8_t p);
+
+    // Small status icon in the top bar (overlay layer, composited into the
+    // animation's scanline batches); IconId::NONE hides it.
+    void setStatusIcon(asset::IconId id);
+
+    // Force animation, text and overlays to be redrawn on the next update
+    // (frames are otherwise only pushed when they change).
+    void invalidate();
     
 
     // ======= OTA Update UI =======
@@ -105,23 +143,40 @@ public:
     // Show rebooting screen (after OTA success).
     void showRebooting();
 
-    // Power saving mode (stop animations)
+    // Emotion frame cache (2 bpp packed, bytes of RAM; 0 = off) and the
+    // 4-color palette the 2-bit frames are drawn with (theme).
+    void setEmotionCacheBudget(size_t bytes);
+    void setEmotionPalette(const uint16_t colors[4]);
+
+    // Power saving mode: pause the animation and switch the panel to the
+    // low-power "idle face" (partial area over the face + 8-colour idle mode).
     void setPowerSaveMode(bool enable);
 
+    // Marquee speed for text wider than the screen (px/s, landscape only).
+    void setMarqueeSpeed(uint16_t px_per_s) { marquee_speed_ = px_per_s; }
+
     // Backlight control passthrough
     void setBacklight(bool on);
     void setBrightness(uint8_t percent);
+    uint8_t getBrightness() const { return brightness_percent_; }
 
     // --- Asset Registration ---------------------------------------------------
-    // Register an emotion animation by name (copied into registry).
-    void registerEmotion(const std::string& name, const Animation1Bit& anim);
+    // Slots, built-in animations and icons are compile-time tables
+    // (assets/asset_registry.hpp, scripts/convert_assets.py registry).
+    // Override a slot with an animation loaded at runtime (AssetBundle);
+    // only the pointer is kept, `anim` must outlive the manager.
+    void registerEmotion(asset::AnimId id, const Animation1Bit& anim);
+    // By name, resolved to a slot once here; false if no slot has that name.
+    bool registerEmotion(std::string_view name, const Animation1Bit& anim);
+    // Runtime source asked first for every emotion started (animation packs,
+    // AnimPackCache::resolve). Called on the display task; the animation must
+    // stay valid until the source is asked again. nullptr = next source.
+    using EmotionSource = std::function<const Animation1Bit*(asset::AnimId)>;
+    void setEmotionSource(EmotionSource src) { emotion_source_ = std::move(src); }
 
-    // Register an icon asset by name (copied into registry).
-    void registerIcon(const std::string& name, const Icon& icon);
-    
     // --- Asset Playback (for testing/direct control) ---
-    // Play a named emotion animation at coordinates (default centers animation).
-    void playEmotion(const std::string& name, int x = 0, int y = 0);
+    // Play an emotion animation at coordinates (default centers animation).
+    void playEmotion(asset::AnimId id, int x = 0, int y = 0);
 
     // Render a text message (centers when x or y < 0); stops animation while active.
     void playText(const std::string& text,
@@ -150,26 +205,113 @@ private:
     // Respond to emotion state changes to map to animations.
     void handleEmotion(state::EmotionState s);
 
+    // Frame period floor right now (interval, power cap, voice / glitch caps)
+    uint32_t frameFloorMs() const;
+    // Poll the glitch probe; a new glitch (re)starts the slow window
+    void pollAudioGlitches();
+
     // Internal asset playback
     // Render an icon with optional placement helper.
-    void playIcon(const std::string& name,
+    void playIcon(asset::IconId id,
                   IconPlacement placement = IconPlacement::Custom,
                   int x = 0, int y = 0);
     static void taskEntry(void* arg);
+    // Wake the display task early (new command / overlay change)
+    void wake();
+    // How long the display task may sleep after an update (UINT32_MAX = until woken)
+    uint32_t nextWakeMs() const;
+
+    // --- Render command queue -------------------------------------------------
+    enum class Cmd : uint8_t {
+        EMOTION,      // arg = asset::AnimId, x/y
+        TEXT,         // text, x/y, color, scale
+        CLEAR_TEXT,
+        ICON,         // id = asset::IconId, arg = IconPlacement, x/y
+        POWER_SAVE,   // arg = on/off
+        CRITICAL,     // arg = enter/leave the PowerState::CRITICAL idle face
+        OTA_SCREEN,   // arg = OtaScreen, text = error message
+        OTA_STATUS,   // text
+        STATUS_ICON,  // id = asset::IconId (NONE = hide)
+    };
+    enum OtaScreen : uint8_t { OTA_UPDATING, OTA_COMPLETED, OTA_ERROR, OTA_REBOOTING };
+
+    static constexpr size_t CMD_TEXT_MAX = 48;   // longer strings are truncated
+    static constexpr size_t CMD_SLOTS = 16;      // power of 2
+
+    struct Command {
+        Cmd kind = Cmd::CLEAR_TEXT;
+        uint8_t arg = 0;
+        uint8_t id = 0;
+        uint8_t scale = 1;
+        uint16_t color = 0xFFFF;
+        int16_t x = 0;
+        int16_t y = 0;
+        char text[CMD_TEXT_MAX] = {};
+    };
+
+    // Bounded MPSC ring (per-slot sequence numbers): producers claim a slot
+    // with a CAS on cmd_head_, the display task is the only consumer.
+    struct CmdSlot {
+        std::atomic<uint32_t> seq{0};
+        Command cmd;
+    };
+
+    static Command makeCommand(Cmd kind, const std::string& text = std::string());
+    void post(const Command& c);
+    bool popCommand(Command& out);
+    void drainCommands();
+    void applyCommand(const Command& c);
+
+    // Display-task implementations behind the public API
+    void doPlayEmotion(asset::AnimId id, int x, int y);
+    // Animation of a slot: pack, bundle, then built-in; false if none
+    bool lookupEmotion(asset::AnimId id, Animation1Bit& out);
+    void doPlayText(const std::string& text, int x, int y, uint16_t color, int scale);
+    void doClearText();
+    void doPlayIcon(asset::IconId id, IconPlacement placement, int x, int y);
+    void doSetPowerSaveMode(bool enable);
+    void doCritical(bool enter);
+    void doOtaScreen(OtaScreen screen, const std::string& msg);
+    void doOtaStatus(const std::string& status);
+    void doOtaProgress(uint8_t percent);
+    void doStatusIcon(asset::IconId id);
+
+    // Status overlay layers (top bar), owned by the display task
+    enum OverlaySlot : uint8_t { OVL_BATTERY, OVL_STATUS_ICON };
+    void syncBatteryOverlay();
+    // Push overlay layers no animation batch carried this tick
+    void flushOverlay();
+
+    // Low-power panel mode. Requested from any task (state callbacks), applied
+    // by the display task so panel commands never interleave with pixel data.
+    // band = lines along the driver's scroll axis to keep lit (len 0 = all).
+    void requestLowPower(bool enable, int band_start = 0, int band_len = 0);
+    void applyLowPower();
+
+    // Text marquee on the hardware scroll band: only the newly exposed
+    // columns are drawn each tick, the panel shifts the rest.
+    void startMarquee();
+    void stepMarquee(uint32_t dt_ms);
+    void stopMarquee();
     
 
 private:
     std::unique_ptr<DisplayDriver> drv; // owned low-level driver
+    uint8_t brightness_percent_ = 100;  // last setBrightness()
     // No Framebuffer - direct rendering to display!
     std::unique_ptr<AnimationPlayer> anim_player;
 
-    // asset tables
-    std::unordered_map<std::string, Animation1Bit> emotions;
-    std::unordered_map<std::string, Icon> icons;
+    // Bundle overrides per slot (nullptr = built-in, asset::BUILTIN_ANIMS)
+    const Animation1Bit* emotion_override_[asset::ANIM_COUNT] = {};
+    // Packs, before the overrides (set before startLoop)
+    EmotionSource emotion_source_;
 
     // battery
     uint8_t battery_percent = 255;
-    uint8_t prev_battery_percent = 255;  // Track previous value to avoid redraw
+    uint8_t prev_battery_percent = 255;  // value in the overlay layer
+
+    // status layers, blended into animation batches (no redraw-after-render)
+    OverlayCompositor overlay_;
 
     // text playback state (mutually exclusive with animation)
     bool text_active_ = false;
@@ -180,6 +322,32 @@ private:
     uint16_t text_color_ = 0xFFFF;
     int text_scale_ = 1;
 
+    // marquee state (text mode, text wider than the screen, scroll axis = X)
+    bool marquee_active_ = false;
+    int marquee_pos_ = 0;          // virtual text column shown at screen x = 0
+    uint16_t marquee_offset_ = 0;  // current hardware scroll offset
+    uint32_t marquee_accum_ = 0;   // sub-pixel remainder (px * 1000)
+    uint16_t marquee_speed_ = 60;  // px/s
+    int marquee_y_ = 0;
+    int marquee_text_w_ = 0;
+
+    // render command queue
+    CmdSlot cmd_ring_[CMD_SLOTS];
+    std::atomic<uint32_t> cmd_head_{0};
+    uint32_t cmd_tail_ = 0;                  // display task only
+    std::atomic<int> ota_progress_req_{-1};  // latest setOTAProgress, -1 = none
+    std::atomic<uint32_t> cmd_dropped_{0};   // posts lost to a full ring
+    asset::AnimId emotion_playing_ = asset::AnimId::NONE; // dedupe repeated playEmotion
+
+    // low-power idle face
+    std::atomic<bool> low_power_req_{false};
+    bool low_power_on_ = false;
+    bool lp_critical_ = false; // entered for PowerState::CRITICAL
+    int lp_band_start_ = 0;
+    int lp_band_len_ = 0;
+    int face_band_start_ = 0;  // last emotion, along the scroll axis
+    int face_band_len_ = 0;
+
     // icon playback state (mutually exclusive with animation)
     bool icon_active_ = false;
     bool icon_mode_cleared_ = false;  // Track if screen cleared for icon mode
@@ -193,6 +361,8 @@ private:
     bool ota_completed = false;
     bool ota_error = false;
     std::string ota_error_msg = "";
+    int ota_bar_px_ = 0; // progress fill already on screen
+    bool otaScreenActive() const { return ota_updating || ota_completed || ota_error; }
 
     // subscriptions
     int sub_inter = -1;
@@ -208,6 +378,23 @@ private:
 
     // Task loop state
     TaskHandle_t task_handle_ = nullptr;
-    uint32_t update_interval_ms_ = 33; // ~30 FPS
+    uint32_t update_interval_ms_ = 33; // ~30 FPS ceiling
+    PmLock render_pm_;                 // CPU at max for one update() pass
+    std::atomic<uint32_t> min_frame_ms_{0};
+
+    // render pacing (display task, except voice_mode_)
+    RenderBudget budget_{};
+    std::function<uint32_t()> glitch_probe_;
+    uint32_t glitch_seen_ = 0;
+    bool glitch_synced_ = false;       // glitch_seen_ taken from the probe
+    TickType_t glitch_until_ = 0;      // slow window end (tick)
+    bool glitch_slow_ = false;
+    std::atomic<bool> voice_mode_{false}; // LISTENING / SPEAKING
+    TickType_t last_render_tick_ = 0;
+    bool render_now_ = false;          // new animation: first frame not capped
+    uint32_t frames_rendered_ = 0;
+    uint32_t frames_deferred_ = 0;
+    uint32_t glitch_backoffs_ = 0;
+    uint32_t wakeups_ = 0;             // loop iterations (pacing stats)
     std::atomic<bool> task_running_{false};  // ✅ Graceful shutdown flag
 };
@@ -0,0 +1,421 @@
+#include "EventLog.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "system/FlashFs.hpp"
+
+#if CONFIG_ESP_COREDUMP_ENABLE_TO_FLASH && CONFIG_ESP_COREDUMP_DATA_FORMAT_ELF
+#include "esp_core_dump.h"
+#define EVLOG_COREDUMP 1
+#endif
+
+static const char *TAG = "EventLog";
+
+namespace
+{
+    // Newest records in CUR, the previous file in OLD (renamed when CUR is full)
+    const char *CUR_PATH = "/spiffs/evlog.bin";
+    const char *OLD_PATH = "/spiffs/evlog.old";
+    const char *CURSOR_PATH = "/spiffs/evlog.cur";
+
+    constexpr size_t URGENT_FILL = EventLog::RAM_RECORDS * 3 / 4; // flush before the ring overflows
+
+    bool urgentType(EventLog::Type t)
+    {
+        return t == EventLog::Type::BOOT || t == EventLog::Type::PANIC || t == EventLog::Type::WDT ||
+               t == EventLog::Type::BROWNOUT;
+    }
+
+    uint32_t nowMs()
+    {
+        return static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    }
+} // namespace
+
+EventLog &EventLog::instance()
+{
+    static EventLog inst;
+    return inst;
+}
+
+// ============================================================================
+// Boot
+// ============================================================================
+void EventLog::captureBoot()
+{
+    const esp_reset_reason_t reason = esp_reset_reason();
+
+    // Deep sleep wake-ups (battery re-checks every few minutes) are not
+    // resets: logging them would write flash on every timer wake
+    if (reason != ESP_RST_DEEPSLEEP)
+    {
+        uint32_t build = 0;
+        const esp_app_desc_t *app = esp_ota_get_app_description();
+        if (app)
+            build = (uint32_t)app->app_elf_sha256[0] << 24 | (uint32_t)app->app_elf_sha256[1] << 16 |
+                    (uint32_t)app->app_elf_sha256[2] << 8 | app->app_elf_sha256[3];
+        record(Type::BOOT, static_cast<uint8_t>(reason), build);
+    }
+
+    switch (reason)
+    {
+    case ESP_RST_PANIC:
+    {
+        uint32_t pc = 0;
+        uint8_t valid = 0;
+        char task[4] = {};
+#ifdef EVLOG_COREDUMP
+        // Only the summary: the full dump stays in flash for espcoredump.py
+        esp_core_dump_summary_t *sum = new (std::nothrow) esp_core_dump_summary_t;
+        if (sum && esp_core_dump_image_check() == ESP_OK && esp_core_dump_get_summary(sum) == ESP_OK)
+        {
+            pc = sum->exc_pc;
+            valid = 1;
+            memcpy(task, sum->exc_task, std::min(sizeof(task), strnlen(sum->exc_task, sizeof(sum->exc_task))));
+        }
+        delete sum;
+#endif
+        record(Type::PANIC, valid, pc);
+        if (valid)
+        {
+            uint32_t name = 0;
+            memcpy(&name, task, sizeof(name));
+            record(Type::PANIC_TASK, 0, name);
+        }
+        break;
+    }
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+        record(Type::WDT, static_cast<uint8_t>(reason));
+        break;
+    case ESP_RST_BROWNOUT:
+        record(Type::BROWNOUT);
+        break;
+    default:
+        break;
+    }
+
+    if (esp_register_shutdown_handler(&EventLog::onShutdown) != ESP_OK)
+        ESP_LOGW(TAG, "No shutdown hook: events since the last flush are lost on restart");
+}
+
+void EventLog::onShutdown()
+{
+    instance().flush();
+}
+
+// ============================================================================
+// Record (any task, RAM only)
+// ============================================================================
+bool EventLog::record(Type t, uint8_t arg, uint32_t value)
+{
+    const uint32_t t_ms = nowMs();
+    bool stored = false;
+    portENTER_CRITICAL(&lock_);
+    if (ring_n_ < RAM_RECORDS)
+    {
+        Record &r = ring_[ring_n_++];
+        r.seq = 0;
+        r.t_ms = t_ms;
+        r.boot = 0;
+        r.type = static_cast<uint8_t>(t);
+        r.arg = arg;
+        r.value = value;
+        urgent_ |= urgentType(t);
+        stats_.recorded++;
+        stored = true;
+    }
+    else
+    {
+        lost_++;
+        stats_.dropped++;
+    }
+    portEXIT_CRITICAL(&lock_);
+    return stored;
+}
+
+// ============================================================================
+// Flush (flash)
+// ============================================================================
+uint32_t EventLog::msUntilFlush() const
+{
+    portENTER_CRITICAL(&lock_);
+    const bool pending = ring_n_ || lost_;
+    const bool now = urgent_ || ring_n_ >= URGENT_FILL;
+    const int64_t last = last_flush_us_;
+    portEXIT_CRITICAL(&lock_);
+
+    if (!pending && sent_seq_.load() == saved_sent_)
+        return UINT32_MAX;
+    if (now || failed_)
+        return failed_ ? UINT32_MAX : 0;
+    const int64_t left_us = last + static_cast<int64_t>(FLUSH_MIN_MS) * 1000 - esp_timer_get_time();
+    return left_us > 0 ? static_cast<uint32_t>((left_us + 999) / 1000) : 0;
+}
+
+bool EventLog::flushIfDue()
+{
+    return msUntilFlush() != 0 || flush();
+}
+
+bool EventLog::flush()
+{
+    // One flusher at a time (network loop vs. deep sleep / restart)
+    if (flushing_.exchange(true))
+        return false;
+
+    bool ok = open();
+    if (ok)
+    {
+        Record *batch = flush_buf_;
+        size_t n;
+        uint32_t lost;
+        portENTER_CRITICAL(&lock_);
+        n = ring_n_;
+        memcpy(batch, ring_, n * sizeof(Record));
+        lost = lost_;
+        ring_n_ = 0;
+        lost_ = 0;
+        urgent_ = false;
+        portEXIT_CRITICAL(&lock_);
+
+        if (lost)
+            batch[n++] = Record{0, nowMs(), 0, static_cast<uint8_t>(Type::LOST), 0, lost};
+        for (size_t i = 0; i < n; i++)
+        {
+            batch[i].seq = next_seq_++;
+            batch[i].boot = boot_;
+        }
+        if (n)
+            ok = appendRecords(batch, n);
+        if (sent_seq_.load() != saved_sent_)
+            ok = saveCursor() && ok;
+    }
+
+    portENTER_CRITICAL(&lock_);
+    last_flush_us_ = esp_timer_get_time();
+    stats_.flushes++;
+    if (!ok)
+        stats_.errors++;
+    portEXIT_CRITICAL(&lock_);
+
+    flushing_ = false;
+    return ok;
+}
+
+bool EventLog::open()
+{
+    if (opened_ || failed_)
+        return opened_;
+    if (!FlashFs::instance().mount())
+    {
+        failed_ = true; // no partition: records stay RAM-only (and get dropped)
+        return false;
+    }
+
+    Record first, last;
+    if (fileRange(CUR_PATH, first, last) || fileRange(OLD_PATH, first, last))
+    {
+        next_seq_ = last.seq + 1;
+        boot_ = static_cast<uint16_t>(last.boot + 1);
+        last_seq_ = last.seq;
+    }
+
+    FILE *f = fopen(CURSOR_PATH, "rb");
+    if (f)
+    {
+        uint32_t sent = 0;
+        if (fread(&sent, sizeof(sent), 1, f) == 1 && sent < next_seq_)
+            sent_seq_ = saved_sent_ = sent;
+        fclose(f);
+    }
+
+    opened_ = true;
+    ESP_LOGI(TAG, "Boot #%u, next seq %u, %u unsent", (unsigned)boot_, (unsigned)next_seq_,
+             (unsigned)(last_seq_.load() - sent_seq_.load()));
+    return true;
+}
+
+bool EventLog::appendRecords(const Record *recs, size_t n)
+{
+    FILE *f = fopen(CUR_PATH, "ab");
+    if (!f)
+        return false;
+    fseek(f, 0, SEEK_END); // append streams may start at 0 until the first write
+    const long size = ftell(f);
+    // Torn tail (power lost mid-append) also rotates: records stay aligned
+    if (size + static_cast<long>(n * sizeof(Record)) > static_cast<long>(FILE_MAX) ||
+        size % static_cast<long>(sizeof(Record)) != 0)
+    {
+        // Rotate: the oldest half of the history goes
+        fclose(f);
+        remove(OLD_PATH);
+        rename(CUR_PATH, OLD_PATH);
+        f = fopen(CUR_PATH, "ab");
+        if (!f)
+            return false;
+    }
+    const bool ok = fwrite(recs, sizeof(Record), n, f) == n;
+    fclose(f);
+    if (!ok)
+    {
+        ESP_LOGE(TAG, "Append of %u record(s) failed", (unsigned)n);
+        return false;
+    }
+    last_seq_ = recs[n - 1].seq;
+    portENTER_CRITICAL(&lock_);
+    stats_.written += n;
+    portEXIT_CRITICAL(&lock_);
+    return true;
+}
+
+bool EventLog::saveCursor()
+{
+    const uint32_t sent = sent_seq_.load();
+    FILE *f = fopen(CURSOR_PATH, "wb");
+    if (!f)
+        return false;
+    const bool ok = fwrite(&sent, sizeof(sent), 1, f) == 1;
+    fclose(f);
+    if (ok)
+        saved_sent_ = sent;
+    return ok;
+}
+
+bool EventLog::fileRange(const char *path, Record &first, Record &last)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+    // A torn last record (power lost mid-append) is ignored
+    long size = 0;
+    bool ok = fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= static_cast<long>(sizeof(Record)) &&
+              fseek(f, 0, SEEK_SET) == 0 && fread(&first, sizeof(Record), 1, f) == 1 &&
+              fseek(f, (size / sizeof(Record) - 1) * sizeof(Record), SEEK_SET) == 0 &&
+              fread(&last, sizeof(Record), 1, f) == 1;
+    fclose(f);
+    return ok;
+}
+
+// ============================================================================
+// Upload
+// ============================================================================
+bool EventLog::hasUnsent() const
+{
+    return last_seq_.load() > sent_seq_.load();
+}
+
+size_t EventLog::readUnsent(uint8_t *buf, size_t cap, uint32_t &last_seq)
+{
+    if (!opened_ || !hasUnsent() || cap < HEADER_BYTES + sizeof(Record))
+        return 0;
+
+    const size_t max = (cap - HEADER_BYTES) / sizeof(Record);
+    size_t count = 0;
+    uint32_t want = sent_seq_.load() + 1;
+
+    // Seqs are consecutive within the files: seek straight to the first unsent
+    for (const char *path : {OLD_PATH, CUR_PATH})
+    {
+        Record first, last;
+        if (count >= max || !fileRange(path, first, last) || last.seq < want)
+            continue;
+        want = std::max(want, first.seq); // older ones rotated out
+        FILE *f = fopen(path, "rb");
+        if (!f)
+            continue;
+        if (fseek(f, static_cast<long>((want - first.seq) * sizeof(Record)), SEEK_SET) == 0)
+        {
+            const size_t n = fread(buf + HEADER_BYTES + count * sizeof(Record), sizeof(Record),
+                                   std::min<size_t>(max - count, last.seq - want + 1), f);
+            count += n;
+            want += n;
+        }
+        fclose(f);
+    }
+    if (!count)
+        return 0;
+
+    buf[0] = 'E';
+    buf[1] = 'V';
+    buf[2] = VERSION;
+    buf[3] = sizeof(Record);
+    buf[4] = static_cast<uint8_t>(count);
+    buf[5] = static_cast<uint8_t>(count >> 8);
+    buf[6] = static_cast<uint8_t>(boot_);
+    buf[7] = static_cast<uint8_t>(boot_ >> 8);
+    last_seq = want - 1;
+    return HEADER_BYTES + count * sizeof(Record);
+}
+
+void EventLog::commitSent(uint32_t last_seq)
+{
+    const uint32_t prev = sent_seq_.exchange(last_seq);
+    if (last_seq > prev)
+    {
+        portENTER_CRITICAL(&lock_);
+        stats_.uploaded += last_seq - prev;
+        portEXIT_CRITICAL(&lock_);
+    }
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+const char *EventLog::typeName(uint8_t type)
+{
+    static constexpr const char *NAMES[] = {"?",         "boot",    "panic",   "panic_task", "wdt",
+                                            "brownout",  "spk_ur",  "mic_or",  "wifi_down",  "wifi_up",
+                                            "ws_down",   "mqtt_up", "lost",    "audio_slo",  "audio_ok",
+                                            "roam",      "link"};
+    return type < sizeof(NAMES) / sizeof(NAMES[0]) ? NAMES[type] : "?";
+}
+
+EventLog::Stats EventLog::stats() const
+{
+    portENTER_CRITICAL(&lock_);
+    const Stats s = stats_;
+    portEXIT_CRITICAL(&lock_);
+    return s;
+}
+
+void EventLog::print(size_t last)
+{
+    const Stats s = stats();
+    portENTER_CRITICAL(&lock_);
+    const size_t pending = ring_n_;
+    portEXIT_CRITICAL(&lock_);
+
+    ESP_LOGI(TAG, "boot #%u: %u recorded, %u dropped, %u in RAM; %u written in %u flush(es), %u error(s)",
+             (unsigned)boot_, (unsigned)s.recorded, (unsigned)s.dropped, (unsigned)pending, (unsigned)s.written,
+             (unsigned)s.flushes, (unsigned)s.errors);
+    ESP_LOGI(TAG, "seq %u flashed, %u uploaded (%u this boot)", (unsigned)last_seq_.load(),
+             (unsigned)sent_seq_.load(), (unsigned)s.uploaded);
+    if (!opened_ || !last)
+        return;
+
+    Record first, end;
+    if (!fileRange(CUR_PATH, first, end))
+        return;
+    FILE *f = fopen(CUR_PATH, "rb");
+    if (!f)
+        return;
+    const size_t total = end.seq - first.seq + 1;
+    const size_t skip = total > last ? total - last : 0;
+    Record r;
+    if (fseek(f, static_cast<long>(skip * sizeof(Record)), SEEK_SET) == 0)
+    {
+        while (fread(&r, sizeof(r), 1, f) == 1)
+            ESP_LOGI(TAG, "  #%u boot %u %8u ms  %-10s arg=%u value=0x%08x", (unsigned)r.seq, (unsigned)r.boot,
+                     (unsigned)r.t_ms, typeName(r.type), (unsigned)r.arg, (unsigned)r.value);
+    }
+    fclose(f);
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+
+/**
+ * EventLog
+ * ============================================================================
+ * Nhật ký sự cố / hiệu năng dạng nhị phân trên FlashFs (/spiffs/evlog.*), sống
+ * qua reset để biết thiết bị ngoài hiện trường đã gặp gì trước khi khởi động
+ * lại: nguyên nhân reset (panic, watchdog, brown-out) + tóm tắt core dump khi
+ * bật, I2S underrun / overrun, SLO audio (AudioHealth), Wi-Fi / WS / MQTT
+ * rớt và nối lại, chất lượng link / roaming.
+ *
+ * - record(): mọi task, chỉ ghi vào vòng RAM (RAM_RECORDS bản ghi 16 byte,
+ *   không chặn, không đụng flash). Vòng đầy → bản ghi mới bị bỏ và đếm, lần
+ *   flush sau ghi thêm một bản ghi LOST.
+ * - flushIfDue(): network loop; nối vòng RAM vào file nhiều nhất mỗi
+ *   FLUSH_MIN_MS (ghi flash dừng cache cả hai core), ngay lập tức với bản ghi
+ *   reset / panic hoặc khi vòng gần đầy. seq (tăng liên tục qua các lần boot)
+ *   và boot được gán lúc flush. Hai file xoay vòng, mỗi file tối đa FILE_MAX.
+ * - readUnsent() / commitSent(): upload dần lên MQTT `<base>/events` (QoS 1)
+ *   từ seq cuối cùng đã gửi (con trỏ lưu trong evlog.cur cùng lần flush kế
+ *   tiếp; reboot trước đó → server nhận trùng, lọc theo seq).
+ *
+ * Upload payload (little-endian): header 8 byte {'E','V', version, record
+ * size, count u16, boot u16} rồi count bản ghi Record.
+ */
+class EventLog
+{
+public:
+    enum class Type : uint8_t
+    {
+        BOOT = 1,     // arg = esp_reset_reason_t, value = ELF SHA-256 prefix (firmware build)
+        PANIC,        // value = exception PC (core dump summary), arg = 1 when the dump checks out
+        PANIC_TASK,   // value = first 4 chars of the crashed task's name
+        WDT,          // arg = esp_reset_reason_t (task / interrupt / other watchdog)
+        BROWNOUT,
+        SPK_UNDERRUN, // value = I2S TX underruns since the previous record
+        MIC_OVERRUN,  // value = I2S RX overruns since the previous record
+        WIFI_DOWN,
+        WIFI_UP,      // value = ms offline
+        WS_DOWN,
+        MQTT_UP,      // arg = 1: session resumed
+        LOST,         // value = records dropped (RAM ring full)
+        AUDIO_SLO,    // AudioHealth breach: arg = Slo | Stage << 4, value = measured over the window
+        AUDIO_OK,     // same SLO back within its limit
+        ROAM,         // arg = 1: 802.11v query, 0: directed reconnect; value = RSSI from (u8) | to (u8) << 8
+        LINK,         // link quality changed: arg = LinkQualityMonitor::Quality, value = RSSI (u8) | RTT ms << 8
+    };
+
+#pragma pack(push, 1)
+    struct Record
+    {
+        uint32_t seq;  // 0 until flushed
+        uint32_t t_ms; // uptime within that boot
+        uint16_t boot;
+        uint8_t type;  // Type
+        uint8_t arg;
+        uint32_t value;
+    };
+#pragma pack(pop)
+    static_assert(sizeof(Record) == 16, "Record is the on-flash / on-wire layout");
+
+    static constexpr size_t RAM_RECORDS = 64;
+    static constexpr uint32_t FLUSH_MIN_MS = 60000;     // rate limit for routine records
+    static constexpr size_t FILE_MAX = 16 * 1024;       // per file, two files
+    static constexpr size_t HEADER_BYTES = 8;
+    static constexpr uint8_t VERSION = 1;
+
+    struct Stats
+    {
+        uint32_t recorded = 0;
+        uint32_t dropped = 0; // RAM ring full
+        uint32_t flushes = 0;
+        uint32_t written = 0; // records appended to flash
+        uint32_t uploaded = 0;
+        uint32_t errors = 0;  // flash I/O
+    };
+
+    static EventLog &instance();
+
+    // Reset reason (+ core dump summary) of the boot that just happened;
+    // call once from app_main. Also flushes on esp_restart().
+    void captureBoot();
+
+    // Any task; RAM only, never blocks. False: ring full (counted).
+    bool record(Type t, uint8_t arg = 0, uint32_t value = 0);
+
+    // Network loop: append the RAM ring when due (rate limit above)
+    bool flushIfDue();
+    // Append now (deep sleep, restart, console); mounts FlashFs on first use
+    bool flush();
+    // Time until flushIfDue() has work; UINT32_MAX when clean
+    uint32_t msUntilFlush() const;
+
+    // Flashed records not uploaded yet
+    bool hasUnsent() const;
+    // Header + up to (cap - HEADER_BYTES) / sizeof(Record) unsent records;
+    // 0 when nothing is pending. last_seq: pass to commitSent() once published.
+    size_t readUnsent(uint8_t *buf, size_t cap, uint32_t &last_seq);
+    void commitSent(uint32_t last_seq);
+
+    static const char *typeName(uint8_t type);
+
+    Stats stats() const;
+    // Counters and the newest flashed records (serial "evlog")
+    void print(size_t last = 16);
+
+private:
+    EventLog() = default;
+
+    static void onShutdown();
+    // First flush: mount, recover seq / boot / cursor from the files
+    bool open();
+    bool appendRecords(const Record *recs, size_t n);
+    bool saveCursor();
+    // First and last record of a file; false when missing / empty
+    static bool fileRange(const char *path, Record &first, Record &last);
+
+    mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+    Record ring_[RAM_RECORDS] = {};
+    size_t ring_n_ = 0;
+    uint32_t lost_ = 0;      // dropped since the last flush
+    bool urgent_ = false;    // reset / panic record pending
+    int64_t last_flush_us_ = 0;
+    Stats stats_{};
+
+    // Flash side (flusher only: network loop, or the caller of flush())
+    std::atomic<bool> flushing_{false};
+    Record flush_buf_[RAM_RECORDS + 1] = {}; // ring copy + LOST (off the caller's stack)
+    bool opened_ = false;
+    bool failed_ = false;
+    uint32_t next_seq_ = 1;
+    uint16_t boot_ = 0;
+    std::atomic<uint32_t> last_seq_{0}; // newest flashed
+    std::atomic<uint32_t> sent_seq_{0}; // newest uploaded
+    uint32_t saved_sent_ = 0;           // sent_seq_ as in evlog.cur
+};
@@ -0,0 +1,52 @@
+#include "FlashFs.hpp"
+
+#include "esp_log.h"
+#include "esp_spiffs.h"
+
+static const char *TAG = "FlashFs";
+static const char *PARTITION = "spiffs";
+
+FlashFs &FlashFs::instance()
+{
+    static FlashFs inst;
+    return inst;
+}
+
+bool FlashFs::mount()
+{
+    if (mounted_ || failed_)
+        return mounted_;
+
+    esp_vfs_spiffs_conf_t conf = {};
+    conf.base_path = BASE;
+    conf.partition_label = PARTITION;
+    conf.max_files = 4;
+    conf.format_if_mount_failed = true;
+
+    esp_err_t err = esp_vfs_spiffs_register(&conf);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Mount %s failed: %s", BASE, esp_err_to_name(err));
+        failed_ = true;
+        return false;
+    }
+    mounted_ = true;
+    ESP_LOGI(TAG, "Mounted %s: %u / %u bytes used", BASE, (unsigned)usedBytes(), (unsigned)totalBytes());
+    return true;
+}
+
+size_t FlashFs::totalBytes() const
+{
+    size_t total = 0, used = 0;
+    if (!mounted_ || esp_spiffs_info(PARTITION, &total, &used) != ESP_OK)
+        return 0;
+    return total;
+}
+
+size_t FlashFs::usedBytes() const
+{
+    size_t total = 0, used = 0;
+    if (!mounted_ || esp_spiffs_info(PARTITION, &total, &used) != ESP_OK)
+        return 0;
+    return used;
+}
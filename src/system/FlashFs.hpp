@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * FlashFs
+ * ============================================================================
+ * SPIFFS trên partition "spiffs" (partitions_*.csv), mount tại /spiffs. Dùng
+ * cho dữ liệu tạm cần sống qua RAM hạn chế (vd phần tràn của UtteranceStore
+ * khi WS rớt giữa lượt nói), không dùng cho cấu hình (NVS).
+ *
+ * mount() lười: gọi lần đầu khi cần, không nằm trên đường boot. Partition
+ * chưa format / hỏng → format một lần (mất dữ liệu tạm, không sao).
+ * Ghi flash dừng cache của cả hai core trong lúc erase: caller giữ tần suất
+ * ghi thấp (gom thành khối, RAM trước).
+ */
+class FlashFs
+{
+public:
+    static constexpr const char *BASE = "/spiffs";
+
+    static FlashFs &instance();
+
+    // Idempotent; false when the partition is missing or cannot be formatted.
+    bool mount();
+    bool mounted() const { return mounted_; }
+
+    // Partition size / bytes used (0 when not mounted).
+    size_t totalBytes() const;
+    size_t usedBytes() const;
+
+private:
+    FlashFs() = default;
+
+    bool mounted_ = false;
+    bool failed_ = false; // do not retry a missing partition on every call
+};
@@ -0,0 +1,127 @@
+#include "HeatshrinkDecoder.hpp"
+
+#include <cstring>
+#include <new>
+
+#include "esp_log.h"
+
+static const char *TAG = "Heatshrink";
+
+bool HeatshrinkDecoder::init(uint8_t window_sz2, uint8_t lookahead_sz2)
+{
+    deinit();
+    if (window_sz2 < 4 || window_sz2 > 15 || lookahead_sz2 < 3 || lookahead_sz2 >= window_sz2)
+    {
+        ESP_LOGE(TAG, "Bad parameters: window=%u lookahead=%u", window_sz2, lookahead_sz2);
+        return false;
+    }
+
+    const size_t size = static_cast<size_t>(1) << window_sz2;
+    window_.reset(new (std::nothrow) uint8_t[size]);
+    if (!window_)
+    {
+        ESP_LOGE(TAG, "Out of memory (%u B window)", (unsigned)size);
+        return false;
+    }
+
+    w_bits_ = window_sz2;
+    l_bits_ = lookahead_sz2;
+    mask_ = static_cast<uint16_t>(size - 1);
+    reset();
+    return true;
+}
+
+void HeatshrinkDecoder::deinit()
+{
+    window_.reset();
+    mask_ = 0;
+    w_bits_ = 0;
+    l_bits_ = 0;
+}
+
+void HeatshrinkDecoder::reset()
+{
+    // The encoder treats data before the stream start as zeros
+    if (window_)
+        memset(window_.get(), 0, static_cast<size_t>(mask_) + 1);
+    head_ = 0;
+    state_ = State::TAG;
+    bit_buf_ = 0;
+    bit_count_ = 0;
+    copy_index_ = 0;
+    copy_left_ = 0;
+}
+
+bool HeatshrinkDecoder::getBits(uint8_t n, const uint8_t *&in, size_t &in_len, uint16_t &v)
+{
+    while (bit_count_ < n)
+    {
+        if (in_len == 0)
+            return false;
+        bit_buf_ = (bit_buf_ << 8) | *in++;
+        in_len--;
+        bit_count_ += 8;
+    }
+    bit_count_ -= n;
+    v = static_cast<uint16_t>((bit_buf_ >> bit_count_) & ((1u << n) - 1));
+    return true;
+}
+
+void HeatshrinkDecoder::emit(uint8_t b, uint8_t *out, size_t &produced)
+{
+    out[produced++] = b;
+    window_[head_] = b;
+    head_ = (head_ + 1) & mask_;
+}
+
+size_t HeatshrinkDecoder::decode(const uint8_t *&in, size_t &in_len, uint8_t *out, size_t out_cap)
+{
+    if (!window_ || !out)
+        return 0;
+
+    size_t produced = 0;
+    uint16_t v = 0;
+    while (produced < out_cap)
+    {
+        switch (state_)
+        {
+        case State::TAG:
+            if (!getBits(1, in, in_len, v))
+                return produced;
+            state_ = v ? State::LITERAL : State::INDEX;
+            break;
+
+        case State::LITERAL:
+            if (!getBits(8, in, in_len, v))
+                return produced;
+            emit(static_cast<uint8_t>(v), out, produced);
+            state_ = State::TAG;
+            break;
+
+        case State::INDEX:
+            if (!getBits(w_bits_, in, in_len, v))
+                return produced;
+            copy_index_ = static_cast<uint16_t>(v + 1);
+            state_ = State::COUNT;
+            break;
+
+        case State::COUNT:
+            if (!getBits(l_bits_, in, in_len, v))
+                return produced;
+            copy_left_ = static_cast<uint16_t>(v + 1);
+            state_ = State::COPY;
+            break;
+
+        case State::COPY:
+            while (copy_left_ > 0 && produced < out_cap)
+            {
+                emit(window_[(head_ - copy_index_) & mask_], out, produced);
+                copy_left_--;
+            }
+            if (copy_left_ == 0)
+                state_ = State::TAG;
+            break;
+        }
+    }
+    return produced;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * HeatshrinkDecoder
+ * ============================================================================
+ * Streaming decoder cho định dạng LZSS của heatshrink (tương thích với
+ * `heatshrink -w W -l L` / python heatshrink2), dùng để giải nén ảnh OTA
+ * ngay trên đường ghi flash.
+ *
+ * Bit stream (MSB trước):
+ *   1 + 8 bit              literal
+ *   0 + W bit (idx - 1) + L bit (count - 1)
+ *                          copy `count` byte từ `idx` byte phía sau
+ *
+ * RAM: cửa sổ 2^W byte (W = 8..12 → 256 B..4 KB). Input/output được cấp
+ * từng phần tuỳ ý; trạng thái (kể cả back-reference dang dở) giữ qua các lần
+ * gọi decode().
+ */
+class HeatshrinkDecoder
+{
+public:
+    HeatshrinkDecoder() = default;
+    ~HeatshrinkDecoder() = default;
+
+    HeatshrinkDecoder(const HeatshrinkDecoder &) = delete;
+    HeatshrinkDecoder &operator=(const HeatshrinkDecoder &) = delete;
+
+    // window_sz2 in [4, 15], lookahead_sz2 in [3, window_sz2)
+    bool init(uint8_t window_sz2, uint8_t lookahead_sz2);
+    void deinit();
+    void reset();
+
+    bool valid() const { return window_ != nullptr; }
+
+    // Decode from `in` (advanced, `in_len` decremented) into out[0..out_cap).
+    // Returns bytes produced; stops when the input is used up or out is full.
+    size_t decode(const uint8_t *&in, size_t &in_len, uint8_t *out, size_t out_cap);
+
+    // A back-reference still has bytes to emit (call decode() again with
+    // more output room even if the input is empty).
+    bool pending() const { return state_ == State::COPY && copy_left_ > 0; }
+
+private:
+    enum class State : uint8_t
+    {
+        TAG,
+        LITERAL,
+        INDEX,
+        COUNT,
+        COPY
+    };
+
+    // Next `n` (<= 15) bits MSB-first; false if the input ran out (kept for later)
+    bool getBits(uint8_t n, const uint8_t *&in, size_t &in_len, uint16_t &v);
+    void emit(uint8_t b, uint8_t *out, size_t &produced);
+
+    std::unique_ptr<uint8_t[]> window_;
+    uint16_t mask_ = 0;
+    uint16_t head_ = 0;
+    uint8_t w_bits_ = 0;
+    uint8_t l_bits_ = 0;
+
+    State state_ = State::TAG;
+    uint32_t bit_buf_ = 0;
+    uint8_t bit_count_ = 0;
+    uint16_t copy_index_ = 0;
+    uint16_t copy_left_ = 0;
+};
@@ -0,0 +1,150 @@
+#include "InitGraph.hpp"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "InitGraph";
+
+namespace
+{
+    const char *resultName(InitGraph::Result r)
+    {
+        switch (r)
+        {
+        case InitGraph::Result::OK:
+            return "ok";
+        case InitGraph::Result::FAILED:
+            return "FAILED";
+        case InitGraph::Result::SKIPPED:
+            return "skipped";
+        default:
+            return "pending";
+        }
+    }
+} // namespace
+
+InitGraph::InitGraph(const char *name) : name_(name)
+{
+    done_ = xEventGroupCreateStatic(&done_buf_);
+}
+
+InitGraph::~InitGraph()
+{
+    if (done_)
+        vEventGroupDelete(done_);
+}
+
+int InitGraph::add(const char *name, std::initializer_list<int> deps, BaseType_t core, StageFn fn,
+                   uint32_t stack_bytes)
+{
+    if (count_ >= MAX_STAGES)
+    {
+        ESP_LOGE(TAG, "[%s] too many stages, '%s' dropped", name_, name);
+        return -1;
+    }
+
+    EventBits_t mask = 0;
+    for (int d : deps)
+    {
+        if (d < 0 || static_cast<size_t>(d) >= count_)
+        {
+            ESP_LOGE(TAG, "[%s] '%s': unknown dependency %d", name_, name, d);
+            return -1;
+        }
+        mask |= EventBits_t(1) << d;
+    }
+
+    Stage &st = stages_[count_];
+    st.name = name;
+    st.fn = std::move(fn);
+    st.deps = mask;
+    st.core = core;
+    st.stack = stack_bytes;
+    st.graph = this;
+    return static_cast<int>(count_++);
+}
+
+bool InitGraph::run(UBaseType_t priority)
+{
+    if (!done_)
+        return false;
+
+    const EventBits_t all = (EventBits_t(1) << count_) - 1;
+    xEventGroupClearBits(done_, all);
+    t0_us_ = esp_timer_get_time();
+
+    for (size_t i = 0; i < count_; i++)
+    {
+        Stage &st = stages_[i];
+        if (xTaskCreatePinnedToCore(&InitGraph::stageTask, st.name, st.stack, &st,
+                                    priority, nullptr, st.core) != pdPASS)
+        {
+            // No task: run it here once its deps are done (serial fallback)
+            ESP_LOGW(TAG, "[%s] no task for '%s', running inline", name_, st.name);
+            runStage(st);
+        }
+    }
+
+    xEventGroupWaitBits(done_, all, pdFALSE, pdTRUE, portMAX_DELAY);
+    total_us_ = esp_timer_get_time() - t0_us_;
+
+    bool ok = true;
+    for (size_t i = 0; i < count_; i++)
+        ok = ok && stages_[i].result == Result::OK;
+    return ok;
+}
+
+InitGraph::Result InitGraph::result(int id) const
+{
+    if (id < 0 || static_cast<size_t>(id) >= count_)
+        return Result::PENDING;
+    return stages_[id].result;
+}
+
+void InitGraph::stageTask(void *arg)
+{
+    auto *st = static_cast<Stage *>(arg);
+    st->graph->runStage(*st);
+    vTaskDelete(nullptr);
+}
+
+void InitGraph::runStage(Stage &st)
+{
+    if (st.deps)
+        xEventGroupWaitBits(done_, st.deps, pdFALSE, pdTRUE, portMAX_DELAY);
+
+    bool deps_ok = true;
+    for (size_t i = 0; i < count_; i++)
+    {
+        if ((st.deps & (EventBits_t(1) << i)) && stages_[i].result != Result::OK)
+            deps_ok = false;
+    }
+
+    st.start_us = esp_timer_get_time() - t0_us_;
+    if (deps_ok)
+        st.result = st.fn() ? Result::OK : Result::FAILED;
+    else
+        st.result = Result::SKIPPED;
+    st.end_us = esp_timer_get_time() - t0_us_;
+
+    ESP_LOGD(TAG, "[%s] %-8s core %d  +%4u ms  run %4u ms  %s", name_, st.name, (int)xPortGetCoreID(),
+             (unsigned)(st.start_us / 1000), (unsigned)((st.end_us - st.start_us) / 1000),
+             resultName(st.result));
+
+    const EventBits_t self = EventBits_t(1) << (&st - stages_);
+    xEventGroupSetBits(done_, self);
+}
+
+void InitGraph::print() const
+{
+    ESP_LOGI(TAG, "[%s] %u stages, %u ms wall", name_, (unsigned)count_, (unsigned)totalMs());
+    int64_t serial_us = 0;
+    for (size_t i = 0; i < count_; i++)
+    {
+        const Stage &st = stages_[i];
+        serial_us += st.end_us - st.start_us;
+        ESP_LOGI(TAG, "  %-8s start +%4u ms  run %4u ms  %s", st.name, (unsigned)(st.start_us / 1000),
+                 (unsigned)((st.end_us - st.start_us) / 1000), resultName(st.result));
+    }
+    ESP_LOGI(TAG, "  serial sum %u ms", (unsigned)(serial_us / 1000));
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+
+/**
+ * InitGraph
+ * ============================================================================
+ * Khởi tạo các subsystem theo đồ thị phụ thuộc thay vì tuần tự: mỗi stage là
+ * một hàm bool() kèm danh sách stage phải xong trước và core chạy. run() tạo
+ * một task tạm cho mỗi stage (pin vào core đã chọn); task chờ bit "done" của
+ * các dependency trên một event group rồi mới chạy, nên các stage độc lập
+ * (vd. I2S install và init LCD, không cần Wi-Fi) chạy song song trên 2 core.
+ *
+ * - Dependency lỗi → stage bị bỏ qua (SKIPPED), run() trả về false.
+ * - Mỗi stage ghi thời gian chờ / chạy (so với lúc run() bắt đầu); print()
+ *   in bảng để tìm đường chậm khi boot.
+ * - Tối đa MAX_STAGES (1 bit event group / stage); dependency phải được add()
+ *   trước, nên đồ thị luôn không có vòng.
+ *
+ * Graph dùng một lần: add() hết rồi run() từ task gọi (task đó chỉ chờ).
+ */
+class InitGraph
+{
+public:
+    using StageFn = std::function<bool()>;
+    static constexpr size_t MAX_STAGES = 12;
+    static constexpr uint32_t DEFAULT_STACK = 4096;
+
+    enum class Result : uint8_t
+    {
+        PENDING,
+        OK,
+        FAILED,
+        SKIPPED // a dependency failed
+    };
+
+    explicit InitGraph(const char *name);
+    ~InitGraph();
+
+    InitGraph(const InitGraph &) = delete;
+    InitGraph &operator=(const InitGraph &) = delete;
+
+    // Stage id (pass to later stages' deps), or -1 when full / a dep is unknown.
+    // core: 0, 1 or tskNO_AFFINITY.
+    int add(const char *name, std::initializer_list<int> deps, BaseType_t core, StageFn fn,
+            uint32_t stack_bytes = DEFAULT_STACK);
+
+    // Run every stage and block until all have finished. True if all succeeded.
+    bool run(UBaseType_t priority = 5);
+
+    Result result(int id) const;
+    // Wall time of the last run() (first stage start → last stage end)
+    uint32_t totalMs() const { return total_us_ / 1000; }
+
+    // Per-stage core / wait / run table on the log.
+    void print() const;
+
+private:
+    struct Stage
+    {
+        const char *name = nullptr;
+        StageFn fn;
+        EventBits_t deps = 0;
+        BaseType_t core = tskNO_AFFINITY;
+        uint32_t stack = DEFAULT_STACK;
+        Result result = Result::PENDING;
+        int64_t start_us = 0; // deps satisfied, fn entered (relative to run())
+        int64_t end_us = 0;
+        InitGraph *graph = nullptr;
+    };
+
+    static void stageTask(void *arg);
+    void runStage(Stage &st);
+
+    const char *name_;
+    Stage stages_[MAX_STAGES];
+    size_t count_ = 0;
+    int64_t t0_us_ = 0;
+    int64_t total_us_ = 0;
+    StaticEventGroup_t done_buf_;
+    EventGroupHandle_t done_ = nullptr;
+};
@@ -0,0 +1,168 @@
+#include "LatencyTrace.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+static const char *TAG = "LatencyTrace";
+
+namespace
+{
+    struct SpanDef
+    {
+        const char *name;
+        LatencyTrace::Point from;
+        LatencyTrace::Point to;
+    };
+
+    constexpr SpanDef SPANS[LatencyTrace::SPAN_COUNT] = {
+        {"capture", LatencyTrace::MIC_READ, LatencyTrace::ENCODE},
+        {"uplink", LatencyTrace::ENCODE, LatencyTrace::UPLINK_SEND},
+        {"server", LatencyTrace::UPLINK_EOU, LatencyTrace::DL_RX},
+        {"downlink", LatencyTrace::DL_RX, LatencyTrace::DECODE},
+        {"playout", LatencyTrace::DECODE, LatencyTrace::SPK_WRITE},
+        {"turn", LatencyTrace::UPLINK_EOU, LatencyTrace::SPK_WRITE},
+    };
+
+    struct TurnRec
+    {
+        uint16_t turn;
+        uint16_t mask; // points present
+        uint32_t t_us[LatencyTrace::POINT_COUNT];
+    };
+} // namespace
+
+LatencyTrace &LatencyTrace::instance()
+{
+    static LatencyTrace inst;
+    return inst;
+}
+
+const char *LatencyTrace::spanName(Span s)
+{
+    return s < SPAN_COUNT ? SPANS[s].name : "?";
+}
+
+// ============================================================================
+// Writers (any task)
+// ============================================================================
+void LatencyTrace::beginTurn()
+{
+    turn_.fetch_add(1, std::memory_order_relaxed);
+    seen_.store(0, std::memory_order_release);
+}
+
+void LatencyTrace::mark(Point p)
+{
+    if (p >= POINT_COUNT)
+        return;
+    const uint32_t bit = 1u << p;
+    if (seen_.fetch_or(bit, std::memory_order_acq_rel) & bit)
+        return; // already stamped this turn
+
+    const uint32_t t = static_cast<uint32_t>(esp_timer_get_time());
+    const uint32_t turn = turn_.load(std::memory_order_relaxed) & 0xFFFF;
+
+    Slot &s = slots_[head_.fetch_add(1, std::memory_order_relaxed) & (SLOTS - 1)];
+    s.meta.store(0, std::memory_order_relaxed);
+    s.t_us.store(t, std::memory_order_relaxed);
+    s.meta.store((turn << 16) | (static_cast<uint32_t>(p) << 8) | 1u, std::memory_order_release);
+}
+
+void LatencyTrace::clear()
+{
+    for (Slot &s : slots_)
+        s.meta.store(0, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+void LatencyTrace::stats(SpanStats out[SPAN_COUNT]) const
+{
+    for (size_t sp = 0; sp < SPAN_COUNT; sp++)
+        out[sp] = SpanStats{};
+
+    // Group the ring by turn (~1.3 KB, off the caller's stack)
+    std::unique_ptr<TurnRec[]> turns(new (std::nothrow) TurnRec[MAX_TURNS]);
+    if (!turns)
+        return;
+    size_t n_turns = 0;
+
+    for (const Slot &s : slots_)
+    {
+        const uint32_t m = s.meta.load(std::memory_order_acquire);
+        if (!(m & 1u))
+            continue;
+        const uint32_t t = s.t_us.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s.meta.load(std::memory_order_relaxed) != m)
+            continue; // overwritten while reading
+
+        const uint16_t turn = static_cast<uint16_t>(m >> 16);
+        const uint8_t point = static_cast<uint8_t>((m >> 8) & 0xFF);
+        if (point >= POINT_COUNT)
+            continue;
+
+        TurnRec *rec = nullptr;
+        for (size_t i = 0; i < n_turns; i++)
+        {
+            if (turns[i].turn == turn)
+            {
+                rec = &turns[i];
+                break;
+            }
+        }
+        if (!rec)
+        {
+            if (n_turns == MAX_TURNS)
+                continue;
+            rec = &turns[n_turns++];
+            rec->turn = turn;
+            rec->mask = 0;
+        }
+        rec->t_us[point] = t;
+        rec->mask |= static_cast<uint16_t>(1u << point);
+    }
+
+    uint32_t v[MAX_TURNS];
+    for (size_t sp = 0; sp < SPAN_COUNT; sp++)
+    {
+        const uint16_t need = static_cast<uint16_t>((1u << SPANS[sp].from) | (1u << SPANS[sp].to));
+        size_t n = 0;
+        for (size_t i = 0; i < n_turns; i++)
+        {
+            if ((turns[i].mask & need) != need)
+                continue;
+            const int32_t d = static_cast<int32_t>(turns[i].t_us[SPANS[sp].to] - turns[i].t_us[SPANS[sp].from]);
+            if (d >= 0)
+                v[n++] = static_cast<uint32_t>(d);
+        }
+
+        SpanStats st;
+        if (n > 0)
+        {
+            std::sort(v, v + n);
+            st.p50_us = v[(n - 1) / 2];
+            st.p95_us = v[std::min(n - 1, (n * 95) / 100)];
+            st.max_us = v[n - 1];
+            st.count = static_cast<uint16_t>(n);
+        }
+        out[sp] = st;
+    }
+}
+
+void LatencyTrace::print() const
+{
+    SpanStats st[SPAN_COUNT];
+    stats(st);
+    ESP_LOGI(TAG, "%-9s %5s %9s %9s %9s", "span", "n", "p50 ms", "p95 ms", "max ms");
+    for (size_t sp = 0; sp < SPAN_COUNT; sp++)
+    {
+        ESP_LOGI(TAG, "%-9s %5u %9.1f %9.1f %9.1f", SPANS[sp].name, (unsigned)st[sp].count,
+                 st[sp].p50_us / 1000.0, st[sp].p95_us / 1000.0, st[sp].max_us / 1000.0);
+    }
+}
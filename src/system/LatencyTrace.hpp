@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * LatencyTrace
+ * ============================================================================
+ * Đo trễ voice turn trên thiết bị. Các task đánh dấu thời điểm tại những điểm
+ * chính của pipeline; mỗi điểm chỉ được ghi lần đầu trong một turn (turn bắt
+ * đầu khi vào LISTENING), nên gọi mark() ở vòng lặp nóng chỉ tốn 1 fetch_or.
+ *
+ * Ghi: lock-free từ mọi task (fetch_add slot + seqlock nhẹ trên mỗi slot),
+ * không cấp phát, không khóa. Đọc: stats() quét ring, ghép các điểm cùng turn
+ * thành span rồi tính p50/p95/max (đủ cho ~36 turn gần nhất).
+ *
+ * Span (cùng một turn):
+ *   capture  MIC_READ    → ENCODE       listen start → first encoded frame
+ *   uplink   ENCODE      → UPLINK_SEND  first frame queued → on the socket
+ *   server   UPLINK_EOU  → DL_RX        end of utterance → first reply byte
+ *   downlink DL_RX       → DECODE       jitter buffering + first decode
+ *   playout  DECODE      → SPK_WRITE    first PCM → first I2S write
+ *   turn     UPLINK_EOU  → SPK_WRITE    what the user waits for
+ */
+class LatencyTrace
+{
+public:
+    enum Point : uint8_t
+    {
+        MIC_READ,    // I2S read in micTaskLoop (while listening)
+        ENCODE,      // encoded frame committed to the uplink ring
+        UPLINK_SEND, // uplink packet handed to the socket
+        UPLINK_EOU,  // end-of-utterance packet sent
+        DL_RX,       // first downlink audio byte (handleWsBinaryMessage)
+        DECODE,      // first decoded downlink frame
+        SPK_WRITE,   // first writePcm of the reply
+        POINT_COUNT
+    };
+
+    enum Span : uint8_t
+    {
+        SPAN_CAPTURE,
+        SPAN_UPLINK,
+        SPAN_SERVER,
+        SPAN_DOWNLINK,
+        SPAN_PLAYOUT,
+        SPAN_TURN,
+        SPAN_COUNT
+    };
+
+    struct SpanStats
+    {
+        uint32_t p50_us = 0;
+        uint32_t p95_us = 0;
+        uint32_t max_us = 0;
+        uint16_t count = 0;
+    };
+
+    static LatencyTrace &instance();
+
+    // New voice turn (LISTENING start): every point may be marked once more.
+    void beginTurn();
+
+    // Timestamp `p` for the current turn; later calls in the same turn are ignored.
+    void mark(Point p);
+
+    // Per-span statistics over the turns still in the ring.
+    void stats(SpanStats out[SPAN_COUNT]) const;
+
+    // Drop all samples (e.g. after a config change).
+    void clear();
+
+    // Table of stats() on the log (serial "lat" command).
+    void print() const;
+
+    static const char *spanName(Span s);
+
+private:
+    LatencyTrace() = default;
+
+    static constexpr size_t SLOTS = 256; // power of 2, ~7 points per turn
+    static constexpr size_t MAX_TURNS = 40;
+
+    struct Slot
+    {
+        std::atomic<uint32_t> t_us{0};
+        std::atomic<uint32_t> meta{0}; // turn << 16 | point << 8 | 1 (0 = being written)
+    };
+
+    Slot slots_[SLOTS];
+    std::atomic<uint32_t> head_{0};
+    std::atomic<uint32_t> turn_{0};
+    std::atomic<uint32_t> seen_{0}; // points marked in the current turn
+};
@@ -0,0 +1,784 @@
+#include "MediaPlayer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "esp_http_client.h"
+#include "esp_log.h"
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+#include "esp_crt_bundle.h"
+#endif
+#include "AudioCodec.hpp"
+#include "SpscRing.hpp"
+#include "system/AudioManager.hpp"
+#include "system/FlashFs.hpp"
+#include "system/TaskPlan.hpp"
+
+static const char *TAG = "MediaPlayer";
+
+static constexpr const char *SPILL_PATH = "/spiffs/media.bin";
+static constexpr uint32_t FETCH_TIMEOUT_MS = 10000;   // per socket read
+static constexpr uint8_t FETCH_RETRIES = 6;           // reconnects in a row without a new byte
+static constexpr uint32_t FETCH_BACKOFF_MS = 1000;    // doubles per failed reconnect
+static constexpr uint32_t FETCH_BACKOFF_MAX_MS = 30000;
+static constexpr uint32_t FULL_POLL_MS = 200;         // buffer full: socket left unread this long
+static constexpr uint32_t STOP_WAIT_MS = 300;         // stop(): decode task parks within one ring wait
+static constexpr uint32_t RING_WAIT_MS = 100;         // decode task: media ring full
+static constexpr size_t RESYNC_MAX = 64;              // framed: bad bytes skipped per takeUnit()
+
+namespace
+{
+    // buf_lock_ scope
+    struct Lock
+    {
+        explicit Lock(SemaphoreHandle_t m) : m_(m) { xSemaphoreTake(m_, portMAX_DELAY); }
+        ~Lock() { xSemaphoreGive(m_); }
+        SemaphoreHandle_t m_;
+    };
+} // namespace
+
+MediaPlayer &MediaPlayer::instance()
+{
+    static MediaPlayer inst;
+    return inst;
+}
+
+bool MediaPlayer::init(AudioManager *audio, std::unique_ptr<AudioCodec> codec, const Config &cfg)
+{
+    if (audio_ || !audio || !codec)
+        return audio_ != nullptr;
+    buf_lock_ = xSemaphoreCreateMutex();
+    if (!buf_lock_)
+        return false;
+    cfg_ = cfg;
+    codec_ = std::move(codec);
+    audio_ = audio;
+    ESP_LOGI(TAG, "Ready: %s, RAM prebuffer %u KB (+%u KB flash), prebuffer %u ms", codec_->name(),
+             (unsigned)(cfg_.ram_bytes / 1024), (unsigned)(cfg_.spill_max_bytes / 1024),
+             (unsigned)cfg_.prebuffer_ms);
+    return true;
+}
+
+bool MediaPlayer::startTasks()
+{
+    auto &plan = TaskPlan::instance();
+    if (!fetch_task_ && !plan.spawn(TaskPlan::MEDIA_FETCH, &MediaPlayer::fetchTaskEntry, this, &fetch_task_))
+    {
+        fetch_task_ = nullptr;
+        return false;
+    }
+    if (!dec_task_ && !plan.spawn(TaskPlan::MEDIA_DEC, &MediaPlayer::decTaskEntry, this, &dec_task_,
+                                  codec_->decoderStackBytes()))
+    {
+        dec_task_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void MediaPlayer::wake()
+{
+    if (fetch_task_)
+        xTaskNotifyGive(fetch_task_);
+    if (dec_task_)
+        xTaskNotifyGive(dec_task_);
+}
+
+// ============================================================================
+// Commands
+// ============================================================================
+bool MediaPlayer::play(const MediaRequest &req)
+{
+    if (!audio_)
+        return false;
+    if (req.url.rfind("http://", 0) != 0 && req.url.rfind("https://", 0) != 0)
+    {
+        ESP_LOGE(TAG, "Not an http(s) URL: %s", req.url.c_str());
+        return false;
+    }
+    stop();
+
+    pcm_ = audio_->openMediaRing();
+    if (!pcm_)
+        return false;
+
+    MediaBuffer::Config bc;
+    bc.ram_bytes = cfg_.ram_bytes;
+    bc.spill_max_bytes = cfg_.spill_max_bytes;
+    if (req.spill)
+    {
+        // Shared partition (config, logs, uplink store): a quarter stays free
+        FlashFs &fs = FlashFs::instance();
+        const size_t total = fs.mount() ? fs.totalBytes() : 0;
+        const size_t used = fs.usedBytes();
+        const size_t avail = total > used + total / 4 ? total - used - total / 4 : 0;
+        bc.spill_max_bytes = std::min(bc.spill_max_bytes, avail);
+        if (bc.spill_max_bytes >= cfg_.ram_bytes)
+            bc.spill_path = SPILL_PATH;
+        else
+            ESP_LOGW(TAG, "No flash for the spill (%u B free), RAM prebuffer only", (unsigned)avail);
+    }
+
+    // Byte rate: given, or a constant-rate byte stream (ADPCM) from the
+    // codec; framed streams learn it from the first record
+    const uint32_t codec_rate = codec_->sampleRate();
+    const uint32_t rate = codec_->variableFrameSize() || req.sample_rate == 0 ? codec_rate : req.sample_rate;
+    uint32_t bps = req.bytes_per_s;
+    if (bps == 0 && !codec_->variableFrameSize())
+        bps = static_cast<uint32_t>(static_cast<uint64_t>(codec_->bitrate()) * rate / codec_rate / 8);
+
+    {
+        Lock l(buf_lock_);
+        if (!buf_.init(bc))
+        {
+            ESP_LOGE(TAG, "No RAM for a %u KB prebuffer", (unsigned)(cfg_.ram_bytes / 1024));
+            return false;
+        }
+        url_ = req.url;
+        stream_rate_ = rate;
+        byte_rate_ = bps;
+        record_bytes_ = 0;
+        size_ = 0;
+        eof_ = false;
+        uint32_t start = req.offset;
+        if (start == 0 && req.start_ms > 0 && !msToBytes(req.start_ms, start))
+            ESP_LOGW(TAG, "Start position needs the byte rate (bps), playing from the start");
+        buf_.reset(start);
+        play_off_ = start;
+        dec_reset_ = true;
+        state_ = State::BUFFERING;
+        gen_++;
+    }
+    audio_->setMediaDuck(cfg_.duck_pct);
+    if (!startTasks())
+    {
+        ESP_LOGE(TAG, "Media tasks not started");
+        halt(End::ERROR);
+        return false;
+    }
+    stats_.streams++;
+    ESP_LOGI(TAG, "Play %s from %u B (%u Hz, %u B/s%s)", url_.c_str(), (unsigned)play_off_, (unsigned)rate,
+             (unsigned)bps, bc.spill_path ? ", flash spill" : "");
+    wake();
+    return true;
+}
+
+void MediaPlayer::pause()
+{
+    State s = State::PLAYING;
+    if (state_.compare_exchange_strong(s, State::PAUSED) ||
+        (s == State::BUFFERING && state_.compare_exchange_strong(s, State::PAUSED)))
+    {
+        // The PCM already in the media ring waits for resume()
+        audio_->setMediaActive(false);
+        ESP_LOGI(TAG, "Paused at %u ms", (unsigned)positionMs());
+        wake();
+    }
+}
+
+void MediaPlayer::resume()
+{
+    State s = State::PAUSED;
+    if (state_.compare_exchange_strong(s, State::BUFFERING))
+    {
+        // Usually still buffered: the decode task goes straight to PLAYING
+        ESP_LOGI(TAG, "Resume at %u ms", (unsigned)positionMs());
+        wake();
+    }
+}
+
+bool MediaPlayer::seek(uint32_t ms)
+{
+    if (state_ == State::STOPPED)
+        return false;
+    uint32_t target = 0;
+    if (!msToBytes(ms, target))
+    {
+        ESP_LOGW(TAG, "Seek needs the stream byte rate");
+        return false;
+    }
+    if (size_ > 0 && target >= size_)
+        return false;
+
+    bool refetch = false;
+    {
+        Lock l(buf_lock_);
+        const uint32_t rd = buf_.readOffset();
+        if (target >= rd && target <= buf_.writeOffset())
+        {
+            // Already buffered: just move the read side
+            buf_.skip(target - rd);
+        }
+        else
+        {
+            buf_.reset(target);
+            eof_ = false;
+            gen_++; // fetch task reconnects at the new write offset
+            refetch = true;
+        }
+        play_off_ = target;
+        dec_reset_ = true;
+    }
+    State s = State::PLAYING;
+    state_.compare_exchange_strong(s, State::BUFFERING);
+    stats_.seeks++;
+    if (refetch)
+        stats_.refetches++;
+    ESP_LOGI(TAG, "Seek %u ms -> %u B%s", (unsigned)ms, (unsigned)target, refetch ? " (refetch)" : "");
+    wake();
+    return true;
+}
+
+void MediaPlayer::stop()
+{
+    if (state_.exchange(State::STOPPED) == State::STOPPED)
+        return;
+    gen_++;
+    audio_->setMediaActive(false);
+    wake();
+    // The decode task may sit in a media ring wait; it parks right after
+    for (uint32_t waited = 0; dec_busy_ && waited < STOP_WAIT_MS; waited += 10)
+        vTaskDelay(pdMS_TO_TICKS(10));
+    if (dec_busy_)
+        ESP_LOGW(TAG, "Decode task still busy at stop");
+    else if (pcm_)
+        pcm_->reset();
+    freeBuffer();
+    finish(End::STOPPED);
+}
+
+void MediaPlayer::halt(End why)
+{
+    if (state_.exchange(State::STOPPED) == State::STOPPED)
+        return;
+    gen_++;
+    audio_->setMediaActive(false);
+    if (pcm_)
+        pcm_->reset();
+    freeBuffer();
+    finish(why);
+}
+
+void MediaPlayer::freeBuffer()
+{
+    Lock l(buf_lock_);
+    stats_.spill_errors += buf_.errors();
+    buf_.deinit();
+    eof_ = false;
+}
+
+void MediaPlayer::finish(End why)
+{
+    ESP_LOGI(TAG, "Stream %s at %u ms", endName(why), (unsigned)positionMs());
+    end_pos_ms_ = positionMs();
+    end_ = why;
+    if (on_end_cb_)
+        on_end_cb_();
+}
+
+MediaPlayer::End MediaPlayer::takeEnd(uint32_t &pos_ms)
+{
+    const End e = end_.exchange(End::NONE);
+    pos_ms = end_pos_ms_;
+    return e;
+}
+
+// ============================================================================
+// Positions
+// ============================================================================
+uint32_t MediaPlayer::bytesToMs(uint32_t bytes) const
+{
+    const uint32_t rate = byte_rate_;
+    return rate ? static_cast<uint32_t>(static_cast<uint64_t>(bytes) * 1000 / rate) : 0;
+}
+
+bool MediaPlayer::msToBytes(uint32_t ms, uint32_t &bytes) const
+{
+    const uint32_t rate = byte_rate_;
+    if (rate == 0)
+        return false;
+    bytes = static_cast<uint32_t>(static_cast<uint64_t>(ms) * rate / 1000);
+    if (codec_->variableFrameSize())
+    {
+        // Records are CBR from byte 0: land on a length prefix
+        uint32_t stride = record_bytes_ ? record_bytes_ + 2 : 0;
+        if (stride == 0)
+            stride = static_cast<uint32_t>(static_cast<uint64_t>(rate) * codec_->pcmFrameSamples() /
+                                           codec_->sampleRate());
+        if (stride > 0)
+            bytes -= bytes % stride;
+    }
+    return true;
+}
+
+uint32_t MediaPlayer::bufferedMs() const
+{
+    if (state_ == State::STOPPED)
+        return 0;
+    Lock l(buf_lock_);
+    return bytesToMs(static_cast<uint32_t>(buf_.bytes()));
+}
+
+size_t MediaPlayer::bufferTargetBytes(uint32_t ms) const
+{
+    const uint32_t rate = byte_rate_;
+    // Unknown rate (framed, before the first record): half the RAM part
+    const size_t want = rate ? static_cast<size_t>(static_cast<uint64_t>(ms) * rate / 1000) : cfg_.ram_bytes / 2;
+    const size_t cap = buf_.capacity();
+    return std::min(want, cap > cfg_.http_chunk ? cap - cfg_.http_chunk : cap);
+}
+
+// ============================================================================
+// FETCH task: HTTP(S) range requests → prebuffer
+// ============================================================================
+void MediaPlayer::fetchTaskEntry(void *arg)
+{
+    static_cast<MediaPlayer *>(arg)->fetchTaskLoop();
+}
+
+void MediaPlayer::fetchTaskLoop()
+{
+    uint8_t failures = 0;
+    uint32_t last_gen = 0;
+    for (;;)
+    {
+        const uint32_t gen = gen_;
+        if (state_ == State::STOPPED || eof_ || failed_gen_ == gen)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        if (gen != last_gen)
+        {
+            last_gen = gen;
+            failures = 0;
+        }
+
+        bool progress = false;
+        bool fatal = false;
+        if (fetchRange(gen, progress, fatal) || gen != gen_)
+        {
+            failures = 0;
+            continue;
+        }
+        failures = progress ? 1 : failures + 1;
+        if (fatal || failures > FETCH_RETRIES)
+        {
+            ESP_LOGE(TAG, "Giving up on the stream (%s)", fatal ? "HTTP error" : "no progress");
+            failed_gen_ = gen;
+            if (dec_task_)
+                xTaskNotifyGive(dec_task_);
+            continue;
+        }
+        const uint32_t backoff = std::min(FETCH_BACKOFF_MS << (failures - 1), FETCH_BACKOFF_MAX_MS);
+        stats_.reconnects++;
+        ESP_LOGW(TAG, "Stream interrupted, resuming in %u ms", (unsigned)backoff);
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(backoff));
+    }
+}
+
+bool MediaPlayer::fetchRange(uint32_t gen, bool &progress, bool &fatal)
+{
+    uint32_t from = 0;
+    std::string url;
+    {
+        Lock l(buf_lock_);
+        if (gen != gen_ || !buf_.ready())
+            return true;
+        from = buf_.writeOffset();
+        url = url_;
+    }
+
+    std::unique_ptr<uint8_t[]> chunk(new (std::nothrow) uint8_t[cfg_.http_chunk]);
+    if (!chunk)
+        return false;
+
+    esp_http_client_config_t cfg = {};
+    cfg.url = url.c_str();
+    cfg.timeout_ms = FETCH_TIMEOUT_MS;
+    cfg.buffer_size = static_cast<int>(cfg_.http_chunk);
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+    cfg.crt_bundle_attach = esp_crt_bundle_attach;
+#endif
+    esp_http_client_handle_t http = esp_http_client_init(&cfg);
+    if (!http)
+        return false;
+
+    char range[32];
+    snprintf(range, sizeof(range), "bytes=%u-", (unsigned)from);
+    esp_http_client_set_header(http, "Range", range);
+
+    bool done = false;
+    do
+    {
+        if (esp_http_client_open(http, 0) != ESP_OK)
+        {
+            ESP_LOGW(TAG, "GET media failed (offset %u)", (unsigned)from);
+            break;
+        }
+        const int64_t len = esp_http_client_fetch_headers(http);
+        const int status = esp_http_client_get_status_code(http);
+        // 200 only from offset 0: a server ignoring Range replays byte 0
+        if (status != 206 && !(status == 200 && from == 0))
+        {
+            fatal = status > 0 && status < 500;
+            ESP_LOGE(TAG, "Media GET at %u B: HTTP %d%s", (unsigned)from, status,
+                     status == 200 ? " (no Range support)" : "");
+            break;
+        }
+        if (len > 0)
+            size_ = from + static_cast<uint32_t>(len);
+
+        // Full: leave the socket unread (TCP flow control holds the server)
+        // until a quarter is played, so the flash part is written in bursts
+        bool held = false;
+        for (;;)
+        {
+            if (gen != gen_)
+            {
+                done = true;
+                break;
+            }
+            size_t used = 0;
+            size_t space = 0;
+            size_t cap = 0;
+            {
+                Lock l(buf_lock_);
+                used = buf_.bytes();
+                space = buf_.space();
+                cap = buf_.capacity();
+            }
+            if (space < cfg_.http_chunk || (held && used > cap / 4 * 3))
+            {
+                held = true;
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(FULL_POLL_MS));
+                continue;
+            }
+            held = false;
+
+            const int n = esp_http_client_read(http, reinterpret_cast<char *>(chunk.get()), cfg_.http_chunk);
+            if (n <= 0)
+                break;
+            size_t took = 0;
+            {
+                Lock l(buf_lock_);
+                if (gen != gen_)
+                {
+                    done = true;
+                    break;
+                }
+                took = buf_.write(chunk.get(), static_cast<size_t>(n));
+            }
+            if (took > 0)
+            {
+                progress = true;
+                if (dec_task_)
+                    xTaskNotifyGive(dec_task_);
+            }
+            // Spill write failed: the connection is past the buffer now,
+            // reconnect at the write offset
+            if (took < static_cast<size_t>(n))
+                break;
+        }
+        if (done)
+            break;
+
+        Lock l(buf_lock_);
+        const uint32_t end = buf_.writeOffset();
+        if (gen == gen_ && (esp_http_client_is_complete_data_received(http) || (size_ > 0 && end >= size_)))
+        {
+            if (size_ == 0)
+                size_ = end;
+            eof_ = true;
+            done = true;
+            ESP_LOGI(TAG, "Stream fully buffered (%u B)", (unsigned)end);
+            if (dec_task_)
+                xTaskNotifyGive(dec_task_);
+        }
+    } while (false);
+
+    esp_http_client_close(http);
+    esp_http_client_cleanup(http);
+    return done;
+}
+
+// ============================================================================
+// DECODE task: prebuffer → codec → resample → media PCM ring
+// ============================================================================
+void MediaPlayer::decTaskEntry(void *arg)
+{
+    static_cast<MediaPlayer *>(arg)->decTaskLoop();
+}
+
+void MediaPlayer::restartDecoder()
+{
+    codec_->resetDecoder();
+    pcm_->reset();
+    dec_pending_ = 0;
+    rebuffering_ = false;
+
+    const size_t frame = codec_->pcmFrameSamples();
+    if (!dec_pcm_)
+        dec_pcm_.reset(new (std::nothrow) int16_t[frame]);
+    if (!dec_unit_)
+    {
+        dec_unit_cap_ = codec_->variableFrameSize() ? codec_->maxEncodedFrameBytes() : codec_->encodedFrameBytes();
+        dec_unit_.reset(new (std::nothrow) uint8_t[dec_unit_cap_]);
+    }
+
+    const uint32_t in = stream_rate_;
+    const uint32_t out = audio_->outputSampleRate();
+    if (in == out || in == 0)
+    {
+        resampler_.deinit();
+        return;
+    }
+    if (resampler_.inRate() == in && resampler_.outRate() == out && resampler_.ready())
+    {
+        resampler_.reset();
+        return;
+    }
+    if (!resampler_.init(in, out, frame) ||
+        resampler_.maxOutput(frame) * sizeof(int16_t) > pcm_->maxChunk())
+    {
+        ESP_LOGE(TAG, "Media %u Hz unsupported for %u Hz speaker, playing as-is", (unsigned)in, (unsigned)out);
+        resampler_.deinit();
+    }
+}
+
+size_t MediaPlayer::takeUnit(uint8_t *buf, size_t cap, bool &drained)
+{
+    Lock l(buf_lock_);
+    const bool eof = eof_;
+    drained = false;
+    if (!codec_->variableFrameSize())
+    {
+        // Byte stream: a whole frame, or the tail at the end
+        const size_t n = buf_.bytes() >= cap || eof ? buf_.read(buf, cap) : 0;
+        drained = n == 0 && eof;
+        play_off_ = buf_.readOffset();
+        return n;
+    }
+
+    // [u16 LE len][packet]; a bad length skips one byte (resync)
+    for (size_t i = 0; i < RESYNC_MAX; i++)
+    {
+        uint8_t hdr[2];
+        if (!buf_.peek(hdr, sizeof(hdr)))
+        {
+            if (eof)
+            {
+                buf_.skip(buf_.bytes());
+                drained = true;
+            }
+            return 0;
+        }
+        const size_t len = hdr[0] | (hdr[1] << 8);
+        if (len == 0 || len > cap)
+        {
+            buf_.skip(1);
+            stats_.bad_records++;
+            continue;
+        }
+        if (buf_.bytes() < sizeof(hdr) + len)
+        {
+            if (eof)
+            {
+                // Truncated last record
+                buf_.skip(buf_.bytes());
+                drained = true;
+            }
+            return 0;
+        }
+        buf_.skip(sizeof(hdr));
+        buf_.read(buf, len);
+        play_off_ = buf_.readOffset();
+        if (record_bytes_ == 0)
+        {
+            // CBR: the first record fixes the byte rate and the seek stride
+            record_bytes_ = static_cast<uint32_t>(len);
+            if (byte_rate_ == 0)
+                byte_rate_ = static_cast<uint32_t>(static_cast<uint64_t>(len + sizeof(hdr)) * codec_->sampleRate() /
+                                                   codec_->pcmFrameSamples());
+        }
+        return len;
+    }
+    play_off_ = buf_.readOffset();
+    return 0;
+}
+
+bool MediaPlayer::writePending()
+{
+    const bool resample = resampler_.ready();
+    const size_t max_bytes = (resample ? resampler_.maxOutput(dec_pending_) : dec_pending_) * sizeof(int16_t);
+    // Ring full is the steady state: the speaker sets the pace
+    uint8_t *dst = pcm_->acquireWrite(max_bytes, pdMS_TO_TICKS(RING_WAIT_MS));
+    if (!dst)
+        return false;
+    if (resample)
+    {
+        const size_t out = resampler_.process(dec_pcm_.get(), dec_pending_, reinterpret_cast<int16_t *>(dst));
+        pcm_->commitWrite(out * sizeof(int16_t));
+    }
+    else
+    {
+        memcpy(dst, dec_pcm_.get(), max_bytes);
+        pcm_->commitWrite(max_bytes);
+    }
+    dec_pending_ = 0;
+    return true;
+}
+
+void MediaPlayer::decTaskLoop()
+{
+    for (;;)
+    {
+        if (state_ == State::STOPPED)
+        {
+            dec_busy_ = false;
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        dec_busy_ = true;
+        if (state_ == State::STOPPED) // stop() raced the flag: it waits for this
+            continue;
+
+        if (failed_gen_ == gen_)
+        {
+            halt(End::ERROR);
+            continue;
+        }
+        if (dec_reset_.exchange(false))
+            restartDecoder();
+        if (!dec_pcm_ || !dec_unit_)
+        {
+            ESP_LOGE(TAG, "No RAM for the media decoder");
+            halt(End::ERROR);
+            continue;
+        }
+
+        const State s = state_;
+        // Speaker plays the media ring only while PLAYING
+        audio_->setMediaActive(s == State::PLAYING);
+
+        if (s == State::PAUSED)
+        {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+            continue;
+        }
+        if (s == State::BUFFERING)
+        {
+            size_t have = 0;
+            size_t target = 0;
+            {
+                Lock l(buf_lock_);
+                have = buf_.bytes();
+                target = bufferTargetBytes(rebuffering_ ? cfg_.rebuffer_ms : cfg_.prebuffer_ms);
+            }
+            State b = State::BUFFERING;
+            if ((have >= target || eof_) && state_.compare_exchange_strong(b, State::PLAYING))
+            {
+                ESP_LOGI(TAG, "Playing (%u ms buffered)", (unsigned)bytesToMs(static_cast<uint32_t>(have)));
+                continue;
+            }
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RING_WAIT_MS));
+            continue;
+        }
+
+        // A decoded frame waits across pause / rebuffer until the ring takes it
+        if (dec_pending_ > 0)
+        {
+            writePending();
+            continue;
+        }
+        bool drained = false;
+        const size_t n = takeUnit(dec_unit_.get(), dec_unit_cap_, drained);
+        if (n > 0)
+        {
+            dec_pending_ = codec_->decode(dec_unit_.get(), n, dec_pcm_.get(), codec_->pcmFrameSamples());
+            continue;
+        }
+        if (drained)
+        {
+            // Last byte decoded: finished once the speaker played the ring
+            if (pcm_->available() == 0)
+                halt(End::FINISHED);
+            else
+                vTaskDelay(pdMS_TO_TICKS(20));
+            continue;
+        }
+        // Ran dry mid-stream: stop the bed, refill rebuffer_ms
+        State p = State::PLAYING;
+        if (state_.compare_exchange_strong(p, State::BUFFERING))
+        {
+            rebuffering_ = true;
+            stats_.rebuffers++;
+            ESP_LOGW(TAG, "Underrun at %u ms, rebuffering", (unsigned)positionMs());
+        }
+    }
+}
+
+// ============================================================================
+// Info
+// ============================================================================
+const char *MediaPlayer::stateName(State s)
+{
+    switch (s)
+    {
+    case State::STOPPED:
+        return "stopped";
+    case State::BUFFERING:
+        return "buffering";
+    case State::PLAYING:
+        return "playing";
+    case State::PAUSED:
+        return "paused";
+    }
+    return "?";
+}
+
+const char *MediaPlayer::endName(End e)
+{
+    switch (e)
+    {
+    case End::NONE:
+        return "none";
+    case End::FINISHED:
+        return "finished";
+    case End::STOPPED:
+        return "stopped";
+    case End::ERROR:
+        return "error";
+    }
+    return "?";
+}
+
+void MediaPlayer::print() const
+{
+    const State s = state_;
+    if (s == State::STOPPED)
+    {
+        ESP_LOGI(TAG, "%s", stateName(s));
+    }
+    else
+    {
+        size_t ram = 0;
+        size_t spilled = 0;
+        {
+            Lock l(buf_lock_);
+            ram = buf_.ramBytes();
+            spilled = buf_.spilledBytes();
+        }
+        ESP_LOGI(TAG, "%s %s", stateName(s), url_.c_str());
+        ESP_LOGI(TAG, "pos %u / %u ms, buffered %u ms (RAM %u B, flash %u B)%s, %u B/s", (unsigned)positionMs(),
+                 (unsigned)durationMs(), (unsigned)bufferedMs(), (unsigned)ram, (unsigned)spilled,
+                 eof_ ? " eof" : "", (unsigned)byte_rate_.load());
+    }
+    ESP_LOGI(TAG,
+             "streams %u, rebuffers %u, reconnects %u, seeks %u (%u refetched), bad records %u, "
+             "spill errors %u, speaker underruns %u",
+             (unsigned)stats_.streams, (unsigned)stats_.rebuffers, (unsigned)stats_.reconnects,
+             (unsigned)stats_.seeks, (unsigned)stats_.refetches, (unsigned)stats_.bad_records,
+             (unsigned)stats_.spill_errors, audio_ ? (unsigned)audio_->mediaUnderruns() : 0u);
+}
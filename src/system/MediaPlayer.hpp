@@ -0,0 +1,210 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "MediaBuffer.hpp"
+#include "PolyphaseResampler.hpp"
+
+class AudioManager;
+class AudioCodec;
+class SpscRing;
+
+// One media stream to play (MQTT "media" play / console "media play").
+struct MediaRequest
+{
+    std::string url;           // http(s)://, Range support needed for seek / reconnect
+    uint32_t offset = 0;       // first stream byte (continue where an earlier play stopped)
+    uint32_t start_ms = 0;     // or a start position, when bytes_per_s is known
+    uint32_t sample_rate = 0;  // ADPCM streams: decoded rate (0 = codec rate); framed codecs decode at the codec rate
+    uint32_t bytes_per_s = 0;  // stream byte rate for ms positions; 0 = from the codec / first record
+    bool spill = false;        // prebuffer past RAM into /spiffs/media.bin
+};
+
+/**
+ * MediaPlayer
+ * ============================================================================
+ * Chế độ phát media dài (nhạc, podcast) tách khỏi đường TTS ngắn: kênh turn
+ * (WS, rb_spk_*) bị flush mỗi lần nghe / nói, còn media có bộ đệm, decoder
+ * và kết nối riêng nên không bị ngắt.
+ *
+ *  - Tải: task MEDIA_FETCH kéo stream qua HTTP(S) (GET Range từ
+ *    writeOffset() của buffer), độc lập với WS. Rớt kết nối → nối lại đúng
+ *    byte còn thiếu (backoff như OTA); bộ đệm đầy → ngừng đọc socket (TCP
+ *    flow control giữ server lại) tới khi vơi 1/4, nên phần tràn flash
+ *    được ghi thành đợt.
+ *  - Prebuffer: MediaBuffer (RAM ram_bytes, tuỳ chọn tràn ra
+ *    /spiffs/media.bin tới spill_max_bytes). Phát sau prebuffer_ms; cạn giữa
+ *    chừng → dừng tiếng, đệm lại rebuffer_ms rồi phát tiếp.
+ *  - Giải mã: task MEDIA_DEC với codec riêng (cùng loại codec của turn, nên
+ *    TTS và media giải mã song song không chung state), resample về tốc độ
+ *    loa, ghi vào media ring của AudioManager. Speaker task phát ring này khi
+ *    không có TTS và trộn dưới TTS khi có.
+ *  - Tương tác giọng nói: LISTENING / PROCESSING / SPEAKING → AudioManager
+ *    hạ media xuống duck_pct % (ramp ~130 ms), IDLE → trả lại; không flush.
+ *  - pause / resume / seek / stop: pause giữ nguyên buffer (tải vẫn chạy tới
+ *    đầy); seek trong phần đã đệm chỉ nhảy con trỏ, ngoài đó thì bỏ buffer
+ *    và tải lại từ byte đích.
+ *
+ * Định dạng stream: codec của thiết bị, cùng framing với downlink (ADPCM
+ * byte-stream; Opus [u16 LE len][packet]). Server chuyển mã; thiết bị không
+ * có MP3 / AAC decoder. Vị trí theo ms cần byte rate cố định: ADPCM suy từ
+ * codec; stream framed lấy kích thước record đầu tiên (server gửi CBR), seek
+ * căn theo record.
+ *
+ * Lệnh từ bất kỳ task nào (MQTT, console); trạng thái đọc không khoá.
+ */
+class MediaPlayer
+{
+public:
+    enum class State : uint8_t
+    {
+        STOPPED,
+        BUFFERING, // filling the prebuffer before (re)starting playback
+        PLAYING,
+        PAUSED,
+    };
+
+    // Why the last stream stopped (MQTT "media" event)
+    enum class End : uint8_t
+    {
+        NONE,
+        FINISHED, // played to the last byte
+        STOPPED,  // stop() or replaced by a new play()
+        ERROR,    // HTTP error / no Range support / reconnects exhausted
+    };
+
+    struct Config
+    {
+        size_t ram_bytes = 40 * 1024;        // compressed prebuffer in RAM (ADPCM 16 kHz: 5 s)
+        size_t spill_max_bytes = 256 * 1024; // flash part, MediaRequest::spill only (clamped to free SPIFFS)
+        uint32_t prebuffer_ms = 3000;        // before playback / after a seek
+        uint32_t rebuffer_ms = 1500;         // after running dry mid-stream
+        size_t http_chunk = 2048;            // socket read = buffer write size
+        uint8_t duck_pct = 20;               // media gain under a voice turn
+    };
+
+    struct Stats
+    {
+        uint32_t streams = 0;
+        uint32_t rebuffers = 0;   // ran dry mid-stream
+        uint32_t reconnects = 0;  // Range resumes after a drop
+        uint32_t seeks = 0;
+        uint32_t refetches = 0;   // seeks outside the buffer
+        uint32_t bad_records = 0; // framed: invalid length, resynced
+        uint32_t spill_errors = 0;
+    };
+
+    static MediaPlayer &instance();
+
+    // Own decoder: same codec type as the turn's, a second instance. The
+    // buffer is allocated per stream (freed at stop). Call once after
+    // AudioManager::init().
+    bool init(AudioManager *audio, std::unique_ptr<AudioCodec> codec, const Config &cfg);
+    bool ready() const { return audio_ != nullptr; }
+
+    // Replace whatever plays; false = bad request / no RAM.
+    bool play(const MediaRequest &req);
+    void pause();
+    void resume();
+    // Position in ms (needs a byte rate); false while stopped / unknown rate.
+    bool seek(uint32_t ms);
+    // Stop and free the buffer; returns once the decode task let go of the
+    // media ring.
+    void stop();
+
+    State state() const { return state_; }
+    uint32_t positionMs() const { return bytesToMs(play_off_); }
+    uint32_t bufferedMs() const;
+    uint32_t durationMs() const { return bytesToMs(size_); } // 0 = unknown
+    const std::string &url() const { return url_; }
+
+    // Called (from a media task) when a stream ends; keep it short. The
+    // reason is fetched with takeEnd() on the caller's own task.
+    void onEnd(std::function<void()> cb) { on_end_cb_ = std::move(cb); }
+    // Pending end event (NONE if none); clears it.
+    End takeEnd(uint32_t &pos_ms);
+
+    static const char *stateName(State s);
+    static const char *endName(End e);
+    Stats stats() const { return stats_; }
+    // State, buffer and counters (serial "media")
+    void print() const;
+
+private:
+    MediaPlayer() = default;
+
+    bool startTasks();
+    void wake();
+    // End the stream from a media task (decode task: owns the PCM ring)
+    void halt(End why);
+    void freeBuffer();
+    void finish(End why);
+    uint32_t bytesToMs(uint32_t bytes) const;
+    // Stream offset for a position, on a record boundary; false = unknown rate
+    bool msToBytes(uint32_t ms, uint32_t &bytes) const;
+    // Buffered bytes before playback (re)starts
+    size_t bufferTargetBytes(uint32_t ms) const;
+
+    static void fetchTaskEntry(void *arg);
+    void fetchTaskLoop();
+    // One ranged GET from the buffer's write offset; returns once the
+    // stream is complete, the request changed (gen), or the connection failed.
+    // fatal: retrying cannot help.
+    bool fetchRange(uint32_t gen, bool &progress, bool &fatal);
+
+    static void decTaskEntry(void *arg);
+    void decTaskLoop();
+    // Next stream unit into buf (ADPCM: up to one frame; framed: one
+    // record's payload); 0 = not buffered yet, or drained at the end.
+    size_t takeUnit(uint8_t *buf, size_t cap, bool &drained);
+    // Decoder + resampler for the stream rate, PCM ring emptied
+    void restartDecoder();
+    // Decoded frame (resampled) into the media ring; false = ring still full
+    bool writePending();
+
+    AudioManager *audio_ = nullptr;
+    std::unique_ptr<AudioCodec> codec_;
+    Config cfg_{};
+    SpscRing *pcm_ = nullptr;
+
+    // Stream (set by play() under buf_lock_, read by the tasks after a gen change)
+    std::string url_;
+    std::atomic<uint32_t> gen_{0};       // bumped by play / seek-refetch / stop
+    std::atomic<uint32_t> failed_gen_{0}; // fetch gave up on this gen
+    std::atomic<State> state_{State::STOPPED};
+    std::atomic<uint32_t> stream_rate_{0}; // decoded sample rate
+    std::atomic<bool> eof_{false};       // whole stream is in the buffer
+    std::atomic<uint32_t> size_{0};      // stream bytes, 0 = unknown
+    std::atomic<uint32_t> byte_rate_{0}; // bytes per second, 0 = unknown
+    std::atomic<uint32_t> play_off_{0};  // stream byte the decoder is at
+    std::atomic<uint32_t> record_bytes_{0}; // framed: first record size (seek stride)
+    std::atomic<bool> dec_reset_{false}; // decoder state + PCM ring restart
+    std::atomic<bool> dec_busy_{false};  // decode task holds the media ring
+
+    // Compressed prebuffer; every access under buf_lock_
+    MediaBuffer buf_;
+    SemaphoreHandle_t buf_lock_ = nullptr;
+
+    // Decode side (decode task)
+    PolyphaseResampler resampler_;
+    std::unique_ptr<int16_t[]> dec_pcm_; // one decoded frame at the stream rate
+    size_t dec_pending_ = 0;             // samples in dec_pcm_ not in the ring yet
+    std::unique_ptr<uint8_t[]> dec_unit_; // one stream unit
+    size_t dec_unit_cap_ = 0;
+    bool rebuffering_ = false;
+
+    std::atomic<End> end_{End::NONE};
+    std::atomic<uint32_t> end_pos_ms_{0};
+    std::function<void()> on_end_cb_;
+    Stats stats_{};
+
+    TaskHandle_t fetch_task_ = nullptr;
+    TaskHandle_t dec_task_ = nullptr;
+};
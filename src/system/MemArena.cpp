@@ -0,0 +1,186 @@
+#include "MemArena.hpp"
+
+#include <cstring>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "MemArena";
+
+// ============================================================================
+// Budget (bytes per region)
+// ============================================================================
+#ifndef PTALK_ARENA_AUDIO_BYTES
+// mic_pcm 4K + mic_enc 32K + spk_pcm 8K + spk_enc 16K + kws 4K + aec 4K,
+// each plus its wrap-around slack (one frame / one uplink chunk)
+#define PTALK_ARENA_AUDIO_BYTES (78 * 1024)
+#endif
+#ifndef PTALK_ARENA_DISPLAY_BYTES
+// 2 x 320 px x 16 lines RGB565 + one 320 px line
+#define PTALK_ARENA_DISPLAY_BYTES (21 * 1024)
+#endif
+#ifndef PTALK_ARENA_NET_BYTES
+// Uplink packet header + 1 KB payload
+#define PTALK_ARENA_NET_BYTES (2 * 1024)
+#endif
+#ifndef PTALK_ARENA_OTA_BYTES
+// 8 x 2 KB chunk pool (default MQTT window / chunk size) + 2 KB heatshrink output
+#define PTALK_ARENA_OTA_BYTES (18 * 1024)
+#endif
+
+namespace
+{
+    struct RegionDef
+    {
+        const char *name;
+        size_t bytes;
+        uint32_t caps;
+    };
+
+    constexpr RegionDef REGIONS[MemArena::REGION_COUNT] = {
+        {"audio", PTALK_ARENA_AUDIO_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT},
+        {"display", PTALK_ARENA_DISPLAY_BYTES, MALLOC_CAP_DMA},
+        {"net", PTALK_ARENA_NET_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT},
+        {"ota", PTALK_ARENA_OTA_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT},
+    };
+
+    constexpr size_t alignUp(size_t n) { return (n + 3) & ~static_cast<size_t>(3); }
+} // namespace
+
+MemArena &MemArena::instance()
+{
+    static MemArena inst;
+    return inst;
+}
+
+// ============================================================================
+// Boot reservation
+// ============================================================================
+bool MemArena::init()
+{
+    if (initialized_)
+        return true;
+    initialized_ = true;
+
+    bool ok = true;
+    for (size_t r = 0; r < REGION_COUNT; r++)
+    {
+        const RegionDef &def = REGIONS[r];
+        if (def.bytes == 0)
+            continue;
+        regions_[r].base = static_cast<uint8_t *>(heap_caps_malloc(def.bytes, def.caps));
+        if (!regions_[r].base)
+        {
+            ESP_LOGE(TAG, "Region %s: %u B not available (largest block %u B), using heap",
+                     def.name, (unsigned)def.bytes, (unsigned)heap_caps_get_largest_free_block(def.caps));
+            ok = false;
+            continue;
+        }
+        regions_[r].cap = def.bytes;
+    }
+    return ok;
+}
+
+// ============================================================================
+// Claims
+// ============================================================================
+void *MemArena::claim(Region r, const char *tag, size_t bytes)
+{
+    if (r >= REGION_COUNT || bytes == 0)
+        return nullptr;
+    bytes = alignUp(bytes);
+
+    void *out = nullptr;
+    uint32_t got = 0;
+    portENTER_CRITICAL(&lock_);
+    RegionState &rs = regions_[r];
+
+    Block *blk = nullptr;
+    for (size_t i = 0; i < block_count_; i++)
+    {
+        if (blocks_[i].region == r && strcmp(blocks_[i].tag, tag) == 0)
+            blk = &blocks_[i];
+    }
+
+    if (blk && bytes <= blk->bytes)
+    {
+        // Re-claim (re-layout): same block
+        out = rs.base + blk->offset;
+    }
+    else if (blk && blk->offset + blk->bytes == rs.used && blk->offset + bytes <= rs.cap)
+    {
+        // Last block of the region: grow in place
+        rs.used = blk->offset + bytes;
+        blk->bytes = bytes;
+        out = rs.base + blk->offset;
+    }
+    else if (!blk && rs.base && rs.used + bytes <= rs.cap && block_count_ < MAX_BLOCKS)
+    {
+        blk = &blocks_[block_count_++];
+        blk->tag = tag;
+        blk->region = r;
+        blk->offset = rs.used;
+        blk->bytes = bytes;
+        rs.used += bytes;
+        out = rs.base + blk->offset;
+    }
+    else
+    {
+        rs.fallbacks++;
+        rs.fallback_bytes += bytes;
+        got = static_cast<uint32_t>(rs.cap - rs.used);
+    }
+    portEXIT_CRITICAL(&lock_);
+
+    if (!out)
+        ESP_LOGW(TAG, "%s/%s: %u B over budget (%u B left), heap fallback",
+                 REGIONS[r].name, tag, (unsigned)bytes, (unsigned)got);
+    return out;
+}
+
+size_t MemArena::capacity(Region r) const
+{
+    return r < REGION_COUNT ? regions_[r].cap : 0;
+}
+
+size_t MemArena::used(Region r) const
+{
+    return r < REGION_COUNT ? regions_[r].used : 0;
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+void MemArena::print() const
+{
+    RegionState regions[REGION_COUNT];
+    Block blocks[MAX_BLOCKS];
+    portENTER_CRITICAL(&lock_);
+    memcpy(regions, regions_, sizeof(regions));
+    memcpy(blocks, blocks_, sizeof(blocks));
+    const size_t block_count = block_count_;
+    portEXIT_CRITICAL(&lock_);
+
+    size_t total_cap = 0;
+    size_t total_used = 0;
+    ESP_LOGI(TAG, "%-8s %-8s %7s %7s %7s %9s", "region", "caps", "budget", "used", "free", "fallback");
+    for (size_t r = 0; r < REGION_COUNT; r++)
+    {
+        const RegionState &rs = regions[r];
+        ESP_LOGI(TAG, "%-8s %-8s %7u %7u %7u %3u/%5u%s", REGIONS[r].name,
+                 (REGIONS[r].caps & MALLOC_CAP_DMA) ? "dma" : "internal",
+                 (unsigned)REGIONS[r].bytes, (unsigned)rs.used, (unsigned)(rs.cap - rs.used),
+                 (unsigned)rs.fallbacks, (unsigned)rs.fallback_bytes, rs.base ? "" : " (heap only)");
+        for (size_t i = 0; i < block_count; i++)
+        {
+            if (blocks[i].region == r)
+                ESP_LOGI(TAG, "  %-14s %7u @%u", blocks[i].tag, (unsigned)blocks[i].bytes, (unsigned)blocks[i].offset);
+        }
+        total_cap += rs.cap;
+        total_used += rs.used;
+    }
+    ESP_LOGI(TAG, "total: %u / %u B reserved in use | heap now: free %u, largest %u",
+             (unsigned)total_used, (unsigned)total_cap,
+             (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT),
+             (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+}
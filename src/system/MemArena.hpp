@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+
+/**
+ * MemArena
+ * ============================================================================
+ * Bộ nhớ dài hạn được cấp một lần lúc boot, trước khi heap bị phân mảnh:
+ * mỗi region là một block liền lấy từ đúng capability (internal / DMA), các
+ * module "claim" khối con theo tag (bump allocator, không free).
+ *
+ * - Claim lại cùng tag trả về đúng khối cũ nếu vẫn vừa (ring được cấp lại khi
+ *   đổi codec không tốn thêm chỗ); khối cuối region được nới tại chỗ.
+ * - Hết budget → nullptr: caller quay về heap như cũ, bảng budget ghi lại
+ *   (fallback) để chỉnh PTALK_ARENA_*_BYTES.
+ * - Region không cấp được lúc boot (heap nhỏ hơn budget) chỉ bị tắt; mọi
+ *   claim vào nó đi đường heap.
+ *
+ * Budget mặc định khớp DeviceProfile (ADPCM/Opus, KWS + AEC, ST7789 240x320,
+ * OTA window 8 x 2 KB); override bằng -DPTALK_ARENA_<REGION>_BYTES=...
+ */
+class MemArena
+{
+public:
+    enum Region : uint8_t
+    {
+        AUDIO,   // SpscRing storage (internal RAM)
+        DISPLAY, // LCD async pixel buffers + line buffer (DMA-capable)
+        NET,     // uplink packet assembly (internal RAM)
+        OTA,     // OTA chunk pool + inflate buffer (internal RAM)
+        REGION_COUNT
+    };
+
+    static MemArena &instance();
+
+    // Reserve every region; call first thing at boot. Returns false if any
+    // region could not be reserved (that region then falls back to the heap).
+    bool init();
+
+    // Block `tag` of `bytes` (4-byte aligned) in region r; nullptr when the
+    // region is exhausted / disabled. `tag` must be a string literal.
+    void *claim(Region r, const char *tag, size_t bytes);
+
+    size_t capacity(Region r) const;
+    size_t used(Region r) const;
+
+    // Budget table on the log (boot and serial "arena" command)
+    void print() const;
+
+private:
+    MemArena() = default;
+
+    static constexpr size_t MAX_BLOCKS = 16;
+
+    struct Block
+    {
+        const char *tag = nullptr;
+        uint8_t region = 0;
+        uint32_t offset = 0;
+        uint32_t bytes = 0;
+    };
+
+    struct RegionState
+    {
+        uint8_t *base = nullptr;
+        size_t cap = 0;
+        size_t used = 0;
+        uint32_t fallbacks = 0;      // claims served by the heap instead
+        uint32_t fallback_bytes = 0; // bytes of those claims
+    };
+
+    mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+    RegionState regions_[REGION_COUNT];
+    Block blocks_[MAX_BLOCKS];
+    size_t block_count_ = 0;
+    bool initialized_ = false;
+};
@@ -0,0 +1,314 @@
+#include "MemTelemetry.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+#include "SpscRing.hpp"
+
+static const char *TAG = "MemTelemetry";
+
+MemTelemetry &MemTelemetry::instance()
+{
+    static MemTelemetry inst;
+    return inst;
+}
+
+// ============================================================================
+// Start / stop
+// ============================================================================
+bool MemTelemetry::start(uint32_t period_ms)
+{
+    if (timer_)
+        return true;
+
+    esp_timer_create_args_t args = {};
+    args.callback = &MemTelemetry::timerCb;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "mem_telemetry";
+    if (esp_timer_create(&args, &timer_) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "esp_timer_create failed");
+        timer_ = nullptr;
+        return false;
+    }
+
+    sample(); // status is valid right after boot
+    esp_timer_start_periodic(timer_, static_cast<uint64_t>(period_ms) * 1000);
+    ESP_LOGI(TAG, "Sampling every %u ms", (unsigned)period_ms);
+    return true;
+}
+
+void MemTelemetry::stop()
+{
+    if (!timer_)
+        return;
+    esp_timer_stop(timer_);
+    esp_timer_delete(timer_);
+    timer_ = nullptr;
+}
+
+void MemTelemetry::timerCb(void *arg)
+{
+    static_cast<MemTelemetry *>(arg)->sample();
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+void MemTelemetry::registerTask(uint32_t stack_bytes)
+{
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    const char *name = pcTaskGetName(self);
+
+    portENTER_CRITICAL(&lock_);
+    // Same name first (restarted task keeps its low-water mark), then a
+    // never-used slot, then any slot whose task exited
+    TaskSlot *slot = nullptr;
+    for (TaskSlot &t : tasks_)
+    {
+        if (t.name[0] && strncmp(t.name, name, sizeof(t.name) - 1) == 0)
+        {
+            slot = &t;
+            break;
+        }
+    }
+    for (size_t i = 0; !slot && i < MAX_TASKS; i++)
+        if (!tasks_[i].name[0])
+            slot = &tasks_[i];
+    for (size_t i = 0; !slot && i < MAX_TASKS; i++)
+        if (!tasks_[i].handle)
+            slot = &tasks_[i];
+
+    if (slot)
+    {
+        if (strncmp(slot->name, name, sizeof(slot->name) - 1) != 0)
+        {
+            snprintf(slot->name, sizeof(slot->name), "%s", name);
+            slot->min_free = UINT32_MAX;
+        }
+        slot->handle = self;
+        slot->stack_bytes = stack_bytes;
+    }
+    portEXIT_CRITICAL(&lock_);
+
+    if (!slot)
+        ESP_LOGW(TAG, "Task table full (%u), %s not tracked", (unsigned)MAX_TASKS, name);
+}
+
+void MemTelemetry::unregisterTask(TaskHandle_t th)
+{
+    if (!th)
+        th = xTaskGetCurrentTaskHandle();
+
+    portENTER_CRITICAL(&lock_);
+    for (TaskSlot &t : tasks_)
+    {
+        if (t.handle != th)
+            continue;
+        // Last look before the TCB goes away
+        const uint32_t hw = uxTaskGetStackHighWaterMark(th);
+        if (hw < t.min_free)
+            t.min_free = hw;
+        t.handle = nullptr;
+    }
+    portEXIT_CRITICAL(&lock_);
+}
+
+void MemTelemetry::registerRing(const char *name, const SpscRing *rb)
+{
+    portENTER_CRITICAL(&lock_);
+    bool added = false;
+    for (size_t i = 0; i < ring_count_; i++)
+    {
+        if (rings_[i].rb == rb)
+        {
+            rings_[i].name = name;
+            added = true;
+        }
+    }
+    if (!added && ring_count_ < MAX_RINGS)
+    {
+        rings_[ring_count_].name = name;
+        rings_[ring_count_].rb = rb;
+        ring_count_++;
+        added = true;
+    }
+    portEXIT_CRITICAL(&lock_);
+
+    if (!added)
+        ESP_LOGW(TAG, "Ring table full (%u), %s not tracked", (unsigned)MAX_RINGS, name);
+}
+
+// ============================================================================
+// Sampling
+// ============================================================================
+MemTelemetry::HeapStats MemTelemetry::readHeap(uint32_t caps)
+{
+    HeapStats h;
+    h.free = heap_caps_get_free_size(caps);
+    h.min_free = heap_caps_get_minimum_free_size(caps);
+    h.largest = heap_caps_get_largest_free_block(caps);
+    h.frag_pct = h.free ? static_cast<uint8_t>(100 - (uint64_t)h.largest * 100 / h.free) : 0;
+    return h;
+}
+
+void MemTelemetry::sample()
+{
+    // Heap walks take their own locks: outside the critical section
+    const HeapStats heap = readHeap(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    const HeapStats dma = readHeap(MALLOC_CAP_DMA);
+
+    portENTER_CRITICAL(&lock_);
+    heap_ = heap;
+    dma_ = dma;
+    for (TaskSlot &t : tasks_)
+    {
+        if (!t.handle)
+            continue;
+        const uint32_t hw = uxTaskGetStackHighWaterMark(t.handle); // bytes on ESP-IDF
+        if (hw < t.min_free)
+            t.min_free = hw;
+    }
+    for (size_t i = 0; i < ring_count_; i++)
+    {
+        RingSlot &r = rings_[i];
+        r.capacity = r.rb->capacity();
+        r.fill = r.rb->available();
+        r.peak = r.rb->peakFill();
+    }
+    samples_++;
+    portEXIT_CRITICAL(&lock_);
+}
+
+int MemTelemetry::tightestTask() const
+{
+    int best = -1;
+    for (size_t i = 0; i < MAX_TASKS; i++)
+    {
+        const TaskSlot &t = tasks_[i];
+        if (!t.name[0] || t.min_free == UINT32_MAX)
+            continue;
+        if (best < 0 || t.min_free < tasks_[best].min_free)
+            best = static_cast<int>(i);
+    }
+    return best;
+}
+
+// ============================================================================
+// Reports
+// ============================================================================
+void MemTelemetry::writeSummary(jsonlite::Writer &w) const
+{
+    portENTER_CRITICAL(&lock_);
+    const HeapStats heap = heap_;
+    const HeapStats dma = dma_;
+    const int ti = tightestTask();
+    TaskSlot tight;
+    if (ti >= 0)
+        tight = tasks_[ti];
+    portEXIT_CRITICAL(&lock_);
+
+    w.beginObject("mem")
+        .field("free", heap.free)
+        .field("min_free", heap.min_free)
+        .field("largest", heap.largest)
+        .field("frag", static_cast<uint32_t>(heap.frag_pct))
+        .field("dma_free", dma.free)
+        .field("dma_largest", dma.largest);
+    if (ti >= 0)
+        w.field("stack_min", tight.min_free).field("stack_task", tight.name);
+    w.endObject();
+}
+
+void MemTelemetry::writeReport(jsonlite::Writer &w) const
+{
+    TaskSlot tasks[MAX_TASKS];
+    RingSlot rings[MAX_RINGS];
+    portENTER_CRITICAL(&lock_);
+    const HeapStats heap = heap_;
+    const HeapStats dma = dma_;
+    memcpy(tasks, tasks_, sizeof(tasks));
+    memcpy(rings, rings_, sizeof(rings));
+    const size_t ring_count = ring_count_;
+    const uint32_t samples = samples_;
+    portEXIT_CRITICAL(&lock_);
+
+    w.beginObject("mem").field("samples", samples);
+    w.beginObject("heap")
+        .field("free", heap.free)
+        .field("min_free", heap.min_free)
+        .field("largest", heap.largest)
+        .field("frag", static_cast<uint32_t>(heap.frag_pct))
+        .endObject();
+    w.beginObject("dma")
+        .field("free", dma.free)
+        .field("min_free", dma.min_free)
+        .field("largest", dma.largest)
+        .endObject();
+
+    // name: {"size": stack given, "free": lowest headroom, "live": running}
+    w.beginObject("tasks");
+    for (const TaskSlot &t : tasks)
+    {
+        if (!t.name[0])
+            continue;
+        w.beginObject(t.name)
+            .field("size", t.stack_bytes)
+            .field("free", t.min_free == UINT32_MAX ? 0u : t.min_free)
+            .field("live", t.handle != nullptr)
+            .endObject();
+    }
+    w.endObject();
+
+    w.beginObject("rings");
+    for (size_t i = 0; i < ring_count; i++)
+    {
+        const RingSlot &r = rings[i];
+        w.beginObject(r.name)
+            .field("cap", r.capacity)
+            .field("fill", r.fill)
+            .field("peak", r.peak)
+            .endObject();
+    }
+    w.endObject();
+
+    w.endObject();
+}
+
+void MemTelemetry::print() const
+{
+    TaskSlot tasks[MAX_TASKS];
+    RingSlot rings[MAX_RINGS];
+    portENTER_CRITICAL(&lock_);
+    const HeapStats heap = heap_;
+    const HeapStats dma = dma_;
+    memcpy(tasks, tasks_, sizeof(tasks));
+    memcpy(rings, rings_, sizeof(rings));
+    const size_t ring_count = ring_count_;
+    portEXIT_CRITICAL(&lock_);
+
+    ESP_LOGI(TAG, "heap: free %u min %u largest %u frag %u%% | dma: free %u largest %u",
+             (unsigned)heap.free, (unsigned)heap.min_free, (unsigned)heap.largest,
+             (unsigned)heap.frag_pct, (unsigned)dma.free, (unsigned)dma.largest);
+
+    ESP_LOGI(TAG, "%-16s %6s %6s %5s", "task", "stack", "free", "used%");
+    for (const TaskSlot &t : tasks)
+    {
+        if (!t.name[0] || t.min_free == UINT32_MAX)
+            continue;
+        const unsigned used = t.stack_bytes ? (unsigned)((t.stack_bytes - t.min_free) * 100 / t.stack_bytes) : 0;
+        ESP_LOGI(TAG, "%-16s %6u %6u %4u%%%s", t.name, (unsigned)t.stack_bytes,
+                 (unsigned)t.min_free, used, t.handle ? "" : " (exited)");
+    }
+
+    ESP_LOGI(TAG, "%-16s %6s %6s %6s", "ring", "cap", "fill", "peak");
+    for (size_t i = 0; i < ring_count; i++)
+    {
+        ESP_LOGI(TAG, "%-16s %6u %6u %6u", rings[i].name, (unsigned)rings[i].capacity,
+                 (unsigned)rings[i].fill, (unsigned)rings[i].peak);
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+#include "JsonLite.hpp"
+
+class SpscRing;
+
+/**
+ * MemTelemetry
+ * ============================================================================
+ * Số liệu bộ nhớ để chỉnh lại stack / buffer theo đo đạc thay vì đoán:
+ * - stack: high-water mark (byte còn trống thấp nhất) của mỗi task đã đăng ký,
+ *   so với kích thước đã cấp cho xTaskCreate;
+ * - heap: internal RAM (free, min free từ lúc boot, block lớn nhất, phân mảnh)
+ *   và vùng DMA-capable;
+ * - ring: mức đầy hiện tại và đỉnh (SpscRing::peakFill(), ghi chính xác ở mỗi
+ *   commit) của các audio ring.
+ *
+ * Một esp_timer lấy mẫu theo chu kỳ (vài chục µs, không cấp phát). Task tự
+ * đăng ký khi chạy và huỷ đăng ký trước vTaskDelete(); handle của task đã bị
+ * xoá không bao giờ được đọc. Báo cáo: writeSummary() (object "mem" gọn trong
+ * status MQTT), writeReport() (đầy đủ, lệnh request_mem), print() (serial).
+ */
+class MemTelemetry
+{
+public:
+    static constexpr size_t MAX_TASKS = 16;
+    static constexpr size_t MAX_RINGS = 8;
+
+    struct HeapStats
+    {
+        uint32_t free = 0;
+        uint32_t min_free = 0; // low-water mark since boot
+        uint32_t largest = 0;  // largest allocatable block
+        uint8_t frag_pct = 0;  // 100 - largest * 100 / free
+    };
+
+    static MemTelemetry &instance();
+
+    // Periodic sampling (esp_timer); no-op if already running.
+    bool start(uint32_t period_ms = 5000);
+    void stop();
+
+    // Calling task; stack_bytes = the depth given to xTaskCreate.
+    void registerTask(uint32_t stack_bytes);
+    // Must run before the task is deleted (nullptr = calling task).
+    void unregisterTask(TaskHandle_t th = nullptr);
+
+    // Ring object must outlive the telemetry (AudioManager members do);
+    // an unallocated ring reports capacity 0.
+    void registerRing(const char *name, const SpscRing *rb);
+
+    // Take one sample now (also run by the timer).
+    void sample();
+
+    HeapStats internalHeap() const { return heap_; }
+    HeapStats dmaHeap() const { return dma_; }
+
+    // Compact "mem" member of the status document: heap + tightest stack
+    void writeSummary(jsonlite::Writer &w) const;
+    // Full "mem" member: every task and ring
+    void writeReport(jsonlite::Writer &w) const;
+    // Table on the log (serial "mem" command)
+    void print() const;
+
+private:
+    MemTelemetry() = default;
+
+    static void timerCb(void *arg);
+    static HeapStats readHeap(uint32_t caps);
+
+    struct TaskSlot
+    {
+        TaskHandle_t handle = nullptr; // nullptr once the task exited
+        char name[16] = {};            // kept: a restarted task reuses its slot
+        uint32_t stack_bytes = 0;
+        uint32_t min_free = UINT32_MAX; // lowest high-water mark seen (bytes)
+    };
+
+    struct RingSlot
+    {
+        const char *name = nullptr;
+        const SpscRing *rb = nullptr;
+        uint32_t capacity = 0;
+        uint32_t fill = 0;
+        uint32_t peak = 0;
+    };
+
+    // Index of the task with the least stack headroom, -1 if none
+    int tightestTask() const;
+
+    mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+    TaskSlot tasks_[MAX_TASKS];
+    RingSlot rings_[MAX_RINGS];
+    size_t ring_count_ = 0;
+
+    HeapStats heap_;
+    HeapStats dma_;
+    uint32_t samples_ = 0;
+
+    esp_timer_handle_t timer_ = nullptr;
+};
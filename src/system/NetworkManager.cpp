@@ -6,33 +6,92 @@
 #include "system/DisplayManager.hpp"
 #include "system/PowerManager.hpp"
 #include "system/MQTTConfig.hpp"
+#include "system/LatencyTrace.hpp"
+#include "system/MemTelemetry.hpp"
+#include "system/Profiler.hpp"
+#include "system/MemArena.hpp"
+#include "system/TaskPlan.hpp"
+#include "system/FlashFs.hpp"
+#include "system/EventLog.hpp"
+#include "system/AudioHealth.hpp"
+#include "system/AnimPackCache.hpp"
+#include "system/MediaPlayer.hpp"
+#include "system/ConfigStore.hpp"
+#include "AppController.hpp"
+
+#include "AudioPacket.hpp"
+#include "OtaChunk.hpp"
 
 #include "esp_mac.h"
+#include "esp_system.h" // esp_random
+#include <algorithm>
+#include <charconv>
+#include <new>
 #include <sstream>
 #include <iomanip>
+#include <cstring>
 #include "Version.hpp"
-#include "cJSON.h"
+#include "JsonLite.hpp"
 #include "nvs_flash.h"
 #include "nvs.h"
 
 #include "esp_log.h"
 #include "esp_timer.h"
-#include "esp_crc.h" // For CRC32 verification
 
 
 static const char *TAG = "NetworkManager";
 
 // Forward declarations for NVS storage utility functions
-static bool nmgr_save_u8(const char *key, uint8_t value);
-static bool nmgr_save_str(const char *key, const std::string &value);
-static uint8_t nmgr_load_u8(const char *key, uint8_t def_val);
 static std::string nmgr_load_str(const char *key, const char *def_val);
 
+// Largest control message / status document (fixed buffers, no heap)
+static constexpr size_t JSON_SMALL_MAX = 256;
+static constexpr size_t STATUS_JSON_MAX = 1536;
+// Full memory report (request_mem): every task and ring, heap-allocated
+static constexpr size_t MEM_REPORT_MAX = 2048;
+// CPU report (request_cpu): up to Profiler::MAX_TASKS tasks + probes
+static constexpr size_t CPU_REPORT_MAX = 2560;
+// Uplink store spill (UtteranceStore), on the FlashFs partition
+static const char *UPLINK_SPILL_PATH = "/spiffs/utt.bin";
+// Config mode reuses the background scan cache up to this age; older → one
+// short active scan, bounded by SCAN_WAIT_MS
+static constexpr uint32_t SCAN_FRESH_MS = 5 * 60 * 1000;
+static constexpr uint32_t SCAN_WAIT_MS = 2500;
+// EventLog: at most one audio glitch record per kind per window; records per
+// MQTT message (8 B header + 32 x 16 B)
+static constexpr uint32_t EVLOG_GLITCH_MS = 10000;
+static constexpr size_t EVLOG_UPLOAD_BATCH = 32;
+// Roam search: the background scan cache counts if this fresh, and a scan
+// started for it is read back at the next link sample
+static constexpr uint32_t LINK_ROAM_SCAN_AGE_MS = 30000;
+
+// EventLog value for link records: RSSI (u8) | other RSSI or RTT << 8
+static uint32_t linkEventValue(int8_t rssi, uint32_t hi)
+{
+    return static_cast<uint8_t>(rssi) | std::min<uint32_t>(hi, 0xFFFFFF) << 8;
+}
+
+static wifi_ps_type_t idlePowerSave(LinkQualityMonitor::Sleep s)
+{
+    switch (s)
+    {
+    case LinkQualityMonitor::Sleep::MAX_MODEM:
+        return WIFI_PS_MAX_MODEM;
+    case LinkQualityMonitor::Sleep::NONE:
+        return WIFI_PS_NONE;
+    default:
+        return WIFI_PS_MIN_MODEM;
+    }
+}
+
 NetworkManager::NetworkManager() = default;
 
 NetworkManager::~NetworkManager()
 {
     stop();
+    if (sub_interaction_id != -1)
+        StateManager::instance().unsubscribeInteraction(sub_interaction_id);
+    StateManager::deleteMailbox(state_mailbox);
 }
 
 // ============================================================================
@@ -53,12 +112,26 @@ bool NetworkManager::init()
 
     wifi->init();
     ws->init();
+    wifi->setScanRefresh(config_.wifi_scan_refresh_ms);
+
+    // Store-and-forward spill file; the first mount formats the partition
+    // (seconds, once), so it happens here and not at the first drop
+    if (config_.uplink_store_ram_bytes && config_.uplink_store_spill_bytes)
+        FlashFs::instance().mount();
+
+    // Idle profile until a voice turn starts (modem sleep when configured)
+    radio_pm_.create(ESP_PM_CPU_FREQ_MAX, "radio_busy");
+    updateRadioProfile();
 
     // Apply configured WS URL if provided
     if (!config_.ws_url.empty())
     {
         ws->setUrl(config_.ws_url);
     }
+    if (config_.ws_ca_pem.empty())
+        config_.ws_ca_pem = nmgr_load_str("ws_ca", "");
+    if (!config_.ws_ca_pem.empty())
+        ws->setCaCert(config_.ws_ca_pem.c_str()); // config_ outlives ws
 
     // --------------------------------------------------------------------
     // WiFi Status Callback
@@ -75,24 +148,42 @@ bool NetworkManager::init()
     // --------------------------------------------------------------------
     // WebSocket Message Callbacks
     // --------------------------------------------------------------------
-    ws->onText([this](const std::string &msg)
+    ws->onText([this](std::string_view msg)
                { this->handleWsTextMessage(msg); });
 
-    ws->onBinary([this](const uint8_t *data, size_t len)
-                 { this->handleWsBinaryMessage(data, len); });
+    ws->onBinary([this](const WsBinaryView &frag)
+                 { this->handleWsBinaryMessage(frag); });
 
-    // Subscribe to interaction state updates
+    // Subscribe to interaction state updates. Deferred: the setter (touch /
+    // audio task) only queues the event; uplink task creation runs here in
+    // the network task loop.
+    state_mailbox = StateManager::createMailbox(8);
     sub_interaction_id = StateManager::instance().subscribeInteraction(
         [this](state::InteractionState s, state::InputSource src)
         {
             this->handleInteractionState(s);
-        });
+        },
+        state_mailbox);
 
     mqtt = std::make_unique<MqttClient>();
     mqtt->init();
 
     // Tạo topic dựa trên MAC ID
-    mqtt_base_topic = "devices/" + getDeviceEfuseID();
+    device_id = getDeviceEfuseID();
+    mqtt_base_topic = "devices/" + device_id;
+    // Built once: publish/dispatch compare against these without temporaries
+    topic_status = mqtt_base_topic + "/status";
+    topic_cmd = mqtt_base_topic + "/cmd";
+    topic_ota_data = mqtt_base_topic + "/ota_data";
+    topic_ota_ack = mqtt_base_topic + "/ota_ack";
+    topic_telemetry = mqtt_base_topic + "/telemetry";
+    topic_events = mqtt_base_topic + "/events";
+    topic_media = mqtt_base_topic + "/media";
+
+    TelemetryAggregator::Config tcfg;
+    tcfg.report_ms = config_.telemetry_report_ms;
+    tcfg.keyframe_every = config_.telemetry_keyframe_every;
+    telemetry_.configure(tcfg);
 
     setupMqtt();
     ESP_LOGI(TAG, "NetworkManager init OK");
@@ -106,17 +197,34 @@ bool NetworkManager::init(const Config &cfg)
     return init();
 }
 
+void NetworkManager::deferInit(const Config &cfg)
+{
+    config_ = cfg;
+    init_deferred_ = true;
+}
+
 // ============================================================================
 // START / STOP
 // ============================================================================
 void NetworkManager::start()
 {
-    if (started)
+    // The start graph and the controller task (PowerState NORMAL) may race here
+    if (started.exchange(true))
         return;
-    started = true;
 
     ESP_LOGI(TAG, "NetworkManager start()");
 
+    if (init_deferred_)
+    {
+        init_deferred_ = false;
+        if (!init())
+        {
+            ESP_LOGE(TAG, "Deferred init failed");
+            started = false;
+            return;
+        }
+    }
+
     // Prefer explicit credentials if provided in config
     if (!config_.sta_ssid.empty() && !config_.sta_pass.empty())
     {
@@ -125,7 +233,7 @@ void NetworkManager::start()
         // Spawn retry task to open portal if connection fails
         if (wifi_retry_task == nullptr)
         {
-            xTaskCreate(&NetworkManager::retryWifiTaskEntry, "wifi_retry", 4096, this, 5, &wifi_retry_task);
+            TaskPlan::instance().spawn(TaskPlan::WIFI_RETRY, &NetworkManager::retryWifiTaskEntry, this, &wifi_retry_task);
         }
     }
     else
@@ -139,26 +247,19 @@ void NetworkManager::start()
         if (wifi_retry_task == nullptr)
         {
             ESP_LOGI(TAG, "Spawning WiFi retry task for fallback to portal if connection fails");
-            xTaskCreate(&NetworkManager::retryWifiTaskEntry, "wifi_retry", 4096, this, 5, &wifi_retry_task);
+            TaskPlan::instance().spawn(TaskPlan::WIFI_RETRY, &NetworkManager::retryWifiTaskEntry, this, &wifi_retry_task);
         }
     }
 
+    // Settings changed anywhere wake the loop, which writes them once they settle
+    ConfigStore::instance().setDirtyHook([this]
+                                         { wakeLoop(); });
+
     // Spawn internal update task so callers don't need to tick manually
     if (task_handle == nullptr)
     {
-        BaseType_t rc = xTaskCreatePinnedToCore(
-            &NetworkManager::taskEntry,
-            "NetworkLoop",
-            8192, // Increased from 4096 to prevent stack overflow
-            this,
-            5,
-            &task_handle,
-            tskNO_AFFINITY);
-        if (rc != pdPASS)
-        {
-            ESP_LOGE(TAG, "Failed to create NetworkLoop task (%d)", (int)rc);
-            task_handle = nullptr;
-        }
+        // Pinned beside the Wi-Fi / lwIP tasks on core 0 (task plan)
+        TaskPlan::instance().spawn(TaskPlan::NET_LOOP, &NetworkManager::taskEntry, this, &task_handle);
     }
 }
 
@@ -172,6 +273,9 @@ void NetworkManager::stop()
 
     ws_should_run = false;
     ws_running = false;
+    ws_dropped_at_us = 0;
+    ws_resume_deadline_us = 0;
+    ws_session_epoch++;
 
     if (ws)
         ws->close();
@@ -182,8 +286,12 @@ void NetworkManager::stop()
     {
         TaskHandle_t th = task_handle;
         task_handle = nullptr;
+        MemTelemetry::instance().unregisterTask(th);
         vTaskDelete(th);
     }
+
+    // No loop left to run the write-behind
+    ConfigStore::instance().flush();
 }
 
 // ============================================================================
@@ -196,9 +304,47 @@ void NetworkManager::update(uint32_t dt_ms)
         return;
 
     tick_ms += dt_ms;
+
+    // Periodic retained status (heap / stack telemetry included)
+    if (config_.status_interval_ms && mqtt && mqtt->isConnected())
+    {
+        status_elapsed_ms += dt_ms;
+        if (status_elapsed_ms >= config_.status_interval_ms)
+        {
+            status_elapsed_ms = 0;
+            publishMqttStatus();
+        }
+    }
+    updateTelemetry(dt_ms);
+    updateEventLog(dt_ms);
+    updateLink(dt_ms);
+    updateMedia();
+    ConfigStore::instance().flushIfQuiet();
+
     if (ws_running && !ws->isConnected())
     {
-        ws->close();
+        ws->disconnect();
+    }
+
+    // --------------------------------------------------------------------
+    // Session resumption deadlines
+    // --------------------------------------------------------------------
+    const int64_t now_us = esp_timer_get_time();
+    const int64_t resume_deadline = ws_resume_deadline_us.load();
+    if (resume_deadline && now_us > resume_deadline && ws_running)
+    {
+        ESP_LOGW(TAG, "No answer to session_resume, starting a new session");
+        abandonWsSession();
+    }
+    const int64_t dropped_at = ws_dropped_at_us.load();
+    if (dropped_at && !ws_running &&
+        now_us - dropped_at > static_cast<int64_t>(config_.ws_resume_window_ms) * 1000)
+    {
+        ESP_LOGW(TAG, "WS down for %u ms, session given up", (unsigned)config_.ws_resume_window_ms);
+        ws_dropped_at_us = 0;
+        ws_session_epoch++;
+        if (on_disconnect_cb)
+            on_disconnect_cb();
     }
     // --------------------------------------------------------------------
     // Retry WebSocket when Wi‑Fi is connected
@@ -221,10 +367,62 @@ void NetworkManager::update(uint32_t dt_ms)
         }
         ws->connect();
 
-        ws_retry_timer = 5000; // 5 second delay between reconnect attempts
+        // Watchdog for this attempt; a CLOSED event rearms it with the backoff
+        ws_retry_timer = std::max<uint32_t>(5000, nextWsBackoffMs());
     }
 }
 
+uint32_t NetworkManager::nextWakeMs() const
+{
+    uint32_t wait = UINT32_MAX;
+    auto due = [&wait](int64_t ms)
+    { wait = static_cast<uint32_t>(std::min<int64_t>(wait, std::max<int64_t>(ms, 0))); };
+
+    if (config_.status_interval_ms && mqtt && mqtt->isConnected())
+        due(static_cast<int64_t>(config_.status_interval_ms) - status_elapsed_ms);
+    if (config_.telemetry_sample_ms && config_.telemetry_report_ms)
+    {
+        due(static_cast<int64_t>(config_.telemetry_sample_ms) - tele_sample_elapsed_ms);
+        if (mqtt && mqtt->isConnected())
+            due(static_cast<int64_t>(config_.telemetry_report_ms) - tele_report_elapsed_ms);
+    }
+    if (ws_should_run && !ws_running)
+        due(ws_retry_timer);
+    if (ws_running)
+        due(1000); // link supervision (ws->isConnected() has no event of its own)
+    if (config_.link_sample_ms && wifi_ready)
+        due(static_cast<int64_t>(config_.link_sample_ms) - link_elapsed_ms);
+
+    due(ConfigStore::instance().msUntilFlush()); // UINT32_MAX when clean
+    if (!voice_active_)
+        due(EventLog::instance().msUntilFlush()); // deferred during a turn
+
+    const int64_t now_us = esp_timer_get_time();
+    const int64_t resume_deadline = ws_resume_deadline_us.load();
+    if (resume_deadline)
+        due((resume_deadline - now_us) / 1000 + 1);
+    const int64_t dropped_at = ws_dropped_at_us.load();
+    if (dropped_at && !ws_running)
+        due((dropped_at + static_cast<int64_t>(config_.ws_resume_window_ms) * 1000 - now_us) / 1000 + 1);
+    return wait;
+}
+
+// Full jitter over an exponentially growing window: min * 2^n capped at max,
+// delay uniform in [window/2, window]. Devices that dropped together (AP
+// reboot, server restart) then spread out instead of reconnecting in lockstep.
+uint32_t NetworkManager::nextWsBackoffMs()
+{
+    uint32_t window = config_.ws_backoff_min_ms;
+    for (uint8_t i = 0; i < ws_backoff_exp && window < config_.ws_backoff_max_ms; i++)
+        window *= 2;
+    window = std::min(window, config_.ws_backoff_max_ms);
+    if (ws_backoff_exp < 16)
+        ws_backoff_exp++;
+
+    const uint32_t half = window / 2;
+    return half + (half ? esp_random() % (half + 1) : 0);
+}
+
 void NetworkManager::taskEntry(void *arg)
 {
     auto *self = static_cast<NetworkManager *>(arg);
@@ -234,6 +432,8 @@ void NetworkManager::taskEntry(void *arg)
         return;
     }
 
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::NET_LOOP));
+
     TickType_t prev = xTaskGetTickCount();
     for (;;)
     {
@@ -241,6 +441,7 @@ void NetworkManager::taskEntry(void *arg)
         {
             // Clear our own handle before self-deleting
             self->task_handle = nullptr;
+            MemTelemetry::instance().unregisterTask();
             vTaskDelete(nullptr);
         }
 
@@ -248,9 +449,16 @@ void NetworkManager::taskEntry(void *arg)
         uint32_t dt_ms = (now - prev) * portTICK_PERIOD_MS;
         prev = now;
 
-        self->update(dt_ms ? dt_ms : self->update_interval_ms);
+        self->update(dt_ms);
 
-        vTaskDelay(pdMS_TO_TICKS(self->update_interval_ms));
+        // Sleep until the next deadline of update() or an event: deferred
+        // state callbacks and wakeLoop() (Wi-Fi / WS / MQTT status, stop)
+        // both arrive through the mailbox. Nothing due = no wakeups at all.
+        const uint32_t wait_ms = self->nextWakeMs();
+        TickType_t ticks = portMAX_DELAY;
+        if (wait_ms != UINT32_MAX)
+            ticks = std::max<TickType_t>(1, (wait_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS);
+        StateManager::instance().pump(self->state_mailbox, ticks);
     }
 }
 
@@ -268,7 +476,7 @@ void NetworkManager::setCredentials(const std::string &ssid, const std::string &
 // ============================================================================
 // SEND MESSAGE TO WS
 // ============================================================================
-bool NetworkManager::sendText(const std::string &text)
+bool NetworkManager::sendText(std::string_view text)
 {
     if (!ws_running)
         return false;
@@ -285,16 +493,21 @@ bool NetworkManager::sendBinary(const uint8_t *data, size_t len)
 // ============================================================================
 // CALLBACK REGISTRATION
 // ============================================================================
-void NetworkManager::onServerText(std::function<void(const std::string &)> cb)
+void NetworkManager::onServerText(std::function<void(std::string_view)> cb)
 {
     on_text_cb = cb;
 }
 
-void NetworkManager::onServerBinary(std::function<void(const uint8_t *, size_t)> cb)
+void NetworkManager::onServerBinary(std::function<void(const WsBinaryView &)> cb)
 {
     on_binary_cb = cb;
 }
 
+void NetworkManager::onServerAudioPacket(std::function<bool(const audio_packet::Header &)> cb)
+{
+    on_audio_packet_cb = cb;
+}
+
 void NetworkManager::onDisconnect(std::function<void()> cb)
 {
     on_disconnect_cb = cb;
@@ -353,6 +566,11 @@ void NetworkManager::handleWifiStatus(int status)
     case 0: // DISCONNECTED
         ESP_LOGW(TAG, "WiFi → DISCONNECTED");
 
+        if (wifi_ready)
+        {
+            EventLog::instance().record(EventLog::Type::WIFI_DOWN);
+            wifi_down_at_us = esp_timer_get_time();
+        }
         wifi_ready = false;
         mqtt->stop();
         // Only close WS if NOT in immune mode (during audio streaming, keep WS alive)
@@ -360,8 +578,9 @@ void NetworkManager::handleWifiStatus(int status)
         {
             ws_should_run = false;
             ws_running = false;
+            // Keep the client: GOT_IP reconnects on the same instance
             if (ws)
-                ws->close();
+                ws->disconnect();
             publishState(state::ConnectivityState::OFFLINE);
         }
         else
@@ -381,12 +600,25 @@ void NetworkManager::handleWifiStatus(int status)
     case 2: // GOT_IP
         ESP_LOGI(TAG, "WiFi → GOT_IP");
 
+        if (wifi_down_at_us)
+        {
+            EventLog::instance().record(EventLog::Type::WIFI_UP, 0,
+                                        static_cast<uint32_t>((esp_timer_get_time() - wifi_down_at_us) / 1000));
+            wifi_down_at_us = 0;
+        }
+
         if (wifi_retry_task)
         {
             vTaskDelete(wifi_retry_task);
             wifi_retry_task = nullptr;
         }
         wifi_ready = true;
+        // New association (roam, reconnect): judge this AP from scratch
+        link_.onAssociated();
+        link_elapsed_ms = 0;
+        link_ping_out = false;
+        link_roam_scan = false;
+        link_btm_last = false;
         ws_should_run = true;
         ws_retry_timer = 500; // Wait 500ms for WiFi to stabilize before WS connect
         mqtt->start();
@@ -394,6 +626,7 @@ void NetworkManager::handleWifiStatus(int status)
         break;
     }
 
+    wakeLoop();
     ESP_LOGI(TAG, "handleWifiStatus completed");
 }
 
@@ -413,15 +646,29 @@ void NetworkManager::handleWsStatus(int status)
     case 0: // CLOSED
         ESP_LOGW(TAG, "WS → CLOSED");
 
+        if (ws_running)
+            EventLog::instance().record(EventLog::Type::WS_DOWN);
         ws_running = false;
+        ws_resume_deadline_us = 0;
 
-        if (on_disconnect_cb)
-            on_disconnect_cb();
+        // Defer the cleanup: a reconnect inside the resume window continues
+        // the turn (update() runs it once the window expires)
+        if (config_.ws_resume_window_ms && ws_session_token)
+        {
+            int64_t none = 0;
+            ws_dropped_at_us.compare_exchange_strong(none, esp_timer_get_time());
+        }
+        else
+        {
+            ws_session_epoch++;
+            if (on_disconnect_cb)
+                on_disconnect_cb();
+        }
 
         if (wifi_ready)
         {
             ws_should_run = true;
-            ws_retry_timer = 1500;
+            ws_retry_timer = nextWsBackoffMs();
             publishState(state::ConnectivityState::CONNECTING_WS);
         }
         else
@@ -438,39 +685,127 @@ void NetworkManager::handleWsStatus(int status)
     case 2: // OPEN
         ESP_LOGI(TAG, "WS → OPEN");
         ws_running = true;
+        ws_backoff_exp = 0;
+        dl_skip = false; // a message cut by the drop is not continued
 
         publishState(state::ConnectivityState::ONLINE);
 
-        // Send device handshake to server with all info and device_id for linking
-        sendWSDeviceHandshake();
+        if (ws_dropped_at_us.load() && ws_session_token)
+        {
+            // Short drop: ask the server to continue the session; framing and
+            // audio format stay as negotiated
+            ws_resume_deadline_us = esp_timer_get_time() + 2000 * 1000;
+            sendWSSessionResume();
+        }
+        else
+        {
+            dl_framed = false; // until this server enables it
+            ul_adapt_ack_ = false;
+            // Send device handshake to server with all info and device_id for linking
+            sendWSDeviceHandshake();
+        }
 
         break;
     }
+    wakeLoop(); // retry timer / resume deadlines changed
+}
+bool NetworkManager::sendWSSessionResume()
+{
+    char token[17];
+    snprintf(token, sizeof(token), "%016llx", (unsigned long long)ws_session_token);
+
+    char buf[JSON_SMALL_MAX];
+    jsonlite::Writer w(buf, sizeof(buf));
+    w.beginObject()
+        .field("cmd", "session_resume")
+        .field("device_id", device_id.c_str())
+        .field("session", token)
+        // Last uplink audio session, so the server knows which turn was cut
+        .field("uplink_session", static_cast<uint32_t>(uplink_session))
+        .endObject();
+
+    bool result = w.ok() && sendText(w.view());
+    ESP_LOGI(TAG, "Session resume sent (%s)", token);
+    return result;
 }
+
+void NetworkManager::abandonWsSession()
+{
+    ws_resume_deadline_us = 0;
+    ws_session_epoch++;
+    if (ws_dropped_at_us.exchange(0) && on_disconnect_cb)
+        on_disconnect_cb();
+    ws_session_token = 0;
+    dl_framed = false;
+    ul_adapt_ack_ = false;
+    sendWSDeviceHandshake();
+}
+
 bool NetworkManager::sendWSDeviceHandshake()
 {
     if (!ws_running)
         return false;
 
-    std::string device_id = getDeviceEfuseID();
-    std::string app_version = app_meta::APP_VERSION;
-    std::string device_name = nmgr_load_str("device_name", "PTalk");
-    uint8_t battery = power_manager ? power_manager->getPercent() : 85;
+    // New server session; kept across drops shorter than the resume window
+    if (!ws_session_token)
+        ws_session_token = (static_cast<uint64_t>(esp_random()) << 32) | esp_random();
+    char token[17];
+    snprintf(token, sizeof(token), "%016llx", (unsigned long long)ws_session_token);
 
-    // Build handshake message with device info
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddStringToObject(root, "cmd", "device_handshake");
-    cJSON_AddStringToObject(root, "device_id", device_id.c_str());
-    cJSON_AddStringToObject(root, "firmware_version", app_version.c_str());
-    cJSON_AddStringToObject(root, "device_name", device_name.c_str());
-    cJSON_AddNumberToObject(root, "battery_percent", battery);
-    cJSON_AddStringToObject(root, "connectivity_state", "ONLINE");
+    char device_name[64];
+    ConfigStore::instance().getStr(ConfigStore::Key::DEVICE_NAME, device_name, sizeof(device_name));
+    uint8_t battery = power_manager ? power_manager->getPercent() : 85;
 
-    char *json_str = cJSON_Print(root);
-    bool result = sendText(json_str);
+    // Uplink rate levels, nominal first (header byte "kbps" names the one in use)
+    char ul_levels[32] = "";
+    if (audio_manager)
+    {
+        size_t off = 0;
+        for (size_t i = 0; i < audio_manager->uplinkLevels() && off < sizeof(ul_levels); i++)
+            off += snprintf(ul_levels + off, sizeof(ul_levels) - off, i ? ",%u" : "%u",
+                            (unsigned)audio_manager->uplinkLevel(i).kbps);
+    }
 
-    cJSON_free(json_str);
-    cJSON_Delete(root);
+    // Build handshake message with device info
+    char buf[768];
+    jsonlite::Writer w(buf, sizeof(buf));
+    w.beginObject()
+        .field("cmd", "device_handshake")
+        .field("device_id", device_id.c_str())
+        .field("firmware_version", app_meta::APP_VERSION)
+        .field("ota_encodings", "raw,heatshrink") // request_ota "encoding"
+        .field("device_name", device_name)
+        .field("battery_percent", static_cast<uint32_t>(battery))
+        .field("connectivity_state", "ONLINE")
+        // Audio stream format (framed codecs use [u16 LE len][packet] records)
+        .field("audio_codec", audio_manager ? audio_manager->codecName() : "adpcm")
+        .field("audio_frame_ms", static_cast<uint32_t>(audio_manager ? audio_manager->frameMs() : 16))
+        .field("audio_framed", audio_manager ? audio_manager->encodedStreamFramed() : false)
+        .field("audio_dl_sync", true) // ADPCM downlink packets may carry FLAG_SYNC
+        // Uplink messages carry the AudioPacket.hpp header; the server answers
+        // "AUDIO_PROTO:2" to put the same header on downlink audio
+        .field("audio_protocol", static_cast<uint32_t>(audio_packet::VERSION))
+        .field("audio_packet_ms", config_.uplink_packet_ms)
+        // Adaptive uplink: kbps levels the device may switch between; ADPCM
+        // at half rate only after the server answers "AUDIO_UL_ADAPT:1"
+        .field("audio_ul_kbps", ul_levels)
+        .field("audio_ul_cancel", true) // uplink may end with FLAG_CANCEL
+        // Downlink may use any rate (announced with "AUDIO_RATE:<hz>"); the device
+        // resamples it to its speaker rate
+        .field("audio_out_rate", static_cast<uint32_t>(audio_manager ? audio_manager->outputSampleRate() : 16000))
+        // Resumption: after a drop the device sends {"cmd":"session_resume",
+        // "session":...} instead of this; the server answers "SESSION:RESUMED"
+        // or "SESSION:NEW"
+        .field("session", token)
+        .field("resume_window_ms", config_.ws_resume_window_ms)
+        .endObject();
+
+    if (!w.ok())
+    {
+        ESP_LOGE(TAG, "Device handshake does not fit %u B", (unsigned)sizeof(buf));
+        return false;
+    }
+    bool result = sendText(w.view());
 
     ESP_LOGI(TAG, "Device handshake sent to server");
     return result;
@@ -479,9 +814,44 @@ bool NetworkManager::sendWSDeviceHandshake()
 // ============================================================================
 // MESSAGE FROM WEBSOCKET
 // ============================================================================
-void NetworkManager::handleWsTextMessage(const std::string &msg)
+void NetworkManager::handleWsTextMessage(std::string_view msg)
 {
-    ESP_LOGI(TAG, "WS Text Message: %s", msg.c_str());
+    ESP_LOGI(TAG, "WS Text Message: %.*s", (int)msg.size(), msg.data());
+
+    // Downlink audio framing: "AUDIO_PROTO:<version>" (0 = raw stream)
+    if (msg.rfind("AUDIO_PROTO:", 0) == 0)
+    {
+        unsigned v = 0;
+        std::from_chars(msg.data() + 12, msg.data() + msg.size(), v);
+        dl_framed = (v == audio_packet::VERSION);
+        dl_skip = false;
+        ESP_LOGI(TAG, "Downlink audio %s (server protocol %u)",
+                 dl_framed ? "framed" : "raw", v);
+        return;
+    }
+
+    // Server decodes the uplink at any level of "audio_ul_kbps"
+    if (msg.rfind("AUDIO_UL_ADAPT:", 0) == 0)
+    {
+        ul_adapt_ack_ = msg.size() > 15 && msg[15] == '1';
+        ESP_LOGI(TAG, "Uplink rate levels %s by server", ul_adapt_ack_ ? "accepted" : "refused");
+        return;
+    }
+
+    // Answer to session_resume
+    if (msg == "SESSION:RESUMED")
+    {
+        ESP_LOGI(TAG, "WS session resumed");
+        ws_resume_deadline_us = 0;
+        ws_dropped_at_us = 0; // turn continues, no cleanup
+        return;
+    }
+    if (msg == "SESSION:NEW")
+    {
+        ESP_LOGW(TAG, "Server lost the session, full handshake");
+        abandonWsSession();
+        return;
+    }
 
     // ❌ XÓA: Không còn parse JSON config commands từ WS
     // cJSON *json = cJSON_Parse(msg.c_str());
@@ -492,7 +862,7 @@ void NetworkManager::handleWsTextMessage(const std::string &msg)
     {
         auto emotion = parseEmotionCode(msg);
         StateManager::instance().setEmotionState(emotion);
-        ESP_LOGI(TAG, "Emotion code: %s → %d", msg.c_str(), (int)emotion);
+        ESP_LOGI(TAG, "Emotion code: %.*s → %d", (int)msg.size(), msg.data(), (int)emotion);
     }
 
 
@@ -501,16 +871,44 @@ void NetworkManager::handleWsTextMessage(const std::string &msg)
     
 }
 
-void NetworkManager::handleWsBinaryMessage(const uint8_t *data, size_t len)
+void NetworkManager::handleWsBinaryMessage(const WsBinaryView &frag)
 {
     // ❌ XÓA: OTA logic đã chuyển sang MQTT
     // if (firmware_download_active) { ... }
 
-    // ✅ CHỈ GIỮ: Audio streaming downlink
-    if (on_binary_cb)
+    // ✅ CHỈ GIỮ: Audio streaming downlink (fragments go straight to the ring)
+    LatencyTrace::instance().mark(LatencyTrace::DL_RX);
+    if (!dl_framed)
     {
-        on_binary_cb(data, len);
+        if (on_binary_cb)
+            on_binary_cb(frag);
+        return;
     }
+
+    // Framed: header (+ sync state) at the start of each message, payload
+    // views shifted past it
+    if (frag.first())
+    {
+        audio_packet::Header h;
+        dl_skip = !audio_packet::parse(frag.data, frag.len, h);
+        if (dl_skip)
+        {
+            ESP_LOGW(TAG, "Downlink: bad audio header, dropped %u B", (unsigned)frag.total);
+            return;
+        }
+        dl_hdr = audio_packet::headerBytes(h.flags);
+        if (on_audio_packet_cb && !on_audio_packet_cb(h))
+        {
+            dl_skip = true;
+            return;
+        }
+        if (frag.len > dl_hdr && on_binary_cb)
+            on_binary_cb(WsBinaryView{frag.data + dl_hdr, frag.len - dl_hdr, 0, frag.total - dl_hdr, frag.last});
+        return;
+    }
+
+    if (!dl_skip && on_binary_cb && frag.offset >= dl_hdr)
+        on_binary_cb(WsBinaryView{frag.data, frag.len, frag.offset - dl_hdr, frag.total - dl_hdr, frag.last});
 }
 
 void NetworkManager::handleOtaBinaryChunk(const uint8_t *data, size_t len)
@@ -521,62 +919,86 @@ void NetworkManager::handleOtaBinaryChunk(const uint8_t *data, size_t len)
         sendOtaNack(0);
         return;
     }
+    if (!firmware_download.url.empty())
+    {
+        ESP_LOGW(TAG, "OTA image comes over HTTP(S), ignoring binary chunk");
+        return;
+    }
 
-    const size_t HEADER_SIZE = 12;
-    if (len < HEADER_SIZE)
+    ota_chunk::Chunk chunk;
+    switch (ota_chunk::parse(data, len, chunk))
     {
+    case ota_chunk::Status::OK:
+        break;
+    case ota_chunk::Status::TOO_SMALL:
         ESP_LOGE(TAG, "OTA chunk too small: %zu bytes", len);
         return;
+    case ota_chunk::Status::SIZE_MISMATCH:
+        ESP_LOGE(TAG, "Chunk size mismatch: header=%u, actual=%zu", (unsigned)chunk.size,
+                 len - ota_chunk::HEADER_BYTES);
+        sendOtaNack(chunk.seq);
+        return;
+    case ota_chunk::Status::CRC_MISMATCH:
+        ESP_LOGE(TAG, "Chunk %u CRC mismatch: recv=0x%08X, calc=0x%08X",
+                 (unsigned)chunk.seq, (unsigned)chunk.crc, (unsigned)chunk.calc_crc);
+        ota_chunks_failed++;
+        sendOtaNack(chunk.seq);
+        return;
     }
 
-    // Parse header: [4B seq][4B size][4B crc32][data...]
-    uint32_t seq = data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
-    uint32_t chunk_size = data[4] | (data[5] << 8) | (data[6] << 16) | (data[7] << 24);
-    uint32_t recv_crc = data[8] | (data[9] << 8) | (data[10] << 16) | (data[11] << 24);
+    const uint32_t seq = chunk.seq;
+    const uint8_t *chunk_data = chunk.data;
+    const uint32_t chunk_size = chunk.size;
 
-    const uint8_t *chunk_data = data + HEADER_SIZE;
-    size_t actual_data_len = len - HEADER_SIZE;
-
-    // Verify size
-    if (actual_data_len != chunk_size)
+    // Sliding window: chunks below the base or already buffered are
+    // retransmissions whose ACK was lost; ACK them again.
+    if (seq < ota_expected_seq ||
+        (seq - ota_expected_seq < 32 && (ota_rx_mask & (1u << (seq - ota_expected_seq)))))
     {
-        ESP_LOGE(TAG, "Chunk size mismatch: header=%u, actual=%zu", chunk_size, actual_data_len);
-        sendOtaNack(seq);
+        ESP_LOGD(TAG, "Duplicate chunk %u (base %u) - ACKing", seq, ota_expected_seq);
+        sendOtaAck(seq);
         return;
     }
-
-    // Verify CRC32
-    uint32_t calc_crc = esp_crc32_le(0, chunk_data, chunk_size);
-    if (calc_crc != recv_crc)
+    if (seq - ota_expected_seq >= ota_window)
     {
-        ESP_LOGE(TAG, "Chunk %u CRC mismatch: recv=0x%08X, calc=0x%08X",
-                 seq, recv_crc, calc_crc);
-        ota_chunks_failed++;
-        sendOtaNack(seq);
+        ESP_LOGW(TAG, "Chunk %u outside window [%u, %u)", seq, ota_expected_seq, ota_expected_seq + ota_window);
+        sendOtaNack(seq, true);
         return;
     }
 
-    // Check sequence
-    if (seq != ota_expected_seq)
+    // Hand to AppController (copies into the OTA writer's pool)
+    OtaChunkStatus st = on_firmware_chunk_cb ? on_firmware_chunk_cb(seq, chunk_data, chunk_size)
+                                             : OtaChunkStatus::FAILED;
+    switch (st)
     {
-        if (seq < ota_expected_seq)
-        {
-            ESP_LOGW(TAG, "Duplicate chunk %u (expected %u) - ACKing", seq, ota_expected_seq);
-            sendOtaAck(seq);
-            return;
-        }
-        else
-        {
-            ESP_LOGE(TAG, "Sequence gap: got %u, expected %u", seq, ota_expected_seq);
-            sendOtaNack(seq);
-            return;
-        }
+    case OtaChunkStatus::ACCEPTED:
+        break;
+    case OtaChunkStatus::DUPLICATE:
+        sendOtaAck(seq);
+        return;
+    case OtaChunkStatus::BUSY:
+        // Writer pool full: server resends after the next ACK / timeout
+        sendOtaNack(seq, true);
+        return;
+    case OtaChunkStatus::FAILED:
+    default:
+        ESP_LOGE(TAG, "OTA chunk %u rejected by writer, aborting download", seq);
+        firmware_download_active = false;
+        updateRadioProfile();
+        if (on_firmware_complete_cb)
+            on_firmware_complete_cb(false, "Flash write failed");
+        return;
     }
 
-    // ✅ Chunk OK - forward to OTA handler
+    // ✅ Chunk OK
     firmware_bytes_received += chunk_size;
     ota_chunks_received++;
-    ota_expected_seq++;
+    ota_rx_mask |= 1u << (seq - ota_expected_seq);
+    while (ota_rx_mask & 1u)
+    {
+        ota_rx_mask >>= 1;
+        ota_expected_seq++;
+    }
 
     // Log progress
     if (firmware_expected_size > 0)
@@ -592,20 +1014,25 @@ void NetworkManager::handleOtaBinaryChunk(const uint8_t *data, size_t len)
         }
     }
 
-    // Pass to AppController
-    if (on_firmware_chunk_cb)
-    {
-        on_firmware_chunk_cb(chunk_data, chunk_size);
-    }
-
     // Send ACK via MQTT
     sendOtaAck(seq);
 
-    if (firmware_bytes_received >= firmware_expected_size)
+    // A chunk past the base means the base chunk was lost: NACK it once so the
+    // server resends it without waiting for its timeout
+    if (ota_rx_mask && ota_last_nack != ota_expected_seq)
+    {
+        ota_last_nack = ota_expected_seq;
+        sendOtaNack(ota_expected_seq);
+    }
+
+    bool complete = ota_total_chunks > 0 ? ota_expected_seq >= ota_total_chunks
+                                         : firmware_bytes_received >= firmware_expected_size;
+    if (complete)
     {
         ESP_LOGI(TAG, "OTA download complete: %u bytes in %u chunks (%u failed)",
                  firmware_bytes_received, ota_chunks_received, ota_chunks_failed);
         firmware_download_active = false;
+        updateRadioProfile();
         if (on_firmware_complete_cb)
         {
             on_firmware_complete_cb(true, "Download complete");
@@ -613,56 +1040,403 @@ void NetworkManager::handleOtaBinaryChunk(const uint8_t *data, size_t len)
     }
 }
 
-// Task loop sending microphone data to server
-void NetworkManager::uplinkTaskLoop()
+// Bytes of whole [len][packet] records at the ring head: at most `max_records`
+// records within `budget` bytes, waiting up to `wait` for the first one.
+size_t NetworkManager::collectFramedRecords(size_t budget, size_t max_records,
+                                            size_t &records, TickType_t wait)
+{
+    size_t batch = 0;
+    records = 0;
+    while (records < max_records && batch + 2 <= budget)
+    {
+        const uint8_t *v = mic_encoded_rb->acquireRead(batch + 2, batch == 0 ? wait : 0);
+        if (!v)
+            break;
+        size_t rec = 2 + (static_cast<size_t>(v[batch]) | (static_cast<size_t>(v[batch + 1]) << 8));
+        if (batch + rec > budget || !mic_encoded_rb->acquireRead(batch + rec, 0))
+            break;
+        batch += rec;
+        records++;
+    }
+    return batch;
+}
+
+uint8_t NetworkManager::uplinkUsableLevels() const
 {
-    const size_t SEND_SIZE = 512;
-    uint8_t send_buf[SEND_SIZE];
-    size_t acc = 0;
+    if (!audio_manager || !config_.uplink_adaptive)
+        return 1;
+    // Half-rate ADPCM only for a server that said it decodes it
+    size_t n = audio_manager->uplinkLevels();
+    while (n > 1 && audio_manager->uplinkLevel(n - 1).half_rate && !ul_adapt_ack_)
+        n--;
+    return static_cast<uint8_t>(n);
+}
 
-    while (started)
+size_t NetworkManager::uplinkTrackSwitch(size_t budget)
+{
+    uint32_t pos = 0;
+    uint8_t level = 0;
+    const uint32_t seq = audio_manager->uplinkSwitch(pos, level);
+    if (seq != ul_switch_seen_)
     {
-        bool is_listening = (StateManager::instance().getInteractionState() == state::InteractionState::LISTENING);
+        ul_switch_seen_ = seq;
+        ul_switch_pending_ = true;
+        ul_switch_pos_ = pos;
+        ul_enc_level_ = level;
+    }
+    if (!ul_switch_pending_)
+        return budget;
 
-        if (!ws_running)
-            break;
+    // Reached (or dropped past by a ring reset): later bytes are at the new level
+    const int32_t ahead = static_cast<int32_t>(ul_switch_pos_ - mic_encoded_rb->readPosition());
+    if (ahead <= 0)
+    {
+        ul_level_ = ul_enc_level_;
+        ul_switch_pending_ = false;
+        return budget;
+    }
+    return std::min(budget, static_cast<size_t>(ahead));
+}
+
+bool NetworkManager::uplinkStoreOpen()
+{
+    if (ul_store_.ready())
+        return true;
+    if (!config_.uplink_store_ram_bytes || !config_.ws_resume_window_ms)
+        return false;
 
-        // Exit when not listening and buffer is empty
-        if (!is_listening && xStreamBufferIsEmpty(mic_encoded_sb) && acc == 0)
+    UtteranceStore::Config sc;
+    sc.ram_bytes = config_.uplink_store_ram_bytes;
+    if (config_.uplink_store_spill_bytes && FlashFs::instance().mounted())
+    {
+        sc.spill_path = UPLINK_SPILL_PATH;
+        sc.spill_max_bytes = config_.uplink_store_spill_bytes;
+    }
+    if (!ul_store_.init(sc))
+    {
+        ESP_LOGE(TAG, "No RAM for the uplink store, turn dropped");
+        return false;
+    }
+    ESP_LOGW(TAG, "Uplink offline: keeping the turn (%u B RAM, %u B flash)",
+             (unsigned)sc.ram_bytes, sc.spill_path ? (unsigned)sc.spill_max_bytes : 0u);
+    return true;
+}
+
+// Task loop sending microphone data to server: one WS binary message per
+// packet = header (AudioPacket.hpp) + whole codec frames
+void NetworkManager::uplinkTaskLoop()
+{
+    const uint32_t frame_ms = std::max<uint32_t>(mic_frame_ms, 1);
+    const size_t frame_bytes = std::max<size_t>(mic_frame_bytes, 1);
+    const size_t max_payload = mic_encoded_rb ? mic_encoded_rb->maxChunk() : 0;
+
+    // Whole codec frames closest to the configured packet duration
+    size_t frames = std::max<size_t>(1, (config_.uplink_packet_ms + frame_ms / 2) / frame_ms);
+    if (!mic_framed)
+        frames = std::max<size_t>(1, std::min(frames, max_payload / frame_bytes));
+    const size_t packet_bytes = mic_framed ? max_payload : frames * frame_bytes;
+
+    const size_t HDR = audio_packet::HEADER_BYTES;
+    if (uplink_pkt_cap < HDR + max_payload)
+    {
+        uplink_pkt_heap.reset();
+        uplink_pkt = static_cast<uint8_t *>(MemArena::instance().claim(MemArena::NET, "uplink_pkt", HDR + max_payload));
+        if (!uplink_pkt)
+        {
+            uplink_pkt_heap.reset(new (std::nothrow) uint8_t[HDR + max_payload]);
+            uplink_pkt = uplink_pkt_heap.get();
+        }
+        uplink_pkt_cap = uplink_pkt ? HDR + max_payload : 0;
+        if (!uplink_pkt)
+            ESP_LOGE(TAG, "No RAM for uplink packet buffer");
+    }
+    ESP_LOGI(TAG, "Uplink: %u frames (%u ms) per packet",
+             (unsigned)frames, (unsigned)(frames * frame_ms));
+
+    // One session per utterance; seq restarts at 0
+    audio_packet::Header hdr;
+    hdr.codec = audio_packet::codecId(audio_manager ? audio_manager->codecName() : "adpcm");
+    hdr.session = ++uplink_session;
+    ESP_LOGI(TAG, "Uplink session %u", (unsigned)hdr.session);
+
+    // Rate control: level, backoff and RTT carry over from the last turn
+    const uint32_t nominal_kbps = audio_manager ? std::max<uint32_t>(audio_manager->uplinkLevel(0).kbps, 1) : 1;
+    ul_rate_.reset(uplinkUsableLevels(), ul_req_level_, static_cast<uint32_t>(esp_timer_get_time() / 1000));
+    uint32_t rtt_seen = ws->rttSamples();
+    int64_t next_probe_us = 0;
+
+    uint32_t dropped_seen = audio_manager ? audio_manager->micDroppedFrames() : 0;
+    bool drained = false;
+    bool last_sent = false;
+
+    // Store-and-forward: valid while this server session lives
+    const uint32_t epoch = ws_session_epoch.load();
+    bool stored_eou = false; // the end of the turn is in the store
+    bool lost = false;       // stored packets were lost: next packet has GAP
+    uint32_t replayed = 0;
+    int64_t replay_start_us = 0;
+    bool cancelled = false;
+
+    while (started && mic_encoded_rb && uplink_pkt)
+    {
+        if (uplink_cancel_.load(std::memory_order_acquire))
+        {
+            cancelled = true;
+            break;
+        }
+        if (ws_session_epoch.load() != epoch)
+        {
+            if (!ul_store_.empty())
+                ESP_LOGW(TAG, "Uplink session %u lost, %u stored packets dropped",
+                         (unsigned)hdr.session, (unsigned)ul_store_.packets());
+            break;
+        }
+        // Dropped inside the resume window, or resume not answered yet
+        const bool online = ws_running && ws->isConnected() &&
+                            ws_dropped_at_us.load() == 0 && ws_resume_deadline_us.load() == 0;
+        if (!online && !uplinkStoreOpen())
             break;
 
-        // Read data, waiting up to 100ms to batch enough bytes (non-busy wait)
-        size_t want = SEND_SIZE - acc;
-        size_t got = xStreamBufferReceive(mic_encoded_sb, send_buf + acc, want, pdMS_TO_TICKS(100));
+        // Replay first, oldest packet first, at line rate; same session,
+        // seq continues, capture timestamps kept
+        if (online && !ul_store_.empty())
+        {
+            if (replayed == 0)
+                replay_start_us = esp_timer_get_time();
+            UtteranceStore::Record rec;
+            if (!ul_store_.peek(rec, uplink_pkt + HDR, uplink_pkt_cap - HDR))
+            {
+                ESP_LOGE(TAG, "Uplink store unreadable, %u packets dropped", (unsigned)ul_store_.packets());
+                ul_store_.clear();
+                lost = true;
+                stored_eou = false;
+                continue;
+            }
+            hdr.flags = rec.flags | (lost ? audio_packet::FLAG_GAP : 0);
+            hdr.kbps = rec.kbps;
+            hdr.timestamp_ms = rec.timestamp_ms;
+            audio_packet::write(uplink_pkt, hdr);
+            if (!ws->sendBinary(uplink_pkt, HDR + rec.len, static_cast<int>(config_.uplink_send_timeout_ms)))
+            {
+                if (ws->isConnected())
+                    vTaskDelay(pdMS_TO_TICKS(frame_ms));
+                continue;
+            }
+            ul_store_.pop();
+            lost = false;
+            hdr.seq++;
+            replayed++;
+            if (ul_store_.empty())
+            {
+                ESP_LOGI(TAG, "Uplink replay: %u packets in %u ms, %u dropped while offline",
+                         (unsigned)replayed, (unsigned)((esp_timer_get_time() - replay_start_us) / 1000),
+                         (unsigned)ul_store_.dropped());
+                replayed = 0; // a later drop in this turn starts a new replay
+            }
+            if (rec.flags & audio_packet::FLAG_EOU)
+            {
+                LatencyTrace::instance().mark(LatencyTrace::UPLINK_EOU);
+                last_sent = true;
+                break;
+            }
+        }
+        // While the store holds packets, new ones queue behind them
+        const bool to_store = !online || !ul_store_.empty();
+
+        const bool is_listening = uplink_listening_.load(std::memory_order_acquire);
+
+        // The current level scales the packet (same duration, fewer bytes)
+        // and the packet stops where the encoder switched level
+        const size_t to_switch = audio_manager ? uplinkTrackSwitch(SIZE_MAX) : SIZE_MAX;
+        const uint32_t kbps = audio_manager ? std::max<uint32_t>(audio_manager->uplinkLevel(ul_level_).kbps, 1) : nominal_kbps;
+        const size_t level_frame_bytes = std::max<size_t>(1, frame_bytes * kbps / nominal_kbps);
+        const size_t level_packet_bytes = mic_framed ? packet_bytes : frames * level_frame_bytes;
+        const size_t budget = std::min(level_packet_bytes, to_switch);
+        const bool cut = budget < level_packet_bytes;
+
+        // Replay pending: do not wait for the ring
+        const TickType_t wait = online && to_store ? 0 : pdMS_TO_TICKS(100);
+        size_t len = 0;
+        if (mic_framed)
+        {
+            size_t records = 0;
+            len = collectFramedRecords(budget, frames, records, wait);
+            if (is_listening && len > 0 && records < frames && !cut)
+            {
+                // Packet not full yet while capture runs
+                if (!(online && to_store))
+                    vTaskDelay(pdMS_TO_TICKS(frame_ms));
+                continue;
+            }
+        }
+        else if (mic_encoded_rb->acquireRead(budget, wait))
+        {
+            len = budget;
+        }
+        else if (!is_listening)
+        {
+            // Tail shorter than one packet once capture stopped (no padding)
+            len = std::min(mic_encoded_rb->available(), budget);
+            if (len > 0 && !mic_encoded_rb->acquireRead(len, 0))
+                len = 0;
+        }
 
-        if (got > 0)
+        if (len == 0)
         {
-            acc += got;
+            if (is_listening || (online && to_store))
+                continue;
+            if (online)
+            {
+                drained = true;
+                break;
+            }
+            // Offline, turn captured: its end goes in the store (a full
+            // store leaves it to the drained path), then wait for the resume
+            // or the end of the window
+            if (!stored_eou)
+            {
+                UtteranceStore::Record rec;
+                rec.flags = audio_packet::FLAG_EOU;
+                rec.timestamp_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+                ul_store_.push(rec, nullptr);
+                stored_eou = true;
+            }
+            vTaskDelay(pdMS_TO_TICKS(frame_ms));
+            continue;
         }
 
-        // Send immediately when 512 bytes are ready
-        if (acc == SEND_SIZE)
+        // The view granted above is still valid; re-acquiring is free
+        const uint8_t *payload = mic_encoded_rb->acquireRead(len, 0);
+        const size_t backlog = mic_encoded_rb->available();
+        const bool last = !is_listening && backlog == len;
+
+        hdr.flags = last ? audio_packet::FLAG_EOU : 0;
+        hdr.kbps = static_cast<uint8_t>(std::min<uint32_t>(kbps, 0xFF));
+        const uint32_t dropped = audio_manager ? audio_manager->micDroppedFrames() : dropped_seen;
+        if (dropped != dropped_seen || lost)
+            hdr.flags |= audio_packet::FLAG_GAP;
+
+        // First payload sample was captured `backlog` worth of audio ago
+        const int64_t send_start_us = esp_timer_get_time();
+        const uint32_t now_ms = static_cast<uint32_t>(send_start_us / 1000);
+        hdr.timestamp_ms = now_ms - static_cast<uint32_t>(backlog * frame_ms / level_frame_bytes);
+
+        if (to_store)
         {
-            ws->sendBinary(send_buf, SEND_SIZE);
-            acc = 0;
-            // Không vTaskDelay ở đây để có thể gửi liên tiếp nếu buffer đang đầy
+            // A full store drops the packet; the next one stored carries GAP
+            UtteranceStore::Record rec;
+            rec.len = static_cast<uint16_t>(len);
+            rec.flags = hdr.flags | (ul_store_.gapPending() ? audio_packet::FLAG_GAP : 0);
+            rec.kbps = hdr.kbps;
+            rec.timestamp_ms = hdr.timestamp_ms;
+            if (ul_store_.push(rec, payload))
+            {
+                lost = false;
+                stored_eou = last;
+            }
+            dropped_seen = dropped;
+            mic_encoded_rb->release(len);
+            continue;
         }
 
-        // Flush remaining buffer once capture stops
-        if (!is_listening && acc > 0 && xStreamBufferIsEmpty(mic_encoded_sb))
+        bool sent;
         {
-            memset(send_buf + acc, 0, SEND_SIZE - acc);
-            ws->sendBinary(send_buf, SEND_SIZE);
+            PTALK_PROF_SCOPE(UPLINK_SEND);
+            audio_packet::write(uplink_pkt, hdr);
+            memcpy(uplink_pkt + HDR, payload, len);
+            sent = ws->sendBinary(uplink_pkt, HDR + len,
+                                  static_cast<int>(config_.uplink_send_timeout_ms));
+        }
+
+        // Congestion signals: send time, audio still queued, ping RTT
+        const int64_t sent_us = esp_timer_get_time();
+        if (sent_us >= next_probe_us)
+        {
+            ws->sendPing();
+            next_probe_us = sent_us + static_cast<int64_t>(config_.uplink_rtt_probe_ms) * 1000;
+        }
+        const uint32_t rtt_n = ws->rttSamples();
+        if (rtt_n != rtt_seen)
+        {
+            rtt_seen = rtt_n;
+            ul_rate_.onRtt(ws->rttMs());
+        }
+        const size_t queued = sent ? backlog - len : backlog;
+        const uint8_t want = ul_rate_.onPacket(static_cast<uint32_t>(sent_us / 1000), sent,
+                                               static_cast<uint32_t>((sent_us - send_start_us) / 1000),
+                                               static_cast<uint32_t>(queued * 8 / kbps));
+        // One switch in flight at a time: the next waits for the encoder
+        if (audio_manager && want != ul_req_level_ && ul_enc_level_ == ul_req_level_)
+        {
+            ESP_LOGI(TAG, "Uplink %s: level %u -> %u (%u kbps, queued %u B, rtt %u ms)",
+                     want > ul_req_level_ ? "congested" : "recovered", (unsigned)ul_req_level_, (unsigned)want,
+                     (unsigned)audio_manager->uplinkLevel(want).kbps, (unsigned)queued, (unsigned)ul_rate_.srttMs());
+            ul_req_level_ = want;
+            audio_manager->requestUplinkLevel(want);
+        }
+        ul_kbps_ = static_cast<uint16_t>(kbps);
+
+        if (!sent)
+        {
+            // Dropped: the packet stays in the ring and goes to the store
+            if (!ws->isConnected())
+                continue;
+            // Congested: the packet stays queued in the ring, retry next frame
+            vTaskDelay(pdMS_TO_TICKS(frame_ms));
+            continue;
+        }
+
+        if (hdr.flags & audio_packet::FLAG_GAP)
+        {
+            ESP_LOGW(TAG, "Uplink backpressure: %u frames dropped before seq %u",
+                     (unsigned)(dropped - dropped_seen), (unsigned)hdr.seq);
+            dropped_seen = dropped;
+        }
+        mic_encoded_rb->release(len);
+        LatencyTrace::instance().mark(last ? LatencyTrace::UPLINK_EOU : LatencyTrace::UPLINK_SEND);
+        lost = false;
+        hdr.seq++;
+        last_sent = last;
+        if (last)
             break;
+        // Không vTaskDelay ở đây để có thể gửi liên tiếp nếu buffer đang đầy
+    }
+
+    // Cancelled on the device: FLAG_CANCEL (with EOU, the turn is over)
+    // tells the server to drop the utterance, even one already ended by EOU
+    cancelled = cancelled || uplink_cancel_.exchange(false);
+    if (cancelled && uplink_pkt)
+    {
+        if (ws->isConnected() && ws_dropped_at_us.load() == 0 && ws_session_epoch.load() == epoch)
+        {
+            hdr.flags = audio_packet::FLAG_EOU | audio_packet::FLAG_CANCEL;
+            hdr.timestamp_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+            audio_packet::write(uplink_pkt, hdr);
+            ws->sendBinary(uplink_pkt, HDR, static_cast<int>(config_.uplink_send_timeout_ms));
         }
+        ESP_LOGI(TAG, "Uplink session %u cancelled on the device (%u stored packets dropped)",
+                 (unsigned)hdr.session, (unsigned)ul_store_.packets());
+    }
+    // Tail ended on a packet boundary: a header-only packet marks the end
+    else if (drained && !last_sent && ws->isConnected())
+    {
+        hdr.flags = audio_packet::FLAG_EOU;
+        hdr.timestamp_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+        audio_packet::write(uplink_pkt, hdr);
+        if (ws->sendBinary(uplink_pkt, HDR,
+                           static_cast<int>(config_.uplink_send_timeout_ms)))
+            LatencyTrace::instance().mark(LatencyTrace::UPLINK_EOU);
     }
+
     // 4. Dọn dẹp an toàn
-    if (mic_encoded_sb)
+    if (mic_encoded_rb)
     {
-        xStreamBufferReset(mic_encoded_sb);
+        mic_encoded_rb->reset();
     }
+    ul_store_.deinit(); // RAM back, spill file deleted
     uplink_task_handle = nullptr;
     ESP_LOGW(TAG, "Uplink task deleted");
+    MemTelemetry::instance().unregisterTask();
     vTaskDelete(nullptr);
 }
 
@@ -672,6 +1446,7 @@ void NetworkManager::uplinkTaskEntry(void *arg)
     auto *self = static_cast<NetworkManager *>(arg);
     if (self)
     {
+        MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::NET_UPLINK));
         self->uplinkTaskLoop(); // Run loop (non-static)
     }
 }
@@ -686,20 +1461,30 @@ void NetworkManager::publishState(state::ConnectivityState s)
 
 void NetworkManager::handleInteractionState(state::InteractionState s)
 {
-    if (s == state::InteractionState::LISTENING)
+    voice_active_ = s == state::InteractionState::TRIGGERED ||
+                    s == state::InteractionState::LISTENING ||
+                    s == state::InteractionState::PROCESSING ||
+                    s == state::InteractionState::SPEAKING;
+    updateRadioProfile();
+
+    const bool listening = s == state::InteractionState::LISTENING;
+    // Turn cancelled on the device (local voice command): the uplink task
+    // drops what is left and tells the server to forget the utterance
+    if (s == state::InteractionState::CANCELLING && uplink_task_handle)
+        uplink_cancel_.store(true, std::memory_order_release);
+    else if (listening)
+        uplink_cancel_.store(false, std::memory_order_release);
+    if (uplink_listening_.exchange(listening) && !listening && mic_encoded_rb)
+        mic_encoded_rb->interruptReader(); // flush the tail now, not after the 100 ms wait
+
+    if (listening)
     {
         if (uplink_task_handle == nullptr)
         {
             ESP_LOGI(TAG, "Starting Uplink Task (State: LISTENING)");
-            xTaskCreatePinnedToCore(
-                &NetworkManager::uplinkTaskEntry,
-                "WsUplink",
-                4096,
-                this,
-                5,
-                &uplink_task_handle,
-                1 // Core 0
-            );
+            // Socket sends run on core 0 with lwIP, off the audio core
+            TaskPlan::instance().spawn(TaskPlan::NET_UPLINK, &NetworkManager::uplinkTaskEntry, this,
+                                       &uplink_task_handle);
         }
     }
     else
@@ -709,6 +1494,18 @@ void NetworkManager::handleInteractionState(state::InteractionState s)
     }
 }
 
+void NetworkManager::updateRadioProfile()
+{
+    const bool busy = voice_active_ || firmware_download_active;
+    radio_pm_.hold(busy);
+    if (wifi)
+    {
+        // Idle depth follows the link: deep on a strong one, off on a failing one
+        wifi->setPowerSave(config_.wifi_modem_sleep_idle && !busy ? idlePowerSave(link_.sleep()) : WIFI_PS_NONE);
+        wifi->pauseScanRefresh(busy);
+    }
+}
+
 // ============================================================================
 // OTA CHUNK PROTOCOL ACK/NACK
 // ============================================================================
@@ -720,17 +1517,17 @@ void NetworkManager::sendOtaAck(uint32_t seq)
         return;
     }
 
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddNumberToObject(root, "ota_ack", seq);
-    char *json_str = cJSON_PrintUnformatted(root);
+    char buf[64];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    w.beginObject()
+        .field("ota_ack", seq)
+        .field("base", ota_expected_seq) // all chunks below are received
+        .endObject();
 
-    mqtt->publish(mqtt_base_topic + "/ota_ack", json_str, 1, false);
-
-    cJSON_free(json_str);
-    cJSON_Delete(root);
+    mqtt->publish(topic_ota_ack, w.view(), 1, false);
 }
 
-void NetworkManager::sendOtaNack(uint32_t seq)
+void NetworkManager::sendOtaNack(uint32_t seq, bool busy)
 {
     if (!mqtt || !mqtt->isConnected())
     {
@@ -738,50 +1535,73 @@ void NetworkManager::sendOtaNack(uint32_t seq)
         return;
     }
 
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddNumberToObject(root, "ota_nack", seq);
-    cJSON_AddNumberToObject(root, "expected_seq", ota_expected_seq);
-    char *json_str = cJSON_PrintUnformatted(root);
-
-    mqtt->publish(mqtt_base_topic + "/ota_ack", json_str, 1, false);
+    char buf[96];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    w.beginObject()
+        .field("ota_nack", seq)
+        .field("expected_seq", ota_expected_seq);
+    if (busy)
+        w.field("busy", true); // not an error: resend later
+    w.endObject();
 
-    ESP_LOGW(TAG, "Sent NACK for chunk %u (expected %u)", seq, ota_expected_seq);
+    mqtt->publish(topic_ota_ack, w.view(), 1, false);
 
-    cJSON_free(json_str);
-    cJSON_Delete(root);
+    ESP_LOGW(TAG, "Sent NACK for chunk %u (expected %u%s)", seq, ota_expected_seq, busy ? ", busy" : "");
 }
 
 void NetworkManager::setupMqtt()
 {
     mqtt->setUri(config_.mqtt_url);
-    mqtt->setClientId("PTalk_" + getDeviceEfuseID());
+    mqtt->setClientId("PTalk_" + getDeviceEfuseID()); // stable: persistent session
+    mqtt->setKeepalive(config_.mqtt_keepalive_s);
+    mqtt->setPersistentSession(config_.mqtt_persistent_session);
+    mqtt->setOutboxLimit(config_.mqtt_outbox_limit_bytes);
 
     mqtt->onConnected([this]()
                       {
-        ESP_LOGI(TAG, "MQTT Connected - subscribing to topics");
-        
-        // Subscribe to command topic
-        mqtt->subscribe(mqtt_base_topic + "/cmd", 1);
-        
-        // Subscribe to OTA data topic (binary chunks)
-        mqtt->subscribe(mqtt_base_topic + "/ota_data", 1);
-        
-        // Subscribe to OTA ACK topic (optional - for server confirmation)
-        mqtt->subscribe(mqtt_base_topic + "/ota_ack", 0);
-        
+        // A (re)connected server may not know msgpack: start from JSON
+        mqtt_format = jsonlite::Format::JSON;
+
+        // Resumed session: the broker still has our subscriptions
+        if (!mqtt->sessionPresent())
+        {
+            ESP_LOGI(TAG, "MQTT Connected - subscribing to topics");
+
+            // Subscribe to command topic
+            mqtt->subscribe(topic_cmd, 1);
+
+            // Subscribe to OTA data topic (binary chunks)
+            mqtt->subscribe(topic_ota_data, 1);
+
+            // Subscribe to OTA ACK topic (optional - for server confirmation)
+            mqtt->subscribe(topic_ota_ack, 0);
+        }
+        else
+        {
+            ESP_LOGI(TAG, "MQTT Connected - session resumed");
+        }
+
+        EventLog::instance().record(EventLog::Type::MQTT_UP, mqtt->sessionPresent() ? 1 : 0);
+
+        // Telemetry restarts from a keyframe
+        telemetry_.forceKeyframe();
+        tele_report_elapsed_ms = 0;
+
         // Send device handshake on connect
-        sendDeviceHandshake(); });
+        sendDeviceHandshake();
+        // periodic status starts counting
+        wakeLoop(); });
 
-    mqtt->onMessage([this](const std::string &topic, const std::string &payload)
+    mqtt->onMessage([this](std::string_view topic, std::string_view payload)
                     {
-                        ESP_LOGD(TAG, "MQTT message: %s (%zu bytes)", topic.c_str(), payload.size());
+                        ESP_LOGD(TAG, "MQTT message: %.*s (%zu bytes)", (int)topic.size(), topic.data(), payload.size());
 
-                        if (topic == mqtt_base_topic + "/cmd")
+                        if (topic == topic_cmd)
                         {
-                            // JSON config commands
+                            // Config commands (JSON or MessagePack)
                             handleConfigCommand(payload);
                         }
-                        else if (topic == mqtt_base_topic + "/ota_data")
+                        else if (topic == topic_ota_data)
                         {
                             // Binary OTA chunks
                             handleOtaBinaryChunk((const uint8_t *)payload.data(), payload.size());
@@ -799,11 +1619,297 @@ void NetworkManager::setupMqtt()
 void NetworkManager::publishMqttStatus()
 {
     // Gửi heartbeat/status định kỳ hoặc khi có thay đổi
-    std::string status_json = getCurrentStatusJson();
-    mqtt->publish(mqtt_base_topic + "/status", status_json, 1, true);
+    char buf[STATUS_JSON_MAX];
+    size_t n = writeStatusJson(buf, sizeof(buf), mqttFormat());
+    if (n)
+        mqtt->publish(topic_status, std::string_view(buf, n), 1, true);
+}
+
+void NetworkManager::updateTelemetry(uint32_t dt_ms)
+{
+    if (!config_.telemetry_sample_ms || !config_.telemetry_report_ms)
+        return;
+
+    tele_sample_elapsed_ms += dt_ms;
+    if (tele_sample_elapsed_ms >= config_.telemetry_sample_ms)
+    {
+        tele_sample_elapsed_ms = 0;
+        TelemetryAggregator::Sample s;
+        s.heap_free = esp_get_free_heap_size();
+        s.rssi = wifi ? wifi->getRssi() : 0;
+        s.battery = power_manager ? power_manager->getPercent() : 0;
+        s.slo = AudioHealth::instance().breachMask();
+        s.rtt_ms = link_.rttMs();
+        s.link = static_cast<uint8_t>(link_.quality());
+        s.roams = link_.roams();
+        telemetry_.addSample(s);
+    }
+
+    if (!mqtt || !mqtt->isConnected())
+        return;
+    tele_report_elapsed_ms += dt_ms;
+    if (tele_report_elapsed_ms < config_.telemetry_report_ms)
+        return;
+    tele_report_elapsed_ms = 0;
+
+    char buf[JSON_SMALL_MAX * 2];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    const uint32_t uptime_s = static_cast<uint32_t>(esp_timer_get_time() / 1000000ULL);
+    if (telemetry_.build(w, mqtt->droppedCount(), uptime_s))
+        mqtt->publish(topic_telemetry, w.view(), 0, false);
+}
+
+void NetworkManager::updateEventLog(uint32_t dt_ms)
+{
+    EventLog &log = EventLog::instance();
+
+    // I2S glitches: one record per kind and window carries the count
+    evlog_glitch_elapsed_ms += dt_ms;
+    if (audio_manager && evlog_glitch_elapsed_ms >= EVLOG_GLITCH_MS)
+    {
+        evlog_glitch_elapsed_ms = 0;
+        const AudioManager::GlitchStats g = audio_manager->glitchStats();
+        if (g.spk_underruns != evlog_spk_underruns)
+            log.record(EventLog::Type::SPK_UNDERRUN, 0, g.spk_underruns - evlog_spk_underruns);
+        if (g.mic_overruns != evlog_mic_overruns)
+            log.record(EventLog::Type::MIC_OVERRUN, 0, g.mic_overruns - evlog_mic_overruns);
+        evlog_spk_underruns = g.spk_underruns;
+        evlog_mic_overruns = g.mic_overruns;
+
+        AudioHealth::Transition trans[AudioHealth::SLO_COUNT];
+        const size_t n = AudioHealth::instance().evaluate(trans, AudioHealth::SLO_COUNT);
+        for (size_t i = 0; i < n; i++)
+        {
+            const AudioHealth::Transition &t = trans[i];
+            log.record(t.breached ? EventLog::Type::AUDIO_SLO : EventLog::Type::AUDIO_OK,
+                       static_cast<uint8_t>(t.slo | t.stage << 4), t.value);
+        }
+    }
+
+    // Flash writes stall both cores' cache: never in the middle of a turn
+    if (voice_active_)
+        return;
+    log.flushIfDue();
+
+    // Incremental upload: everything flashed since the last acked batch
+    if (!mqtt || !mqtt->isConnected())
+        return;
+    uint8_t buf[EventLog::HEADER_BYTES + EVLOG_UPLOAD_BATCH * sizeof(EventLog::Record)];
+    uint32_t last_seq = 0;
+    for (int i = 0; i < 4 && log.hasUnsent(); i++)
+    {
+        const size_t n = log.readUnsent(buf, sizeof(buf), last_seq);
+        if (!n || !mqtt->publish(topic_events, std::string_view(reinterpret_cast<const char *>(buf), n), 1, false))
+            break; // outbox full / link gone: retried on a later pass
+        log.commitSent(last_seq);
+    }
+}
+
+void NetworkManager::updateMedia()
+{
+    if (!mqtt || !mqtt->isConnected())
+        return; // kept until the next connected pass
+    uint32_t pos_ms = 0;
+    const MediaPlayer::End end = MediaPlayer::instance().takeEnd(pos_ms);
+    if (end == MediaPlayer::End::NONE)
+        return;
+    char buf[JSON_SMALL_MAX];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    w.beginObject().field("event", MediaPlayer::endName(end)).field("pos_ms", pos_ms).endObject();
+    mqtt->publish(topic_media, w.view(), 1, false);
+}
+
+void NetworkManager::updateLink(uint32_t dt_ms)
+{
+    if (!config_.link_sample_ms || !wifi || !wifi_ready)
+        return;
+    link_elapsed_ms += dt_ms;
+    const bool forced = link_roam_req_.exchange(false);
+    if (link_elapsed_ms < config_.link_sample_ms && !forced)
+        return;
+    link_elapsed_ms = 0;
+
+    const uint32_t now_ms = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    const bool busy = voice_active_ || firmware_download_active;
+
+    LinkQualityMonitor::Sample s;
+    s.rssi = wifi->getRssi();
+    const bool ws_up = ws && ws->isConnected();
+    if (ws_up)
+    {
+        // Any round trip counts (the uplink task probes during a turn);
+        // loss only for our own probe from the previous sample, and only
+        // once the server has shown it echoes PING
+        const uint32_t n = ws->rttSamples();
+        if (n != link_rtt_seen)
+            s.rtt_ms = ws->rttMs();
+        s.probed = link_ping_out && ws->pongSeen();
+        s.answered = n != link_rtt_seen;
+        link_rtt_seen = n;
+    }
+    link_ping_out = ws_up && !busy && ws->sendPing();
+
+    const LinkQualityMonitor::Quality prev = link_.quality();
+    const LinkQualityMonitor::Quality q = link_.onSample(s);
+    if (q != prev)
+    {
+        ESP_LOGI(TAG, "Link %s -> %s (rssi %d dBm, rtt %u ms, loss %u%%)", LinkQualityMonitor::qualityName(prev),
+                 LinkQualityMonitor::qualityName(q), link_.rssi(), (unsigned)link_.rttMs(), (unsigned)link_.lossPct());
+        // First verdict after a connect only when it is bad news
+        if (prev != LinkQualityMonitor::Quality::UNKNOWN || q == LinkQualityMonitor::Quality::POOR)
+            EventLog::instance().record(EventLog::Type::LINK, static_cast<uint8_t>(q),
+                                        linkEventValue(link_.rssi(), link_.rttMs()));
+        updateRadioProfile();
+    }
+
+    // Roaming drops the connection for a moment: between turns only
+    if (!config_.wifi_roam || busy)
+        return;
+    if (link_roam_scan)
+    {
+        if (wifi->isScanning())
+            return;
+        link_roam_scan = false;
+        roamIfBetter();
+        return;
+    }
+    if (!forced && !link_.wantRoam(now_ms))
+        return;
+
+    link_.onRoamAttempt(now_ms);
+    ESP_LOGI(TAG, "Link weak (%d dBm): looking for a better AP", link_.rssi());
+    // 802.11v first; if the AP left us where we were, scan next time
+    if (!link_btm_last && wifi->requestBssTransition())
+    {
+        link_btm_last = true;
+        link_.onRoamed();
+        EventLog::instance().record(EventLog::Type::ROAM, 1, linkEventValue(link_.rssi(), 0));
+        return;
+    }
+    link_btm_last = false;
+    if (wifi->scanAgeMs() > LINK_ROAM_SCAN_AGE_MS && wifi->startScan())
+    {
+        link_roam_scan = true; // read back at the next sample
+        return;
+    }
+    roamIfBetter();
+}
+
+void NetworkManager::roamIfBetter()
+{
+    const int8_t from = link_.rssi();
+    WifiService::ScanEntry ap;
+    if (!wifi->findRoamCandidate(link_.roamTargetRssi(), LINK_ROAM_SCAN_AGE_MS, ap))
+    {
+        ESP_LOGI(TAG, "Roam: no AP of this SSID at %d dBm or better", link_.roamTargetRssi());
+        return;
+    }
+    if (!wifi->roamTo(ap))
+        return;
+    link_.onRoamed();
+    EventLog::instance().record(EventLog::Type::ROAM, 0, linkEventValue(from, static_cast<uint8_t>(ap.rssi)));
 }
 
-void NetworkManager::onFirmwareChunk(std::function<void(const uint8_t *, size_t)> cb)
+void NetworkManager::printLink() const
+{
+    if (!config_.link_sample_ms)
+    {
+        ESP_LOGI(TAG, "Link monitor off");
+        return;
+    }
+    ESP_LOGI(TAG, "Link %s: rssi %d dBm (now %d), rtt %u ms, ping loss %u%%",
+             LinkQualityMonitor::qualityName(link_.quality()), link_.rssi(), wifi ? wifi->getRssi() : 0,
+             (unsigned)link_.rttMs(), (unsigned)link_.lossPct());
+    ESP_LOGI(TAG, "Modem sleep %s (idle: %s), roam %s: %u search(es), %u move(s)",
+             wifi && wifi->powerSave() == WIFI_PS_MAX_MODEM  ? "max"
+             : wifi && wifi->powerSave() == WIFI_PS_MIN_MODEM ? "min"
+                                                              : "off",
+             LinkQualityMonitor::sleepName(link_.sleep()), config_.wifi_roam ? "on" : "off",
+             (unsigned)link_.roamAttempts(), (unsigned)link_.roams());
+}
+
+// {"status":"ok","device_id":...,"mem":{heap, dma, tasks, rings}} on /status
+void NetworkManager::publishMemReport()
+{
+    std::unique_ptr<char[]> buf(new (std::nothrow) char[MEM_REPORT_MAX]);
+    if (!buf)
+    {
+        ESP_LOGE(TAG, "No RAM for memory report");
+        publishStatusReply("error", "no_memory");
+        return;
+    }
+
+    MemTelemetry::instance().sample(); // fresh numbers for an explicit request
+    jsonlite::Writer w(buf.get(), MEM_REPORT_MAX, mqttFormat());
+    w.beginObject().field("status", "ok").field("device_id", device_id.c_str());
+    MemTelemetry::instance().writeReport(w);
+    w.endObject();
+
+    if (!w.ok())
+    {
+        ESP_LOGE(TAG, "Memory report does not fit %u B", (unsigned)MEM_REPORT_MAX);
+        return;
+    }
+    mqtt->publish(topic_status, w.view(), 1, false);
+}
+
+// {"status":"ok","device_id":...,"cpu":{cores, tasks, probes}} on /status
+void NetworkManager::publishCpuReport()
+{
+    std::unique_ptr<char[]> buf(new (std::nothrow) char[CPU_REPORT_MAX]);
+    if (!buf)
+    {
+        ESP_LOGE(TAG, "No RAM for CPU report");
+        publishStatusReply("error", "no_memory");
+        return;
+    }
+
+    // Load over the window since the previous request (or since boot)
+    Profiler::instance().sampleTasks();
+    jsonlite::Writer w(buf.get(), CPU_REPORT_MAX, mqttFormat());
+    w.beginObject().field("status", "ok").field("device_id", device_id.c_str());
+    Profiler::instance().writeReport(w);
+    if (audio_manager)
+    {
+        // I2S DMA glitches since boot (see AudioManager::glitchStats())
+        const AudioManager::GlitchStats g = audio_manager->glitchStats();
+        w.beginObject("glitch")
+            .field("spk_underrun", g.spk_underruns)
+            .field("mic_overrun", g.mic_overruns)
+            .field("spk_dma_underflow", g.spk_dma_underflows)
+            .field("mic_dma_overflow", g.mic_dma_overflows)
+            .field("spk_dma", dmaPresetName(g.spk_dma))
+            .field("mic_dma", dmaPresetName(g.mic_dma))
+            .endObject();
+        // Downlink loss since boot: packets missing, frames concealed / rebuilt
+        w.beginObject("downlink")
+            .field("lost", audio_manager->downlinkLostPackets())
+            .field("concealed", audio_manager->downlinkConcealedFrames())
+            .field("fec", audio_manager->downlinkFecFrames())
+            .field("jitter_ms", audio_manager->downlinkJitterMs())
+            .endObject();
+        // Uplink rate control: bitrate of the last packet, steps since boot
+        w.beginObject("uplink")
+            .field("kbps", static_cast<uint32_t>(ul_kbps_.load()))
+            .field("levels", static_cast<uint32_t>(uplinkUsableLevels()))
+            .field("steps_down", ul_rate_.stepsDown())
+            .field("steps_up", ul_rate_.stepsUp())
+            .field("rtt_ms", ws ? ws->rttMs() : 0u)
+            .endObject();
+        // Per-stage health and SLO state (see AudioHealth)
+        AudioHealth::instance().writeReport(w);
+    }
+    w.endObject();
+
+    if (!w.ok())
+    {
+        ESP_LOGE(TAG, "CPU report does not fit %u B", (unsigned)CPU_REPORT_MAX);
+        return;
+    }
+    mqtt->publish(topic_status, w.view(), 1, false);
+}
+
+void NetworkManager::onFirmwareChunk(std::function<OtaChunkStatus(uint32_t, const uint8_t *, size_t)> cb)
 {
     on_firmware_chunk_cb = cb;
 }
@@ -879,12 +1985,14 @@ void NetworkManager::retryWifiThenPortal()
         wifi->disconnect();
         vTaskDelay(pdMS_TO_TICKS(100)); // Brief delay to ensure WiFi is stopped
 
-        // Start STA mode and scan
-        wifi->ensureStaStarted();
-        vTaskDelay(pdMS_TO_TICKS(100)); // Brief delay before scanning
-
-        // Scan and cache networks before opening portal
-        wifi->scanAndCache();
+        // Networks for the portal page: the background cache when fresh,
+        // else one short scan
+        if (wifi->scanAgeMs() > SCAN_FRESH_MS)
+        {
+            wifi->ensureStaStarted();
+            vTaskDelay(pdMS_TO_TICKS(100)); // Brief delay before scanning
+            wifi->refreshScan(SCAN_FRESH_MS, SCAN_WAIT_MS);
+        }
 
         // Open portal with stop_wifi_first=true to ensure clean state
         wifi->startCaptivePortal(config_.ap_ssid, config_.ap_max_clients, true);
@@ -927,14 +2035,19 @@ void NetworkManager::retryWifiThenBLE()
         vTaskDelay(pdMS_TO_TICKS(500)); // Wait for disconnect to complete
     }
 
-    // 2. Start STA and scan networks (no longer connecting, so scan will work)
+    // 2. Networks for BLE: the background cache when fresh, else start STA
+    //    and scan once (no longer connecting, so scan will work)
     if (wifi)
     {
-        wifi->ensureStaStarted();
-        vTaskDelay(pdMS_TO_TICKS(500)); // Wait for STA to be ready
-
-        cached_networks = wifi->scanNetworks();
-        ESP_LOGI(TAG, "Scanned and cached %d networks before BLE mode", cached_networks.size());
+        if (wifi->scanAgeMs() > SCAN_FRESH_MS)
+        {
+            wifi->ensureStaStarted();
+            vTaskDelay(pdMS_TO_TICKS(100)); // Wait for STA to be ready
+            wifi->refreshScan(SCAN_FRESH_MS, SCAN_WAIT_MS);
+        }
+        cached_networks = wifi->getCachedNetworks();
+        ESP_LOGI(TAG, "%u cached networks for BLE mode (scan age %u ms)", (unsigned)cached_networks.size(),
+                 (unsigned)wifi->scanAgeMs());
     }
 
     // 3. Now STOP WiFi completely to free RF for BLE
@@ -969,16 +2082,23 @@ void NetworkManager::startBLEConfigMode()
 
         // Prepare current device configuration to restore in BLE
         BluetoothService::ConfigData current_cfg;
-        current_cfg.device_name = nmgr_load_str("device_name", "PTalk");
-        current_cfg.volume = nmgr_load_u8("volume", 60);
-        current_cfg.brightness = nmgr_load_u8("brightness", 100);
-        current_cfg.ws_url = nmgr_load_str("ws_url", "");
+        const ConfigStore &store = ConfigStore::instance();
+        current_cfg.device_name = store.getString(ConfigStore::Key::DEVICE_NAME);
+        current_cfg.volume = store.getU8(ConfigStore::Key::VOLUME);
+        current_cfg.brightness = store.getU8(ConfigStore::Key::BRIGHTNESS);
+        current_cfg.ws_url = store.getString(ConfigStore::Key::WS_URL);
 
         ble_service->init(config_.ap_ssid, cached_networks, &current_cfg);
         ble_service->start();
     }
 }
 
+void NetworkManager::stopBLEConfigMode()
+{
+    if (ble_service)
+        ble_service->shutdown();
+}
+
 // Static task entry for deferred BLE config
 void NetworkManager::bleConfigTaskEntry(void *arg)
 {
@@ -1003,13 +2123,7 @@ void NetworkManager::openBLEConfigMode()
         return;
     }
 
-    xTaskCreate(
-        &NetworkManager::bleConfigTaskEntry,
-        "BLEConfig",
-        6144,
-        this,
-        5,
-        &ble_config_task);
+    TaskPlan::instance().spawn(TaskPlan::BLE_CONFIG, &NetworkManager::bleConfigTaskEntry, this, &ble_config_task);
 }
 
 void NetworkManager::openBLEConfigModeDeferred()
@@ -1022,6 +2136,7 @@ void NetworkManager::openBLEConfigModeDeferred()
     started = false; // Signal network loop task to exit gracefully
     ws_should_run = false;
     ws_running = false;
+    wakeLoop();
 
     // Wait for network loop task to exit gracefully (started=false signals it)
     // Task will set task_handle = nullptr before self-deleting
@@ -1051,6 +2166,7 @@ void NetworkManager::openBLEConfigModeDeferred()
         ESP_LOGI(TAG, "Force deleting network task...");
         TaskHandle_t th = task_handle;
         task_handle = nullptr;
+        MemTelemetry::instance().unregisterTask(th);
         vTaskDelete(th);
         vTaskDelay(pdMS_TO_TICKS(100));
     }
@@ -1068,14 +2184,19 @@ void NetworkManager::openBLEConfigModeDeferred()
         vTaskDelay(pdMS_TO_TICKS(500)); // Wait for disconnect to complete
     }
 
-    // 2. Start STA and scan networks (no longer connecting, so scan will work)
+    // 2. Networks for BLE: the background cache when fresh, else start STA
+    //    and scan once (no longer connecting, so scan will work)
     if (wifi)
     {
-        wifi->ensureStaStarted();
-        vTaskDelay(pdMS_TO_TICKS(500)); // Wait for STA to be ready
-
-        cached_networks = wifi->scanNetworks();
-        ESP_LOGI(TAG, "Scanned and cached %d networks before BLE mode", cached_networks.size());
+        if (wifi->scanAgeMs() > SCAN_FRESH_MS)
+        {
+            wifi->ensureStaStarted();
+            vTaskDelay(pdMS_TO_TICKS(100)); // Wait for STA to be ready
+            wifi->refreshScan(SCAN_FRESH_MS, SCAN_WAIT_MS);
+        }
+        cached_networks = wifi->getCachedNetworks();
+        ESP_LOGI(TAG, "%u cached networks for BLE mode (scan age %u ms)", (unsigned)cached_networks.size(),
+                 (unsigned)wifi->scanAgeMs());
     }
 
     // 3. Now STOP WiFi completely to free RF for BLE
@@ -1103,85 +2224,43 @@ void NetworkManager::openBLEConfigModeDeferred()
 // ============================================================================
 // EMOTION CODE PARSING
 // ============================================================================
-state::EmotionState NetworkManager::parseEmotionCode(const std::string &code)
+namespace
 {
-    // Map WebSocket emotion codes to EmotionState
-    // Format expected: "01", "11", etc. (2-char codes)
-
-    if (code == "00" || code.empty())
-    {
+    struct EmotionCode
+    {
+        std::string_view code;
+        state::EmotionState state;
+    };
+
+    // WebSocket emotion codes ("01", "11"... 2-char) -> EmotionState
+    constexpr EmotionCode EMOTION_CODES[] = {
+        {"00", state::EmotionState::NEUTRAL},
+        {"01", state::EmotionState::HAPPY},    // Happy, cheerful
+        {"02", state::EmotionState::ANGRY},    // Angry, urgent
+        {"03", state::EmotionState::EXCITED},  // Excited, enthusiastic
+        {"10", state::EmotionState::SAD},      // Sad, empathetic
+        {"12", state::EmotionState::CONFUSED}, // Confused, uncertain
+        {"13", state::EmotionState::CALM},     // Calm, soothing
+        {"99", state::EmotionState::THINKING}, // Thinking, processing
+    };
+} // namespace
+
+state::EmotionState NetworkManager::parseEmotionCode(std::string_view code)
+{
+    if (code.empty())
         return state::EmotionState::NEUTRAL;
-    }
-    if (code == "01")
-    {
-        return state::EmotionState::HAPPY; // Happy, cheerful
-    }
-    if (code == "02")
-    {
-        return state::EmotionState::ANGRY; // Angry, urgent
-    }
-    if (code == "03")
-    {
-        return state::EmotionState::EXCITED; // Excited, enthusiastic
-    }
-    if (code == "10")
-    {
-        return state::EmotionState::SAD; // Sad, empathetic
-    }
-    if (code == "12")
-    {
-        return state::EmotionState::CONFUSED; // Confused, uncertain
-    }
-    if (code == "13")
-    {
-        return state::EmotionState::CALM; // Calm, soothing
-    }
-    if (code == "99")
-    {
-        return state::EmotionState::THINKING; // Thinking, processing
-    }
+    for (const auto &e : EMOTION_CODES)
+        if (e.code == code)
+            return e.state;
 
-    ESP_LOGW(TAG, "Unknown emotion code: %s", code.c_str());
+    ESP_LOGW(TAG, "Unknown emotion code: %.*s", (int)code.size(), code.data());
     return state::EmotionState::NEUTRAL;
 }
 // ============================================================================
 // REAL-TIME WEBSOCKET CONFIGURATION
 // ============================================================================
 
-static bool nmgr_save_u8(const char *key, uint8_t value)
-{
-    nvs_handle_t h;
-    if (nvs_open("storage", NVS_READWRITE, &h) != ESP_OK)
-        return false;
-    esp_err_t e = nvs_set_u8(h, key, value);
-    nvs_commit(h);
-    nvs_close(h);
-    return e == ESP_OK;
-}
-
-static bool nmgr_save_str(const char *key, const std::string &value)
-{
-    nvs_handle_t h;
-    if (nvs_open("storage", NVS_READWRITE, &h) != ESP_OK)
-        return false;
-    esp_err_t e = nvs_set_str(h, key, value.c_str());
-    nvs_commit(h);
-    nvs_close(h);
-    return e == ESP_OK;
-}
-
-static uint8_t nmgr_load_u8(const char *key, uint8_t def_val)
-{
-    uint8_t v = def_val;
-    nvs_handle_t h;
-    if (nvs_open("storage", NVS_READONLY, &h) == ESP_OK)
-    {
-        nvs_get_u8(h, key, &v);
-        nvs_close(h);
-    }
-    return v;
-}
-
+// Large, read-once values outside the ConfigStore cache (ws_ca PEM)
 static std::string nmgr_load_str(const char *key, const char *def_val)
 {
     std::string out;
@@ -1209,6 +2288,9 @@ void NetworkManager::setManagers(class AudioManager *audio, class DisplayManager
 {
     audio_manager = audio;
     display_manager = display;
+    // Stream end (media task) → published from update()
+    MediaPlayer::instance().onEnd([this]()
+                                  { wakeLoop(); });
 }
 
 void NetworkManager::onConfigUpdate(std::function<void(const std::string &, const std::string &)> cb)
@@ -1221,11 +2303,24 @@ bool NetworkManager::sendDeviceHandshake()
     if (!mqtt || !mqtt->isConnected())
         return false;
 
-    std::string status_json = getCurrentStatusJson();
-    return mqtt->publish(mqtt_base_topic + "/status", status_json, 1, true); // Retain = true
+    char buf[STATUS_JSON_MAX];
+    size_t n = writeStatusJson(buf, sizeof(buf), mqttFormat());
+    return n && mqtt->publish(topic_status, std::string_view(buf, n), 1, true); // Retain = true
 }
 
-void NetworkManager::handleConfigCommand(const std::string &json_msg)
+// {"status":<status>,"message":<message>[,"device_id":...]} on /status
+void NetworkManager::publishStatusReply(const char *status, const char *message, bool with_device_id)
+{
+    char buf[JSON_SMALL_MAX];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    w.beginObject().field("status", status).field("message", message);
+    if (with_device_id)
+        w.field("device_id", device_id.c_str());
+    w.endObject();
+    mqtt->publish(topic_status, w.view(), 1, false);
+}
+
+void NetworkManager::handleConfigCommand(std::string_view json_msg)
 {
     // ✅ THÊM: Check MQTT connection trước khi xử lý
     if (!mqtt || !mqtt->isConnected())
@@ -1234,57 +2329,152 @@ void NetworkManager::handleConfigCommand(const std::string &json_msg)
         return;
     }
 
-    cJSON *root = cJSON_Parse(json_msg.c_str());
-    if (!root)
+    // One pass over the members; values stay views into the payload
+    jsonlite::Value cmd_v, volume_v, brightness_v, name_v;
+    jsonlite::Value size_v, sha_v, chunk_v, total_v, enc_v, img_v, w_v, l_v;
+    jsonlite::Value ns_v, agc_v, pack_v, url_v, bg_v;
+    jsonlite::Value action_v, offset_v, ms_v, rate_v, bps_v, spill_v;
+    const jsonlite::Format in_fmt = jsonlite::detectFormat(json_msg);
     {
-        ESP_LOGE(TAG, "Invalid JSON config command: %s", json_msg.c_str());
-        return;
+        jsonlite::ObjectReader rd(json_msg, in_fmt);
+        std::string_view key;
+        jsonlite::Value v;
+        while (rd.next(key, v))
+        {
+            if (key == "cmd")
+                cmd_v = v;
+            else if (key == "volume")
+                volume_v = v;
+            else if (key == "brightness")
+                brightness_v = v;
+            else if (key == "device_name")
+                name_v = v;
+            else if (key == "size")
+                size_v = v;
+            else if (key == "sha256")
+                sha_v = v;
+            else if (key == "chunk_size")
+                chunk_v = v;
+            else if (key == "total_chunks")
+                total_v = v;
+            else if (key == "encoding")
+                enc_v = v;
+            else if (key == "image_size")
+                img_v = v;
+            else if (key == "window_sz2")
+                w_v = v;
+            else if (key == "lookahead_sz2")
+                l_v = v;
+            else if (key == "ns")
+                ns_v = v;
+            else if (key == "agc")
+                agc_v = v;
+            else if (key == "pack")
+                pack_v = v;
+            else if (key == "url")
+                url_v = v;
+            else if (key == "background")
+                bg_v = v;
+            else if (key == "action")
+                action_v = v;
+            else if (key == "offset")
+                offset_v = v;
+            else if (key == "ms")
+                ms_v = v;
+            else if (key == "rate")
+                rate_v = v;
+            else if (key == "bps")
+                bps_v = v;
+            else if (key == "spill")
+                spill_v = v;
+        }
+        if (rd.error())
+        {
+            if (in_fmt == jsonlite::Format::JSON)
+                ESP_LOGE(TAG, "Invalid JSON config command: %.*s", (int)json_msg.size(), json_msg.data());
+            else
+                ESP_LOGE(TAG, "Invalid %s config command (%u B)", jsonlite::formatName(in_fmt), (unsigned)json_msg.size());
+            return;
+        }
     }
 
-    cJSON *cmd_obj = cJSON_GetObjectItem(root, "cmd");
-    if (!cmd_obj || !cmd_obj->valuestring)
+    if (!cmd_v.isString())
     {
         ESP_LOGE(TAG, "Config command missing 'cmd' field");
-        cJSON_Delete(root);
         return;
     }
 
-    std::string cmd_str = cmd_obj->valuestring;
+    char cmd_str[32];
+    cmd_v.copyString(cmd_str, sizeof(cmd_str));
     mqtt_config::ConfigCommand cmd = mqtt_config::parseCommandString(cmd_str);
 
-    ESP_LOGI(TAG, "Processing MQTT config command: %s", cmd_str.c_str());
+    ESP_LOGI(TAG, "Processing MQTT config command: %s (%s)", cmd_str, jsonlite::formatName(in_fmt));
 
     // Process command
     switch (cmd)
     {
     case mqtt_config::ConfigCommand::SET_AUDIO_VOLUME:
     {
-        cJSON *vol_obj = cJSON_GetObjectItem(root, "volume");
-        if (vol_obj && vol_obj->type == cJSON_Number)
+        uint32_t volume;
+        if (volume_v.asU32(volume))
         {
-            uint8_t volume = (uint8_t)vol_obj->valueint;
-            applyVolumeConfig(volume);
+            applyVolumeConfig(static_cast<uint8_t>(std::min<uint32_t>(volume, 100)));
         }
         break;
     }
 
     case mqtt_config::ConfigCommand::SET_BRIGHTNESS:
     {
-        cJSON *bright_obj = cJSON_GetObjectItem(root, "brightness");
-        if (bright_obj && bright_obj->type == cJSON_Number)
+        uint32_t brightness;
+        if (brightness_v.asU32(brightness))
         {
-            uint8_t brightness = (uint8_t)bright_obj->valueint;
-            applyBrightnessConfig(brightness);
+            applyBrightnessConfig(static_cast<uint8_t>(std::min<uint32_t>(brightness, 100)));
         }
         break;
     }
 
+    case mqtt_config::ConfigCommand::SET_AUDIO_FRONTEND:
+    {
+        bool ns, agc;
+        const bool has_ns = ns_v.asBool(ns);
+        const bool has_agc = agc_v.asBool(agc);
+        applyFrontEndConfig(has_ns ? &ns : nullptr, has_agc ? &agc : nullptr);
+        break;
+    }
+
+    case mqtt_config::ConfigCommand::ANIM_PACK:
+    {
+        // Fetched later by the pack task (idle only); reply = accepted or not
+        char pack[32] = ""; // longer than PACK_NAME_MAX: rejected by offer()
+        char url[AnimPackCache::URL_MAX + 1] = "";
+        char sha[72] = "";
+        uint32_t size = 0;
+        if (pack_v.isString())
+            pack_v.copyString(pack, sizeof(pack));
+        if (url_v.isString())
+            url_v.copyString(url, sizeof(url));
+        if (sha_v.isString())
+            sha_v.copyString(sha, sizeof(sha));
+        size_v.asU32(size);
+        if (AnimPackCache::instance().offer(pack, url, sha, size))
+            publishStatusReply(mqtt_config::statusToString(mqtt_config::ResponseStatus::OK), pack);
+        else
+            publishStatusReply(mqtt_config::statusToString(mqtt_config::ResponseStatus::INVALID_PARAM),
+                               "anim_pack rejected");
+        break;
+    }
+
+    case mqtt_config::ConfigCommand::MEDIA:
+        handleMediaCommand(action_v, url_v, offset_v, ms_v, rate_v, bps_v, spill_v);
+        break;
+
     case mqtt_config::ConfigCommand::SET_DEVICE_NAME:
     {
-        cJSON *name_obj = cJSON_GetObjectItem(root, "device_name");
-        if (name_obj && name_obj->valuestring)
+        if (name_v.isString())
         {
-            applyDeviceNameConfig(name_obj->valuestring);
+            char name[64];
+            name_v.copyString(name, sizeof(name));
+            applyDeviceNameConfig(name);
         }
         break;
     }
@@ -1292,33 +2482,36 @@ void NetworkManager::handleConfigCommand(const std::string &json_msg)
     case mqtt_config::ConfigCommand::SET_WIFI:
     {
         // Wi‑Fi configuration is NOT allowed via WebSocket; use BLE portal instead.
-        cJSON *resp = cJSON_CreateObject();
-        cJSON_AddStringToObject(resp, "status", mqtt_config::statusToString(mqtt_config::ResponseStatus::NOT_SUPPORTED));
-        cJSON_AddStringToObject(resp, "message", "WiFi config not supported over WebSocket. Use BLE.");
-        char *resp_str = cJSON_Print(resp);
-        mqtt->publish(mqtt_base_topic + "/status", resp_str, 1, false);
-        cJSON_free(resp_str);
-        cJSON_Delete(resp);
+        publishStatusReply(mqtt_config::statusToString(mqtt_config::ResponseStatus::NOT_SUPPORTED),
+                           "WiFi config not supported over WebSocket. Use BLE.");
         break;
     }
 
     case mqtt_config::ConfigCommand::REQUEST_STATUS:
     {
         // Send current device status
-        std::string status_json = getCurrentStatusJson();
-        mqtt->publish(mqtt_base_topic + "/status", status_json.c_str(), 1, false);
+        char buf[STATUS_JSON_MAX];
+        size_t n = writeStatusJson(buf, sizeof(buf), mqttFormat());
+        if (n)
+            mqtt->publish(topic_status, std::string_view(buf, n), 1, false);
+        break;
+    }
+
+    case mqtt_config::ConfigCommand::REQUEST_MEM:
+    {
+        publishMemReport();
+        break;
+    }
+
+    case mqtt_config::ConfigCommand::REQUEST_CPU:
+    {
+        publishCpuReport();
         break;
     }
 
     case mqtt_config::ConfigCommand::REBOOT:
     {
-        cJSON *ack = cJSON_CreateObject();
-        cJSON_AddStringToObject(ack, "status", "ok");
-        cJSON_AddStringToObject(ack, "message", "Rebooting...");
-        char *ack_str = cJSON_Print(ack);
-        mqtt->publish(mqtt_base_topic + "/status", ack_str, 1, false);    
-        cJSON_free(ack_str);
-        cJSON_Delete(ack);
+        publishStatusReply("ok", "Rebooting...");
 
         // Delay before reboot to send ack
         vTaskDelay(pdMS_TO_TICKS(500));
@@ -1330,49 +2523,91 @@ void NetworkManager::handleConfigCommand(const std::string &json_msg)
     {
         // Server is initiating OTA - prepare to receive binary data
         uint32_t fw_size = 0;
-        cJSON *size_obj = cJSON_GetObjectItem(root, "size");
-        if (size_obj && cJSON_IsNumber(size_obj))
-        {
-            fw_size = static_cast<uint32_t>(size_obj->valuedouble);
-        }
+        size_v.asU32(fw_size);
 
-        std::string fw_sha256;
-        cJSON *sha_obj = cJSON_GetObjectItem(root, "sha256");
-        if (sha_obj && sha_obj->valuestring)
-        {
-            fw_sha256 = sha_obj->valuestring;
-        }
+        char fw_sha256[72] = "";
+        if (sha_v.isString())
+            sha_v.copyString(fw_sha256, sizeof(fw_sha256));
 
         // Parse chunk protocol info
         uint32_t chunk_size = 2048; // Default
-        cJSON *chunk_obj = cJSON_GetObjectItem(root, "chunk_size");
-        if (chunk_obj && cJSON_IsNumber(chunk_obj))
+        chunk_v.asU32(chunk_size);
+
+        uint32_t total_chunks = 0;
+        total_v.asU32(total_chunks);
+
+        // Optional compressed stream: "size" is then the compressed length and
+        // "image_size" the flashed length (SHA-256 covers the image)
+        OtaEncoding encoding;
+        if (enc_v.isString() && !enc_v.equals("raw"))
         {
-            chunk_size = static_cast<uint32_t>(chunk_obj->valuedouble);
+            uint32_t image_size = 0;
+            if (!enc_v.equals("heatshrink") || !img_v.asU32(image_size))
+            {
+                ESP_LOGE(TAG, "Unsupported OTA encoding '%.*s'", (int)enc_v.raw.size(), enc_v.raw.data());
+                publishStatusReply("error", "unsupported_encoding");
+                break;
+            }
+            encoding.type = OtaEncoding::HEATSHRINK;
+            encoding.image_size = image_size;
+            uint32_t sz2;
+            if (w_v.asU32(sz2))
+                encoding.window_sz2 = static_cast<uint8_t>(sz2);
+            if (l_v.asU32(sz2))
+                encoding.lookahead_sz2 = static_cast<uint8_t>(sz2);
         }
 
-        uint32_t total_chunks = 0;
-        cJSON *total_obj = cJSON_GetObjectItem(root, "total_chunks");
-        if (total_obj && cJSON_IsNumber(total_obj))
+        // "url": the device pulls the image over HTTP(S) (ranged GETs, resumed
+        // after drops); MQTT then only carries this request and the result
+        firmware_download = OtaDownload{};
+        if (url_v.isString())
         {
-            total_chunks = static_cast<uint32_t>(total_obj->valuedouble);
+            // Nothing else vouches for what the URL serves
+            if (fw_size == 0 || strlen(fw_sha256) != 64)
+            {
+                publishStatusReply(mqtt_config::statusToString(mqtt_config::ResponseStatus::INVALID_PARAM),
+                                   "url needs size and sha256");
+                break;
+            }
+            std::string &url = firmware_download.url;
+            url.resize(url_v.raw.size() + 1); // unescaped never longer than raw
+            url.resize(url_v.copyString(url.data(), url.size()));
+            firmware_download.size = fw_size;
+            firmware_download.sha256 = fw_sha256;
+            firmware_download.encoding = encoding;
+            firmware_download.chunk_size = config_.ota_http_chunk_bytes;
+            firmware_download.window = config_.ota_http_window;
         }
+        const bool http = !firmware_download.url.empty();
+        // Background: no UI takeover, paused during voice turns, applied at
+        // the next idle stretch or sleep (AppController)
+        firmware_background = false;
+        bg_v.asBool(firmware_background);
 
         // Setup OTA state to receive binary data
         firmware_download_active = true;
+        updateRadioProfile();
         firmware_bytes_received = 0;
         firmware_expected_size = fw_size;
         firmware_expected_sha256 = fw_sha256;
+        firmware_encoding = encoding;
 
         // Initialize chunk protocol state
         ota_expected_seq = 0;
+        ota_rx_mask = 0;
+        ota_last_nack = UINT32_MAX;
+        ota_window = std::clamp<uint32_t>(config_.ota_window, 1, 32);
         ota_chunk_size = chunk_size;
         ota_total_chunks = total_chunks;
         ota_chunks_received = 0;
         ota_chunks_failed = 0;
 
-        ESP_LOGI(TAG, "OTA initiated: size=%u, chunks=%u, chunk_size=%u, sha256=%s",
-                 fw_size, total_chunks, chunk_size, fw_sha256.c_str());
+        if (http)
+            ESP_LOGI(TAG, "OTA initiated over HTTP(S)%s: size=%u, sha256=%s",
+                     firmware_background ? " (background)" : "", fw_size, fw_sha256);
+        else
+            ESP_LOGI(TAG, "OTA initiated: size=%u, chunks=%u, chunk_size=%u, window=%u, sha256=%s",
+                     fw_size, total_chunks, chunk_size, ota_window, fw_sha256);
 
         // CRITICAL: Notify AppController to setup OTA callbacks BEFORE sending ACK
         // This ensures callbacks are registered before binary data arrives
@@ -1387,32 +2622,28 @@ void NetworkManager::handleConfigCommand(const std::string &json_msg)
         }
 
         // Send ACK - ready to receive firmware
-        cJSON *resp = cJSON_CreateObject();
-        cJSON_AddStringToObject(resp, "status", "ok");
-        cJSON_AddStringToObject(resp, "message", "Ready to receive firmware");
+        char buf[JSON_SMALL_MAX];
+        jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+        w.beginObject().field("status", "ok");
+        if (http)
+            w.field("message", "Downloading firmware").field("transport", "http");
+        else
+            w.field("message", "Ready to receive firmware").field("transport", "mqtt").field("window", ota_window);
+        if (firmware_background)
+            w.field("background", true);
         if (fw_size > 0)
-            cJSON_AddNumberToObject(resp, "size", fw_size);
-        if (!fw_sha256.empty())
-            cJSON_AddStringToObject(resp, "sha256", fw_sha256.c_str());
-        cJSON_AddStringToObject(resp, "device_id", getDeviceEfuseID().c_str());
-
-        char *resp_str = cJSON_Print(resp);
-        mqtt->publish(mqtt_base_topic + "/status", resp_str, 1, false);
-        cJSON_free(resp_str);
-        cJSON_Delete(resp);
+            w.field("size", fw_size);
+        if (fw_sha256[0])
+            w.field("sha256", fw_sha256);
+        w.field("device_id", device_id.c_str()).endObject();
+
+        mqtt->publish(topic_status, w.view(), 1, false);
         break;
     }
 
     case mqtt_config::ConfigCommand::REQUEST_BLE_CONFIG:
     {
-        cJSON *ack = cJSON_CreateObject();
-        cJSON_AddStringToObject(ack, "status", "ok");
-        cJSON_AddStringToObject(ack, "message", "Opening BLE config mode...");
-        cJSON_AddStringToObject(ack, "device_id", getDeviceEfuseID().c_str());
-        char *ack_str = cJSON_Print(ack);
-        mqtt->publish(mqtt_base_topic + "/status", ack_str, 1, false);
-        cJSON_free(ack_str);
-        cJSON_Delete(ack);
+        publishStatusReply("ok", "Opening BLE config mode...", true);
 
         // Delay before opening BLE to send ack
         vTaskDelay(pdMS_TO_TICKS(1000));
@@ -1422,12 +2653,99 @@ void NetworkManager::handleConfigCommand(const std::string &json_msg)
         break;
     }
 
+    case mqtt_config::ConfigCommand::SET_ENCODING:
+    {
+        jsonlite::Format fmt;
+        if (enc_v.equals("json"))
+            fmt = jsonlite::Format::JSON;
+        else if (enc_v.equals("msgpack"))
+            fmt = jsonlite::Format::MSGPACK;
+        else
+        {
+            publishStatusReply(mqtt_config::statusToString(mqtt_config::ResponseStatus::INVALID_PARAM),
+                               "encoding must be json or msgpack");
+            break;
+        }
+
+        // Switch first: the ack is the first message in the new encoding
+        mqtt_format = fmt;
+        char buf[64];
+        jsonlite::Writer w(buf, sizeof(buf), fmt);
+        w.beginObject().field("status", "ok").field("encoding", jsonlite::formatName(fmt)).endObject();
+        mqtt->publish(topic_status, w.view(), 1, false);
+        ESP_LOGI(TAG, "MQTT encoding -> %s", jsonlite::formatName(fmt));
+        break;
+    }
+
     default:
-        ESP_LOGW(TAG, "Unknown config command: %s", cmd_str.c_str());
+        ESP_LOGW(TAG, "Unknown config command: %s", cmd_str);
         break;
     }
+}
+
+void NetworkManager::handleMediaCommand(const jsonlite::Value &action_v, const jsonlite::Value &url_v,
+                                        const jsonlite::Value &offset_v, const jsonlite::Value &ms_v,
+                                        const jsonlite::Value &rate_v, const jsonlite::Value &bps_v,
+                                        const jsonlite::Value &spill_v)
+{
+    using mqtt_config::ResponseStatus;
+    using mqtt_config::statusToString;
+    MediaPlayer &player = MediaPlayer::instance();
+    if (!player.ready())
+    {
+        publishStatusReply(statusToString(ResponseStatus::NOT_SUPPORTED), "media player not ready");
+        return;
+    }
 
-    cJSON_Delete(root);
+    uint32_t ms = 0;
+    const bool has_ms = ms_v.asU32(ms);
+    if (action_v.equals("play"))
+    {
+        char url[256] = "";
+        if (url_v.isString() && url_v.copyString(url, sizeof(url)) >= sizeof(url) - 1)
+        {
+            publishStatusReply(statusToString(ResponseStatus::INVALID_PARAM), "url too long");
+            return;
+        }
+        MediaRequest req;
+        req.url = url;
+        offset_v.asU32(req.offset);
+        if (has_ms)
+            req.start_ms = ms;
+        rate_v.asU32(req.sample_rate);
+        bps_v.asU32(req.bytes_per_s);
+        spill_v.asBool(req.spill);
+        if (player.play(req))
+            publishStatusReply(statusToString(ResponseStatus::OK), "buffering");
+        else
+            publishStatusReply(statusToString(ResponseStatus::INVALID_PARAM), "media play rejected");
+    }
+    else if (action_v.equals("pause"))
+    {
+        player.pause();
+        publishStatusReply(statusToString(ResponseStatus::OK), MediaPlayer::stateName(player.state()));
+    }
+    else if (action_v.equals("resume"))
+    {
+        player.resume();
+        publishStatusReply(statusToString(ResponseStatus::OK), MediaPlayer::stateName(player.state()));
+    }
+    else if (action_v.equals("seek"))
+    {
+        if (has_ms && player.seek(ms))
+            publishStatusReply(statusToString(ResponseStatus::OK), "seeking");
+        else
+            publishStatusReply(statusToString(ResponseStatus::INVALID_PARAM), "seek rejected");
+    }
+    else if (action_v.equals("stop"))
+    {
+        player.stop();
+        publishStatusReply(statusToString(ResponseStatus::OK), "stopped");
+    }
+    else
+    {
+        publishStatusReply(statusToString(ResponseStatus::INVALID_PARAM), "unknown media action");
+    }
 }
 
 bool NetworkManager::applyVolumeConfig(uint8_t volume)
@@ -1437,18 +2755,14 @@ bool NetworkManager::applyVolumeConfig(uint8_t volume)
     ESP_LOGI(TAG, "Applying volume config: %d%%", volume);
     if (audio_manager)
         audio_manager->setVolume(volume);
-    nmgr_save_u8("volume", volume);
+    ConfigStore::instance().setU8(ConfigStore::Key::VOLUME, volume); // written once the changes settle
 
     // Gửi phản hồi qua MQTT thay vì WS
-    cJSON *response = cJSON_CreateObject();
-    cJSON_AddStringToObject(response, "status", "ok");
-    cJSON_AddNumberToObject(response, "volume", volume);
-    char *resp_str = cJSON_PrintUnformatted(response);
-
-    mqtt->publish(mqtt_base_topic + "/status", resp_str, 1, false);
-
-    free(resp_str);
-    cJSON_Delete(response);
+    char buf[64];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    w.beginObject().field("status", "ok").field("volume", static_cast<uint32_t>(volume)).endObject();
+    if (mqtt) // also called for local voice commands, MQTT may be down
+        mqtt->publish(topic_status, w.view(), 1, false);
     return true;
 }
 
@@ -1464,20 +2778,47 @@ bool NetworkManager::applyBrightnessConfig(uint8_t brightness)
         display_manager->setBrightness(brightness);
     }
 
-    // Persist to NVS for next boot
-    nmgr_save_u8("brightness", brightness);
+    // Persist for next boot (write-behind, coalesced)
+    ConfigStore::instance().setU8(ConfigStore::Key::BRIGHTNESS, brightness);
 
     // Send response
-    cJSON *response = cJSON_CreateObject();
-    cJSON_AddStringToObject(response, "status", "ok");
-    cJSON_AddNumberToObject(response, "brightness", brightness);
-    char *resp_str = cJSON_PrintUnformatted(response);
+    char buf[64];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    w.beginObject().field("status", "ok").field("brightness", static_cast<uint32_t>(brightness)).endObject();
+    mqtt->publish(topic_status, w.view(), 1, false);
 
-    mqtt->publish(mqtt_base_topic + "/status", resp_str, 1, false);
+    return true;
+}
 
-    free(resp_str);
-    cJSON_Delete(response);
+bool NetworkManager::applyFrontEndConfig(const bool *ns, const bool *agc)
+{
+    if (!audio_manager)
+    {
+        publishStatusReply(mqtt_config::statusToString(mqtt_config::ResponseStatus::NOT_SUPPORTED), "no audio");
+        return false;
+    }
+    if (ns)
+    {
+        audio_manager->setNoiseSuppression(*ns);
+        ConfigStore::instance().setBool(ConfigStore::Key::NS, *ns);
+    }
+    if (agc)
+    {
+        audio_manager->setAutoGain(*agc);
+        ConfigStore::instance().setBool(ConfigStore::Key::AGC, *agc);
+    }
+    ESP_LOGI(TAG, "Uplink front-end: NS %s, AGC %s", audio_manager->noiseSuppression() ? "on" : "off",
+             audio_manager->autoGain() ? "on" : "off");
 
+    char buf[96];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    w.beginObject()
+        .field("status", "ok")
+        .field("ns", audio_manager->noiseSuppression())
+        .field("agc", audio_manager->autoGain())
+        .fieldFixed("gain_db", audio_manager->uplinkGainDb(), 1)
+        .endObject();
+    mqtt->publish(topic_status, w.view(), 1, false);
     return true;
 }
 
@@ -1485,18 +2826,13 @@ bool NetworkManager::applyDeviceNameConfig(const std::string &name)
 {
     ESP_LOGI(TAG, "Applying device name config: %s", name.c_str());
 
-    // Persist to NVS for next boot
-    nmgr_save_str("device_name", name);
-
-    cJSON *response = cJSON_CreateObject();
-    cJSON_AddStringToObject(response, "status", "ok");
-    cJSON_AddStringToObject(response, "device_name", name.c_str());
-    char *resp_str = cJSON_PrintUnformatted(response);
+    // Persist for next boot (write-behind, coalesced)
+    ConfigStore::instance().setStr(ConfigStore::Key::DEVICE_NAME, name.c_str());
 
-    mqtt->publish(mqtt_base_topic + "/status", resp_str, 1, false);
-
-    free(resp_str);
-    cJSON_Delete(response);
+    char buf[JSON_SMALL_MAX];
+    jsonlite::Writer w(buf, sizeof(buf), mqttFormat());
+    w.beginObject().field("status", "ok").field("device_name", name).endObject();
+    mqtt->publish(topic_status, w.view(), 1, false);
 
     return true;
 }
@@ -1509,15 +2845,7 @@ bool NetworkManager::applyWiFiConfig(const std::string &ssid, const std::string
     setCredentials(ssid, password);
 
     // Send response before restart
-    cJSON *response = cJSON_CreateObject();
-    cJSON_AddStringToObject(response, "status", "ok");
-    cJSON_AddStringToObject(response, "message", "WiFi configured, restarting...");
-    char *resp_str = cJSON_PrintUnformatted(response);
-
-    mqtt->publish(mqtt_base_topic + "/status", resp_str, 1, false);
-
-    free(resp_str);
-    cJSON_Delete(response);
+    publishStatusReply("ok", "WiFi configured, restarting...");
 
     // Delay before restart
     vTaskDelay(pdMS_TO_TICKS(1000));
@@ -1526,32 +2854,122 @@ bool NetworkManager::applyWiFiConfig(const std::string &ssid, const std::string
     return true;
 }
 
+void NetworkManager::firmwareDownloadDone(bool success, const std::string &msg)
+{
+    firmware_download_active = false;
+    updateRadioProfile();
+    ESP_LOGI(TAG, "HTTP(S) OTA download %s: %s", success ? "done" : "failed", msg.c_str());
+    if (mqtt && mqtt->isConnected())
+        publishStatusReply(success ? "ok" : "error", msg.c_str());
+}
+
 std::string NetworkManager::getCurrentStatusJson() const
 {
-    std::string device_id = getDeviceEfuseID();
-    std::string app_version = app_meta::APP_VERSION;
-    std::string device_name = nmgr_load_str("device_name", "PTalk");
-    uint8_t volume = nmgr_load_u8("volume", 60);
-    uint8_t brightness = nmgr_load_u8("brightness", 100);
+    char buf[STATUS_JSON_MAX];
+    size_t n = writeStatusJson(buf, sizeof(buf));
+    return std::string(buf, n);
+}
+
+size_t NetworkManager::writeStatusJson(char *buf, size_t cap, jsonlite::Format fmt) const
+{
+    // RAM copy: no NVS access per status
+    const ConfigStore &store = ConfigStore::instance();
+    char device_name[64];
+    store.getStr(ConfigStore::Key::DEVICE_NAME, device_name, sizeof(device_name));
+    uint8_t volume = store.getU8(ConfigStore::Key::VOLUME);
+    uint8_t brightness = store.getU8(ConfigStore::Key::BRIGHTNESS);
     uint8_t battery = power_manager ? power_manager->getPercent() : 85;
     uint32_t uptime_sec = static_cast<uint32_t>(esp_timer_get_time() / 1000000ULL);
 
-    cJSON *root = cJSON_CreateObject();
-    cJSON_AddStringToObject(root, "status", "ok");
-    cJSON_AddStringToObject(root, "device_id", device_id.c_str());
-    cJSON_AddStringToObject(root, "device_name", device_name.c_str());
-    cJSON_AddNumberToObject(root, "battery_percent", battery);
-    cJSON_AddStringToObject(root, "connectivity_state", "ONLINE");
-    cJSON_AddStringToObject(root, "firmware_version", app_version.c_str());
-    cJSON_AddNumberToObject(root, "volume", volume);         // From NVS (WS/BLE persisted)
-    cJSON_AddNumberToObject(root, "brightness", brightness); // From NVS (WS/BLE persisted)
-    cJSON_AddNumberToObject(root, "uptime_sec", uptime_sec);
+    jsonlite::Writer w(buf, cap, fmt);
+    w.beginObject()
+        .field("status", "ok")
+        .field("device_id", device_id.c_str())
+        .field("device_name", device_name)
+        .field("battery_percent", static_cast<uint32_t>(battery))
+        .field("connectivity_state", "ONLINE")
+        .field("firmware_version", app_meta::APP_VERSION)
+        .field("ota_encodings", "raw,heatshrink")                // request_ota "encoding"
+        .field("ota_transports", "mqtt,http")                    // request_ota "url" = http
+        .field("encodings", "json,msgpack")                      // set_encoding
+        .field("volume", static_cast<uint32_t>(volume))         // ConfigStore (RAM copy)
+        .field("brightness", static_cast<uint32_t>(brightness)) // ConfigStore (RAM copy)
+        .field("uptime_sec", uptime_sec);
+
+    // Voice-turn latency per stage (ms) over the recent turns
+    LatencyTrace::SpanStats lat[LatencyTrace::SPAN_COUNT];
+    LatencyTrace::instance().stats(lat);
+    w.beginObject("latency_ms");
+    for (size_t i = 0; i < LatencyTrace::SPAN_COUNT; i++)
+    {
+        if (lat[i].count == 0)
+            continue;
+        w.beginObject(LatencyTrace::spanName(static_cast<LatencyTrace::Span>(i)))
+            .fieldFixed("p50", lat[i].p50_us / 1000.0)
+            .fieldFixed("p95", lat[i].p95_us / 1000.0)
+            .fieldFixed("max", lat[i].max_us / 1000.0)
+            .field("n", static_cast<uint32_t>(lat[i].count))
+            .endObject();
+    }
+    w.endObject();
+
+    // Controller event lanes: drops mean an event was lost, coalesced are
+    // merged battery/power updates
+    AppController::QueueStats qs = AppController::instance().queueStats();
+    w.beginObject("app_queue")
+        .field("high_dropped", qs.high_dropped)
+        .field("normal_dropped", qs.normal_dropped)
+        .field("coalesced", qs.coalesced)
+        .field("high_peak", qs.high_peak)
+        .field("normal_peak", qs.normal_peak)
+        .endObject();
+
+    // WS connect cost (TCP + TLS + upgrade)
+    if (ws)
+    {
+        const WsConnectStats &wst = ws->connectStats();
+        w.beginObject("ws")
+            .field("tls", wst.tls)
+            .field("connects", wst.connects)
+            .field("connect_ms", wst.last_ms)
+            .field("connect_avg_ms", wst.avg_ms)
+            .field("heap_peak", wst.heap_peak)
+            .endObject();
+    }
 
-    char *json_str = cJSON_Print(root);
-    std::string result(json_str);
+    // Media playback position / buffer depth while a stream is open
+    const MediaPlayer &media = MediaPlayer::instance();
+    if (media.state() != MediaPlayer::State::STOPPED)
+    {
+        w.beginObject("media")
+            .field("state", MediaPlayer::stateName(media.state()))
+            .field("pos_ms", media.positionMs())
+            .field("buf_ms", media.bufferedMs())
+            .field("dur_ms", media.durationMs())
+            .endObject();
+    }
 
-    cJSON_free(json_str);
-    cJSON_Delete(root);
+    // Link quality (LinkQualityMonitor), idle modem sleep depth, roams
+    if (config_.link_sample_ms && wifi)
+    {
+        w.beginObject("link")
+            .field("q", LinkQualityMonitor::qualityName(link_.quality()))
+            .field("rssi", static_cast<int32_t>(link_.rssi()))
+            .field("rtt_ms", link_.rttMs())
+            .field("loss", static_cast<uint32_t>(link_.lossPct()))
+            .field("sleep", LinkQualityMonitor::sleepName(link_.sleep()))
+            .field("roams", link_.roams())
+            .endObject();
+    }
 
-    return result;
+    // Heap + tightest task stack (full table: request_mem)
+    MemTelemetry::instance().writeSummary(w);
+    w.endObject();
+
+    if (!w.ok())
+    {
+        ESP_LOGE(TAG, "Status JSON does not fit %u B", (unsigned)cap);
+        return 0;
+    }
+    return w.size();
 }
\ No newline at end of file
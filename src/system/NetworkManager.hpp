@@ -1,20 +1,30 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <string_view>
 #include <atomic>
 #include <functional>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-// #include "freertos/ringbuf.h"
-#include "freertos/stream_buffer.h"
+
+#include "SpscRing.hpp"
+#include "AudioPacket.hpp"
+#include "JsonLite.hpp"
+#include "LinkQualityMonitor.hpp"
+#include "UplinkRateController.hpp"
+#include "UtteranceStore.hpp"
 
 #include "system/StateTypes.hpp"
 #include "system/StateManager.hpp"
+#include "system/OTAUpdater.hpp"
+#include "system/PmLock.hpp"
+#include "system/TelemetryAggregator.hpp"
 #include "BluetoothService.hpp"
 
 class WifiService;     // Low-level WiFi
 class WebSocketClient; // Low-level WebSocket
+struct WsBinaryView;   // One received binary fragment (WebSocketClient.hpp)
 class MqttClient;
 struct WifiInfo;
 class PowerManager;
@@ -42,9 +52,84 @@ public:
         uint8_t ap_max_clients = 4;    // limit number of AP clients
 
         // WebSocket server endpoint
-        std::string ws_url; // e.g. ws://192.168.1.100:8080/ws
+        std::string ws_url; // e.g. ws://192.168.1.100:8080/ws or wss://host/ws
+        // CA certificate (PEM) for wss://; empty -> NVS "ws_ca". Neither on
+        // IDF 4.4 -> wss:// is refused (IDF 5: certificate bundle)
+        std::string ws_ca_pem;
         // MQTT broker endpoint
         std::string mqtt_url; // e.g. mqtt://broker.hivemq.com:
+
+        // Uplink packetizer: mic audio carried by one WS binary message,
+        // rounded to whole codec frames (20/40/80 ms). Larger packets cost
+        // latency but cut per-message header/TCP overhead.
+        uint32_t uplink_packet_ms = 40;
+        // Upper bound of one send; a busy socket keeps audio queued in the
+        // mic ring (bounded), the encoder drops frames once it is full
+        uint32_t uplink_send_timeout_ms = 1000;
+        // Adaptive uplink bitrate: step the codec down (Opus bitrate, ADPCM
+        // 8 kHz) as the send queue / send time / ping RTT grow, back up once
+        // the link is clean (UplinkRateController); off = nominal rate only
+        bool uplink_adaptive = true;
+        // Ping carrying a timestamp this often while streaming (RTT signal)
+        uint32_t uplink_rtt_probe_ms = 1000;
+        // Store-and-forward: a drop inside the resume window keeps packetizing
+        // the turn into RAM, then a file on the "spiffs" partition, and
+        // replays it after SESSION:RESUMED; 0 RAM = off, 0 spill = RAM only
+        uint32_t uplink_store_ram_bytes = 16 * 1024;
+        uint32_t uplink_store_spill_bytes = 128 * 1024;
+
+        // OTA receive window: chunks the server may have in flight. The
+        // device buffers out-of-order chunks and ACKs each one selectively
+        // (max 32).
+        uint32_t ota_window = 8;
+        // request_ota with "url": the device fetches the image over HTTP(S)
+        // in reads of this size, with this many writer buffers (fits the
+        // boot arena OTA region)
+        uint32_t ota_http_chunk_bytes = 4096;
+        uint32_t ota_http_window = 4;
+
+        // WS reconnect: exponential backoff with jitter between attempts
+        uint32_t ws_backoff_min_ms = 500;
+        uint32_t ws_backoff_max_ms = 30000;
+        // A drop shorter than this resumes the server session (token in the
+        // handshake) instead of aborting the turn; 0 disables resumption
+        uint32_t ws_resume_window_ms = 15000;
+
+        // Retained MQTT status (full document) every N ms while connected;
+        // 0 = only on connect and on request. Periodic numbers go out as
+        // compact telemetry reports instead (below).
+        uint32_t status_interval_ms = 0;
+
+        // Telemetry aggregator (<base>/telemetry, QoS 0): heap / RSSI /
+        // battery sampled every sample_ms, one report per report_ms with
+        // only the metrics that moved past their deadband (none → no
+        // publish), a full keyframe every keyframe_every reports; 0 = off
+        uint32_t telemetry_sample_ms = 10000;
+        uint32_t telemetry_report_ms = 60000;
+        uint8_t telemetry_keyframe_every = 10;
+
+        // MQTT session: keepalive (s), clean-session = false so the broker
+        // keeps subscriptions + queued QoS 1 commands across reconnects, and
+        // a cap on unacked QoS 1 bytes (over it the publish is dropped and
+        // counted); 0 = unbounded
+        uint16_t mqtt_keepalive_s = 120;
+        bool mqtt_persistent_session = true;
+        uint32_t mqtt_outbox_limit_bytes = 8 * 1024;
+
+        // Wi-Fi modem sleep outside voice turns / firmware download (the
+        // idle power profile); off = radio always awake
+        bool wifi_modem_sleep_idle = true;
+        // Background Wi-Fi scan this often while connected and idle, so
+        // the portal / BLE config list is ready the moment either opens;
+        // 0 = scan only when config mode opens
+        uint32_t wifi_scan_refresh_ms = 120000;
+        // Link quality (LinkQualityMonitor): RSSI + WS ping RTT / loss every
+        // link_sample_ms (idle: one ping per sample). Picks the idle modem
+        // sleep depth and, with wifi_roam, moves to a stronger BSSID of the
+        // same SSID between turns (802.11v BSS transition when the AP
+        // supports it, else scan + directed reconnect); 0 = off
+        uint32_t link_sample_ms = 10000;
+        bool wifi_roam = true;
     };
 
     // ======================================================
@@ -55,6 +140,9 @@ public:
     // Init with configuration (preferred)
     // Initialize using provided config; returns false on failure.
     bool init(const Config &cfg);
+    // Fast resume: keep cfg and run init() from the first start(), in the
+    // caller's task, so Wi-Fi / WS / MQTT bring-up stays off the boot path.
+    void deferInit(const Config &cfg);
 
     // Start Wi‑Fi connection workflow and WS task; no-op if already started.
     void start();
@@ -68,6 +156,9 @@ public:
 
     // Tick the manager (used by internal task); dt_ms is elapsed milliseconds.
     void update(uint32_t dt_ms);
+    // Milliseconds until update() has something due (status publish, WS
+    // retry, resume deadlines); UINT32_MAX = nothing, sleep until woken.
+    uint32_t nextWakeMs() const;
 
     // Update credentials when user submits portal form.
     void setCredentials(const std::string &ssid, const std::string &pass);
@@ -77,19 +168,37 @@ public:
     void setApSsid(const std::string &apSsid);
     void setDeviceLimit(uint8_t maxClients);
 
-    // Set mic encoded stream buffer (for uplink audio task)
-    void setMicBuffer(StreamBufferHandle_t sb) { mic_encoded_sb = sb; }
+    // Set mic encoded ring (uplink task is its only consumer).
+    // framed = ring holds [u16 LE len][packet] records (variable-size codecs);
+    // they are sent as-is, packed whole into each WS binary message.
+    // frame_bytes / frame_ms = nominal encoded size and duration of one
+    // codec frame (packet sizing and capture timestamps).
+    void setMicBuffer(SpscRing *rb, bool framed = false,
+                      size_t frame_bytes = 128, uint32_t frame_ms = 16)
+    {
+        mic_encoded_rb = rb;
+        mic_framed = framed;
+        mic_frame_bytes = frame_bytes;
+        mic_frame_ms = frame_ms;
+    }
 
     // Send text message to server; returns false if WS not running.
-    bool sendText(const std::string &text);
+    bool sendText(std::string_view text);
     // Send binary message to server; returns false if WS not running.
     bool sendBinary(const uint8_t *data, size_t len);
 
-    // Register callback for incoming WS text.
-    void onServerText(std::function<void(const std::string &)> cb);
+    // Register callback for incoming WS text (view valid only during the call).
+    void onServerText(std::function<void(std::string_view)> cb);
 
-    // Register callback for incoming WS binary.
-    void onServerBinary(std::function<void(const uint8_t *, size_t)> cb);
+    // Register callback for incoming WS binary; large messages arrive as
+    // several in-order fragments pointing into the receive buffer. Once the
+    // server enables downlink framing ("AUDIO_PROTO:2") the audio header is
+    // stripped and the views cover the payload only.
+    void onServerBinary(std::function<void(const WsBinaryView &)> cb);
+
+    // Register callback for the header of each framed downlink audio message,
+    // called before its payload; return false to drop that payload.
+    void onServerAudioPacket(std::function<bool(const audio_packet::Header &)> cb);
 
     // Register callback on WS disconnect (to flush buffers/reset state).
     void onDisconnect(std::function<void()> cb);
@@ -104,6 +213,15 @@ public:
     void setManagers(class AudioManager *audio, class DisplayManager *display);
     void setPowerManager(PowerManager *power) { power_manager = power; }
 
+    // Link quality, modem sleep depth and roam counters (serial "link")
+    void printLink() const;
+    // Look for a better AP at the next chance (console; idle only)
+    void requestRoam()
+    {
+        link_roam_req_ = true;
+        wakeLoop();
+    }
+
     // Check if a speaking session is active (prevents SPEAKING spam).
     bool isSpeakingSessionActive() const { return speaking_session_active; }
 
@@ -120,9 +238,21 @@ public:
     
     uint32_t getFirmwareExpectedSize() const { return firmware_expected_size; }
     std::string getFirmwareExpectedChecksum() const { return firmware_expected_sha256; }
-
-    // Register callback for incoming firmware data chunks during OTA.
-    void onFirmwareChunk(std::function<void(const uint8_t *, size_t)> cb);
+    uint32_t getFirmwareChunkSize() const { return ota_chunk_size; }
+    // Stream encoding announced by request_ota (raw or compressed)
+    const OtaEncoding &getFirmwareEncoding() const { return firmware_encoding; }
+    uint32_t getOtaWindow() const { return ota_window; }
+    // HTTP(S) transport: image request to hand to OTAUpdater::startDownload()
+    // (url empty = MQTT chunks)
+    const OtaDownload &getFirmwareDownload() const { return firmware_download; }
+    // request_ota "background": keep talking, update between turns
+    bool isFirmwareBackground() const { return firmware_background; }
+    // HTTP(S) download ended (OtaFetch task): radio profile back, result to the server
+    void firmwareDownloadDone(bool success, const std::string &msg);
+
+    // Register callback for incoming firmware data chunks during OTA. Chunks
+    // may arrive out of order inside the window; the status decides ACK/NACK.
+    void onFirmwareChunk(std::function<OtaChunkStatus(uint32_t seq, const uint8_t *, size_t)> cb);
 
     // Register callback for firmware download completion (success flag, message).
     void onFirmwareComplete(std::function<void(bool success, const std::string &msg)> cb);
@@ -135,6 +265,10 @@ public:
 
     void startBLEConfigMode();
 
+    // Provisioning finished: BLE controller back to its powered-down state
+    // right away (not from a BLE callback).
+    void stopBLEConfigMode();
+
     // Open BLE config mode with WiFi scan (can be called proactively)
     void openBLEConfigMode();
 
@@ -147,7 +281,7 @@ public:
     /// Parse emotion code from WebSocket message
     /// @param code 2-character emotion code ("01", "11", etc.)
     /// @return EmotionState, or NEUTRAL if code not recognized
-    static state::EmotionState parseEmotionCode(const std::string &code);
+    static state::EmotionState parseEmotionCode(std::string_view code);
 
     // ======================================================
     // Real-time WebSocket Configuration Support
@@ -165,6 +299,9 @@ public:
     /// Apply brightness configuration (0-100)
     bool applyBrightnessConfig(uint8_t brightness);
 
+    /// Apply uplink NS / AGC switches (nullptr = unchanged)
+    bool applyFrontEndConfig(const bool *ns, const bool *agc);
+
     /// Apply device name configuration
     bool applyDeviceNameConfig(const std::string &name);
 
@@ -173,6 +310,13 @@ public:
 
     /// Get current device status for status query response
     std::string getCurrentStatusJson() const;
+    /// Same document written into buf (no heap); returns its length, 0 if
+    /// it does not fit. MSGPACK: same keys, MessagePack map
+    size_t writeStatusJson(char *buf, size_t cap, jsonlite::Format fmt = jsonlite::Format::JSON) const;
+
+    /// Encoding of device → server MQTT messages (set_encoding; JSON after
+    /// every MQTT connect)
+    jsonlite::Format mqttFormat() const { return mqtt_format.load(); }
 
 private:
     // ======================================================
@@ -185,6 +329,12 @@ private:
     void handleWsStatus(int status_code);
 
     bool sendWSDeviceHandshake();
+    // Short "session_resume" instead of the full handshake after a short drop
+    bool sendWSSessionResume();
+    // Server dropped the session (or never answered the resume): forget the
+    // old turn and start over with a full handshake
+    void abandonWsSession();
+    uint32_t nextWsBackoffMs();
 
     // Retry logic for initial WiFi connection
     void retryWifiThenPortal();
@@ -193,36 +343,71 @@ private:
 
     // Receive message from WebSocketClient
     // Handle inbound WS text and dispatch to callbacks/state updates.
-    void handleWsTextMessage(const std::string &msg);
+    void handleWsTextMessage(std::string_view msg);
 
     // Process configuration command from WebSocket message
-    void handleConfigCommand(const std::string &json_msg);
+    void handleConfigCommand(std::string_view json_msg);
+    // Small {"status","message"} reply on the status topic
+    void publishStatusReply(const char *status, const char *message, bool with_device_id = false);
 
     // Handle inbound WS binary payloads (firmware or app data).
-    void handleWsBinaryMessage(const uint8_t *data, size_t len);
+    void handleWsBinaryMessage(const WsBinaryView &frag);
     void handleOtaBinaryChunk(const uint8_t *data, size_t len);
     // OTA chunk protocol ACK/NACK helpers
     void sendOtaAck(uint32_t seq);
-    void sendOtaNack(uint32_t seq);
+    void sendOtaNack(uint32_t seq, bool busy = false);
     // MQTT setup and status publishing
     void setupMqtt();
     void publishMqttStatus();
+    // Sample / report on the telemetry schedule (network task)
+    void updateTelemetry(uint32_t dt_ms);
+    // EventLog: audio glitch deltas, rate-limited flush, upload on <base>/events
+    void updateEventLog(uint32_t dt_ms);
+    // Link quality sample; modem sleep depth, roaming between turns
+    void updateLink(uint32_t dt_ms);
+    // MediaPlayer stream end → <base>/media
+    void updateMedia();
+    // "media" command: play / pause / resume / seek / stop
+    void handleMediaCommand(const jsonlite::Value &action_v, const jsonlite::Value &url_v, const jsonlite::Value &offset_v,
+                            const jsonlite::Value &ms_v, const jsonlite::Value &rate_v, const jsonlite::Value &bps_v,
+                            const jsonlite::Value &spill_v);
+    // Reconnect to the best cached AP of our SSID if it beats the link enough
+    void roamIfBetter();
+    // Full MemTelemetry report on /status (request_mem)
+    void publishMemReport();
+    // Per-task / per-core CPU load and probe stats (request_cpu)
+    void publishCpuReport();
 
     // Uplink task for sending microphone data
     void uplinkTaskLoop();
+    // Whole [len][packet] records at the ring head (framed streams).
+    size_t collectFramedRecords(size_t budget, size_t max_records,
+                                size_t &records, TickType_t wait);
+    // Levels the rate controller may use with this server.
+    uint8_t uplinkUsableLevels() const;
+    // Follow the encoder's level switches; returns how much of `budget`
+    // fits before the next one (a packet never mixes two levels).
+    size_t uplinkTrackSwitch(size_t budget);
+    // Allocate the store at the first drop of a turn; false = not usable.
+    bool uplinkStoreOpen();
     static void uplinkTaskEntry(void *arg);
     // Push connectivity state lên StateManager
     void publishState(state::ConnectivityState s);
     // Start/stop uplink task based on interaction state.
     void handleInteractionState(state::InteractionState s);
+    // Wake the network loop early: something update() looks at changed.
+    void wakeLoop() { StateManager::wakeMailbox(state_mailbox); }
+    // Radio busy period (voice turn or firmware download): CPU lock held and
+    // modem sleep off; idle otherwise.
+    void updateRadioProfile();
 
     static void taskEntry(void *arg);
 
 private:
     TaskHandle_t task_handle = nullptr;
 
-    uint32_t update_interval_ms = 33; // ~30 FPS tick
     int sub_interaction_id = -1;
+    StateManager::Mailbox state_mailbox = nullptr; // deferred state callbacks
 
 private:
     // ======================================================
@@ -242,6 +427,7 @@ private:
     // Config storage
     // ======================================================
     Config config_{}; // holds init-time configuration
+    bool init_deferred_ = false; // deferInit(): init() pending until start()
 
     // ======================================================
     // Runtime flags
@@ -261,38 +447,110 @@ private:
                                           // Mqtt client for telemetry
     std::unique_ptr<MqttClient> mqtt;
     std::string mqtt_base_topic; // Ví dụ: "ptalk/DEVICE_ID"
+    std::string device_id;       // eFuse MAC id, read once in init()
+    std::string topic_status, topic_cmd, topic_ota_data, topic_ota_ack, topic_telemetry, topic_events, topic_media;
+    std::atomic<jsonlite::Format> mqtt_format{jsonlite::Format::JSON};
     //
-    StreamBufferHandle_t mic_encoded_sb = nullptr;
+    SpscRing *mic_encoded_rb = nullptr;
+    bool mic_framed = false;
+    size_t mic_frame_bytes = 128;
+    uint32_t mic_frame_ms = 16;
     TaskHandle_t uplink_task_handle = nullptr;
+    // Header + payload of the packet being sent (uplink task only): a boot
+    // arena block, uplink_pkt_heap only when the NET budget is too small
+    uint8_t *uplink_pkt = nullptr;
+    std::unique_ptr<uint8_t[]> uplink_pkt_heap;
+    size_t uplink_pkt_cap = 0;
+    uint16_t uplink_session = 0;
+
+    // Uplink rate control (uplink task; kept across turns, same link)
+    UplinkRateController ul_rate_;
+    uint8_t ul_level_ = 0;        // level of the bytes being sent
+    uint8_t ul_req_level_ = 0;    // last level asked of the encoder
+    uint8_t ul_enc_level_ = 0;    // last level the encoder switched to
+    uint32_t ul_switch_seen_ = 0; // AudioManager::uplinkSwitch() counter
+    bool ul_switch_pending_ = false; // switch ahead of the read position
+    uint32_t ul_switch_pos_ = 0;
+    std::atomic<uint16_t> ul_kbps_{0}; // telemetry
+    // Server decodes half-rate ADPCM ("AUDIO_UL_ADAPT:1"); per connection
+    std::atomic<bool> ul_adapt_ack_{false};
+    // Turn kept across a drop (uplink task); RAM allocated at the first drop
+    UtteranceStore ul_store_;
+
+    // Downlink audio framing (WS task); negotiated per connection
+    bool dl_framed = false;
+    bool dl_skip = false; // rest of the current message is dropped
+    size_t dl_hdr = audio_packet::HEADER_BYTES; // current message's header size
 
     // Retry timer (ms)
     uint32_t ws_retry_timer = 0;
+    uint8_t ws_backoff_exp = 0; // attempts since the last OPEN
+
+    // Session resumption: token sent in the handshake; a drop defers the
+    // disconnect cleanup until the resume window ends or the server says the
+    // session is gone
+    uint64_t ws_session_token = 0;
+    std::atomic<int64_t> ws_dropped_at_us{0}; // 0 = no drop pending
+    std::atomic<int64_t> ws_resume_deadline_us{0}; // waiting for SESSION:*, 0 = no
+    std::atomic<uint32_t> ws_session_epoch{0}; // +1 each time a session is given up
 
     uint32_t tick_ms = 0;
+    uint32_t status_elapsed_ms = 0; // since the last periodic publishMqttStatus()
+    TelemetryAggregator telemetry_;
+    uint32_t tele_sample_elapsed_ms = 0;
+    uint32_t tele_report_elapsed_ms = 0;
+    // EventLog: glitch counters already logged, offline since
+    uint32_t evlog_glitch_elapsed_ms = 0;
+    uint32_t evlog_spk_underruns = 0;
+    uint32_t evlog_mic_overruns = 0;
+    int64_t wifi_down_at_us = 0;
+    // Link quality (updateLink)
+    LinkQualityMonitor link_;
+    uint32_t link_elapsed_ms = 0;
+    uint32_t link_rtt_seen = 0;  // ws->rttSamples() at the previous sample
+    bool link_ping_out = false;  // our probe awaits its pong
+    bool link_roam_scan = false; // roam search waiting for its scan
+    bool link_btm_last = false;  // last search was a BSS transition query
+    std::atomic<bool> link_roam_req_{false};
 
     // ======================================================
     // App-level callbacks
     // ======================================================
-    std::function<void(const std::string &)> on_text_cb = nullptr;
-    std::function<void(const uint8_t *, size_t)> on_binary_cb = nullptr;
+    std::function<void(std::string_view)> on_text_cb = nullptr;
+    std::function<void(const WsBinaryView &)> on_binary_cb = nullptr;
+    std::function<bool(const audio_packet::Header &)> on_audio_packet_cb = nullptr;
     std::function<void()> on_disconnect_cb = nullptr;
     std::function<void(const std::string &, const std::string &)> on_config_update_cb = nullptr;
 
     // ======================================================
     // OTA Callbacks
     // ======================================================
-    std::function<void(const uint8_t *, size_t)> on_firmware_chunk_cb = nullptr;
+    std::function<OtaChunkStatus(uint32_t, const uint8_t *, size_t)> on_firmware_chunk_cb = nullptr;
     std::function<void(bool, const std::string &)> on_firmware_complete_cb = nullptr;
     std::function<void()> on_server_ota_request_cb = nullptr;
 
+    // Power profile (updateRadioProfile)
+    PmLock radio_pm_;
+    std::atomic<bool> voice_active_{false};
+    // LISTENING, mirrored for the uplink task (set before it is started)
+    std::atomic<bool> uplink_listening_{false};
+    // CANCELLING seen while the uplink task runs (local voice command)
+    std::atomic<bool> uplink_cancel_{false};
+
     // OTA state
     bool firmware_download_active = false;
     uint32_t firmware_bytes_received = 0;
     uint32_t firmware_expected_size = 0;
     std::string firmware_expected_sha256;
+    OtaEncoding firmware_encoding;
+    OtaDownload firmware_download; // url set: HTTP(S) transport, no chunks over MQTT
+    bool firmware_background = false;
 
     // OTA chunk protocol state
-    uint32_t ota_expected_seq = 0;    // Next expected sequence number
+    uint32_t ota_expected_seq = 0;    // Lowest chunk not yet received (cumulative ACK base)
+    uint32_t ota_rx_mask = 0;         // bit i: chunk ota_expected_seq + i received
+    uint32_t ota_window = 8;          // Receive window (chunks)
+    uint32_t ota_last_nack = UINT32_MAX; // Hole already NACKed (one NACK per hole)
     uint32_t ota_chunk_size = 2048;   // Chunk data size from server
     uint32_t ota_total_chunks = 0;    // Total chunks expected
     uint32_t ota_chunks_received = 0; // Chunks successfully received
@@ -3,23 +3,50 @@
 #include "esp_system.h"
 #include "esp_ota_ops.h"
 #include "esp_partition.h"
+#include "esp_timer.h"
+#include "esp_http_client.h"
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+#include "esp_crt_bundle.h"
+#endif
+#include "system/MemArena.hpp"
+#include "system/TaskPlan.hpp"
 #include <algorithm>
 #include <cctype>
+#include <cstring>
+#include <new>
+#include "mbedtls/version.h"
+
+// mbedtls 3.x (IDF 5) dropped the *_ret names
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+#define OTA_SHA256_STARTS mbedtls_sha256_starts
+#define OTA_SHA256_UPDATE mbedtls_sha256_update
+#define OTA_SHA256_FINISH mbedtls_sha256_finish
+#else
+#define OTA_SHA256_STARTS mbedtls_sha256_starts_ret
+#define OTA_SHA256_UPDATE mbedtls_sha256_update_ret
+#define OTA_SHA256_FINISH mbedtls_sha256_finish_ret
+#endif
 
 // Helper: convert uint8_t digest to lowercase hex string
-// static std::string toHexLower(const uint8_t *data, size_t len)
-// {
-//     static const char *hex = "0123456789abcdef";
-//     std::string out;
-//     out.reserve(len * 2);
-//     for (size_t i = 0; i < len; ++i)
-//     {
-//         uint8_t b = data[i];
-//         out.push_back(hex[b >> 4]);
-//         out.push_back(hex[b & 0x0F]);
-//     }
-//     return out;
-// }
+static std::string toHexLower(const uint8_t *data, size_t len)
+{
+    static const char *hex = "0123456789abcdef";
+    std::string out;
+    out.reserve(len * 2);
+    for (size_t i = 0; i < len; ++i)
+    {
+        uint8_t b = data[i];
+        out.push_back(hex[b >> 4]);
+        out.push_back(hex[b & 0x0F]);
+    }
+    return out;
+}
+
+static bool isSha256Hex(const std::string &s)
+{
+    return s.size() == 64 &&
+           std::all_of(s.begin(), s.end(), [](unsigned char c) { return std::isxdigit(c) != 0; });
+}
 
 static std::string toLower(std::string s)
 {
@@ -29,6 +56,15 @@ static std::string toLower(std::string s)
 
 static const char* TAG = "OTAUpdater";
 
+static constexpr uint32_t FINISH_DRAIN_MS = 10000;
+static constexpr size_t INFLATE_BUF = 2048; // decoded bytes per esp_ota_write
+
+// HTTP(S) download
+static constexpr uint32_t FETCH_TIMEOUT_MS = 10000;   // per socket read
+static constexpr uint8_t FETCH_RETRIES = 6;           // reconnects in a row without a new byte
+static constexpr uint32_t FETCH_BACKOFF_MS = 1000;    // doubles per failed reconnect
+static constexpr uint32_t FETCH_BACKOFF_MAX_MS = 30000;
+
 bool OTAUpdater::init() {
     ESP_LOGI(TAG, "OTAUpdater init()");
     return true;
@@ -42,11 +78,13 @@ void OTAUpdater::stop() {
     ESP_LOGI(TAG, "OTAUpdater stopped");
 }
 
-bool OTAUpdater::beginUpdate(size_t total_size, const std::string &expected_sha256)
+bool OTAUpdater::beginUpdate(size_t total_size, const std::string &expected_sha256,
+                             size_t chunk_size, size_t window, const OtaEncoding &enc)
 {
-    if (total_size == 0)
+    const size_t image_bytes = enc.type == OtaEncoding::RAW ? total_size : enc.image_size;
+    if (total_size == 0 || image_bytes == 0)
     {
-        ESP_LOGE(TAG, "Invalid firmware size: 0");
+        ESP_LOGE(TAG, "Invalid firmware size: stream=%u image=%u", (unsigned)total_size, (unsigned)image_bytes);
         return false;
     }
 
@@ -57,7 +95,7 @@ bool OTAUpdater::beginUpdate(size_t total_size, const std::string &expected_sha2
     }
 
     // Check storage space before starting update
-    if (!checkStorageSpace(total_size))
+    if (!checkStorageSpace(image_bytes))
     {
         ESP_LOGE(TAG, "Insufficient storage space for firmware update");
         return false;
@@ -73,26 +111,77 @@ bool OTAUpdater::beginUpdate(size_t total_size, const std::string &expected_sha2
 
     ESP_LOGI(TAG, "Writing OTA partition at offset 0x%x", update_partition->address);
 
-    // Begin OTA update
-    esp_err_t err = esp_ota_begin(update_partition, OTA_SIZE_UNKNOWN, &update_handle);
+    encoding = enc;
+    if (encoding.type == OtaEncoding::HEATSHRINK)
+    {
+        inflate_buf = static_cast<uint8_t *>(MemArena::instance().claim(MemArena::OTA, "ota_inflate", INFLATE_BUF));
+        if (!inflate_buf)
+        {
+            inflate_heap.reset(new (std::nothrow) uint8_t[INFLATE_BUF]);
+            inflate_buf = inflate_heap.get();
+        }
+        if (!inflate_buf || !inflater.init(encoding.window_sz2, encoding.lookahead_sz2))
+        {
+            ESP_LOGE(TAG, "Cannot set up heatshrink decoder (w=%u l=%u)",
+                     encoding.window_sz2, encoding.lookahead_sz2);
+            releaseInflate();
+            inflater.deinit();
+            return false;
+        }
+        inflate_fill = 0;
+        ESP_LOGI(TAG, "Compressed image: %u B stream -> %u B (heatshrink w=%u l=%u)",
+                 (unsigned)total_size, (unsigned)image_bytes, encoding.window_sz2, encoding.lookahead_sz2);
+    }
+
+    // Begin OTA update. Sequential mode erases each sector right before it
+    // is written, so the erase cost is spread over the transfer instead of
+    // blocking here for the whole partition.
+#ifdef OTA_WITH_SEQUENTIAL_WRITES
+    const size_t image_size = OTA_WITH_SEQUENTIAL_WRITES;
+#else
+    const size_t image_size = OTA_SIZE_UNKNOWN;
+#endif
+    esp_err_t err = esp_ota_begin(update_partition, image_size, &update_handle);
     if (err != ESP_OK)
     {
         ESP_LOGE(TAG, "esp_ota_begin failed: %s", esp_err_to_name(err));
+        releaseInflate();
+        inflater.deinit();
         return false;
     }
 
-    updating = true;
     bytes_written = 0;
-    total_bytes = total_size;
+    total_bytes = image_bytes;
+    stream_total = total_size;
+    stream_consumed = 0;
+
+    if (chunk_size > 0 && !startWriter(chunk_size, window))
+    {
+        esp_ota_abort(update_handle);
+        releaseInflate();
+        inflater.deinit();
+        return false;
+    }
+
+    updating = true;
 
     expected_sha256_hex = toLower(expected_sha256);
-    checksum_enabled = !expected_sha256_hex.empty();
+    checksum_enabled = isSha256Hex(expected_sha256_hex);
 
-    // NOTE: SHA256 is calculated AFTER download completes by reading from flash
-    // This avoids hardware SHA engine conflicts with WebSocket TLS
+    // SHA256 is accumulated chunk by chunk as data reaches flash (no
+    // read-back pass). The IDF mbedtls port only takes the SHA engine if it
+    // is free and otherwise hashes in software, so TLS sessions are unaffected.
+    // On the ESP32 this context keeps the engine until free(): a wss:// or
+    // mqtts:// handshake during the update is correct, just hashed in software.
     if (checksum_enabled)
     {
-        ESP_LOGI(TAG, "OTA checksum target: %s (will verify after download)", expected_sha256_hex.c_str());
+        mbedtls_sha256_init(&sha_ctx);
+        OTA_SHA256_STARTS(&sha_ctx, 0);
+        ESP_LOGI(TAG, "OTA checksum target: %s (streamed)", expected_sha256_hex.c_str());
+    }
+    else if (!expected_sha256_hex.empty())
+    {
+        ESP_LOGW(TAG, "Ignoring malformed SHA256 '%s' - image not hash-checked", expected_sha256_hex.c_str());
     }
 
     ESP_LOGI(TAG, "OTA update started, total size: %u bytes", total_bytes);
@@ -109,27 +198,261 @@ int OTAUpdater::writeChunk(const uint8_t *data, size_t size)
         return -1;
     }
 
-    if (bytes_written + size > total_bytes)
+    if (stream_consumed + size > stream_total)
+    {
+        ESP_LOGE(TAG, "Chunk overflow: received=%u, chunk=%zu, expected=%u", stream_consumed, size, stream_total);
+        return -1;
+    }
+
+    if (isPipelined())
     {
-        ESP_LOGE(TAG, "Chunk overflow: written=%u, chunk=%zu, expected=%u", bytes_written, size, total_bytes);
+        ESP_LOGE(TAG, "writeChunk() while the pipelined writer owns the partition");
         return -1;
     }
 
+    if (!consume(data, size))
+        return -1;
+    return size;
+}
+
+bool OTAUpdater::consume(const uint8_t *data, size_t size)
+{
+    if (encoding.type == OtaEncoding::RAW)
+    {
+        if (!flashWrite(data, size))
+            return false;
+        stream_consumed += size;
+        return true;
+    }
+
+    const uint8_t *in = data;
+    size_t in_len = size;
+    while (in_len > 0 || inflater.pending())
+    {
+        size_t n = inflater.decode(in, in_len, &inflate_buf[inflate_fill], INFLATE_BUF - inflate_fill);
+        inflate_fill += n;
+        if (bytes_written + inflate_fill > total_bytes)
+        {
+            ESP_LOGE(TAG, "Decoded image exceeds %u bytes", total_bytes);
+            return false;
+        }
+        if (inflate_fill == INFLATE_BUF && !flushInflate())
+            return false;
+        if (n == 0 && in_len == 0)
+            break;
+    }
+    stream_consumed += size;
+    return true;
+}
+
+bool OTAUpdater::flushInflate()
+{
+    if (inflate_fill == 0)
+        return true;
+    bool ok = flashWrite(inflate_buf, inflate_fill);
+    inflate_fill = 0;
+    return ok;
+}
+
+bool OTAUpdater::flashWrite(const uint8_t *data, size_t size)
+{
     esp_err_t err = esp_ota_write(update_handle, data, size);
     if (err != ESP_OK)
     {
         ESP_LOGE(TAG, "esp_ota_write failed: %s", esp_err_to_name(err));
-        return -1;
+        return false;
     }
 
     bytes_written += size;
 
-    // NOTE: SHA256 is calculated AFTER download completes by reading from flash
-    // This avoids hardware SHA engine conflicts with WebSocket TLS
+    // Chunks reach this point in image order (writer task or writeChunk)
+    if (checksum_enabled)
+        OTA_SHA256_UPDATE(&sha_ctx, data, size);
 
     reportProgress();
+    return true;
+}
 
-    return size;
+// ============================================================================
+// Pipelined writer: pool of chunk buffers → writer task → esp_ota_write
+// ============================================================================
+bool OTAUpdater::startWriter(size_t chunk_size, size_t window)
+{
+    // Whole window from the boot arena; else the heap, falling back to fewer
+    // buffers on a fragmented heap (1 still overlaps one chunk), and last the
+    // largest window the arena can still hold
+    const size_t want = std::max<size_t>(window, 1);
+    MemArena &arena = MemArena::instance();
+    pool = static_cast<uint8_t *>(arena.claim(MemArena::OTA, "ota_pool", want * chunk_size));
+    for (size_t k = want; k > 0; k /= 2)
+    {
+        if (!pool)
+        {
+            pool_heap.reset(new (std::nothrow) uint8_t[k * chunk_size]);
+            pool = pool_heap.get();
+        }
+        slots.reset(new (std::nothrow) Slot[k]);
+        if (pool && slots)
+        {
+            pool_slots = k;
+            break;
+        }
+        releasePool();
+        slots.reset();
+    }
+    if (!pool_slots)
+    {
+        const size_t free_bytes = arena.capacity(MemArena::OTA) - arena.used(MemArena::OTA);
+        const size_t k = std::min(want, free_bytes / chunk_size);
+        if (k > 0)
+            pool = static_cast<uint8_t *>(arena.claim(MemArena::OTA, "ota_pool", k * chunk_size));
+        slots.reset(pool ? new (std::nothrow) Slot[k] : nullptr);
+        if (pool && slots)
+        {
+            pool_slots = k;
+        }
+        else
+        {
+            releasePool();
+            slots.reset();
+        }
+    }
+    if (!pool_slots)
+    {
+        ESP_LOGE(TAG, "No RAM for OTA chunk pool (%u B chunks)", (unsigned)chunk_size);
+        return false;
+    }
+
+    pool_chunk = chunk_size;
+    write_seq = 0;
+    writer_failed = false;
+    writer_run = true;
+    // Core 0, below the network / audio tasks (task plan)
+    if (!TaskPlan::instance().spawn(TaskPlan::OTA_WRITER, &OTAUpdater::writerTaskEntry, this, &writer_task))
+    {
+        writer_run = false;
+        writer_task = nullptr;
+        releasePool();
+        slots.reset();
+        pool_slots = 0;
+        return false;
+    }
+
+    ESP_LOGI(TAG, "OTA writer: %u x %u B chunk buffers", (unsigned)pool_slots, (unsigned)pool_chunk);
+    return true;
+}
+
+void OTAUpdater::releasePool()
+{
+    pool = nullptr; // arena blocks stay reserved for the next update
+    pool_heap.reset();
+}
+
+void OTAUpdater::releaseInflate()
+{
+    inflate_buf = nullptr;
+    inflate_heap.reset();
+}
+
+void OTAUpdater::stopWriter()
+{
+    if (writer_task)
+    {
+        writer_run = false;
+        xTaskNotifyGive(writer_task);
+        // The task clears writer_task on exit; it finishes the chunk in flight first
+        for (int i = 0; i < 200 && writer_task; i++)
+            vTaskDelay(pdMS_TO_TICKS(10));
+        if (writer_task)
+            ESP_LOGW(TAG, "OTA writer did not exit");
+    }
+    releasePool();
+    slots.reset();
+    pool_slots = 0;
+    pool_chunk = 0;
+}
+
+OtaChunkStatus OTAUpdater::submitChunk(uint32_t seq, const uint8_t *data, size_t size)
+{
+    if (!updating || !isPipelined() || writer_failed)
+        return OtaChunkStatus::FAILED;
+    if (paused_)
+        return OtaChunkStatus::BUSY; // sender holds off until the turn ends
+    if (!data || size == 0 || size > pool_chunk)
+    {
+        ESP_LOGE(TAG, "Chunk %u: bad size %u (max %u)", (unsigned)seq, (unsigned)size, (unsigned)pool_chunk);
+        return OtaChunkStatus::FAILED;
+    }
+
+    // The writer clears a slot before advancing write_seq, so a slot inside
+    // the window read here is free unless it already holds this seq
+    const uint32_t base = write_seq.load(std::memory_order_acquire);
+    if (seq < base)
+        return OtaChunkStatus::DUPLICATE;
+    if (seq >= base + pool_slots)
+        return OtaChunkStatus::BUSY;
+
+    Slot &slot = slots[seq % pool_slots];
+    if (slot.filled.load(std::memory_order_acquire))
+        return slot.seq == seq ? OtaChunkStatus::DUPLICATE : OtaChunkStatus::BUSY;
+
+    if (static_cast<uint64_t>(seq) * pool_chunk + size > stream_total)
+    {
+        ESP_LOGE(TAG, "Chunk %u overflows stream (%u B)", (unsigned)seq, (unsigned)stream_total);
+        return OtaChunkStatus::FAILED;
+    }
+
+    memcpy(&pool[(seq % pool_slots) * pool_chunk], data, size);
+    slot.seq = seq;
+    slot.len = size;
+    slot.filled.store(true, std::memory_order_release);
+    xTaskNotifyGive(writer_task);
+    return OtaChunkStatus::ACCEPTED;
+}
+
+bool OTAUpdater::waitWriterIdle(uint32_t timeout_ms)
+{
+    const TickType_t start = xTaskGetTickCount();
+    while (stream_consumed < stream_total && !writer_failed)
+    {
+        if ((xTaskGetTickCount() - start) >= pdMS_TO_TICKS(timeout_ms))
+            return false;
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return !writer_failed;
+}
+
+void OTAUpdater::writerTaskEntry(void *arg)
+{
+    static_cast<OTAUpdater *>(arg)->writerTaskLoop();
+}
+
+void OTAUpdater::writerTaskLoop()
+{
+    while (writer_run)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+
+        // Flash every consecutive chunk that has arrived (none while paused)
+        while (writer_run && !writer_failed && !paused_)
+        {
+            const uint32_t seq = write_seq.load(std::memory_order_relaxed);
+            Slot &slot = slots[seq % pool_slots];
+            if (!slot.filled.load(std::memory_order_acquire) || slot.seq != seq)
+                break;
+
+            if (!consume(&pool[(seq % pool_slots) * pool_chunk], slot.len))
+            {
+                writer_failed = true;
+                break;
+            }
+            slot.filled.store(false, std::memory_order_release);
+            write_seq.store(seq + 1, std::memory_order_release);
+        }
+    }
+
+    writer_task = nullptr;
+    vTaskDelete(nullptr);
 }
 
 bool OTAUpdater::finishUpdate()
@@ -142,18 +465,51 @@ bool OTAUpdater::finishUpdate()
 
     ESP_LOGI(TAG, "🔧 finishUpdate: START (bytes_written=%u, total=%u)", bytes_written, total_bytes);
 
+    if (isPipelined())
+    {
+        // Let the writer flush the chunks still in the pool
+        bool drained = waitWriterIdle(FINISH_DRAIN_MS);
+        stopWriter();
+        if (!drained)
+        {
+            ESP_LOGE(TAG, "OTA writer did not finish (received=%u/%u)", stream_consumed, stream_total);
+            return false;
+        }
+    }
+
+    // Tail of the decoded image still in the inflate buffer
+    if (encoding.type != OtaEncoding::RAW)
+    {
+        bool ok = flushInflate();
+        releaseInflate();
+        inflater.deinit();
+        if (!ok)
+            return false;
+    }
+
     if (bytes_written != total_bytes)
     {
         ESP_LOGE(TAG, "Size mismatch: written=%u, expected=%u", bytes_written, total_bytes);
         return false;
     }
 
-    // NOTE: SHA256 verification is skipped - esp_ota_end() already validates image internally
-    // (magic bytes, CRC, partition table, etc.). The provided sha256 is logged for reference.
+    // Compare the streamed digest before the image can become bootable
     if (checksum_enabled)
     {
-        ESP_LOGI(TAG, "📝 Expected SHA256 (for reference): %s", expected_sha256_hex.c_str());
-        ESP_LOGI(TAG, "📝 Skipping manual SHA256 verification - trusting esp_ota_end() validation");
+        uint8_t digest[32];
+        OTA_SHA256_FINISH(&sha_ctx, digest);
+        mbedtls_sha256_free(&sha_ctx);
+        checksum_enabled = false;
+
+        std::string actual = toHexLower(digest, sizeof(digest));
+        if (actual != expected_sha256_hex)
+        {
+            ESP_LOGE(TAG, "SHA256 mismatch: expected %s, got %s", expected_sha256_hex.c_str(), actual.c_str());
+            esp_ota_abort(update_handle);
+            updating = false;
+            return false;
+        }
+        ESP_LOGI(TAG, "✅ SHA256 OK");
     }
 
     // End OTA update - this validates image internally
@@ -196,6 +552,10 @@ bool OTAUpdater::finishUpdate()
 
 void OTAUpdater::abortUpdate()
 {
+    cancelDownload();
+    stopWriter();
+    paused_ = false;
+    rate_limit_ = 0;
     if (updating)
     {
         ESP_LOGW(TAG, "Aborting OTA update");
@@ -204,10 +564,264 @@ void OTAUpdater::abortUpdate()
     updating = false;
     bytes_written = 0;
     total_bytes = 0;
+    stream_total = 0;
+    stream_consumed = 0;
+    releaseInflate();
+    inflate_fill = 0;
+    inflater.deinit();
+    encoding = OtaEncoding{};
     expected_sha256_hex.clear();
+    if (checksum_enabled)
+        mbedtls_sha256_free(&sha_ctx);
     checksum_enabled = false;
 }
 
+// ============================================================================
+// Background mode
+// ============================================================================
+void OTAUpdater::setPaused(bool paused)
+{
+    if (paused_.exchange(paused) == paused)
+        return;
+    ESP_LOGI(TAG, "OTA %s", paused ? "paused" : "resumed");
+    if (paused)
+        return;
+    if (writer_task)
+        xTaskNotifyGive(writer_task);
+    if (fetch_task)
+        xTaskNotifyGive(fetch_task);
+}
+
+void OTAUpdater::pace(size_t bytes, int64_t &pace_us)
+{
+    const uint32_t rate = rate_limit_;
+    const int64_t now = esp_timer_get_time();
+    if (!rate)
+    {
+        pace_us = now;
+        return;
+    }
+    // Deadline advances by the time these bytes are worth; never banks idle time
+    pace_us = std::max(pace_us, now) + static_cast<int64_t>(bytes) * 1000000 / rate;
+    if (pace_us > now)
+        vTaskDelay(pdMS_TO_TICKS((pace_us - now) / 1000));
+}
+
+// ============================================================================
+// HTTP(S) download: ranged GETs → writer pool
+// ============================================================================
+bool OTAUpdater::startDownload(const OtaDownload &req, DoneCallback done)
+{
+    if (fetch_task || updating)
+    {
+        ESP_LOGW(TAG, "Update already in progress");
+        return false;
+    }
+    if (req.url.empty() || req.size == 0 || req.chunk_size == 0 || !isSha256Hex(req.sha256))
+    {
+        ESP_LOGE(TAG, "HTTP OTA needs url, size and sha256");
+        return false;
+    }
+
+    download_req = req;
+    download_done = std::move(done);
+    fetch_cancel = false;
+    fetch_resumes = 0;
+    if (!TaskPlan::instance().spawn(TaskPlan::OTA_FETCH, &OTAUpdater::fetchTaskEntry, this, &fetch_task))
+    {
+        fetch_task = nullptr;
+        download_done = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void OTAUpdater::cancelDownload()
+{
+    if (!fetch_task)
+        return;
+    fetch_cancel = true;
+    xTaskNotifyGive(fetch_task); // cut a reconnect backoff short
+}
+
+void OTAUpdater::fetchTaskEntry(void *arg)
+{
+    auto *self = static_cast<OTAUpdater *>(arg);
+    std::string msg;
+    const bool ok = self->fetchImage(msg);
+
+    DoneCallback done = std::move(self->download_done);
+    self->fetch_task = nullptr;
+    if (done)
+        done(ok, msg);
+    vTaskDelete(nullptr);
+}
+
+bool OTAUpdater::fetchImage(std::string &msg)
+{
+    const OtaDownload &req = download_req;
+    if (!beginUpdate(req.size, req.sha256, req.chunk_size, req.window, req.encoding))
+    {
+        msg = "OTA begin failed";
+        return false;
+    }
+    std::unique_ptr<uint8_t[]> buf(new (std::nothrow) uint8_t[pool_chunk]);
+    if (!buf)
+    {
+        msg = "No RAM for the download buffer";
+        return false;
+    }
+
+    const int64_t t0 = esp_timer_get_time();
+    uint32_t got = 0;  // stream bytes received (in the pool or buf)
+    uint32_t seq = 0;  // next writer chunk
+    size_t fill = 0;   // bytes of chunk seq in buf
+    uint8_t failures = 0;
+    for (;;)
+    {
+        const uint32_t before = got;
+        bool fatal = false;
+        if (fetchRange(buf.get(), got, seq, fill, fatal, msg))
+            break;
+        if (fetch_cancel)
+        {
+            msg = "cancelled";
+            return false;
+        }
+        if (fatal)
+            return false;
+        if (paused_)
+        {
+            // Voice turn: connection closed, resume from `got` afterwards
+            ESP_LOGI(TAG, "Download paused at %u/%u B", (unsigned)got, (unsigned)req.size);
+            while (paused_ && !fetch_cancel)
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+            failures = 0;
+            continue;
+        }
+
+        failures = got > before ? 1 : failures + 1;
+        if (failures > FETCH_RETRIES)
+        {
+            msg = "Download stalled at " + std::to_string(got) + " B";
+            return false;
+        }
+        const uint32_t backoff = std::min(FETCH_BACKOFF_MS << (failures - 1), FETCH_BACKOFF_MAX_MS);
+        fetch_resumes++;
+        ESP_LOGW(TAG, "Download interrupted at %u/%u B, resuming in %u ms", (unsigned)got,
+                 (unsigned)req.size, (unsigned)backoff);
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(backoff));
+    }
+
+    const uint32_t ms = static_cast<uint32_t>((esp_timer_get_time() - t0) / 1000);
+    ESP_LOGI(TAG, "Downloaded %u B in %u ms (%u KB/s, %u resumes)", (unsigned)got, (unsigned)ms,
+             (unsigned)(ms ? got / ms : 0), (unsigned)fetch_resumes);
+    msg = "Download complete";
+    return true;
+}
+
+bool OTAUpdater::fetchRange(uint8_t *buf, uint32_t &got, uint32_t &seq, size_t &fill, bool &fatal, std::string &msg)
+{
+    const OtaDownload &req = download_req;
+
+    esp_http_client_config_t cfg = {};
+    cfg.url = req.url.c_str();
+    cfg.timeout_ms = FETCH_TIMEOUT_MS;
+    cfg.buffer_size = static_cast<int>(pool_chunk); // large socket reads
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+    cfg.crt_bundle_attach = esp_crt_bundle_attach;
+#endif
+    esp_http_client_handle_t http = esp_http_client_init(&cfg);
+    if (!http)
+        return false;
+
+    char range[32];
+    snprintf(range, sizeof(range), "bytes=%u-", (unsigned)got);
+    esp_http_client_set_header(http, "Range", range);
+
+    do
+    {
+        if (esp_http_client_open(http, 0) != ESP_OK)
+        {
+            ESP_LOGW(TAG, "GET firmware failed (offset %u)", (unsigned)got);
+            break;
+        }
+        const int64_t len = esp_http_client_fetch_headers(http);
+        const int status = esp_http_client_get_status_code(http);
+        // 200 is only good from offset 0: a server ignoring Range would
+        // replay the image from its first byte
+        if (status != 206 && !(status == 200 && got == 0))
+        {
+            // 4xx (expired signature, gone) or Range ignored: give up; 5xx: retry
+            fatal = status > 0 && status < 500;
+            msg = status == 200 ? "Server does not support Range" : "HTTP " + std::to_string(status);
+            ESP_LOGE(TAG, "Firmware GET at %u B: HTTP %d", (unsigned)got, status);
+            break;
+        }
+        if (len > 0 && len != static_cast<int64_t>(req.size - got))
+        {
+            fatal = true;
+            msg = "Length mismatch";
+            ESP_LOGE(TAG, "Firmware length %lld B from offset %u, expected %u", (long long)len, (unsigned)got,
+                     (unsigned)(req.size - got));
+            break;
+        }
+
+        int64_t pace_us = 0;
+        while (got < req.size && !fetch_cancel && !paused_)
+        {
+            const size_t want = std::min<size_t>(pool_chunk - fill, req.size - got);
+            const int n = esp_http_client_read(http, reinterpret_cast<char *>(buf + fill), want);
+            if (n <= 0)
+                break;
+            fill += n;
+            got += n;
+            if (fill == pool_chunk || got == req.size)
+            {
+                if (!submitBlocking(seq, buf, fill))
+                {
+                    fatal = !fetch_cancel;
+                    msg = "Flash write failed";
+                    break;
+                }
+                seq++;
+                pace(fill, pace_us);
+                fill = 0;
+            }
+        }
+    } while (false);
+
+    esp_http_client_close(http);
+    esp_http_client_cleanup(http);
+    return got == req.size && fill == 0;
+}
+
+bool OTAUpdater::submitBlocking(uint32_t seq, const uint8_t *data, size_t size)
+{
+    // Window full = flash is the bottleneck: stop reading, TCP flow control
+    // holds the server back
+    for (;;)
+    {
+        switch (submitChunk(seq, data, size))
+        {
+        case OtaChunkStatus::ACCEPTED:
+        case OtaChunkStatus::DUPLICATE:
+            return true;
+        case OtaChunkStatus::BUSY:
+            if (fetch_cancel)
+                return false;
+            if (paused_)
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000)); // setPaused(false) wakes
+            else
+                vTaskDelay(pdMS_TO_TICKS(5));
+            break;
+        case OtaChunkStatus::FAILED:
+        default:
+            return false;
+        }
+    }
+}
+
 bool OTAUpdater::validateFirmware() {
     if (!update_partition) {
         ESP_LOGE(TAG, "No update partition");
@@ -1,13 +1,54 @@
 #pragma once
+#include <atomic>
 #include <memory>
 #include <functional>
 #include <string>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "esp_ota_ops.h"
 #include "mbedtls/sha256.h"
+#include "HeatshrinkDecoder.hpp"
+
+// Result of handing one received OTA chunk to the writer (submitChunk()).
+enum class OtaChunkStatus : uint8_t
+{
+    ACCEPTED,  // queued for flash (or already written)
+    DUPLICATE, // seq seen before; ACK again, nothing stored
+    BUSY,      // outside the writer window / pool full: resend later
+    FAILED     // update not running or flash write failed: abort
+};
+
+// Encoding of the OTA byte stream (request_ota "encoding"). The SHA-256 and
+// image checks always apply to the decoded image.
+struct OtaEncoding
+{
+    enum Type : uint8_t
+    {
+        RAW,       // plain .bin
+        HEATSHRINK // heatshrink LZSS, decoded on the flash write path
+    };
+    Type type = RAW;
+    uint8_t window_sz2 = 11;   // heatshrink -w
+    uint8_t lookahead_sz2 = 4; // heatshrink -l
+    size_t image_size = 0;     // decoded size (HEATSHRINK); RAW uses the stream size
+};
+
+// Image pulled over HTTP(S) by the updater itself (request_ota "url"): MQTT
+// only carries the request and the result. size and sha256 are mandatory,
+// they are the only checks on what the server streams.
+struct OtaDownload
+{
+    std::string url;          // http(s)://, may be a signed (expiring) CDN URL
+    size_t size = 0;          // stream bytes
+    std::string sha256;       // hex digest of the decoded image
+    OtaEncoding encoding{};
+    size_t chunk_size = 4096; // bytes per read / writer buffer (one flash sector)
+    size_t window = 4;        // writer buffers
+};
 
 // OTAUpdater manages firmware update writes to the OTA partition, validates
-// the image, and reports progress. AppController orchestrates it; downloading
-// firmware remains in NetworkManager.
+// the image, and reports progress. AppController orchestrates it; the image
+// arrives as MQTT chunks from NetworkManager or is fetched here over HTTP(S).
 class OTAUpdater {
 public:
     OTAUpdater() = default;
@@ -29,19 +70,60 @@ public:
 
     // ======= OTA Control =======
     // Begin OTA update. Requires total size (bytes) and optional expected SHA-256 (hex string).
-    bool beginUpdate(size_t total_size, const std::string &expected_sha256 = "");
+    // chunk_size > 0 starts the pipelined writer: `window` preallocated chunk
+    // buffers feed a writer task, so esp_ota_write (sector erase + program)
+    // overlaps the network receive. chunk_size = 0 keeps synchronous writeChunk().
+    // total_size is the stream size; with a compressed `encoding` the chunks
+    // are decoded before esp_ota_write and encoding.image_size is flashed.
+    bool beginUpdate(size_t total_size, const std::string &expected_sha256 = "",
+                     size_t chunk_size = 0, size_t window = 8,
+                     const OtaEncoding &encoding = OtaEncoding{});
 
     // Write a data chunk to OTA partition; returns bytes written or -1 on error.
+    // Synchronous path only (beginUpdate without chunk_size). Counts stream
+    // bytes (compressed input is accepted whole).
     int writeChunk(const uint8_t* data, size_t size);
 
+    // Pipelined path: copy chunk `seq` (offset seq * chunk_size) into a pool
+    // buffer and wake the writer. Chunks may arrive out of order inside the
+    // window; they reach flash in order. Safe from one producer task.
+    OtaChunkStatus submitChunk(uint32_t seq, const uint8_t* data, size_t size);
+
+    // Chunk buffers actually allocated (may be < requested on low RAM).
+    size_t pipelineWindow() const { return pool_slots; }
+
     // Finish OTA update, validate, and set boot partition; returns false on failure.
     bool finishUpdate();
 
     // Abort the ongoing OTA update and reset counters.
     void abortUpdate();
 
+    // ======= HTTP(S) download =======
+    using DoneCallback = std::function<void(bool ok, const std::string &msg)>;
+    // Fetch req on the OtaFetch task: beginUpdate (pipelined writer), then
+    // ranged GETs streamed into the writer pool. A dropped connection
+    // resumes with "Range: bytes=<received>-" (every byte received is already
+    // in the pool or the read buffer), backing off while it makes no
+    // progress. done() runs on that task; on success call finishUpdate(),
+    // else abortUpdate().
+    bool startDownload(const OtaDownload &req, DoneCallback done);
+    // Stop at the next read; done(false, "cancelled") follows.
+    void cancelDownload();
+    bool isDownloading() const { return fetch_task != nullptr; }
+
+    // ======= Background mode =======
+    // Paused: the writer stops flashing (flash writes stall the cache on both
+    // cores), submitChunk() answers BUSY and a download closes its
+    // connection, resuming with a Range request once unpaused. Set while a
+    // voice turn runs; wakes both tasks on resume.
+    void setPaused(bool paused);
+    bool isPaused() const { return paused_; }
+    // Download pace cap in bytes/s (0 = as fast as flash allows)
+    void setRateLimit(uint32_t bytes_per_s) { rate_limit_ = bytes_per_s; }
+
     // ======= Status =======
     bool isUpdating() const { return updating; }
+    bool isPipelined() const { return pool_slots > 0; }
     uint32_t getExpectedSize() const { return total_bytes; }
     std::string getExpectedChecksum() const { return expected_sha256_hex; }
     uint32_t getBytesWritten() const { return bytes_written; }
@@ -64,12 +146,13 @@ private:
     // ======= Internal state =======
     bool updating = false;
     uint32_t bytes_written = 0;
-    uint32_t total_bytes = 0;
+    uint32_t total_bytes = 0;   // image bytes to flash
+    uint32_t stream_total = 0;  // bytes on the wire (== total_bytes for RAW)
+    uint32_t stream_consumed = 0;
     std::string expected_sha256_hex;
     bool checksum_enabled = false;
-
-    // NOTE: SHA256 is calculated after download by reading from flash
-    // This avoids hardware SHA engine conflicts with WebSocket TLS
+    // Running digest of the bytes written so far (valid while checksum_enabled)
+    mbedtls_sha256_context sha_ctx{};
 
     // ======= ESP32 OTA handle =======
     esp_ota_handle_t update_handle = 0;
@@ -78,6 +161,64 @@ private:
     // ======= Callback =======
     ProgressCallback progress_callback;
 
+    // ======= Compressed stream =======
+    OtaEncoding encoding;
+    HeatshrinkDecoder inflater;
+    uint8_t *inflate_buf = nullptr;          // decoded bytes waiting for flash (arena block)
+    std::unique_ptr<uint8_t[]> inflate_heap; // inflate_buf when the OTA arena is short
+    size_t inflate_fill = 0;
+
+    // ======= Pipelined writer =======
+    // Slot i holds chunk seq with seq % pool_slots == i while
+    // write_seq <= seq < write_seq + pool_slots.
+    struct Slot
+    {
+        std::atomic<bool> filled{false};
+        uint32_t seq = 0;
+        size_t len = 0;
+    };
+    uint8_t *pool = nullptr;              // arena block, else pool_heap
+    std::unique_ptr<uint8_t[]> pool_heap;
+    std::unique_ptr<Slot[]> slots;
+    size_t pool_slots = 0;
+    size_t pool_chunk = 0;
+    std::atomic<uint32_t> write_seq{0}; // next chunk the writer flashes
+    std::atomic<bool> writer_failed{false};
+    std::atomic<bool> writer_run{false};
+    TaskHandle_t writer_task = nullptr;
+    std::atomic<bool> paused_{false};
+    std::atomic<uint32_t> rate_limit_{0};
+
+    bool startWriter(size_t chunk_size, size_t window);
+    void stopWriter();
+    void releasePool();
+    void releaseInflate();
+    // Wait until every submitted chunk is on flash (false on timeout/failure).
+    bool waitWriterIdle(uint32_t timeout_ms);
+    static void writerTaskEntry(void* arg);
+    void writerTaskLoop();
+    bool flashWrite(const uint8_t* data, size_t size);
+    // Stream bytes in order → (decoder) → flashWrite
+    bool consume(const uint8_t* data, size_t size);
+    bool flushInflate();
+
+    // ======= HTTP(S) fetch =======
+    OtaDownload download_req;
+    DoneCallback download_done;
+    std::atomic<bool> fetch_cancel{false};
+    TaskHandle_t fetch_task = nullptr;
+    uint32_t fetch_resumes = 0;
+
+    static void fetchTaskEntry(void* arg);
+    bool fetchImage(std::string &msg);
+    // One ranged GET from `got`; true once the whole stream is in. fatal:
+    // retrying cannot help (HTTP error, no Range support, writer failed).
+    bool fetchRange(uint8_t* buf, uint32_t &got, uint32_t &seq, size_t &fill, bool &fatal, std::string &msg);
+    // submitChunk, waiting while the writer window is full or paused
+    bool submitBlocking(uint32_t seq, const uint8_t* data, size_t size);
+    // Sleep so the download stays under rate_limit_ (pace_us: running deadline)
+    void pace(size_t bytes, int64_t &pace_us);
+
     // ======= Helper functions =======
     bool validateFirmware();
     void reportProgress();
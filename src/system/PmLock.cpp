@@ -0,0 +1,48 @@
+#include "PmLock.hpp"
+
+#include "esp_log.h"
+
+static const char *TAG = "PmLock";
+
+PmLock::~PmLock()
+{
+    destroy();
+}
+
+bool PmLock::create(esp_pm_lock_type_t type, const char *name)
+{
+    if (handle_)
+        return true;
+    esp_err_t err = esp_pm_lock_create(type, 0, name, &handle_);
+    if (err != ESP_OK)
+    {
+        // ESP_ERR_NOT_SUPPORTED: CONFIG_PM_ENABLE off, stay a no-op
+        if (err != ESP_ERR_NOT_SUPPORTED)
+            ESP_LOGW(TAG, "%s: esp_pm_lock_create failed: %s", name, esp_err_to_name(err));
+        handle_ = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void PmLock::destroy()
+{
+    if (!handle_)
+        return;
+    hold(false);
+    esp_pm_lock_delete(handle_);
+    handle_ = nullptr;
+}
+
+void PmLock::hold(bool busy)
+{
+    if (!handle_)
+        return;
+    // Only the caller that flips the flag touches esp_pm
+    if (held_.exchange(busy, std::memory_order_acq_rel) == busy)
+        return;
+    if (busy)
+        esp_pm_lock_acquire(handle_);
+    else
+        esp_pm_lock_release(handle_);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atomic>
+
+#include "esp_pm.h"
+
+/**
+ * PmLock
+ * ============================================================================
+ * esp_pm lock giữ trong "busy period" của một module (CPU ở max, không light
+ * sleep). Build không bật CONFIG_PM_ENABLE: create() thất bại và mọi lời gọi
+ * là no-op, nên module không cần #ifdef.
+ *
+ * hold() idempotent: module chỉ cần phản chiếu cờ busy của mình vào lock ở
+ * mỗi lần đổi trạng thái, acquire/release của esp_pm luôn cân bằng.
+ */
+class PmLock
+{
+public:
+    PmLock() = default;
+    ~PmLock();
+
+    PmLock(const PmLock &) = delete;
+    PmLock &operator=(const PmLock &) = delete;
+
+    // name must outlive the lock (string literal); false if PM is unavailable
+    bool create(esp_pm_lock_type_t type, const char *name);
+    void destroy();
+
+    void hold(bool busy);
+    bool held() const { return held_.load(std::memory_order_relaxed); }
+
+private:
+    esp_pm_lock_handle_t handle_ = nullptr;
+    std::atomic<bool> held_{false};
+};
@@ -3,6 +3,8 @@
 #include "AppController.hpp"
 #include "../../lib/power/Power.hpp"        // Power driver implementation
 #include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
 
 static const char* TAG = "PowerManager";
 
@@ -11,6 +13,9 @@ PowerManager::PowerManager(std::unique_ptr<Power> power, const Config& cfg)
 
 PowerManager::~PowerManager() {
     stop();
+    auto& sm = StateManager::instance();
+    if (sub_inter != -1) sm.unsubscribeInteraction(sub_inter);
+    if (sub_sys != -1) sm.unsubscribeSystem(sub_sys);
 }
 
 bool PowerManager::init() {
@@ -19,6 +24,9 @@ bool PowerManager::init() {
         return false;
     }
 
+    power->setOversampling(config.adc_oversample);
+    period_ms = config.evaluate_interval_ms;
+
     timer = xTimerCreate(
         "PowerManagerTimer",
         pdMS_TO_TICKS(config.evaluate_interval_ms),
@@ -32,9 +40,72 @@ bool PowerManager::init() {
         return false;
     }
 
+    pm_enabled = configurePm();
+    if (pm_enabled) {
+        // Synchronous (no mailbox): the profile switches inside the setter's
+        // call, not one task hop later
+        auto& sm = StateManager::instance();
+        sub_inter = sm.subscribeInteraction(
+            [this](state::InteractionState, state::InputSource) { applyProfile(); });
+        sub_sys = sm.subscribeSystem(
+            [this](state::SystemState) { applyProfile(); });
+        applyProfile();
+    }
+
     return true;
 }
 
+// ============================================================================
+// Power profiles
+// ============================================================================
+bool PowerManager::configurePm() {
+    esp_pm_config_esp32_t pm = {};
+    pm.max_freq_mhz = config.active_cpu_mhz;
+    pm.min_freq_mhz = config.idle_cpu_mhz;
+    pm.light_sleep_enable = config.idle_light_sleep;
+
+    esp_err_t err = esp_pm_configure(&pm);
+    if (err == ESP_ERR_NOT_SUPPORTED) {
+        ESP_LOGI(TAG, "Power management not enabled in this build (CONFIG_PM_ENABLE)");
+        return false;
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "esp_pm_configure(%d..%d MHz) failed: %s",
+                 config.idle_cpu_mhz, config.active_cpu_mhz, esp_err_to_name(err));
+        return false;
+    }
+    if (!profile_lock.create(ESP_PM_CPU_FREQ_MAX, "profile_active")) {
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Power profiles: idle %d MHz%s, active %d MHz",
+             config.idle_cpu_mhz, config.idle_light_sleep ? " + light sleep" : "",
+             config.active_cpu_mhz);
+    return true;
+}
+
+void PowerManager::applyProfile() {
+    auto& sm = StateManager::instance();
+    bool active = false;
+    switch (sm.getInteractionState()) {
+    case state::InteractionState::TRIGGERED:
+    case state::InteractionState::LISTENING:
+    case state::InteractionState::PROCESSING:
+    case state::InteractionState::SPEAKING:
+        active = true;
+        break;
+    default:
+        break;
+    }
+    if (sm.getSystemState() == state::SystemState::UPDATING_FIRMWARE) {
+        active = true;
+    }
+
+    if (active == profile_lock.held()) return;
+    profile_lock.hold(active);
+    ESP_LOGI(TAG, "Power profile: %s", active ? "active" : "idle");
+}
+
 void PowerManager::start() {
     if (started) return;
     started = true;
@@ -71,11 +142,10 @@ void PowerManager::timerCallback() {
     if (!power) return;
 
     float voltage = power->getVoltage();
-    uint8_t percent = power->getBatteryPercent();
     uint8_t charging = power->isCharging();
     uint8_t full = power->isFull();
 
-    if (voltage < 0.0f || percent == BATTERY_INVALID) {
+    if (voltage < 0.0f) {
         battery_present = false;
         publishIfChanged(state::PowerState::ERROR);
         return;
@@ -83,21 +153,23 @@ void PowerManager::timerCallback() {
 
     battery_present = true;
     last_voltage = voltage;
+    ui_charging = (charging == 1);
+    ui_full = (full == 1);
+
+    // Terminal voltage sags by I*R under load: back out the resting voltage
+    const uint16_t load_ma = loadCurrentMa();
+    const float ocv = ui_charging ? voltage : voltage + load_ma * 0.001f * config.internal_ohm;
+    const float ocv_percent = Power::ocvToPercent(ocv);
 
+    const int64_t now_us = esp_timer_get_time();
+    const float dt_s = last_sample_us ? (now_us - last_sample_us) / 1e6f : 0.0f;
+    last_sample_us = now_us;
+
+    float pct = ocv_percent;
     if (config.enable_smoothing) {
-        if (first_sample) {
-            last_percent = percent;
-            first_sample = false;
-        } else {
-            float smoothed = last_percent + config.smoothing_alpha * (percent - last_percent);
-            last_percent = static_cast<uint8_t>(smoothed);
-        }
-    } else {
-        last_percent = percent;
+        pct = estimate(ocv_percent, load_ma, ui_charging, dt_s);
     }
-
-    ui_charging = (charging == 1);
-    ui_full = (full == 1);
+    last_percent = static_cast<uint8_t>(pct + 0.5f);
 
     // ✅ Percent tracking: changes published via state machine, not events
     // DisplayManager subscribes PowerState directly and reads battery from power manager
@@ -111,9 +183,72 @@ void PowerManager::timerCallback() {
 
     auto newState = evaluateState(last_voltage, last_percent, charging, full);
     publishIfChanged(newState);
+
+    adaptInterval(ui_charging);
 }
 
+// ============================================================================
+// State of charge estimator
+// ============================================================================
+uint16_t PowerManager::loadCurrentMa() const {
+    switch (StateManager::instance().getInteractionState()) {
+    case state::InteractionState::SPEAKING:
+        return config.load_speaking_ma;
+    case state::InteractionState::TRIGGERED:
+    case state::InteractionState::LISTENING:
+    case state::InteractionState::PROCESSING:
+        return config.load_active_ma;
+    default:
+        return config.load_idle_ma;
+    }
+}
+
+float PowerManager::estimate(float ocv_percent, uint16_t load_ma, bool charging, float dt_s) {
+    if (first_sample) {
+        first_sample = false;
+        soc = ocv_percent;
+        soc_var = config.meas_var;
+        return soc;
+    }
 
+    // Predict: coulomb counting with the modelled load. Charge current is
+    // unknown (TP4056 only reports the phase): let the measurement lead
+    if (charging) {
+        soc_var += config.process_var * 20.0f;
+    } else {
+        const float capacity_mas = config.capacity_mah * 3600.0f;
+        if (capacity_mas > 0.0f) {
+            soc -= load_ma * dt_s / capacity_mas * 100.0f;
+        }
+        soc_var += config.process_var;
+    }
+
+    // Update with the IR-compensated OCV reading
+    const bool speaking = load_ma >= config.load_speaking_ma;
+    const float r = speaking ? config.meas_var_speaking : config.meas_var;
+    const float k = soc_var / (soc_var + r);
+    soc += k * (ocv_percent - soc);
+    soc_var *= (1.0f - k);
+
+    if (soc < 0.0f) soc = 0.0f;
+    if (soc > 100.0f) soc = 100.0f;
+    return soc;
+}
+
+void PowerManager::adaptInterval(bool charging) {
+    if (!started || !timer || config.steady_interval_ms == 0) return;
+
+    // Keep the fast rate while anything can still move quickly
+    const bool settled = config.enable_smoothing && soc_var < config.settled_var;
+    const bool fast = !settled || charging ||
+                      last_percent <= config.critical_percent + 10.0f;
+    const uint32_t want = fast ? config.evaluate_interval_ms : config.steady_interval_ms;
+    if (want == period_ms) return;
+
+    period_ms = want;
+    xTimerChangePeriod(timer, pdMS_TO_TICKS(want), 0);
+    ESP_LOGD(TAG, "Battery sampling every %u ms", (unsigned)want);
+}
 
 state::PowerState PowerManager::evaluateState(float volt,
                                              uint8_t percent,
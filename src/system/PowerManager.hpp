@@ -3,6 +3,7 @@
 #include <memory>
 #include "StateTypes.hpp"
 #include "StateManager.hpp"
+#include "PmLock.hpp"
 #include "freertos/FreeRTOS.h"
 #include "freertos/timers.h"
 
@@ -11,14 +12,40 @@ class DisplayManager;
 
 // Monitors battery voltage/percent, smooths readings, infers power state, and
 // publishes changes to StateManager; optionally updates DisplayManager with %.
+// Percent comes from a 1-state Kalman filter: coulomb-style prediction from
+// the estimated load current of the interaction state, corrected by the
+// oversampled voltage compensated for IR drop (OCV curve). Speaker sag is
+// both compensated and trusted less, so it cannot fake a CRITICAL. Sampling
+// slows to steady_interval_ms once the estimate has settled.
+// Also owns the device power profile (esp_pm): DFS between idle_cpu_mhz and
+// active_cpu_mhz with automatic light sleep, and a profile lock that pins the
+// CPU at max while a voice turn or firmware update is in progress. Modules
+// hold their own PmLock around busy periods on top of that.
 class PowerManager {
 public:
     struct Config {
-        uint32_t evaluate_interval_ms = 2000;
+        uint32_t evaluate_interval_ms = 2000; // fast: boot, charging, low battery, not settled
+        uint32_t steady_interval_ms = 30000;  // settled estimate (0 = always fast)
         // float low_battery_percent = 20.0f;
         float critical_percent = 8.0f;
-        bool enable_smoothing = true;
-        float smoothing_alpha = 0.15f;
+        bool enable_smoothing = true; // Kalman estimator (false: raw OCV percent)
+        uint8_t adc_oversample = 64;  // conversions per reading
+
+        // Battery model
+        uint32_t capacity_mah = 1000;
+        float internal_ohm = 0.15f;        // cell + protection + wiring
+        uint16_t load_idle_ma = 60;        // IDLE / MUTED, radio in modem sleep
+        uint16_t load_active_ma = 130;     // listening / processing, radio busy
+        uint16_t load_speaking_ma = 320;   // amplifier driving the speaker
+        float meas_var = 9.0f;             // OCV percent noise (%^2), ~±3 %
+        float meas_var_speaking = 100.0f;  // under speaker load the model is rough
+        float process_var = 0.05f;         // per sample (%^2), model error
+        float settled_var = 2.0f;          // P below this = steady sampling
+
+        // Power profiles (no-op unless CONFIG_PM_ENABLE)
+        int active_cpu_mhz = 240;     // TRIGGERED..SPEAKING, UPDATING_FIRMWARE
+        int idle_cpu_mhz = 80;        // IDLE / MUTED / SLEEPING
+        bool idle_light_sleep = true; // automatic light sleep when nothing holds a lock
     };
 
 public:
@@ -46,6 +73,9 @@ public:
     // Force an immediate power evaluation (runs one sample now).
     void sampleNow();
 
+    // True while the active profile (CPU at max) is held.
+    bool isActiveProfile() const { return profile_lock.held(); }
+
     // Link DisplayManager for battery % updates.
     void setDisplayManager(DisplayManager* display) { display_mgr = display; }
 
@@ -60,7 +90,17 @@ private:
 
     void publishIfChanged(state::PowerState st);
 
-    uint8_t applySmoothing(uint8_t percent);
+    // Estimated battery current for the current interaction state (mA)
+    uint16_t loadCurrentMa() const;
+    // One Kalman step; returns the filtered state of charge (0..100)
+    float estimate(float ocv_percent, uint16_t load_ma, bool charging, float dt_s);
+    // Fast or steady timer period
+    void adaptInterval(bool charging);
+
+    // esp_pm_configure + profile lock; false when PM is not in this build
+    bool configurePm();
+    // Re-evaluate the profile from the current interaction / system state
+    void applyProfile();
 
 private:
     std::unique_ptr<Power> power;
@@ -81,6 +121,18 @@ private:
 
     bool first_sample = true;
 
+    // Estimator
+    float soc = 0.0f;       // state of charge estimate (%)
+    float soc_var = 100.0f; // its variance (%^2)
+    int64_t last_sample_us = 0;
+    uint32_t period_ms = 0; // timer period in use
+
     // Display manager link for battery % updates
     DisplayManager* display_mgr = nullptr;
+
+    // Power profile
+    PmLock profile_lock;
+    bool pm_enabled = false;
+    int sub_inter = -1;
+    int sub_sys = -1;
 };
@@ -0,0 +1,274 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "esp_log.h"
+#include "esp_rom_sys.h"
+
+static const char *TAG = "Profiler";
+
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+#define PTALK_TASK_STATS 1
+#else
+#define PTALK_TASK_STATS 0
+#endif
+
+namespace
+{
+#if PTALK_TASK_STATS
+    // uxTaskGetSystemState() output; only touched by the sampleTasks() owner
+    TaskStatus_t s_status[Profiler::MAX_TASKS];
+#endif
+
+    uint32_t cyclesToUs(uint64_t cycles)
+    {
+        // Current CPU clock: approximate while DFS (PmLock) is switching
+        const uint32_t per_us = esp_rom_get_cpu_ticks_per_us();
+        return per_us ? static_cast<uint32_t>(cycles / per_us) : 0;
+    }
+} // namespace
+
+Profiler &Profiler::instance()
+{
+    static Profiler inst;
+    return inst;
+}
+
+// ============================================================================
+// Probes
+// ============================================================================
+void Profiler::record(Probe p, uint32_t cycles)
+{
+    if (p >= PROBE_COUNT)
+        return;
+    portENTER_CRITICAL(&lock_);
+    ProbeStats &s = probes_[p];
+    s.count++;
+    s.total_cycles += cycles;
+    if (cycles > s.max_cycles)
+        s.max_cycles = cycles;
+    portEXIT_CRITICAL(&lock_);
+}
+
+Profiler::ProbeStats Profiler::probe(Probe p) const
+{
+    ProbeStats s;
+    if (p >= PROBE_COUNT)
+        return s;
+    portENTER_CRITICAL(&lock_);
+    s = probes_[p];
+    portEXIT_CRITICAL(&lock_);
+    return s;
+}
+
+void Profiler::clearProbes()
+{
+    portENTER_CRITICAL(&lock_);
+    for (ProbeStats &s : probes_)
+        s = ProbeStats{};
+    portEXIT_CRITICAL(&lock_);
+}
+
+const char *Profiler::probeName(Probe p)
+{
+    switch (p)
+    {
+    case AEC:
+        return "aec";
+    case NS_AGC:
+        return "ns_agc";
+    case MIC_PROCESS:
+        return "mic_process";
+    case KWS_FEED:
+        return "kws_feed";
+    case DECODE:
+        return "decode";
+    case SPK_WRITE:
+        return "spk_write";
+    case RENDER:
+        return "render";
+    case UPLINK_SEND:
+        return "uplink_send";
+    default:
+        return "?";
+    }
+}
+
+// ============================================================================
+// Task load (FreeRTOS run-time stats)
+// ============================================================================
+bool Profiler::taskStatsAvailable()
+{
+    return PTALK_TASK_STATS;
+}
+
+bool Profiler::sampleTasks()
+{
+#if PTALK_TASK_STATS
+    if (sampling_.exchange(true, std::memory_order_acquire))
+        return false;
+
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    const UBaseType_t n = uxTaskGetSystemState(s_status, MAX_TASKS, &total);
+    if (n == 0)
+        ESP_LOGW(TAG, "More than %u tasks, load not sampled", (unsigned)MAX_TASKS);
+
+    // tasks_ is only written here (under sampling_), so it is read as the
+    // previous sample without the lock
+    const uint32_t window = static_cast<uint32_t>(total) - total_runtime_;
+
+    TaskHandle_t idle[2] = {xTaskGetIdleTaskHandleForCore(0), xTaskGetIdleTaskHandleForCore(1)};
+    uint16_t busy[2] = {1000, 1000};
+
+    static TaskLoad next[MAX_TASKS];
+    for (UBaseType_t i = 0; i < n; i++)
+    {
+        const TaskStatus_t &st = s_status[i];
+        TaskLoad &t = next[i];
+        t = TaskLoad{};
+        t.handle = st.xHandle;
+        strncpy(t.name, st.pcTaskName, sizeof(t.name) - 1);
+        const BaseType_t core = xTaskGetAffinity(st.xHandle);
+        t.core = (core == 0 || core == 1) ? static_cast<int8_t>(core) : -1;
+        t.priority = static_cast<uint8_t>(st.uxCurrentPriority);
+        t.runtime = static_cast<uint32_t>(st.ulRunTimeCounter);
+
+        // Same handle in the last sample → delta; new task → since creation
+        uint32_t base = 0;
+        for (size_t k = 0; k < task_count_; k++)
+        {
+            if (tasks_[k].handle == t.handle)
+            {
+                base = tasks_[k].runtime;
+                break;
+            }
+        }
+        const uint32_t ran = t.runtime - base;
+        t.load_pm = window ? static_cast<uint16_t>(std::min<uint64_t>(1000, uint64_t(ran) * 1000 / window)) : 0;
+
+        for (int c = 0; c < 2; c++)
+            if (t.handle == idle[c])
+                busy[c] = static_cast<uint16_t>(1000 - t.load_pm);
+    }
+
+    portENTER_CRITICAL(&lock_);
+    memcpy(tasks_, next, sizeof(tasks_));
+    task_count_ = n;
+    total_runtime_ = static_cast<uint32_t>(total);
+    window_us_ = window;
+    busy_pm_[0] = busy[0];
+    busy_pm_[1] = busy[1];
+    portEXIT_CRITICAL(&lock_);
+
+    sampling_.store(false, std::memory_order_release);
+    return n > 0;
+#else
+    return false;
+#endif
+}
+
+// ============================================================================
+// Reports
+// ============================================================================
+void Profiler::writeReport(jsonlite::Writer &w) const
+{
+    TaskLoad tasks[MAX_TASKS];
+    ProbeStats probes[PROBE_COUNT];
+    portENTER_CRITICAL(&lock_);
+    memcpy(tasks, tasks_, sizeof(tasks));
+    memcpy(probes, probes_, sizeof(probes));
+    const size_t count = task_count_;
+    const uint32_t window = window_us_;
+    const uint16_t busy0 = busy_pm_[0], busy1 = busy_pm_[1];
+    portEXIT_CRITICAL(&lock_);
+
+    w.beginObject("cpu");
+    if (taskStatsAvailable())
+    {
+        // Percentages with one decimal; task load is a share of one core
+        w.field("window_ms", window / 1000)
+            .fieldFixed("core0", busy0 / 10.0)
+            .fieldFixed("core1", busy1 / 10.0);
+        w.beginObject("tasks");
+        for (size_t i = 0; i < count; i++)
+        {
+            const TaskLoad &t = tasks[i];
+            w.beginObject(t.name)
+                .field("core", static_cast<int32_t>(t.core))
+                .field("prio", static_cast<uint32_t>(t.priority))
+                .fieldFixed("load", t.load_pm / 10.0)
+                .endObject();
+        }
+        w.endObject();
+    }
+    else
+    {
+        w.field("tasks", "unavailable");
+    }
+
+    // name: {"n": calls, "avg_us", "max_us"}
+    w.beginObject("probes");
+    for (int p = 0; p < PROBE_COUNT; p++)
+    {
+        const ProbeStats &s = probes[p];
+        if (!s.count)
+            continue;
+        w.beginObject(probeName(static_cast<Probe>(p)))
+            .field("n", s.count)
+            .field("avg_us", cyclesToUs(s.total_cycles / s.count))
+            .field("max_us", cyclesToUs(s.max_cycles))
+            .endObject();
+    }
+    w.endObject();
+    w.endObject();
+}
+
+void Profiler::print() const
+{
+    TaskLoad tasks[MAX_TASKS];
+    ProbeStats probes[PROBE_COUNT];
+    portENTER_CRITICAL(&lock_);
+    memcpy(tasks, tasks_, sizeof(tasks));
+    memcpy(probes, probes_, sizeof(probes));
+    const size_t count = task_count_;
+    const uint32_t window = window_us_;
+    const uint16_t busy0 = busy_pm_[0], busy1 = busy_pm_[1];
+    portEXIT_CRITICAL(&lock_);
+
+    if (taskStatsAvailable())
+    {
+        ESP_LOGI(TAG, "window %u ms | core0 busy %u.%u%% | core1 busy %u.%u%%", (unsigned)(window / 1000),
+                 busy0 / 10, busy0 % 10, busy1 / 10, busy1 % 10);
+        ESP_LOGI(TAG, "%-16s %4s %4s %7s", "task", "core", "prio", "load%");
+        for (size_t i = 0; i < count; i++)
+        {
+            const TaskLoad &t = tasks[i];
+            char core[4] = "any";
+            if (t.core >= 0)
+                snprintf(core, sizeof(core), "%d", t.core);
+            ESP_LOGI(TAG, "%-16s %4s %4u %5u.%u", t.name, core, (unsigned)t.priority,
+                     t.load_pm / 10, t.load_pm % 10);
+        }
+    }
+    else
+    {
+        ESP_LOGW(TAG, "Task load needs CONFIG_FREERTOS_USE_TRACE_FACILITY + GENERATE_RUN_TIME_STATS");
+    }
+
+    if (!PTALK_PROFILE)
+    {
+        ESP_LOGI(TAG, "probes: build with -DPTALK_PROFILE=1");
+        return;
+    }
+    ESP_LOGI(TAG, "%-12s %8s %8s %8s", "probe", "calls", "avg us", "max us");
+    for (int p = 0; p < PROBE_COUNT; p++)
+    {
+        const ProbeStats &s = probes[p];
+        if (!s.count)
+            continue;
+        ESP_LOGI(TAG, "%-12s %8u %8u %8u", probeName(static_cast<Probe>(p)), (unsigned)s.count,
+                 (unsigned)cyclesToUs(s.total_cycles / s.count), (unsigned)cyclesToUs(s.max_cycles));
+    }
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "JsonLite.hpp"
+
+// Scoped cycle probes: off by default, PTALK_PROF_SCOPE() then expands to
+// nothing. Build with -DPTALK_PROFILE=1 to measure.
+#ifndef PTALK_PROFILE
+#define PTALK_PROFILE 0
+#endif
+
+#if PTALK_PROFILE
+#include "esp_cpu.h"
+#endif
+
+/**
+ * Profiler
+ * ============================================================================
+ * Đo CPU trên thiết bị để chọn core / priority theo số liệu:
+ *
+ * 1. Probe theo scope: PTALK_PROF_SCOPE(DECODE) đọc esp_cpu_get_ccount()
+ *    lúc vào và lúc ra khỏi scope, cộng vào bảng của probe (số lần, tổng,
+ *    max cycles). Là thời gian thực (wall) của scope trên core đó: bị
+ *    preempt hay block bên trong cũng được tính. Cycle counter là riêng mỗi
+ *    core: task không pin mà chuyển core giữa scope cho một mẫu sai (pin
+ *    display loop khi đo RENDER). PTALK_PROFILE=0 → macro rỗng.
+ *
+ * 2. Tải CPU theo task: FreeRTOS run-time stats (CONFIG_FREERTOS_GENERATE_
+ *    RUN_TIME_STATS, bộ đếm esp_timer). sampleTasks() lấy delta so với lần
+ *    gọi trước, nên mỗi báo cáo là tải trong cửa sổ từ báo cáo trước: % của
+ *    một core cho từng task, và % bận của mỗi core (100 - IDLE).
+ *
+ * Báo cáo: lệnh serial "cpu", MQTT request_cpu (writeReport()).
+ */
+class Profiler
+{
+public:
+    enum Probe : uint8_t
+    {
+        AEC,          // echoCancel (encoder task)
+        NS_AGC,       // VoiceFrontEnd::process: noise suppression + AGC (encoder task)
+        MIC_PROCESS,  // processMicFrame: VAD / gain / encode (encoder task)
+        KWS_FEED,     // feedWakeWord (mic task)
+        DECODE,       // decode + resample of one downlink frame (decoder task)
+        SPK_WRITE,    // writePcm (speaker task; includes waiting on I2S DMA)
+        RENDER,       // AnimationPlayer::render (display task)
+        UPLINK_SEND,  // header + copy + sendBinary of one packet (uplink task)
+        PROBE_COUNT
+    };
+
+    struct ProbeStats
+    {
+        uint32_t count = 0;
+        uint64_t total_cycles = 0;
+        uint32_t max_cycles = 0;
+    };
+
+    static constexpr size_t MAX_TASKS = 24;
+
+    static Profiler &instance();
+
+    // Hot path of a probe scope (PTALK_PROFILE builds only).
+    void record(Probe p, uint32_t cycles);
+    ProbeStats probe(Probe p) const;
+    void clearProbes();
+    static const char *probeName(Probe p);
+
+    // False when the run-time stats are not configured in.
+    static bool taskStatsAvailable();
+    // Load since the previous call (first call: since boot). False if
+    // unavailable or another report is being built.
+    bool sampleTasks();
+
+    // "cpu" member: per-core busy %, per-task load, probe table
+    void writeReport(jsonlite::Writer &w) const;
+    // Same on the log (serial "cpu" command)
+    void print() const;
+
+    class Scope
+    {
+    public:
+#if PTALK_PROFILE
+        explicit Scope(Probe p) : probe_(p), start_(esp_cpu_get_ccount()) {}
+        ~Scope() { Profiler::instance().record(probe_, esp_cpu_get_ccount() - start_); }
+
+    private:
+        Probe probe_;
+        uint32_t start_;
+#else
+        explicit Scope(Probe) {}
+#endif
+    };
+
+private:
+    Profiler() = default;
+
+    struct TaskLoad
+    {
+        TaskHandle_t handle = nullptr;
+        char name[16] = {};
+        int8_t core = -1; // -1 = not pinned
+        uint8_t priority = 0;
+        uint32_t runtime = 0; // counter at the last sample
+        uint16_t load_pm = 0; // ‰ of one core over the last window
+    };
+
+    mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+    ProbeStats probes_[PROBE_COUNT];
+
+    std::atomic<bool> sampling_{false};
+    TaskLoad tasks_[MAX_TASKS];
+    size_t task_count_ = 0;
+    uint32_t total_runtime_ = 0;   // counter at the last sample
+    uint32_t window_us_ = 0;       // length of the last window
+    uint16_t busy_pm_[2] = {0, 0}; // per core, 1000 - idle
+};
+
+#define PTALK_PROF_CAT2(a, b) a##b
+#define PTALK_PROF_CAT(a, b) PTALK_PROF_CAT2(a, b)
+#if PTALK_PROFILE
+#define PTALK_PROF_SCOPE(probe) Profiler::Scope PTALK_PROF_CAT(prof_scope_, __LINE__)(Profiler::probe)
+#else
+#define PTALK_PROF_SCOPE(probe) ((void)0)
+#endif
@@ -0,0 +1,127 @@
+#include "ResumeState.hpp"
+
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+
+static const char *TAG = "ResumeState";
+
+namespace
+{
+    struct Retained
+    {
+        uint32_t magic;
+        uint8_t volume;
+        uint8_t brightness;
+        uint8_t connectivity; // state::ConnectivityState
+        uint8_t reserved;
+        uint32_t timer_wakes; // battery checks since the last full boot
+        uint32_t last_interactive_ms;
+    };
+
+    constexpr uint32_t RETAINED_MAGIC = 0x52534d31; // "RSM1"
+
+    // Cleared on power-on / brown-out (magic mismatch), kept across deep sleep
+    RTC_DATA_ATTR Retained s_rtc;
+} // namespace
+
+ResumeState &ResumeState::instance()
+{
+    static ResumeState inst;
+    return inst;
+}
+
+void ResumeState::capture()
+{
+    switch (esp_sleep_get_wakeup_cause())
+    {
+    case ESP_SLEEP_WAKEUP_UNDEFINED:
+        wake_ = Wake::COLD;
+        break;
+    case ESP_SLEEP_WAKEUP_TIMER:
+        wake_ = Wake::TIMER;
+        break;
+    case ESP_SLEEP_WAKEUP_EXT0:
+    case ESP_SLEEP_WAKEUP_EXT1:
+        wake_ = Wake::BUTTON;
+        break;
+    default:
+        wake_ = Wake::OTHER;
+        break;
+    }
+
+    valid_ = wake_ != Wake::COLD && s_rtc.magic == RETAINED_MAGIC;
+    if (!valid_)
+    {
+        s_rtc = Retained{};
+        return;
+    }
+
+    snap_.volume = s_rtc.volume;
+    snap_.brightness = s_rtc.brightness;
+    snap_.connectivity = static_cast<state::ConnectivityState>(s_rtc.connectivity);
+}
+
+bool ResumeState::fastResume() const
+{
+    return valid_ && snap_.connectivity == state::ConnectivityState::ONLINE;
+}
+
+uint32_t ResumeState::timerWakes() const
+{
+    return valid_ ? s_rtc.timer_wakes : 0;
+}
+
+void ResumeState::retain(const Snapshot &s)
+{
+    s_rtc.volume = s.volume;
+    s_rtc.brightness = s.brightness;
+    s_rtc.connectivity = static_cast<uint8_t>(s.connectivity);
+    s_rtc.timer_wakes = 0;
+    s_rtc.last_interactive_ms = interactive_ms_;
+    s_rtc.magic = RETAINED_MAGIC;
+}
+
+void ResumeState::noteTimerWake()
+{
+    s_rtc.timer_wakes++;
+}
+
+void ResumeState::markInteractive()
+{
+    if (interactive_ms_ != 0)
+        return;
+    // esp_timer counts from app startup (bootloader time not included)
+    interactive_ms_ = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    if (interactive_ms_ == 0)
+        interactive_ms_ = 1;
+    ESP_LOGI(TAG, "Boot -> interactive: %u ms (%s wake%s)", (unsigned)interactive_ms_,
+             wakeName(wake_), fastResume() ? ", fast resume" : "");
+}
+
+const char *ResumeState::wakeName(Wake w)
+{
+    switch (w)
+    {
+    case Wake::COLD:
+        return "cold";
+    case Wake::TIMER:
+        return "timer";
+    case Wake::BUTTON:
+        return "button";
+    default:
+        return "other";
+    }
+}
+
+void ResumeState::print() const
+{
+    ESP_LOGI(TAG, "wake=%s retained=%d fast_resume=%d timer_wakes=%u",
+             wakeName(wake_), valid_, fastResume(), (unsigned)timerWakes());
+    if (valid_)
+        ESP_LOGI(TAG, "snapshot: volume=%u brightness=%u connectivity=%d",
+                 snap_.volume, snap_.brightness, (int)snap_.connectivity);
+    ESP_LOGI(TAG, "boot -> interactive: %u ms (previous boot: %u ms)",
+             (unsigned)interactive_ms_, (unsigned)(valid_ ? s_rtc.last_interactive_ms : 0));
+}
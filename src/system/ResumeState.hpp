@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+
+#include "system/StateTypes.hpp"
+
+/**
+ * ResumeState
+ * ============================================================================
+ * Trạng thái giữ trong RTC slow memory qua deep sleep, để lần thức dậy sau
+ * không phải đi lại toàn bộ cold boot:
+ * - volume / brightness đang dùng lúc ngủ (áp dụng ngay, không chờ NVS);
+ * - connectivity cuối cùng: chỉ khi trước đó ONLINE mới resume nhanh (Wi-Fi /
+ *   WS / MQTT lên nền sau khi display + audio đã chạy);
+ * - đếm số lần thức dậy chỉ để kiểm tra pin (timer).
+ * Kênh Wi-Fi / BSSID / DHCP lease đã nằm trong RTC cache của WifiService.
+ *
+ * capture() gọi đầu tiên trong app_main: đọc nguyên nhân thức dậy và kiểm tra
+ * magic (cold boot / brown-out xoá RTC → dữ liệu không hợp lệ). retain() gọi
+ * ngay trước esp_deep_sleep_start(). markInteractive() ghi thời gian từ lúc
+ * boot đến khi display + audio + nút bấm sẵn sàng (lệnh console "boot").
+ */
+class ResumeState
+{
+public:
+    enum class Wake : uint8_t
+    {
+        COLD,   // power-on / reset / panic: no retained state
+        TIMER,  // periodic battery re-check from enterSleep()
+        BUTTON, // touch pin (ext0 / ext1)
+        OTHER   // UART, ULP, ...
+    };
+
+    struct Snapshot
+    {
+        uint8_t volume = 60;
+        uint8_t brightness = 100;
+        state::ConnectivityState connectivity = state::ConnectivityState::OFFLINE;
+    };
+
+    static ResumeState &instance();
+
+    // Classify the wake-up and validate the RTC copy; call once, first thing.
+    void capture();
+
+    Wake wake() const { return wake_; }
+    // Woken from deep sleep with a retained snapshot
+    bool valid() const { return valid_; }
+    // Retained snapshot was ONLINE: bring the network up after the UI
+    bool fastResume() const;
+    const Snapshot &snapshot() const { return snap_; }
+    uint32_t timerWakes() const;
+
+    // Store what the next wake-up needs; call right before deep sleep.
+    void retain(const Snapshot &s);
+    // Timer wake that goes straight back to sleep (snapshot stays valid).
+    void noteTimerWake();
+
+    // Boot → display, audio and touch running; logged once per boot.
+    void markInteractive();
+    uint32_t bootToInteractiveMs() const { return interactive_ms_; }
+
+    static const char *wakeName(Wake w);
+
+    // Wake kind, snapshot and boot time on the log (serial "boot" command).
+    void print() const;
+
+private:
+    ResumeState() = default;
+
+    Wake wake_ = Wake::COLD;
+    bool valid_ = false;
+    Snapshot snap_{};
+    uint32_t interactive_ms_ = 0; // 0 = not interactive yet
+};
@@ -0,0 +1,168 @@
+#include "SerialConsole.hpp"
+
+#include <cstdio>
+
+#include "driver/uart.h"
+#include "esp_log.h"
+#include "esp_sleep.h"
+#include "sdkconfig.h"
+
+#include "system/MemTelemetry.hpp"
+#include "system/TaskPlan.hpp"
+
+static const char *TAG = "SerialConsole";
+
+static constexpr size_t MAX_LINE = 96;
+static constexpr uart_port_t CONSOLE_UART = static_cast<uart_port_t>(CONFIG_ESP_CONSOLE_UART_NUM);
+static constexpr int RX_BUF = 256;      // driver minimum is the FIFO size (128)
+static constexpr int EVENT_DEPTH = 8;
+static constexpr int WAKEUP_EDGES = 3;  // RX edges that end a light sleep
+
+SerialConsole &SerialConsole::instance()
+{
+    static SerialConsole inst;
+    return inst;
+}
+
+void SerialConsole::registerCommand(const char *name, const char *help, Handler fn)
+{
+    for (auto &c : commands)
+    {
+        if (c.name == name)
+        {
+            c.help = help ? help : "";
+            c.fn = std::move(fn);
+            return;
+        }
+    }
+    commands.push_back({name, help ? help : "", std::move(fn)});
+}
+
+// ============================================================================
+// Start / Stop
+// ============================================================================
+void SerialConsole::start()
+{
+    if (task_handle)
+        return;
+
+    if (uart_driver_install(CONSOLE_UART, RX_BUF, 0, EVENT_DEPTH, &uart_queue, 0) != ESP_OK)
+    {
+        ESP_LOGE(TAG, "UART%d driver install failed", (int)CONSOLE_UART);
+        uart_queue = nullptr;
+        return;
+    }
+    // Typing wakes the chip from automatic light sleep; the characters that
+    // do the waking are lost, so the first line may need a retype
+    uart_set_wakeup_threshold(CONSOLE_UART, WAKEUP_EDGES);
+    esp_sleep_enable_uart_wakeup(CONSOLE_UART);
+
+    running = true;
+    if (!TaskPlan::instance().spawn(TaskPlan::CONSOLE, &SerialConsole::taskEntry, this, &task_handle))
+    {
+        running = false;
+        task_handle = nullptr;
+        uart_driver_delete(CONSOLE_UART);
+        uart_queue = nullptr;
+        return;
+    }
+    ESP_LOGI(TAG, "Console ready (%u commands, type 'help')", (unsigned)commands.size());
+}
+
+void SerialConsole::stop()
+{
+    running = false;
+    if (uart_queue)
+    {
+        // Unblock the task waiting on the event queue
+        uart_event_t wake = {};
+        wake.type = UART_EVENT_MAX;
+        xQueueSend(uart_queue, &wake, 0);
+    }
+}
+
+void SerialConsole::taskEntry(void *arg)
+{
+    static_cast<SerialConsole *>(arg)->taskLoop();
+}
+
+// ============================================================================
+// Task: wait for UART RX events, collect one line, dispatch
+// ============================================================================
+void SerialConsole::taskLoop()
+{
+    std::string line;
+    line.reserve(MAX_LINE);
+    MemTelemetry::instance().registerTask(TaskPlan::instance().stackBytes(TaskPlan::CONSOLE));
+
+    while (running)
+    {
+        uart_event_t ev;
+        if (xQueueReceive(uart_queue, &ev, portMAX_DELAY) != pdTRUE)
+            continue;
+
+        if (ev.type == UART_FIFO_OVF || ev.type == UART_BUFFER_FULL)
+        {
+            // Pasted more than the buffer: drop it rather than run a fragment
+            uart_flush_input(CONSOLE_UART);
+            xQueueReset(uart_queue);
+            line.clear();
+            continue;
+        }
+        if (ev.type != UART_DATA)
+            continue;
+
+        uint8_t buf[32];
+        int n;
+        while ((n = uart_read_bytes(CONSOLE_UART, buf, sizeof(buf), 0)) > 0)
+        {
+            for (int i = 0; i < n; i++)
+                feed(static_cast<char>(buf[i]), line);
+        }
+    }
+
+    MemTelemetry::instance().unregisterTask();
+    uart_driver_delete(CONSOLE_UART);
+    uart_queue = nullptr;
+    task_handle = nullptr;
+    vTaskDelete(nullptr);
+}
+
+void SerialConsole::feed(char c, std::string &line)
+{
+    if (c == '\r' || c == '\n')
+    {
+        if (!line.empty())
+            dispatch(line);
+        line.clear();
+        return;
+    }
+    if (line.size() < MAX_LINE)
+        line.push_back(c);
+}
+
+void SerialConsole::dispatch(const std::string &line)
+{
+    const size_t sp = line.find(' ');
+    const std::string name = line.substr(0, sp);
+    const size_t arg_pos = sp == std::string::npos ? std::string::npos : line.find_first_not_of(' ', sp);
+    const std::string args = arg_pos == std::string::npos ? std::string() : line.substr(arg_pos);
+
+    if (name == "help")
+    {
+        for (const auto &c : commands)
+            ESP_LOGI(TAG, "  %-10s %s", c.name.c_str(), c.help.c_str());
+        return;
+    }
+
+    for (const auto &c : commands)
+    {
+        if (c.name == name)
+        {
+            if (c.fn)
+                c.fn(args);
+            return;
+        }
+    }
+    ESP_LOGW(TAG, "Unknown command '%s' (try 'help')", name.c_str());
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+// Line-based debug console on the log UART. Modules register named commands;
+// a low-priority task blocks on the UART driver's event queue (no polling,
+// RX also wakes the chip from light sleep) and dispatches "name args..."
+// lines. "help" lists the commands. Log output keeps going through the VFS.
+class SerialConsole
+{
+public:
+    // Handler receives the text after the command name (may be empty).
+    using Handler = std::function<void(const std::string &args)>;
+
+    static SerialConsole &instance();
+
+    // Register before start() (the table is not locked); a later registration
+    // with the same name replaces the earlier one.
+    void registerCommand(const char *name, const char *help, Handler fn);
+
+    // Start the console task; no-op if already running.
+    void start();
+    void stop();
+
+private:
+    SerialConsole() = default;
+
+    static void taskEntry(void *arg);
+    void taskLoop();
+    void dispatch(const std::string &line);
+    void feed(char c, std::string &line);
+
+    struct Command
+    {
+        std::string name;
+        std::string help;
+        Handler fn;
+    };
+
+    std::vector<Command> commands;
+    TaskHandle_t task_handle = nullptr;
+    QueueHandle_t uart_queue = nullptr; // UART driver events (RX data)
+    volatile bool running = false;
+};
@@ -1,6 +1,7 @@
 #include "StateManager.hpp"
 #include "esp_log.h"
-#include <algorithm>
+
+#include "freertos/task.h"
 
 static const char *TAG = "StateManager";
 
@@ -10,59 +11,184 @@ StateManager& StateManager::instance() {
 }
 
 // ===========================================================
-// Interaction State + Source
+// Subscriber tables
 // ===========================================================
 
-void StateManager::setInteractionState(state::InteractionState s, state::InputSource src) {
-    std::vector<std::pair<int, InteractionCb>> callbacks;
-    
-    {
-        std::lock_guard<std::mutex> lk(mtx);
+template <typename Cb>
+int StateManager::addSubscriber(Table<Cb> &table, Cb cb, Mailbox mailbox) {
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        Slot<Cb> &sl = table.slots[i];
+        uint8_t expected = SLOT_FREE;
+        if (!sl.state.compare_exchange_strong(expected, SLOT_CLAIMED, std::memory_order_acquire))
+            continue;
+
+        sl.id = next_sub_id.fetch_add(1, std::memory_order_relaxed);
+        sl.mailbox = mailbox;
+        sl.fn = std::move(cb);
+        sl.state.store(SLOT_LIVE, std::memory_order_release);
+        return sl.id;
+    }
+    ESP_LOGE(TAG, "Subscriber table full (%d)", MAX_SUBSCRIBERS);
+    return -1;
+}
 
-        if (s == interaction_state && src == interaction_source) {
-            return;  // No change
+template <typename Cb>
+void StateManager::removeSubscriber(Table<Cb> &table, int id) {
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        Slot<Cb> &sl = table.slots[i];
+        if (sl.state.load(std::memory_order_acquire) != SLOT_LIVE || sl.id != id)
+            continue;
+
+        uint8_t expected = SLOT_LIVE;
+        if (!sl.state.compare_exchange_strong(expected, SLOT_RETIRING, std::memory_order_acq_rel))
+            return; // raced with another unsubscribe
+
+        // Publishers re-check LIVE after bumping in_calls, so once this drops
+        // to zero nobody can be inside fn
+        while (sl.in_calls.load(std::memory_order_acquire) != 0)
+            vTaskDelay(1);
+
+        sl.fn = nullptr;
+        sl.mailbox = nullptr;
+        sl.id = 0;
+        sl.state.store(SLOT_FREE, std::memory_order_release);
+        return;
+    }
+}
+
+template <typename Cb, typename... Args>
+void StateManager::publish(Table<Cb> &table, Topic topic, uint8_t value, uint8_t source, Args... args) {
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        Slot<Cb> &sl = table.slots[i];
+        if (sl.state.load(std::memory_order_acquire) != SLOT_LIVE)
+            continue;
+
+        sl.in_calls.fetch_add(1, std::memory_order_acq_rel);
+        if (sl.state.load(std::memory_order_acquire) == SLOT_LIVE) {
+            if (sl.mailbox) {
+                Event e{topic, value, source, static_cast<uint8_t>(i), sl.id};
+                if (xQueueSend(sl.mailbox, &e, 0) != pdTRUE) {
+                    dropped_events.fetch_add(1, std::memory_order_relaxed);
+                    ESP_LOGW(TAG, "Mailbox full, topic %u event dropped", (unsigned)topic);
+                }
+            } else if (sl.fn) {
+                sl.fn(args...);
+            }
         }
+        sl.in_calls.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+// ===========================================================
+// Deferred delivery
+// ===========================================================
 
-        interaction_state = s;
-        interaction_source = src;
+StateManager::Mailbox StateManager::createMailbox(size_t depth) {
+    Mailbox mb = xQueueCreate(depth, sizeof(Event));
+    if (!mb)
+        ESP_LOGE(TAG, "createMailbox(%u) failed", (unsigned)depth);
+    return mb;
+}
 
-        ESP_LOGI(TAG, "InteractionState: %d -> %d (source=%d)",
-            static_cast<int>(interaction_state), static_cast<int>(s), static_cast<int>(src));
+void StateManager::deleteMailbox(Mailbox mailbox) {
+    if (mailbox)
+        vQueueDelete(mailbox);
+}
 
-        // Copy callbacks under lock
-        callbacks = interaction_cbs;
-    }  // Lock released here
+void StateManager::wakeMailbox(Mailbox mailbox) {
+    if (!mailbox)
+        return;
+    Event e = {};
+    e.topic = TOPIC_WAKE;
+    e.slot = MAX_SUBSCRIBERS; // addressed to nobody
+    // Full queue: the owner is already due to wake
+    xQueueSend(mailbox, &e, 0);
+}
 
-    // ✅ Call callbacks OUTSIDE lock to prevent deadlocks and timer overflow
-    for (auto &p : callbacks) {
-        if (p.second) p.second(s, src);
+size_t StateManager::pump(Mailbox mailbox, TickType_t wait) {
+    if (!mailbox) {
+        if (wait)
+            vTaskDelay(wait);
+        return 0;
     }
+
+    size_t n = 0;
+    Event e;
+    while (xQueueReceive(mailbox, &e, wait) == pdTRUE) {
+        wait = 0;
+        deliver(e);
+        if (e.topic != TOPIC_WAKE)
+            n++;
+    }
+    return n;
+}
+
+// Run one queued event on the pumping task, if its subscriber still exists
+void StateManager::deliver(const Event &e) {
+    auto run = [&e](auto &table, auto &&call) {
+        if (e.slot >= MAX_SUBSCRIBERS)
+            return;
+        auto &sl = table.slots[e.slot];
+        sl.in_calls.fetch_add(1, std::memory_order_acq_rel);
+        if (sl.state.load(std::memory_order_acquire) == SLOT_LIVE && sl.id == e.id && sl.fn)
+            call(sl.fn);
+        sl.in_calls.fetch_sub(1, std::memory_order_release);
+    };
+
+    switch (e.topic) {
+    case TOPIC_INTERACTION:
+        run(interaction_cbs, [&e](InteractionCb &fn) {
+            fn(static_cast<state::InteractionState>(e.value), static_cast<state::InputSource>(e.source));
+        });
+        break;
+    case TOPIC_CONNECTIVITY:
+        run(connectivity_cbs, [&e](ConnectivityCb &fn) { fn(static_cast<state::ConnectivityState>(e.value)); });
+        break;
+    case TOPIC_SYSTEM:
+        run(system_cbs, [&e](SystemCb &fn) { fn(static_cast<state::SystemState>(e.value)); });
+        break;
+    case TOPIC_POWER:
+        run(power_cbs, [&e](PowerCb &fn) { fn(static_cast<state::PowerState>(e.value)); });
+        break;
+    case TOPIC_EMOTION:
+        run(emotion_cbs, [&e](EmotionCb &fn) { fn(static_cast<state::EmotionState>(e.value)); });
+        break;
+    case TOPIC_WAKE:
+        break;
+    }
+}
+
+// ===========================================================
+// Interaction State + Source
+// ===========================================================
+
+void StateManager::setInteractionState(state::InteractionState s, state::InputSource src) {
+    const uint16_t word = static_cast<uint16_t>(static_cast<uint8_t>(s) | (static_cast<uint8_t>(src) << 8));
+    const uint16_t old = interaction_word.exchange(word, std::memory_order_acq_rel);
+    if (old == word) {
+        return;  // No change
+    }
+
+    ESP_LOGI(TAG, "InteractionState: %d -> %d (source=%d)",
+        static_cast<int>(old & 0xFF), static_cast<int>(s), static_cast<int>(src));
+
+    publish(interaction_cbs, TOPIC_INTERACTION, static_cast<uint8_t>(s), static_cast<uint8_t>(src), s, src);
 }
 
 state::InteractionState StateManager::getInteractionState() {
-    std::lock_guard<std::mutex> lk(mtx);
-    return interaction_state;
+    return static_cast<state::InteractionState>(interaction_word.load(std::memory_order_acquire) & 0xFF);
 }
 
 state::InputSource StateManager::getInteractionSource() {
-    std::lock_guard<std::mutex> lk(mtx);
-    return interaction_source;
+    return static_cast<state::InputSource>(interaction_word.load(std::memory_order_acquire) >> 8);
 }
 
-int StateManager::subscribeInteraction(InteractionCb cb) {
-    std::lock_guard<std::mutex> lk(mtx);
-    int id = next_sub_id++;
-    interaction_cbs.emplace_back(id, std::move(cb));
-    return id;
+int StateManager::subscribeInteraction(InteractionCb cb, Mailbox mailbox) {
+    return addSubscriber(interaction_cbs, std::move(cb), mailbox);
 }
 
 void StateManager::unsubscribeInteraction(int id) {
-    std::lock_guard<std::mutex> lk(mtx);
-    interaction_cbs.erase(
-        std::remove_if(interaction_cbs.begin(), interaction_cbs.end(),
-        [id](auto &p){ return p.first == id; }),
-        interaction_cbs.end()
-    );
+    removeSubscriber(interaction_cbs, id);
 }
 
 // ===========================================================
@@ -70,44 +196,22 @@ void StateManager::unsubscribeInteraction(int id) {
 // ===========================================================
 
 void StateManager::setConnectivityState(state::ConnectivityState s) {
-    std::vector<std::pair<int, ConnectivityCb>> callbacks;
-    
-    {
-        std::lock_guard<std::mutex> lk(mtx);
-        if (s == connectivity_state) return;
-
-        connectivity_state = s;
-        ESP_LOGI(TAG, "ConnectivityState: %d (change)", static_cast<int>(s));
-
-        // Copy callbacks under lock
-        callbacks = connectivity_cbs;
-    }  // Lock released here
-
-    // ✅ Call callbacks OUTSIDE lock to prevent deadlocks
-    for (auto &p : callbacks) {
-        if (p.second) p.second(s);
-    }
+    if (connectivity_state.exchange(s, std::memory_order_acq_rel) == s) return;
+
+    ESP_LOGI(TAG, "ConnectivityState: %d (change)", static_cast<int>(s));
+    publish(connectivity_cbs, TOPIC_CONNECTIVITY, static_cast<uint8_t>(s), 0, s);
 }
 
 state::ConnectivityState StateManager::getConnectivityState() {
-    std::lock_guard<std::mutex> lk(mtx);
-    return connectivity_state;
+    return connectivity_state.load(std::memory_order_acquire);
 }
 
-int StateManager::subscribeConnectivity(ConnectivityCb cb) {
-    std::lock_guard<std::mutex> lk(mtx);
-    int id = next_sub_id++;
-    connectivity_cbs.emplace_back(id, std::move(cb));
-    return id;
+int StateManager::subscribeConnectivity(ConnectivityCb cb, Mailbox mailbox) {
+    return addSubscriber(connectivity_cbs, std::move(cb), mailbox);
 }
 
 void StateManager::unsubscribeConnectivity(int id) {
-    std::lock_guard<std::mutex> lk(mtx);
-    connectivity_cbs.erase(
-        std::remove_if(connectivity_cbs.begin(), connectivity_cbs.end(),
-        [id](auto &p){ return p.first == id; }),
-        connectivity_cbs.end()
-    );
+    removeSubscriber(connectivity_cbs, id);
 }
 
 // ===========================================================
@@ -115,44 +219,22 @@ void StateManager::unsubscribeConnectivity(int id) {
 // ===========================================================
 
 void StateManager::setSystemState(state::SystemState s) {
-    std::vector<std::pair<int, SystemCb>> callbacks;
-    
-    {
-        std::lock_guard<std::mutex> lk(mtx);
-        if (s == system_state) return;
-
-        system_state = s;
-        ESP_LOGI(TAG, "SystemState: %d (change)", static_cast<int>(s));
-
-        // Copy callbacks under lock
-        callbacks = system_cbs;
-    }  // Lock released here
-
-    // ✅ Call callbacks OUTSIDE lock to prevent deadlocks
-    for (auto &p : callbacks) {
-        if (p.second) p.second(s);
-    }
+    if (system_state.exchange(s, std::memory_order_acq_rel) == s) return;
+
+    ESP_LOGI(TAG, "SystemState: %d (change)", static_cast<int>(s));
+    publish(system_cbs, TOPIC_SYSTEM, static_cast<uint8_t>(s), 0, s);
 }
 
 state::SystemState StateManager::getSystemState() {
-    std::lock_guard<std::mutex> lk(mtx);
-    return system_state;
+    return system_state.load(std::memory_order_acquire);
 }
 
-int StateManager::subscribeSystem(SystemCb cb) {
-    std::lock_guard<std::mutex> lk(mtx);
-    int id = next_sub_id++;
-    system_cbs.emplace_back(id, std::move(cb));
-    return id;
+int StateManager::subscribeSystem(SystemCb cb, Mailbox mailbox) {
+    return addSubscriber(system_cbs, std::move(cb), mailbox);
 }
 
 void StateManager::unsubscribeSystem(int id) {
-    std::lock_guard<std::mutex> lk(mtx);
-    system_cbs.erase(
-        std::remove_if(system_cbs.begin(), system_cbs.end(),
-        [id](auto &p){ return p.first == id; }),
-        system_cbs.end()
-    );
+    removeSubscriber(system_cbs, id);
 }
 
 // ===========================================================
@@ -160,87 +242,44 @@ void StateManager::unsubscribeSystem(int id) {
 // ===========================================================
 
 void StateManager::setPowerState(state::PowerState s) {
-    std::vector<std::pair<int, PowerCb>> callbacks;
-    
-    {
-        std::lock_guard<std::mutex> lk(mtx);
-        if (s == power_state) return;
-
-        power_state = s;
-
-        ESP_LOGI(TAG, "PowerState: %d (change)", static_cast<int>(s));
-
-        // Copy callbacks under lock
-        callbacks = power_cbs;
-    }  // Lock released here
+    if (power_state.exchange(s, std::memory_order_acq_rel) == s) return;
 
-    // ✅ Call callbacks OUTSIDE lock to prevent deadlocks and timer stack overflow
-    for (auto &p : callbacks) {
-        if (p.second) p.second(s);
-    }
+    ESP_LOGI(TAG, "PowerState: %d (change)", static_cast<int>(s));
+    publish(power_cbs, TOPIC_POWER, static_cast<uint8_t>(s), 0, s);
 }
 
 state::PowerState StateManager::getPowerState() {
-    std::lock_guard<std::mutex> lk(mtx);
-    return power_state;
+    return power_state.load(std::memory_order_acquire);
 }
 
-int StateManager::subscribePower(PowerCb cb) {
-    std::lock_guard<std::mutex> lk(mtx);
-    int id = next_sub_id++;
-    power_cbs.emplace_back(id, std::move(cb));
-    return id;
+int StateManager::subscribePower(PowerCb cb, Mailbox mailbox) {
+    return addSubscriber(power_cbs, std::move(cb), mailbox);
 }
 
 void StateManager::unsubscribePower(int id) {
-    std::lock_guard<std::mutex> lk(mtx);
-    power_cbs.erase(
-        std::remove_if(power_cbs.begin(), power_cbs.end(),
-        [id](auto &p){ return p.first == id; }),
-        power_cbs.end()
-    );
+    removeSubscriber(power_cbs, id);
 }
+
 // ===========================================================
 // Emotion
 // ===========================================================
 
 void StateManager::setEmotionState(state::EmotionState s) {
-    std::vector<std::pair<int, EmotionCb>> callbacks;
-    
-    {
-        std::lock_guard<std::mutex> lk(mtx);
-        //if (s == emotion_state) return;
-
-        emotion_state = s;
-        ESP_LOGI(TAG, "EmotionState: %d (change)", static_cast<int>(s));
-
-        // Copy callbacks under lock
-        callbacks = emotion_cbs;
-    }  // Lock released here
-
-    // ✅ Call callbacks OUTSIDE lock to prevent deadlocks
-    for (auto &p : callbacks) {
-        if (p.second) p.second(s);
-    }
+    //if (s == emotion_state) return;
+    emotion_state.store(s, std::memory_order_release);
+
+    ESP_LOGI(TAG, "EmotionState: %d (change)", static_cast<int>(s));
+    publish(emotion_cbs, TOPIC_EMOTION, static_cast<uint8_t>(s), 0, s);
 }
 
 state::EmotionState StateManager::getEmotionState() {
-    std::lock_guard<std::mutex> lk(mtx);
-    return emotion_state;
+    return emotion_state.load(std::memory_order_acquire);
 }
 
-int StateManager::subscribeEmotion(EmotionCb cb) {
-    std::lock_guard<std::mutex> lk(mtx);
-    int id = next_sub_id++;
-    emotion_cbs.emplace_back(id, std::move(cb));
-    return id;
+int StateManager::subscribeEmotion(EmotionCb cb, Mailbox mailbox) {
+    return addSubscriber(emotion_cbs, std::move(cb), mailbox);
 }
 
 void StateManager::unsubscribeEmotion(int id) {
-    std::lock_guard<std::mutex> lk(mtx);
-    emotion_cbs.erase(
-        std::remove_if(emotion_cbs.begin(), emotion_cbs.end(),
-        [id](auto &p){ return p.first == id; }),
-        emotion_cbs.end()
-    );
-}
\ No newline at end of file
+    removeSubscriber(emotion_cbs, id);
+}
@@ -1,11 +1,28 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <vector>
-#include <mutex>
 #include "StateTypes.hpp"
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
 // Central state hub providing thread-safe setters/getters and subscription
 // callbacks for interaction, connectivity, system, power, and emotion state.
+//
+// Publish path (no lock, no copy, no heap):
+// - each topic keeps its state in one atomic word (interaction state and
+//   source are packed together), so getters are a single load and safe to
+//   poll from hot loops;
+// - subscribers live in a fixed per-topic slot table and are called in
+//   place; a per-slot in-flight counter lets unsubscribe wait for running
+//   calls instead of holding a lock around them.
+//
+// Delivery is synchronous on the setter's task by default. A subscriber can
+// pass a mailbox (createMailbox()) instead: publishers then only enqueue a
+// 8-byte event (never blocking) and the owner runs its callbacks with pump()
+// from its own task.
 class StateManager {
 public:
     // New: callback type includes source
@@ -16,6 +33,11 @@ public:
     using PowerCb = std::function<void(state::PowerState)>;
     using EmotionCb = std::function<void(state::EmotionState)>;
 
+    // Deferred-delivery queue owned by one subscriber task
+    using Mailbox = QueueHandle_t;
+
+    static constexpr int MAX_SUBSCRIBERS = 8; // per topic
+
     static StateManager& instance();
 
     // ---- Setters ----
@@ -35,7 +57,7 @@ public:
     state::InteractionState getInteractionState();
     // Return latest interaction source.
     state::InputSource getInteractionSource();
-    
+
     // Return latest connectivity state.
     state::ConnectivityState getConnectivityState();
     // Return latest system state.
@@ -46,52 +68,98 @@ public:
     state::EmotionState getEmotionState();
 
     // ---- Subscribe ----
+    // Returns subscription id, or -1 if the topic's table is full.
+    // mailbox != nullptr: deferred delivery, run by pump(mailbox).
     // Subscribe to interaction changes; returns subscription id.
-    int subscribeInteraction(InteractionCb cb);
+    int subscribeInteraction(InteractionCb cb, Mailbox mailbox = nullptr);
     // Subscribe to connectivity changes; returns subscription id.
-    int subscribeConnectivity(ConnectivityCb cb);
+    int subscribeConnectivity(ConnectivityCb cb, Mailbox mailbox = nullptr);
     // Subscribe to system changes; returns subscription id.
-    int subscribeSystem(SystemCb cb);
+    int subscribeSystem(SystemCb cb, Mailbox mailbox = nullptr);
     // Subscribe to power changes; returns subscription id.
-    int subscribePower(PowerCb cb);
+    int subscribePower(PowerCb cb, Mailbox mailbox = nullptr);
     // Subscribe to emotion changes; returns subscription id.
-    int subscribeEmotion(EmotionCb cb);
+    int subscribeEmotion(EmotionCb cb, Mailbox mailbox = nullptr);
 
     // ---- Unsubscribe ----
+    // Waits for in-flight calls of that subscriber; don't call from inside
+    // its own callback.
     void unsubscribeInteraction(int id);
     void unsubscribeConnectivity(int id);
     void unsubscribeSystem(int id);
     void unsubscribePower(int id);
     void unsubscribeEmotion(int id);
 
+    // ---- Deferred delivery ----
+    static Mailbox createMailbox(size_t depth = 8);
+    static void deleteMailbox(Mailbox mailbox);
+    // Run the callbacks queued in `mailbox` (call from its owner task). Blocks
+    // up to `wait` for the first event, then drains without blocking.
+    // Returns the number of callbacks run.
+    size_t pump(Mailbox mailbox, TickType_t wait = 0);
+    // Make a pump() blocked on `mailbox` return (no callback runs); lets the
+    // owner task sleep without a timeout and still react to other events.
+    static void wakeMailbox(Mailbox mailbox);
+    // Events lost because a mailbox was full.
+    uint32_t droppedEvents() const { return dropped_events.load(std::memory_order_relaxed); }
+
 private:
     StateManager() = default;
     StateManager(const StateManager&) = delete;
     StateManager& operator=(const StateManager&) = delete;
 
     // ---- Internals ----
-    std::mutex mtx;
-
-    state::InteractionState interaction_state = state::InteractionState::IDLE;
-    state::InputSource interaction_source = state::InputSource::UNKNOWN;
-
-    state::ConnectivityState connectivity_state = state::ConnectivityState::OFFLINE;
-    state::SystemState system_state = state::SystemState::BOOTING;
-    state::PowerState power_state = state::PowerState::NORMAL;
-    state::EmotionState emotion_state = state::EmotionState::NEUTRAL;
-
-    // Subscription containers
-    int next_sub_id = 1;
-    std::vector<std::pair<int, InteractionCb>> interaction_cbs;
-    std::vector<std::pair<int, ConnectivityCb>> connectivity_cbs;
-    std::vector<std::pair<int, SystemCb>> system_cbs;
-    std::vector<std::pair<int, PowerCb>> power_cbs;
-    std::vector<std::pair<int, EmotionCb>> emotion_cbs;
-
-    // ---- Notify helpers ----
-    void notifyInteraction(state::InteractionState s, state::InputSource src);
-    void notifyConnectivity(state::ConnectivityState s);
-    void notifySystem(state::SystemState s);
-    void notifyPower(state::PowerState s);
-    void notifyEmotion(state::EmotionState s);
+    enum Topic : uint8_t { TOPIC_INTERACTION, TOPIC_CONNECTIVITY, TOPIC_SYSTEM, TOPIC_POWER, TOPIC_EMOTION, TOPIC_WAKE };
+
+    // Mailbox entry: value at publish time + the slot/id it is addressed to
+    struct Event {
+        uint8_t topic;
+        uint8_t value;
+        uint8_t source;
+        uint8_t slot;
+        int32_t id;
+    };
+
+    enum SlotState : uint8_t { SLOT_FREE, SLOT_CLAIMED, SLOT_LIVE, SLOT_RETIRING };
+
+    template <typename Cb>
+    struct Slot {
+        std::atomic<uint8_t> state{SLOT_FREE};
+        std::atomic<uint8_t> in_calls{0};
+        int32_t id = 0;
+        Mailbox mailbox = nullptr;
+        Cb fn;
+    };
+
+    template <typename Cb>
+    struct Table {
+        Slot<Cb> slots[MAX_SUBSCRIBERS];
+    };
+
+    template <typename Cb>
+    int addSubscriber(Table<Cb>& table, Cb cb, Mailbox mailbox);
+    template <typename Cb>
+    void removeSubscriber(Table<Cb>& table, int id);
+    template <typename Cb, typename... Args>
+    void publish(Table<Cb>& table, Topic topic, uint8_t value, uint8_t source, Args... args);
+    void deliver(const Event& e);
+
+    // interaction state | source << 8
+    std::atomic<uint16_t> interaction_word{
+        static_cast<uint16_t>(static_cast<uint8_t>(state::InteractionState::IDLE) |
+                              (static_cast<uint8_t>(state::InputSource::UNKNOWN) << 8))};
+
+    std::atomic<state::ConnectivityState> connectivity_state{state::ConnectivityState::OFFLINE};
+    std::atomic<state::SystemState> system_state{state::SystemState::BOOTING};
+    std::atomic<state::PowerState> power_state{state::PowerState::NORMAL};
+    std::atomic<state::EmotionState> emotion_state{state::EmotionState::NEUTRAL};
+
+    // Subscription tables
+    std::atomic<int32_t> next_sub_id{1};
+    std::atomic<uint32_t> dropped_events{0};
+    Table<InteractionCb> interaction_cbs;
+    Table<ConnectivityCb> connectivity_cbs;
+    Table<SystemCb> system_cbs;
+    Table<PowerCb> power_cbs;
+    Table<EmotionCb> emotion_cbs;
 };
@@ -59,6 +59,7 @@ namespace state
         WAKEWORD,       // Wakeword detected
         SERVER_COMMAND, // remote trigger
         SYSTEM,         // system-triggered (e.g. auto-listen)
+        LOCAL_COMMAND,  // on-device voice command (CommandRecognizer)
         UNKNOWN         // fallback
     };
 
@@ -0,0 +1,71 @@
+#include "TaskPlan.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "esp_log.h"
+
+static const char *TAG = "TaskPlan";
+
+TaskPlan &TaskPlan::instance()
+{
+    static TaskPlan inst;
+    return inst;
+}
+
+bool TaskPlan::install(const Table &table)
+{
+    for (size_t i = 0; i < TASK_COUNT; i++)
+    {
+        const Spec &s = table[i];
+        const bool core_ok = s.core == 0 || s.core == 1 || s.core == tskNO_AFFINITY;
+        if (!s.name || s.stack == 0 || !core_ok || s.priority >= configMAX_PRIORITIES)
+        {
+            ESP_LOGE(TAG, "Bad plan entry %u (%s)", (unsigned)i, s.name ? s.name : "unnamed");
+            return false;
+        }
+    }
+    table_ = table;
+    installed_ = true;
+    return true;
+}
+
+bool TaskPlan::spawn(Id id, TaskFunction_t fn, void *arg, TaskHandle_t *out, uint32_t min_stack)
+{
+    if (id >= TASK_COUNT || !installed_)
+    {
+        ESP_LOGE(TAG, "spawn(%u): no plan installed", (unsigned)id);
+        return false;
+    }
+
+    const Spec &s = table_[id];
+    const uint32_t stack = std::max(s.stack, min_stack);
+    used_stack_[id] = stack;
+    if (xTaskCreatePinnedToCore(fn, s.name, stack, arg, s.priority, out, s.core) != pdPASS)
+    {
+        ESP_LOGE(TAG, "Failed to create %s (%u B)", s.name, (unsigned)stack);
+        if (out)
+            *out = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void TaskPlan::print() const
+{
+    if (!installed_)
+    {
+        ESP_LOGW(TAG, "No plan installed");
+        return;
+    }
+    ESP_LOGI(TAG, "%-16s %4s %4s %7s", "task", "core", "prio", "stack");
+    for (size_t i = 0; i < TASK_COUNT; i++)
+    {
+        const Spec &s = table_[i];
+        char core[4] = "any";
+        if (s.core != tskNO_AFFINITY)
+            snprintf(core, sizeof(core), "%d", (int)s.core);
+        ESP_LOGI(TAG, "%-16s %4s %4u %7u", s.name, core, (unsigned)s.priority,
+                 (unsigned)stackBytes(static_cast<Id>(i)));
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+/**
+ * TaskPlan
+ * ============================================================================
+ * Bảng đặt task (core, priority, stack) cho mọi task dài hạn của firmware.
+ * DeviceProfile cài bảng của board (device_cfg::tasks) một lần lúc setup;
+ * các module tạo task qua spawn(id, ...) thay vì tự ghi số core / prio, nên
+ * phân bổ CPU đọc được ở một chỗ và đổi không cần sửa module.
+ *
+ * - spawn(): xTaskCreatePinnedToCore theo bảng; min_stack cho task có stack
+ *   phụ thuộc runtime (encoder / decoder task: encoderStackBytes() /
+ *   decoderStackBytes() của codec).
+ * - stackBytes(id): stack thật đã cấp (MemTelemetry::registerTask).
+ * - print(): bảng đang dùng (lệnh serial "tasks").
+ *
+ * Chưa install() → spawn() trả false (không có giá trị mặc định ngầm).
+ */
+class TaskPlan
+{
+public:
+    enum Id : uint8_t
+    {
+        CONTROLLER,  // AppController event loop
+        DISPLAY,     // DisplayManager render loop
+        AUDIO_MIC,   // I2S RX → mic ring (+ KWS feed)
+        AUDIO_ENC,   // AEC / VAD / encode → uplink ring
+        AUDIO_DEC,   // downlink decode + PLC + resample → speaker ring
+        AUDIO_SPK,   // speaker ring → I2S TX
+        AUDIO_KWS,   // wake-word inference
+        NET_LOOP,    // NetworkManager update (WS / MQTT / status)
+        NET_UPLINK,  // mic ring → WS binary
+        WIFI_RETRY,  // one-shot STA reconnect with stored credentials
+        BLE_CONFIG,  // BLE provisioning session
+        OTA_WRITER,  // OTA chunk → flash
+        CONSOLE,     // serial debug console
+        ASSET_FETCH, // animation pack download + preload (idle only)
+        OTA_FETCH,   // OTA image download (HTTP(S) range requests)
+        MEDIA_FETCH, // media stream download (HTTP(S) range requests) → prebuffer
+        MEDIA_DEC,   // media prebuffer → decode + resample → media PCM ring
+        TASK_COUNT
+    };
+
+    struct Spec
+    {
+        const char *name = nullptr;
+        uint32_t stack = 0;      // bytes
+        UBaseType_t priority = 1;
+        BaseType_t core = tskNO_AFFINITY; // 0, 1 or tskNO_AFFINITY
+    };
+
+    using Table = std::array<Spec, TASK_COUNT>;
+
+    static TaskPlan &instance();
+
+    // Validate and take the board table; false (table not taken) on an
+    // entry without name / stack or with a bad core.
+    bool install(const Table &table);
+    bool installed() const { return installed_; }
+
+    const Spec &spec(Id id) const { return table_[id]; }
+    // Stack given to the last spawn() of `id` (plan value until then)
+    uint32_t stackBytes(Id id) const { return used_stack_[id] ? used_stack_[id] : table_[id].stack; }
+
+    bool spawn(Id id, TaskFunction_t fn, void *arg, TaskHandle_t *out = nullptr, uint32_t min_stack = 0);
+
+    void print() const;
+
+private:
+    TaskPlan() = default;
+
+    Table table_{};
+    uint32_t used_stack_[TASK_COUNT] = {};
+    bool installed_ = false;
+};
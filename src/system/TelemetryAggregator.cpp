@@ -0,0 +1,147 @@
+#include "TelemetryAggregator.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    // Deadbands: smaller moves are noise, not news
+    constexpr int32_t HEAP_DEADBAND = 2048;  // bytes
+    constexpr int32_t RSSI_DEADBAND = 3;     // dB
+    constexpr int32_t BATTERY_DEADBAND = 1;  // %
+    constexpr int32_t RTT_DEADBAND = 20;     // ms
+    constexpr int32_t LAT_DEADBAND_MS = 5;   // or LAT_DEADBAND_PCT of the value
+    constexpr int32_t LAT_DEADBAND_PCT = 10;
+
+    bool latencyMoved(uint16_t sent, uint32_t now_ms)
+    {
+        const int32_t band = std::max<int32_t>(LAT_DEADBAND_MS, sent * LAT_DEADBAND_PCT / 100);
+        const int32_t d = static_cast<int32_t>(now_ms) - sent;
+        return d > band || -d > band;
+    }
+} // namespace
+
+void TelemetryAggregator::addSample(const Sample &s)
+{
+    heap_last_ = s.heap_free;
+    heap_min_ = std::min(heap_min_, s.heap_free);
+    if (s.rssi != 0)
+    {
+        rssi_sum_ += s.rssi;
+        rssi_min_ = rssi_n_ ? std::min(rssi_min_, s.rssi) : s.rssi;
+        rssi_n_++;
+    }
+    battery_ = s.battery;
+    slo_ |= s.slo; // a breach within the window is reported even if it cleared
+    if (s.rtt_ms)
+        rtt_ms_ = s.rtt_ms;
+    link_ = s.link;
+    roams_ = s.roams;
+    have_sample_ = true;
+    stats_.samples++;
+}
+
+bool TelemetryAggregator::build(jsonlite::Writer &w, uint32_t mqtt_dropped, uint32_t uptime_s)
+{
+    if (!have_sample_)
+        return false;
+
+    const bool keyframe = keyframe_due_ || (cfg_.keyframe_every && since_keyframe_ + 1 >= cfg_.keyframe_every);
+
+    int32_t values[METRIC_COUNT];
+    bool present[METRIC_COUNT];
+    values[HEAP] = static_cast<int32_t>(heap_last_);
+    values[HEAP_MIN] = static_cast<int32_t>(heap_min_);
+    values[RSSI] = rssi_n_ ? rssi_sum_ / rssi_n_ : 0;
+    values[RSSI_MIN] = rssi_min_;
+    values[BATTERY] = battery_;
+    values[DROPS] = static_cast<int32_t>(mqtt_dropped);
+    values[SLO] = static_cast<int32_t>(slo_);
+    values[RTT] = static_cast<int32_t>(rtt_ms_);
+    values[LINK] = link_;
+    values[ROAMS] = static_cast<int32_t>(roams_);
+    static constexpr int32_t DEADBAND[METRIC_COUNT] = {HEAP_DEADBAND, HEAP_DEADBAND, RSSI_DEADBAND, RSSI_DEADBAND,
+                                                       BATTERY_DEADBAND, 0, 0, RTT_DEADBAND, 0, 0};
+    static constexpr const char *KEY[METRIC_COUNT] = {"heap", "heap_min", "rssi", "rssi_min", "bat",
+                                                      "drop", "slo",      "rtt",  "lq",       "roam"};
+
+    bool any = false;
+    for (int m = 0; m < METRIC_COUNT; m++)
+    {
+        bool valid = true;
+        if (m == RSSI || m == RSSI_MIN)
+            valid = rssi_n_ > 0;
+        else if (m == RTT || m == LINK)
+            valid = values[m] != 0; // link monitor off / no verdict yet
+        present[m] = valid && changed(tracks_[m], values[m], DEADBAND[m], keyframe);
+        any |= present[m];
+    }
+
+    LatencyTrace::SpanStats lat[LatencyTrace::SPAN_COUNT];
+    LatencyTrace::instance().stats(lat);
+    bool lat_present[LatencyTrace::SPAN_COUNT];
+    bool any_lat = false;
+    for (size_t i = 0; i < LatencyTrace::SPAN_COUNT; i++)
+    {
+        lat_present[i] = lat[i].count > 0 &&
+                         (keyframe || !lat_has_[i] || latencyMoved(lat_sent_[i][0], lat[i].p50_us / 1000) ||
+                          latencyMoved(lat_sent_[i][1], lat[i].p95_us / 1000));
+        any_lat |= lat_present[i];
+    }
+
+    // Window closes either way
+    heap_min_ = UINT32_MAX;
+    rssi_sum_ = 0;
+    rssi_n_ = 0;
+    slo_ = 0;
+
+    if (!any && !any_lat)
+    {
+        stats_.suppressed++;
+        since_keyframe_++;
+        return false;
+    }
+
+    w.beginObject().field("seq", ++seq_).field("up", uptime_s);
+    if (keyframe)
+        w.field("k", 1u);
+    for (int m = 0; m < METRIC_COUNT; m++)
+    {
+        if (present[m])
+            w.field(KEY[m], values[m]);
+    }
+    if (any_lat)
+    {
+        w.beginObject("lat");
+        for (size_t i = 0; i < LatencyTrace::SPAN_COUNT; i++)
+        {
+            if (!lat_present[i])
+                continue;
+            w.beginObject(LatencyTrace::spanName(static_cast<LatencyTrace::Span>(i)))
+                .field("p50", lat[i].p50_us / 1000)
+                .field("p95", lat[i].p95_us / 1000)
+                .endObject();
+        }
+        w.endObject();
+    }
+    w.endObject();
+    if (!w.ok())
+        return false; // tracks untouched: the same deltas go out next time
+
+    for (int m = 0; m < METRIC_COUNT; m++)
+    {
+        if (present[m])
+            tracks_[m] = {values[m], true};
+    }
+    for (size_t i = 0; i < LatencyTrace::SPAN_COUNT; i++)
+    {
+        if (!lat_present[i])
+            continue;
+        lat_sent_[i][0] = static_cast<uint16_t>(std::min<uint32_t>(lat[i].p50_us / 1000, UINT16_MAX));
+        lat_sent_[i][1] = static_cast<uint16_t>(std::min<uint32_t>(lat[i].p95_us / 1000, UINT16_MAX));
+        lat_has_[i] = true;
+    }
+    keyframe_due_ = false;
+    since_keyframe_ = keyframe ? 0 : since_keyframe_ + 1;
+    stats_.reports++;
+    return true;
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "JsonLite.hpp"
+#include "system/LatencyTrace.hpp"
+
+/**
+ * TelemetryAggregator
+ * ============================================================================
+ * Gom số liệu định kỳ (heap, RSSI, pin, latency voice turn, MQTT drop) thành
+ * một report gọn trên `<base>/telemetry` (QoS 0, không retain), thay cho việc
+ * gửi lại cả status document mỗi chu kỳ:
+ *  - addSample() mỗi sample_ms: heap / RSSI gộp theo cửa sổ (min, trung bình),
+ *    SLO audio bị vi phạm = OR các breachMask() trong cửa sổ; RTT / chất lượng
+ *    link / số lần roam lấy mẫu cuối (LinkQualityMonitor);
+ *  - build() mỗi report_ms: chỉ ghi metric đổi quá deadband so với lần gửi
+ *    trước (delta suppression); không có gì đổi → không publish (radio ngủ
+ *    tiếp). Cứ keyframe_every report (và sau mỗi lần MQTT nối lại) là một
+ *    keyframe đủ mọi metric, để server không phải đoán giá trị cũ.
+ *
+ * Report: {"seq":N,"up":s,"k":1?,"heap":..,"heap_min":..,"rssi":..,
+ *          "rssi_min":..,"bat":..,"drop":..,"slo":..,"rtt":..,"lq":..,"roam":..,
+ *          "lat":{"<span>":{"p50":..,"p95":..}}}
+ * (ms; key vắng = không đổi). Chỉ network task gọi (không thread-safe).
+ */
+class TelemetryAggregator
+{
+public:
+    struct Config
+    {
+        uint32_t report_ms = 60000;
+        uint8_t keyframe_every = 10; // 0 = keyframes only after reconnects
+    };
+
+    struct Sample
+    {
+        uint32_t heap_free = 0;
+        int8_t rssi = 0; // 0 = not associated
+        uint8_t battery = 0;
+        uint32_t slo = 0; // AudioHealth::breachMask()
+        uint32_t rtt_ms = 0; // smoothed WS RTT, 0 = none yet
+        uint8_t link = 0;    // LinkQualityMonitor::Quality, 0 = unknown
+        uint32_t roams = 0;
+    };
+
+    struct Stats
+    {
+        uint32_t reports = 0;
+        uint32_t suppressed = 0; // reports skipped: nothing past its deadband
+        uint32_t samples = 0;
+    };
+
+    void configure(const Config &cfg) { cfg_ = cfg; }
+    const Config &config() const { return cfg_; }
+
+    void addSample(const Sample &s);
+    // Next report carries every metric (new MQTT session, server request)
+    void forceKeyframe() { keyframe_due_ = true; }
+
+    // Close the window and write a report into w (an empty writer). False:
+    // nothing changed, do not publish. mqtt_dropped = MqttClient counter.
+    bool build(jsonlite::Writer &w, uint32_t mqtt_dropped, uint32_t uptime_s);
+
+    Stats stats() const { return stats_; }
+
+private:
+    enum Metric : uint8_t
+    {
+        HEAP,
+        HEAP_MIN,
+        RSSI,
+        RSSI_MIN,
+        BATTERY,
+        DROPS,
+        SLO,
+        RTT,
+        LINK,
+        ROAMS,
+        METRIC_COUNT
+    };
+
+    struct Track
+    {
+        int32_t last = 0;
+        bool sent = false;
+    };
+
+    // Value worth sending: first time, keyframe, or moved past the deadband
+    bool changed(const Track &t, int32_t v, int32_t deadband, bool keyframe) const
+    {
+        return keyframe || !t.sent || v - t.last > deadband || t.last - v > deadband;
+    }
+
+    Config cfg_{};
+    Stats stats_{};
+
+    // Current window
+    uint32_t heap_last_ = 0;
+    uint32_t heap_min_ = UINT32_MAX;
+    int32_t rssi_sum_ = 0;
+    uint16_t rssi_n_ = 0;
+    int8_t rssi_min_ = 0;
+    uint8_t battery_ = 0;
+    uint32_t slo_ = 0;
+    uint32_t rtt_ms_ = 0;
+    uint8_t link_ = 0;
+    uint32_t roams_ = 0;
+    bool have_sample_ = false;
+
+    Track tracks_[METRIC_COUNT];
+    uint16_t lat_sent_[LatencyTrace::SPAN_COUNT][2] = {}; // p50, p95 (ms)
+    bool lat_has_[LatencyTrace::SPAN_COUNT] = {};
+    uint32_t seq_ = 0;
+    uint8_t since_keyframe_ = 0;
+    bool keyframe_due_ = true;
+};